@@ -5,12 +5,141 @@
 #ifndef REGISTERS_ATOMICUTILS_HPP
 #define REGISTERS_ATOMICUTILS_HPP
 
+#include <cstdint> //for std::uint32_t, std::uintptr_t
+#include "susudefs.hpp" //for __forceinline
+
+//Статистика атомарных операций над регистрами. Включается определением REGISTERS_INSTRUMENTATION и позволяет
+//оценить, насколько часто задачи и прерывания конкурируют за одни и те же регистры. Счетчики обновляются после
+//завершения операции и сами не защищены, поэтому при одновременном обновлении из прерывания возможна потеря
+//одного отсчета, для статистики это допустимо.
+struct AtomicStatistics
+{
+#if defined(REGISTERS_INSTRUMENTATION)
+  inline static volatile std::uint32_t setCount = 0U ;   //Количество атомарных установок
+  inline static volatile std::uint32_t retryCount = 0U ; //Общее количество повторов из-за сброса монитора
+  inline static volatile std::uint32_t maxRetries = 0U ; //Максимальное количество повторов одной установки
+
+  static void Reset()
+  {
+    setCount = 0U ;
+    retryCount = 0U ;
+    maxRetries = 0U ;
+  }
+#endif
+
+  __forceinline static void OnSet(std::uint32_t retries)
+  {
+#if defined(REGISTERS_INSTRUMENTATION)
+    setCount = setCount + 1U ;
+    retryCount = retryCount + retries ;
+    if (retries > maxRetries)
+    {
+      maxRetries = retries ;
+    }
+#else
+    static_cast<void>(retries) ;
+#endif
+  }
+} ;
+
+#if defined(REGISTERS_TRACE)
+#include "registertrace.hpp" //for RegisterTrace
+#endif
+
+//Атомарная установка обращается к регистру в обход политики доступа, поэтому при включенной трассировке
+//(REGISTERS_TRACE) она записывается в RegisterTrace одной записью с новым значением битового поля
+struct AtomicTrace
+{
+  __forceinline static void OnSet(std::uintptr_t address, std::uint32_t fieldValue)
+  {
+#if defined(REGISTERS_TRACE)
+    RegisterTrace::Record(address, fieldValue, RegisterAccessKind::AtomicSet) ;
+#else
+    static_cast<void>(address) ;
+    static_cast<void>(fieldValue) ;
+#endif
+  }
+} ;
+
+#if defined(REGISTERS_HOST_ACCESS)
+#include "memoryaccess.hpp" // for UntracedMemoryAccess
+
+//На хосте регистры эмулируются и доступ к ним однопоточный, поэтому атомарность не нужна
+template <typename T>
+struct AtomicUtils
+{
+  static void Set(std::uintptr_t address, T mask, T value, T offset)
+  {
+    T newRegValue = UntracedMemoryAccess::Read<T>(address) ;
+    newRegValue &= ~(mask << (offset));
+    newRegValue |= (value << (offset));
+    UntracedMemoryAccess::Write<T>(address, newRegValue) ;
+    AtomicStatistics::OnSet(0U) ;
+    AtomicTrace::OnSet(address, static_cast<std::uint32_t>(value << offset)) ;
+  }
+};
+
+#elif defined(__riscv)
+
+#if !defined(__riscv_atomic)
+#error "AtomicUtils requires RISC-V core with A extension"
+#endif
+
+//На RISC-V (GD32VF103) поле, все биты которого сбрасываются или устанавливаются, изменяется одной атомарной
+//командой памяти amoand.w или amoor.w: шина выполняет ее за одну операцию и никогда не повторяет. Остальные
+//значения поля записываются эксклюзивными чтением и записью lr.w/sc.w, как на Cortex-M3/M4: если между ними
+//регистр был изменен, то sc.w не выполняет запись и операция повторяется. Две команды amoand.w и amoor.w
+//здесь не подходят, между ними поле кратковременно равно 0 и это значение видит прерывание и аппаратура.
+template <typename T>
+struct AtomicUtils
+{
+  static_assert(sizeof(T) == sizeof(std::uint32_t), "AMO and LR/SC instructions work with 32 bit words only") ;
+
+  __forceinline static void Set(std::uintptr_t address, T mask, T value, T offset)
+  {
+    const T fieldMask = static_cast<T>(mask << offset) ;
+    const T fieldValue = static_cast<T>((value << offset) & fieldMask) ;
+    std::uint32_t retries = 0U ;
+    if (fieldValue == T{0U})
+    {
+      __asm volatile ("amoand.w zero, %1, (%0)" : : "r"(address), "r"(static_cast<T>(~fieldMask)) : "memory") ;
+    }
+    else if (fieldValue == fieldMask)
+    {
+      __asm volatile ("amoor.w zero, %1, (%0)" : : "r"(address), "r"(fieldValue) : "memory") ;
+    }
+    else
+    {
+      //Между lr.w и sc.w только команды базового набора без переходов назад, поэтому sc.w рано или поздно
+      //выполнится успешно
+      T newRegValue ;
+      __asm volatile ("1: lr.w %0, (%2)\n"
+                      "   and %0, %0, %3\n"
+                      "   or %0, %0, %4\n"
+                      "   sc.w %0, %0, (%2)\n"
+                      "   beqz %0, 2f\n"
+                      "   addi %1, %1, 1\n"
+                      "   j 1b\n"
+                      "2:"
+                      : "=&r"(newRegValue), "+&r"(retries)
+                      : "r"(address), "r"(static_cast<T>(~fieldMask)), "r"(fieldValue)
+                      : "memory") ;
+    }
+    AtomicStatistics::OnSet(retries) ;
+    AtomicTrace::OnSet(address, fieldValue) ;
+  }
+};
+
+#elif defined(__ARM_FEATURE_LDREX) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
 #include "intrinsics.h" // for __STREX, __LDREX, __CLREX
-#include <cstdint> //for std::uint32_t
 
+//На Cortex-M3/M4 используются эксклюзивные чтение и запись, если между ними регистр был изменен
+//(например, прерыванием), то запись не выполняется и операция повторяется
 template <typename T>
 struct AtomicUtils
-{  
+{
+  static_assert(sizeof(T) == sizeof(std::uint32_t), "LDREX and STREX are used for 32 bit registers only") ;
+
   static bool CompareExchange(volatile T* ptr, T oldValue, T newValue)
   {
     using namespace std ;
@@ -25,24 +154,53 @@ struct AtomicUtils
     return false;
   }
 
-  static void Set(T address, T mask, T value, T offset)
+  __forceinline static void Set(std::uintptr_t address, T mask, T value, T offset)
   {
-    T oldRegValue ;
+    volatile T* ptr = reinterpret_cast<volatile T *>(address) ;
+    std::uint32_t retries = 0U ;
     T newRegValue ;
 
-    do
+    for (;;)
     {
-      oldRegValue = *reinterpret_cast<volatile  T*>(address);
-      newRegValue = oldRegValue;
+      newRegValue = static_cast<T>(__LDREX(ptr)) ; // эксклюзивно читаем значение регистра
       newRegValue &= ~(mask << (offset));
       newRegValue |= (value << (offset));
-    } while (
-      !AtomicUtils<T>::CompareExchange(reinterpret_cast<volatile T *>(address),
-                                             oldRegValue,
-                                             newRegValue)
-      ) ;
+      // пытаемся эксклюзивно записать новое значение, если монитор сброшен, то повторяем
+      if (__STREX(static_cast<std::uint32_t>(newRegValue), ptr) == 0U)
+      {
+        break ;
+      }
+      ++retries ;
+    }
+    AtomicStatistics::OnSet(retries) ;
+    AtomicTrace::OnSet(address, static_cast<std::uint32_t>(value << offset)) ;
   }
 
 };
 
+#else
+#include "intrinsics.h" // for __get_PRIMASK, __set_PRIMASK, __disable_interrupt
+
+//На Cortex-M0 (STM32F0x1) нет эксклюзивного доступа к памяти, поэтому чтение-модификация-запись выполняется
+//с запрещенными прерываниями. Участок занимает несколько команд, предыдущее состояние PRIMASK восстанавливается,
+//поэтому метод можно вызывать и из прерывания, и из критической секции.
+template <typename T>
+struct AtomicUtils
+{
+  __forceinline static void Set(std::uintptr_t address, T mask, T value, T offset)
+  {
+    const auto primask = __get_PRIMASK() ;
+    __disable_interrupt() ;
+    T newRegValue = *reinterpret_cast<volatile T*>(address) ;
+    newRegValue &= ~(mask << (offset));
+    newRegValue |= (value << (offset));
+    *reinterpret_cast<volatile T*>(address) = newRegValue ;
+    __set_PRIMASK(primask) ;
+    AtomicStatistics::OnSet(0U) ;
+    AtomicTrace::OnSet(address, static_cast<std::uint32_t>(value << offset)) ;
+  }
+};
+
+#endif //defined(REGISTERS_HOST_ACCESS)
+
 #endif //REGISTERS_ATOMICUTILS_HPP
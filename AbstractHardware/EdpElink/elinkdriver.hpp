@@ -7,6 +7,7 @@
 
 #include "susudefs.hpp"  //for __forceinline
 #include "systemclock.hpp" //for SystemClock
+#include "waituntil.hpp" //for WaitFor
 
 
 enum class ElinkDriverCommands : std::uint8_t
@@ -156,145 +157,102 @@ struct BlackAndWhite
 template <typename Spi, typename ResetPin, typename DcPin, typename CsPin, typename BusyPin, typename Atribute>
 struct ElinkDriver
 {
- 
-  static void SendCommand(ElinkDriverCommands Command)
+  //Методы возвращают WaitStatus::Timeout и прекращают обмен, если байт не передан по SPI или дисплей не
+  //освободился за BusyTimeout
+  static WaitStatus SendCommand(ElinkDriverCommands Command)
   {
     //PinsPack<DcPin, CsPin>::Reset() ;    //DEV_Digital_Write(EPD_DC_PIN, 0);   //CsDEV_Digital_Write(EPD_CS_PIN, 0);
     DcPin::Reset() ;
     CsPin::Reset() ;
-    Spi::WriteByte(static_cast<std::uint8_t>(Command)) ; //    DEV_SPI_WriteByte(Reg);
+    const bool isWritten = Spi::WriteByte(static_cast<std::uint8_t>(Command)) ; //    DEV_SPI_WriteByte(Reg);
     CsPin::Set() ; //    DEV_Digital_Write(EPD_CS_PIN, 1);
     CsPin::Set() ;
+    return isWritten ? WaitStatus::Ready : WaitStatus::Timeout ;
   }
   
   
-  static void SendData(std::uint8_t data)
+  static WaitStatus SendData(std::uint8_t data)
   {
     DcPin::Set() ;//DEV_Digital_Write(EPD_DC_PIN, 1);
     CsPin::Reset() ; //DEV_Digital_Write(EPD_CS_PIN, 0);
-    Spi::WriteByte(data) ; //    DEV_SPI_WriteByte(Data);
+    const bool isWritten = Spi::WriteByte(data) ; //    DEV_SPI_WriteByte(Data);
     CsPin::Set() ; //    DEV_Digital_Write(EPD_CS_PIN, 1);
+    return isWritten ? WaitStatus::Ready : WaitStatus::Timeout ;
   }
   
 
-  __forceinline static void Refresh()
+  __forceinline static WaitStatus Refresh()
   {
-    SetLut() ;
-    SendCommand(ElinkDriverCommands::DisplayRefresh) ;
+    if ((SetLut() != WaitStatus::Ready) || (SendCommand(ElinkDriverCommands::DisplayRefresh) != WaitStatus::Ready))
+    {
+      return WaitStatus::Timeout ;
+    }
     SystemClock::SetDelayMs(100) ;
-    WaitUntilBusy() ;
+    return WaitUntilBusy() ;
   }
 
   __forceinline template<typename = typename std::enable_if_t<Atribute::template HasAttribute<BlackAndWhite>()>>
-  static void RefreshQuick()
+  static WaitStatus RefreshQuick()
   {
-    SetLutQuick() ;
-    SendCommand(ElinkDriverCommands::DisplayRefresh) ;       
-    WaitUntilBusy() ;
+    if ((SetLutQuick() != WaitStatus::Ready) ||
+        (SendCommand(ElinkDriverCommands::DisplayRefresh) != WaitStatus::Ready))
+    {
+      return WaitStatus::Timeout ;
+    }
+    return WaitUntilBusy() ;
   }
   
   
-  static void SetLut()
+  static WaitStatus SetLut()
   {
     
-    SendCommand(ElinkDriverCommands::VcomLut);         //g vcom
-    for(std::uint8_t count = 0; count < 44U; ++count) 
-    {
-      SendData(EPD_4IN2_lut_vcom0[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::W2wLut);
-    for(std::uint8_t count = 0; count < 42; ++count) 
-    {
-      SendData(EPD_4IN2_lut_ww[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::B2wLut);
-    for(std::uint8_t count = 0; count < 42U; ++count) 
-    {
-      SendData(EPD_4IN2_lut_bw[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::W2bLut);
-    for(std::uint8_t count = 0; count < 42U; ++count)  
-    {
-      SendData(EPD_4IN2_lut_wb[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::B2bLut);
-    for(std::uint8_t count = 0; count < 42U; ++count) 
+    if ((SendLut(ElinkDriverCommands::VcomLut, EPD_4IN2_lut_vcom0) != WaitStatus::Ready) ||         //g vcom
+        (SendLut(ElinkDriverCommands::W2wLut, EPD_4IN2_lut_ww) != WaitStatus::Ready) ||
+        (SendLut(ElinkDriverCommands::B2wLut, EPD_4IN2_lut_bw) != WaitStatus::Ready) ||
+        (SendLut(ElinkDriverCommands::W2bLut, EPD_4IN2_lut_wb) != WaitStatus::Ready))
     {
-      SendData(EPD_4IN2_lut_bb[count]);
+      return WaitStatus::Timeout ;
     }
+    return SendLut(ElinkDriverCommands::B2bLut, EPD_4IN2_lut_bb) ;
   }
   
   template<typename = typename std::enable_if_t<Atribute::template HasAttribute<BlackAndWhite>()>> 
-  static void SetLutQuick()
+  static WaitStatus SetLutQuick()
   {
     
-    SendCommand(ElinkDriverCommands::VcomLut);         //g vcom
-    for(std::uint8_t count = 0; count < 44U; ++count) 
-    {
-      SendData(EPD_4IN2_lut_vcom0_quick[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::W2wLut);
-    for(std::uint8_t count = 0; count < 42; ++count) 
+    if ((SendLut(ElinkDriverCommands::VcomLut, EPD_4IN2_lut_vcom0_quick) != WaitStatus::Ready) ||   //g vcom
+        (SendLut(ElinkDriverCommands::W2wLut, EPD_4IN2_lut_ww_quick) != WaitStatus::Ready) ||
+        (SendLut(ElinkDriverCommands::B2wLut, EPD_4IN2_lut_bw_quick) != WaitStatus::Ready) ||
+        (SendLut(ElinkDriverCommands::W2bLut, EPD_4IN2_lut_wb_quick) != WaitStatus::Ready))
     {
-      SendData(EPD_4IN2_lut_ww_quick[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::B2wLut);
-    for(std::uint8_t count = 0; count < 42U; ++count) 
-    {
-      SendData(EPD_4IN2_lut_bw_quick[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::W2bLut);
-    for(std::uint8_t count = 0; count < 42U; ++count)  
-    {
-      SendData(EPD_4IN2_lut_wb_quick[count]);
-    }
-
-    SendCommand(ElinkDriverCommands::B2bLut);
-    for(std::uint8_t count = 0; count < 42U; ++count) 
-    {
-      SendData(EPD_4IN2_lut_bb_quick[count]);
+      return WaitStatus::Timeout ;
     }
+    return SendLut(ElinkDriverCommands::B2bLut, EPD_4IN2_lut_bb_quick) ;
   }
   
   __forceinline  template<typename = typename std::enable_if_t<Atribute::template HasAttribute<BlackAndWhite>()>>    
-  static void Init()
+  static WaitStatus Init()
   {
     Reset();
-    SendCommand(ElinkDriverCommands::BoosterSoftStart);
-    SendData(BtphaDefaultValue) ;
-    SendData(BtphbDefaultValue) ;
-    SendData(BtphcDefaultValue) ;
-    
-    SendCommand(ElinkDriverCommands::PowerOff);
-    WaitUntilBusy() ;
-    
-    SendCommand(ElinkDriverCommands::PowerOn);
-    WaitUntilBusy() ;
-  
-    SendCommand(ElinkDriverCommands::PanelSetting) ;
-    SendData(0x3f); // KW-BF   KWR-AF	BWROTP 0f	BWOTP 1f
-
-    SendCommand(ElinkDriverCommands::PllControl); // PLL setting
-    SendData(0x3C); // 3A 100HZ   29 150Hz 39 200HZ	31 171HZ
- 
-    SendCommand(ElinkDriverCommands::VcmDcSetting); // vcom_DC setting
-    SendData(0x3A);
-
-    SendCommand(ElinkDriverCommands::VcomAndDataIntervalSetting); // VCOM AND DATA INTERVAL SETTING
-    SendData(0x97); // 97white border 77black border		VBDF 17|D7 VBDW 97 VBDB 57		VBDF F7 VBDW 77 VBDB 37  VBDR B7
-
-    SetLut();
+    if ((Send(ElinkDriverCommands::BoosterSoftStart, BtphaDefaultValue, BtphbDefaultValue, BtphcDefaultValue) !=
+         WaitStatus::Ready) ||
+        (SendCommand(ElinkDriverCommands::PowerOff) != WaitStatus::Ready) ||
+        (WaitUntilBusy() != WaitStatus::Ready) ||
+        (SendCommand(ElinkDriverCommands::PowerOn) != WaitStatus::Ready) ||
+        (WaitUntilBusy() != WaitStatus::Ready) ||
+        (Send(ElinkDriverCommands::PanelSetting, 0x3f) != WaitStatus::Ready) || // KW-BF   KWR-AF	BWROTP 0f	BWOTP 1f
+        (Send(ElinkDriverCommands::PllControl, 0x3C) != WaitStatus::Ready) || // PLL setting: 3A 100HZ   29 150Hz 39 200HZ	31 171HZ
+        (Send(ElinkDriverCommands::VcmDcSetting, 0x3A) != WaitStatus::Ready) || // vcom_DC setting
+        // VCOM AND DATA INTERVAL SETTING: 97white border 77black border		VBDF 17|D7 VBDW 97 VBDB 57		VBDF F7 VBDW 77 VBDB 37  VBDR B7
+        (Send(ElinkDriverCommands::VcomAndDataIntervalSetting, 0x97) != WaitStatus::Ready))
+    {
+      return WaitStatus::Timeout ;
+    }
+    return SetLut();
   }
   
   
-  static void UpdatePartialWindow(const std::uint8_t *bufferBlack,
+  static WaitStatus UpdatePartialWindow(const std::uint8_t *bufferBlack,
                                std::uint16_t x,
                                std::uint16_t y,
                                std::uint16_t width,
@@ -303,58 +261,55 @@ struct ElinkDriver
   {
     const size_t counts  = (width / 8) * height ;
     
-    SetPartialMode() ;
-    SendCommand(ElinkDriverCommands::PartialWindow) ;
-    SendData(x >> 8U) ;
-    SendData(x & 0xf8) ;
-    SendData(((x & 0xf8) + width - 1U) >> 8) ;
-    SendData(((x & 0xf8) + width - 1U) | 0x07U) ;
-    SendData(y >> 8) ;
-    SendData( y & 0xff) ;
-    SendData((y + height - 1U) >> 8U) ;
-    SendData((y + height - 1U) & 0xff) ;
-    SendData(0x01) ;
-    SendCommand(ElinkDriverCommands::DataStartTransmission2);
+    if ((SetPartialMode() != WaitStatus::Ready) ||
+        (Send(ElinkDriverCommands::PartialWindow,
+              x >> 8U,
+              x & 0xf8,
+              ((x & 0xf8) + width - 1U) >> 8,
+              ((x & 0xf8) + width - 1U) | 0x07U,
+              y >> 8,
+              y & 0xff,
+              (y + height - 1U) >> 8U,
+              (y + height - 1U) & 0xff,
+              0x01) != WaitStatus::Ready) ||
+        (SendCommand(ElinkDriverCommands::DataStartTransmission2) != WaitStatus::Ready))
+    {
+      return WaitStatus::Timeout ;
+    }
     for (size_t j = 0; j < counts; ++j)
     {
-       SendData(bufferBlack[j]);
+      if (SendData(bufferBlack[j]) != WaitStatus::Ready)
+      {
+        return WaitStatus::Timeout ;
+      }
+    }
+    if (SendCommand(ElinkDriverCommands::PartialWindow) != WaitStatus::Ready)
+    {
+      return WaitStatus::Timeout ;
     }
-    SendCommand(ElinkDriverCommands::PartialWindow) ;
  //   ClearPartialMode() ;
-    RefreshQuick();
+    return RefreshQuick();
   }
   
-  static void SetPartialMode()
+  static WaitStatus SetPartialMode()
   {
-    SendCommand(ElinkDriverCommands::PartialIn) ;
+    return SendCommand(ElinkDriverCommands::PartialIn) ;
   }
  
-  static void ClearPartialMode()
+  static WaitStatus ClearPartialMode()
   {
-    SendCommand(ElinkDriverCommands::PartialOut) ;
+    return SendCommand(ElinkDriverCommands::PartialOut) ;
   }
   
-  static void Clear()
+  static WaitStatus Clear()
   {
  
-    SendCommand(ElinkDriverCommands::DataStartTransmission1) ;
-    for (std::uint16_t j = 0; j < RealDisplayHeight;  ++j)
-    {
-      for (std::uint16_t i = 0; i < RealDisplayWidth; ++i)
-      {
-        SendData(BlackColor) ;
-      }
-    }
-  
-    SendCommand(ElinkDriverCommands::DataStartTransmission2);
-   for (std::uint16_t j = 0; j < RealDisplayHeight; ++j)
+    if ((Fill(ElinkDriverCommands::DataStartTransmission1, BlackColor) != WaitStatus::Ready) ||
+        (Fill(ElinkDriverCommands::DataStartTransmission2, BlackColor) != WaitStatus::Ready))
     {
-      for (std::uint16_t i = 0; i < RealDisplayWidth; ++i) 
-      {
-        SendData(BlackColor);
-      }
+      return WaitStatus::Timeout ;
     }
-    Refresh();
+    return Refresh();
  
   }
   
@@ -363,7 +318,7 @@ struct ElinkDriver
 function :	Sends the image buffer in RAM to e-Paper and displays
 parameter:
 ******************************************************************************/
-static void Display(const uint8_t *blackimage, const uint8_t *ryimage)
+static WaitStatus Display(const uint8_t *blackimage, const uint8_t *ryimage)
 {   
  // SendCommand(ElinkDriverCommands::DataStartTransmission1);
  // for (std::uint16_t j = 0; j < RealDisplayHeight;  ++j) 
@@ -374,18 +329,70 @@ static void Display(const uint8_t *blackimage, const uint8_t *ryimage)
  //    }
  // }
 
-    SendCommand(ElinkDriverCommands::DataStartTransmission2);
+    if (SendCommand(ElinkDriverCommands::DataStartTransmission2) != WaitStatus::Ready)
+    {
+      return WaitStatus::Timeout ;
+    }
     for (std::uint16_t j = 0; j < RealDisplayHeight; ++j)
     {
       for (std::uint16_t i = 0; i < RealDisplayWidth; ++i) 
       {
-           SendData(ryimage[i + j * RealDisplayWidth]);
+           if (SendData(ryimage[i + j * RealDisplayWidth]) != WaitStatus::Ready)
+           {
+             return WaitStatus::Timeout ;
+           }
       }
     }
-   RefreshQuick();
+   return RefreshQuick();
 }
   
 private:
+  //Команда с данными, передача прекращается на первом не переданном байте
+  template<typename ...Data>
+  static WaitStatus Send(ElinkDriverCommands command, Data ...data)
+  {
+    if (SendCommand(command) != WaitStatus::Ready)
+    {
+      return WaitStatus::Timeout ;
+    }
+    const bool isSent = ((SendData(static_cast<std::uint8_t>(data)) == WaitStatus::Ready) && ...) ;
+    return isSent ? WaitStatus::Ready : WaitStatus::Timeout ;
+  }
+
+  template<std::size_t size>
+  static WaitStatus SendLut(ElinkDriverCommands command, const unsigned char (&lut)[size])
+  {
+    if (SendCommand(command) != WaitStatus::Ready)
+    {
+      return WaitStatus::Timeout ;
+    }
+    for (std::size_t count = 0U; count < size; ++count)
+    {
+      if (SendData(lut[count]) != WaitStatus::Ready)
+      {
+        return WaitStatus::Timeout ;
+      }
+    }
+    return WaitStatus::Ready ;
+  }
+
+  //Заполнение всего экрана одним значением
+  static WaitStatus Fill(ElinkDriverCommands command, std::uint8_t value)
+  {
+    if (SendCommand(command) != WaitStatus::Ready)
+    {
+      return WaitStatus::Timeout ;
+    }
+    for (std::uint32_t i = 0U; i < static_cast<std::uint32_t>(RealDisplayHeight) * RealDisplayWidth; ++i)
+    {
+      if (SendData(value) != WaitStatus::Ready)
+      {
+        return WaitStatus::Timeout ;
+      }
+    }
+    return WaitStatus::Ready ;
+  }
+
   __forceinline static void Reset()
   {
     ResetPin::Set() ;
@@ -402,12 +409,23 @@ private:
     return (result == static_cast<decltype(result)> (1U)) ;
   }
   
-  __forceinline static void WaitUntilBusy()
+  //Стратегия ожидания дисплея: линия BUSY опрашивается раз в 10 мс
+  struct DelayWait
   {
-    while (!IsBusy())
+    __forceinline static void Pause(std::uint32_t poll)
     {
+      static_cast<void>(poll) ;
       SystemClock::SetDelayMs(10) ;
     }
+  } ;
+
+  //Полное обновление дисплея занимает около 4 секунд, ожидание ограничено 10 секундами, чтобы отключенный
+  //дисплей не останавливал программу
+  static constexpr std::uint32_t BusyTimeout = 1000U ;
+
+  __forceinline static WaitStatus WaitUntilBusy()
+  {
+    return WaitFor([]() { return IsBusy() ; }, BusyTimeout, DelayWait{}) ;
   }
 };
 
@@ -12,6 +12,7 @@
 #include "flashregisters.hpp" // for Flash
 #include <cstddef>  // for std::size_t
 #include <cassert>  // for assert
+#include "waituntil.hpp" // for WaitUntil, BackoffWait
 
 //static_assert(STM32F303xx == 1,
 //              "This implementation only for STM32F303R micro") ;
@@ -36,15 +37,16 @@ class FlashWrapper
       FLASH::CR::LOCK::Enable::Set() ;
     }
     
-    __forceinline static void Erase(const std::size_t addr)
+    //Методы стирания и записи возвращают false, если Flash не освободилась за отведенное время
+    __forceinline static bool Erase(const std::size_t addr)
     {
     //  assert((addr >= SectorsStartAddr) && (addr < (SectorsStartAddr + SectorsCount * SectorsSize))) ;
-      EraseSector(addr) ;
+      return EraseSector(addr) ;
     }
     
     
     template<typename T>
-    static void Write( T value, const T * const pDest)
+    static bool Write( T value, const T * const pDest)
     {
       //Проверим, что адрес не выходит за границу страницы, предполагаем, что все одной странице
       assert(((reinterpret_cast<std::size_t>(&pDest) - SectorsStartAddr) / SectorsSize ) ==
@@ -52,8 +54,10 @@ class FlashWrapper
       
       assert(pDest != nullptr) ;
       
-      while(!IsReady())
+      if (!WaitReady(ProgramTimeout))
       {
+        Lock() ;
+        return false ;
       }
 
       FLASH::CR::PG::StartProgram::Set() ;
@@ -64,36 +68,44 @@ class FlashWrapper
       //если размер не четный, то писать все равно надо пол слова.
       std::size_t Size = ((sizeof(T) % 2) == 0) ? sizeof(T) / 2 : (sizeof(T) / 2 + 1) ;
         
-      for(std::size_t i = 0U ; i < Size ; ++i)
+      bool result = true ;
+      for(std::size_t i = 0U ; (i < Size) && result ; ++i)
       {
         pDestination[i] = pSource[i] ;
-        while(!IsReady())
-        {
-        }
-        while (FLASH::SR::EOP::NotComplete::IsSet())
-        {
-        };
+        result = WaitComplete(ProgramTimeout) ;
         FLASH::SR::EOP::NotComplete::Set() ;
       }
         
       FLASH::CR::PG::Clear::Set() ;
       Lock();
+      return result ;
     }
 
 
 
   private:
 
-    __forceinline static bool IsReady()
+    //Ожидание освобождения Flash. Стирание страницы длится до 40 мс, поэтому регистр опрашивается с
+    //увеличивающимися паузами, чтобы не нагружать шину
+    __forceinline static bool WaitReady(std::uint32_t timeout)
     {
-      return (FLASH::SR::BSY::NotBusy::IsSet()) ;
+      return WaitUntil<FLASH::SR::BSY::NotBusy>(timeout, BackoffWait<>{}) == WaitStatus::Ready ;
     }
 
-    static void EraseSector(const std::size_t addr)
+    //Ожидание окончания операции: Flash свободна и установлен флаг EOP
+    __forceinline static bool WaitComplete(std::uint32_t timeout)
+    {
+      return WaitUntil<FLASH::SR::BSY::NotBusy, FLASH::SR::EOP::Complete>(timeout, BackoffWait<>{}) ==
+             WaitStatus::Ready ;
+    }
+
+    static bool EraseSector(const std::size_t addr)
     {
       
-      while (!IsReady())
+      if (!WaitReady(ProgramTimeout))
       {
+        Lock() ;
+        return false ;
       }
       
       FLASH::CR::PER::PageErase::Set() ;
@@ -104,13 +116,7 @@ class FlashWrapper
       // так что просто один дополнительный запрос, чтобы сразу на проверку Busy не пойти
       FLASH::CR::STRT::Start::Set() ;
       
-      while (!IsReady())
-      {
-      }
-
-      while (FLASH::SR::EOP::NotComplete::IsSet())
-      {
-      };
+      const bool result = WaitComplete(EraseTimeout) ;
       
       while (FLASH::SR::EOP::Complete::IsSet())
       {
@@ -119,10 +125,20 @@ class FlashWrapper
       };
       FLASH::CR::PER::Clear::Set() ;
       Lock() ;
+      return result ;
     }
 
     static constexpr std::uint32_t FlashCode1  = 0x45670123U ;
     static constexpr std::uint32_t FlashCode2  = 0xCDEF89ABU ;
+    //Таймауты - количество опросов BackoffWait<1024>: пауза между опросами до 1024 итераций пустого цикла,
+    //итерация не короче 4 тактов, поэтому на максимальной частоте 72 МГц опрос с полной паузой длится не
+    //меньше 57 мкс. 100 опросов - не меньше 5 мс при программировании полуслова до 70 мкс, стирание
+    //страницы длится до 40 мс, таймаут стирания - не меньше 80 мс
+    static constexpr std::uint32_t MaxCoreClock = 72'000'000U ;
+    static constexpr std::uint32_t MinPauseCycles = 4U * 1024U ;
+    static constexpr std::uint32_t PollsPerMs = (MaxCoreClock / 1000U + MinPauseCycles - 1U) / MinPauseCycles ;
+    static constexpr std::uint32_t ProgramTimeout = 100U ;
+    static constexpr std::uint32_t EraseTimeout = 2U * 40U * PollsPerMs ;
     
 };
 
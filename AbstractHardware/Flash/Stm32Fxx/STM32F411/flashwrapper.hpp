@@ -5,6 +5,8 @@
 #include "sector.hpp"     // For Sector class
 #include <array>          // For std::array
 #include "flashregisters.hpp" // for Flash
+#include "fieldsupdate.hpp"   // for FieldsUpdate
+#include "waituntil.hpp"      // for WaitUntil, BackoffWait
 
 //static_assert(STM32F411xx == 1,
 //              "This implementation only for STM32F411RG micro") ;
@@ -40,22 +42,26 @@ class FlashWrapper
       FLASH::CR::LOCK::Enable::Set() ;
     }
 
-    __forceinline static void Erase(const std::size_t addr)
+    //Методы стирания и записи возвращают false, если Flash не освободилась за отведенное время
+    __forceinline static bool Erase(const std::size_t addr)
     {
       //search needed sector in the sectors list and erase it if found.
       const std::int32_t sector = GetSectorIndex(addr) ;
       assert(sector >= 0) ;
-      EraseSector(static_cast<std::uint32_t>(sector)) ;      
+      return EraseSector(static_cast<std::uint32_t>(sector)) ;      
     }
     
-    static void Write(const char * const pSrc, char * const pDest, //lint  !e971
+    static bool Write(const char * const pSrc, char * const pDest, //lint  !e971
             const std::size_t length)
     {
+      bool result = false ;
       if( (length < MaxMessageLength) && (pSrc != nullptr) && (pDest != nullptr))
       {
         
-        while(!IsReady())
+        if (!WaitReady(ProgramTimeout))
         {
+          Lock() ;
+          return false ;
         }
 
         FLASH::CR::PG::StartProgram::Set() ;
@@ -68,17 +74,20 @@ class FlashWrapper
           
           pDestination[i] = pSource[i] ;
           
-          while(!IsReady())
+          if (!WaitReady(ProgramTimeout))
           {
+            break ;
           }
+          result = (i == length - 1U) ;
         }
         FLASH::CR::PG::Clear::Set() ;
         Lock();
       }
+      return result ;
     }
 
   template<typename T>
-  static void Write(T  value, const T * const pDest)
+  static bool Write(T  value, const T * const pDest)
   {
 
     assert(pDest != nullptr) ;
@@ -101,46 +110,51 @@ class FlashWrapper
       FLASH::CR::PSIZE::Size8bits::Set() ;  
     }    
 
-    while(!IsReady())
+    if (!WaitReady(ProgramTimeout))
     {
+      Lock() ;
+      return false ;
     }
 
     FLASH::CR::PG::StartProgram::Set() ;
      
     *const_cast<T *>(pDest) = value ;
-    while(!IsReady())
-    {
-    }
+    const bool result = WaitReady(ProgramTimeout) ;
 
     FLASH::CR::PG::Clear::Set() ;
     Lock();
+    return result ;
   }
 
   private:
 
-    __forceinline static bool IsReady()
+    //Ожидание окончания операции. Стирание сектора длится до секунд, поэтому регистр опрашивается с
+    //увеличивающимися паузами, чтобы не нагружать шину
+    __forceinline static bool WaitReady(std::uint32_t timeout)
     {
-      return (FLASH::SR::BSY::NotBusy::IsSet()) ;
+      return WaitUntil<FLASH::SR::BSY::NotBusy>(timeout, BackoffWait<>{}) == WaitStatus::Ready ;
     }
 
-    static void EraseSector(const std::size_t index)
+    static bool EraseSector(const std::size_t index)
     {
       
-      while (!IsReady())
+      if (!WaitReady(ProgramTimeout))
       {
+        Lock() ;
+        return false ;
       }
       
-      FLASH::CR::SNB::Set(index) ;
-      FLASH::CR::SER::Activate::Set() ;
+      //Номер сектора и режим стирания сектора устанавливаются за одно чтение и одну запись
+      FieldsUpdate<FLASH::CR::SNB, FLASH::CR::SER>::Set(static_cast<FLASH::CR::Type>(index),
+                                                          FLASH::CR::SER::Activate::Value) ;
       
       FLASH::CR::STRT::Start::Set() ;
 
-      while (!IsReady())
-      {
-      }
+      const bool result = WaitReady(EraseTimeout) ;
 
       FLASH::CR::SER::Clear::Set() ;
       Lock() ;
+      return result ;
     }
 
     static std::int32_t GetSectorIndex(const std::size_t addr)
@@ -159,6 +173,15 @@ class FlashWrapper
     static constexpr uint32_t FlashCode1  = uint32_t(0x45670123U) ;
     static constexpr uint32_t FlashCode2  = uint32_t(0xCDEF89ABU) ;
     static constexpr std::size_t MaxMessageLength = 255U ;
+    //Таймауты - количество опросов BackoffWait<1024>: пауза между опросами до 1024 итераций пустого цикла,
+    //итерация не короче 4 тактов, поэтому на максимальной частоте 100 МГц опрос с полной паузой длится не
+    //меньше 41 мкс. 100 опросов - не меньше 3.7 мс при программировании слова до 100 мкс, стирание сектора
+    //128 кБ длится до 4 секунд, таймаут стирания - не меньше 8 секунд
+    static constexpr std::uint32_t MaxCoreClock = 100'000'000U ;
+    static constexpr std::uint32_t MinPauseCycles = 4U * 1024U ;
+    static constexpr std::uint32_t PollsPerMs = (MaxCoreClock / 1000U + MinPauseCycles - 1U) / MinPauseCycles ;
+    static constexpr std::uint32_t ProgramTimeout = 100U ;
+    static constexpr std::uint32_t EraseTimeout = 2U * 4'000U * PollsPerMs ;
 };
 
 //#endif //NDEBUG
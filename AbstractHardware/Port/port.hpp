@@ -7,29 +7,35 @@
 
 #include <cassert>  //for assert
 #include "susudefs.hpp"  //for __forceinline
-#include "atomicutils.hpp" //for AtomicUtils
+#include "setreset.hpp" //for SetReset
 
 template <typename T>
 struct Port
 {
   
   using ModerType = typename T::MODER::Type ;
+  using ModeArray = typename T::MODER::MODERArray ;
+  //Вывод порта изменяется через регистр установки и сброса (BSRR) одной записью, поэтому методы можно вызывать
+  //и из задач, и из прерываний без критической секции
+  using OutputSetReset = SetReset<typename T::ODR> ;
+
   __forceinline static void Set(std::uint32_t value)
   {
     assert((value <= (1 << 16U))) ;
-    T::BSRR::Write(static_cast<typename T::BSRR::Type>(value)) ;
+    OutputSetReset::Set(static_cast<typename OutputSetReset::Register::Type>(value)) ;
   }
   
   __forceinline static void Reset(std::uint32_t value)
   {
     assert((value <= (1 << 16U))) ;
-    T::BSRR::Write(static_cast<typename T::BSRR::Type>(value) << 16) ;
+    OutputSetReset::Reset(static_cast<typename T::ODR::Type>(value)) ;
   }
   
+  //Метод переключает выводы одной записью в BSRR, значение ODR считывается один раз
   __forceinline static void Toggle(std::uint32_t value)
   {
     assert((value <= (1 << 16U))) ;
-    T::ODR::Toggle(static_cast<typename T::ODR::Type>(value)) ;
+    OutputSetReset::Toggle(static_cast<typename T::ODR::Type>(value)) ;
   }
   
   __forceinline static auto Get()
@@ -37,53 +43,29 @@ struct Port
     return T::IDR::Get() ;
   }
   
+  //Режим вывода задается полем массива MODER по номеру вывода, смещение поля вычисляется по шагу массива
   __forceinline static void SetAnalog(std::uint32_t pinNum)
   {
     assert(pinNum <= 15U) ;
-    using RegType = typename T::MODER::Type;
-    AtomicUtils<RegType>::Set(
-            T::MODER::Address,
-            T::MODER::FieldValues::Analog::Mask,
-            T::MODER::FieldValues::Analog::Value,
-            static_cast<ModerType>(pinNum * uint8_t{2U})
-            ) ;
+    ModeArray::SetAtomic(pinNum, T::MODER::FieldValues::Analog::Value) ;
   }
   
   __forceinline static void SetInput(std::uint32_t pinNum)
   {
     assert(pinNum <= 15U) ;
-    AtomicUtils<ModerType>::Set(
-           T::MODER::Address,
-           0b11,
-           T::MODER::FieldValues::Input::Value,
-           static_cast<ModerType>(pinNum * uint8_t{2U})
-      ) ;
-   // volatile auto value = T::MODER::Get() ;
-   // value &= ~(3 << (pinNum * 2U)) ;
-   // value |= 	(T::MODER::FieldValues::Input::Value << (pinNum * 2U)) ;
-   // T::MODER::Write(value);
+    ModeArray::SetAtomic(pinNum, T::MODER::FieldValues::Input::Value) ;
   }
   
   __forceinline static void SetOutput(std::uint32_t pinNum)
   {
     assert(pinNum <= 15U);
-    AtomicUtils<ModerType>::Set(
-            T::MODER::Address,
-            T::MODER::FieldValues::Output::Mask,
-            T::MODER::FieldValues::Output::Value,
-            static_cast<ModerType>(pinNum * uint8_t{2U})
-            ) ;
+    ModeArray::SetAtomic(pinNum, T::MODER::FieldValues::Output::Value) ;
   }
   
   __forceinline static void SetAlternate(std::uint32_t pinNum)
   {
     assert(pinNum <= 15U);
-    AtomicUtils<ModerType>::Set(
-            T::MODER::Address,
-            T::MODER::FieldValues::Alternate::Mask,
-            T::MODER::FieldValues::Alternate::Value,
-            static_cast<ModerType>(pinNum * uint8_t{2U})
-            ) ;
+    ModeArray::SetAtomic(pinNum, T::MODER::FieldValues::Alternate::Value) ;
   }
     
 } ;
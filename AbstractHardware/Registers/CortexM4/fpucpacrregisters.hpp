@@ -14,20 +14,29 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct FPU_CPACR
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000ED88U ;
+
   struct FPU_CPACRCPACRBase {} ;
 
   struct CPACR : public RegisterBase<0xE000ED88, 32, ReadWriteMode>
   {
     using CP = FPU_CPACR_CPACR_CP_Values<FPU_CPACR::CPACR, 20, 4, ReadWriteMode, FPU_CPACRCPACRBase> ;
+    static constexpr Type WritableMask = 0xF00000U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FPU_CPACR ;
     using FieldValues = FPU_CPACR_CPACR_CP_Values<FPU_CPACR::CPACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CPACRPack  = Register<0xE000ED88, 32, ReadWriteMode, FPU_CPACRCPACRBase, T...> ;
 
+  using Registers = TypesList<FPU_CPACR::CPACR> ;
 } ;
 
 #endif //#if !defined(FPUCPACRREGISTERS_HPP)
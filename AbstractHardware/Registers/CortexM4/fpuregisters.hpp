@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct FPU
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000EF34U ;
+
   struct FPUFPCCRBase {} ;
 
   struct FPCCR : public RegisterBase<0xE000EF34, 32, ReadWriteMode>
@@ -30,6 +35,9 @@ struct FPU
     using MONRDY = FPU_FPCCR_MONRDY_Values<FPU::FPCCR, 8, 1, ReadWriteMode, FPUFPCCRBase> ;
     using LSPEN = FPU_FPCCR_LSPEN_Values<FPU::FPCCR, 30, 1, ReadWriteMode, FPUFPCCRBase> ;
     using ASPEN = FPU_FPCCR_ASPEN_Values<FPU::FPCCR, 31, 1, ReadWriteMode, FPUFPCCRBase> ;
+    static constexpr Type WritableMask = 0xC000017BU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FPU ;
     using FieldValues = FPU_FPCCR_ASPEN_Values<FPU::FPCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +49,9 @@ struct FPU
   struct FPCAR : public RegisterBase<0xE000EF38, 32, ReadWriteMode>
   {
     using ADDRESS = FPU_FPCAR_ADDRESS_Values<FPU::FPCAR, 3, 29, ReadWriteMode, FPUFPCARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFF8U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FPU ;
     using FieldValues = FPU_FPCAR_ADDRESS_Values<FPU::FPCAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,12 +76,16 @@ struct FPU
     using C = FPU_FPSCR_C_Values<FPU::FPSCR, 29, 1, ReadWriteMode, FPUFPSCRBase> ;
     using Z = FPU_FPSCR_Z_Values<FPU::FPSCR, 30, 1, ReadWriteMode, FPUFPSCRBase> ;
     using N = FPU_FPSCR_N_Values<FPU::FPSCR, 31, 1, ReadWriteMode, FPUFPSCRBase> ;
+    static constexpr Type WritableMask = 0xF7C0009FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FPU ;
     using FieldValues = FPU_FPSCR_N_Values<FPU::FPSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FPSCRPack  = Register<0xE000EF3C, 32, ReadWriteMode, FPUFPSCRBase, T...> ;
 
+  using Registers = TypesList<FPU::FPCCR, FPU::FPCAR, FPU::FPSCR> ;
 } ;
 
 #endif //#if !defined(FPUREGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct MPU
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000ED90U ;
+
   struct MPUMPU_TYPERBase {} ;
 
   struct MPU_TYPER : public RegisterBase<0xE000ED90, 32, ReadMode>
@@ -24,6 +29,9 @@ struct MPU
     using SEPARATE = MPU_MPU_TYPER_SEPARATE_Values<MPU::MPU_TYPER, 0, 1, ReadMode, MPUMPU_TYPERBase> ;
     using DREGION = MPU_MPU_TYPER_DREGION_Values<MPU::MPU_TYPER, 8, 8, ReadMode, MPUMPU_TYPERBase> ;
     using IREGION = MPU_MPU_TYPER_IREGION_Values<MPU::MPU_TYPER, 16, 8, ReadMode, MPUMPU_TYPERBase> ;
+    static constexpr Type VolatileMask = 0xFFFF01U ;
+    static constexpr Type ResetValue = 0x800U ;
+    using Peripheral = MPU ;
     using FieldValues = MPU_MPU_TYPER_IREGION_Values<MPU::MPU_TYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -37,6 +45,9 @@ struct MPU
     using ENABLE = MPU_MPU_CTRL_ENABLE_Values<MPU::MPU_CTRL, 0, 1, ReadMode, MPUMPU_CTRLBase> ;
     using HFNMIENA = MPU_MPU_CTRL_HFNMIENA_Values<MPU::MPU_CTRL, 1, 1, ReadMode, MPUMPU_CTRLBase> ;
     using PRIVDEFENA = MPU_MPU_CTRL_PRIVDEFENA_Values<MPU::MPU_CTRL, 2, 1, ReadMode, MPUMPU_CTRLBase> ;
+    static constexpr Type VolatileMask = 0x7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = MPU ;
     using FieldValues = MPU_MPU_CTRL_PRIVDEFENA_Values<MPU::MPU_CTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,6 +59,9 @@ struct MPU
   struct MPU_RNR : public RegisterBase<0xE000ED98, 32, ReadWriteMode>
   {
     using REGION = MPU_MPU_RNR_REGION_Values<MPU::MPU_RNR, 0, 8, ReadWriteMode, MPUMPU_RNRBase> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = MPU ;
     using FieldValues = MPU_MPU_RNR_REGION_Values<MPU::MPU_RNR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +75,9 @@ struct MPU
     using REGION = MPU_MPU_RBAR_REGION_Values<MPU::MPU_RBAR, 0, 4, ReadWriteMode, MPUMPU_RBARBase> ;
     using VALID = MPU_MPU_RBAR_VALID_Values<MPU::MPU_RBAR, 4, 1, ReadWriteMode, MPUMPU_RBARBase> ;
     using ADDR = MPU_MPU_RBAR_ADDR_Values<MPU::MPU_RBAR, 5, 27, ReadWriteMode, MPUMPU_RBARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = MPU ;
     using FieldValues = MPU_MPU_RBAR_ADDR_Values<MPU::MPU_RBAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,12 +97,16 @@ struct MPU
     using TEX = MPU_MPU_RASR_TEX_Values<MPU::MPU_RASR, 19, 3, ReadWriteMode, MPUMPU_RASRBase> ;
     using AP = MPU_MPU_RASR_AP_Values<MPU::MPU_RASR, 24, 3, ReadWriteMode, MPUMPU_RASRBase> ;
     using XN = MPU_MPU_RASR_XN_Values<MPU::MPU_RASR, 28, 1, ReadWriteMode, MPUMPU_RASRBase> ;
+    static constexpr Type WritableMask = 0x173FFF3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = MPU ;
     using FieldValues = MPU_MPU_RASR_XN_Values<MPU::MPU_RASR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using MPU_RASRPack  = Register<0xE000EDA0, 32, ReadWriteMode, MPUMPU_RASRBase, T...> ;
 
+  using Registers = TypesList<MPU::MPU_TYPER, MPU::MPU_CTRL, MPU::MPU_RNR, MPU::MPU_RBAR, MPU::MPU_RASR> ;
 } ;
 
 #endif //#if !defined(MPUREGISTERS_HPP)
@@ -14,14 +14,22 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct NVIC
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000E100U ;
+
   struct NVICISER0Base {} ;
 
   struct ISER0 : public RegisterBase<0xE000E100, 32, ReadWriteMode>
   {
     using SETENA = NVIC_ISER0_SETENA_Values<NVIC::ISER0, 0, 32, ReadWriteMode, NVICISER0Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ISER0_SETENA_Values<NVIC::ISER0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +41,9 @@ struct NVIC
   struct ISER1 : public RegisterBase<0xE000E104, 32, ReadWriteMode>
   {
     using SETENA = NVIC_ISER1_SETENA_Values<NVIC::ISER1, 0, 32, ReadWriteMode, NVICISER1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ISER1_SETENA_Values<NVIC::ISER1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +55,9 @@ struct NVIC
   struct ISER2 : public RegisterBase<0xE000E108, 32, ReadWriteMode>
   {
     using SETENA = NVIC_ISER2_SETENA_Values<NVIC::ISER2, 0, 32, ReadWriteMode, NVICISER2Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ISER2_SETENA_Values<NVIC::ISER2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +69,9 @@ struct NVIC
   struct ICER0 : public RegisterBase<0xE000E180, 32, ReadWriteMode>
   {
     using CLRENA = NVIC_ICER0_CLRENA_Values<NVIC::ICER0, 0, 32, ReadWriteMode, NVICICER0Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ICER0_CLRENA_Values<NVIC::ICER0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +83,9 @@ struct NVIC
   struct ICER1 : public RegisterBase<0xE000E184, 32, ReadWriteMode>
   {
     using CLRENA = NVIC_ICER1_CLRENA_Values<NVIC::ICER1, 0, 32, ReadWriteMode, NVICICER1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ICER1_CLRENA_Values<NVIC::ICER1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +97,9 @@ struct NVIC
   struct ICER2 : public RegisterBase<0xE000E188, 32, ReadWriteMode>
   {
     using CLRENA = NVIC_ICER2_CLRENA_Values<NVIC::ICER2, 0, 32, ReadWriteMode, NVICICER2Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ICER2_CLRENA_Values<NVIC::ICER2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +111,9 @@ struct NVIC
   struct ISPR0 : public RegisterBase<0xE000E200, 32, ReadWriteMode>
   {
     using SETPEND = NVIC_ISPR0_SETPEND_Values<NVIC::ISPR0, 0, 32, ReadWriteMode, NVICISPR0Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ISPR0_SETPEND_Values<NVIC::ISPR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +125,9 @@ struct NVIC
   struct ISPR1 : public RegisterBase<0xE000E204, 32, ReadWriteMode>
   {
     using SETPEND = NVIC_ISPR1_SETPEND_Values<NVIC::ISPR1, 0, 32, ReadWriteMode, NVICISPR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ISPR1_SETPEND_Values<NVIC::ISPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +139,9 @@ struct NVIC
   struct ISPR2 : public RegisterBase<0xE000E208, 32, ReadWriteMode>
   {
     using SETPEND = NVIC_ISPR2_SETPEND_Values<NVIC::ISPR2, 0, 32, ReadWriteMode, NVICISPR2Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ISPR2_SETPEND_Values<NVIC::ISPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +153,9 @@ struct NVIC
   struct ICPR0 : public RegisterBase<0xE000E280, 32, ReadWriteMode>
   {
     using CLRPEND = NVIC_ICPR0_CLRPEND_Values<NVIC::ICPR0, 0, 32, ReadWriteMode, NVICICPR0Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ICPR0_CLRPEND_Values<NVIC::ICPR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +167,9 @@ struct NVIC
   struct ICPR1 : public RegisterBase<0xE000E284, 32, ReadWriteMode>
   {
     using CLRPEND = NVIC_ICPR1_CLRPEND_Values<NVIC::ICPR1, 0, 32, ReadWriteMode, NVICICPR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ICPR1_CLRPEND_Values<NVIC::ICPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +181,9 @@ struct NVIC
   struct ICPR2 : public RegisterBase<0xE000E288, 32, ReadWriteMode>
   {
     using CLRPEND = NVIC_ICPR2_CLRPEND_Values<NVIC::ICPR2, 0, 32, ReadWriteMode, NVICICPR2Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_ICPR2_CLRPEND_Values<NVIC::ICPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +195,9 @@ struct NVIC
   struct IABR0 : public RegisterBase<0xE000E300, 32, ReadMode>
   {
     using ACTIVE = NVIC_IABR0_ACTIVE_Values<NVIC::IABR0, 0, 32, ReadMode, NVICIABR0Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IABR0_ACTIVE_Values<NVIC::IABR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +209,9 @@ struct NVIC
   struct IABR1 : public RegisterBase<0xE000E304, 32, ReadMode>
   {
     using ACTIVE = NVIC_IABR1_ACTIVE_Values<NVIC::IABR1, 0, 32, ReadMode, NVICIABR1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IABR1_ACTIVE_Values<NVIC::IABR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +223,9 @@ struct NVIC
   struct IABR2 : public RegisterBase<0xE000E308, 32, ReadMode>
   {
     using ACTIVE = NVIC_IABR2_ACTIVE_Values<NVIC::IABR2, 0, 32, ReadMode, NVICIABR2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IABR2_ACTIVE_Values<NVIC::IABR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -190,6 +240,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR0_IPR_N1_Values<NVIC::IPR0, 8, 8, ReadWriteMode, NVICIPR0Base> ;
     using IPR_N2 = NVIC_IPR0_IPR_N2_Values<NVIC::IPR0, 16, 8, ReadWriteMode, NVICIPR0Base> ;
     using IPR_N3 = NVIC_IPR0_IPR_N3_Values<NVIC::IPR0, 24, 8, ReadWriteMode, NVICIPR0Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR0_IPR_N3_Values<NVIC::IPR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -204,6 +260,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR1_IPR_N1_Values<NVIC::IPR1, 8, 8, ReadWriteMode, NVICIPR1Base> ;
     using IPR_N2 = NVIC_IPR1_IPR_N2_Values<NVIC::IPR1, 16, 8, ReadWriteMode, NVICIPR1Base> ;
     using IPR_N3 = NVIC_IPR1_IPR_N3_Values<NVIC::IPR1, 24, 8, ReadWriteMode, NVICIPR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR1_IPR_N3_Values<NVIC::IPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +280,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR2_IPR_N1_Values<NVIC::IPR2, 8, 8, ReadWriteMode, NVICIPR2Base> ;
     using IPR_N2 = NVIC_IPR2_IPR_N2_Values<NVIC::IPR2, 16, 8, ReadWriteMode, NVICIPR2Base> ;
     using IPR_N3 = NVIC_IPR2_IPR_N3_Values<NVIC::IPR2, 24, 8, ReadWriteMode, NVICIPR2Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR2_IPR_N3_Values<NVIC::IPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -232,6 +300,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR3_IPR_N1_Values<NVIC::IPR3, 8, 8, ReadWriteMode, NVICIPR3Base> ;
     using IPR_N2 = NVIC_IPR3_IPR_N2_Values<NVIC::IPR3, 16, 8, ReadWriteMode, NVICIPR3Base> ;
     using IPR_N3 = NVIC_IPR3_IPR_N3_Values<NVIC::IPR3, 24, 8, ReadWriteMode, NVICIPR3Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR3_IPR_N3_Values<NVIC::IPR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -246,6 +320,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR4_IPR_N1_Values<NVIC::IPR4, 8, 8, ReadWriteMode, NVICIPR4Base> ;
     using IPR_N2 = NVIC_IPR4_IPR_N2_Values<NVIC::IPR4, 16, 8, ReadWriteMode, NVICIPR4Base> ;
     using IPR_N3 = NVIC_IPR4_IPR_N3_Values<NVIC::IPR4, 24, 8, ReadWriteMode, NVICIPR4Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR4_IPR_N3_Values<NVIC::IPR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -260,6 +340,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR5_IPR_N1_Values<NVIC::IPR5, 8, 8, ReadWriteMode, NVICIPR5Base> ;
     using IPR_N2 = NVIC_IPR5_IPR_N2_Values<NVIC::IPR5, 16, 8, ReadWriteMode, NVICIPR5Base> ;
     using IPR_N3 = NVIC_IPR5_IPR_N3_Values<NVIC::IPR5, 24, 8, ReadWriteMode, NVICIPR5Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR5_IPR_N3_Values<NVIC::IPR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +360,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR6_IPR_N1_Values<NVIC::IPR6, 8, 8, ReadWriteMode, NVICIPR6Base> ;
     using IPR_N2 = NVIC_IPR6_IPR_N2_Values<NVIC::IPR6, 16, 8, ReadWriteMode, NVICIPR6Base> ;
     using IPR_N3 = NVIC_IPR6_IPR_N3_Values<NVIC::IPR6, 24, 8, ReadWriteMode, NVICIPR6Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR6_IPR_N3_Values<NVIC::IPR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -288,6 +380,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR7_IPR_N1_Values<NVIC::IPR7, 8, 8, ReadWriteMode, NVICIPR7Base> ;
     using IPR_N2 = NVIC_IPR7_IPR_N2_Values<NVIC::IPR7, 16, 8, ReadWriteMode, NVICIPR7Base> ;
     using IPR_N3 = NVIC_IPR7_IPR_N3_Values<NVIC::IPR7, 24, 8, ReadWriteMode, NVICIPR7Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR7_IPR_N3_Values<NVIC::IPR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -302,6 +400,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR8_IPR_N1_Values<NVIC::IPR8, 8, 8, ReadWriteMode, NVICIPR8Base> ;
     using IPR_N2 = NVIC_IPR8_IPR_N2_Values<NVIC::IPR8, 16, 8, ReadWriteMode, NVICIPR8Base> ;
     using IPR_N3 = NVIC_IPR8_IPR_N3_Values<NVIC::IPR8, 24, 8, ReadWriteMode, NVICIPR8Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR8_IPR_N3_Values<NVIC::IPR8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -316,6 +420,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR9_IPR_N1_Values<NVIC::IPR9, 8, 8, ReadWriteMode, NVICIPR9Base> ;
     using IPR_N2 = NVIC_IPR9_IPR_N2_Values<NVIC::IPR9, 16, 8, ReadWriteMode, NVICIPR9Base> ;
     using IPR_N3 = NVIC_IPR9_IPR_N3_Values<NVIC::IPR9, 24, 8, ReadWriteMode, NVICIPR9Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR9_IPR_N3_Values<NVIC::IPR9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -330,6 +440,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR10_IPR_N1_Values<NVIC::IPR10, 8, 8, ReadWriteMode, NVICIPR10Base> ;
     using IPR_N2 = NVIC_IPR10_IPR_N2_Values<NVIC::IPR10, 16, 8, ReadWriteMode, NVICIPR10Base> ;
     using IPR_N3 = NVIC_IPR10_IPR_N3_Values<NVIC::IPR10, 24, 8, ReadWriteMode, NVICIPR10Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR10_IPR_N3_Values<NVIC::IPR10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -344,6 +460,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR11_IPR_N1_Values<NVIC::IPR11, 8, 8, ReadWriteMode, NVICIPR11Base> ;
     using IPR_N2 = NVIC_IPR11_IPR_N2_Values<NVIC::IPR11, 16, 8, ReadWriteMode, NVICIPR11Base> ;
     using IPR_N3 = NVIC_IPR11_IPR_N3_Values<NVIC::IPR11, 24, 8, ReadWriteMode, NVICIPR11Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR11_IPR_N3_Values<NVIC::IPR11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,6 +480,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR12_IPR_N1_Values<NVIC::IPR12, 8, 8, ReadWriteMode, NVICIPR12Base> ;
     using IPR_N2 = NVIC_IPR12_IPR_N2_Values<NVIC::IPR12, 16, 8, ReadWriteMode, NVICIPR12Base> ;
     using IPR_N3 = NVIC_IPR12_IPR_N3_Values<NVIC::IPR12, 24, 8, ReadWriteMode, NVICIPR12Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR12_IPR_N3_Values<NVIC::IPR12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -372,6 +500,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR13_IPR_N1_Values<NVIC::IPR13, 8, 8, ReadWriteMode, NVICIPR13Base> ;
     using IPR_N2 = NVIC_IPR13_IPR_N2_Values<NVIC::IPR13, 16, 8, ReadWriteMode, NVICIPR13Base> ;
     using IPR_N3 = NVIC_IPR13_IPR_N3_Values<NVIC::IPR13, 24, 8, ReadWriteMode, NVICIPR13Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR13_IPR_N3_Values<NVIC::IPR13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -386,6 +520,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR14_IPR_N1_Values<NVIC::IPR14, 8, 8, ReadWriteMode, NVICIPR14Base> ;
     using IPR_N2 = NVIC_IPR14_IPR_N2_Values<NVIC::IPR14, 16, 8, ReadWriteMode, NVICIPR14Base> ;
     using IPR_N3 = NVIC_IPR14_IPR_N3_Values<NVIC::IPR14, 24, 8, ReadWriteMode, NVICIPR14Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR14_IPR_N3_Values<NVIC::IPR14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -400,6 +540,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR15_IPR_N1_Values<NVIC::IPR15, 8, 8, ReadWriteMode, NVICIPR15Base> ;
     using IPR_N2 = NVIC_IPR15_IPR_N2_Values<NVIC::IPR15, 16, 8, ReadWriteMode, NVICIPR15Base> ;
     using IPR_N3 = NVIC_IPR15_IPR_N3_Values<NVIC::IPR15, 24, 8, ReadWriteMode, NVICIPR15Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR15_IPR_N3_Values<NVIC::IPR15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -414,6 +560,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR16_IPR_N1_Values<NVIC::IPR16, 8, 8, ReadWriteMode, NVICIPR16Base> ;
     using IPR_N2 = NVIC_IPR16_IPR_N2_Values<NVIC::IPR16, 16, 8, ReadWriteMode, NVICIPR16Base> ;
     using IPR_N3 = NVIC_IPR16_IPR_N3_Values<NVIC::IPR16, 24, 8, ReadWriteMode, NVICIPR16Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR16_IPR_N3_Values<NVIC::IPR16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -428,6 +580,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR17_IPR_N1_Values<NVIC::IPR17, 8, 8, ReadWriteMode, NVICIPR17Base> ;
     using IPR_N2 = NVIC_IPR17_IPR_N2_Values<NVIC::IPR17, 16, 8, ReadWriteMode, NVICIPR17Base> ;
     using IPR_N3 = NVIC_IPR17_IPR_N3_Values<NVIC::IPR17, 24, 8, ReadWriteMode, NVICIPR17Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR17_IPR_N3_Values<NVIC::IPR17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -442,6 +600,12 @@ struct NVIC
     using IPR_N1 = NVIC_IPR18_IPR_N1_Values<NVIC::IPR18, 8, 8, ReadWriteMode, NVICIPR18Base> ;
     using IPR_N2 = NVIC_IPR18_IPR_N2_Values<NVIC::IPR18, 16, 8, ReadWriteMode, NVICIPR18Base> ;
     using IPR_N3 = NVIC_IPR18_IPR_N3_Values<NVIC::IPR18, 24, 8, ReadWriteMode, NVICIPR18Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR18_IPR_N3_Values<NVIC::IPR18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -456,12 +620,37 @@ struct NVIC
     using IPR_N1 = NVIC_IPR19_IPR_N1_Values<NVIC::IPR19, 8, 8, ReadWriteMode, NVICIPR19Base> ;
     using IPR_N2 = NVIC_IPR19_IPR_N2_Values<NVIC::IPR19, 16, 8, ReadWriteMode, NVICIPR19Base> ;
     using IPR_N3 = NVIC_IPR19_IPR_N3_Values<NVIC::IPR19, 24, 8, ReadWriteMode, NVICIPR19Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IPR_NArray = FieldArray<0U, IPR_N0, IPR_N1, IPR_N2, IPR_N3> ;
+    template<std::size_t index>
+    using Field = typename IPR_NArray::template Field<index> ;
+    using Peripheral = NVIC ;
     using FieldValues = NVIC_IPR19_IPR_N3_Values<NVIC::IPR19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using IPR19Pack  = Register<0xE000E44C, 32, ReadWriteMode, NVICIPR19Base, T...> ;
 
+  template<std::size_t index>
+  using ISER = IndexedType<index, 0U, NVIC::ISER0, NVIC::ISER1, NVIC::ISER2> ;
+
+  template<std::size_t index>
+  using ICER = IndexedType<index, 0U, NVIC::ICER0, NVIC::ICER1, NVIC::ICER2> ;
+
+  template<std::size_t index>
+  using ISPR = IndexedType<index, 0U, NVIC::ISPR0, NVIC::ISPR1, NVIC::ISPR2> ;
+
+  template<std::size_t index>
+  using ICPR = IndexedType<index, 0U, NVIC::ICPR0, NVIC::ICPR1, NVIC::ICPR2> ;
+
+  template<std::size_t index>
+  using IABR = IndexedType<index, 0U, NVIC::IABR0, NVIC::IABR1, NVIC::IABR2> ;
+
+  template<std::size_t index>
+  using IPR = IndexedType<index, 0U, NVIC::IPR0, NVIC::IPR1, NVIC::IPR2, NVIC::IPR3, NVIC::IPR4, NVIC::IPR5, NVIC::IPR6, NVIC::IPR7, NVIC::IPR8, NVIC::IPR9, NVIC::IPR10, NVIC::IPR11, NVIC::IPR12, NVIC::IPR13, NVIC::IPR14, NVIC::IPR15, NVIC::IPR16, NVIC::IPR17, NVIC::IPR18, NVIC::IPR19> ;
+
+  using Registers = TypesList<NVIC::ISER0, NVIC::ISER1, NVIC::ISER2, NVIC::ICER0, NVIC::ICER1, NVIC::ICER2, NVIC::ISPR0, NVIC::ISPR1, NVIC::ISPR2, NVIC::ICPR0, NVIC::ICPR1, NVIC::ICPR2, NVIC::IABR0, NVIC::IABR1, NVIC::IABR2, NVIC::IPR0, NVIC::IPR1, NVIC::IPR2, NVIC::IPR3, NVIC::IPR4, NVIC::IPR5, NVIC::IPR6, NVIC::IPR7, NVIC::IPR8, NVIC::IPR9, NVIC::IPR10, NVIC::IPR11, NVIC::IPR12, NVIC::IPR13, NVIC::IPR14, NVIC::IPR15, NVIC::IPR16, NVIC::IPR17, NVIC::IPR18, NVIC::IPR19> ;
 } ;
 
 #endif //#if !defined(NVICREGISTERS_HPP)
@@ -14,20 +14,29 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct NVIC_STIR
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000EF00U ;
+
   struct NVIC_STIRSTIRBase {} ;
 
   struct STIR : public RegisterBase<0xE000EF00, 32, ReadWriteMode>
   {
     using INTID = NVIC_STIR_STIR_INTID_Values<NVIC_STIR::STIR, 0, 9, ReadWriteMode, NVIC_STIRSTIRBase> ;
+    static constexpr Type WritableMask = 0x1FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = NVIC_STIR ;
     using FieldValues = NVIC_STIR_STIR_INTID_Values<NVIC_STIR::STIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using STIRPack  = Register<0xE000EF00, 32, ReadWriteMode, NVIC_STIRSTIRBase, T...> ;
 
+  using Registers = TypesList<NVIC_STIR::STIR> ;
 } ;
 
 #endif //#if !defined(NVICSTIRREGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SCB_ACTRL
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000E008U ;
+
   struct SCB_ACTRLACTRLBase {} ;
 
   struct ACTRL : public RegisterBase<0xE000E008, 32, ReadWriteMode>
@@ -26,12 +31,16 @@ struct SCB_ACTRL
     using DISFOLD = SCB_ACTRL_ACTRL_DISFOLD_Values<SCB_ACTRL::ACTRL, 2, 1, ReadWriteMode, SCB_ACTRLACTRLBase> ;
     using DISFPCA = SCB_ACTRL_ACTRL_DISFPCA_Values<SCB_ACTRL::ACTRL, 8, 1, ReadWriteMode, SCB_ACTRLACTRLBase> ;
     using DISOOFP = SCB_ACTRL_ACTRL_DISOOFP_Values<SCB_ACTRL::ACTRL, 9, 1, ReadWriteMode, SCB_ACTRLACTRLBase> ;
+    static constexpr Type WritableMask = 0x307U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SCB_ACTRL ;
     using FieldValues = SCB_ACTRL_ACTRL_DISOOFP_Values<SCB_ACTRL::ACTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ACTRLPack  = Register<0xE000E008, 32, ReadWriteMode, SCB_ACTRLACTRLBase, T...> ;
 
+  using Registers = TypesList<SCB_ACTRL::ACTRL> ;
 } ;
 
 #endif //#if !defined(SCBACTRLREGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct STK
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE000E010U ;
+
   struct STKCTRLBase {} ;
 
   struct CTRL : public RegisterBase<0xE000E010, 32, ReadWriteMode>
@@ -25,6 +30,10 @@ struct STK
     using TICKINT = STK_CTRL_TICKINT_Values<STK::CTRL, 1, 1, ReadWriteMode, STKCTRLBase> ;
     using CLKSOURCE = STK_CTRL_CLKSOURCE_Values<STK::CTRL, 2, 1, ReadWriteMode, STKCTRLBase> ;
     using COUNTFLAG = STK_CTRL_COUNTFLAG_Values<STK::CTRL, 16, 1, ReadWriteMode, STKCTRLBase> ;
+    static constexpr Type VolatileMask = 0x10000U ;
+    static constexpr Type WritableMask = 0x7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = STK ;
     using FieldValues = STK_CTRL_COUNTFLAG_Values<STK::CTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -36,6 +45,9 @@ struct STK
   struct LOAD : public RegisterBase<0xE000E014, 32, ReadWriteMode>
   {
     using RELOAD = STK_LOAD_RELOAD_Values<STK::LOAD, 0, 24, ReadWriteMode, STKLOADBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = STK ;
     using FieldValues = STK_LOAD_RELOAD_Values<STK::LOAD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +59,9 @@ struct STK
   struct VAL : public RegisterBase<0xE000E018, 32, ReadWriteMode>
   {
     using CURRENT = STK_VAL_CURRENT_Values<STK::VAL, 0, 24, ReadWriteMode, STKVALBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = STK ;
     using FieldValues = STK_VAL_CURRENT_Values<STK::VAL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,12 +75,16 @@ struct STK
     using TENMS = STK_CALIB_TENMS_Values<STK::CALIB, 0, 24, ReadWriteMode, STKCALIBBase> ;
     using SKEW = STK_CALIB_SKEW_Values<STK::CALIB, 30, 1, ReadWriteMode, STKCALIBBase> ;
     using NOREF = STK_CALIB_NOREF_Values<STK::CALIB, 31, 1, ReadWriteMode, STKCALIBBase> ;
+    static constexpr Type WritableMask = 0xC0FFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = STK ;
     using FieldValues = STK_CALIB_NOREF_Values<STK::CALIB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALIBPack  = Register<0xE000E01C, 32, ReadWriteMode, STKCALIBBase, T...> ;
 
+  using Registers = TypesList<STK::CTRL, STK::LOAD, STK::VAL, STK::CALIB> ;
 } ;
 
 #endif //#if !defined(STKREGISTERS_HPP)
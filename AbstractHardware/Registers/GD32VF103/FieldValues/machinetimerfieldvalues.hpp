@@ -16,7 +16,7 @@ template <typename Reg, size_t offset, size_t size, typename AccessMode, typenam
 struct MACHINETIMER_MTIMECMP_MTIMECMP_Values: public RegisterField<Reg, offset, size, AccessMode>
 {
     template<typename Reg::Type val,
-        class  = typename std::enable_if_t<(size >= sizeof(Reg::Type) * 8U) || (val < (1U << size))>>
+        class  = typename std::enable_if_t<(size >= sizeof(typename Reg::Type) * 8U) || (val < (1U << size))>>
     using Value = FieldValue<MACHINETIMER_MTIMECMP_MTIMECMP_Values, BaseType, val>;
 };
 
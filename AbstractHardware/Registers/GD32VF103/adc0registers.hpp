@@ -26,6 +26,9 @@ struct ADC0
     using EOIC = ADC0_STAT_EOIC_Values<ADC0::STAT, 2, 1, ReadWriteMode, ADC0STATBase> ;
     using EOC = ADC0_STAT_EOC_Values<ADC0::STAT, 1, 1, ReadWriteMode, ADC0STATBase> ;
     using WDE = ADC0_STAT_WDE_Values<ADC0::STAT, 0, 1, ReadWriteMode, ADC0STATBase> ;
+    static constexpr Type WritableMask = 0x1FU ;
+    static constexpr Type ZeroToClearMask = 0x1FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC0_STAT_WDE_Values<ADC0::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -49,6 +52,7 @@ struct ADC0
     using WDEIE = ADC0_CTL0_WDEIE_Values<ADC0::CTL0, 6, 1, ReadWriteMode, ADC0CTL0Base> ;
     using EOCIE = ADC0_CTL0_EOCIE_Values<ADC0::CTL0, 5, 1, ReadWriteMode, ADC0CTL0Base> ;
     using WDCHSEL = ADC0_CTL0_WDCHSEL_Values<ADC0::CTL0, 0, 5, ReadWriteMode, ADC0CTL0Base> ;
+    static constexpr Type SnapshotMask = 0xCFFFFFU ;
     using FieldValues = ADC0_CTL0_WDCHSEL_Values<ADC0::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +76,8 @@ struct ADC0
     using CLB = ADC0_CTL1_CLB_Values<ADC0::CTL1, 2, 1, ReadWriteMode, ADC0CTL1Base> ;
     using CTN = ADC0_CTL1_CTN_Values<ADC0::CTL1, 1, 1, ReadWriteMode, ADC0CTL1Base> ;
     using ADCON = ADC0_CTL1_ADCON_Values<ADC0::CTL1, 0, 1, ReadWriteMode, ADC0CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFEF90EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = ADC0_CTL1_ADCON_Values<ADC0::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +96,7 @@ struct ADC0
     using SPT15 = ADC0_SAMPT0_SPT15_Values<ADC0::SAMPT0, 15, 3, ReadWriteMode, ADC0SAMPT0Base> ;
     using SPT16 = ADC0_SAMPT0_SPT16_Values<ADC0::SAMPT0, 18, 3, ReadWriteMode, ADC0SAMPT0Base> ;
     using SPT17 = ADC0_SAMPT0_SPT17_Values<ADC0::SAMPT0, 21, 3, ReadWriteMode, ADC0SAMPT0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC0_SAMPT0_SPT17_Values<ADC0::SAMPT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +117,7 @@ struct ADC0
     using SPT7 = ADC0_SAMPT1_SPT7_Values<ADC0::SAMPT1, 21, 3, ReadWriteMode, ADC0SAMPT1Base> ;
     using SPT8 = ADC0_SAMPT1_SPT8_Values<ADC0::SAMPT1, 24, 3, ReadWriteMode, ADC0SAMPT1Base> ;
     using SPT9 = ADC0_SAMPT1_SPT9_Values<ADC0::SAMPT1, 27, 3, ReadWriteMode, ADC0SAMPT1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC0_SAMPT1_SPT9_Values<ADC0::SAMPT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +129,7 @@ struct ADC0
   struct IOFF0 : public RegisterBase<0x40012414, 32, ReadWriteMode>
   {
     using IOFF = ADC0_IOFF0_IOFF_Values<ADC0::IOFF0, 0, 12, ReadWriteMode, ADC0IOFF0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC0_IOFF0_IOFF_Values<ADC0::IOFF0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +141,7 @@ struct ADC0
   struct IOFF1 : public RegisterBase<0x40012418, 32, ReadWriteMode>
   {
     using IOFF = ADC0_IOFF1_IOFF_Values<ADC0::IOFF1, 0, 12, ReadWriteMode, ADC0IOFF1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC0_IOFF1_IOFF_Values<ADC0::IOFF1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +153,7 @@ struct ADC0
   struct IOFF2 : public RegisterBase<0x4001241C, 32, ReadWriteMode>
   {
     using IOFF = ADC0_IOFF2_IOFF_Values<ADC0::IOFF2, 0, 12, ReadWriteMode, ADC0IOFF2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC0_IOFF2_IOFF_Values<ADC0::IOFF2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +165,7 @@ struct ADC0
   struct IOFF3 : public RegisterBase<0x40012420, 32, ReadWriteMode>
   {
     using IOFF = ADC0_IOFF3_IOFF_Values<ADC0::IOFF3, 0, 12, ReadWriteMode, ADC0IOFF3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC0_IOFF3_IOFF_Values<ADC0::IOFF3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +177,7 @@ struct ADC0
   struct WDHT : public RegisterBase<0x40012424, 32, ReadWriteMode>
   {
     using WDHTField = ADC0_WDHT_WDHT_Values<ADC0::WDHT, 0, 12, ReadWriteMode, ADC0WDHTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC0_WDHT_WDHT_Values<ADC0::WDHT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +189,7 @@ struct ADC0
   struct WDLT : public RegisterBase<0x40012428, 32, ReadWriteMode>
   {
     using WDLTField = ADC0_WDLT_WDLT_Values<ADC0::WDLT, 0, 12, ReadWriteMode, ADC0WDLTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC0_WDLT_WDLT_Values<ADC0::WDLT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +205,7 @@ struct ADC0
     using RSQ14 = ADC0_RSQ0_RSQ14_Values<ADC0::RSQ0, 10, 5, ReadWriteMode, ADC0RSQ0Base> ;
     using RSQ13 = ADC0_RSQ0_RSQ13_Values<ADC0::RSQ0, 5, 5, ReadWriteMode, ADC0RSQ0Base> ;
     using RSQ12 = ADC0_RSQ0_RSQ12_Values<ADC0::RSQ0, 0, 5, ReadWriteMode, ADC0RSQ0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC0_RSQ0_RSQ12_Values<ADC0::RSQ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +222,7 @@ struct ADC0
     using RSQ8 = ADC0_RSQ1_RSQ8_Values<ADC0::RSQ1, 10, 5, ReadWriteMode, ADC0RSQ1Base> ;
     using RSQ7 = ADC0_RSQ1_RSQ7_Values<ADC0::RSQ1, 5, 5, ReadWriteMode, ADC0RSQ1Base> ;
     using RSQ6 = ADC0_RSQ1_RSQ6_Values<ADC0::RSQ1, 0, 5, ReadWriteMode, ADC0RSQ1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC0_RSQ1_RSQ6_Values<ADC0::RSQ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +239,7 @@ struct ADC0
     using RSQ2Field = ADC0_RSQ2_RSQ2_Values<ADC0::RSQ2, 10, 5, ReadWriteMode, ADC0RSQ2Base> ;
     using RSQ1 = ADC0_RSQ2_RSQ1_Values<ADC0::RSQ2, 5, 5, ReadWriteMode, ADC0RSQ2Base> ;
     using RSQ0 = ADC0_RSQ2_RSQ0_Values<ADC0::RSQ2, 0, 5, ReadWriteMode, ADC0RSQ2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC0_RSQ2_RSQ0_Values<ADC0::RSQ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -238,6 +255,7 @@ struct ADC0
     using ISQ2 = ADC0_ISQ_ISQ2_Values<ADC0::ISQ, 10, 5, ReadWriteMode, ADC0ISQBase> ;
     using ISQ1 = ADC0_ISQ_ISQ1_Values<ADC0::ISQ, 5, 5, ReadWriteMode, ADC0ISQBase> ;
     using ISQ0 = ADC0_ISQ_ISQ0_Values<ADC0::ISQ, 0, 5, ReadWriteMode, ADC0ISQBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFU ;
     using FieldValues = ADC0_ISQ_ISQ0_Values<ADC0::ISQ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -309,12 +327,14 @@ struct ADC0
     using OVSS = ADC0_OVSAMPCTL_OVSS_Values<ADC0::OVSAMPCTL, 5, 4, ReadWriteMode, ADC0OVSAMPCTLBase> ;
     using OVSR = ADC0_OVSAMPCTL_OVSR_Values<ADC0::OVSAMPCTL, 2, 3, ReadWriteMode, ADC0OVSAMPCTLBase> ;
     using OVSEN = ADC0_OVSAMPCTL_OVSEN_Values<ADC0::OVSAMPCTL, 0, 1, ReadWriteMode, ADC0OVSAMPCTLBase> ;
+    static constexpr Type SnapshotMask = 0x33FDU ;
     using FieldValues = ADC0_OVSAMPCTL_OVSEN_Values<ADC0::OVSAMPCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OVSAMPCTLPack  = Register<0x40012480, 32, ReadWriteMode, ADC0OVSAMPCTLBase, T...> ;
 
+  using Registers = TypesList<ADC0::STAT, ADC0::CTL0, ADC0::CTL1, ADC0::SAMPT0, ADC0::SAMPT1, ADC0::IOFF0, ADC0::IOFF1, ADC0::IOFF2, ADC0::IOFF3, ADC0::WDHT, ADC0::WDLT, ADC0::RSQ0, ADC0::RSQ1, ADC0::RSQ2, ADC0::ISQ, ADC0::IDATA0, ADC0::IDATA1, ADC0::IDATA2, ADC0::IDATA3, ADC0::RDATA, ADC0::OVSAMPCTL> ;
 } ;
 
 #endif //#if !defined(ADC0REGISTERS_HPP)
@@ -26,6 +26,9 @@ struct ADC1
     using EOIC = ADC1_STAT_EOIC_Values<ADC1::STAT, 2, 1, ReadWriteMode, ADC1STATBase> ;
     using EOC = ADC1_STAT_EOC_Values<ADC1::STAT, 1, 1, ReadWriteMode, ADC1STATBase> ;
     using WDE = ADC1_STAT_WDE_Values<ADC1::STAT, 0, 1, ReadWriteMode, ADC1STATBase> ;
+    static constexpr Type WritableMask = 0x1FU ;
+    static constexpr Type ZeroToClearMask = 0x1FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC1_STAT_WDE_Values<ADC1::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,6 +51,7 @@ struct ADC1
     using WDEIE = ADC1_CTL0_WDEIE_Values<ADC1::CTL0, 6, 1, ReadWriteMode, ADC1CTL0Base> ;
     using EOCIE = ADC1_CTL0_EOCIE_Values<ADC1::CTL0, 5, 1, ReadWriteMode, ADC1CTL0Base> ;
     using WDCHSEL = ADC1_CTL0_WDCHSEL_Values<ADC1::CTL0, 0, 5, ReadWriteMode, ADC1CTL0Base> ;
+    static constexpr Type SnapshotMask = 0xC0FFFFU ;
     using FieldValues = ADC1_CTL0_WDCHSEL_Values<ADC1::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +74,8 @@ struct ADC1
     using CLB = ADC1_CTL1_CLB_Values<ADC1::CTL1, 2, 1, ReadWriteMode, ADC1CTL1Base> ;
     using CTN = ADC1_CTL1_CTN_Values<ADC1::CTL1, 1, 1, ReadWriteMode, ADC1CTL1Base> ;
     using ADCON = ADC1_CTL1_ADCON_Values<ADC1::CTL1, 0, 1, ReadWriteMode, ADC1CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x7EF90EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = ADC1_CTL1_ADCON_Values<ADC1::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +94,7 @@ struct ADC1
     using SPT15 = ADC1_SAMPT0_SPT15_Values<ADC1::SAMPT0, 15, 3, ReadWriteMode, ADC1SAMPT0Base> ;
     using SPT16 = ADC1_SAMPT0_SPT16_Values<ADC1::SAMPT0, 18, 3, ReadWriteMode, ADC1SAMPT0Base> ;
     using SPT17 = ADC1_SAMPT0_SPT17_Values<ADC1::SAMPT0, 21, 3, ReadWriteMode, ADC1SAMPT0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC1_SAMPT0_SPT17_Values<ADC1::SAMPT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +115,7 @@ struct ADC1
     using SPT7 = ADC1_SAMPT1_SPT7_Values<ADC1::SAMPT1, 21, 3, ReadWriteMode, ADC1SAMPT1Base> ;
     using SPT8 = ADC1_SAMPT1_SPT8_Values<ADC1::SAMPT1, 24, 3, ReadWriteMode, ADC1SAMPT1Base> ;
     using SPT9 = ADC1_SAMPT1_SPT9_Values<ADC1::SAMPT1, 27, 3, ReadWriteMode, ADC1SAMPT1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC1_SAMPT1_SPT9_Values<ADC1::SAMPT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -119,6 +127,7 @@ struct ADC1
   struct IOFF0 : public RegisterBase<0x40012814, 32, ReadWriteMode>
   {
     using IOFF = ADC1_IOFF0_IOFF_Values<ADC1::IOFF0, 0, 12, ReadWriteMode, ADC1IOFF0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_IOFF0_IOFF_Values<ADC1::IOFF0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +139,7 @@ struct ADC1
   struct IOFF1 : public RegisterBase<0x40012818, 32, ReadWriteMode>
   {
     using IOFF = ADC1_IOFF1_IOFF_Values<ADC1::IOFF1, 0, 12, ReadWriteMode, ADC1IOFF1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_IOFF1_IOFF_Values<ADC1::IOFF1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +151,7 @@ struct ADC1
   struct IOFF2 : public RegisterBase<0x4001281C, 32, ReadWriteMode>
   {
     using IOFF = ADC1_IOFF2_IOFF_Values<ADC1::IOFF2, 0, 12, ReadWriteMode, ADC1IOFF2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_IOFF2_IOFF_Values<ADC1::IOFF2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +163,7 @@ struct ADC1
   struct IOFF3 : public RegisterBase<0x40012820, 32, ReadWriteMode>
   {
     using IOFF = ADC1_IOFF3_IOFF_Values<ADC1::IOFF3, 0, 12, ReadWriteMode, ADC1IOFF3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_IOFF3_IOFF_Values<ADC1::IOFF3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -163,6 +175,7 @@ struct ADC1
   struct WDHT : public RegisterBase<0x40012824, 32, ReadWriteMode>
   {
     using WDHTField = ADC1_WDHT_WDHT_Values<ADC1::WDHT, 0, 12, ReadWriteMode, ADC1WDHTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_WDHT_WDHT_Values<ADC1::WDHT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -174,6 +187,7 @@ struct ADC1
   struct WDLT : public RegisterBase<0x40012828, 32, ReadWriteMode>
   {
     using WDLTField = ADC1_WDLT_WDLT_Values<ADC1::WDLT, 0, 12, ReadWriteMode, ADC1WDLTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_WDLT_WDLT_Values<ADC1::WDLT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +203,7 @@ struct ADC1
     using RSQ14 = ADC1_RSQ0_RSQ14_Values<ADC1::RSQ0, 10, 5, ReadWriteMode, ADC1RSQ0Base> ;
     using RSQ13 = ADC1_RSQ0_RSQ13_Values<ADC1::RSQ0, 5, 5, ReadWriteMode, ADC1RSQ0Base> ;
     using RSQ12 = ADC1_RSQ0_RSQ12_Values<ADC1::RSQ0, 0, 5, ReadWriteMode, ADC1RSQ0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC1_RSQ0_RSQ12_Values<ADC1::RSQ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +220,7 @@ struct ADC1
     using RSQ8 = ADC1_RSQ1_RSQ8_Values<ADC1::RSQ1, 10, 5, ReadWriteMode, ADC1RSQ1Base> ;
     using RSQ7 = ADC1_RSQ1_RSQ7_Values<ADC1::RSQ1, 5, 5, ReadWriteMode, ADC1RSQ1Base> ;
     using RSQ6 = ADC1_RSQ1_RSQ6_Values<ADC1::RSQ1, 0, 5, ReadWriteMode, ADC1RSQ1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC1_RSQ1_RSQ6_Values<ADC1::RSQ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -221,6 +237,7 @@ struct ADC1
     using RSQ2Field = ADC1_RSQ2_RSQ2_Values<ADC1::RSQ2, 10, 5, ReadWriteMode, ADC1RSQ2Base> ;
     using RSQ1 = ADC1_RSQ2_RSQ1_Values<ADC1::RSQ2, 5, 5, ReadWriteMode, ADC1RSQ2Base> ;
     using RSQ0 = ADC1_RSQ2_RSQ0_Values<ADC1::RSQ2, 0, 5, ReadWriteMode, ADC1RSQ2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC1_RSQ2_RSQ0_Values<ADC1::RSQ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +253,7 @@ struct ADC1
     using ISQ2 = ADC1_ISQ_ISQ2_Values<ADC1::ISQ, 10, 5, ReadWriteMode, ADC1ISQBase> ;
     using ISQ1 = ADC1_ISQ_ISQ1_Values<ADC1::ISQ, 5, 5, ReadWriteMode, ADC1ISQBase> ;
     using ISQ0 = ADC1_ISQ_ISQ0_Values<ADC1::ISQ, 0, 5, ReadWriteMode, ADC1ISQBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFU ;
     using FieldValues = ADC1_ISQ_ISQ0_Values<ADC1::ISQ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -297,6 +315,7 @@ struct ADC1
   template<typename... T> 
   using RDATAPack  = Register<0x4001284C, 32, ReadMode, ADC1RDATABase, T...> ;
 
+  using Registers = TypesList<ADC1::STAT, ADC1::CTL0, ADC1::CTL1, ADC1::SAMPT0, ADC1::SAMPT1, ADC1::IOFF0, ADC1::IOFF1, ADC1::IOFF2, ADC1::IOFF3, ADC1::WDHT, ADC1::WDLT, ADC1::RSQ0, ADC1::RSQ1, ADC1::RSQ2, ADC1::ISQ, ADC1::IDATA0, ADC1::IDATA1, ADC1::IDATA2, ADC1::IDATA3, ADC1::RDATA> ;
 } ;
 
 #endif //#if !defined(ADC1REGISTERS_HPP)
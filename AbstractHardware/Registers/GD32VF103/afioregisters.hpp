@@ -24,6 +24,7 @@ struct AFIO
     using EOE = AFIO_EC_EOE_Values<AFIO::EC, 7, 1, ReadWriteMode, AFIOECBase> ;
     using PORT = AFIO_EC_PORT_Values<AFIO::EC, 4, 3, ReadWriteMode, AFIOECBase> ;
     using PIN = AFIO_EC_PIN_Values<AFIO::EC, 0, 4, ReadWriteMode, AFIOECBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = AFIO_EC_PIN_Values<AFIO::EC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +51,7 @@ struct AFIO
     using USART0_REMAP = AFIO_PCF0_USART0_REMAP_Values<AFIO::PCF0, 2, 1, ReadWriteMode, AFIOPCF0Base> ;
     using I2C0_REMAP = AFIO_PCF0_I2C0_REMAP_Values<AFIO::PCF0, 1, 1, ReadWriteMode, AFIOPCF0Base> ;
     using SPI0_REMAP = AFIO_PCF0_SPI0_REMAP_Values<AFIO::PCF0, 0, 1, ReadWriteMode, AFIOPCF0Base> ;
+    static constexpr Type SnapshotMask = 0x3741FFFFU ;
     using FieldValues = AFIO_PCF0_SPI0_REMAP_Values<AFIO::PCF0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -64,6 +66,7 @@ struct AFIO
     using EXTI2_SS = AFIO_EXTISS0_EXTI2_SS_Values<AFIO::EXTISS0, 8, 4, ReadWriteMode, AFIOEXTISS0Base> ;
     using EXTI1_SS = AFIO_EXTISS0_EXTI1_SS_Values<AFIO::EXTISS0, 4, 4, ReadWriteMode, AFIOEXTISS0Base> ;
     using EXTI0_SS = AFIO_EXTISS0_EXTI0_SS_Values<AFIO::EXTISS0, 0, 4, ReadWriteMode, AFIOEXTISS0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = AFIO_EXTISS0_EXTI0_SS_Values<AFIO::EXTISS0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,7 @@ struct AFIO
     using EXTI6_SS = AFIO_EXTISS1_EXTI6_SS_Values<AFIO::EXTISS1, 8, 4, ReadWriteMode, AFIOEXTISS1Base> ;
     using EXTI5_SS = AFIO_EXTISS1_EXTI5_SS_Values<AFIO::EXTISS1, 4, 4, ReadWriteMode, AFIOEXTISS1Base> ;
     using EXTI4_SS = AFIO_EXTISS1_EXTI4_SS_Values<AFIO::EXTISS1, 0, 4, ReadWriteMode, AFIOEXTISS1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = AFIO_EXTISS1_EXTI4_SS_Values<AFIO::EXTISS1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +96,7 @@ struct AFIO
     using EXTI10_SS = AFIO_EXTISS2_EXTI10_SS_Values<AFIO::EXTISS2, 8, 4, ReadWriteMode, AFIOEXTISS2Base> ;
     using EXTI9_SS = AFIO_EXTISS2_EXTI9_SS_Values<AFIO::EXTISS2, 4, 4, ReadWriteMode, AFIOEXTISS2Base> ;
     using EXTI8_SS = AFIO_EXTISS2_EXTI8_SS_Values<AFIO::EXTISS2, 0, 4, ReadWriteMode, AFIOEXTISS2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = AFIO_EXTISS2_EXTI8_SS_Values<AFIO::EXTISS2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +111,7 @@ struct AFIO
     using EXTI14_SS = AFIO_EXTISS3_EXTI14_SS_Values<AFIO::EXTISS3, 8, 4, ReadWriteMode, AFIOEXTISS3Base> ;
     using EXTI13_SS = AFIO_EXTISS3_EXTI13_SS_Values<AFIO::EXTISS3, 4, 4, ReadWriteMode, AFIOEXTISS3Base> ;
     using EXTI12_SS = AFIO_EXTISS3_EXTI12_SS_Values<AFIO::EXTISS3, 0, 4, ReadWriteMode, AFIOEXTISS3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = AFIO_EXTISS3_EXTI12_SS_Values<AFIO::EXTISS3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,12 +123,14 @@ struct AFIO
   struct PCF1 : public RegisterBase<0x4001001C, 32, ReadWriteMode>
   {
     using EXMC_NADV = AFIO_PCF1_EXMC_NADV_Values<AFIO::PCF1, 10, 1, ReadWriteMode, AFIOPCF1Base> ;
+    static constexpr Type SnapshotMask = 0x400U ;
     using FieldValues = AFIO_PCF1_EXMC_NADV_Values<AFIO::PCF1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PCF1Pack  = Register<0x4001001C, 32, ReadWriteMode, AFIOPCF1Base, T...> ;
 
+  using Registers = TypesList<AFIO::EC, AFIO::PCF0, AFIO::EXTISS0, AFIO::EXTISS1, AFIO::EXTISS2, AFIO::EXTISS3, AFIO::PCF1> ;
 } ;
 
 #endif //#if !defined(AFIOREGISTERS_HPP)
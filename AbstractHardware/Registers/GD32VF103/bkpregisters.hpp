@@ -22,6 +22,7 @@ struct BKP
   struct DATA0 : public RegisterBase<0x40006C04, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA0_DATA_Values<BKP::DATA0, 0, 16, ReadWriteMode, BKPDATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA0_DATA_Values<BKP::DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct BKP
   struct DATA1 : public RegisterBase<0x40006C08, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA1_DATA_Values<BKP::DATA1, 0, 16, ReadWriteMode, BKPDATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA1_DATA_Values<BKP::DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct BKP
   struct DATA2 : public RegisterBase<0x40006C0C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA2_DATA_Values<BKP::DATA2, 0, 16, ReadWriteMode, BKPDATA2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA2_DATA_Values<BKP::DATA2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct BKP
   struct DATA3 : public RegisterBase<0x40006C10, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA3_DATA_Values<BKP::DATA3, 0, 16, ReadWriteMode, BKPDATA3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA3_DATA_Values<BKP::DATA3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +70,7 @@ struct BKP
   struct DATA4 : public RegisterBase<0x40006C14, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA4_DATA_Values<BKP::DATA4, 0, 16, ReadWriteMode, BKPDATA4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA4_DATA_Values<BKP::DATA4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +82,7 @@ struct BKP
   struct DATA5 : public RegisterBase<0x40006C18, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA5_DATA_Values<BKP::DATA5, 0, 16, ReadWriteMode, BKPDATA5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA5_DATA_Values<BKP::DATA5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +94,7 @@ struct BKP
   struct DATA6 : public RegisterBase<0x40006C1C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA6_DATA_Values<BKP::DATA6, 0, 16, ReadWriteMode, BKPDATA6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA6_DATA_Values<BKP::DATA6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +106,7 @@ struct BKP
   struct DATA7 : public RegisterBase<0x40006C20, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA7_DATA_Values<BKP::DATA7, 0, 16, ReadWriteMode, BKPDATA7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA7_DATA_Values<BKP::DATA7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +118,7 @@ struct BKP
   struct DATA8 : public RegisterBase<0x40006C24, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA8_DATA_Values<BKP::DATA8, 0, 16, ReadWriteMode, BKPDATA8Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA8_DATA_Values<BKP::DATA8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +130,7 @@ struct BKP
   struct DATA9 : public RegisterBase<0x40006C28, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA9_DATA_Values<BKP::DATA9, 0, 16, ReadWriteMode, BKPDATA9Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA9_DATA_Values<BKP::DATA9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +142,7 @@ struct BKP
   struct DATA10 : public RegisterBase<0x40006C40, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA10_DATA_Values<BKP::DATA10, 0, 16, ReadWriteMode, BKPDATA10Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA10_DATA_Values<BKP::DATA10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +154,7 @@ struct BKP
   struct DATA11 : public RegisterBase<0x40006C44, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA11_DATA_Values<BKP::DATA11, 0, 16, ReadWriteMode, BKPDATA11Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA11_DATA_Values<BKP::DATA11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +166,7 @@ struct BKP
   struct DATA12 : public RegisterBase<0x40006C48, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA12_DATA_Values<BKP::DATA12, 0, 16, ReadWriteMode, BKPDATA12Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA12_DATA_Values<BKP::DATA12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +178,7 @@ struct BKP
   struct DATA13 : public RegisterBase<0x40006C4C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA13_DATA_Values<BKP::DATA13, 0, 16, ReadWriteMode, BKPDATA13Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA13_DATA_Values<BKP::DATA13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +190,7 @@ struct BKP
   struct DATA14 : public RegisterBase<0x40006C50, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA14_DATA_Values<BKP::DATA14, 0, 16, ReadWriteMode, BKPDATA14Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA14_DATA_Values<BKP::DATA14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -187,6 +202,7 @@ struct BKP
   struct DATA15 : public RegisterBase<0x40006C54, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA15_DATA_Values<BKP::DATA15, 0, 16, ReadWriteMode, BKPDATA15Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA15_DATA_Values<BKP::DATA15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -198,6 +214,7 @@ struct BKP
   struct DATA16 : public RegisterBase<0x40006C58, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA16_DATA_Values<BKP::DATA16, 0, 16, ReadWriteMode, BKPDATA16Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA16_DATA_Values<BKP::DATA16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +226,7 @@ struct BKP
   struct DATA17 : public RegisterBase<0x40006C5C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA17_DATA_Values<BKP::DATA17, 0, 16, ReadWriteMode, BKPDATA17Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA17_DATA_Values<BKP::DATA17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -220,6 +238,7 @@ struct BKP
   struct DATA18 : public RegisterBase<0x40006C60, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA18_DATA_Values<BKP::DATA18, 0, 16, ReadWriteMode, BKPDATA18Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA18_DATA_Values<BKP::DATA18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -231,6 +250,7 @@ struct BKP
   struct DATA19 : public RegisterBase<0x40006C64, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA19_DATA_Values<BKP::DATA19, 0, 16, ReadWriteMode, BKPDATA19Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA19_DATA_Values<BKP::DATA19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +262,7 @@ struct BKP
   struct DATA20 : public RegisterBase<0x40006C68, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA20_DATA_Values<BKP::DATA20, 0, 16, ReadWriteMode, BKPDATA20Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA20_DATA_Values<BKP::DATA20, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -253,6 +274,7 @@ struct BKP
   struct DATA21 : public RegisterBase<0x40006C6C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA21_DATA_Values<BKP::DATA21, 0, 16, ReadWriteMode, BKPDATA21Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA21_DATA_Values<BKP::DATA21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +286,7 @@ struct BKP
   struct DATA22 : public RegisterBase<0x40006C70, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA22_DATA_Values<BKP::DATA22, 0, 16, ReadWriteMode, BKPDATA22Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA22_DATA_Values<BKP::DATA22, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -275,6 +298,7 @@ struct BKP
   struct DATA23 : public RegisterBase<0x40006C74, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA23_DATA_Values<BKP::DATA23, 0, 16, ReadWriteMode, BKPDATA23Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA23_DATA_Values<BKP::DATA23, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -286,6 +310,7 @@ struct BKP
   struct DATA24 : public RegisterBase<0x40006C78, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA24_DATA_Values<BKP::DATA24, 0, 16, ReadWriteMode, BKPDATA24Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA24_DATA_Values<BKP::DATA24, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -297,6 +322,7 @@ struct BKP
   struct DATA25 : public RegisterBase<0x40006C7C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA25_DATA_Values<BKP::DATA25, 0, 16, ReadWriteMode, BKPDATA25Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA25_DATA_Values<BKP::DATA25, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -308,6 +334,7 @@ struct BKP
   struct DATA26 : public RegisterBase<0x40006C80, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA26_DATA_Values<BKP::DATA26, 0, 16, ReadWriteMode, BKPDATA26Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA26_DATA_Values<BKP::DATA26, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -319,6 +346,7 @@ struct BKP
   struct DATA27 : public RegisterBase<0x40006C84, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA27_DATA_Values<BKP::DATA27, 0, 16, ReadWriteMode, BKPDATA27Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA27_DATA_Values<BKP::DATA27, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -330,6 +358,7 @@ struct BKP
   struct DATA28 : public RegisterBase<0x40006C88, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA28_DATA_Values<BKP::DATA28, 0, 16, ReadWriteMode, BKPDATA28Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA28_DATA_Values<BKP::DATA28, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -341,6 +370,7 @@ struct BKP
   struct DATA29 : public RegisterBase<0x40006C8C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA29_DATA_Values<BKP::DATA29, 0, 16, ReadWriteMode, BKPDATA29Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA29_DATA_Values<BKP::DATA29, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -352,6 +382,7 @@ struct BKP
   struct DATA30 : public RegisterBase<0x40006C90, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA30_DATA_Values<BKP::DATA30, 0, 16, ReadWriteMode, BKPDATA30Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA30_DATA_Values<BKP::DATA30, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -363,6 +394,7 @@ struct BKP
   struct DATA31 : public RegisterBase<0x40006C94, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA31_DATA_Values<BKP::DATA31, 0, 16, ReadWriteMode, BKPDATA31Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA31_DATA_Values<BKP::DATA31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -374,6 +406,7 @@ struct BKP
   struct DATA32 : public RegisterBase<0x40006C98, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA32_DATA_Values<BKP::DATA32, 0, 16, ReadWriteMode, BKPDATA32Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA32_DATA_Values<BKP::DATA32, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -385,6 +418,7 @@ struct BKP
   struct DATA33 : public RegisterBase<0x40006C9C, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA33_DATA_Values<BKP::DATA33, 0, 16, ReadWriteMode, BKPDATA33Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA33_DATA_Values<BKP::DATA33, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -396,6 +430,7 @@ struct BKP
   struct DATA34 : public RegisterBase<0x40006CA0, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA34_DATA_Values<BKP::DATA34, 0, 16, ReadWriteMode, BKPDATA34Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA34_DATA_Values<BKP::DATA34, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -407,6 +442,7 @@ struct BKP
   struct DATA35 : public RegisterBase<0x40006CA4, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA35_DATA_Values<BKP::DATA35, 0, 16, ReadWriteMode, BKPDATA35Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA35_DATA_Values<BKP::DATA35, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -418,6 +454,7 @@ struct BKP
   struct DATA36 : public RegisterBase<0x40006CA8, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA36_DATA_Values<BKP::DATA36, 0, 16, ReadWriteMode, BKPDATA36Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA36_DATA_Values<BKP::DATA36, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -429,6 +466,7 @@ struct BKP
   struct DATA37 : public RegisterBase<0x40006CAC, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA37_DATA_Values<BKP::DATA37, 0, 16, ReadWriteMode, BKPDATA37Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA37_DATA_Values<BKP::DATA37, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -440,6 +478,7 @@ struct BKP
   struct DATA38 : public RegisterBase<0x40006CB0, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA38_DATA_Values<BKP::DATA38, 0, 16, ReadWriteMode, BKPDATA38Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA38_DATA_Values<BKP::DATA38, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -451,6 +490,7 @@ struct BKP
   struct DATA39 : public RegisterBase<0x40006CB4, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA39_DATA_Values<BKP::DATA39, 0, 16, ReadWriteMode, BKPDATA39Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA39_DATA_Values<BKP::DATA39, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -462,6 +502,7 @@ struct BKP
   struct DATA40 : public RegisterBase<0x40006CB8, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA40_DATA_Values<BKP::DATA40, 0, 16, ReadWriteMode, BKPDATA40Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA40_DATA_Values<BKP::DATA40, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -473,6 +514,7 @@ struct BKP
   struct DATA41 : public RegisterBase<0x40006CBC, 16, ReadWriteMode>
   {
     using DATA = BKP_DATA41_DATA_Values<BKP::DATA41, 0, 16, ReadWriteMode, BKPDATA41Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = BKP_DATA41_DATA_Values<BKP::DATA41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -487,6 +529,7 @@ struct BKP
     using ASOEN = BKP_OCTL_ASOEN_Values<BKP::OCTL, 8, 1, ReadWriteMode, BKPOCTLBase> ;
     using COEN = BKP_OCTL_COEN_Values<BKP::OCTL, 7, 1, ReadWriteMode, BKPOCTLBase> ;
     using RCCV = BKP_OCTL_RCCV_Values<BKP::OCTL, 0, 7, ReadWriteMode, BKPOCTLBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = BKP_OCTL_RCCV_Values<BKP::OCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -499,6 +542,7 @@ struct BKP
   {
     using TPAL = BKP_TPCTL_TPAL_Values<BKP::TPCTL, 1, 1, ReadWriteMode, BKPTPCTLBase> ;
     using TPEN = BKP_TPCTL_TPEN_Values<BKP::TPCTL, 0, 1, ReadWriteMode, BKPTPCTLBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = BKP_TPCTL_TPEN_Values<BKP::TPCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -514,12 +558,14 @@ struct BKP
     using TPIE = BKP_TPCS_TPIE_Values<BKP::TPCS, 2, 1, ReadWriteMode, BKPTPCSBase> ;
     using TIR = BKP_TPCS_TIR_Values<BKP::TPCS, 1, 1, ReadWriteMode, BKPTPCSBase> ;
     using TER = BKP_TPCS_TER_Values<BKP::TPCS, 0, 1, ReadWriteMode, BKPTPCSBase> ;
+    static constexpr Type SnapshotMask = 0x307U ;
     using FieldValues = BKP_TPCS_TER_Values<BKP::TPCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TPCSPack  = Register<0x40006C34, 16, ReadWriteMode, BKPTPCSBase, T...> ;
 
+  using Registers = TypesList<BKP::DATA0, BKP::DATA1, BKP::DATA2, BKP::DATA3, BKP::DATA4, BKP::DATA5, BKP::DATA6, BKP::DATA7, BKP::DATA8, BKP::DATA9, BKP::DATA10, BKP::DATA11, BKP::DATA12, BKP::DATA13, BKP::DATA14, BKP::DATA15, BKP::DATA16, BKP::DATA17, BKP::DATA18, BKP::DATA19, BKP::DATA20, BKP::DATA21, BKP::DATA22, BKP::DATA23, BKP::DATA24, BKP::DATA25, BKP::DATA26, BKP::DATA27, BKP::DATA28, BKP::DATA29, BKP::DATA30, BKP::DATA31, BKP::DATA32, BKP::DATA33, BKP::DATA34, BKP::DATA35, BKP::DATA36, BKP::DATA37, BKP::DATA38, BKP::DATA39, BKP::DATA40, BKP::DATA41, BKP::OCTL, BKP::TPCTL, BKP::TPCS> ;
 } ;
 
 #endif //#if !defined(BKPREGISTERS_HPP)
@@ -31,6 +31,7 @@ struct CAN1
     using TFO = CAN1_CTL_TFO_Values<CAN1::CTL, 2, 1, ReadWriteMode, CAN1CTLBase> ;
     using SLPWMOD = CAN1_CTL_SLPWMOD_Values<CAN1::CTL, 1, 1, ReadWriteMode, CAN1CTLBase> ;
     using IWMOD = CAN1_CTL_IWMOD_Values<CAN1::CTL, 0, 1, ReadWriteMode, CAN1CTLBase> ;
+    static constexpr Type SnapshotMask = 0x180FFU ;
     using FieldValues = CAN1_CTL_IWMOD_Values<CAN1::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +51,7 @@ struct CAN1
     using ERRIF = CAN1_STAT_ERRIF_Values<CAN1::STAT, 2, 1, ReadWriteMode, CAN1STATBase> ;
     using SLPWS = CAN1_STAT_SLPWS_Values<CAN1::STAT, 1, 1, ReadMode, CAN1STATBase> ;
     using IWS = CAN1_STAT_IWS_Values<CAN1::STAT, 0, 1, ReadMode, CAN1STATBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CAN1_STAT_IWS_Values<CAN1::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +84,7 @@ struct CAN1
     using MAL0 = CAN1_TSTAT_MAL0_Values<CAN1::TSTAT, 2, 1, ReadWriteMode, CAN1TSTATBase> ;
     using MTFNERR0 = CAN1_TSTAT_MTFNERR0_Values<CAN1::TSTAT, 1, 1, ReadWriteMode, CAN1TSTATBase> ;
     using MTF0 = CAN1_TSTAT_MTF0_Values<CAN1::TSTAT, 0, 1, ReadWriteMode, CAN1TSTATBase> ;
+    static constexpr Type SnapshotMask = 0x8F8F8FU ;
     using FieldValues = CAN1_TSTAT_MTF0_Values<CAN1::TSTAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +99,7 @@ struct CAN1
     using RFO0 = CAN1_RFIFO0_RFO0_Values<CAN1::RFIFO0, 4, 1, ReadWriteMode, CAN1RFIFO0Base> ;
     using RFF0 = CAN1_RFIFO0_RFF0_Values<CAN1::RFIFO0, 3, 1, ReadWriteMode, CAN1RFIFO0Base> ;
     using RFL0 = CAN1_RFIFO0_RFL0_Values<CAN1::RFIFO0, 0, 2, ReadMode, CAN1RFIFO0Base> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN1_RFIFO0_RFL0_Values<CAN1::RFIFO0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +114,7 @@ struct CAN1
     using RFO1 = CAN1_RFIFO1_RFO1_Values<CAN1::RFIFO1, 4, 1, ReadWriteMode, CAN1RFIFO1Base> ;
     using RFF1 = CAN1_RFIFO1_RFF1_Values<CAN1::RFIFO1, 3, 1, ReadWriteMode, CAN1RFIFO1Base> ;
     using RFL1 = CAN1_RFIFO1_RFL1_Values<CAN1::RFIFO1, 0, 2, ReadMode, CAN1RFIFO1Base> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN1_RFIFO1_RFL1_Values<CAN1::RFIFO1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +139,7 @@ struct CAN1
     using RFFIE0 = CAN1_INTEN_RFFIE0_Values<CAN1::INTEN, 2, 1, ReadWriteMode, CAN1INTENBase> ;
     using RFNEIE0 = CAN1_INTEN_RFNEIE0_Values<CAN1::INTEN, 1, 1, ReadWriteMode, CAN1INTENBase> ;
     using TMEIE = CAN1_INTEN_TMEIE_Values<CAN1::INTEN, 0, 1, ReadWriteMode, CAN1INTENBase> ;
+    static constexpr Type SnapshotMask = 0x38F7FU ;
     using FieldValues = CAN1_INTEN_TMEIE_Values<CAN1::INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +156,7 @@ struct CAN1
     using BOERR = CAN1_ERR_BOERR_Values<CAN1::ERR, 2, 1, ReadMode, CAN1ERRBase> ;
     using PERR = CAN1_ERR_PERR_Values<CAN1::ERR, 1, 1, ReadMode, CAN1ERRBase> ;
     using WERR = CAN1_ERR_WERR_Values<CAN1::ERR, 0, 1, ReadMode, CAN1ERRBase> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = CAN1_ERR_WERR_Values<CAN1::ERR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +173,7 @@ struct CAN1
     using BS2 = CAN1_BT_BS2_Values<CAN1::BT, 20, 3, ReadWriteMode, CAN1BTBase> ;
     using BS1 = CAN1_BT_BS1_Values<CAN1::BT, 16, 4, ReadWriteMode, CAN1BTBase> ;
     using BAUDPSC = CAN1_BT_BAUDPSC_Values<CAN1::BT, 0, 10, ReadWriteMode, CAN1BTBase> ;
+    static constexpr Type SnapshotMask = 0xC37F03FFU ;
     using FieldValues = CAN1_BT_BAUDPSC_Values<CAN1::BT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +189,7 @@ struct CAN1
     using FF = CAN1_TMI0_FF_Values<CAN1::TMI0, 2, 1, ReadWriteMode, CAN1TMI0Base> ;
     using FT = CAN1_TMI0_FT_Values<CAN1::TMI0, 1, 1, ReadWriteMode, CAN1TMI0Base> ;
     using TEN = CAN1_TMI0_TEN_Values<CAN1::TMI0, 0, 1, ReadWriteMode, CAN1TMI0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMI0_TEN_Values<CAN1::TMI0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -194,6 +203,7 @@ struct CAN1
     using TS = CAN1_TMP0_TS_Values<CAN1::TMP0, 16, 16, ReadWriteMode, CAN1TMP0Base> ;
     using TSEN = CAN1_TMP0_TSEN_Values<CAN1::TMP0, 8, 1, ReadWriteMode, CAN1TMP0Base> ;
     using DLENC = CAN1_TMP0_DLENC_Values<CAN1::TMP0, 0, 4, ReadWriteMode, CAN1TMP0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN1_TMP0_DLENC_Values<CAN1::TMP0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +218,7 @@ struct CAN1
     using DB2 = CAN1_TMDATA00_DB2_Values<CAN1::TMDATA00, 16, 8, ReadWriteMode, CAN1TMDATA00Base> ;
     using DB1 = CAN1_TMDATA00_DB1_Values<CAN1::TMDATA00, 8, 8, ReadWriteMode, CAN1TMDATA00Base> ;
     using DB0 = CAN1_TMDATA00_DB0_Values<CAN1::TMDATA00, 0, 8, ReadWriteMode, CAN1TMDATA00Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMDATA00_DB0_Values<CAN1::TMDATA00, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +233,7 @@ struct CAN1
     using DB6 = CAN1_TMDATA10_DB6_Values<CAN1::TMDATA10, 16, 8, ReadWriteMode, CAN1TMDATA10Base> ;
     using DB5 = CAN1_TMDATA10_DB5_Values<CAN1::TMDATA10, 8, 8, ReadWriteMode, CAN1TMDATA10Base> ;
     using DB4 = CAN1_TMDATA10_DB4_Values<CAN1::TMDATA10, 0, 8, ReadWriteMode, CAN1TMDATA10Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMDATA10_DB4_Values<CAN1::TMDATA10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +249,7 @@ struct CAN1
     using FF = CAN1_TMI1_FF_Values<CAN1::TMI1, 2, 1, ReadWriteMode, CAN1TMI1Base> ;
     using FT = CAN1_TMI1_FT_Values<CAN1::TMI1, 1, 1, ReadWriteMode, CAN1TMI1Base> ;
     using TEN = CAN1_TMI1_TEN_Values<CAN1::TMI1, 0, 1, ReadWriteMode, CAN1TMI1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMI1_TEN_Values<CAN1::TMI1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -250,6 +263,7 @@ struct CAN1
     using TS = CAN1_TMP1_TS_Values<CAN1::TMP1, 16, 16, ReadWriteMode, CAN1TMP1Base> ;
     using TSEN = CAN1_TMP1_TSEN_Values<CAN1::TMP1, 8, 1, ReadWriteMode, CAN1TMP1Base> ;
     using DLENC = CAN1_TMP1_DLENC_Values<CAN1::TMP1, 0, 4, ReadWriteMode, CAN1TMP1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN1_TMP1_DLENC_Values<CAN1::TMP1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +278,7 @@ struct CAN1
     using DB2 = CAN1_TMDATA01_DB2_Values<CAN1::TMDATA01, 16, 8, ReadWriteMode, CAN1TMDATA01Base> ;
     using DB1 = CAN1_TMDATA01_DB1_Values<CAN1::TMDATA01, 8, 8, ReadWriteMode, CAN1TMDATA01Base> ;
     using DB0 = CAN1_TMDATA01_DB0_Values<CAN1::TMDATA01, 0, 8, ReadWriteMode, CAN1TMDATA01Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMDATA01_DB0_Values<CAN1::TMDATA01, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +293,7 @@ struct CAN1
     using DB6 = CAN1_TMDATA11_DB6_Values<CAN1::TMDATA11, 16, 8, ReadWriteMode, CAN1TMDATA11Base> ;
     using DB5 = CAN1_TMDATA11_DB5_Values<CAN1::TMDATA11, 8, 8, ReadWriteMode, CAN1TMDATA11Base> ;
     using DB4 = CAN1_TMDATA11_DB4_Values<CAN1::TMDATA11, 0, 8, ReadWriteMode, CAN1TMDATA11Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMDATA11_DB4_Values<CAN1::TMDATA11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct CAN1
     using FF = CAN1_TMI2_FF_Values<CAN1::TMI2, 2, 1, ReadWriteMode, CAN1TMI2Base> ;
     using FT = CAN1_TMI2_FT_Values<CAN1::TMI2, 1, 1, ReadWriteMode, CAN1TMI2Base> ;
     using TEN = CAN1_TMI2_TEN_Values<CAN1::TMI2, 0, 1, ReadWriteMode, CAN1TMI2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMI2_TEN_Values<CAN1::TMI2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +323,7 @@ struct CAN1
     using TS = CAN1_TMP2_TS_Values<CAN1::TMP2, 16, 16, ReadWriteMode, CAN1TMP2Base> ;
     using TSEN = CAN1_TMP2_TSEN_Values<CAN1::TMP2, 8, 1, ReadWriteMode, CAN1TMP2Base> ;
     using DLENC = CAN1_TMP2_DLENC_Values<CAN1::TMP2, 0, 4, ReadWriteMode, CAN1TMP2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN1_TMP2_DLENC_Values<CAN1::TMP2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -320,6 +338,7 @@ struct CAN1
     using DB2 = CAN1_TMDATA02_DB2_Values<CAN1::TMDATA02, 16, 8, ReadWriteMode, CAN1TMDATA02Base> ;
     using DB1 = CAN1_TMDATA02_DB1_Values<CAN1::TMDATA02, 8, 8, ReadWriteMode, CAN1TMDATA02Base> ;
     using DB0 = CAN1_TMDATA02_DB0_Values<CAN1::TMDATA02, 0, 8, ReadWriteMode, CAN1TMDATA02Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMDATA02_DB0_Values<CAN1::TMDATA02, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -334,6 +353,7 @@ struct CAN1
     using DB6 = CAN1_TMDATA12_DB6_Values<CAN1::TMDATA12, 16, 8, ReadWriteMode, CAN1TMDATA12Base> ;
     using DB5 = CAN1_TMDATA12_DB5_Values<CAN1::TMDATA12, 8, 8, ReadWriteMode, CAN1TMDATA12Base> ;
     using DB4 = CAN1_TMDATA12_DB4_Values<CAN1::TMDATA12, 0, 8, ReadWriteMode, CAN1TMDATA12Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TMDATA12_DB4_Values<CAN1::TMDATA12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -456,6 +476,7 @@ struct CAN1
   {
     using HBC1F = CAN1_FCTL_HBC1F_Values<CAN1::FCTL, 8, 6, ReadWriteMode, CAN1FCTLBase> ;
     using FLD = CAN1_FCTL_FLD_Values<CAN1::FCTL, 0, 1, ReadWriteMode, CAN1FCTLBase> ;
+    static constexpr Type SnapshotMask = 0x3F01U ;
     using FieldValues = CAN1_FCTL_FLD_Values<CAN1::FCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -494,6 +515,7 @@ struct CAN1
     using FMOD2 = CAN1_FMCFG_FMOD2_Values<CAN1::FMCFG, 2, 1, ReadWriteMode, CAN1FMCFGBase> ;
     using FMOD1 = CAN1_FMCFG_FMOD1_Values<CAN1::FMCFG, 1, 1, ReadWriteMode, CAN1FMCFGBase> ;
     using FMOD0 = CAN1_FMCFG_FMOD0_Values<CAN1::FMCFG, 0, 1, ReadWriteMode, CAN1FMCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FMCFG_FMOD0_Values<CAN1::FMCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -532,6 +554,7 @@ struct CAN1
     using FS25 = CAN1_FSCFG_FS25_Values<CAN1::FSCFG, 25, 1, ReadWriteMode, CAN1FSCFGBase> ;
     using FS26 = CAN1_FSCFG_FS26_Values<CAN1::FSCFG, 26, 1, ReadWriteMode, CAN1FSCFGBase> ;
     using FS27 = CAN1_FSCFG_FS27_Values<CAN1::FSCFG, 27, 1, ReadWriteMode, CAN1FSCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FSCFG_FS27_Values<CAN1::FSCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -570,6 +593,7 @@ struct CAN1
     using FAF25 = CAN1_FAFIFO_FAF25_Values<CAN1::FAFIFO, 25, 1, ReadWriteMode, CAN1FAFIFOBase> ;
     using FAF26 = CAN1_FAFIFO_FAF26_Values<CAN1::FAFIFO, 26, 1, ReadWriteMode, CAN1FAFIFOBase> ;
     using FAF27 = CAN1_FAFIFO_FAF27_Values<CAN1::FAFIFO, 27, 1, ReadWriteMode, CAN1FAFIFOBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FAFIFO_FAF27_Values<CAN1::FAFIFO, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +632,7 @@ struct CAN1
     using FW25 = CAN1_FW_FW25_Values<CAN1::FW, 25, 1, ReadWriteMode, CAN1FWBase> ;
     using FW26 = CAN1_FW_FW26_Values<CAN1::FW, 26, 1, ReadWriteMode, CAN1FWBase> ;
     using FW27 = CAN1_FW_FW27_Values<CAN1::FW, 27, 1, ReadWriteMode, CAN1FWBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FW_FW27_Values<CAN1::FW, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -650,6 +675,7 @@ struct CAN1
     using FD29 = CAN1_F0DATA0_FD29_Values<CAN1::F0DATA0, 29, 1, ReadWriteMode, CAN1F0DATA0Base> ;
     using FD30 = CAN1_F0DATA0_FD30_Values<CAN1::F0DATA0, 30, 1, ReadWriteMode, CAN1F0DATA0Base> ;
     using FD31 = CAN1_F0DATA0_FD31_Values<CAN1::F0DATA0, 31, 1, ReadWriteMode, CAN1F0DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F0DATA0_FD31_Values<CAN1::F0DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -692,6 +718,7 @@ struct CAN1
     using FD29 = CAN1_F0DATA1_FD29_Values<CAN1::F0DATA1, 29, 1, ReadWriteMode, CAN1F0DATA1Base> ;
     using FD30 = CAN1_F0DATA1_FD30_Values<CAN1::F0DATA1, 30, 1, ReadWriteMode, CAN1F0DATA1Base> ;
     using FD31 = CAN1_F0DATA1_FD31_Values<CAN1::F0DATA1, 31, 1, ReadWriteMode, CAN1F0DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F0DATA1_FD31_Values<CAN1::F0DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -734,6 +761,7 @@ struct CAN1
     using FD29 = CAN1_F1DATA0_FD29_Values<CAN1::F1DATA0, 29, 1, ReadWriteMode, CAN1F1DATA0Base> ;
     using FD30 = CAN1_F1DATA0_FD30_Values<CAN1::F1DATA0, 30, 1, ReadWriteMode, CAN1F1DATA0Base> ;
     using FD31 = CAN1_F1DATA0_FD31_Values<CAN1::F1DATA0, 31, 1, ReadWriteMode, CAN1F1DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F1DATA0_FD31_Values<CAN1::F1DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +804,7 @@ struct CAN1
     using FD29 = CAN1_F1DATA1_FD29_Values<CAN1::F1DATA1, 29, 1, ReadWriteMode, CAN1F1DATA1Base> ;
     using FD30 = CAN1_F1DATA1_FD30_Values<CAN1::F1DATA1, 30, 1, ReadWriteMode, CAN1F1DATA1Base> ;
     using FD31 = CAN1_F1DATA1_FD31_Values<CAN1::F1DATA1, 31, 1, ReadWriteMode, CAN1F1DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F1DATA1_FD31_Values<CAN1::F1DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -818,6 +847,7 @@ struct CAN1
     using FD29 = CAN1_F2DATA0_FD29_Values<CAN1::F2DATA0, 29, 1, ReadWriteMode, CAN1F2DATA0Base> ;
     using FD30 = CAN1_F2DATA0_FD30_Values<CAN1::F2DATA0, 30, 1, ReadWriteMode, CAN1F2DATA0Base> ;
     using FD31 = CAN1_F2DATA0_FD31_Values<CAN1::F2DATA0, 31, 1, ReadWriteMode, CAN1F2DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F2DATA0_FD31_Values<CAN1::F2DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -860,6 +890,7 @@ struct CAN1
     using FD29 = CAN1_F2DATA1_FD29_Values<CAN1::F2DATA1, 29, 1, ReadWriteMode, CAN1F2DATA1Base> ;
     using FD30 = CAN1_F2DATA1_FD30_Values<CAN1::F2DATA1, 30, 1, ReadWriteMode, CAN1F2DATA1Base> ;
     using FD31 = CAN1_F2DATA1_FD31_Values<CAN1::F2DATA1, 31, 1, ReadWriteMode, CAN1F2DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F2DATA1_FD31_Values<CAN1::F2DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -902,6 +933,7 @@ struct CAN1
     using FD29 = CAN1_F3DATA0_FD29_Values<CAN1::F3DATA0, 29, 1, ReadWriteMode, CAN1F3DATA0Base> ;
     using FD30 = CAN1_F3DATA0_FD30_Values<CAN1::F3DATA0, 30, 1, ReadWriteMode, CAN1F3DATA0Base> ;
     using FD31 = CAN1_F3DATA0_FD31_Values<CAN1::F3DATA0, 31, 1, ReadWriteMode, CAN1F3DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F3DATA0_FD31_Values<CAN1::F3DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -944,6 +976,7 @@ struct CAN1
     using FD29 = CAN1_F3DATA1_FD29_Values<CAN1::F3DATA1, 29, 1, ReadWriteMode, CAN1F3DATA1Base> ;
     using FD30 = CAN1_F3DATA1_FD30_Values<CAN1::F3DATA1, 30, 1, ReadWriteMode, CAN1F3DATA1Base> ;
     using FD31 = CAN1_F3DATA1_FD31_Values<CAN1::F3DATA1, 31, 1, ReadWriteMode, CAN1F3DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F3DATA1_FD31_Values<CAN1::F3DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -986,6 +1019,7 @@ struct CAN1
     using FD29 = CAN1_F4DATA0_FD29_Values<CAN1::F4DATA0, 29, 1, ReadWriteMode, CAN1F4DATA0Base> ;
     using FD30 = CAN1_F4DATA0_FD30_Values<CAN1::F4DATA0, 30, 1, ReadWriteMode, CAN1F4DATA0Base> ;
     using FD31 = CAN1_F4DATA0_FD31_Values<CAN1::F4DATA0, 31, 1, ReadWriteMode, CAN1F4DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F4DATA0_FD31_Values<CAN1::F4DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1028,6 +1062,7 @@ struct CAN1
     using FD29 = CAN1_F4DATA1_FD29_Values<CAN1::F4DATA1, 29, 1, ReadWriteMode, CAN1F4DATA1Base> ;
     using FD30 = CAN1_F4DATA1_FD30_Values<CAN1::F4DATA1, 30, 1, ReadWriteMode, CAN1F4DATA1Base> ;
     using FD31 = CAN1_F4DATA1_FD31_Values<CAN1::F4DATA1, 31, 1, ReadWriteMode, CAN1F4DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F4DATA1_FD31_Values<CAN1::F4DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1070,6 +1105,7 @@ struct CAN1
     using FD29 = CAN1_F5DATA0_FD29_Values<CAN1::F5DATA0, 29, 1, ReadWriteMode, CAN1F5DATA0Base> ;
     using FD30 = CAN1_F5DATA0_FD30_Values<CAN1::F5DATA0, 30, 1, ReadWriteMode, CAN1F5DATA0Base> ;
     using FD31 = CAN1_F5DATA0_FD31_Values<CAN1::F5DATA0, 31, 1, ReadWriteMode, CAN1F5DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F5DATA0_FD31_Values<CAN1::F5DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1112,6 +1148,7 @@ struct CAN1
     using FD29 = CAN1_F5DATA1_FD29_Values<CAN1::F5DATA1, 29, 1, ReadWriteMode, CAN1F5DATA1Base> ;
     using FD30 = CAN1_F5DATA1_FD30_Values<CAN1::F5DATA1, 30, 1, ReadWriteMode, CAN1F5DATA1Base> ;
     using FD31 = CAN1_F5DATA1_FD31_Values<CAN1::F5DATA1, 31, 1, ReadWriteMode, CAN1F5DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F5DATA1_FD31_Values<CAN1::F5DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1154,6 +1191,7 @@ struct CAN1
     using FD29 = CAN1_F6DATA0_FD29_Values<CAN1::F6DATA0, 29, 1, ReadWriteMode, CAN1F6DATA0Base> ;
     using FD30 = CAN1_F6DATA0_FD30_Values<CAN1::F6DATA0, 30, 1, ReadWriteMode, CAN1F6DATA0Base> ;
     using FD31 = CAN1_F6DATA0_FD31_Values<CAN1::F6DATA0, 31, 1, ReadWriteMode, CAN1F6DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F6DATA0_FD31_Values<CAN1::F6DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1196,6 +1234,7 @@ struct CAN1
     using FD29 = CAN1_F6DATA1_FD29_Values<CAN1::F6DATA1, 29, 1, ReadWriteMode, CAN1F6DATA1Base> ;
     using FD30 = CAN1_F6DATA1_FD30_Values<CAN1::F6DATA1, 30, 1, ReadWriteMode, CAN1F6DATA1Base> ;
     using FD31 = CAN1_F6DATA1_FD31_Values<CAN1::F6DATA1, 31, 1, ReadWriteMode, CAN1F6DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F6DATA1_FD31_Values<CAN1::F6DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1238,6 +1277,7 @@ struct CAN1
     using FD29 = CAN1_F7DATA0_FD29_Values<CAN1::F7DATA0, 29, 1, ReadWriteMode, CAN1F7DATA0Base> ;
     using FD30 = CAN1_F7DATA0_FD30_Values<CAN1::F7DATA0, 30, 1, ReadWriteMode, CAN1F7DATA0Base> ;
     using FD31 = CAN1_F7DATA0_FD31_Values<CAN1::F7DATA0, 31, 1, ReadWriteMode, CAN1F7DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F7DATA0_FD31_Values<CAN1::F7DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1280,6 +1320,7 @@ struct CAN1
     using FD29 = CAN1_F7DATA1_FD29_Values<CAN1::F7DATA1, 29, 1, ReadWriteMode, CAN1F7DATA1Base> ;
     using FD30 = CAN1_F7DATA1_FD30_Values<CAN1::F7DATA1, 30, 1, ReadWriteMode, CAN1F7DATA1Base> ;
     using FD31 = CAN1_F7DATA1_FD31_Values<CAN1::F7DATA1, 31, 1, ReadWriteMode, CAN1F7DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F7DATA1_FD31_Values<CAN1::F7DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1322,6 +1363,7 @@ struct CAN1
     using FD29 = CAN1_F8DATA0_FD29_Values<CAN1::F8DATA0, 29, 1, ReadWriteMode, CAN1F8DATA0Base> ;
     using FD30 = CAN1_F8DATA0_FD30_Values<CAN1::F8DATA0, 30, 1, ReadWriteMode, CAN1F8DATA0Base> ;
     using FD31 = CAN1_F8DATA0_FD31_Values<CAN1::F8DATA0, 31, 1, ReadWriteMode, CAN1F8DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F8DATA0_FD31_Values<CAN1::F8DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1364,6 +1406,7 @@ struct CAN1
     using FD29 = CAN1_F8DATA1_FD29_Values<CAN1::F8DATA1, 29, 1, ReadWriteMode, CAN1F8DATA1Base> ;
     using FD30 = CAN1_F8DATA1_FD30_Values<CAN1::F8DATA1, 30, 1, ReadWriteMode, CAN1F8DATA1Base> ;
     using FD31 = CAN1_F8DATA1_FD31_Values<CAN1::F8DATA1, 31, 1, ReadWriteMode, CAN1F8DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F8DATA1_FD31_Values<CAN1::F8DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1406,6 +1449,7 @@ struct CAN1
     using FD29 = CAN1_F9DATA0_FD29_Values<CAN1::F9DATA0, 29, 1, ReadWriteMode, CAN1F9DATA0Base> ;
     using FD30 = CAN1_F9DATA0_FD30_Values<CAN1::F9DATA0, 30, 1, ReadWriteMode, CAN1F9DATA0Base> ;
     using FD31 = CAN1_F9DATA0_FD31_Values<CAN1::F9DATA0, 31, 1, ReadWriteMode, CAN1F9DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F9DATA0_FD31_Values<CAN1::F9DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1448,6 +1492,7 @@ struct CAN1
     using FD29 = CAN1_F9DATA1_FD29_Values<CAN1::F9DATA1, 29, 1, ReadWriteMode, CAN1F9DATA1Base> ;
     using FD30 = CAN1_F9DATA1_FD30_Values<CAN1::F9DATA1, 30, 1, ReadWriteMode, CAN1F9DATA1Base> ;
     using FD31 = CAN1_F9DATA1_FD31_Values<CAN1::F9DATA1, 31, 1, ReadWriteMode, CAN1F9DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F9DATA1_FD31_Values<CAN1::F9DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1490,6 +1535,7 @@ struct CAN1
     using FD29 = CAN1_F10DATA0_FD29_Values<CAN1::F10DATA0, 29, 1, ReadWriteMode, CAN1F10DATA0Base> ;
     using FD30 = CAN1_F10DATA0_FD30_Values<CAN1::F10DATA0, 30, 1, ReadWriteMode, CAN1F10DATA0Base> ;
     using FD31 = CAN1_F10DATA0_FD31_Values<CAN1::F10DATA0, 31, 1, ReadWriteMode, CAN1F10DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F10DATA0_FD31_Values<CAN1::F10DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1532,6 +1578,7 @@ struct CAN1
     using FD29 = CAN1_F10DATA1_FD29_Values<CAN1::F10DATA1, 29, 1, ReadWriteMode, CAN1F10DATA1Base> ;
     using FD30 = CAN1_F10DATA1_FD30_Values<CAN1::F10DATA1, 30, 1, ReadWriteMode, CAN1F10DATA1Base> ;
     using FD31 = CAN1_F10DATA1_FD31_Values<CAN1::F10DATA1, 31, 1, ReadWriteMode, CAN1F10DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F10DATA1_FD31_Values<CAN1::F10DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1574,6 +1621,7 @@ struct CAN1
     using FD29 = CAN1_F11DATA0_FD29_Values<CAN1::F11DATA0, 29, 1, ReadWriteMode, CAN1F11DATA0Base> ;
     using FD30 = CAN1_F11DATA0_FD30_Values<CAN1::F11DATA0, 30, 1, ReadWriteMode, CAN1F11DATA0Base> ;
     using FD31 = CAN1_F11DATA0_FD31_Values<CAN1::F11DATA0, 31, 1, ReadWriteMode, CAN1F11DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F11DATA0_FD31_Values<CAN1::F11DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1616,6 +1664,7 @@ struct CAN1
     using FD29 = CAN1_F11DATA1_FD29_Values<CAN1::F11DATA1, 29, 1, ReadWriteMode, CAN1F11DATA1Base> ;
     using FD30 = CAN1_F11DATA1_FD30_Values<CAN1::F11DATA1, 30, 1, ReadWriteMode, CAN1F11DATA1Base> ;
     using FD31 = CAN1_F11DATA1_FD31_Values<CAN1::F11DATA1, 31, 1, ReadWriteMode, CAN1F11DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F11DATA1_FD31_Values<CAN1::F11DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1658,6 +1707,7 @@ struct CAN1
     using FD29 = CAN1_F12DATA0_FD29_Values<CAN1::F12DATA0, 29, 1, ReadWriteMode, CAN1F12DATA0Base> ;
     using FD30 = CAN1_F12DATA0_FD30_Values<CAN1::F12DATA0, 30, 1, ReadWriteMode, CAN1F12DATA0Base> ;
     using FD31 = CAN1_F12DATA0_FD31_Values<CAN1::F12DATA0, 31, 1, ReadWriteMode, CAN1F12DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F12DATA0_FD31_Values<CAN1::F12DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1700,6 +1750,7 @@ struct CAN1
     using FD29 = CAN1_F12DATA1_FD29_Values<CAN1::F12DATA1, 29, 1, ReadWriteMode, CAN1F12DATA1Base> ;
     using FD30 = CAN1_F12DATA1_FD30_Values<CAN1::F12DATA1, 30, 1, ReadWriteMode, CAN1F12DATA1Base> ;
     using FD31 = CAN1_F12DATA1_FD31_Values<CAN1::F12DATA1, 31, 1, ReadWriteMode, CAN1F12DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F12DATA1_FD31_Values<CAN1::F12DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1742,6 +1793,7 @@ struct CAN1
     using FD29 = CAN1_F13DATA0_FD29_Values<CAN1::F13DATA0, 29, 1, ReadWriteMode, CAN1F13DATA0Base> ;
     using FD30 = CAN1_F13DATA0_FD30_Values<CAN1::F13DATA0, 30, 1, ReadWriteMode, CAN1F13DATA0Base> ;
     using FD31 = CAN1_F13DATA0_FD31_Values<CAN1::F13DATA0, 31, 1, ReadWriteMode, CAN1F13DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F13DATA0_FD31_Values<CAN1::F13DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1784,6 +1836,7 @@ struct CAN1
     using FD29 = CAN1_F13DATA1_FD29_Values<CAN1::F13DATA1, 29, 1, ReadWriteMode, CAN1F13DATA1Base> ;
     using FD30 = CAN1_F13DATA1_FD30_Values<CAN1::F13DATA1, 30, 1, ReadWriteMode, CAN1F13DATA1Base> ;
     using FD31 = CAN1_F13DATA1_FD31_Values<CAN1::F13DATA1, 31, 1, ReadWriteMode, CAN1F13DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F13DATA1_FD31_Values<CAN1::F13DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1826,6 +1879,7 @@ struct CAN1
     using FD29 = CAN1_F14DATA0_FD29_Values<CAN1::F14DATA0, 29, 1, ReadWriteMode, CAN1F14DATA0Base> ;
     using FD30 = CAN1_F14DATA0_FD30_Values<CAN1::F14DATA0, 30, 1, ReadWriteMode, CAN1F14DATA0Base> ;
     using FD31 = CAN1_F14DATA0_FD31_Values<CAN1::F14DATA0, 31, 1, ReadWriteMode, CAN1F14DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F14DATA0_FD31_Values<CAN1::F14DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1868,6 +1922,7 @@ struct CAN1
     using FD29 = CAN1_F14DATA1_FD29_Values<CAN1::F14DATA1, 29, 1, ReadWriteMode, CAN1F14DATA1Base> ;
     using FD30 = CAN1_F14DATA1_FD30_Values<CAN1::F14DATA1, 30, 1, ReadWriteMode, CAN1F14DATA1Base> ;
     using FD31 = CAN1_F14DATA1_FD31_Values<CAN1::F14DATA1, 31, 1, ReadWriteMode, CAN1F14DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F14DATA1_FD31_Values<CAN1::F14DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1910,6 +1965,7 @@ struct CAN1
     using FD29 = CAN1_F15DATA0_FD29_Values<CAN1::F15DATA0, 29, 1, ReadWriteMode, CAN1F15DATA0Base> ;
     using FD30 = CAN1_F15DATA0_FD30_Values<CAN1::F15DATA0, 30, 1, ReadWriteMode, CAN1F15DATA0Base> ;
     using FD31 = CAN1_F15DATA0_FD31_Values<CAN1::F15DATA0, 31, 1, ReadWriteMode, CAN1F15DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F15DATA0_FD31_Values<CAN1::F15DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1952,6 +2008,7 @@ struct CAN1
     using FD29 = CAN1_F15DATA1_FD29_Values<CAN1::F15DATA1, 29, 1, ReadWriteMode, CAN1F15DATA1Base> ;
     using FD30 = CAN1_F15DATA1_FD30_Values<CAN1::F15DATA1, 30, 1, ReadWriteMode, CAN1F15DATA1Base> ;
     using FD31 = CAN1_F15DATA1_FD31_Values<CAN1::F15DATA1, 31, 1, ReadWriteMode, CAN1F15DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F15DATA1_FD31_Values<CAN1::F15DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1994,6 +2051,7 @@ struct CAN1
     using FD29 = CAN1_F16DATA0_FD29_Values<CAN1::F16DATA0, 29, 1, ReadWriteMode, CAN1F16DATA0Base> ;
     using FD30 = CAN1_F16DATA0_FD30_Values<CAN1::F16DATA0, 30, 1, ReadWriteMode, CAN1F16DATA0Base> ;
     using FD31 = CAN1_F16DATA0_FD31_Values<CAN1::F16DATA0, 31, 1, ReadWriteMode, CAN1F16DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F16DATA0_FD31_Values<CAN1::F16DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2036,6 +2094,7 @@ struct CAN1
     using FD29 = CAN1_F16DATA1_FD29_Values<CAN1::F16DATA1, 29, 1, ReadWriteMode, CAN1F16DATA1Base> ;
     using FD30 = CAN1_F16DATA1_FD30_Values<CAN1::F16DATA1, 30, 1, ReadWriteMode, CAN1F16DATA1Base> ;
     using FD31 = CAN1_F16DATA1_FD31_Values<CAN1::F16DATA1, 31, 1, ReadWriteMode, CAN1F16DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F16DATA1_FD31_Values<CAN1::F16DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2078,6 +2137,7 @@ struct CAN1
     using FD29 = CAN1_F17DATA0_FD29_Values<CAN1::F17DATA0, 29, 1, ReadWriteMode, CAN1F17DATA0Base> ;
     using FD30 = CAN1_F17DATA0_FD30_Values<CAN1::F17DATA0, 30, 1, ReadWriteMode, CAN1F17DATA0Base> ;
     using FD31 = CAN1_F17DATA0_FD31_Values<CAN1::F17DATA0, 31, 1, ReadWriteMode, CAN1F17DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F17DATA0_FD31_Values<CAN1::F17DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2120,6 +2180,7 @@ struct CAN1
     using FD29 = CAN1_F17DATA1_FD29_Values<CAN1::F17DATA1, 29, 1, ReadWriteMode, CAN1F17DATA1Base> ;
     using FD30 = CAN1_F17DATA1_FD30_Values<CAN1::F17DATA1, 30, 1, ReadWriteMode, CAN1F17DATA1Base> ;
     using FD31 = CAN1_F17DATA1_FD31_Values<CAN1::F17DATA1, 31, 1, ReadWriteMode, CAN1F17DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F17DATA1_FD31_Values<CAN1::F17DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2162,6 +2223,7 @@ struct CAN1
     using FD29 = CAN1_F18DATA0_FD29_Values<CAN1::F18DATA0, 29, 1, ReadWriteMode, CAN1F18DATA0Base> ;
     using FD30 = CAN1_F18DATA0_FD30_Values<CAN1::F18DATA0, 30, 1, ReadWriteMode, CAN1F18DATA0Base> ;
     using FD31 = CAN1_F18DATA0_FD31_Values<CAN1::F18DATA0, 31, 1, ReadWriteMode, CAN1F18DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F18DATA0_FD31_Values<CAN1::F18DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2204,6 +2266,7 @@ struct CAN1
     using FD29 = CAN1_F18DATA1_FD29_Values<CAN1::F18DATA1, 29, 1, ReadWriteMode, CAN1F18DATA1Base> ;
     using FD30 = CAN1_F18DATA1_FD30_Values<CAN1::F18DATA1, 30, 1, ReadWriteMode, CAN1F18DATA1Base> ;
     using FD31 = CAN1_F18DATA1_FD31_Values<CAN1::F18DATA1, 31, 1, ReadWriteMode, CAN1F18DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F18DATA1_FD31_Values<CAN1::F18DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2246,6 +2309,7 @@ struct CAN1
     using FD29 = CAN1_F19DATA0_FD29_Values<CAN1::F19DATA0, 29, 1, ReadWriteMode, CAN1F19DATA0Base> ;
     using FD30 = CAN1_F19DATA0_FD30_Values<CAN1::F19DATA0, 30, 1, ReadWriteMode, CAN1F19DATA0Base> ;
     using FD31 = CAN1_F19DATA0_FD31_Values<CAN1::F19DATA0, 31, 1, ReadWriteMode, CAN1F19DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F19DATA0_FD31_Values<CAN1::F19DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2288,6 +2352,7 @@ struct CAN1
     using FD29 = CAN1_F19DATA1_FD29_Values<CAN1::F19DATA1, 29, 1, ReadWriteMode, CAN1F19DATA1Base> ;
     using FD30 = CAN1_F19DATA1_FD30_Values<CAN1::F19DATA1, 30, 1, ReadWriteMode, CAN1F19DATA1Base> ;
     using FD31 = CAN1_F19DATA1_FD31_Values<CAN1::F19DATA1, 31, 1, ReadWriteMode, CAN1F19DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F19DATA1_FD31_Values<CAN1::F19DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2330,6 +2395,7 @@ struct CAN1
     using FD29 = CAN1_F20DATA0_FD29_Values<CAN1::F20DATA0, 29, 1, ReadWriteMode, CAN1F20DATA0Base> ;
     using FD30 = CAN1_F20DATA0_FD30_Values<CAN1::F20DATA0, 30, 1, ReadWriteMode, CAN1F20DATA0Base> ;
     using FD31 = CAN1_F20DATA0_FD31_Values<CAN1::F20DATA0, 31, 1, ReadWriteMode, CAN1F20DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F20DATA0_FD31_Values<CAN1::F20DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2372,6 +2438,7 @@ struct CAN1
     using FD29 = CAN1_F20DATA1_FD29_Values<CAN1::F20DATA1, 29, 1, ReadWriteMode, CAN1F20DATA1Base> ;
     using FD30 = CAN1_F20DATA1_FD30_Values<CAN1::F20DATA1, 30, 1, ReadWriteMode, CAN1F20DATA1Base> ;
     using FD31 = CAN1_F20DATA1_FD31_Values<CAN1::F20DATA1, 31, 1, ReadWriteMode, CAN1F20DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F20DATA1_FD31_Values<CAN1::F20DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2414,6 +2481,7 @@ struct CAN1
     using FD29 = CAN1_F21DATA0_FD29_Values<CAN1::F21DATA0, 29, 1, ReadWriteMode, CAN1F21DATA0Base> ;
     using FD30 = CAN1_F21DATA0_FD30_Values<CAN1::F21DATA0, 30, 1, ReadWriteMode, CAN1F21DATA0Base> ;
     using FD31 = CAN1_F21DATA0_FD31_Values<CAN1::F21DATA0, 31, 1, ReadWriteMode, CAN1F21DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F21DATA0_FD31_Values<CAN1::F21DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2456,6 +2524,7 @@ struct CAN1
     using FD29 = CAN1_F21DATA1_FD29_Values<CAN1::F21DATA1, 29, 1, ReadWriteMode, CAN1F21DATA1Base> ;
     using FD30 = CAN1_F21DATA1_FD30_Values<CAN1::F21DATA1, 30, 1, ReadWriteMode, CAN1F21DATA1Base> ;
     using FD31 = CAN1_F21DATA1_FD31_Values<CAN1::F21DATA1, 31, 1, ReadWriteMode, CAN1F21DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F21DATA1_FD31_Values<CAN1::F21DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2498,6 +2567,7 @@ struct CAN1
     using FD29 = CAN1_F22DATA0_FD29_Values<CAN1::F22DATA0, 29, 1, ReadWriteMode, CAN1F22DATA0Base> ;
     using FD30 = CAN1_F22DATA0_FD30_Values<CAN1::F22DATA0, 30, 1, ReadWriteMode, CAN1F22DATA0Base> ;
     using FD31 = CAN1_F22DATA0_FD31_Values<CAN1::F22DATA0, 31, 1, ReadWriteMode, CAN1F22DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F22DATA0_FD31_Values<CAN1::F22DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2540,6 +2610,7 @@ struct CAN1
     using FD29 = CAN1_F22DATA1_FD29_Values<CAN1::F22DATA1, 29, 1, ReadWriteMode, CAN1F22DATA1Base> ;
     using FD30 = CAN1_F22DATA1_FD30_Values<CAN1::F22DATA1, 30, 1, ReadWriteMode, CAN1F22DATA1Base> ;
     using FD31 = CAN1_F22DATA1_FD31_Values<CAN1::F22DATA1, 31, 1, ReadWriteMode, CAN1F22DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F22DATA1_FD31_Values<CAN1::F22DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2582,6 +2653,7 @@ struct CAN1
     using FD29 = CAN1_F23DATA0_FD29_Values<CAN1::F23DATA0, 29, 1, ReadWriteMode, CAN1F23DATA0Base> ;
     using FD30 = CAN1_F23DATA0_FD30_Values<CAN1::F23DATA0, 30, 1, ReadWriteMode, CAN1F23DATA0Base> ;
     using FD31 = CAN1_F23DATA0_FD31_Values<CAN1::F23DATA0, 31, 1, ReadWriteMode, CAN1F23DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F23DATA0_FD31_Values<CAN1::F23DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2624,6 +2696,7 @@ struct CAN1
     using FD29 = CAN1_F23DATA1_FD29_Values<CAN1::F23DATA1, 29, 1, ReadWriteMode, CAN1F23DATA1Base> ;
     using FD30 = CAN1_F23DATA1_FD30_Values<CAN1::F23DATA1, 30, 1, ReadWriteMode, CAN1F23DATA1Base> ;
     using FD31 = CAN1_F23DATA1_FD31_Values<CAN1::F23DATA1, 31, 1, ReadWriteMode, CAN1F23DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F23DATA1_FD31_Values<CAN1::F23DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2666,6 +2739,7 @@ struct CAN1
     using FD29 = CAN1_F24DATA0_FD29_Values<CAN1::F24DATA0, 29, 1, ReadWriteMode, CAN1F24DATA0Base> ;
     using FD30 = CAN1_F24DATA0_FD30_Values<CAN1::F24DATA0, 30, 1, ReadWriteMode, CAN1F24DATA0Base> ;
     using FD31 = CAN1_F24DATA0_FD31_Values<CAN1::F24DATA0, 31, 1, ReadWriteMode, CAN1F24DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F24DATA0_FD31_Values<CAN1::F24DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2708,6 +2782,7 @@ struct CAN1
     using FD29 = CAN1_F24DATA1_FD29_Values<CAN1::F24DATA1, 29, 1, ReadWriteMode, CAN1F24DATA1Base> ;
     using FD30 = CAN1_F24DATA1_FD30_Values<CAN1::F24DATA1, 30, 1, ReadWriteMode, CAN1F24DATA1Base> ;
     using FD31 = CAN1_F24DATA1_FD31_Values<CAN1::F24DATA1, 31, 1, ReadWriteMode, CAN1F24DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F24DATA1_FD31_Values<CAN1::F24DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2750,6 +2825,7 @@ struct CAN1
     using FD29 = CAN1_F25DATA0_FD29_Values<CAN1::F25DATA0, 29, 1, ReadWriteMode, CAN1F25DATA0Base> ;
     using FD30 = CAN1_F25DATA0_FD30_Values<CAN1::F25DATA0, 30, 1, ReadWriteMode, CAN1F25DATA0Base> ;
     using FD31 = CAN1_F25DATA0_FD31_Values<CAN1::F25DATA0, 31, 1, ReadWriteMode, CAN1F25DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F25DATA0_FD31_Values<CAN1::F25DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2792,6 +2868,7 @@ struct CAN1
     using FD29 = CAN1_F25DATA1_FD29_Values<CAN1::F25DATA1, 29, 1, ReadWriteMode, CAN1F25DATA1Base> ;
     using FD30 = CAN1_F25DATA1_FD30_Values<CAN1::F25DATA1, 30, 1, ReadWriteMode, CAN1F25DATA1Base> ;
     using FD31 = CAN1_F25DATA1_FD31_Values<CAN1::F25DATA1, 31, 1, ReadWriteMode, CAN1F25DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F25DATA1_FD31_Values<CAN1::F25DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2834,6 +2911,7 @@ struct CAN1
     using FD29 = CAN1_F26DATA0_FD29_Values<CAN1::F26DATA0, 29, 1, ReadWriteMode, CAN1F26DATA0Base> ;
     using FD30 = CAN1_F26DATA0_FD30_Values<CAN1::F26DATA0, 30, 1, ReadWriteMode, CAN1F26DATA0Base> ;
     using FD31 = CAN1_F26DATA0_FD31_Values<CAN1::F26DATA0, 31, 1, ReadWriteMode, CAN1F26DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F26DATA0_FD31_Values<CAN1::F26DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2876,6 +2954,7 @@ struct CAN1
     using FD29 = CAN1_F26DATA1_FD29_Values<CAN1::F26DATA1, 29, 1, ReadWriteMode, CAN1F26DATA1Base> ;
     using FD30 = CAN1_F26DATA1_FD30_Values<CAN1::F26DATA1, 30, 1, ReadWriteMode, CAN1F26DATA1Base> ;
     using FD31 = CAN1_F26DATA1_FD31_Values<CAN1::F26DATA1, 31, 1, ReadWriteMode, CAN1F26DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F26DATA1_FD31_Values<CAN1::F26DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2918,6 +2997,7 @@ struct CAN1
     using FD29 = CAN1_F27DATA0_FD29_Values<CAN1::F27DATA0, 29, 1, ReadWriteMode, CAN1F27DATA0Base> ;
     using FD30 = CAN1_F27DATA0_FD30_Values<CAN1::F27DATA0, 30, 1, ReadWriteMode, CAN1F27DATA0Base> ;
     using FD31 = CAN1_F27DATA0_FD31_Values<CAN1::F27DATA0, 31, 1, ReadWriteMode, CAN1F27DATA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F27DATA0_FD31_Values<CAN1::F27DATA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2960,12 +3040,14 @@ struct CAN1
     using FD29 = CAN1_F27DATA1_FD29_Values<CAN1::F27DATA1, 29, 1, ReadWriteMode, CAN1F27DATA1Base> ;
     using FD30 = CAN1_F27DATA1_FD30_Values<CAN1::F27DATA1, 30, 1, ReadWriteMode, CAN1F27DATA1Base> ;
     using FD31 = CAN1_F27DATA1_FD31_Values<CAN1::F27DATA1, 31, 1, ReadWriteMode, CAN1F27DATA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F27DATA1_FD31_Values<CAN1::F27DATA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using F27DATA1Pack  = Register<0x40006B1C, 32, ReadWriteMode, CAN1F27DATA1Base, T...> ;
 
+  using Registers = TypesList<CAN1::CTL, CAN1::STAT, CAN1::TSTAT, CAN1::RFIFO0, CAN1::RFIFO1, CAN1::INTEN, CAN1::ERR, CAN1::BT, CAN1::TMI0, CAN1::TMP0, CAN1::TMDATA00, CAN1::TMDATA10, CAN1::TMI1, CAN1::TMP1, CAN1::TMDATA01, CAN1::TMDATA11, CAN1::TMI2, CAN1::TMP2, CAN1::TMDATA02, CAN1::TMDATA12, CAN1::RFIFOMI0, CAN1::RFIFOMP0, CAN1::RFIFOMDATA00, CAN1::RFIFOMDATA10, CAN1::RFIFOMI1, CAN1::RFIFOMP1, CAN1::RFIFOMDATA01, CAN1::RFIFOMDATA11, CAN1::FCTL, CAN1::FMCFG, CAN1::FSCFG, CAN1::FAFIFO, CAN1::FW, CAN1::F0DATA0, CAN1::F0DATA1, CAN1::F1DATA0, CAN1::F1DATA1, CAN1::F2DATA0, CAN1::F2DATA1, CAN1::F3DATA0, CAN1::F3DATA1, CAN1::F4DATA0, CAN1::F4DATA1, CAN1::F5DATA0, CAN1::F5DATA1, CAN1::F6DATA0, CAN1::F6DATA1, CAN1::F7DATA0, CAN1::F7DATA1, CAN1::F8DATA0, CAN1::F8DATA1, CAN1::F9DATA0, CAN1::F9DATA1, CAN1::F10DATA0, CAN1::F10DATA1, CAN1::F11DATA0, CAN1::F11DATA1, CAN1::F12DATA0, CAN1::F12DATA1, CAN1::F13DATA0, CAN1::F13DATA1, CAN1::F14DATA0, CAN1::F14DATA1, CAN1::F15DATA0, CAN1::F15DATA1, CAN1::F16DATA0, CAN1::F16DATA1, CAN1::F17DATA0, CAN1::F17DATA1, CAN1::F18DATA0, CAN1::F18DATA1, CAN1::F19DATA0, CAN1::F19DATA1, CAN1::F20DATA0, CAN1::F20DATA1, CAN1::F21DATA0, CAN1::F21DATA1, CAN1::F22DATA0, CAN1::F22DATA1, CAN1::F23DATA0, CAN1::F23DATA1, CAN1::F24DATA0, CAN1::F24DATA1, CAN1::F25DATA0, CAN1::F25DATA1, CAN1::F26DATA0, CAN1::F26DATA1, CAN1::F27DATA0, CAN1::F27DATA1> ;
 } ;
 
 #endif //#if !defined(CAN1REGISTERS_HPP)
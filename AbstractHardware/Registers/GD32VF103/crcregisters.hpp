@@ -22,6 +22,7 @@ struct CRC
   struct DATA : public RegisterBase<0x40023000, 32, ReadWriteMode>
   {
     using DATAField = CRC_DATA_DATA_Values<CRC::DATA, 0, 32, ReadWriteMode, CRCDATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CRC_DATA_DATA_Values<CRC::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct CRC
   struct FDATA : public RegisterBase<0x40023004, 32, ReadWriteMode>
   {
     using FDATAField = CRC_FDATA_FDATA_Values<CRC::FDATA, 0, 8, ReadWriteMode, CRCFDATABase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = CRC_FDATA_FDATA_Values<CRC::FDATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,12 +46,14 @@ struct CRC
   struct CTL : public RegisterBase<0x40023008, 32, ReadWriteMode>
   {
     using RST = CRC_CTL_RST_Values<CRC::CTL, 0, 1, ReadWriteMode, CRCCTLBase> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = CRC_CTL_RST_Values<CRC::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CTLPack  = Register<0x40023008, 32, ReadWriteMode, CRCCTLBase, T...> ;
 
+  using Registers = TypesList<CRC::DATA, CRC::FDATA, CRC::CTL> ;
 } ;
 
 #endif //#if !defined(CRCREGISTERS_HPP)
@@ -35,6 +35,7 @@ struct DAC
     using DWM1 = DAC_CTL_DWM1_Values<DAC::CTL, 22, 2, ReadWriteMode, DACCTLBase> ;
     using DWBW1 = DAC_CTL_DWBW1_Values<DAC::CTL, 24, 4, ReadWriteMode, DACCTLBase> ;
     using DDMAEN1 = DAC_CTL_DDMAEN1_Values<DAC::CTL, 28, 1, ReadWriteMode, DACCTLBase> ;
+    static constexpr Type SnapshotMask = 0x1FFF1FFFU ;
     using FieldValues = DAC_CTL_DDMAEN1_Values<DAC::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +59,7 @@ struct DAC
   struct DAC0_R12DH : public RegisterBase<0x40007408, 32, ReadWriteMode>
   {
     using DAC0_DH = DAC_DAC0_R12DH_DAC0_DH_Values<DAC::DAC0_R12DH, 0, 12, ReadWriteMode, DACDAC0_R12DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC_DAC0_R12DH_DAC0_DH_Values<DAC::DAC0_R12DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +71,7 @@ struct DAC
   struct DAC0_L12DH : public RegisterBase<0x4000740C, 32, ReadWriteMode>
   {
     using DAC0_DH = DAC_DAC0_L12DH_DAC0_DH_Values<DAC::DAC0_L12DH, 4, 12, ReadWriteMode, DACDAC0_L12DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC_DAC0_L12DH_DAC0_DH_Values<DAC::DAC0_L12DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +83,7 @@ struct DAC
   struct DAC0_R8DH : public RegisterBase<0x40007410, 32, ReadWriteMode>
   {
     using DAC0_DH = DAC_DAC0_R8DH_DAC0_DH_Values<DAC::DAC0_R8DH, 0, 8, ReadWriteMode, DACDAC0_R8DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC_DAC0_R8DH_DAC0_DH_Values<DAC::DAC0_R8DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +95,7 @@ struct DAC
   struct DAC1_R12DH : public RegisterBase<0x40007414, 32, ReadWriteMode>
   {
     using DAC1_DH = DAC_DAC1_R12DH_DAC1_DH_Values<DAC::DAC1_R12DH, 0, 12, ReadWriteMode, DACDAC1_R12DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC_DAC1_R12DH_DAC1_DH_Values<DAC::DAC1_R12DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,7 @@ struct DAC
   struct DAC1_L12DH : public RegisterBase<0x40007418, 32, ReadWriteMode>
   {
     using DAC1_DH = DAC_DAC1_L12DH_DAC1_DH_Values<DAC::DAC1_L12DH, 4, 12, ReadWriteMode, DACDAC1_L12DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC_DAC1_L12DH_DAC1_DH_Values<DAC::DAC1_L12DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +119,7 @@ struct DAC
   struct DAC1_R8DH : public RegisterBase<0x4000741C, 32, ReadWriteMode>
   {
     using DAC1_DH = DAC_DAC1_R8DH_DAC1_DH_Values<DAC::DAC1_R8DH, 0, 8, ReadWriteMode, DACDAC1_R8DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC_DAC1_R8DH_DAC1_DH_Values<DAC::DAC1_R8DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +132,7 @@ struct DAC
   {
     using DAC0_DH = DAC_DACC_R12DH_DAC0_DH_Values<DAC::DACC_R12DH, 0, 12, ReadWriteMode, DACDACC_R12DHBase> ;
     using DAC1_DH = DAC_DACC_R12DH_DAC1_DH_Values<DAC::DACC_R12DH, 16, 12, ReadWriteMode, DACDACC_R12DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = DAC_DACC_R12DH_DAC1_DH_Values<DAC::DACC_R12DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +145,7 @@ struct DAC
   {
     using DAC0_DH = DAC_DACC_L12DH_DAC0_DH_Values<DAC::DACC_L12DH, 4, 12, ReadWriteMode, DACDACC_L12DHBase> ;
     using DAC1_DH = DAC_DACC_L12DH_DAC1_DH_Values<DAC::DACC_L12DH, 20, 12, ReadWriteMode, DACDACC_L12DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFF0U ;
     using FieldValues = DAC_DACC_L12DH_DAC1_DH_Values<DAC::DACC_L12DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -149,6 +158,7 @@ struct DAC
   {
     using DAC0_DH = DAC_DACC_R8DH_DAC0_DH_Values<DAC::DACC_R8DH, 0, 8, ReadWriteMode, DACDACC_R8DHBase> ;
     using DAC1_DH = DAC_DACC_R8DH_DAC1_DH_Values<DAC::DACC_R8DH, 8, 8, ReadWriteMode, DACDACC_R8DHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DAC_DACC_R8DH_DAC1_DH_Values<DAC::DACC_R8DH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -177,6 +187,7 @@ struct DAC
   template<typename... T> 
   using DAC1_DOPack  = Register<0x40007430, 32, ReadMode, DACDAC1_DOBase, T...> ;
 
+  using Registers = TypesList<DAC::CTL, DAC::SWT, DAC::DAC0_R12DH, DAC::DAC0_L12DH, DAC::DAC0_R8DH, DAC::DAC1_R12DH, DAC::DAC1_L12DH, DAC::DAC1_R8DH, DAC::DACC_R12DH, DAC::DACC_L12DH, DAC::DACC_R8DH, DAC::DAC0_DO, DAC::DAC1_DO> ;
 } ;
 
 #endif //#if !defined(DACREGISTERS_HPP)
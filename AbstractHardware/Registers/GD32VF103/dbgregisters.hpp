@@ -48,12 +48,14 @@ struct DBG
     using TIMER5_HOLD = DBG_CTL_TIMER5_HOLD_Values<DBG::CTL, 19, 1, ReadWriteMode, DBGCTLBase> ;
     using TIMER6_HOLD = DBG_CTL_TIMER6_HOLD_Values<DBG::CTL, 20, 1, ReadWriteMode, DBGCTLBase> ;
     using CAN1_HOLD = DBG_CTL_CAN1_HOLD_Values<DBG::CTL, 21, 1, ReadWriteMode, DBGCTLBase> ;
+    static constexpr Type SnapshotMask = 0x3DFF07U ;
     using FieldValues = DBG_CTL_CAN1_HOLD_Values<DBG::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CTLPack  = Register<0xE0042004, 32, ReadWriteMode, DBGCTLBase, T...> ;
 
+  using Registers = TypesList<DBG::ID, DBG::CTL> ;
 } ;
 
 #endif //#if !defined(DBGREGISTERS_HPP)
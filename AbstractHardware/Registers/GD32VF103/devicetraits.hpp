@@ -0,0 +1,45 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>      //for std::uintptr_t, std::uint32_t
+#include "buses.hpp"    //for BusCost
+
+//Характеристики микроконтроллера GD32VF103, которые нужны уровню регистров
+struct DeviceTraits
+{
+  //У RISC-V ядра нет bit-band,
+  //поэтому битовые поля всегда устанавливаются через чтение-модификацию-запись
+  static constexpr bool IsBitBandSupported = false ;
+  static constexpr std::uintptr_t PeripheralBase = 0U ;
+  static constexpr std::uintptr_t PeripheralSize = 0U ;
+  static constexpr std::uintptr_t PeripheralBitBandBase = 0U ;
+
+  //Делители частоты шин APB относительно частоты ядра, должны совпадать с настройкой RCU
+  static constexpr std::uint32_t Apb1Prescaler = 2U ;
+  static constexpr std::uint32_t Apb2Prescaler = 1U ;
+} ;
+
+//Оценка стоимости обращения к регистрам периферии в тактах ядра
+template<>
+struct BusCost<Apb1Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 3U + 2U * DeviceTraits::Apb1Prescaler ;
+  static constexpr std::uint32_t WriteCycles = 1U + DeviceTraits::Apb1Prescaler ;
+} ;
+
+template<>
+struct BusCost<Apb2Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 3U + 2U * DeviceTraits::Apb2Prescaler ;
+  static constexpr std::uint32_t WriteCycles = 1U + DeviceTraits::Apb2Prescaler ;
+} ;
+
+template<>
+struct BusCost<PpbBus>
+{
+  static constexpr std::uint32_t ReadCycles = 1U ;
+  static constexpr std::uint32_t WriteCycles = 1U ;
+} ;
@@ -87,6 +87,8 @@ struct DMA0
     using FTFIFC6 = DMA0_INTC_FTFIFC6_Values<DMA0::INTC, 25, 1, WriteMode, DMA0INTCBase> ;
     using HTFIFC6 = DMA0_INTC_HTFIFC6_Values<DMA0::INTC, 26, 1, WriteMode, DMA0INTCBase> ;
     using ERRIFC6 = DMA0_INTC_ERRIFC6_Values<DMA0::INTC, 27, 1, WriteMode, DMA0INTCBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type OneToClearMask = 0xFFFFFFFU ;
     using FieldValues = DMA0_INTC_ERRIFC6_Values<DMA0::INTC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +111,8 @@ struct DMA0
     using MWIDTH = DMA0_CH0CTL_MWIDTH_Values<DMA0::CH0CTL, 10, 2, ReadWriteMode, DMA0CH0CTLBase> ;
     using PRIO = DMA0_CH0CTL_PRIO_Values<DMA0::CH0CTL, 12, 2, ReadWriteMode, DMA0CH0CTLBase> ;
     using M2M = DMA0_CH0CTL_M2M_Values<DMA0::CH0CTL, 14, 1, ReadWriteMode, DMA0CH0CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH0CTL_M2M_Values<DMA0::CH0CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +124,7 @@ struct DMA0
   struct CH0CNT : public RegisterBase<0x4002000C, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH0CNT_CNT_Values<DMA0::CH0CNT, 0, 16, ReadWriteMode, DMA0CH0CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH0CNT_CNT_Values<DMA0::CH0CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct DMA0
   struct CH0PADDR : public RegisterBase<0x40020010, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH0PADDR_PADDR_Values<DMA0::CH0PADDR, 0, 32, ReadWriteMode, DMA0CH0PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH0PADDR_PADDR_Values<DMA0::CH0PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +148,7 @@ struct DMA0
   struct CH0MADDR : public RegisterBase<0x40020014, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH0MADDR_MADDR_Values<DMA0::CH0MADDR, 0, 32, ReadWriteMode, DMA0CH0MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH0MADDR_MADDR_Values<DMA0::CH0MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +171,8 @@ struct DMA0
     using MWIDTH = DMA0_CH1CTL_MWIDTH_Values<DMA0::CH1CTL, 10, 2, ReadWriteMode, DMA0CH1CTLBase> ;
     using PRIO = DMA0_CH1CTL_PRIO_Values<DMA0::CH1CTL, 12, 2, ReadWriteMode, DMA0CH1CTLBase> ;
     using M2M = DMA0_CH1CTL_M2M_Values<DMA0::CH1CTL, 14, 1, ReadWriteMode, DMA0CH1CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH1CTL_M2M_Values<DMA0::CH1CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -175,6 +184,7 @@ struct DMA0
   struct CH1CNT : public RegisterBase<0x40020020, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH1CNT_CNT_Values<DMA0::CH1CNT, 0, 16, ReadWriteMode, DMA0CH1CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH1CNT_CNT_Values<DMA0::CH1CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -186,6 +196,7 @@ struct DMA0
   struct CH1PADDR : public RegisterBase<0x40020024, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH1PADDR_PADDR_Values<DMA0::CH1PADDR, 0, 32, ReadWriteMode, DMA0CH1PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH1PADDR_PADDR_Values<DMA0::CH1PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,6 +208,7 @@ struct DMA0
   struct CH1MADDR : public RegisterBase<0x40020028, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH1MADDR_MADDR_Values<DMA0::CH1MADDR, 0, 32, ReadWriteMode, DMA0CH1MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH1MADDR_MADDR_Values<DMA0::CH1MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +231,8 @@ struct DMA0
     using MWIDTH = DMA0_CH2CTL_MWIDTH_Values<DMA0::CH2CTL, 10, 2, ReadWriteMode, DMA0CH2CTLBase> ;
     using PRIO = DMA0_CH2CTL_PRIO_Values<DMA0::CH2CTL, 12, 2, ReadWriteMode, DMA0CH2CTLBase> ;
     using M2M = DMA0_CH2CTL_M2M_Values<DMA0::CH2CTL, 14, 1, ReadWriteMode, DMA0CH2CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH2CTL_M2M_Values<DMA0::CH2CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +244,7 @@ struct DMA0
   struct CH2CNT : public RegisterBase<0x40020034, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH2CNT_CNT_Values<DMA0::CH2CNT, 0, 16, ReadWriteMode, DMA0CH2CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH2CNT_CNT_Values<DMA0::CH2CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +256,7 @@ struct DMA0
   struct CH2PADDR : public RegisterBase<0x40020038, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH2PADDR_PADDR_Values<DMA0::CH2PADDR, 0, 32, ReadWriteMode, DMA0CH2PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH2PADDR_PADDR_Values<DMA0::CH2PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +268,7 @@ struct DMA0
   struct CH2MADDR : public RegisterBase<0x4002003C, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH2MADDR_MADDR_Values<DMA0::CH2MADDR, 0, 32, ReadWriteMode, DMA0CH2MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH2MADDR_MADDR_Values<DMA0::CH2MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +291,8 @@ struct DMA0
     using MWIDTH = DMA0_CH3CTL_MWIDTH_Values<DMA0::CH3CTL, 10, 2, ReadWriteMode, DMA0CH3CTLBase> ;
     using PRIO = DMA0_CH3CTL_PRIO_Values<DMA0::CH3CTL, 12, 2, ReadWriteMode, DMA0CH3CTLBase> ;
     using M2M = DMA0_CH3CTL_M2M_Values<DMA0::CH3CTL, 14, 1, ReadWriteMode, DMA0CH3CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH3CTL_M2M_Values<DMA0::CH3CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -285,6 +304,7 @@ struct DMA0
   struct CH3CNT : public RegisterBase<0x40020048, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH3CNT_CNT_Values<DMA0::CH3CNT, 0, 16, ReadWriteMode, DMA0CH3CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH3CNT_CNT_Values<DMA0::CH3CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct DMA0
   struct CH3PADDR : public RegisterBase<0x4002004C, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH3PADDR_PADDR_Values<DMA0::CH3PADDR, 0, 32, ReadWriteMode, DMA0CH3PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH3PADDR_PADDR_Values<DMA0::CH3PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,6 +328,7 @@ struct DMA0
   struct CH3MADDR : public RegisterBase<0x40020050, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH3MADDR_MADDR_Values<DMA0::CH3MADDR, 0, 32, ReadWriteMode, DMA0CH3MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH3MADDR_MADDR_Values<DMA0::CH3MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +351,8 @@ struct DMA0
     using MWIDTH = DMA0_CH4CTL_MWIDTH_Values<DMA0::CH4CTL, 10, 2, ReadWriteMode, DMA0CH4CTLBase> ;
     using PRIO = DMA0_CH4CTL_PRIO_Values<DMA0::CH4CTL, 12, 2, ReadWriteMode, DMA0CH4CTLBase> ;
     using M2M = DMA0_CH4CTL_M2M_Values<DMA0::CH4CTL, 14, 1, ReadWriteMode, DMA0CH4CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH4CTL_M2M_Values<DMA0::CH4CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +364,7 @@ struct DMA0
   struct CH4CNT : public RegisterBase<0x4002005C, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH4CNT_CNT_Values<DMA0::CH4CNT, 0, 16, ReadWriteMode, DMA0CH4CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH4CNT_CNT_Values<DMA0::CH4CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -351,6 +376,7 @@ struct DMA0
   struct CH4PADDR : public RegisterBase<0x40020060, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH4PADDR_PADDR_Values<DMA0::CH4PADDR, 0, 32, ReadWriteMode, DMA0CH4PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH4PADDR_PADDR_Values<DMA0::CH4PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -362,6 +388,7 @@ struct DMA0
   struct CH4MADDR : public RegisterBase<0x40020064, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH4MADDR_MADDR_Values<DMA0::CH4MADDR, 0, 32, ReadWriteMode, DMA0CH4MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH4MADDR_MADDR_Values<DMA0::CH4MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -384,6 +411,8 @@ struct DMA0
     using MWIDTH = DMA0_CH5CTL_MWIDTH_Values<DMA0::CH5CTL, 10, 2, ReadWriteMode, DMA0CH5CTLBase> ;
     using PRIO = DMA0_CH5CTL_PRIO_Values<DMA0::CH5CTL, 12, 2, ReadWriteMode, DMA0CH5CTLBase> ;
     using M2M = DMA0_CH5CTL_M2M_Values<DMA0::CH5CTL, 14, 1, ReadWriteMode, DMA0CH5CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH5CTL_M2M_Values<DMA0::CH5CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -395,6 +424,7 @@ struct DMA0
   struct CH5CNT : public RegisterBase<0x40020070, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH5CNT_CNT_Values<DMA0::CH5CNT, 0, 16, ReadWriteMode, DMA0CH5CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH5CNT_CNT_Values<DMA0::CH5CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -406,6 +436,7 @@ struct DMA0
   struct CH5PADDR : public RegisterBase<0x40020074, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH5PADDR_PADDR_Values<DMA0::CH5PADDR, 0, 32, ReadWriteMode, DMA0CH5PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH5PADDR_PADDR_Values<DMA0::CH5PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -417,6 +448,7 @@ struct DMA0
   struct CH5MADDR : public RegisterBase<0x40020078, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH5MADDR_MADDR_Values<DMA0::CH5MADDR, 0, 32, ReadWriteMode, DMA0CH5MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH5MADDR_MADDR_Values<DMA0::CH5MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,6 +471,8 @@ struct DMA0
     using MWIDTH = DMA0_CH6CTL_MWIDTH_Values<DMA0::CH6CTL, 10, 2, ReadWriteMode, DMA0CH6CTLBase> ;
     using PRIO = DMA0_CH6CTL_PRIO_Values<DMA0::CH6CTL, 12, 2, ReadWriteMode, DMA0CH6CTLBase> ;
     using M2M = DMA0_CH6CTL_M2M_Values<DMA0::CH6CTL, 14, 1, ReadWriteMode, DMA0CH6CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA0_CH6CTL_M2M_Values<DMA0::CH6CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -450,6 +484,7 @@ struct DMA0
   struct CH6CNT : public RegisterBase<0x40020084, 32, ReadWriteMode>
   {
     using CNT = DMA0_CH6CNT_CNT_Values<DMA0::CH6CNT, 0, 16, ReadWriteMode, DMA0CH6CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA0_CH6CNT_CNT_Values<DMA0::CH6CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -461,6 +496,7 @@ struct DMA0
   struct CH6PADDR : public RegisterBase<0x40020088, 32, ReadWriteMode>
   {
     using PADDR = DMA0_CH6PADDR_PADDR_Values<DMA0::CH6PADDR, 0, 32, ReadWriteMode, DMA0CH6PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH6PADDR_PADDR_Values<DMA0::CH6PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -472,12 +508,14 @@ struct DMA0
   struct CH6MADDR : public RegisterBase<0x4002008C, 32, ReadWriteMode>
   {
     using MADDR = DMA0_CH6MADDR_MADDR_Values<DMA0::CH6MADDR, 0, 32, ReadWriteMode, DMA0CH6MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA0_CH6MADDR_MADDR_Values<DMA0::CH6MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CH6MADDRPack  = Register<0x4002008C, 32, ReadWriteMode, DMA0CH6MADDRBase, T...> ;
 
+  using Registers = TypesList<DMA0::INTF, DMA0::INTC, DMA0::CH0CTL, DMA0::CH0CNT, DMA0::CH0PADDR, DMA0::CH0MADDR, DMA0::CH1CTL, DMA0::CH1CNT, DMA0::CH1PADDR, DMA0::CH1MADDR, DMA0::CH2CTL, DMA0::CH2CNT, DMA0::CH2PADDR, DMA0::CH2MADDR, DMA0::CH3CTL, DMA0::CH3CNT, DMA0::CH3PADDR, DMA0::CH3MADDR, DMA0::CH4CTL, DMA0::CH4CNT, DMA0::CH4PADDR, DMA0::CH4MADDR, DMA0::CH5CTL, DMA0::CH5CNT, DMA0::CH5PADDR, DMA0::CH5MADDR, DMA0::CH6CTL, DMA0::CH6CNT, DMA0::CH6PADDR, DMA0::CH6MADDR> ;
 } ;
 
 #endif //#if !defined(DMA0REGISTERS_HPP)
@@ -71,6 +71,8 @@ struct DMA1
     using FTFIFC4 = DMA1_INTC_FTFIFC4_Values<DMA1::INTC, 17, 1, WriteMode, DMA1INTCBase> ;
     using HTFIFC4 = DMA1_INTC_HTFIFC4_Values<DMA1::INTC, 18, 1, WriteMode, DMA1INTCBase> ;
     using ERRIFC4 = DMA1_INTC_ERRIFC4_Values<DMA1::INTC, 19, 1, WriteMode, DMA1INTCBase> ;
+    static constexpr Type WritableMask = 0xFFFFFU ;
+    static constexpr Type OneToClearMask = 0xFFFFFU ;
     using FieldValues = DMA1_INTC_ERRIFC4_Values<DMA1::INTC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +95,8 @@ struct DMA1
     using MWIDTH = DMA1_CH0CTL_MWIDTH_Values<DMA1::CH0CTL, 10, 2, ReadWriteMode, DMA1CH0CTLBase> ;
     using PRIO = DMA1_CH0CTL_PRIO_Values<DMA1::CH0CTL, 12, 2, ReadWriteMode, DMA1CH0CTLBase> ;
     using M2M = DMA1_CH0CTL_M2M_Values<DMA1::CH0CTL, 14, 1, ReadWriteMode, DMA1CH0CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CH0CTL_M2M_Values<DMA1::CH0CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +108,7 @@ struct DMA1
   struct CH0CNT : public RegisterBase<0x4002000C, 32, ReadWriteMode>
   {
     using CNT = DMA1_CH0CNT_CNT_Values<DMA1::CH0CNT, 0, 16, ReadWriteMode, DMA1CH0CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CH0CNT_CNT_Values<DMA1::CH0CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +120,7 @@ struct DMA1
   struct CH0PADDR : public RegisterBase<0x40020010, 32, ReadWriteMode>
   {
     using PADDR = DMA1_CH0PADDR_PADDR_Values<DMA1::CH0PADDR, 0, 32, ReadWriteMode, DMA1CH0PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH0PADDR_PADDR_Values<DMA1::CH0PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -126,6 +132,7 @@ struct DMA1
   struct CH0MADDR : public RegisterBase<0x40020014, 32, ReadWriteMode>
   {
     using MADDR = DMA1_CH0MADDR_MADDR_Values<DMA1::CH0MADDR, 0, 32, ReadWriteMode, DMA1CH0MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH0MADDR_MADDR_Values<DMA1::CH0MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -148,6 +155,8 @@ struct DMA1
     using MWIDTH = DMA1_CH1CTL_MWIDTH_Values<DMA1::CH1CTL, 10, 2, ReadWriteMode, DMA1CH1CTLBase> ;
     using PRIO = DMA1_CH1CTL_PRIO_Values<DMA1::CH1CTL, 12, 2, ReadWriteMode, DMA1CH1CTLBase> ;
     using M2M = DMA1_CH1CTL_M2M_Values<DMA1::CH1CTL, 14, 1, ReadWriteMode, DMA1CH1CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CH1CTL_M2M_Values<DMA1::CH1CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -159,6 +168,7 @@ struct DMA1
   struct CH1CNT : public RegisterBase<0x40020020, 32, ReadWriteMode>
   {
     using CNT = DMA1_CH1CNT_CNT_Values<DMA1::CH1CNT, 0, 16, ReadWriteMode, DMA1CH1CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CH1CNT_CNT_Values<DMA1::CH1CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -170,6 +180,7 @@ struct DMA1
   struct CH1PADDR : public RegisterBase<0x40020024, 32, ReadWriteMode>
   {
     using PADDR = DMA1_CH1PADDR_PADDR_Values<DMA1::CH1PADDR, 0, 32, ReadWriteMode, DMA1CH1PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH1PADDR_PADDR_Values<DMA1::CH1PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +192,7 @@ struct DMA1
   struct CH1MADDR : public RegisterBase<0x40020028, 32, ReadWriteMode>
   {
     using MADDR = DMA1_CH1MADDR_MADDR_Values<DMA1::CH1MADDR, 0, 32, ReadWriteMode, DMA1CH1MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH1MADDR_MADDR_Values<DMA1::CH1MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,6 +215,8 @@ struct DMA1
     using MWIDTH = DMA1_CH2CTL_MWIDTH_Values<DMA1::CH2CTL, 10, 2, ReadWriteMode, DMA1CH2CTLBase> ;
     using PRIO = DMA1_CH2CTL_PRIO_Values<DMA1::CH2CTL, 12, 2, ReadWriteMode, DMA1CH2CTLBase> ;
     using M2M = DMA1_CH2CTL_M2M_Values<DMA1::CH2CTL, 14, 1, ReadWriteMode, DMA1CH2CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CH2CTL_M2M_Values<DMA1::CH2CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -214,6 +228,7 @@ struct DMA1
   struct CH2CNT : public RegisterBase<0x40020034, 32, ReadWriteMode>
   {
     using CNT = DMA1_CH2CNT_CNT_Values<DMA1::CH2CNT, 0, 16, ReadWriteMode, DMA1CH2CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CH2CNT_CNT_Values<DMA1::CH2CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -225,6 +240,7 @@ struct DMA1
   struct CH2PADDR : public RegisterBase<0x40020038, 32, ReadWriteMode>
   {
     using PADDR = DMA1_CH2PADDR_PADDR_Values<DMA1::CH2PADDR, 0, 32, ReadWriteMode, DMA1CH2PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH2PADDR_PADDR_Values<DMA1::CH2PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +252,7 @@ struct DMA1
   struct CH2MADDR : public RegisterBase<0x4002003C, 32, ReadWriteMode>
   {
     using MADDR = DMA1_CH2MADDR_MADDR_Values<DMA1::CH2MADDR, 0, 32, ReadWriteMode, DMA1CH2MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH2MADDR_MADDR_Values<DMA1::CH2MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -258,6 +275,8 @@ struct DMA1
     using MWIDTH = DMA1_CH3CTL_MWIDTH_Values<DMA1::CH3CTL, 10, 2, ReadWriteMode, DMA1CH3CTLBase> ;
     using PRIO = DMA1_CH3CTL_PRIO_Values<DMA1::CH3CTL, 12, 2, ReadWriteMode, DMA1CH3CTLBase> ;
     using M2M = DMA1_CH3CTL_M2M_Values<DMA1::CH3CTL, 14, 1, ReadWriteMode, DMA1CH3CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CH3CTL_M2M_Values<DMA1::CH3CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -269,6 +288,7 @@ struct DMA1
   struct CH3CNT : public RegisterBase<0x40020048, 32, ReadWriteMode>
   {
     using CNT = DMA1_CH3CNT_CNT_Values<DMA1::CH3CNT, 0, 16, ReadWriteMode, DMA1CH3CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CH3CNT_CNT_Values<DMA1::CH3CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -280,6 +300,7 @@ struct DMA1
   struct CH3PADDR : public RegisterBase<0x4002004C, 32, ReadWriteMode>
   {
     using PADDR = DMA1_CH3PADDR_PADDR_Values<DMA1::CH3PADDR, 0, 32, ReadWriteMode, DMA1CH3PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH3PADDR_PADDR_Values<DMA1::CH3PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -291,6 +312,7 @@ struct DMA1
   struct CH3MADDR : public RegisterBase<0x40020050, 32, ReadWriteMode>
   {
     using MADDR = DMA1_CH3MADDR_MADDR_Values<DMA1::CH3MADDR, 0, 32, ReadWriteMode, DMA1CH3MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH3MADDR_MADDR_Values<DMA1::CH3MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -313,6 +335,8 @@ struct DMA1
     using MWIDTH = DMA1_CH4CTL_MWIDTH_Values<DMA1::CH4CTL, 10, 2, ReadWriteMode, DMA1CH4CTLBase> ;
     using PRIO = DMA1_CH4CTL_PRIO_Values<DMA1::CH4CTL, 12, 2, ReadWriteMode, DMA1CH4CTLBase> ;
     using M2M = DMA1_CH4CTL_M2M_Values<DMA1::CH4CTL, 14, 1, ReadWriteMode, DMA1CH4CTLBase> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CH4CTL_M2M_Values<DMA1::CH4CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -324,6 +348,7 @@ struct DMA1
   struct CH4CNT : public RegisterBase<0x4002005C, 32, ReadWriteMode>
   {
     using CNT = DMA1_CH4CNT_CNT_Values<DMA1::CH4CNT, 0, 16, ReadWriteMode, DMA1CH4CNTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CH4CNT_CNT_Values<DMA1::CH4CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -335,6 +360,7 @@ struct DMA1
   struct CH4PADDR : public RegisterBase<0x40020060, 32, ReadWriteMode>
   {
     using PADDR = DMA1_CH4PADDR_PADDR_Values<DMA1::CH4PADDR, 0, 32, ReadWriteMode, DMA1CH4PADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH4PADDR_PADDR_Values<DMA1::CH4PADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -346,12 +372,14 @@ struct DMA1
   struct CH4MADDR : public RegisterBase<0x40020064, 32, ReadWriteMode>
   {
     using MADDR = DMA1_CH4MADDR_MADDR_Values<DMA1::CH4MADDR, 0, 32, ReadWriteMode, DMA1CH4MADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CH4MADDR_MADDR_Values<DMA1::CH4MADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CH4MADDRPack  = Register<0x40020064, 32, ReadWriteMode, DMA1CH4MADDRBase, T...> ;
 
+  using Registers = TypesList<DMA1::INTF, DMA1::INTC, DMA1::CH0CTL, DMA1::CH0CNT, DMA1::CH0PADDR, DMA1::CH0MADDR, DMA1::CH1CTL, DMA1::CH1CNT, DMA1::CH1PADDR, DMA1::CH1MADDR, DMA1::CH2CTL, DMA1::CH2CNT, DMA1::CH2PADDR, DMA1::CH2MADDR, DMA1::CH3CTL, DMA1::CH3CNT, DMA1::CH3PADDR, DMA1::CH3MADDR, DMA1::CH4CTL, DMA1::CH4CNT, DMA1::CH4PADDR, DMA1::CH4MADDR> ;
 } ;
 
 #endif //#if !defined(DMA1REGISTERS_HPP)
@@ -22,6 +22,7 @@ struct ECLIC
   struct CLICCFG : public RegisterBase<0xD2000000, 8, ReadWriteMode>
   {
     using NLBITS = ECLIC_CLICCFG_NLBITS_Values<ECLIC::CLICCFG, 1, 4, ReadWriteMode, ECLICCLICCFGBase> ;
+    static constexpr Type SnapshotMask = 0x1EU ;
     using FieldValues = ECLIC_CLICCFG_NLBITS_Values<ECLIC::CLICCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,6 +47,7 @@ struct ECLIC
   struct MTH : public RegisterBase<0xD200000B, 8, ReadWriteMode>
   {
     using MTHField = ECLIC_MTH_MTH_Values<ECLIC::MTH, 0, 8, ReadWriteMode, ECLICMTHBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_MTH_MTH_Values<ECLIC::MTH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct ECLIC
   struct CLICINTIP_0 : public RegisterBase<0xD2001000, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_0_IP_Values<ECLIC::CLICINTIP_0, 0, 1, ReadWriteMode, ECLICCLICINTIP_0Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_0_IP_Values<ECLIC::CLICINTIP_0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -68,6 +71,7 @@ struct ECLIC
   struct CLICINTIP_1 : public RegisterBase<0xD2001004, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_1_IP_Values<ECLIC::CLICINTIP_1, 0, 1, ReadWriteMode, ECLICCLICINTIP_1Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_1_IP_Values<ECLIC::CLICINTIP_1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +83,7 @@ struct ECLIC
   struct CLICINTIP_2 : public RegisterBase<0xD2001008, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_2_IP_Values<ECLIC::CLICINTIP_2, 0, 1, ReadWriteMode, ECLICCLICINTIP_2Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_2_IP_Values<ECLIC::CLICINTIP_2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +95,7 @@ struct ECLIC
   struct CLICINTIP_3 : public RegisterBase<0xD200100C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_3_IP_Values<ECLIC::CLICINTIP_3, 0, 1, ReadWriteMode, ECLICCLICINTIP_3Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_3_IP_Values<ECLIC::CLICINTIP_3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +107,7 @@ struct ECLIC
   struct CLICINTIP_4 : public RegisterBase<0xD2001010, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_4_IP_Values<ECLIC::CLICINTIP_4, 0, 1, ReadWriteMode, ECLICCLICINTIP_4Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_4_IP_Values<ECLIC::CLICINTIP_4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +119,7 @@ struct ECLIC
   struct CLICINTIP_5 : public RegisterBase<0xD2001014, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_5_IP_Values<ECLIC::CLICINTIP_5, 0, 1, ReadWriteMode, ECLICCLICINTIP_5Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_5_IP_Values<ECLIC::CLICINTIP_5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -123,6 +131,7 @@ struct ECLIC
   struct CLICINTIP_6 : public RegisterBase<0xD2001018, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_6_IP_Values<ECLIC::CLICINTIP_6, 0, 1, ReadWriteMode, ECLICCLICINTIP_6Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_6_IP_Values<ECLIC::CLICINTIP_6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +143,7 @@ struct ECLIC
   struct CLICINTIP_7 : public RegisterBase<0xD200101C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_7_IP_Values<ECLIC::CLICINTIP_7, 0, 1, ReadWriteMode, ECLICCLICINTIP_7Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_7_IP_Values<ECLIC::CLICINTIP_7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +155,7 @@ struct ECLIC
   struct CLICINTIP_8 : public RegisterBase<0xD2001020, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_8_IP_Values<ECLIC::CLICINTIP_8, 0, 1, ReadWriteMode, ECLICCLICINTIP_8Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_8_IP_Values<ECLIC::CLICINTIP_8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -156,6 +167,7 @@ struct ECLIC
   struct CLICINTIP_9 : public RegisterBase<0xD2001024, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_9_IP_Values<ECLIC::CLICINTIP_9, 0, 1, ReadWriteMode, ECLICCLICINTIP_9Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_9_IP_Values<ECLIC::CLICINTIP_9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +179,7 @@ struct ECLIC
   struct CLICINTIP_10 : public RegisterBase<0xD2001028, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_10_IP_Values<ECLIC::CLICINTIP_10, 0, 1, ReadWriteMode, ECLICCLICINTIP_10Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_10_IP_Values<ECLIC::CLICINTIP_10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -178,6 +191,7 @@ struct ECLIC
   struct CLICINTIP_11 : public RegisterBase<0xD200102C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_11_IP_Values<ECLIC::CLICINTIP_11, 0, 1, ReadWriteMode, ECLICCLICINTIP_11Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_11_IP_Values<ECLIC::CLICINTIP_11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +203,7 @@ struct ECLIC
   struct CLICINTIP_12 : public RegisterBase<0xD2001030, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_12_IP_Values<ECLIC::CLICINTIP_12, 0, 1, ReadWriteMode, ECLICCLICINTIP_12Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_12_IP_Values<ECLIC::CLICINTIP_12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -200,6 +215,7 @@ struct ECLIC
   struct CLICINTIP_13 : public RegisterBase<0xD2001034, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_13_IP_Values<ECLIC::CLICINTIP_13, 0, 1, ReadWriteMode, ECLICCLICINTIP_13Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_13_IP_Values<ECLIC::CLICINTIP_13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +227,7 @@ struct ECLIC
   struct CLICINTIP_14 : public RegisterBase<0xD2001038, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_14_IP_Values<ECLIC::CLICINTIP_14, 0, 1, ReadWriteMode, ECLICCLICINTIP_14Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_14_IP_Values<ECLIC::CLICINTIP_14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +239,7 @@ struct ECLIC
   struct CLICINTIP_15 : public RegisterBase<0xD200103C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_15_IP_Values<ECLIC::CLICINTIP_15, 0, 1, ReadWriteMode, ECLICCLICINTIP_15Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_15_IP_Values<ECLIC::CLICINTIP_15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +251,7 @@ struct ECLIC
   struct CLICINTIP_16 : public RegisterBase<0xD2001040, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_16_IP_Values<ECLIC::CLICINTIP_16, 0, 1, ReadWriteMode, ECLICCLICINTIP_16Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_16_IP_Values<ECLIC::CLICINTIP_16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -244,6 +263,7 @@ struct ECLIC
   struct CLICINTIP_17 : public RegisterBase<0xD2001044, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_17_IP_Values<ECLIC::CLICINTIP_17, 0, 1, ReadWriteMode, ECLICCLICINTIP_17Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_17_IP_Values<ECLIC::CLICINTIP_17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +275,7 @@ struct ECLIC
   struct CLICINTIP_18 : public RegisterBase<0xD2001048, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_18_IP_Values<ECLIC::CLICINTIP_18, 0, 1, ReadWriteMode, ECLICCLICINTIP_18Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_18_IP_Values<ECLIC::CLICINTIP_18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +287,7 @@ struct ECLIC
   struct CLICINTIP_19 : public RegisterBase<0xD200104C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_19_IP_Values<ECLIC::CLICINTIP_19, 0, 1, ReadWriteMode, ECLICCLICINTIP_19Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_19_IP_Values<ECLIC::CLICINTIP_19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -277,6 +299,7 @@ struct ECLIC
   struct CLICINTIP_20 : public RegisterBase<0xD2001050, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_20_IP_Values<ECLIC::CLICINTIP_20, 0, 1, ReadWriteMode, ECLICCLICINTIP_20Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_20_IP_Values<ECLIC::CLICINTIP_20, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -288,6 +311,7 @@ struct ECLIC
   struct CLICINTIP_21 : public RegisterBase<0xD2001054, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_21_IP_Values<ECLIC::CLICINTIP_21, 0, 1, ReadWriteMode, ECLICCLICINTIP_21Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_21_IP_Values<ECLIC::CLICINTIP_21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -299,6 +323,7 @@ struct ECLIC
   struct CLICINTIP_22 : public RegisterBase<0xD2001058, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_22_IP_Values<ECLIC::CLICINTIP_22, 0, 1, ReadWriteMode, ECLICCLICINTIP_22Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_22_IP_Values<ECLIC::CLICINTIP_22, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -310,6 +335,7 @@ struct ECLIC
   struct CLICINTIP_23 : public RegisterBase<0xD200105C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_23_IP_Values<ECLIC::CLICINTIP_23, 0, 1, ReadWriteMode, ECLICCLICINTIP_23Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_23_IP_Values<ECLIC::CLICINTIP_23, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -321,6 +347,7 @@ struct ECLIC
   struct CLICINTIP_24 : public RegisterBase<0xD2001060, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_24_IP_Values<ECLIC::CLICINTIP_24, 0, 1, ReadWriteMode, ECLICCLICINTIP_24Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_24_IP_Values<ECLIC::CLICINTIP_24, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -332,6 +359,7 @@ struct ECLIC
   struct CLICINTIP_25 : public RegisterBase<0xD2001064, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_25_IP_Values<ECLIC::CLICINTIP_25, 0, 1, ReadWriteMode, ECLICCLICINTIP_25Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_25_IP_Values<ECLIC::CLICINTIP_25, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -343,6 +371,7 @@ struct ECLIC
   struct CLICINTIP_26 : public RegisterBase<0xD2001068, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_26_IP_Values<ECLIC::CLICINTIP_26, 0, 1, ReadWriteMode, ECLICCLICINTIP_26Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_26_IP_Values<ECLIC::CLICINTIP_26, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -354,6 +383,7 @@ struct ECLIC
   struct CLICINTIP_27 : public RegisterBase<0xD200106C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_27_IP_Values<ECLIC::CLICINTIP_27, 0, 1, ReadWriteMode, ECLICCLICINTIP_27Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_27_IP_Values<ECLIC::CLICINTIP_27, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -365,6 +395,7 @@ struct ECLIC
   struct CLICINTIP_28 : public RegisterBase<0xD2001070, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_28_IP_Values<ECLIC::CLICINTIP_28, 0, 1, ReadWriteMode, ECLICCLICINTIP_28Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_28_IP_Values<ECLIC::CLICINTIP_28, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -376,6 +407,7 @@ struct ECLIC
   struct CLICINTIP_29 : public RegisterBase<0xD2001074, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_29_IP_Values<ECLIC::CLICINTIP_29, 0, 1, ReadWriteMode, ECLICCLICINTIP_29Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_29_IP_Values<ECLIC::CLICINTIP_29, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -387,6 +419,7 @@ struct ECLIC
   struct CLICINTIP_30 : public RegisterBase<0xD2001078, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_30_IP_Values<ECLIC::CLICINTIP_30, 0, 1, ReadWriteMode, ECLICCLICINTIP_30Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_30_IP_Values<ECLIC::CLICINTIP_30, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -398,6 +431,7 @@ struct ECLIC
   struct CLICINTIP_31 : public RegisterBase<0xD200107C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_31_IP_Values<ECLIC::CLICINTIP_31, 0, 1, ReadWriteMode, ECLICCLICINTIP_31Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_31_IP_Values<ECLIC::CLICINTIP_31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -409,6 +443,7 @@ struct ECLIC
   struct CLICINTIP_32 : public RegisterBase<0xD2001080, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_32_IP_Values<ECLIC::CLICINTIP_32, 0, 1, ReadWriteMode, ECLICCLICINTIP_32Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_32_IP_Values<ECLIC::CLICINTIP_32, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -420,6 +455,7 @@ struct ECLIC
   struct CLICINTIP_33 : public RegisterBase<0xD2001084, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_33_IP_Values<ECLIC::CLICINTIP_33, 0, 1, ReadWriteMode, ECLICCLICINTIP_33Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_33_IP_Values<ECLIC::CLICINTIP_33, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -431,6 +467,7 @@ struct ECLIC
   struct CLICINTIP_34 : public RegisterBase<0xD2001088, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_34_IP_Values<ECLIC::CLICINTIP_34, 0, 1, ReadWriteMode, ECLICCLICINTIP_34Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_34_IP_Values<ECLIC::CLICINTIP_34, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -442,6 +479,7 @@ struct ECLIC
   struct CLICINTIP_35 : public RegisterBase<0xD200108C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_35_IP_Values<ECLIC::CLICINTIP_35, 0, 1, ReadWriteMode, ECLICCLICINTIP_35Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_35_IP_Values<ECLIC::CLICINTIP_35, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -453,6 +491,7 @@ struct ECLIC
   struct CLICINTIP_36 : public RegisterBase<0xD2001090, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_36_IP_Values<ECLIC::CLICINTIP_36, 0, 1, ReadWriteMode, ECLICCLICINTIP_36Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_36_IP_Values<ECLIC::CLICINTIP_36, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -464,6 +503,7 @@ struct ECLIC
   struct CLICINTIP_37 : public RegisterBase<0xD2001094, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_37_IP_Values<ECLIC::CLICINTIP_37, 0, 1, ReadWriteMode, ECLICCLICINTIP_37Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_37_IP_Values<ECLIC::CLICINTIP_37, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -475,6 +515,7 @@ struct ECLIC
   struct CLICINTIP_38 : public RegisterBase<0xD2001098, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_38_IP_Values<ECLIC::CLICINTIP_38, 0, 1, ReadWriteMode, ECLICCLICINTIP_38Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_38_IP_Values<ECLIC::CLICINTIP_38, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -486,6 +527,7 @@ struct ECLIC
   struct CLICINTIP_39 : public RegisterBase<0xD200109C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_39_IP_Values<ECLIC::CLICINTIP_39, 0, 1, ReadWriteMode, ECLICCLICINTIP_39Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_39_IP_Values<ECLIC::CLICINTIP_39, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -497,6 +539,7 @@ struct ECLIC
   struct CLICINTIP_40 : public RegisterBase<0xD20010A0, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_40_IP_Values<ECLIC::CLICINTIP_40, 0, 1, ReadWriteMode, ECLICCLICINTIP_40Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_40_IP_Values<ECLIC::CLICINTIP_40, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -508,6 +551,7 @@ struct ECLIC
   struct CLICINTIP_41 : public RegisterBase<0xD20010A4, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_41_IP_Values<ECLIC::CLICINTIP_41, 0, 1, ReadWriteMode, ECLICCLICINTIP_41Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_41_IP_Values<ECLIC::CLICINTIP_41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -519,6 +563,7 @@ struct ECLIC
   struct CLICINTIP_42 : public RegisterBase<0xD20010A8, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_42_IP_Values<ECLIC::CLICINTIP_42, 0, 1, ReadWriteMode, ECLICCLICINTIP_42Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_42_IP_Values<ECLIC::CLICINTIP_42, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -530,6 +575,7 @@ struct ECLIC
   struct CLICINTIP_43 : public RegisterBase<0xD20010AC, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_43_IP_Values<ECLIC::CLICINTIP_43, 0, 1, ReadWriteMode, ECLICCLICINTIP_43Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_43_IP_Values<ECLIC::CLICINTIP_43, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -541,6 +587,7 @@ struct ECLIC
   struct CLICINTIP_44 : public RegisterBase<0xD20010B0, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_44_IP_Values<ECLIC::CLICINTIP_44, 0, 1, ReadWriteMode, ECLICCLICINTIP_44Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_44_IP_Values<ECLIC::CLICINTIP_44, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -552,6 +599,7 @@ struct ECLIC
   struct CLICINTIP_45 : public RegisterBase<0xD20010B4, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_45_IP_Values<ECLIC::CLICINTIP_45, 0, 1, ReadWriteMode, ECLICCLICINTIP_45Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_45_IP_Values<ECLIC::CLICINTIP_45, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -563,6 +611,7 @@ struct ECLIC
   struct CLICINTIP_46 : public RegisterBase<0xD20010B8, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_46_IP_Values<ECLIC::CLICINTIP_46, 0, 1, ReadWriteMode, ECLICCLICINTIP_46Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_46_IP_Values<ECLIC::CLICINTIP_46, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -574,6 +623,7 @@ struct ECLIC
   struct CLICINTIP_47 : public RegisterBase<0xD20010BC, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_47_IP_Values<ECLIC::CLICINTIP_47, 0, 1, ReadWriteMode, ECLICCLICINTIP_47Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_47_IP_Values<ECLIC::CLICINTIP_47, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -585,6 +635,7 @@ struct ECLIC
   struct CLICINTIP_48 : public RegisterBase<0xD20010C0, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_48_IP_Values<ECLIC::CLICINTIP_48, 0, 1, ReadWriteMode, ECLICCLICINTIP_48Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_48_IP_Values<ECLIC::CLICINTIP_48, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -596,6 +647,7 @@ struct ECLIC
   struct CLICINTIP_49 : public RegisterBase<0xD20010C4, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_49_IP_Values<ECLIC::CLICINTIP_49, 0, 1, ReadWriteMode, ECLICCLICINTIP_49Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_49_IP_Values<ECLIC::CLICINTIP_49, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -607,6 +659,7 @@ struct ECLIC
   struct CLICINTIP_50 : public RegisterBase<0xD20010C8, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_50_IP_Values<ECLIC::CLICINTIP_50, 0, 1, ReadWriteMode, ECLICCLICINTIP_50Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_50_IP_Values<ECLIC::CLICINTIP_50, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -618,6 +671,7 @@ struct ECLIC
   struct CLICINTIP_51 : public RegisterBase<0xD20010CC, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_51_IP_Values<ECLIC::CLICINTIP_51, 0, 1, ReadWriteMode, ECLICCLICINTIP_51Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_51_IP_Values<ECLIC::CLICINTIP_51, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -629,6 +683,7 @@ struct ECLIC
   struct CLICINTIP_52 : public RegisterBase<0xD20010D0, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_52_IP_Values<ECLIC::CLICINTIP_52, 0, 1, ReadWriteMode, ECLICCLICINTIP_52Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_52_IP_Values<ECLIC::CLICINTIP_52, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -640,6 +695,7 @@ struct ECLIC
   struct CLICINTIP_53 : public RegisterBase<0xD20010D4, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_53_IP_Values<ECLIC::CLICINTIP_53, 0, 1, ReadWriteMode, ECLICCLICINTIP_53Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_53_IP_Values<ECLIC::CLICINTIP_53, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -651,6 +707,7 @@ struct ECLIC
   struct CLICINTIP_54 : public RegisterBase<0xD20010D8, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_54_IP_Values<ECLIC::CLICINTIP_54, 0, 1, ReadWriteMode, ECLICCLICINTIP_54Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_54_IP_Values<ECLIC::CLICINTIP_54, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -662,6 +719,7 @@ struct ECLIC
   struct CLICINTIP_55 : public RegisterBase<0xD20010DC, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_55_IP_Values<ECLIC::CLICINTIP_55, 0, 1, ReadWriteMode, ECLICCLICINTIP_55Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_55_IP_Values<ECLIC::CLICINTIP_55, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -673,6 +731,7 @@ struct ECLIC
   struct CLICINTIP_56 : public RegisterBase<0xD20010E0, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_56_IP_Values<ECLIC::CLICINTIP_56, 0, 1, ReadWriteMode, ECLICCLICINTIP_56Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_56_IP_Values<ECLIC::CLICINTIP_56, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -684,6 +743,7 @@ struct ECLIC
   struct CLICINTIP_57 : public RegisterBase<0xD20010E4, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_57_IP_Values<ECLIC::CLICINTIP_57, 0, 1, ReadWriteMode, ECLICCLICINTIP_57Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_57_IP_Values<ECLIC::CLICINTIP_57, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -695,6 +755,7 @@ struct ECLIC
   struct CLICINTIP_58 : public RegisterBase<0xD20010E8, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_58_IP_Values<ECLIC::CLICINTIP_58, 0, 1, ReadWriteMode, ECLICCLICINTIP_58Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_58_IP_Values<ECLIC::CLICINTIP_58, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -706,6 +767,7 @@ struct ECLIC
   struct CLICINTIP_59 : public RegisterBase<0xD20010EC, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_59_IP_Values<ECLIC::CLICINTIP_59, 0, 1, ReadWriteMode, ECLICCLICINTIP_59Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_59_IP_Values<ECLIC::CLICINTIP_59, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -717,6 +779,7 @@ struct ECLIC
   struct CLICINTIP_60 : public RegisterBase<0xD20010F0, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_60_IP_Values<ECLIC::CLICINTIP_60, 0, 1, ReadWriteMode, ECLICCLICINTIP_60Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_60_IP_Values<ECLIC::CLICINTIP_60, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -728,6 +791,7 @@ struct ECLIC
   struct CLICINTIP_61 : public RegisterBase<0xD20010F4, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_61_IP_Values<ECLIC::CLICINTIP_61, 0, 1, ReadWriteMode, ECLICCLICINTIP_61Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_61_IP_Values<ECLIC::CLICINTIP_61, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -739,6 +803,7 @@ struct ECLIC
   struct CLICINTIP_62 : public RegisterBase<0xD20010F8, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_62_IP_Values<ECLIC::CLICINTIP_62, 0, 1, ReadWriteMode, ECLICCLICINTIP_62Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_62_IP_Values<ECLIC::CLICINTIP_62, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -750,6 +815,7 @@ struct ECLIC
   struct CLICINTIP_63 : public RegisterBase<0xD20010FC, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_63_IP_Values<ECLIC::CLICINTIP_63, 0, 1, ReadWriteMode, ECLICCLICINTIP_63Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_63_IP_Values<ECLIC::CLICINTIP_63, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -761,6 +827,7 @@ struct ECLIC
   struct CLICINTIP_64 : public RegisterBase<0xD2001100, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_64_IP_Values<ECLIC::CLICINTIP_64, 0, 1, ReadWriteMode, ECLICCLICINTIP_64Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_64_IP_Values<ECLIC::CLICINTIP_64, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -772,6 +839,7 @@ struct ECLIC
   struct CLICINTIP_65 : public RegisterBase<0xD2001104, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_65_IP_Values<ECLIC::CLICINTIP_65, 0, 1, ReadWriteMode, ECLICCLICINTIP_65Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_65_IP_Values<ECLIC::CLICINTIP_65, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -783,6 +851,7 @@ struct ECLIC
   struct CLICINTIP_66 : public RegisterBase<0xD2001108, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_66_IP_Values<ECLIC::CLICINTIP_66, 0, 1, ReadWriteMode, ECLICCLICINTIP_66Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_66_IP_Values<ECLIC::CLICINTIP_66, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -794,6 +863,7 @@ struct ECLIC
   struct CLICINTIP_67 : public RegisterBase<0xD200110C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_67_IP_Values<ECLIC::CLICINTIP_67, 0, 1, ReadWriteMode, ECLICCLICINTIP_67Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_67_IP_Values<ECLIC::CLICINTIP_67, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -805,6 +875,7 @@ struct ECLIC
   struct CLICINTIP_68 : public RegisterBase<0xD2001110, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_68_IP_Values<ECLIC::CLICINTIP_68, 0, 1, ReadWriteMode, ECLICCLICINTIP_68Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_68_IP_Values<ECLIC::CLICINTIP_68, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -816,6 +887,7 @@ struct ECLIC
   struct CLICINTIP_69 : public RegisterBase<0xD2001114, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_69_IP_Values<ECLIC::CLICINTIP_69, 0, 1, ReadWriteMode, ECLICCLICINTIP_69Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_69_IP_Values<ECLIC::CLICINTIP_69, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -827,6 +899,7 @@ struct ECLIC
   struct CLICINTIP_70 : public RegisterBase<0xD2001118, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_70_IP_Values<ECLIC::CLICINTIP_70, 0, 1, ReadWriteMode, ECLICCLICINTIP_70Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_70_IP_Values<ECLIC::CLICINTIP_70, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -838,6 +911,7 @@ struct ECLIC
   struct CLICINTIP_71 : public RegisterBase<0xD200111C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_71_IP_Values<ECLIC::CLICINTIP_71, 0, 1, ReadWriteMode, ECLICCLICINTIP_71Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_71_IP_Values<ECLIC::CLICINTIP_71, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -849,6 +923,7 @@ struct ECLIC
   struct CLICINTIP_72 : public RegisterBase<0xD2001120, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_72_IP_Values<ECLIC::CLICINTIP_72, 0, 1, ReadWriteMode, ECLICCLICINTIP_72Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_72_IP_Values<ECLIC::CLICINTIP_72, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -860,6 +935,7 @@ struct ECLIC
   struct CLICINTIP_73 : public RegisterBase<0xD2001124, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_73_IP_Values<ECLIC::CLICINTIP_73, 0, 1, ReadWriteMode, ECLICCLICINTIP_73Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_73_IP_Values<ECLIC::CLICINTIP_73, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -871,6 +947,7 @@ struct ECLIC
   struct CLICINTIP_74 : public RegisterBase<0xD2001128, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_74_IP_Values<ECLIC::CLICINTIP_74, 0, 1, ReadWriteMode, ECLICCLICINTIP_74Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_74_IP_Values<ECLIC::CLICINTIP_74, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -882,6 +959,7 @@ struct ECLIC
   struct CLICINTIP_75 : public RegisterBase<0xD200112C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_75_IP_Values<ECLIC::CLICINTIP_75, 0, 1, ReadWriteMode, ECLICCLICINTIP_75Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_75_IP_Values<ECLIC::CLICINTIP_75, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -893,6 +971,7 @@ struct ECLIC
   struct CLICINTIP_76 : public RegisterBase<0xD2001130, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_76_IP_Values<ECLIC::CLICINTIP_76, 0, 1, ReadWriteMode, ECLICCLICINTIP_76Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_76_IP_Values<ECLIC::CLICINTIP_76, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -904,6 +983,7 @@ struct ECLIC
   struct CLICINTIP_77 : public RegisterBase<0xD2001134, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_77_IP_Values<ECLIC::CLICINTIP_77, 0, 1, ReadWriteMode, ECLICCLICINTIP_77Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_77_IP_Values<ECLIC::CLICINTIP_77, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -915,6 +995,7 @@ struct ECLIC
   struct CLICINTIP_78 : public RegisterBase<0xD2001138, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_78_IP_Values<ECLIC::CLICINTIP_78, 0, 1, ReadWriteMode, ECLICCLICINTIP_78Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_78_IP_Values<ECLIC::CLICINTIP_78, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -926,6 +1007,7 @@ struct ECLIC
   struct CLICINTIP_79 : public RegisterBase<0xD200113C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_79_IP_Values<ECLIC::CLICINTIP_79, 0, 1, ReadWriteMode, ECLICCLICINTIP_79Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_79_IP_Values<ECLIC::CLICINTIP_79, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -937,6 +1019,7 @@ struct ECLIC
   struct CLICINTIP_80 : public RegisterBase<0xD2001140, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_80_IP_Values<ECLIC::CLICINTIP_80, 0, 1, ReadWriteMode, ECLICCLICINTIP_80Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_80_IP_Values<ECLIC::CLICINTIP_80, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -948,6 +1031,7 @@ struct ECLIC
   struct CLICINTIP_81 : public RegisterBase<0xD2001144, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_81_IP_Values<ECLIC::CLICINTIP_81, 0, 1, ReadWriteMode, ECLICCLICINTIP_81Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_81_IP_Values<ECLIC::CLICINTIP_81, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -959,6 +1043,7 @@ struct ECLIC
   struct CLICINTIP_82 : public RegisterBase<0xD2001148, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_82_IP_Values<ECLIC::CLICINTIP_82, 0, 1, ReadWriteMode, ECLICCLICINTIP_82Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_82_IP_Values<ECLIC::CLICINTIP_82, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -970,6 +1055,7 @@ struct ECLIC
   struct CLICINTIP_83 : public RegisterBase<0xD200114C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_83_IP_Values<ECLIC::CLICINTIP_83, 0, 1, ReadWriteMode, ECLICCLICINTIP_83Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_83_IP_Values<ECLIC::CLICINTIP_83, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -981,6 +1067,7 @@ struct ECLIC
   struct CLICINTIP_84 : public RegisterBase<0xD2001150, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_84_IP_Values<ECLIC::CLICINTIP_84, 0, 1, ReadWriteMode, ECLICCLICINTIP_84Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_84_IP_Values<ECLIC::CLICINTIP_84, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -992,6 +1079,7 @@ struct ECLIC
   struct CLICINTIP_85 : public RegisterBase<0xD2001158, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_85_IP_Values<ECLIC::CLICINTIP_85, 0, 1, ReadWriteMode, ECLICCLICINTIP_85Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_85_IP_Values<ECLIC::CLICINTIP_85, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1003,6 +1091,7 @@ struct ECLIC
   struct CLICINTIP_86 : public RegisterBase<0xD200115C, 8, ReadWriteMode>
   {
     using IP = ECLIC_CLICINTIP_86_IP_Values<ECLIC::CLICINTIP_86, 0, 1, ReadWriteMode, ECLICCLICINTIP_86Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIP_86_IP_Values<ECLIC::CLICINTIP_86, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1014,6 +1103,7 @@ struct ECLIC
   struct CLICINTIE_0 : public RegisterBase<0xD2001001, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_0_IE_Values<ECLIC::CLICINTIE_0, 0, 1, ReadWriteMode, ECLICCLICINTIE_0Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_0_IE_Values<ECLIC::CLICINTIE_0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1025,6 +1115,7 @@ struct ECLIC
   struct CLICINTIE_1 : public RegisterBase<0xD2001005, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_1_IE_Values<ECLIC::CLICINTIE_1, 0, 1, ReadWriteMode, ECLICCLICINTIE_1Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_1_IE_Values<ECLIC::CLICINTIE_1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1036,6 +1127,7 @@ struct ECLIC
   struct CLICINTIE_2 : public RegisterBase<0xD2001009, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_2_IE_Values<ECLIC::CLICINTIE_2, 0, 1, ReadWriteMode, ECLICCLICINTIE_2Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_2_IE_Values<ECLIC::CLICINTIE_2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1047,6 +1139,7 @@ struct ECLIC
   struct CLICINTIE_3 : public RegisterBase<0xD200100D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_3_IE_Values<ECLIC::CLICINTIE_3, 0, 1, ReadWriteMode, ECLICCLICINTIE_3Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_3_IE_Values<ECLIC::CLICINTIE_3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1058,6 +1151,7 @@ struct ECLIC
   struct CLICINTIE_4 : public RegisterBase<0xD2001011, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_4_IE_Values<ECLIC::CLICINTIE_4, 0, 1, ReadWriteMode, ECLICCLICINTIE_4Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_4_IE_Values<ECLIC::CLICINTIE_4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1069,6 +1163,7 @@ struct ECLIC
   struct CLICINTIE_5 : public RegisterBase<0xD2001015, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_5_IE_Values<ECLIC::CLICINTIE_5, 0, 1, ReadWriteMode, ECLICCLICINTIE_5Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_5_IE_Values<ECLIC::CLICINTIE_5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1080,6 +1175,7 @@ struct ECLIC
   struct CLICINTIE_6 : public RegisterBase<0xD2001019, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_6_IE_Values<ECLIC::CLICINTIE_6, 0, 1, ReadWriteMode, ECLICCLICINTIE_6Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_6_IE_Values<ECLIC::CLICINTIE_6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1091,6 +1187,7 @@ struct ECLIC
   struct CLICINTIE_7 : public RegisterBase<0xD200101D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_7_IE_Values<ECLIC::CLICINTIE_7, 0, 1, ReadWriteMode, ECLICCLICINTIE_7Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_7_IE_Values<ECLIC::CLICINTIE_7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1102,6 +1199,7 @@ struct ECLIC
   struct CLICINTIE_8 : public RegisterBase<0xD2001021, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_8_IE_Values<ECLIC::CLICINTIE_8, 0, 1, ReadWriteMode, ECLICCLICINTIE_8Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_8_IE_Values<ECLIC::CLICINTIE_8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1113,6 +1211,7 @@ struct ECLIC
   struct CLICINTIE_9 : public RegisterBase<0xD2001025, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_9_IE_Values<ECLIC::CLICINTIE_9, 0, 1, ReadWriteMode, ECLICCLICINTIE_9Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_9_IE_Values<ECLIC::CLICINTIE_9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1124,6 +1223,7 @@ struct ECLIC
   struct CLICINTIE_10 : public RegisterBase<0xD2001029, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_10_IE_Values<ECLIC::CLICINTIE_10, 0, 1, ReadWriteMode, ECLICCLICINTIE_10Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_10_IE_Values<ECLIC::CLICINTIE_10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1135,6 +1235,7 @@ struct ECLIC
   struct CLICINTIE_11 : public RegisterBase<0xD200102D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_11_IE_Values<ECLIC::CLICINTIE_11, 0, 1, ReadWriteMode, ECLICCLICINTIE_11Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_11_IE_Values<ECLIC::CLICINTIE_11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1146,6 +1247,7 @@ struct ECLIC
   struct CLICINTIE_12 : public RegisterBase<0xD2001031, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_12_IE_Values<ECLIC::CLICINTIE_12, 0, 1, ReadWriteMode, ECLICCLICINTIE_12Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_12_IE_Values<ECLIC::CLICINTIE_12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1157,6 +1259,7 @@ struct ECLIC
   struct CLICINTIE_13 : public RegisterBase<0xD2001035, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_13_IE_Values<ECLIC::CLICINTIE_13, 0, 1, ReadWriteMode, ECLICCLICINTIE_13Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_13_IE_Values<ECLIC::CLICINTIE_13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1168,6 +1271,7 @@ struct ECLIC
   struct CLICINTIE_14 : public RegisterBase<0xD2001039, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_14_IE_Values<ECLIC::CLICINTIE_14, 0, 1, ReadWriteMode, ECLICCLICINTIE_14Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_14_IE_Values<ECLIC::CLICINTIE_14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1179,6 +1283,7 @@ struct ECLIC
   struct CLICINTIE_15 : public RegisterBase<0xD200103D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_15_IE_Values<ECLIC::CLICINTIE_15, 0, 1, ReadWriteMode, ECLICCLICINTIE_15Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_15_IE_Values<ECLIC::CLICINTIE_15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1190,6 +1295,7 @@ struct ECLIC
   struct CLICINTIE_16 : public RegisterBase<0xD2001041, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_16_IE_Values<ECLIC::CLICINTIE_16, 0, 1, ReadWriteMode, ECLICCLICINTIE_16Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_16_IE_Values<ECLIC::CLICINTIE_16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1201,6 +1307,7 @@ struct ECLIC
   struct CLICINTIE_17 : public RegisterBase<0xD2001045, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_17_IE_Values<ECLIC::CLICINTIE_17, 0, 1, ReadWriteMode, ECLICCLICINTIE_17Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_17_IE_Values<ECLIC::CLICINTIE_17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1212,6 +1319,7 @@ struct ECLIC
   struct CLICINTIE_18 : public RegisterBase<0xD2001049, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_18_IE_Values<ECLIC::CLICINTIE_18, 0, 1, ReadWriteMode, ECLICCLICINTIE_18Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_18_IE_Values<ECLIC::CLICINTIE_18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1223,6 +1331,7 @@ struct ECLIC
   struct CLICINTIE_19 : public RegisterBase<0xD200104D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_19_IE_Values<ECLIC::CLICINTIE_19, 0, 1, ReadWriteMode, ECLICCLICINTIE_19Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_19_IE_Values<ECLIC::CLICINTIE_19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1234,6 +1343,7 @@ struct ECLIC
   struct CLICINTIE_20 : public RegisterBase<0xD2001051, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_20_IE_Values<ECLIC::CLICINTIE_20, 0, 1, ReadWriteMode, ECLICCLICINTIE_20Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_20_IE_Values<ECLIC::CLICINTIE_20, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1245,6 +1355,7 @@ struct ECLIC
   struct CLICINTIE_21 : public RegisterBase<0xD2001055, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_21_IE_Values<ECLIC::CLICINTIE_21, 0, 1, ReadWriteMode, ECLICCLICINTIE_21Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_21_IE_Values<ECLIC::CLICINTIE_21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1256,6 +1367,7 @@ struct ECLIC
   struct CLICINTIE_22 : public RegisterBase<0xD2001059, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_22_IE_Values<ECLIC::CLICINTIE_22, 0, 1, ReadWriteMode, ECLICCLICINTIE_22Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_22_IE_Values<ECLIC::CLICINTIE_22, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1267,6 +1379,7 @@ struct ECLIC
   struct CLICINTIE_23 : public RegisterBase<0xD200105D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_23_IE_Values<ECLIC::CLICINTIE_23, 0, 1, ReadWriteMode, ECLICCLICINTIE_23Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_23_IE_Values<ECLIC::CLICINTIE_23, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1278,6 +1391,7 @@ struct ECLIC
   struct CLICINTIE_24 : public RegisterBase<0xD2001061, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_24_IE_Values<ECLIC::CLICINTIE_24, 0, 1, ReadWriteMode, ECLICCLICINTIE_24Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_24_IE_Values<ECLIC::CLICINTIE_24, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1289,6 +1403,7 @@ struct ECLIC
   struct CLICINTIE_25 : public RegisterBase<0xD2001065, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_25_IE_Values<ECLIC::CLICINTIE_25, 0, 1, ReadWriteMode, ECLICCLICINTIE_25Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_25_IE_Values<ECLIC::CLICINTIE_25, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1300,6 +1415,7 @@ struct ECLIC
   struct CLICINTIE_26 : public RegisterBase<0xD2001069, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_26_IE_Values<ECLIC::CLICINTIE_26, 0, 1, ReadWriteMode, ECLICCLICINTIE_26Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_26_IE_Values<ECLIC::CLICINTIE_26, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1311,6 +1427,7 @@ struct ECLIC
   struct CLICINTIE_27 : public RegisterBase<0xD200106D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_27_IE_Values<ECLIC::CLICINTIE_27, 0, 1, ReadWriteMode, ECLICCLICINTIE_27Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_27_IE_Values<ECLIC::CLICINTIE_27, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1322,6 +1439,7 @@ struct ECLIC
   struct CLICINTIE_28 : public RegisterBase<0xD2001071, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_28_IE_Values<ECLIC::CLICINTIE_28, 0, 1, ReadWriteMode, ECLICCLICINTIE_28Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_28_IE_Values<ECLIC::CLICINTIE_28, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1333,6 +1451,7 @@ struct ECLIC
   struct CLICINTIE_29 : public RegisterBase<0xD2001075, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_29_IE_Values<ECLIC::CLICINTIE_29, 0, 1, ReadWriteMode, ECLICCLICINTIE_29Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_29_IE_Values<ECLIC::CLICINTIE_29, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1344,6 +1463,7 @@ struct ECLIC
   struct CLICINTIE_30 : public RegisterBase<0xD2001079, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_30_IE_Values<ECLIC::CLICINTIE_30, 0, 1, ReadWriteMode, ECLICCLICINTIE_30Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_30_IE_Values<ECLIC::CLICINTIE_30, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1355,6 +1475,7 @@ struct ECLIC
   struct CLICINTIE_31 : public RegisterBase<0xD200107D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_31_IE_Values<ECLIC::CLICINTIE_31, 0, 1, ReadWriteMode, ECLICCLICINTIE_31Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_31_IE_Values<ECLIC::CLICINTIE_31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1366,6 +1487,7 @@ struct ECLIC
   struct CLICINTIE_32 : public RegisterBase<0xD2001081, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_32_IE_Values<ECLIC::CLICINTIE_32, 0, 1, ReadWriteMode, ECLICCLICINTIE_32Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_32_IE_Values<ECLIC::CLICINTIE_32, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1377,6 +1499,7 @@ struct ECLIC
   struct CLICINTIE_33 : public RegisterBase<0xD2001085, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_33_IE_Values<ECLIC::CLICINTIE_33, 0, 1, ReadWriteMode, ECLICCLICINTIE_33Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_33_IE_Values<ECLIC::CLICINTIE_33, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1388,6 +1511,7 @@ struct ECLIC
   struct CLICINTIE_34 : public RegisterBase<0xD2001089, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_34_IE_Values<ECLIC::CLICINTIE_34, 0, 1, ReadWriteMode, ECLICCLICINTIE_34Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_34_IE_Values<ECLIC::CLICINTIE_34, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1399,6 +1523,7 @@ struct ECLIC
   struct CLICINTIE_35 : public RegisterBase<0xD200108D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_35_IE_Values<ECLIC::CLICINTIE_35, 0, 1, ReadWriteMode, ECLICCLICINTIE_35Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_35_IE_Values<ECLIC::CLICINTIE_35, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1410,6 +1535,7 @@ struct ECLIC
   struct CLICINTIE_36 : public RegisterBase<0xD2001091, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_36_IE_Values<ECLIC::CLICINTIE_36, 0, 1, ReadWriteMode, ECLICCLICINTIE_36Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_36_IE_Values<ECLIC::CLICINTIE_36, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1421,6 +1547,7 @@ struct ECLIC
   struct CLICINTIE_37 : public RegisterBase<0xD2001095, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_37_IE_Values<ECLIC::CLICINTIE_37, 0, 1, ReadWriteMode, ECLICCLICINTIE_37Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_37_IE_Values<ECLIC::CLICINTIE_37, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1432,6 +1559,7 @@ struct ECLIC
   struct CLICINTIE_38 : public RegisterBase<0xD2001099, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_38_IE_Values<ECLIC::CLICINTIE_38, 0, 1, ReadWriteMode, ECLICCLICINTIE_38Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_38_IE_Values<ECLIC::CLICINTIE_38, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1443,6 +1571,7 @@ struct ECLIC
   struct CLICINTIE_39 : public RegisterBase<0xD200109D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_39_IE_Values<ECLIC::CLICINTIE_39, 0, 1, ReadWriteMode, ECLICCLICINTIE_39Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_39_IE_Values<ECLIC::CLICINTIE_39, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1454,6 +1583,7 @@ struct ECLIC
   struct CLICINTIE_40 : public RegisterBase<0xD20010A1, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_40_IE_Values<ECLIC::CLICINTIE_40, 0, 1, ReadWriteMode, ECLICCLICINTIE_40Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_40_IE_Values<ECLIC::CLICINTIE_40, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1465,6 +1595,7 @@ struct ECLIC
   struct CLICINTIE_41 : public RegisterBase<0xD20010A5, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_41_IE_Values<ECLIC::CLICINTIE_41, 0, 1, ReadWriteMode, ECLICCLICINTIE_41Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_41_IE_Values<ECLIC::CLICINTIE_41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1476,6 +1607,7 @@ struct ECLIC
   struct CLICINTIE_42 : public RegisterBase<0xD20010A9, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_42_IE_Values<ECLIC::CLICINTIE_42, 0, 1, ReadWriteMode, ECLICCLICINTIE_42Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_42_IE_Values<ECLIC::CLICINTIE_42, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1487,6 +1619,7 @@ struct ECLIC
   struct CLICINTIE_43 : public RegisterBase<0xD20010AD, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_43_IE_Values<ECLIC::CLICINTIE_43, 0, 1, ReadWriteMode, ECLICCLICINTIE_43Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_43_IE_Values<ECLIC::CLICINTIE_43, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1498,6 +1631,7 @@ struct ECLIC
   struct CLICINTIE_44 : public RegisterBase<0xD20010B1, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_44_IE_Values<ECLIC::CLICINTIE_44, 0, 1, ReadWriteMode, ECLICCLICINTIE_44Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_44_IE_Values<ECLIC::CLICINTIE_44, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1509,6 +1643,7 @@ struct ECLIC
   struct CLICINTIE_45 : public RegisterBase<0xD20010B5, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_45_IE_Values<ECLIC::CLICINTIE_45, 0, 1, ReadWriteMode, ECLICCLICINTIE_45Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_45_IE_Values<ECLIC::CLICINTIE_45, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1520,6 +1655,7 @@ struct ECLIC
   struct CLICINTIE_46 : public RegisterBase<0xD20010B9, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_46_IE_Values<ECLIC::CLICINTIE_46, 0, 1, ReadWriteMode, ECLICCLICINTIE_46Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_46_IE_Values<ECLIC::CLICINTIE_46, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1531,6 +1667,7 @@ struct ECLIC
   struct CLICINTIE_47 : public RegisterBase<0xD20010BD, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_47_IE_Values<ECLIC::CLICINTIE_47, 0, 1, ReadWriteMode, ECLICCLICINTIE_47Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_47_IE_Values<ECLIC::CLICINTIE_47, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1542,6 +1679,7 @@ struct ECLIC
   struct CLICINTIE_48 : public RegisterBase<0xD20010C1, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_48_IE_Values<ECLIC::CLICINTIE_48, 0, 1, ReadWriteMode, ECLICCLICINTIE_48Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_48_IE_Values<ECLIC::CLICINTIE_48, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1553,6 +1691,7 @@ struct ECLIC
   struct CLICINTIE_49 : public RegisterBase<0xD20010C5, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_49_IE_Values<ECLIC::CLICINTIE_49, 0, 1, ReadWriteMode, ECLICCLICINTIE_49Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_49_IE_Values<ECLIC::CLICINTIE_49, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1564,6 +1703,7 @@ struct ECLIC
   struct CLICINTIE_50 : public RegisterBase<0xD20010C9, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_50_IE_Values<ECLIC::CLICINTIE_50, 0, 1, ReadWriteMode, ECLICCLICINTIE_50Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_50_IE_Values<ECLIC::CLICINTIE_50, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1575,6 +1715,7 @@ struct ECLIC
   struct CLICINTIE_51 : public RegisterBase<0xD20010CD, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_51_IE_Values<ECLIC::CLICINTIE_51, 0, 1, ReadWriteMode, ECLICCLICINTIE_51Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_51_IE_Values<ECLIC::CLICINTIE_51, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1586,6 +1727,7 @@ struct ECLIC
   struct CLICINTIE_52 : public RegisterBase<0xD20010D1, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_52_IE_Values<ECLIC::CLICINTIE_52, 0, 1, ReadWriteMode, ECLICCLICINTIE_52Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_52_IE_Values<ECLIC::CLICINTIE_52, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1597,6 +1739,7 @@ struct ECLIC
   struct CLICINTIE_53 : public RegisterBase<0xD20010D5, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_53_IE_Values<ECLIC::CLICINTIE_53, 0, 1, ReadWriteMode, ECLICCLICINTIE_53Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_53_IE_Values<ECLIC::CLICINTIE_53, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1608,6 +1751,7 @@ struct ECLIC
   struct CLICINTIE_54 : public RegisterBase<0xD20010D9, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_54_IE_Values<ECLIC::CLICINTIE_54, 0, 1, ReadWriteMode, ECLICCLICINTIE_54Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_54_IE_Values<ECLIC::CLICINTIE_54, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1619,6 +1763,7 @@ struct ECLIC
   struct CLICINTIE_55 : public RegisterBase<0xD20010DD, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_55_IE_Values<ECLIC::CLICINTIE_55, 0, 1, ReadWriteMode, ECLICCLICINTIE_55Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_55_IE_Values<ECLIC::CLICINTIE_55, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1630,6 +1775,7 @@ struct ECLIC
   struct CLICINTIE_56 : public RegisterBase<0xD20010E1, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_56_IE_Values<ECLIC::CLICINTIE_56, 0, 1, ReadWriteMode, ECLICCLICINTIE_56Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_56_IE_Values<ECLIC::CLICINTIE_56, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1641,6 +1787,7 @@ struct ECLIC
   struct CLICINTIE_57 : public RegisterBase<0xD20010E5, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_57_IE_Values<ECLIC::CLICINTIE_57, 0, 1, ReadWriteMode, ECLICCLICINTIE_57Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_57_IE_Values<ECLIC::CLICINTIE_57, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1652,6 +1799,7 @@ struct ECLIC
   struct CLICINTIE_58 : public RegisterBase<0xD20010E9, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_58_IE_Values<ECLIC::CLICINTIE_58, 0, 1, ReadWriteMode, ECLICCLICINTIE_58Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_58_IE_Values<ECLIC::CLICINTIE_58, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1663,6 +1811,7 @@ struct ECLIC
   struct CLICINTIE_59 : public RegisterBase<0xD20010ED, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_59_IE_Values<ECLIC::CLICINTIE_59, 0, 1, ReadWriteMode, ECLICCLICINTIE_59Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_59_IE_Values<ECLIC::CLICINTIE_59, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1674,6 +1823,7 @@ struct ECLIC
   struct CLICINTIE_60 : public RegisterBase<0xD20010F1, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_60_IE_Values<ECLIC::CLICINTIE_60, 0, 1, ReadWriteMode, ECLICCLICINTIE_60Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_60_IE_Values<ECLIC::CLICINTIE_60, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1685,6 +1835,7 @@ struct ECLIC
   struct CLICINTIE_61 : public RegisterBase<0xD20010F5, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_61_IE_Values<ECLIC::CLICINTIE_61, 0, 1, ReadWriteMode, ECLICCLICINTIE_61Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_61_IE_Values<ECLIC::CLICINTIE_61, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1696,6 +1847,7 @@ struct ECLIC
   struct CLICINTIE_62 : public RegisterBase<0xD20010F9, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_62_IE_Values<ECLIC::CLICINTIE_62, 0, 1, ReadWriteMode, ECLICCLICINTIE_62Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_62_IE_Values<ECLIC::CLICINTIE_62, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1707,6 +1859,7 @@ struct ECLIC
   struct CLICINTIE_63 : public RegisterBase<0xD20010FD, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_63_IE_Values<ECLIC::CLICINTIE_63, 0, 1, ReadWriteMode, ECLICCLICINTIE_63Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_63_IE_Values<ECLIC::CLICINTIE_63, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1718,6 +1871,7 @@ struct ECLIC
   struct CLICINTIE_64 : public RegisterBase<0xD2001101, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_64_IE_Values<ECLIC::CLICINTIE_64, 0, 1, ReadWriteMode, ECLICCLICINTIE_64Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_64_IE_Values<ECLIC::CLICINTIE_64, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1729,6 +1883,7 @@ struct ECLIC
   struct CLICINTIE_65 : public RegisterBase<0xD2001105, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_65_IE_Values<ECLIC::CLICINTIE_65, 0, 1, ReadWriteMode, ECLICCLICINTIE_65Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_65_IE_Values<ECLIC::CLICINTIE_65, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1740,6 +1895,7 @@ struct ECLIC
   struct CLICINTIE_66 : public RegisterBase<0xD2001109, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_66_IE_Values<ECLIC::CLICINTIE_66, 0, 1, ReadWriteMode, ECLICCLICINTIE_66Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_66_IE_Values<ECLIC::CLICINTIE_66, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1751,6 +1907,7 @@ struct ECLIC
   struct CLICINTIE_67 : public RegisterBase<0xD200110D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_67_IE_Values<ECLIC::CLICINTIE_67, 0, 1, ReadWriteMode, ECLICCLICINTIE_67Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_67_IE_Values<ECLIC::CLICINTIE_67, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1762,6 +1919,7 @@ struct ECLIC
   struct CLICINTIE_68 : public RegisterBase<0xD2001111, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_68_IE_Values<ECLIC::CLICINTIE_68, 0, 1, ReadWriteMode, ECLICCLICINTIE_68Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_68_IE_Values<ECLIC::CLICINTIE_68, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1773,6 +1931,7 @@ struct ECLIC
   struct CLICINTIE_69 : public RegisterBase<0xD2001115, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_69_IE_Values<ECLIC::CLICINTIE_69, 0, 1, ReadWriteMode, ECLICCLICINTIE_69Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_69_IE_Values<ECLIC::CLICINTIE_69, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1784,6 +1943,7 @@ struct ECLIC
   struct CLICINTIE_70 : public RegisterBase<0xD2001119, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_70_IE_Values<ECLIC::CLICINTIE_70, 0, 1, ReadWriteMode, ECLICCLICINTIE_70Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_70_IE_Values<ECLIC::CLICINTIE_70, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1795,6 +1955,7 @@ struct ECLIC
   struct CLICINTIE_71 : public RegisterBase<0xD200111D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_71_IE_Values<ECLIC::CLICINTIE_71, 0, 1, ReadWriteMode, ECLICCLICINTIE_71Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_71_IE_Values<ECLIC::CLICINTIE_71, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1806,6 +1967,7 @@ struct ECLIC
   struct CLICINTIE_72 : public RegisterBase<0xD2001121, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_72_IE_Values<ECLIC::CLICINTIE_72, 0, 1, ReadWriteMode, ECLICCLICINTIE_72Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_72_IE_Values<ECLIC::CLICINTIE_72, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1817,6 +1979,7 @@ struct ECLIC
   struct CLICINTIE_73 : public RegisterBase<0xD2001125, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_73_IE_Values<ECLIC::CLICINTIE_73, 0, 1, ReadWriteMode, ECLICCLICINTIE_73Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_73_IE_Values<ECLIC::CLICINTIE_73, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1828,6 +1991,7 @@ struct ECLIC
   struct CLICINTIE_74 : public RegisterBase<0xD2001129, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_74_IE_Values<ECLIC::CLICINTIE_74, 0, 1, ReadWriteMode, ECLICCLICINTIE_74Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_74_IE_Values<ECLIC::CLICINTIE_74, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1839,6 +2003,7 @@ struct ECLIC
   struct CLICINTIE_75 : public RegisterBase<0xD200112D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_75_IE_Values<ECLIC::CLICINTIE_75, 0, 1, ReadWriteMode, ECLICCLICINTIE_75Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_75_IE_Values<ECLIC::CLICINTIE_75, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1850,6 +2015,7 @@ struct ECLIC
   struct CLICINTIE_76 : public RegisterBase<0xD2001131, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_76_IE_Values<ECLIC::CLICINTIE_76, 0, 1, ReadWriteMode, ECLICCLICINTIE_76Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_76_IE_Values<ECLIC::CLICINTIE_76, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1861,6 +2027,7 @@ struct ECLIC
   struct CLICINTIE_77 : public RegisterBase<0xD2001135, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_77_IE_Values<ECLIC::CLICINTIE_77, 0, 1, ReadWriteMode, ECLICCLICINTIE_77Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_77_IE_Values<ECLIC::CLICINTIE_77, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1872,6 +2039,7 @@ struct ECLIC
   struct CLICINTIE_78 : public RegisterBase<0xD2001139, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_78_IE_Values<ECLIC::CLICINTIE_78, 0, 1, ReadWriteMode, ECLICCLICINTIE_78Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_78_IE_Values<ECLIC::CLICINTIE_78, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1883,6 +2051,7 @@ struct ECLIC
   struct CLICINTIE_79 : public RegisterBase<0xD200113D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_79_IE_Values<ECLIC::CLICINTIE_79, 0, 1, ReadWriteMode, ECLICCLICINTIE_79Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_79_IE_Values<ECLIC::CLICINTIE_79, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1894,6 +2063,7 @@ struct ECLIC
   struct CLICINTIE_80 : public RegisterBase<0xD2001141, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_80_IE_Values<ECLIC::CLICINTIE_80, 0, 1, ReadWriteMode, ECLICCLICINTIE_80Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_80_IE_Values<ECLIC::CLICINTIE_80, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1905,6 +2075,7 @@ struct ECLIC
   struct CLICINTIE_81 : public RegisterBase<0xD2001145, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_81_IE_Values<ECLIC::CLICINTIE_81, 0, 1, ReadWriteMode, ECLICCLICINTIE_81Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_81_IE_Values<ECLIC::CLICINTIE_81, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1916,6 +2087,7 @@ struct ECLIC
   struct CLICINTIE_82 : public RegisterBase<0xD2001149, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_82_IE_Values<ECLIC::CLICINTIE_82, 0, 1, ReadWriteMode, ECLICCLICINTIE_82Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_82_IE_Values<ECLIC::CLICINTIE_82, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1927,6 +2099,7 @@ struct ECLIC
   struct CLICINTIE_83 : public RegisterBase<0xD200114D, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_83_IE_Values<ECLIC::CLICINTIE_83, 0, 1, ReadWriteMode, ECLICCLICINTIE_83Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_83_IE_Values<ECLIC::CLICINTIE_83, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1938,6 +2111,7 @@ struct ECLIC
   struct CLICINTIE_84 : public RegisterBase<0xD2001151, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_84_IE_Values<ECLIC::CLICINTIE_84, 0, 1, ReadWriteMode, ECLICCLICINTIE_84Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_84_IE_Values<ECLIC::CLICINTIE_84, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1949,6 +2123,7 @@ struct ECLIC
   struct CLICINTIE_85 : public RegisterBase<0xD2001155, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_85_IE_Values<ECLIC::CLICINTIE_85, 0, 1, ReadWriteMode, ECLICCLICINTIE_85Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_85_IE_Values<ECLIC::CLICINTIE_85, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1960,6 +2135,7 @@ struct ECLIC
   struct CLICINTIE_86 : public RegisterBase<0xD2001159, 8, ReadWriteMode>
   {
     using IE = ECLIC_CLICINTIE_86_IE_Values<ECLIC::CLICINTIE_86, 0, 1, ReadWriteMode, ECLICCLICINTIE_86Base> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = ECLIC_CLICINTIE_86_IE_Values<ECLIC::CLICINTIE_86, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1972,6 +2148,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_0_SHV_Values<ECLIC::CLICINTATTR_0, 0, 1, ReadWriteMode, ECLICCLICINTATTR_0Base> ;
     using TRIG = ECLIC_CLICINTATTR_0_TRIG_Values<ECLIC::CLICINTATTR_0, 1, 2, ReadWriteMode, ECLICCLICINTATTR_0Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_0_TRIG_Values<ECLIC::CLICINTATTR_0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1984,6 +2161,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_1_SHV_Values<ECLIC::CLICINTATTR_1, 0, 1, ReadWriteMode, ECLICCLICINTATTR_1Base> ;
     using TRIG = ECLIC_CLICINTATTR_1_TRIG_Values<ECLIC::CLICINTATTR_1, 1, 2, ReadWriteMode, ECLICCLICINTATTR_1Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_1_TRIG_Values<ECLIC::CLICINTATTR_1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1996,6 +2174,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_2_SHV_Values<ECLIC::CLICINTATTR_2, 0, 1, ReadWriteMode, ECLICCLICINTATTR_2Base> ;
     using TRIG = ECLIC_CLICINTATTR_2_TRIG_Values<ECLIC::CLICINTATTR_2, 1, 2, ReadWriteMode, ECLICCLICINTATTR_2Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_2_TRIG_Values<ECLIC::CLICINTATTR_2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2008,6 +2187,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_3_SHV_Values<ECLIC::CLICINTATTR_3, 0, 1, ReadWriteMode, ECLICCLICINTATTR_3Base> ;
     using TRIG = ECLIC_CLICINTATTR_3_TRIG_Values<ECLIC::CLICINTATTR_3, 1, 2, ReadWriteMode, ECLICCLICINTATTR_3Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_3_TRIG_Values<ECLIC::CLICINTATTR_3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2020,6 +2200,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_4_SHV_Values<ECLIC::CLICINTATTR_4, 0, 1, ReadWriteMode, ECLICCLICINTATTR_4Base> ;
     using TRIG = ECLIC_CLICINTATTR_4_TRIG_Values<ECLIC::CLICINTATTR_4, 1, 2, ReadWriteMode, ECLICCLICINTATTR_4Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_4_TRIG_Values<ECLIC::CLICINTATTR_4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2032,6 +2213,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_5_SHV_Values<ECLIC::CLICINTATTR_5, 0, 1, ReadWriteMode, ECLICCLICINTATTR_5Base> ;
     using TRIG = ECLIC_CLICINTATTR_5_TRIG_Values<ECLIC::CLICINTATTR_5, 1, 2, ReadWriteMode, ECLICCLICINTATTR_5Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_5_TRIG_Values<ECLIC::CLICINTATTR_5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2044,6 +2226,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_6_SHV_Values<ECLIC::CLICINTATTR_6, 0, 1, ReadWriteMode, ECLICCLICINTATTR_6Base> ;
     using TRIG = ECLIC_CLICINTATTR_6_TRIG_Values<ECLIC::CLICINTATTR_6, 1, 2, ReadWriteMode, ECLICCLICINTATTR_6Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_6_TRIG_Values<ECLIC::CLICINTATTR_6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2056,6 +2239,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_7_SHV_Values<ECLIC::CLICINTATTR_7, 0, 1, ReadWriteMode, ECLICCLICINTATTR_7Base> ;
     using TRIG = ECLIC_CLICINTATTR_7_TRIG_Values<ECLIC::CLICINTATTR_7, 1, 2, ReadWriteMode, ECLICCLICINTATTR_7Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_7_TRIG_Values<ECLIC::CLICINTATTR_7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2068,6 +2252,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_8_SHV_Values<ECLIC::CLICINTATTR_8, 0, 1, ReadWriteMode, ECLICCLICINTATTR_8Base> ;
     using TRIG = ECLIC_CLICINTATTR_8_TRIG_Values<ECLIC::CLICINTATTR_8, 1, 2, ReadWriteMode, ECLICCLICINTATTR_8Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_8_TRIG_Values<ECLIC::CLICINTATTR_8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2080,6 +2265,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_9_SHV_Values<ECLIC::CLICINTATTR_9, 0, 1, ReadWriteMode, ECLICCLICINTATTR_9Base> ;
     using TRIG = ECLIC_CLICINTATTR_9_TRIG_Values<ECLIC::CLICINTATTR_9, 1, 2, ReadWriteMode, ECLICCLICINTATTR_9Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_9_TRIG_Values<ECLIC::CLICINTATTR_9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2092,6 +2278,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_10_SHV_Values<ECLIC::CLICINTATTR_10, 0, 1, ReadWriteMode, ECLICCLICINTATTR_10Base> ;
     using TRIG = ECLIC_CLICINTATTR_10_TRIG_Values<ECLIC::CLICINTATTR_10, 1, 2, ReadWriteMode, ECLICCLICINTATTR_10Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_10_TRIG_Values<ECLIC::CLICINTATTR_10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2104,6 +2291,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_11_SHV_Values<ECLIC::CLICINTATTR_11, 0, 1, ReadWriteMode, ECLICCLICINTATTR_11Base> ;
     using TRIG = ECLIC_CLICINTATTR_11_TRIG_Values<ECLIC::CLICINTATTR_11, 1, 2, ReadWriteMode, ECLICCLICINTATTR_11Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_11_TRIG_Values<ECLIC::CLICINTATTR_11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2116,6 +2304,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_12_SHV_Values<ECLIC::CLICINTATTR_12, 0, 1, ReadWriteMode, ECLICCLICINTATTR_12Base> ;
     using TRIG = ECLIC_CLICINTATTR_12_TRIG_Values<ECLIC::CLICINTATTR_12, 1, 2, ReadWriteMode, ECLICCLICINTATTR_12Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_12_TRIG_Values<ECLIC::CLICINTATTR_12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2128,6 +2317,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_13_SHV_Values<ECLIC::CLICINTATTR_13, 0, 1, ReadWriteMode, ECLICCLICINTATTR_13Base> ;
     using TRIG = ECLIC_CLICINTATTR_13_TRIG_Values<ECLIC::CLICINTATTR_13, 1, 2, ReadWriteMode, ECLICCLICINTATTR_13Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_13_TRIG_Values<ECLIC::CLICINTATTR_13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2140,6 +2330,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_14_SHV_Values<ECLIC::CLICINTATTR_14, 0, 1, ReadWriteMode, ECLICCLICINTATTR_14Base> ;
     using TRIG = ECLIC_CLICINTATTR_14_TRIG_Values<ECLIC::CLICINTATTR_14, 1, 2, ReadWriteMode, ECLICCLICINTATTR_14Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_14_TRIG_Values<ECLIC::CLICINTATTR_14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2152,6 +2343,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_15_SHV_Values<ECLIC::CLICINTATTR_15, 0, 1, ReadWriteMode, ECLICCLICINTATTR_15Base> ;
     using TRIG = ECLIC_CLICINTATTR_15_TRIG_Values<ECLIC::CLICINTATTR_15, 1, 2, ReadWriteMode, ECLICCLICINTATTR_15Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_15_TRIG_Values<ECLIC::CLICINTATTR_15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2164,6 +2356,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_16_SHV_Values<ECLIC::CLICINTATTR_16, 0, 1, ReadWriteMode, ECLICCLICINTATTR_16Base> ;
     using TRIG = ECLIC_CLICINTATTR_16_TRIG_Values<ECLIC::CLICINTATTR_16, 1, 2, ReadWriteMode, ECLICCLICINTATTR_16Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_16_TRIG_Values<ECLIC::CLICINTATTR_16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2176,6 +2369,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_17_SHV_Values<ECLIC::CLICINTATTR_17, 0, 1, ReadWriteMode, ECLICCLICINTATTR_17Base> ;
     using TRIG = ECLIC_CLICINTATTR_17_TRIG_Values<ECLIC::CLICINTATTR_17, 1, 2, ReadWriteMode, ECLICCLICINTATTR_17Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_17_TRIG_Values<ECLIC::CLICINTATTR_17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2188,6 +2382,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_18_SHV_Values<ECLIC::CLICINTATTR_18, 0, 1, ReadWriteMode, ECLICCLICINTATTR_18Base> ;
     using TRIG = ECLIC_CLICINTATTR_18_TRIG_Values<ECLIC::CLICINTATTR_18, 1, 2, ReadWriteMode, ECLICCLICINTATTR_18Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_18_TRIG_Values<ECLIC::CLICINTATTR_18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2200,6 +2395,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_19_SHV_Values<ECLIC::CLICINTATTR_19, 0, 1, ReadWriteMode, ECLICCLICINTATTR_19Base> ;
     using TRIG = ECLIC_CLICINTATTR_19_TRIG_Values<ECLIC::CLICINTATTR_19, 1, 2, ReadWriteMode, ECLICCLICINTATTR_19Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_19_TRIG_Values<ECLIC::CLICINTATTR_19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2212,6 +2408,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_20_SHV_Values<ECLIC::CLICINTATTR_20, 0, 1, ReadWriteMode, ECLICCLICINTATTR_20Base> ;
     using TRIG = ECLIC_CLICINTATTR_20_TRIG_Values<ECLIC::CLICINTATTR_20, 1, 2, ReadWriteMode, ECLICCLICINTATTR_20Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_20_TRIG_Values<ECLIC::CLICINTATTR_20, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2224,6 +2421,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_21_SHV_Values<ECLIC::CLICINTATTR_21, 0, 1, ReadWriteMode, ECLICCLICINTATTR_21Base> ;
     using TRIG = ECLIC_CLICINTATTR_21_TRIG_Values<ECLIC::CLICINTATTR_21, 1, 2, ReadWriteMode, ECLICCLICINTATTR_21Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_21_TRIG_Values<ECLIC::CLICINTATTR_21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2236,6 +2434,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_22_SHV_Values<ECLIC::CLICINTATTR_22, 0, 1, ReadWriteMode, ECLICCLICINTATTR_22Base> ;
     using TRIG = ECLIC_CLICINTATTR_22_TRIG_Values<ECLIC::CLICINTATTR_22, 1, 2, ReadWriteMode, ECLICCLICINTATTR_22Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_22_TRIG_Values<ECLIC::CLICINTATTR_22, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2248,6 +2447,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_23_SHV_Values<ECLIC::CLICINTATTR_23, 0, 1, ReadWriteMode, ECLICCLICINTATTR_23Base> ;
     using TRIG = ECLIC_CLICINTATTR_23_TRIG_Values<ECLIC::CLICINTATTR_23, 1, 2, ReadWriteMode, ECLICCLICINTATTR_23Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_23_TRIG_Values<ECLIC::CLICINTATTR_23, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2260,6 +2460,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_24_SHV_Values<ECLIC::CLICINTATTR_24, 0, 1, ReadWriteMode, ECLICCLICINTATTR_24Base> ;
     using TRIG = ECLIC_CLICINTATTR_24_TRIG_Values<ECLIC::CLICINTATTR_24, 1, 2, ReadWriteMode, ECLICCLICINTATTR_24Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_24_TRIG_Values<ECLIC::CLICINTATTR_24, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2272,6 +2473,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_25_SHV_Values<ECLIC::CLICINTATTR_25, 0, 1, ReadWriteMode, ECLICCLICINTATTR_25Base> ;
     using TRIG = ECLIC_CLICINTATTR_25_TRIG_Values<ECLIC::CLICINTATTR_25, 1, 2, ReadWriteMode, ECLICCLICINTATTR_25Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_25_TRIG_Values<ECLIC::CLICINTATTR_25, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2284,6 +2486,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_26_SHV_Values<ECLIC::CLICINTATTR_26, 0, 1, ReadWriteMode, ECLICCLICINTATTR_26Base> ;
     using TRIG = ECLIC_CLICINTATTR_26_TRIG_Values<ECLIC::CLICINTATTR_26, 1, 2, ReadWriteMode, ECLICCLICINTATTR_26Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_26_TRIG_Values<ECLIC::CLICINTATTR_26, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2296,6 +2499,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_27_SHV_Values<ECLIC::CLICINTATTR_27, 0, 1, ReadWriteMode, ECLICCLICINTATTR_27Base> ;
     using TRIG = ECLIC_CLICINTATTR_27_TRIG_Values<ECLIC::CLICINTATTR_27, 1, 2, ReadWriteMode, ECLICCLICINTATTR_27Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_27_TRIG_Values<ECLIC::CLICINTATTR_27, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2308,6 +2512,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_28_SHV_Values<ECLIC::CLICINTATTR_28, 0, 1, ReadWriteMode, ECLICCLICINTATTR_28Base> ;
     using TRIG = ECLIC_CLICINTATTR_28_TRIG_Values<ECLIC::CLICINTATTR_28, 1, 2, ReadWriteMode, ECLICCLICINTATTR_28Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_28_TRIG_Values<ECLIC::CLICINTATTR_28, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2320,6 +2525,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_29_SHV_Values<ECLIC::CLICINTATTR_29, 0, 1, ReadWriteMode, ECLICCLICINTATTR_29Base> ;
     using TRIG = ECLIC_CLICINTATTR_29_TRIG_Values<ECLIC::CLICINTATTR_29, 1, 2, ReadWriteMode, ECLICCLICINTATTR_29Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_29_TRIG_Values<ECLIC::CLICINTATTR_29, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2332,6 +2538,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_30_SHV_Values<ECLIC::CLICINTATTR_30, 0, 1, ReadWriteMode, ECLICCLICINTATTR_30Base> ;
     using TRIG = ECLIC_CLICINTATTR_30_TRIG_Values<ECLIC::CLICINTATTR_30, 1, 2, ReadWriteMode, ECLICCLICINTATTR_30Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_30_TRIG_Values<ECLIC::CLICINTATTR_30, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2344,6 +2551,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_31_SHV_Values<ECLIC::CLICINTATTR_31, 0, 1, ReadWriteMode, ECLICCLICINTATTR_31Base> ;
     using TRIG = ECLIC_CLICINTATTR_31_TRIG_Values<ECLIC::CLICINTATTR_31, 1, 2, ReadWriteMode, ECLICCLICINTATTR_31Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_31_TRIG_Values<ECLIC::CLICINTATTR_31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2356,6 +2564,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_32_SHV_Values<ECLIC::CLICINTATTR_32, 0, 1, ReadWriteMode, ECLICCLICINTATTR_32Base> ;
     using TRIG = ECLIC_CLICINTATTR_32_TRIG_Values<ECLIC::CLICINTATTR_32, 1, 2, ReadWriteMode, ECLICCLICINTATTR_32Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_32_TRIG_Values<ECLIC::CLICINTATTR_32, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2368,6 +2577,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_33_SHV_Values<ECLIC::CLICINTATTR_33, 0, 1, ReadWriteMode, ECLICCLICINTATTR_33Base> ;
     using TRIG = ECLIC_CLICINTATTR_33_TRIG_Values<ECLIC::CLICINTATTR_33, 1, 2, ReadWriteMode, ECLICCLICINTATTR_33Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_33_TRIG_Values<ECLIC::CLICINTATTR_33, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2380,6 +2590,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_34_SHV_Values<ECLIC::CLICINTATTR_34, 0, 1, ReadWriteMode, ECLICCLICINTATTR_34Base> ;
     using TRIG = ECLIC_CLICINTATTR_34_TRIG_Values<ECLIC::CLICINTATTR_34, 1, 2, ReadWriteMode, ECLICCLICINTATTR_34Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_34_TRIG_Values<ECLIC::CLICINTATTR_34, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2392,6 +2603,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_35_SHV_Values<ECLIC::CLICINTATTR_35, 0, 1, ReadWriteMode, ECLICCLICINTATTR_35Base> ;
     using TRIG = ECLIC_CLICINTATTR_35_TRIG_Values<ECLIC::CLICINTATTR_35, 1, 2, ReadWriteMode, ECLICCLICINTATTR_35Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_35_TRIG_Values<ECLIC::CLICINTATTR_35, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2404,6 +2616,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_36_SHV_Values<ECLIC::CLICINTATTR_36, 0, 1, ReadWriteMode, ECLICCLICINTATTR_36Base> ;
     using TRIG = ECLIC_CLICINTATTR_36_TRIG_Values<ECLIC::CLICINTATTR_36, 1, 2, ReadWriteMode, ECLICCLICINTATTR_36Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_36_TRIG_Values<ECLIC::CLICINTATTR_36, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2416,6 +2629,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_37_SHV_Values<ECLIC::CLICINTATTR_37, 0, 1, ReadWriteMode, ECLICCLICINTATTR_37Base> ;
     using TRIG = ECLIC_CLICINTATTR_37_TRIG_Values<ECLIC::CLICINTATTR_37, 1, 2, ReadWriteMode, ECLICCLICINTATTR_37Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_37_TRIG_Values<ECLIC::CLICINTATTR_37, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2428,6 +2642,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_38_SHV_Values<ECLIC::CLICINTATTR_38, 0, 1, ReadWriteMode, ECLICCLICINTATTR_38Base> ;
     using TRIG = ECLIC_CLICINTATTR_38_TRIG_Values<ECLIC::CLICINTATTR_38, 1, 2, ReadWriteMode, ECLICCLICINTATTR_38Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_38_TRIG_Values<ECLIC::CLICINTATTR_38, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2440,6 +2655,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_39_SHV_Values<ECLIC::CLICINTATTR_39, 0, 1, ReadWriteMode, ECLICCLICINTATTR_39Base> ;
     using TRIG = ECLIC_CLICINTATTR_39_TRIG_Values<ECLIC::CLICINTATTR_39, 1, 2, ReadWriteMode, ECLICCLICINTATTR_39Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_39_TRIG_Values<ECLIC::CLICINTATTR_39, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2452,6 +2668,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_40_SHV_Values<ECLIC::CLICINTATTR_40, 0, 1, ReadWriteMode, ECLICCLICINTATTR_40Base> ;
     using TRIG = ECLIC_CLICINTATTR_40_TRIG_Values<ECLIC::CLICINTATTR_40, 1, 2, ReadWriteMode, ECLICCLICINTATTR_40Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_40_TRIG_Values<ECLIC::CLICINTATTR_40, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2464,6 +2681,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_41_SHV_Values<ECLIC::CLICINTATTR_41, 0, 1, ReadWriteMode, ECLICCLICINTATTR_41Base> ;
     using TRIG = ECLIC_CLICINTATTR_41_TRIG_Values<ECLIC::CLICINTATTR_41, 1, 2, ReadWriteMode, ECLICCLICINTATTR_41Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_41_TRIG_Values<ECLIC::CLICINTATTR_41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2476,6 +2694,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_42_SHV_Values<ECLIC::CLICINTATTR_42, 0, 1, ReadWriteMode, ECLICCLICINTATTR_42Base> ;
     using TRIG = ECLIC_CLICINTATTR_42_TRIG_Values<ECLIC::CLICINTATTR_42, 1, 2, ReadWriteMode, ECLICCLICINTATTR_42Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_42_TRIG_Values<ECLIC::CLICINTATTR_42, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2488,6 +2707,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_43_SHV_Values<ECLIC::CLICINTATTR_43, 0, 1, ReadWriteMode, ECLICCLICINTATTR_43Base> ;
     using TRIG = ECLIC_CLICINTATTR_43_TRIG_Values<ECLIC::CLICINTATTR_43, 1, 2, ReadWriteMode, ECLICCLICINTATTR_43Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_43_TRIG_Values<ECLIC::CLICINTATTR_43, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2500,6 +2720,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_44_SHV_Values<ECLIC::CLICINTATTR_44, 0, 1, ReadWriteMode, ECLICCLICINTATTR_44Base> ;
     using TRIG = ECLIC_CLICINTATTR_44_TRIG_Values<ECLIC::CLICINTATTR_44, 1, 2, ReadWriteMode, ECLICCLICINTATTR_44Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_44_TRIG_Values<ECLIC::CLICINTATTR_44, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2512,6 +2733,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_45_SHV_Values<ECLIC::CLICINTATTR_45, 0, 1, ReadWriteMode, ECLICCLICINTATTR_45Base> ;
     using TRIG = ECLIC_CLICINTATTR_45_TRIG_Values<ECLIC::CLICINTATTR_45, 1, 2, ReadWriteMode, ECLICCLICINTATTR_45Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_45_TRIG_Values<ECLIC::CLICINTATTR_45, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2524,6 +2746,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_46_SHV_Values<ECLIC::CLICINTATTR_46, 0, 1, ReadWriteMode, ECLICCLICINTATTR_46Base> ;
     using TRIG = ECLIC_CLICINTATTR_46_TRIG_Values<ECLIC::CLICINTATTR_46, 1, 2, ReadWriteMode, ECLICCLICINTATTR_46Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_46_TRIG_Values<ECLIC::CLICINTATTR_46, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2536,6 +2759,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_47_SHV_Values<ECLIC::CLICINTATTR_47, 0, 1, ReadWriteMode, ECLICCLICINTATTR_47Base> ;
     using TRIG = ECLIC_CLICINTATTR_47_TRIG_Values<ECLIC::CLICINTATTR_47, 1, 2, ReadWriteMode, ECLICCLICINTATTR_47Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_47_TRIG_Values<ECLIC::CLICINTATTR_47, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2548,6 +2772,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_48_SHV_Values<ECLIC::CLICINTATTR_48, 0, 1, ReadWriteMode, ECLICCLICINTATTR_48Base> ;
     using TRIG = ECLIC_CLICINTATTR_48_TRIG_Values<ECLIC::CLICINTATTR_48, 1, 2, ReadWriteMode, ECLICCLICINTATTR_48Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_48_TRIG_Values<ECLIC::CLICINTATTR_48, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2560,6 +2785,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_49_SHV_Values<ECLIC::CLICINTATTR_49, 0, 1, ReadWriteMode, ECLICCLICINTATTR_49Base> ;
     using TRIG = ECLIC_CLICINTATTR_49_TRIG_Values<ECLIC::CLICINTATTR_49, 1, 2, ReadWriteMode, ECLICCLICINTATTR_49Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_49_TRIG_Values<ECLIC::CLICINTATTR_49, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2572,6 +2798,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_50_SHV_Values<ECLIC::CLICINTATTR_50, 0, 1, ReadWriteMode, ECLICCLICINTATTR_50Base> ;
     using TRIG = ECLIC_CLICINTATTR_50_TRIG_Values<ECLIC::CLICINTATTR_50, 1, 2, ReadWriteMode, ECLICCLICINTATTR_50Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_50_TRIG_Values<ECLIC::CLICINTATTR_50, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2584,6 +2811,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_51_SHV_Values<ECLIC::CLICINTATTR_51, 0, 1, ReadWriteMode, ECLICCLICINTATTR_51Base> ;
     using TRIG = ECLIC_CLICINTATTR_51_TRIG_Values<ECLIC::CLICINTATTR_51, 1, 2, ReadWriteMode, ECLICCLICINTATTR_51Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_51_TRIG_Values<ECLIC::CLICINTATTR_51, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2596,6 +2824,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_52_SHV_Values<ECLIC::CLICINTATTR_52, 0, 1, ReadWriteMode, ECLICCLICINTATTR_52Base> ;
     using TRIG = ECLIC_CLICINTATTR_52_TRIG_Values<ECLIC::CLICINTATTR_52, 1, 2, ReadWriteMode, ECLICCLICINTATTR_52Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_52_TRIG_Values<ECLIC::CLICINTATTR_52, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2608,6 +2837,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_53_SHV_Values<ECLIC::CLICINTATTR_53, 0, 1, ReadWriteMode, ECLICCLICINTATTR_53Base> ;
     using TRIG = ECLIC_CLICINTATTR_53_TRIG_Values<ECLIC::CLICINTATTR_53, 1, 2, ReadWriteMode, ECLICCLICINTATTR_53Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_53_TRIG_Values<ECLIC::CLICINTATTR_53, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2620,6 +2850,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_54_SHV_Values<ECLIC::CLICINTATTR_54, 0, 1, ReadWriteMode, ECLICCLICINTATTR_54Base> ;
     using TRIG = ECLIC_CLICINTATTR_54_TRIG_Values<ECLIC::CLICINTATTR_54, 1, 2, ReadWriteMode, ECLICCLICINTATTR_54Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_54_TRIG_Values<ECLIC::CLICINTATTR_54, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2632,6 +2863,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_55_SHV_Values<ECLIC::CLICINTATTR_55, 0, 1, ReadWriteMode, ECLICCLICINTATTR_55Base> ;
     using TRIG = ECLIC_CLICINTATTR_55_TRIG_Values<ECLIC::CLICINTATTR_55, 1, 2, ReadWriteMode, ECLICCLICINTATTR_55Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_55_TRIG_Values<ECLIC::CLICINTATTR_55, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2644,6 +2876,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_56_SHV_Values<ECLIC::CLICINTATTR_56, 0, 1, ReadWriteMode, ECLICCLICINTATTR_56Base> ;
     using TRIG = ECLIC_CLICINTATTR_56_TRIG_Values<ECLIC::CLICINTATTR_56, 1, 2, ReadWriteMode, ECLICCLICINTATTR_56Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_56_TRIG_Values<ECLIC::CLICINTATTR_56, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2656,6 +2889,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_57_SHV_Values<ECLIC::CLICINTATTR_57, 0, 1, ReadWriteMode, ECLICCLICINTATTR_57Base> ;
     using TRIG = ECLIC_CLICINTATTR_57_TRIG_Values<ECLIC::CLICINTATTR_57, 1, 2, ReadWriteMode, ECLICCLICINTATTR_57Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_57_TRIG_Values<ECLIC::CLICINTATTR_57, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2668,6 +2902,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_58_SHV_Values<ECLIC::CLICINTATTR_58, 0, 1, ReadWriteMode, ECLICCLICINTATTR_58Base> ;
     using TRIG = ECLIC_CLICINTATTR_58_TRIG_Values<ECLIC::CLICINTATTR_58, 1, 2, ReadWriteMode, ECLICCLICINTATTR_58Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_58_TRIG_Values<ECLIC::CLICINTATTR_58, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2680,6 +2915,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_59_SHV_Values<ECLIC::CLICINTATTR_59, 0, 1, ReadWriteMode, ECLICCLICINTATTR_59Base> ;
     using TRIG = ECLIC_CLICINTATTR_59_TRIG_Values<ECLIC::CLICINTATTR_59, 1, 2, ReadWriteMode, ECLICCLICINTATTR_59Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_59_TRIG_Values<ECLIC::CLICINTATTR_59, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2692,6 +2928,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_60_SHV_Values<ECLIC::CLICINTATTR_60, 0, 1, ReadWriteMode, ECLICCLICINTATTR_60Base> ;
     using TRIG = ECLIC_CLICINTATTR_60_TRIG_Values<ECLIC::CLICINTATTR_60, 1, 2, ReadWriteMode, ECLICCLICINTATTR_60Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_60_TRIG_Values<ECLIC::CLICINTATTR_60, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2704,6 +2941,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_61_SHV_Values<ECLIC::CLICINTATTR_61, 0, 1, ReadWriteMode, ECLICCLICINTATTR_61Base> ;
     using TRIG = ECLIC_CLICINTATTR_61_TRIG_Values<ECLIC::CLICINTATTR_61, 1, 2, ReadWriteMode, ECLICCLICINTATTR_61Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_61_TRIG_Values<ECLIC::CLICINTATTR_61, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2716,6 +2954,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_62_SHV_Values<ECLIC::CLICINTATTR_62, 0, 1, ReadWriteMode, ECLICCLICINTATTR_62Base> ;
     using TRIG = ECLIC_CLICINTATTR_62_TRIG_Values<ECLIC::CLICINTATTR_62, 1, 2, ReadWriteMode, ECLICCLICINTATTR_62Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_62_TRIG_Values<ECLIC::CLICINTATTR_62, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2728,6 +2967,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_63_SHV_Values<ECLIC::CLICINTATTR_63, 0, 1, ReadWriteMode, ECLICCLICINTATTR_63Base> ;
     using TRIG = ECLIC_CLICINTATTR_63_TRIG_Values<ECLIC::CLICINTATTR_63, 1, 2, ReadWriteMode, ECLICCLICINTATTR_63Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_63_TRIG_Values<ECLIC::CLICINTATTR_63, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2740,6 +2980,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_64_SHV_Values<ECLIC::CLICINTATTR_64, 0, 1, ReadWriteMode, ECLICCLICINTATTR_64Base> ;
     using TRIG = ECLIC_CLICINTATTR_64_TRIG_Values<ECLIC::CLICINTATTR_64, 1, 2, ReadWriteMode, ECLICCLICINTATTR_64Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_64_TRIG_Values<ECLIC::CLICINTATTR_64, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2752,6 +2993,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_65_SHV_Values<ECLIC::CLICINTATTR_65, 0, 1, ReadWriteMode, ECLICCLICINTATTR_65Base> ;
     using TRIG = ECLIC_CLICINTATTR_65_TRIG_Values<ECLIC::CLICINTATTR_65, 1, 2, ReadWriteMode, ECLICCLICINTATTR_65Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_65_TRIG_Values<ECLIC::CLICINTATTR_65, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2764,6 +3006,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_66_SHV_Values<ECLIC::CLICINTATTR_66, 0, 1, ReadWriteMode, ECLICCLICINTATTR_66Base> ;
     using TRIG = ECLIC_CLICINTATTR_66_TRIG_Values<ECLIC::CLICINTATTR_66, 1, 2, ReadWriteMode, ECLICCLICINTATTR_66Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_66_TRIG_Values<ECLIC::CLICINTATTR_66, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2776,6 +3019,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_67_SHV_Values<ECLIC::CLICINTATTR_67, 0, 1, ReadWriteMode, ECLICCLICINTATTR_67Base> ;
     using TRIG = ECLIC_CLICINTATTR_67_TRIG_Values<ECLIC::CLICINTATTR_67, 1, 2, ReadWriteMode, ECLICCLICINTATTR_67Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_67_TRIG_Values<ECLIC::CLICINTATTR_67, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2788,6 +3032,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_68_SHV_Values<ECLIC::CLICINTATTR_68, 0, 1, ReadWriteMode, ECLICCLICINTATTR_68Base> ;
     using TRIG = ECLIC_CLICINTATTR_68_TRIG_Values<ECLIC::CLICINTATTR_68, 1, 2, ReadWriteMode, ECLICCLICINTATTR_68Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_68_TRIG_Values<ECLIC::CLICINTATTR_68, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2800,6 +3045,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_69_SHV_Values<ECLIC::CLICINTATTR_69, 0, 1, ReadWriteMode, ECLICCLICINTATTR_69Base> ;
     using TRIG = ECLIC_CLICINTATTR_69_TRIG_Values<ECLIC::CLICINTATTR_69, 1, 2, ReadWriteMode, ECLICCLICINTATTR_69Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_69_TRIG_Values<ECLIC::CLICINTATTR_69, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2812,6 +3058,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_70_SHV_Values<ECLIC::CLICINTATTR_70, 0, 1, ReadWriteMode, ECLICCLICINTATTR_70Base> ;
     using TRIG = ECLIC_CLICINTATTR_70_TRIG_Values<ECLIC::CLICINTATTR_70, 1, 2, ReadWriteMode, ECLICCLICINTATTR_70Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_70_TRIG_Values<ECLIC::CLICINTATTR_70, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2824,6 +3071,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_71_SHV_Values<ECLIC::CLICINTATTR_71, 0, 1, ReadWriteMode, ECLICCLICINTATTR_71Base> ;
     using TRIG = ECLIC_CLICINTATTR_71_TRIG_Values<ECLIC::CLICINTATTR_71, 1, 2, ReadWriteMode, ECLICCLICINTATTR_71Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_71_TRIG_Values<ECLIC::CLICINTATTR_71, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2836,6 +3084,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_72_SHV_Values<ECLIC::CLICINTATTR_72, 0, 1, ReadWriteMode, ECLICCLICINTATTR_72Base> ;
     using TRIG = ECLIC_CLICINTATTR_72_TRIG_Values<ECLIC::CLICINTATTR_72, 1, 2, ReadWriteMode, ECLICCLICINTATTR_72Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_72_TRIG_Values<ECLIC::CLICINTATTR_72, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2848,6 +3097,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_73_SHV_Values<ECLIC::CLICINTATTR_73, 0, 1, ReadWriteMode, ECLICCLICINTATTR_73Base> ;
     using TRIG = ECLIC_CLICINTATTR_73_TRIG_Values<ECLIC::CLICINTATTR_73, 1, 2, ReadWriteMode, ECLICCLICINTATTR_73Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_73_TRIG_Values<ECLIC::CLICINTATTR_73, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2860,6 +3110,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_74_SHV_Values<ECLIC::CLICINTATTR_74, 0, 1, ReadWriteMode, ECLICCLICINTATTR_74Base> ;
     using TRIG = ECLIC_CLICINTATTR_74_TRIG_Values<ECLIC::CLICINTATTR_74, 1, 2, ReadWriteMode, ECLICCLICINTATTR_74Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_74_TRIG_Values<ECLIC::CLICINTATTR_74, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2872,6 +3123,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_75_SHV_Values<ECLIC::CLICINTATTR_75, 0, 1, ReadWriteMode, ECLICCLICINTATTR_75Base> ;
     using TRIG = ECLIC_CLICINTATTR_75_TRIG_Values<ECLIC::CLICINTATTR_75, 1, 2, ReadWriteMode, ECLICCLICINTATTR_75Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_75_TRIG_Values<ECLIC::CLICINTATTR_75, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2884,6 +3136,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_76_SHV_Values<ECLIC::CLICINTATTR_76, 0, 1, ReadWriteMode, ECLICCLICINTATTR_76Base> ;
     using TRIG = ECLIC_CLICINTATTR_76_TRIG_Values<ECLIC::CLICINTATTR_76, 1, 2, ReadWriteMode, ECLICCLICINTATTR_76Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_76_TRIG_Values<ECLIC::CLICINTATTR_76, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2896,6 +3149,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_77_SHV_Values<ECLIC::CLICINTATTR_77, 0, 1, ReadWriteMode, ECLICCLICINTATTR_77Base> ;
     using TRIG = ECLIC_CLICINTATTR_77_TRIG_Values<ECLIC::CLICINTATTR_77, 1, 2, ReadWriteMode, ECLICCLICINTATTR_77Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_77_TRIG_Values<ECLIC::CLICINTATTR_77, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2908,6 +3162,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_78_SHV_Values<ECLIC::CLICINTATTR_78, 0, 1, ReadWriteMode, ECLICCLICINTATTR_78Base> ;
     using TRIG = ECLIC_CLICINTATTR_78_TRIG_Values<ECLIC::CLICINTATTR_78, 1, 2, ReadWriteMode, ECLICCLICINTATTR_78Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_78_TRIG_Values<ECLIC::CLICINTATTR_78, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2920,6 +3175,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_79_SHV_Values<ECLIC::CLICINTATTR_79, 0, 1, ReadWriteMode, ECLICCLICINTATTR_79Base> ;
     using TRIG = ECLIC_CLICINTATTR_79_TRIG_Values<ECLIC::CLICINTATTR_79, 1, 2, ReadWriteMode, ECLICCLICINTATTR_79Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_79_TRIG_Values<ECLIC::CLICINTATTR_79, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2932,6 +3188,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_80_SHV_Values<ECLIC::CLICINTATTR_80, 0, 1, ReadWriteMode, ECLICCLICINTATTR_80Base> ;
     using TRIG = ECLIC_CLICINTATTR_80_TRIG_Values<ECLIC::CLICINTATTR_80, 1, 2, ReadWriteMode, ECLICCLICINTATTR_80Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_80_TRIG_Values<ECLIC::CLICINTATTR_80, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2944,6 +3201,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_81_SHV_Values<ECLIC::CLICINTATTR_81, 0, 1, ReadWriteMode, ECLICCLICINTATTR_81Base> ;
     using TRIG = ECLIC_CLICINTATTR_81_TRIG_Values<ECLIC::CLICINTATTR_81, 1, 2, ReadWriteMode, ECLICCLICINTATTR_81Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_81_TRIG_Values<ECLIC::CLICINTATTR_81, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2956,6 +3214,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_82_SHV_Values<ECLIC::CLICINTATTR_82, 0, 1, ReadWriteMode, ECLICCLICINTATTR_82Base> ;
     using TRIG = ECLIC_CLICINTATTR_82_TRIG_Values<ECLIC::CLICINTATTR_82, 1, 2, ReadWriteMode, ECLICCLICINTATTR_82Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_82_TRIG_Values<ECLIC::CLICINTATTR_82, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2968,6 +3227,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_83_SHV_Values<ECLIC::CLICINTATTR_83, 0, 1, ReadWriteMode, ECLICCLICINTATTR_83Base> ;
     using TRIG = ECLIC_CLICINTATTR_83_TRIG_Values<ECLIC::CLICINTATTR_83, 1, 2, ReadWriteMode, ECLICCLICINTATTR_83Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_83_TRIG_Values<ECLIC::CLICINTATTR_83, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2980,6 +3240,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_84_SHV_Values<ECLIC::CLICINTATTR_84, 0, 1, ReadWriteMode, ECLICCLICINTATTR_84Base> ;
     using TRIG = ECLIC_CLICINTATTR_84_TRIG_Values<ECLIC::CLICINTATTR_84, 1, 2, ReadWriteMode, ECLICCLICINTATTR_84Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_84_TRIG_Values<ECLIC::CLICINTATTR_84, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2992,6 +3253,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_85_SHV_Values<ECLIC::CLICINTATTR_85, 0, 1, ReadWriteMode, ECLICCLICINTATTR_85Base> ;
     using TRIG = ECLIC_CLICINTATTR_85_TRIG_Values<ECLIC::CLICINTATTR_85, 1, 2, ReadWriteMode, ECLICCLICINTATTR_85Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_85_TRIG_Values<ECLIC::CLICINTATTR_85, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3004,6 +3266,7 @@ struct ECLIC
   {
     using SHV = ECLIC_CLICINTATTR_86_SHV_Values<ECLIC::CLICINTATTR_86, 0, 1, ReadWriteMode, ECLICCLICINTATTR_86Base> ;
     using TRIG = ECLIC_CLICINTATTR_86_TRIG_Values<ECLIC::CLICINTATTR_86, 1, 2, ReadWriteMode, ECLICCLICINTATTR_86Base> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ECLIC_CLICINTATTR_86_TRIG_Values<ECLIC::CLICINTATTR_86, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3015,6 +3278,7 @@ struct ECLIC
   struct CLICINTCTL_0 : public RegisterBase<0xD2001003, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_0_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_0, 0, 8, ReadWriteMode, ECLICCLICINTCTL_0Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_0_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3026,6 +3290,7 @@ struct ECLIC
   struct CLICINTCTL_1 : public RegisterBase<0xD2001007, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_1_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_1, 0, 8, ReadWriteMode, ECLICCLICINTCTL_1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_1_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3037,6 +3302,7 @@ struct ECLIC
   struct CLICINTCTL_2 : public RegisterBase<0xD200100B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_2_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_2, 0, 8, ReadWriteMode, ECLICCLICINTCTL_2Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_2_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3048,6 +3314,7 @@ struct ECLIC
   struct CLICINTCTL_3 : public RegisterBase<0xD200100F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_3_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_3, 0, 8, ReadWriteMode, ECLICCLICINTCTL_3Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_3_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3059,6 +3326,7 @@ struct ECLIC
   struct CLICINTCTL_4 : public RegisterBase<0xD2001013, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_4_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_4, 0, 8, ReadWriteMode, ECLICCLICINTCTL_4Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_4_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3070,6 +3338,7 @@ struct ECLIC
   struct CLICINTCTL_5 : public RegisterBase<0xD2001017, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_5_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_5, 0, 8, ReadWriteMode, ECLICCLICINTCTL_5Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_5_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3081,6 +3350,7 @@ struct ECLIC
   struct CLICINTCTL_6 : public RegisterBase<0xD200101B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_6_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_6, 0, 8, ReadWriteMode, ECLICCLICINTCTL_6Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_6_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3092,6 +3362,7 @@ struct ECLIC
   struct CLICINTCTL_7 : public RegisterBase<0xD200101F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_7_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_7, 0, 8, ReadWriteMode, ECLICCLICINTCTL_7Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_7_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3103,6 +3374,7 @@ struct ECLIC
   struct CLICINTCTL_8 : public RegisterBase<0xD2001023, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_8_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_8, 0, 8, ReadWriteMode, ECLICCLICINTCTL_8Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_8_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3114,6 +3386,7 @@ struct ECLIC
   struct CLICINTCTL_9 : public RegisterBase<0xD2001027, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_9_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_9, 0, 8, ReadWriteMode, ECLICCLICINTCTL_9Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_9_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3125,6 +3398,7 @@ struct ECLIC
   struct CLICINTCTL_10 : public RegisterBase<0xD200102B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_10_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_10, 0, 8, ReadWriteMode, ECLICCLICINTCTL_10Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_10_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3136,6 +3410,7 @@ struct ECLIC
   struct CLICINTCTL_11 : public RegisterBase<0xD200102F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_11_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_11, 0, 8, ReadWriteMode, ECLICCLICINTCTL_11Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_11_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3147,6 +3422,7 @@ struct ECLIC
   struct CLICINTCTL_12 : public RegisterBase<0xD2001033, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_12_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_12, 0, 8, ReadWriteMode, ECLICCLICINTCTL_12Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_12_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3158,6 +3434,7 @@ struct ECLIC
   struct CLICINTCTL_13 : public RegisterBase<0xD2001037, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_13_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_13, 0, 8, ReadWriteMode, ECLICCLICINTCTL_13Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_13_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3169,6 +3446,7 @@ struct ECLIC
   struct CLICINTCTL_14 : public RegisterBase<0xD200103B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_14_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_14, 0, 8, ReadWriteMode, ECLICCLICINTCTL_14Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_14_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3180,6 +3458,7 @@ struct ECLIC
   struct CLICINTCTL_15 : public RegisterBase<0xD200103F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_15_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_15, 0, 8, ReadWriteMode, ECLICCLICINTCTL_15Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_15_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3191,6 +3470,7 @@ struct ECLIC
   struct CLICINTCTL_16 : public RegisterBase<0xD2001043, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_16_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_16, 0, 8, ReadWriteMode, ECLICCLICINTCTL_16Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_16_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3202,6 +3482,7 @@ struct ECLIC
   struct CLICINTCTL_17 : public RegisterBase<0xD2001047, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_17_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_17, 0, 8, ReadWriteMode, ECLICCLICINTCTL_17Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_17_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3213,6 +3494,7 @@ struct ECLIC
   struct CLICINTCTL_18 : public RegisterBase<0xD200104B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_18_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_18, 0, 8, ReadWriteMode, ECLICCLICINTCTL_18Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_18_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3224,6 +3506,7 @@ struct ECLIC
   struct CLICINTCTL_19 : public RegisterBase<0xD200104F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_19_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_19, 0, 8, ReadWriteMode, ECLICCLICINTCTL_19Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_19_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3235,6 +3518,7 @@ struct ECLIC
   struct CLICINTCTL_20 : public RegisterBase<0xD2001053, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_20_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_20, 0, 8, ReadWriteMode, ECLICCLICINTCTL_20Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_20_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_20, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3246,6 +3530,7 @@ struct ECLIC
   struct CLICINTCTL_21 : public RegisterBase<0xD2001057, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_21_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_21, 0, 8, ReadWriteMode, ECLICCLICINTCTL_21Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_21_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3257,6 +3542,7 @@ struct ECLIC
   struct CLICINTCTL_22 : public RegisterBase<0xD200105B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_22_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_22, 0, 8, ReadWriteMode, ECLICCLICINTCTL_22Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_22_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_22, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3268,6 +3554,7 @@ struct ECLIC
   struct CLICINTCTL_23 : public RegisterBase<0xD200105F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_23_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_23, 0, 8, ReadWriteMode, ECLICCLICINTCTL_23Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_23_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_23, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3279,6 +3566,7 @@ struct ECLIC
   struct CLICINTCTL_24 : public RegisterBase<0xD2001063, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_24_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_24, 0, 8, ReadWriteMode, ECLICCLICINTCTL_24Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_24_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_24, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3290,6 +3578,7 @@ struct ECLIC
   struct CLICINTCTL_25 : public RegisterBase<0xD2001067, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_25_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_25, 0, 8, ReadWriteMode, ECLICCLICINTCTL_25Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_25_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_25, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3301,6 +3590,7 @@ struct ECLIC
   struct CLICINTCTL_26 : public RegisterBase<0xD200106B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_26_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_26, 0, 8, ReadWriteMode, ECLICCLICINTCTL_26Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_26_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_26, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3312,6 +3602,7 @@ struct ECLIC
   struct CLICINTCTL_27 : public RegisterBase<0xD200106F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_27_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_27, 0, 8, ReadWriteMode, ECLICCLICINTCTL_27Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_27_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_27, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3323,6 +3614,7 @@ struct ECLIC
   struct CLICINTCTL_28 : public RegisterBase<0xD2001073, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_28_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_28, 0, 8, ReadWriteMode, ECLICCLICINTCTL_28Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_28_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_28, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3334,6 +3626,7 @@ struct ECLIC
   struct CLICINTCTL_29 : public RegisterBase<0xD2001077, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_29_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_29, 0, 8, ReadWriteMode, ECLICCLICINTCTL_29Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_29_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_29, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3345,6 +3638,7 @@ struct ECLIC
   struct CLICINTCTL_30 : public RegisterBase<0xD200107B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_30_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_30, 0, 8, ReadWriteMode, ECLICCLICINTCTL_30Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_30_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_30, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3356,6 +3650,7 @@ struct ECLIC
   struct CLICINTCTL_31 : public RegisterBase<0xD200107F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_31_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_31, 0, 8, ReadWriteMode, ECLICCLICINTCTL_31Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_31_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3367,6 +3662,7 @@ struct ECLIC
   struct CLICINTCTL_32 : public RegisterBase<0xD2001083, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_32_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_32, 0, 8, ReadWriteMode, ECLICCLICINTCTL_32Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_32_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_32, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3378,6 +3674,7 @@ struct ECLIC
   struct CLICINTCTL_33 : public RegisterBase<0xD2001087, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_33_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_33, 0, 8, ReadWriteMode, ECLICCLICINTCTL_33Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_33_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_33, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3389,6 +3686,7 @@ struct ECLIC
   struct CLICINTCTL_34 : public RegisterBase<0xD200108B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_34_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_34, 0, 8, ReadWriteMode, ECLICCLICINTCTL_34Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_34_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_34, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3400,6 +3698,7 @@ struct ECLIC
   struct CLICINTCTL_35 : public RegisterBase<0xD200108F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_35_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_35, 0, 8, ReadWriteMode, ECLICCLICINTCTL_35Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_35_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_35, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3411,6 +3710,7 @@ struct ECLIC
   struct CLICINTCTL_36 : public RegisterBase<0xD2001093, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_36_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_36, 0, 8, ReadWriteMode, ECLICCLICINTCTL_36Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_36_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_36, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3422,6 +3722,7 @@ struct ECLIC
   struct CLICINTCTL_37 : public RegisterBase<0xD2001097, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_37_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_37, 0, 8, ReadWriteMode, ECLICCLICINTCTL_37Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_37_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_37, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3433,6 +3734,7 @@ struct ECLIC
   struct CLICINTCTL_38 : public RegisterBase<0xD200109B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_38_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_38, 0, 8, ReadWriteMode, ECLICCLICINTCTL_38Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_38_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_38, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3444,6 +3746,7 @@ struct ECLIC
   struct CLICINTCTL_39 : public RegisterBase<0xD200109F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_39_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_39, 0, 8, ReadWriteMode, ECLICCLICINTCTL_39Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_39_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_39, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3455,6 +3758,7 @@ struct ECLIC
   struct CLICINTCTL_40 : public RegisterBase<0xD20010A3, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_40_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_40, 0, 8, ReadWriteMode, ECLICCLICINTCTL_40Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_40_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_40, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3466,6 +3770,7 @@ struct ECLIC
   struct CLICINTCTL_41 : public RegisterBase<0xD20010A7, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_41_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_41, 0, 8, ReadWriteMode, ECLICCLICINTCTL_41Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_41_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3477,6 +3782,7 @@ struct ECLIC
   struct CLICINTCTL_42 : public RegisterBase<0xD20010AB, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_42_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_42, 0, 8, ReadWriteMode, ECLICCLICINTCTL_42Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_42_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_42, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3488,6 +3794,7 @@ struct ECLIC
   struct CLICINTCTL_43 : public RegisterBase<0xD20010AF, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_43_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_43, 0, 8, ReadWriteMode, ECLICCLICINTCTL_43Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_43_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_43, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3499,6 +3806,7 @@ struct ECLIC
   struct CLICINTCTL_44 : public RegisterBase<0xD20010B3, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_44_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_44, 0, 8, ReadWriteMode, ECLICCLICINTCTL_44Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_44_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_44, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3510,6 +3818,7 @@ struct ECLIC
   struct CLICINTCTL_45 : public RegisterBase<0xD20010B7, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_45_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_45, 0, 8, ReadWriteMode, ECLICCLICINTCTL_45Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_45_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_45, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3521,6 +3830,7 @@ struct ECLIC
   struct CLICINTCTL_46 : public RegisterBase<0xD20010BB, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_46_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_46, 0, 8, ReadWriteMode, ECLICCLICINTCTL_46Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_46_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_46, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3532,6 +3842,7 @@ struct ECLIC
   struct CLICINTCTL_47 : public RegisterBase<0xD20010BF, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_47_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_47, 0, 8, ReadWriteMode, ECLICCLICINTCTL_47Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_47_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_47, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3543,6 +3854,7 @@ struct ECLIC
   struct CLICINTCTL_48 : public RegisterBase<0xD20010C3, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_48_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_48, 0, 8, ReadWriteMode, ECLICCLICINTCTL_48Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_48_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_48, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3554,6 +3866,7 @@ struct ECLIC
   struct CLICINTCTL_49 : public RegisterBase<0xD20010C7, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_49_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_49, 0, 8, ReadWriteMode, ECLICCLICINTCTL_49Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_49_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_49, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3565,6 +3878,7 @@ struct ECLIC
   struct CLICINTCTL_50 : public RegisterBase<0xD20010CB, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_50_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_50, 0, 8, ReadWriteMode, ECLICCLICINTCTL_50Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_50_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_50, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3576,6 +3890,7 @@ struct ECLIC
   struct CLICINTCTL_51 : public RegisterBase<0xD20010CF, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_51_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_51, 0, 8, ReadWriteMode, ECLICCLICINTCTL_51Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_51_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_51, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3587,6 +3902,7 @@ struct ECLIC
   struct CLICINTCTL_52 : public RegisterBase<0xD20010D3, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_52_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_52, 0, 8, ReadWriteMode, ECLICCLICINTCTL_52Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_52_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_52, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3598,6 +3914,7 @@ struct ECLIC
   struct CLICINTCTL_53 : public RegisterBase<0xD20010D7, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_53_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_53, 0, 8, ReadWriteMode, ECLICCLICINTCTL_53Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_53_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_53, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3609,6 +3926,7 @@ struct ECLIC
   struct CLICINTCTL_54 : public RegisterBase<0xD20010DB, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_54_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_54, 0, 8, ReadWriteMode, ECLICCLICINTCTL_54Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_54_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_54, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3620,6 +3938,7 @@ struct ECLIC
   struct CLICINTCTL_55 : public RegisterBase<0xD20010DF, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_55_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_55, 0, 8, ReadWriteMode, ECLICCLICINTCTL_55Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_55_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_55, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3631,6 +3950,7 @@ struct ECLIC
   struct CLICINTCTL_56 : public RegisterBase<0xD20010E3, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_56_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_56, 0, 8, ReadWriteMode, ECLICCLICINTCTL_56Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_56_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_56, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3642,6 +3962,7 @@ struct ECLIC
   struct CLICINTCTL_57 : public RegisterBase<0xD20010E7, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_57_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_57, 0, 8, ReadWriteMode, ECLICCLICINTCTL_57Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_57_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_57, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3653,6 +3974,7 @@ struct ECLIC
   struct CLICINTCTL_58 : public RegisterBase<0xD20010EB, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_58_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_58, 0, 8, ReadWriteMode, ECLICCLICINTCTL_58Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_58_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_58, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3664,6 +3986,7 @@ struct ECLIC
   struct CLICINTCTL_59 : public RegisterBase<0xD20010EF, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_59_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_59, 0, 8, ReadWriteMode, ECLICCLICINTCTL_59Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_59_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_59, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3675,6 +3998,7 @@ struct ECLIC
   struct CLICINTCTL_60 : public RegisterBase<0xD20010F3, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_60_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_60, 0, 8, ReadWriteMode, ECLICCLICINTCTL_60Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_60_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_60, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3686,6 +4010,7 @@ struct ECLIC
   struct CLICINTCTL_61 : public RegisterBase<0xD20010F7, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_61_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_61, 0, 8, ReadWriteMode, ECLICCLICINTCTL_61Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_61_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_61, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3697,6 +4022,7 @@ struct ECLIC
   struct CLICINTCTL_62 : public RegisterBase<0xD20010FB, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_62_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_62, 0, 8, ReadWriteMode, ECLICCLICINTCTL_62Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_62_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_62, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3708,6 +4034,7 @@ struct ECLIC
   struct CLICINTCTL_63 : public RegisterBase<0xD20010FF, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_63_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_63, 0, 8, ReadWriteMode, ECLICCLICINTCTL_63Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_63_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_63, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3719,6 +4046,7 @@ struct ECLIC
   struct CLICINTCTL_64 : public RegisterBase<0xD2001103, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_64_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_64, 0, 8, ReadWriteMode, ECLICCLICINTCTL_64Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_64_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_64, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3730,6 +4058,7 @@ struct ECLIC
   struct CLICINTCTL_65 : public RegisterBase<0xD2001107, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_65_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_65, 0, 8, ReadWriteMode, ECLICCLICINTCTL_65Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_65_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_65, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3741,6 +4070,7 @@ struct ECLIC
   struct CLICINTCTL_66 : public RegisterBase<0xD200110B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_66_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_66, 0, 8, ReadWriteMode, ECLICCLICINTCTL_66Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_66_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_66, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3752,6 +4082,7 @@ struct ECLIC
   struct CLICINTCTL_67 : public RegisterBase<0xD200110F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_67_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_67, 0, 8, ReadWriteMode, ECLICCLICINTCTL_67Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_67_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_67, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3763,6 +4094,7 @@ struct ECLIC
   struct CLICINTCTL_68 : public RegisterBase<0xD2001113, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_68_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_68, 0, 8, ReadWriteMode, ECLICCLICINTCTL_68Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_68_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_68, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3774,6 +4106,7 @@ struct ECLIC
   struct CLICINTCTL_69 : public RegisterBase<0xD2001117, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_69_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_69, 0, 8, ReadWriteMode, ECLICCLICINTCTL_69Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_69_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_69, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3785,6 +4118,7 @@ struct ECLIC
   struct CLICINTCTL_70 : public RegisterBase<0xD200111B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_70_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_70, 0, 8, ReadWriteMode, ECLICCLICINTCTL_70Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_70_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_70, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3796,6 +4130,7 @@ struct ECLIC
   struct CLICINTCTL_71 : public RegisterBase<0xD200111F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_71_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_71, 0, 8, ReadWriteMode, ECLICCLICINTCTL_71Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_71_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_71, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3807,6 +4142,7 @@ struct ECLIC
   struct CLICINTCTL_72 : public RegisterBase<0xD2001123, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_72_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_72, 0, 8, ReadWriteMode, ECLICCLICINTCTL_72Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_72_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_72, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3818,6 +4154,7 @@ struct ECLIC
   struct CLICINTCTL_73 : public RegisterBase<0xD2001127, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_73_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_73, 0, 8, ReadWriteMode, ECLICCLICINTCTL_73Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_73_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_73, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3829,6 +4166,7 @@ struct ECLIC
   struct CLICINTCTL_74 : public RegisterBase<0xD200112B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_74_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_74, 0, 8, ReadWriteMode, ECLICCLICINTCTL_74Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_74_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_74, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3840,6 +4178,7 @@ struct ECLIC
   struct CLICINTCTL_75 : public RegisterBase<0xD200112F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_75_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_75, 0, 8, ReadWriteMode, ECLICCLICINTCTL_75Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_75_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_75, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3851,6 +4190,7 @@ struct ECLIC
   struct CLICINTCTL_76 : public RegisterBase<0xD2001133, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_76_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_76, 0, 8, ReadWriteMode, ECLICCLICINTCTL_76Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_76_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_76, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3862,6 +4202,7 @@ struct ECLIC
   struct CLICINTCTL_77 : public RegisterBase<0xD2001137, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_77_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_77, 0, 8, ReadWriteMode, ECLICCLICINTCTL_77Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_77_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_77, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3873,6 +4214,7 @@ struct ECLIC
   struct CLICINTCTL_78 : public RegisterBase<0xD200113B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_78_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_78, 0, 8, ReadWriteMode, ECLICCLICINTCTL_78Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_78_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_78, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3884,6 +4226,7 @@ struct ECLIC
   struct CLICINTCTL_79 : public RegisterBase<0xD200113F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_79_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_79, 0, 8, ReadWriteMode, ECLICCLICINTCTL_79Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_79_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_79, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3895,6 +4238,7 @@ struct ECLIC
   struct CLICINTCTL_80 : public RegisterBase<0xD2001143, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_80_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_80, 0, 8, ReadWriteMode, ECLICCLICINTCTL_80Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_80_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_80, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3906,6 +4250,7 @@ struct ECLIC
   struct CLICINTCTL_81 : public RegisterBase<0xD2001147, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_81_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_81, 0, 8, ReadWriteMode, ECLICCLICINTCTL_81Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_81_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_81, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3917,6 +4262,7 @@ struct ECLIC
   struct CLICINTCTL_82 : public RegisterBase<0xD200114B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_82_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_82, 0, 8, ReadWriteMode, ECLICCLICINTCTL_82Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_82_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_82, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3928,6 +4274,7 @@ struct ECLIC
   struct CLICINTCTL_83 : public RegisterBase<0xD200114F, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_83_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_83, 0, 8, ReadWriteMode, ECLICCLICINTCTL_83Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_83_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_83, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3939,6 +4286,7 @@ struct ECLIC
   struct CLICINTCTL_84 : public RegisterBase<0xD2001153, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_84_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_84, 0, 8, ReadWriteMode, ECLICCLICINTCTL_84Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_84_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_84, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3950,6 +4298,7 @@ struct ECLIC
   struct CLICINTCTL_85 : public RegisterBase<0xD2001157, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_85_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_85, 0, 8, ReadWriteMode, ECLICCLICINTCTL_85Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_85_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_85, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -3961,12 +4310,14 @@ struct ECLIC
   struct CLICINTCTL_86 : public RegisterBase<0xD200115B, 8, ReadWriteMode>
   {
     using LEVEL_PRIORITY = ECLIC_CLICINTCTL_86_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_86, 0, 8, ReadWriteMode, ECLICCLICINTCTL_86Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = ECLIC_CLICINTCTL_86_LEVEL_PRIORITY_Values<ECLIC::CLICINTCTL_86, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CLICINTCTL_86Pack  = Register<0xD200115B, 8, ReadWriteMode, ECLICCLICINTCTL_86Base, T...> ;
 
+  using Registers = TypesList<ECLIC::CLICCFG, ECLIC::CLICINFO, ECLIC::MTH, ECLIC::CLICINTIP_0, ECLIC::CLICINTIP_1, ECLIC::CLICINTIP_2, ECLIC::CLICINTIP_3, ECLIC::CLICINTIP_4, ECLIC::CLICINTIP_5, ECLIC::CLICINTIP_6, ECLIC::CLICINTIP_7, ECLIC::CLICINTIP_8, ECLIC::CLICINTIP_9, ECLIC::CLICINTIP_10, ECLIC::CLICINTIP_11, ECLIC::CLICINTIP_12, ECLIC::CLICINTIP_13, ECLIC::CLICINTIP_14, ECLIC::CLICINTIP_15, ECLIC::CLICINTIP_16, ECLIC::CLICINTIP_17, ECLIC::CLICINTIP_18, ECLIC::CLICINTIP_19, ECLIC::CLICINTIP_20, ECLIC::CLICINTIP_21, ECLIC::CLICINTIP_22, ECLIC::CLICINTIP_23, ECLIC::CLICINTIP_24, ECLIC::CLICINTIP_25, ECLIC::CLICINTIP_26, ECLIC::CLICINTIP_27, ECLIC::CLICINTIP_28, ECLIC::CLICINTIP_29, ECLIC::CLICINTIP_30, ECLIC::CLICINTIP_31, ECLIC::CLICINTIP_32, ECLIC::CLICINTIP_33, ECLIC::CLICINTIP_34, ECLIC::CLICINTIP_35, ECLIC::CLICINTIP_36, ECLIC::CLICINTIP_37, ECLIC::CLICINTIP_38, ECLIC::CLICINTIP_39, ECLIC::CLICINTIP_40, ECLIC::CLICINTIP_41, ECLIC::CLICINTIP_42, ECLIC::CLICINTIP_43, ECLIC::CLICINTIP_44, ECLIC::CLICINTIP_45, ECLIC::CLICINTIP_46, ECLIC::CLICINTIP_47, ECLIC::CLICINTIP_48, ECLIC::CLICINTIP_49, ECLIC::CLICINTIP_50, ECLIC::CLICINTIP_51, ECLIC::CLICINTIP_52, ECLIC::CLICINTIP_53, ECLIC::CLICINTIP_54, ECLIC::CLICINTIP_55, ECLIC::CLICINTIP_56, ECLIC::CLICINTIP_57, ECLIC::CLICINTIP_58, ECLIC::CLICINTIP_59, ECLIC::CLICINTIP_60, ECLIC::CLICINTIP_61, ECLIC::CLICINTIP_62, ECLIC::CLICINTIP_63, ECLIC::CLICINTIP_64, ECLIC::CLICINTIP_65, ECLIC::CLICINTIP_66, ECLIC::CLICINTIP_67, ECLIC::CLICINTIP_68, ECLIC::CLICINTIP_69, ECLIC::CLICINTIP_70, ECLIC::CLICINTIP_71, ECLIC::CLICINTIP_72, ECLIC::CLICINTIP_73, ECLIC::CLICINTIP_74, ECLIC::CLICINTIP_75, ECLIC::CLICINTIP_76, ECLIC::CLICINTIP_77, ECLIC::CLICINTIP_78, ECLIC::CLICINTIP_79, ECLIC::CLICINTIP_80, ECLIC::CLICINTIP_81, ECLIC::CLICINTIP_82, ECLIC::CLICINTIP_83, ECLIC::CLICINTIP_84, ECLIC::CLICINTIP_85, ECLIC::CLICINTIP_86, ECLIC::CLICINTIE_0, ECLIC::CLICINTIE_1, ECLIC::CLICINTIE_2, ECLIC::CLICINTIE_3, ECLIC::CLICINTIE_4, ECLIC::CLICINTIE_5, ECLIC::CLICINTIE_6, ECLIC::CLICINTIE_7, ECLIC::CLICINTIE_8, ECLIC::CLICINTIE_9, ECLIC::CLICINTIE_10, ECLIC::CLICINTIE_11, ECLIC::CLICINTIE_12, ECLIC::CLICINTIE_13, ECLIC::CLICINTIE_14, ECLIC::CLICINTIE_15, ECLIC::CLICINTIE_16, ECLIC::CLICINTIE_17, ECLIC::CLICINTIE_18, ECLIC::CLICINTIE_19, ECLIC::CLICINTIE_20, ECLIC::CLICINTIE_21, ECLIC::CLICINTIE_22, ECLIC::CLICINTIE_23, ECLIC::CLICINTIE_24, ECLIC::CLICINTIE_25, ECLIC::CLICINTIE_26, ECLIC::CLICINTIE_27, ECLIC::CLICINTIE_28, ECLIC::CLICINTIE_29, ECLIC::CLICINTIE_30, ECLIC::CLICINTIE_31, ECLIC::CLICINTIE_32, ECLIC::CLICINTIE_33, ECLIC::CLICINTIE_34, ECLIC::CLICINTIE_35, ECLIC::CLICINTIE_36, ECLIC::CLICINTIE_37, ECLIC::CLICINTIE_38, ECLIC::CLICINTIE_39, ECLIC::CLICINTIE_40, ECLIC::CLICINTIE_41, ECLIC::CLICINTIE_42, ECLIC::CLICINTIE_43, ECLIC::CLICINTIE_44, ECLIC::CLICINTIE_45, ECLIC::CLICINTIE_46, ECLIC::CLICINTIE_47, ECLIC::CLICINTIE_48, ECLIC::CLICINTIE_49, ECLIC::CLICINTIE_50, ECLIC::CLICINTIE_51, ECLIC::CLICINTIE_52, ECLIC::CLICINTIE_53, ECLIC::CLICINTIE_54, ECLIC::CLICINTIE_55, ECLIC::CLICINTIE_56, ECLIC::CLICINTIE_57, ECLIC::CLICINTIE_58, ECLIC::CLICINTIE_59, ECLIC::CLICINTIE_60, ECLIC::CLICINTIE_61, ECLIC::CLICINTIE_62, ECLIC::CLICINTIE_63, ECLIC::CLICINTIE_64, ECLIC::CLICINTIE_65, ECLIC::CLICINTIE_66, ECLIC::CLICINTIE_67, ECLIC::CLICINTIE_68, ECLIC::CLICINTIE_69, ECLIC::CLICINTIE_70, ECLIC::CLICINTIE_71, ECLIC::CLICINTIE_72, ECLIC::CLICINTIE_73, ECLIC::CLICINTIE_74, ECLIC::CLICINTIE_75, ECLIC::CLICINTIE_76, ECLIC::CLICINTIE_77, ECLIC::CLICINTIE_78, ECLIC::CLICINTIE_79, ECLIC::CLICINTIE_80, ECLIC::CLICINTIE_81, ECLIC::CLICINTIE_82, ECLIC::CLICINTIE_83, ECLIC::CLICINTIE_84, ECLIC::CLICINTIE_85, ECLIC::CLICINTIE_86, ECLIC::CLICINTATTR_0, ECLIC::CLICINTATTR_1, ECLIC::CLICINTATTR_2, ECLIC::CLICINTATTR_3, ECLIC::CLICINTATTR_4, ECLIC::CLICINTATTR_5, ECLIC::CLICINTATTR_6, ECLIC::CLICINTATTR_7, ECLIC::CLICINTATTR_8, ECLIC::CLICINTATTR_9, ECLIC::CLICINTATTR_10, ECLIC::CLICINTATTR_11, ECLIC::CLICINTATTR_12, ECLIC::CLICINTATTR_13, ECLIC::CLICINTATTR_14, ECLIC::CLICINTATTR_15, ECLIC::CLICINTATTR_16, ECLIC::CLICINTATTR_17, ECLIC::CLICINTATTR_18, ECLIC::CLICINTATTR_19, ECLIC::CLICINTATTR_20, ECLIC::CLICINTATTR_21, ECLIC::CLICINTATTR_22, ECLIC::CLICINTATTR_23, ECLIC::CLICINTATTR_24, ECLIC::CLICINTATTR_25, ECLIC::CLICINTATTR_26, ECLIC::CLICINTATTR_27, ECLIC::CLICINTATTR_28, ECLIC::CLICINTATTR_29, ECLIC::CLICINTATTR_30, ECLIC::CLICINTATTR_31, ECLIC::CLICINTATTR_32, ECLIC::CLICINTATTR_33, ECLIC::CLICINTATTR_34, ECLIC::CLICINTATTR_35, ECLIC::CLICINTATTR_36, ECLIC::CLICINTATTR_37, ECLIC::CLICINTATTR_38, ECLIC::CLICINTATTR_39, ECLIC::CLICINTATTR_40, ECLIC::CLICINTATTR_41, ECLIC::CLICINTATTR_42, ECLIC::CLICINTATTR_43, ECLIC::CLICINTATTR_44, ECLIC::CLICINTATTR_45, ECLIC::CLICINTATTR_46, ECLIC::CLICINTATTR_47, ECLIC::CLICINTATTR_48, ECLIC::CLICINTATTR_49, ECLIC::CLICINTATTR_50, ECLIC::CLICINTATTR_51, ECLIC::CLICINTATTR_52, ECLIC::CLICINTATTR_53, ECLIC::CLICINTATTR_54, ECLIC::CLICINTATTR_55, ECLIC::CLICINTATTR_56, ECLIC::CLICINTATTR_57, ECLIC::CLICINTATTR_58, ECLIC::CLICINTATTR_59, ECLIC::CLICINTATTR_60, ECLIC::CLICINTATTR_61, ECLIC::CLICINTATTR_62, ECLIC::CLICINTATTR_63, ECLIC::CLICINTATTR_64, ECLIC::CLICINTATTR_65, ECLIC::CLICINTATTR_66, ECLIC::CLICINTATTR_67, ECLIC::CLICINTATTR_68, ECLIC::CLICINTATTR_69, ECLIC::CLICINTATTR_70, ECLIC::CLICINTATTR_71, ECLIC::CLICINTATTR_72, ECLIC::CLICINTATTR_73, ECLIC::CLICINTATTR_74, ECLIC::CLICINTATTR_75, ECLIC::CLICINTATTR_76, ECLIC::CLICINTATTR_77, ECLIC::CLICINTATTR_78, ECLIC::CLICINTATTR_79, ECLIC::CLICINTATTR_80, ECLIC::CLICINTATTR_81, ECLIC::CLICINTATTR_82, ECLIC::CLICINTATTR_83, ECLIC::CLICINTATTR_84, ECLIC::CLICINTATTR_85, ECLIC::CLICINTATTR_86, ECLIC::CLICINTCTL_0, ECLIC::CLICINTCTL_1, ECLIC::CLICINTCTL_2, ECLIC::CLICINTCTL_3, ECLIC::CLICINTCTL_4, ECLIC::CLICINTCTL_5, ECLIC::CLICINTCTL_6, ECLIC::CLICINTCTL_7, ECLIC::CLICINTCTL_8, ECLIC::CLICINTCTL_9, ECLIC::CLICINTCTL_10, ECLIC::CLICINTCTL_11, ECLIC::CLICINTCTL_12, ECLIC::CLICINTCTL_13, ECLIC::CLICINTCTL_14, ECLIC::CLICINTCTL_15, ECLIC::CLICINTCTL_16, ECLIC::CLICINTCTL_17, ECLIC::CLICINTCTL_18, ECLIC::CLICINTCTL_19, ECLIC::CLICINTCTL_20, ECLIC::CLICINTCTL_21, ECLIC::CLICINTCTL_22, ECLIC::CLICINTCTL_23, ECLIC::CLICINTCTL_24, ECLIC::CLICINTCTL_25, ECLIC::CLICINTCTL_26, ECLIC::CLICINTCTL_27, ECLIC::CLICINTCTL_28, ECLIC::CLICINTCTL_29, ECLIC::CLICINTCTL_30, ECLIC::CLICINTCTL_31, ECLIC::CLICINTCTL_32, ECLIC::CLICINTCTL_33, ECLIC::CLICINTCTL_34, ECLIC::CLICINTCTL_35, ECLIC::CLICINTCTL_36, ECLIC::CLICINTCTL_37, ECLIC::CLICINTCTL_38, ECLIC::CLICINTCTL_39, ECLIC::CLICINTCTL_40, ECLIC::CLICINTCTL_41, ECLIC::CLICINTCTL_42, ECLIC::CLICINTCTL_43, ECLIC::CLICINTCTL_44, ECLIC::CLICINTCTL_45, ECLIC::CLICINTCTL_46, ECLIC::CLICINTCTL_47, ECLIC::CLICINTCTL_48, ECLIC::CLICINTCTL_49, ECLIC::CLICINTCTL_50, ECLIC::CLICINTCTL_51, ECLIC::CLICINTCTL_52, ECLIC::CLICINTCTL_53, ECLIC::CLICINTCTL_54, ECLIC::CLICINTCTL_55, ECLIC::CLICINTCTL_56, ECLIC::CLICINTCTL_57, ECLIC::CLICINTCTL_58, ECLIC::CLICINTCTL_59, ECLIC::CLICINTCTL_60, ECLIC::CLICINTCTL_61, ECLIC::CLICINTCTL_62, ECLIC::CLICINTCTL_63, ECLIC::CLICINTCTL_64, ECLIC::CLICINTCTL_65, ECLIC::CLICINTCTL_66, ECLIC::CLICINTCTL_67, ECLIC::CLICINTCTL_68, ECLIC::CLICINTCTL_69, ECLIC::CLICINTCTL_70, ECLIC::CLICINTCTL_71, ECLIC::CLICINTCTL_72, ECLIC::CLICINTCTL_73, ECLIC::CLICINTCTL_74, ECLIC::CLICINTCTL_75, ECLIC::CLICINTCTL_76, ECLIC::CLICINTCTL_77, ECLIC::CLICINTCTL_78, ECLIC::CLICINTCTL_79, ECLIC::CLICINTCTL_80, ECLIC::CLICINTCTL_81, ECLIC::CLICINTCTL_82, ECLIC::CLICINTCTL_83, ECLIC::CLICINTCTL_84, ECLIC::CLICINTCTL_85, ECLIC::CLICINTCTL_86> ;
 } ;
 
 #endif //#if !defined(ECLICREGISTERS_HPP)
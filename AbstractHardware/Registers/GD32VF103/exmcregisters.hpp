@@ -30,6 +30,7 @@ struct EXMC
     using NRTP = EXMC_SNCTL0_NRTP_Values<EXMC::SNCTL0, 2, 2, ReadWriteMode, EXMCSNCTL0Base> ;
     using NRMUX = EXMC_SNCTL0_NRMUX_Values<EXMC::SNCTL0, 1, 1, ReadWriteMode, EXMCSNCTL0Base> ;
     using NRBKEN = EXMC_SNCTL0_NRBKEN_Values<EXMC::SNCTL0, 0, 1, ReadWriteMode, EXMCSNCTL0Base> ;
+    static constexpr Type SnapshotMask = 0xB27FU ;
     using FieldValues = EXMC_SNCTL0_NRBKEN_Values<EXMC::SNCTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct EXMC
     using DSET = EXMC_SNTCFG0_DSET_Values<EXMC::SNTCFG0, 8, 8, ReadWriteMode, EXMCSNTCFG0Base> ;
     using AHLD = EXMC_SNTCFG0_AHLD_Values<EXMC::SNTCFG0, 4, 4, ReadWriteMode, EXMCSNTCFG0Base> ;
     using ASET = EXMC_SNTCFG0_ASET_Values<EXMC::SNTCFG0, 0, 4, ReadWriteMode, EXMCSNTCFG0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = EXMC_SNTCFG0_ASET_Values<EXMC::SNTCFG0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,12 +65,14 @@ struct EXMC
     using NRTP = EXMC_SNCTL1_NRTP_Values<EXMC::SNCTL1, 2, 2, ReadWriteMode, EXMCSNCTL1Base> ;
     using NRMUX = EXMC_SNCTL1_NRMUX_Values<EXMC::SNCTL1, 1, 1, ReadWriteMode, EXMCSNCTL1Base> ;
     using NRBKEN = EXMC_SNCTL1_NRBKEN_Values<EXMC::SNCTL1, 0, 1, ReadWriteMode, EXMCSNCTL1Base> ;
+    static constexpr Type SnapshotMask = 0xB27FU ;
     using FieldValues = EXMC_SNCTL1_NRBKEN_Values<EXMC::SNCTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SNCTL1Pack  = Register<0xA0000008, 32, ReadWriteMode, EXMCSNCTL1Base, T...> ;
 
+  using Registers = TypesList<EXMC::SNCTL0, EXMC::SNTCFG0, EXMC::SNCTL1> ;
 } ;
 
 #endif //#if !defined(EXMCREGISTERS_HPP)
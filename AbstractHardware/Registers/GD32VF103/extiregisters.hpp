@@ -40,6 +40,7 @@ struct EXTI
     using INTEN16 = EXTI_INTEN_INTEN16_Values<EXTI::INTEN, 16, 1, ReadWriteMode, EXTIINTENBase> ;
     using INTEN17 = EXTI_INTEN_INTEN17_Values<EXTI::INTEN, 17, 1, ReadWriteMode, EXTIINTENBase> ;
     using INTEN18 = EXTI_INTEN_INTEN18_Values<EXTI::INTEN, 18, 1, ReadWriteMode, EXTIINTENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = EXTI_INTEN_INTEN18_Values<EXTI::INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +70,7 @@ struct EXTI
     using EVEN16 = EXTI_EVEN_EVEN16_Values<EXTI::EVEN, 16, 1, ReadWriteMode, EXTIEVENBase> ;
     using EVEN17 = EXTI_EVEN_EVEN17_Values<EXTI::EVEN, 17, 1, ReadWriteMode, EXTIEVENBase> ;
     using EVEN18 = EXTI_EVEN_EVEN18_Values<EXTI::EVEN, 18, 1, ReadWriteMode, EXTIEVENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = EXTI_EVEN_EVEN18_Values<EXTI::EVEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +100,7 @@ struct EXTI
     using RTEN16 = EXTI_RTEN_RTEN16_Values<EXTI::RTEN, 16, 1, ReadWriteMode, EXTIRTENBase> ;
     using RTEN17 = EXTI_RTEN_RTEN17_Values<EXTI::RTEN, 17, 1, ReadWriteMode, EXTIRTENBase> ;
     using RTEN18 = EXTI_RTEN_RTEN18_Values<EXTI::RTEN, 18, 1, ReadWriteMode, EXTIRTENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = EXTI_RTEN_RTEN18_Values<EXTI::RTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +130,7 @@ struct EXTI
     using FTEN16 = EXTI_FTEN_FTEN16_Values<EXTI::FTEN, 16, 1, ReadWriteMode, EXTIFTENBase> ;
     using FTEN17 = EXTI_FTEN_FTEN17_Values<EXTI::FTEN, 17, 1, ReadWriteMode, EXTIFTENBase> ;
     using FTEN18 = EXTI_FTEN_FTEN18_Values<EXTI::FTEN, 18, 1, ReadWriteMode, EXTIFTENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = EXTI_FTEN_FTEN18_Values<EXTI::FTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -156,6 +160,7 @@ struct EXTI
     using SWIEV16 = EXTI_SWIEV_SWIEV16_Values<EXTI::SWIEV, 16, 1, ReadWriteMode, EXTISWIEVBase> ;
     using SWIEV17 = EXTI_SWIEV_SWIEV17_Values<EXTI::SWIEV, 17, 1, ReadWriteMode, EXTISWIEVBase> ;
     using SWIEV18 = EXTI_SWIEV_SWIEV18_Values<EXTI::SWIEV, 18, 1, ReadWriteMode, EXTISWIEVBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = EXTI_SWIEV_SWIEV18_Values<EXTI::SWIEV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -185,12 +190,16 @@ struct EXTI
     using PD16 = EXTI_PD_PD16_Values<EXTI::PD, 16, 1, ReadWriteMode, EXTIPDBase> ;
     using PD17 = EXTI_PD_PD17_Values<EXTI::PD, 17, 1, ReadWriteMode, EXTIPDBase> ;
     using PD18 = EXTI_PD_PD18_Values<EXTI::PD, 18, 1, ReadWriteMode, EXTIPDBase> ;
+    static constexpr Type WritableMask = 0x7FFFFU ;
+    static constexpr Type OneToClearMask = 0x7FFFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PD_PD18_Values<EXTI::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PDPack  = Register<0x40010414, 32, ReadWriteMode, EXTIPDBase, T...> ;
 
+  using Registers = TypesList<EXTI::INTEN, EXTI::EVEN, EXTI::RTEN, EXTI::FTEN, EXTI::SWIEV, EXTI::PD> ;
 } ;
 
 #endif //#if !defined(EXTIREGISTERS_HPP)
@@ -21,6 +21,7 @@ struct FMC
   struct WS : public RegisterBase<0x40022000, 32, ReadWriteMode>
   {
     using WSCNT = FMC_WS_WSCNT_Values<FMC::WS, 0, 3, ReadWriteMode, FMCWSBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = FMC_WS_WSCNT_Values<FMC::WS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +58,9 @@ struct FMC
     using WPERR = FMC_STAT0_WPERR_Values<FMC::STAT0, 4, 1, ReadWriteMode, FMCSTAT0Base> ;
     using PGERR = FMC_STAT0_PGERR_Values<FMC::STAT0, 2, 1, ReadWriteMode, FMCSTAT0Base> ;
     using BUSY = FMC_STAT0_BUSY_Values<FMC::STAT0, 0, 1, ReadMode, FMCSTAT0Base> ;
+    static constexpr Type WritableMask = 0x34U ;
+    static constexpr Type OneToClearMask = 0x34U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = FMC_STAT0_BUSY_Values<FMC::STAT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +81,7 @@ struct FMC
     using MER = FMC_CTL0_MER_Values<FMC::CTL0, 2, 1, ReadWriteMode, FMCCTL0Base> ;
     using PER = FMC_CTL0_PER_Values<FMC::CTL0, 1, 1, ReadWriteMode, FMCCTL0Base> ;
     using PG = FMC_CTL0_PG_Values<FMC::CTL0, 0, 1, ReadWriteMode, FMCCTL0Base> ;
+    static constexpr Type SnapshotMask = 0x16F7U ;
     using FieldValues = FMC_CTL0_PG_Values<FMC::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +135,7 @@ struct FMC
   template<typename... T> 
   using PIDPack  = Register<0x40022100, 32, ReadMode, FMCPIDBase, T...> ;
 
+  using Registers = TypesList<FMC::WS, FMC::KEY0, FMC::OBKEY, FMC::STAT0, FMC::CTL0, FMC::ADDR0, FMC::OBSTAT, FMC::WP, FMC::PID> ;
 } ;
 
 #endif //#if !defined(FMCREGISTERS_HPP)
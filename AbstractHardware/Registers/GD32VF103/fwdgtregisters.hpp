@@ -33,6 +33,7 @@ struct FWDGT
   struct PSC : public RegisterBase<0x40003004, 32, ReadWriteMode>
   {
     using PSCField = FWDGT_PSC_PSC_Values<FWDGT::PSC, 0, 3, ReadWriteMode, FWDGTPSCBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = FWDGT_PSC_PSC_Values<FWDGT::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct FWDGT
   struct RLD : public RegisterBase<0x40003008, 32, ReadWriteMode>
   {
     using RLDField = FWDGT_RLD_RLD_Values<FWDGT::RLD, 0, 12, ReadWriteMode, FWDGTRLDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = FWDGT_RLD_RLD_Values<FWDGT::RLD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct FWDGT
   template<typename... T> 
   using STATPack  = Register<0x4000300C, 32, ReadMode, FWDGTSTATBase, T...> ;
 
+  using Registers = TypesList<FWDGT::CTL, FWDGT::PSC, FWDGT::RLD, FWDGT::STAT> ;
 } ;
 
 #endif //#if !defined(FWDGTREGISTERS_HPP)
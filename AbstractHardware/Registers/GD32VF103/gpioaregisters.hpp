@@ -17,6 +17,8 @@
 
 struct GPIOA
 {
+  struct BOP ;
+
   struct GPIOACTL0Base {} ;
 
   struct CTL0 : public RegisterBase<0x40010800, 32, ReadWriteMode>
@@ -30,6 +32,7 @@ struct GPIOA
     using CTLMD2 = GPIOA_CTL_MD_Values<GPIOA::CTL0, 8, 4, ReadWriteMode, GPIOACTL0Base> ;
     using CTLMD1 = GPIOA_CTL_MD_Values<GPIOA::CTL0, 4, 4, ReadWriteMode, GPIOACTL0Base> ;
     using CTLMD0 = GPIOA_CTL_MD_Values<GPIOA::CTL0, 0, 4, ReadWriteMode, GPIOACTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOA_CTL_MD_Values<GPIOA::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -49,6 +52,7 @@ struct GPIOA
       using CTLMD9 = GPIOA_CTL_MD_Values<GPIOA::CTL0, 4, 4, ReadWriteMode, GPIOACTL0Base> ;
       using CTLMD8 = GPIOA_CTL_MD_Values<GPIOA::CTL0, 0, 4, ReadWriteMode, GPIOACTL0Base> ;
       using FieldValues = GPIOA_CTL_MD_Values<GPIOA::CTL0, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -100,6 +104,9 @@ struct GPIOA
     using OCTL2 = GPIOA_OCTL_OCTL2_Values<GPIOA::OCTL, 2, 1, ReadWriteMode, GPIOAOCTLBase> ;
     using OCTL1 = GPIOA_OCTL_OCTL1_Values<GPIOA::OCTL, 1, 1, ReadWriteMode, GPIOAOCTLBase> ;
     using OCTL0 = GPIOA_OCTL_OCTL0_Values<GPIOA::OCTL, 0, 1, ReadWriteMode, GPIOAOCTLBase> ;
+    using SetResetRegister = GPIOA::BOP ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = GPIOA_OCTL_OCTL0_Values<GPIOA::OCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -195,12 +202,14 @@ struct GPIOA
     using LK2 = GPIOA_LOCK_LK2_Values<GPIOA::LOCK, 2, 1, ReadWriteMode, GPIOALOCKBase> ;
     using LK1 = GPIOA_LOCK_LK1_Values<GPIOA::LOCK, 1, 1, ReadWriteMode, GPIOALOCKBase> ;
     using LK0 = GPIOA_LOCK_LK0_Values<GPIOA::LOCK, 0, 1, ReadWriteMode, GPIOALOCKBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = GPIOA_LOCK_LK0_Values<GPIOA::LOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using LOCKPack  = Register<0x40010818, 32, ReadWriteMode, GPIOALOCKBase, T...> ;
 
+  using Registers = TypesList<GPIOA::CTL0, GPIOA::CTL1, GPIOA::ISTAT, GPIOA::OCTL, GPIOA::BOP, GPIOA::BC, GPIOA::LOCK> ;
 } ;
 
 #endif //#if !defined(GPIOAREGISTERS_HPP)
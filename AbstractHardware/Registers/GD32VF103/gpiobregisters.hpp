@@ -17,6 +17,8 @@
 
 struct GPIOB
 {
+  struct BOP ;
+
   struct GPIOBCTL0Base {} ;
 
   struct CTL0 : public RegisterBase<0x40010C00, 32, ReadWriteMode>
@@ -29,6 +31,7 @@ struct GPIOB
       using CTLMD2 = GPIOB_CTL_MD_Values<GPIOB::CTL0, 8, 4, ReadWriteMode, GPIOBCTL0Base> ;
       using CTLMD1 = GPIOB_CTL_MD_Values<GPIOB::CTL0, 4, 4, ReadWriteMode, GPIOBCTL0Base> ;
       using CTLMD0 = GPIOB_CTL_MD_Values<GPIOB::CTL0, 0, 4, ReadWriteMode, GPIOBCTL0Base> ; ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOB_CTL_MD_Values<GPIOB::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct GPIOB
     using MD9 = GPIOB_CTL1_MD9_Values<GPIOB::CTL1, 4, 2, ReadWriteMode, GPIOBCTL1Base> ;
     using CTL8 = GPIOB_CTL1_CTL8_Values<GPIOB::CTL1, 2, 2, ReadWriteMode, GPIOBCTL1Base> ;
     using MD8 = GPIOB_CTL1_MD8_Values<GPIOB::CTL1, 0, 2, ReadWriteMode, GPIOBCTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOB_CTL1_MD8_Values<GPIOB::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -107,6 +111,9 @@ struct GPIOB
     using OCTL2 = GPIOB_OCTL_OCTL2_Values<GPIOB::OCTL, 2, 1, ReadWriteMode, GPIOBOCTLBase> ;
     using OCTL1 = GPIOB_OCTL_OCTL1_Values<GPIOB::OCTL, 1, 1, ReadWriteMode, GPIOBOCTLBase> ;
     using OCTL0 = GPIOB_OCTL_OCTL0_Values<GPIOB::OCTL, 0, 1, ReadWriteMode, GPIOBOCTLBase> ;
+    using SetResetRegister = GPIOB::BOP ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = GPIOB_OCTL_OCTL0_Values<GPIOB::OCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -202,12 +209,14 @@ struct GPIOB
     using LK2 = GPIOB_LOCK_LK2_Values<GPIOB::LOCK, 2, 1, ReadWriteMode, GPIOBLOCKBase> ;
     using LK1 = GPIOB_LOCK_LK1_Values<GPIOB::LOCK, 1, 1, ReadWriteMode, GPIOBLOCKBase> ;
     using LK0 = GPIOB_LOCK_LK0_Values<GPIOB::LOCK, 0, 1, ReadWriteMode, GPIOBLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = GPIOB_LOCK_LK0_Values<GPIOB::LOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using LOCKPack  = Register<0x40010C18, 32, ReadWriteMode, GPIOBLOCKBase, T...> ;
 
+  using Registers = TypesList<GPIOB::CTL0, GPIOB::CTL1, GPIOB::ISTAT, GPIOB::OCTL, GPIOB::BOP, GPIOB::BC, GPIOB::LOCK> ;
 } ;
 
 #endif //#if !defined(GPIOBREGISTERS_HPP)
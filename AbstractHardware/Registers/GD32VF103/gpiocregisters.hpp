@@ -17,6 +17,8 @@
 
 struct GPIOC
 {
+  struct BOP ;
+
   struct GPIOCCTL0Base {} ;
 
   struct CTL0 : public RegisterBase<0x40011000, 32, ReadWriteMode>
@@ -30,6 +32,7 @@ struct GPIOC
       using CTLMD1 = GPIOC_CTL_MD_Values<GPIOC::CTL0, 4, 4, ReadWriteMode, GPIOCCTL0Base> ;
       using CTLMD0 = GPIOC_CTL_MD_Values<GPIOC::CTL0, 0, 4, ReadWriteMode, GPIOCCTL0Base> ;
       using FieldValues = GPIOC_CTL_MD_Values<GPIOC::CTL0, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T>
@@ -48,6 +51,7 @@ struct GPIOC
       using CTLMD9 = GPIOC_CTL_MD_Values<GPIOC::CTL0, 4, 4, ReadWriteMode, GPIOCCTL0Base> ;
       using CTLMD8 = GPIOC_CTL_MD_Values<GPIOC::CTL0, 0, 4, ReadWriteMode, GPIOCCTL0Base> ;
       using FieldValues = GPIOC_CTL_MD_Values<GPIOC::CTL0, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -99,6 +103,9 @@ struct GPIOC
     using OCTL2 = GPIOC_OCTL_OCTL2_Values<GPIOC::OCTL, 2, 1, ReadWriteMode, GPIOCOCTLBase> ;
     using OCTL1 = GPIOC_OCTL_OCTL1_Values<GPIOC::OCTL, 1, 1, ReadWriteMode, GPIOCOCTLBase> ;
     using OCTL0 = GPIOC_OCTL_OCTL0_Values<GPIOC::OCTL, 0, 1, ReadWriteMode, GPIOCOCTLBase> ;
+    using SetResetRegister = GPIOC::BOP ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = GPIOC_OCTL_OCTL0_Values<GPIOC::OCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -194,12 +201,14 @@ struct GPIOC
     using LK2 = GPIOC_LOCK_LK2_Values<GPIOC::LOCK, 2, 1, ReadWriteMode, GPIOCLOCKBase> ;
     using LK1 = GPIOC_LOCK_LK1_Values<GPIOC::LOCK, 1, 1, ReadWriteMode, GPIOCLOCKBase> ;
     using LK0 = GPIOC_LOCK_LK0_Values<GPIOC::LOCK, 0, 1, ReadWriteMode, GPIOCLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = GPIOC_LOCK_LK0_Values<GPIOC::LOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using LOCKPack  = Register<0x40011018, 32, ReadWriteMode, GPIOCLOCKBase, T...> ;
 
+  using Registers = TypesList<GPIOC::CTL0, GPIOC::CTL1, GPIOC::ISTAT, GPIOC::OCTL, GPIOC::BOP, GPIOC::BC, GPIOC::LOCK> ;
 } ;
 
 #endif //#if !defined(GPIOCREGISTERS_HPP)
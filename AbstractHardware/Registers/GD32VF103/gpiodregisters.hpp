@@ -17,6 +17,8 @@
 
 struct GPIOD
 {
+  struct BOP ;
+
   struct GPIODCTL0Base {} ;
 
   struct CTL0 : public RegisterBase<0x40011400, 32, ReadWriteMode>
@@ -37,6 +39,7 @@ struct GPIOD
     using MD1 = GPIOD_CTL0_MD1_Values<GPIOD::CTL0, 4, 2, ReadWriteMode, GPIODCTL0Base> ;
     using CTL0Field = GPIOD_CTL0_CTL0_Values<GPIOD::CTL0, 2, 2, ReadWriteMode, GPIODCTL0Base> ;
     using MD0 = GPIOD_CTL0_MD0_Values<GPIOD::CTL0, 0, 2, ReadWriteMode, GPIODCTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOD_CTL0_MD0_Values<GPIOD::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +66,7 @@ struct GPIOD
     using MD9 = GPIOD_CTL1_MD9_Values<GPIOD::CTL1, 4, 2, ReadWriteMode, GPIODCTL1Base> ;
     using CTL8 = GPIOD_CTL1_CTL8_Values<GPIOD::CTL1, 2, 2, ReadWriteMode, GPIODCTL1Base> ;
     using MD8 = GPIOD_CTL1_MD8_Values<GPIOD::CTL1, 0, 2, ReadWriteMode, GPIODCTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOD_CTL1_MD8_Values<GPIOD::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +119,9 @@ struct GPIOD
     using OCTL2 = GPIOD_OCTL_OCTL2_Values<GPIOD::OCTL, 2, 1, ReadWriteMode, GPIODOCTLBase> ;
     using OCTL1 = GPIOD_OCTL_OCTL1_Values<GPIOD::OCTL, 1, 1, ReadWriteMode, GPIODOCTLBase> ;
     using OCTL0 = GPIOD_OCTL_OCTL0_Values<GPIOD::OCTL, 0, 1, ReadWriteMode, GPIODOCTLBase> ;
+    using SetResetRegister = GPIOD::BOP ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = GPIOD_OCTL_OCTL0_Values<GPIOD::OCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,12 +217,14 @@ struct GPIOD
     using LK2 = GPIOD_LOCK_LK2_Values<GPIOD::LOCK, 2, 1, ReadWriteMode, GPIODLOCKBase> ;
     using LK1 = GPIOD_LOCK_LK1_Values<GPIOD::LOCK, 1, 1, ReadWriteMode, GPIODLOCKBase> ;
     using LK0 = GPIOD_LOCK_LK0_Values<GPIOD::LOCK, 0, 1, ReadWriteMode, GPIODLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = GPIOD_LOCK_LK0_Values<GPIOD::LOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using LOCKPack  = Register<0x40011418, 32, ReadWriteMode, GPIODLOCKBase, T...> ;
 
+  using Registers = TypesList<GPIOD::CTL0, GPIOD::CTL1, GPIOD::ISTAT, GPIOD::OCTL, GPIOD::BOP, GPIOD::BC, GPIOD::LOCK> ;
 } ;
 
 #endif //#if !defined(GPIODREGISTERS_HPP)
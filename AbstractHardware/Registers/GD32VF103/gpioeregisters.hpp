@@ -17,6 +17,8 @@
 
 struct GPIOE
 {
+  struct BOP ;
+
   struct GPIOECTL0Base {} ;
 
   struct CTL0 : public RegisterBase<0x40011800, 32, ReadWriteMode>
@@ -37,6 +39,7 @@ struct GPIOE
     using MD1 = GPIOE_CTL0_MD1_Values<GPIOE::CTL0, 4, 2, ReadWriteMode, GPIOECTL0Base> ;
     using CTL0Field = GPIOE_CTL0_CTL0_Values<GPIOE::CTL0, 2, 2, ReadWriteMode, GPIOECTL0Base> ;
     using MD0 = GPIOE_CTL0_MD0_Values<GPIOE::CTL0, 0, 2, ReadWriteMode, GPIOECTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOE_CTL0_MD0_Values<GPIOE::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +66,7 @@ struct GPIOE
     using MD9 = GPIOE_CTL1_MD9_Values<GPIOE::CTL1, 4, 2, ReadWriteMode, GPIOECTL1Base> ;
     using CTL8 = GPIOE_CTL1_CTL8_Values<GPIOE::CTL1, 2, 2, ReadWriteMode, GPIOECTL1Base> ;
     using MD8 = GPIOE_CTL1_MD8_Values<GPIOE::CTL1, 0, 2, ReadWriteMode, GPIOECTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = GPIOE_CTL1_MD8_Values<GPIOE::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +119,9 @@ struct GPIOE
     using OCTL2 = GPIOE_OCTL_OCTL2_Values<GPIOE::OCTL, 2, 1, ReadWriteMode, GPIOEOCTLBase> ;
     using OCTL1 = GPIOE_OCTL_OCTL1_Values<GPIOE::OCTL, 1, 1, ReadWriteMode, GPIOEOCTLBase> ;
     using OCTL0 = GPIOE_OCTL_OCTL0_Values<GPIOE::OCTL, 0, 1, ReadWriteMode, GPIOEOCTLBase> ;
+    using SetResetRegister = GPIOE::BOP ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = GPIOE_OCTL_OCTL0_Values<GPIOE::OCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,12 +217,14 @@ struct GPIOE
     using LK2 = GPIOE_LOCK_LK2_Values<GPIOE::LOCK, 2, 1, ReadWriteMode, GPIOELOCKBase> ;
     using LK1 = GPIOE_LOCK_LK1_Values<GPIOE::LOCK, 1, 1, ReadWriteMode, GPIOELOCKBase> ;
     using LK0 = GPIOE_LOCK_LK0_Values<GPIOE::LOCK, 0, 1, ReadWriteMode, GPIOELOCKBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = GPIOE_LOCK_LK0_Values<GPIOE::LOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using LOCKPack  = Register<0x40011818, 32, ReadWriteMode, GPIOELOCKBase, T...> ;
 
+  using Registers = TypesList<GPIOE::CTL0, GPIOE::CTL1, GPIOE::ISTAT, GPIOE::OCTL, GPIOE::BOP, GPIOE::BC, GPIOE::LOCK> ;
 } ;
 
 #endif //#if !defined(GPIOEREGISTERS_HPP)
@@ -35,6 +35,8 @@ struct I2C1
     using SMBSEL = I2C1_CTL0_SMBSEL_Values<I2C1::CTL0, 3, 1, ReadWriteMode, I2C1CTL0Base> ;
     using SMBEN = I2C1_CTL0_SMBEN_Values<I2C1::CTL0, 1, 1, ReadWriteMode, I2C1CTL0Base> ;
     using I2CEN = I2C1_CTL0_I2CEN_Values<I2C1::CTL0, 0, 1, ReadWriteMode, I2C1CTL0Base> ;
+    static constexpr Type SnapshotMask = 0xBFFAU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = I2C1_CTL0_I2CEN_Values<I2C1::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +53,7 @@ struct I2C1
     using EVIE = I2C1_CTL1_EVIE_Values<I2C1::CTL1, 9, 1, ReadWriteMode, I2C1CTL1Base> ;
     using ERRIE = I2C1_CTL1_ERRIE_Values<I2C1::CTL1, 8, 1, ReadWriteMode, I2C1CTL1Base> ;
     using I2CCLK = I2C1_CTL1_I2CCLK_Values<I2C1::CTL1, 0, 6, ReadWriteMode, I2C1CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x1F3FU ;
     using FieldValues = I2C1_CTL1_I2CCLK_Values<I2C1::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +68,7 @@ struct I2C1
     using ADDRESS9_8 = I2C1_SADDR0_ADDRESS9_8_Values<I2C1::SADDR0, 8, 2, ReadWriteMode, I2C1SADDR0Base> ;
     using ADDRESS7_1 = I2C1_SADDR0_ADDRESS7_1_Values<I2C1::SADDR0, 1, 7, ReadWriteMode, I2C1SADDR0Base> ;
     using ADDRESS0 = I2C1_SADDR0_ADDRESS0_Values<I2C1::SADDR0, 0, 1, ReadWriteMode, I2C1SADDR0Base> ;
+    static constexpr Type SnapshotMask = 0x83FFU ;
     using FieldValues = I2C1_SADDR0_ADDRESS0_Values<I2C1::SADDR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +81,7 @@ struct I2C1
   {
     using ADDRESS2 = I2C1_SADDR1_ADDRESS2_Values<I2C1::SADDR1, 1, 7, ReadWriteMode, I2C1SADDR1Base> ;
     using DUADEN = I2C1_SADDR1_DUADEN_Values<I2C1::SADDR1, 0, 1, ReadWriteMode, I2C1SADDR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = I2C1_SADDR1_DUADEN_Values<I2C1::SADDR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +93,7 @@ struct I2C1
   struct DATA : public RegisterBase<0x40005810, 16, ReadWriteMode>
   {
     using TRB = I2C1_DATA_TRB_Values<I2C1::DATA, 0, 8, ReadWriteMode, I2C1DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C1_DATA_TRB_Values<I2C1::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +118,9 @@ struct I2C1
     using BTC = I2C1_STAT0_BTC_Values<I2C1::STAT0, 2, 1, ReadMode, I2C1STAT0Base> ;
     using ADDSEND = I2C1_STAT0_ADDSEND_Values<I2C1::STAT0, 1, 1, ReadMode, I2C1STAT0Base> ;
     using SBSEND = I2C1_STAT0_SBSEND_Values<I2C1::STAT0, 0, 1, ReadMode, I2C1STAT0Base> ;
+    static constexpr Type WritableMask = 0xDF00U ;
+    static constexpr Type ZeroToClearMask = 0xDF00U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C1_STAT0_SBSEND_Values<I2C1::STAT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +152,7 @@ struct I2C1
     using FAST = I2C1_CKCFG_FAST_Values<I2C1::CKCFG, 15, 1, ReadWriteMode, I2C1CKCFGBase> ;
     using DTCY = I2C1_CKCFG_DTCY_Values<I2C1::CKCFG, 14, 1, ReadWriteMode, I2C1CKCFGBase> ;
     using CLKC = I2C1_CKCFG_CLKC_Values<I2C1::CKCFG, 0, 12, ReadWriteMode, I2C1CKCFGBase> ;
+    static constexpr Type SnapshotMask = 0xCFFFU ;
     using FieldValues = I2C1_CKCFG_CLKC_Values<I2C1::CKCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,12 +164,14 @@ struct I2C1
   struct RT : public RegisterBase<0x40005820, 16, ReadWriteMode>
   {
     using RISETIME = I2C1_RT_RISETIME_Values<I2C1::RT, 0, 6, ReadWriteMode, I2C1RTBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = I2C1_RT_RISETIME_Values<I2C1::RT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using RTPack  = Register<0x40005820, 16, ReadWriteMode, I2C1RTBase, T...> ;
 
+  using Registers = TypesList<I2C1::CTL0, I2C1::CTL1, I2C1::SADDR0, I2C1::SADDR1, I2C1::DATA, I2C1::STAT0, I2C1::STAT1, I2C1::CKCFG, I2C1::RT> ;
 } ;
 
 #endif //#if !defined(I2C1REGISTERS_HPP)
@@ -32,6 +32,7 @@ struct MACHINETIMER
         using FieldValues = MACHINETIMER_MTIMECMP_MTIMECMP_Values<MACHINETIMER::MTIMECMP, 0, 0, NoAccess, NoAccess> ;
     };
 
+  using Registers = TypesList<> ;
 } ;
 
 
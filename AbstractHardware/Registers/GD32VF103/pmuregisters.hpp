@@ -28,6 +28,7 @@ struct PMU
     using WURST = PMU_CTL_WURST_Values<PMU::CTL, 2, 1, ReadWriteMode, PMUCTLBase> ;
     using STBMOD = PMU_CTL_STBMOD_Values<PMU::CTL, 1, 1, ReadWriteMode, PMUCTLBase> ;
     using LDOLP = PMU_CTL_LDOLP_Values<PMU::CTL, 0, 1, ReadWriteMode, PMUCTLBase> ;
+    static constexpr Type SnapshotMask = 0x1FFU ;
     using FieldValues = PMU_CTL_LDOLP_Values<PMU::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,12 +43,14 @@ struct PMU
     using LVDF = PMU_CS_LVDF_Values<PMU::CS, 2, 1, ReadMode, PMUCSBase> ;
     using STBF = PMU_CS_STBF_Values<PMU::CS, 1, 1, ReadMode, PMUCSBase> ;
     using WUF = PMU_CS_WUF_Values<PMU::CS, 0, 1, ReadMode, PMUCSBase> ;
+    static constexpr Type SnapshotMask = 0x100U ;
     using FieldValues = PMU_CS_WUF_Values<PMU::CS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSPack  = Register<0x40007004, 32, ReadWriteMode, PMUCSBase, T...> ;
 
+  using Registers = TypesList<PMU::CTL, PMU::CS> ;
 } ;
 
 #endif //#if !defined(PMUREGISTERS_HPP)
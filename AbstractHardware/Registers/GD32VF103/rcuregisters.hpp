@@ -35,6 +35,7 @@ struct RCU
     using PLL1STB = RCU_CTL_PLL1STB_Values<RCU::CTL, 27, 1, ReadMode, RCUCTLBase> ;
     using PLL2EN = RCU_CTL_PLL2EN_Values<RCU::CTL, 28, 1, ReadWriteMode, RCUCTLBase> ;
     using PLL2STB = RCU_CTL_PLL2STB_Values<RCU::CTL, 29, 1, ReadMode, RCUCTLBase> ;
+    static constexpr Type SnapshotMask = 0x150D00F9U ;
     using FieldValues = RCU_CTL_PLL2STB_Values<RCU::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +59,7 @@ struct RCU
     using CKOUT0SEL = RCU_CFG0_CKOUT0SEL_Values<RCU::CFG0, 24, 4, ReadWriteMode, RCUCFG0Base> ;
     using ADCPSC_2 = RCU_CFG0_ADCPSC_2_Values<RCU::CFG0, 28, 1, ReadWriteMode, RCUCFG0Base> ;
     using PLLMF_4 = RCU_CFG0_PLLMF_4_Values<RCU::CFG0, 29, 1, ReadWriteMode, RCUCFG0Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFF3U ;
     using FieldValues = RCU_CFG0_PLLMF_4_Values<RCU::CFG0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +93,7 @@ struct RCU
     using PLL1STBIC = RCU_INT_PLL1STBIC_Values<RCU::INT, 21, 1, WriteMode, RCUINTBase> ;
     using PLL2STBIC = RCU_INT_PLL2STBIC_Values<RCU::INT, 22, 1, WriteMode, RCUINTBase> ;
     using CKMIC = RCU_INT_CKMIC_Values<RCU::INT, 23, 1, WriteMode, RCUINTBase> ;
+    static constexpr Type SnapshotMask = 0xFF7F00U ;
     using FieldValues = RCU_INT_CKMIC_Values<RCU::INT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +115,7 @@ struct RCU
     using TIMER0RST = RCU_APB2RST_TIMER0RST_Values<RCU::APB2RST, 11, 1, ReadWriteMode, RCUAPB2RSTBase> ;
     using SPI0RST = RCU_APB2RST_SPI0RST_Values<RCU::APB2RST, 12, 1, ReadWriteMode, RCUAPB2RSTBase> ;
     using USART0RST = RCU_APB2RST_USART0RST_Values<RCU::APB2RST, 14, 1, ReadWriteMode, RCUAPB2RSTBase> ;
+    static constexpr Type SnapshotMask = 0x5E7DU ;
     using FieldValues = RCU_APB2RST_USART0RST_Values<RCU::APB2RST, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +146,7 @@ struct RCU
     using BKPIRST = RCU_APB1RST_BKPIRST_Values<RCU::APB1RST, 27, 1, ReadWriteMode, RCUAPB1RSTBase> ;
     using PMURST = RCU_APB1RST_PMURST_Values<RCU::APB1RST, 28, 1, ReadWriteMode, RCUAPB1RSTBase> ;
     using DACRST = RCU_APB1RST_DACRST_Values<RCU::APB1RST, 29, 1, ReadWriteMode, RCUAPB1RSTBase> ;
+    static constexpr Type SnapshotMask = 0x3E7EC83FU ;
     using FieldValues = RCU_APB1RST_DACRST_Values<RCU::APB1RST, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -159,6 +164,7 @@ struct RCU
     using CRCEN = RCU_AHBEN_CRCEN_Values<RCU::AHBEN, 6, 1, ReadWriteMode, RCUAHBENBase> ;
     using EXMCEN = RCU_AHBEN_EXMCEN_Values<RCU::AHBEN, 8, 1, ReadWriteMode, RCUAHBENBase> ;
     using USBFSEN = RCU_AHBEN_USBFSEN_Values<RCU::AHBEN, 12, 1, ReadWriteMode, RCUAHBENBase> ;
+    static constexpr Type SnapshotMask = 0x1157U ;
     using FieldValues = RCU_AHBEN_USBFSEN_Values<RCU::AHBEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +186,7 @@ struct RCU
     using TIMER0EN = RCU_APB2EN_TIMER0EN_Values<RCU::APB2EN, 11, 1, ReadWriteMode, RCUAPB2ENBase> ;
     using SPI0EN = RCU_APB2EN_SPI0EN_Values<RCU::APB2EN, 12, 1, ReadWriteMode, RCUAPB2ENBase> ;
     using USART0EN = RCU_APB2EN_USART0EN_Values<RCU::APB2EN, 14, 1, ReadWriteMode, RCUAPB2ENBase> ;
+    static constexpr Type SnapshotMask = 0x5E7DU ;
     using FieldValues = RCU_APB2EN_USART0EN_Values<RCU::APB2EN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +217,7 @@ struct RCU
     using BKPIEN = RCU_APB1EN_BKPIEN_Values<RCU::APB1EN, 27, 1, ReadWriteMode, RCUAPB1ENBase> ;
     using PMUEN = RCU_APB1EN_PMUEN_Values<RCU::APB1EN, 28, 1, ReadWriteMode, RCUAPB1ENBase> ;
     using DACEN = RCU_APB1EN_DACEN_Values<RCU::APB1EN, 29, 1, ReadWriteMode, RCUAPB1ENBase> ;
+    static constexpr Type SnapshotMask = 0x3E7EC83FU ;
     using FieldValues = RCU_APB1EN_DACEN_Values<RCU::APB1EN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -226,6 +234,7 @@ struct RCU
     using RTCSRC = RCU_BDCTL_RTCSRC_Values<RCU::BDCTL, 8, 2, ReadWriteMode, RCUBDCTLBase> ;
     using RTCEN = RCU_BDCTL_RTCEN_Values<RCU::BDCTL, 15, 1, ReadWriteMode, RCUBDCTLBase> ;
     using BKPRST = RCU_BDCTL_BKPRST_Values<RCU::BDCTL, 16, 1, ReadWriteMode, RCUBDCTLBase> ;
+    static constexpr Type SnapshotMask = 0x18305U ;
     using FieldValues = RCU_BDCTL_BKPRST_Values<RCU::BDCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -245,6 +254,7 @@ struct RCU
     using FWDGTRSTF = RCU_RSTSCK_FWDGTRSTF_Values<RCU::RSTSCK, 29, 1, ReadMode, RCURSTSCKBase> ;
     using WWDGTRSTF = RCU_RSTSCK_WWDGTRSTF_Values<RCU::RSTSCK, 30, 1, ReadMode, RCURSTSCKBase> ;
     using LPRSTF = RCU_RSTSCK_LPRSTF_Values<RCU::RSTSCK, 31, 1, ReadMode, RCURSTSCKBase> ;
+    static constexpr Type SnapshotMask = 0x1000001U ;
     using FieldValues = RCU_RSTSCK_LPRSTF_Values<RCU::RSTSCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -256,6 +266,7 @@ struct RCU
   struct AHBRST : public RegisterBase<0x40021028, 32, ReadWriteMode>
   {
     using USBFSRST = RCU_AHBRST_USBFSRST_Values<RCU::AHBRST, 12, 1, ReadWriteMode, RCUAHBRSTBase> ;
+    static constexpr Type SnapshotMask = 0x1000U ;
     using FieldValues = RCU_AHBRST_USBFSRST_Values<RCU::AHBRST, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +284,7 @@ struct RCU
     using PREDV0SEL = RCU_CFG1_PREDV0SEL_Values<RCU::CFG1, 16, 1, ReadWriteMode, RCUCFG1Base> ;
     using I2S1SEL = RCU_CFG1_I2S1SEL_Values<RCU::CFG1, 17, 1, ReadWriteMode, RCUCFG1Base> ;
     using I2S2SEL = RCU_CFG1_I2S2SEL_Values<RCU::CFG1, 18, 1, ReadWriteMode, RCUCFG1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = RCU_CFG1_I2S2SEL_Values<RCU::CFG1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,12 +296,14 @@ struct RCU
   struct DSV : public RegisterBase<0x40021034, 32, ReadWriteMode>
   {
     using DSLPVS = RCU_DSV_DSLPVS_Values<RCU::DSV, 0, 2, ReadWriteMode, RCUDSVBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = RCU_DSV_DSLPVS_Values<RCU::DSV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DSVPack  = Register<0x40021034, 32, ReadWriteMode, RCUDSVBase, T...> ;
 
+  using Registers = TypesList<RCU::CTL, RCU::CFG0, RCU::INT, RCU::APB2RST, RCU::APB1RST, RCU::AHBEN, RCU::APB2EN, RCU::APB1EN, RCU::BDCTL, RCU::RSTSCK, RCU::AHBRST, RCU::CFG1, RCU::DSV> ;
 } ;
 
 #endif //#if !defined(RCUREGISTERS_HPP)
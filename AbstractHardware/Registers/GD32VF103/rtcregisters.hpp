@@ -24,6 +24,7 @@ struct RTC
     using OVIE = RTC_INTEN_OVIE_Values<RTC::INTEN, 2, 1, ReadWriteMode, RTCINTENBase> ;
     using ALRMIE = RTC_INTEN_ALRMIE_Values<RTC::INTEN, 1, 1, ReadWriteMode, RTCINTENBase> ;
     using SCIE = RTC_INTEN_SCIE_Values<RTC::INTEN, 0, 1, ReadWriteMode, RTCINTENBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = RTC_INTEN_SCIE_Values<RTC::INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,9 @@ struct RTC
     using OVIF = RTC_CTL_OVIF_Values<RTC::CTL, 2, 1, ReadWriteMode, RTCCTLBase> ;
     using ALRMIF = RTC_CTL_ALRMIF_Values<RTC::CTL, 1, 1, ReadWriteMode, RTCCTLBase> ;
     using SCIF = RTC_CTL_SCIF_Values<RTC::CTL, 0, 1, ReadWriteMode, RTCCTLBase> ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ZeroToClearMask = 0xFU ;
+    static constexpr Type SnapshotMask = 0x30U ;
     using FieldValues = RTC_CTL_SCIF_Values<RTC::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +55,7 @@ struct RTC
   struct PSCH : public RegisterBase<0x40002808, 32, ReadWriteMode>
   {
     using PSC = RTC_PSCH_PSC_Values<RTC::PSCH, 0, 4, WriteMode, RTCPSCHBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = RTC_PSCH_PSC_Values<RTC::PSCH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +67,7 @@ struct RTC
   struct PSCL : public RegisterBase<0x4000280C, 32, ReadWriteMode>
   {
     using PSC = RTC_PSCL_PSC_Values<RTC::PSCL, 0, 16, WriteMode, RTCPSCLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = RTC_PSCL_PSC_Values<RTC::PSCL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +101,7 @@ struct RTC
   struct CNTH : public RegisterBase<0x40002818, 32, ReadWriteMode>
   {
     using CNT = RTC_CNTH_CNT_Values<RTC::CNTH, 0, 16, ReadWriteMode, RTCCNTHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = RTC_CNTH_CNT_Values<RTC::CNTH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +113,7 @@ struct RTC
   struct CNTL : public RegisterBase<0x4000281C, 32, ReadWriteMode>
   {
     using CNT = RTC_CNTL_CNT_Values<RTC::CNTL, 0, 16, ReadWriteMode, RTCCNTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = RTC_CNTL_CNT_Values<RTC::CNTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +142,7 @@ struct RTC
   template<typename... T> 
   using ALRMLPack  = Register<0x40002824, 32, WriteMode, RTCALRMLBase, T...> ;
 
+  using Registers = TypesList<RTC::INTEN, RTC::CTL, RTC::PSCH, RTC::PSCL, RTC::DIVH, RTC::DIVL, RTC::CNTH, RTC::CNTL, RTC::ALRMH, RTC::ALRML> ;
 } ;
 
 #endif //#if !defined(RTCREGISTERS_HPP)
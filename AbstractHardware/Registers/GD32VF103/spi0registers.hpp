@@ -35,6 +35,8 @@ struct SPI0
     using MSTMOD = SPI0_CTL0_MSTMOD_Values<SPI0::CTL0, 2, 1, ReadWriteMode, SPI0CTL0Base> ;
     using CKPL = SPI0_CTL0_CKPL_Values<SPI0::CTL0, 1, 1, ReadWriteMode, SPI0CTL0Base> ;
     using CKPH = SPI0_CTL0_CKPH_Values<SPI0::CTL0, 0, 1, ReadWriteMode, SPI0CTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI0_CTL0_CKPH_Values<SPI0::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +55,7 @@ struct SPI0
     using NSSDRV = SPI0_CTL1_NSSDRV_Values<SPI0::CTL1, 2, 1, ReadWriteMode, SPI0CTL1Base> ;
     using DMATEN = SPI0_CTL1_DMATEN_Values<SPI0::CTL1, 1, 1, ReadWriteMode, SPI0CTL1Base> ;
     using DMAREN = SPI0_CTL1_DMAREN_Values<SPI0::CTL1, 0, 1, ReadWriteMode, SPI0CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = SPI0_CTL1_DMAREN_Values<SPI0::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +75,9 @@ struct SPI0
     using I2SCH = SPI0_STAT_I2SCH_Values<SPI0::STAT, 2, 1, ReadMode, SPI0STATBase> ;
     using TBE = SPI0_STAT_TBE_Values<SPI0::STAT, 1, 1, ReadMode, SPI0STATBase> ;
     using RBNE = SPI0_STAT_RBNE_Values<SPI0::STAT, 0, 1, ReadMode, SPI0STATBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI0_STAT_RBNE_Values<SPI0::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +89,7 @@ struct SPI0
   struct DATA : public RegisterBase<0x4001300C, 16, ReadWriteMode>
   {
     using SPI_DATA = SPI0_DATA_SPI_DATA_Values<SPI0::DATA, 0, 16, ReadWriteMode, SPI0DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI0_DATA_SPI_DATA_Values<SPI0::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -94,6 +101,7 @@ struct SPI0
   struct CRCPOLY : public RegisterBase<0x40013010, 16, ReadWriteMode>
   {
     using CRCPOLYField = SPI0_CRCPOLY_CRCPOLY_Values<SPI0::CRCPOLY, 0, 16, ReadWriteMode, SPI0CRCPOLYBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI0_CRCPOLY_CRCPOLY_Values<SPI0::CRCPOLY, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +142,8 @@ struct SPI0
     using CKPL = SPI0_I2SCTL_CKPL_Values<SPI0::I2SCTL, 3, 1, ReadWriteMode, SPI0I2SCTLBase> ;
     using DTLEN = SPI0_I2SCTL_DTLEN_Values<SPI0::I2SCTL, 1, 2, ReadWriteMode, SPI0I2SCTLBase> ;
     using CHLEN = SPI0_I2SCTL_CHLEN_Values<SPI0::I2SCTL, 0, 1, ReadWriteMode, SPI0I2SCTLBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI0_I2SCTL_CHLEN_Values<SPI0::I2SCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,12 +157,14 @@ struct SPI0
     using MCKOEN = SPI0_I2SPSC_MCKOEN_Values<SPI0::I2SPSC, 9, 1, ReadWriteMode, SPI0I2SPSCBase> ;
     using OF = SPI0_I2SPSC_OF_Values<SPI0::I2SPSC, 8, 1, ReadWriteMode, SPI0I2SPSCBase> ;
     using DIV = SPI0_I2SPSC_DIV_Values<SPI0::I2SPSC, 0, 8, ReadWriteMode, SPI0I2SPSCBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI0_I2SPSC_DIV_Values<SPI0::I2SPSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPSCPack  = Register<0x40013020, 16, ReadWriteMode, SPI0I2SPSCBase, T...> ;
 
+  using Registers = TypesList<SPI0::CTL0, SPI0::CTL1, SPI0::STAT, SPI0::DATA, SPI0::CRCPOLY, SPI0::RCRC, SPI0::TCRC, SPI0::I2SCTL, SPI0::I2SPSC> ;
 } ;
 
 #endif //#if !defined(SPI0REGISTERS_HPP)
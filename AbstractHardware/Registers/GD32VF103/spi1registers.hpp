@@ -35,6 +35,8 @@ struct SPI1
     using MSTMOD = SPI1_CTL0_MSTMOD_Values<SPI1::CTL0, 2, 1, ReadWriteMode, SPI1CTL0Base> ;
     using CKPL = SPI1_CTL0_CKPL_Values<SPI1::CTL0, 1, 1, ReadWriteMode, SPI1CTL0Base> ;
     using CKPH = SPI1_CTL0_CKPH_Values<SPI1::CTL0, 0, 1, ReadWriteMode, SPI1CTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI1_CTL0_CKPH_Values<SPI1::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +55,7 @@ struct SPI1
     using NSSDRV = SPI1_CTL1_NSSDRV_Values<SPI1::CTL1, 2, 1, ReadWriteMode, SPI1CTL1Base> ;
     using DMATEN = SPI1_CTL1_DMATEN_Values<SPI1::CTL1, 1, 1, ReadWriteMode, SPI1CTL1Base> ;
     using DMAREN = SPI1_CTL1_DMAREN_Values<SPI1::CTL1, 0, 1, ReadWriteMode, SPI1CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = SPI1_CTL1_DMAREN_Values<SPI1::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +75,9 @@ struct SPI1
     using I2SCH = SPI1_STAT_I2SCH_Values<SPI1::STAT, 2, 1, ReadMode, SPI1STATBase> ;
     using TBE = SPI1_STAT_TBE_Values<SPI1::STAT, 1, 1, ReadMode, SPI1STATBase> ;
     using RBNE = SPI1_STAT_RBNE_Values<SPI1::STAT, 0, 1, ReadMode, SPI1STATBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI1_STAT_RBNE_Values<SPI1::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +89,7 @@ struct SPI1
   struct DATA : public RegisterBase<0x4000380C, 16, ReadWriteMode>
   {
     using SPI_DATA = SPI1_DATA_SPI_DATA_Values<SPI1::DATA, 0, 16, ReadWriteMode, SPI1DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI1_DATA_SPI_DATA_Values<SPI1::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -94,6 +101,7 @@ struct SPI1
   struct CRCPOLY : public RegisterBase<0x40003810, 16, ReadWriteMode>
   {
     using CRCPOLYField = SPI1_CRCPOLY_CRCPOLY_Values<SPI1::CRCPOLY, 0, 16, ReadWriteMode, SPI1CRCPOLYBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI1_CRCPOLY_CRCPOLY_Values<SPI1::CRCPOLY, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +142,8 @@ struct SPI1
     using CKPL = SPI1_I2SCTL_CKPL_Values<SPI1::I2SCTL, 3, 1, ReadWriteMode, SPI1I2SCTLBase> ;
     using DTLEN = SPI1_I2SCTL_DTLEN_Values<SPI1::I2SCTL, 1, 2, ReadWriteMode, SPI1I2SCTLBase> ;
     using CHLEN = SPI1_I2SCTL_CHLEN_Values<SPI1::I2SCTL, 0, 1, ReadWriteMode, SPI1I2SCTLBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI1_I2SCTL_CHLEN_Values<SPI1::I2SCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,12 +157,14 @@ struct SPI1
     using MCKOEN = SPI1_I2SPSC_MCKOEN_Values<SPI1::I2SPSC, 9, 1, ReadWriteMode, SPI1I2SPSCBase> ;
     using OF = SPI1_I2SPSC_OF_Values<SPI1::I2SPSC, 8, 1, ReadWriteMode, SPI1I2SPSCBase> ;
     using DIV = SPI1_I2SPSC_DIV_Values<SPI1::I2SPSC, 0, 8, ReadWriteMode, SPI1I2SPSCBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI1_I2SPSC_DIV_Values<SPI1::I2SPSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPSCPack  = Register<0x40003820, 16, ReadWriteMode, SPI1I2SPSCBase, T...> ;
 
+  using Registers = TypesList<SPI1::CTL0, SPI1::CTL1, SPI1::STAT, SPI1::DATA, SPI1::CRCPOLY, SPI1::RCRC, SPI1::TCRC, SPI1::I2SCTL, SPI1::I2SPSC> ;
 } ;
 
 #endif //#if !defined(SPI1REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI2
     using MSTMOD = SPI2_CTL0_MSTMOD_Values<SPI2::CTL0, 2, 1, ReadWriteMode, SPI2CTL0Base> ;
     using CKPL = SPI2_CTL0_CKPL_Values<SPI2::CTL0, 1, 1, ReadWriteMode, SPI2CTL0Base> ;
     using CKPH = SPI2_CTL0_CKPH_Values<SPI2::CTL0, 0, 1, ReadWriteMode, SPI2CTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI2_CTL0_CKPH_Values<SPI2::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +55,7 @@ struct SPI2
     using NSSDRV = SPI2_CTL1_NSSDRV_Values<SPI2::CTL1, 2, 1, ReadWriteMode, SPI2CTL1Base> ;
     using DMATEN = SPI2_CTL1_DMATEN_Values<SPI2::CTL1, 1, 1, ReadWriteMode, SPI2CTL1Base> ;
     using DMAREN = SPI2_CTL1_DMAREN_Values<SPI2::CTL1, 0, 1, ReadWriteMode, SPI2CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = SPI2_CTL1_DMAREN_Values<SPI2::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +75,9 @@ struct SPI2
     using I2SCH = SPI2_STAT_I2SCH_Values<SPI2::STAT, 2, 1, ReadMode, SPI2STATBase> ;
     using TBE = SPI2_STAT_TBE_Values<SPI2::STAT, 1, 1, ReadMode, SPI2STATBase> ;
     using RBNE = SPI2_STAT_RBNE_Values<SPI2::STAT, 0, 1, ReadMode, SPI2STATBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_STAT_RBNE_Values<SPI2::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +89,7 @@ struct SPI2
   struct DATA : public RegisterBase<0x40003C0C, 16, ReadWriteMode>
   {
     using SPI_DATA = SPI2_DATA_SPI_DATA_Values<SPI2::DATA, 0, 16, ReadWriteMode, SPI2DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_DATA_SPI_DATA_Values<SPI2::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -94,6 +101,7 @@ struct SPI2
   struct CRCPOLY : public RegisterBase<0x40003C10, 16, ReadWriteMode>
   {
     using CRCPOLYField = SPI2_CRCPOLY_CRCPOLY_Values<SPI2::CRCPOLY, 0, 16, ReadWriteMode, SPI2CRCPOLYBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI2_CRCPOLY_CRCPOLY_Values<SPI2::CRCPOLY, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +142,8 @@ struct SPI2
     using CKPL = SPI2_I2SCTL_CKPL_Values<SPI2::I2SCTL, 3, 1, ReadWriteMode, SPI2I2SCTLBase> ;
     using DTLEN = SPI2_I2SCTL_DTLEN_Values<SPI2::I2SCTL, 1, 2, ReadWriteMode, SPI2I2SCTLBase> ;
     using CHLEN = SPI2_I2SCTL_CHLEN_Values<SPI2::I2SCTL, 0, 1, ReadWriteMode, SPI2I2SCTLBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI2_I2SCTL_CHLEN_Values<SPI2::I2SCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,12 +157,14 @@ struct SPI2
     using MCKOEN = SPI2_I2SPSC_MCKOEN_Values<SPI2::I2SPSC, 9, 1, ReadWriteMode, SPI2I2SPSCBase> ;
     using OF = SPI2_I2SPSC_OF_Values<SPI2::I2SPSC, 8, 1, ReadWriteMode, SPI2I2SPSCBase> ;
     using DIV = SPI2_I2SPSC_DIV_Values<SPI2::I2SPSC, 0, 8, ReadWriteMode, SPI2I2SPSCBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI2_I2SPSC_DIV_Values<SPI2::I2SPSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPSCPack  = Register<0x40003C20, 16, ReadWriteMode, SPI2I2SPSCBase, T...> ;
 
+  using Registers = TypesList<SPI2::CTL0, SPI2::CTL1, SPI2::STAT, SPI2::DATA, SPI2::CRCPOLY, SPI2::RCRC, SPI2::TCRC, SPI2::I2SCTL, SPI2::I2SPSC> ;
 } ;
 
 #endif //#if !defined(SPI2REGISTERS_HPP)
@@ -29,6 +29,8 @@ struct TIMER0
     using UPS = TIMER0_CTL0_UPS_Values<TIMER0::CTL0, 2, 1, ReadWriteMode, TIMER0CTL0Base> ;
     using UPDIS = TIMER0_CTL0_UPDIS_Values<TIMER0::CTL0, 1, 1, ReadWriteMode, TIMER0CTL0Base> ;
     using CEN = TIMER0_CTL0_CEN_Values<TIMER0::CTL0, 0, 1, ReadWriteMode, TIMER0CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER0_CTL0_CEN_Values<TIMER0::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +53,7 @@ struct TIMER0
     using DMAS = TIMER0_CTL1_DMAS_Values<TIMER0::CTL1, 3, 1, ReadWriteMode, TIMER0CTL1Base> ;
     using CCUC = TIMER0_CTL1_CCUC_Values<TIMER0::CTL1, 2, 1, ReadWriteMode, TIMER0CTL1Base> ;
     using CCSE = TIMER0_CTL1_CCSE_Values<TIMER0::CTL1, 0, 1, ReadWriteMode, TIMER0CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFDU ;
     using FieldValues = TIMER0_CTL1_CCSE_Values<TIMER0::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -68,6 +71,7 @@ struct TIMER0
     using MSM = TIMER0_SMCFG_MSM_Values<TIMER0::SMCFG, 7, 1, ReadWriteMode, TIMER0SMCFGBase> ;
     using TRGS = TIMER0_SMCFG_TRGS_Values<TIMER0::SMCFG, 4, 3, ReadWriteMode, TIMER0SMCFGBase> ;
     using SMC = TIMER0_SMCFG_SMC_Values<TIMER0::SMCFG, 0, 3, ReadWriteMode, TIMER0SMCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIMER0_SMCFG_SMC_Values<TIMER0::SMCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +97,7 @@ struct TIMER0
     using CH1IE = TIMER0_DMAINTEN_CH1IE_Values<TIMER0::DMAINTEN, 2, 1, ReadWriteMode, TIMER0DMAINTENBase> ;
     using CH0IE = TIMER0_DMAINTEN_CH0IE_Values<TIMER0::DMAINTEN, 1, 1, ReadWriteMode, TIMER0DMAINTENBase> ;
     using UPIE = TIMER0_DMAINTEN_UPIE_Values<TIMER0::DMAINTEN, 0, 1, ReadWriteMode, TIMER0DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = TIMER0_DMAINTEN_UPIE_Values<TIMER0::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +120,9 @@ struct TIMER0
     using CH1IF = TIMER0_INTF_CH1IF_Values<TIMER0::INTF, 2, 1, ReadWriteMode, TIMER0INTFBase> ;
     using CH0IF = TIMER0_INTF_CH0IF_Values<TIMER0::INTF, 1, 1, ReadWriteMode, TIMER0INTFBase> ;
     using UPIF = TIMER0_INTF_UPIF_Values<TIMER0::INTF, 0, 1, ReadWriteMode, TIMER0INTFBase> ;
+    static constexpr Type WritableMask = 0x1EFFU ;
+    static constexpr Type ZeroToClearMask = 0x1EFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER0_INTF_UPIF_Values<TIMER0::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +161,7 @@ struct TIMER0
     using CH0COMSEN = TIMER0_CHCTL0_Output_CH0COMSEN_Values<TIMER0::CHCTL0_Output, 3, 1, ReadWriteMode, TIMER0CHCTL0_OutputBase> ;
     using CH0COMFEN = TIMER0_CHCTL0_Output_CH0COMFEN_Values<TIMER0::CHCTL0_Output, 2, 1, ReadWriteMode, TIMER0CHCTL0_OutputBase> ;
     using CH0MS = TIMER0_CHCTL0_Output_CH0MS_Values<TIMER0::CHCTL0_Output, 0, 2, ReadWriteMode, TIMER0CHCTL0_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CHCTL0_Output_CH0MS_Values<TIMER0::CHCTL0_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +178,7 @@ struct TIMER0
     using CH0CAPFLT = TIMER0_CHCTL0_Input_CH0CAPFLT_Values<TIMER0::CHCTL0_Input, 4, 4, ReadWriteMode, TIMER0CHCTL0_InputBase> ;
     using CH0CAPPSC = TIMER0_CHCTL0_Input_CH0CAPPSC_Values<TIMER0::CHCTL0_Input, 2, 2, ReadWriteMode, TIMER0CHCTL0_InputBase> ;
     using CH0MS = TIMER0_CHCTL0_Input_CH0MS_Values<TIMER0::CHCTL0_Input, 0, 2, ReadWriteMode, TIMER0CHCTL0_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CHCTL0_Input_CH0MS_Values<TIMER0::CHCTL0_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +199,7 @@ struct TIMER0
     using CH2COMSEN = TIMER0_CHCTL1_Output_CH2COMSEN_Values<TIMER0::CHCTL1_Output, 3, 1, ReadWriteMode, TIMER0CHCTL1_OutputBase> ;
     using CH2COMFEN = TIMER0_CHCTL1_Output_CH2COMFEN_Values<TIMER0::CHCTL1_Output, 2, 1, ReadWriteMode, TIMER0CHCTL1_OutputBase> ;
     using CH2MS = TIMER0_CHCTL1_Output_CH2MS_Values<TIMER0::CHCTL1_Output, 0, 2, ReadWriteMode, TIMER0CHCTL1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CHCTL1_Output_CH2MS_Values<TIMER0::CHCTL1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +216,7 @@ struct TIMER0
     using CH2CAPFLT = TIMER0_CHCTL1_Input_CH2CAPFLT_Values<TIMER0::CHCTL1_Input, 4, 4, ReadWriteMode, TIMER0CHCTL1_InputBase> ;
     using CH2CAPPSC = TIMER0_CHCTL1_Input_CH2CAPPSC_Values<TIMER0::CHCTL1_Input, 2, 2, ReadWriteMode, TIMER0CHCTL1_InputBase> ;
     using CH2MS = TIMER0_CHCTL1_Input_CH2MS_Values<TIMER0::CHCTL1_Input, 0, 2, ReadWriteMode, TIMER0CHCTL1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CHCTL1_Input_CH2MS_Values<TIMER0::CHCTL1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +241,7 @@ struct TIMER0
     using CH0NEN = TIMER0_CHCTL2_CH0NEN_Values<TIMER0::CHCTL2, 2, 1, ReadWriteMode, TIMER0CHCTL2Base> ;
     using CH0P = TIMER0_CHCTL2_CH0P_Values<TIMER0::CHCTL2, 1, 1, ReadWriteMode, TIMER0CHCTL2Base> ;
     using CH0EN = TIMER0_CHCTL2_CH0EN_Values<TIMER0::CHCTL2, 0, 1, ReadWriteMode, TIMER0CHCTL2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFU ;
     using FieldValues = TIMER0_CHCTL2_CH0EN_Values<TIMER0::CHCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +253,7 @@ struct TIMER0
   struct CNT : public RegisterBase<0x40012C24, 16, ReadWriteMode>
   {
     using CNTField = TIMER0_CNT_CNT_Values<TIMER0::CNT, 0, 16, ReadWriteMode, TIMER0CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER0_CNT_CNT_Values<TIMER0::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +265,7 @@ struct TIMER0
   struct PSC : public RegisterBase<0x40012C28, 16, ReadWriteMode>
   {
     using PSCField = TIMER0_PSC_PSC_Values<TIMER0::PSC, 0, 16, ReadWriteMode, TIMER0PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_PSC_PSC_Values<TIMER0::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +277,7 @@ struct TIMER0
   struct CAR : public RegisterBase<0x40012C2C, 16, ReadWriteMode>
   {
     using CARL = TIMER0_CAR_CARL_Values<TIMER0::CAR, 0, 16, ReadWriteMode, TIMER0CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CAR_CARL_Values<TIMER0::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +289,7 @@ struct TIMER0
   struct CREP : public RegisterBase<0x40012C30, 16, ReadWriteMode>
   {
     using CREPField = TIMER0_CREP_CREP_Values<TIMER0::CREP, 0, 8, ReadWriteMode, TIMER0CREPBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIMER0_CREP_CREP_Values<TIMER0::CREP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +301,7 @@ struct TIMER0
   struct CH0CV : public RegisterBase<0x40012C34, 16, ReadWriteMode>
   {
     using CH0VAL = TIMER0_CH0CV_CH0VAL_Values<TIMER0::CH0CV, 0, 16, ReadWriteMode, TIMER0CH0CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CH0CV_CH0VAL_Values<TIMER0::CH0CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -295,6 +313,7 @@ struct TIMER0
   struct CH1CV : public RegisterBase<0x40012C38, 16, ReadWriteMode>
   {
     using CH1VAL = TIMER0_CH1CV_CH1VAL_Values<TIMER0::CH1CV, 0, 16, ReadWriteMode, TIMER0CH1CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CH1CV_CH1VAL_Values<TIMER0::CH1CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +325,7 @@ struct TIMER0
   struct CH2CV : public RegisterBase<0x40012C3C, 16, ReadWriteMode>
   {
     using CH2VAL = TIMER0_CH2CV_CH2VAL_Values<TIMER0::CH2CV, 0, 16, ReadWriteMode, TIMER0CH2CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CH2CV_CH2VAL_Values<TIMER0::CH2CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -317,6 +337,7 @@ struct TIMER0
   struct CH3CV : public RegisterBase<0x40012C40, 16, ReadWriteMode>
   {
     using CH3VAL = TIMER0_CH3CV_CH3VAL_Values<TIMER0::CH3CV, 0, 16, ReadWriteMode, TIMER0CH3CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CH3CV_CH3VAL_Values<TIMER0::CH3CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -335,6 +356,7 @@ struct TIMER0
     using IOS = TIMER0_CCHP_IOS_Values<TIMER0::CCHP, 10, 1, ReadWriteMode, TIMER0CCHPBase> ;
     using PROT = TIMER0_CCHP_PROT_Values<TIMER0::CCHP, 8, 2, ReadWriteMode, TIMER0CCHPBase> ;
     using DTCFG = TIMER0_CCHP_DTCFG_Values<TIMER0::CCHP, 0, 8, ReadWriteMode, TIMER0CCHPBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_CCHP_DTCFG_Values<TIMER0::CCHP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -347,6 +369,7 @@ struct TIMER0
   {
     using DMATC = TIMER0_DMACFG_DMATC_Values<TIMER0::DMACFG, 8, 5, ReadWriteMode, TIMER0DMACFGBase> ;
     using DMATA = TIMER0_DMACFG_DMATA_Values<TIMER0::DMACFG, 0, 5, ReadWriteMode, TIMER0DMACFGBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIMER0_DMACFG_DMATA_Values<TIMER0::DMACFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,12 +381,14 @@ struct TIMER0
   struct DMATB : public RegisterBase<0x40012C4C, 16, ReadWriteMode>
   {
     using DMATBField = TIMER0_DMATB_DMATB_Values<TIMER0::DMATB, 0, 16, ReadWriteMode, TIMER0DMATBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER0_DMATB_DMATB_Values<TIMER0::DMATB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMATBPack  = Register<0x40012C4C, 16, ReadWriteMode, TIMER0DMATBBase, T...> ;
 
+  using Registers = TypesList<TIMER0::CTL0, TIMER0::CTL1, TIMER0::SMCFG, TIMER0::DMAINTEN, TIMER0::INTF, TIMER0::SWEVG, TIMER0::CHCTL0_Output, TIMER0::CHCTL0_Input, TIMER0::CHCTL1_Output, TIMER0::CHCTL1_Input, TIMER0::CHCTL2, TIMER0::CNT, TIMER0::PSC, TIMER0::CAR, TIMER0::CREP, TIMER0::CH0CV, TIMER0::CH1CV, TIMER0::CH2CV, TIMER0::CH3CV, TIMER0::CCHP, TIMER0::DMACFG, TIMER0::DMATB> ;
 } ;
 
 #endif //#if !defined(TIMER0REGISTERS_HPP)
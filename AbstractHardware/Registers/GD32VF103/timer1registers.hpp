@@ -29,6 +29,8 @@ struct TIMER1
     using UPS = TIMER1_CTL0_UPS_Values<TIMER1::CTL0, 2, 1, ReadWriteMode, TIMER1CTL0Base> ;
     using UPDIS = TIMER1_CTL0_UPDIS_Values<TIMER1::CTL0, 1, 1, ReadWriteMode, TIMER1CTL0Base> ;
     using CEN = TIMER1_CTL0_CEN_Values<TIMER1::CTL0, 0, 1, ReadWriteMode, TIMER1CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER1_CTL0_CEN_Values<TIMER1::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIMER1
     using TI0S = TIMER1_CTL1_TI0S_Values<TIMER1::CTL1, 7, 1, ReadWriteMode, TIMER1CTL1Base> ;
     using MMC = TIMER1_CTL1_MMC_Values<TIMER1::CTL1, 4, 3, ReadWriteMode, TIMER1CTL1Base> ;
     using DMAS = TIMER1_CTL1_DMAS_Values<TIMER1::CTL1, 3, 1, ReadWriteMode, TIMER1CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIMER1_CTL1_DMAS_Values<TIMER1::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct TIMER1
     using MSM = TIMER1_SMCFG_MSM_Values<TIMER1::SMCFG, 7, 1, ReadWriteMode, TIMER1SMCFGBase> ;
     using TRGS = TIMER1_SMCFG_TRGS_Values<TIMER1::SMCFG, 4, 3, ReadWriteMode, TIMER1SMCFGBase> ;
     using SMC = TIMER1_SMCFG_SMC_Values<TIMER1::SMCFG, 0, 3, ReadWriteMode, TIMER1SMCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIMER1_SMCFG_SMC_Values<TIMER1::SMCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct TIMER1
     using CH1IE = TIMER1_DMAINTEN_CH1IE_Values<TIMER1::DMAINTEN, 2, 1, ReadWriteMode, TIMER1DMAINTENBase> ;
     using CH0IE = TIMER1_DMAINTEN_CH0IE_Values<TIMER1::DMAINTEN, 1, 1, ReadWriteMode, TIMER1DMAINTENBase> ;
     using UPIE = TIMER1_DMAINTEN_UPIE_Values<TIMER1::DMAINTEN, 0, 1, ReadWriteMode, TIMER1DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIMER1_DMAINTEN_UPIE_Values<TIMER1::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +106,9 @@ struct TIMER1
     using CH1IF = TIMER1_INTF_CH1IF_Values<TIMER1::INTF, 2, 1, ReadWriteMode, TIMER1INTFBase> ;
     using CH0IF = TIMER1_INTF_CH0IF_Values<TIMER1::INTF, 1, 1, ReadWriteMode, TIMER1INTFBase> ;
     using UPIF = TIMER1_INTF_UPIF_Values<TIMER1::INTF, 0, 1, ReadWriteMode, TIMER1INTFBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER1_INTF_UPIF_Values<TIMER1::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +145,7 @@ struct TIMER1
     using CH0COMSEN = TIMER1_CHCTL0_Output_CH0COMSEN_Values<TIMER1::CHCTL0_Output, 3, 1, ReadWriteMode, TIMER1CHCTL0_OutputBase> ;
     using CH0COMFEN = TIMER1_CHCTL0_Output_CH0COMFEN_Values<TIMER1::CHCTL0_Output, 2, 1, ReadWriteMode, TIMER1CHCTL0_OutputBase> ;
     using CH0MS = TIMER1_CHCTL0_Output_CH0MS_Values<TIMER1::CHCTL0_Output, 0, 2, ReadWriteMode, TIMER1CHCTL0_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CHCTL0_Output_CH0MS_Values<TIMER1::CHCTL0_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +162,7 @@ struct TIMER1
     using CH0CAPFLT = TIMER1_CHCTL0_Input_CH0CAPFLT_Values<TIMER1::CHCTL0_Input, 4, 4, ReadWriteMode, TIMER1CHCTL0_InputBase> ;
     using CH0CAPPSC = TIMER1_CHCTL0_Input_CH0CAPPSC_Values<TIMER1::CHCTL0_Input, 2, 2, ReadWriteMode, TIMER1CHCTL0_InputBase> ;
     using CH0MS = TIMER1_CHCTL0_Input_CH0MS_Values<TIMER1::CHCTL0_Input, 0, 2, ReadWriteMode, TIMER1CHCTL0_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CHCTL0_Input_CH0MS_Values<TIMER1::CHCTL0_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +183,7 @@ struct TIMER1
     using CH2COMSEN = TIMER1_CHCTL1_Output_CH2COMSEN_Values<TIMER1::CHCTL1_Output, 3, 1, ReadWriteMode, TIMER1CHCTL1_OutputBase> ;
     using CH2COMFEN = TIMER1_CHCTL1_Output_CH2COMFEN_Values<TIMER1::CHCTL1_Output, 2, 1, ReadWriteMode, TIMER1CHCTL1_OutputBase> ;
     using CH2MS = TIMER1_CHCTL1_Output_CH2MS_Values<TIMER1::CHCTL1_Output, 0, 2, ReadWriteMode, TIMER1CHCTL1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CHCTL1_Output_CH2MS_Values<TIMER1::CHCTL1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +200,7 @@ struct TIMER1
     using CH2CAPFLT = TIMER1_CHCTL1_Input_CH2CAPFLT_Values<TIMER1::CHCTL1_Input, 4, 4, ReadWriteMode, TIMER1CHCTL1_InputBase> ;
     using CH2CAPPSC = TIMER1_CHCTL1_Input_CH2CAPPSC_Values<TIMER1::CHCTL1_Input, 2, 2, ReadWriteMode, TIMER1CHCTL1_InputBase> ;
     using CH2MS = TIMER1_CHCTL1_Input_CH2MS_Values<TIMER1::CHCTL1_Input, 0, 2, ReadWriteMode, TIMER1CHCTL1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CHCTL1_Input_CH2MS_Values<TIMER1::CHCTL1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +219,7 @@ struct TIMER1
     using CH1EN = TIMER1_CHCTL2_CH1EN_Values<TIMER1::CHCTL2, 4, 1, ReadWriteMode, TIMER1CHCTL2Base> ;
     using CH0P = TIMER1_CHCTL2_CH0P_Values<TIMER1::CHCTL2, 1, 1, ReadWriteMode, TIMER1CHCTL2Base> ;
     using CH0EN = TIMER1_CHCTL2_CH0EN_Values<TIMER1::CHCTL2, 0, 1, ReadWriteMode, TIMER1CHCTL2Base> ;
+    static constexpr Type SnapshotMask = 0x3333U ;
     using FieldValues = TIMER1_CHCTL2_CH0EN_Values<TIMER1::CHCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +231,7 @@ struct TIMER1
   struct CNT : public RegisterBase<0x40000024, 16, ReadWriteMode>
   {
     using CNTField = TIMER1_CNT_CNT_Values<TIMER1::CNT, 0, 16, ReadWriteMode, TIMER1CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER1_CNT_CNT_Values<TIMER1::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +243,7 @@ struct TIMER1
   struct PSC : public RegisterBase<0x40000028, 16, ReadWriteMode>
   {
     using PSCField = TIMER1_PSC_PSC_Values<TIMER1::PSC, 0, 16, ReadWriteMode, TIMER1PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_PSC_PSC_Values<TIMER1::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +255,7 @@ struct TIMER1
   struct CAR : public RegisterBase<0x4000002C, 16, ReadWriteMode>
   {
     using CARL = TIMER1_CAR_CARL_Values<TIMER1::CAR, 0, 16, ReadWriteMode, TIMER1CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CAR_CARL_Values<TIMER1::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +267,7 @@ struct TIMER1
   struct CH0CV : public RegisterBase<0x40000034, 32, ReadWriteMode>
   {
     using CH0VAL = TIMER1_CH0CV_CH0VAL_Values<TIMER1::CH0CV, 0, 16, ReadWriteMode, TIMER1CH0CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CH0CV_CH0VAL_Values<TIMER1::CH0CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +279,7 @@ struct TIMER1
   struct CH1CV : public RegisterBase<0x40000038, 32, ReadWriteMode>
   {
     using CH1VAL = TIMER1_CH1CV_CH1VAL_Values<TIMER1::CH1CV, 0, 16, ReadWriteMode, TIMER1CH1CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CH1CV_CH1VAL_Values<TIMER1::CH1CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +291,7 @@ struct TIMER1
   struct CH2CV : public RegisterBase<0x4000003C, 32, ReadWriteMode>
   {
     using CH2VAL = TIMER1_CH2CV_CH2VAL_Values<TIMER1::CH2CV, 0, 16, ReadWriteMode, TIMER1CH2CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CH2CV_CH2VAL_Values<TIMER1::CH2CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +303,7 @@ struct TIMER1
   struct CH3CV : public RegisterBase<0x40000040, 32, ReadWriteMode>
   {
     using CH3VAL = TIMER1_CH3CV_CH3VAL_Values<TIMER1::CH3CV, 0, 16, ReadWriteMode, TIMER1CH3CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_CH3CV_CH3VAL_Values<TIMER1::CH3CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct TIMER1
   {
     using DMATC = TIMER1_DMACFG_DMATC_Values<TIMER1::DMACFG, 8, 5, ReadWriteMode, TIMER1DMACFGBase> ;
     using DMATA = TIMER1_DMACFG_DMATA_Values<TIMER1::DMACFG, 0, 5, ReadWriteMode, TIMER1DMACFGBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIMER1_DMACFG_DMATA_Values<TIMER1::DMACFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,12 +328,14 @@ struct TIMER1
   struct DMATB : public RegisterBase<0x4000004C, 32, ReadWriteMode>
   {
     using DMATBField = TIMER1_DMATB_DMATB_Values<TIMER1::DMATB, 0, 16, ReadWriteMode, TIMER1DMATBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER1_DMATB_DMATB_Values<TIMER1::DMATB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMATBPack  = Register<0x4000004C, 32, ReadWriteMode, TIMER1DMATBBase, T...> ;
 
+  using Registers = TypesList<TIMER1::CTL0, TIMER1::CTL1, TIMER1::SMCFG, TIMER1::DMAINTEN, TIMER1::INTF, TIMER1::SWEVG, TIMER1::CHCTL0_Output, TIMER1::CHCTL0_Input, TIMER1::CHCTL1_Output, TIMER1::CHCTL1_Input, TIMER1::CHCTL2, TIMER1::CNT, TIMER1::PSC, TIMER1::CAR, TIMER1::CH0CV, TIMER1::CH1CV, TIMER1::CH2CV, TIMER1::CH3CV, TIMER1::DMACFG, TIMER1::DMATB> ;
 } ;
 
 #endif //#if !defined(TIMER1REGISTERS_HPP)
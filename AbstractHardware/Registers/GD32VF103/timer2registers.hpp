@@ -29,6 +29,8 @@ struct TIMER2
     using UPS = TIMER2_CTL0_UPS_Values<TIMER2::CTL0, 2, 1, ReadWriteMode, TIMER2CTL0Base> ;
     using UPDIS = TIMER2_CTL0_UPDIS_Values<TIMER2::CTL0, 1, 1, ReadWriteMode, TIMER2CTL0Base> ;
     using CEN = TIMER2_CTL0_CEN_Values<TIMER2::CTL0, 0, 1, ReadWriteMode, TIMER2CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER2_CTL0_CEN_Values<TIMER2::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIMER2
     using TI0S = TIMER2_CTL1_TI0S_Values<TIMER2::CTL1, 7, 1, ReadWriteMode, TIMER2CTL1Base> ;
     using MMC = TIMER2_CTL1_MMC_Values<TIMER2::CTL1, 4, 3, ReadWriteMode, TIMER2CTL1Base> ;
     using DMAS = TIMER2_CTL1_DMAS_Values<TIMER2::CTL1, 3, 1, ReadWriteMode, TIMER2CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIMER2_CTL1_DMAS_Values<TIMER2::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct TIMER2
     using MSM = TIMER2_SMCFG_MSM_Values<TIMER2::SMCFG, 7, 1, ReadWriteMode, TIMER2SMCFGBase> ;
     using TRGS = TIMER2_SMCFG_TRGS_Values<TIMER2::SMCFG, 4, 3, ReadWriteMode, TIMER2SMCFGBase> ;
     using SMC = TIMER2_SMCFG_SMC_Values<TIMER2::SMCFG, 0, 3, ReadWriteMode, TIMER2SMCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIMER2_SMCFG_SMC_Values<TIMER2::SMCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct TIMER2
     using CH1IE = TIMER2_DMAINTEN_CH1IE_Values<TIMER2::DMAINTEN, 2, 1, ReadWriteMode, TIMER2DMAINTENBase> ;
     using CH0IE = TIMER2_DMAINTEN_CH0IE_Values<TIMER2::DMAINTEN, 1, 1, ReadWriteMode, TIMER2DMAINTENBase> ;
     using UPIE = TIMER2_DMAINTEN_UPIE_Values<TIMER2::DMAINTEN, 0, 1, ReadWriteMode, TIMER2DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIMER2_DMAINTEN_UPIE_Values<TIMER2::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +106,9 @@ struct TIMER2
     using CH1IF = TIMER2_INTF_CH1IF_Values<TIMER2::INTF, 2, 1, ReadWriteMode, TIMER2INTFBase> ;
     using CH0IF = TIMER2_INTF_CH0IF_Values<TIMER2::INTF, 1, 1, ReadWriteMode, TIMER2INTFBase> ;
     using UPIF = TIMER2_INTF_UPIF_Values<TIMER2::INTF, 0, 1, ReadWriteMode, TIMER2INTFBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER2_INTF_UPIF_Values<TIMER2::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +145,7 @@ struct TIMER2
     using CH0COMSEN = TIMER2_CHCTL0_Output_CH0COMSEN_Values<TIMER2::CHCTL0_Output, 3, 1, ReadWriteMode, TIMER2CHCTL0_OutputBase> ;
     using CH0COMFEN = TIMER2_CHCTL0_Output_CH0COMFEN_Values<TIMER2::CHCTL0_Output, 2, 1, ReadWriteMode, TIMER2CHCTL0_OutputBase> ;
     using CH0MS = TIMER2_CHCTL0_Output_CH0MS_Values<TIMER2::CHCTL0_Output, 0, 2, ReadWriteMode, TIMER2CHCTL0_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CHCTL0_Output_CH0MS_Values<TIMER2::CHCTL0_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +162,7 @@ struct TIMER2
     using CH0CAPFLT = TIMER2_CHCTL0_Input_CH0CAPFLT_Values<TIMER2::CHCTL0_Input, 4, 4, ReadWriteMode, TIMER2CHCTL0_InputBase> ;
     using CH0CAPPSC = TIMER2_CHCTL0_Input_CH0CAPPSC_Values<TIMER2::CHCTL0_Input, 2, 2, ReadWriteMode, TIMER2CHCTL0_InputBase> ;
     using CH0MS = TIMER2_CHCTL0_Input_CH0MS_Values<TIMER2::CHCTL0_Input, 0, 2, ReadWriteMode, TIMER2CHCTL0_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CHCTL0_Input_CH0MS_Values<TIMER2::CHCTL0_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +183,7 @@ struct TIMER2
     using CH2COMSEN = TIMER2_CHCTL1_Output_CH2COMSEN_Values<TIMER2::CHCTL1_Output, 3, 1, ReadWriteMode, TIMER2CHCTL1_OutputBase> ;
     using CH2COMFEN = TIMER2_CHCTL1_Output_CH2COMFEN_Values<TIMER2::CHCTL1_Output, 2, 1, ReadWriteMode, TIMER2CHCTL1_OutputBase> ;
     using CH2MS = TIMER2_CHCTL1_Output_CH2MS_Values<TIMER2::CHCTL1_Output, 0, 2, ReadWriteMode, TIMER2CHCTL1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CHCTL1_Output_CH2MS_Values<TIMER2::CHCTL1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +200,7 @@ struct TIMER2
     using CH2CAPFLT = TIMER2_CHCTL1_Input_CH2CAPFLT_Values<TIMER2::CHCTL1_Input, 4, 4, ReadWriteMode, TIMER2CHCTL1_InputBase> ;
     using CH2CAPPSC = TIMER2_CHCTL1_Input_CH2CAPPSC_Values<TIMER2::CHCTL1_Input, 2, 2, ReadWriteMode, TIMER2CHCTL1_InputBase> ;
     using CH2MS = TIMER2_CHCTL1_Input_CH2MS_Values<TIMER2::CHCTL1_Input, 0, 2, ReadWriteMode, TIMER2CHCTL1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CHCTL1_Input_CH2MS_Values<TIMER2::CHCTL1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +219,7 @@ struct TIMER2
     using CH1EN = TIMER2_CHCTL2_CH1EN_Values<TIMER2::CHCTL2, 4, 1, ReadWriteMode, TIMER2CHCTL2Base> ;
     using CH0P = TIMER2_CHCTL2_CH0P_Values<TIMER2::CHCTL2, 1, 1, ReadWriteMode, TIMER2CHCTL2Base> ;
     using CH0EN = TIMER2_CHCTL2_CH0EN_Values<TIMER2::CHCTL2, 0, 1, ReadWriteMode, TIMER2CHCTL2Base> ;
+    static constexpr Type SnapshotMask = 0x3333U ;
     using FieldValues = TIMER2_CHCTL2_CH0EN_Values<TIMER2::CHCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +231,7 @@ struct TIMER2
   struct CNT : public RegisterBase<0x40000424, 16, ReadWriteMode>
   {
     using CNTField = TIMER2_CNT_CNT_Values<TIMER2::CNT, 0, 16, ReadWriteMode, TIMER2CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER2_CNT_CNT_Values<TIMER2::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +243,7 @@ struct TIMER2
   struct PSC : public RegisterBase<0x40000428, 16, ReadWriteMode>
   {
     using PSCField = TIMER2_PSC_PSC_Values<TIMER2::PSC, 0, 16, ReadWriteMode, TIMER2PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_PSC_PSC_Values<TIMER2::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +255,7 @@ struct TIMER2
   struct CAR : public RegisterBase<0x4000042C, 16, ReadWriteMode>
   {
     using CARL = TIMER2_CAR_CARL_Values<TIMER2::CAR, 0, 16, ReadWriteMode, TIMER2CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CAR_CARL_Values<TIMER2::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +267,7 @@ struct TIMER2
   struct CH0CV : public RegisterBase<0x40000434, 32, ReadWriteMode>
   {
     using CH0VAL = TIMER2_CH0CV_CH0VAL_Values<TIMER2::CH0CV, 0, 16, ReadWriteMode, TIMER2CH0CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CH0CV_CH0VAL_Values<TIMER2::CH0CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +279,7 @@ struct TIMER2
   struct CH1CV : public RegisterBase<0x40000438, 32, ReadWriteMode>
   {
     using CH1VAL = TIMER2_CH1CV_CH1VAL_Values<TIMER2::CH1CV, 0, 16, ReadWriteMode, TIMER2CH1CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CH1CV_CH1VAL_Values<TIMER2::CH1CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +291,7 @@ struct TIMER2
   struct CH2CV : public RegisterBase<0x4000043C, 32, ReadWriteMode>
   {
     using CH2VAL = TIMER2_CH2CV_CH2VAL_Values<TIMER2::CH2CV, 0, 16, ReadWriteMode, TIMER2CH2CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CH2CV_CH2VAL_Values<TIMER2::CH2CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +303,7 @@ struct TIMER2
   struct CH3CV : public RegisterBase<0x40000440, 32, ReadWriteMode>
   {
     using CH3VAL = TIMER2_CH3CV_CH3VAL_Values<TIMER2::CH3CV, 0, 16, ReadWriteMode, TIMER2CH3CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_CH3CV_CH3VAL_Values<TIMER2::CH3CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct TIMER2
   {
     using DMATC = TIMER2_DMACFG_DMATC_Values<TIMER2::DMACFG, 8, 5, ReadWriteMode, TIMER2DMACFGBase> ;
     using DMATA = TIMER2_DMACFG_DMATA_Values<TIMER2::DMACFG, 0, 5, ReadWriteMode, TIMER2DMACFGBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIMER2_DMACFG_DMATA_Values<TIMER2::DMACFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,12 +328,14 @@ struct TIMER2
   struct DMATB : public RegisterBase<0x4000044C, 32, ReadWriteMode>
   {
     using DMATBField = TIMER2_DMATB_DMATB_Values<TIMER2::DMATB, 0, 16, ReadWriteMode, TIMER2DMATBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER2_DMATB_DMATB_Values<TIMER2::DMATB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMATBPack  = Register<0x4000044C, 32, ReadWriteMode, TIMER2DMATBBase, T...> ;
 
+  using Registers = TypesList<TIMER2::CTL0, TIMER2::CTL1, TIMER2::SMCFG, TIMER2::DMAINTEN, TIMER2::INTF, TIMER2::SWEVG, TIMER2::CHCTL0_Output, TIMER2::CHCTL0_Input, TIMER2::CHCTL1_Output, TIMER2::CHCTL1_Input, TIMER2::CHCTL2, TIMER2::CNT, TIMER2::PSC, TIMER2::CAR, TIMER2::CH0CV, TIMER2::CH1CV, TIMER2::CH2CV, TIMER2::CH3CV, TIMER2::DMACFG, TIMER2::DMATB> ;
 } ;
 
 #endif //#if !defined(TIMER2REGISTERS_HPP)
@@ -29,6 +29,8 @@ struct TIMER3
     using UPS = TIMER3_CTL0_UPS_Values<TIMER3::CTL0, 2, 1, ReadWriteMode, TIMER3CTL0Base> ;
     using UPDIS = TIMER3_CTL0_UPDIS_Values<TIMER3::CTL0, 1, 1, ReadWriteMode, TIMER3CTL0Base> ;
     using CEN = TIMER3_CTL0_CEN_Values<TIMER3::CTL0, 0, 1, ReadWriteMode, TIMER3CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER3_CTL0_CEN_Values<TIMER3::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIMER3
     using TI0S = TIMER3_CTL1_TI0S_Values<TIMER3::CTL1, 7, 1, ReadWriteMode, TIMER3CTL1Base> ;
     using MMC = TIMER3_CTL1_MMC_Values<TIMER3::CTL1, 4, 3, ReadWriteMode, TIMER3CTL1Base> ;
     using DMAS = TIMER3_CTL1_DMAS_Values<TIMER3::CTL1, 3, 1, ReadWriteMode, TIMER3CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIMER3_CTL1_DMAS_Values<TIMER3::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct TIMER3
     using MSM = TIMER3_SMCFG_MSM_Values<TIMER3::SMCFG, 7, 1, ReadWriteMode, TIMER3SMCFGBase> ;
     using TRGS = TIMER3_SMCFG_TRGS_Values<TIMER3::SMCFG, 4, 3, ReadWriteMode, TIMER3SMCFGBase> ;
     using SMC = TIMER3_SMCFG_SMC_Values<TIMER3::SMCFG, 0, 3, ReadWriteMode, TIMER3SMCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIMER3_SMCFG_SMC_Values<TIMER3::SMCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct TIMER3
     using CH1IE = TIMER3_DMAINTEN_CH1IE_Values<TIMER3::DMAINTEN, 2, 1, ReadWriteMode, TIMER3DMAINTENBase> ;
     using CH0IE = TIMER3_DMAINTEN_CH0IE_Values<TIMER3::DMAINTEN, 1, 1, ReadWriteMode, TIMER3DMAINTENBase> ;
     using UPIE = TIMER3_DMAINTEN_UPIE_Values<TIMER3::DMAINTEN, 0, 1, ReadWriteMode, TIMER3DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIMER3_DMAINTEN_UPIE_Values<TIMER3::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +106,9 @@ struct TIMER3
     using CH1IF = TIMER3_INTF_CH1IF_Values<TIMER3::INTF, 2, 1, ReadWriteMode, TIMER3INTFBase> ;
     using CH0IF = TIMER3_INTF_CH0IF_Values<TIMER3::INTF, 1, 1, ReadWriteMode, TIMER3INTFBase> ;
     using UPIF = TIMER3_INTF_UPIF_Values<TIMER3::INTF, 0, 1, ReadWriteMode, TIMER3INTFBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER3_INTF_UPIF_Values<TIMER3::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +145,7 @@ struct TIMER3
     using CH0COMSEN = TIMER3_CHCTL0_Output_CH0COMSEN_Values<TIMER3::CHCTL0_Output, 3, 1, ReadWriteMode, TIMER3CHCTL0_OutputBase> ;
     using CH0COMFEN = TIMER3_CHCTL0_Output_CH0COMFEN_Values<TIMER3::CHCTL0_Output, 2, 1, ReadWriteMode, TIMER3CHCTL0_OutputBase> ;
     using CH0MS = TIMER3_CHCTL0_Output_CH0MS_Values<TIMER3::CHCTL0_Output, 0, 2, ReadWriteMode, TIMER3CHCTL0_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CHCTL0_Output_CH0MS_Values<TIMER3::CHCTL0_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +162,7 @@ struct TIMER3
     using CH0CAPFLT = TIMER3_CHCTL0_Input_CH0CAPFLT_Values<TIMER3::CHCTL0_Input, 4, 4, ReadWriteMode, TIMER3CHCTL0_InputBase> ;
     using CH0CAPPSC = TIMER3_CHCTL0_Input_CH0CAPPSC_Values<TIMER3::CHCTL0_Input, 2, 2, ReadWriteMode, TIMER3CHCTL0_InputBase> ;
     using CH0MS = TIMER3_CHCTL0_Input_CH0MS_Values<TIMER3::CHCTL0_Input, 0, 2, ReadWriteMode, TIMER3CHCTL0_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CHCTL0_Input_CH0MS_Values<TIMER3::CHCTL0_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +183,7 @@ struct TIMER3
     using CH2COMSEN = TIMER3_CHCTL1_Output_CH2COMSEN_Values<TIMER3::CHCTL1_Output, 3, 1, ReadWriteMode, TIMER3CHCTL1_OutputBase> ;
     using CH2COMFEN = TIMER3_CHCTL1_Output_CH2COMFEN_Values<TIMER3::CHCTL1_Output, 2, 1, ReadWriteMode, TIMER3CHCTL1_OutputBase> ;
     using CH2MS = TIMER3_CHCTL1_Output_CH2MS_Values<TIMER3::CHCTL1_Output, 0, 2, ReadWriteMode, TIMER3CHCTL1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CHCTL1_Output_CH2MS_Values<TIMER3::CHCTL1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +200,7 @@ struct TIMER3
     using CH2CAPFLT = TIMER3_CHCTL1_Input_CH2CAPFLT_Values<TIMER3::CHCTL1_Input, 4, 4, ReadWriteMode, TIMER3CHCTL1_InputBase> ;
     using CH2CAPPSC = TIMER3_CHCTL1_Input_CH2CAPPSC_Values<TIMER3::CHCTL1_Input, 2, 2, ReadWriteMode, TIMER3CHCTL1_InputBase> ;
     using CH2MS = TIMER3_CHCTL1_Input_CH2MS_Values<TIMER3::CHCTL1_Input, 0, 2, ReadWriteMode, TIMER3CHCTL1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CHCTL1_Input_CH2MS_Values<TIMER3::CHCTL1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +219,7 @@ struct TIMER3
     using CH1EN = TIMER3_CHCTL2_CH1EN_Values<TIMER3::CHCTL2, 4, 1, ReadWriteMode, TIMER3CHCTL2Base> ;
     using CH0P = TIMER3_CHCTL2_CH0P_Values<TIMER3::CHCTL2, 1, 1, ReadWriteMode, TIMER3CHCTL2Base> ;
     using CH0EN = TIMER3_CHCTL2_CH0EN_Values<TIMER3::CHCTL2, 0, 1, ReadWriteMode, TIMER3CHCTL2Base> ;
+    static constexpr Type SnapshotMask = 0x3333U ;
     using FieldValues = TIMER3_CHCTL2_CH0EN_Values<TIMER3::CHCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +231,7 @@ struct TIMER3
   struct CNT : public RegisterBase<0x40000824, 16, ReadWriteMode>
   {
     using CNTField = TIMER3_CNT_CNT_Values<TIMER3::CNT, 0, 16, ReadWriteMode, TIMER3CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER3_CNT_CNT_Values<TIMER3::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +243,7 @@ struct TIMER3
   struct PSC : public RegisterBase<0x40000828, 16, ReadWriteMode>
   {
     using PSCField = TIMER3_PSC_PSC_Values<TIMER3::PSC, 0, 16, ReadWriteMode, TIMER3PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_PSC_PSC_Values<TIMER3::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +255,7 @@ struct TIMER3
   struct CAR : public RegisterBase<0x4000082C, 16, ReadWriteMode>
   {
     using CARL = TIMER3_CAR_CARL_Values<TIMER3::CAR, 0, 16, ReadWriteMode, TIMER3CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CAR_CARL_Values<TIMER3::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +267,7 @@ struct TIMER3
   struct CH0CV : public RegisterBase<0x40000834, 32, ReadWriteMode>
   {
     using CH0VAL = TIMER3_CH0CV_CH0VAL_Values<TIMER3::CH0CV, 0, 16, ReadWriteMode, TIMER3CH0CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CH0CV_CH0VAL_Values<TIMER3::CH0CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +279,7 @@ struct TIMER3
   struct CH1CV : public RegisterBase<0x40000838, 32, ReadWriteMode>
   {
     using CH1VAL = TIMER3_CH1CV_CH1VAL_Values<TIMER3::CH1CV, 0, 16, ReadWriteMode, TIMER3CH1CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CH1CV_CH1VAL_Values<TIMER3::CH1CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +291,7 @@ struct TIMER3
   struct CH2CV : public RegisterBase<0x4000083C, 32, ReadWriteMode>
   {
     using CH2VAL = TIMER3_CH2CV_CH2VAL_Values<TIMER3::CH2CV, 0, 16, ReadWriteMode, TIMER3CH2CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CH2CV_CH2VAL_Values<TIMER3::CH2CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +303,7 @@ struct TIMER3
   struct CH3CV : public RegisterBase<0x40000840, 32, ReadWriteMode>
   {
     using CH3VAL = TIMER3_CH3CV_CH3VAL_Values<TIMER3::CH3CV, 0, 16, ReadWriteMode, TIMER3CH3CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_CH3CV_CH3VAL_Values<TIMER3::CH3CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct TIMER3
   {
     using DMATC = TIMER3_DMACFG_DMATC_Values<TIMER3::DMACFG, 8, 5, ReadWriteMode, TIMER3DMACFGBase> ;
     using DMATA = TIMER3_DMACFG_DMATA_Values<TIMER3::DMACFG, 0, 5, ReadWriteMode, TIMER3DMACFGBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIMER3_DMACFG_DMATA_Values<TIMER3::DMACFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,12 +328,14 @@ struct TIMER3
   struct DMATB : public RegisterBase<0x4000084C, 32, ReadWriteMode>
   {
     using DMATBField = TIMER3_DMATB_DMATB_Values<TIMER3::DMATB, 0, 16, ReadWriteMode, TIMER3DMATBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER3_DMATB_DMATB_Values<TIMER3::DMATB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMATBPack  = Register<0x4000084C, 32, ReadWriteMode, TIMER3DMATBBase, T...> ;
 
+  using Registers = TypesList<TIMER3::CTL0, TIMER3::CTL1, TIMER3::SMCFG, TIMER3::DMAINTEN, TIMER3::INTF, TIMER3::SWEVG, TIMER3::CHCTL0_Output, TIMER3::CHCTL0_Input, TIMER3::CHCTL1_Output, TIMER3::CHCTL1_Input, TIMER3::CHCTL2, TIMER3::CNT, TIMER3::PSC, TIMER3::CAR, TIMER3::CH0CV, TIMER3::CH1CV, TIMER3::CH2CV, TIMER3::CH3CV, TIMER3::DMACFG, TIMER3::DMATB> ;
 } ;
 
 #endif //#if !defined(TIMER3REGISTERS_HPP)
@@ -29,6 +29,8 @@ struct TIMER4
     using UPS = TIMER4_CTL0_UPS_Values<TIMER4::CTL0, 2, 1, ReadWriteMode, TIMER4CTL0Base> ;
     using UPDIS = TIMER4_CTL0_UPDIS_Values<TIMER4::CTL0, 1, 1, ReadWriteMode, TIMER4CTL0Base> ;
     using CEN = TIMER4_CTL0_CEN_Values<TIMER4::CTL0, 0, 1, ReadWriteMode, TIMER4CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER4_CTL0_CEN_Values<TIMER4::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIMER4
     using TI0S = TIMER4_CTL1_TI0S_Values<TIMER4::CTL1, 7, 1, ReadWriteMode, TIMER4CTL1Base> ;
     using MMC = TIMER4_CTL1_MMC_Values<TIMER4::CTL1, 4, 3, ReadWriteMode, TIMER4CTL1Base> ;
     using DMAS = TIMER4_CTL1_DMAS_Values<TIMER4::CTL1, 3, 1, ReadWriteMode, TIMER4CTL1Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIMER4_CTL1_DMAS_Values<TIMER4::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct TIMER4
     using MSM = TIMER4_SMCFG_MSM_Values<TIMER4::SMCFG, 7, 1, ReadWriteMode, TIMER4SMCFGBase> ;
     using TRGS = TIMER4_SMCFG_TRGS_Values<TIMER4::SMCFG, 4, 3, ReadWriteMode, TIMER4SMCFGBase> ;
     using SMC = TIMER4_SMCFG_SMC_Values<TIMER4::SMCFG, 0, 3, ReadWriteMode, TIMER4SMCFGBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIMER4_SMCFG_SMC_Values<TIMER4::SMCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct TIMER4
     using CH1IE = TIMER4_DMAINTEN_CH1IE_Values<TIMER4::DMAINTEN, 2, 1, ReadWriteMode, TIMER4DMAINTENBase> ;
     using CH0IE = TIMER4_DMAINTEN_CH0IE_Values<TIMER4::DMAINTEN, 1, 1, ReadWriteMode, TIMER4DMAINTENBase> ;
     using UPIE = TIMER4_DMAINTEN_UPIE_Values<TIMER4::DMAINTEN, 0, 1, ReadWriteMode, TIMER4DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIMER4_DMAINTEN_UPIE_Values<TIMER4::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +106,9 @@ struct TIMER4
     using CH1IF = TIMER4_INTF_CH1IF_Values<TIMER4::INTF, 2, 1, ReadWriteMode, TIMER4INTFBase> ;
     using CH0IF = TIMER4_INTF_CH0IF_Values<TIMER4::INTF, 1, 1, ReadWriteMode, TIMER4INTFBase> ;
     using UPIF = TIMER4_INTF_UPIF_Values<TIMER4::INTF, 0, 1, ReadWriteMode, TIMER4INTFBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER4_INTF_UPIF_Values<TIMER4::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +145,7 @@ struct TIMER4
     using CH0COMSEN = TIMER4_CHCTL0_Output_CH0COMSEN_Values<TIMER4::CHCTL0_Output, 3, 1, ReadWriteMode, TIMER4CHCTL0_OutputBase> ;
     using CH0COMFEN = TIMER4_CHCTL0_Output_CH0COMFEN_Values<TIMER4::CHCTL0_Output, 2, 1, ReadWriteMode, TIMER4CHCTL0_OutputBase> ;
     using CH0MS = TIMER4_CHCTL0_Output_CH0MS_Values<TIMER4::CHCTL0_Output, 0, 2, ReadWriteMode, TIMER4CHCTL0_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CHCTL0_Output_CH0MS_Values<TIMER4::CHCTL0_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +162,7 @@ struct TIMER4
     using CH0CAPFLT = TIMER4_CHCTL0_Input_CH0CAPFLT_Values<TIMER4::CHCTL0_Input, 4, 4, ReadWriteMode, TIMER4CHCTL0_InputBase> ;
     using CH0CAPPSC = TIMER4_CHCTL0_Input_CH0CAPPSC_Values<TIMER4::CHCTL0_Input, 2, 2, ReadWriteMode, TIMER4CHCTL0_InputBase> ;
     using CH0MS = TIMER4_CHCTL0_Input_CH0MS_Values<TIMER4::CHCTL0_Input, 0, 2, ReadWriteMode, TIMER4CHCTL0_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CHCTL0_Input_CH0MS_Values<TIMER4::CHCTL0_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +183,7 @@ struct TIMER4
     using CH2COMSEN = TIMER4_CHCTL1_Output_CH2COMSEN_Values<TIMER4::CHCTL1_Output, 3, 1, ReadWriteMode, TIMER4CHCTL1_OutputBase> ;
     using CH2COMFEN = TIMER4_CHCTL1_Output_CH2COMFEN_Values<TIMER4::CHCTL1_Output, 2, 1, ReadWriteMode, TIMER4CHCTL1_OutputBase> ;
     using CH2MS = TIMER4_CHCTL1_Output_CH2MS_Values<TIMER4::CHCTL1_Output, 0, 2, ReadWriteMode, TIMER4CHCTL1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CHCTL1_Output_CH2MS_Values<TIMER4::CHCTL1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +200,7 @@ struct TIMER4
     using CH2CAPFLT = TIMER4_CHCTL1_Input_CH2CAPFLT_Values<TIMER4::CHCTL1_Input, 4, 4, ReadWriteMode, TIMER4CHCTL1_InputBase> ;
     using CH2CAPPSC = TIMER4_CHCTL1_Input_CH2CAPPSC_Values<TIMER4::CHCTL1_Input, 2, 2, ReadWriteMode, TIMER4CHCTL1_InputBase> ;
     using CH2MS = TIMER4_CHCTL1_Input_CH2MS_Values<TIMER4::CHCTL1_Input, 0, 2, ReadWriteMode, TIMER4CHCTL1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CHCTL1_Input_CH2MS_Values<TIMER4::CHCTL1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +219,7 @@ struct TIMER4
     using CH1EN = TIMER4_CHCTL2_CH1EN_Values<TIMER4::CHCTL2, 4, 1, ReadWriteMode, TIMER4CHCTL2Base> ;
     using CH0P = TIMER4_CHCTL2_CH0P_Values<TIMER4::CHCTL2, 1, 1, ReadWriteMode, TIMER4CHCTL2Base> ;
     using CH0EN = TIMER4_CHCTL2_CH0EN_Values<TIMER4::CHCTL2, 0, 1, ReadWriteMode, TIMER4CHCTL2Base> ;
+    static constexpr Type SnapshotMask = 0x3333U ;
     using FieldValues = TIMER4_CHCTL2_CH0EN_Values<TIMER4::CHCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +231,7 @@ struct TIMER4
   struct CNT : public RegisterBase<0x40000C24, 16, ReadWriteMode>
   {
     using CNTField = TIMER4_CNT_CNT_Values<TIMER4::CNT, 0, 16, ReadWriteMode, TIMER4CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER4_CNT_CNT_Values<TIMER4::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +243,7 @@ struct TIMER4
   struct PSC : public RegisterBase<0x40000C28, 16, ReadWriteMode>
   {
     using PSCField = TIMER4_PSC_PSC_Values<TIMER4::PSC, 0, 16, ReadWriteMode, TIMER4PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_PSC_PSC_Values<TIMER4::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +255,7 @@ struct TIMER4
   struct CAR : public RegisterBase<0x40000C2C, 16, ReadWriteMode>
   {
     using CARL = TIMER4_CAR_CARL_Values<TIMER4::CAR, 0, 16, ReadWriteMode, TIMER4CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CAR_CARL_Values<TIMER4::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +267,7 @@ struct TIMER4
   struct CH0CV : public RegisterBase<0x40000C34, 32, ReadWriteMode>
   {
     using CH0VAL = TIMER4_CH0CV_CH0VAL_Values<TIMER4::CH0CV, 0, 16, ReadWriteMode, TIMER4CH0CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CH0CV_CH0VAL_Values<TIMER4::CH0CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +279,7 @@ struct TIMER4
   struct CH1CV : public RegisterBase<0x40000C38, 32, ReadWriteMode>
   {
     using CH1VAL = TIMER4_CH1CV_CH1VAL_Values<TIMER4::CH1CV, 0, 16, ReadWriteMode, TIMER4CH1CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CH1CV_CH1VAL_Values<TIMER4::CH1CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +291,7 @@ struct TIMER4
   struct CH2CV : public RegisterBase<0x40000C3C, 32, ReadWriteMode>
   {
     using CH2VAL = TIMER4_CH2CV_CH2VAL_Values<TIMER4::CH2CV, 0, 16, ReadWriteMode, TIMER4CH2CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CH2CV_CH2VAL_Values<TIMER4::CH2CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +303,7 @@ struct TIMER4
   struct CH3CV : public RegisterBase<0x40000C40, 32, ReadWriteMode>
   {
     using CH3VAL = TIMER4_CH3CV_CH3VAL_Values<TIMER4::CH3CV, 0, 16, ReadWriteMode, TIMER4CH3CVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_CH3CV_CH3VAL_Values<TIMER4::CH3CV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct TIMER4
   {
     using DMATC = TIMER4_DMACFG_DMATC_Values<TIMER4::DMACFG, 8, 5, ReadWriteMode, TIMER4DMACFGBase> ;
     using DMATA = TIMER4_DMACFG_DMATA_Values<TIMER4::DMACFG, 0, 5, ReadWriteMode, TIMER4DMACFGBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIMER4_DMACFG_DMATA_Values<TIMER4::DMACFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,12 +328,14 @@ struct TIMER4
   struct DMATB : public RegisterBase<0x40000C4C, 32, ReadWriteMode>
   {
     using DMATBField = TIMER4_DMATB_DMATB_Values<TIMER4::DMATB, 0, 16, ReadWriteMode, TIMER4DMATBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER4_DMATB_DMATB_Values<TIMER4::DMATB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMATBPack  = Register<0x40000C4C, 32, ReadWriteMode, TIMER4DMATBBase, T...> ;
 
+  using Registers = TypesList<TIMER4::CTL0, TIMER4::CTL1, TIMER4::SMCFG, TIMER4::DMAINTEN, TIMER4::INTF, TIMER4::SWEVG, TIMER4::CHCTL0_Output, TIMER4::CHCTL0_Input, TIMER4::CHCTL1_Output, TIMER4::CHCTL1_Input, TIMER4::CHCTL2, TIMER4::CNT, TIMER4::PSC, TIMER4::CAR, TIMER4::CH0CV, TIMER4::CH1CV, TIMER4::CH2CV, TIMER4::CH3CV, TIMER4::DMACFG, TIMER4::DMATB> ;
 } ;
 
 #endif //#if !defined(TIMER4REGISTERS_HPP)
@@ -26,6 +26,8 @@ struct TIMER5
     using UPS = TIMER5_CTL0_UPS_Values<TIMER5::CTL0, 2, 1, ReadWriteMode, TIMER5CTL0Base> ;
     using UPDIS = TIMER5_CTL0_UPDIS_Values<TIMER5::CTL0, 1, 1, ReadWriteMode, TIMER5CTL0Base> ;
     using CEN = TIMER5_CTL0_CEN_Values<TIMER5::CTL0, 0, 1, ReadWriteMode, TIMER5CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER5_CTL0_CEN_Values<TIMER5::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -37,6 +39,7 @@ struct TIMER5
   struct CTL1 : public RegisterBase<0x40001004, 16, ReadWriteMode>
   {
     using MMC = TIMER5_CTL1_MMC_Values<TIMER5::CTL1, 4, 3, ReadWriteMode, TIMER5CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIMER5_CTL1_MMC_Values<TIMER5::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -49,6 +52,7 @@ struct TIMER5
   {
     using UPDEN = TIMER5_DMAINTEN_UPDEN_Values<TIMER5::DMAINTEN, 8, 1, ReadWriteMode, TIMER5DMAINTENBase> ;
     using UPIE = TIMER5_DMAINTEN_UPIE_Values<TIMER5::DMAINTEN, 0, 1, ReadWriteMode, TIMER5DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x101U ;
     using FieldValues = TIMER5_DMAINTEN_UPIE_Values<TIMER5::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +64,9 @@ struct TIMER5
   struct INTF : public RegisterBase<0x40001010, 16, ReadWriteMode>
   {
     using UPIF = TIMER5_INTF_UPIF_Values<TIMER5::INTF, 0, 1, ReadWriteMode, TIMER5INTFBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER5_INTF_UPIF_Values<TIMER5::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +89,7 @@ struct TIMER5
   struct CNT : public RegisterBase<0x40001024, 16, ReadWriteMode>
   {
     using CNTField = TIMER5_CNT_CNT_Values<TIMER5::CNT, 0, 16, ReadWriteMode, TIMER5CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER5_CNT_CNT_Values<TIMER5::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +101,7 @@ struct TIMER5
   struct PSC : public RegisterBase<0x40001028, 16, ReadWriteMode>
   {
     using PSCField = TIMER5_PSC_PSC_Values<TIMER5::PSC, 0, 16, ReadWriteMode, TIMER5PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER5_PSC_PSC_Values<TIMER5::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,12 +113,14 @@ struct TIMER5
   struct CAR : public RegisterBase<0x4000102C, 16, ReadWriteMode>
   {
     using CARL = TIMER5_CAR_CARL_Values<TIMER5::CAR, 0, 16, ReadWriteMode, TIMER5CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER5_CAR_CARL_Values<TIMER5::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CARPack  = Register<0x4000102C, 16, ReadWriteMode, TIMER5CARBase, T...> ;
 
+  using Registers = TypesList<TIMER5::CTL0, TIMER5::CTL1, TIMER5::DMAINTEN, TIMER5::INTF, TIMER5::SWEVG, TIMER5::CNT, TIMER5::PSC, TIMER5::CAR> ;
 } ;
 
 #endif //#if !defined(TIMER5REGISTERS_HPP)
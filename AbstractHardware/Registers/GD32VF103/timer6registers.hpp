@@ -26,6 +26,8 @@ struct TIMER6
     using UPS = TIMER6_CTL0_UPS_Values<TIMER6::CTL0, 2, 1, ReadWriteMode, TIMER6CTL0Base> ;
     using UPDIS = TIMER6_CTL0_UPDIS_Values<TIMER6::CTL0, 1, 1, ReadWriteMode, TIMER6CTL0Base> ;
     using CEN = TIMER6_CTL0_CEN_Values<TIMER6::CTL0, 0, 1, ReadWriteMode, TIMER6CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIMER6_CTL0_CEN_Values<TIMER6::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -37,6 +39,7 @@ struct TIMER6
   struct CTL1 : public RegisterBase<0x40001404, 16, ReadWriteMode>
   {
     using MMC = TIMER6_CTL1_MMC_Values<TIMER6::CTL1, 4, 3, ReadWriteMode, TIMER6CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIMER6_CTL1_MMC_Values<TIMER6::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -49,6 +52,7 @@ struct TIMER6
   {
     using UPDEN = TIMER6_DMAINTEN_UPDEN_Values<TIMER6::DMAINTEN, 8, 1, ReadWriteMode, TIMER6DMAINTENBase> ;
     using UPIE = TIMER6_DMAINTEN_UPIE_Values<TIMER6::DMAINTEN, 0, 1, ReadWriteMode, TIMER6DMAINTENBase> ;
+    static constexpr Type SnapshotMask = 0x101U ;
     using FieldValues = TIMER6_DMAINTEN_UPIE_Values<TIMER6::DMAINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +64,9 @@ struct TIMER6
   struct INTF : public RegisterBase<0x40001410, 16, ReadWriteMode>
   {
     using UPIF = TIMER6_INTF_UPIF_Values<TIMER6::INTF, 0, 1, ReadWriteMode, TIMER6INTFBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER6_INTF_UPIF_Values<TIMER6::INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +89,7 @@ struct TIMER6
   struct CNT : public RegisterBase<0x40001424, 16, ReadWriteMode>
   {
     using CNTField = TIMER6_CNT_CNT_Values<TIMER6::CNT, 0, 16, ReadWriteMode, TIMER6CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIMER6_CNT_CNT_Values<TIMER6::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +101,7 @@ struct TIMER6
   struct PSC : public RegisterBase<0x40001428, 16, ReadWriteMode>
   {
     using PSCField = TIMER6_PSC_PSC_Values<TIMER6::PSC, 0, 16, ReadWriteMode, TIMER6PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER6_PSC_PSC_Values<TIMER6::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,12 +113,14 @@ struct TIMER6
   struct CAR : public RegisterBase<0x4000142C, 16, ReadWriteMode>
   {
     using CARL = TIMER6_CAR_CARL_Values<TIMER6::CAR, 0, 16, ReadWriteMode, TIMER6CARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIMER6_CAR_CARL_Values<TIMER6::CAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CARPack  = Register<0x4000142C, 16, ReadWriteMode, TIMER6CARBase, T...> ;
 
+  using Registers = TypesList<TIMER6::CTL0, TIMER6::CTL1, TIMER6::DMAINTEN, TIMER6::INTF, TIMER6::SWEVG, TIMER6::CNT, TIMER6::PSC, TIMER6::CAR> ;
 } ;
 
 #endif //#if !defined(TIMER6REGISTERS_HPP)
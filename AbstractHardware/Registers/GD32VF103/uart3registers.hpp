@@ -30,6 +30,9 @@ struct UART3
     using NERR = UART3_STAT_NERR_Values<UART3::STAT, 2, 1, ReadMode, UART3STATBase> ;
     using FERR = UART3_STAT_FERR_Values<UART3::STAT, 1, 1, ReadMode, UART3STATBase> ;
     using PERR = UART3_STAT_PERR_Values<UART3::STAT, 0, 1, ReadMode, UART3STATBase> ;
+    static constexpr Type WritableMask = 0x160U ;
+    static constexpr Type ZeroToClearMask = 0x160U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART3_STAT_PERR_Values<UART3::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +44,7 @@ struct UART3
   struct DATA : public RegisterBase<0x40004C04, 32, ReadWriteMode>
   {
     using DATAField = UART3_DATA_DATA_Values<UART3::DATA, 0, 9, ReadWriteMode, UART3DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART3_DATA_DATA_Values<UART3::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +57,7 @@ struct UART3
   {
     using INTDIV = UART3_BAUD_INTDIV_Values<UART3::BAUD, 4, 12, ReadWriteMode, UART3BAUDBase> ;
     using FRADIV = UART3_BAUD_FRADIV_Values<UART3::BAUD, 0, 4, ReadWriteMode, UART3BAUDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART3_BAUD_FRADIV_Values<UART3::BAUD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +82,8 @@ struct UART3
     using REN = UART3_CTL0_REN_Values<UART3::CTL0, 2, 1, ReadWriteMode, UART3CTL0Base> ;
     using RWU = UART3_CTL0_RWU_Values<UART3::CTL0, 1, 1, ReadWriteMode, UART3CTL0Base> ;
     using SBKCMD = UART3_CTL0_SBKCMD_Values<UART3::CTL0, 0, 1, ReadWriteMode, UART3CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = UART3_CTL0_SBKCMD_Values<UART3::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +99,7 @@ struct UART3
     using LBDIE = UART3_CTL1_LBDIE_Values<UART3::CTL1, 6, 1, ReadWriteMode, UART3CTL1Base> ;
     using LBLEN = UART3_CTL1_LBLEN_Values<UART3::CTL1, 5, 1, ReadWriteMode, UART3CTL1Base> ;
     using ADDR = UART3_CTL1_ADDR_Values<UART3::CTL1, 0, 4, ReadWriteMode, UART3CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x706FU ;
     using FieldValues = UART3_CTL1_ADDR_Values<UART3::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +116,7 @@ struct UART3
     using IRLP = UART3_CTL2_IRLP_Values<UART3::CTL2, 2, 1, ReadWriteMode, UART3CTL2Base> ;
     using IREN = UART3_CTL2_IREN_Values<UART3::CTL2, 1, 1, ReadWriteMode, UART3CTL2Base> ;
     using ERRIE = UART3_CTL2_ERRIE_Values<UART3::CTL2, 0, 1, ReadWriteMode, UART3CTL2Base> ;
+    static constexpr Type SnapshotMask = 0xCFU ;
     using FieldValues = UART3_CTL2_ERRIE_Values<UART3::CTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -119,12 +128,14 @@ struct UART3
   struct GP : public RegisterBase<0x40004C18, 32, ReadWriteMode>
   {
     using PSC = UART3_GP_PSC_Values<UART3::GP, 0, 8, ReadWriteMode, UART3GPBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = UART3_GP_PSC_Values<UART3::GP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GPPack  = Register<0x40004C18, 32, ReadWriteMode, UART3GPBase, T...> ;
 
+  using Registers = TypesList<UART3::STAT, UART3::DATA, UART3::BAUD, UART3::CTL0, UART3::CTL1, UART3::CTL2, UART3::GP> ;
 } ;
 
 #endif //#if !defined(UART3REGISTERS_HPP)
@@ -30,6 +30,9 @@ struct UART4
     using NERR = UART4_STAT_NERR_Values<UART4::STAT, 2, 1, ReadMode, UART4STATBase> ;
     using FERR = UART4_STAT_FERR_Values<UART4::STAT, 1, 1, ReadMode, UART4STATBase> ;
     using PERR = UART4_STAT_PERR_Values<UART4::STAT, 0, 1, ReadMode, UART4STATBase> ;
+    static constexpr Type WritableMask = 0x160U ;
+    static constexpr Type ZeroToClearMask = 0x160U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART4_STAT_PERR_Values<UART4::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +44,7 @@ struct UART4
   struct DATA : public RegisterBase<0x40005004, 32, ReadWriteMode>
   {
     using DATAField = UART4_DATA_DATA_Values<UART4::DATA, 0, 9, ReadWriteMode, UART4DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART4_DATA_DATA_Values<UART4::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +57,7 @@ struct UART4
   {
     using INTDIV = UART4_BAUD_INTDIV_Values<UART4::BAUD, 4, 12, ReadWriteMode, UART4BAUDBase> ;
     using FRADIV = UART4_BAUD_FRADIV_Values<UART4::BAUD, 0, 4, ReadWriteMode, UART4BAUDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART4_BAUD_FRADIV_Values<UART4::BAUD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +82,8 @@ struct UART4
     using REN = UART4_CTL0_REN_Values<UART4::CTL0, 2, 1, ReadWriteMode, UART4CTL0Base> ;
     using RWU = UART4_CTL0_RWU_Values<UART4::CTL0, 1, 1, ReadWriteMode, UART4CTL0Base> ;
     using SBKCMD = UART4_CTL0_SBKCMD_Values<UART4::CTL0, 0, 1, ReadWriteMode, UART4CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = UART4_CTL0_SBKCMD_Values<UART4::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +99,7 @@ struct UART4
     using LBDIE = UART4_CTL1_LBDIE_Values<UART4::CTL1, 6, 1, ReadWriteMode, UART4CTL1Base> ;
     using LBLEN = UART4_CTL1_LBLEN_Values<UART4::CTL1, 5, 1, ReadWriteMode, UART4CTL1Base> ;
     using ADDR = UART4_CTL1_ADDR_Values<UART4::CTL1, 0, 4, ReadWriteMode, UART4CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x706FU ;
     using FieldValues = UART4_CTL1_ADDR_Values<UART4::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +116,7 @@ struct UART4
     using IRLP = UART4_CTL2_IRLP_Values<UART4::CTL2, 2, 1, ReadWriteMode, UART4CTL2Base> ;
     using IREN = UART4_CTL2_IREN_Values<UART4::CTL2, 1, 1, ReadWriteMode, UART4CTL2Base> ;
     using ERRIE = UART4_CTL2_ERRIE_Values<UART4::CTL2, 0, 1, ReadWriteMode, UART4CTL2Base> ;
+    static constexpr Type SnapshotMask = 0xCFU ;
     using FieldValues = UART4_CTL2_ERRIE_Values<UART4::CTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -119,12 +128,14 @@ struct UART4
   struct GP : public RegisterBase<0x40005018, 32, ReadWriteMode>
   {
     using PSC = UART4_GP_PSC_Values<UART4::GP, 0, 8, ReadWriteMode, UART4GPBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = UART4_GP_PSC_Values<UART4::GP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GPPack  = Register<0x40005018, 32, ReadWriteMode, UART4GPBase, T...> ;
 
+  using Registers = TypesList<UART4::STAT, UART4::DATA, UART4::BAUD, UART4::CTL0, UART4::CTL1, UART4::CTL2, UART4::GP> ;
 } ;
 
 #endif //#if !defined(UART4REGISTERS_HPP)
@@ -31,6 +31,9 @@ struct USART0
     using NERR = USART0_STAT_NERR_Values<USART0::STAT, 2, 1, ReadMode, USART0STATBase> ;
     using FERR = USART0_STAT_FERR_Values<USART0::STAT, 1, 1, ReadMode, USART0STATBase> ;
     using PERR = USART0_STAT_PERR_Values<USART0::STAT, 0, 1, ReadMode, USART0STATBase> ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART0_STAT_PERR_Values<USART0::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +45,7 @@ struct USART0
   struct DATA : public RegisterBase<0x40013804, 32, ReadWriteMode>
   {
     using DATAField = USART0_DATA_DATA_Values<USART0::DATA, 0, 9, ReadWriteMode, USART0DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART0_DATA_DATA_Values<USART0::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +58,7 @@ struct USART0
   {
     using INTDIV = USART0_BAUD_INTDIV_Values<USART0::BAUD, 4, 12, ReadWriteMode, USART0BAUDBase> ;
     using FRADIV = USART0_BAUD_FRADIV_Values<USART0::BAUD, 0, 4, ReadWriteMode, USART0BAUDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART0_BAUD_FRADIV_Values<USART0::BAUD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct USART0
     using REN = USART0_CTL0_REN_Values<USART0::CTL0, 2, 1, ReadWriteMode, USART0CTL0Base> ;
     using RWU = USART0_CTL0_RWU_Values<USART0::CTL0, 1, 1, ReadWriteMode, USART0CTL0Base> ;
     using SBKCMD = USART0_CTL0_SBKCMD_Values<USART0::CTL0, 0, 1, ReadWriteMode, USART0CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = USART0_CTL0_SBKCMD_Values<USART0::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -97,6 +104,7 @@ struct USART0
     using LBDIE = USART0_CTL1_LBDIE_Values<USART0::CTL1, 6, 1, ReadWriteMode, USART0CTL1Base> ;
     using LBLEN = USART0_CTL1_LBLEN_Values<USART0::CTL1, 5, 1, ReadWriteMode, USART0CTL1Base> ;
     using ADDR = USART0_CTL1_ADDR_Values<USART0::CTL1, 0, 4, ReadWriteMode, USART0CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x7F6FU ;
     using FieldValues = USART0_CTL1_ADDR_Values<USART0::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +126,7 @@ struct USART0
     using IRLP = USART0_CTL2_IRLP_Values<USART0::CTL2, 2, 1, ReadWriteMode, USART0CTL2Base> ;
     using IREN = USART0_CTL2_IREN_Values<USART0::CTL2, 1, 1, ReadWriteMode, USART0CTL2Base> ;
     using ERRIE = USART0_CTL2_ERRIE_Values<USART0::CTL2, 0, 1, ReadWriteMode, USART0CTL2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = USART0_CTL2_ERRIE_Values<USART0::CTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,12 +139,14 @@ struct USART0
   {
     using GUAT = USART0_GP_GUAT_Values<USART0::GP, 8, 8, ReadWriteMode, USART0GPBase> ;
     using PSC = USART0_GP_PSC_Values<USART0::GP, 0, 8, ReadWriteMode, USART0GPBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART0_GP_PSC_Values<USART0::GP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GPPack  = Register<0x40013818, 32, ReadWriteMode, USART0GPBase, T...> ;
 
+  using Registers = TypesList<USART0::STAT, USART0::DATA, USART0::BAUD, USART0::CTL0, USART0::CTL1, USART0::CTL2, USART0::GP> ;
 } ;
 
 #endif //#if !defined(USART0REGISTERS_HPP)
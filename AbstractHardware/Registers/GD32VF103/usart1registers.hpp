@@ -31,6 +31,9 @@ struct USART1
     using NERR = USART1_STAT_NERR_Values<USART1::STAT, 2, 1, ReadMode, USART1STATBase> ;
     using FERR = USART1_STAT_FERR_Values<USART1::STAT, 1, 1, ReadMode, USART1STATBase> ;
     using PERR = USART1_STAT_PERR_Values<USART1::STAT, 0, 1, ReadMode, USART1STATBase> ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART1_STAT_PERR_Values<USART1::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +45,7 @@ struct USART1
   struct DATA : public RegisterBase<0x40004404, 32, ReadWriteMode>
   {
     using DATAField = USART1_DATA_DATA_Values<USART1::DATA, 0, 9, ReadWriteMode, USART1DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART1_DATA_DATA_Values<USART1::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +58,7 @@ struct USART1
   {
     using INTDIV = USART1_BAUD_INTDIV_Values<USART1::BAUD, 4, 12, ReadWriteMode, USART1BAUDBase> ;
     using FRADIV = USART1_BAUD_FRADIV_Values<USART1::BAUD, 0, 4, ReadWriteMode, USART1BAUDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART1_BAUD_FRADIV_Values<USART1::BAUD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct USART1
     using REN = USART1_CTL0_REN_Values<USART1::CTL0, 2, 1, ReadWriteMode, USART1CTL0Base> ;
     using RWU = USART1_CTL0_RWU_Values<USART1::CTL0, 1, 1, ReadWriteMode, USART1CTL0Base> ;
     using SBKCMD = USART1_CTL0_SBKCMD_Values<USART1::CTL0, 0, 1, ReadWriteMode, USART1CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = USART1_CTL0_SBKCMD_Values<USART1::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -97,6 +104,7 @@ struct USART1
     using LBDIE = USART1_CTL1_LBDIE_Values<USART1::CTL1, 6, 1, ReadWriteMode, USART1CTL1Base> ;
     using LBLEN = USART1_CTL1_LBLEN_Values<USART1::CTL1, 5, 1, ReadWriteMode, USART1CTL1Base> ;
     using ADDR = USART1_CTL1_ADDR_Values<USART1::CTL1, 0, 4, ReadWriteMode, USART1CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x7F6FU ;
     using FieldValues = USART1_CTL1_ADDR_Values<USART1::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +126,7 @@ struct USART1
     using IRLP = USART1_CTL2_IRLP_Values<USART1::CTL2, 2, 1, ReadWriteMode, USART1CTL2Base> ;
     using IREN = USART1_CTL2_IREN_Values<USART1::CTL2, 1, 1, ReadWriteMode, USART1CTL2Base> ;
     using ERRIE = USART1_CTL2_ERRIE_Values<USART1::CTL2, 0, 1, ReadWriteMode, USART1CTL2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = USART1_CTL2_ERRIE_Values<USART1::CTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,12 +139,14 @@ struct USART1
   {
     using GUAT = USART1_GP_GUAT_Values<USART1::GP, 8, 8, ReadWriteMode, USART1GPBase> ;
     using PSC = USART1_GP_PSC_Values<USART1::GP, 0, 8, ReadWriteMode, USART1GPBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART1_GP_PSC_Values<USART1::GP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GPPack  = Register<0x40004418, 32, ReadWriteMode, USART1GPBase, T...> ;
 
+  using Registers = TypesList<USART1::STAT, USART1::DATA, USART1::BAUD, USART1::CTL0, USART1::CTL1, USART1::CTL2, USART1::GP> ;
 } ;
 
 #endif //#if !defined(USART1REGISTERS_HPP)
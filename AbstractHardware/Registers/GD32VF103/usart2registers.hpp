@@ -31,6 +31,9 @@ struct USART2
     using NERR = USART2_STAT_NERR_Values<USART2::STAT, 2, 1, ReadMode, USART2STATBase> ;
     using FERR = USART2_STAT_FERR_Values<USART2::STAT, 1, 1, ReadMode, USART2STATBase> ;
     using PERR = USART2_STAT_PERR_Values<USART2::STAT, 0, 1, ReadMode, USART2STATBase> ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART2_STAT_PERR_Values<USART2::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +45,7 @@ struct USART2
   struct DATA : public RegisterBase<0x40004804, 32, ReadWriteMode>
   {
     using DATAField = USART2_DATA_DATA_Values<USART2::DATA, 0, 9, ReadWriteMode, USART2DATABase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART2_DATA_DATA_Values<USART2::DATA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +58,7 @@ struct USART2
   {
     using INTDIV = USART2_BAUD_INTDIV_Values<USART2::BAUD, 4, 12, ReadWriteMode, USART2BAUDBase> ;
     using FRADIV = USART2_BAUD_FRADIV_Values<USART2::BAUD, 0, 4, ReadWriteMode, USART2BAUDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART2_BAUD_FRADIV_Values<USART2::BAUD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct USART2
     using REN = USART2_CTL0_REN_Values<USART2::CTL0, 2, 1, ReadWriteMode, USART2CTL0Base> ;
     using RWU = USART2_CTL0_RWU_Values<USART2::CTL0, 1, 1, ReadWriteMode, USART2CTL0Base> ;
     using SBKCMD = USART2_CTL0_SBKCMD_Values<USART2::CTL0, 0, 1, ReadWriteMode, USART2CTL0Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = USART2_CTL0_SBKCMD_Values<USART2::CTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -97,6 +104,7 @@ struct USART2
     using LBDIE = USART2_CTL1_LBDIE_Values<USART2::CTL1, 6, 1, ReadWriteMode, USART2CTL1Base> ;
     using LBLEN = USART2_CTL1_LBLEN_Values<USART2::CTL1, 5, 1, ReadWriteMode, USART2CTL1Base> ;
     using ADDR = USART2_CTL1_ADDR_Values<USART2::CTL1, 0, 4, ReadWriteMode, USART2CTL1Base> ;
+    static constexpr Type SnapshotMask = 0x7F6FU ;
     using FieldValues = USART2_CTL1_ADDR_Values<USART2::CTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +126,7 @@ struct USART2
     using IRLP = USART2_CTL2_IRLP_Values<USART2::CTL2, 2, 1, ReadWriteMode, USART2CTL2Base> ;
     using IREN = USART2_CTL2_IREN_Values<USART2::CTL2, 1, 1, ReadWriteMode, USART2CTL2Base> ;
     using ERRIE = USART2_CTL2_ERRIE_Values<USART2::CTL2, 0, 1, ReadWriteMode, USART2CTL2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = USART2_CTL2_ERRIE_Values<USART2::CTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,12 +139,14 @@ struct USART2
   {
     using GUAT = USART2_GP_GUAT_Values<USART2::GP, 8, 8, ReadWriteMode, USART2GPBase> ;
     using PSC = USART2_GP_PSC_Values<USART2::GP, 0, 8, ReadWriteMode, USART2GPBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART2_GP_PSC_Values<USART2::GP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GPPack  = Register<0x40004818, 32, ReadWriteMode, USART2GPBase, T...> ;
 
+  using Registers = TypesList<USART2::STAT, USART2::DATA, USART2::BAUD, USART2::CTL0, USART2::CTL1, USART2::CTL2, USART2::GP> ;
 } ;
 
 #endif //#if !defined(USART2REGISTERS_HPP)
@@ -25,6 +25,7 @@ struct USBFS_DEVICE
     using NZLSOH = USBFS_DEVICE_DCFG_NZLSOH_Values<USBFS_DEVICE::DCFG, 2, 1, ReadWriteMode, USBFS_DEVICEDCFGBase> ;
     using DAR = USBFS_DEVICE_DCFG_DAR_Values<USBFS_DEVICE::DCFG, 4, 7, ReadWriteMode, USBFS_DEVICEDCFGBase> ;
     using EOPFT = USBFS_DEVICE_DCFG_EOPFT_Values<USBFS_DEVICE::DCFG, 11, 2, ReadWriteMode, USBFS_DEVICEDCFGBase> ;
+    static constexpr Type SnapshotMask = 0x1FF7U ;
     using FieldValues = USBFS_DEVICE_DCFG_EOPFT_Values<USBFS_DEVICE::DCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct USBFS_DEVICE
     using SGONAK = USBFS_DEVICE_DCTL_SGONAK_Values<USBFS_DEVICE::DCTL, 9, 1, WriteMode, USBFS_DEVICEDCTLBase> ;
     using CGONAK = USBFS_DEVICE_DCTL_CGONAK_Values<USBFS_DEVICE::DCTL, 10, 1, WriteMode, USBFS_DEVICEDCTLBase> ;
     using POIF = USBFS_DEVICE_DCTL_POIF_Values<USBFS_DEVICE::DCTL, 11, 1, ReadWriteMode, USBFS_DEVICEDCTLBase> ;
+    static constexpr Type SnapshotMask = 0xF83U ;
     using FieldValues = USBFS_DEVICE_DCTL_POIF_Values<USBFS_DEVICE::DCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +74,7 @@ struct USBFS_DEVICE
     using CITOEN = USBFS_DEVICE_DIEPINTEN_CITOEN_Values<USBFS_DEVICE::DIEPINTEN, 3, 1, ReadWriteMode, USBFS_DEVICEDIEPINTENBase> ;
     using EPTXFUDEN = USBFS_DEVICE_DIEPINTEN_EPTXFUDEN_Values<USBFS_DEVICE::DIEPINTEN, 4, 1, ReadWriteMode, USBFS_DEVICEDIEPINTENBase> ;
     using IEPNEEN = USBFS_DEVICE_DIEPINTEN_IEPNEEN_Values<USBFS_DEVICE::DIEPINTEN, 6, 1, ReadWriteMode, USBFS_DEVICEDIEPINTENBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DIEPINTEN_IEPNEEN_Values<USBFS_DEVICE::DIEPINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -87,6 +90,7 @@ struct USBFS_DEVICE
     using STPFEN = USBFS_DEVICE_DOEPINTEN_STPFEN_Values<USBFS_DEVICE::DOEPINTEN, 3, 1, ReadWriteMode, USBFS_DEVICEDOEPINTENBase> ;
     using EPRXFOVREN = USBFS_DEVICE_DOEPINTEN_EPRXFOVREN_Values<USBFS_DEVICE::DOEPINTEN, 4, 1, ReadWriteMode, USBFS_DEVICEDOEPINTENBase> ;
     using BTBSTPEN = USBFS_DEVICE_DOEPINTEN_BTBSTPEN_Values<USBFS_DEVICE::DOEPINTEN, 6, 1, ReadWriteMode, USBFS_DEVICEDOEPINTENBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DOEPINTEN_BTBSTPEN_Values<USBFS_DEVICE::DOEPINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct USBFS_DEVICE
   {
     using IEPIE = USBFS_DEVICE_DAEPINTEN_IEPIE_Values<USBFS_DEVICE::DAEPINTEN, 0, 4, ReadWriteMode, USBFS_DEVICEDAEPINTENBase> ;
     using OEPIE = USBFS_DEVICE_DAEPINTEN_OEPIE_Values<USBFS_DEVICE::DAEPINTEN, 16, 4, ReadWriteMode, USBFS_DEVICEDAEPINTENBase> ;
+    static constexpr Type SnapshotMask = 0xF000FU ;
     using FieldValues = USBFS_DEVICE_DAEPINTEN_OEPIE_Values<USBFS_DEVICE::DAEPINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -122,6 +127,7 @@ struct USBFS_DEVICE
   struct DVBUSDT : public RegisterBase<0x50000828, 32, ReadWriteMode>
   {
     using DVBUSDTField = USBFS_DEVICE_DVBUSDT_DVBUSDT_Values<USBFS_DEVICE::DVBUSDT, 0, 16, ReadWriteMode, USBFS_DEVICEDVBUSDTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USBFS_DEVICE_DVBUSDT_DVBUSDT_Values<USBFS_DEVICE::DVBUSDT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +139,7 @@ struct USBFS_DEVICE
   struct DVBUSPT : public RegisterBase<0x5000082C, 32, ReadWriteMode>
   {
     using DVBUSPTField = USBFS_DEVICE_DVBUSPT_DVBUSPT_Values<USBFS_DEVICE::DVBUSPT, 0, 12, ReadWriteMode, USBFS_DEVICEDVBUSPTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = USBFS_DEVICE_DVBUSPT_DVBUSPT_Values<USBFS_DEVICE::DVBUSPT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -144,6 +151,7 @@ struct USBFS_DEVICE
   struct DIEPFEINTEN : public RegisterBase<0x50000834, 32, ReadWriteMode>
   {
     using IEPTXFEIE = USBFS_DEVICE_DIEPFEINTEN_IEPTXFEIE_Values<USBFS_DEVICE::DIEPFEINTEN, 0, 4, ReadWriteMode, USBFS_DEVICEDIEPFEINTENBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = USBFS_DEVICE_DIEPFEINTEN_IEPTXFEIE_Values<USBFS_DEVICE::DIEPFEINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +172,7 @@ struct USBFS_DEVICE
     using SNAK = USBFS_DEVICE_DIEP0CTL_SNAK_Values<USBFS_DEVICE::DIEP0CTL, 27, 1, WriteMode, USBFS_DEVICEDIEP0CTLBase> ;
     using EPD = USBFS_DEVICE_DIEP0CTL_EPD_Values<USBFS_DEVICE::DIEP0CTL, 30, 1, ReadWriteMode, USBFS_DEVICEDIEP0CTLBase> ;
     using EPEN = USBFS_DEVICE_DIEP0CTL_EPEN_Values<USBFS_DEVICE::DIEP0CTL, 31, 1, ReadWriteMode, USBFS_DEVICEDIEP0CTLBase> ;
+    static constexpr Type SnapshotMask = 0xCFE00003U ;
     using FieldValues = USBFS_DEVICE_DIEP0CTL_EPEN_Values<USBFS_DEVICE::DIEP0CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -187,6 +196,7 @@ struct USBFS_DEVICE
     using EOFRM_DPID = USBFS_DEVICE_DIEP1CTL_EOFRM_DPID_Values<USBFS_DEVICE::DIEP1CTL, 16, 1, ReadMode, USBFS_DEVICEDIEP1CTLBase> ;
     using EPACT = USBFS_DEVICE_DIEP1CTL_EPACT_Values<USBFS_DEVICE::DIEP1CTL, 15, 1, ReadWriteMode, USBFS_DEVICEDIEP1CTLBase> ;
     using MPL = USBFS_DEVICE_DIEP1CTL_MPL_Values<USBFS_DEVICE::DIEP1CTL, 0, 11, ReadWriteMode, USBFS_DEVICEDIEP1CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = USBFS_DEVICE_DIEP1CTL_MPL_Values<USBFS_DEVICE::DIEP1CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +220,7 @@ struct USBFS_DEVICE
     using EOFRM_DPID = USBFS_DEVICE_DIEP2CTL_EOFRM_DPID_Values<USBFS_DEVICE::DIEP2CTL, 16, 1, ReadMode, USBFS_DEVICEDIEP2CTLBase> ;
     using EPACT = USBFS_DEVICE_DIEP2CTL_EPACT_Values<USBFS_DEVICE::DIEP2CTL, 15, 1, ReadWriteMode, USBFS_DEVICEDIEP2CTLBase> ;
     using MPL = USBFS_DEVICE_DIEP2CTL_MPL_Values<USBFS_DEVICE::DIEP2CTL, 0, 11, ReadWriteMode, USBFS_DEVICEDIEP2CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = USBFS_DEVICE_DIEP2CTL_MPL_Values<USBFS_DEVICE::DIEP2CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +244,7 @@ struct USBFS_DEVICE
     using EOFRM_DPID = USBFS_DEVICE_DIEP3CTL_EOFRM_DPID_Values<USBFS_DEVICE::DIEP3CTL, 16, 1, ReadMode, USBFS_DEVICEDIEP3CTLBase> ;
     using EPACT = USBFS_DEVICE_DIEP3CTL_EPACT_Values<USBFS_DEVICE::DIEP3CTL, 15, 1, ReadWriteMode, USBFS_DEVICEDIEP3CTLBase> ;
     using MPL = USBFS_DEVICE_DIEP3CTL_MPL_Values<USBFS_DEVICE::DIEP3CTL, 0, 11, ReadWriteMode, USBFS_DEVICEDIEP3CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = USBFS_DEVICE_DIEP3CTL_MPL_Values<USBFS_DEVICE::DIEP3CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -253,6 +265,7 @@ struct USBFS_DEVICE
     using NAKS = USBFS_DEVICE_DOEP0CTL_NAKS_Values<USBFS_DEVICE::DOEP0CTL, 17, 1, ReadMode, USBFS_DEVICEDOEP0CTLBase> ;
     using EPACT = USBFS_DEVICE_DOEP0CTL_EPACT_Values<USBFS_DEVICE::DOEP0CTL, 15, 1, ReadMode, USBFS_DEVICEDOEP0CTLBase> ;
     using MPL = USBFS_DEVICE_DOEP0CTL_MPL_Values<USBFS_DEVICE::DOEP0CTL, 0, 2, ReadMode, USBFS_DEVICEDOEP0CTLBase> ;
+    static constexpr Type SnapshotMask = 0x8C300000U ;
     using FieldValues = USBFS_DEVICE_DOEP0CTL_MPL_Values<USBFS_DEVICE::DOEP0CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -276,6 +289,7 @@ struct USBFS_DEVICE
     using EOFRM_DPID = USBFS_DEVICE_DOEP1CTL_EOFRM_DPID_Values<USBFS_DEVICE::DOEP1CTL, 16, 1, ReadMode, USBFS_DEVICEDOEP1CTLBase> ;
     using EPACT = USBFS_DEVICE_DOEP1CTL_EPACT_Values<USBFS_DEVICE::DOEP1CTL, 15, 1, ReadWriteMode, USBFS_DEVICEDOEP1CTLBase> ;
     using MPL = USBFS_DEVICE_DOEP1CTL_MPL_Values<USBFS_DEVICE::DOEP1CTL, 0, 11, ReadWriteMode, USBFS_DEVICEDOEP1CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFC3C87FFU ;
     using FieldValues = USBFS_DEVICE_DOEP1CTL_MPL_Values<USBFS_DEVICE::DOEP1CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -299,6 +313,7 @@ struct USBFS_DEVICE
     using EOFRM_DPID = USBFS_DEVICE_DOEP2CTL_EOFRM_DPID_Values<USBFS_DEVICE::DOEP2CTL, 16, 1, ReadMode, USBFS_DEVICEDOEP2CTLBase> ;
     using EPACT = USBFS_DEVICE_DOEP2CTL_EPACT_Values<USBFS_DEVICE::DOEP2CTL, 15, 1, ReadWriteMode, USBFS_DEVICEDOEP2CTLBase> ;
     using MPL = USBFS_DEVICE_DOEP2CTL_MPL_Values<USBFS_DEVICE::DOEP2CTL, 0, 11, ReadWriteMode, USBFS_DEVICEDOEP2CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFC3C87FFU ;
     using FieldValues = USBFS_DEVICE_DOEP2CTL_MPL_Values<USBFS_DEVICE::DOEP2CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -322,6 +337,7 @@ struct USBFS_DEVICE
     using EOFRM_DPID = USBFS_DEVICE_DOEP3CTL_EOFRM_DPID_Values<USBFS_DEVICE::DOEP3CTL, 16, 1, ReadMode, USBFS_DEVICEDOEP3CTLBase> ;
     using EPACT = USBFS_DEVICE_DOEP3CTL_EPACT_Values<USBFS_DEVICE::DOEP3CTL, 15, 1, ReadWriteMode, USBFS_DEVICEDOEP3CTLBase> ;
     using MPL = USBFS_DEVICE_DOEP3CTL_MPL_Values<USBFS_DEVICE::DOEP3CTL, 0, 11, ReadWriteMode, USBFS_DEVICEDOEP3CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFC3C87FFU ;
     using FieldValues = USBFS_DEVICE_DOEP3CTL_MPL_Values<USBFS_DEVICE::DOEP3CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -338,6 +354,7 @@ struct USBFS_DEVICE
     using CITO = USBFS_DEVICE_DIEP0INTF_CITO_Values<USBFS_DEVICE::DIEP0INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDIEP0INTFBase> ;
     using EPDIS = USBFS_DEVICE_DIEP0INTF_EPDIS_Values<USBFS_DEVICE::DIEP0INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDIEP0INTFBase> ;
     using TF = USBFS_DEVICE_DIEP0INTF_TF_Values<USBFS_DEVICE::DIEP0INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDIEP0INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DIEP0INTF_TF_Values<USBFS_DEVICE::DIEP0INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -354,6 +371,7 @@ struct USBFS_DEVICE
     using CITO = USBFS_DEVICE_DIEP1INTF_CITO_Values<USBFS_DEVICE::DIEP1INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDIEP1INTFBase> ;
     using EPDIS = USBFS_DEVICE_DIEP1INTF_EPDIS_Values<USBFS_DEVICE::DIEP1INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDIEP1INTFBase> ;
     using TF = USBFS_DEVICE_DIEP1INTF_TF_Values<USBFS_DEVICE::DIEP1INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDIEP1INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DIEP1INTF_TF_Values<USBFS_DEVICE::DIEP1INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -370,6 +388,7 @@ struct USBFS_DEVICE
     using CITO = USBFS_DEVICE_DIEP2INTF_CITO_Values<USBFS_DEVICE::DIEP2INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDIEP2INTFBase> ;
     using EPDIS = USBFS_DEVICE_DIEP2INTF_EPDIS_Values<USBFS_DEVICE::DIEP2INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDIEP2INTFBase> ;
     using TF = USBFS_DEVICE_DIEP2INTF_TF_Values<USBFS_DEVICE::DIEP2INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDIEP2INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DIEP2INTF_TF_Values<USBFS_DEVICE::DIEP2INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -386,6 +405,7 @@ struct USBFS_DEVICE
     using CITO = USBFS_DEVICE_DIEP3INTF_CITO_Values<USBFS_DEVICE::DIEP3INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDIEP3INTFBase> ;
     using EPDIS = USBFS_DEVICE_DIEP3INTF_EPDIS_Values<USBFS_DEVICE::DIEP3INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDIEP3INTFBase> ;
     using TF = USBFS_DEVICE_DIEP3INTF_TF_Values<USBFS_DEVICE::DIEP3INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDIEP3INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DIEP3INTF_TF_Values<USBFS_DEVICE::DIEP3INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -401,6 +421,7 @@ struct USBFS_DEVICE
     using STPF = USBFS_DEVICE_DOEP0INTF_STPF_Values<USBFS_DEVICE::DOEP0INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDOEP0INTFBase> ;
     using EPDIS = USBFS_DEVICE_DOEP0INTF_EPDIS_Values<USBFS_DEVICE::DOEP0INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDOEP0INTFBase> ;
     using TF = USBFS_DEVICE_DOEP0INTF_TF_Values<USBFS_DEVICE::DOEP0INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDOEP0INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DOEP0INTF_TF_Values<USBFS_DEVICE::DOEP0INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +437,7 @@ struct USBFS_DEVICE
     using STPF = USBFS_DEVICE_DOEP1INTF_STPF_Values<USBFS_DEVICE::DOEP1INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDOEP1INTFBase> ;
     using EPDIS = USBFS_DEVICE_DOEP1INTF_EPDIS_Values<USBFS_DEVICE::DOEP1INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDOEP1INTFBase> ;
     using TF = USBFS_DEVICE_DOEP1INTF_TF_Values<USBFS_DEVICE::DOEP1INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDOEP1INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DOEP1INTF_TF_Values<USBFS_DEVICE::DOEP1INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -431,6 +453,7 @@ struct USBFS_DEVICE
     using STPF = USBFS_DEVICE_DOEP2INTF_STPF_Values<USBFS_DEVICE::DOEP2INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDOEP2INTFBase> ;
     using EPDIS = USBFS_DEVICE_DOEP2INTF_EPDIS_Values<USBFS_DEVICE::DOEP2INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDOEP2INTFBase> ;
     using TF = USBFS_DEVICE_DOEP2INTF_TF_Values<USBFS_DEVICE::DOEP2INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDOEP2INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DOEP2INTF_TF_Values<USBFS_DEVICE::DOEP2INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -446,6 +469,7 @@ struct USBFS_DEVICE
     using STPF = USBFS_DEVICE_DOEP3INTF_STPF_Values<USBFS_DEVICE::DOEP3INTF, 3, 1, ReadWriteMode, USBFS_DEVICEDOEP3INTFBase> ;
     using EPDIS = USBFS_DEVICE_DOEP3INTF_EPDIS_Values<USBFS_DEVICE::DOEP3INTF, 1, 1, ReadWriteMode, USBFS_DEVICEDOEP3INTFBase> ;
     using TF = USBFS_DEVICE_DOEP3INTF_TF_Values<USBFS_DEVICE::DOEP3INTF, 0, 1, ReadWriteMode, USBFS_DEVICEDOEP3INTFBase> ;
+    static constexpr Type SnapshotMask = 0x5BU ;
     using FieldValues = USBFS_DEVICE_DOEP3INTF_TF_Values<USBFS_DEVICE::DOEP3INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -458,6 +482,7 @@ struct USBFS_DEVICE
   {
     using PCNT = USBFS_DEVICE_DIEP0LEN_PCNT_Values<USBFS_DEVICE::DIEP0LEN, 19, 2, ReadWriteMode, USBFS_DEVICEDIEP0LENBase> ;
     using TLEN = USBFS_DEVICE_DIEP0LEN_TLEN_Values<USBFS_DEVICE::DIEP0LEN, 0, 7, ReadWriteMode, USBFS_DEVICEDIEP0LENBase> ;
+    static constexpr Type SnapshotMask = 0x18007FU ;
     using FieldValues = USBFS_DEVICE_DIEP0LEN_TLEN_Values<USBFS_DEVICE::DIEP0LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -471,6 +496,7 @@ struct USBFS_DEVICE
     using STPCNT = USBFS_DEVICE_DOEP0LEN_STPCNT_Values<USBFS_DEVICE::DOEP0LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDOEP0LENBase> ;
     using PCNT = USBFS_DEVICE_DOEP0LEN_PCNT_Values<USBFS_DEVICE::DOEP0LEN, 19, 1, ReadWriteMode, USBFS_DEVICEDOEP0LENBase> ;
     using TLEN = USBFS_DEVICE_DOEP0LEN_TLEN_Values<USBFS_DEVICE::DOEP0LEN, 0, 7, ReadWriteMode, USBFS_DEVICEDOEP0LENBase> ;
+    static constexpr Type SnapshotMask = 0x6008007FU ;
     using FieldValues = USBFS_DEVICE_DOEP0LEN_TLEN_Values<USBFS_DEVICE::DOEP0LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -484,6 +510,7 @@ struct USBFS_DEVICE
     using MCPF = USBFS_DEVICE_DIEP1LEN_MCPF_Values<USBFS_DEVICE::DIEP1LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDIEP1LENBase> ;
     using PCNT = USBFS_DEVICE_DIEP1LEN_PCNT_Values<USBFS_DEVICE::DIEP1LEN, 19, 10, ReadWriteMode, USBFS_DEVICEDIEP1LENBase> ;
     using TLEN = USBFS_DEVICE_DIEP1LEN_TLEN_Values<USBFS_DEVICE::DIEP1LEN, 0, 19, ReadWriteMode, USBFS_DEVICEDIEP1LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_DEVICE_DIEP1LEN_TLEN_Values<USBFS_DEVICE::DIEP1LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -497,6 +524,7 @@ struct USBFS_DEVICE
     using MCPF = USBFS_DEVICE_DIEP2LEN_MCPF_Values<USBFS_DEVICE::DIEP2LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDIEP2LENBase> ;
     using PCNT = USBFS_DEVICE_DIEP2LEN_PCNT_Values<USBFS_DEVICE::DIEP2LEN, 19, 10, ReadWriteMode, USBFS_DEVICEDIEP2LENBase> ;
     using TLEN = USBFS_DEVICE_DIEP2LEN_TLEN_Values<USBFS_DEVICE::DIEP2LEN, 0, 19, ReadWriteMode, USBFS_DEVICEDIEP2LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_DEVICE_DIEP2LEN_TLEN_Values<USBFS_DEVICE::DIEP2LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -510,6 +538,7 @@ struct USBFS_DEVICE
     using MCPF = USBFS_DEVICE_DIEP3LEN_MCPF_Values<USBFS_DEVICE::DIEP3LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDIEP3LENBase> ;
     using PCNT = USBFS_DEVICE_DIEP3LEN_PCNT_Values<USBFS_DEVICE::DIEP3LEN, 19, 10, ReadWriteMode, USBFS_DEVICEDIEP3LENBase> ;
     using TLEN = USBFS_DEVICE_DIEP3LEN_TLEN_Values<USBFS_DEVICE::DIEP3LEN, 0, 19, ReadWriteMode, USBFS_DEVICEDIEP3LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_DEVICE_DIEP3LEN_TLEN_Values<USBFS_DEVICE::DIEP3LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -523,6 +552,7 @@ struct USBFS_DEVICE
     using STPCNT_RXDPID = USBFS_DEVICE_DOEP1LEN_STPCNT_RXDPID_Values<USBFS_DEVICE::DOEP1LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDOEP1LENBase> ;
     using PCNT = USBFS_DEVICE_DOEP1LEN_PCNT_Values<USBFS_DEVICE::DOEP1LEN, 19, 10, ReadWriteMode, USBFS_DEVICEDOEP1LENBase> ;
     using TLEN = USBFS_DEVICE_DOEP1LEN_TLEN_Values<USBFS_DEVICE::DOEP1LEN, 0, 19, ReadWriteMode, USBFS_DEVICEDOEP1LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_DEVICE_DOEP1LEN_TLEN_Values<USBFS_DEVICE::DOEP1LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -536,6 +566,7 @@ struct USBFS_DEVICE
     using STPCNT_RXDPID = USBFS_DEVICE_DOEP2LEN_STPCNT_RXDPID_Values<USBFS_DEVICE::DOEP2LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDOEP2LENBase> ;
     using PCNT = USBFS_DEVICE_DOEP2LEN_PCNT_Values<USBFS_DEVICE::DOEP2LEN, 19, 10, ReadWriteMode, USBFS_DEVICEDOEP2LENBase> ;
     using TLEN = USBFS_DEVICE_DOEP2LEN_TLEN_Values<USBFS_DEVICE::DOEP2LEN, 0, 19, ReadWriteMode, USBFS_DEVICEDOEP2LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_DEVICE_DOEP2LEN_TLEN_Values<USBFS_DEVICE::DOEP2LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -549,6 +580,7 @@ struct USBFS_DEVICE
     using STPCNT_RXDPID = USBFS_DEVICE_DOEP3LEN_STPCNT_RXDPID_Values<USBFS_DEVICE::DOEP3LEN, 29, 2, ReadWriteMode, USBFS_DEVICEDOEP3LENBase> ;
     using PCNT = USBFS_DEVICE_DOEP3LEN_PCNT_Values<USBFS_DEVICE::DOEP3LEN, 19, 10, ReadWriteMode, USBFS_DEVICEDOEP3LENBase> ;
     using TLEN = USBFS_DEVICE_DOEP3LEN_TLEN_Values<USBFS_DEVICE::DOEP3LEN, 0, 19, ReadWriteMode, USBFS_DEVICEDOEP3LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_DEVICE_DOEP3LEN_TLEN_Values<USBFS_DEVICE::DOEP3LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -599,6 +631,7 @@ struct USBFS_DEVICE
   template<typename... T> 
   using DIEP3TFSTATPack  = Register<0x50000978, 32, ReadMode, USBFS_DEVICEDIEP3TFSTATBase, T...> ;
 
+  using Registers = TypesList<USBFS_DEVICE::DCFG, USBFS_DEVICE::DCTL, USBFS_DEVICE::DSTAT, USBFS_DEVICE::DIEPINTEN, USBFS_DEVICE::DOEPINTEN, USBFS_DEVICE::DAEPINT, USBFS_DEVICE::DAEPINTEN, USBFS_DEVICE::DVBUSDT, USBFS_DEVICE::DVBUSPT, USBFS_DEVICE::DIEPFEINTEN, USBFS_DEVICE::DIEP0CTL, USBFS_DEVICE::DIEP1CTL, USBFS_DEVICE::DIEP2CTL, USBFS_DEVICE::DIEP3CTL, USBFS_DEVICE::DOEP0CTL, USBFS_DEVICE::DOEP1CTL, USBFS_DEVICE::DOEP2CTL, USBFS_DEVICE::DOEP3CTL, USBFS_DEVICE::DIEP0INTF, USBFS_DEVICE::DIEP1INTF, USBFS_DEVICE::DIEP2INTF, USBFS_DEVICE::DIEP3INTF, USBFS_DEVICE::DOEP0INTF, USBFS_DEVICE::DOEP1INTF, USBFS_DEVICE::DOEP2INTF, USBFS_DEVICE::DOEP3INTF, USBFS_DEVICE::DIEP0LEN, USBFS_DEVICE::DOEP0LEN, USBFS_DEVICE::DIEP1LEN, USBFS_DEVICE::DIEP2LEN, USBFS_DEVICE::DIEP3LEN, USBFS_DEVICE::DOEP1LEN, USBFS_DEVICE::DOEP2LEN, USBFS_DEVICE::DOEP3LEN, USBFS_DEVICE::DIEP0TFSTAT, USBFS_DEVICE::DIEP1TFSTAT, USBFS_DEVICE::DIEP2TFSTAT, USBFS_DEVICE::DIEP3TFSTAT> ;
 } ;
 
 #endif //#if !defined(USBFSDEVICEREGISTERS_HPP)
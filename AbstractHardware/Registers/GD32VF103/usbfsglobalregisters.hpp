@@ -31,6 +31,7 @@ struct USBFS_GLOBAL
     using DI = USBFS_GLOBAL_GOTGCS_DI_Values<USBFS_GLOBAL::GOTGCS, 17, 1, ReadMode, USBFS_GLOBALGOTGCSBase> ;
     using ASV = USBFS_GLOBAL_GOTGCS_ASV_Values<USBFS_GLOBAL::GOTGCS, 18, 1, ReadMode, USBFS_GLOBALGOTGCSBase> ;
     using BSV = USBFS_GLOBAL_GOTGCS_BSV_Values<USBFS_GLOBAL::GOTGCS, 19, 1, ReadMode, USBFS_GLOBALGOTGCSBase> ;
+    static constexpr Type SnapshotMask = 0xE02U ;
     using FieldValues = USBFS_GLOBAL_GOTGCS_BSV_Values<USBFS_GLOBAL::GOTGCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +48,7 @@ struct USBFS_GLOBAL
     using HNPDET = USBFS_GLOBAL_GOTGINTF_HNPDET_Values<USBFS_GLOBAL::GOTGINTF, 17, 1, ReadWriteMode, USBFS_GLOBALGOTGINTFBase> ;
     using ADTO = USBFS_GLOBAL_GOTGINTF_ADTO_Values<USBFS_GLOBAL::GOTGINTF, 18, 1, ReadWriteMode, USBFS_GLOBALGOTGINTFBase> ;
     using DF = USBFS_GLOBAL_GOTGINTF_DF_Values<USBFS_GLOBAL::GOTGINTF, 19, 1, ReadWriteMode, USBFS_GLOBALGOTGINTFBase> ;
+    static constexpr Type SnapshotMask = 0xE0304U ;
     using FieldValues = USBFS_GLOBAL_GOTGINTF_DF_Values<USBFS_GLOBAL::GOTGINTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +62,7 @@ struct USBFS_GLOBAL
     using GINTEN = USBFS_GLOBAL_GAHBCS_GINTEN_Values<USBFS_GLOBAL::GAHBCS, 0, 1, ReadWriteMode, USBFS_GLOBALGAHBCSBase> ;
     using TXFTH = USBFS_GLOBAL_GAHBCS_TXFTH_Values<USBFS_GLOBAL::GAHBCS, 7, 1, ReadWriteMode, USBFS_GLOBALGAHBCSBase> ;
     using PTXFTH = USBFS_GLOBAL_GAHBCS_PTXFTH_Values<USBFS_GLOBAL::GAHBCS, 8, 1, ReadWriteMode, USBFS_GLOBALGAHBCSBase> ;
+    static constexpr Type SnapshotMask = 0x181U ;
     using FieldValues = USBFS_GLOBAL_GAHBCS_PTXFTH_Values<USBFS_GLOBAL::GAHBCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +79,7 @@ struct USBFS_GLOBAL
     using UTT = USBFS_GLOBAL_GUSBCS_UTT_Values<USBFS_GLOBAL::GUSBCS, 10, 4, ReadWriteMode, USBFS_GLOBALGUSBCSBase> ;
     using FHM = USBFS_GLOBAL_GUSBCS_FHM_Values<USBFS_GLOBAL::GUSBCS, 29, 1, ReadWriteMode, USBFS_GLOBALGUSBCSBase> ;
     using FDM = USBFS_GLOBAL_GUSBCS_FDM_Values<USBFS_GLOBAL::GUSBCS, 30, 1, ReadWriteMode, USBFS_GLOBALGUSBCSBase> ;
+    static constexpr Type SnapshotMask = 0x60003F07U ;
     using FieldValues = USBFS_GLOBAL_GUSBCS_FDM_Values<USBFS_GLOBAL::GUSBCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +96,7 @@ struct USBFS_GLOBAL
     using RXFF = USBFS_GLOBAL_GRSTCTL_RXFF_Values<USBFS_GLOBAL::GRSTCTL, 4, 1, ReadWriteMode, USBFS_GLOBALGRSTCTLBase> ;
     using TXFF = USBFS_GLOBAL_GRSTCTL_TXFF_Values<USBFS_GLOBAL::GRSTCTL, 5, 1, ReadWriteMode, USBFS_GLOBALGRSTCTLBase> ;
     using TXFNUM = USBFS_GLOBAL_GRSTCTL_TXFNUM_Values<USBFS_GLOBAL::GRSTCTL, 6, 5, ReadWriteMode, USBFS_GLOBALGRSTCTLBase> ;
+    static constexpr Type SnapshotMask = 0x7F7U ;
     using FieldValues = USBFS_GLOBAL_GRSTCTL_TXFNUM_Values<USBFS_GLOBAL::GRSTCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +132,7 @@ struct USBFS_GLOBAL
     using DISCIF = USBFS_GLOBAL_GINTF_DISCIF_Values<USBFS_GLOBAL::GINTF, 29, 1, ReadWriteMode, USBFS_GLOBALGINTFBase> ;
     using SESIF = USBFS_GLOBAL_GINTF_SESIF_Values<USBFS_GLOBAL::GINTF, 30, 1, ReadWriteMode, USBFS_GLOBALGINTFBase> ;
     using WKUPIF = USBFS_GLOBAL_GINTF_WKUPIF_Values<USBFS_GLOBAL::GINTF, 31, 1, ReadWriteMode, USBFS_GLOBALGINTFBase> ;
+    static constexpr Type SnapshotMask = 0xF030FC0AU ;
     using FieldValues = USBFS_GLOBAL_GINTF_WKUPIF_Values<USBFS_GLOBAL::GINTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +167,7 @@ struct USBFS_GLOBAL
     using DISCIE = USBFS_GLOBAL_GINTEN_DISCIE_Values<USBFS_GLOBAL::GINTEN, 29, 1, ReadWriteMode, USBFS_GLOBALGINTENBase> ;
     using SESIE = USBFS_GLOBAL_GINTEN_SESIE_Values<USBFS_GLOBAL::GINTEN, 30, 1, ReadWriteMode, USBFS_GLOBALGINTENBase> ;
     using WKUPIE = USBFS_GLOBAL_GINTEN_WKUPIE_Values<USBFS_GLOBAL::GINTEN, 31, 1, ReadWriteMode, USBFS_GLOBALGINTENBase> ;
+    static constexpr Type SnapshotMask = 0xF63CFCFEU ;
     using FieldValues = USBFS_GLOBAL_GINTEN_WKUPIE_Values<USBFS_GLOBAL::GINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -228,6 +235,7 @@ struct USBFS_GLOBAL
   struct GRFLEN : public RegisterBase<0x50000024, 32, ReadWriteMode>
   {
     using RXFD = USBFS_GLOBAL_GRFLEN_RXFD_Values<USBFS_GLOBAL::GRFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALGRFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USBFS_GLOBAL_GRFLEN_RXFD_Values<USBFS_GLOBAL::GRFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +248,7 @@ struct USBFS_GLOBAL
   {
     using HNPTXRSAR = USBFS_GLOBAL_HNPTFLEN_HNPTXRSAR_Values<USBFS_GLOBAL::HNPTFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALHNPTFLENBase> ;
     using HNPTXFD = USBFS_GLOBAL_HNPTFLEN_HNPTXFD_Values<USBFS_GLOBAL::HNPTFLEN, 16, 16, ReadWriteMode, USBFS_GLOBALHNPTFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_HNPTFLEN_HNPTXFD_Values<USBFS_GLOBAL::HNPTFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +261,7 @@ struct USBFS_GLOBAL
   {
     using IEP0TXFD = USBFS_GLOBAL_DIEP0TFLEN_IEP0TXFD_Values<USBFS_GLOBAL::DIEP0TFLEN, 16, 16, ReadWriteMode, USBFS_GLOBALDIEP0TFLENBase> ;
     using IEP0TXRSAR = USBFS_GLOBAL_DIEP0TFLEN_IEP0TXRSAR_Values<USBFS_GLOBAL::DIEP0TFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALDIEP0TFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_DIEP0TFLEN_IEP0TXRSAR_Values<USBFS_GLOBAL::DIEP0TFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -280,6 +290,7 @@ struct USBFS_GLOBAL
     using VBUSBCEN = USBFS_GLOBAL_GCCFG_VBUSBCEN_Values<USBFS_GLOBAL::GCCFG, 19, 1, ReadWriteMode, USBFS_GLOBALGCCFGBase> ;
     using SOFOEN = USBFS_GLOBAL_GCCFG_SOFOEN_Values<USBFS_GLOBAL::GCCFG, 20, 1, ReadWriteMode, USBFS_GLOBALGCCFGBase> ;
     using VBUSIG = USBFS_GLOBAL_GCCFG_VBUSIG_Values<USBFS_GLOBAL::GCCFG, 21, 1, ReadWriteMode, USBFS_GLOBALGCCFGBase> ;
+    static constexpr Type SnapshotMask = 0x3D0000U ;
     using FieldValues = USBFS_GLOBAL_GCCFG_VBUSIG_Values<USBFS_GLOBAL::GCCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -291,6 +302,7 @@ struct USBFS_GLOBAL
   struct CID : public RegisterBase<0x5000003C, 32, ReadWriteMode>
   {
     using CIDField = USBFS_GLOBAL_CID_CID_Values<USBFS_GLOBAL::CID, 0, 32, ReadWriteMode, USBFS_GLOBALCIDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_CID_CID_Values<USBFS_GLOBAL::CID, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -303,6 +315,7 @@ struct USBFS_GLOBAL
   {
     using HPTXFSAR = USBFS_GLOBAL_HPTFLEN_HPTXFSAR_Values<USBFS_GLOBAL::HPTFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALHPTFLENBase> ;
     using HPTXFD = USBFS_GLOBAL_HPTFLEN_HPTXFD_Values<USBFS_GLOBAL::HPTFLEN, 16, 16, ReadWriteMode, USBFS_GLOBALHPTFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_HPTFLEN_HPTXFD_Values<USBFS_GLOBAL::HPTFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -315,6 +328,7 @@ struct USBFS_GLOBAL
   {
     using IEPTXRSAR = USBFS_GLOBAL_DIEP1TFLEN_IEPTXRSAR_Values<USBFS_GLOBAL::DIEP1TFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALDIEP1TFLENBase> ;
     using IEPTXFD = USBFS_GLOBAL_DIEP1TFLEN_IEPTXFD_Values<USBFS_GLOBAL::DIEP1TFLEN, 16, 16, ReadWriteMode, USBFS_GLOBALDIEP1TFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_DIEP1TFLEN_IEPTXFD_Values<USBFS_GLOBAL::DIEP1TFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -327,6 +341,7 @@ struct USBFS_GLOBAL
   {
     using IEPTXRSAR = USBFS_GLOBAL_DIEP2TFLEN_IEPTXRSAR_Values<USBFS_GLOBAL::DIEP2TFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALDIEP2TFLENBase> ;
     using IEPTXFD = USBFS_GLOBAL_DIEP2TFLEN_IEPTXFD_Values<USBFS_GLOBAL::DIEP2TFLEN, 16, 16, ReadWriteMode, USBFS_GLOBALDIEP2TFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_DIEP2TFLEN_IEPTXFD_Values<USBFS_GLOBAL::DIEP2TFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -339,12 +354,14 @@ struct USBFS_GLOBAL
   {
     using IEPTXRSAR = USBFS_GLOBAL_DIEP3TFLEN_IEPTXRSAR_Values<USBFS_GLOBAL::DIEP3TFLEN, 0, 16, ReadWriteMode, USBFS_GLOBALDIEP3TFLENBase> ;
     using IEPTXFD = USBFS_GLOBAL_DIEP3TFLEN_IEPTXFD_Values<USBFS_GLOBAL::DIEP3TFLEN, 16, 16, ReadWriteMode, USBFS_GLOBALDIEP3TFLENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USBFS_GLOBAL_DIEP3TFLEN_IEPTXFD_Values<USBFS_GLOBAL::DIEP3TFLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DIEP3TFLENPack  = Register<0x5000010C, 32, ReadWriteMode, USBFS_GLOBALDIEP3TFLENBase, T...> ;
 
+  using Registers = TypesList<USBFS_GLOBAL::GOTGCS, USBFS_GLOBAL::GOTGINTF, USBFS_GLOBAL::GAHBCS, USBFS_GLOBAL::GUSBCS, USBFS_GLOBAL::GRSTCTL, USBFS_GLOBAL::GINTF, USBFS_GLOBAL::GINTEN, USBFS_GLOBAL::GRSTATR_Device, USBFS_GLOBAL::GRSTATR_Host, USBFS_GLOBAL::GRSTATP_Device, USBFS_GLOBAL::GRSTATP_Host, USBFS_GLOBAL::GRFLEN, USBFS_GLOBAL::HNPTFLEN, USBFS_GLOBAL::DIEP0TFLEN, USBFS_GLOBAL::HNPTFQSTAT, USBFS_GLOBAL::GCCFG, USBFS_GLOBAL::CID, USBFS_GLOBAL::HPTFLEN, USBFS_GLOBAL::DIEP1TFLEN, USBFS_GLOBAL::DIEP2TFLEN, USBFS_GLOBAL::DIEP3TFLEN> ;
 } ;
 
 #endif //#if !defined(USBFSGLOBALREGISTERS_HPP)
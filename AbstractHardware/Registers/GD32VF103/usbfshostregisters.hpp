@@ -22,6 +22,7 @@ struct USBFS_HOST
   struct HCTL : public RegisterBase<0x50000400, 32, ReadWriteMode>
   {
     using CLKSEL = USBFS_HOST_HCTL_CLKSEL_Values<USBFS_HOST::HCTL, 0, 2, ReadWriteMode, USBFS_HOSTHCTLBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = USBFS_HOST_HCTL_CLKSEL_Values<USBFS_HOST::HCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct USBFS_HOST
   struct HFT : public RegisterBase<0x50000404, 32, ReadWriteMode>
   {
     using FRI = USBFS_HOST_HFT_FRI_Values<USBFS_HOST::HFT, 0, 16, ReadWriteMode, USBFS_HOSTHFTBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USBFS_HOST_HFT_FRI_Values<USBFS_HOST::HFT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +60,7 @@ struct USBFS_HOST
     using PTXFS = USBFS_HOST_HPTFQSTAT_PTXFS_Values<USBFS_HOST::HPTFQSTAT, 0, 16, ReadMode, USBFS_HOSTHPTFQSTATBase> ;
     using PTXREQS = USBFS_HOST_HPTFQSTAT_PTXREQS_Values<USBFS_HOST::HPTFQSTAT, 16, 8, ReadMode, USBFS_HOSTHPTFQSTATBase> ;
     using PTXREQT = USBFS_HOST_HPTFQSTAT_PTXREQT_Values<USBFS_HOST::HPTFQSTAT, 24, 8, ReadMode, USBFS_HOSTHPTFQSTATBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USBFS_HOST_HPTFQSTAT_PTXREQT_Values<USBFS_HOST::HPTFQSTAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +83,7 @@ struct USBFS_HOST
   struct HACHINTEN : public RegisterBase<0x50000418, 32, ReadWriteMode>
   {
     using CINTEN = USBFS_HOST_HACHINTEN_CINTEN_Values<USBFS_HOST::HACHINTEN, 0, 8, ReadWriteMode, USBFS_HOSTHACHINTENBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = USBFS_HOST_HACHINTEN_CINTEN_Values<USBFS_HOST::HACHINTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +104,7 @@ struct USBFS_HOST
     using PLST = USBFS_HOST_HPCS_PLST_Values<USBFS_HOST::HPCS, 10, 2, ReadMode, USBFS_HOSTHPCSBase> ;
     using PP = USBFS_HOST_HPCS_PP_Values<USBFS_HOST::HPCS, 12, 1, ReadWriteMode, USBFS_HOSTHPCSBase> ;
     using PS = USBFS_HOST_HPCS_PS_Values<USBFS_HOST::HPCS, 17, 2, ReadMode, USBFS_HOSTHPCSBase> ;
+    static constexpr Type SnapshotMask = 0x11CEU ;
     using FieldValues = USBFS_HOST_HPCS_PS_Values<USBFS_HOST::HPCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -119,6 +124,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH0CTL_ODDFRM_Values<USBFS_HOST::HCH0CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH0CTLBase> ;
     using CDIS = USBFS_HOST_HCH0CTL_CDIS_Values<USBFS_HOST::HCH0CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH0CTLBase> ;
     using CEN = USBFS_HOST_HCH0CTL_CEN_Values<USBFS_HOST::HCH0CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH0CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH0CTL_CEN_Values<USBFS_HOST::HCH0CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -138,6 +144,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH1CTL_ODDFRM_Values<USBFS_HOST::HCH1CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH1CTLBase> ;
     using CDIS = USBFS_HOST_HCH1CTL_CDIS_Values<USBFS_HOST::HCH1CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH1CTLBase> ;
     using CEN = USBFS_HOST_HCH1CTL_CEN_Values<USBFS_HOST::HCH1CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH1CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH1CTL_CEN_Values<USBFS_HOST::HCH1CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +164,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH2CTL_ODDFRM_Values<USBFS_HOST::HCH2CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH2CTLBase> ;
     using CDIS = USBFS_HOST_HCH2CTL_CDIS_Values<USBFS_HOST::HCH2CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH2CTLBase> ;
     using CEN = USBFS_HOST_HCH2CTL_CEN_Values<USBFS_HOST::HCH2CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH2CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH2CTL_CEN_Values<USBFS_HOST::HCH2CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +184,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH3CTL_ODDFRM_Values<USBFS_HOST::HCH3CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH3CTLBase> ;
     using CDIS = USBFS_HOST_HCH3CTL_CDIS_Values<USBFS_HOST::HCH3CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH3CTLBase> ;
     using CEN = USBFS_HOST_HCH3CTL_CEN_Values<USBFS_HOST::HCH3CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH3CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH3CTL_CEN_Values<USBFS_HOST::HCH3CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -195,6 +204,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH4CTL_ODDFRM_Values<USBFS_HOST::HCH4CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH4CTLBase> ;
     using CDIS = USBFS_HOST_HCH4CTL_CDIS_Values<USBFS_HOST::HCH4CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH4CTLBase> ;
     using CEN = USBFS_HOST_HCH4CTL_CEN_Values<USBFS_HOST::HCH4CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH4CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH4CTL_CEN_Values<USBFS_HOST::HCH4CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -214,6 +224,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH5CTL_ODDFRM_Values<USBFS_HOST::HCH5CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH5CTLBase> ;
     using CDIS = USBFS_HOST_HCH5CTL_CDIS_Values<USBFS_HOST::HCH5CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH5CTLBase> ;
     using CEN = USBFS_HOST_HCH5CTL_CEN_Values<USBFS_HOST::HCH5CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH5CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH5CTL_CEN_Values<USBFS_HOST::HCH5CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +244,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH6CTL_ODDFRM_Values<USBFS_HOST::HCH6CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH6CTLBase> ;
     using CDIS = USBFS_HOST_HCH6CTL_CDIS_Values<USBFS_HOST::HCH6CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH6CTLBase> ;
     using CEN = USBFS_HOST_HCH6CTL_CEN_Values<USBFS_HOST::HCH6CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH6CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH6CTL_CEN_Values<USBFS_HOST::HCH6CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +264,7 @@ struct USBFS_HOST
     using ODDFRM = USBFS_HOST_HCH7CTL_ODDFRM_Values<USBFS_HOST::HCH7CTL, 29, 1, ReadWriteMode, USBFS_HOSTHCH7CTLBase> ;
     using CDIS = USBFS_HOST_HCH7CTL_CDIS_Values<USBFS_HOST::HCH7CTL, 30, 1, ReadWriteMode, USBFS_HOSTHCH7CTLBase> ;
     using CEN = USBFS_HOST_HCH7CTL_CEN_Values<USBFS_HOST::HCH7CTL, 31, 1, ReadWriteMode, USBFS_HOSTHCH7CTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFCEFFFFU ;
     using FieldValues = USBFS_HOST_HCH7CTL_CEN_Values<USBFS_HOST::HCH7CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -271,6 +284,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH0INTF_BBER_Values<USBFS_HOST::HCH0INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH0INTFBase> ;
     using REQOVR = USBFS_HOST_HCH0INTF_REQOVR_Values<USBFS_HOST::HCH0INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH0INTFBase> ;
     using DTER = USBFS_HOST_HCH0INTF_DTER_Values<USBFS_HOST::HCH0INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH0INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH0INTF_DTER_Values<USBFS_HOST::HCH0INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -290,6 +304,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH1INTF_BBER_Values<USBFS_HOST::HCH1INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH1INTFBase> ;
     using REQOVR = USBFS_HOST_HCH1INTF_REQOVR_Values<USBFS_HOST::HCH1INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH1INTFBase> ;
     using DTER = USBFS_HOST_HCH1INTF_DTER_Values<USBFS_HOST::HCH1INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH1INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH1INTF_DTER_Values<USBFS_HOST::HCH1INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -309,6 +324,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH2INTF_BBER_Values<USBFS_HOST::HCH2INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH2INTFBase> ;
     using REQOVR = USBFS_HOST_HCH2INTF_REQOVR_Values<USBFS_HOST::HCH2INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH2INTFBase> ;
     using DTER = USBFS_HOST_HCH2INTF_DTER_Values<USBFS_HOST::HCH2INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH2INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH2INTF_DTER_Values<USBFS_HOST::HCH2INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -328,6 +344,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH3INTF_BBER_Values<USBFS_HOST::HCH3INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH3INTFBase> ;
     using REQOVR = USBFS_HOST_HCH3INTF_REQOVR_Values<USBFS_HOST::HCH3INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH3INTFBase> ;
     using DTER = USBFS_HOST_HCH3INTF_DTER_Values<USBFS_HOST::HCH3INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH3INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH3INTF_DTER_Values<USBFS_HOST::HCH3INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -347,6 +364,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH4INTF_BBER_Values<USBFS_HOST::HCH4INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH4INTFBase> ;
     using REQOVR = USBFS_HOST_HCH4INTF_REQOVR_Values<USBFS_HOST::HCH4INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH4INTFBase> ;
     using DTER = USBFS_HOST_HCH4INTF_DTER_Values<USBFS_HOST::HCH4INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH4INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH4INTF_DTER_Values<USBFS_HOST::HCH4INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -366,6 +384,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH5INTF_BBER_Values<USBFS_HOST::HCH5INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH5INTFBase> ;
     using REQOVR = USBFS_HOST_HCH5INTF_REQOVR_Values<USBFS_HOST::HCH5INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH5INTFBase> ;
     using DTER = USBFS_HOST_HCH5INTF_DTER_Values<USBFS_HOST::HCH5INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH5INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH5INTF_DTER_Values<USBFS_HOST::HCH5INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -385,6 +404,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH6INTF_BBER_Values<USBFS_HOST::HCH6INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH6INTFBase> ;
     using REQOVR = USBFS_HOST_HCH6INTF_REQOVR_Values<USBFS_HOST::HCH6INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH6INTFBase> ;
     using DTER = USBFS_HOST_HCH6INTF_DTER_Values<USBFS_HOST::HCH6INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH6INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH6INTF_DTER_Values<USBFS_HOST::HCH6INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -404,6 +424,7 @@ struct USBFS_HOST
     using BBER = USBFS_HOST_HCH7INTF_BBER_Values<USBFS_HOST::HCH7INTF, 8, 1, ReadWriteMode, USBFS_HOSTHCH7INTFBase> ;
     using REQOVR = USBFS_HOST_HCH7INTF_REQOVR_Values<USBFS_HOST::HCH7INTF, 9, 1, ReadWriteMode, USBFS_HOSTHCH7INTFBase> ;
     using DTER = USBFS_HOST_HCH7INTF_DTER_Values<USBFS_HOST::HCH7INTF, 10, 1, ReadWriteMode, USBFS_HOSTHCH7INTFBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH7INTF_DTER_Values<USBFS_HOST::HCH7INTF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -423,6 +444,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH0INTEN_BBERIE_Values<USBFS_HOST::HCH0INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH0INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH0INTEN_REQOVRIE_Values<USBFS_HOST::HCH0INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH0INTENBase> ;
     using DTERIE = USBFS_HOST_HCH0INTEN_DTERIE_Values<USBFS_HOST::HCH0INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH0INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH0INTEN_DTERIE_Values<USBFS_HOST::HCH0INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -442,6 +464,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH1INTEN_BBERIE_Values<USBFS_HOST::HCH1INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH1INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH1INTEN_REQOVRIE_Values<USBFS_HOST::HCH1INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH1INTENBase> ;
     using DTERIE = USBFS_HOST_HCH1INTEN_DTERIE_Values<USBFS_HOST::HCH1INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH1INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH1INTEN_DTERIE_Values<USBFS_HOST::HCH1INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -461,6 +484,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH2INTEN_BBERIE_Values<USBFS_HOST::HCH2INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH2INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH2INTEN_REQOVRIE_Values<USBFS_HOST::HCH2INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH2INTENBase> ;
     using DTERIE = USBFS_HOST_HCH2INTEN_DTERIE_Values<USBFS_HOST::HCH2INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH2INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH2INTEN_DTERIE_Values<USBFS_HOST::HCH2INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -480,6 +504,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH3INTEN_BBERIE_Values<USBFS_HOST::HCH3INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH3INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH3INTEN_REQOVRIE_Values<USBFS_HOST::HCH3INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH3INTENBase> ;
     using DTERIE = USBFS_HOST_HCH3INTEN_DTERIE_Values<USBFS_HOST::HCH3INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH3INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH3INTEN_DTERIE_Values<USBFS_HOST::HCH3INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -499,6 +524,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH4INTEN_BBERIE_Values<USBFS_HOST::HCH4INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH4INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH4INTEN_REQOVRIE_Values<USBFS_HOST::HCH4INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH4INTENBase> ;
     using DTERIE = USBFS_HOST_HCH4INTEN_DTERIE_Values<USBFS_HOST::HCH4INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH4INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH4INTEN_DTERIE_Values<USBFS_HOST::HCH4INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -518,6 +544,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH5INTEN_BBERIE_Values<USBFS_HOST::HCH5INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH5INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH5INTEN_REQOVRIE_Values<USBFS_HOST::HCH5INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH5INTENBase> ;
     using DTERIE = USBFS_HOST_HCH5INTEN_DTERIE_Values<USBFS_HOST::HCH5INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH5INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH5INTEN_DTERIE_Values<USBFS_HOST::HCH5INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -537,6 +564,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH6INTEN_BBERIE_Values<USBFS_HOST::HCH6INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH6INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH6INTEN_REQOVRIE_Values<USBFS_HOST::HCH6INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH6INTENBase> ;
     using DTERIE = USBFS_HOST_HCH6INTEN_DTERIE_Values<USBFS_HOST::HCH6INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH6INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH6INTEN_DTERIE_Values<USBFS_HOST::HCH6INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -556,6 +584,7 @@ struct USBFS_HOST
     using BBERIE = USBFS_HOST_HCH7INTEN_BBERIE_Values<USBFS_HOST::HCH7INTEN, 8, 1, ReadWriteMode, USBFS_HOSTHCH7INTENBase> ;
     using REQOVRIE = USBFS_HOST_HCH7INTEN_REQOVRIE_Values<USBFS_HOST::HCH7INTEN, 9, 1, ReadWriteMode, USBFS_HOSTHCH7INTENBase> ;
     using DTERIE = USBFS_HOST_HCH7INTEN_DTERIE_Values<USBFS_HOST::HCH7INTEN, 10, 1, ReadWriteMode, USBFS_HOSTHCH7INTENBase> ;
+    static constexpr Type SnapshotMask = 0x7BBU ;
     using FieldValues = USBFS_HOST_HCH7INTEN_DTERIE_Values<USBFS_HOST::HCH7INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -569,6 +598,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH0LEN_TLEN_Values<USBFS_HOST::HCH0LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH0LENBase> ;
     using PCNT = USBFS_HOST_HCH0LEN_PCNT_Values<USBFS_HOST::HCH0LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH0LENBase> ;
     using DPID = USBFS_HOST_HCH0LEN_DPID_Values<USBFS_HOST::HCH0LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH0LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH0LEN_DPID_Values<USBFS_HOST::HCH0LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -582,6 +612,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH1LEN_TLEN_Values<USBFS_HOST::HCH1LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH1LENBase> ;
     using PCNT = USBFS_HOST_HCH1LEN_PCNT_Values<USBFS_HOST::HCH1LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH1LENBase> ;
     using DPID = USBFS_HOST_HCH1LEN_DPID_Values<USBFS_HOST::HCH1LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH1LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH1LEN_DPID_Values<USBFS_HOST::HCH1LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -595,6 +626,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH2LEN_TLEN_Values<USBFS_HOST::HCH2LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH2LENBase> ;
     using PCNT = USBFS_HOST_HCH2LEN_PCNT_Values<USBFS_HOST::HCH2LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH2LENBase> ;
     using DPID = USBFS_HOST_HCH2LEN_DPID_Values<USBFS_HOST::HCH2LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH2LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH2LEN_DPID_Values<USBFS_HOST::HCH2LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +640,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH3LEN_TLEN_Values<USBFS_HOST::HCH3LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH3LENBase> ;
     using PCNT = USBFS_HOST_HCH3LEN_PCNT_Values<USBFS_HOST::HCH3LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH3LENBase> ;
     using DPID = USBFS_HOST_HCH3LEN_DPID_Values<USBFS_HOST::HCH3LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH3LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH3LEN_DPID_Values<USBFS_HOST::HCH3LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -621,6 +654,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH4LEN_TLEN_Values<USBFS_HOST::HCH4LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH4LENBase> ;
     using PCNT = USBFS_HOST_HCH4LEN_PCNT_Values<USBFS_HOST::HCH4LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH4LENBase> ;
     using DPID = USBFS_HOST_HCH4LEN_DPID_Values<USBFS_HOST::HCH4LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH4LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH4LEN_DPID_Values<USBFS_HOST::HCH4LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -634,6 +668,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH5LEN_TLEN_Values<USBFS_HOST::HCH5LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH5LENBase> ;
     using PCNT = USBFS_HOST_HCH5LEN_PCNT_Values<USBFS_HOST::HCH5LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH5LENBase> ;
     using DPID = USBFS_HOST_HCH5LEN_DPID_Values<USBFS_HOST::HCH5LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH5LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH5LEN_DPID_Values<USBFS_HOST::HCH5LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -647,6 +682,7 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH6LEN_TLEN_Values<USBFS_HOST::HCH6LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH6LENBase> ;
     using PCNT = USBFS_HOST_HCH6LEN_PCNT_Values<USBFS_HOST::HCH6LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH6LENBase> ;
     using DPID = USBFS_HOST_HCH6LEN_DPID_Values<USBFS_HOST::HCH6LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH6LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH6LEN_DPID_Values<USBFS_HOST::HCH6LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -660,12 +696,14 @@ struct USBFS_HOST
     using TLEN = USBFS_HOST_HCH7LEN_TLEN_Values<USBFS_HOST::HCH7LEN, 0, 19, ReadWriteMode, USBFS_HOSTHCH7LENBase> ;
     using PCNT = USBFS_HOST_HCH7LEN_PCNT_Values<USBFS_HOST::HCH7LEN, 19, 10, ReadWriteMode, USBFS_HOSTHCH7LENBase> ;
     using DPID = USBFS_HOST_HCH7LEN_DPID_Values<USBFS_HOST::HCH7LEN, 29, 2, ReadWriteMode, USBFS_HOSTHCH7LENBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = USBFS_HOST_HCH7LEN_DPID_Values<USBFS_HOST::HCH7LEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using HCH7LENPack  = Register<0x500005F0, 32, ReadWriteMode, USBFS_HOSTHCH7LENBase, T...> ;
 
+  using Registers = TypesList<USBFS_HOST::HCTL, USBFS_HOST::HFT, USBFS_HOST::HFINFR, USBFS_HOST::HPTFQSTAT, USBFS_HOST::HACHINT, USBFS_HOST::HACHINTEN, USBFS_HOST::HPCS, USBFS_HOST::HCH0CTL, USBFS_HOST::HCH1CTL, USBFS_HOST::HCH2CTL, USBFS_HOST::HCH3CTL, USBFS_HOST::HCH4CTL, USBFS_HOST::HCH5CTL, USBFS_HOST::HCH6CTL, USBFS_HOST::HCH7CTL, USBFS_HOST::HCH0INTF, USBFS_HOST::HCH1INTF, USBFS_HOST::HCH2INTF, USBFS_HOST::HCH3INTF, USBFS_HOST::HCH4INTF, USBFS_HOST::HCH5INTF, USBFS_HOST::HCH6INTF, USBFS_HOST::HCH7INTF, USBFS_HOST::HCH0INTEN, USBFS_HOST::HCH1INTEN, USBFS_HOST::HCH2INTEN, USBFS_HOST::HCH3INTEN, USBFS_HOST::HCH4INTEN, USBFS_HOST::HCH5INTEN, USBFS_HOST::HCH6INTEN, USBFS_HOST::HCH7INTEN, USBFS_HOST::HCH0LEN, USBFS_HOST::HCH1LEN, USBFS_HOST::HCH2LEN, USBFS_HOST::HCH3LEN, USBFS_HOST::HCH4LEN, USBFS_HOST::HCH5LEN, USBFS_HOST::HCH6LEN, USBFS_HOST::HCH7LEN> ;
 } ;
 
 #endif //#if !defined(USBFSHOSTREGISTERS_HPP)
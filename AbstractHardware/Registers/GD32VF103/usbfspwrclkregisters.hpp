@@ -23,12 +23,14 @@ struct USBFS_PWRCLK
   {
     using SUCLK = USBFS_PWRCLK_PWRCLKCTL_SUCLK_Values<USBFS_PWRCLK::PWRCLKCTL, 0, 1, ReadWriteMode, USBFS_PWRCLKPWRCLKCTLBase> ;
     using SHCLK = USBFS_PWRCLK_PWRCLKCTL_SHCLK_Values<USBFS_PWRCLK::PWRCLKCTL, 1, 1, ReadWriteMode, USBFS_PWRCLKPWRCLKCTLBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = USBFS_PWRCLK_PWRCLKCTL_SHCLK_Values<USBFS_PWRCLK::PWRCLKCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PWRCLKCTLPack  = Register<0x50000E00, 32, ReadWriteMode, USBFS_PWRCLKPWRCLKCTLBase, T...> ;
 
+  using Registers = TypesList<USBFS_PWRCLK::PWRCLKCTL> ;
 } ;
 
 #endif //#if !defined(USBFSPWRCLKREGISTERS_HPP)
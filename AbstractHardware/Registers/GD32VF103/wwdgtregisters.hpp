@@ -23,6 +23,7 @@ struct WWDGT
   {
     using WDGTEN = WWDGT_CTL_WDGTEN_Values<WWDGT::CTL, 7, 1, ReadWriteMode, WWDGTCTLBase> ;
     using CNT = WWDGT_CTL_CNT_Values<WWDGT::CTL, 0, 7, ReadWriteMode, WWDGTCTLBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = WWDGT_CTL_CNT_Values<WWDGT::CTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -36,6 +37,7 @@ struct WWDGT
     using EWIE = WWDGT_CFG_EWIE_Values<WWDGT::CFG, 9, 1, ReadWriteMode, WWDGTCFGBase> ;
     using PSC = WWDGT_CFG_PSC_Values<WWDGT::CFG, 7, 2, ReadWriteMode, WWDGTCFGBase> ;
     using WIN = WWDGT_CFG_WIN_Values<WWDGT::CFG, 0, 7, ReadWriteMode, WWDGTCFGBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = WWDGT_CFG_WIN_Values<WWDGT::CFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,12 +49,16 @@ struct WWDGT
   struct STAT : public RegisterBase<0x40002C08, 32, ReadWriteMode>
   {
     using EWIF = WWDGT_STAT_EWIF_Values<WWDGT::STAT, 0, 1, ReadWriteMode, WWDGTSTATBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = WWDGT_STAT_EWIF_Values<WWDGT::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using STATPack  = Register<0x40002C08, 32, ReadWriteMode, WWDGTSTATBase, T...> ;
 
+  using Registers = TypesList<WWDGT::CTL, WWDGT::CFG, WWDGT::STAT> ;
 } ;
 
 #endif //#if !defined(WWDGTREGISTERS_HPP)
@@ -0,0 +1,19 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>      //for std::uintptr_t, std::uint32_t
+#include "buses.hpp"    //for BusCost
+
+//Характеристики микроконтроллера MDR1986VE4, которые нужны уровню регистров
+struct DeviceTraits
+{
+  //Cortex-M0 не поддерживает bit-band,
+  //поэтому битовые поля всегда устанавливаются через чтение-модификацию-запись
+  static constexpr bool IsBitBandSupported = false ;
+  static constexpr std::uintptr_t PeripheralBase = 0U ;
+  static constexpr std::uintptr_t PeripheralSize = 0U ;
+  static constexpr std::uintptr_t PeripheralBitBandBase = 0U ;
+} ;
@@ -35,6 +35,7 @@ struct MDR_ADC
     using SEL_TS = MDR_ADC_ADC1_Cfg_SEL_TS_Values<MDR_ADC::ADC1_Cfg, 19, 1, ReadWriteMode, MDR_ADCADC1_CfgBase> ;
     using SEL_VREF = MDR_ADC_ADC1_Cfg_SEL_VREF_Values<MDR_ADC::ADC1_Cfg, 20, 1, ReadWriteMode, MDR_ADCADC1_CfgBase> ;
     using Delay_GO = MDR_ADC_ADC1_Cfg_Delay_GO_Values<MDR_ADC::ADC1_Cfg, 25, 3, ReadWriteMode, MDR_ADCADC1_CfgBase> ;
+    static constexpr Type SnapshotMask = 0xE1EFFFFU ;
     using FieldValues = MDR_ADC_ADC1_Cfg_Delay_GO_Values<MDR_ADC::ADC1_Cfg, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,6 +47,7 @@ struct MDR_ADC
   struct ADC2_Cfg : public RegisterBase<0x40040004, 32, ReadWriteMode>
   {
     using ADC1_OP = MDR_ADC_ADC2_Cfg_ADC1_OP_Values<MDR_ADC::ADC2_Cfg, 17, 1, ReadWriteMode, MDR_ADCADC2_CfgBase> ;
+    static constexpr Type SnapshotMask = 0x20000U ;
     using FieldValues = MDR_ADC_ADC2_Cfg_ADC1_OP_Values<MDR_ADC::ADC2_Cfg, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct MDR_ADC
   struct ADC1_H_Level : public RegisterBase<0x40040008, 32, ReadWriteMode>
   {
     using Level = MDR_ADC_ADC1_H_Level_Level_Values<MDR_ADC::ADC1_H_Level, 0, 12, ReadWriteMode, MDR_ADCADC1_H_LevelBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = MDR_ADC_ADC1_H_Level_Level_Values<MDR_ADC::ADC1_H_Level, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -67,6 +70,7 @@ struct MDR_ADC
 
   struct ADC1_L_Level : public RegisterBase<0x40040010, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -93,6 +97,7 @@ struct MDR_ADC
     using EOCIF = MDR_ADC_ADC1_STATUS_EOCIF_Values<MDR_ADC::ADC1_STATUS, 2, 1, ReadWriteMode, MDR_ADCADC1_STATUSBase> ;
     using AWOIF_IE = MDR_ADC_ADC1_STATUS_AWOIF_IE_Values<MDR_ADC::ADC1_STATUS, 3, 1, ReadWriteMode, MDR_ADCADC1_STATUSBase> ;
     using EOCIF_EN = MDR_ADC_ADC1_STATUS_EOCIF_EN_Values<MDR_ADC::ADC1_STATUS, 4, 1, ReadWriteMode, MDR_ADCADC1_STATUSBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = MDR_ADC_ADC1_STATUS_EOCIF_EN_Values<MDR_ADC::ADC1_STATUS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +118,7 @@ struct MDR_ADC
     using Channel_7 = MDR_ADC_ADC1_CHSEL_Channel_7_Values<MDR_ADC::ADC1_CHSEL, 7, 1, ReadWriteMode, MDR_ADCADC1_CHSELBase> ;
     using Channel_30 = MDR_ADC_ADC1_CHSEL_Channel_30_Values<MDR_ADC::ADC1_CHSEL, 30, 1, ReadWriteMode, MDR_ADCADC1_CHSELBase> ;
     using Channel_31 = MDR_ADC_ADC1_CHSEL_Channel_31_Values<MDR_ADC::ADC1_CHSEL, 31, 1, ReadWriteMode, MDR_ADCADC1_CHSELBase> ;
+    static constexpr Type SnapshotMask = 0xC00000FFU ;
     using FieldValues = MDR_ADC_ADC1_CHSEL_Channel_31_Values<MDR_ADC::ADC1_CHSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,12 +131,14 @@ struct MDR_ADC
   {
     using TS_Trim = MDR_ADC_ADC1_TRIM_TS_Trim_Values<MDR_ADC::ADC1_TRIM, 1, 5, ReadWriteMode, MDR_ADCADC1_TRIMBase> ;
     using SEL_VREF_BUF = MDR_ADC_ADC1_TRIM_SEL_VREF_BUF_Values<MDR_ADC::ADC1_TRIM, 6, 1, ReadWriteMode, MDR_ADCADC1_TRIMBase> ;
+    static constexpr Type SnapshotMask = 0x7EU ;
     using FieldValues = MDR_ADC_ADC1_TRIM_SEL_VREF_BUF_Values<MDR_ADC::ADC1_TRIM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ADC1_TRIMPack  = Register<0x40040030, 32, ReadWriteMode, MDR_ADCADC1_TRIMBase, T...> ;
 
+  using Registers = TypesList<MDR_ADC::ADC1_Cfg, MDR_ADC::ADC2_Cfg, MDR_ADC::ADC1_H_Level, MDR_ADC::ADC1_L_Level, MDR_ADC::ADC1_RESULT, MDR_ADC::ADC1_STATUS, MDR_ADC::ADC1_CHSEL, MDR_ADC::ADC1_TRIM> ;
 } ;
 
 #endif //#if !defined(MDRADCREGISTERS_HPP)
@@ -38,6 +38,7 @@ struct MDR_ADCUI
     using CHP6_EN = MDR_ADCUI_CTRL1_CHP6_EN_Values<MDR_ADCUI::CTRL1, 14, 1, ReadWriteMode, MDR_ADCUICTRL1Base> ;
     using CHP7_EN = MDR_ADCUI_CTRL1_CHP7_EN_Values<MDR_ADCUI::CTRL1, 15, 1, ReadWriteMode, MDR_ADCUICTRL1Base> ;
     using CHP8_EN = MDR_ADCUI_CTRL1_CHP8_EN_Values<MDR_ADCUI::CTRL1, 16, 1, ReadWriteMode, MDR_ADCUICTRL1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = MDR_ADCUI_CTRL1_CHP8_EN_Values<MDR_ADCUI::CTRL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -56,6 +57,7 @@ struct MDR_ADCUI
     using ADC6_PGA = MDR_ADCUI_ANGAIN_ADC6_PGA_Values<MDR_ADCUI::ANGAIN, 10, 2, ReadWriteMode, MDR_ADCUIANGAINBase> ;
     using ADC7_PGA = MDR_ADCUI_ANGAIN_ADC7_PGA_Values<MDR_ADCUI::ANGAIN, 12, 2, ReadWriteMode, MDR_ADCUIANGAINBase> ;
     using ADC8_PGA = MDR_ADCUI_ANGAIN_ADC8_PGA_Values<MDR_ADCUI::ANGAIN, 14, 3, ReadWriteMode, MDR_ADCUIANGAINBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = MDR_ADCUI_ANGAIN_ADC8_PGA_Values<MDR_ADCUI::ANGAIN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +85,7 @@ struct MDR_ADCUI
     using DMA6_EN = MDR_ADCUI_DMAEN_DMA6_EN_Values<MDR_ADCUI::DMAEN, 5, 1, ReadWriteMode, MDR_ADCUIDMAENBase> ;
     using DMA7_EN = MDR_ADCUI_DMAEN_DMA7_EN_Values<MDR_ADCUI::DMAEN, 6, 1, ReadWriteMode, MDR_ADCUIDMAENBase> ;
     using DMA8_EN = MDR_ADCUI_DMAEN_DMA8_EN_Values<MDR_ADCUI::DMAEN, 7, 1, ReadWriteMode, MDR_ADCUIDMAENBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_ADCUI_DMAEN_DMA8_EN_Values<MDR_ADCUI::DMAEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +101,7 @@ struct MDR_ADCUI
     using Reset = MDR_ADCUI_CTRL2_Reset_Values<MDR_ADCUI::CTRL2, 10, 1, ReadWriteMode, MDR_ADCUICTRL2Base> ;
     using BF_bp = MDR_ADCUI_CTRL2_BF_bp_Values<MDR_ADCUI::CTRL2, 11, 1, ReadWriteMode, MDR_ADCUICTRL2Base> ;
     using CHOP_Freq = MDR_ADCUI_CTRL2_CHOP_Freq_Values<MDR_ADCUI::CTRL2, 12, 2, ReadWriteMode, MDR_ADCUICTRL2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFU ;
     using FieldValues = MDR_ADCUI_CTRL2_CHOP_Freq_Values<MDR_ADCUI::CTRL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +128,7 @@ struct MDR_ADCUI
     using OV6_EN = MDR_ADCUI_INTEN_OV6_EN_Values<MDR_ADCUI::INTEN, 13, 1, ReadWriteMode, MDR_ADCUIINTENBase> ;
     using OV7_EN = MDR_ADCUI_INTEN_OV7_EN_Values<MDR_ADCUI::INTEN, 14, 1, ReadWriteMode, MDR_ADCUIINTENBase> ;
     using OV8_EN = MDR_ADCUI_INTEN_OV8_EN_Values<MDR_ADCUI::INTEN, 15, 1, ReadWriteMode, MDR_ADCUIINTENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_ADCUI_INTEN_OV8_EN_Values<MDR_ADCUI::INTEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +155,7 @@ struct MDR_ADCUI
     using OV6 = MDR_ADCUI_STAT_OV6_Values<MDR_ADCUI::STAT, 13, 1, ReadWriteMode, MDR_ADCUISTATBase> ;
     using OV7 = MDR_ADCUI_STAT_OV7_Values<MDR_ADCUI::STAT, 14, 1, ReadWriteMode, MDR_ADCUISTATBase> ;
     using OV8 = MDR_ADCUI_STAT_OV8_Values<MDR_ADCUI::STAT, 15, 1, ReadWriteMode, MDR_ADCUISTATBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_ADCUI_STAT_OV8_Values<MDR_ADCUI::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +167,7 @@ struct MDR_ADCUI
   struct TST : public RegisterBase<0x4006803C, 32, ReadWriteMode>
   {
     using TST2 = MDR_ADCUI_TST_TST2_Values<MDR_ADCUI::TST, 1, 1, ReadWriteMode, MDR_ADCUITSTBase> ;
+    static constexpr Type SnapshotMask = 0x2U ;
     using FieldValues = MDR_ADCUI_TST_TST2_Values<MDR_ADCUI::TST, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -239,6 +246,7 @@ struct MDR_ADCUI
   template<typename... T> 
   using ADC8_DATPack  = Register<0x40068038, 32, ReadMode, MDR_ADCUIADC8_DATBase, T...> ;
 
+  using Registers = TypesList<MDR_ADCUI::CTRL1, MDR_ADCUI::ANGAIN, MDR_ADCUI::DIGGAIN, MDR_ADCUI::DMAEN, MDR_ADCUI::CTRL2, MDR_ADCUI::INTEN, MDR_ADCUI::STAT, MDR_ADCUI::TST, MDR_ADCUI::ADC1_DAT, MDR_ADCUI::ADC2_DAT, MDR_ADCUI::ADC3_DAT, MDR_ADCUI::ADC4_DAT, MDR_ADCUI::ADC5_DAT, MDR_ADCUI::ADC6_DAT, MDR_ADCUI::ADC7_DAT, MDR_ADCUI::ADC8_DAT> ;
 } ;
 
 #endif //#if !defined(MDRADCUIREGISTERS_HPP)
@@ -30,6 +30,7 @@ struct MDR_BKP
     using Trim_DUcc = MDR_BKP_REG_0E_Trim_DUcc_Values<MDR_BKP::REG_0E, 12, 2, ReadWriteMode, MDR_BKPREG_0EBase> ;
     using COVDET = MDR_BKP_REG_0E_COVDET_Values<MDR_BKP::REG_0E, 14, 1, ReadWriteMode, MDR_BKPREG_0EBase> ;
     using I_LimEn = MDR_BKP_REG_0E_I_LimEn_Values<MDR_BKP::REG_0E, 15, 1, ReadWriteMode, MDR_BKPREG_0EBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_BKP_REG_0E_I_LimEn_Values<MDR_BKP::REG_0E, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +55,7 @@ struct MDR_BKP
     using HSI_TRIM = MDR_BKP_REG_0F_HSI_TRIM_Values<MDR_BKP::REG_0F, 24, 6, ReadWriteMode, MDR_BKPREG_0FBase> ;
     using Standby = MDR_BKP_REG_0F_Standby_Values<MDR_BKP::REG_0F, 30, 1, ReadWriteMode, MDR_BKPREG_0FBase> ;
     using RTC_RESET = MDR_BKP_REG_0F_RTC_RESET_Values<MDR_BKP::REG_0F, 31, 1, ReadWriteMode, MDR_BKPREG_0FBase> ;
+    static constexpr Type SnapshotMask = 0xFFDF9FFFU ;
     using FieldValues = MDR_BKP_REG_0F_RTC_RESET_Values<MDR_BKP::REG_0F, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -64,6 +66,7 @@ struct MDR_BKP
 
   struct RTC_CNT : public RegisterBase<0x40060040, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -74,6 +77,7 @@ struct MDR_BKP
   struct RTC_DIV : public RegisterBase<0x40060044, 32, ReadWriteMode>
   {
     using Value = MDR_BKP_RTC_DIV_Value_Values<MDR_BKP::RTC_DIV, 0, 20, ReadWriteMode, MDR_BKPRTC_DIVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = MDR_BKP_RTC_DIV_Value_Values<MDR_BKP::RTC_DIV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +89,7 @@ struct MDR_BKP
   struct RTC_PRL : public RegisterBase<0x40060048, 32, ReadWriteMode>
   {
     using Value = MDR_BKP_RTC_PRL_Value_Values<MDR_BKP::RTC_PRL, 0, 20, ReadWriteMode, MDR_BKPRTC_PRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = MDR_BKP_RTC_PRL_Value_Values<MDR_BKP::RTC_PRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +101,7 @@ struct MDR_BKP
   struct RTC_ALRM : public RegisterBase<0x4006004C, 32, ReadWriteMode>
   {
     using Value = MDR_BKP_RTC_ALRM_Value_Values<MDR_BKP::RTC_ALRM, 0, 32, ReadWriteMode, MDR_BKPRTC_ALRMBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_BKP_RTC_ALRM_Value_Values<MDR_BKP::RTC_ALRM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +119,7 @@ struct MDR_BKP
     using SECF_IE = MDR_BKP_RTC_CS_SECF_IE_Values<MDR_BKP::RTC_CS, 4, 1, ReadWriteMode, MDR_BKPRTC_CSBase> ;
     using ALRF_IE = MDR_BKP_RTC_CS_ALRF_IE_Values<MDR_BKP::RTC_CS, 5, 1, ReadWriteMode, MDR_BKPRTC_CSBase> ;
     using WEC = MDR_BKP_RTC_CS_WEC_Values<MDR_BKP::RTC_CS, 6, 1, ReadWriteMode, MDR_BKPRTC_CSBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = MDR_BKP_RTC_CS_WEC_Values<MDR_BKP::RTC_CS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -123,6 +130,7 @@ struct MDR_BKP
 
   struct REG_00 : public RegisterBase<0x40060000, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -132,6 +140,7 @@ struct MDR_BKP
 
   struct REG_01 : public RegisterBase<0x40060004, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -141,6 +150,7 @@ struct MDR_BKP
 
   struct REG_02 : public RegisterBase<0x40060008, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -150,6 +160,7 @@ struct MDR_BKP
 
   struct REG_03 : public RegisterBase<0x4006000C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -159,6 +170,7 @@ struct MDR_BKP
 
   struct REG_04 : public RegisterBase<0x40060010, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -168,6 +180,7 @@ struct MDR_BKP
 
   struct REG_05 : public RegisterBase<0x40060014, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -177,6 +190,7 @@ struct MDR_BKP
 
   struct REG_06 : public RegisterBase<0x40060018, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -186,6 +200,7 @@ struct MDR_BKP
 
   struct REG_07 : public RegisterBase<0x4006001C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -195,6 +210,7 @@ struct MDR_BKP
 
   struct REG_08 : public RegisterBase<0x40060020, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -204,6 +220,7 @@ struct MDR_BKP
 
   struct REG_09 : public RegisterBase<0x40060024, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -213,6 +230,7 @@ struct MDR_BKP
 
   struct REG_0A : public RegisterBase<0x40060028, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -222,6 +240,7 @@ struct MDR_BKP
 
   struct REG_0B : public RegisterBase<0x4006002C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -231,6 +250,7 @@ struct MDR_BKP
 
   struct REG_0C : public RegisterBase<0x40060030, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -240,11 +260,13 @@ struct MDR_BKP
 
   struct REG_0D : public RegisterBase<0x40060034, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
   using REG_0DPack  = Register<0x40060034, 32, ReadWriteMode, MDR_BKPREG_0DBase, T...> ;
 
+  using Registers = TypesList<MDR_BKP::REG_0E, MDR_BKP::REG_0F, MDR_BKP::RTC_CNT, MDR_BKP::RTC_DIV, MDR_BKP::RTC_PRL, MDR_BKP::RTC_ALRM, MDR_BKP::RTC_CS, MDR_BKP::REG_00, MDR_BKP::REG_01, MDR_BKP::REG_02, MDR_BKP::REG_03, MDR_BKP::REG_04, MDR_BKP::REG_05, MDR_BKP::REG_06, MDR_BKP::REG_07, MDR_BKP::REG_08, MDR_BKP::REG_09, MDR_BKP::REG_0A, MDR_BKP::REG_0B, MDR_BKP::REG_0C, MDR_BKP::REG_0D> ;
 } ;
 
 #endif //#if !defined(MDRBKPREGISTERS_HPP)
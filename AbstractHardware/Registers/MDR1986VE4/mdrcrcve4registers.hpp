@@ -26,6 +26,7 @@ struct MDR_CRC_VE4
     using DMA_En = MDR_CRC_VE4_CTRL_DMA_En_Values<MDR_CRC_VE4::CTRL, 2, 1, ReadWriteMode, MDR_CRC_VE4CTRLBase> ;
     using DL_Size = MDR_CRC_VE4_CTRL_DL_Size_Values<MDR_CRC_VE4::CTRL, 3, 2, ReadWriteMode, MDR_CRC_VE4CTRLBase> ;
     using DC_Size = MDR_CRC_VE4_CTRL_DC_Size_Values<MDR_CRC_VE4::CTRL, 5, 2, ReadWriteMode, MDR_CRC_VE4CTRLBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = MDR_CRC_VE4_CTRL_DC_Size_Values<MDR_CRC_VE4::CTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,7 @@ struct MDR_CRC_VE4
     using FIFO_Full = MDR_CRC_VE4_STAT_FIFO_Full_Values<MDR_CRC_VE4::STAT, 1, 1, ReadMode, MDR_CRC_VE4STATBase> ;
     using FIFO_Empty = MDR_CRC_VE4_STAT_FIFO_Empty_Values<MDR_CRC_VE4::STAT, 2, 1, ReadMode, MDR_CRC_VE4STATBase> ;
     using FIFO_Over = MDR_CRC_VE4_STAT_FIFO_Over_Values<MDR_CRC_VE4::STAT, 3, 1, ReadWriteMode, MDR_CRC_VE4STATBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_CRC_VE4_STAT_FIFO_Over_Values<MDR_CRC_VE4::STAT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct MDR_CRC_VE4
   struct CRC_VAL : public RegisterBase<0x4009800C, 32, ReadWriteMode>
   {
     using CRC_Out = MDR_CRC_VE4_CRC_VAL_CRC_Out_Values<MDR_CRC_VE4::CRC_VAL, 0, 16, ReadWriteMode, MDR_CRC_VE4CRC_VALBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_CRC_VE4_CRC_VAL_CRC_Out_Values<MDR_CRC_VE4::CRC_VAL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,12 +76,14 @@ struct MDR_CRC_VE4
   struct CRC_POL : public RegisterBase<0x40098010, 32, ReadWriteMode>
   {
     using CRC_POLField = MDR_CRC_VE4_CRC_POL_CRC_POL_Values<MDR_CRC_VE4::CRC_POL, 0, 17, ReadWriteMode, MDR_CRC_VE4CRC_POLBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = MDR_CRC_VE4_CRC_POL_CRC_POL_Values<MDR_CRC_VE4::CRC_POL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CRC_POLPack  = Register<0x40098010, 32, ReadWriteMode, MDR_CRC_VE4CRC_POLBase, T...> ;
 
+  using Registers = TypesList<MDR_CRC_VE4::CTRL, MDR_CRC_VE4::STAT, MDR_CRC_VE4::DATAI, MDR_CRC_VE4::CRC_VAL, MDR_CRC_VE4::CRC_POL> ;
 } ;
 
 #endif //#if !defined(MDRCRCVE4REGISTERS_HPP)
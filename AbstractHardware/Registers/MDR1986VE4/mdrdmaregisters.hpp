@@ -50,6 +50,7 @@ struct MDR_DMA
   struct CTRL_BASE_PTR : public RegisterBase<0x40028008, 32, ReadWriteMode>
   {
     using Addr_Hi = MDR_DMA_CTRL_BASE_PTR_Addr_Hi_Values<MDR_DMA::CTRL_BASE_PTR, 10, 22, ReadWriteMode, MDR_DMACTRL_BASE_PTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFC00U ;
     using FieldValues = MDR_DMA_CTRL_BASE_PTR_Addr_Hi_Values<MDR_DMA::CTRL_BASE_PTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -122,6 +123,7 @@ struct MDR_DMA
 
   struct CHNL_USEBURST_SET : public RegisterBase<0x40028018, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -140,6 +142,7 @@ struct MDR_DMA
 
   struct CHNL_REQ_MASK_SET : public RegisterBase<0x40028020, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -158,6 +161,7 @@ struct MDR_DMA
 
   struct CHNL_ENABLE_SET : public RegisterBase<0x40028028, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -176,6 +180,7 @@ struct MDR_DMA
 
   struct CHNL_PRI_ALT_SET : public RegisterBase<0x40028030, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -194,6 +199,7 @@ struct MDR_DMA
 
   struct CHNL_PRIORITY_SET : public RegisterBase<0x40028038, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -212,11 +218,13 @@ struct MDR_DMA
 
   struct ERR_CLR : public RegisterBase<0x4002804C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
   using ERR_CLRPack  = Register<0x4002804C, 32, ReadWriteMode, MDR_DMAERR_CLRBase, T...> ;
 
+  using Registers = TypesList<MDR_DMA::STATUS, MDR_DMA::CFG, MDR_DMA::CTRL_BASE_PTR, MDR_DMA::ALT_CTRL_BASE_PTR, MDR_DMA::WAITONREQ_STATUS, MDR_DMA::CHNL_SW_REQUEST, MDR_DMA::CHNL_USEBURST_SET, MDR_DMA::CHNL_USEBURST_CLR, MDR_DMA::CHNL_REQ_MASK_SET, MDR_DMA::CHNL_REQ_MASK_CLR, MDR_DMA::CHNL_ENABLE_SET, MDR_DMA::CHNL_ENABLE_CLR, MDR_DMA::CHNL_PRI_ALT_SET, MDR_DMA::CHNL_PRI_ALT_CLR, MDR_DMA::CHNL_PRIORITY_SET, MDR_DMA::CHNL_PRIORITY_CLR, MDR_DMA::ERR_CLR> ;
 } ;
 
 #endif //#if !defined(MDRDMAREGISTERS_HPP)
@@ -33,6 +33,7 @@ struct MDR_EEPROM
     using MAS1 = MDR_EEPROM_CMD_MAS1_Values<MDR_EEPROM::CMD, 11, 1, ReadWriteMode, MDR_EEPROMCMDBase> ;
     using PROG = MDR_EEPROM_CMD_PROG_Values<MDR_EEPROM::CMD, 12, 1, ReadWriteMode, MDR_EEPROMCMDBase> ;
     using NVSTR = MDR_EEPROM_CMD_NVSTR_Values<MDR_EEPROM::CMD, 13, 1, ReadWriteMode, MDR_EEPROMCMDBase> ;
+    static constexpr Type SnapshotMask = 0x3FCFU ;
     using FieldValues = MDR_EEPROM_CMD_NVSTR_Values<MDR_EEPROM::CMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +44,7 @@ struct MDR_EEPROM
 
   struct ADDR : public RegisterBase<0x40018004, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -52,6 +54,7 @@ struct MDR_EEPROM
 
   struct DI : public RegisterBase<0x40018008, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -61,6 +64,7 @@ struct MDR_EEPROM
 
   struct DO : public RegisterBase<0x4001800C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -70,11 +74,13 @@ struct MDR_EEPROM
 
   struct KEY : public RegisterBase<0x40018010, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
   using KEYPack  = Register<0x40018010, 32, ReadWriteMode, MDR_EEPROMKEYBase, T...> ;
 
+  using Registers = TypesList<MDR_EEPROM::CMD, MDR_EEPROM::ADDR, MDR_EEPROM::DI, MDR_EEPROM::DO, MDR_EEPROM::KEY> ;
 } ;
 
 #endif //#if !defined(MDREEPROMREGISTERS_HPP)
@@ -37,6 +37,7 @@ struct MDR_PORTA
     using Pin_13 = MDR_PORTA_RXTX_Pin_13_Values<MDR_PORTA::RXTX, 13, 1, ReadWriteMode, MDR_PORTARXTXBase> ;
     using Pin_14 = MDR_PORTA_RXTX_Pin_14_Values<MDR_PORTA::RXTX, 14, 1, ReadWriteMode, MDR_PORTARXTXBase> ;
     using Pin_15 = MDR_PORTA_RXTX_Pin_15_Values<MDR_PORTA::RXTX, 15, 1, ReadWriteMode, MDR_PORTARXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTA_RXTX_Pin_15_Values<MDR_PORTA::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +64,7 @@ struct MDR_PORTA
     using Pin_13 = MDR_PORTA_OE_Pin_13_Values<MDR_PORTA::OE, 13, 1, ReadWriteMode, MDR_PORTAOEBase> ;
     using Pin_14 = MDR_PORTA_OE_Pin_14_Values<MDR_PORTA::OE, 14, 1, ReadWriteMode, MDR_PORTAOEBase> ;
     using Pin_15 = MDR_PORTA_OE_Pin_15_Values<MDR_PORTA::OE, 15, 1, ReadWriteMode, MDR_PORTAOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTA_OE_Pin_15_Values<MDR_PORTA::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +91,7 @@ struct MDR_PORTA
     using Pin_13 = MDR_PORTA_FUNC_Pin_13_Values<MDR_PORTA::FUNC, 26, 2, ReadWriteMode, MDR_PORTAFUNCBase> ;
     using Pin_14 = MDR_PORTA_FUNC_Pin_14_Values<MDR_PORTA::FUNC, 28, 2, ReadWriteMode, MDR_PORTAFUNCBase> ;
     using Pin_15 = MDR_PORTA_FUNC_Pin_15_Values<MDR_PORTA::FUNC, 30, 2, ReadWriteMode, MDR_PORTAFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_FUNC_Pin_15_Values<MDR_PORTA::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +118,7 @@ struct MDR_PORTA
     using Pin_13 = MDR_PORTA_ANALOG_Pin_13_Values<MDR_PORTA::ANALOG, 13, 1, ReadWriteMode, MDR_PORTAANALOGBase> ;
     using Pin_14 = MDR_PORTA_ANALOG_Pin_14_Values<MDR_PORTA::ANALOG, 14, 1, ReadWriteMode, MDR_PORTAANALOGBase> ;
     using Pin_15 = MDR_PORTA_ANALOG_Pin_15_Values<MDR_PORTA::ANALOG, 15, 1, ReadWriteMode, MDR_PORTAANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTA_ANALOG_Pin_15_Values<MDR_PORTA::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +161,7 @@ struct MDR_PORTA
     using UP_Pin_13 = MDR_PORTA_PULL_UP_Pin_13_Values<MDR_PORTA::PULL, 29, 1, ReadWriteMode, MDR_PORTAPULLBase> ;
     using UP_Pin_14 = MDR_PORTA_PULL_UP_Pin_14_Values<MDR_PORTA::PULL, 30, 1, ReadWriteMode, MDR_PORTAPULLBase> ;
     using UP_Pin_15 = MDR_PORTA_PULL_UP_Pin_15_Values<MDR_PORTA::PULL, 31, 1, ReadWriteMode, MDR_PORTAPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_PULL_UP_Pin_15_Values<MDR_PORTA::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -199,6 +204,7 @@ struct MDR_PORTA
     using Schmitt_Pin_13 = MDR_PORTA_PD_Schmitt_Pin_13_Values<MDR_PORTA::PD, 29, 1, ReadWriteMode, MDR_PORTAPDBase> ;
     using Schmitt_Pin_14 = MDR_PORTA_PD_Schmitt_Pin_14_Values<MDR_PORTA::PD, 30, 1, ReadWriteMode, MDR_PORTAPDBase> ;
     using Schmitt_Pin_15 = MDR_PORTA_PD_Schmitt_Pin_15_Values<MDR_PORTA::PD, 31, 1, ReadWriteMode, MDR_PORTAPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_PD_Schmitt_Pin_15_Values<MDR_PORTA::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -225,6 +231,7 @@ struct MDR_PORTA
     using Pin_13 = MDR_PORTA_PWR_Pin_13_Values<MDR_PORTA::PWR, 26, 2, ReadWriteMode, MDR_PORTAPWRBase> ;
     using Pin_14 = MDR_PORTA_PWR_Pin_14_Values<MDR_PORTA::PWR, 28, 2, ReadWriteMode, MDR_PORTAPWRBase> ;
     using Pin_15 = MDR_PORTA_PWR_Pin_15_Values<MDR_PORTA::PWR, 30, 2, ReadWriteMode, MDR_PORTAPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_PWR_Pin_15_Values<MDR_PORTA::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,12 +258,14 @@ struct MDR_PORTA
     using Pin_13 = MDR_PORTA_GFEN_Pin_13_Values<MDR_PORTA::GFEN, 13, 1, ReadWriteMode, MDR_PORTAGFENBase> ;
     using Pin_14 = MDR_PORTA_GFEN_Pin_14_Values<MDR_PORTA::GFEN, 14, 1, ReadWriteMode, MDR_PORTAGFENBase> ;
     using Pin_15 = MDR_PORTA_GFEN_Pin_15_Values<MDR_PORTA::GFEN, 15, 1, ReadWriteMode, MDR_PORTAGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTA_GFEN_Pin_15_Values<MDR_PORTA::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x4008001C, 32, ReadWriteMode, MDR_PORTAGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTA::RXTX, MDR_PORTA::OE, MDR_PORTA::FUNC, MDR_PORTA::ANALOG, MDR_PORTA::PULL, MDR_PORTA::PD, MDR_PORTA::PWR, MDR_PORTA::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTAREGISTERS_HPP)
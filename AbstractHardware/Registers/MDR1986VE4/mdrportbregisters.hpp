@@ -37,6 +37,7 @@ struct MDR_PORTB
     using Pin_13 = MDR_PORTB_RXTX_Pin_13_Values<MDR_PORTB::RXTX, 13, 1, ReadWriteMode, MDR_PORTBRXTXBase> ;
     using Pin_14 = MDR_PORTB_RXTX_Pin_14_Values<MDR_PORTB::RXTX, 14, 1, ReadWriteMode, MDR_PORTBRXTXBase> ;
     using Pin_15 = MDR_PORTB_RXTX_Pin_15_Values<MDR_PORTB::RXTX, 15, 1, ReadWriteMode, MDR_PORTBRXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTB_RXTX_Pin_15_Values<MDR_PORTB::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +64,7 @@ struct MDR_PORTB
     using Pin_13 = MDR_PORTB_OE_Pin_13_Values<MDR_PORTB::OE, 13, 1, ReadWriteMode, MDR_PORTBOEBase> ;
     using Pin_14 = MDR_PORTB_OE_Pin_14_Values<MDR_PORTB::OE, 14, 1, ReadWriteMode, MDR_PORTBOEBase> ;
     using Pin_15 = MDR_PORTB_OE_Pin_15_Values<MDR_PORTB::OE, 15, 1, ReadWriteMode, MDR_PORTBOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTB_OE_Pin_15_Values<MDR_PORTB::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +91,7 @@ struct MDR_PORTB
     using Pin_13 = MDR_PORTB_FUNC_Pin_13_Values<MDR_PORTB::FUNC, 26, 2, ReadWriteMode, MDR_PORTBFUNCBase> ;
     using Pin_14 = MDR_PORTB_FUNC_Pin_14_Values<MDR_PORTB::FUNC, 28, 2, ReadWriteMode, MDR_PORTBFUNCBase> ;
     using Pin_15 = MDR_PORTB_FUNC_Pin_15_Values<MDR_PORTB::FUNC, 30, 2, ReadWriteMode, MDR_PORTBFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_FUNC_Pin_15_Values<MDR_PORTB::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +118,7 @@ struct MDR_PORTB
     using Pin_13 = MDR_PORTB_ANALOG_Pin_13_Values<MDR_PORTB::ANALOG, 13, 1, ReadWriteMode, MDR_PORTBANALOGBase> ;
     using Pin_14 = MDR_PORTB_ANALOG_Pin_14_Values<MDR_PORTB::ANALOG, 14, 1, ReadWriteMode, MDR_PORTBANALOGBase> ;
     using Pin_15 = MDR_PORTB_ANALOG_Pin_15_Values<MDR_PORTB::ANALOG, 15, 1, ReadWriteMode, MDR_PORTBANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTB_ANALOG_Pin_15_Values<MDR_PORTB::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +161,7 @@ struct MDR_PORTB
     using UP_Pin_13 = MDR_PORTB_PULL_UP_Pin_13_Values<MDR_PORTB::PULL, 29, 1, ReadWriteMode, MDR_PORTBPULLBase> ;
     using UP_Pin_14 = MDR_PORTB_PULL_UP_Pin_14_Values<MDR_PORTB::PULL, 30, 1, ReadWriteMode, MDR_PORTBPULLBase> ;
     using UP_Pin_15 = MDR_PORTB_PULL_UP_Pin_15_Values<MDR_PORTB::PULL, 31, 1, ReadWriteMode, MDR_PORTBPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_PULL_UP_Pin_15_Values<MDR_PORTB::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -199,6 +204,7 @@ struct MDR_PORTB
     using Schmitt_Pin_13 = MDR_PORTB_PD_Schmitt_Pin_13_Values<MDR_PORTB::PD, 29, 1, ReadWriteMode, MDR_PORTBPDBase> ;
     using Schmitt_Pin_14 = MDR_PORTB_PD_Schmitt_Pin_14_Values<MDR_PORTB::PD, 30, 1, ReadWriteMode, MDR_PORTBPDBase> ;
     using Schmitt_Pin_15 = MDR_PORTB_PD_Schmitt_Pin_15_Values<MDR_PORTB::PD, 31, 1, ReadWriteMode, MDR_PORTBPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_PD_Schmitt_Pin_15_Values<MDR_PORTB::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -225,6 +231,7 @@ struct MDR_PORTB
     using Pin_13 = MDR_PORTB_PWR_Pin_13_Values<MDR_PORTB::PWR, 26, 2, ReadWriteMode, MDR_PORTBPWRBase> ;
     using Pin_14 = MDR_PORTB_PWR_Pin_14_Values<MDR_PORTB::PWR, 28, 2, ReadWriteMode, MDR_PORTBPWRBase> ;
     using Pin_15 = MDR_PORTB_PWR_Pin_15_Values<MDR_PORTB::PWR, 30, 2, ReadWriteMode, MDR_PORTBPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_PWR_Pin_15_Values<MDR_PORTB::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,12 +258,14 @@ struct MDR_PORTB
     using Pin_13 = MDR_PORTB_GFEN_Pin_13_Values<MDR_PORTB::GFEN, 13, 1, ReadWriteMode, MDR_PORTBGFENBase> ;
     using Pin_14 = MDR_PORTB_GFEN_Pin_14_Values<MDR_PORTB::GFEN, 14, 1, ReadWriteMode, MDR_PORTBGFENBase> ;
     using Pin_15 = MDR_PORTB_GFEN_Pin_15_Values<MDR_PORTB::GFEN, 15, 1, ReadWriteMode, MDR_PORTBGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTB_GFEN_Pin_15_Values<MDR_PORTB::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x4008801C, 32, ReadWriteMode, MDR_PORTBGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTB::RXTX, MDR_PORTB::OE, MDR_PORTB::FUNC, MDR_PORTB::ANALOG, MDR_PORTB::PULL, MDR_PORTB::PD, MDR_PORTB::PWR, MDR_PORTB::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTBREGISTERS_HPP)
@@ -37,6 +37,7 @@ struct MDR_PORTC
     using Pin_13 = MDR_PORTC_RXTX_Pin_13_Values<MDR_PORTC::RXTX, 13, 1, ReadWriteMode, MDR_PORTCRXTXBase> ;
     using Pin_14 = MDR_PORTC_RXTX_Pin_14_Values<MDR_PORTC::RXTX, 14, 1, ReadWriteMode, MDR_PORTCRXTXBase> ;
     using Pin_15 = MDR_PORTC_RXTX_Pin_15_Values<MDR_PORTC::RXTX, 15, 1, ReadWriteMode, MDR_PORTCRXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTC_RXTX_Pin_15_Values<MDR_PORTC::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +64,7 @@ struct MDR_PORTC
     using Pin_13 = MDR_PORTC_OE_Pin_13_Values<MDR_PORTC::OE, 13, 1, ReadWriteMode, MDR_PORTCOEBase> ;
     using Pin_14 = MDR_PORTC_OE_Pin_14_Values<MDR_PORTC::OE, 14, 1, ReadWriteMode, MDR_PORTCOEBase> ;
     using Pin_15 = MDR_PORTC_OE_Pin_15_Values<MDR_PORTC::OE, 15, 1, ReadWriteMode, MDR_PORTCOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTC_OE_Pin_15_Values<MDR_PORTC::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +91,7 @@ struct MDR_PORTC
     using Pin_13 = MDR_PORTC_FUNC_Pin_13_Values<MDR_PORTC::FUNC, 26, 2, ReadWriteMode, MDR_PORTCFUNCBase> ;
     using Pin_14 = MDR_PORTC_FUNC_Pin_14_Values<MDR_PORTC::FUNC, 28, 2, ReadWriteMode, MDR_PORTCFUNCBase> ;
     using Pin_15 = MDR_PORTC_FUNC_Pin_15_Values<MDR_PORTC::FUNC, 30, 2, ReadWriteMode, MDR_PORTCFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_FUNC_Pin_15_Values<MDR_PORTC::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +118,7 @@ struct MDR_PORTC
     using Pin_13 = MDR_PORTC_ANALOG_Pin_13_Values<MDR_PORTC::ANALOG, 13, 1, ReadWriteMode, MDR_PORTCANALOGBase> ;
     using Pin_14 = MDR_PORTC_ANALOG_Pin_14_Values<MDR_PORTC::ANALOG, 14, 1, ReadWriteMode, MDR_PORTCANALOGBase> ;
     using Pin_15 = MDR_PORTC_ANALOG_Pin_15_Values<MDR_PORTC::ANALOG, 15, 1, ReadWriteMode, MDR_PORTCANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTC_ANALOG_Pin_15_Values<MDR_PORTC::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +161,7 @@ struct MDR_PORTC
     using UP_Pin_13 = MDR_PORTC_PULL_UP_Pin_13_Values<MDR_PORTC::PULL, 29, 1, ReadWriteMode, MDR_PORTCPULLBase> ;
     using UP_Pin_14 = MDR_PORTC_PULL_UP_Pin_14_Values<MDR_PORTC::PULL, 30, 1, ReadWriteMode, MDR_PORTCPULLBase> ;
     using UP_Pin_15 = MDR_PORTC_PULL_UP_Pin_15_Values<MDR_PORTC::PULL, 31, 1, ReadWriteMode, MDR_PORTCPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_PULL_UP_Pin_15_Values<MDR_PORTC::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -199,6 +204,7 @@ struct MDR_PORTC
     using Schmitt_Pin_13 = MDR_PORTC_PD_Schmitt_Pin_13_Values<MDR_PORTC::PD, 29, 1, ReadWriteMode, MDR_PORTCPDBase> ;
     using Schmitt_Pin_14 = MDR_PORTC_PD_Schmitt_Pin_14_Values<MDR_PORTC::PD, 30, 1, ReadWriteMode, MDR_PORTCPDBase> ;
     using Schmitt_Pin_15 = MDR_PORTC_PD_Schmitt_Pin_15_Values<MDR_PORTC::PD, 31, 1, ReadWriteMode, MDR_PORTCPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_PD_Schmitt_Pin_15_Values<MDR_PORTC::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -225,6 +231,7 @@ struct MDR_PORTC
     using Pin_13 = MDR_PORTC_PWR_Pin_13_Values<MDR_PORTC::PWR, 26, 2, ReadWriteMode, MDR_PORTCPWRBase> ;
     using Pin_14 = MDR_PORTC_PWR_Pin_14_Values<MDR_PORTC::PWR, 28, 2, ReadWriteMode, MDR_PORTCPWRBase> ;
     using Pin_15 = MDR_PORTC_PWR_Pin_15_Values<MDR_PORTC::PWR, 30, 2, ReadWriteMode, MDR_PORTCPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_PWR_Pin_15_Values<MDR_PORTC::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,12 +258,14 @@ struct MDR_PORTC
     using Pin_13 = MDR_PORTC_GFEN_Pin_13_Values<MDR_PORTC::GFEN, 13, 1, ReadWriteMode, MDR_PORTCGFENBase> ;
     using Pin_14 = MDR_PORTC_GFEN_Pin_14_Values<MDR_PORTC::GFEN, 14, 1, ReadWriteMode, MDR_PORTCGFENBase> ;
     using Pin_15 = MDR_PORTC_GFEN_Pin_15_Values<MDR_PORTC::GFEN, 15, 1, ReadWriteMode, MDR_PORTCGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTC_GFEN_Pin_15_Values<MDR_PORTC::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x4009001C, 32, ReadWriteMode, MDR_PORTCGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTC::RXTX, MDR_PORTC::OE, MDR_PORTC::FUNC, MDR_PORTC::ANALOG, MDR_PORTC::PULL, MDR_PORTC::PD, MDR_PORTC::PWR, MDR_PORTC::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTCREGISTERS_HPP)
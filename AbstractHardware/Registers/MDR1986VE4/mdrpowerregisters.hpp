@@ -31,6 +31,7 @@ struct MDR_Power
     using INVB = MDR_Power_PVDCS_INVB_Values<MDR_Power::PVDCS, 10, 1, ReadWriteMode, MDR_PowerPVDCSBase> ;
     using INV = MDR_Power_PVDCS_INV_Values<MDR_Power::PVDCS, 11, 1, ReadWriteMode, MDR_PowerPVDCSBase> ;
     using PVDBEN = MDR_Power_PVDCS_PVDBEN_Values<MDR_Power::PVDCS, 12, 1, ReadWriteMode, MDR_PowerPVDCSBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
     using FieldValues = MDR_Power_PVDCS_PVDBEN_Values<MDR_Power::PVDCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,6 +49,7 @@ struct MDR_Power
   template<typename... T> 
   using ResRegPack  = Register<0x40058004, 32, ReadMode, MDR_PowerResRegBase, T...> ;
 
+  using Registers = TypesList<MDR_Power::PVDCS, MDR_Power::ResReg> ;
 } ;
 
 #endif //#if !defined(MDRPOWERREGISTERS_HPP)
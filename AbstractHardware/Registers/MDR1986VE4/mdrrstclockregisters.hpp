@@ -36,6 +36,7 @@ struct MDR_RST_CLOCK
     using PLL_CPU_ON = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_ON_Values<MDR_RST_CLOCK::PLL_CONTROL, 2, 1, ReadWriteMode, MDR_RST_CLOCKPLL_CONTROLBase> ;
     using PLL_CPU_PLD = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_PLD_Values<MDR_RST_CLOCK::PLL_CONTROL, 3, 1, ReadWriteMode, MDR_RST_CLOCKPLL_CONTROLBase> ;
     using PLL_CPU_MUL = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_MUL_Values<MDR_RST_CLOCK::PLL_CONTROL, 8, 4, ReadWriteMode, MDR_RST_CLOCKPLL_CONTROLBase> ;
+    static constexpr Type SnapshotMask = 0xF0CU ;
     using FieldValues = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_MUL_Values<MDR_RST_CLOCK::PLL_CONTROL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,6 +49,7 @@ struct MDR_RST_CLOCK
   {
     using HSE_ON = MDR_RST_CLOCK_HS_CONTROL_HSE_ON_Values<MDR_RST_CLOCK::HS_CONTROL, 0, 1, ReadWriteMode, MDR_RST_CLOCKHS_CONTROLBase> ;
     using HSE_BYP = MDR_RST_CLOCK_HS_CONTROL_HSE_BYP_Values<MDR_RST_CLOCK::HS_CONTROL, 1, 1, ReadWriteMode, MDR_RST_CLOCKHS_CONTROLBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = MDR_RST_CLOCK_HS_CONTROL_HSE_BYP_Values<MDR_RST_CLOCK::HS_CONTROL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct MDR_RST_CLOCK
     using CPU_C2_SEL = MDR_RST_CLOCK_CPU_CLOCK_CPU_C2_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 2, 1, ReadWriteMode, MDR_RST_CLOCKCPU_CLOCKBase> ;
     using CPU_C3_SEL = MDR_RST_CLOCK_CPU_CLOCK_CPU_C3_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 4, 4, ReadWriteMode, MDR_RST_CLOCKCPU_CLOCKBase> ;
     using HCLK_SEL = MDR_RST_CLOCK_CPU_CLOCK_HCLK_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 8, 2, ReadWriteMode, MDR_RST_CLOCKCPU_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3F7U ;
     using FieldValues = MDR_RST_CLOCK_CPU_CLOCK_HCLK_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +79,7 @@ struct MDR_RST_CLOCK
     using PER1_C2_SEL = MDR_RST_CLOCK_PER1_CLOCK_PER1_C2_SEL_Values<MDR_RST_CLOCK::PER1_CLOCK, 2, 2, ReadWriteMode, MDR_RST_CLOCKPER1_CLOCKBase> ;
     using DEBUG_EN = MDR_RST_CLOCK_PER1_CLOCK_DEBUG_EN_Values<MDR_RST_CLOCK::PER1_CLOCK, 4, 1, ReadWriteMode, MDR_RST_CLOCKPER1_CLOCKBase> ;
     using DMA_EN = MDR_RST_CLOCK_PER1_CLOCK_DMA_EN_Values<MDR_RST_CLOCK::PER1_CLOCK, 5, 1, ReadWriteMode, MDR_RST_CLOCKPER1_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = MDR_RST_CLOCK_PER1_CLOCK_DMA_EN_Values<MDR_RST_CLOCK::PER1_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +96,7 @@ struct MDR_RST_CLOCK
     using ADCIU_C3_SEL = MDR_RST_CLOCK_ADC_CLOCK_ADCIU_C3_SEL_Values<MDR_RST_CLOCK::ADC_CLOCK, 8, 4, ReadWriteMode, MDR_RST_CLOCKADC_CLOCKBase> ;
     using ADCIU_CLK_EN = MDR_RST_CLOCK_ADC_CLOCK_ADCIU_CLK_EN_Values<MDR_RST_CLOCK::ADC_CLOCK, 12, 1, ReadWriteMode, MDR_RST_CLOCKADC_CLOCKBase> ;
     using ADC_CLK_EN = MDR_RST_CLOCK_ADC_CLOCK_ADC_CLK_EN_Values<MDR_RST_CLOCK::ADC_CLOCK, 13, 1, ReadWriteMode, MDR_RST_CLOCKADC_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFU ;
     using FieldValues = MDR_RST_CLOCK_ADC_CLOCK_ADC_CLK_EN_Values<MDR_RST_CLOCK::ADC_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +111,7 @@ struct MDR_RST_CLOCK
     using HSI_SEL = MDR_RST_CLOCK_RTC_CLOCK_HSI_SEL_Values<MDR_RST_CLOCK::RTC_CLOCK, 4, 4, ReadWriteMode, MDR_RST_CLOCKRTC_CLOCKBase> ;
     using HSE_RTC_EN = MDR_RST_CLOCK_RTC_CLOCK_HSE_RTC_EN_Values<MDR_RST_CLOCK::RTC_CLOCK, 8, 1, ReadWriteMode, MDR_RST_CLOCKRTC_CLOCKBase> ;
     using HSI_RTC_EN = MDR_RST_CLOCK_RTC_CLOCK_HSI_RTC_EN_Values<MDR_RST_CLOCK::RTC_CLOCK, 9, 1, ReadWriteMode, MDR_RST_CLOCKRTC_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = MDR_RST_CLOCK_RTC_CLOCK_HSI_RTC_EN_Values<MDR_RST_CLOCK::RTC_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct MDR_RST_CLOCK
     using PORTB_CLK_EN = MDR_RST_CLOCK_PER2_CLOCK_PORTB_CLK_EN_Values<MDR_RST_CLOCK::PER2_CLOCK, 17, 1, ReadWriteMode, MDR_RST_CLOCKPER2_CLOCKBase> ;
     using PORTC_CLK_EN = MDR_RST_CLOCK_PER2_CLOCK_PORTC_CLK_EN_Values<MDR_RST_CLOCK::PER2_CLOCK, 18, 1, ReadWriteMode, MDR_RST_CLOCKPER2_CLOCKBase> ;
     using CRC_CLK_EN = MDR_RST_CLOCK_PER2_CLOCK_CRC_CLK_EN_Values<MDR_RST_CLOCK::PER2_CLOCK, 19, 1, ReadWriteMode, MDR_RST_CLOCKPER2_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = MDR_RST_CLOCK_PER2_CLOCK_CRC_CLK_EN_Values<MDR_RST_CLOCK::PER2_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +157,7 @@ struct MDR_RST_CLOCK
     using TIM2_BRG = MDR_RST_CLOCK_TIM_CLOCK_TIM2_BRG_Values<MDR_RST_CLOCK::TIM_CLOCK, 8, 3, ReadWriteMode, MDR_RST_CLOCKTIM_CLOCKBase> ;
     using TIM1_CLK_EN = MDR_RST_CLOCK_TIM_CLOCK_TIM1_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKTIM_CLOCKBase> ;
     using TIM2_CLK_EN = MDR_RST_CLOCK_TIM_CLOCK_TIM2_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 25, 1, ReadWriteMode, MDR_RST_CLOCKTIM_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3000707U ;
     using FieldValues = MDR_RST_CLOCK_TIM_CLOCK_TIM2_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +172,7 @@ struct MDR_RST_CLOCK
     using UART2_BRG = MDR_RST_CLOCK_UART_CLOCK_UART2_BRG_Values<MDR_RST_CLOCK::UART_CLOCK, 8, 3, ReadWriteMode, MDR_RST_CLOCKUART_CLOCKBase> ;
     using UART1_CLK_EN = MDR_RST_CLOCK_UART_CLOCK_UART1_CLK_EN_Values<MDR_RST_CLOCK::UART_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKUART_CLOCKBase> ;
     using UART2_CLK_EN = MDR_RST_CLOCK_UART_CLOCK_UART2_CLK_EN_Values<MDR_RST_CLOCK::UART_CLOCK, 25, 1, ReadWriteMode, MDR_RST_CLOCKUART_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3000707U ;
     using FieldValues = MDR_RST_CLOCK_UART_CLOCK_UART2_CLK_EN_Values<MDR_RST_CLOCK::UART_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,12 +185,14 @@ struct MDR_RST_CLOCK
   {
     using SSP1_BRG = MDR_RST_CLOCK_SSP_CLOCK_SSP1_BRG_Values<MDR_RST_CLOCK::SSP_CLOCK, 0, 3, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase> ;
     using SSP1_CLK_EN = MDR_RST_CLOCK_SSP_CLOCK_SSP1_CLK_EN_Values<MDR_RST_CLOCK::SSP_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x1000007U ;
     using FieldValues = MDR_RST_CLOCK_SSP_CLOCK_SSP1_CLK_EN_Values<MDR_RST_CLOCK::SSP_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SSP_CLOCKPack  = Register<0x4002002C, 32, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase, T...> ;
 
+  using Registers = TypesList<MDR_RST_CLOCK::CLOCK_STATUS, MDR_RST_CLOCK::PLL_CONTROL, MDR_RST_CLOCK::HS_CONTROL, MDR_RST_CLOCK::CPU_CLOCK, MDR_RST_CLOCK::PER1_CLOCK, MDR_RST_CLOCK::ADC_CLOCK, MDR_RST_CLOCK::RTC_CLOCK, MDR_RST_CLOCK::PER2_CLOCK, MDR_RST_CLOCK::TIM_CLOCK, MDR_RST_CLOCK::UART_CLOCK, MDR_RST_CLOCK::SSP_CLOCK> ;
 } ;
 
 #endif //#if !defined(MDRRSTCLOCKREGISTERS_HPP)
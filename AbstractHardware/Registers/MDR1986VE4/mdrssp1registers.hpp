@@ -26,6 +26,7 @@ struct MDR_SSP1
     using SPO = MDR_SSP1_CR0_SPO_Values<MDR_SSP1::CR0, 6, 1, ReadWriteMode, MDR_SSP1CR0Base> ;
     using SPH = MDR_SSP1_CR0_SPH_Values<MDR_SSP1::CR0, 7, 1, ReadWriteMode, MDR_SSP1CR0Base> ;
     using SCR = MDR_SSP1_CR0_SCR_Values<MDR_SSP1::CR0, 8, 8, ReadWriteMode, MDR_SSP1CR0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_SSP1_CR0_SCR_Values<MDR_SSP1::CR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,7 @@ struct MDR_SSP1
     using SSE = MDR_SSP1_CR1_SSE_Values<MDR_SSP1::CR1, 1, 1, ReadWriteMode, MDR_SSP1CR1Base> ;
     using MS = MDR_SSP1_CR1_MS_Values<MDR_SSP1::CR1, 2, 1, ReadWriteMode, MDR_SSP1CR1Base> ;
     using SOD = MDR_SSP1_CR1_SOD_Values<MDR_SSP1::CR1, 3, 1, ReadWriteMode, MDR_SSP1CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = MDR_SSP1_CR1_SOD_Values<MDR_SSP1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +53,7 @@ struct MDR_SSP1
   struct DR : public RegisterBase<0x40000008, 32, ReadWriteMode>
   {
     using Data = MDR_SSP1_DR_Data_Values<MDR_SSP1::DR, 0, 16, ReadWriteMode, MDR_SSP1DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_SSP1_DR_Data_Values<MDR_SSP1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +80,7 @@ struct MDR_SSP1
   struct CPSR : public RegisterBase<0x40000010, 32, ReadWriteMode>
   {
     using CPSDVSR = MDR_SSP1_CPSR_CPSDVSR_Values<MDR_SSP1::CPSR, 0, 8, ReadWriteMode, MDR_SSP1CPSRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_SSP1_CPSR_CPSDVSR_Values<MDR_SSP1::CPSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +95,7 @@ struct MDR_SSP1
     using RTIM = MDR_SSP1_IMSC_RTIM_Values<MDR_SSP1::IMSC, 1, 1, ReadWriteMode, MDR_SSP1IMSCBase> ;
     using RXIM = MDR_SSP1_IMSC_RXIM_Values<MDR_SSP1::IMSC, 2, 1, ReadWriteMode, MDR_SSP1IMSCBase> ;
     using TXIM = MDR_SSP1_IMSC_TXIM_Values<MDR_SSP1::IMSC, 3, 1, ReadWriteMode, MDR_SSP1IMSCBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = MDR_SSP1_IMSC_TXIM_Values<MDR_SSP1::IMSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,12 +148,14 @@ struct MDR_SSP1
   {
     using RXDMAE = MDR_SSP1_DMACR_RXDMAE_Values<MDR_SSP1::DMACR, 0, 1, ReadWriteMode, MDR_SSP1DMACRBase> ;
     using TXDMAE = MDR_SSP1_DMACR_TXDMAE_Values<MDR_SSP1::DMACR, 1, 1, ReadWriteMode, MDR_SSP1DMACRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = MDR_SSP1_DMACR_TXDMAE_Values<MDR_SSP1::DMACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMACRPack  = Register<0x40000024, 32, ReadWriteMode, MDR_SSP1DMACRBase, T...> ;
 
+  using Registers = TypesList<MDR_SSP1::CR0, MDR_SSP1::CR1, MDR_SSP1::DR, MDR_SSP1::SR, MDR_SSP1::CPSR, MDR_SSP1::IMSC, MDR_SSP1::RIS, MDR_SSP1::MIS, MDR_SSP1::ICR, MDR_SSP1::DMACR> ;
 } ;
 
 #endif //#if !defined(MDRSSP1REGISTERS_HPP)
@@ -26,6 +26,7 @@ struct MDR_UART1
     using PE = MDR_UART1_DR_PE_Values<MDR_UART1::DR, 9, 1, ReadWriteMode, MDR_UART1DRBase> ;
     using BE = MDR_UART1_DR_BE_Values<MDR_UART1::DR, 10, 1, ReadWriteMode, MDR_UART1DRBase> ;
     using OE = MDR_UART1_DR_OE_Values<MDR_UART1::DR, 11, 1, ReadWriteMode, MDR_UART1DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_UART1_DR_OE_Values<MDR_UART1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,7 @@ struct MDR_UART1
     using PE = MDR_UART1_RSR_ECR_PE_Values<MDR_UART1::RSR_ECR, 1, 1, ReadWriteMode, MDR_UART1RSR_ECRBase> ;
     using BE = MDR_UART1_RSR_ECR_BE_Values<MDR_UART1::RSR_ECR, 2, 1, ReadWriteMode, MDR_UART1RSR_ECRBase> ;
     using OE = MDR_UART1_RSR_ECR_OE_Values<MDR_UART1::RSR_ECR, 3, 1, ReadWriteMode, MDR_UART1RSR_ECRBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = MDR_UART1_RSR_ECR_OE_Values<MDR_UART1::RSR_ECR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +72,7 @@ struct MDR_UART1
   struct ILPR : public RegisterBase<0x40008020, 32, ReadWriteMode>
   {
     using DVSR = MDR_UART1_ILPR_DVSR_Values<MDR_UART1::ILPR, 0, 8, ReadWriteMode, MDR_UART1ILPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_UART1_ILPR_DVSR_Values<MDR_UART1::ILPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +84,7 @@ struct MDR_UART1
   struct IBRD : public RegisterBase<0x40008024, 32, ReadWriteMode>
   {
     using Baud_DivInt = MDR_UART1_IBRD_Baud_DivInt_Values<MDR_UART1::IBRD, 0, 16, ReadWriteMode, MDR_UART1IBRDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_UART1_IBRD_Baud_DivInt_Values<MDR_UART1::IBRD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +96,7 @@ struct MDR_UART1
   struct FBRD : public RegisterBase<0x40008028, 32, ReadWriteMode>
   {
     using Baud_DivFrac = MDR_UART1_FBRD_Baud_DivFrac_Values<MDR_UART1::FBRD, 0, 6, ReadWriteMode, MDR_UART1FBRDBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = MDR_UART1_FBRD_Baud_DivFrac_Values<MDR_UART1::FBRD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_UART1
     using FEN = MDR_UART1_LCR_H_FEN_Values<MDR_UART1::LCR_H, 4, 1, ReadWriteMode, MDR_UART1LCR_HBase> ;
     using WLEN = MDR_UART1_LCR_H_WLEN_Values<MDR_UART1::LCR_H, 5, 2, ReadWriteMode, MDR_UART1LCR_HBase> ;
     using SPS = MDR_UART1_LCR_H_SPS_Values<MDR_UART1::LCR_H, 7, 1, ReadWriteMode, MDR_UART1LCR_HBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_UART1_LCR_H_SPS_Values<MDR_UART1::LCR_H, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +137,7 @@ struct MDR_UART1
     using Out2 = MDR_UART1_CR_Out2_Values<MDR_UART1::CR, 13, 1, ReadWriteMode, MDR_UART1CRBase> ;
     using RTSEn = MDR_UART1_CR_RTSEn_Values<MDR_UART1::CR, 14, 1, ReadWriteMode, MDR_UART1CRBase> ;
     using CTSEn = MDR_UART1_CR_CTSEn_Values<MDR_UART1::CR, 15, 1, ReadWriteMode, MDR_UART1CRBase> ;
+    static constexpr Type SnapshotMask = 0xFF87U ;
     using FieldValues = MDR_UART1_CR_CTSEn_Values<MDR_UART1::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +150,7 @@ struct MDR_UART1
   {
     using TXIFLSES = MDR_UART1_IFLS_TXIFLSES_Values<MDR_UART1::IFLS, 0, 3, ReadWriteMode, MDR_UART1IFLSBase> ;
     using RXIFLSES = MDR_UART1_IFLS_RXIFLSES_Values<MDR_UART1::IFLS, 3, 3, ReadWriteMode, MDR_UART1IFLSBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = MDR_UART1_IFLS_RXIFLSES_Values<MDR_UART1::IFLS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +172,7 @@ struct MDR_UART1
     using PE_IM = MDR_UART1_IMSC_PE_IM_Values<MDR_UART1::IMSC, 8, 1, ReadWriteMode, MDR_UART1IMSCBase> ;
     using BE_IM = MDR_UART1_IMSC_BE_IM_Values<MDR_UART1::IMSC, 9, 1, ReadWriteMode, MDR_UART1IMSCBase> ;
     using OE_IM = MDR_UART1_IMSC_OE_IM_Values<MDR_UART1::IMSC, 10, 1, ReadWriteMode, MDR_UART1IMSCBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = MDR_UART1_IMSC_OE_IM_Values<MDR_UART1::IMSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +249,7 @@ struct MDR_UART1
     using RXDMAE = MDR_UART1_DMACR_RXDMAE_Values<MDR_UART1::DMACR, 0, 1, ReadWriteMode, MDR_UART1DMACRBase> ;
     using TXDMAE = MDR_UART1_DMACR_TXDMAE_Values<MDR_UART1::DMACR, 1, 1, ReadWriteMode, MDR_UART1DMACRBase> ;
     using DMAonErr = MDR_UART1_DMACR_DMAonErr_Values<MDR_UART1::DMACR, 2, 1, ReadWriteMode, MDR_UART1DMACRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = MDR_UART1_DMACR_DMAonErr_Values<MDR_UART1::DMACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -253,12 +263,14 @@ struct MDR_UART1
     using ITEN = MDR_UART1_TCR_ITEN_Values<MDR_UART1::TCR, 0, 1, ReadWriteMode, MDR_UART1TCRBase> ;
     using TestFIFO = MDR_UART1_TCR_TestFIFO_Values<MDR_UART1::TCR, 1, 1, ReadWriteMode, MDR_UART1TCRBase> ;
     using SIRTest = MDR_UART1_TCR_SIRTest_Values<MDR_UART1::TCR, 2, 1, ReadWriteMode, MDR_UART1TCRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = MDR_UART1_TCR_SIRTest_Values<MDR_UART1::TCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TCRPack  = Register<0x40008080, 32, ReadWriteMode, MDR_UART1TCRBase, T...> ;
 
+  using Registers = TypesList<MDR_UART1::DR, MDR_UART1::RSR_ECR, MDR_UART1::FR, MDR_UART1::ILPR, MDR_UART1::IBRD, MDR_UART1::FBRD, MDR_UART1::LCR_H, MDR_UART1::CR, MDR_UART1::IFLS, MDR_UART1::IMSC, MDR_UART1::RIS, MDR_UART1::MIS, MDR_UART1::ICR, MDR_UART1::DMACR, MDR_UART1::TCR> ;
 } ;
 
 #endif //#if !defined(MDRUART1REGISTERS_HPP)
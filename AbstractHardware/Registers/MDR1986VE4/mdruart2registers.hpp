@@ -26,6 +26,7 @@ struct MDR_UART2
     using PE = MDR_UART2_DR_PE_Values<MDR_UART2::DR, 9, 1, ReadWriteMode, MDR_UART2DRBase> ;
     using BE = MDR_UART2_DR_BE_Values<MDR_UART2::DR, 10, 1, ReadWriteMode, MDR_UART2DRBase> ;
     using OE = MDR_UART2_DR_OE_Values<MDR_UART2::DR, 11, 1, ReadWriteMode, MDR_UART2DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_UART2_DR_OE_Values<MDR_UART2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,7 @@ struct MDR_UART2
     using PE = MDR_UART2_RSR_ECR_PE_Values<MDR_UART2::RSR_ECR, 1, 1, ReadWriteMode, MDR_UART2RSR_ECRBase> ;
     using BE = MDR_UART2_RSR_ECR_BE_Values<MDR_UART2::RSR_ECR, 2, 1, ReadWriteMode, MDR_UART2RSR_ECRBase> ;
     using OE = MDR_UART2_RSR_ECR_OE_Values<MDR_UART2::RSR_ECR, 3, 1, ReadWriteMode, MDR_UART2RSR_ECRBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = MDR_UART2_RSR_ECR_OE_Values<MDR_UART2::RSR_ECR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +72,7 @@ struct MDR_UART2
   struct ILPR : public RegisterBase<0x40010020, 32, ReadWriteMode>
   {
     using DVSR = MDR_UART2_ILPR_DVSR_Values<MDR_UART2::ILPR, 0, 8, ReadWriteMode, MDR_UART2ILPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_UART2_ILPR_DVSR_Values<MDR_UART2::ILPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +84,7 @@ struct MDR_UART2
   struct IBRD : public RegisterBase<0x40010024, 32, ReadWriteMode>
   {
     using Baud_DivInt = MDR_UART2_IBRD_Baud_DivInt_Values<MDR_UART2::IBRD, 0, 16, ReadWriteMode, MDR_UART2IBRDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_UART2_IBRD_Baud_DivInt_Values<MDR_UART2::IBRD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +96,7 @@ struct MDR_UART2
   struct FBRD : public RegisterBase<0x40010028, 32, ReadWriteMode>
   {
     using Baud_DivFrac = MDR_UART2_FBRD_Baud_DivFrac_Values<MDR_UART2::FBRD, 0, 6, ReadWriteMode, MDR_UART2FBRDBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = MDR_UART2_FBRD_Baud_DivFrac_Values<MDR_UART2::FBRD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_UART2
     using FEN = MDR_UART2_LCR_H_FEN_Values<MDR_UART2::LCR_H, 4, 1, ReadWriteMode, MDR_UART2LCR_HBase> ;
     using WLEN = MDR_UART2_LCR_H_WLEN_Values<MDR_UART2::LCR_H, 5, 2, ReadWriteMode, MDR_UART2LCR_HBase> ;
     using SPS = MDR_UART2_LCR_H_SPS_Values<MDR_UART2::LCR_H, 7, 1, ReadWriteMode, MDR_UART2LCR_HBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_UART2_LCR_H_SPS_Values<MDR_UART2::LCR_H, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +137,7 @@ struct MDR_UART2
     using Out2 = MDR_UART2_CR_Out2_Values<MDR_UART2::CR, 13, 1, ReadWriteMode, MDR_UART2CRBase> ;
     using RTSEn = MDR_UART2_CR_RTSEn_Values<MDR_UART2::CR, 14, 1, ReadWriteMode, MDR_UART2CRBase> ;
     using CTSEn = MDR_UART2_CR_CTSEn_Values<MDR_UART2::CR, 15, 1, ReadWriteMode, MDR_UART2CRBase> ;
+    static constexpr Type SnapshotMask = 0xFF87U ;
     using FieldValues = MDR_UART2_CR_CTSEn_Values<MDR_UART2::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +150,7 @@ struct MDR_UART2
   {
     using TXIFLSES = MDR_UART2_IFLS_TXIFLSES_Values<MDR_UART2::IFLS, 0, 3, ReadWriteMode, MDR_UART2IFLSBase> ;
     using RXIFLSES = MDR_UART2_IFLS_RXIFLSES_Values<MDR_UART2::IFLS, 3, 3, ReadWriteMode, MDR_UART2IFLSBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = MDR_UART2_IFLS_RXIFLSES_Values<MDR_UART2::IFLS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +172,7 @@ struct MDR_UART2
     using PE_IM = MDR_UART2_IMSC_PE_IM_Values<MDR_UART2::IMSC, 8, 1, ReadWriteMode, MDR_UART2IMSCBase> ;
     using BE_IM = MDR_UART2_IMSC_BE_IM_Values<MDR_UART2::IMSC, 9, 1, ReadWriteMode, MDR_UART2IMSCBase> ;
     using OE_IM = MDR_UART2_IMSC_OE_IM_Values<MDR_UART2::IMSC, 10, 1, ReadWriteMode, MDR_UART2IMSCBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = MDR_UART2_IMSC_OE_IM_Values<MDR_UART2::IMSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +249,7 @@ struct MDR_UART2
     using RXDMAE = MDR_UART2_DMACR_RXDMAE_Values<MDR_UART2::DMACR, 0, 1, ReadWriteMode, MDR_UART2DMACRBase> ;
     using TXDMAE = MDR_UART2_DMACR_TXDMAE_Values<MDR_UART2::DMACR, 1, 1, ReadWriteMode, MDR_UART2DMACRBase> ;
     using DMAonErr = MDR_UART2_DMACR_DMAonErr_Values<MDR_UART2::DMACR, 2, 1, ReadWriteMode, MDR_UART2DMACRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = MDR_UART2_DMACR_DMAonErr_Values<MDR_UART2::DMACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -253,12 +263,14 @@ struct MDR_UART2
     using ITEN = MDR_UART2_TCR_ITEN_Values<MDR_UART2::TCR, 0, 1, ReadWriteMode, MDR_UART2TCRBase> ;
     using TestFIFO = MDR_UART2_TCR_TestFIFO_Values<MDR_UART2::TCR, 1, 1, ReadWriteMode, MDR_UART2TCRBase> ;
     using SIRTest = MDR_UART2_TCR_SIRTest_Values<MDR_UART2::TCR, 2, 1, ReadWriteMode, MDR_UART2TCRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = MDR_UART2_TCR_SIRTest_Values<MDR_UART2::TCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TCRPack  = Register<0x40010080, 32, ReadWriteMode, MDR_UART2TCRBase, T...> ;
 
+  using Registers = TypesList<MDR_UART2::DR, MDR_UART2::RSR_ECR, MDR_UART2::FR, MDR_UART2::ILPR, MDR_UART2::IBRD, MDR_UART2::FBRD, MDR_UART2::LCR_H, MDR_UART2::CR, MDR_UART2::IFLS, MDR_UART2::IMSC, MDR_UART2::RIS, MDR_UART2::MIS, MDR_UART2::ICR, MDR_UART2::DMACR, MDR_UART2::TCR> ;
 } ;
 
 #endif //#if !defined(MDRUART2REGISTERS_HPP)
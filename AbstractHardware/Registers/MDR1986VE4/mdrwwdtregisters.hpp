@@ -23,6 +23,7 @@ struct MDR_WWDT
   {
     using T = MDR_WWDT_CR_T_Values<MDR_WWDT::CR, 0, 7, ReadWriteMode, MDR_WWDTCRBase> ;
     using WDGA = MDR_WWDT_CR_WDGA_Values<MDR_WWDT::CR, 7, 1, ReadWriteMode, MDR_WWDTCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_WWDT_CR_WDGA_Values<MDR_WWDT::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -36,6 +37,7 @@ struct MDR_WWDT
     using W = MDR_WWDT_CFR_W_Values<MDR_WWDT::CFR, 0, 7, ReadWriteMode, MDR_WWDTCFRBase> ;
     using WGTB = MDR_WWDT_CFR_WGTB_Values<MDR_WWDT::CFR, 7, 2, ReadWriteMode, MDR_WWDTCFRBase> ;
     using EWI = MDR_WWDT_CFR_EWI_Values<MDR_WWDT::CFR, 9, 1, ReadWriteMode, MDR_WWDTCFRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = MDR_WWDT_CFR_EWI_Values<MDR_WWDT::CFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,12 +49,14 @@ struct MDR_WWDT
   struct SR : public RegisterBase<0x40048008, 32, ReadWriteMode>
   {
     using EWIF = MDR_WWDT_SR_EWIF_Values<MDR_WWDT::SR, 0, 1, ReadWriteMode, MDR_WWDTSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_WWDT_SR_EWIF_Values<MDR_WWDT::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SRPack  = Register<0x40048008, 32, ReadWriteMode, MDR_WWDTSRBase, T...> ;
 
+  using Registers = TypesList<MDR_WWDT::CR, MDR_WWDT::CFR, MDR_WWDT::SR> ;
 } ;
 
 #endif //#if !defined(MDRWWDTREGISTERS_HPP)
@@ -38,6 +38,7 @@ struct MDR_ADC
     using TR = MDR_ADC_ADC1_Cfg_TR_Values<MDR_ADC::ADC1_Cfg, 21, 4, ReadWriteMode, MDR_ADCADC1_CfgBase> ;
     using Delay_GO = MDR_ADC_ADC1_Cfg_Delay_GO_Values<MDR_ADC::ADC1_Cfg, 25, 3, ReadWriteMode, MDR_ADCADC1_CfgBase> ;
     using Delay_ADC = MDR_ADC_ADC1_Cfg_Delay_ADC_Values<MDR_ADC::ADC1_Cfg, 28, 4, ReadWriteMode, MDR_ADCADC1_CfgBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_ADC_ADC1_Cfg_Delay_ADC_Values<MDR_ADC::ADC1_Cfg, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +61,7 @@ struct MDR_ADC
     using ADC1_OP = MDR_ADC_ADC2_Cfg_ADC1_OP_Values<MDR_ADC::ADC2_Cfg, 17, 1, ReadWriteMode, MDR_ADCADC2_CfgBase> ;
     using ADC2_OP = MDR_ADC_ADC2_Cfg_ADC2_OP_Values<MDR_ADC::ADC2_Cfg, 18, 1, ReadWriteMode, MDR_ADCADC2_CfgBase> ;
     using Delay_GO = MDR_ADC_ADC2_Cfg_Delay_GO_Values<MDR_ADC::ADC2_Cfg, 25, 3, ReadWriteMode, MDR_ADCADC2_CfgBase> ;
+    static constexpr Type SnapshotMask = 0xE06FFFFU ;
     using FieldValues = MDR_ADC_ADC2_Cfg_Delay_GO_Values<MDR_ADC::ADC2_Cfg, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct MDR_ADC
   struct ADC1_H_Level : public RegisterBase<0x40088008, 32, ReadWriteMode>
   {
     using Level = MDR_ADC_ADC1_H_Level_Level_Values<MDR_ADC::ADC1_H_Level, 0, 12, ReadWriteMode, MDR_ADCADC1_H_LevelBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = MDR_ADC_ADC1_H_Level_Level_Values<MDR_ADC::ADC1_H_Level, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +85,7 @@ struct MDR_ADC
   struct ADC2_H_Level : public RegisterBase<0x4008800C, 32, ReadWriteMode>
   {
     //using FieldValues = <MDR_ADC::ADC2_H_Level, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -92,6 +96,7 @@ struct MDR_ADC
   struct ADC1_L_Level : public RegisterBase<0x40088010, 32, ReadWriteMode>
   {
     //using FieldValues = <MDR_ADC::ADC1_L_Level, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -102,6 +107,7 @@ struct MDR_ADC
   struct ADC2_L_Level : public RegisterBase<0x40088014, 32, ReadWriteMode>
   {
     //using FieldValues = <MDR_ADC::ADC2_L_Level, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -124,6 +130,7 @@ struct MDR_ADC
   struct ADC2_RESULT : public RegisterBase<0x4008801C, 32, ReadWriteMode>
   {
     //using FieldValues = <MDR_ADC::ADC2_RESULT, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -139,6 +146,7 @@ struct MDR_ADC
     using AWOIF_IE = MDR_ADC_ADC1_STATUS_AWOIF_IE_Values<MDR_ADC::ADC1_STATUS, 3, 1, ReadWriteMode, MDR_ADCADC1_STATUSBase> ;
     using EOCIF_EN = MDR_ADC_ADC1_STATUS_EOCIF_EN_Values<MDR_ADC::ADC1_STATUS, 4, 1, ReadWriteMode, MDR_ADCADC1_STATUSBase> ;
     //using FieldValues = MDR_ADC_ADC1_STATUS_EOCIF_EN_Values<MDR_ADC::ADC1_STATUS, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
   } ;
 
   template<typename... T> 
@@ -149,6 +157,7 @@ struct MDR_ADC
   struct ADC2_STATUS : public RegisterBase<0x40088024, 32, ReadWriteMode>
   {
     //using FieldValues = <MDR_ADC::ADC2_STATUS, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
@@ -176,6 +185,7 @@ struct MDR_ADC
     using Channel_15 = MDR_ADC_ADC1_CHSEL_Channel_15_Values<MDR_ADC::ADC1_CHSEL, 15, 1, ReadWriteMode, MDR_ADCADC1_CHSELBase> ;
     using Channel_30 = MDR_ADC_ADC1_CHSEL_Channel_30_Values<MDR_ADC::ADC1_CHSEL, 30, 1, ReadWriteMode, MDR_ADCADC1_CHSELBase> ;
     using Channel_31 = MDR_ADC_ADC1_CHSEL_Channel_31_Values<MDR_ADC::ADC1_CHSEL, 31, 1, ReadWriteMode, MDR_ADCADC1_CHSELBase> ;
+    static constexpr Type SnapshotMask = 0xC000FFFFU ;
     using FieldValues = MDR_ADC_ADC1_CHSEL_Channel_31_Values<MDR_ADC::ADC1_CHSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -187,11 +197,13 @@ struct MDR_ADC
   struct ADC2_CHSEL : public RegisterBase<0x4008802C, 32, ReadWriteMode>
   {
     //using FieldValues = <MDR_ADC::ADC2_CHSEL, 0, 0, NoAccess, NoAccess> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
   using ADC2_CHSELPack  = Register<0x4008802C, 32, ReadWriteMode, MDR_ADCADC2_CHSELBase, T...> ;
 
+  using Registers = TypesList<MDR_ADC::ADC1_Cfg, MDR_ADC::ADC2_Cfg, MDR_ADC::ADC1_H_Level, MDR_ADC::ADC2_H_Level, MDR_ADC::ADC1_L_Level, MDR_ADC::ADC2_L_Level, MDR_ADC::ADC1_RESULT, MDR_ADC::ADC2_RESULT, MDR_ADC::ADC1_STATUS, MDR_ADC::ADC2_STATUS, MDR_ADC::ADC1_CHSEL, MDR_ADC::ADC2_CHSEL> ;
 } ;
 
 #endif //#if !defined(MDRADCREGISTERS_HPP)
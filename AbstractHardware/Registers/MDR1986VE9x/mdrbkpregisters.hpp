@@ -28,6 +28,7 @@ struct MDR_BKP
     using Trim_dDUcc = MDR_BKP_REG_0E_Trim_dDUcc_Values<MDR_BKP::REG_0E, 8, 3, ReadWriteMode, MDR_BKPREG_0EBase> ;
     using FPOR = MDR_BKP_REG_0E_FPOR_Values<MDR_BKP::REG_0E, 11, 1, ReadWriteMode, MDR_BKPREG_0EBase> ;
     using MODE = MDR_BKP_REG_0E_MODE_Values<MDR_BKP::REG_0E, 12, 3, ReadWriteMode, MDR_BKPREG_0EBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = MDR_BKP_REG_0E_MODE_Values<MDR_BKP::REG_0E, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +53,7 @@ struct MDR_BKP
     using HSI_TRIM = MDR_BKP_REG_0F_HSI_TRIM_Values<MDR_BKP::REG_0F, 24, 6, ReadWriteMode, MDR_BKPREG_0FBase> ;
     using Standby = MDR_BKP_REG_0F_Standby_Values<MDR_BKP::REG_0F, 30, 1, ReadWriteMode, MDR_BKPREG_0FBase> ;
     using RTC_RESET = MDR_BKP_REG_0F_RTC_RESET_Values<MDR_BKP::REG_0F, 31, 1, ReadWriteMode, MDR_BKPREG_0FBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF9FFFU ;
     using FieldValues = MDR_BKP_REG_0F_RTC_RESET_Values<MDR_BKP::REG_0F, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct MDR_BKP
 
   struct RTC_CNT : public RegisterBase<0x400D8040, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::RTC_CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +76,7 @@ struct MDR_BKP
   struct RTC_DIV : public RegisterBase<0x400D8044, 32, ReadWriteMode>
   {
     using Value = MDR_BKP_RTC_DIV_Value_Values<MDR_BKP::RTC_DIV, 0, 20, ReadWriteMode, MDR_BKPRTC_DIVBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = MDR_BKP_RTC_DIV_Value_Values<MDR_BKP::RTC_DIV, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +88,7 @@ struct MDR_BKP
   struct RTC_PRL : public RegisterBase<0x400D8048, 32, ReadWriteMode>
   {
     using Value = MDR_BKP_RTC_PRL_Value_Values<MDR_BKP::RTC_PRL, 0, 20, ReadWriteMode, MDR_BKPRTC_PRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = MDR_BKP_RTC_PRL_Value_Values<MDR_BKP::RTC_PRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +100,7 @@ struct MDR_BKP
   struct RTC_ALRM : public RegisterBase<0x400D804C, 32, ReadWriteMode>
   {
     using Value = MDR_BKP_RTC_ALRM_Value_Values<MDR_BKP::RTC_ALRM, 0, 32, ReadWriteMode, MDR_BKPRTC_ALRMBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_BKP_RTC_ALRM_Value_Values<MDR_BKP::RTC_ALRM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +118,7 @@ struct MDR_BKP
     using SECF_IE = MDR_BKP_RTC_CS_SECF_IE_Values<MDR_BKP::RTC_CS, 4, 1, ReadWriteMode, MDR_BKPRTC_CSBase> ;
     using ALRF_IE = MDR_BKP_RTC_CS_ALRF_IE_Values<MDR_BKP::RTC_CS, 5, 1, ReadWriteMode, MDR_BKPRTC_CSBase> ;
     using WEC = MDR_BKP_RTC_CS_WEC_Values<MDR_BKP::RTC_CS, 6, 1, ReadWriteMode, MDR_BKPRTC_CSBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = MDR_BKP_RTC_CS_WEC_Values<MDR_BKP::RTC_CS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -122,6 +129,7 @@ struct MDR_BKP
 
   struct REG_00 : public RegisterBase<0x400D8000, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_00, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +140,7 @@ struct MDR_BKP
 
   struct REG_01 : public RegisterBase<0x400D8004, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_01, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +151,7 @@ struct MDR_BKP
 
   struct REG_02 : public RegisterBase<0x400D8008, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_02, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +162,7 @@ struct MDR_BKP
 
   struct REG_03 : public RegisterBase<0x400D800C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_03, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -162,6 +173,7 @@ struct MDR_BKP
 
   struct REG_04 : public RegisterBase<0x400D8010, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_04, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -172,6 +184,7 @@ struct MDR_BKP
 
   struct REG_05 : public RegisterBase<0x400D8014, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_05, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -182,6 +195,7 @@ struct MDR_BKP
 
   struct REG_06 : public RegisterBase<0x400D8018, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_06, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +206,7 @@ struct MDR_BKP
 
   struct REG_07 : public RegisterBase<0x400D801C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_07, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -202,6 +217,7 @@ struct MDR_BKP
 
   struct REG_08 : public RegisterBase<0x400D8020, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_08, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -212,6 +228,7 @@ struct MDR_BKP
 
   struct REG_09 : public RegisterBase<0x400D8024, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_09, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +239,7 @@ struct MDR_BKP
 
   struct REG_0A : public RegisterBase<0x400D8028, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_0A, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -232,6 +250,7 @@ struct MDR_BKP
 
   struct REG_0B : public RegisterBase<0x400D802C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_0B, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +261,7 @@ struct MDR_BKP
 
   struct REG_0C : public RegisterBase<0x400D8030, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_0C, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,12 +272,14 @@ struct MDR_BKP
 
   struct REG_0D : public RegisterBase<0x400D8034, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_BKP::REG_0D, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using REG_0DPack  = Register<0x400D8034, 32, ReadWriteMode, MDR_BKPREG_0DBase, T...> ;
 
+  using Registers = TypesList<MDR_BKP::REG_0E, MDR_BKP::REG_0F, MDR_BKP::RTC_CNT, MDR_BKP::RTC_DIV, MDR_BKP::RTC_PRL, MDR_BKP::RTC_ALRM, MDR_BKP::RTC_CS, MDR_BKP::REG_00, MDR_BKP::REG_01, MDR_BKP::REG_02, MDR_BKP::REG_03, MDR_BKP::REG_04, MDR_BKP::REG_05, MDR_BKP::REG_06, MDR_BKP::REG_07, MDR_BKP::REG_08, MDR_BKP::REG_09, MDR_BKP::REG_0A, MDR_BKP::REG_0B, MDR_BKP::REG_0C, MDR_BKP::REG_0D> ;
 } ;
 
 #endif //#if !defined(MDRBKPREGISTERS_HPP)
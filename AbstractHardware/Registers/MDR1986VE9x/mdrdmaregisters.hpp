@@ -50,6 +50,7 @@ struct MDR_DMA
   struct CTRL_BASE_PTR : public RegisterBase<0x40028008, 32, ReadWriteMode>
   {
     using Addr_Hi = MDR_DMA_CTRL_BASE_PTR_Addr_Hi_Values<MDR_DMA::CTRL_BASE_PTR, 10, 22, ReadWriteMode, MDR_DMACTRL_BASE_PTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFC00U ;
     using FieldValues = MDR_DMA_CTRL_BASE_PTR_Addr_Hi_Values<MDR_DMA::CTRL_BASE_PTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +93,7 @@ struct MDR_DMA
 
   struct CHNL_USEBURST_SET : public RegisterBase<0x40028018, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_DMA::CHNL_USEBURST_SET, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +114,7 @@ struct MDR_DMA
 
   struct CHNL_REQ_MASK_SET : public RegisterBase<0x40028020, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_DMA::CHNL_REQ_MASK_SET, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +135,7 @@ struct MDR_DMA
 
   struct CHNL_ENABLE_SET : public RegisterBase<0x40028028, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_DMA::CHNL_ENABLE_SET, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +156,7 @@ struct MDR_DMA
 
   struct CHNL_PRI_ALT_SET : public RegisterBase<0x40028030, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_DMA::CHNL_PRI_ALT_SET, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -172,6 +177,7 @@ struct MDR_DMA
 
   struct CHNL_PRIORITY_SET : public RegisterBase<0x40028038, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_DMA::CHNL_PRIORITY_SET, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,12 +198,14 @@ struct MDR_DMA
 
   struct ERR_CLR : public RegisterBase<0x4002804C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_DMA::ERR_CLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ERR_CLRPack  = Register<0x4002804C, 32, ReadWriteMode, MDR_DMAERR_CLRBase, T...> ;
 
+  using Registers = TypesList<MDR_DMA::STATUS, MDR_DMA::CFG, MDR_DMA::CTRL_BASE_PTR, MDR_DMA::ALT_CTRL_BASE_PTR, MDR_DMA::WAITONREQ_STATUS, MDR_DMA::CHNL_SW_REQUEST, MDR_DMA::CHNL_USEBURST_SET, MDR_DMA::CHNL_USEBURST_CLR, MDR_DMA::CHNL_REQ_MASK_SET, MDR_DMA::CHNL_REQ_MASK_CLR, MDR_DMA::CHNL_ENABLE_SET, MDR_DMA::CHNL_ENABLE_CLR, MDR_DMA::CHNL_PRI_ALT_SET, MDR_DMA::CHNL_PRI_ALT_CLR, MDR_DMA::CHNL_PRIORITY_SET, MDR_DMA::CHNL_PRIORITY_CLR, MDR_DMA::ERR_CLR> ;
 } ;
 
 #endif //#if !defined(MDRDMAREGISTERS_HPP)
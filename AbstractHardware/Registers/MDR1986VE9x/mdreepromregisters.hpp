@@ -33,6 +33,7 @@ struct MDR_EEPROM
     using MAS1 = MDR_EEPROM_CMD_MAS1_Values<MDR_EEPROM::CMD, 11, 1, ReadWriteMode, MDR_EEPROMCMDBase> ;
     using PROG = MDR_EEPROM_CMD_PROG_Values<MDR_EEPROM::CMD, 12, 1, ReadWriteMode, MDR_EEPROMCMDBase> ;
     using NVSTR = MDR_EEPROM_CMD_NVSTR_Values<MDR_EEPROM::CMD, 13, 1, ReadWriteMode, MDR_EEPROMCMDBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFU ;
     using FieldValues = MDR_EEPROM_CMD_NVSTR_Values<MDR_EEPROM::CMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +44,7 @@ struct MDR_EEPROM
 
   struct ADDR : public RegisterBase<0x40018004, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_EEPROM::ADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +55,7 @@ struct MDR_EEPROM
 
   struct DI : public RegisterBase<0x40018008, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_EEPROM::DI, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +66,7 @@ struct MDR_EEPROM
 
   struct DO : public RegisterBase<0x4001800C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_EEPROM::DO, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,12 +77,14 @@ struct MDR_EEPROM
 
   struct KEY : public RegisterBase<0x40018010, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_EEPROM::KEY, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using KEYPack  = Register<0x40018010, 32, ReadWriteMode, MDR_EEPROMKEYBase, T...> ;
 
+  using Registers = TypesList<MDR_EEPROM::CMD, MDR_EEPROM::ADDR, MDR_EEPROM::DI, MDR_EEPROM::DO, MDR_EEPROM::KEY> ;
 } ;
 
 #endif //#if !defined(MDREEPROMREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_I2C
   struct PRL : public RegisterBase<0x40050000, 32, ReadWriteMode>
   {
     using PRLField = MDR_I2C_PRL_PRL_Values<MDR_I2C::PRL, 0, 8, ReadWriteMode, MDR_I2CPRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_I2C_PRL_PRL_Values<MDR_I2C::PRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_I2C
   struct PRH : public RegisterBase<0x40050004, 32, ReadWriteMode>
   {
     using PRHField = MDR_I2C_PRH_PRH_Values<MDR_I2C::PRH, 0, 8, ReadWriteMode, MDR_I2CPRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_I2C_PRH_PRH_Values<MDR_I2C::PRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,6 +48,7 @@ struct MDR_I2C
     using S_I2C = MDR_I2C_CTR_S_I2C_Values<MDR_I2C::CTR, 5, 1, ReadWriteMode, MDR_I2CCTRBase> ;
     using EN_INT = MDR_I2C_CTR_EN_INT_Values<MDR_I2C::CTR, 6, 1, ReadWriteMode, MDR_I2CCTRBase> ;
     using EN_I2C = MDR_I2C_CTR_EN_I2C_Values<MDR_I2C::CTR, 7, 1, ReadWriteMode, MDR_I2CCTRBase> ;
+    static constexpr Type SnapshotMask = 0xE0U ;
     using FieldValues = MDR_I2C_CTR_EN_I2C_Values<MDR_I2C::CTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +60,7 @@ struct MDR_I2C
   struct RXD : public RegisterBase<0x4005000C, 32, ReadWriteMode>
   {
     using DATA = MDR_I2C_RXD_DATA_Values<MDR_I2C::RXD, 0, 8, ReadWriteMode, MDR_I2CRXDBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_I2C_RXD_DATA_Values<MDR_I2C::RXD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +76,7 @@ struct MDR_I2C
     using Lost_ARB = MDR_I2C_STA_Lost_ARB_Values<MDR_I2C::STA, 5, 1, ReadWriteMode, MDR_I2CSTABase> ;
     using BUSY = MDR_I2C_STA_BUSY_Values<MDR_I2C::STA, 6, 1, ReadWriteMode, MDR_I2CSTABase> ;
     using RX_ACK = MDR_I2C_STA_RX_ACK_Values<MDR_I2C::STA, 7, 1, ReadWriteMode, MDR_I2CSTABase> ;
+    static constexpr Type SnapshotMask = 0xE3U ;
     using FieldValues = MDR_I2C_STA_RX_ACK_Values<MDR_I2C::STA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +88,7 @@ struct MDR_I2C
   struct TXD : public RegisterBase<0x40050014, 32, ReadWriteMode>
   {
     using DATA = MDR_I2C_TXD_DATA_Values<MDR_I2C::TXD, 0, 8, ReadWriteMode, MDR_I2CTXDBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_I2C_TXD_DATA_Values<MDR_I2C::TXD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,12 +105,14 @@ struct MDR_I2C
     using Start_Read = MDR_I2C_CMD_Start_Read_Values<MDR_I2C::CMD, 5, 1, ReadWriteMode, MDR_I2CCMDBase> ;
     using Send_Stop = MDR_I2C_CMD_Send_Stop_Values<MDR_I2C::CMD, 6, 1, ReadWriteMode, MDR_I2CCMDBase> ;
     using Send_Start = MDR_I2C_CMD_Send_Start_Values<MDR_I2C::CMD, 7, 1, ReadWriteMode, MDR_I2CCMDBase> ;
+    static constexpr Type SnapshotMask = 0xF9U ;
     using FieldValues = MDR_I2C_CMD_Send_Start_Values<MDR_I2C::CMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CMDPack  = Register<0x40050018, 32, ReadWriteMode, MDR_I2CCMDBase, T...> ;
 
+  using Registers = TypesList<MDR_I2C::PRL, MDR_I2C::PRH, MDR_I2C::CTR, MDR_I2C::RXD, MDR_I2C::STA, MDR_I2C::TXD, MDR_I2C::CMD> ;
 } ;
 
 #endif //#if !defined(MDRI2CREGISTERS_HPP)
@@ -33,6 +33,7 @@ struct MDR_IWDT
   struct PR : public RegisterBase<0x40068004, 32, ReadWriteMode>
   {
     using PRField = MDR_IWDT_PR_PR_Values<MDR_IWDT::PR, 0, 3, ReadWriteMode, MDR_IWDTPRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_IWDT_PR_PR_Values<MDR_IWDT::PR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct MDR_IWDT
   struct RLR : public RegisterBase<0x40068008, 32, ReadWriteMode>
   {
     using PRL = MDR_IWDT_RLR_PRL_Values<MDR_IWDT::RLR, 0, 12, ReadWriteMode, MDR_IWDTRLRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = MDR_IWDT_RLR_PRL_Values<MDR_IWDT::RLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct MDR_IWDT
   template<typename... T> 
   using SRPack  = Register<0x4006800C, 32, ReadMode, MDR_IWDTSRBase, T...> ;
 
+  using Registers = TypesList<MDR_IWDT::KR, MDR_IWDT::PR, MDR_IWDT::RLR, MDR_IWDT::SR> ;
 } ;
 
 #endif //#if !defined(MDRIWDTREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_PORTA
   struct RXTX : public RegisterBase<0x400A8000, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTA_RXTX_Pin_%s_Values<MDR_PORTA::RXTX, 0, 1, ReadWriteMode, MDR_PORTARXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_RXTX_Pin_%s_Values<MDR_PORTA::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_PORTA
   struct OE : public RegisterBase<0x400A8004, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTA_OE_Pin_%s_Values<MDR_PORTA::OE, 0, 1, ReadWriteMode, MDR_PORTAOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_OE_Pin_%s_Values<MDR_PORTA::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_PORTA
   struct FUNC : public RegisterBase<0x400A8008, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTA_FUNC_Pin_%s_Values<MDR_PORTA::FUNC, 0, 2, ReadWriteMode, MDR_PORTAFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_FUNC_Pin_%s_Values<MDR_PORTA::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct MDR_PORTA
   struct ANALOG : public RegisterBase<0x400A800C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTA_ANALOG_Pin_%s_Values<MDR_PORTA::ANALOG, 0, 1, ReadWriteMode, MDR_PORTAANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_ANALOG_Pin_%s_Values<MDR_PORTA::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct MDR_PORTA
     using Down_Pin_14 = MDR_PORTA_PULL_Down_Pin_14_Values<MDR_PORTA::PULL, 14, 1, ReadWriteMode, MDR_PORTAPULLBase> ;
     using Down_Pin_15 = MDR_PORTA_PULL_Down_Pin_15_Values<MDR_PORTA::PULL, 15, 1, ReadWriteMode, MDR_PORTAPULLBase> ;
     using UP_Pin_%s = MDR_PORTA_PULL_UP_Pin_%s_Values<MDR_PORTA::PULL, 16, 1, ReadWriteMode, MDR_PORTAPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTA_PULL_UP_Pin_%s_Values<MDR_PORTA::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_PORTA
     using Driver_Pin_14 = MDR_PORTA_PD_Driver_Pin_14_Values<MDR_PORTA::PD, 14, 1, ReadWriteMode, MDR_PORTAPDBase> ;
     using Driver_Pin_15 = MDR_PORTA_PD_Driver_Pin_15_Values<MDR_PORTA::PD, 15, 1, ReadWriteMode, MDR_PORTAPDBase> ;
     using Schmitt_Pin_%s = MDR_PORTA_PD_Schmitt_Pin_%s_Values<MDR_PORTA::PD, 16, 1, ReadWriteMode, MDR_PORTAPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTA_PD_Schmitt_Pin_%s_Values<MDR_PORTA::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +126,7 @@ struct MDR_PORTA
   struct PWR : public RegisterBase<0x400A8018, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTA_PWR_Pin_%s_Values<MDR_PORTA::PWR, 0, 2, ReadWriteMode, MDR_PORTAPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_PWR_Pin_%s_Values<MDR_PORTA::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,12 +138,14 @@ struct MDR_PORTA
   struct GFEN : public RegisterBase<0x400A801C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTA_GFEN_Pin_%s_Values<MDR_PORTA::GFEN, 0, 1, ReadWriteMode, MDR_PORTAGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTA_GFEN_Pin_%s_Values<MDR_PORTA::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x400A801C, 32, ReadWriteMode, MDR_PORTAGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTA::RXTX, MDR_PORTA::OE, MDR_PORTA::FUNC, MDR_PORTA::ANALOG, MDR_PORTA::PULL, MDR_PORTA::PD, MDR_PORTA::PWR, MDR_PORTA::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTAREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_PORTB
   struct RXTX : public RegisterBase<0x400B0000, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTB_RXTX_Pin_%s_Values<MDR_PORTB::RXTX, 0, 1, ReadWriteMode, MDR_PORTBRXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_RXTX_Pin_%s_Values<MDR_PORTB::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_PORTB
   struct OE : public RegisterBase<0x400B0004, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTB_OE_Pin_%s_Values<MDR_PORTB::OE, 0, 1, ReadWriteMode, MDR_PORTBOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_OE_Pin_%s_Values<MDR_PORTB::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_PORTB
   struct FUNC : public RegisterBase<0x400B0008, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTB_FUNC_Pin_%s_Values<MDR_PORTB::FUNC, 0, 2, ReadWriteMode, MDR_PORTBFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_FUNC_Pin_%s_Values<MDR_PORTB::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct MDR_PORTB
   struct ANALOG : public RegisterBase<0x400B000C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTB_ANALOG_Pin_%s_Values<MDR_PORTB::ANALOG, 0, 1, ReadWriteMode, MDR_PORTBANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_ANALOG_Pin_%s_Values<MDR_PORTB::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct MDR_PORTB
     using Down_Pin_14 = MDR_PORTB_PULL_Down_Pin_14_Values<MDR_PORTB::PULL, 14, 1, ReadWriteMode, MDR_PORTBPULLBase> ;
     using Down_Pin_15 = MDR_PORTB_PULL_Down_Pin_15_Values<MDR_PORTB::PULL, 15, 1, ReadWriteMode, MDR_PORTBPULLBase> ;
     using UP_Pin_%s = MDR_PORTB_PULL_UP_Pin_%s_Values<MDR_PORTB::PULL, 16, 1, ReadWriteMode, MDR_PORTBPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTB_PULL_UP_Pin_%s_Values<MDR_PORTB::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_PORTB
     using Driver_Pin_14 = MDR_PORTB_PD_Driver_Pin_14_Values<MDR_PORTB::PD, 14, 1, ReadWriteMode, MDR_PORTBPDBase> ;
     using Driver_Pin_15 = MDR_PORTB_PD_Driver_Pin_15_Values<MDR_PORTB::PD, 15, 1, ReadWriteMode, MDR_PORTBPDBase> ;
     using Schmitt_Pin_%s = MDR_PORTB_PD_Schmitt_Pin_%s_Values<MDR_PORTB::PD, 16, 1, ReadWriteMode, MDR_PORTBPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTB_PD_Schmitt_Pin_%s_Values<MDR_PORTB::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +126,7 @@ struct MDR_PORTB
   struct PWR : public RegisterBase<0x400B0018, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTB_PWR_Pin_%s_Values<MDR_PORTB::PWR, 0, 2, ReadWriteMode, MDR_PORTBPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_PWR_Pin_%s_Values<MDR_PORTB::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,12 +138,14 @@ struct MDR_PORTB
   struct GFEN : public RegisterBase<0x400B001C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTB_GFEN_Pin_%s_Values<MDR_PORTB::GFEN, 0, 1, ReadWriteMode, MDR_PORTBGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTB_GFEN_Pin_%s_Values<MDR_PORTB::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x400B001C, 32, ReadWriteMode, MDR_PORTBGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTB::RXTX, MDR_PORTB::OE, MDR_PORTB::FUNC, MDR_PORTB::ANALOG, MDR_PORTB::PULL, MDR_PORTB::PD, MDR_PORTB::PWR, MDR_PORTB::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTBREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_PORTC
   struct RXTX : public RegisterBase<0x400B8000, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTC_RXTX_Pin_%s_Values<MDR_PORTC::RXTX, 0, 1, ReadWriteMode, MDR_PORTCRXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_RXTX_Pin_%s_Values<MDR_PORTC::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_PORTC
   struct OE : public RegisterBase<0x400B8004, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTC_OE_Pin_%s_Values<MDR_PORTC::OE, 0, 1, ReadWriteMode, MDR_PORTCOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_OE_Pin_%s_Values<MDR_PORTC::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_PORTC
   struct FUNC : public RegisterBase<0x400B8008, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTC_FUNC_Pin_%s_Values<MDR_PORTC::FUNC, 0, 2, ReadWriteMode, MDR_PORTCFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_FUNC_Pin_%s_Values<MDR_PORTC::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct MDR_PORTC
   struct ANALOG : public RegisterBase<0x400B800C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTC_ANALOG_Pin_%s_Values<MDR_PORTC::ANALOG, 0, 1, ReadWriteMode, MDR_PORTCANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_ANALOG_Pin_%s_Values<MDR_PORTC::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct MDR_PORTC
     using Down_Pin_14 = MDR_PORTC_PULL_Down_Pin_14_Values<MDR_PORTC::PULL, 14, 1, ReadWriteMode, MDR_PORTCPULLBase> ;
     using Down_Pin_15 = MDR_PORTC_PULL_Down_Pin_15_Values<MDR_PORTC::PULL, 15, 1, ReadWriteMode, MDR_PORTCPULLBase> ;
     using UP_Pin_%s = MDR_PORTC_PULL_UP_Pin_%s_Values<MDR_PORTC::PULL, 16, 1, ReadWriteMode, MDR_PORTCPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTC_PULL_UP_Pin_%s_Values<MDR_PORTC::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_PORTC
     using Driver_Pin_14 = MDR_PORTC_PD_Driver_Pin_14_Values<MDR_PORTC::PD, 14, 1, ReadWriteMode, MDR_PORTCPDBase> ;
     using Driver_Pin_15 = MDR_PORTC_PD_Driver_Pin_15_Values<MDR_PORTC::PD, 15, 1, ReadWriteMode, MDR_PORTCPDBase> ;
     using Schmitt_Pin_%s = MDR_PORTC_PD_Schmitt_Pin_%s_Values<MDR_PORTC::PD, 16, 1, ReadWriteMode, MDR_PORTCPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTC_PD_Schmitt_Pin_%s_Values<MDR_PORTC::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +126,7 @@ struct MDR_PORTC
   struct PWR : public RegisterBase<0x400B8018, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTC_PWR_Pin_%s_Values<MDR_PORTC::PWR, 0, 2, ReadWriteMode, MDR_PORTCPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_PWR_Pin_%s_Values<MDR_PORTC::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,12 +138,14 @@ struct MDR_PORTC
   struct GFEN : public RegisterBase<0x400B801C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTC_GFEN_Pin_%s_Values<MDR_PORTC::GFEN, 0, 1, ReadWriteMode, MDR_PORTCGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTC_GFEN_Pin_%s_Values<MDR_PORTC::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x400B801C, 32, ReadWriteMode, MDR_PORTCGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTC::RXTX, MDR_PORTC::OE, MDR_PORTC::FUNC, MDR_PORTC::ANALOG, MDR_PORTC::PULL, MDR_PORTC::PD, MDR_PORTC::PWR, MDR_PORTC::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTCREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_PORTD
   struct RXTX : public RegisterBase<0x400C0000, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTD_RXTX_Pin_%s_Values<MDR_PORTD::RXTX, 0, 1, ReadWriteMode, MDR_PORTDRXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTD_RXTX_Pin_%s_Values<MDR_PORTD::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_PORTD
   struct OE : public RegisterBase<0x400C0004, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTD_OE_Pin_%s_Values<MDR_PORTD::OE, 0, 1, ReadWriteMode, MDR_PORTDOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTD_OE_Pin_%s_Values<MDR_PORTD::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_PORTD
   struct FUNC : public RegisterBase<0x400C0008, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTD_FUNC_Pin_%s_Values<MDR_PORTD::FUNC, 0, 2, ReadWriteMode, MDR_PORTDFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTD_FUNC_Pin_%s_Values<MDR_PORTD::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct MDR_PORTD
   struct ANALOG : public RegisterBase<0x400C000C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTD_ANALOG_Pin_%s_Values<MDR_PORTD::ANALOG, 0, 1, ReadWriteMode, MDR_PORTDANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTD_ANALOG_Pin_%s_Values<MDR_PORTD::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct MDR_PORTD
     using Down_Pin_14 = MDR_PORTD_PULL_Down_Pin_14_Values<MDR_PORTD::PULL, 14, 1, ReadWriteMode, MDR_PORTDPULLBase> ;
     using Down_Pin_15 = MDR_PORTD_PULL_Down_Pin_15_Values<MDR_PORTD::PULL, 15, 1, ReadWriteMode, MDR_PORTDPULLBase> ;
     using UP_Pin_%s = MDR_PORTD_PULL_UP_Pin_%s_Values<MDR_PORTD::PULL, 16, 1, ReadWriteMode, MDR_PORTDPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTD_PULL_UP_Pin_%s_Values<MDR_PORTD::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_PORTD
     using Driver_Pin_14 = MDR_PORTD_PD_Driver_Pin_14_Values<MDR_PORTD::PD, 14, 1, ReadWriteMode, MDR_PORTDPDBase> ;
     using Driver_Pin_15 = MDR_PORTD_PD_Driver_Pin_15_Values<MDR_PORTD::PD, 15, 1, ReadWriteMode, MDR_PORTDPDBase> ;
     using Schmitt_Pin_%s = MDR_PORTD_PD_Schmitt_Pin_%s_Values<MDR_PORTD::PD, 16, 1, ReadWriteMode, MDR_PORTDPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTD_PD_Schmitt_Pin_%s_Values<MDR_PORTD::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +126,7 @@ struct MDR_PORTD
   struct PWR : public RegisterBase<0x400C0018, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTD_PWR_Pin_%s_Values<MDR_PORTD::PWR, 0, 2, ReadWriteMode, MDR_PORTDPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTD_PWR_Pin_%s_Values<MDR_PORTD::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,12 +138,14 @@ struct MDR_PORTD
   struct GFEN : public RegisterBase<0x400C001C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTD_GFEN_Pin_%s_Values<MDR_PORTD::GFEN, 0, 1, ReadWriteMode, MDR_PORTDGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTD_GFEN_Pin_%s_Values<MDR_PORTD::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x400C001C, 32, ReadWriteMode, MDR_PORTDGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTD::RXTX, MDR_PORTD::OE, MDR_PORTD::FUNC, MDR_PORTD::ANALOG, MDR_PORTD::PULL, MDR_PORTD::PD, MDR_PORTD::PWR, MDR_PORTD::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTDREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_PORTE
   struct RXTX : public RegisterBase<0x400C8000, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTE_RXTX_Pin_%s_Values<MDR_PORTE::RXTX, 0, 1, ReadWriteMode, MDR_PORTERXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTE_RXTX_Pin_%s_Values<MDR_PORTE::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_PORTE
   struct OE : public RegisterBase<0x400C8004, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTE_OE_Pin_%s_Values<MDR_PORTE::OE, 0, 1, ReadWriteMode, MDR_PORTEOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTE_OE_Pin_%s_Values<MDR_PORTE::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_PORTE
   struct FUNC : public RegisterBase<0x400C8008, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTE_FUNC_Pin_%s_Values<MDR_PORTE::FUNC, 0, 2, ReadWriteMode, MDR_PORTEFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTE_FUNC_Pin_%s_Values<MDR_PORTE::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct MDR_PORTE
   struct ANALOG : public RegisterBase<0x400C800C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTE_ANALOG_Pin_%s_Values<MDR_PORTE::ANALOG, 0, 1, ReadWriteMode, MDR_PORTEANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTE_ANALOG_Pin_%s_Values<MDR_PORTE::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct MDR_PORTE
     using Down_Pin_14 = MDR_PORTE_PULL_Down_Pin_14_Values<MDR_PORTE::PULL, 14, 1, ReadWriteMode, MDR_PORTEPULLBase> ;
     using Down_Pin_15 = MDR_PORTE_PULL_Down_Pin_15_Values<MDR_PORTE::PULL, 15, 1, ReadWriteMode, MDR_PORTEPULLBase> ;
     using UP_Pin_%s = MDR_PORTE_PULL_UP_Pin_%s_Values<MDR_PORTE::PULL, 16, 1, ReadWriteMode, MDR_PORTEPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTE_PULL_UP_Pin_%s_Values<MDR_PORTE::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_PORTE
     using Driver_Pin_14 = MDR_PORTE_PD_Driver_Pin_14_Values<MDR_PORTE::PD, 14, 1, ReadWriteMode, MDR_PORTEPDBase> ;
     using Driver_Pin_15 = MDR_PORTE_PD_Driver_Pin_15_Values<MDR_PORTE::PD, 15, 1, ReadWriteMode, MDR_PORTEPDBase> ;
     using Schmitt_Pin_%s = MDR_PORTE_PD_Schmitt_Pin_%s_Values<MDR_PORTE::PD, 16, 1, ReadWriteMode, MDR_PORTEPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTE_PD_Schmitt_Pin_%s_Values<MDR_PORTE::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +126,7 @@ struct MDR_PORTE
   struct PWR : public RegisterBase<0x400C8018, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTE_PWR_Pin_%s_Values<MDR_PORTE::PWR, 0, 2, ReadWriteMode, MDR_PORTEPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTE_PWR_Pin_%s_Values<MDR_PORTE::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,12 +138,14 @@ struct MDR_PORTE
   struct GFEN : public RegisterBase<0x400C801C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTE_GFEN_Pin_%s_Values<MDR_PORTE::GFEN, 0, 1, ReadWriteMode, MDR_PORTEGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTE_GFEN_Pin_%s_Values<MDR_PORTE::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x400C801C, 32, ReadWriteMode, MDR_PORTEGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTE::RXTX, MDR_PORTE::OE, MDR_PORTE::FUNC, MDR_PORTE::ANALOG, MDR_PORTE::PULL, MDR_PORTE::PD, MDR_PORTE::PWR, MDR_PORTE::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTEREGISTERS_HPP)
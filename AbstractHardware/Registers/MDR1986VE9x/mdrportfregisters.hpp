@@ -22,6 +22,7 @@ struct MDR_PORTF
   struct RXTX : public RegisterBase<0x400E8000, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTF_RXTX_Pin_%s_Values<MDR_PORTF::RXTX, 0, 1, ReadWriteMode, MDR_PORTFRXTXBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTF_RXTX_Pin_%s_Values<MDR_PORTF::RXTX, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_PORTF
   struct OE : public RegisterBase<0x400E8004, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTF_OE_Pin_%s_Values<MDR_PORTF::OE, 0, 1, ReadWriteMode, MDR_PORTFOEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTF_OE_Pin_%s_Values<MDR_PORTF::OE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_PORTF
   struct FUNC : public RegisterBase<0x400E8008, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTF_FUNC_Pin_%s_Values<MDR_PORTF::FUNC, 0, 2, ReadWriteMode, MDR_PORTFFUNCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTF_FUNC_Pin_%s_Values<MDR_PORTF::FUNC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct MDR_PORTF
   struct ANALOG : public RegisterBase<0x400E800C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTF_ANALOG_Pin_%s_Values<MDR_PORTF::ANALOG, 0, 1, ReadWriteMode, MDR_PORTFANALOGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTF_ANALOG_Pin_%s_Values<MDR_PORTF::ANALOG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct MDR_PORTF
     using Down_Pin_14 = MDR_PORTF_PULL_Down_Pin_14_Values<MDR_PORTF::PULL, 14, 1, ReadWriteMode, MDR_PORTFPULLBase> ;
     using Down_Pin_15 = MDR_PORTF_PULL_Down_Pin_15_Values<MDR_PORTF::PULL, 15, 1, ReadWriteMode, MDR_PORTFPULLBase> ;
     using UP_Pin_%s = MDR_PORTF_PULL_UP_Pin_%s_Values<MDR_PORTF::PULL, 16, 1, ReadWriteMode, MDR_PORTFPULLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTF_PULL_UP_Pin_%s_Values<MDR_PORTF::PULL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +114,7 @@ struct MDR_PORTF
     using Driver_Pin_14 = MDR_PORTF_PD_Driver_Pin_14_Values<MDR_PORTF::PD, 14, 1, ReadWriteMode, MDR_PORTFPDBase> ;
     using Driver_Pin_15 = MDR_PORTF_PD_Driver_Pin_15_Values<MDR_PORTF::PD, 15, 1, ReadWriteMode, MDR_PORTFPDBase> ;
     using Schmitt_Pin_%s = MDR_PORTF_PD_Schmitt_Pin_%s_Values<MDR_PORTF::PD, 16, 1, ReadWriteMode, MDR_PORTFPDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_PORTF_PD_Schmitt_Pin_%s_Values<MDR_PORTF::PD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +126,7 @@ struct MDR_PORTF
   struct PWR : public RegisterBase<0x400E8018, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTF_PWR_Pin_%s_Values<MDR_PORTF::PWR, 0, 2, ReadWriteMode, MDR_PORTFPWRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTF_PWR_Pin_%s_Values<MDR_PORTF::PWR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,12 +138,14 @@ struct MDR_PORTF
   struct GFEN : public RegisterBase<0x400E801C, 32, ReadWriteMode>
   {
     using Pin_%s = MDR_PORTF_GFEN_Pin_%s_Values<MDR_PORTF::GFEN, 0, 1, ReadWriteMode, MDR_PORTFGFENBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MDR_PORTF_GFEN_Pin_%s_Values<MDR_PORTF::GFEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GFENPack  = Register<0x400E801C, 32, ReadWriteMode, MDR_PORTFGFENBase, T...> ;
 
+  using Registers = TypesList<MDR_PORTF::RXTX, MDR_PORTF::OE, MDR_PORTF::FUNC, MDR_PORTF::ANALOG, MDR_PORTF::PULL, MDR_PORTF::PD, MDR_PORTF::PWR, MDR_PORTF::GFEN> ;
 } ;
 
 #endif //#if !defined(MDRPORTFREGISTERS_HPP)
@@ -30,6 +30,7 @@ struct MDR_Power
     using IEPVD = MDR_Power_PVDCS_IEPVD_Values<MDR_Power::PVDCS, 9, 1, ReadWriteMode, MDR_PowerPVDCSBase> ;
     using INVB = MDR_Power_PVDCS_INVB_Values<MDR_Power::PVDCS, 10, 1, ReadWriteMode, MDR_PowerPVDCSBase> ;
     using INV = MDR_Power_PVDCS_INV_Values<MDR_Power::PVDCS, 11, 1, ReadWriteMode, MDR_PowerPVDCSBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = MDR_Power_PVDCS_INV_Values<MDR_Power::PVDCS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +48,7 @@ struct MDR_Power
   template<typename... T> 
   using ResRegPack  = Register<0x40058004, 32, ReadMode, MDR_PowerResRegBase, T...> ;
 
+  using Registers = TypesList<MDR_Power::PVDCS, MDR_Power::ResReg> ;
 } ;
 
 #endif //#if !defined(MDRPOWERREGISTERS_HPP)
@@ -40,6 +40,7 @@ struct MDR_RST_CLOCK
     using PLL_CPU_PLD = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_PLD_Values<MDR_RST_CLOCK::PLL_CONTROL, 3, 1, ReadWriteMode, MDR_RST_CLOCKPLL_CONTROLBase> ;
     using PLL_USB_MUL = MDR_RST_CLOCK_PLL_CONTROL_PLL_USB_MUL_Values<MDR_RST_CLOCK::PLL_CONTROL, 4, 4, ReadWriteMode, MDR_RST_CLOCKPLL_CONTROLBase> ;
     using PLL_CPU_MUL = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_MUL_Values<MDR_RST_CLOCK::PLL_CONTROL, 8, 4, ReadWriteMode, MDR_RST_CLOCKPLL_CONTROLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = MDR_RST_CLOCK_PLL_CONTROL_PLL_CPU_MUL_Values<MDR_RST_CLOCK::PLL_CONTROL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +53,7 @@ struct MDR_RST_CLOCK
   {
     using HSE_ON = MDR_RST_CLOCK_HS_CONTROL_HSE_ON_Values<MDR_RST_CLOCK::HS_CONTROL, 0, 1, ReadWriteMode, MDR_RST_CLOCKHS_CONTROLBase> ;
     using HSE_BYP = MDR_RST_CLOCK_HS_CONTROL_HSE_BYP_Values<MDR_RST_CLOCK::HS_CONTROL, 1, 1, ReadWriteMode, MDR_RST_CLOCKHS_CONTROLBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = MDR_RST_CLOCK_HS_CONTROL_HSE_BYP_Values<MDR_RST_CLOCK::HS_CONTROL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +68,7 @@ struct MDR_RST_CLOCK
     using CPU_C2_SEL = MDR_RST_CLOCK_CPU_CLOCK_CPU_C2_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 2, 1, ReadWriteMode, MDR_RST_CLOCKCPU_CLOCKBase> ;
     using CPU_C3_SEL = MDR_RST_CLOCK_CPU_CLOCK_CPU_C3_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 4, 4, ReadWriteMode, MDR_RST_CLOCKCPU_CLOCKBase> ;
     using HCLK_SEL = MDR_RST_CLOCK_CPU_CLOCK_HCLK_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 8, 2, ReadWriteMode, MDR_RST_CLOCKCPU_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3F7U ;
     using FieldValues = MDR_RST_CLOCK_CPU_CLOCK_HCLK_SEL_Values<MDR_RST_CLOCK::CPU_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +83,7 @@ struct MDR_RST_CLOCK
     using USB_C2_SEL = MDR_RST_CLOCK_USB_CLOCK_USB_C2_SEL_Values<MDR_RST_CLOCK::USB_CLOCK, 2, 1, ReadWriteMode, MDR_RST_CLOCKUSB_CLOCKBase> ;
     using USB_C3_SEL = MDR_RST_CLOCK_USB_CLOCK_USB_C3_SEL_Values<MDR_RST_CLOCK::USB_CLOCK, 4, 1, ReadWriteMode, MDR_RST_CLOCKUSB_CLOCKBase> ;
     using USB_EN = MDR_RST_CLOCK_USB_CLOCK_USB_EN_Values<MDR_RST_CLOCK::USB_CLOCK, 8, 1, ReadWriteMode, MDR_RST_CLOCKUSB_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x117U ;
     using FieldValues = MDR_RST_CLOCK_USB_CLOCK_USB_EN_Values<MDR_RST_CLOCK::USB_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -94,6 +98,7 @@ struct MDR_RST_CLOCK
     using ADC_C2_SEL = MDR_RST_CLOCK_ADC_CLOCK_ADC_C2_SEL_Values<MDR_RST_CLOCK::ADC_CLOCK, 4, 2, ReadWriteMode, MDR_RST_CLOCKADC_CLOCKBase> ;
     using ADC_C3_SEL = MDR_RST_CLOCK_ADC_CLOCK_ADC_C3_SEL_Values<MDR_RST_CLOCK::ADC_CLOCK, 8, 4, ReadWriteMode, MDR_RST_CLOCKADC_CLOCKBase> ;
     using ADC_CLK_EN = MDR_RST_CLOCK_ADC_CLOCK_ADC_CLK_EN_Values<MDR_RST_CLOCK::ADC_CLOCK, 13, 1, ReadWriteMode, MDR_RST_CLOCKADC_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x2F33U ;
     using FieldValues = MDR_RST_CLOCK_ADC_CLOCK_ADC_CLK_EN_Values<MDR_RST_CLOCK::ADC_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +113,7 @@ struct MDR_RST_CLOCK
     using HSI_SEL = MDR_RST_CLOCK_RTC_CLOCK_HSI_SEL_Values<MDR_RST_CLOCK::RTC_CLOCK, 4, 4, ReadWriteMode, MDR_RST_CLOCKRTC_CLOCKBase> ;
     using HSE_RTC_EN = MDR_RST_CLOCK_RTC_CLOCK_HSE_RTC_EN_Values<MDR_RST_CLOCK::RTC_CLOCK, 8, 1, ReadWriteMode, MDR_RST_CLOCKRTC_CLOCKBase> ;
     using HSI_RTC_EN = MDR_RST_CLOCK_RTC_CLOCK_HSI_RTC_EN_Values<MDR_RST_CLOCK::RTC_CLOCK, 9, 1, ReadWriteMode, MDR_RST_CLOCKRTC_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = MDR_RST_CLOCK_RTC_CLOCK_HSI_RTC_EN_Values<MDR_RST_CLOCK::RTC_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +152,7 @@ struct MDR_RST_CLOCK
     using BKP_CLK_EN = MDR_RST_CLOCK_PER_CLOCK_BKP_CLK_EN_Values<MDR_RST_CLOCK::PER_CLOCK, 27, 1, ReadWriteMode, MDR_RST_CLOCKPER_CLOCKBase> ;
     using PORTF_CLK_EN = MDR_RST_CLOCK_PER_CLOCK_PORTF_CLK_EN_Values<MDR_RST_CLOCK::PER_CLOCK, 29, 1, ReadWriteMode, MDR_RST_CLOCKPER_CLOCKBase> ;
     using EBC_CLK_EN = MDR_RST_CLOCK_PER_CLOCK_EBC_CLK_EN_Values<MDR_RST_CLOCK::PER_CLOCK, 30, 1, ReadWriteMode, MDR_RST_CLOCKPER_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x6BFFFDFFU ;
     using FieldValues = MDR_RST_CLOCK_PER_CLOCK_EBC_CLK_EN_Values<MDR_RST_CLOCK::PER_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -160,6 +167,7 @@ struct MDR_RST_CLOCK
     using CAN2_BRG = MDR_RST_CLOCK_CAN_CLOCK_CAN2_BRG_Values<MDR_RST_CLOCK::CAN_CLOCK, 8, 3, ReadWriteMode, MDR_RST_CLOCKCAN_CLOCKBase> ;
     using CAN1_CLK_EN = MDR_RST_CLOCK_CAN_CLOCK_CAN1_CLK_EN_Values<MDR_RST_CLOCK::CAN_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKCAN_CLOCKBase> ;
     using CAN2_CLK_EN = MDR_RST_CLOCK_CAN_CLOCK_CAN2_CLK_EN_Values<MDR_RST_CLOCK::CAN_CLOCK, 25, 1, ReadWriteMode, MDR_RST_CLOCKCAN_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3000707U ;
     using FieldValues = MDR_RST_CLOCK_CAN_CLOCK_CAN2_CLK_EN_Values<MDR_RST_CLOCK::CAN_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +184,7 @@ struct MDR_RST_CLOCK
     using TIM1_CLK_EN = MDR_RST_CLOCK_TIM_CLOCK_TIM1_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKTIM_CLOCKBase> ;
     using TIM2_CLK_EN = MDR_RST_CLOCK_TIM_CLOCK_TIM2_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 25, 1, ReadWriteMode, MDR_RST_CLOCKTIM_CLOCKBase> ;
     using TIM3_CLK_EN = MDR_RST_CLOCK_TIM_CLOCK_TIM3_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 26, 1, ReadWriteMode, MDR_RST_CLOCKTIM_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x7070707U ;
     using FieldValues = MDR_RST_CLOCK_TIM_CLOCK_TIM3_CLK_EN_Values<MDR_RST_CLOCK::TIM_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -190,6 +199,7 @@ struct MDR_RST_CLOCK
     using UART2_BRG = MDR_RST_CLOCK_UART_CLOCK_UART2_BRG_Values<MDR_RST_CLOCK::UART_CLOCK, 8, 3, ReadWriteMode, MDR_RST_CLOCKUART_CLOCKBase> ;
     using UART1_CLK_EN = MDR_RST_CLOCK_UART_CLOCK_UART1_CLK_EN_Values<MDR_RST_CLOCK::UART_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKUART_CLOCKBase> ;
     using UART2_CLK_EN = MDR_RST_CLOCK_UART_CLOCK_UART2_CLK_EN_Values<MDR_RST_CLOCK::UART_CLOCK, 25, 1, ReadWriteMode, MDR_RST_CLOCKUART_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x3000707U ;
     using FieldValues = MDR_RST_CLOCK_UART_CLOCK_UART2_CLK_EN_Values<MDR_RST_CLOCK::UART_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,12 +216,14 @@ struct MDR_RST_CLOCK
     using SSP1_CLK_EN = MDR_RST_CLOCK_SSP_CLOCK_SSP1_CLK_EN_Values<MDR_RST_CLOCK::SSP_CLOCK, 24, 1, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase> ;
     using SSP2_CLK_EN = MDR_RST_CLOCK_SSP_CLOCK_SSP2_CLK_EN_Values<MDR_RST_CLOCK::SSP_CLOCK, 25, 1, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase> ;
     using SSP3_CLK_EN = MDR_RST_CLOCK_SSP_CLOCK_SSP3_CLK_EN_Values<MDR_RST_CLOCK::SSP_CLOCK, 26, 1, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase> ;
+    static constexpr Type SnapshotMask = 0x7070707U ;
     using FieldValues = MDR_RST_CLOCK_SSP_CLOCK_SSP3_CLK_EN_Values<MDR_RST_CLOCK::SSP_CLOCK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SSP_CLOCKPack  = Register<0x4002002C, 32, ReadWriteMode, MDR_RST_CLOCKSSP_CLOCKBase, T...> ;
 
+  using Registers = TypesList<MDR_RST_CLOCK::CLOCK_STATUS, MDR_RST_CLOCK::PLL_CONTROL, MDR_RST_CLOCK::HS_CONTROL, MDR_RST_CLOCK::CPU_CLOCK, MDR_RST_CLOCK::USB_CLOCK, MDR_RST_CLOCK::ADC_CLOCK, MDR_RST_CLOCK::RTC_CLOCK, MDR_RST_CLOCK::PER_CLOCK, MDR_RST_CLOCK::CAN_CLOCK, MDR_RST_CLOCK::TIM_CLOCK, MDR_RST_CLOCK::UART_CLOCK, MDR_RST_CLOCK::SSP_CLOCK> ;
 } ;
 
 #endif //#if !defined(MDRRSTCLOCKREGISTERS_HPP)
@@ -26,6 +26,7 @@ struct MDR_SSP2
     using SPO = MDR_SSP2_CR0_SPO_Values<MDR_SSP2::CR0, 6, 1, ReadWriteMode, MDR_SSP2CR0Base> ;
     using SPH = MDR_SSP2_CR0_SPH_Values<MDR_SSP2::CR0, 7, 1, ReadWriteMode, MDR_SSP2CR0Base> ;
     using SCR = MDR_SSP2_CR0_SCR_Values<MDR_SSP2::CR0, 8, 8, ReadWriteMode, MDR_SSP2CR0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_SSP2_CR0_SCR_Values<MDR_SSP2::CR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,7 @@ struct MDR_SSP2
     using SSE = MDR_SSP2_CR1_SSE_Values<MDR_SSP2::CR1, 1, 1, ReadWriteMode, MDR_SSP2CR1Base> ;
     using MS = MDR_SSP2_CR1_MS_Values<MDR_SSP2::CR1, 2, 1, ReadWriteMode, MDR_SSP2CR1Base> ;
     using SOD = MDR_SSP2_CR1_SOD_Values<MDR_SSP2::CR1, 3, 1, ReadWriteMode, MDR_SSP2CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = MDR_SSP2_CR1_SOD_Values<MDR_SSP2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +53,7 @@ struct MDR_SSP2
   struct DR : public RegisterBase<0x400A0008, 32, ReadWriteMode>
   {
     using Data = MDR_SSP2_DR_Data_Values<MDR_SSP2::DR, 0, 16, ReadWriteMode, MDR_SSP2DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_SSP2_DR_Data_Values<MDR_SSP2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +80,7 @@ struct MDR_SSP2
   struct CPSR : public RegisterBase<0x400A0010, 32, ReadWriteMode>
   {
     using CPSDVSR = MDR_SSP2_CPSR_CPSDVSR_Values<MDR_SSP2::CPSR, 0, 8, ReadWriteMode, MDR_SSP2CPSRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_SSP2_CPSR_CPSDVSR_Values<MDR_SSP2::CPSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +95,7 @@ struct MDR_SSP2
     using RTIM = MDR_SSP2_IMSC_RTIM_Values<MDR_SSP2::IMSC, 1, 1, ReadWriteMode, MDR_SSP2IMSCBase> ;
     using RXIM = MDR_SSP2_IMSC_RXIM_Values<MDR_SSP2::IMSC, 2, 1, ReadWriteMode, MDR_SSP2IMSCBase> ;
     using TXIM = MDR_SSP2_IMSC_TXIM_Values<MDR_SSP2::IMSC, 3, 1, ReadWriteMode, MDR_SSP2IMSCBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = MDR_SSP2_IMSC_TXIM_Values<MDR_SSP2::IMSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,12 +148,14 @@ struct MDR_SSP2
   {
     using RXDMAE = MDR_SSP2_DMACR_RXDMAE_Values<MDR_SSP2::DMACR, 0, 1, ReadWriteMode, MDR_SSP2DMACRBase> ;
     using TXDMAE = MDR_SSP2_DMACR_TXDMAE_Values<MDR_SSP2::DMACR, 1, 1, ReadWriteMode, MDR_SSP2DMACRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = MDR_SSP2_DMACR_TXDMAE_Values<MDR_SSP2::DMACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMACRPack  = Register<0x400A0024, 32, ReadWriteMode, MDR_SSP2DMACRBase, T...> ;
 
+  using Registers = TypesList<MDR_SSP2::CR0, MDR_SSP2::CR1, MDR_SSP2::DR, MDR_SSP2::SR, MDR_SSP2::CPSR, MDR_SSP2::IMSC, MDR_SSP2::RIS, MDR_SSP2::MIS, MDR_SSP2::ICR, MDR_SSP2::DMACR> ;
 } ;
 
 #endif //#if !defined(MDRSSP2REGISTERS_HPP)
@@ -22,6 +22,7 @@ struct MDR_TIMER1
   struct CNT : public RegisterBase<0x40070000, 32, ReadWriteMode>
   {
     using Value = MDR_TIMER1_CNT_Value_Values<MDR_TIMER1::CNT, 0, 16, ReadWriteMode, MDR_TIMER1CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = MDR_TIMER1_CNT_Value_Values<MDR_TIMER1::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct MDR_TIMER1
   struct PSG : public RegisterBase<0x40070004, 32, ReadWriteMode>
   {
     using Value = MDR_TIMER1_PSG_Value_Values<MDR_TIMER1::PSG, 0, 16, ReadWriteMode, MDR_TIMER1PSGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_TIMER1_PSG_Value_Values<MDR_TIMER1::PSG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct MDR_TIMER1
   struct ARR : public RegisterBase<0x40070008, 32, ReadWriteMode>
   {
     using Value = MDR_TIMER1_ARR_Value_Values<MDR_TIMER1::ARR, 0, 16, ReadWriteMode, MDR_TIMER1ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_TIMER1_ARR_Value_Values<MDR_TIMER1::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +64,7 @@ struct MDR_TIMER1
     using FDTS = MDR_TIMER1_CNTRL_FDTS_Values<MDR_TIMER1::CNTRL, 4, 2, ReadWriteMode, MDR_TIMER1CNTRLBase> ;
     using CNT_MODE = MDR_TIMER1_CNTRL_CNT_MODE_Values<MDR_TIMER1::CNTRL, 6, 2, ReadWriteMode, MDR_TIMER1CNTRLBase> ;
     using EVENT_SEL = MDR_TIMER1_CNTRL_EVENT_SEL_Values<MDR_TIMER1::CNTRL, 8, 4, ReadWriteMode, MDR_TIMER1CNTRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = MDR_TIMER1_CNTRL_EVENT_SEL_Values<MDR_TIMER1::CNTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +76,7 @@ struct MDR_TIMER1
   struct CCR1 : public RegisterBase<0x40070010, 32, ReadWriteMode>
   {
     using Value = MDR_TIMER1_CCR1_Value_Values<MDR_TIMER1::CCR1, 0, 16, ReadWriteMode, MDR_TIMER1CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_TIMER1_CCR1_Value_Values<MDR_TIMER1::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +87,7 @@ struct MDR_TIMER1
 
   struct CCR2 : public RegisterBase<0x40070014, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +98,7 @@ struct MDR_TIMER1
 
   struct CCR3 : public RegisterBase<0x40070018, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +109,7 @@ struct MDR_TIMER1
 
   struct CCR4 : public RegisterBase<0x4007001C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +129,7 @@ struct MDR_TIMER1
     using ETREN = MDR_TIMER1_CH1_CNTRL_ETREN_Values<MDR_TIMER1::CH1_CNTRL, 13, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRLBase> ;
     using WR_CMPL = MDR_TIMER1_CH1_CNTRL_WR_CMPL_Values<MDR_TIMER1::CH1_CNTRL, 14, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRLBase> ;
     using CAP_nPWM = MDR_TIMER1_CH1_CNTRL_CAP_nPWM_Values<MDR_TIMER1::CH1_CNTRL, 15, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = MDR_TIMER1_CH1_CNTRL_CAP_nPWM_Values<MDR_TIMER1::CH1_CNTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +140,7 @@ struct MDR_TIMER1
 
   struct CH2_CNTRL : public RegisterBase<0x40070024, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH2_CNTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +151,7 @@ struct MDR_TIMER1
 
   struct CH3_CNTRL : public RegisterBase<0x40070028, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH3_CNTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +162,7 @@ struct MDR_TIMER1
 
   struct CH4_CNTRL : public RegisterBase<0x4007002C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH4_CNTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +179,7 @@ struct MDR_TIMER1
     using NSelOE = MDR_TIMER1_CH1_CNTRL1_NSelOE_Values<MDR_TIMER1::CH1_CNTRL1, 8, 2, ReadWriteMode, MDR_TIMER1CH1_CNTRL1Base> ;
     using NSelO = MDR_TIMER1_CH1_CNTRL1_NSelO_Values<MDR_TIMER1::CH1_CNTRL1, 10, 2, ReadWriteMode, MDR_TIMER1CH1_CNTRL1Base> ;
     using NInv = MDR_TIMER1_CH1_CNTRL1_NInv_Values<MDR_TIMER1::CH1_CNTRL1, 12, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRL1Base> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = MDR_TIMER1_CH1_CNTRL1_NInv_Values<MDR_TIMER1::CH1_CNTRL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -177,6 +190,7 @@ struct MDR_TIMER1
 
   struct CH2_CNTRL1 : public RegisterBase<0x40070034, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH2_CNTRL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -187,6 +201,7 @@ struct MDR_TIMER1
 
   struct CH3_CNTRL1 : public RegisterBase<0x40070038, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH3_CNTRL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,6 +212,7 @@ struct MDR_TIMER1
 
   struct CH4_CNTRL1 : public RegisterBase<0x4007003C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH4_CNTRL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +226,7 @@ struct MDR_TIMER1
     using DTG = MDR_TIMER1_CH1_DTG_DTG_Values<MDR_TIMER1::CH1_DTG, 0, 4, ReadWriteMode, MDR_TIMER1CH1_DTGBase> ;
     using EDTS = MDR_TIMER1_CH1_DTG_EDTS_Values<MDR_TIMER1::CH1_DTG, 4, 1, ReadWriteMode, MDR_TIMER1CH1_DTGBase> ;
     using DTGx = MDR_TIMER1_CH1_DTG_DTGx_Values<MDR_TIMER1::CH1_DTG, 8, 8, ReadWriteMode, MDR_TIMER1CH1_DTGBase> ;
+    static constexpr Type SnapshotMask = 0xFF1FU ;
     using FieldValues = MDR_TIMER1_CH1_DTG_DTGx_Values<MDR_TIMER1::CH1_DTG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -220,6 +237,7 @@ struct MDR_TIMER1
 
   struct CH2_DTG : public RegisterBase<0x40070044, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH2_DTG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +248,7 @@ struct MDR_TIMER1
 
   struct CH3_DTG : public RegisterBase<0x40070048, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH3_DTG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +259,7 @@ struct MDR_TIMER1
 
   struct CH4_DTG : public RegisterBase<0x4007004C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH4_DTG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +274,7 @@ struct MDR_TIMER1
     using ETR_INV = MDR_TIMER1_BRKETR_CNTRL_ETR_INV_Values<MDR_TIMER1::BRKETR_CNTRL, 1, 1, ReadWriteMode, MDR_TIMER1BRKETR_CNTRLBase> ;
     using ETR_PSC = MDR_TIMER1_BRKETR_CNTRL_ETR_PSC_Values<MDR_TIMER1::BRKETR_CNTRL, 2, 2, ReadWriteMode, MDR_TIMER1BRKETR_CNTRLBase> ;
     using ETR_Filter = MDR_TIMER1_BRKETR_CNTRL_ETR_Filter_Values<MDR_TIMER1::BRKETR_CNTRL, 4, 4, ReadWriteMode, MDR_TIMER1BRKETR_CNTRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MDR_TIMER1_BRKETR_CNTRL_ETR_Filter_Values<MDR_TIMER1::BRKETR_CNTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -281,6 +302,7 @@ struct MDR_TIMER1
     using CCR1_CAP_CH2 = MDR_TIMER1_STATUS_CCR1_CAP_CH2_Values<MDR_TIMER1::STATUS, 14, 1, ReadWriteMode, MDR_TIMER1STATUSBase> ;
     using CCR1_CAP_CH3 = MDR_TIMER1_STATUS_CCR1_CAP_CH3_Values<MDR_TIMER1::STATUS, 15, 1, ReadWriteMode, MDR_TIMER1STATUSBase> ;
     using CCR1_CAP_CH4 = MDR_TIMER1_STATUS_CCR1_CAP_CH4_Values<MDR_TIMER1::STATUS, 16, 1, ReadWriteMode, MDR_TIMER1STATUSBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = MDR_TIMER1_STATUS_CCR1_CAP_CH4_Values<MDR_TIMER1::STATUS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -308,6 +330,7 @@ struct MDR_TIMER1
     using CCR1_CAP_CH2_IE = MDR_TIMER1_IE_CCR1_CAP_CH2_IE_Values<MDR_TIMER1::IE, 14, 1, ReadWriteMode, MDR_TIMER1IEBase> ;
     using CCR1_CAP_CH3_IE = MDR_TIMER1_IE_CCR1_CAP_CH3_IE_Values<MDR_TIMER1::IE, 15, 1, ReadWriteMode, MDR_TIMER1IEBase> ;
     using CCR1_CAP_CH4_IE = MDR_TIMER1_IE_CCR1_CAP_CH4_IE_Values<MDR_TIMER1::IE, 16, 1, ReadWriteMode, MDR_TIMER1IEBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = MDR_TIMER1_IE_CCR1_CAP_CH4_IE_Values<MDR_TIMER1::IE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -335,6 +358,7 @@ struct MDR_TIMER1
     using CCR1_CAP_CH2_DMAE = MDR_TIMER1_DMA_RE_CCR1_CAP_CH2_DMAE_Values<MDR_TIMER1::DMA_RE, 14, 1, ReadWriteMode, MDR_TIMER1DMA_REBase> ;
     using CCR1_CAP_CH3_DMAE = MDR_TIMER1_DMA_RE_CCR1_CAP_CH3_DMAE_Values<MDR_TIMER1::DMA_RE, 15, 1, ReadWriteMode, MDR_TIMER1DMA_REBase> ;
     using CCR1_CAP_CH4_DMAE = MDR_TIMER1_DMA_RE_CCR1_CAP_CH4_DMAE_Values<MDR_TIMER1::DMA_RE, 16, 1, ReadWriteMode, MDR_TIMER1DMA_REBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = MDR_TIMER1_DMA_RE_CCR1_CAP_CH4_DMAE_Values<MDR_TIMER1::DMA_RE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -349,6 +373,7 @@ struct MDR_TIMER1
     using CCR1_En = MDR_TIMER1_CH1_CNTRL2_CCR1_En_Values<MDR_TIMER1::CH1_CNTRL2, 2, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRL2Base> ;
     using CCRRLD = MDR_TIMER1_CH1_CNTRL2_CCRRLD_Values<MDR_TIMER1::CH1_CNTRL2, 3, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRL2Base> ;
     using CAP_CCR_Fix = MDR_TIMER1_CH1_CNTRL2_CAP_CCR_Fix_Values<MDR_TIMER1::CH1_CNTRL2, 4, 1, ReadWriteMode, MDR_TIMER1CH1_CNTRL2Base> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = MDR_TIMER1_CH1_CNTRL2_CAP_CCR_Fix_Values<MDR_TIMER1::CH1_CNTRL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -359,6 +384,7 @@ struct MDR_TIMER1
 
   struct CH2_CNTRL2 : public RegisterBase<0x40070064, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH2_CNTRL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -369,6 +395,7 @@ struct MDR_TIMER1
 
   struct CH3_CNTRL2 : public RegisterBase<0x40070068, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH3_CNTRL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +406,7 @@ struct MDR_TIMER1
 
   struct CH4_CNTRL2 : public RegisterBase<0x4007006C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CH4_CNTRL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -389,6 +417,7 @@ struct MDR_TIMER1
 
   struct CCR11 : public RegisterBase<0x40070070, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -399,6 +428,7 @@ struct MDR_TIMER1
 
   struct CCR21 : public RegisterBase<0x40070074, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -409,6 +439,7 @@ struct MDR_TIMER1
 
   struct CCR31 : public RegisterBase<0x40070078, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -419,12 +450,14 @@ struct MDR_TIMER1
 
   struct CCR41 : public RegisterBase<0x4007007C, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = <MDR_TIMER1::CCR41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCR41Pack  = Register<0x4007007C, 32, ReadWriteMode, MDR_TIMER1CCR41Base, T...> ;
 
+  using Registers = TypesList<MDR_TIMER1::CNT, MDR_TIMER1::PSG, MDR_TIMER1::ARR, MDR_TIMER1::CNTRL, MDR_TIMER1::CCR1, MDR_TIMER1::CCR2, MDR_TIMER1::CCR3, MDR_TIMER1::CCR4, MDR_TIMER1::CH1_CNTRL, MDR_TIMER1::CH2_CNTRL, MDR_TIMER1::CH3_CNTRL, MDR_TIMER1::CH4_CNTRL, MDR_TIMER1::CH1_CNTRL1, MDR_TIMER1::CH2_CNTRL1, MDR_TIMER1::CH3_CNTRL1, MDR_TIMER1::CH4_CNTRL1, MDR_TIMER1::CH1_DTG, MDR_TIMER1::CH2_DTG, MDR_TIMER1::CH3_DTG, MDR_TIMER1::CH4_DTG, MDR_TIMER1::BRKETR_CNTRL, MDR_TIMER1::STATUS, MDR_TIMER1::IE, MDR_TIMER1::DMA_RE, MDR_TIMER1::CH1_CNTRL2, MDR_TIMER1::CH2_CNTRL2, MDR_TIMER1::CH3_CNTRL2, MDR_TIMER1::CH4_CNTRL2, MDR_TIMER1::CCR11, MDR_TIMER1::CCR21, MDR_TIMER1::CCR31, MDR_TIMER1::CCR41> ;
 } ;
 
 #endif //#if !defined(MDRTIMER1REGISTERS_HPP)
@@ -27,6 +27,9 @@ struct ADC
     using EOC = ADC_ISR_EOC_Values<ADC::ISR, 2, 1, ReadWriteMode, ADCISRBase> ;
     using EOSMP = ADC_ISR_EOSMP_Values<ADC::ISR, 1, 1, ReadWriteMode, ADCISRBase> ;
     using ADRDY = ADC_ISR_ADRDY_Values<ADC::ISR, 0, 1, ReadWriteMode, ADCISRBase> ;
+    static constexpr Type WritableMask = 0x9FU ;
+    static constexpr Type OneToClearMask = 0x9FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC_ISR_ADRDY_Values<ADC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +46,7 @@ struct ADC
     using EOCIE = ADC_IER_EOCIE_Values<ADC::IER, 2, 1, ReadWriteMode, ADCIERBase> ;
     using EOSMPIE = ADC_IER_EOSMPIE_Values<ADC::IER, 1, 1, ReadWriteMode, ADCIERBase> ;
     using ADRDYIE = ADC_IER_ADRDYIE_Values<ADC::IER, 0, 1, ReadWriteMode, ADCIERBase> ;
+    static constexpr Type SnapshotMask = 0x9FU ;
     using FieldValues = ADC_IER_ADRDYIE_Values<ADC::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +62,7 @@ struct ADC
     using ADSTART = ADC_CR_ADSTART_Values<ADC::CR, 2, 1, ReadWriteMode, ADCCRBase> ;
     using ADDIS = ADC_CR_ADDIS_Values<ADC::CR, 1, 1, ReadWriteMode, ADCCRBase> ;
     using ADEN = ADC_CR_ADEN_Values<ADC::CR, 0, 1, ReadWriteMode, ADCCRBase> ;
+    static constexpr Type SnapshotMask = 0x80000017U ;
     using FieldValues = ADC_CR_ADEN_Values<ADC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +88,7 @@ struct ADC
     using SCANDIR = ADC_CFGR1_SCANDIR_Values<ADC::CFGR1, 2, 1, ReadWriteMode, ADCCFGR1Base> ;
     using DMACFG = ADC_CFGR1_DMACFG_Values<ADC::CFGR1, 1, 1, ReadWriteMode, ADCCFGR1Base> ;
     using DMAEN = ADC_CFGR1_DMAEN_Values<ADC::CFGR1, 0, 1, ReadWriteMode, ADCCFGR1Base> ;
+    static constexpr Type SnapshotMask = 0x7CC1FDFFU ;
     using FieldValues = ADC_CFGR1_DMAEN_Values<ADC::CFGR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +101,7 @@ struct ADC
   {
     using JITOFF_D4 = ADC_CFGR2_JITOFF_D4_Values<ADC::CFGR2, 31, 1, ReadWriteMode, ADCCFGR2Base> ;
     using JITOFF_D2 = ADC_CFGR2_JITOFF_D2_Values<ADC::CFGR2, 30, 1, ReadWriteMode, ADCCFGR2Base> ;
+    static constexpr Type SnapshotMask = 0xC0000000U ;
     using FieldValues = ADC_CFGR2_JITOFF_D2_Values<ADC::CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +113,7 @@ struct ADC
   struct SMPR : public RegisterBase<0x40012414, 32, ReadWriteMode>
   {
     using SMPRField = ADC_SMPR_SMPR_Values<ADC::SMPR, 0, 3, ReadWriteMode, ADCSMPRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = ADC_SMPR_SMPR_Values<ADC::SMPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +126,7 @@ struct ADC
   {
     using HT = ADC_TR_HT_Values<ADC::TR, 16, 12, ReadWriteMode, ADCTRBase> ;
     using LT = ADC_TR_LT_Values<ADC::TR, 0, 12, ReadWriteMode, ADCTRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC_TR_LT_Values<ADC::TR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,6 +156,7 @@ struct ADC
     using CHSEL2 = ADC_CHSELR_CHSEL2_Values<ADC::CHSELR, 2, 1, ReadWriteMode, ADCCHSELRBase> ;
     using CHSEL1 = ADC_CHSELR_CHSEL1_Values<ADC::CHSELR, 1, 1, ReadWriteMode, ADCCHSELRBase> ;
     using CHSEL0 = ADC_CHSELR_CHSEL0_Values<ADC::CHSELR, 0, 1, ReadWriteMode, ADCCHSELRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFU ;
     using FieldValues = ADC_CHSELR_CHSEL0_Values<ADC::CHSELR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,12 +181,14 @@ struct ADC
     using VBATEN = ADC_CCR_VBATEN_Values<ADC::CCR, 24, 1, ReadWriteMode, ADCCCRBase> ;
     using TSEN = ADC_CCR_TSEN_Values<ADC::CCR, 23, 1, ReadWriteMode, ADCCCRBase> ;
     using VREFEN = ADC_CCR_VREFEN_Values<ADC::CCR, 22, 1, ReadWriteMode, ADCCCRBase> ;
+    static constexpr Type SnapshotMask = 0x1C00000U ;
     using FieldValues = ADC_CCR_VREFEN_Values<ADC::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCRPack  = Register<0x40012708, 32, ReadWriteMode, ADCCCRBase, T...> ;
 
+  using Registers = TypesList<ADC::ISR, ADC::IER, ADC::CR, ADC::CFGR1, ADC::CFGR2, ADC::SMPR, ADC::TR, ADC::CHSELR, ADC::DR, ADC::CCR> ;
 } ;
 
 #endif //#if !defined(ADCREGISTERS_HPP)
@@ -24,6 +24,7 @@ struct CEC
     using TXEOM = CEC_CR_TXEOM_Values<CEC::CR, 2, 1, ReadWriteMode, CECCRBase> ;
     using TXSOM = CEC_CR_TXSOM_Values<CEC::CR, 1, 1, ReadWriteMode, CECCRBase> ;
     using CECEN = CEC_CR_CECEN_Values<CEC::CR, 0, 1, ReadWriteMode, CECCRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = CEC_CR_CECEN_Values<CEC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +42,7 @@ struct CEC
     using SFT = CEC_CFGR_SFT_Values<CEC::CFGR, 5, 3, ReadWriteMode, CECCFGRBase> ;
     using LSTN = CEC_CFGR_LSTN_Values<CEC::CFGR, 4, 1, ReadWriteMode, CECCFGRBase> ;
     using OAR = CEC_CFGR_OAR_Values<CEC::CFGR, 0, 4, ReadWriteMode, CECCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = CEC_CFGR_OAR_Values<CEC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -86,6 +88,7 @@ struct CEC
     using RXOVR = CEC_ISR_RXOVR_Values<CEC::ISR, 2, 1, ReadWriteMode, CECISRBase> ;
     using RXEND = CEC_ISR_RXEND_Values<CEC::ISR, 1, 1, ReadWriteMode, CECISRBase> ;
     using RXBR = CEC_ISR_RXBR_Values<CEC::ISR, 0, 1, ReadWriteMode, CECISRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CEC_ISR_RXBR_Values<CEC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,12 +112,14 @@ struct CEC
     using RXOVRIE = CEC_IER_RXOVRIE_Values<CEC::IER, 2, 1, ReadWriteMode, CECIERBase> ;
     using RXENDIE = CEC_IER_RXENDIE_Values<CEC::IER, 1, 1, ReadWriteMode, CECIERBase> ;
     using RXBRIE = CEC_IER_RXBRIE_Values<CEC::IER, 0, 1, ReadWriteMode, CECIERBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
     using FieldValues = CEC_IER_RXBRIE_Values<CEC::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using IERPack  = Register<0x40007814, 32, ReadWriteMode, CECIERBase, T...> ;
 
+  using Registers = TypesList<CEC::CR, CEC::CFGR, CEC::TXDR, CEC::RXDR, CEC::ISR, CEC::IER> ;
 } ;
 
 #endif //#if !defined(CECREGISTERS_HPP)
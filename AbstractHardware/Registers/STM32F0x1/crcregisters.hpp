@@ -22,6 +22,7 @@ struct CRC
   struct DR : public RegisterBase<0x40023000, 32, ReadWriteMode>
   {
     using DRField = CRC_DR_DR_Values<CRC::DR, 0, 32, ReadWriteMode, CRCDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CRC_DR_DR_Values<CRC::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct CRC
   struct IDR : public RegisterBase<0x40023004, 32, ReadWriteMode>
   {
     using IDRField = CRC_IDR_IDR_Values<CRC::IDR, 0, 8, ReadWriteMode, CRCIDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CRC_IDR_IDR_Values<CRC::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +49,7 @@ struct CRC
     using POLYSIZE = CRC_CR_POLYSIZE_Values<CRC::CR, 3, 2, ReadWriteMode, CRCCRBase> ;
     using REV_IN = CRC_CR_REV_IN_Values<CRC::CR, 5, 2, ReadWriteMode, CRCCRBase> ;
     using REV_OUT = CRC_CR_REV_OUT_Values<CRC::CR, 7, 1, ReadWriteMode, CRCCRBase> ;
+    static constexpr Type SnapshotMask = 0xF9U ;
     using FieldValues = CRC_CR_REV_OUT_Values<CRC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,12 +61,14 @@ struct CRC
   struct INIT : public RegisterBase<0x4002300C, 32, ReadWriteMode>
   {
     using INITField = CRC_INIT_INIT_Values<CRC::INIT, 0, 32, ReadWriteMode, CRCINITBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRC_INIT_INIT_Values<CRC::INIT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using INITPack  = Register<0x4002300C, 32, ReadWriteMode, CRCINITBase, T...> ;
 
+  using Registers = TypesList<CRC::DR, CRC::IDR, CRC::CR, CRC::INIT> ;
 } ;
 
 #endif //#if !defined(CRCREGISTERS_HPP)
@@ -37,6 +37,7 @@ struct DAC
     using MAMP2 = DAC_CR_MAMP2_Values<DAC::CR, 24, 4, ReadWriteMode, DACCRBase> ;
     using DMAEN2 = DAC_CR_DMAEN2_Values<DAC::CR, 28, 1, ReadWriteMode, DACCRBase> ;
     using DMAUDRIE2 = DAC_CR_DMAUDRIE2_Values<DAC::CR, 29, 1, ReadWriteMode, DACCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFF3FFFU ;
     using FieldValues = DAC_CR_DMAUDRIE2_Values<DAC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +61,7 @@ struct DAC
   struct DHR12R1 : public RegisterBase<0x40007408, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC_DHR12R1_DACC1DHR_Values<DAC::DHR12R1, 0, 12, ReadWriteMode, DACDHR12R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC_DHR12R1_DACC1DHR_Values<DAC::DHR12R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct DAC
   struct DHR12L1 : public RegisterBase<0x4000740C, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC_DHR12L1_DACC1DHR_Values<DAC::DHR12L1, 4, 12, ReadWriteMode, DACDHR12L1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC_DHR12L1_DACC1DHR_Values<DAC::DHR12L1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +85,7 @@ struct DAC
   struct DHR8R1 : public RegisterBase<0x40007410, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC_DHR8R1_DACC1DHR_Values<DAC::DHR8R1, 0, 8, ReadWriteMode, DACDHR8R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC_DHR8R1_DACC1DHR_Values<DAC::DHR8R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -105,6 +109,7 @@ struct DAC
   {
     using DMAUDR2 = DAC_SR_DMAUDR2_Values<DAC::SR, 29, 1, ReadWriteMode, DACSRBase> ;
     using DMAUDR1 = DAC_SR_DMAUDR1_Values<DAC::SR, 13, 1, ReadWriteMode, DACSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = DAC_SR_DMAUDR1_Values<DAC::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -116,6 +121,7 @@ struct DAC
   struct DHR12R2 : public RegisterBase<0x40007414, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC_DHR12R2_DACC2DHR_Values<DAC::DHR12R2, 0, 12, ReadWriteMode, DACDHR12R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC_DHR12R2_DACC2DHR_Values<DAC::DHR12R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +133,7 @@ struct DAC
   struct DHR12L2 : public RegisterBase<0x40007418, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC_DHR12L2_DACC2DHR_Values<DAC::DHR12L2, 4, 12, ReadWriteMode, DACDHR12L2Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC_DHR12L2_DACC2DHR_Values<DAC::DHR12L2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -138,6 +145,7 @@ struct DAC
   struct DHR8R2 : public RegisterBase<0x4000741C, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC_DHR8R2_DACC2DHR_Values<DAC::DHR8R2, 0, 8, ReadWriteMode, DACDHR8R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC_DHR8R2_DACC2DHR_Values<DAC::DHR8R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +158,7 @@ struct DAC
   {
     using DACC1DHR = DAC_DHR12RD_DACC1DHR_Values<DAC::DHR12RD, 0, 12, ReadWriteMode, DACDHR12RDBase> ;
     using DACC2DHR = DAC_DHR12RD_DACC2DHR_Values<DAC::DHR12RD, 16, 12, ReadWriteMode, DACDHR12RDBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = DAC_DHR12RD_DACC2DHR_Values<DAC::DHR12RD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -162,6 +171,7 @@ struct DAC
   {
     using DACC1DHR = DAC_DHR12LD_DACC1DHR_Values<DAC::DHR12LD, 4, 12, ReadWriteMode, DACDHR12LDBase> ;
     using DACC2DHR = DAC_DHR12LD_DACC2DHR_Values<DAC::DHR12LD, 20, 12, ReadWriteMode, DACDHR12LDBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFF0U ;
     using FieldValues = DAC_DHR12LD_DACC2DHR_Values<DAC::DHR12LD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -174,6 +184,7 @@ struct DAC
   {
     using DACC2DHR = DAC_DHR8RD_DACC2DHR_Values<DAC::DHR8RD, 8, 8, ReadWriteMode, DACDHR8RDBase> ;
     using DACC1DHR = DAC_DHR8RD_DACC1DHR_Values<DAC::DHR8RD, 0, 8, ReadWriteMode, DACDHR8RDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DAC_DHR8RD_DACC1DHR_Values<DAC::DHR8RD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +202,7 @@ struct DAC
   template<typename... T> 
   using DOR2Pack  = Register<0x40007430, 32, ReadMode, DACDOR2Base, T...> ;
 
+  using Registers = TypesList<DAC::CR, DAC::SWTRIGR, DAC::DHR12R1, DAC::DHR12L1, DAC::DHR8R1, DAC::DOR1, DAC::SR, DAC::DHR12R2, DAC::DHR12L2, DAC::DHR8R2, DAC::DHR12RD, DAC::DHR12LD, DAC::DHR8RD, DAC::DOR2> ;
 } ;
 
 #endif //#if !defined(DACREGISTERS_HPP)
@@ -36,6 +36,7 @@ struct DBGMCU
   {
     using DBG_STOP = DBGMCU_CR_DBG_STOP_Values<DBGMCU::CR, 1, 1, ReadWriteMode, DBGMCUCRBase> ;
     using DBG_STANDBY = DBGMCU_CR_DBG_STANDBY_Values<DBGMCU::CR, 2, 1, ReadWriteMode, DBGMCUCRBase> ;
+    static constexpr Type SnapshotMask = 0x6U ;
     using FieldValues = DBGMCU_CR_DBG_STANDBY_Values<DBGMCU::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -56,6 +57,7 @@ struct DBGMCU
     using DBG_IWDG_STOP = DBGMCU_APB1_FZ_DBG_IWDG_STOP_Values<DBGMCU::APB1_FZ, 12, 1, ReadWriteMode, DBGMCUAPB1_FZBase> ;
     using DBG_I2C1_SMBUS_TIMEOUT = DBGMCU_APB1_FZ_DBG_I2C1_SMBUS_TIMEOUT_Values<DBGMCU::APB1_FZ, 21, 1, ReadWriteMode, DBGMCUAPB1_FZBase> ;
     using DBG_CAN_STOP = DBGMCU_APB1_FZ_DBG_CAN_STOP_Values<DBGMCU::APB1_FZ, 25, 1, ReadWriteMode, DBGMCUAPB1_FZBase> ;
+    static constexpr Type SnapshotMask = 0x2201D33U ;
     using FieldValues = DBGMCU_APB1_FZ_DBG_CAN_STOP_Values<DBGMCU::APB1_FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,12 +72,14 @@ struct DBGMCU
     using DBG_TIM15_STOP = DBGMCU_APB2_FZ_DBG_TIM15_STOP_Values<DBGMCU::APB2_FZ, 16, 1, ReadWriteMode, DBGMCUAPB2_FZBase> ;
     using DBG_TIM16_STOP = DBGMCU_APB2_FZ_DBG_TIM16_STOP_Values<DBGMCU::APB2_FZ, 17, 1, ReadWriteMode, DBGMCUAPB2_FZBase> ;
     using DBG_TIM17_STOP = DBGMCU_APB2_FZ_DBG_TIM17_STOP_Values<DBGMCU::APB2_FZ, 18, 1, ReadWriteMode, DBGMCUAPB2_FZBase> ;
+    static constexpr Type SnapshotMask = 0x70800U ;
     using FieldValues = DBGMCU_APB2_FZ_DBG_TIM17_STOP_Values<DBGMCU::APB2_FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using APB2_FZPack  = Register<0x4001580C, 32, ReadWriteMode, DBGMCUAPB2_FZBase, T...> ;
 
+  using Registers = TypesList<DBGMCU::IDCODE, DBGMCU::CR, DBGMCU::APB1_FZ, DBGMCU::APB2_FZ> ;
 } ;
 
 #endif //#if !defined(DBGMCUREGISTERS_HPP)
@@ -0,0 +1,38 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>      //for std::uintptr_t, std::uint32_t
+#include "buses.hpp"    //for BusCost
+
+//Характеристики микроконтроллера STM32F0x1, которые нужны уровню регистров
+struct DeviceTraits
+{
+  //Cortex-M0 не поддерживает bit-band,
+  //поэтому битовые поля всегда устанавливаются через чтение-модификацию-запись
+  static constexpr bool IsBitBandSupported = false ;
+  static constexpr std::uintptr_t PeripheralBase = 0U ;
+  static constexpr std::uintptr_t PeripheralSize = 0U ;
+  static constexpr std::uintptr_t PeripheralBitBandBase = 0U ;
+
+  //Делитель частоты шины APB относительно частоты ядра, должен совпадать с настройкой RCC
+  static constexpr std::uint32_t Apb1Prescaler = 1U ;
+} ;
+
+//Оценка стоимости обращения к регистрам периферии в тактах ядра. У Cortex-M0 нет буфера записи,
+//поэтому запись через мост APB стоит столько же, сколько и чтение
+template<>
+struct BusCost<Apb1Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 2U + 2U * DeviceTraits::Apb1Prescaler ;
+  static constexpr std::uint32_t WriteCycles = 2U + 2U * DeviceTraits::Apb1Prescaler ;
+} ;
+
+template<>
+struct BusCost<Ahb2Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 2U ;
+  static constexpr std::uint32_t WriteCycles = 2U ;
+} ;
@@ -49,6 +49,7 @@ struct EXTI
     using MR25 = EXTI_IMR_MR25_Values<EXTI::IMR, 25, 1, ReadWriteMode, EXTIIMRBase> ;
     using MR26 = EXTI_IMR_MR26_Values<EXTI::IMR, 26, 1, ReadWriteMode, EXTIIMRBase> ;
     using MR27 = EXTI_IMR_MR27_Values<EXTI::IMR, 27, 1, ReadWriteMode, EXTIIMRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = EXTI_IMR_MR27_Values<EXTI::IMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -87,6 +88,7 @@ struct EXTI
     using MR25 = EXTI_EMR_MR25_Values<EXTI::EMR, 25, 1, ReadWriteMode, EXTIEMRBase> ;
     using MR26 = EXTI_EMR_MR26_Values<EXTI::EMR, 26, 1, ReadWriteMode, EXTIEMRBase> ;
     using MR27 = EXTI_EMR_MR27_Values<EXTI::EMR, 27, 1, ReadWriteMode, EXTIEMRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = EXTI_EMR_MR27_Values<EXTI::EMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -116,6 +118,7 @@ struct EXTI
     using TR16 = EXTI_RTSR_TR16_Values<EXTI::RTSR, 16, 1, ReadWriteMode, EXTIRTSRBase> ;
     using TR17 = EXTI_RTSR_TR17_Values<EXTI::RTSR, 17, 1, ReadWriteMode, EXTIRTSRBase> ;
     using TR19 = EXTI_RTSR_TR19_Values<EXTI::RTSR, 19, 1, ReadWriteMode, EXTIRTSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFFFU ;
     using FieldValues = EXTI_RTSR_TR19_Values<EXTI::RTSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +148,7 @@ struct EXTI
     using TR16 = EXTI_FTSR_TR16_Values<EXTI::FTSR, 16, 1, ReadWriteMode, EXTIFTSRBase> ;
     using TR17 = EXTI_FTSR_TR17_Values<EXTI::FTSR, 17, 1, ReadWriteMode, EXTIFTSRBase> ;
     using TR19 = EXTI_FTSR_TR19_Values<EXTI::FTSR, 19, 1, ReadWriteMode, EXTIFTSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFFFU ;
     using FieldValues = EXTI_FTSR_TR19_Values<EXTI::FTSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -174,6 +178,7 @@ struct EXTI
     using SWIER16 = EXTI_SWIER_SWIER16_Values<EXTI::SWIER, 16, 1, ReadWriteMode, EXTISWIERBase> ;
     using SWIER17 = EXTI_SWIER_SWIER17_Values<EXTI::SWIER, 17, 1, ReadWriteMode, EXTISWIERBase> ;
     using SWIER19 = EXTI_SWIER_SWIER19_Values<EXTI::SWIER, 19, 1, ReadWriteMode, EXTISWIERBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_SWIER_SWIER19_Values<EXTI::SWIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,12 +208,16 @@ struct EXTI
     using PR16 = EXTI_PR_PR16_Values<EXTI::PR, 16, 1, ReadWriteMode, EXTIPRBase> ;
     using PR17 = EXTI_PR_PR17_Values<EXTI::PR, 17, 1, ReadWriteMode, EXTIPRBase> ;
     using PR19 = EXTI_PR_PR19_Values<EXTI::PR, 19, 1, ReadWriteMode, EXTIPRBase> ;
+    static constexpr Type WritableMask = 0xBFFFFU ;
+    static constexpr Type OneToClearMask = 0xBFFFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PR_PR19_Values<EXTI::PR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PRPack  = Register<0x40010414, 32, ReadWriteMode, EXTIPRBase, T...> ;
 
+  using Registers = TypesList<EXTI::IMR, EXTI::EMR, EXTI::RTSR, EXTI::FTSR, EXTI::SWIER, EXTI::PR> ;
 } ;
 
 #endif //#if !defined(EXTIREGISTERS_HPP)
@@ -24,6 +24,7 @@ struct Flash
     using LATENCY = Flash_ACR_LATENCY_Values<Flash::ACR, 0, 3, ReadWriteMode, FlashACRBase> ;
     using PRFTBE = Flash_ACR_PRFTBE_Values<Flash::ACR, 4, 1, ReadWriteMode, FlashACRBase> ;
     using PRFTBS = Flash_ACR_PRFTBS_Values<Flash::ACR, 5, 1, ReadMode, FlashACRBase> ;
+    static constexpr Type SnapshotMask = 0x17U ;
     using FieldValues = Flash_ACR_PRFTBS_Values<Flash::ACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +61,9 @@ struct Flash
     using WRPRT = Flash_SR_WRPRT_Values<Flash::SR, 4, 1, ReadWriteMode, FlashSRBase> ;
     using PGERR = Flash_SR_PGERR_Values<Flash::SR, 2, 1, ReadWriteMode, FlashSRBase> ;
     using BSY = Flash_SR_BSY_Values<Flash::SR, 0, 1, ReadMode, FlashSRBase> ;
+    static constexpr Type WritableMask = 0x34U ;
+    static constexpr Type OneToClearMask = 0x34U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = Flash_SR_BSY_Values<Flash::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct Flash
     using MER = Flash_CR_MER_Values<Flash::CR, 2, 1, ReadWriteMode, FlashCRBase> ;
     using PER = Flash_CR_PER_Values<Flash::CR, 1, 1, ReadWriteMode, FlashCRBase> ;
     using PG = Flash_CR_PG_Values<Flash::CR, 0, 1, ReadWriteMode, FlashCRBase> ;
+    static constexpr Type SnapshotMask = 0x36B7U ;
     using FieldValues = Flash_CR_PG_Values<Flash::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct Flash
   template<typename... T> 
   using WRPRPack  = Register<0x40022020, 32, ReadMode, FlashWRPRBase, T...> ;
 
+  using Registers = TypesList<Flash::ACR, Flash::KEYR, Flash::OPTKEYR, Flash::SR, Flash::CR, Flash::AR, Flash::OBR, Flash::WRPR> ;
 } ;
 
 #endif //#if !defined(FLASHREGISTERS_HPP)
@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOC
 {
+  struct BSRR ;
+
   struct GPIOCMODERBase {} ;
 
   struct MODER : public RegisterBase<0x48000800, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOC
     using MODER2 = GPIOC_MODER_MODER2_Values<GPIOC::MODER, 4, 2, ReadWriteMode, GPIOCMODERBase> ;
     using MODER1 = GPIOC_MODER_MODER1_Values<GPIOC::MODER, 2, 2, ReadWriteMode, GPIOCMODERBase> ;
     using MODER0 = GPIOC_MODER_MODER0_Values<GPIOC::MODER, 0, 2, ReadWriteMode, GPIOCMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOC_MODER_MODER0_Values<GPIOC::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOC
     using OT2 = GPIOC_OTYPER_OT2_Values<GPIOC::OTYPER, 2, 1, ReadWriteMode, GPIOCOTYPERBase> ;
     using OT1 = GPIOC_OTYPER_OT1_Values<GPIOC::OTYPER, 1, 1, ReadWriteMode, GPIOCOTYPERBase> ;
     using OT0 = GPIOC_OTYPER_OT0_Values<GPIOC::OTYPER, 0, 1, ReadWriteMode, GPIOCOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOC_OTYPER_OT0_Values<GPIOC::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOC
     using OSPEEDR2 = GPIOC_OSPEEDR_OSPEEDR2_Values<GPIOC::OSPEEDR, 4, 2, ReadWriteMode, GPIOCOSPEEDRBase> ;
     using OSPEEDR1 = GPIOC_OSPEEDR_OSPEEDR1_Values<GPIOC::OSPEEDR, 2, 2, ReadWriteMode, GPIOCOSPEEDRBase> ;
     using OSPEEDR0 = GPIOC_OSPEEDR_OSPEEDR0_Values<GPIOC::OSPEEDR, 0, 2, ReadWriteMode, GPIOCOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOC_OSPEEDR_OSPEEDR0_Values<GPIOC::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOC
     using PUPDR2 = GPIOC_PUPDR_PUPDR2_Values<GPIOC::PUPDR, 4, 2, ReadWriteMode, GPIOCPUPDRBase> ;
     using PUPDR1 = GPIOC_PUPDR_PUPDR1_Values<GPIOC::PUPDR, 2, 2, ReadWriteMode, GPIOCPUPDRBase> ;
     using PUPDR0 = GPIOC_PUPDR_PUPDR0_Values<GPIOC::PUPDR, 0, 2, ReadWriteMode, GPIOCPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOC_PUPDR_PUPDR0_Values<GPIOC::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOC
     using IDR2 = GPIOC_IDR_IDR2_Values<GPIOC::IDR, 2, 1, ReadMode, GPIOCIDRBase> ;
     using IDR1 = GPIOC_IDR_IDR1_Values<GPIOC::IDR, 1, 1, ReadMode, GPIOCIDRBase> ;
     using IDR0 = GPIOC_IDR_IDR0_Values<GPIOC::IDR, 0, 1, ReadMode, GPIOCIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOC_IDR_IDR0_Values<GPIOC::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOC
     using ODR2 = GPIOC_ODR_ODR2_Values<GPIOC::ODR, 2, 1, ReadWriteMode, GPIOCODRBase> ;
     using ODR1 = GPIOC_ODR_ODR1_Values<GPIOC::ODR, 1, 1, ReadWriteMode, GPIOCODRBase> ;
     using ODR0 = GPIOC_ODR_ODR0_Values<GPIOC::ODR, 0, 1, ReadWriteMode, GPIOCODRBase> ;
+    using SetResetRegister = GPIOC::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOC_ODR_ODR0_Values<GPIOC::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOC
     using BS2 = GPIOC_BSRR_BS2_Values<GPIOC::BSRR, 2, 1, WriteMode, GPIOCBSRRBase> ;
     using BS1 = GPIOC_BSRR_BS1_Values<GPIOC::BSRR, 1, 1, WriteMode, GPIOCBSRRBase> ;
     using BS0 = GPIOC_BSRR_BS0_Values<GPIOC::BSRR, 0, 1, WriteMode, GPIOCBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOC_BSRR_BS0_Values<GPIOC::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOC
     using LCK2 = GPIOC_LCKR_LCK2_Values<GPIOC::LCKR, 2, 1, ReadWriteMode, GPIOCLCKRBase> ;
     using LCK1 = GPIOC_LCKR_LCK1_Values<GPIOC::LCKR, 1, 1, ReadWriteMode, GPIOCLCKRBase> ;
     using LCK0 = GPIOC_LCKR_LCK0_Values<GPIOC::LCKR, 0, 1, ReadWriteMode, GPIOCLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOC_LCKR_LCK0_Values<GPIOC::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOC
     using AFRL2 = GPIOC_AFRL_AFRL2_Values<GPIOC::AFRL, 8, 4, ReadWriteMode, GPIOCAFRLBase> ;
     using AFRL1 = GPIOC_AFRL_AFRL1_Values<GPIOC::AFRL, 4, 4, ReadWriteMode, GPIOCAFRLBase> ;
     using AFRL0 = GPIOC_AFRL_AFRL0_Values<GPIOC::AFRL, 0, 4, ReadWriteMode, GPIOCAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOC_AFRL_AFRL0_Values<GPIOC::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,6 +310,10 @@ struct GPIOC
     using AFRH10 = GPIOC_AFRH_AFRH10_Values<GPIOC::AFRH, 8, 4, ReadWriteMode, GPIOCAFRHBase> ;
     using AFRH9 = GPIOC_AFRH_AFRH9_Values<GPIOC::AFRH, 4, 4, ReadWriteMode, GPIOCAFRHBase> ;
     using AFRH8 = GPIOC_AFRH_AFRH8_Values<GPIOC::AFRH, 0, 4, ReadWriteMode, GPIOCAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOC_AFRH_AFRH8_Values<GPIOC::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -298,12 +340,16 @@ struct GPIOC
     using BR13 = GPIOC_BRR_BR13_Values<GPIOC::BRR, 13, 1, WriteMode, GPIOCBRRBase> ;
     using BR14 = GPIOC_BRR_BR14_Values<GPIOC::BRR, 14, 1, WriteMode, GPIOCBRRBase> ;
     using BR15 = GPIOC_BRR_BR15_Values<GPIOC::BRR, 15, 1, WriteMode, GPIOCBRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    template<std::size_t index>
+    using Field = typename BRArray::template Field<index> ;
     using FieldValues = GPIOC_BRR_BR15_Values<GPIOC::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BRRPack  = Register<0x48000828, 32, WriteMode, GPIOCBRRBase, T...> ;
 
+  using Registers = TypesList<GPIOC::MODER, GPIOC::OTYPER, GPIOC::OSPEEDR, GPIOC::PUPDR, GPIOC::IDR, GPIOC::ODR, GPIOC::BSRR, GPIOC::LCKR, GPIOC::AFRL, GPIOC::AFRH, GPIOC::BRR> ;
 } ;
 
 #endif //#if !defined(GPIOCREGISTERS_HPP)
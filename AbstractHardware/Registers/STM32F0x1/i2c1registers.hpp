@@ -42,6 +42,8 @@ struct I2C1
     using SMBDEN = I2C1_CR1_SMBDEN_Values<I2C1::CR1, 21, 1, ReadWriteMode, I2C1CR1Base> ;
     using ALERTEN = I2C1_CR1_ALERTEN_Values<I2C1::CR1, 22, 1, ReadWriteMode, I2C1CR1Base> ;
     using PECEN = I2C1_CR1_PECEN_Values<I2C1::CR1, 23, 1, ReadWriteMode, I2C1CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = I2C1_CR1_PECEN_Values<I2C1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +67,7 @@ struct I2C1
     using SADD8 = I2C1_CR2_SADD8_Values<I2C1::CR2, 8, 2, ReadWriteMode, I2C1CR2Base> ;
     using SADD1 = I2C1_CR2_SADD1_Values<I2C1::CR2, 1, 7, ReadWriteMode, I2C1CR2Base> ;
     using SADD0 = I2C1_CR2_SADD0_Values<I2C1::CR2, 0, 1, ReadWriteMode, I2C1CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = I2C1_CR2_SADD0_Values<I2C1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +83,7 @@ struct I2C1
     using OA1_8 = I2C1_OAR1_OA1_8_Values<I2C1::OAR1, 8, 2, ReadWriteMode, I2C1OAR1Base> ;
     using OA1MODE = I2C1_OAR1_OA1MODE_Values<I2C1::OAR1, 10, 1, ReadWriteMode, I2C1OAR1Base> ;
     using OA1EN = I2C1_OAR1_OA1EN_Values<I2C1::OAR1, 15, 1, ReadWriteMode, I2C1OAR1Base> ;
+    static constexpr Type SnapshotMask = 0x87FFU ;
     using FieldValues = I2C1_OAR1_OA1EN_Values<I2C1::OAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +97,7 @@ struct I2C1
     using OA2 = I2C1_OAR2_OA2_Values<I2C1::OAR2, 1, 7, ReadWriteMode, I2C1OAR2Base> ;
     using OA2MSK = I2C1_OAR2_OA2MSK_Values<I2C1::OAR2, 8, 3, ReadWriteMode, I2C1OAR2Base> ;
     using OA2EN = I2C1_OAR2_OA2EN_Values<I2C1::OAR2, 15, 1, ReadWriteMode, I2C1OAR2Base> ;
+    static constexpr Type SnapshotMask = 0x87FEU ;
     using FieldValues = I2C1_OAR2_OA2EN_Values<I2C1::OAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +113,7 @@ struct I2C1
     using SDADEL = I2C1_TIMINGR_SDADEL_Values<I2C1::TIMINGR, 16, 4, ReadWriteMode, I2C1TIMINGRBase> ;
     using SCLDEL = I2C1_TIMINGR_SCLDEL_Values<I2C1::TIMINGR, 20, 4, ReadWriteMode, I2C1TIMINGRBase> ;
     using PRESC = I2C1_TIMINGR_PRESC_Values<I2C1::TIMINGR, 28, 4, ReadWriteMode, I2C1TIMINGRBase> ;
+    static constexpr Type SnapshotMask = 0xF0FFFFFFU ;
     using FieldValues = I2C1_TIMINGR_PRESC_Values<I2C1::TIMINGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -123,6 +129,7 @@ struct I2C1
     using TIMOUTEN = I2C1_TIMEOUTR_TIMOUTEN_Values<I2C1::TIMEOUTR, 15, 1, ReadWriteMode, I2C1TIMEOUTRBase> ;
     using TIMEOUTB = I2C1_TIMEOUTR_TIMEOUTB_Values<I2C1::TIMEOUTR, 16, 12, ReadWriteMode, I2C1TIMEOUTRBase> ;
     using TEXTEN = I2C1_TIMEOUTR_TEXTEN_Values<I2C1::TIMEOUTR, 31, 1, ReadWriteMode, I2C1TIMEOUTRBase> ;
+    static constexpr Type SnapshotMask = 0x8FFF9FFFU ;
     using FieldValues = I2C1_TIMEOUTR_TEXTEN_Values<I2C1::TIMEOUTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +157,7 @@ struct I2C1
     using RXNE = I2C1_ISR_RXNE_Values<I2C1::ISR, 2, 1, ReadMode, I2C1ISRBase> ;
     using TXIS = I2C1_ISR_TXIS_Values<I2C1::ISR, 1, 1, ReadWriteMode, I2C1ISRBase> ;
     using TXE = I2C1_ISR_TXE_Values<I2C1::ISR, 0, 1, ReadWriteMode, I2C1ISRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C1_ISR_TXE_Values<I2C1::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -202,12 +210,14 @@ struct I2C1
   struct TXDR : public RegisterBase<0x40005428, 32, ReadWriteMode>
   {
     using TXDATA = I2C1_TXDR_TXDATA_Values<I2C1::TXDR, 0, 8, ReadWriteMode, I2C1TXDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C1_TXDR_TXDATA_Values<I2C1::TXDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TXDRPack  = Register<0x40005428, 32, ReadWriteMode, I2C1TXDRBase, T...> ;
 
+  using Registers = TypesList<I2C1::CR1, I2C1::CR2, I2C1::OAR1, I2C1::OAR2, I2C1::TIMINGR, I2C1::TIMEOUTR, I2C1::ISR, I2C1::ICR, I2C1::PECR, I2C1::RXDR, I2C1::TXDR> ;
 } ;
 
 #endif //#if !defined(I2C1REGISTERS_HPP)
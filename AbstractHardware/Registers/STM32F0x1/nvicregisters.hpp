@@ -22,6 +22,7 @@ struct NVIC
   struct ISER : public RegisterBase<0xE000E100, 32, ReadWriteMode>
   {
     using SETENA = NVIC_ISER_SETENA_Values<NVIC::ISER, 0, 32, ReadWriteMode, NVICISERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = NVIC_ISER_SETENA_Values<NVIC::ISER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct NVIC
   struct ICER : public RegisterBase<0xE000E180, 32, ReadWriteMode>
   {
     using CLRENA = NVIC_ICER_CLRENA_Values<NVIC::ICER, 0, 32, ReadWriteMode, NVICICERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = NVIC_ICER_CLRENA_Values<NVIC::ICER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct NVIC
   struct ISPR : public RegisterBase<0xE000E200, 32, ReadWriteMode>
   {
     using SETPEND = NVIC_ISPR_SETPEND_Values<NVIC::ISPR, 0, 32, ReadWriteMode, NVICISPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = NVIC_ISPR_SETPEND_Values<NVIC::ISPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct NVIC
   struct ICPR : public RegisterBase<0xE000E280, 32, ReadWriteMode>
   {
     using CLRPEND = NVIC_ICPR_CLRPEND_Values<NVIC::ICPR, 0, 32, ReadWriteMode, NVICICPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = NVIC_ICPR_CLRPEND_Values<NVIC::ICPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +73,7 @@ struct NVIC
     using PRI_01 = NVIC_IPR0_PRI_01_Values<NVIC::IPR0, 14, 2, ReadWriteMode, NVICIPR0Base> ;
     using PRI_02 = NVIC_IPR0_PRI_02_Values<NVIC::IPR0, 22, 2, ReadWriteMode, NVICIPR0Base> ;
     using PRI_03 = NVIC_IPR0_PRI_03_Values<NVIC::IPR0, 30, 2, ReadWriteMode, NVICIPR0Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR0_PRI_03_Values<NVIC::IPR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +88,7 @@ struct NVIC
     using PRI_41 = NVIC_IPR1_PRI_41_Values<NVIC::IPR1, 14, 2, ReadWriteMode, NVICIPR1Base> ;
     using PRI_42 = NVIC_IPR1_PRI_42_Values<NVIC::IPR1, 22, 2, ReadWriteMode, NVICIPR1Base> ;
     using PRI_43 = NVIC_IPR1_PRI_43_Values<NVIC::IPR1, 30, 2, ReadWriteMode, NVICIPR1Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR1_PRI_43_Values<NVIC::IPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -97,6 +103,7 @@ struct NVIC
     using PRI_81 = NVIC_IPR2_PRI_81_Values<NVIC::IPR2, 14, 2, ReadWriteMode, NVICIPR2Base> ;
     using PRI_82 = NVIC_IPR2_PRI_82_Values<NVIC::IPR2, 22, 2, ReadWriteMode, NVICIPR2Base> ;
     using PRI_83 = NVIC_IPR2_PRI_83_Values<NVIC::IPR2, 30, 2, ReadWriteMode, NVICIPR2Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR2_PRI_83_Values<NVIC::IPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +118,7 @@ struct NVIC
     using PRI_121 = NVIC_IPR3_PRI_121_Values<NVIC::IPR3, 14, 2, ReadWriteMode, NVICIPR3Base> ;
     using PRI_122 = NVIC_IPR3_PRI_122_Values<NVIC::IPR3, 22, 2, ReadWriteMode, NVICIPR3Base> ;
     using PRI_123 = NVIC_IPR3_PRI_123_Values<NVIC::IPR3, 30, 2, ReadWriteMode, NVICIPR3Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR3_PRI_123_Values<NVIC::IPR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +133,7 @@ struct NVIC
     using PRI_161 = NVIC_IPR4_PRI_161_Values<NVIC::IPR4, 14, 2, ReadWriteMode, NVICIPR4Base> ;
     using PRI_162 = NVIC_IPR4_PRI_162_Values<NVIC::IPR4, 22, 2, ReadWriteMode, NVICIPR4Base> ;
     using PRI_163 = NVIC_IPR4_PRI_163_Values<NVIC::IPR4, 30, 2, ReadWriteMode, NVICIPR4Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR4_PRI_163_Values<NVIC::IPR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -139,6 +148,7 @@ struct NVIC
     using PRI_201 = NVIC_IPR5_PRI_201_Values<NVIC::IPR5, 14, 2, ReadWriteMode, NVICIPR5Base> ;
     using PRI_202 = NVIC_IPR5_PRI_202_Values<NVIC::IPR5, 22, 2, ReadWriteMode, NVICIPR5Base> ;
     using PRI_203 = NVIC_IPR5_PRI_203_Values<NVIC::IPR5, 30, 2, ReadWriteMode, NVICIPR5Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR5_PRI_203_Values<NVIC::IPR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +163,7 @@ struct NVIC
     using PRI_241 = NVIC_IPR6_PRI_241_Values<NVIC::IPR6, 14, 2, ReadWriteMode, NVICIPR6Base> ;
     using PRI_242 = NVIC_IPR6_PRI_242_Values<NVIC::IPR6, 22, 2, ReadWriteMode, NVICIPR6Base> ;
     using PRI_243 = NVIC_IPR6_PRI_243_Values<NVIC::IPR6, 30, 2, ReadWriteMode, NVICIPR6Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR6_PRI_243_Values<NVIC::IPR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,12 +178,14 @@ struct NVIC
     using PRI_281 = NVIC_IPR7_PRI_281_Values<NVIC::IPR7, 14, 2, ReadWriteMode, NVICIPR7Base> ;
     using PRI_282 = NVIC_IPR7_PRI_282_Values<NVIC::IPR7, 22, 2, ReadWriteMode, NVICIPR7Base> ;
     using PRI_283 = NVIC_IPR7_PRI_283_Values<NVIC::IPR7, 30, 2, ReadWriteMode, NVICIPR7Base> ;
+    static constexpr Type SnapshotMask = 0xC0C0C0C0U ;
     using FieldValues = NVIC_IPR7_PRI_283_Values<NVIC::IPR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using IPR7Pack  = Register<0xE000E41C, 32, ReadWriteMode, NVICIPR7Base, T...> ;
 
+  using Registers = TypesList<NVIC::ISER, NVIC::ICER, NVIC::ISPR, NVIC::ICPR, NVIC::IPR0, NVIC::IPR1, NVIC::IPR2, NVIC::IPR3, NVIC::IPR4, NVIC::IPR5, NVIC::IPR6, NVIC::IPR7> ;
 } ;
 
 #endif //#if !defined(NVICREGISTERS_HPP)
@@ -28,6 +28,7 @@ struct PWR
     using CWUF = PWR_CR_CWUF_Values<PWR::CR, 2, 1, ReadWriteMode, PWRCRBase> ;
     using PDDS = PWR_CR_PDDS_Values<PWR::CR, 1, 1, ReadWriteMode, PWRCRBase> ;
     using LPDS = PWR_CR_LPDS_Values<PWR::CR, 0, 1, ReadWriteMode, PWRCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFU ;
     using FieldValues = PWR_CR_LPDS_Values<PWR::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,12 +51,14 @@ struct PWR
     using EWUP6 = PWR_CSR_EWUP6_Values<PWR::CSR, 13, 1, ReadWriteMode, PWRCSRBase> ;
     using EWUP7 = PWR_CSR_EWUP7_Values<PWR::CSR, 14, 1, ReadWriteMode, PWRCSRBase> ;
     using EWUP8 = PWR_CSR_EWUP8_Values<PWR::CSR, 15, 1, ReadWriteMode, PWRCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = PWR_CSR_EWUP8_Values<PWR::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSRPack  = Register<0x40007004, 32, ReadWriteMode, PWRCSRBase, T...> ;
 
+  using Registers = TypesList<PWR::CR, PWR::CSR> ;
 } ;
 
 #endif //#if !defined(PWRREGISTERS_HPP)
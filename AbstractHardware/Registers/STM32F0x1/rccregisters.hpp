@@ -31,6 +31,7 @@ struct RCC
     using CSSON = RCC_CR_CSSON_Values<RCC::CR, 19, 1, ReadWriteMode, RCCCRBase> ;
     using PLLON = RCC_CR_PLLON_Values<RCC::CR, 24, 1, ReadWriteMode, RCCCRBase> ;
     using PLLRDY = RCC_CR_PLLRDY_Values<RCC::CR, 25, 1, ReadMode, RCCCRBase> ;
+    static constexpr Type SnapshotMask = 0x10D00F9U ;
     using FieldValues = RCC_CR_PLLRDY_Values<RCC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +53,7 @@ struct RCC
     using MCO = RCC_CFGR_MCO_Values<RCC::CFGR, 24, 3, ReadWriteMode, RCCCFGRBase> ;
     using MCOPRE = RCC_CFGR_MCOPRE_Values<RCC::CFGR, 28, 3, ReadWriteMode, RCCCFGRBase> ;
     using PLLNODIV = RCC_CFGR_PLLNODIV_Values<RCC::CFGR, 31, 1, ReadWriteMode, RCCCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xF73FC7F3U ;
     using FieldValues = RCC_CFGR_PLLNODIV_Values<RCC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +87,7 @@ struct RCC
     using HSI14RDYC = RCC_CIR_HSI14RDYC_Values<RCC::CIR, 21, 1, WriteMode, RCCCIRBase> ;
     using HSI48RDYC = RCC_CIR_HSI48RDYC_Values<RCC::CIR, 22, 1, WriteMode, RCCCIRBase> ;
     using CSSC = RCC_CIR_CSSC_Values<RCC::CIR, 23, 1, WriteMode, RCCCIRBase> ;
+    static constexpr Type SnapshotMask = 0xFF7F00U ;
     using FieldValues = RCC_CIR_CSSC_Values<RCC::CIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +107,7 @@ struct RCC
     using TIM16RST = RCC_APB2RSTR_TIM16RST_Values<RCC::APB2RSTR, 17, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using TIM17RST = RCC_APB2RSTR_TIM17RST_Values<RCC::APB2RSTR, 18, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using DBGMCURST = RCC_APB2RSTR_DBGMCURST_Values<RCC::APB2RSTR, 22, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x475A01U ;
     using FieldValues = RCC_APB2RSTR_DBGMCURST_Values<RCC::APB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +137,7 @@ struct RCC
     using PWRRST = RCC_APB1RSTR_PWRRST_Values<RCC::APB1RSTR, 28, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using DACRST = RCC_APB1RSTR_DACRST_Values<RCC::APB1RSTR, 29, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using CECRST = RCC_APB1RSTR_CECRST_Values<RCC::APB1RSTR, 30, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x7AFE4933U ;
     using FieldValues = RCC_APB1RSTR_CECRST_Values<RCC::APB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +159,7 @@ struct RCC
     using IOPDEN = RCC_AHBENR_IOPDEN_Values<RCC::AHBENR, 20, 1, ReadWriteMode, RCCAHBENRBase> ;
     using IOPFEN = RCC_AHBENR_IOPFEN_Values<RCC::AHBENR, 22, 1, ReadWriteMode, RCCAHBENRBase> ;
     using TSCEN = RCC_AHBENR_TSCEN_Values<RCC::AHBENR, 24, 1, ReadWriteMode, RCCAHBENRBase> ;
+    static constexpr Type SnapshotMask = 0x15E0057U ;
     using FieldValues = RCC_AHBENR_TSCEN_Values<RCC::AHBENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +182,7 @@ struct RCC
     using USART8EN = RCC_APB2ENR_USART8EN_Values<RCC::APB2ENR, 7, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using USART7EN = RCC_APB2ENR_USART7EN_Values<RCC::APB2ENR, 6, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using USART6EN = RCC_APB2ENR_USART6EN_Values<RCC::APB2ENR, 5, 1, ReadWriteMode, RCCAPB2ENRBase> ;
+    static constexpr Type SnapshotMask = 0x475AE1U ;
     using FieldValues = RCC_APB2ENR_USART6EN_Values<RCC::APB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +212,7 @@ struct RCC
     using PWREN = RCC_APB1ENR_PWREN_Values<RCC::APB1ENR, 28, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using DACEN = RCC_APB1ENR_DACEN_Values<RCC::APB1ENR, 29, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using CECEN = RCC_APB1ENR_CECEN_Values<RCC::APB1ENR, 30, 1, ReadWriteMode, RCCAPB1ENRBase> ;
+    static constexpr Type SnapshotMask = 0x7AFE4933U ;
     using FieldValues = RCC_APB1ENR_CECEN_Values<RCC::APB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +230,7 @@ struct RCC
     using RTCSEL = RCC_BDCR_RTCSEL_Values<RCC::BDCR, 8, 2, ReadWriteMode, RCCBDCRBase> ;
     using RTCEN = RCC_BDCR_RTCEN_Values<RCC::BDCR, 15, 1, ReadWriteMode, RCCBDCRBase> ;
     using BDRST = RCC_BDCR_BDRST_Values<RCC::BDCR, 16, 1, ReadWriteMode, RCCBDCRBase> ;
+    static constexpr Type SnapshotMask = 0x1831DU ;
     using FieldValues = RCC_BDCR_BDRST_Values<RCC::BDCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +251,7 @@ struct RCC
     using IWDGRSTF = RCC_CSR_IWDGRSTF_Values<RCC::CSR, 29, 1, ReadWriteMode, RCCCSRBase> ;
     using WWDGRSTF = RCC_CSR_WWDGRSTF_Values<RCC::CSR, 30, 1, ReadWriteMode, RCCCSRBase> ;
     using LPWRRSTF = RCC_CSR_LPWRRSTF_Values<RCC::CSR, 31, 1, ReadWriteMode, RCCCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RCC_CSR_LPWRRSTF_Values<RCC::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -258,6 +268,7 @@ struct RCC
     using IOPDRST = RCC_AHBRSTR_IOPDRST_Values<RCC::AHBRSTR, 20, 1, ReadWriteMode, RCCAHBRSTRBase> ;
     using IOPFRST = RCC_AHBRSTR_IOPFRST_Values<RCC::AHBRSTR, 22, 1, ReadWriteMode, RCCAHBRSTRBase> ;
     using TSCRST = RCC_AHBRSTR_TSCRST_Values<RCC::AHBRSTR, 24, 1, ReadWriteMode, RCCAHBRSTRBase> ;
+    static constexpr Type SnapshotMask = 0x15E0000U ;
     using FieldValues = RCC_AHBRSTR_TSCRST_Values<RCC::AHBRSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -269,6 +280,7 @@ struct RCC
   struct CFGR2 : public RegisterBase<0x4002102C, 32, ReadWriteMode>
   {
     using PREDIV = RCC_CFGR2_PREDIV_Values<RCC::CFGR2, 0, 4, ReadWriteMode, RCCCFGR2Base> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = RCC_CFGR2_PREDIV_Values<RCC::CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -285,6 +297,7 @@ struct RCC
     using USBSW = RCC_CFGR3_USBSW_Values<RCC::CFGR3, 7, 1, ReadWriteMode, RCCCFGR3Base> ;
     using ADCSW = RCC_CFGR3_ADCSW_Values<RCC::CFGR3, 8, 1, ReadWriteMode, RCCCFGR3Base> ;
     using USART2SW = RCC_CFGR3_USART2SW_Values<RCC::CFGR3, 16, 2, ReadWriteMode, RCCCFGR3Base> ;
+    static constexpr Type SnapshotMask = 0x301D3U ;
     using FieldValues = RCC_CFGR3_USART2SW_Values<RCC::CFGR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -303,12 +316,14 @@ struct RCC
     using HSI48ON = RCC_CR2_HSI48ON_Values<RCC::CR2, 16, 1, ReadWriteMode, RCCCR2Base> ;
     using HSI48RDY = RCC_CR2_HSI48RDY_Values<RCC::CR2, 17, 1, ReadMode, RCCCR2Base> ;
     using HSI48CAL = RCC_CR2_HSI48CAL_Values<RCC::CR2, 24, 1, ReadMode, RCCCR2Base> ;
+    static constexpr Type SnapshotMask = 0x100FDU ;
     using FieldValues = RCC_CR2_HSI48CAL_Values<RCC::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CR2Pack  = Register<0x40021034, 32, ReadWriteMode, RCCCR2Base, T...> ;
 
+  using Registers = TypesList<RCC::CR, RCC::CFGR, RCC::CIR, RCC::APB2RSTR, RCC::APB1RSTR, RCC::AHBENR, RCC::APB2ENR, RCC::APB1ENR, RCC::BDCR, RCC::CSR, RCC::AHBRSTR, RCC::CFGR2, RCC::CFGR3, RCC::CR2> ;
 } ;
 
 #endif //#if !defined(RCCREGISTERS_HPP)
@@ -28,6 +28,7 @@ struct RTC
     using MNU = RTC_TR_MNU_Values<RTC::TR, 8, 4, ReadWriteMode, RTCTRBase> ;
     using ST = RTC_TR_ST_Values<RTC::TR, 4, 3, ReadWriteMode, RTCTRBase> ;
     using SU = RTC_TR_SU_Values<RTC::TR, 0, 4, ReadWriteMode, RTCTRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RTC_TR_SU_Values<RTC::TR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -45,6 +46,7 @@ struct RTC
     using MU = RTC_DR_MU_Values<RTC::DR, 8, 4, ReadWriteMode, RTCDRBase> ;
     using DT = RTC_DR_DT_Values<RTC::DR, 4, 2, ReadWriteMode, RTCDRBase> ;
     using DU = RTC_DR_DU_Values<RTC::DR, 0, 4, ReadWriteMode, RTCDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RTC_DR_DU_Values<RTC::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +72,7 @@ struct RTC
     using POL = RTC_CR_POL_Values<RTC::CR, 20, 1, ReadWriteMode, RTCCRBase> ;
     using OSEL = RTC_CR_OSEL_Values<RTC::CR, 21, 2, ReadWriteMode, RTCCRBase> ;
     using COE = RTC_CR_COE_Values<RTC::CR, 23, 1, ReadWriteMode, RTCCRBase> ;
+    static constexpr Type SnapshotMask = 0xFF9978U ;
     using FieldValues = RTC_CR_COE_Values<RTC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +95,9 @@ struct RTC
     using TAMP1F = RTC_ISR_TAMP1F_Values<RTC::ISR, 13, 1, ReadWriteMode, RTCISRBase> ;
     using TAMP2F = RTC_ISR_TAMP2F_Values<RTC::ISR, 14, 1, ReadWriteMode, RTCISRBase> ;
     using RECALPF = RTC_ISR_RECALPF_Values<RTC::ISR, 16, 1, ReadMode, RTCISRBase> ;
+    static constexpr Type WritableMask = 0x79A8U ;
+    static constexpr Type ZeroToClearMask = 0x7920U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RTC_ISR_RECALPF_Values<RTC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +110,7 @@ struct RTC
   {
     using PREDIV_A = RTC_PRER_PREDIV_A_Values<RTC::PRER, 16, 7, ReadWriteMode, RTCPRERBase> ;
     using PREDIV_S = RTC_PRER_PREDIV_S_Values<RTC::PRER, 0, 15, ReadWriteMode, RTCPRERBase> ;
+    static constexpr Type SnapshotMask = 0x7F7FFFU ;
     using FieldValues = RTC_PRER_PREDIV_S_Values<RTC::PRER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -128,6 +135,7 @@ struct RTC
     using MSK1 = RTC_ALRMAR_MSK1_Values<RTC::ALRMAR, 7, 1, ReadWriteMode, RTCALRMARBase> ;
     using ST = RTC_ALRMAR_ST_Values<RTC::ALRMAR, 4, 3, ReadWriteMode, RTCALRMARBase> ;
     using SU = RTC_ALRMAR_SU_Values<RTC::ALRMAR, 0, 4, ReadWriteMode, RTCALRMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_ALRMAR_SU_Values<RTC::ALRMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +227,7 @@ struct RTC
     using CALW8 = RTC_CALR_CALW8_Values<RTC::CALR, 14, 1, ReadWriteMode, RTCCALRBase> ;
     using CALW16 = RTC_CALR_CALW16_Values<RTC::CALR, 13, 1, ReadWriteMode, RTCCALRBase> ;
     using CALM = RTC_CALR_CALM_Values<RTC::CALR, 0, 9, ReadWriteMode, RTCCALRBase> ;
+    static constexpr Type SnapshotMask = 0xE1FFU ;
     using FieldValues = RTC_CALR_CALM_Values<RTC::CALR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -245,6 +254,7 @@ struct RTC
     using TAMPIE = RTC_TAFCR_TAMPIE_Values<RTC::TAFCR, 2, 1, ReadWriteMode, RTCTAFCRBase> ;
     using TAMP1TRG = RTC_TAFCR_TAMP1TRG_Values<RTC::TAFCR, 1, 1, ReadWriteMode, RTCTAFCRBase> ;
     using TAMP1E = RTC_TAFCR_TAMP1E_Values<RTC::TAFCR, 0, 1, ReadWriteMode, RTCTAFCRBase> ;
+    static constexpr Type SnapshotMask = 0xFCFF9FU ;
     using FieldValues = RTC_TAFCR_TAMP1E_Values<RTC::TAFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -257,6 +267,7 @@ struct RTC
   {
     using MASKSS = RTC_ALRMASSR_MASKSS_Values<RTC::ALRMASSR, 24, 4, ReadWriteMode, RTCALRMASSRBase> ;
     using SS = RTC_ALRMASSR_SS_Values<RTC::ALRMASSR, 0, 15, ReadWriteMode, RTCALRMASSRBase> ;
+    static constexpr Type SnapshotMask = 0xF007FFFU ;
     using FieldValues = RTC_ALRMASSR_SS_Values<RTC::ALRMASSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -268,6 +279,7 @@ struct RTC
   struct BKP0R : public RegisterBase<0x40002850, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP0R_BKP_Values<RTC::BKP0R, 0, 32, ReadWriteMode, RTCBKP0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP0R_BKP_Values<RTC::BKP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -279,6 +291,7 @@ struct RTC
   struct BKP1R : public RegisterBase<0x40002854, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP1R_BKP_Values<RTC::BKP1R, 0, 32, ReadWriteMode, RTCBKP1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP1R_BKP_Values<RTC::BKP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -290,6 +303,7 @@ struct RTC
   struct BKP2R : public RegisterBase<0x40002858, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP2R_BKP_Values<RTC::BKP2R, 0, 32, ReadWriteMode, RTCBKP2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP2R_BKP_Values<RTC::BKP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -301,6 +315,7 @@ struct RTC
   struct BKP3R : public RegisterBase<0x4000285C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP3R_BKP_Values<RTC::BKP3R, 0, 32, ReadWriteMode, RTCBKP3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP3R_BKP_Values<RTC::BKP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -312,12 +327,14 @@ struct RTC
   struct BKP4R : public RegisterBase<0x40002860, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP4R_BKP_Values<RTC::BKP4R, 0, 32, ReadWriteMode, RTCBKP4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP4R_BKP_Values<RTC::BKP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BKP4RPack  = Register<0x40002860, 32, ReadWriteMode, RTCBKP4RBase, T...> ;
 
+  using Registers = TypesList<RTC::TR, RTC::DR, RTC::CR, RTC::ISR, RTC::PRER, RTC::ALRMAR, RTC::WPR, RTC::SSR, RTC::SHIFTR, RTC::TSTR, RTC::TSDR, RTC::TSSSR, RTC::CALR, RTC::TAFCR, RTC::ALRMASSR, RTC::BKP0R, RTC::BKP1R, RTC::BKP2R, RTC::BKP3R, RTC::BKP4R> ;
 } ;
 
 #endif //#if !defined(RTCREGISTERS_HPP)
@@ -44,6 +44,7 @@ struct SCB
     using PENDSVCLR = SCB_ICSR_PENDSVCLR_Values<SCB::ICSR, 27, 1, ReadWriteMode, SCBICSRBase> ;
     using PENDSVSET = SCB_ICSR_PENDSVSET_Values<SCB::ICSR, 28, 1, ReadWriteMode, SCBICSRBase> ;
     using NMIPENDSET = SCB_ICSR_NMIPENDSET_Values<SCB::ICSR, 31, 1, ReadWriteMode, SCBICSRBase> ;
+    static constexpr Type SnapshotMask = 0x9E43F03FU ;
     using FieldValues = SCB_ICSR_NMIPENDSET_Values<SCB::ICSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +59,7 @@ struct SCB
     using SYSRESETREQ = SCB_AIRCR_SYSRESETREQ_Values<SCB::AIRCR, 2, 1, ReadWriteMode, SCBAIRCRBase> ;
     using ENDIANESS = SCB_AIRCR_ENDIANESS_Values<SCB::AIRCR, 15, 1, ReadWriteMode, SCBAIRCRBase> ;
     using VECTKEYSTAT = SCB_AIRCR_VECTKEYSTAT_Values<SCB::AIRCR, 16, 16, ReadWriteMode, SCBAIRCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF8006U ;
     using FieldValues = SCB_AIRCR_VECTKEYSTAT_Values<SCB::AIRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct SCB
     using SLEEPONEXIT = SCB_SCR_SLEEPONEXIT_Values<SCB::SCR, 1, 1, ReadWriteMode, SCBSCRBase> ;
     using SLEEPDEEP = SCB_SCR_SLEEPDEEP_Values<SCB::SCR, 2, 1, ReadWriteMode, SCBSCRBase> ;
     using SEVEONPEND = SCB_SCR_SEVEONPEND_Values<SCB::SCR, 4, 1, ReadWriteMode, SCBSCRBase> ;
+    static constexpr Type SnapshotMask = 0x16U ;
     using FieldValues = SCB_SCR_SEVEONPEND_Values<SCB::SCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,6 +86,7 @@ struct SCB
   {
     using UNALIGN__TRP = SCB_CCR_UNALIGN__TRP_Values<SCB::CCR, 3, 1, ReadWriteMode, SCBCCRBase> ;
     using STKALIGN = SCB_CCR_STKALIGN_Values<SCB::CCR, 9, 1, ReadWriteMode, SCBCCRBase> ;
+    static constexpr Type SnapshotMask = 0x208U ;
     using FieldValues = SCB_CCR_STKALIGN_Values<SCB::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -94,6 +98,7 @@ struct SCB
   struct SHPR2 : public RegisterBase<0xE000ED1C, 32, ReadWriteMode>
   {
     using PRI_11 = SCB_SHPR2_PRI_11_Values<SCB::SHPR2, 24, 8, ReadWriteMode, SCBSHPR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF000000U ;
     using FieldValues = SCB_SHPR2_PRI_11_Values<SCB::SHPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,12 +111,14 @@ struct SCB
   {
     using PRI_14 = SCB_SHPR3_PRI_14_Values<SCB::SHPR3, 16, 8, ReadWriteMode, SCBSHPR3Base> ;
     using PRI_15 = SCB_SHPR3_PRI_15_Values<SCB::SHPR3, 24, 8, ReadWriteMode, SCBSHPR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF0000U ;
     using FieldValues = SCB_SHPR3_PRI_15_Values<SCB::SHPR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SHPR3Pack  = Register<0xE000ED20, 32, ReadWriteMode, SCBSHPR3Base, T...> ;
 
+  using Registers = TypesList<SCB::CPUID, SCB::ICSR, SCB::AIRCR, SCB::SCR, SCB::CCR, SCB::SHPR2, SCB::SHPR3> ;
 } ;
 
 #endif //#if !defined(SCBREGISTERS_HPP)
@@ -25,6 +25,7 @@ struct STK
     using TICKINT = STK_CSR_TICKINT_Values<STK::CSR, 1, 1, ReadWriteMode, STKCSRBase> ;
     using CLKSOURCE = STK_CSR_CLKSOURCE_Values<STK::CSR, 2, 1, ReadWriteMode, STKCSRBase> ;
     using COUNTFLAG = STK_CSR_COUNTFLAG_Values<STK::CSR, 16, 1, ReadWriteMode, STKCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = STK_CSR_COUNTFLAG_Values<STK::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -36,6 +37,7 @@ struct STK
   struct RVR : public RegisterBase<0xE000E014, 32, ReadWriteMode>
   {
     using RELOAD = STK_RVR_RELOAD_Values<STK::RVR, 0, 24, ReadWriteMode, STKRVRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = STK_RVR_RELOAD_Values<STK::RVR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +49,7 @@ struct STK
   struct CVR : public RegisterBase<0xE000E018, 32, ReadWriteMode>
   {
     using CURRENT = STK_CVR_CURRENT_Values<STK::CVR, 0, 24, ReadWriteMode, STKCVRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = STK_CVR_CURRENT_Values<STK::CVR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,12 +63,14 @@ struct STK
     using TENMS = STK_CALIB_TENMS_Values<STK::CALIB, 0, 24, ReadWriteMode, STKCALIBBase> ;
     using SKEW = STK_CALIB_SKEW_Values<STK::CALIB, 30, 1, ReadWriteMode, STKCALIBBase> ;
     using NOREF = STK_CALIB_NOREF_Values<STK::CALIB, 31, 1, ReadWriteMode, STKCALIBBase> ;
+    static constexpr Type SnapshotMask = 0xC0FFFFFFU ;
     using FieldValues = STK_CALIB_NOREF_Values<STK::CALIB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALIBPack  = Register<0xE000E01C, 32, ReadWriteMode, STKCALIBBase, T...> ;
 
+  using Registers = TypesList<STK::CSR, STK::RVR, STK::CVR, STK::CALIB> ;
 } ;
 
 #endif //#if !defined(STKREGISTERS_HPP)
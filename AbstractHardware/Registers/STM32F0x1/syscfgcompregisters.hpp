@@ -40,6 +40,7 @@ struct SYSCFG_COMP
     using TIM1_DMA_RMP = SYSCFG_COMP_SYSCFG_CFGR1_TIM1_DMA_RMP_Values<SYSCFG_COMP::SYSCFG_CFGR1, 28, 1, ReadWriteMode, SYSCFG_COMPSYSCFG_CFGR1Base> ;
     using TIM2_DMA_RMP = SYSCFG_COMP_SYSCFG_CFGR1_TIM2_DMA_RMP_Values<SYSCFG_COMP::SYSCFG_CFGR1, 29, 1, ReadWriteMode, SYSCFG_COMPSYSCFG_CFGR1Base> ;
     using TIM3_DMA_RMP = SYSCFG_COMP_SYSCFG_CFGR1_TIM3_DMA_RMP_Values<SYSCFG_COMP::SYSCFG_CFGR1, 30, 1, ReadWriteMode, SYSCFG_COMPSYSCFG_CFGR1Base> ;
+    static constexpr Type SnapshotMask = 0x7F3F1F03U ;
     using FieldValues = SYSCFG_COMP_SYSCFG_CFGR1_TIM3_DMA_RMP_Values<SYSCFG_COMP::SYSCFG_CFGR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +55,7 @@ struct SYSCFG_COMP
     using EXTI2 = SYSCFG_COMP_SYSCFG_EXTICR1_EXTI2_Values<SYSCFG_COMP::SYSCFG_EXTICR1, 8, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR1Base> ;
     using EXTI1 = SYSCFG_COMP_SYSCFG_EXTICR1_EXTI1_Values<SYSCFG_COMP::SYSCFG_EXTICR1, 4, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR1Base> ;
     using EXTI0 = SYSCFG_COMP_SYSCFG_EXTICR1_EXTI0_Values<SYSCFG_COMP::SYSCFG_EXTICR1, 0, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_SYSCFG_EXTICR1_EXTI0_Values<SYSCFG_COMP::SYSCFG_EXTICR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -68,6 +70,7 @@ struct SYSCFG_COMP
     using EXTI6 = SYSCFG_COMP_SYSCFG_EXTICR2_EXTI6_Values<SYSCFG_COMP::SYSCFG_EXTICR2, 8, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR2Base> ;
     using EXTI5 = SYSCFG_COMP_SYSCFG_EXTICR2_EXTI5_Values<SYSCFG_COMP::SYSCFG_EXTICR2, 4, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR2Base> ;
     using EXTI4 = SYSCFG_COMP_SYSCFG_EXTICR2_EXTI4_Values<SYSCFG_COMP::SYSCFG_EXTICR2, 0, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_SYSCFG_EXTICR2_EXTI4_Values<SYSCFG_COMP::SYSCFG_EXTICR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +85,7 @@ struct SYSCFG_COMP
     using EXTI10 = SYSCFG_COMP_SYSCFG_EXTICR3_EXTI10_Values<SYSCFG_COMP::SYSCFG_EXTICR3, 8, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR3Base> ;
     using EXTI9 = SYSCFG_COMP_SYSCFG_EXTICR3_EXTI9_Values<SYSCFG_COMP::SYSCFG_EXTICR3, 4, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR3Base> ;
     using EXTI8 = SYSCFG_COMP_SYSCFG_EXTICR3_EXTI8_Values<SYSCFG_COMP::SYSCFG_EXTICR3, 0, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_SYSCFG_EXTICR3_EXTI8_Values<SYSCFG_COMP::SYSCFG_EXTICR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +100,7 @@ struct SYSCFG_COMP
     using EXTI14 = SYSCFG_COMP_SYSCFG_EXTICR4_EXTI14_Values<SYSCFG_COMP::SYSCFG_EXTICR4, 8, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR4Base> ;
     using EXTI13 = SYSCFG_COMP_SYSCFG_EXTICR4_EXTI13_Values<SYSCFG_COMP::SYSCFG_EXTICR4, 4, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR4Base> ;
     using EXTI12 = SYSCFG_COMP_SYSCFG_EXTICR4_EXTI12_Values<SYSCFG_COMP::SYSCFG_EXTICR4, 0, 4, ReadWriteMode, SYSCFG_COMPSYSCFG_EXTICR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_SYSCFG_EXTICR4_EXTI12_Values<SYSCFG_COMP::SYSCFG_EXTICR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +115,7 @@ struct SYSCFG_COMP
     using PVD_LOCK = SYSCFG_COMP_SYSCFG_CFGR2_PVD_LOCK_Values<SYSCFG_COMP::SYSCFG_CFGR2, 2, 1, ReadWriteMode, SYSCFG_COMPSYSCFG_CFGR2Base> ;
     using SRAM_PARITY_LOCK = SYSCFG_COMP_SYSCFG_CFGR2_SRAM_PARITY_LOCK_Values<SYSCFG_COMP::SYSCFG_CFGR2, 1, 1, ReadWriteMode, SYSCFG_COMPSYSCFG_CFGR2Base> ;
     using LOCUP_LOCK = SYSCFG_COMP_SYSCFG_CFGR2_LOCUP_LOCK_Values<SYSCFG_COMP::SYSCFG_CFGR2, 0, 1, ReadWriteMode, SYSCFG_COMPSYSCFG_CFGR2Base> ;
+    static constexpr Type SnapshotMask = 0x107U ;
     using FieldValues = SYSCFG_COMP_SYSCFG_CFGR2_LOCUP_LOCK_Values<SYSCFG_COMP::SYSCFG_CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -138,12 +144,14 @@ struct SYSCFG_COMP
     using COMP2HYST = SYSCFG_COMP_COMP_CSR_COMP2HYST_Values<SYSCFG_COMP::COMP_CSR, 28, 2, ReadWriteMode, SYSCFG_COMPCOMP_CSRBase> ;
     using COMP2OUT = SYSCFG_COMP_COMP_CSR_COMP2OUT_Values<SYSCFG_COMP::COMP_CSR, 30, 1, ReadMode, SYSCFG_COMPCOMP_CSRBase> ;
     using COMP2LOCK = SYSCFG_COMP_COMP_CSR_COMP2LOCK_Values<SYSCFG_COMP::COMP_CSR, 31, 1, ReadWriteMode, SYSCFG_COMPCOMP_CSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFDBF7FU ;
     using FieldValues = SYSCFG_COMP_COMP_CSR_COMP2LOCK_Values<SYSCFG_COMP::COMP_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using COMP_CSRPack  = Register<0x4001001C, 32, ReadWriteMode, SYSCFG_COMPCOMP_CSRBase, T...> ;
 
+  using Registers = TypesList<SYSCFG_COMP::SYSCFG_CFGR1, SYSCFG_COMP::SYSCFG_EXTICR1, SYSCFG_COMP::SYSCFG_EXTICR2, SYSCFG_COMP::SYSCFG_EXTICR3, SYSCFG_COMP::SYSCFG_EXTICR4, SYSCFG_COMP::SYSCFG_CFGR2, SYSCFG_COMP::COMP_CSR> ;
 } ;
 
 #endif //#if !defined(SYSCFGCOMPREGISTERS_HPP)
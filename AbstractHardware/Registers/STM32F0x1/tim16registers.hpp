@@ -27,6 +27,8 @@ struct TIM16
     using URS = TIM16_CR1_URS_Values<TIM16::CR1, 2, 1, ReadWriteMode, TIM16CR1Base> ;
     using UDIS = TIM16_CR1_UDIS_Values<TIM16::CR1, 1, 1, ReadWriteMode, TIM16CR1Base> ;
     using CEN = TIM16_CR1_CEN_Values<TIM16::CR1, 0, 1, ReadWriteMode, TIM16CR1Base> ;
+    static constexpr Type SnapshotMask = 0x38EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM16_CR1_CEN_Values<TIM16::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIM16
     using CCDS = TIM16_CR2_CCDS_Values<TIM16::CR2, 3, 1, ReadWriteMode, TIM16CR2Base> ;
     using CCUS = TIM16_CR2_CCUS_Values<TIM16::CR2, 2, 1, ReadWriteMode, TIM16CR2Base> ;
     using CCPC = TIM16_CR2_CCPC_Values<TIM16::CR2, 0, 1, ReadWriteMode, TIM16CR2Base> ;
+    static constexpr Type SnapshotMask = 0x30DU ;
     using FieldValues = TIM16_CR2_CCPC_Values<TIM16::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +63,7 @@ struct TIM16
     using COMIE = TIM16_DIER_COMIE_Values<TIM16::DIER, 5, 1, ReadWriteMode, TIM16DIERBase> ;
     using CC1IE = TIM16_DIER_CC1IE_Values<TIM16::DIER, 1, 1, ReadWriteMode, TIM16DIERBase> ;
     using UIE = TIM16_DIER_UIE_Values<TIM16::DIER, 0, 1, ReadWriteMode, TIM16DIERBase> ;
+    static constexpr Type SnapshotMask = 0x43E3U ;
     using FieldValues = TIM16_DIER_UIE_Values<TIM16::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +80,9 @@ struct TIM16
     using COMIF = TIM16_SR_COMIF_Values<TIM16::SR, 5, 1, ReadWriteMode, TIM16SRBase> ;
     using CC1IF = TIM16_SR_CC1IF_Values<TIM16::SR, 1, 1, ReadWriteMode, TIM16SRBase> ;
     using UIF = TIM16_SR_UIF_Values<TIM16::SR, 0, 1, ReadWriteMode, TIM16SRBase> ;
+    static constexpr Type WritableMask = 0x2E3U ;
+    static constexpr Type ZeroToClearMask = 0x2E3U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM16_SR_UIF_Values<TIM16::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -105,6 +112,7 @@ struct TIM16
     using OC1PE = TIM16_CCMR1_Output_OC1PE_Values<TIM16::CCMR1_Output, 3, 1, ReadWriteMode, TIM16CCMR1_OutputBase> ;
     using OC1FE = TIM16_CCMR1_Output_OC1FE_Values<TIM16::CCMR1_Output, 2, 1, ReadWriteMode, TIM16CCMR1_OutputBase> ;
     using CC1S = TIM16_CCMR1_Output_CC1S_Values<TIM16::CCMR1_Output, 0, 2, ReadWriteMode, TIM16CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = TIM16_CCMR1_Output_CC1S_Values<TIM16::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +126,7 @@ struct TIM16
     using IC1F = TIM16_CCMR1_Input_IC1F_Values<TIM16::CCMR1_Input, 4, 4, ReadWriteMode, TIM16CCMR1_InputBase> ;
     using IC1PSC = TIM16_CCMR1_Input_IC1PSC_Values<TIM16::CCMR1_Input, 2, 2, ReadWriteMode, TIM16CCMR1_InputBase> ;
     using CC1S = TIM16_CCMR1_Input_CC1S_Values<TIM16::CCMR1_Input, 0, 2, ReadWriteMode, TIM16CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM16_CCMR1_Input_CC1S_Values<TIM16::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +141,7 @@ struct TIM16
     using CC1NE = TIM16_CCER_CC1NE_Values<TIM16::CCER, 2, 1, ReadWriteMode, TIM16CCERBase> ;
     using CC1P = TIM16_CCER_CC1P_Values<TIM16::CCER, 1, 1, ReadWriteMode, TIM16CCERBase> ;
     using CC1E = TIM16_CCER_CC1E_Values<TIM16::CCER, 0, 1, ReadWriteMode, TIM16CCERBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM16_CCER_CC1E_Values<TIM16::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +153,7 @@ struct TIM16
   struct CNT : public RegisterBase<0x40014424, 32, ReadWriteMode>
   {
     using CNTField = TIM16_CNT_CNT_Values<TIM16::CNT, 0, 16, ReadWriteMode, TIM16CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM16_CNT_CNT_Values<TIM16::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +165,7 @@ struct TIM16
   struct PSC : public RegisterBase<0x40014428, 32, ReadWriteMode>
   {
     using PSCField = TIM16_PSC_PSC_Values<TIM16::PSC, 0, 16, ReadWriteMode, TIM16PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_PSC_PSC_Values<TIM16::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +177,7 @@ struct TIM16
   struct ARR : public RegisterBase<0x4001442C, 32, ReadWriteMode>
   {
     using ARRField = TIM16_ARR_ARR_Values<TIM16::ARR, 0, 16, ReadWriteMode, TIM16ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_ARR_ARR_Values<TIM16::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +189,7 @@ struct TIM16
   struct RCR : public RegisterBase<0x40014430, 32, ReadWriteMode>
   {
     using REP = TIM16_RCR_REP_Values<TIM16::RCR, 0, 8, ReadWriteMode, TIM16RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM16_RCR_REP_Values<TIM16::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -187,6 +201,7 @@ struct TIM16
   struct CCR1 : public RegisterBase<0x40014434, 32, ReadWriteMode>
   {
     using CCR1Field = TIM16_CCR1_CCR1_Values<TIM16::CCR1, 0, 16, ReadWriteMode, TIM16CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_CCR1_CCR1_Values<TIM16::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +220,7 @@ struct TIM16
     using OSSI = TIM16_BDTR_OSSI_Values<TIM16::BDTR, 10, 1, ReadWriteMode, TIM16BDTRBase> ;
     using LOCK = TIM16_BDTR_LOCK_Values<TIM16::BDTR, 8, 2, ReadWriteMode, TIM16BDTRBase> ;
     using DTG = TIM16_BDTR_DTG_Values<TIM16::BDTR, 0, 8, ReadWriteMode, TIM16BDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_BDTR_DTG_Values<TIM16::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -217,6 +233,7 @@ struct TIM16
   {
     using DBL = TIM16_DCR_DBL_Values<TIM16::DCR, 8, 5, ReadWriteMode, TIM16DCRBase> ;
     using DBA = TIM16_DCR_DBA_Values<TIM16::DCR, 0, 5, ReadWriteMode, TIM16DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM16_DCR_DBA_Values<TIM16::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -228,12 +245,14 @@ struct TIM16
   struct DMAR : public RegisterBase<0x4001444C, 32, ReadWriteMode>
   {
     using DMAB = TIM16_DMAR_DMAB_Values<TIM16::DMAR, 0, 16, ReadWriteMode, TIM16DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_DMAR_DMAB_Values<TIM16::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4001444C, 32, ReadWriteMode, TIM16DMARBase, T...> ;
 
+  using Registers = TypesList<TIM16::CR1, TIM16::CR2, TIM16::DIER, TIM16::SR, TIM16::EGR, TIM16::CCMR1_Output, TIM16::CCMR1_Input, TIM16::CCER, TIM16::CNT, TIM16::PSC, TIM16::ARR, TIM16::RCR, TIM16::CCR1, TIM16::BDTR, TIM16::DCR, TIM16::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM16REGISTERS_HPP)
@@ -29,6 +29,8 @@ struct TIM2
     using URS = TIM2_CR1_URS_Values<TIM2::CR1, 2, 1, ReadWriteMode, TIM2CR1Base> ;
     using UDIS = TIM2_CR1_UDIS_Values<TIM2::CR1, 1, 1, ReadWriteMode, TIM2CR1Base> ;
     using CEN = TIM2_CR1_CEN_Values<TIM2::CR1, 0, 1, ReadWriteMode, TIM2CR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM2_CR1_CEN_Values<TIM2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIM2
     using TI1S = TIM2_CR2_TI1S_Values<TIM2::CR2, 7, 1, ReadWriteMode, TIM2CR2Base> ;
     using MMS = TIM2_CR2_MMS_Values<TIM2::CR2, 4, 3, ReadWriteMode, TIM2CR2Base> ;
     using CCDS = TIM2_CR2_CCDS_Values<TIM2::CR2, 3, 1, ReadWriteMode, TIM2CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIM2_CR2_CCDS_Values<TIM2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct TIM2
     using MSM = TIM2_SMCR_MSM_Values<TIM2::SMCR, 7, 1, ReadWriteMode, TIM2SMCRBase> ;
     using TS = TIM2_SMCR_TS_Values<TIM2::SMCR, 4, 3, ReadWriteMode, TIM2SMCRBase> ;
     using SMS = TIM2_SMCR_SMS_Values<TIM2::SMCR, 0, 3, ReadWriteMode, TIM2SMCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIM2_SMCR_SMS_Values<TIM2::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +86,7 @@ struct TIM2
     using CC2IE = TIM2_DIER_CC2IE_Values<TIM2::DIER, 2, 1, ReadWriteMode, TIM2DIERBase> ;
     using CC1IE = TIM2_DIER_CC1IE_Values<TIM2::DIER, 1, 1, ReadWriteMode, TIM2DIERBase> ;
     using UIE = TIM2_DIER_UIE_Values<TIM2::DIER, 0, 1, ReadWriteMode, TIM2DIERBase> ;
+    static constexpr Type SnapshotMask = 0x7F5FU ;
     using FieldValues = TIM2_DIER_UIE_Values<TIM2::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,9 @@ struct TIM2
     using CC2IF = TIM2_SR_CC2IF_Values<TIM2::SR, 2, 1, ReadWriteMode, TIM2SRBase> ;
     using CC1IF = TIM2_SR_CC1IF_Values<TIM2::SR, 1, 1, ReadWriteMode, TIM2SRBase> ;
     using UIF = TIM2_SR_UIF_Values<TIM2::SR, 0, 1, ReadWriteMode, TIM2SRBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM2_SR_UIF_Values<TIM2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -138,6 +146,7 @@ struct TIM2
     using OC1PE = TIM2_CCMR1_Output_OC1PE_Values<TIM2::CCMR1_Output, 3, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
     using OC1FE = TIM2_CCMR1_Output_OC1FE_Values<TIM2::CCMR1_Output, 2, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
     using CC1S = TIM2_CCMR1_Output_CC1S_Values<TIM2::CCMR1_Output, 0, 2, ReadWriteMode, TIM2CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_CCMR1_Output_CC1S_Values<TIM2::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +163,7 @@ struct TIM2
     using IC1F = TIM2_CCMR1_Input_IC1F_Values<TIM2::CCMR1_Input, 4, 4, ReadWriteMode, TIM2CCMR1_InputBase> ;
     using IC1PSC = TIM2_CCMR1_Input_IC1PSC_Values<TIM2::CCMR1_Input, 2, 2, ReadWriteMode, TIM2CCMR1_InputBase> ;
     using CC1S = TIM2_CCMR1_Input_CC1S_Values<TIM2::CCMR1_Input, 0, 2, ReadWriteMode, TIM2CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_CCMR1_Input_CC1S_Values<TIM2::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -174,6 +184,7 @@ struct TIM2
     using OC3PE = TIM2_CCMR2_Output_OC3PE_Values<TIM2::CCMR2_Output, 3, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
     using OC3FE = TIM2_CCMR2_Output_OC3FE_Values<TIM2::CCMR2_Output, 2, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
     using CC3S = TIM2_CCMR2_Output_CC3S_Values<TIM2::CCMR2_Output, 0, 2, ReadWriteMode, TIM2CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_CCMR2_Output_CC3S_Values<TIM2::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -190,6 +201,7 @@ struct TIM2
     using IC3F = TIM2_CCMR2_Input_IC3F_Values<TIM2::CCMR2_Input, 4, 4, ReadWriteMode, TIM2CCMR2_InputBase> ;
     using IC3PSC = TIM2_CCMR2_Input_IC3PSC_Values<TIM2::CCMR2_Input, 2, 2, ReadWriteMode, TIM2CCMR2_InputBase> ;
     using CC3S = TIM2_CCMR2_Input_CC3S_Values<TIM2::CCMR2_Input, 0, 2, ReadWriteMode, TIM2CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_CCMR2_Input_CC3S_Values<TIM2::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -212,6 +224,7 @@ struct TIM2
     using CC1NP = TIM2_CCER_CC1NP_Values<TIM2::CCER, 3, 1, ReadWriteMode, TIM2CCERBase> ;
     using CC1P = TIM2_CCER_CC1P_Values<TIM2::CCER, 1, 1, ReadWriteMode, TIM2CCERBase> ;
     using CC1E = TIM2_CCER_CC1E_Values<TIM2::CCER, 0, 1, ReadWriteMode, TIM2CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBBBU ;
     using FieldValues = TIM2_CCER_CC1E_Values<TIM2::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +237,7 @@ struct TIM2
   {
     using CNT_H = TIM2_CNT_CNT_H_Values<TIM2::CNT, 16, 16, ReadWriteMode, TIM2CNTBase> ;
     using CNT_L = TIM2_CNT_CNT_L_Values<TIM2::CNT, 0, 16, ReadWriteMode, TIM2CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM2_CNT_CNT_L_Values<TIM2::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -235,6 +249,7 @@ struct TIM2
   struct PSC : public RegisterBase<0x40000028, 32, ReadWriteMode>
   {
     using PSCField = TIM2_PSC_PSC_Values<TIM2::PSC, 0, 16, ReadWriteMode, TIM2PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_PSC_PSC_Values<TIM2::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -247,6 +262,7 @@ struct TIM2
   {
     using ARR_H = TIM2_ARR_ARR_H_Values<TIM2::ARR, 16, 16, ReadWriteMode, TIM2ARRBase> ;
     using ARR_L = TIM2_ARR_ARR_L_Values<TIM2::ARR, 0, 16, ReadWriteMode, TIM2ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_ARR_ARR_L_Values<TIM2::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,6 +275,7 @@ struct TIM2
   {
     using CCR1_H = TIM2_CCR1_CCR1_H_Values<TIM2::CCR1, 16, 16, ReadWriteMode, TIM2CCR1Base> ;
     using CCR1_L = TIM2_CCR1_CCR1_L_Values<TIM2::CCR1, 0, 16, ReadWriteMode, TIM2CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR1_CCR1_L_Values<TIM2::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -271,6 +288,7 @@ struct TIM2
   {
     using CCR2_H = TIM2_CCR2_CCR2_H_Values<TIM2::CCR2, 16, 16, ReadWriteMode, TIM2CCR2Base> ;
     using CCR2_L = TIM2_CCR2_CCR2_L_Values<TIM2::CCR2, 0, 16, ReadWriteMode, TIM2CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR2_CCR2_L_Values<TIM2::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -283,6 +301,7 @@ struct TIM2
   {
     using CCR3_H = TIM2_CCR3_CCR3_H_Values<TIM2::CCR3, 16, 16, ReadWriteMode, TIM2CCR3Base> ;
     using CCR3_L = TIM2_CCR3_CCR3_L_Values<TIM2::CCR3, 0, 16, ReadWriteMode, TIM2CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR3_CCR3_L_Values<TIM2::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -295,6 +314,7 @@ struct TIM2
   {
     using CCR4_H = TIM2_CCR4_CCR4_H_Values<TIM2::CCR4, 16, 16, ReadWriteMode, TIM2CCR4Base> ;
     using CCR4_L = TIM2_CCR4_CCR4_L_Values<TIM2::CCR4, 0, 16, ReadWriteMode, TIM2CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR4_CCR4_L_Values<TIM2::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,6 +327,7 @@ struct TIM2
   {
     using DBL = TIM2_DCR_DBL_Values<TIM2::DCR, 8, 5, ReadWriteMode, TIM2DCRBase> ;
     using DBA = TIM2_DCR_DBA_Values<TIM2::DCR, 0, 5, ReadWriteMode, TIM2DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM2_DCR_DBA_Values<TIM2::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -318,12 +339,14 @@ struct TIM2
   struct DMAR : public RegisterBase<0x4000004C, 32, ReadWriteMode>
   {
     using DMARField = TIM2_DMAR_DMAR_Values<TIM2::DMAR, 0, 16, ReadWriteMode, TIM2DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_DMAR_DMAR_Values<TIM2::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4000004C, 32, ReadWriteMode, TIM2DMARBase, T...> ;
 
+  using Registers = TypesList<TIM2::CR1, TIM2::CR2, TIM2::SMCR, TIM2::DIER, TIM2::SR, TIM2::EGR, TIM2::CCMR1_Output, TIM2::CCMR1_Input, TIM2::CCMR2_Output, TIM2::CCMR2_Input, TIM2::CCER, TIM2::CNT, TIM2::PSC, TIM2::ARR, TIM2::CCR1, TIM2::CCR2, TIM2::CCR3, TIM2::CCR4, TIM2::DCR, TIM2::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM2REGISTERS_HPP)
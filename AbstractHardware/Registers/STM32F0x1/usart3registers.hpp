@@ -42,6 +42,8 @@ struct USART3
     using RTOIE = USART3_CR1_RTOIE_Values<USART3::CR1, 26, 1, ReadWriteMode, USART3CR1Base> ;
     using EOBIE = USART3_CR1_EOBIE_Values<USART3::CR1, 27, 1, ReadWriteMode, USART3CR1Base> ;
     using M1 = USART3_CR1_M1_Values<USART3::CR1, 28, 1, ReadWriteMode, USART3CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART3_CR1_M1_Values<USART3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USART3
     using LBDIE = USART3_CR2_LBDIE_Values<USART3::CR2, 6, 1, ReadWriteMode, USART3CR2Base> ;
     using LBDL = USART3_CR2_LBDL_Values<USART3::CR2, 5, 1, ReadWriteMode, USART3CR2Base> ;
     using ADDM7 = USART3_CR2_ADDM7_Values<USART3::CR2, 4, 1, ReadWriteMode, USART3CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART3_CR2_ADDM7_Values<USART3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +103,7 @@ struct USART3
     using IRLP = USART3_CR3_IRLP_Values<USART3::CR3, 2, 1, ReadWriteMode, USART3CR3Base> ;
     using IREN = USART3_CR3_IREN_Values<USART3::CR3, 1, 1, ReadWriteMode, USART3CR3Base> ;
     using EIE = USART3_CR3_EIE_Values<USART3::CR3, 0, 1, ReadWriteMode, USART3CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART3_CR3_EIE_Values<USART3::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +116,7 @@ struct USART3
   {
     using DIV_Mantissa = USART3_BRR_DIV_Mantissa_Values<USART3::BRR, 4, 12, ReadWriteMode, USART3BRRBase> ;
     using DIV_Fraction = USART3_BRR_DIV_Fraction_Values<USART3::BRR, 0, 4, ReadWriteMode, USART3BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART3_BRR_DIV_Fraction_Values<USART3::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct USART3
   {
     using GT = USART3_GTPR_GT_Values<USART3::GTPR, 8, 8, ReadWriteMode, USART3GTPRBase> ;
     using PSC = USART3_GTPR_PSC_Values<USART3::GTPR, 0, 8, ReadWriteMode, USART3GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART3_GTPR_PSC_Values<USART3::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct USART3
   {
     using BLEN = USART3_RTOR_BLEN_Values<USART3::RTOR, 24, 8, ReadWriteMode, USART3RTORBase> ;
     using RTO = USART3_RTOR_RTO_Values<USART3::RTOR, 0, 24, ReadWriteMode, USART3RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART3_RTOR_RTO_Values<USART3::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +158,7 @@ struct USART3
     using MMRQ = USART3_RQR_MMRQ_Values<USART3::RQR, 2, 1, ReadWriteMode, USART3RQRBase> ;
     using SBKRQ = USART3_RQR_SBKRQ_Values<USART3::RQR, 1, 1, ReadWriteMode, USART3RQRBase> ;
     using ABRRQ = USART3_RQR_ABRRQ_Values<USART3::RQR, 0, 1, ReadWriteMode, USART3RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = USART3_RQR_ABRRQ_Values<USART3::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +213,9 @@ struct USART3
     using NCF = USART3_ICR_NCF_Values<USART3::ICR, 2, 1, ReadWriteMode, USART3ICRBase> ;
     using FECF = USART3_ICR_FECF_Values<USART3::ICR, 1, 1, ReadWriteMode, USART3ICRBase> ;
     using PECF = USART3_ICR_PECF_Values<USART3::ICR, 0, 1, ReadWriteMode, USART3ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART3_ICR_PECF_Values<USART3::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -227,12 +238,14 @@ struct USART3
   struct TDR : public RegisterBase<0x40004828, 32, ReadWriteMode>
   {
     using TDRField = USART3_TDR_TDR_Values<USART3::TDR, 0, 9, ReadWriteMode, USART3TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART3_TDR_TDR_Values<USART3::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40004828, 32, ReadWriteMode, USART3TDRBase, T...> ;
 
+  using Registers = TypesList<USART3::CR1, USART3::CR2, USART3::CR3, USART3::BRR, USART3::GTPR, USART3::RTOR, USART3::RQR, USART3::ISR, USART3::ICR, USART3::RDR, USART3::TDR> ;
 } ;
 
 #endif //#if !defined(USART3REGISTERS_HPP)
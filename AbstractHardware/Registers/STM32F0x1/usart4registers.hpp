@@ -42,6 +42,8 @@ struct USART4
     using RTOIE = USART4_CR1_RTOIE_Values<USART4::CR1, 26, 1, ReadWriteMode, USART4CR1Base> ;
     using EOBIE = USART4_CR1_EOBIE_Values<USART4::CR1, 27, 1, ReadWriteMode, USART4CR1Base> ;
     using M1 = USART4_CR1_M1_Values<USART4::CR1, 28, 1, ReadWriteMode, USART4CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART4_CR1_M1_Values<USART4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USART4
     using LBDIE = USART4_CR2_LBDIE_Values<USART4::CR2, 6, 1, ReadWriteMode, USART4CR2Base> ;
     using LBDL = USART4_CR2_LBDL_Values<USART4::CR2, 5, 1, ReadWriteMode, USART4CR2Base> ;
     using ADDM7 = USART4_CR2_ADDM7_Values<USART4::CR2, 4, 1, ReadWriteMode, USART4CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART4_CR2_ADDM7_Values<USART4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +103,7 @@ struct USART4
     using IRLP = USART4_CR3_IRLP_Values<USART4::CR3, 2, 1, ReadWriteMode, USART4CR3Base> ;
     using IREN = USART4_CR3_IREN_Values<USART4::CR3, 1, 1, ReadWriteMode, USART4CR3Base> ;
     using EIE = USART4_CR3_EIE_Values<USART4::CR3, 0, 1, ReadWriteMode, USART4CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART4_CR3_EIE_Values<USART4::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +116,7 @@ struct USART4
   {
     using DIV_Mantissa = USART4_BRR_DIV_Mantissa_Values<USART4::BRR, 4, 12, ReadWriteMode, USART4BRRBase> ;
     using DIV_Fraction = USART4_BRR_DIV_Fraction_Values<USART4::BRR, 0, 4, ReadWriteMode, USART4BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART4_BRR_DIV_Fraction_Values<USART4::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct USART4
   {
     using GT = USART4_GTPR_GT_Values<USART4::GTPR, 8, 8, ReadWriteMode, USART4GTPRBase> ;
     using PSC = USART4_GTPR_PSC_Values<USART4::GTPR, 0, 8, ReadWriteMode, USART4GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART4_GTPR_PSC_Values<USART4::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct USART4
   {
     using BLEN = USART4_RTOR_BLEN_Values<USART4::RTOR, 24, 8, ReadWriteMode, USART4RTORBase> ;
     using RTO = USART4_RTOR_RTO_Values<USART4::RTOR, 0, 24, ReadWriteMode, USART4RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART4_RTOR_RTO_Values<USART4::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +158,7 @@ struct USART4
     using MMRQ = USART4_RQR_MMRQ_Values<USART4::RQR, 2, 1, ReadWriteMode, USART4RQRBase> ;
     using SBKRQ = USART4_RQR_SBKRQ_Values<USART4::RQR, 1, 1, ReadWriteMode, USART4RQRBase> ;
     using ABRRQ = USART4_RQR_ABRRQ_Values<USART4::RQR, 0, 1, ReadWriteMode, USART4RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = USART4_RQR_ABRRQ_Values<USART4::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +213,9 @@ struct USART4
     using NCF = USART4_ICR_NCF_Values<USART4::ICR, 2, 1, ReadWriteMode, USART4ICRBase> ;
     using FECF = USART4_ICR_FECF_Values<USART4::ICR, 1, 1, ReadWriteMode, USART4ICRBase> ;
     using PECF = USART4_ICR_PECF_Values<USART4::ICR, 0, 1, ReadWriteMode, USART4ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART4_ICR_PECF_Values<USART4::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -227,12 +238,14 @@ struct USART4
   struct TDR : public RegisterBase<0x40004C28, 32, ReadWriteMode>
   {
     using TDRField = USART4_TDR_TDR_Values<USART4::TDR, 0, 9, ReadWriteMode, USART4TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART4_TDR_TDR_Values<USART4::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40004C28, 32, ReadWriteMode, USART4TDRBase, T...> ;
 
+  using Registers = TypesList<USART4::CR1, USART4::CR2, USART4::CR3, USART4::BRR, USART4::GTPR, USART4::RTOR, USART4::RQR, USART4::ISR, USART4::ICR, USART4::RDR, USART4::TDR> ;
 } ;
 
 #endif //#if !defined(USART4REGISTERS_HPP)
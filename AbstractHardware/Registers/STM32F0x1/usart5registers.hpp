@@ -42,6 +42,8 @@ struct USART5
     using RTOIE = USART5_CR1_RTOIE_Values<USART5::CR1, 26, 1, ReadWriteMode, USART5CR1Base> ;
     using EOBIE = USART5_CR1_EOBIE_Values<USART5::CR1, 27, 1, ReadWriteMode, USART5CR1Base> ;
     using M1 = USART5_CR1_M1_Values<USART5::CR1, 28, 1, ReadWriteMode, USART5CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART5_CR1_M1_Values<USART5::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USART5
     using LBDIE = USART5_CR2_LBDIE_Values<USART5::CR2, 6, 1, ReadWriteMode, USART5CR2Base> ;
     using LBDL = USART5_CR2_LBDL_Values<USART5::CR2, 5, 1, ReadWriteMode, USART5CR2Base> ;
     using ADDM7 = USART5_CR2_ADDM7_Values<USART5::CR2, 4, 1, ReadWriteMode, USART5CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART5_CR2_ADDM7_Values<USART5::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +103,7 @@ struct USART5
     using IRLP = USART5_CR3_IRLP_Values<USART5::CR3, 2, 1, ReadWriteMode, USART5CR3Base> ;
     using IREN = USART5_CR3_IREN_Values<USART5::CR3, 1, 1, ReadWriteMode, USART5CR3Base> ;
     using EIE = USART5_CR3_EIE_Values<USART5::CR3, 0, 1, ReadWriteMode, USART5CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART5_CR3_EIE_Values<USART5::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +116,7 @@ struct USART5
   {
     using DIV_Mantissa = USART5_BRR_DIV_Mantissa_Values<USART5::BRR, 4, 12, ReadWriteMode, USART5BRRBase> ;
     using DIV_Fraction = USART5_BRR_DIV_Fraction_Values<USART5::BRR, 0, 4, ReadWriteMode, USART5BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART5_BRR_DIV_Fraction_Values<USART5::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct USART5
   {
     using GT = USART5_GTPR_GT_Values<USART5::GTPR, 8, 8, ReadWriteMode, USART5GTPRBase> ;
     using PSC = USART5_GTPR_PSC_Values<USART5::GTPR, 0, 8, ReadWriteMode, USART5GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART5_GTPR_PSC_Values<USART5::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct USART5
   {
     using BLEN = USART5_RTOR_BLEN_Values<USART5::RTOR, 24, 8, ReadWriteMode, USART5RTORBase> ;
     using RTO = USART5_RTOR_RTO_Values<USART5::RTOR, 0, 24, ReadWriteMode, USART5RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART5_RTOR_RTO_Values<USART5::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +158,7 @@ struct USART5
     using MMRQ = USART5_RQR_MMRQ_Values<USART5::RQR, 2, 1, ReadWriteMode, USART5RQRBase> ;
     using SBKRQ = USART5_RQR_SBKRQ_Values<USART5::RQR, 1, 1, ReadWriteMode, USART5RQRBase> ;
     using ABRRQ = USART5_RQR_ABRRQ_Values<USART5::RQR, 0, 1, ReadWriteMode, USART5RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = USART5_RQR_ABRRQ_Values<USART5::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +213,9 @@ struct USART5
     using NCF = USART5_ICR_NCF_Values<USART5::ICR, 2, 1, ReadWriteMode, USART5ICRBase> ;
     using FECF = USART5_ICR_FECF_Values<USART5::ICR, 1, 1, ReadWriteMode, USART5ICRBase> ;
     using PECF = USART5_ICR_PECF_Values<USART5::ICR, 0, 1, ReadWriteMode, USART5ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART5_ICR_PECF_Values<USART5::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -227,12 +238,14 @@ struct USART5
   struct TDR : public RegisterBase<0x40005028, 32, ReadWriteMode>
   {
     using TDRField = USART5_TDR_TDR_Values<USART5::TDR, 0, 9, ReadWriteMode, USART5TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART5_TDR_TDR_Values<USART5::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40005028, 32, ReadWriteMode, USART5TDRBase, T...> ;
 
+  using Registers = TypesList<USART5::CR1, USART5::CR2, USART5::CR3, USART5::BRR, USART5::GTPR, USART5::RTOR, USART5::RQR, USART5::ISR, USART5::ICR, USART5::RDR, USART5::TDR> ;
 } ;
 
 #endif //#if !defined(USART5REGISTERS_HPP)
@@ -42,6 +42,8 @@ struct USART6
     using RTOIE = USART6_CR1_RTOIE_Values<USART6::CR1, 26, 1, ReadWriteMode, USART6CR1Base> ;
     using EOBIE = USART6_CR1_EOBIE_Values<USART6::CR1, 27, 1, ReadWriteMode, USART6CR1Base> ;
     using M1 = USART6_CR1_M1_Values<USART6::CR1, 28, 1, ReadWriteMode, USART6CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART6_CR1_M1_Values<USART6::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USART6
     using LBDIE = USART6_CR2_LBDIE_Values<USART6::CR2, 6, 1, ReadWriteMode, USART6CR2Base> ;
     using LBDL = USART6_CR2_LBDL_Values<USART6::CR2, 5, 1, ReadWriteMode, USART6CR2Base> ;
     using ADDM7 = USART6_CR2_ADDM7_Values<USART6::CR2, 4, 1, ReadWriteMode, USART6CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART6_CR2_ADDM7_Values<USART6::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +103,7 @@ struct USART6
     using IRLP = USART6_CR3_IRLP_Values<USART6::CR3, 2, 1, ReadWriteMode, USART6CR3Base> ;
     using IREN = USART6_CR3_IREN_Values<USART6::CR3, 1, 1, ReadWriteMode, USART6CR3Base> ;
     using EIE = USART6_CR3_EIE_Values<USART6::CR3, 0, 1, ReadWriteMode, USART6CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART6_CR3_EIE_Values<USART6::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +116,7 @@ struct USART6
   {
     using DIV_Mantissa = USART6_BRR_DIV_Mantissa_Values<USART6::BRR, 4, 12, ReadWriteMode, USART6BRRBase> ;
     using DIV_Fraction = USART6_BRR_DIV_Fraction_Values<USART6::BRR, 0, 4, ReadWriteMode, USART6BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART6_BRR_DIV_Fraction_Values<USART6::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct USART6
   {
     using GT = USART6_GTPR_GT_Values<USART6::GTPR, 8, 8, ReadWriteMode, USART6GTPRBase> ;
     using PSC = USART6_GTPR_PSC_Values<USART6::GTPR, 0, 8, ReadWriteMode, USART6GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART6_GTPR_PSC_Values<USART6::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct USART6
   {
     using BLEN = USART6_RTOR_BLEN_Values<USART6::RTOR, 24, 8, ReadWriteMode, USART6RTORBase> ;
     using RTO = USART6_RTOR_RTO_Values<USART6::RTOR, 0, 24, ReadWriteMode, USART6RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART6_RTOR_RTO_Values<USART6::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +158,7 @@ struct USART6
     using MMRQ = USART6_RQR_MMRQ_Values<USART6::RQR, 2, 1, ReadWriteMode, USART6RQRBase> ;
     using SBKRQ = USART6_RQR_SBKRQ_Values<USART6::RQR, 1, 1, ReadWriteMode, USART6RQRBase> ;
     using ABRRQ = USART6_RQR_ABRRQ_Values<USART6::RQR, 0, 1, ReadWriteMode, USART6RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = USART6_RQR_ABRRQ_Values<USART6::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +213,9 @@ struct USART6
     using NCF = USART6_ICR_NCF_Values<USART6::ICR, 2, 1, ReadWriteMode, USART6ICRBase> ;
     using FECF = USART6_ICR_FECF_Values<USART6::ICR, 1, 1, ReadWriteMode, USART6ICRBase> ;
     using PECF = USART6_ICR_PECF_Values<USART6::ICR, 0, 1, ReadWriteMode, USART6ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART6_ICR_PECF_Values<USART6::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -227,12 +238,14 @@ struct USART6
   struct TDR : public RegisterBase<0x40011428, 32, ReadWriteMode>
   {
     using TDRField = USART6_TDR_TDR_Values<USART6::TDR, 0, 9, ReadWriteMode, USART6TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART6_TDR_TDR_Values<USART6::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40011428, 32, ReadWriteMode, USART6TDRBase, T...> ;
 
+  using Registers = TypesList<USART6::CR1, USART6::CR2, USART6::CR3, USART6::BRR, USART6::GTPR, USART6::RTOR, USART6::RQR, USART6::ISR, USART6::ICR, USART6::RDR, USART6::TDR> ;
 } ;
 
 #endif //#if !defined(USART6REGISTERS_HPP)
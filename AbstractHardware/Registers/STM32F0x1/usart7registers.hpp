@@ -42,6 +42,8 @@ struct USART7
     using RTOIE = USART7_CR1_RTOIE_Values<USART7::CR1, 26, 1, ReadWriteMode, USART7CR1Base> ;
     using EOBIE = USART7_CR1_EOBIE_Values<USART7::CR1, 27, 1, ReadWriteMode, USART7CR1Base> ;
     using M1 = USART7_CR1_M1_Values<USART7::CR1, 28, 1, ReadWriteMode, USART7CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART7_CR1_M1_Values<USART7::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USART7
     using LBDIE = USART7_CR2_LBDIE_Values<USART7::CR2, 6, 1, ReadWriteMode, USART7CR2Base> ;
     using LBDL = USART7_CR2_LBDL_Values<USART7::CR2, 5, 1, ReadWriteMode, USART7CR2Base> ;
     using ADDM7 = USART7_CR2_ADDM7_Values<USART7::CR2, 4, 1, ReadWriteMode, USART7CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART7_CR2_ADDM7_Values<USART7::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +103,7 @@ struct USART7
     using IRLP = USART7_CR3_IRLP_Values<USART7::CR3, 2, 1, ReadWriteMode, USART7CR3Base> ;
     using IREN = USART7_CR3_IREN_Values<USART7::CR3, 1, 1, ReadWriteMode, USART7CR3Base> ;
     using EIE = USART7_CR3_EIE_Values<USART7::CR3, 0, 1, ReadWriteMode, USART7CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART7_CR3_EIE_Values<USART7::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +116,7 @@ struct USART7
   {
     using DIV_Mantissa = USART7_BRR_DIV_Mantissa_Values<USART7::BRR, 4, 12, ReadWriteMode, USART7BRRBase> ;
     using DIV_Fraction = USART7_BRR_DIV_Fraction_Values<USART7::BRR, 0, 4, ReadWriteMode, USART7BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART7_BRR_DIV_Fraction_Values<USART7::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct USART7
   {
     using GT = USART7_GTPR_GT_Values<USART7::GTPR, 8, 8, ReadWriteMode, USART7GTPRBase> ;
     using PSC = USART7_GTPR_PSC_Values<USART7::GTPR, 0, 8, ReadWriteMode, USART7GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART7_GTPR_PSC_Values<USART7::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct USART7
   {
     using BLEN = USART7_RTOR_BLEN_Values<USART7::RTOR, 24, 8, ReadWriteMode, USART7RTORBase> ;
     using RTO = USART7_RTOR_RTO_Values<USART7::RTOR, 0, 24, ReadWriteMode, USART7RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART7_RTOR_RTO_Values<USART7::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +158,7 @@ struct USART7
     using MMRQ = USART7_RQR_MMRQ_Values<USART7::RQR, 2, 1, ReadWriteMode, USART7RQRBase> ;
     using SBKRQ = USART7_RQR_SBKRQ_Values<USART7::RQR, 1, 1, ReadWriteMode, USART7RQRBase> ;
     using ABRRQ = USART7_RQR_ABRRQ_Values<USART7::RQR, 0, 1, ReadWriteMode, USART7RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = USART7_RQR_ABRRQ_Values<USART7::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +213,9 @@ struct USART7
     using NCF = USART7_ICR_NCF_Values<USART7::ICR, 2, 1, ReadWriteMode, USART7ICRBase> ;
     using FECF = USART7_ICR_FECF_Values<USART7::ICR, 1, 1, ReadWriteMode, USART7ICRBase> ;
     using PECF = USART7_ICR_PECF_Values<USART7::ICR, 0, 1, ReadWriteMode, USART7ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART7_ICR_PECF_Values<USART7::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -227,12 +238,14 @@ struct USART7
   struct TDR : public RegisterBase<0x40011828, 32, ReadWriteMode>
   {
     using TDRField = USART7_TDR_TDR_Values<USART7::TDR, 0, 9, ReadWriteMode, USART7TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART7_TDR_TDR_Values<USART7::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40011828, 32, ReadWriteMode, USART7TDRBase, T...> ;
 
+  using Registers = TypesList<USART7::CR1, USART7::CR2, USART7::CR3, USART7::BRR, USART7::GTPR, USART7::RTOR, USART7::RQR, USART7::ISR, USART7::ICR, USART7::RDR, USART7::TDR> ;
 } ;
 
 #endif //#if !defined(USART7REGISTERS_HPP)
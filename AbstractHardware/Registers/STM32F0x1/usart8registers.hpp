@@ -42,6 +42,8 @@ struct USART8
     using RTOIE = USART8_CR1_RTOIE_Values<USART8::CR1, 26, 1, ReadWriteMode, USART8CR1Base> ;
     using EOBIE = USART8_CR1_EOBIE_Values<USART8::CR1, 27, 1, ReadWriteMode, USART8CR1Base> ;
     using M1 = USART8_CR1_M1_Values<USART8::CR1, 28, 1, ReadWriteMode, USART8CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART8_CR1_M1_Values<USART8::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USART8
     using LBDIE = USART8_CR2_LBDIE_Values<USART8::CR2, 6, 1, ReadWriteMode, USART8CR2Base> ;
     using LBDL = USART8_CR2_LBDL_Values<USART8::CR2, 5, 1, ReadWriteMode, USART8CR2Base> ;
     using ADDM7 = USART8_CR2_ADDM7_Values<USART8::CR2, 4, 1, ReadWriteMode, USART8CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART8_CR2_ADDM7_Values<USART8::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +103,7 @@ struct USART8
     using IRLP = USART8_CR3_IRLP_Values<USART8::CR3, 2, 1, ReadWriteMode, USART8CR3Base> ;
     using IREN = USART8_CR3_IREN_Values<USART8::CR3, 1, 1, ReadWriteMode, USART8CR3Base> ;
     using EIE = USART8_CR3_EIE_Values<USART8::CR3, 0, 1, ReadWriteMode, USART8CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART8_CR3_EIE_Values<USART8::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +116,7 @@ struct USART8
   {
     using DIV_Mantissa = USART8_BRR_DIV_Mantissa_Values<USART8::BRR, 4, 12, ReadWriteMode, USART8BRRBase> ;
     using DIV_Fraction = USART8_BRR_DIV_Fraction_Values<USART8::BRR, 0, 4, ReadWriteMode, USART8BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART8_BRR_DIV_Fraction_Values<USART8::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct USART8
   {
     using GT = USART8_GTPR_GT_Values<USART8::GTPR, 8, 8, ReadWriteMode, USART8GTPRBase> ;
     using PSC = USART8_GTPR_PSC_Values<USART8::GTPR, 0, 8, ReadWriteMode, USART8GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART8_GTPR_PSC_Values<USART8::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct USART8
   {
     using BLEN = USART8_RTOR_BLEN_Values<USART8::RTOR, 24, 8, ReadWriteMode, USART8RTORBase> ;
     using RTO = USART8_RTOR_RTO_Values<USART8::RTOR, 0, 24, ReadWriteMode, USART8RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART8_RTOR_RTO_Values<USART8::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +158,7 @@ struct USART8
     using MMRQ = USART8_RQR_MMRQ_Values<USART8::RQR, 2, 1, ReadWriteMode, USART8RQRBase> ;
     using SBKRQ = USART8_RQR_SBKRQ_Values<USART8::RQR, 1, 1, ReadWriteMode, USART8RQRBase> ;
     using ABRRQ = USART8_RQR_ABRRQ_Values<USART8::RQR, 0, 1, ReadWriteMode, USART8RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = USART8_RQR_ABRRQ_Values<USART8::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +213,9 @@ struct USART8
     using NCF = USART8_ICR_NCF_Values<USART8::ICR, 2, 1, ReadWriteMode, USART8ICRBase> ;
     using FECF = USART8_ICR_FECF_Values<USART8::ICR, 1, 1, ReadWriteMode, USART8ICRBase> ;
     using PECF = USART8_ICR_PECF_Values<USART8::ICR, 0, 1, ReadWriteMode, USART8ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART8_ICR_PECF_Values<USART8::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -227,12 +238,14 @@ struct USART8
   struct TDR : public RegisterBase<0x40011C28, 32, ReadWriteMode>
   {
     using TDRField = USART8_TDR_TDR_Values<USART8::TDR, 0, 9, ReadWriteMode, USART8TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART8_TDR_TDR_Values<USART8::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40011C28, 32, ReadWriteMode, USART8TDRBase, T...> ;
 
+  using Registers = TypesList<USART8::CR1, USART8::CR2, USART8::CR3, USART8::BRR, USART8::GTPR, USART8::RTOR, USART8::RQR, USART8::ISR, USART8::ICR, USART8::RDR, USART8::TDR> ;
 } ;
 
 #endif //#if !defined(USART8REGISTERS_HPP)
@@ -31,6 +31,7 @@ struct USB
     using STAT_RX = USB_EP0R_STAT_RX_Values<USB::EP0R, 12, 2, ReadWriteMode, USBEP0RBase> ;
     using DTOG_RX = USB_EP0R_DTOG_RX_Values<USB::EP0R, 14, 1, ReadWriteMode, USBEP0RBase> ;
     using CTR_RX = USB_EP0R_CTR_RX_Values<USB::EP0R, 15, 1, ReadWriteMode, USBEP0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP0R_CTR_RX_Values<USB::EP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +52,7 @@ struct USB
     using STAT_RX = USB_EP1R_STAT_RX_Values<USB::EP1R, 12, 2, ReadWriteMode, USBEP1RBase> ;
     using DTOG_RX = USB_EP1R_DTOG_RX_Values<USB::EP1R, 14, 1, ReadWriteMode, USBEP1RBase> ;
     using CTR_RX = USB_EP1R_CTR_RX_Values<USB::EP1R, 15, 1, ReadWriteMode, USBEP1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP1R_CTR_RX_Values<USB::EP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USB
     using STAT_RX = USB_EP2R_STAT_RX_Values<USB::EP2R, 12, 2, ReadWriteMode, USBEP2RBase> ;
     using DTOG_RX = USB_EP2R_DTOG_RX_Values<USB::EP2R, 14, 1, ReadWriteMode, USBEP2RBase> ;
     using CTR_RX = USB_EP2R_CTR_RX_Values<USB::EP2R, 15, 1, ReadWriteMode, USBEP2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP2R_CTR_RX_Values<USB::EP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +94,7 @@ struct USB
     using STAT_RX = USB_EP3R_STAT_RX_Values<USB::EP3R, 12, 2, ReadWriteMode, USBEP3RBase> ;
     using DTOG_RX = USB_EP3R_DTOG_RX_Values<USB::EP3R, 14, 1, ReadWriteMode, USBEP3RBase> ;
     using CTR_RX = USB_EP3R_CTR_RX_Values<USB::EP3R, 15, 1, ReadWriteMode, USBEP3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP3R_CTR_RX_Values<USB::EP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct USB
     using STAT_RX = USB_EP4R_STAT_RX_Values<USB::EP4R, 12, 2, ReadWriteMode, USBEP4RBase> ;
     using DTOG_RX = USB_EP4R_DTOG_RX_Values<USB::EP4R, 14, 1, ReadWriteMode, USBEP4RBase> ;
     using CTR_RX = USB_EP4R_CTR_RX_Values<USB::EP4R, 15, 1, ReadWriteMode, USBEP4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP4R_CTR_RX_Values<USB::EP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct USB
     using STAT_RX = USB_EP5R_STAT_RX_Values<USB::EP5R, 12, 2, ReadWriteMode, USBEP5RBase> ;
     using DTOG_RX = USB_EP5R_DTOG_RX_Values<USB::EP5R, 14, 1, ReadWriteMode, USBEP5RBase> ;
     using CTR_RX = USB_EP5R_CTR_RX_Values<USB::EP5R, 15, 1, ReadWriteMode, USBEP5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP5R_CTR_RX_Values<USB::EP5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +157,7 @@ struct USB
     using STAT_RX = USB_EP6R_STAT_RX_Values<USB::EP6R, 12, 2, ReadWriteMode, USBEP6RBase> ;
     using DTOG_RX = USB_EP6R_DTOG_RX_Values<USB::EP6R, 14, 1, ReadWriteMode, USBEP6RBase> ;
     using CTR_RX = USB_EP6R_CTR_RX_Values<USB::EP6R, 15, 1, ReadWriteMode, USBEP6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP6R_CTR_RX_Values<USB::EP6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +178,7 @@ struct USB
     using STAT_RX = USB_EP7R_STAT_RX_Values<USB::EP7R, 12, 2, ReadWriteMode, USBEP7RBase> ;
     using DTOG_RX = USB_EP7R_DTOG_RX_Values<USB::EP7R, 14, 1, ReadWriteMode, USBEP7RBase> ;
     using CTR_RX = USB_EP7R_CTR_RX_Values<USB::EP7R, 15, 1, ReadWriteMode, USBEP7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_EP7R_CTR_RX_Values<USB::EP7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +204,7 @@ struct USB
     using ERRM = USB_CNTR_ERRM_Values<USB::CNTR, 13, 1, ReadWriteMode, USBCNTRBase> ;
     using PMAOVRM = USB_CNTR_PMAOVRM_Values<USB::CNTR, 14, 1, ReadWriteMode, USBCNTRBase> ;
     using CTRM = USB_CNTR_CTRM_Values<USB::CNTR, 15, 1, ReadWriteMode, USBCNTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
     using FieldValues = USB_CNTR_CTRM_Values<USB::CNTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -217,6 +226,7 @@ struct USB
     using ERR = USB_ISTR_ERR_Values<USB::ISTR, 13, 1, ReadWriteMode, USBISTRBase> ;
     using PMAOVR = USB_ISTR_PMAOVR_Values<USB::ISTR, 14, 1, ReadWriteMode, USBISTRBase> ;
     using CTR = USB_ISTR_CTR_Values<USB::ISTR, 15, 1, ReadMode, USBISTRBase> ;
+    static constexpr Type SnapshotMask = 0x7F80U ;
     using FieldValues = USB_ISTR_CTR_Values<USB::ISTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -244,6 +254,7 @@ struct USB
   {
     using ADD = USB_DADDR_ADD_Values<USB::DADDR, 0, 7, ReadWriteMode, USBDADDRBase> ;
     using EF = USB_DADDR_EF_Values<USB::DADDR, 7, 1, ReadWriteMode, USBDADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = USB_DADDR_EF_Values<USB::DADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +266,7 @@ struct USB
   struct BTABLE : public RegisterBase<0x40005C50, 32, ReadWriteMode>
   {
     using BTABLEField = USB_BTABLE_BTABLE_Values<USB::BTABLE, 3, 13, ReadWriteMode, USBBTABLEBase> ;
+    static constexpr Type SnapshotMask = 0xFFF8U ;
     using FieldValues = USB_BTABLE_BTABLE_Values<USB::BTABLE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -269,6 +281,7 @@ struct USB
     using LPMACK = USB_LPMCSR_LPMACK_Values<USB::LPMCSR, 1, 1, ReadWriteMode, USBLPMCSRBase> ;
     using REMWAKE = USB_LPMCSR_REMWAKE_Values<USB::LPMCSR, 3, 1, ReadMode, USBLPMCSRBase> ;
     using BESL = USB_LPMCSR_BESL_Values<USB::LPMCSR, 4, 4, ReadMode, USBLPMCSRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = USB_LPMCSR_BESL_Values<USB::LPMCSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -288,12 +301,14 @@ struct USB
     using SDET = USB_BCDR_SDET_Values<USB::BCDR, 6, 1, ReadMode, USBBCDRBase> ;
     using PS2DET = USB_BCDR_PS2DET_Values<USB::BCDR, 7, 1, ReadMode, USBBCDRBase> ;
     using DPPU = USB_BCDR_DPPU_Values<USB::BCDR, 15, 1, ReadWriteMode, USBBCDRBase> ;
+    static constexpr Type SnapshotMask = 0x800FU ;
     using FieldValues = USB_BCDR_DPPU_Values<USB::BCDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BCDRPack  = Register<0x40005C58, 32, ReadWriteMode, USBBCDRBase, T...> ;
 
+  using Registers = TypesList<USB::EP0R, USB::EP1R, USB::EP2R, USB::EP3R, USB::EP4R, USB::EP5R, USB::EP6R, USB::EP7R, USB::CNTR, USB::ISTR, USB::FNR, USB::DADDR, USB::BTABLE, USB::LPMCSR, USB::BCDR> ;
 } ;
 
 #endif //#if !defined(USBREGISTERS_HPP)
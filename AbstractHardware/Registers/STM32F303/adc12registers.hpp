@@ -61,6 +61,7 @@ struct ADC1_2
     using VREFEN = ADC1_2_CCR_VREFEN_Values<ADC1_2::CCR, 22, 1, ReadWriteMode, ADC1_2CCRBase> ;
     using TSEN = ADC1_2_CCR_TSEN_Values<ADC1_2::CCR, 23, 1, ReadWriteMode, ADC1_2CCRBase> ;
     using VBATEN = ADC1_2_CCR_VBATEN_Values<ADC1_2::CCR, 24, 1, ReadWriteMode, ADC1_2CCRBase> ;
+    static constexpr Type SnapshotMask = 0x1C3EF1FU ;
     using FieldValues = ADC1_2_CCR_VBATEN_Values<ADC1_2::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +80,7 @@ struct ADC1_2
   template<typename... T> 
   using CDRPack  = Register<0x5000030C, 32, ReadMode, ADC1_2CDRBase, T...> ;
 
+  using Registers = TypesList<ADC1_2::CSR, ADC1_2::CCR, ADC1_2::CDR> ;
 } ;
 
 #endif //#if !defined(ADC12REGISTERS_HPP)
@@ -32,6 +32,9 @@ struct ADC1
     using EOC = ADC1_ISR_EOC_Values<ADC1::ISR, 2, 1, ReadWriteMode, ADC1ISRBase> ;
     using EOSMP = ADC1_ISR_EOSMP_Values<ADC1::ISR, 1, 1, ReadWriteMode, ADC1ISRBase> ;
     using ADRDY = ADC1_ISR_ADRDY_Values<ADC1::ISR, 0, 1, ReadWriteMode, ADC1ISRBase> ;
+    static constexpr Type WritableMask = 0x7FFU ;
+    static constexpr Type OneToClearMask = 0x7FFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC1_ISR_ADRDY_Values<ADC1::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +56,7 @@ struct ADC1
     using EOCIE = ADC1_IER_EOCIE_Values<ADC1::IER, 2, 1, ReadWriteMode, ADC1IERBase> ;
     using EOSMPIE = ADC1_IER_EOSMPIE_Values<ADC1::IER, 1, 1, ReadWriteMode, ADC1IERBase> ;
     using ADRDYIE = ADC1_IER_ADRDYIE_Values<ADC1::IER, 0, 1, ReadWriteMode, ADC1IERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = ADC1_IER_ADRDYIE_Values<ADC1::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,7 @@ struct ADC1
     using ADSTART = ADC1_CR_ADSTART_Values<ADC1::CR, 2, 1, ReadWriteMode, ADC1CRBase> ;
     using ADDIS = ADC1_CR_ADDIS_Values<ADC1::CR, 1, 1, ReadWriteMode, ADC1CRBase> ;
     using ADEN = ADC1_CR_ADEN_Values<ADC1::CR, 0, 1, ReadWriteMode, ADC1CRBase> ;
+    static constexpr Type SnapshotMask = 0xF000003FU ;
     using FieldValues = ADC1_CR_ADEN_Values<ADC1::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,7 @@ struct ADC1
     using RES = ADC1_CFGR_RES_Values<ADC1::CFGR, 3, 2, ReadWriteMode, ADC1CFGRBase> ;
     using DMACFG = ADC1_CFGR_DMACFG_Values<ADC1::CFGR, 1, 1, ReadWriteMode, ADC1CFGRBase> ;
     using DMAEN = ADC1_CFGR_DMAEN_Values<ADC1::CFGR, 0, 1, ReadWriteMode, ADC1CFGRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFBU ;
     using FieldValues = ADC1_CFGR_DMAEN_Values<ADC1::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +127,7 @@ struct ADC1
     using SMP3 = ADC1_SMPR1_SMP3_Values<ADC1::SMPR1, 9, 3, ReadWriteMode, ADC1SMPR1Base> ;
     using SMP2 = ADC1_SMPR1_SMP2_Values<ADC1::SMPR1, 6, 3, ReadWriteMode, ADC1SMPR1Base> ;
     using SMP1 = ADC1_SMPR1_SMP1_Values<ADC1::SMPR1, 3, 3, ReadWriteMode, ADC1SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFF8U ;
     using FieldValues = ADC1_SMPR1_SMP1_Values<ADC1::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +147,7 @@ struct ADC1
     using SMP12 = ADC1_SMPR2_SMP12_Values<ADC1::SMPR2, 6, 3, ReadWriteMode, ADC1SMPR2Base> ;
     using SMP11 = ADC1_SMPR2_SMP11_Values<ADC1::SMPR2, 3, 3, ReadWriteMode, ADC1SMPR2Base> ;
     using SMP10 = ADC1_SMPR2_SMP10_Values<ADC1::SMPR2, 0, 3, ReadWriteMode, ADC1SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = ADC1_SMPR2_SMP10_Values<ADC1::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +160,7 @@ struct ADC1
   {
     using HT1 = ADC1_TR1_HT1_Values<ADC1::TR1, 16, 12, ReadWriteMode, ADC1TR1Base> ;
     using LT1 = ADC1_TR1_LT1_Values<ADC1::TR1, 0, 12, ReadWriteMode, ADC1TR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = ADC1_TR1_LT1_Values<ADC1::TR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +173,7 @@ struct ADC1
   {
     using HT2 = ADC1_TR2_HT2_Values<ADC1::TR2, 16, 8, ReadWriteMode, ADC1TR2Base> ;
     using LT2 = ADC1_TR2_LT2_Values<ADC1::TR2, 0, 8, ReadWriteMode, ADC1TR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC1_TR2_LT2_Values<ADC1::TR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +186,7 @@ struct ADC1
   {
     using HT3 = ADC1_TR3_HT3_Values<ADC1::TR3, 16, 8, ReadWriteMode, ADC1TR3Base> ;
     using LT3 = ADC1_TR3_LT3_Values<ADC1::TR3, 0, 8, ReadWriteMode, ADC1TR3Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC1_TR3_LT3_Values<ADC1::TR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +202,7 @@ struct ADC1
     using SQ2 = ADC1_SQR1_SQ2_Values<ADC1::SQR1, 12, 5, ReadWriteMode, ADC1SQR1Base> ;
     using SQ1 = ADC1_SQR1_SQ1_Values<ADC1::SQR1, 6, 5, ReadWriteMode, ADC1SQR1Base> ;
     using L3 = ADC1_SQR1_L3_Values<ADC1::SQR1, 0, 4, ReadWriteMode, ADC1SQR1Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7CFU ;
     using FieldValues = ADC1_SQR1_L3_Values<ADC1::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +218,7 @@ struct ADC1
     using SQ7 = ADC1_SQR2_SQ7_Values<ADC1::SQR2, 12, 5, ReadWriteMode, ADC1SQR2Base> ;
     using SQ6 = ADC1_SQR2_SQ6_Values<ADC1::SQR2, 6, 5, ReadWriteMode, ADC1SQR2Base> ;
     using SQ5 = ADC1_SQR2_SQ5_Values<ADC1::SQR2, 0, 5, ReadWriteMode, ADC1SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC1_SQR2_SQ5_Values<ADC1::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -221,6 +234,7 @@ struct ADC1
     using SQ12 = ADC1_SQR3_SQ12_Values<ADC1::SQR3, 12, 5, ReadWriteMode, ADC1SQR3Base> ;
     using SQ11 = ADC1_SQR3_SQ11_Values<ADC1::SQR3, 6, 5, ReadWriteMode, ADC1SQR3Base> ;
     using SQ10 = ADC1_SQR3_SQ10_Values<ADC1::SQR3, 0, 5, ReadWriteMode, ADC1SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC1_SQR3_SQ10_Values<ADC1::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +247,7 @@ struct ADC1
   {
     using SQ16 = ADC1_SQR4_SQ16_Values<ADC1::SQR4, 6, 5, ReadWriteMode, ADC1SQR4Base> ;
     using SQ15 = ADC1_SQR4_SQ15_Values<ADC1::SQR4, 0, 5, ReadWriteMode, ADC1SQR4Base> ;
+    static constexpr Type SnapshotMask = 0x7DFU ;
     using FieldValues = ADC1_SQR4_SQ15_Values<ADC1::SQR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -261,6 +276,7 @@ struct ADC1
     using JEXTEN = ADC1_JSQR_JEXTEN_Values<ADC1::JSQR, 6, 2, ReadWriteMode, ADC1JSQRBase> ;
     using JEXTSEL = ADC1_JSQR_JEXTSEL_Values<ADC1::JSQR, 2, 4, ReadWriteMode, ADC1JSQRBase> ;
     using JL = ADC1_JSQR_JL_Values<ADC1::JSQR, 0, 2, ReadWriteMode, ADC1JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x7DF7DFFFU ;
     using FieldValues = ADC1_JSQR_JL_Values<ADC1::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +290,7 @@ struct ADC1
     using OFFSET1_EN = ADC1_OFR1_OFFSET1_EN_Values<ADC1::OFR1, 31, 1, ReadWriteMode, ADC1OFR1Base> ;
     using OFFSET1_CH = ADC1_OFR1_OFFSET1_CH_Values<ADC1::OFR1, 26, 5, ReadWriteMode, ADC1OFR1Base> ;
     using OFFSET1 = ADC1_OFR1_OFFSET1_Values<ADC1::OFR1, 0, 12, ReadWriteMode, ADC1OFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC1_OFR1_OFFSET1_Values<ADC1::OFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -287,6 +304,7 @@ struct ADC1
     using OFFSET2_EN = ADC1_OFR2_OFFSET2_EN_Values<ADC1::OFR2, 31, 1, ReadWriteMode, ADC1OFR2Base> ;
     using OFFSET2_CH = ADC1_OFR2_OFFSET2_CH_Values<ADC1::OFR2, 26, 5, ReadWriteMode, ADC1OFR2Base> ;
     using OFFSET2 = ADC1_OFR2_OFFSET2_Values<ADC1::OFR2, 0, 12, ReadWriteMode, ADC1OFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC1_OFR2_OFFSET2_Values<ADC1::OFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -300,6 +318,7 @@ struct ADC1
     using OFFSET3_EN = ADC1_OFR3_OFFSET3_EN_Values<ADC1::OFR3, 31, 1, ReadWriteMode, ADC1OFR3Base> ;
     using OFFSET3_CH = ADC1_OFR3_OFFSET3_CH_Values<ADC1::OFR3, 26, 5, ReadWriteMode, ADC1OFR3Base> ;
     using OFFSET3 = ADC1_OFR3_OFFSET3_Values<ADC1::OFR3, 0, 12, ReadWriteMode, ADC1OFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC1_OFR3_OFFSET3_Values<ADC1::OFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -313,6 +332,7 @@ struct ADC1
     using OFFSET4_EN = ADC1_OFR4_OFFSET4_EN_Values<ADC1::OFR4, 31, 1, ReadWriteMode, ADC1OFR4Base> ;
     using OFFSET4_CH = ADC1_OFR4_OFFSET4_CH_Values<ADC1::OFR4, 26, 5, ReadWriteMode, ADC1OFR4Base> ;
     using OFFSET4 = ADC1_OFR4_OFFSET4_Values<ADC1::OFR4, 0, 12, ReadWriteMode, ADC1OFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC1_OFR4_OFFSET4_Values<ADC1::OFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -368,6 +388,7 @@ struct ADC1
   struct AWD2CR : public RegisterBase<0x500000A0, 32, ReadWriteMode>
   {
     using AWD2CH = ADC1_AWD2CR_AWD2CH_Values<ADC1::AWD2CR, 1, 18, ReadWriteMode, ADC1AWD2CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC1_AWD2CR_AWD2CH_Values<ADC1::AWD2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +400,7 @@ struct ADC1
   struct AWD3CR : public RegisterBase<0x500000A4, 32, ReadWriteMode>
   {
     using AWD3CH = ADC1_AWD3CR_AWD3CH_Values<ADC1::AWD3CR, 1, 18, ReadWriteMode, ADC1AWD3CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC1_AWD3CR_AWD3CH_Values<ADC1::AWD3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -391,6 +413,7 @@ struct ADC1
   {
     using DIFSEL_1_15 = ADC1_DIFSEL_DIFSEL_1_15_Values<ADC1::DIFSEL, 1, 15, ReadWriteMode, ADC1DIFSELBase> ;
     using DIFSEL_16_18 = ADC1_DIFSEL_DIFSEL_16_18_Values<ADC1::DIFSEL, 16, 3, ReadMode, ADC1DIFSELBase> ;
+    static constexpr Type SnapshotMask = 0xFFFEU ;
     using FieldValues = ADC1_DIFSEL_DIFSEL_16_18_Values<ADC1::DIFSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -403,12 +426,14 @@ struct ADC1
   {
     using CALFACT_D = ADC1_CALFACT_CALFACT_D_Values<ADC1::CALFACT, 16, 7, ReadWriteMode, ADC1CALFACTBase> ;
     using CALFACT_S = ADC1_CALFACT_CALFACT_S_Values<ADC1::CALFACT, 0, 7, ReadWriteMode, ADC1CALFACTBase> ;
+    static constexpr Type SnapshotMask = 0x7F007FU ;
     using FieldValues = ADC1_CALFACT_CALFACT_S_Values<ADC1::CALFACT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALFACTPack  = Register<0x500000B4, 32, ReadWriteMode, ADC1CALFACTBase, T...> ;
 
+  using Registers = TypesList<ADC1::ISR, ADC1::IER, ADC1::CR, ADC1::CFGR, ADC1::SMPR1, ADC1::SMPR2, ADC1::TR1, ADC1::TR2, ADC1::TR3, ADC1::SQR1, ADC1::SQR2, ADC1::SQR3, ADC1::SQR4, ADC1::DR, ADC1::JSQR, ADC1::OFR1, ADC1::OFR2, ADC1::OFR3, ADC1::OFR4, ADC1::JDR1, ADC1::JDR2, ADC1::JDR3, ADC1::JDR4, ADC1::AWD2CR, ADC1::AWD3CR, ADC1::DIFSEL, ADC1::CALFACT> ;
 } ;
 
 #endif //#if !defined(ADC1REGISTERS_HPP)
@@ -32,6 +32,9 @@ struct ADC2
     using EOC = ADC2_ISR_EOC_Values<ADC2::ISR, 2, 1, ReadWriteMode, ADC2ISRBase> ;
     using EOSMP = ADC2_ISR_EOSMP_Values<ADC2::ISR, 1, 1, ReadWriteMode, ADC2ISRBase> ;
     using ADRDY = ADC2_ISR_ADRDY_Values<ADC2::ISR, 0, 1, ReadWriteMode, ADC2ISRBase> ;
+    static constexpr Type WritableMask = 0x7FFU ;
+    static constexpr Type OneToClearMask = 0x7FFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC2_ISR_ADRDY_Values<ADC2::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +56,7 @@ struct ADC2
     using EOCIE = ADC2_IER_EOCIE_Values<ADC2::IER, 2, 1, ReadWriteMode, ADC2IERBase> ;
     using EOSMPIE = ADC2_IER_EOSMPIE_Values<ADC2::IER, 1, 1, ReadWriteMode, ADC2IERBase> ;
     using ADRDYIE = ADC2_IER_ADRDYIE_Values<ADC2::IER, 0, 1, ReadWriteMode, ADC2IERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = ADC2_IER_ADRDYIE_Values<ADC2::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,7 @@ struct ADC2
     using ADSTART = ADC2_CR_ADSTART_Values<ADC2::CR, 2, 1, ReadWriteMode, ADC2CRBase> ;
     using ADDIS = ADC2_CR_ADDIS_Values<ADC2::CR, 1, 1, ReadWriteMode, ADC2CRBase> ;
     using ADEN = ADC2_CR_ADEN_Values<ADC2::CR, 0, 1, ReadWriteMode, ADC2CRBase> ;
+    static constexpr Type SnapshotMask = 0xF000003FU ;
     using FieldValues = ADC2_CR_ADEN_Values<ADC2::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,7 @@ struct ADC2
     using RES = ADC2_CFGR_RES_Values<ADC2::CFGR, 3, 2, ReadWriteMode, ADC2CFGRBase> ;
     using DMACFG = ADC2_CFGR_DMACFG_Values<ADC2::CFGR, 1, 1, ReadWriteMode, ADC2CFGRBase> ;
     using DMAEN = ADC2_CFGR_DMAEN_Values<ADC2::CFGR, 0, 1, ReadWriteMode, ADC2CFGRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFBU ;
     using FieldValues = ADC2_CFGR_DMAEN_Values<ADC2::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +127,7 @@ struct ADC2
     using SMP3 = ADC2_SMPR1_SMP3_Values<ADC2::SMPR1, 9, 3, ReadWriteMode, ADC2SMPR1Base> ;
     using SMP2 = ADC2_SMPR1_SMP2_Values<ADC2::SMPR1, 6, 3, ReadWriteMode, ADC2SMPR1Base> ;
     using SMP1 = ADC2_SMPR1_SMP1_Values<ADC2::SMPR1, 3, 3, ReadWriteMode, ADC2SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFF8U ;
     using FieldValues = ADC2_SMPR1_SMP1_Values<ADC2::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +147,7 @@ struct ADC2
     using SMP12 = ADC2_SMPR2_SMP12_Values<ADC2::SMPR2, 6, 3, ReadWriteMode, ADC2SMPR2Base> ;
     using SMP11 = ADC2_SMPR2_SMP11_Values<ADC2::SMPR2, 3, 3, ReadWriteMode, ADC2SMPR2Base> ;
     using SMP10 = ADC2_SMPR2_SMP10_Values<ADC2::SMPR2, 0, 3, ReadWriteMode, ADC2SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = ADC2_SMPR2_SMP10_Values<ADC2::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +160,7 @@ struct ADC2
   {
     using HT1 = ADC2_TR1_HT1_Values<ADC2::TR1, 16, 12, ReadWriteMode, ADC2TR1Base> ;
     using LT1 = ADC2_TR1_LT1_Values<ADC2::TR1, 0, 12, ReadWriteMode, ADC2TR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = ADC2_TR1_LT1_Values<ADC2::TR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +173,7 @@ struct ADC2
   {
     using HT2 = ADC2_TR2_HT2_Values<ADC2::TR2, 16, 8, ReadWriteMode, ADC2TR2Base> ;
     using LT2 = ADC2_TR2_LT2_Values<ADC2::TR2, 0, 8, ReadWriteMode, ADC2TR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC2_TR2_LT2_Values<ADC2::TR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +186,7 @@ struct ADC2
   {
     using HT3 = ADC2_TR3_HT3_Values<ADC2::TR3, 16, 8, ReadWriteMode, ADC2TR3Base> ;
     using LT3 = ADC2_TR3_LT3_Values<ADC2::TR3, 0, 8, ReadWriteMode, ADC2TR3Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC2_TR3_LT3_Values<ADC2::TR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +202,7 @@ struct ADC2
     using SQ2 = ADC2_SQR1_SQ2_Values<ADC2::SQR1, 12, 5, ReadWriteMode, ADC2SQR1Base> ;
     using SQ1 = ADC2_SQR1_SQ1_Values<ADC2::SQR1, 6, 5, ReadWriteMode, ADC2SQR1Base> ;
     using L3 = ADC2_SQR1_L3_Values<ADC2::SQR1, 0, 4, ReadWriteMode, ADC2SQR1Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7CFU ;
     using FieldValues = ADC2_SQR1_L3_Values<ADC2::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +218,7 @@ struct ADC2
     using SQ7 = ADC2_SQR2_SQ7_Values<ADC2::SQR2, 12, 5, ReadWriteMode, ADC2SQR2Base> ;
     using SQ6 = ADC2_SQR2_SQ6_Values<ADC2::SQR2, 6, 5, ReadWriteMode, ADC2SQR2Base> ;
     using SQ5 = ADC2_SQR2_SQ5_Values<ADC2::SQR2, 0, 5, ReadWriteMode, ADC2SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC2_SQR2_SQ5_Values<ADC2::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -221,6 +234,7 @@ struct ADC2
     using SQ12 = ADC2_SQR3_SQ12_Values<ADC2::SQR3, 12, 5, ReadWriteMode, ADC2SQR3Base> ;
     using SQ11 = ADC2_SQR3_SQ11_Values<ADC2::SQR3, 6, 5, ReadWriteMode, ADC2SQR3Base> ;
     using SQ10 = ADC2_SQR3_SQ10_Values<ADC2::SQR3, 0, 5, ReadWriteMode, ADC2SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC2_SQR3_SQ10_Values<ADC2::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +247,7 @@ struct ADC2
   {
     using SQ16 = ADC2_SQR4_SQ16_Values<ADC2::SQR4, 6, 5, ReadWriteMode, ADC2SQR4Base> ;
     using SQ15 = ADC2_SQR4_SQ15_Values<ADC2::SQR4, 0, 5, ReadWriteMode, ADC2SQR4Base> ;
+    static constexpr Type SnapshotMask = 0x7DFU ;
     using FieldValues = ADC2_SQR4_SQ15_Values<ADC2::SQR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -261,6 +276,7 @@ struct ADC2
     using JEXTEN = ADC2_JSQR_JEXTEN_Values<ADC2::JSQR, 6, 2, ReadWriteMode, ADC2JSQRBase> ;
     using JEXTSEL = ADC2_JSQR_JEXTSEL_Values<ADC2::JSQR, 2, 4, ReadWriteMode, ADC2JSQRBase> ;
     using JL = ADC2_JSQR_JL_Values<ADC2::JSQR, 0, 2, ReadWriteMode, ADC2JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x7DF7DFFFU ;
     using FieldValues = ADC2_JSQR_JL_Values<ADC2::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +290,7 @@ struct ADC2
     using OFFSET1_EN = ADC2_OFR1_OFFSET1_EN_Values<ADC2::OFR1, 31, 1, ReadWriteMode, ADC2OFR1Base> ;
     using OFFSET1_CH = ADC2_OFR1_OFFSET1_CH_Values<ADC2::OFR1, 26, 5, ReadWriteMode, ADC2OFR1Base> ;
     using OFFSET1 = ADC2_OFR1_OFFSET1_Values<ADC2::OFR1, 0, 12, ReadWriteMode, ADC2OFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC2_OFR1_OFFSET1_Values<ADC2::OFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -287,6 +304,7 @@ struct ADC2
     using OFFSET2_EN = ADC2_OFR2_OFFSET2_EN_Values<ADC2::OFR2, 31, 1, ReadWriteMode, ADC2OFR2Base> ;
     using OFFSET2_CH = ADC2_OFR2_OFFSET2_CH_Values<ADC2::OFR2, 26, 5, ReadWriteMode, ADC2OFR2Base> ;
     using OFFSET2 = ADC2_OFR2_OFFSET2_Values<ADC2::OFR2, 0, 12, ReadWriteMode, ADC2OFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC2_OFR2_OFFSET2_Values<ADC2::OFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -300,6 +318,7 @@ struct ADC2
     using OFFSET3_EN = ADC2_OFR3_OFFSET3_EN_Values<ADC2::OFR3, 31, 1, ReadWriteMode, ADC2OFR3Base> ;
     using OFFSET3_CH = ADC2_OFR3_OFFSET3_CH_Values<ADC2::OFR3, 26, 5, ReadWriteMode, ADC2OFR3Base> ;
     using OFFSET3 = ADC2_OFR3_OFFSET3_Values<ADC2::OFR3, 0, 12, ReadWriteMode, ADC2OFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC2_OFR3_OFFSET3_Values<ADC2::OFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -313,6 +332,7 @@ struct ADC2
     using OFFSET4_EN = ADC2_OFR4_OFFSET4_EN_Values<ADC2::OFR4, 31, 1, ReadWriteMode, ADC2OFR4Base> ;
     using OFFSET4_CH = ADC2_OFR4_OFFSET4_CH_Values<ADC2::OFR4, 26, 5, ReadWriteMode, ADC2OFR4Base> ;
     using OFFSET4 = ADC2_OFR4_OFFSET4_Values<ADC2::OFR4, 0, 12, ReadWriteMode, ADC2OFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC2_OFR4_OFFSET4_Values<ADC2::OFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -368,6 +388,7 @@ struct ADC2
   struct AWD2CR : public RegisterBase<0x500001A0, 32, ReadWriteMode>
   {
     using AWD2CH = ADC2_AWD2CR_AWD2CH_Values<ADC2::AWD2CR, 1, 18, ReadWriteMode, ADC2AWD2CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC2_AWD2CR_AWD2CH_Values<ADC2::AWD2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +400,7 @@ struct ADC2
   struct AWD3CR : public RegisterBase<0x500001A4, 32, ReadWriteMode>
   {
     using AWD3CH = ADC2_AWD3CR_AWD3CH_Values<ADC2::AWD3CR, 1, 18, ReadWriteMode, ADC2AWD3CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC2_AWD3CR_AWD3CH_Values<ADC2::AWD3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -391,6 +413,7 @@ struct ADC2
   {
     using DIFSEL_1_15 = ADC2_DIFSEL_DIFSEL_1_15_Values<ADC2::DIFSEL, 1, 15, ReadWriteMode, ADC2DIFSELBase> ;
     using DIFSEL_16_18 = ADC2_DIFSEL_DIFSEL_16_18_Values<ADC2::DIFSEL, 16, 3, ReadMode, ADC2DIFSELBase> ;
+    static constexpr Type SnapshotMask = 0xFFFEU ;
     using FieldValues = ADC2_DIFSEL_DIFSEL_16_18_Values<ADC2::DIFSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -403,12 +426,14 @@ struct ADC2
   {
     using CALFACT_D = ADC2_CALFACT_CALFACT_D_Values<ADC2::CALFACT, 16, 7, ReadWriteMode, ADC2CALFACTBase> ;
     using CALFACT_S = ADC2_CALFACT_CALFACT_S_Values<ADC2::CALFACT, 0, 7, ReadWriteMode, ADC2CALFACTBase> ;
+    static constexpr Type SnapshotMask = 0x7F007FU ;
     using FieldValues = ADC2_CALFACT_CALFACT_S_Values<ADC2::CALFACT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALFACTPack  = Register<0x500001B4, 32, ReadWriteMode, ADC2CALFACTBase, T...> ;
 
+  using Registers = TypesList<ADC2::ISR, ADC2::IER, ADC2::CR, ADC2::CFGR, ADC2::SMPR1, ADC2::SMPR2, ADC2::TR1, ADC2::TR2, ADC2::TR3, ADC2::SQR1, ADC2::SQR2, ADC2::SQR3, ADC2::SQR4, ADC2::DR, ADC2::JSQR, ADC2::OFR1, ADC2::OFR2, ADC2::OFR3, ADC2::OFR4, ADC2::JDR1, ADC2::JDR2, ADC2::JDR3, ADC2::JDR4, ADC2::AWD2CR, ADC2::AWD3CR, ADC2::DIFSEL, ADC2::CALFACT> ;
 } ;
 
 #endif //#if !defined(ADC2REGISTERS_HPP)
@@ -61,6 +61,7 @@ struct ADC3_4
     using VREFEN = ADC3_4_CCR_VREFEN_Values<ADC3_4::CCR, 22, 1, ReadWriteMode, ADC3_4CCRBase> ;
     using TSEN = ADC3_4_CCR_TSEN_Values<ADC3_4::CCR, 23, 1, ReadWriteMode, ADC3_4CCRBase> ;
     using VBATEN = ADC3_4_CCR_VBATEN_Values<ADC3_4::CCR, 24, 1, ReadWriteMode, ADC3_4CCRBase> ;
+    static constexpr Type SnapshotMask = 0x1C3EF1FU ;
     using FieldValues = ADC3_4_CCR_VBATEN_Values<ADC3_4::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +80,7 @@ struct ADC3_4
   template<typename... T> 
   using CDRPack  = Register<0x5000070C, 32, ReadMode, ADC3_4CDRBase, T...> ;
 
+  using Registers = TypesList<ADC3_4::CSR, ADC3_4::CCR, ADC3_4::CDR> ;
 } ;
 
 #endif //#if !defined(ADC34REGISTERS_HPP)
@@ -32,6 +32,9 @@ struct ADC3
     using EOC = ADC3_ISR_EOC_Values<ADC3::ISR, 2, 1, ReadWriteMode, ADC3ISRBase> ;
     using EOSMP = ADC3_ISR_EOSMP_Values<ADC3::ISR, 1, 1, ReadWriteMode, ADC3ISRBase> ;
     using ADRDY = ADC3_ISR_ADRDY_Values<ADC3::ISR, 0, 1, ReadWriteMode, ADC3ISRBase> ;
+    static constexpr Type WritableMask = 0x7FFU ;
+    static constexpr Type OneToClearMask = 0x7FFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC3_ISR_ADRDY_Values<ADC3::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +56,7 @@ struct ADC3
     using EOCIE = ADC3_IER_EOCIE_Values<ADC3::IER, 2, 1, ReadWriteMode, ADC3IERBase> ;
     using EOSMPIE = ADC3_IER_EOSMPIE_Values<ADC3::IER, 1, 1, ReadWriteMode, ADC3IERBase> ;
     using ADRDYIE = ADC3_IER_ADRDYIE_Values<ADC3::IER, 0, 1, ReadWriteMode, ADC3IERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = ADC3_IER_ADRDYIE_Values<ADC3::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,7 @@ struct ADC3
     using ADSTART = ADC3_CR_ADSTART_Values<ADC3::CR, 2, 1, ReadWriteMode, ADC3CRBase> ;
     using ADDIS = ADC3_CR_ADDIS_Values<ADC3::CR, 1, 1, ReadWriteMode, ADC3CRBase> ;
     using ADEN = ADC3_CR_ADEN_Values<ADC3::CR, 0, 1, ReadWriteMode, ADC3CRBase> ;
+    static constexpr Type SnapshotMask = 0xF000003FU ;
     using FieldValues = ADC3_CR_ADEN_Values<ADC3::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,7 @@ struct ADC3
     using RES = ADC3_CFGR_RES_Values<ADC3::CFGR, 3, 2, ReadWriteMode, ADC3CFGRBase> ;
     using DMACFG = ADC3_CFGR_DMACFG_Values<ADC3::CFGR, 1, 1, ReadWriteMode, ADC3CFGRBase> ;
     using DMAEN = ADC3_CFGR_DMAEN_Values<ADC3::CFGR, 0, 1, ReadWriteMode, ADC3CFGRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFBU ;
     using FieldValues = ADC3_CFGR_DMAEN_Values<ADC3::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +127,7 @@ struct ADC3
     using SMP3 = ADC3_SMPR1_SMP3_Values<ADC3::SMPR1, 9, 3, ReadWriteMode, ADC3SMPR1Base> ;
     using SMP2 = ADC3_SMPR1_SMP2_Values<ADC3::SMPR1, 6, 3, ReadWriteMode, ADC3SMPR1Base> ;
     using SMP1 = ADC3_SMPR1_SMP1_Values<ADC3::SMPR1, 3, 3, ReadWriteMode, ADC3SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFF8U ;
     using FieldValues = ADC3_SMPR1_SMP1_Values<ADC3::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +147,7 @@ struct ADC3
     using SMP12 = ADC3_SMPR2_SMP12_Values<ADC3::SMPR2, 6, 3, ReadWriteMode, ADC3SMPR2Base> ;
     using SMP11 = ADC3_SMPR2_SMP11_Values<ADC3::SMPR2, 3, 3, ReadWriteMode, ADC3SMPR2Base> ;
     using SMP10 = ADC3_SMPR2_SMP10_Values<ADC3::SMPR2, 0, 3, ReadWriteMode, ADC3SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = ADC3_SMPR2_SMP10_Values<ADC3::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +160,7 @@ struct ADC3
   {
     using HT1 = ADC3_TR1_HT1_Values<ADC3::TR1, 16, 12, ReadWriteMode, ADC3TR1Base> ;
     using LT1 = ADC3_TR1_LT1_Values<ADC3::TR1, 0, 12, ReadWriteMode, ADC3TR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = ADC3_TR1_LT1_Values<ADC3::TR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +173,7 @@ struct ADC3
   {
     using HT2 = ADC3_TR2_HT2_Values<ADC3::TR2, 16, 8, ReadWriteMode, ADC3TR2Base> ;
     using LT2 = ADC3_TR2_LT2_Values<ADC3::TR2, 0, 8, ReadWriteMode, ADC3TR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC3_TR2_LT2_Values<ADC3::TR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +186,7 @@ struct ADC3
   {
     using HT3 = ADC3_TR3_HT3_Values<ADC3::TR3, 16, 8, ReadWriteMode, ADC3TR3Base> ;
     using LT3 = ADC3_TR3_LT3_Values<ADC3::TR3, 0, 8, ReadWriteMode, ADC3TR3Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC3_TR3_LT3_Values<ADC3::TR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +202,7 @@ struct ADC3
     using SQ2 = ADC3_SQR1_SQ2_Values<ADC3::SQR1, 12, 5, ReadWriteMode, ADC3SQR1Base> ;
     using SQ1 = ADC3_SQR1_SQ1_Values<ADC3::SQR1, 6, 5, ReadWriteMode, ADC3SQR1Base> ;
     using L3 = ADC3_SQR1_L3_Values<ADC3::SQR1, 0, 4, ReadWriteMode, ADC3SQR1Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7CFU ;
     using FieldValues = ADC3_SQR1_L3_Values<ADC3::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +218,7 @@ struct ADC3
     using SQ7 = ADC3_SQR2_SQ7_Values<ADC3::SQR2, 12, 5, ReadWriteMode, ADC3SQR2Base> ;
     using SQ6 = ADC3_SQR2_SQ6_Values<ADC3::SQR2, 6, 5, ReadWriteMode, ADC3SQR2Base> ;
     using SQ5 = ADC3_SQR2_SQ5_Values<ADC3::SQR2, 0, 5, ReadWriteMode, ADC3SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC3_SQR2_SQ5_Values<ADC3::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -221,6 +234,7 @@ struct ADC3
     using SQ12 = ADC3_SQR3_SQ12_Values<ADC3::SQR3, 12, 5, ReadWriteMode, ADC3SQR3Base> ;
     using SQ11 = ADC3_SQR3_SQ11_Values<ADC3::SQR3, 6, 5, ReadWriteMode, ADC3SQR3Base> ;
     using SQ10 = ADC3_SQR3_SQ10_Values<ADC3::SQR3, 0, 5, ReadWriteMode, ADC3SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC3_SQR3_SQ10_Values<ADC3::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +247,7 @@ struct ADC3
   {
     using SQ16 = ADC3_SQR4_SQ16_Values<ADC3::SQR4, 6, 5, ReadWriteMode, ADC3SQR4Base> ;
     using SQ15 = ADC3_SQR4_SQ15_Values<ADC3::SQR4, 0, 5, ReadWriteMode, ADC3SQR4Base> ;
+    static constexpr Type SnapshotMask = 0x7DFU ;
     using FieldValues = ADC3_SQR4_SQ15_Values<ADC3::SQR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -261,6 +276,7 @@ struct ADC3
     using JEXTEN = ADC3_JSQR_JEXTEN_Values<ADC3::JSQR, 6, 2, ReadWriteMode, ADC3JSQRBase> ;
     using JEXTSEL = ADC3_JSQR_JEXTSEL_Values<ADC3::JSQR, 2, 4, ReadWriteMode, ADC3JSQRBase> ;
     using JL = ADC3_JSQR_JL_Values<ADC3::JSQR, 0, 2, ReadWriteMode, ADC3JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x7DF7DFFFU ;
     using FieldValues = ADC3_JSQR_JL_Values<ADC3::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +290,7 @@ struct ADC3
     using OFFSET1_EN = ADC3_OFR1_OFFSET1_EN_Values<ADC3::OFR1, 31, 1, ReadWriteMode, ADC3OFR1Base> ;
     using OFFSET1_CH = ADC3_OFR1_OFFSET1_CH_Values<ADC3::OFR1, 26, 5, ReadWriteMode, ADC3OFR1Base> ;
     using OFFSET1 = ADC3_OFR1_OFFSET1_Values<ADC3::OFR1, 0, 12, ReadWriteMode, ADC3OFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC3_OFR1_OFFSET1_Values<ADC3::OFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -287,6 +304,7 @@ struct ADC3
     using OFFSET2_EN = ADC3_OFR2_OFFSET2_EN_Values<ADC3::OFR2, 31, 1, ReadWriteMode, ADC3OFR2Base> ;
     using OFFSET2_CH = ADC3_OFR2_OFFSET2_CH_Values<ADC3::OFR2, 26, 5, ReadWriteMode, ADC3OFR2Base> ;
     using OFFSET2 = ADC3_OFR2_OFFSET2_Values<ADC3::OFR2, 0, 12, ReadWriteMode, ADC3OFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC3_OFR2_OFFSET2_Values<ADC3::OFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -300,6 +318,7 @@ struct ADC3
     using OFFSET3_EN = ADC3_OFR3_OFFSET3_EN_Values<ADC3::OFR3, 31, 1, ReadWriteMode, ADC3OFR3Base> ;
     using OFFSET3_CH = ADC3_OFR3_OFFSET3_CH_Values<ADC3::OFR3, 26, 5, ReadWriteMode, ADC3OFR3Base> ;
     using OFFSET3 = ADC3_OFR3_OFFSET3_Values<ADC3::OFR3, 0, 12, ReadWriteMode, ADC3OFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC3_OFR3_OFFSET3_Values<ADC3::OFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -313,6 +332,7 @@ struct ADC3
     using OFFSET4_EN = ADC3_OFR4_OFFSET4_EN_Values<ADC3::OFR4, 31, 1, ReadWriteMode, ADC3OFR4Base> ;
     using OFFSET4_CH = ADC3_OFR4_OFFSET4_CH_Values<ADC3::OFR4, 26, 5, ReadWriteMode, ADC3OFR4Base> ;
     using OFFSET4 = ADC3_OFR4_OFFSET4_Values<ADC3::OFR4, 0, 12, ReadWriteMode, ADC3OFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC3_OFR4_OFFSET4_Values<ADC3::OFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -368,6 +388,7 @@ struct ADC3
   struct AWD2CR : public RegisterBase<0x500004A0, 32, ReadWriteMode>
   {
     using AWD2CH = ADC3_AWD2CR_AWD2CH_Values<ADC3::AWD2CR, 1, 18, ReadWriteMode, ADC3AWD2CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC3_AWD2CR_AWD2CH_Values<ADC3::AWD2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +400,7 @@ struct ADC3
   struct AWD3CR : public RegisterBase<0x500004A4, 32, ReadWriteMode>
   {
     using AWD3CH = ADC3_AWD3CR_AWD3CH_Values<ADC3::AWD3CR, 1, 18, ReadWriteMode, ADC3AWD3CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC3_AWD3CR_AWD3CH_Values<ADC3::AWD3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -391,6 +413,7 @@ struct ADC3
   {
     using DIFSEL_1_15 = ADC3_DIFSEL_DIFSEL_1_15_Values<ADC3::DIFSEL, 1, 15, ReadWriteMode, ADC3DIFSELBase> ;
     using DIFSEL_16_18 = ADC3_DIFSEL_DIFSEL_16_18_Values<ADC3::DIFSEL, 16, 3, ReadMode, ADC3DIFSELBase> ;
+    static constexpr Type SnapshotMask = 0xFFFEU ;
     using FieldValues = ADC3_DIFSEL_DIFSEL_16_18_Values<ADC3::DIFSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -403,12 +426,14 @@ struct ADC3
   {
     using CALFACT_D = ADC3_CALFACT_CALFACT_D_Values<ADC3::CALFACT, 16, 7, ReadWriteMode, ADC3CALFACTBase> ;
     using CALFACT_S = ADC3_CALFACT_CALFACT_S_Values<ADC3::CALFACT, 0, 7, ReadWriteMode, ADC3CALFACTBase> ;
+    static constexpr Type SnapshotMask = 0x7F007FU ;
     using FieldValues = ADC3_CALFACT_CALFACT_S_Values<ADC3::CALFACT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALFACTPack  = Register<0x500004B4, 32, ReadWriteMode, ADC3CALFACTBase, T...> ;
 
+  using Registers = TypesList<ADC3::ISR, ADC3::IER, ADC3::CR, ADC3::CFGR, ADC3::SMPR1, ADC3::SMPR2, ADC3::TR1, ADC3::TR2, ADC3::TR3, ADC3::SQR1, ADC3::SQR2, ADC3::SQR3, ADC3::SQR4, ADC3::DR, ADC3::JSQR, ADC3::OFR1, ADC3::OFR2, ADC3::OFR3, ADC3::OFR4, ADC3::JDR1, ADC3::JDR2, ADC3::JDR3, ADC3::JDR4, ADC3::AWD2CR, ADC3::AWD3CR, ADC3::DIFSEL, ADC3::CALFACT> ;
 } ;
 
 #endif //#if !defined(ADC3REGISTERS_HPP)
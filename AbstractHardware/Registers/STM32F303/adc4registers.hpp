@@ -32,6 +32,9 @@ struct ADC4
     using EOC = ADC4_ISR_EOC_Values<ADC4::ISR, 2, 1, ReadWriteMode, ADC4ISRBase> ;
     using EOSMP = ADC4_ISR_EOSMP_Values<ADC4::ISR, 1, 1, ReadWriteMode, ADC4ISRBase> ;
     using ADRDY = ADC4_ISR_ADRDY_Values<ADC4::ISR, 0, 1, ReadWriteMode, ADC4ISRBase> ;
+    static constexpr Type WritableMask = 0x7FFU ;
+    static constexpr Type OneToClearMask = 0x7FFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC4_ISR_ADRDY_Values<ADC4::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +56,7 @@ struct ADC4
     using EOCIE = ADC4_IER_EOCIE_Values<ADC4::IER, 2, 1, ReadWriteMode, ADC4IERBase> ;
     using EOSMPIE = ADC4_IER_EOSMPIE_Values<ADC4::IER, 1, 1, ReadWriteMode, ADC4IERBase> ;
     using ADRDYIE = ADC4_IER_ADRDYIE_Values<ADC4::IER, 0, 1, ReadWriteMode, ADC4IERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = ADC4_IER_ADRDYIE_Values<ADC4::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,7 @@ struct ADC4
     using ADSTART = ADC4_CR_ADSTART_Values<ADC4::CR, 2, 1, ReadWriteMode, ADC4CRBase> ;
     using ADDIS = ADC4_CR_ADDIS_Values<ADC4::CR, 1, 1, ReadWriteMode, ADC4CRBase> ;
     using ADEN = ADC4_CR_ADEN_Values<ADC4::CR, 0, 1, ReadWriteMode, ADC4CRBase> ;
+    static constexpr Type SnapshotMask = 0xF000003FU ;
     using FieldValues = ADC4_CR_ADEN_Values<ADC4::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,7 @@ struct ADC4
     using RES = ADC4_CFGR_RES_Values<ADC4::CFGR, 3, 2, ReadWriteMode, ADC4CFGRBase> ;
     using DMACFG = ADC4_CFGR_DMACFG_Values<ADC4::CFGR, 1, 1, ReadWriteMode, ADC4CFGRBase> ;
     using DMAEN = ADC4_CFGR_DMAEN_Values<ADC4::CFGR, 0, 1, ReadWriteMode, ADC4CFGRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFBU ;
     using FieldValues = ADC4_CFGR_DMAEN_Values<ADC4::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +127,7 @@ struct ADC4
     using SMP3 = ADC4_SMPR1_SMP3_Values<ADC4::SMPR1, 9, 3, ReadWriteMode, ADC4SMPR1Base> ;
     using SMP2 = ADC4_SMPR1_SMP2_Values<ADC4::SMPR1, 6, 3, ReadWriteMode, ADC4SMPR1Base> ;
     using SMP1 = ADC4_SMPR1_SMP1_Values<ADC4::SMPR1, 3, 3, ReadWriteMode, ADC4SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFF8U ;
     using FieldValues = ADC4_SMPR1_SMP1_Values<ADC4::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +147,7 @@ struct ADC4
     using SMP12 = ADC4_SMPR2_SMP12_Values<ADC4::SMPR2, 6, 3, ReadWriteMode, ADC4SMPR2Base> ;
     using SMP11 = ADC4_SMPR2_SMP11_Values<ADC4::SMPR2, 3, 3, ReadWriteMode, ADC4SMPR2Base> ;
     using SMP10 = ADC4_SMPR2_SMP10_Values<ADC4::SMPR2, 0, 3, ReadWriteMode, ADC4SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = ADC4_SMPR2_SMP10_Values<ADC4::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +160,7 @@ struct ADC4
   {
     using HT1 = ADC4_TR1_HT1_Values<ADC4::TR1, 16, 12, ReadWriteMode, ADC4TR1Base> ;
     using LT1 = ADC4_TR1_LT1_Values<ADC4::TR1, 0, 12, ReadWriteMode, ADC4TR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = ADC4_TR1_LT1_Values<ADC4::TR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +173,7 @@ struct ADC4
   {
     using HT2 = ADC4_TR2_HT2_Values<ADC4::TR2, 16, 8, ReadWriteMode, ADC4TR2Base> ;
     using LT2 = ADC4_TR2_LT2_Values<ADC4::TR2, 0, 8, ReadWriteMode, ADC4TR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC4_TR2_LT2_Values<ADC4::TR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +186,7 @@ struct ADC4
   {
     using HT3 = ADC4_TR3_HT3_Values<ADC4::TR3, 16, 8, ReadWriteMode, ADC4TR3Base> ;
     using LT3 = ADC4_TR3_LT3_Values<ADC4::TR3, 0, 8, ReadWriteMode, ADC4TR3Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC4_TR3_LT3_Values<ADC4::TR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +202,7 @@ struct ADC4
     using SQ2 = ADC4_SQR1_SQ2_Values<ADC4::SQR1, 12, 5, ReadWriteMode, ADC4SQR1Base> ;
     using SQ1 = ADC4_SQR1_SQ1_Values<ADC4::SQR1, 6, 5, ReadWriteMode, ADC4SQR1Base> ;
     using L3 = ADC4_SQR1_L3_Values<ADC4::SQR1, 0, 4, ReadWriteMode, ADC4SQR1Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7CFU ;
     using FieldValues = ADC4_SQR1_L3_Values<ADC4::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +218,7 @@ struct ADC4
     using SQ7 = ADC4_SQR2_SQ7_Values<ADC4::SQR2, 12, 5, ReadWriteMode, ADC4SQR2Base> ;
     using SQ6 = ADC4_SQR2_SQ6_Values<ADC4::SQR2, 6, 5, ReadWriteMode, ADC4SQR2Base> ;
     using SQ5 = ADC4_SQR2_SQ5_Values<ADC4::SQR2, 0, 5, ReadWriteMode, ADC4SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC4_SQR2_SQ5_Values<ADC4::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -221,6 +234,7 @@ struct ADC4
     using SQ12 = ADC4_SQR3_SQ12_Values<ADC4::SQR3, 12, 5, ReadWriteMode, ADC4SQR3Base> ;
     using SQ11 = ADC4_SQR3_SQ11_Values<ADC4::SQR3, 6, 5, ReadWriteMode, ADC4SQR3Base> ;
     using SQ10 = ADC4_SQR3_SQ10_Values<ADC4::SQR3, 0, 5, ReadWriteMode, ADC4SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC4_SQR3_SQ10_Values<ADC4::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +247,7 @@ struct ADC4
   {
     using SQ16 = ADC4_SQR4_SQ16_Values<ADC4::SQR4, 6, 5, ReadWriteMode, ADC4SQR4Base> ;
     using SQ15 = ADC4_SQR4_SQ15_Values<ADC4::SQR4, 0, 5, ReadWriteMode, ADC4SQR4Base> ;
+    static constexpr Type SnapshotMask = 0x7DFU ;
     using FieldValues = ADC4_SQR4_SQ15_Values<ADC4::SQR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -261,6 +276,7 @@ struct ADC4
     using JEXTEN = ADC4_JSQR_JEXTEN_Values<ADC4::JSQR, 6, 2, ReadWriteMode, ADC4JSQRBase> ;
     using JEXTSEL = ADC4_JSQR_JEXTSEL_Values<ADC4::JSQR, 2, 4, ReadWriteMode, ADC4JSQRBase> ;
     using JL = ADC4_JSQR_JL_Values<ADC4::JSQR, 0, 2, ReadWriteMode, ADC4JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x7DF7DFFFU ;
     using FieldValues = ADC4_JSQR_JL_Values<ADC4::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +290,7 @@ struct ADC4
     using OFFSET1_EN = ADC4_OFR1_OFFSET1_EN_Values<ADC4::OFR1, 31, 1, ReadWriteMode, ADC4OFR1Base> ;
     using OFFSET1_CH = ADC4_OFR1_OFFSET1_CH_Values<ADC4::OFR1, 26, 5, ReadWriteMode, ADC4OFR1Base> ;
     using OFFSET1 = ADC4_OFR1_OFFSET1_Values<ADC4::OFR1, 0, 12, ReadWriteMode, ADC4OFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC4_OFR1_OFFSET1_Values<ADC4::OFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -287,6 +304,7 @@ struct ADC4
     using OFFSET2_EN = ADC4_OFR2_OFFSET2_EN_Values<ADC4::OFR2, 31, 1, ReadWriteMode, ADC4OFR2Base> ;
     using OFFSET2_CH = ADC4_OFR2_OFFSET2_CH_Values<ADC4::OFR2, 26, 5, ReadWriteMode, ADC4OFR2Base> ;
     using OFFSET2 = ADC4_OFR2_OFFSET2_Values<ADC4::OFR2, 0, 12, ReadWriteMode, ADC4OFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC4_OFR2_OFFSET2_Values<ADC4::OFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -300,6 +318,7 @@ struct ADC4
     using OFFSET3_EN = ADC4_OFR3_OFFSET3_EN_Values<ADC4::OFR3, 31, 1, ReadWriteMode, ADC4OFR3Base> ;
     using OFFSET3_CH = ADC4_OFR3_OFFSET3_CH_Values<ADC4::OFR3, 26, 5, ReadWriteMode, ADC4OFR3Base> ;
     using OFFSET3 = ADC4_OFR3_OFFSET3_Values<ADC4::OFR3, 0, 12, ReadWriteMode, ADC4OFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC4_OFR3_OFFSET3_Values<ADC4::OFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -313,6 +332,7 @@ struct ADC4
     using OFFSET4_EN = ADC4_OFR4_OFFSET4_EN_Values<ADC4::OFR4, 31, 1, ReadWriteMode, ADC4OFR4Base> ;
     using OFFSET4_CH = ADC4_OFR4_OFFSET4_CH_Values<ADC4::OFR4, 26, 5, ReadWriteMode, ADC4OFR4Base> ;
     using OFFSET4 = ADC4_OFR4_OFFSET4_Values<ADC4::OFR4, 0, 12, ReadWriteMode, ADC4OFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC4_OFR4_OFFSET4_Values<ADC4::OFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -368,6 +388,7 @@ struct ADC4
   struct AWD2CR : public RegisterBase<0x500005A0, 32, ReadWriteMode>
   {
     using AWD2CH = ADC4_AWD2CR_AWD2CH_Values<ADC4::AWD2CR, 1, 18, ReadWriteMode, ADC4AWD2CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC4_AWD2CR_AWD2CH_Values<ADC4::AWD2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +400,7 @@ struct ADC4
   struct AWD3CR : public RegisterBase<0x500005A4, 32, ReadWriteMode>
   {
     using AWD3CH = ADC4_AWD3CR_AWD3CH_Values<ADC4::AWD3CR, 1, 18, ReadWriteMode, ADC4AWD3CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC4_AWD3CR_AWD3CH_Values<ADC4::AWD3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -391,6 +413,7 @@ struct ADC4
   {
     using DIFSEL_1_15 = ADC4_DIFSEL_DIFSEL_1_15_Values<ADC4::DIFSEL, 1, 15, ReadWriteMode, ADC4DIFSELBase> ;
     using DIFSEL_16_18 = ADC4_DIFSEL_DIFSEL_16_18_Values<ADC4::DIFSEL, 16, 3, ReadMode, ADC4DIFSELBase> ;
+    static constexpr Type SnapshotMask = 0xFFFEU ;
     using FieldValues = ADC4_DIFSEL_DIFSEL_16_18_Values<ADC4::DIFSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -403,12 +426,14 @@ struct ADC4
   {
     using CALFACT_D = ADC4_CALFACT_CALFACT_D_Values<ADC4::CALFACT, 16, 7, ReadWriteMode, ADC4CALFACTBase> ;
     using CALFACT_S = ADC4_CALFACT_CALFACT_S_Values<ADC4::CALFACT, 0, 7, ReadWriteMode, ADC4CALFACTBase> ;
+    static constexpr Type SnapshotMask = 0x7F007FU ;
     using FieldValues = ADC4_CALFACT_CALFACT_S_Values<ADC4::CALFACT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALFACTPack  = Register<0x500005B4, 32, ReadWriteMode, ADC4CALFACTBase, T...> ;
 
+  using Registers = TypesList<ADC4::ISR, ADC4::IER, ADC4::CR, ADC4::CFGR, ADC4::SMPR1, ADC4::SMPR2, ADC4::TR1, ADC4::TR2, ADC4::TR3, ADC4::SQR1, ADC4::SQR2, ADC4::SQR3, ADC4::SQR4, ADC4::DR, ADC4::JSQR, ADC4::OFR1, ADC4::OFR2, ADC4::OFR3, ADC4::OFR4, ADC4::JDR1, ADC4::JDR2, ADC4::JDR3, ADC4::JDR4, ADC4::AWD2CR, ADC4::AWD3CR, ADC4::DIFSEL, ADC4::CALFACT> ;
 } ;
 
 #endif //#if !defined(ADC4REGISTERS_HPP)
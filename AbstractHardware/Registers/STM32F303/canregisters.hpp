@@ -31,6 +31,7 @@ struct CAN
     using TXFP = CAN_MCR_TXFP_Values<CAN::MCR, 2, 1, ReadWriteMode, CANMCRBase> ;
     using SLEEP = CAN_MCR_SLEEP_Values<CAN::MCR, 1, 1, ReadWriteMode, CANMCRBase> ;
     using INRQ = CAN_MCR_INRQ_Values<CAN::MCR, 0, 1, ReadWriteMode, CANMCRBase> ;
+    static constexpr Type SnapshotMask = 0x180FFU ;
     using FieldValues = CAN_MCR_INRQ_Values<CAN::MCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +51,7 @@ struct CAN
     using ERRI = CAN_MSR_ERRI_Values<CAN::MSR, 2, 1, ReadWriteMode, CANMSRBase> ;
     using SLAK = CAN_MSR_SLAK_Values<CAN::MSR, 1, 1, ReadMode, CANMSRBase> ;
     using INAK = CAN_MSR_INAK_Values<CAN::MSR, 0, 1, ReadMode, CANMSRBase> ;
+    static constexpr Type SnapshotMask = 0x1CU ;
     using FieldValues = CAN_MSR_INAK_Values<CAN::MSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +84,7 @@ struct CAN
     using ALST0 = CAN_TSR_ALST0_Values<CAN::TSR, 2, 1, ReadWriteMode, CANTSRBase> ;
     using TXOK0 = CAN_TSR_TXOK0_Values<CAN::TSR, 1, 1, ReadWriteMode, CANTSRBase> ;
     using RQCP0 = CAN_TSR_RQCP0_Values<CAN::TSR, 0, 1, ReadWriteMode, CANTSRBase> ;
+    static constexpr Type SnapshotMask = 0x8F8F8FU ;
     using FieldValues = CAN_TSR_RQCP0_Values<CAN::TSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +99,7 @@ struct CAN
     using FOVR0 = CAN_RF0R_FOVR0_Values<CAN::RF0R, 4, 1, ReadWriteMode, CANRF0RBase> ;
     using FULL0 = CAN_RF0R_FULL0_Values<CAN::RF0R, 3, 1, ReadWriteMode, CANRF0RBase> ;
     using FMP0 = CAN_RF0R_FMP0_Values<CAN::RF0R, 0, 2, ReadMode, CANRF0RBase> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN_RF0R_FMP0_Values<CAN::RF0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +114,7 @@ struct CAN
     using FOVR1 = CAN_RF1R_FOVR1_Values<CAN::RF1R, 4, 1, ReadWriteMode, CANRF1RBase> ;
     using FULL1 = CAN_RF1R_FULL1_Values<CAN::RF1R, 3, 1, ReadWriteMode, CANRF1RBase> ;
     using FMP1 = CAN_RF1R_FMP1_Values<CAN::RF1R, 0, 2, ReadMode, CANRF1RBase> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN_RF1R_FMP1_Values<CAN::RF1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +139,7 @@ struct CAN
     using FFIE0 = CAN_IER_FFIE0_Values<CAN::IER, 2, 1, ReadWriteMode, CANIERBase> ;
     using FMPIE0 = CAN_IER_FMPIE0_Values<CAN::IER, 1, 1, ReadWriteMode, CANIERBase> ;
     using TMEIE = CAN_IER_TMEIE_Values<CAN::IER, 0, 1, ReadWriteMode, CANIERBase> ;
+    static constexpr Type SnapshotMask = 0x38F7FU ;
     using FieldValues = CAN_IER_TMEIE_Values<CAN::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +156,7 @@ struct CAN
     using BOFF = CAN_ESR_BOFF_Values<CAN::ESR, 2, 1, ReadMode, CANESRBase> ;
     using EPVF = CAN_ESR_EPVF_Values<CAN::ESR, 1, 1, ReadMode, CANESRBase> ;
     using EWGF = CAN_ESR_EWGF_Values<CAN::ESR, 0, 1, ReadMode, CANESRBase> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = CAN_ESR_EWGF_Values<CAN::ESR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +173,7 @@ struct CAN
     using TS2 = CAN_BTR_TS2_Values<CAN::BTR, 20, 3, ReadWriteMode, CANBTRBase> ;
     using TS1 = CAN_BTR_TS1_Values<CAN::BTR, 16, 4, ReadWriteMode, CANBTRBase> ;
     using BRP = CAN_BTR_BRP_Values<CAN::BTR, 0, 10, ReadWriteMode, CANBTRBase> ;
+    static constexpr Type SnapshotMask = 0xC37F03FFU ;
     using FieldValues = CAN_BTR_BRP_Values<CAN::BTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +189,7 @@ struct CAN
     using IDE = CAN_TI0R_IDE_Values<CAN::TI0R, 2, 1, ReadWriteMode, CANTI0RBase> ;
     using RTR = CAN_TI0R_RTR_Values<CAN::TI0R, 1, 1, ReadWriteMode, CANTI0RBase> ;
     using TXRQ = CAN_TI0R_TXRQ_Values<CAN::TI0R, 0, 1, ReadWriteMode, CANTI0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TI0R_TXRQ_Values<CAN::TI0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -194,6 +203,7 @@ struct CAN
     using TIME = CAN_TDT0R_TIME_Values<CAN::TDT0R, 16, 16, ReadWriteMode, CANTDT0RBase> ;
     using TGT = CAN_TDT0R_TGT_Values<CAN::TDT0R, 8, 1, ReadWriteMode, CANTDT0RBase> ;
     using DLC = CAN_TDT0R_DLC_Values<CAN::TDT0R, 0, 4, ReadWriteMode, CANTDT0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN_TDT0R_DLC_Values<CAN::TDT0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +218,7 @@ struct CAN
     using DATA2 = CAN_TDL0R_DATA2_Values<CAN::TDL0R, 16, 8, ReadWriteMode, CANTDL0RBase> ;
     using DATA1 = CAN_TDL0R_DATA1_Values<CAN::TDL0R, 8, 8, ReadWriteMode, CANTDL0RBase> ;
     using DATA0 = CAN_TDL0R_DATA0_Values<CAN::TDL0R, 0, 8, ReadWriteMode, CANTDL0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TDL0R_DATA0_Values<CAN::TDL0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +233,7 @@ struct CAN
     using DATA6 = CAN_TDH0R_DATA6_Values<CAN::TDH0R, 16, 8, ReadWriteMode, CANTDH0RBase> ;
     using DATA5 = CAN_TDH0R_DATA5_Values<CAN::TDH0R, 8, 8, ReadWriteMode, CANTDH0RBase> ;
     using DATA4 = CAN_TDH0R_DATA4_Values<CAN::TDH0R, 0, 8, ReadWriteMode, CANTDH0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TDH0R_DATA4_Values<CAN::TDH0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +249,7 @@ struct CAN
     using IDE = CAN_TI1R_IDE_Values<CAN::TI1R, 2, 1, ReadWriteMode, CANTI1RBase> ;
     using RTR = CAN_TI1R_RTR_Values<CAN::TI1R, 1, 1, ReadWriteMode, CANTI1RBase> ;
     using TXRQ = CAN_TI1R_TXRQ_Values<CAN::TI1R, 0, 1, ReadWriteMode, CANTI1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TI1R_TXRQ_Values<CAN::TI1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -250,6 +263,7 @@ struct CAN
     using TIME = CAN_TDT1R_TIME_Values<CAN::TDT1R, 16, 16, ReadWriteMode, CANTDT1RBase> ;
     using TGT = CAN_TDT1R_TGT_Values<CAN::TDT1R, 8, 1, ReadWriteMode, CANTDT1RBase> ;
     using DLC = CAN_TDT1R_DLC_Values<CAN::TDT1R, 0, 4, ReadWriteMode, CANTDT1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN_TDT1R_DLC_Values<CAN::TDT1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +278,7 @@ struct CAN
     using DATA2 = CAN_TDL1R_DATA2_Values<CAN::TDL1R, 16, 8, ReadWriteMode, CANTDL1RBase> ;
     using DATA1 = CAN_TDL1R_DATA1_Values<CAN::TDL1R, 8, 8, ReadWriteMode, CANTDL1RBase> ;
     using DATA0 = CAN_TDL1R_DATA0_Values<CAN::TDL1R, 0, 8, ReadWriteMode, CANTDL1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TDL1R_DATA0_Values<CAN::TDL1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +293,7 @@ struct CAN
     using DATA6 = CAN_TDH1R_DATA6_Values<CAN::TDH1R, 16, 8, ReadWriteMode, CANTDH1RBase> ;
     using DATA5 = CAN_TDH1R_DATA5_Values<CAN::TDH1R, 8, 8, ReadWriteMode, CANTDH1RBase> ;
     using DATA4 = CAN_TDH1R_DATA4_Values<CAN::TDH1R, 0, 8, ReadWriteMode, CANTDH1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TDH1R_DATA4_Values<CAN::TDH1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct CAN
     using IDE = CAN_TI2R_IDE_Values<CAN::TI2R, 2, 1, ReadWriteMode, CANTI2RBase> ;
     using RTR = CAN_TI2R_RTR_Values<CAN::TI2R, 1, 1, ReadWriteMode, CANTI2RBase> ;
     using TXRQ = CAN_TI2R_TXRQ_Values<CAN::TI2R, 0, 1, ReadWriteMode, CANTI2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TI2R_TXRQ_Values<CAN::TI2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +323,7 @@ struct CAN
     using TIME = CAN_TDT2R_TIME_Values<CAN::TDT2R, 16, 16, ReadWriteMode, CANTDT2RBase> ;
     using TGT = CAN_TDT2R_TGT_Values<CAN::TDT2R, 8, 1, ReadWriteMode, CANTDT2RBase> ;
     using DLC = CAN_TDT2R_DLC_Values<CAN::TDT2R, 0, 4, ReadWriteMode, CANTDT2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN_TDT2R_DLC_Values<CAN::TDT2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -320,6 +338,7 @@ struct CAN
     using DATA2 = CAN_TDL2R_DATA2_Values<CAN::TDL2R, 16, 8, ReadWriteMode, CANTDL2RBase> ;
     using DATA1 = CAN_TDL2R_DATA1_Values<CAN::TDL2R, 8, 8, ReadWriteMode, CANTDL2RBase> ;
     using DATA0 = CAN_TDL2R_DATA0_Values<CAN::TDL2R, 0, 8, ReadWriteMode, CANTDL2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TDL2R_DATA0_Values<CAN::TDL2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -334,6 +353,7 @@ struct CAN
     using DATA6 = CAN_TDH2R_DATA6_Values<CAN::TDH2R, 16, 8, ReadWriteMode, CANTDH2RBase> ;
     using DATA5 = CAN_TDH2R_DATA5_Values<CAN::TDH2R, 8, 8, ReadWriteMode, CANTDH2RBase> ;
     using DATA4 = CAN_TDH2R_DATA4_Values<CAN::TDH2R, 0, 8, ReadWriteMode, CANTDH2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_TDH2R_DATA4_Values<CAN::TDH2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -456,6 +476,7 @@ struct CAN
   {
     using CAN2SB = CAN_FMR_CAN2SB_Values<CAN::FMR, 8, 6, ReadWriteMode, CANFMRBase> ;
     using FINIT = CAN_FMR_FINIT_Values<CAN::FMR, 0, 1, ReadWriteMode, CANFMRBase> ;
+    static constexpr Type SnapshotMask = 0x3F01U ;
     using FieldValues = CAN_FMR_FINIT_Values<CAN::FMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -494,6 +515,7 @@ struct CAN
     using FBM25 = CAN_FM1R_FBM25_Values<CAN::FM1R, 25, 1, ReadWriteMode, CANFM1RBase> ;
     using FBM26 = CAN_FM1R_FBM26_Values<CAN::FM1R, 26, 1, ReadWriteMode, CANFM1RBase> ;
     using FBM27 = CAN_FM1R_FBM27_Values<CAN::FM1R, 27, 1, ReadWriteMode, CANFM1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN_FM1R_FBM27_Values<CAN::FM1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -532,6 +554,7 @@ struct CAN
     using FSC25 = CAN_FS1R_FSC25_Values<CAN::FS1R, 25, 1, ReadWriteMode, CANFS1RBase> ;
     using FSC26 = CAN_FS1R_FSC26_Values<CAN::FS1R, 26, 1, ReadWriteMode, CANFS1RBase> ;
     using FSC27 = CAN_FS1R_FSC27_Values<CAN::FS1R, 27, 1, ReadWriteMode, CANFS1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN_FS1R_FSC27_Values<CAN::FS1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -570,6 +593,7 @@ struct CAN
     using FFA25 = CAN_FFA1R_FFA25_Values<CAN::FFA1R, 25, 1, ReadWriteMode, CANFFA1RBase> ;
     using FFA26 = CAN_FFA1R_FFA26_Values<CAN::FFA1R, 26, 1, ReadWriteMode, CANFFA1RBase> ;
     using FFA27 = CAN_FFA1R_FFA27_Values<CAN::FFA1R, 27, 1, ReadWriteMode, CANFFA1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN_FFA1R_FFA27_Values<CAN::FFA1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +632,7 @@ struct CAN
     using FACT25 = CAN_FA1R_FACT25_Values<CAN::FA1R, 25, 1, ReadWriteMode, CANFA1RBase> ;
     using FACT26 = CAN_FA1R_FACT26_Values<CAN::FA1R, 26, 1, ReadWriteMode, CANFA1RBase> ;
     using FACT27 = CAN_FA1R_FACT27_Values<CAN::FA1R, 27, 1, ReadWriteMode, CANFA1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN_FA1R_FACT27_Values<CAN::FA1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -650,6 +675,7 @@ struct CAN
     using FB29 = CAN_F0R1_FB29_Values<CAN::F0R1, 29, 1, ReadWriteMode, CANF0R1Base> ;
     using FB30 = CAN_F0R1_FB30_Values<CAN::F0R1, 30, 1, ReadWriteMode, CANF0R1Base> ;
     using FB31 = CAN_F0R1_FB31_Values<CAN::F0R1, 31, 1, ReadWriteMode, CANF0R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F0R1_FB31_Values<CAN::F0R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -692,6 +718,7 @@ struct CAN
     using FB29 = CAN_F0R2_FB29_Values<CAN::F0R2, 29, 1, ReadWriteMode, CANF0R2Base> ;
     using FB30 = CAN_F0R2_FB30_Values<CAN::F0R2, 30, 1, ReadWriteMode, CANF0R2Base> ;
     using FB31 = CAN_F0R2_FB31_Values<CAN::F0R2, 31, 1, ReadWriteMode, CANF0R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F0R2_FB31_Values<CAN::F0R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -734,6 +761,7 @@ struct CAN
     using FB29 = CAN_F1R1_FB29_Values<CAN::F1R1, 29, 1, ReadWriteMode, CANF1R1Base> ;
     using FB30 = CAN_F1R1_FB30_Values<CAN::F1R1, 30, 1, ReadWriteMode, CANF1R1Base> ;
     using FB31 = CAN_F1R1_FB31_Values<CAN::F1R1, 31, 1, ReadWriteMode, CANF1R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F1R1_FB31_Values<CAN::F1R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +804,7 @@ struct CAN
     using FB29 = CAN_F1R2_FB29_Values<CAN::F1R2, 29, 1, ReadWriteMode, CANF1R2Base> ;
     using FB30 = CAN_F1R2_FB30_Values<CAN::F1R2, 30, 1, ReadWriteMode, CANF1R2Base> ;
     using FB31 = CAN_F1R2_FB31_Values<CAN::F1R2, 31, 1, ReadWriteMode, CANF1R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F1R2_FB31_Values<CAN::F1R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -818,6 +847,7 @@ struct CAN
     using FB29 = CAN_F2R1_FB29_Values<CAN::F2R1, 29, 1, ReadWriteMode, CANF2R1Base> ;
     using FB30 = CAN_F2R1_FB30_Values<CAN::F2R1, 30, 1, ReadWriteMode, CANF2R1Base> ;
     using FB31 = CAN_F2R1_FB31_Values<CAN::F2R1, 31, 1, ReadWriteMode, CANF2R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F2R1_FB31_Values<CAN::F2R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -860,6 +890,7 @@ struct CAN
     using FB29 = CAN_F2R2_FB29_Values<CAN::F2R2, 29, 1, ReadWriteMode, CANF2R2Base> ;
     using FB30 = CAN_F2R2_FB30_Values<CAN::F2R2, 30, 1, ReadWriteMode, CANF2R2Base> ;
     using FB31 = CAN_F2R2_FB31_Values<CAN::F2R2, 31, 1, ReadWriteMode, CANF2R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F2R2_FB31_Values<CAN::F2R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -902,6 +933,7 @@ struct CAN
     using FB29 = CAN_F3R1_FB29_Values<CAN::F3R1, 29, 1, ReadWriteMode, CANF3R1Base> ;
     using FB30 = CAN_F3R1_FB30_Values<CAN::F3R1, 30, 1, ReadWriteMode, CANF3R1Base> ;
     using FB31 = CAN_F3R1_FB31_Values<CAN::F3R1, 31, 1, ReadWriteMode, CANF3R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F3R1_FB31_Values<CAN::F3R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -944,6 +976,7 @@ struct CAN
     using FB29 = CAN_F3R2_FB29_Values<CAN::F3R2, 29, 1, ReadWriteMode, CANF3R2Base> ;
     using FB30 = CAN_F3R2_FB30_Values<CAN::F3R2, 30, 1, ReadWriteMode, CANF3R2Base> ;
     using FB31 = CAN_F3R2_FB31_Values<CAN::F3R2, 31, 1, ReadWriteMode, CANF3R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F3R2_FB31_Values<CAN::F3R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -986,6 +1019,7 @@ struct CAN
     using FB29 = CAN_F4R1_FB29_Values<CAN::F4R1, 29, 1, ReadWriteMode, CANF4R1Base> ;
     using FB30 = CAN_F4R1_FB30_Values<CAN::F4R1, 30, 1, ReadWriteMode, CANF4R1Base> ;
     using FB31 = CAN_F4R1_FB31_Values<CAN::F4R1, 31, 1, ReadWriteMode, CANF4R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F4R1_FB31_Values<CAN::F4R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1028,6 +1062,7 @@ struct CAN
     using FB29 = CAN_F4R2_FB29_Values<CAN::F4R2, 29, 1, ReadWriteMode, CANF4R2Base> ;
     using FB30 = CAN_F4R2_FB30_Values<CAN::F4R2, 30, 1, ReadWriteMode, CANF4R2Base> ;
     using FB31 = CAN_F4R2_FB31_Values<CAN::F4R2, 31, 1, ReadWriteMode, CANF4R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F4R2_FB31_Values<CAN::F4R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1070,6 +1105,7 @@ struct CAN
     using FB29 = CAN_F5R1_FB29_Values<CAN::F5R1, 29, 1, ReadWriteMode, CANF5R1Base> ;
     using FB30 = CAN_F5R1_FB30_Values<CAN::F5R1, 30, 1, ReadWriteMode, CANF5R1Base> ;
     using FB31 = CAN_F5R1_FB31_Values<CAN::F5R1, 31, 1, ReadWriteMode, CANF5R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F5R1_FB31_Values<CAN::F5R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1112,6 +1148,7 @@ struct CAN
     using FB29 = CAN_F5R2_FB29_Values<CAN::F5R2, 29, 1, ReadWriteMode, CANF5R2Base> ;
     using FB30 = CAN_F5R2_FB30_Values<CAN::F5R2, 30, 1, ReadWriteMode, CANF5R2Base> ;
     using FB31 = CAN_F5R2_FB31_Values<CAN::F5R2, 31, 1, ReadWriteMode, CANF5R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F5R2_FB31_Values<CAN::F5R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1154,6 +1191,7 @@ struct CAN
     using FB29 = CAN_F6R1_FB29_Values<CAN::F6R1, 29, 1, ReadWriteMode, CANF6R1Base> ;
     using FB30 = CAN_F6R1_FB30_Values<CAN::F6R1, 30, 1, ReadWriteMode, CANF6R1Base> ;
     using FB31 = CAN_F6R1_FB31_Values<CAN::F6R1, 31, 1, ReadWriteMode, CANF6R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F6R1_FB31_Values<CAN::F6R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1196,6 +1234,7 @@ struct CAN
     using FB29 = CAN_F6R2_FB29_Values<CAN::F6R2, 29, 1, ReadWriteMode, CANF6R2Base> ;
     using FB30 = CAN_F6R2_FB30_Values<CAN::F6R2, 30, 1, ReadWriteMode, CANF6R2Base> ;
     using FB31 = CAN_F6R2_FB31_Values<CAN::F6R2, 31, 1, ReadWriteMode, CANF6R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F6R2_FB31_Values<CAN::F6R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1238,6 +1277,7 @@ struct CAN
     using FB29 = CAN_F7R1_FB29_Values<CAN::F7R1, 29, 1, ReadWriteMode, CANF7R1Base> ;
     using FB30 = CAN_F7R1_FB30_Values<CAN::F7R1, 30, 1, ReadWriteMode, CANF7R1Base> ;
     using FB31 = CAN_F7R1_FB31_Values<CAN::F7R1, 31, 1, ReadWriteMode, CANF7R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F7R1_FB31_Values<CAN::F7R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1280,6 +1320,7 @@ struct CAN
     using FB29 = CAN_F7R2_FB29_Values<CAN::F7R2, 29, 1, ReadWriteMode, CANF7R2Base> ;
     using FB30 = CAN_F7R2_FB30_Values<CAN::F7R2, 30, 1, ReadWriteMode, CANF7R2Base> ;
     using FB31 = CAN_F7R2_FB31_Values<CAN::F7R2, 31, 1, ReadWriteMode, CANF7R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F7R2_FB31_Values<CAN::F7R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1322,6 +1363,7 @@ struct CAN
     using FB29 = CAN_F8R1_FB29_Values<CAN::F8R1, 29, 1, ReadWriteMode, CANF8R1Base> ;
     using FB30 = CAN_F8R1_FB30_Values<CAN::F8R1, 30, 1, ReadWriteMode, CANF8R1Base> ;
     using FB31 = CAN_F8R1_FB31_Values<CAN::F8R1, 31, 1, ReadWriteMode, CANF8R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F8R1_FB31_Values<CAN::F8R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1364,6 +1406,7 @@ struct CAN
     using FB29 = CAN_F8R2_FB29_Values<CAN::F8R2, 29, 1, ReadWriteMode, CANF8R2Base> ;
     using FB30 = CAN_F8R2_FB30_Values<CAN::F8R2, 30, 1, ReadWriteMode, CANF8R2Base> ;
     using FB31 = CAN_F8R2_FB31_Values<CAN::F8R2, 31, 1, ReadWriteMode, CANF8R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F8R2_FB31_Values<CAN::F8R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1406,6 +1449,7 @@ struct CAN
     using FB29 = CAN_F9R1_FB29_Values<CAN::F9R1, 29, 1, ReadWriteMode, CANF9R1Base> ;
     using FB30 = CAN_F9R1_FB30_Values<CAN::F9R1, 30, 1, ReadWriteMode, CANF9R1Base> ;
     using FB31 = CAN_F9R1_FB31_Values<CAN::F9R1, 31, 1, ReadWriteMode, CANF9R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F9R1_FB31_Values<CAN::F9R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1448,6 +1492,7 @@ struct CAN
     using FB29 = CAN_F9R2_FB29_Values<CAN::F9R2, 29, 1, ReadWriteMode, CANF9R2Base> ;
     using FB30 = CAN_F9R2_FB30_Values<CAN::F9R2, 30, 1, ReadWriteMode, CANF9R2Base> ;
     using FB31 = CAN_F9R2_FB31_Values<CAN::F9R2, 31, 1, ReadWriteMode, CANF9R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F9R2_FB31_Values<CAN::F9R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1490,6 +1535,7 @@ struct CAN
     using FB29 = CAN_F10R1_FB29_Values<CAN::F10R1, 29, 1, ReadWriteMode, CANF10R1Base> ;
     using FB30 = CAN_F10R1_FB30_Values<CAN::F10R1, 30, 1, ReadWriteMode, CANF10R1Base> ;
     using FB31 = CAN_F10R1_FB31_Values<CAN::F10R1, 31, 1, ReadWriteMode, CANF10R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F10R1_FB31_Values<CAN::F10R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1532,6 +1578,7 @@ struct CAN
     using FB29 = CAN_F10R2_FB29_Values<CAN::F10R2, 29, 1, ReadWriteMode, CANF10R2Base> ;
     using FB30 = CAN_F10R2_FB30_Values<CAN::F10R2, 30, 1, ReadWriteMode, CANF10R2Base> ;
     using FB31 = CAN_F10R2_FB31_Values<CAN::F10R2, 31, 1, ReadWriteMode, CANF10R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F10R2_FB31_Values<CAN::F10R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1574,6 +1621,7 @@ struct CAN
     using FB29 = CAN_F11R1_FB29_Values<CAN::F11R1, 29, 1, ReadWriteMode, CANF11R1Base> ;
     using FB30 = CAN_F11R1_FB30_Values<CAN::F11R1, 30, 1, ReadWriteMode, CANF11R1Base> ;
     using FB31 = CAN_F11R1_FB31_Values<CAN::F11R1, 31, 1, ReadWriteMode, CANF11R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F11R1_FB31_Values<CAN::F11R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1616,6 +1664,7 @@ struct CAN
     using FB29 = CAN_F11R2_FB29_Values<CAN::F11R2, 29, 1, ReadWriteMode, CANF11R2Base> ;
     using FB30 = CAN_F11R2_FB30_Values<CAN::F11R2, 30, 1, ReadWriteMode, CANF11R2Base> ;
     using FB31 = CAN_F11R2_FB31_Values<CAN::F11R2, 31, 1, ReadWriteMode, CANF11R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F11R2_FB31_Values<CAN::F11R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1658,6 +1707,7 @@ struct CAN
     using FB29 = CAN_F12R1_FB29_Values<CAN::F12R1, 29, 1, ReadWriteMode, CANF12R1Base> ;
     using FB30 = CAN_F12R1_FB30_Values<CAN::F12R1, 30, 1, ReadWriteMode, CANF12R1Base> ;
     using FB31 = CAN_F12R1_FB31_Values<CAN::F12R1, 31, 1, ReadWriteMode, CANF12R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F12R1_FB31_Values<CAN::F12R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1700,6 +1750,7 @@ struct CAN
     using FB29 = CAN_F12R2_FB29_Values<CAN::F12R2, 29, 1, ReadWriteMode, CANF12R2Base> ;
     using FB30 = CAN_F12R2_FB30_Values<CAN::F12R2, 30, 1, ReadWriteMode, CANF12R2Base> ;
     using FB31 = CAN_F12R2_FB31_Values<CAN::F12R2, 31, 1, ReadWriteMode, CANF12R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F12R2_FB31_Values<CAN::F12R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1742,6 +1793,7 @@ struct CAN
     using FB29 = CAN_F13R1_FB29_Values<CAN::F13R1, 29, 1, ReadWriteMode, CANF13R1Base> ;
     using FB30 = CAN_F13R1_FB30_Values<CAN::F13R1, 30, 1, ReadWriteMode, CANF13R1Base> ;
     using FB31 = CAN_F13R1_FB31_Values<CAN::F13R1, 31, 1, ReadWriteMode, CANF13R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F13R1_FB31_Values<CAN::F13R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1784,6 +1836,7 @@ struct CAN
     using FB29 = CAN_F13R2_FB29_Values<CAN::F13R2, 29, 1, ReadWriteMode, CANF13R2Base> ;
     using FB30 = CAN_F13R2_FB30_Values<CAN::F13R2, 30, 1, ReadWriteMode, CANF13R2Base> ;
     using FB31 = CAN_F13R2_FB31_Values<CAN::F13R2, 31, 1, ReadWriteMode, CANF13R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F13R2_FB31_Values<CAN::F13R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1826,6 +1879,7 @@ struct CAN
     using FB29 = CAN_F14R1_FB29_Values<CAN::F14R1, 29, 1, ReadWriteMode, CANF14R1Base> ;
     using FB30 = CAN_F14R1_FB30_Values<CAN::F14R1, 30, 1, ReadWriteMode, CANF14R1Base> ;
     using FB31 = CAN_F14R1_FB31_Values<CAN::F14R1, 31, 1, ReadWriteMode, CANF14R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F14R1_FB31_Values<CAN::F14R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1868,6 +1922,7 @@ struct CAN
     using FB29 = CAN_F14R2_FB29_Values<CAN::F14R2, 29, 1, ReadWriteMode, CANF14R2Base> ;
     using FB30 = CAN_F14R2_FB30_Values<CAN::F14R2, 30, 1, ReadWriteMode, CANF14R2Base> ;
     using FB31 = CAN_F14R2_FB31_Values<CAN::F14R2, 31, 1, ReadWriteMode, CANF14R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F14R2_FB31_Values<CAN::F14R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1910,6 +1965,7 @@ struct CAN
     using FB29 = CAN_F15R1_FB29_Values<CAN::F15R1, 29, 1, ReadWriteMode, CANF15R1Base> ;
     using FB30 = CAN_F15R1_FB30_Values<CAN::F15R1, 30, 1, ReadWriteMode, CANF15R1Base> ;
     using FB31 = CAN_F15R1_FB31_Values<CAN::F15R1, 31, 1, ReadWriteMode, CANF15R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F15R1_FB31_Values<CAN::F15R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1952,6 +2008,7 @@ struct CAN
     using FB29 = CAN_F15R2_FB29_Values<CAN::F15R2, 29, 1, ReadWriteMode, CANF15R2Base> ;
     using FB30 = CAN_F15R2_FB30_Values<CAN::F15R2, 30, 1, ReadWriteMode, CANF15R2Base> ;
     using FB31 = CAN_F15R2_FB31_Values<CAN::F15R2, 31, 1, ReadWriteMode, CANF15R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F15R2_FB31_Values<CAN::F15R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1994,6 +2051,7 @@ struct CAN
     using FB29 = CAN_F16R1_FB29_Values<CAN::F16R1, 29, 1, ReadWriteMode, CANF16R1Base> ;
     using FB30 = CAN_F16R1_FB30_Values<CAN::F16R1, 30, 1, ReadWriteMode, CANF16R1Base> ;
     using FB31 = CAN_F16R1_FB31_Values<CAN::F16R1, 31, 1, ReadWriteMode, CANF16R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F16R1_FB31_Values<CAN::F16R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2036,6 +2094,7 @@ struct CAN
     using FB29 = CAN_F16R2_FB29_Values<CAN::F16R2, 29, 1, ReadWriteMode, CANF16R2Base> ;
     using FB30 = CAN_F16R2_FB30_Values<CAN::F16R2, 30, 1, ReadWriteMode, CANF16R2Base> ;
     using FB31 = CAN_F16R2_FB31_Values<CAN::F16R2, 31, 1, ReadWriteMode, CANF16R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F16R2_FB31_Values<CAN::F16R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2078,6 +2137,7 @@ struct CAN
     using FB29 = CAN_F17R1_FB29_Values<CAN::F17R1, 29, 1, ReadWriteMode, CANF17R1Base> ;
     using FB30 = CAN_F17R1_FB30_Values<CAN::F17R1, 30, 1, ReadWriteMode, CANF17R1Base> ;
     using FB31 = CAN_F17R1_FB31_Values<CAN::F17R1, 31, 1, ReadWriteMode, CANF17R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F17R1_FB31_Values<CAN::F17R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2120,6 +2180,7 @@ struct CAN
     using FB29 = CAN_F17R2_FB29_Values<CAN::F17R2, 29, 1, ReadWriteMode, CANF17R2Base> ;
     using FB30 = CAN_F17R2_FB30_Values<CAN::F17R2, 30, 1, ReadWriteMode, CANF17R2Base> ;
     using FB31 = CAN_F17R2_FB31_Values<CAN::F17R2, 31, 1, ReadWriteMode, CANF17R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F17R2_FB31_Values<CAN::F17R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2162,6 +2223,7 @@ struct CAN
     using FB29 = CAN_F18R1_FB29_Values<CAN::F18R1, 29, 1, ReadWriteMode, CANF18R1Base> ;
     using FB30 = CAN_F18R1_FB30_Values<CAN::F18R1, 30, 1, ReadWriteMode, CANF18R1Base> ;
     using FB31 = CAN_F18R1_FB31_Values<CAN::F18R1, 31, 1, ReadWriteMode, CANF18R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F18R1_FB31_Values<CAN::F18R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2204,6 +2266,7 @@ struct CAN
     using FB29 = CAN_F18R2_FB29_Values<CAN::F18R2, 29, 1, ReadWriteMode, CANF18R2Base> ;
     using FB30 = CAN_F18R2_FB30_Values<CAN::F18R2, 30, 1, ReadWriteMode, CANF18R2Base> ;
     using FB31 = CAN_F18R2_FB31_Values<CAN::F18R2, 31, 1, ReadWriteMode, CANF18R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F18R2_FB31_Values<CAN::F18R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2246,6 +2309,7 @@ struct CAN
     using FB29 = CAN_F19R1_FB29_Values<CAN::F19R1, 29, 1, ReadWriteMode, CANF19R1Base> ;
     using FB30 = CAN_F19R1_FB30_Values<CAN::F19R1, 30, 1, ReadWriteMode, CANF19R1Base> ;
     using FB31 = CAN_F19R1_FB31_Values<CAN::F19R1, 31, 1, ReadWriteMode, CANF19R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F19R1_FB31_Values<CAN::F19R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2288,6 +2352,7 @@ struct CAN
     using FB29 = CAN_F19R2_FB29_Values<CAN::F19R2, 29, 1, ReadWriteMode, CANF19R2Base> ;
     using FB30 = CAN_F19R2_FB30_Values<CAN::F19R2, 30, 1, ReadWriteMode, CANF19R2Base> ;
     using FB31 = CAN_F19R2_FB31_Values<CAN::F19R2, 31, 1, ReadWriteMode, CANF19R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F19R2_FB31_Values<CAN::F19R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2330,6 +2395,7 @@ struct CAN
     using FB29 = CAN_F20R1_FB29_Values<CAN::F20R1, 29, 1, ReadWriteMode, CANF20R1Base> ;
     using FB30 = CAN_F20R1_FB30_Values<CAN::F20R1, 30, 1, ReadWriteMode, CANF20R1Base> ;
     using FB31 = CAN_F20R1_FB31_Values<CAN::F20R1, 31, 1, ReadWriteMode, CANF20R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F20R1_FB31_Values<CAN::F20R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2372,6 +2438,7 @@ struct CAN
     using FB29 = CAN_F20R2_FB29_Values<CAN::F20R2, 29, 1, ReadWriteMode, CANF20R2Base> ;
     using FB30 = CAN_F20R2_FB30_Values<CAN::F20R2, 30, 1, ReadWriteMode, CANF20R2Base> ;
     using FB31 = CAN_F20R2_FB31_Values<CAN::F20R2, 31, 1, ReadWriteMode, CANF20R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F20R2_FB31_Values<CAN::F20R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2414,6 +2481,7 @@ struct CAN
     using FB29 = CAN_F21R1_FB29_Values<CAN::F21R1, 29, 1, ReadWriteMode, CANF21R1Base> ;
     using FB30 = CAN_F21R1_FB30_Values<CAN::F21R1, 30, 1, ReadWriteMode, CANF21R1Base> ;
     using FB31 = CAN_F21R1_FB31_Values<CAN::F21R1, 31, 1, ReadWriteMode, CANF21R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F21R1_FB31_Values<CAN::F21R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2456,6 +2524,7 @@ struct CAN
     using FB29 = CAN_F21R2_FB29_Values<CAN::F21R2, 29, 1, ReadWriteMode, CANF21R2Base> ;
     using FB30 = CAN_F21R2_FB30_Values<CAN::F21R2, 30, 1, ReadWriteMode, CANF21R2Base> ;
     using FB31 = CAN_F21R2_FB31_Values<CAN::F21R2, 31, 1, ReadWriteMode, CANF21R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F21R2_FB31_Values<CAN::F21R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2498,6 +2567,7 @@ struct CAN
     using FB29 = CAN_F22R1_FB29_Values<CAN::F22R1, 29, 1, ReadWriteMode, CANF22R1Base> ;
     using FB30 = CAN_F22R1_FB30_Values<CAN::F22R1, 30, 1, ReadWriteMode, CANF22R1Base> ;
     using FB31 = CAN_F22R1_FB31_Values<CAN::F22R1, 31, 1, ReadWriteMode, CANF22R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F22R1_FB31_Values<CAN::F22R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2540,6 +2610,7 @@ struct CAN
     using FB29 = CAN_F22R2_FB29_Values<CAN::F22R2, 29, 1, ReadWriteMode, CANF22R2Base> ;
     using FB30 = CAN_F22R2_FB30_Values<CAN::F22R2, 30, 1, ReadWriteMode, CANF22R2Base> ;
     using FB31 = CAN_F22R2_FB31_Values<CAN::F22R2, 31, 1, ReadWriteMode, CANF22R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F22R2_FB31_Values<CAN::F22R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2582,6 +2653,7 @@ struct CAN
     using FB29 = CAN_F23R1_FB29_Values<CAN::F23R1, 29, 1, ReadWriteMode, CANF23R1Base> ;
     using FB30 = CAN_F23R1_FB30_Values<CAN::F23R1, 30, 1, ReadWriteMode, CANF23R1Base> ;
     using FB31 = CAN_F23R1_FB31_Values<CAN::F23R1, 31, 1, ReadWriteMode, CANF23R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F23R1_FB31_Values<CAN::F23R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2624,6 +2696,7 @@ struct CAN
     using FB29 = CAN_F23R2_FB29_Values<CAN::F23R2, 29, 1, ReadWriteMode, CANF23R2Base> ;
     using FB30 = CAN_F23R2_FB30_Values<CAN::F23R2, 30, 1, ReadWriteMode, CANF23R2Base> ;
     using FB31 = CAN_F23R2_FB31_Values<CAN::F23R2, 31, 1, ReadWriteMode, CANF23R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F23R2_FB31_Values<CAN::F23R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2666,6 +2739,7 @@ struct CAN
     using FB29 = CAN_F24R1_FB29_Values<CAN::F24R1, 29, 1, ReadWriteMode, CANF24R1Base> ;
     using FB30 = CAN_F24R1_FB30_Values<CAN::F24R1, 30, 1, ReadWriteMode, CANF24R1Base> ;
     using FB31 = CAN_F24R1_FB31_Values<CAN::F24R1, 31, 1, ReadWriteMode, CANF24R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F24R1_FB31_Values<CAN::F24R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2708,6 +2782,7 @@ struct CAN
     using FB29 = CAN_F24R2_FB29_Values<CAN::F24R2, 29, 1, ReadWriteMode, CANF24R2Base> ;
     using FB30 = CAN_F24R2_FB30_Values<CAN::F24R2, 30, 1, ReadWriteMode, CANF24R2Base> ;
     using FB31 = CAN_F24R2_FB31_Values<CAN::F24R2, 31, 1, ReadWriteMode, CANF24R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F24R2_FB31_Values<CAN::F24R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2750,6 +2825,7 @@ struct CAN
     using FB29 = CAN_F25R1_FB29_Values<CAN::F25R1, 29, 1, ReadWriteMode, CANF25R1Base> ;
     using FB30 = CAN_F25R1_FB30_Values<CAN::F25R1, 30, 1, ReadWriteMode, CANF25R1Base> ;
     using FB31 = CAN_F25R1_FB31_Values<CAN::F25R1, 31, 1, ReadWriteMode, CANF25R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F25R1_FB31_Values<CAN::F25R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2792,6 +2868,7 @@ struct CAN
     using FB29 = CAN_F25R2_FB29_Values<CAN::F25R2, 29, 1, ReadWriteMode, CANF25R2Base> ;
     using FB30 = CAN_F25R2_FB30_Values<CAN::F25R2, 30, 1, ReadWriteMode, CANF25R2Base> ;
     using FB31 = CAN_F25R2_FB31_Values<CAN::F25R2, 31, 1, ReadWriteMode, CANF25R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F25R2_FB31_Values<CAN::F25R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2834,6 +2911,7 @@ struct CAN
     using FB29 = CAN_F26R1_FB29_Values<CAN::F26R1, 29, 1, ReadWriteMode, CANF26R1Base> ;
     using FB30 = CAN_F26R1_FB30_Values<CAN::F26R1, 30, 1, ReadWriteMode, CANF26R1Base> ;
     using FB31 = CAN_F26R1_FB31_Values<CAN::F26R1, 31, 1, ReadWriteMode, CANF26R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F26R1_FB31_Values<CAN::F26R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2876,6 +2954,7 @@ struct CAN
     using FB29 = CAN_F26R2_FB29_Values<CAN::F26R2, 29, 1, ReadWriteMode, CANF26R2Base> ;
     using FB30 = CAN_F26R2_FB30_Values<CAN::F26R2, 30, 1, ReadWriteMode, CANF26R2Base> ;
     using FB31 = CAN_F26R2_FB31_Values<CAN::F26R2, 31, 1, ReadWriteMode, CANF26R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F26R2_FB31_Values<CAN::F26R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2918,6 +2997,7 @@ struct CAN
     using FB29 = CAN_F27R1_FB29_Values<CAN::F27R1, 29, 1, ReadWriteMode, CANF27R1Base> ;
     using FB30 = CAN_F27R1_FB30_Values<CAN::F27R1, 30, 1, ReadWriteMode, CANF27R1Base> ;
     using FB31 = CAN_F27R1_FB31_Values<CAN::F27R1, 31, 1, ReadWriteMode, CANF27R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F27R1_FB31_Values<CAN::F27R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2960,12 +3040,14 @@ struct CAN
     using FB29 = CAN_F27R2_FB29_Values<CAN::F27R2, 29, 1, ReadWriteMode, CANF27R2Base> ;
     using FB30 = CAN_F27R2_FB30_Values<CAN::F27R2, 30, 1, ReadWriteMode, CANF27R2Base> ;
     using FB31 = CAN_F27R2_FB31_Values<CAN::F27R2, 31, 1, ReadWriteMode, CANF27R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN_F27R2_FB31_Values<CAN::F27R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using F27R2Pack  = Register<0x4000671C, 32, ReadWriteMode, CANF27R2Base, T...> ;
 
+  using Registers = TypesList<CAN::MCR, CAN::MSR, CAN::TSR, CAN::RF0R, CAN::RF1R, CAN::IER, CAN::ESR, CAN::BTR, CAN::TI0R, CAN::TDT0R, CAN::TDL0R, CAN::TDH0R, CAN::TI1R, CAN::TDT1R, CAN::TDL1R, CAN::TDH1R, CAN::TI2R, CAN::TDT2R, CAN::TDL2R, CAN::TDH2R, CAN::RI0R, CAN::RDT0R, CAN::RDL0R, CAN::RDH0R, CAN::RI1R, CAN::RDT1R, CAN::RDL1R, CAN::RDH1R, CAN::FMR, CAN::FM1R, CAN::FS1R, CAN::FFA1R, CAN::FA1R, CAN::F0R1, CAN::F0R2, CAN::F1R1, CAN::F1R2, CAN::F2R1, CAN::F2R2, CAN::F3R1, CAN::F3R2, CAN::F4R1, CAN::F4R2, CAN::F5R1, CAN::F5R2, CAN::F6R1, CAN::F6R2, CAN::F7R1, CAN::F7R2, CAN::F8R1, CAN::F8R2, CAN::F9R1, CAN::F9R2, CAN::F10R1, CAN::F10R2, CAN::F11R1, CAN::F11R2, CAN::F12R1, CAN::F12R2, CAN::F13R1, CAN::F13R2, CAN::F14R1, CAN::F14R2, CAN::F15R1, CAN::F15R2, CAN::F16R1, CAN::F16R2, CAN::F17R1, CAN::F17R2, CAN::F18R1, CAN::F18R2, CAN::F19R1, CAN::F19R2, CAN::F20R1, CAN::F20R2, CAN::F21R1, CAN::F21R2, CAN::F22R1, CAN::F22R2, CAN::F23R1, CAN::F23R2, CAN::F24R1, CAN::F24R2, CAN::F25R1, CAN::F25R2, CAN::F26R1, CAN::F26R2, CAN::F27R1, CAN::F27R2> ;
 } ;
 
 #endif //#if !defined(CANREGISTERS_HPP)
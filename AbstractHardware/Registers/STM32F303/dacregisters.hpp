@@ -37,6 +37,7 @@ struct DAC
     using TEN1 = DAC_CR_TEN1_Values<DAC::CR, 2, 1, ReadWriteMode, DACCRBase> ;
     using BOFF1 = DAC_CR_BOFF1_Values<DAC::CR, 1, 1, ReadWriteMode, DACCRBase> ;
     using EN1 = DAC_CR_EN1_Values<DAC::CR, 0, 1, ReadWriteMode, DACCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFF3FFFU ;
     using FieldValues = DAC_CR_EN1_Values<DAC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +61,7 @@ struct DAC
   struct DHR12R1 : public RegisterBase<0x40007408, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC_DHR12R1_DACC1DHR_Values<DAC::DHR12R1, 0, 12, ReadWriteMode, DACDHR12R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC_DHR12R1_DACC1DHR_Values<DAC::DHR12R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct DAC
   struct DHR12L1 : public RegisterBase<0x4000740C, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC_DHR12L1_DACC1DHR_Values<DAC::DHR12L1, 4, 12, ReadWriteMode, DACDHR12L1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC_DHR12L1_DACC1DHR_Values<DAC::DHR12L1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +85,7 @@ struct DAC
   struct DHR8R1 : public RegisterBase<0x40007410, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC_DHR8R1_DACC1DHR_Values<DAC::DHR8R1, 0, 8, ReadWriteMode, DACDHR8R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC_DHR8R1_DACC1DHR_Values<DAC::DHR8R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +97,7 @@ struct DAC
   struct DHR12R2 : public RegisterBase<0x40007414, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC_DHR12R2_DACC2DHR_Values<DAC::DHR12R2, 0, 12, ReadWriteMode, DACDHR12R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC_DHR12R2_DACC2DHR_Values<DAC::DHR12R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +109,7 @@ struct DAC
   struct DHR12L2 : public RegisterBase<0x40007418, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC_DHR12L2_DACC2DHR_Values<DAC::DHR12L2, 4, 12, ReadWriteMode, DACDHR12L2Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC_DHR12L2_DACC2DHR_Values<DAC::DHR12L2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +121,7 @@ struct DAC
   struct DHR8R2 : public RegisterBase<0x4000741C, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC_DHR8R2_DACC2DHR_Values<DAC::DHR8R2, 0, 8, ReadWriteMode, DACDHR8R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC_DHR8R2_DACC2DHR_Values<DAC::DHR8R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +134,7 @@ struct DAC
   {
     using DACC2DHR = DAC_DHR12RD_DACC2DHR_Values<DAC::DHR12RD, 16, 12, ReadWriteMode, DACDHR12RDBase> ;
     using DACC1DHR = DAC_DHR12RD_DACC1DHR_Values<DAC::DHR12RD, 0, 12, ReadWriteMode, DACDHR12RDBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = DAC_DHR12RD_DACC1DHR_Values<DAC::DHR12RD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -139,6 +147,7 @@ struct DAC
   {
     using DACC2DHR = DAC_DHR12LD_DACC2DHR_Values<DAC::DHR12LD, 20, 12, ReadWriteMode, DACDHR12LDBase> ;
     using DACC1DHR = DAC_DHR12LD_DACC1DHR_Values<DAC::DHR12LD, 4, 12, ReadWriteMode, DACDHR12LDBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFF0U ;
     using FieldValues = DAC_DHR12LD_DACC1DHR_Values<DAC::DHR12LD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +160,7 @@ struct DAC
   {
     using DACC2DHR = DAC_DHR8RD_DACC2DHR_Values<DAC::DHR8RD, 8, 8, ReadWriteMode, DACDHR8RDBase> ;
     using DACC1DHR = DAC_DHR8RD_DACC1DHR_Values<DAC::DHR8RD, 0, 8, ReadWriteMode, DACDHR8RDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DAC_DHR8RD_DACC1DHR_Values<DAC::DHR8RD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -185,12 +195,14 @@ struct DAC
   {
     using DMAUDR2 = DAC_SR_DMAUDR2_Values<DAC::SR, 29, 1, ReadWriteMode, DACSRBase> ;
     using DMAUDR1 = DAC_SR_DMAUDR1_Values<DAC::SR, 13, 1, ReadWriteMode, DACSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = DAC_SR_DMAUDR1_Values<DAC::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SRPack  = Register<0x40007434, 32, ReadWriteMode, DACSRBase, T...> ;
 
+  using Registers = TypesList<DAC::CR, DAC::SWTRIGR, DAC::DHR12R1, DAC::DHR12L1, DAC::DHR8R1, DAC::DHR12R2, DAC::DHR12L2, DAC::DHR8R2, DAC::DHR12RD, DAC::DHR12LD, DAC::DHR8RD, DAC::DOR1, DAC::DOR2, DAC::SR> ;
 } ;
 
 #endif //#if !defined(DACREGISTERS_HPP)
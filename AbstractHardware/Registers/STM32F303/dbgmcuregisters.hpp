@@ -38,6 +38,7 @@ struct DBGMCU
     using DBG_STANDBY = DBGMCU_CR_DBG_STANDBY_Values<DBGMCU::CR, 2, 1, ReadWriteMode, DBGMCUCRBase> ;
     using TRACE_IOEN = DBGMCU_CR_TRACE_IOEN_Values<DBGMCU::CR, 5, 1, ReadWriteMode, DBGMCUCRBase> ;
     using TRACE_MODE = DBGMCU_CR_TRACE_MODE_Values<DBGMCU::CR, 6, 2, ReadWriteMode, DBGMCUCRBase> ;
+    static constexpr Type SnapshotMask = 0xE7U ;
     using FieldValues = DBGMCU_CR_TRACE_MODE_Values<DBGMCU::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -64,6 +65,7 @@ struct DBGMCU
     using I2C1_SMBUS_TIMEOUT = DBGMCU_APB1FZ_I2C1_SMBUS_TIMEOUT_Values<DBGMCU::APB1FZ, 21, 1, ReadWriteMode, DBGMCUAPB1FZBase> ;
     using I2C2_SMBUS_TIMEOUT = DBGMCU_APB1FZ_I2C2_SMBUS_TIMEOUT_Values<DBGMCU::APB1FZ, 22, 1, ReadWriteMode, DBGMCUAPB1FZBase> ;
     using DBG_CAN_STOP = DBGMCU_APB1FZ_DBG_CAN_STOP_Values<DBGMCU::APB1FZ, 25, 1, ReadWriteMode, DBGMCUAPB1FZBase> ;
+    static constexpr Type SnapshotMask = 0x2601FFFU ;
     using FieldValues = DBGMCU_APB1FZ_DBG_CAN_STOP_Values<DBGMCU::APB1FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,12 +80,14 @@ struct DBGMCU
     using DBG_TIM16_STOP = DBGMCU_APB2FZ_DBG_TIM16_STOP_Values<DBGMCU::APB2FZ, 3, 1, ReadWriteMode, DBGMCUAPB2FZBase> ;
     using DBG_TIM17_STO = DBGMCU_APB2FZ_DBG_TIM17_STO_Values<DBGMCU::APB2FZ, 4, 1, ReadWriteMode, DBGMCUAPB2FZBase> ;
     using DBG_TIM19_STOP = DBGMCU_APB2FZ_DBG_TIM19_STOP_Values<DBGMCU::APB2FZ, 5, 1, ReadWriteMode, DBGMCUAPB2FZBase> ;
+    static constexpr Type SnapshotMask = 0x3CU ;
     using FieldValues = DBGMCU_APB2FZ_DBG_TIM19_STOP_Values<DBGMCU::APB2FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using APB2FZPack  = Register<0xE004200C, 32, ReadWriteMode, DBGMCUAPB2FZBase, T...> ;
 
+  using Registers = TypesList<DBGMCU::IDCODE, DBGMCU::CR, DBGMCU::APB1FZ, DBGMCU::APB2FZ> ;
 } ;
 
 #endif //#if !defined(DBGMCUREGISTERS_HPP)
@@ -0,0 +1,53 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>      //for std::uintptr_t, std::uint32_t
+#include "buses.hpp"    //for BusCost
+
+//Характеристики микроконтроллера STM32F303, которые нужны уровню регистров
+struct DeviceTraits
+{
+  //Ядро Cortex-M4 поддерживает bit-band для области периферии: каждому биту регистра периферии
+  //соответствует 32 битное слово в области псевдонимов, запись в которое меняет только этот бит
+  static constexpr bool IsBitBandSupported = true ;
+  static constexpr std::uintptr_t PeripheralBase = 0x40000000U ;
+  static constexpr std::uintptr_t PeripheralSize = 0x00100000U ;
+  static constexpr std::uintptr_t PeripheralBitBandBase = 0x42000000U ;
+
+  //Делители частоты шин APB относительно частоты ядра, должны совпадать с настройкой RCC
+  static constexpr std::uint32_t Apb1Prescaler = 1U ;
+  static constexpr std::uint32_t Apb2Prescaler = 1U ;
+} ;
+
+//Оценка стоимости обращения к регистрам периферии в тактах ядра. Чтение через мост APB ждет синхронизации
+//с частотой шины, запись проходит через буфер записи и стоит меньше
+template<>
+struct BusCost<Ahb1Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 2U ;
+  static constexpr std::uint32_t WriteCycles = 1U ;
+} ;
+
+template<>
+struct BusCost<Apb1Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 3U + 2U * DeviceTraits::Apb1Prescaler ;
+  static constexpr std::uint32_t WriteCycles = 1U + DeviceTraits::Apb1Prescaler ;
+} ;
+
+template<>
+struct BusCost<Apb2Bus>
+{
+  static constexpr std::uint32_t ReadCycles = 3U + 2U * DeviceTraits::Apb2Prescaler ;
+  static constexpr std::uint32_t WriteCycles = 1U + DeviceTraits::Apb2Prescaler ;
+} ;
+
+template<>
+struct BusCost<PpbBus>
+{
+  static constexpr std::uint32_t ReadCycles = 1U ;
+  static constexpr std::uint32_t WriteCycles = 1U ;
+} ;
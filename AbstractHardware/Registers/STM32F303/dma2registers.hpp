@@ -87,6 +87,8 @@ struct DMA2
     using CTCIF7 = DMA2_IFCR_CTCIF7_Values<DMA2::IFCR, 25, 1, WriteMode, DMA2IFCRBase> ;
     using CHTIF7 = DMA2_IFCR_CHTIF7_Values<DMA2::IFCR, 26, 1, WriteMode, DMA2IFCRBase> ;
     using CTEIF7 = DMA2_IFCR_CTEIF7_Values<DMA2::IFCR, 27, 1, WriteMode, DMA2IFCRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type OneToClearMask = 0xFFFFFFFU ;
     using FieldValues = DMA2_IFCR_CTEIF7_Values<DMA2::IFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +111,8 @@ struct DMA2
     using MSIZE = DMA2_CCR1_MSIZE_Values<DMA2::CCR1, 10, 2, ReadWriteMode, DMA2CCR1Base> ;
     using PL = DMA2_CCR1_PL_Values<DMA2::CCR1, 12, 2, ReadWriteMode, DMA2CCR1Base> ;
     using MEM2MEM = DMA2_CCR1_MEM2MEM_Values<DMA2::CCR1, 14, 1, ReadWriteMode, DMA2CCR1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR1_MEM2MEM_Values<DMA2::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +124,7 @@ struct DMA2
   struct CNDTR1 : public RegisterBase<0x4002040C, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR1_NDT_Values<DMA2::CNDTR1, 0, 16, ReadWriteMode, DMA2CNDTR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR1_NDT_Values<DMA2::CNDTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct DMA2
   struct CPAR1 : public RegisterBase<0x40020410, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR1_PA_Values<DMA2::CPAR1, 0, 32, ReadWriteMode, DMA2CPAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR1_PA_Values<DMA2::CPAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +148,7 @@ struct DMA2
   struct CMAR1 : public RegisterBase<0x40020414, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR1_MA_Values<DMA2::CMAR1, 0, 32, ReadWriteMode, DMA2CMAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR1_MA_Values<DMA2::CMAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +171,8 @@ struct DMA2
     using MSIZE = DMA2_CCR2_MSIZE_Values<DMA2::CCR2, 10, 2, ReadWriteMode, DMA2CCR2Base> ;
     using PL = DMA2_CCR2_PL_Values<DMA2::CCR2, 12, 2, ReadWriteMode, DMA2CCR2Base> ;
     using MEM2MEM = DMA2_CCR2_MEM2MEM_Values<DMA2::CCR2, 14, 1, ReadWriteMode, DMA2CCR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR2_MEM2MEM_Values<DMA2::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -175,6 +184,7 @@ struct DMA2
   struct CNDTR2 : public RegisterBase<0x40020420, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR2_NDT_Values<DMA2::CNDTR2, 0, 16, ReadWriteMode, DMA2CNDTR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR2_NDT_Values<DMA2::CNDTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -186,6 +196,7 @@ struct DMA2
   struct CPAR2 : public RegisterBase<0x40020424, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR2_PA_Values<DMA2::CPAR2, 0, 32, ReadWriteMode, DMA2CPAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR2_PA_Values<DMA2::CPAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,6 +208,7 @@ struct DMA2
   struct CMAR2 : public RegisterBase<0x40020428, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR2_MA_Values<DMA2::CMAR2, 0, 32, ReadWriteMode, DMA2CMAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR2_MA_Values<DMA2::CMAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +231,8 @@ struct DMA2
     using MSIZE = DMA2_CCR3_MSIZE_Values<DMA2::CCR3, 10, 2, ReadWriteMode, DMA2CCR3Base> ;
     using PL = DMA2_CCR3_PL_Values<DMA2::CCR3, 12, 2, ReadWriteMode, DMA2CCR3Base> ;
     using MEM2MEM = DMA2_CCR3_MEM2MEM_Values<DMA2::CCR3, 14, 1, ReadWriteMode, DMA2CCR3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR3_MEM2MEM_Values<DMA2::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +244,7 @@ struct DMA2
   struct CNDTR3 : public RegisterBase<0x40020434, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR3_NDT_Values<DMA2::CNDTR3, 0, 16, ReadWriteMode, DMA2CNDTR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR3_NDT_Values<DMA2::CNDTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +256,7 @@ struct DMA2
   struct CPAR3 : public RegisterBase<0x40020438, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR3_PA_Values<DMA2::CPAR3, 0, 32, ReadWriteMode, DMA2CPAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR3_PA_Values<DMA2::CPAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +268,7 @@ struct DMA2
   struct CMAR3 : public RegisterBase<0x4002043C, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR3_MA_Values<DMA2::CMAR3, 0, 32, ReadWriteMode, DMA2CMAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR3_MA_Values<DMA2::CMAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +291,8 @@ struct DMA2
     using MSIZE = DMA2_CCR4_MSIZE_Values<DMA2::CCR4, 10, 2, ReadWriteMode, DMA2CCR4Base> ;
     using PL = DMA2_CCR4_PL_Values<DMA2::CCR4, 12, 2, ReadWriteMode, DMA2CCR4Base> ;
     using MEM2MEM = DMA2_CCR4_MEM2MEM_Values<DMA2::CCR4, 14, 1, ReadWriteMode, DMA2CCR4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR4_MEM2MEM_Values<DMA2::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -285,6 +304,7 @@ struct DMA2
   struct CNDTR4 : public RegisterBase<0x40020448, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR4_NDT_Values<DMA2::CNDTR4, 0, 16, ReadWriteMode, DMA2CNDTR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR4_NDT_Values<DMA2::CNDTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct DMA2
   struct CPAR4 : public RegisterBase<0x4002044C, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR4_PA_Values<DMA2::CPAR4, 0, 32, ReadWriteMode, DMA2CPAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR4_PA_Values<DMA2::CPAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,6 +328,7 @@ struct DMA2
   struct CMAR4 : public RegisterBase<0x40020450, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR4_MA_Values<DMA2::CMAR4, 0, 32, ReadWriteMode, DMA2CMAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR4_MA_Values<DMA2::CMAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +351,8 @@ struct DMA2
     using MSIZE = DMA2_CCR5_MSIZE_Values<DMA2::CCR5, 10, 2, ReadWriteMode, DMA2CCR5Base> ;
     using PL = DMA2_CCR5_PL_Values<DMA2::CCR5, 12, 2, ReadWriteMode, DMA2CCR5Base> ;
     using MEM2MEM = DMA2_CCR5_MEM2MEM_Values<DMA2::CCR5, 14, 1, ReadWriteMode, DMA2CCR5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR5_MEM2MEM_Values<DMA2::CCR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +364,7 @@ struct DMA2
   struct CNDTR5 : public RegisterBase<0x4002045C, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR5_NDT_Values<DMA2::CNDTR5, 0, 16, ReadWriteMode, DMA2CNDTR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR5_NDT_Values<DMA2::CNDTR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -351,6 +376,7 @@ struct DMA2
   struct CPAR5 : public RegisterBase<0x40020460, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR5_PA_Values<DMA2::CPAR5, 0, 32, ReadWriteMode, DMA2CPAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR5_PA_Values<DMA2::CPAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -362,6 +388,7 @@ struct DMA2
   struct CMAR5 : public RegisterBase<0x40020464, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR5_MA_Values<DMA2::CMAR5, 0, 32, ReadWriteMode, DMA2CMAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR5_MA_Values<DMA2::CMAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -384,6 +411,8 @@ struct DMA2
     using MSIZE = DMA2_CCR6_MSIZE_Values<DMA2::CCR6, 10, 2, ReadWriteMode, DMA2CCR6Base> ;
     using PL = DMA2_CCR6_PL_Values<DMA2::CCR6, 12, 2, ReadWriteMode, DMA2CCR6Base> ;
     using MEM2MEM = DMA2_CCR6_MEM2MEM_Values<DMA2::CCR6, 14, 1, ReadWriteMode, DMA2CCR6Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR6_MEM2MEM_Values<DMA2::CCR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -395,6 +424,7 @@ struct DMA2
   struct CNDTR6 : public RegisterBase<0x40020470, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR6_NDT_Values<DMA2::CNDTR6, 0, 16, ReadWriteMode, DMA2CNDTR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR6_NDT_Values<DMA2::CNDTR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -406,6 +436,7 @@ struct DMA2
   struct CPAR6 : public RegisterBase<0x40020474, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR6_PA_Values<DMA2::CPAR6, 0, 32, ReadWriteMode, DMA2CPAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR6_PA_Values<DMA2::CPAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -417,6 +448,7 @@ struct DMA2
   struct CMAR6 : public RegisterBase<0x40020478, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR6_MA_Values<DMA2::CMAR6, 0, 32, ReadWriteMode, DMA2CMAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR6_MA_Values<DMA2::CMAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,6 +471,8 @@ struct DMA2
     using MSIZE = DMA2_CCR7_MSIZE_Values<DMA2::CCR7, 10, 2, ReadWriteMode, DMA2CCR7Base> ;
     using PL = DMA2_CCR7_PL_Values<DMA2::CCR7, 12, 2, ReadWriteMode, DMA2CCR7Base> ;
     using MEM2MEM = DMA2_CCR7_MEM2MEM_Values<DMA2::CCR7, 14, 1, ReadWriteMode, DMA2CCR7Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR7_MEM2MEM_Values<DMA2::CCR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -450,6 +484,7 @@ struct DMA2
   struct CNDTR7 : public RegisterBase<0x40020484, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR7_NDT_Values<DMA2::CNDTR7, 0, 16, ReadWriteMode, DMA2CNDTR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR7_NDT_Values<DMA2::CNDTR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -461,6 +496,7 @@ struct DMA2
   struct CPAR7 : public RegisterBase<0x40020488, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR7_PA_Values<DMA2::CPAR7, 0, 32, ReadWriteMode, DMA2CPAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR7_PA_Values<DMA2::CPAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -472,12 +508,14 @@ struct DMA2
   struct CMAR7 : public RegisterBase<0x4002048C, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR7_MA_Values<DMA2::CMAR7, 0, 32, ReadWriteMode, DMA2CMAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR7_MA_Values<DMA2::CMAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CMAR7Pack  = Register<0x4002048C, 32, ReadWriteMode, DMA2CMAR7Base, T...> ;
 
+  using Registers = TypesList<DMA2::ISR, DMA2::IFCR, DMA2::CCR1, DMA2::CNDTR1, DMA2::CPAR1, DMA2::CMAR1, DMA2::CCR2, DMA2::CNDTR2, DMA2::CPAR2, DMA2::CMAR2, DMA2::CCR3, DMA2::CNDTR3, DMA2::CPAR3, DMA2::CMAR3, DMA2::CCR4, DMA2::CNDTR4, DMA2::CPAR4, DMA2::CMAR4, DMA2::CCR5, DMA2::CNDTR5, DMA2::CPAR5, DMA2::CMAR5, DMA2::CCR6, DMA2::CNDTR6, DMA2::CPAR6, DMA2::CMAR6, DMA2::CCR7, DMA2::CNDTR7, DMA2::CPAR7, DMA2::CMAR7> ;
 } ;
 
 #endif //#if !defined(DMA2REGISTERS_HPP)
@@ -53,6 +53,7 @@ struct EXTI
     using MR29 = EXTI_IMR1_MR29_Values<EXTI::IMR1, 29, 1, ReadWriteMode, EXTIIMR1Base> ;
     using MR30 = EXTI_IMR1_MR30_Values<EXTI::IMR1, 30, 1, ReadWriteMode, EXTIIMR1Base> ;
     using MR31 = EXTI_IMR1_MR31_Values<EXTI::IMR1, 31, 1, ReadWriteMode, EXTIIMR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = EXTI_IMR1_MR31_Values<EXTI::IMR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +96,7 @@ struct EXTI
     using MR29 = EXTI_EMR1_MR29_Values<EXTI::EMR1, 29, 1, ReadWriteMode, EXTIEMR1Base> ;
     using MR30 = EXTI_EMR1_MR30_Values<EXTI::EMR1, 30, 1, ReadWriteMode, EXTIEMR1Base> ;
     using MR31 = EXTI_EMR1_MR31_Values<EXTI::EMR1, 31, 1, ReadWriteMode, EXTIEMR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = EXTI_EMR1_MR31_Values<EXTI::EMR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +133,7 @@ struct EXTI
     using TR29 = EXTI_RTSR1_TR29_Values<EXTI::RTSR1, 29, 1, ReadWriteMode, EXTIRTSR1Base> ;
     using TR30 = EXTI_RTSR1_TR30_Values<EXTI::RTSR1, 30, 1, ReadWriteMode, EXTIRTSR1Base> ;
     using TR31 = EXTI_RTSR1_TR31_Values<EXTI::RTSR1, 31, 1, ReadWriteMode, EXTIRTSR1Base> ;
+    static constexpr Type SnapshotMask = 0xE07FFFFFU ;
     using FieldValues = EXTI_RTSR1_TR31_Values<EXTI::RTSR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +170,7 @@ struct EXTI
     using TR29 = EXTI_FTSR1_TR29_Values<EXTI::FTSR1, 29, 1, ReadWriteMode, EXTIFTSR1Base> ;
     using TR30 = EXTI_FTSR1_TR30_Values<EXTI::FTSR1, 30, 1, ReadWriteMode, EXTIFTSR1Base> ;
     using TR31 = EXTI_FTSR1_TR31_Values<EXTI::FTSR1, 31, 1, ReadWriteMode, EXTIFTSR1Base> ;
+    static constexpr Type SnapshotMask = 0xE07FFFFFU ;
     using FieldValues = EXTI_FTSR1_TR31_Values<EXTI::FTSR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,6 +207,7 @@ struct EXTI
     using SWIER29 = EXTI_SWIER1_SWIER29_Values<EXTI::SWIER1, 29, 1, ReadWriteMode, EXTISWIER1Base> ;
     using SWIER30 = EXTI_SWIER1_SWIER30_Values<EXTI::SWIER1, 30, 1, ReadWriteMode, EXTISWIER1Base> ;
     using SWIER31 = EXTI_SWIER1_SWIER31_Values<EXTI::SWIER1, 31, 1, ReadWriteMode, EXTISWIER1Base> ;
+    static constexpr Type SnapshotMask = 0xE07FFFFFU ;
     using FieldValues = EXTI_SWIER1_SWIER31_Values<EXTI::SWIER1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -239,6 +244,9 @@ struct EXTI
     using PR29 = EXTI_PR1_PR29_Values<EXTI::PR1, 29, 1, ReadWriteMode, EXTIPR1Base> ;
     using PR30 = EXTI_PR1_PR30_Values<EXTI::PR1, 30, 1, ReadWriteMode, EXTIPR1Base> ;
     using PR31 = EXTI_PR1_PR31_Values<EXTI::PR1, 31, 1, ReadWriteMode, EXTIPR1Base> ;
+    static constexpr Type WritableMask = 0xE07FFFFFU ;
+    static constexpr Type OneToClearMask = 0xE07FFFFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PR1_PR31_Values<EXTI::PR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -253,6 +261,7 @@ struct EXTI
     using MR33 = EXTI_IMR2_MR33_Values<EXTI::IMR2, 1, 1, ReadWriteMode, EXTIIMR2Base> ;
     using MR34 = EXTI_IMR2_MR34_Values<EXTI::IMR2, 2, 1, ReadWriteMode, EXTIIMR2Base> ;
     using MR35 = EXTI_IMR2_MR35_Values<EXTI::IMR2, 3, 1, ReadWriteMode, EXTIIMR2Base> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = EXTI_IMR2_MR35_Values<EXTI::IMR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -267,6 +276,7 @@ struct EXTI
     using MR33 = EXTI_EMR2_MR33_Values<EXTI::EMR2, 1, 1, ReadWriteMode, EXTIEMR2Base> ;
     using MR34 = EXTI_EMR2_MR34_Values<EXTI::EMR2, 2, 1, ReadWriteMode, EXTIEMR2Base> ;
     using MR35 = EXTI_EMR2_MR35_Values<EXTI::EMR2, 3, 1, ReadWriteMode, EXTIEMR2Base> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = EXTI_EMR2_MR35_Values<EXTI::EMR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -279,6 +289,7 @@ struct EXTI
   {
     using TR32 = EXTI_RTSR2_TR32_Values<EXTI::RTSR2, 0, 1, ReadWriteMode, EXTIRTSR2Base> ;
     using TR33 = EXTI_RTSR2_TR33_Values<EXTI::RTSR2, 1, 1, ReadWriteMode, EXTIRTSR2Base> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = EXTI_RTSR2_TR33_Values<EXTI::RTSR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -291,6 +302,7 @@ struct EXTI
   {
     using TR32 = EXTI_FTSR2_TR32_Values<EXTI::FTSR2, 0, 1, ReadWriteMode, EXTIFTSR2Base> ;
     using TR33 = EXTI_FTSR2_TR33_Values<EXTI::FTSR2, 1, 1, ReadWriteMode, EXTIFTSR2Base> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = EXTI_FTSR2_TR33_Values<EXTI::FTSR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -303,6 +315,7 @@ struct EXTI
   {
     using SWIER32 = EXTI_SWIER2_SWIER32_Values<EXTI::SWIER2, 0, 1, ReadWriteMode, EXTISWIER2Base> ;
     using SWIER33 = EXTI_SWIER2_SWIER33_Values<EXTI::SWIER2, 1, 1, ReadWriteMode, EXTISWIER2Base> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = EXTI_SWIER2_SWIER33_Values<EXTI::SWIER2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -315,12 +328,16 @@ struct EXTI
   {
     using PR32 = EXTI_PR2_PR32_Values<EXTI::PR2, 0, 1, ReadWriteMode, EXTIPR2Base> ;
     using PR33 = EXTI_PR2_PR33_Values<EXTI::PR2, 1, 1, ReadWriteMode, EXTIPR2Base> ;
+    static constexpr Type WritableMask = 0x3U ;
+    static constexpr Type OneToClearMask = 0x3U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PR2_PR33_Values<EXTI::PR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PR2Pack  = Register<0x4001042C, 32, ReadWriteMode, EXTIPR2Base, T...> ;
 
+  using Registers = TypesList<EXTI::IMR1, EXTI::EMR1, EXTI::RTSR1, EXTI::FTSR1, EXTI::SWIER1, EXTI::PR1, EXTI::IMR2, EXTI::EMR2, EXTI::RTSR2, EXTI::FTSR2, EXTI::SWIER2, EXTI::PR2> ;
 } ;
 
 #endif //#if !defined(EXTIREGISTERS_HPP)
@@ -24,6 +24,7 @@ struct FLASH
     using LATENCY = FLASH_ACR_LATENCY_Values<FLASH::ACR, 0, 3, ReadWriteMode, FLASHACRBase> ;
     using PRFTBE = FLASH_ACR_PRFTBE_Values<FLASH::ACR, 4, 1, ReadWriteMode, FLASHACRBase> ;
     using PRFTBS = FLASH_ACR_PRFTBS_Values<FLASH::ACR, 5, 1, ReadMode, FLASHACRBase> ;
+    static constexpr Type SnapshotMask = 0x17U ;
     using FieldValues = FLASH_ACR_PRFTBS_Values<FLASH::ACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +61,9 @@ struct FLASH
     using WRPRT = FLASH_SR_WRPRT_Values<FLASH::SR, 4, 1, ReadWriteMode, FLASHSRBase> ;
     using PGERR = FLASH_SR_PGERR_Values<FLASH::SR, 2, 1, ReadWriteMode, FLASHSRBase> ;
     using BSY = FLASH_SR_BSY_Values<FLASH::SR, 0, 1, ReadMode, FLASHSRBase> ;
+    static constexpr Type WritableMask = 0x34U ;
+    static constexpr Type OneToClearMask = 0x34U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = FLASH_SR_BSY_Values<FLASH::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct FLASH
     using MER = FLASH_CR_MER_Values<FLASH::CR, 2, 1, ReadWriteMode, FLASHCRBase> ;
     using PER = FLASH_CR_PER_Values<FLASH::CR, 1, 1, ReadWriteMode, FLASHCRBase> ;
     using PG = FLASH_CR_PG_Values<FLASH::CR, 0, 1, ReadWriteMode, FLASHCRBase> ;
+    static constexpr Type SnapshotMask = 0x36B7U ;
     using FieldValues = FLASH_CR_PG_Values<FLASH::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +135,7 @@ struct FLASH
   template<typename... T> 
   using WRPRPack  = Register<0x40022020, 32, ReadMode, FLASHWRPRBase, T...> ;
 
+  using Registers = TypesList<FLASH::ACR, FLASH::KEYR, FLASH::OPTKEYR, FLASH::SR, FLASH::CR, FLASH::AR, FLASH::OBR, FLASH::WRPR> ;
 } ;
 
 #endif //#if !defined(FLASHREGISTERS_HPP)
@@ -35,6 +35,7 @@ struct FMC
     using MTYP = FMC_BCR1_MTYP_Values<FMC::BCR1, 2, 2, ReadWriteMode, FMCBCR1Base> ;
     using MUXEN = FMC_BCR1_MUXEN_Values<FMC::BCR1, 1, 1, ReadWriteMode, FMCBCR1Base> ;
     using MBKEN = FMC_BCR1_MBKEN_Values<FMC::BCR1, 0, 1, ReadWriteMode, FMCBCR1Base> ;
+    static constexpr Type SnapshotMask = 0x18FB7FU ;
     using FieldValues = FMC_BCR1_MBKEN_Values<FMC::BCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +53,7 @@ struct FMC
     using DATAST = FMC_BTR1_DATAST_Values<FMC::BTR1, 8, 8, ReadWriteMode, FMCBTR1Base> ;
     using ADDHLD = FMC_BTR1_ADDHLD_Values<FMC::BTR1, 4, 4, ReadWriteMode, FMCBTR1Base> ;
     using ADDSET = FMC_BTR1_ADDSET_Values<FMC::BTR1, 0, 4, ReadWriteMode, FMCBTR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BTR1_ADDSET_Values<FMC::BTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +78,7 @@ struct FMC
     using MTYP = FMC_BCR2_MTYP_Values<FMC::BCR2, 2, 2, ReadWriteMode, FMCBCR2Base> ;
     using MUXEN = FMC_BCR2_MUXEN_Values<FMC::BCR2, 1, 1, ReadWriteMode, FMCBCR2Base> ;
     using MBKEN = FMC_BCR2_MBKEN_Values<FMC::BCR2, 0, 1, ReadWriteMode, FMCBCR2Base> ;
+    static constexpr Type SnapshotMask = 0x8FF7FU ;
     using FieldValues = FMC_BCR2_MBKEN_Values<FMC::BCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +96,7 @@ struct FMC
     using DATAST = FMC_BTR2_DATAST_Values<FMC::BTR2, 8, 8, ReadWriteMode, FMCBTR2Base> ;
     using ADDHLD = FMC_BTR2_ADDHLD_Values<FMC::BTR2, 4, 4, ReadWriteMode, FMCBTR2Base> ;
     using ADDSET = FMC_BTR2_ADDSET_Values<FMC::BTR2, 0, 4, ReadWriteMode, FMCBTR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BTR2_ADDSET_Values<FMC::BTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +121,7 @@ struct FMC
     using MTYP = FMC_BCR3_MTYP_Values<FMC::BCR3, 2, 2, ReadWriteMode, FMCBCR3Base> ;
     using MUXEN = FMC_BCR3_MUXEN_Values<FMC::BCR3, 1, 1, ReadWriteMode, FMCBCR3Base> ;
     using MBKEN = FMC_BCR3_MBKEN_Values<FMC::BCR3, 0, 1, ReadWriteMode, FMCBCR3Base> ;
+    static constexpr Type SnapshotMask = 0x8FF7FU ;
     using FieldValues = FMC_BCR3_MBKEN_Values<FMC::BCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +139,7 @@ struct FMC
     using DATAST = FMC_BTR3_DATAST_Values<FMC::BTR3, 8, 8, ReadWriteMode, FMCBTR3Base> ;
     using ADDHLD = FMC_BTR3_ADDHLD_Values<FMC::BTR3, 4, 4, ReadWriteMode, FMCBTR3Base> ;
     using ADDSET = FMC_BTR3_ADDSET_Values<FMC::BTR3, 0, 4, ReadWriteMode, FMCBTR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BTR3_ADDSET_Values<FMC::BTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +164,7 @@ struct FMC
     using MTYP = FMC_BCR4_MTYP_Values<FMC::BCR4, 2, 2, ReadWriteMode, FMCBCR4Base> ;
     using MUXEN = FMC_BCR4_MUXEN_Values<FMC::BCR4, 1, 1, ReadWriteMode, FMCBCR4Base> ;
     using MBKEN = FMC_BCR4_MBKEN_Values<FMC::BCR4, 0, 1, ReadWriteMode, FMCBCR4Base> ;
+    static constexpr Type SnapshotMask = 0x8FF7FU ;
     using FieldValues = FMC_BCR4_MBKEN_Values<FMC::BCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -175,6 +182,7 @@ struct FMC
     using DATAST = FMC_BTR4_DATAST_Values<FMC::BTR4, 8, 8, ReadWriteMode, FMCBTR4Base> ;
     using ADDHLD = FMC_BTR4_ADDHLD_Values<FMC::BTR4, 4, 4, ReadWriteMode, FMCBTR4Base> ;
     using ADDSET = FMC_BTR4_ADDSET_Values<FMC::BTR4, 0, 4, ReadWriteMode, FMCBTR4Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BTR4_ADDSET_Values<FMC::BTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -193,6 +201,7 @@ struct FMC
     using PTYP = FMC_PCR2_PTYP_Values<FMC::PCR2, 3, 1, ReadWriteMode, FMCPCR2Base> ;
     using PBKEN = FMC_PCR2_PBKEN_Values<FMC::PCR2, 2, 1, ReadWriteMode, FMCPCR2Base> ;
     using PWAITEN = FMC_PCR2_PWAITEN_Values<FMC::PCR2, 1, 1, ReadWriteMode, FMCPCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFE7EU ;
     using FieldValues = FMC_PCR2_PWAITEN_Values<FMC::PCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +219,7 @@ struct FMC
     using IFS = FMC_SR2_IFS_Values<FMC::SR2, 2, 1, ReadWriteMode, FMCSR2Base> ;
     using ILS = FMC_SR2_ILS_Values<FMC::SR2, 1, 1, ReadWriteMode, FMCSR2Base> ;
     using IRS = FMC_SR2_IRS_Values<FMC::SR2, 0, 1, ReadWriteMode, FMCSR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = FMC_SR2_IRS_Values<FMC::SR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +234,7 @@ struct FMC
     using MEMHOLDx = FMC_PMEM2_MEMHOLDx_Values<FMC::PMEM2, 16, 8, ReadWriteMode, FMCPMEM2Base> ;
     using MEMWAITx = FMC_PMEM2_MEMWAITx_Values<FMC::PMEM2, 8, 8, ReadWriteMode, FMCPMEM2Base> ;
     using MEMSETx = FMC_PMEM2_MEMSETx_Values<FMC::PMEM2, 0, 8, ReadWriteMode, FMCPMEM2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PMEM2_MEMSETx_Values<FMC::PMEM2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -238,6 +249,7 @@ struct FMC
     using ATTHOLDx = FMC_PATT2_ATTHOLDx_Values<FMC::PATT2, 16, 8, ReadWriteMode, FMCPATT2Base> ;
     using ATTWAITx = FMC_PATT2_ATTWAITx_Values<FMC::PATT2, 8, 8, ReadWriteMode, FMCPATT2Base> ;
     using ATTSETx = FMC_PATT2_ATTSETx_Values<FMC::PATT2, 0, 8, ReadWriteMode, FMCPATT2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PATT2_ATTSETx_Values<FMC::PATT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -267,6 +279,7 @@ struct FMC
     using PTYP = FMC_PCR3_PTYP_Values<FMC::PCR3, 3, 1, ReadWriteMode, FMCPCR3Base> ;
     using PBKEN = FMC_PCR3_PBKEN_Values<FMC::PCR3, 2, 1, ReadWriteMode, FMCPCR3Base> ;
     using PWAITEN = FMC_PCR3_PWAITEN_Values<FMC::PCR3, 1, 1, ReadWriteMode, FMCPCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFE7EU ;
     using FieldValues = FMC_PCR3_PWAITEN_Values<FMC::PCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +297,7 @@ struct FMC
     using IFS = FMC_SR3_IFS_Values<FMC::SR3, 2, 1, ReadWriteMode, FMCSR3Base> ;
     using ILS = FMC_SR3_ILS_Values<FMC::SR3, 1, 1, ReadWriteMode, FMCSR3Base> ;
     using IRS = FMC_SR3_IRS_Values<FMC::SR3, 0, 1, ReadWriteMode, FMCSR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = FMC_SR3_IRS_Values<FMC::SR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -298,6 +312,7 @@ struct FMC
     using MEMHOLDx = FMC_PMEM3_MEMHOLDx_Values<FMC::PMEM3, 16, 8, ReadWriteMode, FMCPMEM3Base> ;
     using MEMWAITx = FMC_PMEM3_MEMWAITx_Values<FMC::PMEM3, 8, 8, ReadWriteMode, FMCPMEM3Base> ;
     using MEMSETx = FMC_PMEM3_MEMSETx_Values<FMC::PMEM3, 0, 8, ReadWriteMode, FMCPMEM3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PMEM3_MEMSETx_Values<FMC::PMEM3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -312,6 +327,7 @@ struct FMC
     using ATTHOLDx = FMC_PATT3_ATTHOLDx_Values<FMC::PATT3, 16, 8, ReadWriteMode, FMCPATT3Base> ;
     using ATTWAITx = FMC_PATT3_ATTWAITx_Values<FMC::PATT3, 8, 8, ReadWriteMode, FMCPATT3Base> ;
     using ATTSETx = FMC_PATT3_ATTSETx_Values<FMC::PATT3, 0, 8, ReadWriteMode, FMCPATT3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PATT3_ATTSETx_Values<FMC::PATT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -341,6 +357,7 @@ struct FMC
     using PTYP = FMC_PCR4_PTYP_Values<FMC::PCR4, 3, 1, ReadWriteMode, FMCPCR4Base> ;
     using PBKEN = FMC_PCR4_PBKEN_Values<FMC::PCR4, 2, 1, ReadWriteMode, FMCPCR4Base> ;
     using PWAITEN = FMC_PCR4_PWAITEN_Values<FMC::PCR4, 1, 1, ReadWriteMode, FMCPCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFE7EU ;
     using FieldValues = FMC_PCR4_PWAITEN_Values<FMC::PCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,6 +375,7 @@ struct FMC
     using IFS = FMC_SR4_IFS_Values<FMC::SR4, 2, 1, ReadWriteMode, FMCSR4Base> ;
     using ILS = FMC_SR4_ILS_Values<FMC::SR4, 1, 1, ReadWriteMode, FMCSR4Base> ;
     using IRS = FMC_SR4_IRS_Values<FMC::SR4, 0, 1, ReadWriteMode, FMCSR4Base> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = FMC_SR4_IRS_Values<FMC::SR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -372,6 +390,7 @@ struct FMC
     using MEMHOLDx = FMC_PMEM4_MEMHOLDx_Values<FMC::PMEM4, 16, 8, ReadWriteMode, FMCPMEM4Base> ;
     using MEMWAITx = FMC_PMEM4_MEMWAITx_Values<FMC::PMEM4, 8, 8, ReadWriteMode, FMCPMEM4Base> ;
     using MEMSETx = FMC_PMEM4_MEMSETx_Values<FMC::PMEM4, 0, 8, ReadWriteMode, FMCPMEM4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PMEM4_MEMSETx_Values<FMC::PMEM4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -386,6 +405,7 @@ struct FMC
     using ATTHOLDx = FMC_PATT4_ATTHOLDx_Values<FMC::PATT4, 16, 8, ReadWriteMode, FMCPATT4Base> ;
     using ATTWAITx = FMC_PATT4_ATTWAITx_Values<FMC::PATT4, 8, 8, ReadWriteMode, FMCPATT4Base> ;
     using ATTSETx = FMC_PATT4_ATTSETx_Values<FMC::PATT4, 0, 8, ReadWriteMode, FMCPATT4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PATT4_ATTSETx_Values<FMC::PATT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -400,6 +420,7 @@ struct FMC
     using IOHOLDx = FMC_PIO4_IOHOLDx_Values<FMC::PIO4, 16, 8, ReadWriteMode, FMCPIO4Base> ;
     using IOWAITx = FMC_PIO4_IOWAITx_Values<FMC::PIO4, 8, 8, ReadWriteMode, FMCPIO4Base> ;
     using IOSETx = FMC_PIO4_IOSETx_Values<FMC::PIO4, 0, 8, ReadWriteMode, FMCPIO4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FMC_PIO4_IOSETx_Values<FMC::PIO4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -417,6 +438,7 @@ struct FMC
     using DATAST = FMC_BWTR1_DATAST_Values<FMC::BWTR1, 8, 8, ReadWriteMode, FMCBWTR1Base> ;
     using ADDHLD = FMC_BWTR1_ADDHLD_Values<FMC::BWTR1, 4, 4, ReadWriteMode, FMCBWTR1Base> ;
     using ADDSET = FMC_BWTR1_ADDSET_Values<FMC::BWTR1, 0, 4, ReadWriteMode, FMCBWTR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BWTR1_ADDSET_Values<FMC::BWTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -434,6 +456,7 @@ struct FMC
     using DATAST = FMC_BWTR2_DATAST_Values<FMC::BWTR2, 8, 8, ReadWriteMode, FMCBWTR2Base> ;
     using ADDHLD = FMC_BWTR2_ADDHLD_Values<FMC::BWTR2, 4, 4, ReadWriteMode, FMCBWTR2Base> ;
     using ADDSET = FMC_BWTR2_ADDSET_Values<FMC::BWTR2, 0, 4, ReadWriteMode, FMCBWTR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BWTR2_ADDSET_Values<FMC::BWTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -451,6 +474,7 @@ struct FMC
     using DATAST = FMC_BWTR3_DATAST_Values<FMC::BWTR3, 8, 8, ReadWriteMode, FMCBWTR3Base> ;
     using ADDHLD = FMC_BWTR3_ADDHLD_Values<FMC::BWTR3, 4, 4, ReadWriteMode, FMCBWTR3Base> ;
     using ADDSET = FMC_BWTR3_ADDSET_Values<FMC::BWTR3, 0, 4, ReadWriteMode, FMCBWTR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BWTR3_ADDSET_Values<FMC::BWTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -468,12 +492,14 @@ struct FMC
     using DATAST = FMC_BWTR4_DATAST_Values<FMC::BWTR4, 8, 8, ReadWriteMode, FMCBWTR4Base> ;
     using ADDHLD = FMC_BWTR4_ADDHLD_Values<FMC::BWTR4, 4, 4, ReadWriteMode, FMCBWTR4Base> ;
     using ADDSET = FMC_BWTR4_ADDSET_Values<FMC::BWTR4, 0, 4, ReadWriteMode, FMCBWTR4Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FMC_BWTR4_ADDSET_Values<FMC::BWTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BWTR4Pack  = Register<0xA000051C, 32, ReadWriteMode, FMCBWTR4Base, T...> ;
 
+  using Registers = TypesList<FMC::BCR1, FMC::BTR1, FMC::BCR2, FMC::BTR2, FMC::BCR3, FMC::BTR3, FMC::BCR4, FMC::BTR4, FMC::PCR2, FMC::SR2, FMC::PMEM2, FMC::PATT2, FMC::ECCR2, FMC::PCR3, FMC::SR3, FMC::PMEM3, FMC::PATT3, FMC::ECCR3, FMC::PCR4, FMC::SR4, FMC::PMEM4, FMC::PATT4, FMC::PIO4, FMC::BWTR1, FMC::BWTR2, FMC::BWTR3, FMC::BWTR4> ;
 } ;
 
 #endif //#if !defined(FMCREGISTERS_HPP)
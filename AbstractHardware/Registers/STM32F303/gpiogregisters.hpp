@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOG
 {
+  struct BSRR ;
+
   struct GPIOGMODERBase {} ;
 
   struct MODER : public RegisterBase<0x48001800, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOG
     using MODER2 = GPIOG_MODER_MODER2_Values<GPIOG::MODER, 4, 2, ReadWriteMode, GPIOGMODERBase> ;
     using MODER1 = GPIOG_MODER_MODER1_Values<GPIOG::MODER, 2, 2, ReadWriteMode, GPIOGMODERBase> ;
     using MODER0 = GPIOG_MODER_MODER0_Values<GPIOG::MODER, 0, 2, ReadWriteMode, GPIOGMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOG_MODER_MODER0_Values<GPIOG::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOG
     using OT2 = GPIOG_OTYPER_OT2_Values<GPIOG::OTYPER, 2, 1, ReadWriteMode, GPIOGOTYPERBase> ;
     using OT1 = GPIOG_OTYPER_OT1_Values<GPIOG::OTYPER, 1, 1, ReadWriteMode, GPIOGOTYPERBase> ;
     using OT0 = GPIOG_OTYPER_OT0_Values<GPIOG::OTYPER, 0, 1, ReadWriteMode, GPIOGOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOG_OTYPER_OT0_Values<GPIOG::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOG
     using OSPEEDR2 = GPIOG_OSPEEDR_OSPEEDR2_Values<GPIOG::OSPEEDR, 4, 2, ReadWriteMode, GPIOGOSPEEDRBase> ;
     using OSPEEDR1 = GPIOG_OSPEEDR_OSPEEDR1_Values<GPIOG::OSPEEDR, 2, 2, ReadWriteMode, GPIOGOSPEEDRBase> ;
     using OSPEEDR0 = GPIOG_OSPEEDR_OSPEEDR0_Values<GPIOG::OSPEEDR, 0, 2, ReadWriteMode, GPIOGOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOG_OSPEEDR_OSPEEDR0_Values<GPIOG::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOG
     using PUPDR2 = GPIOG_PUPDR_PUPDR2_Values<GPIOG::PUPDR, 4, 2, ReadWriteMode, GPIOGPUPDRBase> ;
     using PUPDR1 = GPIOG_PUPDR_PUPDR1_Values<GPIOG::PUPDR, 2, 2, ReadWriteMode, GPIOGPUPDRBase> ;
     using PUPDR0 = GPIOG_PUPDR_PUPDR0_Values<GPIOG::PUPDR, 0, 2, ReadWriteMode, GPIOGPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOG_PUPDR_PUPDR0_Values<GPIOG::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOG
     using IDR2 = GPIOG_IDR_IDR2_Values<GPIOG::IDR, 2, 1, ReadMode, GPIOGIDRBase> ;
     using IDR1 = GPIOG_IDR_IDR1_Values<GPIOG::IDR, 1, 1, ReadMode, GPIOGIDRBase> ;
     using IDR0 = GPIOG_IDR_IDR0_Values<GPIOG::IDR, 0, 1, ReadMode, GPIOGIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOG_IDR_IDR0_Values<GPIOG::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOG
     using ODR2 = GPIOG_ODR_ODR2_Values<GPIOG::ODR, 2, 1, ReadWriteMode, GPIOGODRBase> ;
     using ODR1 = GPIOG_ODR_ODR1_Values<GPIOG::ODR, 1, 1, ReadWriteMode, GPIOGODRBase> ;
     using ODR0 = GPIOG_ODR_ODR0_Values<GPIOG::ODR, 0, 1, ReadWriteMode, GPIOGODRBase> ;
+    using SetResetRegister = GPIOG::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOG_ODR_ODR0_Values<GPIOG::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOG
     using BS2 = GPIOG_BSRR_BS2_Values<GPIOG::BSRR, 2, 1, WriteMode, GPIOGBSRRBase> ;
     using BS1 = GPIOG_BSRR_BS1_Values<GPIOG::BSRR, 1, 1, WriteMode, GPIOGBSRRBase> ;
     using BS0 = GPIOG_BSRR_BS0_Values<GPIOG::BSRR, 0, 1, WriteMode, GPIOGBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOG_BSRR_BS0_Values<GPIOG::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOG
     using LCK2 = GPIOG_LCKR_LCK2_Values<GPIOG::LCKR, 2, 1, ReadWriteMode, GPIOGLCKRBase> ;
     using LCK1 = GPIOG_LCKR_LCK1_Values<GPIOG::LCKR, 1, 1, ReadWriteMode, GPIOGLCKRBase> ;
     using LCK0 = GPIOG_LCKR_LCK0_Values<GPIOG::LCKR, 0, 1, ReadWriteMode, GPIOGLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOG_LCKR_LCK0_Values<GPIOG::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOG
     using AFRL2 = GPIOG_AFRL_AFRL2_Values<GPIOG::AFRL, 8, 4, ReadWriteMode, GPIOGAFRLBase> ;
     using AFRL1 = GPIOG_AFRL_AFRL1_Values<GPIOG::AFRL, 4, 4, ReadWriteMode, GPIOGAFRLBase> ;
     using AFRL0 = GPIOG_AFRL_AFRL0_Values<GPIOG::AFRL, 0, 4, ReadWriteMode, GPIOGAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOG_AFRL_AFRL0_Values<GPIOG::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,6 +310,10 @@ struct GPIOG
     using AFRH10 = GPIOG_AFRH_AFRH10_Values<GPIOG::AFRH, 8, 4, ReadWriteMode, GPIOGAFRHBase> ;
     using AFRH9 = GPIOG_AFRH_AFRH9_Values<GPIOG::AFRH, 4, 4, ReadWriteMode, GPIOGAFRHBase> ;
     using AFRH8 = GPIOG_AFRH_AFRH8_Values<GPIOG::AFRH, 0, 4, ReadWriteMode, GPIOGAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOG_AFRH_AFRH8_Values<GPIOG::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -298,12 +340,16 @@ struct GPIOG
     using BR13 = GPIOG_BRR_BR13_Values<GPIOG::BRR, 13, 1, WriteMode, GPIOGBRRBase> ;
     using BR14 = GPIOG_BRR_BR14_Values<GPIOG::BRR, 14, 1, WriteMode, GPIOGBRRBase> ;
     using BR15 = GPIOG_BRR_BR15_Values<GPIOG::BRR, 15, 1, WriteMode, GPIOGBRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    template<std::size_t index>
+    using Field = typename BRArray::template Field<index> ;
     using FieldValues = GPIOG_BRR_BR15_Values<GPIOG::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BRRPack  = Register<0x48001828, 32, WriteMode, GPIOGBRRBase, T...> ;
 
+  using Registers = TypesList<GPIOG::MODER, GPIOG::OTYPER, GPIOG::OSPEEDR, GPIOG::PUPDR, GPIOG::IDR, GPIOG::ODR, GPIOG::BSRR, GPIOG::LCKR, GPIOG::AFRL, GPIOG::AFRH, GPIOG::BRR> ;
 } ;
 
 #endif //#if !defined(GPIOGREGISTERS_HPP)
@@ -35,6 +35,8 @@ struct I2S2ext
     using MSTR = I2S2ext_CR1_MSTR_Values<I2S2ext::CR1, 2, 1, ReadWriteMode, I2S2extCR1Base> ;
     using CPOL = I2S2ext_CR1_CPOL_Values<I2S2ext::CR1, 1, 1, ReadWriteMode, I2S2extCR1Base> ;
     using CPHA = I2S2ext_CR1_CPHA_Values<I2S2ext::CR1, 0, 1, ReadWriteMode, I2S2extCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = I2S2ext_CR1_CPHA_Values<I2S2ext::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct I2S2ext
     using FRXTH = I2S2ext_CR2_FRXTH_Values<I2S2ext::CR2, 12, 1, ReadWriteMode, I2S2extCR2Base> ;
     using LDMA_RX = I2S2ext_CR2_LDMA_RX_Values<I2S2ext::CR2, 13, 1, ReadWriteMode, I2S2extCR2Base> ;
     using LDMA_TX = I2S2ext_CR2_LDMA_TX_Values<I2S2ext::CR2, 14, 1, ReadWriteMode, I2S2extCR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = I2S2ext_CR2_LDMA_TX_Values<I2S2ext::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,9 @@ struct I2S2ext
     using TIFRFE = I2S2ext_SR_TIFRFE_Values<I2S2ext::SR, 8, 1, ReadMode, I2S2extSRBase> ;
     using FRLVL = I2S2ext_SR_FRLVL_Values<I2S2ext::SR, 9, 2, ReadMode, I2S2extSRBase> ;
     using FTLVL = I2S2ext_SR_FTLVL_Values<I2S2ext::SR, 11, 2, ReadMode, I2S2extSRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2S2ext_SR_FTLVL_Values<I2S2ext::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +95,7 @@ struct I2S2ext
   struct DR : public RegisterBase<0x4000340C, 32, ReadWriteMode>
   {
     using DRField = I2S2ext_DR_DR_Values<I2S2ext::DR, 0, 16, ReadWriteMode, I2S2extDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2S2ext_DR_DR_Values<I2S2ext::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +107,7 @@ struct I2S2ext
   struct CRCPR : public RegisterBase<0x40003410, 32, ReadWriteMode>
   {
     using CRCPOLY = I2S2ext_CRCPR_CRCPOLY_Values<I2S2ext::CRCPR, 0, 16, ReadWriteMode, I2S2extCRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = I2S2ext_CRCPR_CRCPOLY_Values<I2S2ext::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +148,8 @@ struct I2S2ext
     using CKPOL = I2S2ext_I2SCFGR_CKPOL_Values<I2S2ext::I2SCFGR, 3, 1, ReadWriteMode, I2S2extI2SCFGRBase> ;
     using DATLEN = I2S2ext_I2SCFGR_DATLEN_Values<I2S2ext::I2SCFGR, 1, 2, ReadWriteMode, I2S2extI2SCFGRBase> ;
     using CHLEN = I2S2ext_I2SCFGR_CHLEN_Values<I2S2ext::I2SCFGR, 0, 1, ReadWriteMode, I2S2extI2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = I2S2ext_I2SCFGR_CHLEN_Values<I2S2ext::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,12 +163,14 @@ struct I2S2ext
     using MCKOE = I2S2ext_I2SPR_MCKOE_Values<I2S2ext::I2SPR, 9, 1, ReadWriteMode, I2S2extI2SPRBase> ;
     using ODD = I2S2ext_I2SPR_ODD_Values<I2S2ext::I2SPR, 8, 1, ReadWriteMode, I2S2extI2SPRBase> ;
     using I2SDIV = I2S2ext_I2SPR_I2SDIV_Values<I2S2ext::I2SPR, 0, 8, ReadWriteMode, I2S2extI2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = I2S2ext_I2SPR_I2SDIV_Values<I2S2ext::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003420, 32, ReadWriteMode, I2S2extI2SPRBase, T...> ;
 
+  using Registers = TypesList<I2S2ext::CR1, I2S2ext::CR2, I2S2ext::SR, I2S2ext::DR, I2S2ext::CRCPR, I2S2ext::RXCRCR, I2S2ext::TXCRCR, I2S2ext::I2SCFGR, I2S2ext::I2SPR> ;
 } ;
 
 #endif //#if !defined(I2S2EXTREGISTERS_HPP)
@@ -35,6 +35,8 @@ struct I2S3ext
     using MSTR = I2S3ext_CR1_MSTR_Values<I2S3ext::CR1, 2, 1, ReadWriteMode, I2S3extCR1Base> ;
     using CPOL = I2S3ext_CR1_CPOL_Values<I2S3ext::CR1, 1, 1, ReadWriteMode, I2S3extCR1Base> ;
     using CPHA = I2S3ext_CR1_CPHA_Values<I2S3ext::CR1, 0, 1, ReadWriteMode, I2S3extCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = I2S3ext_CR1_CPHA_Values<I2S3ext::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct I2S3ext
     using FRXTH = I2S3ext_CR2_FRXTH_Values<I2S3ext::CR2, 12, 1, ReadWriteMode, I2S3extCR2Base> ;
     using LDMA_RX = I2S3ext_CR2_LDMA_RX_Values<I2S3ext::CR2, 13, 1, ReadWriteMode, I2S3extCR2Base> ;
     using LDMA_TX = I2S3ext_CR2_LDMA_TX_Values<I2S3ext::CR2, 14, 1, ReadWriteMode, I2S3extCR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = I2S3ext_CR2_LDMA_TX_Values<I2S3ext::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,9 @@ struct I2S3ext
     using TIFRFE = I2S3ext_SR_TIFRFE_Values<I2S3ext::SR, 8, 1, ReadMode, I2S3extSRBase> ;
     using FRLVL = I2S3ext_SR_FRLVL_Values<I2S3ext::SR, 9, 2, ReadMode, I2S3extSRBase> ;
     using FTLVL = I2S3ext_SR_FTLVL_Values<I2S3ext::SR, 11, 2, ReadMode, I2S3extSRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2S3ext_SR_FTLVL_Values<I2S3ext::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +95,7 @@ struct I2S3ext
   struct DR : public RegisterBase<0x4000400C, 32, ReadWriteMode>
   {
     using DRField = I2S3ext_DR_DR_Values<I2S3ext::DR, 0, 16, ReadWriteMode, I2S3extDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2S3ext_DR_DR_Values<I2S3ext::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +107,7 @@ struct I2S3ext
   struct CRCPR : public RegisterBase<0x40004010, 32, ReadWriteMode>
   {
     using CRCPOLY = I2S3ext_CRCPR_CRCPOLY_Values<I2S3ext::CRCPR, 0, 16, ReadWriteMode, I2S3extCRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = I2S3ext_CRCPR_CRCPOLY_Values<I2S3ext::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +148,8 @@ struct I2S3ext
     using CKPOL = I2S3ext_I2SCFGR_CKPOL_Values<I2S3ext::I2SCFGR, 3, 1, ReadWriteMode, I2S3extI2SCFGRBase> ;
     using DATLEN = I2S3ext_I2SCFGR_DATLEN_Values<I2S3ext::I2SCFGR, 1, 2, ReadWriteMode, I2S3extI2SCFGRBase> ;
     using CHLEN = I2S3ext_I2SCFGR_CHLEN_Values<I2S3ext::I2SCFGR, 0, 1, ReadWriteMode, I2S3extI2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = I2S3ext_I2SCFGR_CHLEN_Values<I2S3ext::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,12 +163,14 @@ struct I2S3ext
     using MCKOE = I2S3ext_I2SPR_MCKOE_Values<I2S3ext::I2SPR, 9, 1, ReadWriteMode, I2S3extI2SPRBase> ;
     using ODD = I2S3ext_I2SPR_ODD_Values<I2S3ext::I2SPR, 8, 1, ReadWriteMode, I2S3extI2SPRBase> ;
     using I2SDIV = I2S3ext_I2SPR_I2SDIV_Values<I2S3ext::I2SPR, 0, 8, ReadWriteMode, I2S3extI2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = I2S3ext_I2SPR_I2SDIV_Values<I2S3ext::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40004020, 32, ReadWriteMode, I2S3extI2SPRBase, T...> ;
 
+  using Registers = TypesList<I2S3ext::CR1, I2S3ext::CR2, I2S3ext::SR, I2S3ext::DR, I2S3ext::CRCPR, I2S3ext::RXCRCR, I2S3ext::TXCRCR, I2S3ext::I2SCFGR, I2S3ext::I2SPR> ;
 } ;
 
 #endif //#if !defined(I2S3EXTREGISTERS_HPP)
@@ -33,6 +33,7 @@ struct IWDG
   struct PR : public RegisterBase<0x40003004, 32, ReadWriteMode>
   {
     using PRField = IWDG_PR_PR_Values<IWDG::PR, 0, 3, ReadWriteMode, IWDGPRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = IWDG_PR_PR_Values<IWDG::PR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct IWDG
   struct RLR : public RegisterBase<0x40003008, 32, ReadWriteMode>
   {
     using RL = IWDG_RLR_RL_Values<IWDG::RLR, 0, 12, ReadWriteMode, IWDGRLRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = IWDG_RLR_RL_Values<IWDG::RLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -68,12 +70,14 @@ struct IWDG
   struct WINR : public RegisterBase<0x40003010, 32, ReadWriteMode>
   {
     using WIN = IWDG_WINR_WIN_Values<IWDG::WINR, 0, 12, ReadWriteMode, IWDGWINRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = IWDG_WINR_WIN_Values<IWDG::WINR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using WINRPack  = Register<0x40003010, 32, ReadWriteMode, IWDGWINRBase, T...> ;
 
+  using Registers = TypesList<IWDG::KR, IWDG::PR, IWDG::RLR, IWDG::SR, IWDG::WINR> ;
 } ;
 
 #endif //#if !defined(IWDGREGISTERS_HPP)
@@ -28,6 +28,7 @@ struct PWR
     using PVDE = PWR_CR_PVDE_Values<PWR::CR, 4, 1, ReadWriteMode, PWRCRBase> ;
     using PLS = PWR_CR_PLS_Values<PWR::CR, 5, 3, ReadWriteMode, PWRCRBase> ;
     using DBP = PWR_CR_DBP_Values<PWR::CR, 8, 1, ReadWriteMode, PWRCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFU ;
     using FieldValues = PWR_CR_DBP_Values<PWR::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,12 +44,14 @@ struct PWR
     using PVDO = PWR_CSR_PVDO_Values<PWR::CSR, 2, 1, ReadMode, PWRCSRBase> ;
     using EWUP1 = PWR_CSR_EWUP1_Values<PWR::CSR, 8, 1, ReadWriteMode, PWRCSRBase> ;
     using EWUP2 = PWR_CSR_EWUP2_Values<PWR::CSR, 9, 1, ReadWriteMode, PWRCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = PWR_CSR_EWUP2_Values<PWR::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSRPack  = Register<0x40007004, 32, ReadWriteMode, PWRCSRBase, T...> ;
 
+  using Registers = TypesList<PWR::CR, PWR::CSR> ;
 } ;
 
 #endif //#if !defined(PWRREGISTERS_HPP)
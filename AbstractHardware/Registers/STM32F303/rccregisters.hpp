@@ -31,6 +31,7 @@ struct RCC
     using CSSON = RCC_CR_CSSON_Values<RCC::CR, 19, 1, ReadWriteMode, RCCCRBase> ;
     using PLLON = RCC_CR_PLLON_Values<RCC::CR, 24, 1, ReadWriteMode, RCCCRBase> ;
     using PLLRDY = RCC_CR_PLLRDY_Values<RCC::CR, 25, 1, ReadMode, RCCCRBase> ;
+    static constexpr Type SnapshotMask = 0x10D00F9U ;
     using FieldValues = RCC_CR_PLLRDY_Values<RCC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +54,7 @@ struct RCC
     using MCO = RCC_CFGR_MCO_Values<RCC::CFGR, 24, 3, ReadWriteMode, RCCCFGRBase> ;
     using MCOF = RCC_CFGR_MCOF_Values<RCC::CFGR, 28, 1, ReadMode, RCCCFGRBase> ;
     using I2SSRC = RCC_CFGR_I2SSRC_Values<RCC::CFGR, 23, 1, ReadWriteMode, RCCCFGRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFBFF3U ;
     using FieldValues = RCC_CFGR_I2SSRC_Values<RCC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +82,7 @@ struct RCC
     using HSERDYC = RCC_CIR_HSERDYC_Values<RCC::CIR, 19, 1, WriteMode, RCCCIRBase> ;
     using PLLRDYC = RCC_CIR_PLLRDYC_Values<RCC::CIR, 20, 1, WriteMode, RCCCIRBase> ;
     using CSSC = RCC_CIR_CSSC_Values<RCC::CIR, 23, 1, WriteMode, RCCCIRBase> ;
+    static constexpr Type SnapshotMask = 0x9F1F00U ;
     using FieldValues = RCC_CIR_CSSC_Values<RCC::CIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +101,7 @@ struct RCC
     using TIM15RST = RCC_APB2RSTR_TIM15RST_Values<RCC::APB2RSTR, 16, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using TIM16RST = RCC_APB2RSTR_TIM16RST_Values<RCC::APB2RSTR, 17, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using TIM17RST = RCC_APB2RSTR_TIM17RST_Values<RCC::APB2RSTR, 18, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x77801U ;
     using FieldValues = RCC_APB2RSTR_TIM17RST_Values<RCC::APB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +131,7 @@ struct RCC
     using PWRRST = RCC_APB1RSTR_PWRRST_Values<RCC::APB1RSTR, 28, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using DACRST = RCC_APB1RSTR_DACRST_Values<RCC::APB1RSTR, 29, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using I2C3RST = RCC_APB1RSTR_I2C3RST_Values<RCC::APB1RSTR, 30, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x72FEC837U ;
     using FieldValues = RCC_APB1RSTR_I2C3RST_Values<RCC::APB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +159,7 @@ struct RCC
     using TSCEN = RCC_AHBENR_TSCEN_Values<RCC::AHBENR, 24, 1, ReadWriteMode, RCCAHBENRBase> ;
     using ADC12EN = RCC_AHBENR_ADC12EN_Values<RCC::AHBENR, 28, 1, ReadWriteMode, RCCAHBENRBase> ;
     using ADC34EN = RCC_AHBENR_ADC34EN_Values<RCC::AHBENR, 29, 1, ReadWriteMode, RCCAHBENRBase> ;
+    static constexpr Type SnapshotMask = 0x31FF0077U ;
     using FieldValues = RCC_AHBENR_ADC34EN_Values<RCC::AHBENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -172,6 +178,7 @@ struct RCC
     using TIM15EN = RCC_APB2ENR_TIM15EN_Values<RCC::APB2ENR, 16, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using TIM16EN = RCC_APB2ENR_TIM16EN_Values<RCC::APB2ENR, 17, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using TIM17EN = RCC_APB2ENR_TIM17EN_Values<RCC::APB2ENR, 18, 1, ReadWriteMode, RCCAPB2ENRBase> ;
+    static constexpr Type SnapshotMask = 0x77801U ;
     using FieldValues = RCC_APB2ENR_TIM17EN_Values<RCC::APB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -202,6 +209,7 @@ struct RCC
     using PWREN = RCC_APB1ENR_PWREN_Values<RCC::APB1ENR, 28, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using DACEN = RCC_APB1ENR_DACEN_Values<RCC::APB1ENR, 29, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using I2C3EN = RCC_APB1ENR_I2C3EN_Values<RCC::APB1ENR, 30, 1, ReadWriteMode, RCCAPB1ENRBase> ;
+    static constexpr Type SnapshotMask = 0x76FEC837U ;
     using FieldValues = RCC_APB1ENR_I2C3EN_Values<RCC::APB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +227,7 @@ struct RCC
     using RTCSEL = RCC_BDCR_RTCSEL_Values<RCC::BDCR, 8, 2, ReadWriteMode, RCCBDCRBase> ;
     using RTCEN = RCC_BDCR_RTCEN_Values<RCC::BDCR, 15, 1, ReadWriteMode, RCCBDCRBase> ;
     using BDRST = RCC_BDCR_BDRST_Values<RCC::BDCR, 16, 1, ReadWriteMode, RCCBDCRBase> ;
+    static constexpr Type SnapshotMask = 0x1831DU ;
     using FieldValues = RCC_BDCR_BDRST_Values<RCC::BDCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -239,6 +248,7 @@ struct RCC
     using IWDGRSTF = RCC_CSR_IWDGRSTF_Values<RCC::CSR, 29, 1, ReadWriteMode, RCCCSRBase> ;
     using WWDGRSTF = RCC_CSR_WWDGRSTF_Values<RCC::CSR, 30, 1, ReadWriteMode, RCCCSRBase> ;
     using LPWRRSTF = RCC_CSR_LPWRRSTF_Values<RCC::CSR, 31, 1, ReadWriteMode, RCCCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RCC_CSR_LPWRRSTF_Values<RCC::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -261,6 +271,7 @@ struct RCC
     using TSCRST = RCC_AHBRSTR_TSCRST_Values<RCC::AHBRSTR, 24, 1, ReadWriteMode, RCCAHBRSTRBase> ;
     using ADC12RST = RCC_AHBRSTR_ADC12RST_Values<RCC::AHBRSTR, 28, 1, ReadWriteMode, RCCAHBRSTRBase> ;
     using ADC34RST = RCC_AHBRSTR_ADC34RST_Values<RCC::AHBRSTR, 29, 1, ReadWriteMode, RCCAHBRSTRBase> ;
+    static constexpr Type SnapshotMask = 0x31FF0020U ;
     using FieldValues = RCC_AHBRSTR_ADC34RST_Values<RCC::AHBRSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +285,7 @@ struct RCC
     using PREDIV = RCC_CFGR2_PREDIV_Values<RCC::CFGR2, 0, 4, ReadWriteMode, RCCCFGR2Base> ;
     using ADC12PRES = RCC_CFGR2_ADC12PRES_Values<RCC::CFGR2, 4, 5, ReadWriteMode, RCCCFGR2Base> ;
     using ADC34PRES = RCC_CFGR2_ADC34PRES_Values<RCC::CFGR2, 9, 5, ReadWriteMode, RCCCFGR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFU ;
     using FieldValues = RCC_CFGR2_ADC34PRES_Values<RCC::CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -294,12 +306,14 @@ struct RCC
     using TIM8SW = RCC_CFGR3_TIM8SW_Values<RCC::CFGR3, 9, 1, ReadWriteMode, RCCCFGR3Base> ;
     using UART4SW = RCC_CFGR3_UART4SW_Values<RCC::CFGR3, 20, 2, ReadWriteMode, RCCCFGR3Base> ;
     using UART5SW = RCC_CFGR3_UART5SW_Values<RCC::CFGR3, 22, 2, ReadWriteMode, RCCCFGR3Base> ;
+    static constexpr Type SnapshotMask = 0xFF0373U ;
     using FieldValues = RCC_CFGR3_UART5SW_Values<RCC::CFGR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CFGR3Pack  = Register<0x40021030, 32, ReadWriteMode, RCCCFGR3Base, T...> ;
 
+  using Registers = TypesList<RCC::CR, RCC::CFGR, RCC::CIR, RCC::APB2RSTR, RCC::APB1RSTR, RCC::AHBENR, RCC::APB2ENR, RCC::APB1ENR, RCC::BDCR, RCC::CSR, RCC::AHBRSTR, RCC::CFGR2, RCC::CFGR3> ;
 } ;
 
 #endif //#if !defined(RCCREGISTERS_HPP)
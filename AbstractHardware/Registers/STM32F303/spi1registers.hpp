@@ -35,6 +35,8 @@ struct SPI1
     using MSTR = SPI1_CR1_MSTR_Values<SPI1::CR1, 2, 1, ReadWriteMode, SPI1CR1Base> ;
     using CPOL = SPI1_CR1_CPOL_Values<SPI1::CR1, 1, 1, ReadWriteMode, SPI1CR1Base> ;
     using CPHA = SPI1_CR1_CPHA_Values<SPI1::CR1, 0, 1, ReadWriteMode, SPI1CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI1_CR1_CPHA_Values<SPI1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct SPI1
     using FRXTH = SPI1_CR2_FRXTH_Values<SPI1::CR2, 12, 1, ReadWriteMode, SPI1CR2Base> ;
     using LDMA_RX = SPI1_CR2_LDMA_RX_Values<SPI1::CR2, 13, 1, ReadWriteMode, SPI1CR2Base> ;
     using LDMA_TX = SPI1_CR2_LDMA_TX_Values<SPI1::CR2, 14, 1, ReadWriteMode, SPI1CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SPI1_CR2_LDMA_TX_Values<SPI1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,9 @@ struct SPI1
     using TIFRFE = SPI1_SR_TIFRFE_Values<SPI1::SR, 8, 1, ReadMode, SPI1SRBase> ;
     using FRLVL = SPI1_SR_FRLVL_Values<SPI1::SR, 9, 2, ReadMode, SPI1SRBase> ;
     using FTLVL = SPI1_SR_FTLVL_Values<SPI1::SR, 11, 2, ReadMode, SPI1SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI1_SR_FTLVL_Values<SPI1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +95,7 @@ struct SPI1
   struct DR : public RegisterBase<0x4001300C, 32, ReadWriteMode>
   {
     using DRField = SPI1_DR_DR_Values<SPI1::DR, 0, 16, ReadWriteMode, SPI1DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI1_DR_DR_Values<SPI1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +107,7 @@ struct SPI1
   struct CRCPR : public RegisterBase<0x40013010, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI1_CRCPR_CRCPOLY_Values<SPI1::CRCPR, 0, 16, ReadWriteMode, SPI1CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI1_CRCPR_CRCPOLY_Values<SPI1::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +148,8 @@ struct SPI1
     using CKPOL = SPI1_I2SCFGR_CKPOL_Values<SPI1::I2SCFGR, 3, 1, ReadWriteMode, SPI1I2SCFGRBase> ;
     using DATLEN = SPI1_I2SCFGR_DATLEN_Values<SPI1::I2SCFGR, 1, 2, ReadWriteMode, SPI1I2SCFGRBase> ;
     using CHLEN = SPI1_I2SCFGR_CHLEN_Values<SPI1::I2SCFGR, 0, 1, ReadWriteMode, SPI1I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI1_I2SCFGR_CHLEN_Values<SPI1::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,12 +163,14 @@ struct SPI1
     using MCKOE = SPI1_I2SPR_MCKOE_Values<SPI1::I2SPR, 9, 1, ReadWriteMode, SPI1I2SPRBase> ;
     using ODD = SPI1_I2SPR_ODD_Values<SPI1::I2SPR, 8, 1, ReadWriteMode, SPI1I2SPRBase> ;
     using I2SDIV = SPI1_I2SPR_I2SDIV_Values<SPI1::I2SPR, 0, 8, ReadWriteMode, SPI1I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI1_I2SPR_I2SDIV_Values<SPI1::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40013020, 32, ReadWriteMode, SPI1I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI1::CR1, SPI1::CR2, SPI1::SR, SPI1::DR, SPI1::CRCPR, SPI1::RXCRCR, SPI1::TXCRCR, SPI1::I2SCFGR, SPI1::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI1REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI2
     using MSTR = SPI2_CR1_MSTR_Values<SPI2::CR1, 2, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPOL = SPI2_CR1_CPOL_Values<SPI2::CR1, 1, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPHA = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 1, ReadWriteMode, SPI2CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct SPI2
     using FRXTH = SPI2_CR2_FRXTH_Values<SPI2::CR2, 12, 1, ReadWriteMode, SPI2CR2Base> ;
     using LDMA_RX = SPI2_CR2_LDMA_RX_Values<SPI2::CR2, 13, 1, ReadWriteMode, SPI2CR2Base> ;
     using LDMA_TX = SPI2_CR2_LDMA_TX_Values<SPI2::CR2, 14, 1, ReadWriteMode, SPI2CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SPI2_CR2_LDMA_TX_Values<SPI2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,9 @@ struct SPI2
     using TIFRFE = SPI2_SR_TIFRFE_Values<SPI2::SR, 8, 1, ReadMode, SPI2SRBase> ;
     using FRLVL = SPI2_SR_FRLVL_Values<SPI2::SR, 9, 2, ReadMode, SPI2SRBase> ;
     using FTLVL = SPI2_SR_FTLVL_Values<SPI2::SR, 11, 2, ReadMode, SPI2SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_SR_FTLVL_Values<SPI2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +95,7 @@ struct SPI2
   struct DR : public RegisterBase<0x4000380C, 32, ReadWriteMode>
   {
     using DRField = SPI2_DR_DR_Values<SPI2::DR, 0, 16, ReadWriteMode, SPI2DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_DR_DR_Values<SPI2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +107,7 @@ struct SPI2
   struct CRCPR : public RegisterBase<0x40003810, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 16, ReadWriteMode, SPI2CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +148,8 @@ struct SPI2
     using CKPOL = SPI2_I2SCFGR_CKPOL_Values<SPI2::I2SCFGR, 3, 1, ReadWriteMode, SPI2I2SCFGRBase> ;
     using DATLEN = SPI2_I2SCFGR_DATLEN_Values<SPI2::I2SCFGR, 1, 2, ReadWriteMode, SPI2I2SCFGRBase> ;
     using CHLEN = SPI2_I2SCFGR_CHLEN_Values<SPI2::I2SCFGR, 0, 1, ReadWriteMode, SPI2I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI2_I2SCFGR_CHLEN_Values<SPI2::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,12 +163,14 @@ struct SPI2
     using MCKOE = SPI2_I2SPR_MCKOE_Values<SPI2::I2SPR, 9, 1, ReadWriteMode, SPI2I2SPRBase> ;
     using ODD = SPI2_I2SPR_ODD_Values<SPI2::I2SPR, 8, 1, ReadWriteMode, SPI2I2SPRBase> ;
     using I2SDIV = SPI2_I2SPR_I2SDIV_Values<SPI2::I2SPR, 0, 8, ReadWriteMode, SPI2I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI2_I2SPR_I2SDIV_Values<SPI2::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003820, 32, ReadWriteMode, SPI2I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI2::CR1, SPI2::CR2, SPI2::SR, SPI2::DR, SPI2::CRCPR, SPI2::RXCRCR, SPI2::TXCRCR, SPI2::I2SCFGR, SPI2::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI2REGISTERS_HPP)
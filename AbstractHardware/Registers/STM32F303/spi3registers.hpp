@@ -35,6 +35,8 @@ struct SPI3
     using MSTR = SPI3_CR1_MSTR_Values<SPI3::CR1, 2, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPOL = SPI3_CR1_CPOL_Values<SPI3::CR1, 1, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPHA = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 1, ReadWriteMode, SPI3CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct SPI3
     using FRXTH = SPI3_CR2_FRXTH_Values<SPI3::CR2, 12, 1, ReadWriteMode, SPI3CR2Base> ;
     using LDMA_RX = SPI3_CR2_LDMA_RX_Values<SPI3::CR2, 13, 1, ReadWriteMode, SPI3CR2Base> ;
     using LDMA_TX = SPI3_CR2_LDMA_TX_Values<SPI3::CR2, 14, 1, ReadWriteMode, SPI3CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SPI3_CR2_LDMA_TX_Values<SPI3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,9 @@ struct SPI3
     using TIFRFE = SPI3_SR_TIFRFE_Values<SPI3::SR, 8, 1, ReadMode, SPI3SRBase> ;
     using FRLVL = SPI3_SR_FRLVL_Values<SPI3::SR, 9, 2, ReadMode, SPI3SRBase> ;
     using FTLVL = SPI3_SR_FTLVL_Values<SPI3::SR, 11, 2, ReadMode, SPI3SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI3_SR_FTLVL_Values<SPI3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +95,7 @@ struct SPI3
   struct DR : public RegisterBase<0x40003C0C, 32, ReadWriteMode>
   {
     using DRField = SPI3_DR_DR_Values<SPI3::DR, 0, 16, ReadWriteMode, SPI3DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI3_DR_DR_Values<SPI3::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +107,7 @@ struct SPI3
   struct CRCPR : public RegisterBase<0x40003C10, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 16, ReadWriteMode, SPI3CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -140,6 +148,8 @@ struct SPI3
     using CKPOL = SPI3_I2SCFGR_CKPOL_Values<SPI3::I2SCFGR, 3, 1, ReadWriteMode, SPI3I2SCFGRBase> ;
     using DATLEN = SPI3_I2SCFGR_DATLEN_Values<SPI3::I2SCFGR, 1, 2, ReadWriteMode, SPI3I2SCFGRBase> ;
     using CHLEN = SPI3_I2SCFGR_CHLEN_Values<SPI3::I2SCFGR, 0, 1, ReadWriteMode, SPI3I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI3_I2SCFGR_CHLEN_Values<SPI3::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,12 +163,14 @@ struct SPI3
     using MCKOE = SPI3_I2SPR_MCKOE_Values<SPI3::I2SPR, 9, 1, ReadWriteMode, SPI3I2SPRBase> ;
     using ODD = SPI3_I2SPR_ODD_Values<SPI3::I2SPR, 8, 1, ReadWriteMode, SPI3I2SPRBase> ;
     using I2SDIV = SPI3_I2SPR_I2SDIV_Values<SPI3::I2SPR, 0, 8, ReadWriteMode, SPI3I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI3_I2SPR_I2SDIV_Values<SPI3::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003C20, 32, ReadWriteMode, SPI3I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI3::CR1, SPI3::CR2, SPI3::SR, SPI3::DR, SPI3::CRCPR, SPI3::RXCRCR, SPI3::TXCRCR, SPI3::I2SCFGR, SPI3::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI3REGISTERS_HPP)
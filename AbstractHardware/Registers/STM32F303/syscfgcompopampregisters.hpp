@@ -39,6 +39,7 @@ struct SYSCFG_COMP_OPAMP
     using I2C2_FM = SYSCFG_COMP_OPAMP_SYSCFG_CFGR1_I2C2_FM_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR1, 21, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_CFGR1Base> ;
     using ENCODER_MODE = SYSCFG_COMP_OPAMP_SYSCFG_CFGR1_ENCODER_MODE_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR1, 22, 2, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_CFGR1Base> ;
     using FPU_IT = SYSCFG_COMP_OPAMP_SYSCFG_CFGR1_FPU_IT_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR1, 26, 6, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_CFGR1Base> ;
+    static constexpr Type SnapshotMask = 0xFCFF79E3U ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_CFGR1_FPU_IT_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +54,7 @@ struct SYSCFG_COMP_OPAMP
     using EXTI2 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR1_EXTI2_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR1, 8, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR1Base> ;
     using EXTI1 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR1_EXTI1_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR1, 4, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR1Base> ;
     using EXTI0 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR1_EXTI0_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR1, 0, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR1_EXTI0_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -67,6 +69,7 @@ struct SYSCFG_COMP_OPAMP
     using EXTI6 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR2_EXTI6_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR2, 8, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR2Base> ;
     using EXTI5 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR2_EXTI5_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR2, 4, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR2Base> ;
     using EXTI4 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR2_EXTI4_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR2, 0, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR2_EXTI4_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +84,7 @@ struct SYSCFG_COMP_OPAMP
     using EXTI10 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR3_EXTI10_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR3, 8, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR3Base> ;
     using EXTI9 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR3_EXTI9_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR3, 4, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR3Base> ;
     using EXTI8 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR3_EXTI8_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR3, 0, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR3_EXTI8_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +99,7 @@ struct SYSCFG_COMP_OPAMP
     using EXTI14 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR4_EXTI14_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR4, 8, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR4Base> ;
     using EXTI13 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR4_EXTI13_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR4, 4, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR4Base> ;
     using EXTI12 = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR4_EXTI12_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR4, 0, 4, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_EXTICR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_EXTICR4_EXTI12_Values<SYSCFG_COMP_OPAMP::SYSCFG_EXTICR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +115,7 @@ struct SYSCFG_COMP_OPAMP
     using PVD_LOCK = SYSCFG_COMP_OPAMP_SYSCFG_CFGR2_PVD_LOCK_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR2, 2, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_CFGR2Base> ;
     using BYP_ADD_PAR = SYSCFG_COMP_OPAMP_SYSCFG_CFGR2_BYP_ADD_PAR_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR2, 4, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_CFGR2Base> ;
     using SRAM_PEF = SYSCFG_COMP_OPAMP_SYSCFG_CFGR2_SRAM_PEF_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR2, 8, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_CFGR2Base> ;
+    static constexpr Type SnapshotMask = 0x117U ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_CFGR2_SRAM_PEF_Values<SYSCFG_COMP_OPAMP::SYSCFG_CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -128,6 +134,7 @@ struct SYSCFG_COMP_OPAMP
     using PAGE5_WP = SYSCFG_COMP_OPAMP_SYSCFG_RCR_PAGE5_WP_Values<SYSCFG_COMP_OPAMP::SYSCFG_RCR, 5, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_RCRBase> ;
     using PAGE6_WP = SYSCFG_COMP_OPAMP_SYSCFG_RCR_PAGE6_WP_Values<SYSCFG_COMP_OPAMP::SYSCFG_RCR, 6, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_RCRBase> ;
     using PAGE7_WP = SYSCFG_COMP_OPAMP_SYSCFG_RCR_PAGE7_WP_Values<SYSCFG_COMP_OPAMP::SYSCFG_RCR, 7, 1, ReadWriteMode, SYSCFG_COMP_OPAMPSYSCFG_RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_SYSCFG_RCR_PAGE7_WP_Values<SYSCFG_COMP_OPAMP::SYSCFG_RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -148,6 +155,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP1_BLANKING = SYSCFG_COMP_OPAMP_COMP1_CSR_COMP1_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP1_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP1_CSRBase> ;
     using COMP1OUT = SYSCFG_COMP_OPAMP_COMP1_CSR_COMP1OUT_Values<SYSCFG_COMP_OPAMP::COMP1_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPCOMP1_CSRBase> ;
     using COMP1LOCK = SYSCFG_COMP_OPAMP_COMP1_CSR_COMP1LOCK_Values<SYSCFG_COMP_OPAMP::COMP1_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP1_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBC7FU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP1_CSR_COMP1LOCK_Values<SYSCFG_COMP_OPAMP::COMP1_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -168,6 +176,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP2HYST = SYSCFG_COMP_OPAMP_COMP2_CSR_COMP2HYST_Values<SYSCFG_COMP_OPAMP::COMP2_CSR, 16, 2, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP2_CSRBase> ;
     using COMP2_BLANKING = SYSCFG_COMP_OPAMP_COMP2_CSR_COMP2_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP2_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP2_CSRBase> ;
     using COMP2LOCK = SYSCFG_COMP_OPAMP_COMP2_CSR_COMP2LOCK_Values<SYSCFG_COMP_OPAMP::COMP2_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP2_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBEFDU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP2_CSR_COMP2LOCK_Values<SYSCFG_COMP_OPAMP::COMP2_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -188,6 +197,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP3_BLANKING = SYSCFG_COMP_OPAMP_COMP3_CSR_COMP3_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP3_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP3_CSRBase> ;
     using COMP3OUT = SYSCFG_COMP_OPAMP_COMP3_CSR_COMP3OUT_Values<SYSCFG_COMP_OPAMP::COMP3_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPCOMP3_CSRBase> ;
     using COMP3LOCK = SYSCFG_COMP_OPAMP_COMP3_CSR_COMP3LOCK_Values<SYSCFG_COMP_OPAMP::COMP3_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP3_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBCFDU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP3_CSR_COMP3LOCK_Values<SYSCFG_COMP_OPAMP::COMP3_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +219,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP4_BLANKING = SYSCFG_COMP_OPAMP_COMP4_CSR_COMP4_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP4_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP4_CSRBase> ;
     using COMP4OUT = SYSCFG_COMP_OPAMP_COMP4_CSR_COMP4OUT_Values<SYSCFG_COMP_OPAMP::COMP4_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPCOMP4_CSRBase> ;
     using COMP4LOCK = SYSCFG_COMP_OPAMP_COMP4_CSR_COMP4LOCK_Values<SYSCFG_COMP_OPAMP::COMP4_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP4_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBEFDU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP4_CSR_COMP4LOCK_Values<SYSCFG_COMP_OPAMP::COMP4_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +240,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP5_BLANKING = SYSCFG_COMP_OPAMP_COMP5_CSR_COMP5_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP5_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP5_CSRBase> ;
     using COMP5OUT = SYSCFG_COMP_OPAMP_COMP5_CSR_COMP5OUT_Values<SYSCFG_COMP_OPAMP::COMP5_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPCOMP5_CSRBase> ;
     using COMP5LOCK = SYSCFG_COMP_OPAMP_COMP5_CSR_COMP5LOCK_Values<SYSCFG_COMP_OPAMP::COMP5_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP5_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBCFDU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP5_CSR_COMP5LOCK_Values<SYSCFG_COMP_OPAMP::COMP5_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -250,6 +262,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP6_BLANKING = SYSCFG_COMP_OPAMP_COMP6_CSR_COMP6_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP6_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP6_CSRBase> ;
     using COMP6OUT = SYSCFG_COMP_OPAMP_COMP6_CSR_COMP6OUT_Values<SYSCFG_COMP_OPAMP::COMP6_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPCOMP6_CSRBase> ;
     using COMP6LOCK = SYSCFG_COMP_OPAMP_COMP6_CSR_COMP6LOCK_Values<SYSCFG_COMP_OPAMP::COMP6_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP6_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBEFDU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP6_CSR_COMP6LOCK_Values<SYSCFG_COMP_OPAMP::COMP6_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +283,7 @@ struct SYSCFG_COMP_OPAMP
     using COMP7_BLANKING = SYSCFG_COMP_OPAMP_COMP7_CSR_COMP7_BLANKING_Values<SYSCFG_COMP_OPAMP::COMP7_CSR, 18, 3, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP7_CSRBase> ;
     using COMP7OUT = SYSCFG_COMP_OPAMP_COMP7_CSR_COMP7OUT_Values<SYSCFG_COMP_OPAMP::COMP7_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPCOMP7_CSRBase> ;
     using COMP7LOCK = SYSCFG_COMP_OPAMP_COMP7_CSR_COMP7LOCK_Values<SYSCFG_COMP_OPAMP::COMP7_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPCOMP7_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x801FBCFDU ;
     using FieldValues = SYSCFG_COMP_OPAMP_COMP7_CSR_COMP7LOCK_Values<SYSCFG_COMP_OPAMP::COMP7_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +310,7 @@ struct SYSCFG_COMP_OPAMP
     using TSTREF = SYSCFG_COMP_OPAMP_OPAMP1_CSR_TSTREF_Values<SYSCFG_COMP_OPAMP::OPAMP1_CSR, 29, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP1_CSRBase> ;
     using OUTCAL = SYSCFG_COMP_OPAMP_OPAMP1_CSR_OUTCAL_Values<SYSCFG_COMP_OPAMP::OPAMP1_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPOPAMP1_CSRBase> ;
     using LOCK = SYSCFG_COMP_OPAMP_OPAMP1_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP1_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP1_CSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFFFFEFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_OPAMP1_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP1_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -322,6 +337,7 @@ struct SYSCFG_COMP_OPAMP
     using TSTREF = SYSCFG_COMP_OPAMP_OPAMP2_CSR_TSTREF_Values<SYSCFG_COMP_OPAMP::OPAMP2_CSR, 29, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP2_CSRBase> ;
     using OUTCAL = SYSCFG_COMP_OPAMP_OPAMP2_CSR_OUTCAL_Values<SYSCFG_COMP_OPAMP::OPAMP2_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPOPAMP2_CSRBase> ;
     using LOCK = SYSCFG_COMP_OPAMP_OPAMP2_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP2_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP2_CSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFFFFEFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_OPAMP2_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP2_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -348,6 +364,7 @@ struct SYSCFG_COMP_OPAMP
     using TSTREF = SYSCFG_COMP_OPAMP_OPAMP3_CSR_TSTREF_Values<SYSCFG_COMP_OPAMP::OPAMP3_CSR, 29, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP3_CSRBase> ;
     using OUTCAL = SYSCFG_COMP_OPAMP_OPAMP3_CSR_OUTCAL_Values<SYSCFG_COMP_OPAMP::OPAMP3_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPOPAMP3_CSRBase> ;
     using LOCK = SYSCFG_COMP_OPAMP_OPAMP3_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP3_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP3_CSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFFFFEFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_OPAMP3_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP3_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -374,12 +391,14 @@ struct SYSCFG_COMP_OPAMP
     using TSTREF = SYSCFG_COMP_OPAMP_OPAMP4_CSR_TSTREF_Values<SYSCFG_COMP_OPAMP::OPAMP4_CSR, 29, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP4_CSRBase> ;
     using OUTCAL = SYSCFG_COMP_OPAMP_OPAMP4_CSR_OUTCAL_Values<SYSCFG_COMP_OPAMP::OPAMP4_CSR, 30, 1, ReadMode, SYSCFG_COMP_OPAMPOPAMP4_CSRBase> ;
     using LOCK = SYSCFG_COMP_OPAMP_OPAMP4_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP4_CSR, 31, 1, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP4_CSRBase> ;
+    static constexpr Type SnapshotMask = 0xBFFFFFEFU ;
     using FieldValues = SYSCFG_COMP_OPAMP_OPAMP4_CSR_LOCK_Values<SYSCFG_COMP_OPAMP::OPAMP4_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OPAMP4_CSRPack  = Register<0x40010044, 32, ReadWriteMode, SYSCFG_COMP_OPAMPOPAMP4_CSRBase, T...> ;
 
+  using Registers = TypesList<SYSCFG_COMP_OPAMP::SYSCFG_CFGR1, SYSCFG_COMP_OPAMP::SYSCFG_EXTICR1, SYSCFG_COMP_OPAMP::SYSCFG_EXTICR2, SYSCFG_COMP_OPAMP::SYSCFG_EXTICR3, SYSCFG_COMP_OPAMP::SYSCFG_EXTICR4, SYSCFG_COMP_OPAMP::SYSCFG_CFGR2, SYSCFG_COMP_OPAMP::SYSCFG_RCR, SYSCFG_COMP_OPAMP::COMP1_CSR, SYSCFG_COMP_OPAMP::COMP2_CSR, SYSCFG_COMP_OPAMP::COMP3_CSR, SYSCFG_COMP_OPAMP::COMP4_CSR, SYSCFG_COMP_OPAMP::COMP5_CSR, SYSCFG_COMP_OPAMP::COMP6_CSR, SYSCFG_COMP_OPAMP::COMP7_CSR, SYSCFG_COMP_OPAMP::OPAMP1_CSR, SYSCFG_COMP_OPAMP::OPAMP2_CSR, SYSCFG_COMP_OPAMP::OPAMP3_CSR, SYSCFG_COMP_OPAMP::OPAMP4_CSR> ;
 } ;
 
 #endif //#if !defined(SYSCFGCOMPOPAMPREGISTERS_HPP)
@@ -28,6 +28,8 @@ struct TIM15
     using ARPE = TIM15_CR1_ARPE_Values<TIM15::CR1, 7, 1, ReadWriteMode, TIM15CR1Base> ;
     using CKD = TIM15_CR1_CKD_Values<TIM15::CR1, 8, 2, ReadWriteMode, TIM15CR1Base> ;
     using UIFREMAP = TIM15_CR1_UIFREMAP_Values<TIM15::CR1, 11, 1, ReadWriteMode, TIM15CR1Base> ;
+    static constexpr Type SnapshotMask = 0xB8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM15_CR1_UIFREMAP_Values<TIM15::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,6 +48,7 @@ struct TIM15
     using OIS1 = TIM15_CR2_OIS1_Values<TIM15::CR2, 8, 1, ReadWriteMode, TIM15CR2Base> ;
     using OIS1N = TIM15_CR2_OIS1N_Values<TIM15::CR2, 9, 1, ReadWriteMode, TIM15CR2Base> ;
     using OIS2 = TIM15_CR2_OIS2_Values<TIM15::CR2, 10, 1, ReadWriteMode, TIM15CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FDU ;
     using FieldValues = TIM15_CR2_OIS2_Values<TIM15::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +63,7 @@ struct TIM15
     using TS = TIM15_SMCR_TS_Values<TIM15::SMCR, 4, 3, ReadWriteMode, TIM15SMCRBase> ;
     using MSM = TIM15_SMCR_MSM_Values<TIM15::SMCR, 7, 1, ReadWriteMode, TIM15SMCRBase> ;
     using SMS_3 = TIM15_SMCR_SMS_3_Values<TIM15::SMCR, 16, 1, ReadWriteMode, TIM15SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x100F7U ;
     using FieldValues = TIM15_SMCR_SMS_3_Values<TIM15::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct TIM15
     using CC2DE = TIM15_DIER_CC2DE_Values<TIM15::DIER, 10, 1, ReadWriteMode, TIM15DIERBase> ;
     using COMDE = TIM15_DIER_COMDE_Values<TIM15::DIER, 13, 1, ReadWriteMode, TIM15DIERBase> ;
     using TDE = TIM15_DIER_TDE_Values<TIM15::DIER, 14, 1, ReadWriteMode, TIM15DIERBase> ;
+    static constexpr Type SnapshotMask = 0x67E7U ;
     using FieldValues = TIM15_DIER_TDE_Values<TIM15::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +104,9 @@ struct TIM15
     using CC2IF = TIM15_SR_CC2IF_Values<TIM15::SR, 2, 1, ReadWriteMode, TIM15SRBase> ;
     using CC1IF = TIM15_SR_CC1IF_Values<TIM15::SR, 1, 1, ReadWriteMode, TIM15SRBase> ;
     using UIF = TIM15_SR_UIF_Values<TIM15::SR, 0, 1, ReadWriteMode, TIM15SRBase> ;
+    static constexpr Type WritableMask = 0x6E7U ;
+    static constexpr Type ZeroToClearMask = 0x6E7U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM15_SR_UIF_Values<TIM15::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +143,7 @@ struct TIM15
     using OC2M = TIM15_CCMR1_Output_OC2M_Values<TIM15::CCMR1_Output, 12, 3, ReadWriteMode, TIM15CCMR1_OutputBase> ;
     using OC1M_3 = TIM15_CCMR1_Output_OC1M_3_Values<TIM15::CCMR1_Output, 16, 1, ReadWriteMode, TIM15CCMR1_OutputBase> ;
     using OC2M_3 = TIM15_CCMR1_Output_OC2M_3_Values<TIM15::CCMR1_Output, 24, 1, ReadWriteMode, TIM15CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x1017F7FU ;
     using FieldValues = TIM15_CCMR1_Output_OC2M_3_Values<TIM15::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +160,7 @@ struct TIM15
     using IC1F = TIM15_CCMR1_Input_IC1F_Values<TIM15::CCMR1_Input, 4, 4, ReadWriteMode, TIM15CCMR1_InputBase> ;
     using IC1PSC = TIM15_CCMR1_Input_IC1PSC_Values<TIM15::CCMR1_Input, 2, 2, ReadWriteMode, TIM15CCMR1_InputBase> ;
     using CC1S = TIM15_CCMR1_Input_CC1S_Values<TIM15::CCMR1_Input, 0, 2, ReadWriteMode, TIM15CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_CCMR1_Input_CC1S_Values<TIM15::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -168,6 +178,7 @@ struct TIM15
     using CC1NE = TIM15_CCER_CC1NE_Values<TIM15::CCER, 2, 1, ReadWriteMode, TIM15CCERBase> ;
     using CC1P = TIM15_CCER_CC1P_Values<TIM15::CCER, 1, 1, ReadWriteMode, TIM15CCERBase> ;
     using CC1E = TIM15_CCER_CC1E_Values<TIM15::CCER, 0, 1, ReadWriteMode, TIM15CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBFU ;
     using FieldValues = TIM15_CCER_CC1E_Values<TIM15::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +191,7 @@ struct TIM15
   {
     using CNTField = TIM15_CNT_CNT_Values<TIM15::CNT, 0, 16, ReadWriteMode, TIM15CNTBase> ;
     using UIFCPY = TIM15_CNT_UIFCPY_Values<TIM15::CNT, 31, 1, ReadMode, TIM15CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM15_CNT_UIFCPY_Values<TIM15::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +203,7 @@ struct TIM15
   struct PSC : public RegisterBase<0x40014028, 32, ReadWriteMode>
   {
     using PSCField = TIM15_PSC_PSC_Values<TIM15::PSC, 0, 16, ReadWriteMode, TIM15PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_PSC_PSC_Values<TIM15::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -202,6 +215,7 @@ struct TIM15
   struct ARR : public RegisterBase<0x4001402C, 32, ReadWriteMode>
   {
     using ARRField = TIM15_ARR_ARR_Values<TIM15::ARR, 0, 16, ReadWriteMode, TIM15ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_ARR_ARR_Values<TIM15::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -213,6 +227,7 @@ struct TIM15
   struct RCR : public RegisterBase<0x40014030, 32, ReadWriteMode>
   {
     using REP = TIM15_RCR_REP_Values<TIM15::RCR, 0, 8, ReadWriteMode, TIM15RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM15_RCR_REP_Values<TIM15::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +239,7 @@ struct TIM15
   struct CCR1 : public RegisterBase<0x40014034, 32, ReadWriteMode>
   {
     using CCR1Field = TIM15_CCR1_CCR1_Values<TIM15::CCR1, 0, 16, ReadWriteMode, TIM15CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_CCR1_CCR1_Values<TIM15::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -235,6 +251,7 @@ struct TIM15
   struct CCR2 : public RegisterBase<0x40014038, 32, ReadWriteMode>
   {
     using CCR2Field = TIM15_CCR2_CCR2_Values<TIM15::CCR2, 0, 16, ReadWriteMode, TIM15CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_CCR2_CCR2_Values<TIM15::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +271,7 @@ struct TIM15
     using LOCK = TIM15_BDTR_LOCK_Values<TIM15::BDTR, 8, 2, ReadWriteMode, TIM15BDTRBase> ;
     using DTG = TIM15_BDTR_DTG_Values<TIM15::BDTR, 0, 8, ReadWriteMode, TIM15BDTRBase> ;
     using BKF = TIM15_BDTR_BKF_Values<TIM15::BDTR, 16, 4, ReadWriteMode, TIM15BDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = TIM15_BDTR_BKF_Values<TIM15::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +284,7 @@ struct TIM15
   {
     using DBL = TIM15_DCR_DBL_Values<TIM15::DCR, 8, 5, ReadWriteMode, TIM15DCRBase> ;
     using DBA = TIM15_DCR_DBA_Values<TIM15::DCR, 0, 5, ReadWriteMode, TIM15DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM15_DCR_DBA_Values<TIM15::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -277,12 +296,14 @@ struct TIM15
   struct DMAR : public RegisterBase<0x4001404C, 32, ReadWriteMode>
   {
     using DMAB = TIM15_DMAR_DMAB_Values<TIM15::DMAR, 0, 16, ReadWriteMode, TIM15DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_DMAR_DMAB_Values<TIM15::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4001404C, 32, ReadWriteMode, TIM15DMARBase, T...> ;
 
+  using Registers = TypesList<TIM15::CR1, TIM15::CR2, TIM15::SMCR, TIM15::DIER, TIM15::SR, TIM15::EGR, TIM15::CCMR1_Output, TIM15::CCMR1_Input, TIM15::CCER, TIM15::CNT, TIM15::PSC, TIM15::ARR, TIM15::RCR, TIM15::CCR1, TIM15::CCR2, TIM15::BDTR, TIM15::DCR, TIM15::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM15REGISTERS_HPP)
@@ -28,6 +28,8 @@ struct TIM16
     using ARPE = TIM16_CR1_ARPE_Values<TIM16::CR1, 7, 1, ReadWriteMode, TIM16CR1Base> ;
     using CKD = TIM16_CR1_CKD_Values<TIM16::CR1, 8, 2, ReadWriteMode, TIM16CR1Base> ;
     using UIFREMAP = TIM16_CR1_UIFREMAP_Values<TIM16::CR1, 11, 1, ReadWriteMode, TIM16CR1Base> ;
+    static constexpr Type SnapshotMask = 0xB8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM16_CR1_UIFREMAP_Values<TIM16::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +45,7 @@ struct TIM16
     using CCDS = TIM16_CR2_CCDS_Values<TIM16::CR2, 3, 1, ReadWriteMode, TIM16CR2Base> ;
     using CCUS = TIM16_CR2_CCUS_Values<TIM16::CR2, 2, 1, ReadWriteMode, TIM16CR2Base> ;
     using CCPC = TIM16_CR2_CCPC_Values<TIM16::CR2, 0, 1, ReadWriteMode, TIM16CR2Base> ;
+    static constexpr Type SnapshotMask = 0x30DU ;
     using FieldValues = TIM16_CR2_CCPC_Values<TIM16::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +65,7 @@ struct TIM16
     using CC1DE = TIM16_DIER_CC1DE_Values<TIM16::DIER, 9, 1, ReadWriteMode, TIM16DIERBase> ;
     using COMDE = TIM16_DIER_COMDE_Values<TIM16::DIER, 13, 1, ReadWriteMode, TIM16DIERBase> ;
     using TDE = TIM16_DIER_TDE_Values<TIM16::DIER, 14, 1, ReadWriteMode, TIM16DIERBase> ;
+    static constexpr Type SnapshotMask = 0x63E3U ;
     using FieldValues = TIM16_DIER_TDE_Values<TIM16::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +82,9 @@ struct TIM16
     using COMIF = TIM16_SR_COMIF_Values<TIM16::SR, 5, 1, ReadWriteMode, TIM16SRBase> ;
     using CC1IF = TIM16_SR_CC1IF_Values<TIM16::SR, 1, 1, ReadWriteMode, TIM16SRBase> ;
     using UIF = TIM16_SR_UIF_Values<TIM16::SR, 0, 1, ReadWriteMode, TIM16SRBase> ;
+    static constexpr Type WritableMask = 0x2E3U ;
+    static constexpr Type ZeroToClearMask = 0x2E3U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM16_SR_UIF_Values<TIM16::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +115,7 @@ struct TIM16
     using OC1PE = TIM16_CCMR1_Output_OC1PE_Values<TIM16::CCMR1_Output, 3, 1, ReadWriteMode, TIM16CCMR1_OutputBase> ;
     using OC1M = TIM16_CCMR1_Output_OC1M_Values<TIM16::CCMR1_Output, 4, 3, ReadWriteMode, TIM16CCMR1_OutputBase> ;
     using OC1M_3 = TIM16_CCMR1_Output_OC1M_3_Values<TIM16::CCMR1_Output, 16, 1, ReadWriteMode, TIM16CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x1007FU ;
     using FieldValues = TIM16_CCMR1_Output_OC1M_3_Values<TIM16::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +129,7 @@ struct TIM16
     using IC1F = TIM16_CCMR1_Input_IC1F_Values<TIM16::CCMR1_Input, 4, 4, ReadWriteMode, TIM16CCMR1_InputBase> ;
     using IC1PSC = TIM16_CCMR1_Input_IC1PSC_Values<TIM16::CCMR1_Input, 2, 2, ReadWriteMode, TIM16CCMR1_InputBase> ;
     using CC1S = TIM16_CCMR1_Input_CC1S_Values<TIM16::CCMR1_Input, 0, 2, ReadWriteMode, TIM16CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM16_CCMR1_Input_CC1S_Values<TIM16::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +144,7 @@ struct TIM16
     using CC1NE = TIM16_CCER_CC1NE_Values<TIM16::CCER, 2, 1, ReadWriteMode, TIM16CCERBase> ;
     using CC1P = TIM16_CCER_CC1P_Values<TIM16::CCER, 1, 1, ReadWriteMode, TIM16CCERBase> ;
     using CC1E = TIM16_CCER_CC1E_Values<TIM16::CCER, 0, 1, ReadWriteMode, TIM16CCERBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM16_CCER_CC1E_Values<TIM16::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,6 +157,7 @@ struct TIM16
   {
     using CNTField = TIM16_CNT_CNT_Values<TIM16::CNT, 0, 16, ReadWriteMode, TIM16CNTBase> ;
     using UIFCPY = TIM16_CNT_UIFCPY_Values<TIM16::CNT, 31, 1, ReadMode, TIM16CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM16_CNT_UIFCPY_Values<TIM16::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +169,7 @@ struct TIM16
   struct PSC : public RegisterBase<0x40014428, 32, ReadWriteMode>
   {
     using PSCField = TIM16_PSC_PSC_Values<TIM16::PSC, 0, 16, ReadWriteMode, TIM16PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_PSC_PSC_Values<TIM16::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +181,7 @@ struct TIM16
   struct ARR : public RegisterBase<0x4001442C, 32, ReadWriteMode>
   {
     using ARRField = TIM16_ARR_ARR_Values<TIM16::ARR, 0, 16, ReadWriteMode, TIM16ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_ARR_ARR_Values<TIM16::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +193,7 @@ struct TIM16
   struct RCR : public RegisterBase<0x40014430, 32, ReadWriteMode>
   {
     using REP = TIM16_RCR_REP_Values<TIM16::RCR, 0, 8, ReadWriteMode, TIM16RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM16_RCR_REP_Values<TIM16::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +205,7 @@ struct TIM16
   struct CCR1 : public RegisterBase<0x40014434, 32, ReadWriteMode>
   {
     using CCR1Field = TIM16_CCR1_CCR1_Values<TIM16::CCR1, 0, 16, ReadWriteMode, TIM16CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_CCR1_CCR1_Values<TIM16::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +225,7 @@ struct TIM16
     using AOE = TIM16_BDTR_AOE_Values<TIM16::BDTR, 14, 1, ReadWriteMode, TIM16BDTRBase> ;
     using MOE = TIM16_BDTR_MOE_Values<TIM16::BDTR, 15, 1, ReadWriteMode, TIM16BDTRBase> ;
     using BKF = TIM16_BDTR_BKF_Values<TIM16::BDTR, 16, 4, ReadWriteMode, TIM16BDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = TIM16_BDTR_BKF_Values<TIM16::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +238,7 @@ struct TIM16
   {
     using DBL = TIM16_DCR_DBL_Values<TIM16::DCR, 8, 5, ReadWriteMode, TIM16DCRBase> ;
     using DBA = TIM16_DCR_DBA_Values<TIM16::DCR, 0, 5, ReadWriteMode, TIM16DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM16_DCR_DBA_Values<TIM16::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +250,7 @@ struct TIM16
   struct DMAR : public RegisterBase<0x4001444C, 32, ReadWriteMode>
   {
     using DMAB = TIM16_DMAR_DMAB_Values<TIM16::DMAR, 0, 16, ReadWriteMode, TIM16DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM16_DMAR_DMAB_Values<TIM16::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -243,11 +261,13 @@ struct TIM16
 
   struct OR : public RegisterBase<0x40014450, 32, ReadWriteMode>
   {
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40014450, 32, ReadWriteMode, TIM16ORBase, T...> ;
 
+  using Registers = TypesList<TIM16::CR1, TIM16::CR2, TIM16::DIER, TIM16::SR, TIM16::EGR, TIM16::CCMR1_Output, TIM16::CCMR1_Input, TIM16::CCER, TIM16::CNT, TIM16::PSC, TIM16::ARR, TIM16::RCR, TIM16::CCR1, TIM16::BDTR, TIM16::DCR, TIM16::DMAR, TIM16::OR> ;
 } ;
 
 #endif //#if !defined(TIM16REGISTERS_HPP)
@@ -28,6 +28,8 @@ struct TIM17
     using ARPE = TIM17_CR1_ARPE_Values<TIM17::CR1, 7, 1, ReadWriteMode, TIM17CR1Base> ;
     using CKD = TIM17_CR1_CKD_Values<TIM17::CR1, 8, 2, ReadWriteMode, TIM17CR1Base> ;
     using UIFREMAP = TIM17_CR1_UIFREMAP_Values<TIM17::CR1, 11, 1, ReadWriteMode, TIM17CR1Base> ;
+    static constexpr Type SnapshotMask = 0xB8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM17_CR1_UIFREMAP_Values<TIM17::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +45,7 @@ struct TIM17
     using CCDS = TIM17_CR2_CCDS_Values<TIM17::CR2, 3, 1, ReadWriteMode, TIM17CR2Base> ;
     using CCUS = TIM17_CR2_CCUS_Values<TIM17::CR2, 2, 1, ReadWriteMode, TIM17CR2Base> ;
     using CCPC = TIM17_CR2_CCPC_Values<TIM17::CR2, 0, 1, ReadWriteMode, TIM17CR2Base> ;
+    static constexpr Type SnapshotMask = 0x30DU ;
     using FieldValues = TIM17_CR2_CCPC_Values<TIM17::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +65,7 @@ struct TIM17
     using CC1DE = TIM17_DIER_CC1DE_Values<TIM17::DIER, 9, 1, ReadWriteMode, TIM17DIERBase> ;
     using COMDE = TIM17_DIER_COMDE_Values<TIM17::DIER, 13, 1, ReadWriteMode, TIM17DIERBase> ;
     using TDE = TIM17_DIER_TDE_Values<TIM17::DIER, 14, 1, ReadWriteMode, TIM17DIERBase> ;
+    static constexpr Type SnapshotMask = 0x63E3U ;
     using FieldValues = TIM17_DIER_TDE_Values<TIM17::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +82,9 @@ struct TIM17
     using COMIF = TIM17_SR_COMIF_Values<TIM17::SR, 5, 1, ReadWriteMode, TIM17SRBase> ;
     using CC1IF = TIM17_SR_CC1IF_Values<TIM17::SR, 1, 1, ReadWriteMode, TIM17SRBase> ;
     using UIF = TIM17_SR_UIF_Values<TIM17::SR, 0, 1, ReadWriteMode, TIM17SRBase> ;
+    static constexpr Type WritableMask = 0x2E3U ;
+    static constexpr Type ZeroToClearMask = 0x2E3U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM17_SR_UIF_Values<TIM17::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +115,7 @@ struct TIM17
     using OC1PE = TIM17_CCMR1_Output_OC1PE_Values<TIM17::CCMR1_Output, 3, 1, ReadWriteMode, TIM17CCMR1_OutputBase> ;
     using OC1M = TIM17_CCMR1_Output_OC1M_Values<TIM17::CCMR1_Output, 4, 3, ReadWriteMode, TIM17CCMR1_OutputBase> ;
     using OC1M_3 = TIM17_CCMR1_Output_OC1M_3_Values<TIM17::CCMR1_Output, 16, 1, ReadWriteMode, TIM17CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x1007FU ;
     using FieldValues = TIM17_CCMR1_Output_OC1M_3_Values<TIM17::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +129,7 @@ struct TIM17
     using IC1F = TIM17_CCMR1_Input_IC1F_Values<TIM17::CCMR1_Input, 4, 4, ReadWriteMode, TIM17CCMR1_InputBase> ;
     using IC1PSC = TIM17_CCMR1_Input_IC1PSC_Values<TIM17::CCMR1_Input, 2, 2, ReadWriteMode, TIM17CCMR1_InputBase> ;
     using CC1S = TIM17_CCMR1_Input_CC1S_Values<TIM17::CCMR1_Input, 0, 2, ReadWriteMode, TIM17CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM17_CCMR1_Input_CC1S_Values<TIM17::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +144,7 @@ struct TIM17
     using CC1NE = TIM17_CCER_CC1NE_Values<TIM17::CCER, 2, 1, ReadWriteMode, TIM17CCERBase> ;
     using CC1P = TIM17_CCER_CC1P_Values<TIM17::CCER, 1, 1, ReadWriteMode, TIM17CCERBase> ;
     using CC1E = TIM17_CCER_CC1E_Values<TIM17::CCER, 0, 1, ReadWriteMode, TIM17CCERBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM17_CCER_CC1E_Values<TIM17::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,6 +157,7 @@ struct TIM17
   {
     using CNTField = TIM17_CNT_CNT_Values<TIM17::CNT, 0, 16, ReadWriteMode, TIM17CNTBase> ;
     using UIFCPY = TIM17_CNT_UIFCPY_Values<TIM17::CNT, 31, 1, ReadMode, TIM17CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM17_CNT_UIFCPY_Values<TIM17::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +169,7 @@ struct TIM17
   struct PSC : public RegisterBase<0x40014828, 32, ReadWriteMode>
   {
     using PSCField = TIM17_PSC_PSC_Values<TIM17::PSC, 0, 16, ReadWriteMode, TIM17PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM17_PSC_PSC_Values<TIM17::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +181,7 @@ struct TIM17
   struct ARR : public RegisterBase<0x4001482C, 32, ReadWriteMode>
   {
     using ARRField = TIM17_ARR_ARR_Values<TIM17::ARR, 0, 16, ReadWriteMode, TIM17ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM17_ARR_ARR_Values<TIM17::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +193,7 @@ struct TIM17
   struct RCR : public RegisterBase<0x40014830, 32, ReadWriteMode>
   {
     using REP = TIM17_RCR_REP_Values<TIM17::RCR, 0, 8, ReadWriteMode, TIM17RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM17_RCR_REP_Values<TIM17::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +205,7 @@ struct TIM17
   struct CCR1 : public RegisterBase<0x40014834, 32, ReadWriteMode>
   {
     using CCR1Field = TIM17_CCR1_CCR1_Values<TIM17::CCR1, 0, 16, ReadWriteMode, TIM17CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM17_CCR1_CCR1_Values<TIM17::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +225,7 @@ struct TIM17
     using AOE = TIM17_BDTR_AOE_Values<TIM17::BDTR, 14, 1, ReadWriteMode, TIM17BDTRBase> ;
     using MOE = TIM17_BDTR_MOE_Values<TIM17::BDTR, 15, 1, ReadWriteMode, TIM17BDTRBase> ;
     using BKF = TIM17_BDTR_BKF_Values<TIM17::BDTR, 16, 4, ReadWriteMode, TIM17BDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = TIM17_BDTR_BKF_Values<TIM17::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +238,7 @@ struct TIM17
   {
     using DBL = TIM17_DCR_DBL_Values<TIM17::DCR, 8, 5, ReadWriteMode, TIM17DCRBase> ;
     using DBA = TIM17_DCR_DBA_Values<TIM17::DCR, 0, 5, ReadWriteMode, TIM17DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM17_DCR_DBA_Values<TIM17::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,12 +250,14 @@ struct TIM17
   struct DMAR : public RegisterBase<0x4001484C, 32, ReadWriteMode>
   {
     using DMAB = TIM17_DMAR_DMAB_Values<TIM17::DMAR, 0, 16, ReadWriteMode, TIM17DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM17_DMAR_DMAB_Values<TIM17::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4001484C, 32, ReadWriteMode, TIM17DMARBase, T...> ;
 
+  using Registers = TypesList<TIM17::CR1, TIM17::CR2, TIM17::DIER, TIM17::SR, TIM17::EGR, TIM17::CCMR1_Output, TIM17::CCMR1_Input, TIM17::CCER, TIM17::CNT, TIM17::PSC, TIM17::ARR, TIM17::RCR, TIM17::CCR1, TIM17::BDTR, TIM17::DCR, TIM17::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM17REGISTERS_HPP)
@@ -30,6 +30,8 @@ struct TIM1
     using ARPE = TIM1_CR1_ARPE_Values<TIM1::CR1, 7, 1, ReadWriteMode, TIM1CR1Base> ;
     using CKD = TIM1_CR1_CKD_Values<TIM1::CR1, 8, 2, ReadWriteMode, TIM1CR1Base> ;
     using UIFREMAP = TIM1_CR1_UIFREMAP_Values<TIM1::CR1, 11, 1, ReadWriteMode, TIM1CR1Base> ;
+    static constexpr Type SnapshotMask = 0xBFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM1_CR1_UIFREMAP_Values<TIM1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +57,7 @@ struct TIM1
     using OIS5 = TIM1_CR2_OIS5_Values<TIM1::CR2, 16, 1, ReadWriteMode, TIM1CR2Base> ;
     using OIS6 = TIM1_CR2_OIS6_Values<TIM1::CR2, 18, 1, ReadWriteMode, TIM1CR2Base> ;
     using MMS2 = TIM1_CR2_MMS2_Values<TIM1::CR2, 20, 4, ReadWriteMode, TIM1CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF57FFDU ;
     using FieldValues = TIM1_CR2_MMS2_Values<TIM1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -74,6 +77,7 @@ struct TIM1
     using ECE = TIM1_SMCR_ECE_Values<TIM1::SMCR, 14, 1, ReadWriteMode, TIM1SMCRBase> ;
     using ETP = TIM1_SMCR_ETP_Values<TIM1::SMCR, 15, 1, ReadWriteMode, TIM1SMCRBase> ;
     using SMS3 = TIM1_SMCR_SMS3_Values<TIM1::SMCR, 16, 1, ReadWriteMode, TIM1SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = TIM1_SMCR_SMS3_Values<TIM1::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +103,7 @@ struct TIM1
     using CC2IE = TIM1_DIER_CC2IE_Values<TIM1::DIER, 2, 1, ReadWriteMode, TIM1DIERBase> ;
     using CC1IE = TIM1_DIER_CC1IE_Values<TIM1::DIER, 1, 1, ReadWriteMode, TIM1DIERBase> ;
     using UIE = TIM1_DIER_UIE_Values<TIM1::DIER, 0, 1, ReadWriteMode, TIM1DIERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = TIM1_DIER_UIE_Values<TIM1::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,9 @@ struct TIM1
     using CC4OF = TIM1_SR_CC4OF_Values<TIM1::SR, 12, 1, ReadWriteMode, TIM1SRBase> ;
     using C5IF = TIM1_SR_C5IF_Values<TIM1::SR, 16, 1, ReadWriteMode, TIM1SRBase> ;
     using C6IF = TIM1_SR_C6IF_Values<TIM1::SR, 17, 1, ReadWriteMode, TIM1SRBase> ;
+    static constexpr Type WritableMask = 0x31FFFU ;
+    static constexpr Type ZeroToClearMask = 0x31FFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM1_SR_C6IF_Values<TIM1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +173,7 @@ struct TIM1
     using CC1S = TIM1_CCMR1_Output_CC1S_Values<TIM1::CCMR1_Output, 0, 2, ReadWriteMode, TIM1CCMR1_OutputBase> ;
     using OC1M_3 = TIM1_CCMR1_Output_OC1M_3_Values<TIM1::CCMR1_Output, 16, 1, ReadWriteMode, TIM1CCMR1_OutputBase> ;
     using OC2M_3 = TIM1_CCMR1_Output_OC2M_3_Values<TIM1::CCMR1_Output, 24, 1, ReadWriteMode, TIM1CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM1_CCMR1_Output_OC2M_3_Values<TIM1::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +190,7 @@ struct TIM1
     using IC1F = TIM1_CCMR1_Input_IC1F_Values<TIM1::CCMR1_Input, 4, 4, ReadWriteMode, TIM1CCMR1_InputBase> ;
     using IC1PCS = TIM1_CCMR1_Input_IC1PCS_Values<TIM1::CCMR1_Input, 2, 2, ReadWriteMode, TIM1CCMR1_InputBase> ;
     using CC1S = TIM1_CCMR1_Input_CC1S_Values<TIM1::CCMR1_Input, 0, 2, ReadWriteMode, TIM1CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCMR1_Input_CC1S_Values<TIM1::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,6 +213,7 @@ struct TIM1
     using CC3S = TIM1_CCMR2_Output_CC3S_Values<TIM1::CCMR2_Output, 0, 2, ReadWriteMode, TIM1CCMR2_OutputBase> ;
     using OC3M_3 = TIM1_CCMR2_Output_OC3M_3_Values<TIM1::CCMR2_Output, 16, 1, ReadWriteMode, TIM1CCMR2_OutputBase> ;
     using OC4M_3 = TIM1_CCMR2_Output_OC4M_3_Values<TIM1::CCMR2_Output, 24, 1, ReadWriteMode, TIM1CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM1_CCMR2_Output_OC4M_3_Values<TIM1::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +230,7 @@ struct TIM1
     using IC3F = TIM1_CCMR2_Input_IC3F_Values<TIM1::CCMR2_Input, 4, 4, ReadWriteMode, TIM1CCMR2_InputBase> ;
     using IC3PSC = TIM1_CCMR2_Input_IC3PSC_Values<TIM1::CCMR2_Input, 2, 2, ReadWriteMode, TIM1CCMR2_InputBase> ;
     using CC3S = TIM1_CCMR2_Input_CC3S_Values<TIM1::CCMR2_Input, 0, 2, ReadWriteMode, TIM1CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCMR2_Input_CC3S_Values<TIM1::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -248,6 +260,7 @@ struct TIM1
     using CC5P = TIM1_CCER_CC5P_Values<TIM1::CCER, 17, 1, ReadWriteMode, TIM1CCERBase> ;
     using CC6E = TIM1_CCER_CC6E_Values<TIM1::CCER, 20, 1, ReadWriteMode, TIM1CCERBase> ;
     using CC6P = TIM1_CCER_CC6P_Values<TIM1::CCER, 21, 1, ReadWriteMode, TIM1CCERBase> ;
+    static constexpr Type SnapshotMask = 0x33BFFFU ;
     using FieldValues = TIM1_CCER_CC6P_Values<TIM1::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -260,6 +273,7 @@ struct TIM1
   {
     using CNTField = TIM1_CNT_CNT_Values<TIM1::CNT, 0, 16, ReadWriteMode, TIM1CNTBase> ;
     using UIFCPY = TIM1_CNT_UIFCPY_Values<TIM1::CNT, 31, 1, ReadMode, TIM1CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM1_CNT_UIFCPY_Values<TIM1::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -271,6 +285,7 @@ struct TIM1
   struct PSC : public RegisterBase<0x40012C28, 32, ReadWriteMode>
   {
     using PSCField = TIM1_PSC_PSC_Values<TIM1::PSC, 0, 16, ReadWriteMode, TIM1PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_PSC_PSC_Values<TIM1::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +297,7 @@ struct TIM1
   struct ARR : public RegisterBase<0x40012C2C, 32, ReadWriteMode>
   {
     using ARRField = TIM1_ARR_ARR_Values<TIM1::ARR, 0, 16, ReadWriteMode, TIM1ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_ARR_ARR_Values<TIM1::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct TIM1
   struct RCR : public RegisterBase<0x40012C30, 32, ReadWriteMode>
   {
     using REP = TIM1_RCR_REP_Values<TIM1::RCR, 0, 16, ReadWriteMode, TIM1RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_RCR_REP_Values<TIM1::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -304,6 +321,7 @@ struct TIM1
   struct CCR1 : public RegisterBase<0x40012C34, 32, ReadWriteMode>
   {
     using CCR1Field = TIM1_CCR1_CCR1_Values<TIM1::CCR1, 0, 16, ReadWriteMode, TIM1CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR1_CCR1_Values<TIM1::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -315,6 +333,7 @@ struct TIM1
   struct CCR2 : public RegisterBase<0x40012C38, 32, ReadWriteMode>
   {
     using CCR2Field = TIM1_CCR2_CCR2_Values<TIM1::CCR2, 0, 16, ReadWriteMode, TIM1CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR2_CCR2_Values<TIM1::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -326,6 +345,7 @@ struct TIM1
   struct CCR3 : public RegisterBase<0x40012C3C, 32, ReadWriteMode>
   {
     using CCR3Field = TIM1_CCR3_CCR3_Values<TIM1::CCR3, 0, 16, ReadWriteMode, TIM1CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR3_CCR3_Values<TIM1::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -337,6 +357,7 @@ struct TIM1
   struct CCR4 : public RegisterBase<0x40012C40, 32, ReadWriteMode>
   {
     using CCR4Field = TIM1_CCR4_CCR4_Values<TIM1::CCR4, 0, 16, ReadWriteMode, TIM1CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR4_CCR4_Values<TIM1::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -359,6 +380,7 @@ struct TIM1
     using BK2F = TIM1_BDTR_BK2F_Values<TIM1::BDTR, 20, 4, ReadWriteMode, TIM1BDTRBase> ;
     using BK2E = TIM1_BDTR_BK2E_Values<TIM1::BDTR, 24, 1, ReadWriteMode, TIM1BDTRBase> ;
     using BK2P = TIM1_BDTR_BK2P_Values<TIM1::BDTR, 25, 1, ReadWriteMode, TIM1BDTRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFU ;
     using FieldValues = TIM1_BDTR_BK2P_Values<TIM1::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -371,6 +393,7 @@ struct TIM1
   {
     using DBL = TIM1_DCR_DBL_Values<TIM1::DCR, 8, 5, ReadWriteMode, TIM1DCRBase> ;
     using DBA = TIM1_DCR_DBA_Values<TIM1::DCR, 0, 5, ReadWriteMode, TIM1DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM1_DCR_DBA_Values<TIM1::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -382,6 +405,7 @@ struct TIM1
   struct DMAR : public RegisterBase<0x40012C4C, 32, ReadWriteMode>
   {
     using DMAB = TIM1_DMAR_DMAB_Values<TIM1::DMAR, 0, 16, ReadWriteMode, TIM1DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_DMAR_DMAB_Values<TIM1::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -402,6 +426,7 @@ struct TIM1
     using OC6CE = TIM1_CCMR3_Output_OC6CE_Values<TIM1::CCMR3_Output, 15, 1, ReadWriteMode, TIM1CCMR3_OutputBase> ;
     using OC5M_3 = TIM1_CCMR3_Output_OC5M_3_Values<TIM1::CCMR3_Output, 16, 1, ReadWriteMode, TIM1CCMR3_OutputBase> ;
     using OC6M_3 = TIM1_CCMR3_Output_OC6M_3_Values<TIM1::CCMR3_Output, 24, 1, ReadWriteMode, TIM1CCMR3_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FCFCU ;
     using FieldValues = TIM1_CCMR3_Output_OC6M_3_Values<TIM1::CCMR3_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +441,7 @@ struct TIM1
     using GC5C1 = TIM1_CCR5_GC5C1_Values<TIM1::CCR5, 29, 1, ReadWriteMode, TIM1CCR5Base> ;
     using GC5C2 = TIM1_CCR5_GC5C2_Values<TIM1::CCR5, 30, 1, ReadWriteMode, TIM1CCR5Base> ;
     using GC5C3 = TIM1_CCR5_GC5C3_Values<TIM1::CCR5, 31, 1, ReadWriteMode, TIM1CCR5Base> ;
+    static constexpr Type SnapshotMask = 0xE000FFFFU ;
     using FieldValues = TIM1_CCR5_GC5C3_Values<TIM1::CCR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -427,6 +453,7 @@ struct TIM1
   struct CCR6 : public RegisterBase<0x40012C5C, 32, ReadWriteMode>
   {
     using CCR6Field = TIM1_CCR6_CCR6_Values<TIM1::CCR6, 0, 16, ReadWriteMode, TIM1CCR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR6_CCR6_Values<TIM1::CCR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,12 +466,14 @@ struct TIM1
   {
     using TIM1_ETR_ADC1_RMP = TIM1_OR_TIM1_ETR_ADC1_RMP_Values<TIM1::OR, 0, 2, ReadWriteMode, TIM1ORBase> ;
     using TIM1_ETR_ADC4_RMP = TIM1_OR_TIM1_ETR_ADC4_RMP_Values<TIM1::OR, 2, 2, ReadWriteMode, TIM1ORBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM1_OR_TIM1_ETR_ADC4_RMP_Values<TIM1::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40012C60, 32, ReadWriteMode, TIM1ORBase, T...> ;
 
+  using Registers = TypesList<TIM1::CR1, TIM1::CR2, TIM1::SMCR, TIM1::DIER, TIM1::SR, TIM1::EGR, TIM1::CCMR1_Output, TIM1::CCMR1_Input, TIM1::CCMR2_Output, TIM1::CCMR2_Input, TIM1::CCER, TIM1::CNT, TIM1::PSC, TIM1::ARR, TIM1::RCR, TIM1::CCR1, TIM1::CCR2, TIM1::CCR3, TIM1::CCR4, TIM1::BDTR, TIM1::DCR, TIM1::DMAR, TIM1::CCMR3_Output, TIM1::CCR5, TIM1::CCR6, TIM1::OR> ;
 } ;
 
 #endif //#if !defined(TIM1REGISTERS_HPP)
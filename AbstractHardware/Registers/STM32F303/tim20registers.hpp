@@ -30,6 +30,8 @@ struct TIM20
     using ARPE = TIM20_CR1_ARPE_Values<TIM20::CR1, 7, 1, ReadWriteMode, TIM20CR1Base> ;
     using CKD = TIM20_CR1_CKD_Values<TIM20::CR1, 8, 2, ReadWriteMode, TIM20CR1Base> ;
     using UIFREMAP = TIM20_CR1_UIFREMAP_Values<TIM20::CR1, 11, 1, ReadWriteMode, TIM20CR1Base> ;
+    static constexpr Type SnapshotMask = 0xBFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM20_CR1_UIFREMAP_Values<TIM20::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +57,7 @@ struct TIM20
     using OIS5 = TIM20_CR2_OIS5_Values<TIM20::CR2, 16, 1, ReadWriteMode, TIM20CR2Base> ;
     using OIS6 = TIM20_CR2_OIS6_Values<TIM20::CR2, 18, 1, ReadWriteMode, TIM20CR2Base> ;
     using MMS2 = TIM20_CR2_MMS2_Values<TIM20::CR2, 20, 4, ReadWriteMode, TIM20CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF57FFDU ;
     using FieldValues = TIM20_CR2_MMS2_Values<TIM20::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -74,6 +77,7 @@ struct TIM20
     using ECE = TIM20_SMCR_ECE_Values<TIM20::SMCR, 14, 1, ReadWriteMode, TIM20SMCRBase> ;
     using ETP = TIM20_SMCR_ETP_Values<TIM20::SMCR, 15, 1, ReadWriteMode, TIM20SMCRBase> ;
     using SMS3 = TIM20_SMCR_SMS3_Values<TIM20::SMCR, 16, 1, ReadWriteMode, TIM20SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = TIM20_SMCR_SMS3_Values<TIM20::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +103,7 @@ struct TIM20
     using CC2IE = TIM20_DIER_CC2IE_Values<TIM20::DIER, 2, 1, ReadWriteMode, TIM20DIERBase> ;
     using CC1IE = TIM20_DIER_CC1IE_Values<TIM20::DIER, 1, 1, ReadWriteMode, TIM20DIERBase> ;
     using UIE = TIM20_DIER_UIE_Values<TIM20::DIER, 0, 1, ReadWriteMode, TIM20DIERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = TIM20_DIER_UIE_Values<TIM20::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,9 @@ struct TIM20
     using CC4OF = TIM20_SR_CC4OF_Values<TIM20::SR, 12, 1, ReadWriteMode, TIM20SRBase> ;
     using C5IF = TIM20_SR_C5IF_Values<TIM20::SR, 16, 1, ReadWriteMode, TIM20SRBase> ;
     using C6IF = TIM20_SR_C6IF_Values<TIM20::SR, 17, 1, ReadWriteMode, TIM20SRBase> ;
+    static constexpr Type WritableMask = 0x31FFFU ;
+    static constexpr Type ZeroToClearMask = 0x31FFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM20_SR_C6IF_Values<TIM20::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +173,7 @@ struct TIM20
     using CC1S = TIM20_CCMR1_Output_CC1S_Values<TIM20::CCMR1_Output, 0, 2, ReadWriteMode, TIM20CCMR1_OutputBase> ;
     using OC1M_3 = TIM20_CCMR1_Output_OC1M_3_Values<TIM20::CCMR1_Output, 16, 1, ReadWriteMode, TIM20CCMR1_OutputBase> ;
     using OC2M_3 = TIM20_CCMR1_Output_OC2M_3_Values<TIM20::CCMR1_Output, 24, 1, ReadWriteMode, TIM20CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM20_CCMR1_Output_OC2M_3_Values<TIM20::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +190,7 @@ struct TIM20
     using IC1F = TIM20_CCMR1_Input_IC1F_Values<TIM20::CCMR1_Input, 4, 4, ReadWriteMode, TIM20CCMR1_InputBase> ;
     using IC1PCS = TIM20_CCMR1_Input_IC1PCS_Values<TIM20::CCMR1_Input, 2, 2, ReadWriteMode, TIM20CCMR1_InputBase> ;
     using CC1S = TIM20_CCMR1_Input_CC1S_Values<TIM20::CCMR1_Input, 0, 2, ReadWriteMode, TIM20CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCMR1_Input_CC1S_Values<TIM20::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,6 +213,7 @@ struct TIM20
     using CC3S = TIM20_CCMR2_Output_CC3S_Values<TIM20::CCMR2_Output, 0, 2, ReadWriteMode, TIM20CCMR2_OutputBase> ;
     using OC3M_3 = TIM20_CCMR2_Output_OC3M_3_Values<TIM20::CCMR2_Output, 16, 1, ReadWriteMode, TIM20CCMR2_OutputBase> ;
     using OC4M_3 = TIM20_CCMR2_Output_OC4M_3_Values<TIM20::CCMR2_Output, 24, 1, ReadWriteMode, TIM20CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM20_CCMR2_Output_OC4M_3_Values<TIM20::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +230,7 @@ struct TIM20
     using IC3F = TIM20_CCMR2_Input_IC3F_Values<TIM20::CCMR2_Input, 4, 4, ReadWriteMode, TIM20CCMR2_InputBase> ;
     using IC3PSC = TIM20_CCMR2_Input_IC3PSC_Values<TIM20::CCMR2_Input, 2, 2, ReadWriteMode, TIM20CCMR2_InputBase> ;
     using CC3S = TIM20_CCMR2_Input_CC3S_Values<TIM20::CCMR2_Input, 0, 2, ReadWriteMode, TIM20CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCMR2_Input_CC3S_Values<TIM20::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -248,6 +260,7 @@ struct TIM20
     using CC5P = TIM20_CCER_CC5P_Values<TIM20::CCER, 17, 1, ReadWriteMode, TIM20CCERBase> ;
     using CC6E = TIM20_CCER_CC6E_Values<TIM20::CCER, 20, 1, ReadWriteMode, TIM20CCERBase> ;
     using CC6P = TIM20_CCER_CC6P_Values<TIM20::CCER, 21, 1, ReadWriteMode, TIM20CCERBase> ;
+    static constexpr Type SnapshotMask = 0x33BFFFU ;
     using FieldValues = TIM20_CCER_CC6P_Values<TIM20::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -260,6 +273,7 @@ struct TIM20
   {
     using CNTField = TIM20_CNT_CNT_Values<TIM20::CNT, 0, 16, ReadWriteMode, TIM20CNTBase> ;
     using UIFCPY = TIM20_CNT_UIFCPY_Values<TIM20::CNT, 31, 1, ReadMode, TIM20CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM20_CNT_UIFCPY_Values<TIM20::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -271,6 +285,7 @@ struct TIM20
   struct PSC : public RegisterBase<0x40015028, 32, ReadWriteMode>
   {
     using PSCField = TIM20_PSC_PSC_Values<TIM20::PSC, 0, 16, ReadWriteMode, TIM20PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_PSC_PSC_Values<TIM20::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +297,7 @@ struct TIM20
   struct ARR : public RegisterBase<0x4001502C, 32, ReadWriteMode>
   {
     using ARRField = TIM20_ARR_ARR_Values<TIM20::ARR, 0, 16, ReadWriteMode, TIM20ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_ARR_ARR_Values<TIM20::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct TIM20
   struct RCR : public RegisterBase<0x40015030, 32, ReadWriteMode>
   {
     using REP = TIM20_RCR_REP_Values<TIM20::RCR, 0, 16, ReadWriteMode, TIM20RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_RCR_REP_Values<TIM20::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -304,6 +321,7 @@ struct TIM20
   struct CCR1 : public RegisterBase<0x40015034, 32, ReadWriteMode>
   {
     using CCR1Field = TIM20_CCR1_CCR1_Values<TIM20::CCR1, 0, 16, ReadWriteMode, TIM20CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCR1_CCR1_Values<TIM20::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -315,6 +333,7 @@ struct TIM20
   struct CCR2 : public RegisterBase<0x40015038, 32, ReadWriteMode>
   {
     using CCR2Field = TIM20_CCR2_CCR2_Values<TIM20::CCR2, 0, 16, ReadWriteMode, TIM20CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCR2_CCR2_Values<TIM20::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -326,6 +345,7 @@ struct TIM20
   struct CCR3 : public RegisterBase<0x4001503C, 32, ReadWriteMode>
   {
     using CCR3Field = TIM20_CCR3_CCR3_Values<TIM20::CCR3, 0, 16, ReadWriteMode, TIM20CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCR3_CCR3_Values<TIM20::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -337,6 +357,7 @@ struct TIM20
   struct CCR4 : public RegisterBase<0x40015040, 32, ReadWriteMode>
   {
     using CCR4Field = TIM20_CCR4_CCR4_Values<TIM20::CCR4, 0, 16, ReadWriteMode, TIM20CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCR4_CCR4_Values<TIM20::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -359,6 +380,7 @@ struct TIM20
     using BK2F = TIM20_BDTR_BK2F_Values<TIM20::BDTR, 20, 4, ReadWriteMode, TIM20BDTRBase> ;
     using BK2E = TIM20_BDTR_BK2E_Values<TIM20::BDTR, 24, 1, ReadWriteMode, TIM20BDTRBase> ;
     using BK2P = TIM20_BDTR_BK2P_Values<TIM20::BDTR, 25, 1, ReadWriteMode, TIM20BDTRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFU ;
     using FieldValues = TIM20_BDTR_BK2P_Values<TIM20::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -371,6 +393,7 @@ struct TIM20
   {
     using DBL = TIM20_DCR_DBL_Values<TIM20::DCR, 8, 5, ReadWriteMode, TIM20DCRBase> ;
     using DBA = TIM20_DCR_DBA_Values<TIM20::DCR, 0, 5, ReadWriteMode, TIM20DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM20_DCR_DBA_Values<TIM20::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -382,6 +405,7 @@ struct TIM20
   struct DMAR : public RegisterBase<0x4001504C, 32, ReadWriteMode>
   {
     using DMAB = TIM20_DMAR_DMAB_Values<TIM20::DMAR, 0, 16, ReadWriteMode, TIM20DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_DMAR_DMAB_Values<TIM20::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -402,6 +426,7 @@ struct TIM20
     using OC6CE = TIM20_CCMR3_Output_OC6CE_Values<TIM20::CCMR3_Output, 15, 1, ReadWriteMode, TIM20CCMR3_OutputBase> ;
     using OC5M_3 = TIM20_CCMR3_Output_OC5M_3_Values<TIM20::CCMR3_Output, 16, 1, ReadWriteMode, TIM20CCMR3_OutputBase> ;
     using OC6M_3 = TIM20_CCMR3_Output_OC6M_3_Values<TIM20::CCMR3_Output, 24, 1, ReadWriteMode, TIM20CCMR3_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FCFCU ;
     using FieldValues = TIM20_CCMR3_Output_OC6M_3_Values<TIM20::CCMR3_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +441,7 @@ struct TIM20
     using GC5C1 = TIM20_CCR5_GC5C1_Values<TIM20::CCR5, 29, 1, ReadWriteMode, TIM20CCR5Base> ;
     using GC5C2 = TIM20_CCR5_GC5C2_Values<TIM20::CCR5, 30, 1, ReadWriteMode, TIM20CCR5Base> ;
     using GC5C3 = TIM20_CCR5_GC5C3_Values<TIM20::CCR5, 31, 1, ReadWriteMode, TIM20CCR5Base> ;
+    static constexpr Type SnapshotMask = 0xE000FFFFU ;
     using FieldValues = TIM20_CCR5_GC5C3_Values<TIM20::CCR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -427,6 +453,7 @@ struct TIM20
   struct CCR6 : public RegisterBase<0x4001505C, 32, ReadWriteMode>
   {
     using CCR6Field = TIM20_CCR6_CCR6_Values<TIM20::CCR6, 0, 16, ReadWriteMode, TIM20CCR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM20_CCR6_CCR6_Values<TIM20::CCR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,12 +466,14 @@ struct TIM20
   {
     using TIM1_ETR_ADC1_RMP = TIM20_OR_TIM1_ETR_ADC1_RMP_Values<TIM20::OR, 0, 2, ReadWriteMode, TIM20ORBase> ;
     using TIM1_ETR_ADC4_RMP = TIM20_OR_TIM1_ETR_ADC4_RMP_Values<TIM20::OR, 2, 2, ReadWriteMode, TIM20ORBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM20_OR_TIM1_ETR_ADC4_RMP_Values<TIM20::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40015060, 32, ReadWriteMode, TIM20ORBase, T...> ;
 
+  using Registers = TypesList<TIM20::CR1, TIM20::CR2, TIM20::SMCR, TIM20::DIER, TIM20::SR, TIM20::EGR, TIM20::CCMR1_Output, TIM20::CCMR1_Input, TIM20::CCMR2_Output, TIM20::CCMR2_Input, TIM20::CCER, TIM20::CNT, TIM20::PSC, TIM20::ARR, TIM20::RCR, TIM20::CCR1, TIM20::CCR2, TIM20::CCR3, TIM20::CCR4, TIM20::BDTR, TIM20::DCR, TIM20::DMAR, TIM20::CCMR3_Output, TIM20::CCR5, TIM20::CCR6, TIM20::OR> ;
 } ;
 
 #endif //#if !defined(TIM20REGISTERS_HPP)
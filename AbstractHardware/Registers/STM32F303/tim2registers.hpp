@@ -30,6 +30,8 @@ struct TIM2
     using ARPE = TIM2_CR1_ARPE_Values<TIM2::CR1, 7, 1, ReadWriteMode, TIM2CR1Base> ;
     using CKD = TIM2_CR1_CKD_Values<TIM2::CR1, 8, 2, ReadWriteMode, TIM2CR1Base> ;
     using UIFREMAP = TIM2_CR1_UIFREMAP_Values<TIM2::CR1, 11, 1, ReadWriteMode, TIM2CR1Base> ;
+    static constexpr Type SnapshotMask = 0xBFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM2_CR1_UIFREMAP_Values<TIM2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +45,7 @@ struct TIM2
     using TI1S = TIM2_CR2_TI1S_Values<TIM2::CR2, 7, 1, ReadWriteMode, TIM2CR2Base> ;
     using MMS = TIM2_CR2_MMS_Values<TIM2::CR2, 4, 3, ReadWriteMode, TIM2CR2Base> ;
     using CCDS = TIM2_CR2_CCDS_Values<TIM2::CR2, 3, 1, ReadWriteMode, TIM2CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIM2_CR2_CCDS_Values<TIM2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +65,7 @@ struct TIM2
     using ECE = TIM2_SMCR_ECE_Values<TIM2::SMCR, 14, 1, ReadWriteMode, TIM2SMCRBase> ;
     using ETP = TIM2_SMCR_ETP_Values<TIM2::SMCR, 15, 1, ReadWriteMode, TIM2SMCRBase> ;
     using SMS_3 = TIM2_SMCR_SMS_3_Values<TIM2::SMCR, 16, 1, ReadWriteMode, TIM2SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = TIM2_SMCR_SMS_3_Values<TIM2::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +88,7 @@ struct TIM2
     using CC2IE = TIM2_DIER_CC2IE_Values<TIM2::DIER, 2, 1, ReadWriteMode, TIM2DIERBase> ;
     using CC1IE = TIM2_DIER_CC1IE_Values<TIM2::DIER, 1, 1, ReadWriteMode, TIM2DIERBase> ;
     using UIE = TIM2_DIER_UIE_Values<TIM2::DIER, 0, 1, ReadWriteMode, TIM2DIERBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIM2_DIER_UIE_Values<TIM2::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +109,9 @@ struct TIM2
     using CC2IF = TIM2_SR_CC2IF_Values<TIM2::SR, 2, 1, ReadWriteMode, TIM2SRBase> ;
     using CC1IF = TIM2_SR_CC1IF_Values<TIM2::SR, 1, 1, ReadWriteMode, TIM2SRBase> ;
     using UIF = TIM2_SR_UIF_Values<TIM2::SR, 0, 1, ReadWriteMode, TIM2SRBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM2_SR_UIF_Values<TIM2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +150,7 @@ struct TIM2
     using OC2CE = TIM2_CCMR1_Output_OC2CE_Values<TIM2::CCMR1_Output, 15, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
     using OC1M_3 = TIM2_CCMR1_Output_OC1M_3_Values<TIM2::CCMR1_Output, 16, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
     using OC2M_3 = TIM2_CCMR1_Output_OC2M_3_Values<TIM2::CCMR1_Output, 24, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM2_CCMR1_Output_OC2M_3_Values<TIM2::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +167,7 @@ struct TIM2
     using IC1F = TIM2_CCMR1_Input_IC1F_Values<TIM2::CCMR1_Input, 4, 4, ReadWriteMode, TIM2CCMR1_InputBase> ;
     using IC1PSC = TIM2_CCMR1_Input_IC1PSC_Values<TIM2::CCMR1_Input, 2, 2, ReadWriteMode, TIM2CCMR1_InputBase> ;
     using CC1S = TIM2_CCMR1_Input_CC1S_Values<TIM2::CCMR1_Input, 0, 2, ReadWriteMode, TIM2CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_CCMR1_Input_CC1S_Values<TIM2::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +190,7 @@ struct TIM2
     using O24CE = TIM2_CCMR2_Output_O24CE_Values<TIM2::CCMR2_Output, 15, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
     using OC3M_3 = TIM2_CCMR2_Output_OC3M_3_Values<TIM2::CCMR2_Output, 16, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
     using OC4M_3 = TIM2_CCMR2_Output_OC4M_3_Values<TIM2::CCMR2_Output, 24, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM2_CCMR2_Output_OC4M_3_Values<TIM2::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +207,7 @@ struct TIM2
     using IC3F = TIM2_CCMR2_Input_IC3F_Values<TIM2::CCMR2_Input, 4, 4, ReadWriteMode, TIM2CCMR2_InputBase> ;
     using IC3PSC = TIM2_CCMR2_Input_IC3PSC_Values<TIM2::CCMR2_Input, 2, 2, ReadWriteMode, TIM2CCMR2_InputBase> ;
     using CC3S = TIM2_CCMR2_Input_CC3S_Values<TIM2::CCMR2_Input, 0, 2, ReadWriteMode, TIM2CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_CCMR2_Input_CC3S_Values<TIM2::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +230,7 @@ struct TIM2
     using CC4E = TIM2_CCER_CC4E_Values<TIM2::CCER, 12, 1, ReadWriteMode, TIM2CCERBase> ;
     using CC4P = TIM2_CCER_CC4P_Values<TIM2::CCER, 13, 1, ReadWriteMode, TIM2CCERBase> ;
     using CC4NP = TIM2_CCER_CC4NP_Values<TIM2::CCER, 15, 1, ReadWriteMode, TIM2CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBBBU ;
     using FieldValues = TIM2_CCER_CC4NP_Values<TIM2::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -231,6 +244,7 @@ struct TIM2
     using CNTL = TIM2_CNT_CNTL_Values<TIM2::CNT, 0, 16, ReadWriteMode, TIM2CNTBase> ;
     using CNTH = TIM2_CNT_CNTH_Values<TIM2::CNT, 16, 15, ReadWriteMode, TIM2CNTBase> ;
     using CNT_or_UIFCPY = TIM2_CNT_CNT_or_UIFCPY_Values<TIM2::CNT, 31, 1, ReadWriteMode, TIM2CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM2_CNT_CNT_or_UIFCPY_Values<TIM2::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +256,7 @@ struct TIM2
   struct PSC : public RegisterBase<0x40000028, 32, ReadWriteMode>
   {
     using PSCField = TIM2_PSC_PSC_Values<TIM2::PSC, 0, 16, ReadWriteMode, TIM2PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_PSC_PSC_Values<TIM2::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +269,7 @@ struct TIM2
   {
     using ARRL = TIM2_ARR_ARRL_Values<TIM2::ARR, 0, 16, ReadWriteMode, TIM2ARRBase> ;
     using ARRH = TIM2_ARR_ARRH_Values<TIM2::ARR, 16, 16, ReadWriteMode, TIM2ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_ARR_ARRH_Values<TIM2::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +282,7 @@ struct TIM2
   {
     using CCR1L = TIM2_CCR1_CCR1L_Values<TIM2::CCR1, 0, 16, ReadWriteMode, TIM2CCR1Base> ;
     using CCR1H = TIM2_CCR1_CCR1H_Values<TIM2::CCR1, 16, 16, ReadWriteMode, TIM2CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR1_CCR1H_Values<TIM2::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +295,7 @@ struct TIM2
   {
     using CCR2L = TIM2_CCR2_CCR2L_Values<TIM2::CCR2, 0, 16, ReadWriteMode, TIM2CCR2Base> ;
     using CCR2H = TIM2_CCR2_CCR2H_Values<TIM2::CCR2, 16, 16, ReadWriteMode, TIM2CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR2_CCR2H_Values<TIM2::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -290,6 +308,7 @@ struct TIM2
   {
     using CCR3L = TIM2_CCR3_CCR3L_Values<TIM2::CCR3, 0, 16, ReadWriteMode, TIM2CCR3Base> ;
     using CCR3H = TIM2_CCR3_CCR3H_Values<TIM2::CCR3, 16, 16, ReadWriteMode, TIM2CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR3_CCR3H_Values<TIM2::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -302,6 +321,7 @@ struct TIM2
   {
     using CCR4L = TIM2_CCR4_CCR4L_Values<TIM2::CCR4, 0, 16, ReadWriteMode, TIM2CCR4Base> ;
     using CCR4H = TIM2_CCR4_CCR4H_Values<TIM2::CCR4, 16, 16, ReadWriteMode, TIM2CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM2_CCR4_CCR4H_Values<TIM2::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -314,6 +334,7 @@ struct TIM2
   {
     using DBL = TIM2_DCR_DBL_Values<TIM2::DCR, 8, 5, ReadWriteMode, TIM2DCRBase> ;
     using DBA = TIM2_DCR_DBA_Values<TIM2::DCR, 0, 5, ReadWriteMode, TIM2DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM2_DCR_DBA_Values<TIM2::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -325,12 +346,14 @@ struct TIM2
   struct DMAR : public RegisterBase<0x4000004C, 32, ReadWriteMode>
   {
     using DMAB = TIM2_DMAR_DMAB_Values<TIM2::DMAR, 0, 16, ReadWriteMode, TIM2DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM2_DMAR_DMAB_Values<TIM2::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4000004C, 32, ReadWriteMode, TIM2DMARBase, T...> ;
 
+  using Registers = TypesList<TIM2::CR1, TIM2::CR2, TIM2::SMCR, TIM2::DIER, TIM2::SR, TIM2::EGR, TIM2::CCMR1_Output, TIM2::CCMR1_Input, TIM2::CCMR2_Output, TIM2::CCMR2_Input, TIM2::CCER, TIM2::CNT, TIM2::PSC, TIM2::ARR, TIM2::CCR1, TIM2::CCR2, TIM2::CCR3, TIM2::CCR4, TIM2::DCR, TIM2::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM2REGISTERS_HPP)
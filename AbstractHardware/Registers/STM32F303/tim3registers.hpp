@@ -30,6 +30,8 @@ struct TIM3
     using ARPE = TIM3_CR1_ARPE_Values<TIM3::CR1, 7, 1, ReadWriteMode, TIM3CR1Base> ;
     using CKD = TIM3_CR1_CKD_Values<TIM3::CR1, 8, 2, ReadWriteMode, TIM3CR1Base> ;
     using UIFREMAP = TIM3_CR1_UIFREMAP_Values<TIM3::CR1, 11, 1, ReadWriteMode, TIM3CR1Base> ;
+    static constexpr Type SnapshotMask = 0xBFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM3_CR1_UIFREMAP_Values<TIM3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +45,7 @@ struct TIM3
     using TI1S = TIM3_CR2_TI1S_Values<TIM3::CR2, 7, 1, ReadWriteMode, TIM3CR2Base> ;
     using MMS = TIM3_CR2_MMS_Values<TIM3::CR2, 4, 3, ReadWriteMode, TIM3CR2Base> ;
     using CCDS = TIM3_CR2_CCDS_Values<TIM3::CR2, 3, 1, ReadWriteMode, TIM3CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIM3_CR2_CCDS_Values<TIM3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +65,7 @@ struct TIM3
     using ECE = TIM3_SMCR_ECE_Values<TIM3::SMCR, 14, 1, ReadWriteMode, TIM3SMCRBase> ;
     using ETP = TIM3_SMCR_ETP_Values<TIM3::SMCR, 15, 1, ReadWriteMode, TIM3SMCRBase> ;
     using SMS_3 = TIM3_SMCR_SMS_3_Values<TIM3::SMCR, 16, 1, ReadWriteMode, TIM3SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = TIM3_SMCR_SMS_3_Values<TIM3::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +88,7 @@ struct TIM3
     using CC2IE = TIM3_DIER_CC2IE_Values<TIM3::DIER, 2, 1, ReadWriteMode, TIM3DIERBase> ;
     using CC1IE = TIM3_DIER_CC1IE_Values<TIM3::DIER, 1, 1, ReadWriteMode, TIM3DIERBase> ;
     using UIE = TIM3_DIER_UIE_Values<TIM3::DIER, 0, 1, ReadWriteMode, TIM3DIERBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIM3_DIER_UIE_Values<TIM3::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +109,9 @@ struct TIM3
     using CC2IF = TIM3_SR_CC2IF_Values<TIM3::SR, 2, 1, ReadWriteMode, TIM3SRBase> ;
     using CC1IF = TIM3_SR_CC1IF_Values<TIM3::SR, 1, 1, ReadWriteMode, TIM3SRBase> ;
     using UIF = TIM3_SR_UIF_Values<TIM3::SR, 0, 1, ReadWriteMode, TIM3SRBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM3_SR_UIF_Values<TIM3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +150,7 @@ struct TIM3
     using OC2CE = TIM3_CCMR1_Output_OC2CE_Values<TIM3::CCMR1_Output, 15, 1, ReadWriteMode, TIM3CCMR1_OutputBase> ;
     using OC1M_3 = TIM3_CCMR1_Output_OC1M_3_Values<TIM3::CCMR1_Output, 16, 1, ReadWriteMode, TIM3CCMR1_OutputBase> ;
     using OC2M_3 = TIM3_CCMR1_Output_OC2M_3_Values<TIM3::CCMR1_Output, 24, 1, ReadWriteMode, TIM3CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM3_CCMR1_Output_OC2M_3_Values<TIM3::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +167,7 @@ struct TIM3
     using IC1F = TIM3_CCMR1_Input_IC1F_Values<TIM3::CCMR1_Input, 4, 4, ReadWriteMode, TIM3CCMR1_InputBase> ;
     using IC1PSC = TIM3_CCMR1_Input_IC1PSC_Values<TIM3::CCMR1_Input, 2, 2, ReadWriteMode, TIM3CCMR1_InputBase> ;
     using CC1S = TIM3_CCMR1_Input_CC1S_Values<TIM3::CCMR1_Input, 0, 2, ReadWriteMode, TIM3CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM3_CCMR1_Input_CC1S_Values<TIM3::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +190,7 @@ struct TIM3
     using O24CE = TIM3_CCMR2_Output_O24CE_Values<TIM3::CCMR2_Output, 15, 1, ReadWriteMode, TIM3CCMR2_OutputBase> ;
     using OC3M_3 = TIM3_CCMR2_Output_OC3M_3_Values<TIM3::CCMR2_Output, 16, 1, ReadWriteMode, TIM3CCMR2_OutputBase> ;
     using OC4M_3 = TIM3_CCMR2_Output_OC4M_3_Values<TIM3::CCMR2_Output, 24, 1, ReadWriteMode, TIM3CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM3_CCMR2_Output_OC4M_3_Values<TIM3::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +207,7 @@ struct TIM3
     using IC3F = TIM3_CCMR2_Input_IC3F_Values<TIM3::CCMR2_Input, 4, 4, ReadWriteMode, TIM3CCMR2_InputBase> ;
     using IC3PSC = TIM3_CCMR2_Input_IC3PSC_Values<TIM3::CCMR2_Input, 2, 2, ReadWriteMode, TIM3CCMR2_InputBase> ;
     using CC3S = TIM3_CCMR2_Input_CC3S_Values<TIM3::CCMR2_Input, 0, 2, ReadWriteMode, TIM3CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM3_CCMR2_Input_CC3S_Values<TIM3::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +230,7 @@ struct TIM3
     using CC4E = TIM3_CCER_CC4E_Values<TIM3::CCER, 12, 1, ReadWriteMode, TIM3CCERBase> ;
     using CC4P = TIM3_CCER_CC4P_Values<TIM3::CCER, 13, 1, ReadWriteMode, TIM3CCERBase> ;
     using CC4NP = TIM3_CCER_CC4NP_Values<TIM3::CCER, 15, 1, ReadWriteMode, TIM3CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBBBU ;
     using FieldValues = TIM3_CCER_CC4NP_Values<TIM3::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -231,6 +244,7 @@ struct TIM3
     using CNTL = TIM3_CNT_CNTL_Values<TIM3::CNT, 0, 16, ReadWriteMode, TIM3CNTBase> ;
     using CNTH = TIM3_CNT_CNTH_Values<TIM3::CNT, 16, 15, ReadWriteMode, TIM3CNTBase> ;
     using CNT_or_UIFCPY = TIM3_CNT_CNT_or_UIFCPY_Values<TIM3::CNT, 31, 1, ReadWriteMode, TIM3CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM3_CNT_CNT_or_UIFCPY_Values<TIM3::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +256,7 @@ struct TIM3
   struct PSC : public RegisterBase<0x40000428, 32, ReadWriteMode>
   {
     using PSCField = TIM3_PSC_PSC_Values<TIM3::PSC, 0, 16, ReadWriteMode, TIM3PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM3_PSC_PSC_Values<TIM3::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +269,7 @@ struct TIM3
   {
     using ARRL = TIM3_ARR_ARRL_Values<TIM3::ARR, 0, 16, ReadWriteMode, TIM3ARRBase> ;
     using ARRH = TIM3_ARR_ARRH_Values<TIM3::ARR, 16, 16, ReadWriteMode, TIM3ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM3_ARR_ARRH_Values<TIM3::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +282,7 @@ struct TIM3
   {
     using CCR1L = TIM3_CCR1_CCR1L_Values<TIM3::CCR1, 0, 16, ReadWriteMode, TIM3CCR1Base> ;
     using CCR1H = TIM3_CCR1_CCR1H_Values<TIM3::CCR1, 16, 16, ReadWriteMode, TIM3CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM3_CCR1_CCR1H_Values<TIM3::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +295,7 @@ struct TIM3
   {
     using CCR2L = TIM3_CCR2_CCR2L_Values<TIM3::CCR2, 0, 16, ReadWriteMode, TIM3CCR2Base> ;
     using CCR2H = TIM3_CCR2_CCR2H_Values<TIM3::CCR2, 16, 16, ReadWriteMode, TIM3CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM3_CCR2_CCR2H_Values<TIM3::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -290,6 +308,7 @@ struct TIM3
   {
     using CCR3L = TIM3_CCR3_CCR3L_Values<TIM3::CCR3, 0, 16, ReadWriteMode, TIM3CCR3Base> ;
     using CCR3H = TIM3_CCR3_CCR3H_Values<TIM3::CCR3, 16, 16, ReadWriteMode, TIM3CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM3_CCR3_CCR3H_Values<TIM3::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -302,6 +321,7 @@ struct TIM3
   {
     using CCR4L = TIM3_CCR4_CCR4L_Values<TIM3::CCR4, 0, 16, ReadWriteMode, TIM3CCR4Base> ;
     using CCR4H = TIM3_CCR4_CCR4H_Values<TIM3::CCR4, 16, 16, ReadWriteMode, TIM3CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM3_CCR4_CCR4H_Values<TIM3::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -314,6 +334,7 @@ struct TIM3
   {
     using DBL = TIM3_DCR_DBL_Values<TIM3::DCR, 8, 5, ReadWriteMode, TIM3DCRBase> ;
     using DBA = TIM3_DCR_DBA_Values<TIM3::DCR, 0, 5, ReadWriteMode, TIM3DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM3_DCR_DBA_Values<TIM3::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -325,12 +346,14 @@ struct TIM3
   struct DMAR : public RegisterBase<0x4000044C, 32, ReadWriteMode>
   {
     using DMAB = TIM3_DMAR_DMAB_Values<TIM3::DMAR, 0, 16, ReadWriteMode, TIM3DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM3_DMAR_DMAB_Values<TIM3::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4000044C, 32, ReadWriteMode, TIM3DMARBase, T...> ;
 
+  using Registers = TypesList<TIM3::CR1, TIM3::CR2, TIM3::SMCR, TIM3::DIER, TIM3::SR, TIM3::EGR, TIM3::CCMR1_Output, TIM3::CCMR1_Input, TIM3::CCMR2_Output, TIM3::CCMR2_Input, TIM3::CCER, TIM3::CNT, TIM3::PSC, TIM3::ARR, TIM3::CCR1, TIM3::CCR2, TIM3::CCR3, TIM3::CCR4, TIM3::DCR, TIM3::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM3REGISTERS_HPP)
@@ -30,6 +30,8 @@ struct TIM4
     using ARPE = TIM4_CR1_ARPE_Values<TIM4::CR1, 7, 1, ReadWriteMode, TIM4CR1Base> ;
     using CKD = TIM4_CR1_CKD_Values<TIM4::CR1, 8, 2, ReadWriteMode, TIM4CR1Base> ;
     using UIFREMAP = TIM4_CR1_UIFREMAP_Values<TIM4::CR1, 11, 1, ReadWriteMode, TIM4CR1Base> ;
+    static constexpr Type SnapshotMask = 0xBFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM4_CR1_UIFREMAP_Values<TIM4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +45,7 @@ struct TIM4
     using TI1S = TIM4_CR2_TI1S_Values<TIM4::CR2, 7, 1, ReadWriteMode, TIM4CR2Base> ;
     using MMS = TIM4_CR2_MMS_Values<TIM4::CR2, 4, 3, ReadWriteMode, TIM4CR2Base> ;
     using CCDS = TIM4_CR2_CCDS_Values<TIM4::CR2, 3, 1, ReadWriteMode, TIM4CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIM4_CR2_CCDS_Values<TIM4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +65,7 @@ struct TIM4
     using ECE = TIM4_SMCR_ECE_Values<TIM4::SMCR, 14, 1, ReadWriteMode, TIM4SMCRBase> ;
     using ETP = TIM4_SMCR_ETP_Values<TIM4::SMCR, 15, 1, ReadWriteMode, TIM4SMCRBase> ;
     using SMS_3 = TIM4_SMCR_SMS_3_Values<TIM4::SMCR, 16, 1, ReadWriteMode, TIM4SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = TIM4_SMCR_SMS_3_Values<TIM4::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +88,7 @@ struct TIM4
     using CC2IE = TIM4_DIER_CC2IE_Values<TIM4::DIER, 2, 1, ReadWriteMode, TIM4DIERBase> ;
     using CC1IE = TIM4_DIER_CC1IE_Values<TIM4::DIER, 1, 1, ReadWriteMode, TIM4DIERBase> ;
     using UIE = TIM4_DIER_UIE_Values<TIM4::DIER, 0, 1, ReadWriteMode, TIM4DIERBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIM4_DIER_UIE_Values<TIM4::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +109,9 @@ struct TIM4
     using CC2IF = TIM4_SR_CC2IF_Values<TIM4::SR, 2, 1, ReadWriteMode, TIM4SRBase> ;
     using CC1IF = TIM4_SR_CC1IF_Values<TIM4::SR, 1, 1, ReadWriteMode, TIM4SRBase> ;
     using UIF = TIM4_SR_UIF_Values<TIM4::SR, 0, 1, ReadWriteMode, TIM4SRBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM4_SR_UIF_Values<TIM4::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +150,7 @@ struct TIM4
     using OC2CE = TIM4_CCMR1_Output_OC2CE_Values<TIM4::CCMR1_Output, 15, 1, ReadWriteMode, TIM4CCMR1_OutputBase> ;
     using OC1M_3 = TIM4_CCMR1_Output_OC1M_3_Values<TIM4::CCMR1_Output, 16, 1, ReadWriteMode, TIM4CCMR1_OutputBase> ;
     using OC2M_3 = TIM4_CCMR1_Output_OC2M_3_Values<TIM4::CCMR1_Output, 24, 1, ReadWriteMode, TIM4CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM4_CCMR1_Output_OC2M_3_Values<TIM4::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +167,7 @@ struct TIM4
     using IC1F = TIM4_CCMR1_Input_IC1F_Values<TIM4::CCMR1_Input, 4, 4, ReadWriteMode, TIM4CCMR1_InputBase> ;
     using IC1PSC = TIM4_CCMR1_Input_IC1PSC_Values<TIM4::CCMR1_Input, 2, 2, ReadWriteMode, TIM4CCMR1_InputBase> ;
     using CC1S = TIM4_CCMR1_Input_CC1S_Values<TIM4::CCMR1_Input, 0, 2, ReadWriteMode, TIM4CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_CCMR1_Input_CC1S_Values<TIM4::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +190,7 @@ struct TIM4
     using O24CE = TIM4_CCMR2_Output_O24CE_Values<TIM4::CCMR2_Output, 15, 1, ReadWriteMode, TIM4CCMR2_OutputBase> ;
     using OC3M_3 = TIM4_CCMR2_Output_OC3M_3_Values<TIM4::CCMR2_Output, 16, 1, ReadWriteMode, TIM4CCMR2_OutputBase> ;
     using OC4M_3 = TIM4_CCMR2_Output_OC4M_3_Values<TIM4::CCMR2_Output, 24, 1, ReadWriteMode, TIM4CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM4_CCMR2_Output_OC4M_3_Values<TIM4::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +207,7 @@ struct TIM4
     using IC3F = TIM4_CCMR2_Input_IC3F_Values<TIM4::CCMR2_Input, 4, 4, ReadWriteMode, TIM4CCMR2_InputBase> ;
     using IC3PSC = TIM4_CCMR2_Input_IC3PSC_Values<TIM4::CCMR2_Input, 2, 2, ReadWriteMode, TIM4CCMR2_InputBase> ;
     using CC3S = TIM4_CCMR2_Input_CC3S_Values<TIM4::CCMR2_Input, 0, 2, ReadWriteMode, TIM4CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_CCMR2_Input_CC3S_Values<TIM4::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +230,7 @@ struct TIM4
     using CC4E = TIM4_CCER_CC4E_Values<TIM4::CCER, 12, 1, ReadWriteMode, TIM4CCERBase> ;
     using CC4P = TIM4_CCER_CC4P_Values<TIM4::CCER, 13, 1, ReadWriteMode, TIM4CCERBase> ;
     using CC4NP = TIM4_CCER_CC4NP_Values<TIM4::CCER, 15, 1, ReadWriteMode, TIM4CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBBBU ;
     using FieldValues = TIM4_CCER_CC4NP_Values<TIM4::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -231,6 +244,7 @@ struct TIM4
     using CNTL = TIM4_CNT_CNTL_Values<TIM4::CNT, 0, 16, ReadWriteMode, TIM4CNTBase> ;
     using CNTH = TIM4_CNT_CNTH_Values<TIM4::CNT, 16, 15, ReadWriteMode, TIM4CNTBase> ;
     using CNT_or_UIFCPY = TIM4_CNT_CNT_or_UIFCPY_Values<TIM4::CNT, 31, 1, ReadWriteMode, TIM4CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM4_CNT_CNT_or_UIFCPY_Values<TIM4::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +256,7 @@ struct TIM4
   struct PSC : public RegisterBase<0x40000828, 32, ReadWriteMode>
   {
     using PSCField = TIM4_PSC_PSC_Values<TIM4::PSC, 0, 16, ReadWriteMode, TIM4PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_PSC_PSC_Values<TIM4::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +269,7 @@ struct TIM4
   {
     using ARRL = TIM4_ARR_ARRL_Values<TIM4::ARR, 0, 16, ReadWriteMode, TIM4ARRBase> ;
     using ARRH = TIM4_ARR_ARRH_Values<TIM4::ARR, 16, 16, ReadWriteMode, TIM4ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_ARR_ARRH_Values<TIM4::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +282,7 @@ struct TIM4
   {
     using CCR1L = TIM4_CCR1_CCR1L_Values<TIM4::CCR1, 0, 16, ReadWriteMode, TIM4CCR1Base> ;
     using CCR1H = TIM4_CCR1_CCR1H_Values<TIM4::CCR1, 16, 16, ReadWriteMode, TIM4CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR1_CCR1H_Values<TIM4::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +295,7 @@ struct TIM4
   {
     using CCR2L = TIM4_CCR2_CCR2L_Values<TIM4::CCR2, 0, 16, ReadWriteMode, TIM4CCR2Base> ;
     using CCR2H = TIM4_CCR2_CCR2H_Values<TIM4::CCR2, 16, 16, ReadWriteMode, TIM4CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR2_CCR2H_Values<TIM4::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -290,6 +308,7 @@ struct TIM4
   {
     using CCR3L = TIM4_CCR3_CCR3L_Values<TIM4::CCR3, 0, 16, ReadWriteMode, TIM4CCR3Base> ;
     using CCR3H = TIM4_CCR3_CCR3H_Values<TIM4::CCR3, 16, 16, ReadWriteMode, TIM4CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR3_CCR3H_Values<TIM4::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -302,6 +321,7 @@ struct TIM4
   {
     using CCR4L = TIM4_CCR4_CCR4L_Values<TIM4::CCR4, 0, 16, ReadWriteMode, TIM4CCR4Base> ;
     using CCR4H = TIM4_CCR4_CCR4H_Values<TIM4::CCR4, 16, 16, ReadWriteMode, TIM4CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR4_CCR4H_Values<TIM4::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -314,6 +334,7 @@ struct TIM4
   {
     using DBL = TIM4_DCR_DBL_Values<TIM4::DCR, 8, 5, ReadWriteMode, TIM4DCRBase> ;
     using DBA = TIM4_DCR_DBA_Values<TIM4::DCR, 0, 5, ReadWriteMode, TIM4DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM4_DCR_DBA_Values<TIM4::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -325,12 +346,14 @@ struct TIM4
   struct DMAR : public RegisterBase<0x4000084C, 32, ReadWriteMode>
   {
     using DMAB = TIM4_DMAR_DMAB_Values<TIM4::DMAR, 0, 16, ReadWriteMode, TIM4DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_DMAR_DMAB_Values<TIM4::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4000084C, 32, ReadWriteMode, TIM4DMARBase, T...> ;
 
+  using Registers = TypesList<TIM4::CR1, TIM4::CR2, TIM4::SMCR, TIM4::DIER, TIM4::SR, TIM4::EGR, TIM4::CCMR1_Output, TIM4::CCMR1_Input, TIM4::CCMR2_Output, TIM4::CCMR2_Input, TIM4::CCER, TIM4::CNT, TIM4::PSC, TIM4::ARR, TIM4::CCR1, TIM4::CCR2, TIM4::CCR3, TIM4::CCR4, TIM4::DCR, TIM4::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM4REGISTERS_HPP)
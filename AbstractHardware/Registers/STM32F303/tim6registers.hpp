@@ -27,6 +27,8 @@ struct TIM6
     using OPM = TIM6_CR1_OPM_Values<TIM6::CR1, 3, 1, ReadWriteMode, TIM6CR1Base> ;
     using ARPE = TIM6_CR1_ARPE_Values<TIM6::CR1, 7, 1, ReadWriteMode, TIM6CR1Base> ;
     using UIFREMAP = TIM6_CR1_UIFREMAP_Values<TIM6::CR1, 11, 1, ReadWriteMode, TIM6CR1Base> ;
+    static constexpr Type SnapshotMask = 0x88EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM6_CR1_UIFREMAP_Values<TIM6::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM6
   struct CR2 : public RegisterBase<0x40001004, 32, ReadWriteMode>
   {
     using MMS = TIM6_CR2_MMS_Values<TIM6::CR2, 4, 3, ReadWriteMode, TIM6CR2Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIM6_CR2_MMS_Values<TIM6::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +53,7 @@ struct TIM6
   {
     using UDE = TIM6_DIER_UDE_Values<TIM6::DIER, 8, 1, ReadWriteMode, TIM6DIERBase> ;
     using UIE = TIM6_DIER_UIE_Values<TIM6::DIER, 0, 1, ReadWriteMode, TIM6DIERBase> ;
+    static constexpr Type SnapshotMask = 0x101U ;
     using FieldValues = TIM6_DIER_UIE_Values<TIM6::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +65,9 @@ struct TIM6
   struct SR : public RegisterBase<0x40001010, 32, ReadWriteMode>
   {
     using UIF = TIM6_SR_UIF_Values<TIM6::SR, 0, 1, ReadWriteMode, TIM6SRBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM6_SR_UIF_Values<TIM6::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +91,7 @@ struct TIM6
   {
     using CNTField = TIM6_CNT_CNT_Values<TIM6::CNT, 0, 16, ReadWriteMode, TIM6CNTBase> ;
     using UIFCPY = TIM6_CNT_UIFCPY_Values<TIM6::CNT, 31, 1, ReadMode, TIM6CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM6_CNT_UIFCPY_Values<TIM6::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +103,7 @@ struct TIM6
   struct PSC : public RegisterBase<0x40001028, 32, ReadWriteMode>
   {
     using PSCField = TIM6_PSC_PSC_Values<TIM6::PSC, 0, 16, ReadWriteMode, TIM6PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM6_PSC_PSC_Values<TIM6::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,12 +115,14 @@ struct TIM6
   struct ARR : public RegisterBase<0x4000102C, 32, ReadWriteMode>
   {
     using ARRField = TIM6_ARR_ARR_Values<TIM6::ARR, 0, 16, ReadWriteMode, TIM6ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM6_ARR_ARR_Values<TIM6::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ARRPack  = Register<0x4000102C, 32, ReadWriteMode, TIM6ARRBase, T...> ;
 
+  using Registers = TypesList<TIM6::CR1, TIM6::CR2, TIM6::DIER, TIM6::SR, TIM6::EGR, TIM6::CNT, TIM6::PSC, TIM6::ARR> ;
 } ;
 
 #endif //#if !defined(TIM6REGISTERS_HPP)
@@ -27,6 +27,8 @@ struct TIM7
     using OPM = TIM7_CR1_OPM_Values<TIM7::CR1, 3, 1, ReadWriteMode, TIM7CR1Base> ;
     using ARPE = TIM7_CR1_ARPE_Values<TIM7::CR1, 7, 1, ReadWriteMode, TIM7CR1Base> ;
     using UIFREMAP = TIM7_CR1_UIFREMAP_Values<TIM7::CR1, 11, 1, ReadWriteMode, TIM7CR1Base> ;
+    static constexpr Type SnapshotMask = 0x88EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM7_CR1_UIFREMAP_Values<TIM7::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM7
   struct CR2 : public RegisterBase<0x40001404, 32, ReadWriteMode>
   {
     using MMS = TIM7_CR2_MMS_Values<TIM7::CR2, 4, 3, ReadWriteMode, TIM7CR2Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIM7_CR2_MMS_Values<TIM7::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +53,7 @@ struct TIM7
   {
     using UDE = TIM7_DIER_UDE_Values<TIM7::DIER, 8, 1, ReadWriteMode, TIM7DIERBase> ;
     using UIE = TIM7_DIER_UIE_Values<TIM7::DIER, 0, 1, ReadWriteMode, TIM7DIERBase> ;
+    static constexpr Type SnapshotMask = 0x101U ;
     using FieldValues = TIM7_DIER_UIE_Values<TIM7::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +65,9 @@ struct TIM7
   struct SR : public RegisterBase<0x40001410, 32, ReadWriteMode>
   {
     using UIF = TIM7_SR_UIF_Values<TIM7::SR, 0, 1, ReadWriteMode, TIM7SRBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM7_SR_UIF_Values<TIM7::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +91,7 @@ struct TIM7
   {
     using CNTField = TIM7_CNT_CNT_Values<TIM7::CNT, 0, 16, ReadWriteMode, TIM7CNTBase> ;
     using UIFCPY = TIM7_CNT_UIFCPY_Values<TIM7::CNT, 31, 1, ReadMode, TIM7CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM7_CNT_UIFCPY_Values<TIM7::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +103,7 @@ struct TIM7
   struct PSC : public RegisterBase<0x40001428, 32, ReadWriteMode>
   {
     using PSCField = TIM7_PSC_PSC_Values<TIM7::PSC, 0, 16, ReadWriteMode, TIM7PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM7_PSC_PSC_Values<TIM7::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,12 +115,14 @@ struct TIM7
   struct ARR : public RegisterBase<0x4000142C, 32, ReadWriteMode>
   {
     using ARRField = TIM7_ARR_ARR_Values<TIM7::ARR, 0, 16, ReadWriteMode, TIM7ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM7_ARR_ARR_Values<TIM7::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ARRPack  = Register<0x4000142C, 32, ReadWriteMode, TIM7ARRBase, T...> ;
 
+  using Registers = TypesList<TIM7::CR1, TIM7::CR2, TIM7::DIER, TIM7::SR, TIM7::EGR, TIM7::CNT, TIM7::PSC, TIM7::ARR> ;
 } ;
 
 #endif //#if !defined(TIM7REGISTERS_HPP)
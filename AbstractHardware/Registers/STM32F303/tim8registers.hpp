@@ -30,6 +30,8 @@ struct TIM8
     using ARPE = TIM8_CR1_ARPE_Values<TIM8::CR1, 7, 1, ReadWriteMode, TIM8CR1Base> ;
     using CKD = TIM8_CR1_CKD_Values<TIM8::CR1, 8, 2, ReadWriteMode, TIM8CR1Base> ;
     using UIFREMAP = TIM8_CR1_UIFREMAP_Values<TIM8::CR1, 11, 1, ReadWriteMode, TIM8CR1Base> ;
+    static constexpr Type SnapshotMask = 0xBFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM8_CR1_UIFREMAP_Values<TIM8::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +57,7 @@ struct TIM8
     using OIS5 = TIM8_CR2_OIS5_Values<TIM8::CR2, 16, 1, ReadWriteMode, TIM8CR2Base> ;
     using OIS6 = TIM8_CR2_OIS6_Values<TIM8::CR2, 18, 1, ReadWriteMode, TIM8CR2Base> ;
     using MMS2 = TIM8_CR2_MMS2_Values<TIM8::CR2, 20, 4, ReadWriteMode, TIM8CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF57FFDU ;
     using FieldValues = TIM8_CR2_MMS2_Values<TIM8::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -74,6 +77,7 @@ struct TIM8
     using ECE = TIM8_SMCR_ECE_Values<TIM8::SMCR, 14, 1, ReadWriteMode, TIM8SMCRBase> ;
     using ETP = TIM8_SMCR_ETP_Values<TIM8::SMCR, 15, 1, ReadWriteMode, TIM8SMCRBase> ;
     using SMS3 = TIM8_SMCR_SMS3_Values<TIM8::SMCR, 16, 1, ReadWriteMode, TIM8SMCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = TIM8_SMCR_SMS3_Values<TIM8::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +103,7 @@ struct TIM8
     using CC2IE = TIM8_DIER_CC2IE_Values<TIM8::DIER, 2, 1, ReadWriteMode, TIM8DIERBase> ;
     using CC1IE = TIM8_DIER_CC1IE_Values<TIM8::DIER, 1, 1, ReadWriteMode, TIM8DIERBase> ;
     using UIE = TIM8_DIER_UIE_Values<TIM8::DIER, 0, 1, ReadWriteMode, TIM8DIERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = TIM8_DIER_UIE_Values<TIM8::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,9 @@ struct TIM8
     using CC4OF = TIM8_SR_CC4OF_Values<TIM8::SR, 12, 1, ReadWriteMode, TIM8SRBase> ;
     using C5IF = TIM8_SR_C5IF_Values<TIM8::SR, 16, 1, ReadWriteMode, TIM8SRBase> ;
     using C6IF = TIM8_SR_C6IF_Values<TIM8::SR, 17, 1, ReadWriteMode, TIM8SRBase> ;
+    static constexpr Type WritableMask = 0x31FFFU ;
+    static constexpr Type ZeroToClearMask = 0x31FFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM8_SR_C6IF_Values<TIM8::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +173,7 @@ struct TIM8
     using CC1S = TIM8_CCMR1_Output_CC1S_Values<TIM8::CCMR1_Output, 0, 2, ReadWriteMode, TIM8CCMR1_OutputBase> ;
     using OC1M_3 = TIM8_CCMR1_Output_OC1M_3_Values<TIM8::CCMR1_Output, 16, 1, ReadWriteMode, TIM8CCMR1_OutputBase> ;
     using OC2M_3 = TIM8_CCMR1_Output_OC2M_3_Values<TIM8::CCMR1_Output, 24, 1, ReadWriteMode, TIM8CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM8_CCMR1_Output_OC2M_3_Values<TIM8::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +190,7 @@ struct TIM8
     using IC1F = TIM8_CCMR1_Input_IC1F_Values<TIM8::CCMR1_Input, 4, 4, ReadWriteMode, TIM8CCMR1_InputBase> ;
     using IC1PCS = TIM8_CCMR1_Input_IC1PCS_Values<TIM8::CCMR1_Input, 2, 2, ReadWriteMode, TIM8CCMR1_InputBase> ;
     using CC1S = TIM8_CCMR1_Input_CC1S_Values<TIM8::CCMR1_Input, 0, 2, ReadWriteMode, TIM8CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCMR1_Input_CC1S_Values<TIM8::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,6 +213,7 @@ struct TIM8
     using CC3S = TIM8_CCMR2_Output_CC3S_Values<TIM8::CCMR2_Output, 0, 2, ReadWriteMode, TIM8CCMR2_OutputBase> ;
     using OC3M_3 = TIM8_CCMR2_Output_OC3M_3_Values<TIM8::CCMR2_Output, 16, 1, ReadWriteMode, TIM8CCMR2_OutputBase> ;
     using OC4M_3 = TIM8_CCMR2_Output_OC4M_3_Values<TIM8::CCMR2_Output, 24, 1, ReadWriteMode, TIM8CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FFFFU ;
     using FieldValues = TIM8_CCMR2_Output_OC4M_3_Values<TIM8::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +230,7 @@ struct TIM8
     using IC3F = TIM8_CCMR2_Input_IC3F_Values<TIM8::CCMR2_Input, 4, 4, ReadWriteMode, TIM8CCMR2_InputBase> ;
     using IC3PSC = TIM8_CCMR2_Input_IC3PSC_Values<TIM8::CCMR2_Input, 2, 2, ReadWriteMode, TIM8CCMR2_InputBase> ;
     using CC3S = TIM8_CCMR2_Input_CC3S_Values<TIM8::CCMR2_Input, 0, 2, ReadWriteMode, TIM8CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCMR2_Input_CC3S_Values<TIM8::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -248,6 +260,7 @@ struct TIM8
     using CC5P = TIM8_CCER_CC5P_Values<TIM8::CCER, 17, 1, ReadWriteMode, TIM8CCERBase> ;
     using CC6E = TIM8_CCER_CC6E_Values<TIM8::CCER, 20, 1, ReadWriteMode, TIM8CCERBase> ;
     using CC6P = TIM8_CCER_CC6P_Values<TIM8::CCER, 21, 1, ReadWriteMode, TIM8CCERBase> ;
+    static constexpr Type SnapshotMask = 0x33BFFFU ;
     using FieldValues = TIM8_CCER_CC6P_Values<TIM8::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -260,6 +273,7 @@ struct TIM8
   {
     using CNTField = TIM8_CNT_CNT_Values<TIM8::CNT, 0, 16, ReadWriteMode, TIM8CNTBase> ;
     using UIFCPY = TIM8_CNT_UIFCPY_Values<TIM8::CNT, 31, 1, ReadMode, TIM8CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM8_CNT_UIFCPY_Values<TIM8::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -271,6 +285,7 @@ struct TIM8
   struct PSC : public RegisterBase<0x40013428, 32, ReadWriteMode>
   {
     using PSCField = TIM8_PSC_PSC_Values<TIM8::PSC, 0, 16, ReadWriteMode, TIM8PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_PSC_PSC_Values<TIM8::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +297,7 @@ struct TIM8
   struct ARR : public RegisterBase<0x4001342C, 32, ReadWriteMode>
   {
     using ARRField = TIM8_ARR_ARR_Values<TIM8::ARR, 0, 16, ReadWriteMode, TIM8ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_ARR_ARR_Values<TIM8::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct TIM8
   struct RCR : public RegisterBase<0x40013430, 32, ReadWriteMode>
   {
     using REP = TIM8_RCR_REP_Values<TIM8::RCR, 0, 16, ReadWriteMode, TIM8RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_RCR_REP_Values<TIM8::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -304,6 +321,7 @@ struct TIM8
   struct CCR1 : public RegisterBase<0x40013434, 32, ReadWriteMode>
   {
     using CCR1Field = TIM8_CCR1_CCR1_Values<TIM8::CCR1, 0, 16, ReadWriteMode, TIM8CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCR1_CCR1_Values<TIM8::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -315,6 +333,7 @@ struct TIM8
   struct CCR2 : public RegisterBase<0x40013438, 32, ReadWriteMode>
   {
     using CCR2Field = TIM8_CCR2_CCR2_Values<TIM8::CCR2, 0, 16, ReadWriteMode, TIM8CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCR2_CCR2_Values<TIM8::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -326,6 +345,7 @@ struct TIM8
   struct CCR3 : public RegisterBase<0x4001343C, 32, ReadWriteMode>
   {
     using CCR3Field = TIM8_CCR3_CCR3_Values<TIM8::CCR3, 0, 16, ReadWriteMode, TIM8CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCR3_CCR3_Values<TIM8::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -337,6 +357,7 @@ struct TIM8
   struct CCR4 : public RegisterBase<0x40013440, 32, ReadWriteMode>
   {
     using CCR4Field = TIM8_CCR4_CCR4_Values<TIM8::CCR4, 0, 16, ReadWriteMode, TIM8CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCR4_CCR4_Values<TIM8::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -359,6 +380,7 @@ struct TIM8
     using BK2F = TIM8_BDTR_BK2F_Values<TIM8::BDTR, 20, 4, ReadWriteMode, TIM8BDTRBase> ;
     using BK2E = TIM8_BDTR_BK2E_Values<TIM8::BDTR, 24, 1, ReadWriteMode, TIM8BDTRBase> ;
     using BK2P = TIM8_BDTR_BK2P_Values<TIM8::BDTR, 25, 1, ReadWriteMode, TIM8BDTRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFU ;
     using FieldValues = TIM8_BDTR_BK2P_Values<TIM8::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -371,6 +393,7 @@ struct TIM8
   {
     using DBL = TIM8_DCR_DBL_Values<TIM8::DCR, 8, 5, ReadWriteMode, TIM8DCRBase> ;
     using DBA = TIM8_DCR_DBA_Values<TIM8::DCR, 0, 5, ReadWriteMode, TIM8DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM8_DCR_DBA_Values<TIM8::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -382,6 +405,7 @@ struct TIM8
   struct DMAR : public RegisterBase<0x4001344C, 32, ReadWriteMode>
   {
     using DMAB = TIM8_DMAR_DMAB_Values<TIM8::DMAR, 0, 16, ReadWriteMode, TIM8DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_DMAR_DMAB_Values<TIM8::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -402,6 +426,7 @@ struct TIM8
     using OC6CE = TIM8_CCMR3_Output_OC6CE_Values<TIM8::CCMR3_Output, 15, 1, ReadWriteMode, TIM8CCMR3_OutputBase> ;
     using OC5M_3 = TIM8_CCMR3_Output_OC5M_3_Values<TIM8::CCMR3_Output, 16, 1, ReadWriteMode, TIM8CCMR3_OutputBase> ;
     using OC6M_3 = TIM8_CCMR3_Output_OC6M_3_Values<TIM8::CCMR3_Output, 24, 1, ReadWriteMode, TIM8CCMR3_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x101FCFCU ;
     using FieldValues = TIM8_CCMR3_Output_OC6M_3_Values<TIM8::CCMR3_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +441,7 @@ struct TIM8
     using GC5C1 = TIM8_CCR5_GC5C1_Values<TIM8::CCR5, 29, 1, ReadWriteMode, TIM8CCR5Base> ;
     using GC5C2 = TIM8_CCR5_GC5C2_Values<TIM8::CCR5, 30, 1, ReadWriteMode, TIM8CCR5Base> ;
     using GC5C3 = TIM8_CCR5_GC5C3_Values<TIM8::CCR5, 31, 1, ReadWriteMode, TIM8CCR5Base> ;
+    static constexpr Type SnapshotMask = 0xE000FFFFU ;
     using FieldValues = TIM8_CCR5_GC5C3_Values<TIM8::CCR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -427,6 +453,7 @@ struct TIM8
   struct CCR6 : public RegisterBase<0x4001345C, 32, ReadWriteMode>
   {
     using CCR6Field = TIM8_CCR6_CCR6_Values<TIM8::CCR6, 0, 16, ReadWriteMode, TIM8CCR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM8_CCR6_CCR6_Values<TIM8::CCR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,12 +466,14 @@ struct TIM8
   {
     using TIM8_ETR_ADC2_RMP = TIM8_OR_TIM8_ETR_ADC2_RMP_Values<TIM8::OR, 0, 2, ReadWriteMode, TIM8ORBase> ;
     using TIM8_ETR_ADC3_RMP = TIM8_OR_TIM8_ETR_ADC3_RMP_Values<TIM8::OR, 2, 2, ReadWriteMode, TIM8ORBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM8_OR_TIM8_ETR_ADC3_RMP_Values<TIM8::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40013460, 32, ReadWriteMode, TIM8ORBase, T...> ;
 
+  using Registers = TypesList<TIM8::CR1, TIM8::CR2, TIM8::SMCR, TIM8::DIER, TIM8::SR, TIM8::EGR, TIM8::CCMR1_Output, TIM8::CCMR1_Input, TIM8::CCMR2_Output, TIM8::CCMR2_Input, TIM8::CCER, TIM8::CNT, TIM8::PSC, TIM8::ARR, TIM8::RCR, TIM8::CCR1, TIM8::CCR2, TIM8::CCR3, TIM8::CCR4, TIM8::BDTR, TIM8::DCR, TIM8::DMAR, TIM8::CCMR3_Output, TIM8::CCR5, TIM8::CCR6, TIM8::OR> ;
 } ;
 
 #endif //#if !defined(TIM8REGISTERS_HPP)
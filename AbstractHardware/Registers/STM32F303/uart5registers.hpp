@@ -41,6 +41,8 @@ struct UART5
     using RE = UART5_CR1_RE_Values<UART5::CR1, 2, 1, ReadWriteMode, UART5CR1Base> ;
     using UESM = UART5_CR1_UESM_Values<UART5::CR1, 1, 1, ReadWriteMode, UART5CR1Base> ;
     using UE = UART5_CR1_UE_Values<UART5::CR1, 0, 1, ReadWriteMode, UART5CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = UART5_CR1_UE_Values<UART5::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +72,7 @@ struct UART5
     using LBDIE = UART5_CR2_LBDIE_Values<UART5::CR2, 6, 1, ReadWriteMode, UART5CR2Base> ;
     using LBDL = UART5_CR2_LBDL_Values<UART5::CR2, 5, 1, ReadWriteMode, UART5CR2Base> ;
     using ADDM7 = UART5_CR2_ADDM7_Values<UART5::CR2, 4, 1, ReadWriteMode, UART5CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = UART5_CR2_ADDM7_Values<UART5::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +102,7 @@ struct UART5
     using IRLP = UART5_CR3_IRLP_Values<UART5::CR3, 2, 1, ReadWriteMode, UART5CR3Base> ;
     using IREN = UART5_CR3_IREN_Values<UART5::CR3, 1, 1, ReadWriteMode, UART5CR3Base> ;
     using EIE = UART5_CR3_EIE_Values<UART5::CR3, 0, 1, ReadWriteMode, UART5CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = UART5_CR3_EIE_Values<UART5::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct UART5
   {
     using DIV_Mantissa = UART5_BRR_DIV_Mantissa_Values<UART5::BRR, 4, 12, ReadWriteMode, UART5BRRBase> ;
     using DIV_Fraction = UART5_BRR_DIV_Fraction_Values<UART5::BRR, 0, 4, ReadWriteMode, UART5BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART5_BRR_DIV_Fraction_Values<UART5::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -123,6 +128,7 @@ struct UART5
   {
     using GT = UART5_GTPR_GT_Values<UART5::GTPR, 8, 8, ReadWriteMode, UART5GTPRBase> ;
     using PSC = UART5_GTPR_PSC_Values<UART5::GTPR, 0, 8, ReadWriteMode, UART5GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART5_GTPR_PSC_Values<UART5::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +141,7 @@ struct UART5
   {
     using BLEN = UART5_RTOR_BLEN_Values<UART5::RTOR, 24, 8, ReadWriteMode, UART5RTORBase> ;
     using RTO = UART5_RTOR_RTO_Values<UART5::RTOR, 0, 24, ReadWriteMode, UART5RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = UART5_RTOR_RTO_Values<UART5::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +157,7 @@ struct UART5
     using MMRQ = UART5_RQR_MMRQ_Values<UART5::RQR, 2, 1, ReadWriteMode, UART5RQRBase> ;
     using SBKRQ = UART5_RQR_SBKRQ_Values<UART5::RQR, 1, 1, ReadWriteMode, UART5RQRBase> ;
     using ABRRQ = UART5_RQR_ABRRQ_Values<UART5::RQR, 0, 1, ReadWriteMode, UART5RQRBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = UART5_RQR_ABRRQ_Values<UART5::RQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -204,6 +212,9 @@ struct UART5
     using NCF = UART5_ICR_NCF_Values<UART5::ICR, 2, 1, ReadWriteMode, UART5ICRBase> ;
     using FECF = UART5_ICR_FECF_Values<UART5::ICR, 1, 1, ReadWriteMode, UART5ICRBase> ;
     using PECF = UART5_ICR_PECF_Values<UART5::ICR, 0, 1, ReadWriteMode, UART5ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART5_ICR_PECF_Values<UART5::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -226,12 +237,14 @@ struct UART5
   struct TDR : public RegisterBase<0x40005028, 32, ReadWriteMode>
   {
     using TDRField = UART5_TDR_TDR_Values<UART5::TDR, 0, 9, ReadWriteMode, UART5TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART5_TDR_TDR_Values<UART5::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40005028, 32, ReadWriteMode, UART5TDRBase, T...> ;
 
+  using Registers = TypesList<UART5::CR1, UART5::CR2, UART5::CR3, UART5::BRR, UART5::GTPR, UART5::RTOR, UART5::RQR, UART5::ISR, UART5::ICR, UART5::RDR, UART5::TDR> ;
 } ;
 
 #endif //#if !defined(UART5REGISTERS_HPP)
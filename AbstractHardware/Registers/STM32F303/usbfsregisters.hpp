@@ -31,6 +31,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP0R_STAT_RX_Values<USB_FS::USB_EP0R, 12, 2, ReadWriteMode, USB_FSUSB_EP0RBase> ;
     using DTOG_RX = USB_FS_USB_EP0R_DTOG_RX_Values<USB_FS::USB_EP0R, 14, 1, ReadWriteMode, USB_FSUSB_EP0RBase> ;
     using CTR_RX = USB_FS_USB_EP0R_CTR_RX_Values<USB_FS::USB_EP0R, 15, 1, ReadWriteMode, USB_FSUSB_EP0RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP0R_CTR_RX_Values<USB_FS::USB_EP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +52,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP1R_STAT_RX_Values<USB_FS::USB_EP1R, 12, 2, ReadWriteMode, USB_FSUSB_EP1RBase> ;
     using DTOG_RX = USB_FS_USB_EP1R_DTOG_RX_Values<USB_FS::USB_EP1R, 14, 1, ReadWriteMode, USB_FSUSB_EP1RBase> ;
     using CTR_RX = USB_FS_USB_EP1R_CTR_RX_Values<USB_FS::USB_EP1R, 15, 1, ReadWriteMode, USB_FSUSB_EP1RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP1R_CTR_RX_Values<USB_FS::USB_EP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP2R_STAT_RX_Values<USB_FS::USB_EP2R, 12, 2, ReadWriteMode, USB_FSUSB_EP2RBase> ;
     using DTOG_RX = USB_FS_USB_EP2R_DTOG_RX_Values<USB_FS::USB_EP2R, 14, 1, ReadWriteMode, USB_FSUSB_EP2RBase> ;
     using CTR_RX = USB_FS_USB_EP2R_CTR_RX_Values<USB_FS::USB_EP2R, 15, 1, ReadWriteMode, USB_FSUSB_EP2RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP2R_CTR_RX_Values<USB_FS::USB_EP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +94,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP3R_STAT_RX_Values<USB_FS::USB_EP3R, 12, 2, ReadWriteMode, USB_FSUSB_EP3RBase> ;
     using DTOG_RX = USB_FS_USB_EP3R_DTOG_RX_Values<USB_FS::USB_EP3R, 14, 1, ReadWriteMode, USB_FSUSB_EP3RBase> ;
     using CTR_RX = USB_FS_USB_EP3R_CTR_RX_Values<USB_FS::USB_EP3R, 15, 1, ReadWriteMode, USB_FSUSB_EP3RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP3R_CTR_RX_Values<USB_FS::USB_EP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP4R_STAT_RX_Values<USB_FS::USB_EP4R, 12, 2, ReadWriteMode, USB_FSUSB_EP4RBase> ;
     using DTOG_RX = USB_FS_USB_EP4R_DTOG_RX_Values<USB_FS::USB_EP4R, 14, 1, ReadWriteMode, USB_FSUSB_EP4RBase> ;
     using CTR_RX = USB_FS_USB_EP4R_CTR_RX_Values<USB_FS::USB_EP4R, 15, 1, ReadWriteMode, USB_FSUSB_EP4RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP4R_CTR_RX_Values<USB_FS::USB_EP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP5R_STAT_RX_Values<USB_FS::USB_EP5R, 12, 2, ReadWriteMode, USB_FSUSB_EP5RBase> ;
     using DTOG_RX = USB_FS_USB_EP5R_DTOG_RX_Values<USB_FS::USB_EP5R, 14, 1, ReadWriteMode, USB_FSUSB_EP5RBase> ;
     using CTR_RX = USB_FS_USB_EP5R_CTR_RX_Values<USB_FS::USB_EP5R, 15, 1, ReadWriteMode, USB_FSUSB_EP5RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP5R_CTR_RX_Values<USB_FS::USB_EP5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +157,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP6R_STAT_RX_Values<USB_FS::USB_EP6R, 12, 2, ReadWriteMode, USB_FSUSB_EP6RBase> ;
     using DTOG_RX = USB_FS_USB_EP6R_DTOG_RX_Values<USB_FS::USB_EP6R, 14, 1, ReadWriteMode, USB_FSUSB_EP6RBase> ;
     using CTR_RX = USB_FS_USB_EP6R_CTR_RX_Values<USB_FS::USB_EP6R, 15, 1, ReadWriteMode, USB_FSUSB_EP6RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP6R_CTR_RX_Values<USB_FS::USB_EP6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +178,7 @@ struct USB_FS
     using STAT_RX = USB_FS_USB_EP7R_STAT_RX_Values<USB_FS::USB_EP7R, 12, 2, ReadWriteMode, USB_FSUSB_EP7RBase> ;
     using DTOG_RX = USB_FS_USB_EP7R_DTOG_RX_Values<USB_FS::USB_EP7R, 14, 1, ReadWriteMode, USB_FSUSB_EP7RBase> ;
     using CTR_RX = USB_FS_USB_EP7R_CTR_RX_Values<USB_FS::USB_EP7R, 15, 1, ReadWriteMode, USB_FSUSB_EP7RBase> ;
+    static constexpr Type SnapshotMask = 0xF7FFU ;
     using FieldValues = USB_FS_USB_EP7R_CTR_RX_Values<USB_FS::USB_EP7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -194,6 +202,7 @@ struct USB_FS
     using ERRM = USB_FS_USB_CNTR_ERRM_Values<USB_FS::USB_CNTR, 13, 1, ReadWriteMode, USB_FSUSB_CNTRBase> ;
     using PMAOVRM = USB_FS_USB_CNTR_PMAOVRM_Values<USB_FS::USB_CNTR, 14, 1, ReadWriteMode, USB_FSUSB_CNTRBase> ;
     using CTRM = USB_FS_USB_CNTR_CTRM_Values<USB_FS::USB_CNTR, 15, 1, ReadWriteMode, USB_FSUSB_CNTRBase> ;
+    static constexpr Type SnapshotMask = 0xFF1FU ;
     using FieldValues = USB_FS_USB_CNTR_CTRM_Values<USB_FS::USB_CNTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -214,6 +223,7 @@ struct USB_FS
     using ERR = USB_FS_ISTR_ERR_Values<USB_FS::ISTR, 13, 1, ReadWriteMode, USB_FSISTRBase> ;
     using PMAOVR = USB_FS_ISTR_PMAOVR_Values<USB_FS::ISTR, 14, 1, ReadWriteMode, USB_FSISTRBase> ;
     using CTR = USB_FS_ISTR_CTR_Values<USB_FS::ISTR, 15, 1, ReadMode, USB_FSISTRBase> ;
+    static constexpr Type SnapshotMask = 0x7F00U ;
     using FieldValues = USB_FS_ISTR_CTR_Values<USB_FS::ISTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -247,6 +257,7 @@ struct USB_FS
     using ADD5 = USB_FS_DADDR_ADD5_Values<USB_FS::DADDR, 5, 1, ReadWriteMode, USB_FSDADDRBase> ;
     using ADD6 = USB_FS_DADDR_ADD6_Values<USB_FS::DADDR, 6, 1, ReadWriteMode, USB_FSDADDRBase> ;
     using EF = USB_FS_DADDR_EF_Values<USB_FS::DADDR, 7, 1, ReadWriteMode, USB_FSDADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = USB_FS_DADDR_EF_Values<USB_FS::DADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -258,12 +269,14 @@ struct USB_FS
   struct BTABLE : public RegisterBase<0x40005C50, 32, ReadWriteMode>
   {
     using BTABLEField = USB_FS_BTABLE_BTABLE_Values<USB_FS::BTABLE, 3, 13, ReadWriteMode, USB_FSBTABLEBase> ;
+    static constexpr Type SnapshotMask = 0xFFF8U ;
     using FieldValues = USB_FS_BTABLE_BTABLE_Values<USB_FS::BTABLE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BTABLEPack  = Register<0x40005C50, 32, ReadWriteMode, USB_FSBTABLEBase, T...> ;
 
+  using Registers = TypesList<USB_FS::USB_EP0R, USB_FS::USB_EP1R, USB_FS::USB_EP2R, USB_FS::USB_EP3R, USB_FS::USB_EP4R, USB_FS::USB_EP5R, USB_FS::USB_EP6R, USB_FS::USB_EP7R, USB_FS::USB_CNTR, USB_FS::ISTR, USB_FS::FNR, USB_FS::DADDR, USB_FS::BTABLE> ;
 } ;
 
 #endif //#if !defined(USBFSREGISTERS_HPP)
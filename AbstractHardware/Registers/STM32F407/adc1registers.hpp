@@ -27,6 +27,9 @@ struct ADC1
     using JEOC = ADC1_SR_JEOC_Values<ADC1::SR, 2, 1, ReadWriteMode, ADC1SRBase> ;
     using EOC = ADC1_SR_EOC_Values<ADC1::SR, 1, 1, ReadWriteMode, ADC1SRBase> ;
     using AWD = ADC1_SR_AWD_Values<ADC1::SR, 0, 1, ReadWriteMode, ADC1SRBase> ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ZeroToClearMask = 0x3FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC1_SR_AWD_Values<ADC1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,7 @@ struct ADC1
     using AWDIE = ADC1_CR1_AWDIE_Values<ADC1::CR1, 6, 1, ReadWriteMode, ADC1CR1Base> ;
     using EOCIE = ADC1_CR1_EOCIE_Values<ADC1::CR1, 5, 1, ReadWriteMode, ADC1CR1Base> ;
     using AWDCH = ADC1_CR1_AWDCH_Values<ADC1::CR1, 0, 5, ReadWriteMode, ADC1CR1Base> ;
+    static constexpr Type SnapshotMask = 0x7C0FFFFU ;
     using FieldValues = ADC1_CR1_AWDCH_Values<ADC1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,8 @@ struct ADC1
     using DMA = ADC1_CR2_DMA_Values<ADC1::CR2, 8, 1, ReadWriteMode, ADC1CR2Base> ;
     using CONT = ADC1_CR2_CONT_Values<ADC1::CR2, 1, 1, ReadWriteMode, ADC1CR2Base> ;
     using ADON = ADC1_CR2_ADON_Values<ADC1::CR2, 0, 1, ReadWriteMode, ADC1CR2Base> ;
+    static constexpr Type SnapshotMask = 0x3F3F0F02U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = ADC1_CR2_ADON_Values<ADC1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +90,7 @@ struct ADC1
   struct SMPR1 : public RegisterBase<0x4001200C, 32, ReadWriteMode>
   {
     using SMPx_x = ADC1_SMPR1_SMPx_x_Values<ADC1::SMPR1, 0, 32, ReadWriteMode, ADC1SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = ADC1_SMPR1_SMPx_x_Values<ADC1::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +102,7 @@ struct ADC1
   struct SMPR2 : public RegisterBase<0x40012010, 32, ReadWriteMode>
   {
     using SMPx_x = ADC1_SMPR2_SMPx_x_Values<ADC1::SMPR2, 0, 32, ReadWriteMode, ADC1SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = ADC1_SMPR2_SMPx_x_Values<ADC1::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +114,7 @@ struct ADC1
   struct JOFR1 : public RegisterBase<0x40012014, 32, ReadWriteMode>
   {
     using JOFFSET1 = ADC1_JOFR1_JOFFSET1_Values<ADC1::JOFR1, 0, 12, ReadWriteMode, ADC1JOFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_JOFR1_JOFFSET1_Values<ADC1::JOFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +126,7 @@ struct ADC1
   struct JOFR2 : public RegisterBase<0x40012018, 32, ReadWriteMode>
   {
     using JOFFSET2 = ADC1_JOFR2_JOFFSET2_Values<ADC1::JOFR2, 0, 12, ReadWriteMode, ADC1JOFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_JOFR2_JOFFSET2_Values<ADC1::JOFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -128,6 +138,7 @@ struct ADC1
   struct JOFR3 : public RegisterBase<0x4001201C, 32, ReadWriteMode>
   {
     using JOFFSET3 = ADC1_JOFR3_JOFFSET3_Values<ADC1::JOFR3, 0, 12, ReadWriteMode, ADC1JOFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_JOFR3_JOFFSET3_Values<ADC1::JOFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -139,6 +150,7 @@ struct ADC1
   struct JOFR4 : public RegisterBase<0x40012020, 32, ReadWriteMode>
   {
     using JOFFSET4 = ADC1_JOFR4_JOFFSET4_Values<ADC1::JOFR4, 0, 12, ReadWriteMode, ADC1JOFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_JOFR4_JOFFSET4_Values<ADC1::JOFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +162,7 @@ struct ADC1
   struct HTR : public RegisterBase<0x40012024, 32, ReadWriteMode>
   {
     using HT = ADC1_HTR_HT_Values<ADC1::HTR, 0, 12, ReadWriteMode, ADC1HTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_HTR_HT_Values<ADC1::HTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +174,7 @@ struct ADC1
   struct LTR : public RegisterBase<0x40012028, 32, ReadWriteMode>
   {
     using LT = ADC1_LTR_LT_Values<ADC1::LTR, 0, 12, ReadWriteMode, ADC1LTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC1_LTR_LT_Values<ADC1::LTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +190,7 @@ struct ADC1
     using SQ15 = ADC1_SQR1_SQ15_Values<ADC1::SQR1, 10, 5, ReadWriteMode, ADC1SQR1Base> ;
     using SQ14 = ADC1_SQR1_SQ14_Values<ADC1::SQR1, 5, 5, ReadWriteMode, ADC1SQR1Base> ;
     using SQ13 = ADC1_SQR1_SQ13_Values<ADC1::SQR1, 0, 5, ReadWriteMode, ADC1SQR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC1_SQR1_SQ13_Values<ADC1::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +207,7 @@ struct ADC1
     using SQ9 = ADC1_SQR2_SQ9_Values<ADC1::SQR2, 10, 5, ReadWriteMode, ADC1SQR2Base> ;
     using SQ8 = ADC1_SQR2_SQ8_Values<ADC1::SQR2, 5, 5, ReadWriteMode, ADC1SQR2Base> ;
     using SQ7 = ADC1_SQR2_SQ7_Values<ADC1::SQR2, 0, 5, ReadWriteMode, ADC1SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC1_SQR2_SQ7_Values<ADC1::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +224,7 @@ struct ADC1
     using SQ3 = ADC1_SQR3_SQ3_Values<ADC1::SQR3, 10, 5, ReadWriteMode, ADC1SQR3Base> ;
     using SQ2 = ADC1_SQR3_SQ2_Values<ADC1::SQR3, 5, 5, ReadWriteMode, ADC1SQR3Base> ;
     using SQ1 = ADC1_SQR3_SQ1_Values<ADC1::SQR3, 0, 5, ReadWriteMode, ADC1SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC1_SQR3_SQ1_Values<ADC1::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +240,7 @@ struct ADC1
     using JSQ3 = ADC1_JSQR_JSQ3_Values<ADC1::JSQR, 10, 5, ReadWriteMode, ADC1JSQRBase> ;
     using JSQ2 = ADC1_JSQR_JSQ2_Values<ADC1::JSQR, 5, 5, ReadWriteMode, ADC1JSQRBase> ;
     using JSQ1 = ADC1_JSQR_JSQ1_Values<ADC1::JSQR, 0, 5, ReadWriteMode, ADC1JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFU ;
     using FieldValues = ADC1_JSQR_JSQ1_Values<ADC1::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +302,7 @@ struct ADC1
   template<typename... T> 
   using DRPack  = Register<0x4001204C, 32, ReadMode, ADC1DRBase, T...> ;
 
+  using Registers = TypesList<ADC1::SR, ADC1::CR1, ADC1::CR2, ADC1::SMPR1, ADC1::SMPR2, ADC1::JOFR1, ADC1::JOFR2, ADC1::JOFR3, ADC1::JOFR4, ADC1::HTR, ADC1::LTR, ADC1::SQR1, ADC1::SQR2, ADC1::SQR3, ADC1::JSQR, ADC1::JDR1, ADC1::JDR2, ADC1::JDR3, ADC1::JDR4, ADC1::DR> ;
 } ;
 
 #endif //#if !defined(ADC1REGISTERS_HPP)
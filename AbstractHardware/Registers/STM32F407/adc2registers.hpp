@@ -27,6 +27,9 @@ struct ADC2
     using JEOC = ADC2_SR_JEOC_Values<ADC2::SR, 2, 1, ReadWriteMode, ADC2SRBase> ;
     using EOC = ADC2_SR_EOC_Values<ADC2::SR, 1, 1, ReadWriteMode, ADC2SRBase> ;
     using AWD = ADC2_SR_AWD_Values<ADC2::SR, 0, 1, ReadWriteMode, ADC2SRBase> ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ZeroToClearMask = 0x3FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC2_SR_AWD_Values<ADC2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,7 @@ struct ADC2
     using AWDIE = ADC2_CR1_AWDIE_Values<ADC2::CR1, 6, 1, ReadWriteMode, ADC2CR1Base> ;
     using EOCIE = ADC2_CR1_EOCIE_Values<ADC2::CR1, 5, 1, ReadWriteMode, ADC2CR1Base> ;
     using AWDCH = ADC2_CR1_AWDCH_Values<ADC2::CR1, 0, 5, ReadWriteMode, ADC2CR1Base> ;
+    static constexpr Type SnapshotMask = 0x7C0FFFFU ;
     using FieldValues = ADC2_CR1_AWDCH_Values<ADC2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,8 @@ struct ADC2
     using DMA = ADC2_CR2_DMA_Values<ADC2::CR2, 8, 1, ReadWriteMode, ADC2CR2Base> ;
     using CONT = ADC2_CR2_CONT_Values<ADC2::CR2, 1, 1, ReadWriteMode, ADC2CR2Base> ;
     using ADON = ADC2_CR2_ADON_Values<ADC2::CR2, 0, 1, ReadWriteMode, ADC2CR2Base> ;
+    static constexpr Type SnapshotMask = 0x3F3F0F02U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = ADC2_CR2_ADON_Values<ADC2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +90,7 @@ struct ADC2
   struct SMPR1 : public RegisterBase<0x4001210C, 32, ReadWriteMode>
   {
     using SMPx_x = ADC2_SMPR1_SMPx_x_Values<ADC2::SMPR1, 0, 32, ReadWriteMode, ADC2SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = ADC2_SMPR1_SMPx_x_Values<ADC2::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +102,7 @@ struct ADC2
   struct SMPR2 : public RegisterBase<0x40012110, 32, ReadWriteMode>
   {
     using SMPx_x = ADC2_SMPR2_SMPx_x_Values<ADC2::SMPR2, 0, 32, ReadWriteMode, ADC2SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = ADC2_SMPR2_SMPx_x_Values<ADC2::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +114,7 @@ struct ADC2
   struct JOFR1 : public RegisterBase<0x40012114, 32, ReadWriteMode>
   {
     using JOFFSET1 = ADC2_JOFR1_JOFFSET1_Values<ADC2::JOFR1, 0, 12, ReadWriteMode, ADC2JOFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC2_JOFR1_JOFFSET1_Values<ADC2::JOFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +126,7 @@ struct ADC2
   struct JOFR2 : public RegisterBase<0x40012118, 32, ReadWriteMode>
   {
     using JOFFSET2 = ADC2_JOFR2_JOFFSET2_Values<ADC2::JOFR2, 0, 12, ReadWriteMode, ADC2JOFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC2_JOFR2_JOFFSET2_Values<ADC2::JOFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -128,6 +138,7 @@ struct ADC2
   struct JOFR3 : public RegisterBase<0x4001211C, 32, ReadWriteMode>
   {
     using JOFFSET3 = ADC2_JOFR3_JOFFSET3_Values<ADC2::JOFR3, 0, 12, ReadWriteMode, ADC2JOFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC2_JOFR3_JOFFSET3_Values<ADC2::JOFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -139,6 +150,7 @@ struct ADC2
   struct JOFR4 : public RegisterBase<0x40012120, 32, ReadWriteMode>
   {
     using JOFFSET4 = ADC2_JOFR4_JOFFSET4_Values<ADC2::JOFR4, 0, 12, ReadWriteMode, ADC2JOFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC2_JOFR4_JOFFSET4_Values<ADC2::JOFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +162,7 @@ struct ADC2
   struct HTR : public RegisterBase<0x40012124, 32, ReadWriteMode>
   {
     using HT = ADC2_HTR_HT_Values<ADC2::HTR, 0, 12, ReadWriteMode, ADC2HTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC2_HTR_HT_Values<ADC2::HTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +174,7 @@ struct ADC2
   struct LTR : public RegisterBase<0x40012128, 32, ReadWriteMode>
   {
     using LT = ADC2_LTR_LT_Values<ADC2::LTR, 0, 12, ReadWriteMode, ADC2LTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC2_LTR_LT_Values<ADC2::LTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +190,7 @@ struct ADC2
     using SQ15 = ADC2_SQR1_SQ15_Values<ADC2::SQR1, 10, 5, ReadWriteMode, ADC2SQR1Base> ;
     using SQ14 = ADC2_SQR1_SQ14_Values<ADC2::SQR1, 5, 5, ReadWriteMode, ADC2SQR1Base> ;
     using SQ13 = ADC2_SQR1_SQ13_Values<ADC2::SQR1, 0, 5, ReadWriteMode, ADC2SQR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC2_SQR1_SQ13_Values<ADC2::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +207,7 @@ struct ADC2
     using SQ9 = ADC2_SQR2_SQ9_Values<ADC2::SQR2, 10, 5, ReadWriteMode, ADC2SQR2Base> ;
     using SQ8 = ADC2_SQR2_SQ8_Values<ADC2::SQR2, 5, 5, ReadWriteMode, ADC2SQR2Base> ;
     using SQ7 = ADC2_SQR2_SQ7_Values<ADC2::SQR2, 0, 5, ReadWriteMode, ADC2SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC2_SQR2_SQ7_Values<ADC2::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +224,7 @@ struct ADC2
     using SQ3 = ADC2_SQR3_SQ3_Values<ADC2::SQR3, 10, 5, ReadWriteMode, ADC2SQR3Base> ;
     using SQ2 = ADC2_SQR3_SQ2_Values<ADC2::SQR3, 5, 5, ReadWriteMode, ADC2SQR3Base> ;
     using SQ1 = ADC2_SQR3_SQ1_Values<ADC2::SQR3, 0, 5, ReadWriteMode, ADC2SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC2_SQR3_SQ1_Values<ADC2::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +240,7 @@ struct ADC2
     using JSQ3 = ADC2_JSQR_JSQ3_Values<ADC2::JSQR, 10, 5, ReadWriteMode, ADC2JSQRBase> ;
     using JSQ2 = ADC2_JSQR_JSQ2_Values<ADC2::JSQR, 5, 5, ReadWriteMode, ADC2JSQRBase> ;
     using JSQ1 = ADC2_JSQR_JSQ1_Values<ADC2::JSQR, 0, 5, ReadWriteMode, ADC2JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFU ;
     using FieldValues = ADC2_JSQR_JSQ1_Values<ADC2::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +302,7 @@ struct ADC2
   template<typename... T> 
   using DRPack  = Register<0x4001214C, 32, ReadMode, ADC2DRBase, T...> ;
 
+  using Registers = TypesList<ADC2::SR, ADC2::CR1, ADC2::CR2, ADC2::SMPR1, ADC2::SMPR2, ADC2::JOFR1, ADC2::JOFR2, ADC2::JOFR3, ADC2::JOFR4, ADC2::HTR, ADC2::LTR, ADC2::SQR1, ADC2::SQR2, ADC2::SQR3, ADC2::JSQR, ADC2::JDR1, ADC2::JDR2, ADC2::JDR3, ADC2::JDR4, ADC2::DR> ;
 } ;
 
 #endif //#if !defined(ADC2REGISTERS_HPP)
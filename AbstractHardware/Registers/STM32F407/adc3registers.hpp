@@ -27,6 +27,9 @@ struct ADC3
     using JEOC = ADC3_SR_JEOC_Values<ADC3::SR, 2, 1, ReadWriteMode, ADC3SRBase> ;
     using EOC = ADC3_SR_EOC_Values<ADC3::SR, 1, 1, ReadWriteMode, ADC3SRBase> ;
     using AWD = ADC3_SR_AWD_Values<ADC3::SR, 0, 1, ReadWriteMode, ADC3SRBase> ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ZeroToClearMask = 0x3FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC3_SR_AWD_Values<ADC3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,7 @@ struct ADC3
     using AWDIE = ADC3_CR1_AWDIE_Values<ADC3::CR1, 6, 1, ReadWriteMode, ADC3CR1Base> ;
     using EOCIE = ADC3_CR1_EOCIE_Values<ADC3::CR1, 5, 1, ReadWriteMode, ADC3CR1Base> ;
     using AWDCH = ADC3_CR1_AWDCH_Values<ADC3::CR1, 0, 5, ReadWriteMode, ADC3CR1Base> ;
+    static constexpr Type SnapshotMask = 0x7C0FFFFU ;
     using FieldValues = ADC3_CR1_AWDCH_Values<ADC3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,8 @@ struct ADC3
     using DMA = ADC3_CR2_DMA_Values<ADC3::CR2, 8, 1, ReadWriteMode, ADC3CR2Base> ;
     using CONT = ADC3_CR2_CONT_Values<ADC3::CR2, 1, 1, ReadWriteMode, ADC3CR2Base> ;
     using ADON = ADC3_CR2_ADON_Values<ADC3::CR2, 0, 1, ReadWriteMode, ADC3CR2Base> ;
+    static constexpr Type SnapshotMask = 0x3F3F0F02U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = ADC3_CR2_ADON_Values<ADC3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +90,7 @@ struct ADC3
   struct SMPR1 : public RegisterBase<0x4001220C, 32, ReadWriteMode>
   {
     using SMPx_x = ADC3_SMPR1_SMPx_x_Values<ADC3::SMPR1, 0, 32, ReadWriteMode, ADC3SMPR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = ADC3_SMPR1_SMPx_x_Values<ADC3::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +102,7 @@ struct ADC3
   struct SMPR2 : public RegisterBase<0x40012210, 32, ReadWriteMode>
   {
     using SMPx_x = ADC3_SMPR2_SMPx_x_Values<ADC3::SMPR2, 0, 32, ReadWriteMode, ADC3SMPR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = ADC3_SMPR2_SMPx_x_Values<ADC3::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +114,7 @@ struct ADC3
   struct JOFR1 : public RegisterBase<0x40012214, 32, ReadWriteMode>
   {
     using JOFFSET1 = ADC3_JOFR1_JOFFSET1_Values<ADC3::JOFR1, 0, 12, ReadWriteMode, ADC3JOFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC3_JOFR1_JOFFSET1_Values<ADC3::JOFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +126,7 @@ struct ADC3
   struct JOFR2 : public RegisterBase<0x40012218, 32, ReadWriteMode>
   {
     using JOFFSET2 = ADC3_JOFR2_JOFFSET2_Values<ADC3::JOFR2, 0, 12, ReadWriteMode, ADC3JOFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC3_JOFR2_JOFFSET2_Values<ADC3::JOFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -128,6 +138,7 @@ struct ADC3
   struct JOFR3 : public RegisterBase<0x4001221C, 32, ReadWriteMode>
   {
     using JOFFSET3 = ADC3_JOFR3_JOFFSET3_Values<ADC3::JOFR3, 0, 12, ReadWriteMode, ADC3JOFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC3_JOFR3_JOFFSET3_Values<ADC3::JOFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -139,6 +150,7 @@ struct ADC3
   struct JOFR4 : public RegisterBase<0x40012220, 32, ReadWriteMode>
   {
     using JOFFSET4 = ADC3_JOFR4_JOFFSET4_Values<ADC3::JOFR4, 0, 12, ReadWriteMode, ADC3JOFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC3_JOFR4_JOFFSET4_Values<ADC3::JOFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +162,7 @@ struct ADC3
   struct HTR : public RegisterBase<0x40012224, 32, ReadWriteMode>
   {
     using HT = ADC3_HTR_HT_Values<ADC3::HTR, 0, 12, ReadWriteMode, ADC3HTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC3_HTR_HT_Values<ADC3::HTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +174,7 @@ struct ADC3
   struct LTR : public RegisterBase<0x40012228, 32, ReadWriteMode>
   {
     using LT = ADC3_LTR_LT_Values<ADC3::LTR, 0, 12, ReadWriteMode, ADC3LTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = ADC3_LTR_LT_Values<ADC3::LTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +190,7 @@ struct ADC3
     using SQ15 = ADC3_SQR1_SQ15_Values<ADC3::SQR1, 10, 5, ReadWriteMode, ADC3SQR1Base> ;
     using SQ14 = ADC3_SQR1_SQ14_Values<ADC3::SQR1, 5, 5, ReadWriteMode, ADC3SQR1Base> ;
     using SQ13 = ADC3_SQR1_SQ13_Values<ADC3::SQR1, 0, 5, ReadWriteMode, ADC3SQR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = ADC3_SQR1_SQ13_Values<ADC3::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +207,7 @@ struct ADC3
     using SQ9 = ADC3_SQR2_SQ9_Values<ADC3::SQR2, 10, 5, ReadWriteMode, ADC3SQR2Base> ;
     using SQ8 = ADC3_SQR2_SQ8_Values<ADC3::SQR2, 5, 5, ReadWriteMode, ADC3SQR2Base> ;
     using SQ7 = ADC3_SQR2_SQ7_Values<ADC3::SQR2, 0, 5, ReadWriteMode, ADC3SQR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC3_SQR2_SQ7_Values<ADC3::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +224,7 @@ struct ADC3
     using SQ3 = ADC3_SQR3_SQ3_Values<ADC3::SQR3, 10, 5, ReadWriteMode, ADC3SQR3Base> ;
     using SQ2 = ADC3_SQR3_SQ2_Values<ADC3::SQR3, 5, 5, ReadWriteMode, ADC3SQR3Base> ;
     using SQ1 = ADC3_SQR3_SQ1_Values<ADC3::SQR3, 0, 5, ReadWriteMode, ADC3SQR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = ADC3_SQR3_SQ1_Values<ADC3::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +240,7 @@ struct ADC3
     using JSQ3 = ADC3_JSQR_JSQ3_Values<ADC3::JSQR, 10, 5, ReadWriteMode, ADC3JSQRBase> ;
     using JSQ2 = ADC3_JSQR_JSQ2_Values<ADC3::JSQR, 5, 5, ReadWriteMode, ADC3JSQRBase> ;
     using JSQ1 = ADC3_JSQR_JSQ1_Values<ADC3::JSQR, 0, 5, ReadWriteMode, ADC3JSQRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFU ;
     using FieldValues = ADC3_JSQR_JSQ1_Values<ADC3::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +302,7 @@ struct ADC3
   template<typename... T> 
   using DRPack  = Register<0x4001224C, 32, ReadMode, ADC3DRBase, T...> ;
 
+  using Registers = TypesList<ADC3::SR, ADC3::CR1, ADC3::CR2, ADC3::SMPR1, ADC3::SMPR2, ADC3::JOFR1, ADC3::JOFR2, ADC3::JOFR3, ADC3::JOFR4, ADC3::HTR, ADC3::LTR, ADC3::SQR1, ADC3::SQR2, ADC3::SQR3, ADC3::JSQR, ADC3::JDR1, ADC3::JDR2, ADC3::JDR3, ADC3::JDR4, ADC3::DR> ;
 } ;
 
 #endif //#if !defined(ADC3REGISTERS_HPP)
@@ -56,6 +56,7 @@ struct C_ADC
     using DDS = C_ADC_CCR_DDS_Values<C_ADC::CCR, 13, 1, ReadWriteMode, C_ADCCCRBase> ;
     using DELAY = C_ADC_CCR_DELAY_Values<C_ADC::CCR, 8, 4, ReadWriteMode, C_ADCCCRBase> ;
     using MULT = C_ADC_CCR_MULT_Values<C_ADC::CCR, 0, 5, ReadWriteMode, C_ADCCCRBase> ;
+    static constexpr Type SnapshotMask = 0xC3EF1FU ;
     using FieldValues = C_ADC_CCR_MULT_Values<C_ADC::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -74,6 +75,7 @@ struct C_ADC
   template<typename... T> 
   using CDRPack  = Register<0x40012308, 32, ReadMode, C_ADCCDRBase, T...> ;
 
+  using Registers = TypesList<C_ADC::CSR, C_ADC::CCR, C_ADC::CDR> ;
 } ;
 
 #endif //#if !defined(CADCREGISTERS_HPP)
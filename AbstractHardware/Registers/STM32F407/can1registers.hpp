@@ -31,6 +31,7 @@ struct CAN1
     using TXFP = CAN1_MCR_TXFP_Values<CAN1::MCR, 2, 1, ReadWriteMode, CAN1MCRBase> ;
     using SLEEP = CAN1_MCR_SLEEP_Values<CAN1::MCR, 1, 1, ReadWriteMode, CAN1MCRBase> ;
     using INRQ = CAN1_MCR_INRQ_Values<CAN1::MCR, 0, 1, ReadWriteMode, CAN1MCRBase> ;
+    static constexpr Type SnapshotMask = 0x180FFU ;
     using FieldValues = CAN1_MCR_INRQ_Values<CAN1::MCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +51,7 @@ struct CAN1
     using ERRI = CAN1_MSR_ERRI_Values<CAN1::MSR, 2, 1, ReadWriteMode, CAN1MSRBase> ;
     using SLAK = CAN1_MSR_SLAK_Values<CAN1::MSR, 1, 1, ReadMode, CAN1MSRBase> ;
     using INAK = CAN1_MSR_INAK_Values<CAN1::MSR, 0, 1, ReadMode, CAN1MSRBase> ;
+    static constexpr Type SnapshotMask = 0x1CU ;
     using FieldValues = CAN1_MSR_INAK_Values<CAN1::MSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +84,7 @@ struct CAN1
     using ALST0 = CAN1_TSR_ALST0_Values<CAN1::TSR, 2, 1, ReadWriteMode, CAN1TSRBase> ;
     using TXOK0 = CAN1_TSR_TXOK0_Values<CAN1::TSR, 1, 1, ReadWriteMode, CAN1TSRBase> ;
     using RQCP0 = CAN1_TSR_RQCP0_Values<CAN1::TSR, 0, 1, ReadWriteMode, CAN1TSRBase> ;
+    static constexpr Type SnapshotMask = 0x8F8F8FU ;
     using FieldValues = CAN1_TSR_RQCP0_Values<CAN1::TSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +99,7 @@ struct CAN1
     using FOVR0 = CAN1_RF0R_FOVR0_Values<CAN1::RF0R, 4, 1, ReadWriteMode, CAN1RF0RBase> ;
     using FULL0 = CAN1_RF0R_FULL0_Values<CAN1::RF0R, 3, 1, ReadWriteMode, CAN1RF0RBase> ;
     using FMP0 = CAN1_RF0R_FMP0_Values<CAN1::RF0R, 0, 2, ReadMode, CAN1RF0RBase> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN1_RF0R_FMP0_Values<CAN1::RF0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +114,7 @@ struct CAN1
     using FOVR1 = CAN1_RF1R_FOVR1_Values<CAN1::RF1R, 4, 1, ReadWriteMode, CAN1RF1RBase> ;
     using FULL1 = CAN1_RF1R_FULL1_Values<CAN1::RF1R, 3, 1, ReadWriteMode, CAN1RF1RBase> ;
     using FMP1 = CAN1_RF1R_FMP1_Values<CAN1::RF1R, 0, 2, ReadMode, CAN1RF1RBase> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN1_RF1R_FMP1_Values<CAN1::RF1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +139,7 @@ struct CAN1
     using FFIE0 = CAN1_IER_FFIE0_Values<CAN1::IER, 2, 1, ReadWriteMode, CAN1IERBase> ;
     using FMPIE0 = CAN1_IER_FMPIE0_Values<CAN1::IER, 1, 1, ReadWriteMode, CAN1IERBase> ;
     using TMEIE = CAN1_IER_TMEIE_Values<CAN1::IER, 0, 1, ReadWriteMode, CAN1IERBase> ;
+    static constexpr Type SnapshotMask = 0x38F7FU ;
     using FieldValues = CAN1_IER_TMEIE_Values<CAN1::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +156,7 @@ struct CAN1
     using BOFF = CAN1_ESR_BOFF_Values<CAN1::ESR, 2, 1, ReadMode, CAN1ESRBase> ;
     using EPVF = CAN1_ESR_EPVF_Values<CAN1::ESR, 1, 1, ReadMode, CAN1ESRBase> ;
     using EWGF = CAN1_ESR_EWGF_Values<CAN1::ESR, 0, 1, ReadMode, CAN1ESRBase> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = CAN1_ESR_EWGF_Values<CAN1::ESR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +173,7 @@ struct CAN1
     using TS2 = CAN1_BTR_TS2_Values<CAN1::BTR, 20, 3, ReadWriteMode, CAN1BTRBase> ;
     using TS1 = CAN1_BTR_TS1_Values<CAN1::BTR, 16, 4, ReadWriteMode, CAN1BTRBase> ;
     using BRP = CAN1_BTR_BRP_Values<CAN1::BTR, 0, 10, ReadWriteMode, CAN1BTRBase> ;
+    static constexpr Type SnapshotMask = 0xC37F03FFU ;
     using FieldValues = CAN1_BTR_BRP_Values<CAN1::BTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +189,7 @@ struct CAN1
     using IDE = CAN1_TI0R_IDE_Values<CAN1::TI0R, 2, 1, ReadWriteMode, CAN1TI0RBase> ;
     using RTR = CAN1_TI0R_RTR_Values<CAN1::TI0R, 1, 1, ReadWriteMode, CAN1TI0RBase> ;
     using TXRQ = CAN1_TI0R_TXRQ_Values<CAN1::TI0R, 0, 1, ReadWriteMode, CAN1TI0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TI0R_TXRQ_Values<CAN1::TI0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -194,6 +203,7 @@ struct CAN1
     using TIME = CAN1_TDT0R_TIME_Values<CAN1::TDT0R, 16, 16, ReadWriteMode, CAN1TDT0RBase> ;
     using TGT = CAN1_TDT0R_TGT_Values<CAN1::TDT0R, 8, 1, ReadWriteMode, CAN1TDT0RBase> ;
     using DLC = CAN1_TDT0R_DLC_Values<CAN1::TDT0R, 0, 4, ReadWriteMode, CAN1TDT0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN1_TDT0R_DLC_Values<CAN1::TDT0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +218,7 @@ struct CAN1
     using DATA2 = CAN1_TDL0R_DATA2_Values<CAN1::TDL0R, 16, 8, ReadWriteMode, CAN1TDL0RBase> ;
     using DATA1 = CAN1_TDL0R_DATA1_Values<CAN1::TDL0R, 8, 8, ReadWriteMode, CAN1TDL0RBase> ;
     using DATA0 = CAN1_TDL0R_DATA0_Values<CAN1::TDL0R, 0, 8, ReadWriteMode, CAN1TDL0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TDL0R_DATA0_Values<CAN1::TDL0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +233,7 @@ struct CAN1
     using DATA6 = CAN1_TDH0R_DATA6_Values<CAN1::TDH0R, 16, 8, ReadWriteMode, CAN1TDH0RBase> ;
     using DATA5 = CAN1_TDH0R_DATA5_Values<CAN1::TDH0R, 8, 8, ReadWriteMode, CAN1TDH0RBase> ;
     using DATA4 = CAN1_TDH0R_DATA4_Values<CAN1::TDH0R, 0, 8, ReadWriteMode, CAN1TDH0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TDH0R_DATA4_Values<CAN1::TDH0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +249,7 @@ struct CAN1
     using IDE = CAN1_TI1R_IDE_Values<CAN1::TI1R, 2, 1, ReadWriteMode, CAN1TI1RBase> ;
     using RTR = CAN1_TI1R_RTR_Values<CAN1::TI1R, 1, 1, ReadWriteMode, CAN1TI1RBase> ;
     using TXRQ = CAN1_TI1R_TXRQ_Values<CAN1::TI1R, 0, 1, ReadWriteMode, CAN1TI1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TI1R_TXRQ_Values<CAN1::TI1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -250,6 +263,7 @@ struct CAN1
     using TIME = CAN1_TDT1R_TIME_Values<CAN1::TDT1R, 16, 16, ReadWriteMode, CAN1TDT1RBase> ;
     using TGT = CAN1_TDT1R_TGT_Values<CAN1::TDT1R, 8, 1, ReadWriteMode, CAN1TDT1RBase> ;
     using DLC = CAN1_TDT1R_DLC_Values<CAN1::TDT1R, 0, 4, ReadWriteMode, CAN1TDT1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN1_TDT1R_DLC_Values<CAN1::TDT1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +278,7 @@ struct CAN1
     using DATA2 = CAN1_TDL1R_DATA2_Values<CAN1::TDL1R, 16, 8, ReadWriteMode, CAN1TDL1RBase> ;
     using DATA1 = CAN1_TDL1R_DATA1_Values<CAN1::TDL1R, 8, 8, ReadWriteMode, CAN1TDL1RBase> ;
     using DATA0 = CAN1_TDL1R_DATA0_Values<CAN1::TDL1R, 0, 8, ReadWriteMode, CAN1TDL1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TDL1R_DATA0_Values<CAN1::TDL1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +293,7 @@ struct CAN1
     using DATA6 = CAN1_TDH1R_DATA6_Values<CAN1::TDH1R, 16, 8, ReadWriteMode, CAN1TDH1RBase> ;
     using DATA5 = CAN1_TDH1R_DATA5_Values<CAN1::TDH1R, 8, 8, ReadWriteMode, CAN1TDH1RBase> ;
     using DATA4 = CAN1_TDH1R_DATA4_Values<CAN1::TDH1R, 0, 8, ReadWriteMode, CAN1TDH1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TDH1R_DATA4_Values<CAN1::TDH1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct CAN1
     using IDE = CAN1_TI2R_IDE_Values<CAN1::TI2R, 2, 1, ReadWriteMode, CAN1TI2RBase> ;
     using RTR = CAN1_TI2R_RTR_Values<CAN1::TI2R, 1, 1, ReadWriteMode, CAN1TI2RBase> ;
     using TXRQ = CAN1_TI2R_TXRQ_Values<CAN1::TI2R, 0, 1, ReadWriteMode, CAN1TI2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TI2R_TXRQ_Values<CAN1::TI2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +323,7 @@ struct CAN1
     using TIME = CAN1_TDT2R_TIME_Values<CAN1::TDT2R, 16, 16, ReadWriteMode, CAN1TDT2RBase> ;
     using TGT = CAN1_TDT2R_TGT_Values<CAN1::TDT2R, 8, 1, ReadWriteMode, CAN1TDT2RBase> ;
     using DLC = CAN1_TDT2R_DLC_Values<CAN1::TDT2R, 0, 4, ReadWriteMode, CAN1TDT2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN1_TDT2R_DLC_Values<CAN1::TDT2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -320,6 +338,7 @@ struct CAN1
     using DATA2 = CAN1_TDL2R_DATA2_Values<CAN1::TDL2R, 16, 8, ReadWriteMode, CAN1TDL2RBase> ;
     using DATA1 = CAN1_TDL2R_DATA1_Values<CAN1::TDL2R, 8, 8, ReadWriteMode, CAN1TDL2RBase> ;
     using DATA0 = CAN1_TDL2R_DATA0_Values<CAN1::TDL2R, 0, 8, ReadWriteMode, CAN1TDL2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TDL2R_DATA0_Values<CAN1::TDL2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -334,6 +353,7 @@ struct CAN1
     using DATA6 = CAN1_TDH2R_DATA6_Values<CAN1::TDH2R, 16, 8, ReadWriteMode, CAN1TDH2RBase> ;
     using DATA5 = CAN1_TDH2R_DATA5_Values<CAN1::TDH2R, 8, 8, ReadWriteMode, CAN1TDH2RBase> ;
     using DATA4 = CAN1_TDH2R_DATA4_Values<CAN1::TDH2R, 0, 8, ReadWriteMode, CAN1TDH2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_TDH2R_DATA4_Values<CAN1::TDH2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -456,6 +476,7 @@ struct CAN1
   {
     using CAN2SB = CAN1_FMR_CAN2SB_Values<CAN1::FMR, 8, 6, ReadWriteMode, CAN1FMRBase> ;
     using FINIT = CAN1_FMR_FINIT_Values<CAN1::FMR, 0, 1, ReadWriteMode, CAN1FMRBase> ;
+    static constexpr Type SnapshotMask = 0x3F01U ;
     using FieldValues = CAN1_FMR_FINIT_Values<CAN1::FMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -494,6 +515,7 @@ struct CAN1
     using FBM25 = CAN1_FM1R_FBM25_Values<CAN1::FM1R, 25, 1, ReadWriteMode, CAN1FM1RBase> ;
     using FBM26 = CAN1_FM1R_FBM26_Values<CAN1::FM1R, 26, 1, ReadWriteMode, CAN1FM1RBase> ;
     using FBM27 = CAN1_FM1R_FBM27_Values<CAN1::FM1R, 27, 1, ReadWriteMode, CAN1FM1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FM1R_FBM27_Values<CAN1::FM1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -532,6 +554,7 @@ struct CAN1
     using FSC25 = CAN1_FS1R_FSC25_Values<CAN1::FS1R, 25, 1, ReadWriteMode, CAN1FS1RBase> ;
     using FSC26 = CAN1_FS1R_FSC26_Values<CAN1::FS1R, 26, 1, ReadWriteMode, CAN1FS1RBase> ;
     using FSC27 = CAN1_FS1R_FSC27_Values<CAN1::FS1R, 27, 1, ReadWriteMode, CAN1FS1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FS1R_FSC27_Values<CAN1::FS1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -570,6 +593,7 @@ struct CAN1
     using FFA25 = CAN1_FFA1R_FFA25_Values<CAN1::FFA1R, 25, 1, ReadWriteMode, CAN1FFA1RBase> ;
     using FFA26 = CAN1_FFA1R_FFA26_Values<CAN1::FFA1R, 26, 1, ReadWriteMode, CAN1FFA1RBase> ;
     using FFA27 = CAN1_FFA1R_FFA27_Values<CAN1::FFA1R, 27, 1, ReadWriteMode, CAN1FFA1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FFA1R_FFA27_Values<CAN1::FFA1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +632,7 @@ struct CAN1
     using FACT25 = CAN1_FA1R_FACT25_Values<CAN1::FA1R, 25, 1, ReadWriteMode, CAN1FA1RBase> ;
     using FACT26 = CAN1_FA1R_FACT26_Values<CAN1::FA1R, 26, 1, ReadWriteMode, CAN1FA1RBase> ;
     using FACT27 = CAN1_FA1R_FACT27_Values<CAN1::FA1R, 27, 1, ReadWriteMode, CAN1FA1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN1_FA1R_FACT27_Values<CAN1::FA1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -650,6 +675,7 @@ struct CAN1
     using FB29 = CAN1_F0R1_FB29_Values<CAN1::F0R1, 29, 1, ReadWriteMode, CAN1F0R1Base> ;
     using FB30 = CAN1_F0R1_FB30_Values<CAN1::F0R1, 30, 1, ReadWriteMode, CAN1F0R1Base> ;
     using FB31 = CAN1_F0R1_FB31_Values<CAN1::F0R1, 31, 1, ReadWriteMode, CAN1F0R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F0R1_FB31_Values<CAN1::F0R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -692,6 +718,7 @@ struct CAN1
     using FB29 = CAN1_F0R2_FB29_Values<CAN1::F0R2, 29, 1, ReadWriteMode, CAN1F0R2Base> ;
     using FB30 = CAN1_F0R2_FB30_Values<CAN1::F0R2, 30, 1, ReadWriteMode, CAN1F0R2Base> ;
     using FB31 = CAN1_F0R2_FB31_Values<CAN1::F0R2, 31, 1, ReadWriteMode, CAN1F0R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F0R2_FB31_Values<CAN1::F0R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -734,6 +761,7 @@ struct CAN1
     using FB29 = CAN1_F1R1_FB29_Values<CAN1::F1R1, 29, 1, ReadWriteMode, CAN1F1R1Base> ;
     using FB30 = CAN1_F1R1_FB30_Values<CAN1::F1R1, 30, 1, ReadWriteMode, CAN1F1R1Base> ;
     using FB31 = CAN1_F1R1_FB31_Values<CAN1::F1R1, 31, 1, ReadWriteMode, CAN1F1R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F1R1_FB31_Values<CAN1::F1R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +804,7 @@ struct CAN1
     using FB29 = CAN1_F1R2_FB29_Values<CAN1::F1R2, 29, 1, ReadWriteMode, CAN1F1R2Base> ;
     using FB30 = CAN1_F1R2_FB30_Values<CAN1::F1R2, 30, 1, ReadWriteMode, CAN1F1R2Base> ;
     using FB31 = CAN1_F1R2_FB31_Values<CAN1::F1R2, 31, 1, ReadWriteMode, CAN1F1R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F1R2_FB31_Values<CAN1::F1R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -818,6 +847,7 @@ struct CAN1
     using FB29 = CAN1_F2R1_FB29_Values<CAN1::F2R1, 29, 1, ReadWriteMode, CAN1F2R1Base> ;
     using FB30 = CAN1_F2R1_FB30_Values<CAN1::F2R1, 30, 1, ReadWriteMode, CAN1F2R1Base> ;
     using FB31 = CAN1_F2R1_FB31_Values<CAN1::F2R1, 31, 1, ReadWriteMode, CAN1F2R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F2R1_FB31_Values<CAN1::F2R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -860,6 +890,7 @@ struct CAN1
     using FB29 = CAN1_F2R2_FB29_Values<CAN1::F2R2, 29, 1, ReadWriteMode, CAN1F2R2Base> ;
     using FB30 = CAN1_F2R2_FB30_Values<CAN1::F2R2, 30, 1, ReadWriteMode, CAN1F2R2Base> ;
     using FB31 = CAN1_F2R2_FB31_Values<CAN1::F2R2, 31, 1, ReadWriteMode, CAN1F2R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F2R2_FB31_Values<CAN1::F2R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -902,6 +933,7 @@ struct CAN1
     using FB29 = CAN1_F3R1_FB29_Values<CAN1::F3R1, 29, 1, ReadWriteMode, CAN1F3R1Base> ;
     using FB30 = CAN1_F3R1_FB30_Values<CAN1::F3R1, 30, 1, ReadWriteMode, CAN1F3R1Base> ;
     using FB31 = CAN1_F3R1_FB31_Values<CAN1::F3R1, 31, 1, ReadWriteMode, CAN1F3R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F3R1_FB31_Values<CAN1::F3R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -944,6 +976,7 @@ struct CAN1
     using FB29 = CAN1_F3R2_FB29_Values<CAN1::F3R2, 29, 1, ReadWriteMode, CAN1F3R2Base> ;
     using FB30 = CAN1_F3R2_FB30_Values<CAN1::F3R2, 30, 1, ReadWriteMode, CAN1F3R2Base> ;
     using FB31 = CAN1_F3R2_FB31_Values<CAN1::F3R2, 31, 1, ReadWriteMode, CAN1F3R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F3R2_FB31_Values<CAN1::F3R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -986,6 +1019,7 @@ struct CAN1
     using FB29 = CAN1_F4R1_FB29_Values<CAN1::F4R1, 29, 1, ReadWriteMode, CAN1F4R1Base> ;
     using FB30 = CAN1_F4R1_FB30_Values<CAN1::F4R1, 30, 1, ReadWriteMode, CAN1F4R1Base> ;
     using FB31 = CAN1_F4R1_FB31_Values<CAN1::F4R1, 31, 1, ReadWriteMode, CAN1F4R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F4R1_FB31_Values<CAN1::F4R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1028,6 +1062,7 @@ struct CAN1
     using FB29 = CAN1_F4R2_FB29_Values<CAN1::F4R2, 29, 1, ReadWriteMode, CAN1F4R2Base> ;
     using FB30 = CAN1_F4R2_FB30_Values<CAN1::F4R2, 30, 1, ReadWriteMode, CAN1F4R2Base> ;
     using FB31 = CAN1_F4R2_FB31_Values<CAN1::F4R2, 31, 1, ReadWriteMode, CAN1F4R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F4R2_FB31_Values<CAN1::F4R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1070,6 +1105,7 @@ struct CAN1
     using FB29 = CAN1_F5R1_FB29_Values<CAN1::F5R1, 29, 1, ReadWriteMode, CAN1F5R1Base> ;
     using FB30 = CAN1_F5R1_FB30_Values<CAN1::F5R1, 30, 1, ReadWriteMode, CAN1F5R1Base> ;
     using FB31 = CAN1_F5R1_FB31_Values<CAN1::F5R1, 31, 1, ReadWriteMode, CAN1F5R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F5R1_FB31_Values<CAN1::F5R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1112,6 +1148,7 @@ struct CAN1
     using FB29 = CAN1_F5R2_FB29_Values<CAN1::F5R2, 29, 1, ReadWriteMode, CAN1F5R2Base> ;
     using FB30 = CAN1_F5R2_FB30_Values<CAN1::F5R2, 30, 1, ReadWriteMode, CAN1F5R2Base> ;
     using FB31 = CAN1_F5R2_FB31_Values<CAN1::F5R2, 31, 1, ReadWriteMode, CAN1F5R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F5R2_FB31_Values<CAN1::F5R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1154,6 +1191,7 @@ struct CAN1
     using FB29 = CAN1_F6R1_FB29_Values<CAN1::F6R1, 29, 1, ReadWriteMode, CAN1F6R1Base> ;
     using FB30 = CAN1_F6R1_FB30_Values<CAN1::F6R1, 30, 1, ReadWriteMode, CAN1F6R1Base> ;
     using FB31 = CAN1_F6R1_FB31_Values<CAN1::F6R1, 31, 1, ReadWriteMode, CAN1F6R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F6R1_FB31_Values<CAN1::F6R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1196,6 +1234,7 @@ struct CAN1
     using FB29 = CAN1_F6R2_FB29_Values<CAN1::F6R2, 29, 1, ReadWriteMode, CAN1F6R2Base> ;
     using FB30 = CAN1_F6R2_FB30_Values<CAN1::F6R2, 30, 1, ReadWriteMode, CAN1F6R2Base> ;
     using FB31 = CAN1_F6R2_FB31_Values<CAN1::F6R2, 31, 1, ReadWriteMode, CAN1F6R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F6R2_FB31_Values<CAN1::F6R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1238,6 +1277,7 @@ struct CAN1
     using FB29 = CAN1_F7R1_FB29_Values<CAN1::F7R1, 29, 1, ReadWriteMode, CAN1F7R1Base> ;
     using FB30 = CAN1_F7R1_FB30_Values<CAN1::F7R1, 30, 1, ReadWriteMode, CAN1F7R1Base> ;
     using FB31 = CAN1_F7R1_FB31_Values<CAN1::F7R1, 31, 1, ReadWriteMode, CAN1F7R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F7R1_FB31_Values<CAN1::F7R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1280,6 +1320,7 @@ struct CAN1
     using FB29 = CAN1_F7R2_FB29_Values<CAN1::F7R2, 29, 1, ReadWriteMode, CAN1F7R2Base> ;
     using FB30 = CAN1_F7R2_FB30_Values<CAN1::F7R2, 30, 1, ReadWriteMode, CAN1F7R2Base> ;
     using FB31 = CAN1_F7R2_FB31_Values<CAN1::F7R2, 31, 1, ReadWriteMode, CAN1F7R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F7R2_FB31_Values<CAN1::F7R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1322,6 +1363,7 @@ struct CAN1
     using FB29 = CAN1_F8R1_FB29_Values<CAN1::F8R1, 29, 1, ReadWriteMode, CAN1F8R1Base> ;
     using FB30 = CAN1_F8R1_FB30_Values<CAN1::F8R1, 30, 1, ReadWriteMode, CAN1F8R1Base> ;
     using FB31 = CAN1_F8R1_FB31_Values<CAN1::F8R1, 31, 1, ReadWriteMode, CAN1F8R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F8R1_FB31_Values<CAN1::F8R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1364,6 +1406,7 @@ struct CAN1
     using FB29 = CAN1_F8R2_FB29_Values<CAN1::F8R2, 29, 1, ReadWriteMode, CAN1F8R2Base> ;
     using FB30 = CAN1_F8R2_FB30_Values<CAN1::F8R2, 30, 1, ReadWriteMode, CAN1F8R2Base> ;
     using FB31 = CAN1_F8R2_FB31_Values<CAN1::F8R2, 31, 1, ReadWriteMode, CAN1F8R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F8R2_FB31_Values<CAN1::F8R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1406,6 +1449,7 @@ struct CAN1
     using FB29 = CAN1_F9R1_FB29_Values<CAN1::F9R1, 29, 1, ReadWriteMode, CAN1F9R1Base> ;
     using FB30 = CAN1_F9R1_FB30_Values<CAN1::F9R1, 30, 1, ReadWriteMode, CAN1F9R1Base> ;
     using FB31 = CAN1_F9R1_FB31_Values<CAN1::F9R1, 31, 1, ReadWriteMode, CAN1F9R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F9R1_FB31_Values<CAN1::F9R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1448,6 +1492,7 @@ struct CAN1
     using FB29 = CAN1_F9R2_FB29_Values<CAN1::F9R2, 29, 1, ReadWriteMode, CAN1F9R2Base> ;
     using FB30 = CAN1_F9R2_FB30_Values<CAN1::F9R2, 30, 1, ReadWriteMode, CAN1F9R2Base> ;
     using FB31 = CAN1_F9R2_FB31_Values<CAN1::F9R2, 31, 1, ReadWriteMode, CAN1F9R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F9R2_FB31_Values<CAN1::F9R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1490,6 +1535,7 @@ struct CAN1
     using FB29 = CAN1_F10R1_FB29_Values<CAN1::F10R1, 29, 1, ReadWriteMode, CAN1F10R1Base> ;
     using FB30 = CAN1_F10R1_FB30_Values<CAN1::F10R1, 30, 1, ReadWriteMode, CAN1F10R1Base> ;
     using FB31 = CAN1_F10R1_FB31_Values<CAN1::F10R1, 31, 1, ReadWriteMode, CAN1F10R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F10R1_FB31_Values<CAN1::F10R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1532,6 +1578,7 @@ struct CAN1
     using FB29 = CAN1_F10R2_FB29_Values<CAN1::F10R2, 29, 1, ReadWriteMode, CAN1F10R2Base> ;
     using FB30 = CAN1_F10R2_FB30_Values<CAN1::F10R2, 30, 1, ReadWriteMode, CAN1F10R2Base> ;
     using FB31 = CAN1_F10R2_FB31_Values<CAN1::F10R2, 31, 1, ReadWriteMode, CAN1F10R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F10R2_FB31_Values<CAN1::F10R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1574,6 +1621,7 @@ struct CAN1
     using FB29 = CAN1_F11R1_FB29_Values<CAN1::F11R1, 29, 1, ReadWriteMode, CAN1F11R1Base> ;
     using FB30 = CAN1_F11R1_FB30_Values<CAN1::F11R1, 30, 1, ReadWriteMode, CAN1F11R1Base> ;
     using FB31 = CAN1_F11R1_FB31_Values<CAN1::F11R1, 31, 1, ReadWriteMode, CAN1F11R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F11R1_FB31_Values<CAN1::F11R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1616,6 +1664,7 @@ struct CAN1
     using FB29 = CAN1_F11R2_FB29_Values<CAN1::F11R2, 29, 1, ReadWriteMode, CAN1F11R2Base> ;
     using FB30 = CAN1_F11R2_FB30_Values<CAN1::F11R2, 30, 1, ReadWriteMode, CAN1F11R2Base> ;
     using FB31 = CAN1_F11R2_FB31_Values<CAN1::F11R2, 31, 1, ReadWriteMode, CAN1F11R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F11R2_FB31_Values<CAN1::F11R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1658,6 +1707,7 @@ struct CAN1
     using FB29 = CAN1_F12R1_FB29_Values<CAN1::F12R1, 29, 1, ReadWriteMode, CAN1F12R1Base> ;
     using FB30 = CAN1_F12R1_FB30_Values<CAN1::F12R1, 30, 1, ReadWriteMode, CAN1F12R1Base> ;
     using FB31 = CAN1_F12R1_FB31_Values<CAN1::F12R1, 31, 1, ReadWriteMode, CAN1F12R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F12R1_FB31_Values<CAN1::F12R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1700,6 +1750,7 @@ struct CAN1
     using FB29 = CAN1_F12R2_FB29_Values<CAN1::F12R2, 29, 1, ReadWriteMode, CAN1F12R2Base> ;
     using FB30 = CAN1_F12R2_FB30_Values<CAN1::F12R2, 30, 1, ReadWriteMode, CAN1F12R2Base> ;
     using FB31 = CAN1_F12R2_FB31_Values<CAN1::F12R2, 31, 1, ReadWriteMode, CAN1F12R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F12R2_FB31_Values<CAN1::F12R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1742,6 +1793,7 @@ struct CAN1
     using FB29 = CAN1_F13R1_FB29_Values<CAN1::F13R1, 29, 1, ReadWriteMode, CAN1F13R1Base> ;
     using FB30 = CAN1_F13R1_FB30_Values<CAN1::F13R1, 30, 1, ReadWriteMode, CAN1F13R1Base> ;
     using FB31 = CAN1_F13R1_FB31_Values<CAN1::F13R1, 31, 1, ReadWriteMode, CAN1F13R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F13R1_FB31_Values<CAN1::F13R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1784,6 +1836,7 @@ struct CAN1
     using FB29 = CAN1_F13R2_FB29_Values<CAN1::F13R2, 29, 1, ReadWriteMode, CAN1F13R2Base> ;
     using FB30 = CAN1_F13R2_FB30_Values<CAN1::F13R2, 30, 1, ReadWriteMode, CAN1F13R2Base> ;
     using FB31 = CAN1_F13R2_FB31_Values<CAN1::F13R2, 31, 1, ReadWriteMode, CAN1F13R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F13R2_FB31_Values<CAN1::F13R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1826,6 +1879,7 @@ struct CAN1
     using FB29 = CAN1_F14R1_FB29_Values<CAN1::F14R1, 29, 1, ReadWriteMode, CAN1F14R1Base> ;
     using FB30 = CAN1_F14R1_FB30_Values<CAN1::F14R1, 30, 1, ReadWriteMode, CAN1F14R1Base> ;
     using FB31 = CAN1_F14R1_FB31_Values<CAN1::F14R1, 31, 1, ReadWriteMode, CAN1F14R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F14R1_FB31_Values<CAN1::F14R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1868,6 +1922,7 @@ struct CAN1
     using FB29 = CAN1_F14R2_FB29_Values<CAN1::F14R2, 29, 1, ReadWriteMode, CAN1F14R2Base> ;
     using FB30 = CAN1_F14R2_FB30_Values<CAN1::F14R2, 30, 1, ReadWriteMode, CAN1F14R2Base> ;
     using FB31 = CAN1_F14R2_FB31_Values<CAN1::F14R2, 31, 1, ReadWriteMode, CAN1F14R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F14R2_FB31_Values<CAN1::F14R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1910,6 +1965,7 @@ struct CAN1
     using FB29 = CAN1_F15R1_FB29_Values<CAN1::F15R1, 29, 1, ReadWriteMode, CAN1F15R1Base> ;
     using FB30 = CAN1_F15R1_FB30_Values<CAN1::F15R1, 30, 1, ReadWriteMode, CAN1F15R1Base> ;
     using FB31 = CAN1_F15R1_FB31_Values<CAN1::F15R1, 31, 1, ReadWriteMode, CAN1F15R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F15R1_FB31_Values<CAN1::F15R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1952,6 +2008,7 @@ struct CAN1
     using FB29 = CAN1_F15R2_FB29_Values<CAN1::F15R2, 29, 1, ReadWriteMode, CAN1F15R2Base> ;
     using FB30 = CAN1_F15R2_FB30_Values<CAN1::F15R2, 30, 1, ReadWriteMode, CAN1F15R2Base> ;
     using FB31 = CAN1_F15R2_FB31_Values<CAN1::F15R2, 31, 1, ReadWriteMode, CAN1F15R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F15R2_FB31_Values<CAN1::F15R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1994,6 +2051,7 @@ struct CAN1
     using FB29 = CAN1_F16R1_FB29_Values<CAN1::F16R1, 29, 1, ReadWriteMode, CAN1F16R1Base> ;
     using FB30 = CAN1_F16R1_FB30_Values<CAN1::F16R1, 30, 1, ReadWriteMode, CAN1F16R1Base> ;
     using FB31 = CAN1_F16R1_FB31_Values<CAN1::F16R1, 31, 1, ReadWriteMode, CAN1F16R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F16R1_FB31_Values<CAN1::F16R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2036,6 +2094,7 @@ struct CAN1
     using FB29 = CAN1_F16R2_FB29_Values<CAN1::F16R2, 29, 1, ReadWriteMode, CAN1F16R2Base> ;
     using FB30 = CAN1_F16R2_FB30_Values<CAN1::F16R2, 30, 1, ReadWriteMode, CAN1F16R2Base> ;
     using FB31 = CAN1_F16R2_FB31_Values<CAN1::F16R2, 31, 1, ReadWriteMode, CAN1F16R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F16R2_FB31_Values<CAN1::F16R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2078,6 +2137,7 @@ struct CAN1
     using FB29 = CAN1_F17R1_FB29_Values<CAN1::F17R1, 29, 1, ReadWriteMode, CAN1F17R1Base> ;
     using FB30 = CAN1_F17R1_FB30_Values<CAN1::F17R1, 30, 1, ReadWriteMode, CAN1F17R1Base> ;
     using FB31 = CAN1_F17R1_FB31_Values<CAN1::F17R1, 31, 1, ReadWriteMode, CAN1F17R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F17R1_FB31_Values<CAN1::F17R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2120,6 +2180,7 @@ struct CAN1
     using FB29 = CAN1_F17R2_FB29_Values<CAN1::F17R2, 29, 1, ReadWriteMode, CAN1F17R2Base> ;
     using FB30 = CAN1_F17R2_FB30_Values<CAN1::F17R2, 30, 1, ReadWriteMode, CAN1F17R2Base> ;
     using FB31 = CAN1_F17R2_FB31_Values<CAN1::F17R2, 31, 1, ReadWriteMode, CAN1F17R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F17R2_FB31_Values<CAN1::F17R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2162,6 +2223,7 @@ struct CAN1
     using FB29 = CAN1_F18R1_FB29_Values<CAN1::F18R1, 29, 1, ReadWriteMode, CAN1F18R1Base> ;
     using FB30 = CAN1_F18R1_FB30_Values<CAN1::F18R1, 30, 1, ReadWriteMode, CAN1F18R1Base> ;
     using FB31 = CAN1_F18R1_FB31_Values<CAN1::F18R1, 31, 1, ReadWriteMode, CAN1F18R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F18R1_FB31_Values<CAN1::F18R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2204,6 +2266,7 @@ struct CAN1
     using FB29 = CAN1_F18R2_FB29_Values<CAN1::F18R2, 29, 1, ReadWriteMode, CAN1F18R2Base> ;
     using FB30 = CAN1_F18R2_FB30_Values<CAN1::F18R2, 30, 1, ReadWriteMode, CAN1F18R2Base> ;
     using FB31 = CAN1_F18R2_FB31_Values<CAN1::F18R2, 31, 1, ReadWriteMode, CAN1F18R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F18R2_FB31_Values<CAN1::F18R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2246,6 +2309,7 @@ struct CAN1
     using FB29 = CAN1_F19R1_FB29_Values<CAN1::F19R1, 29, 1, ReadWriteMode, CAN1F19R1Base> ;
     using FB30 = CAN1_F19R1_FB30_Values<CAN1::F19R1, 30, 1, ReadWriteMode, CAN1F19R1Base> ;
     using FB31 = CAN1_F19R1_FB31_Values<CAN1::F19R1, 31, 1, ReadWriteMode, CAN1F19R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F19R1_FB31_Values<CAN1::F19R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2288,6 +2352,7 @@ struct CAN1
     using FB29 = CAN1_F19R2_FB29_Values<CAN1::F19R2, 29, 1, ReadWriteMode, CAN1F19R2Base> ;
     using FB30 = CAN1_F19R2_FB30_Values<CAN1::F19R2, 30, 1, ReadWriteMode, CAN1F19R2Base> ;
     using FB31 = CAN1_F19R2_FB31_Values<CAN1::F19R2, 31, 1, ReadWriteMode, CAN1F19R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F19R2_FB31_Values<CAN1::F19R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2330,6 +2395,7 @@ struct CAN1
     using FB29 = CAN1_F20R1_FB29_Values<CAN1::F20R1, 29, 1, ReadWriteMode, CAN1F20R1Base> ;
     using FB30 = CAN1_F20R1_FB30_Values<CAN1::F20R1, 30, 1, ReadWriteMode, CAN1F20R1Base> ;
     using FB31 = CAN1_F20R1_FB31_Values<CAN1::F20R1, 31, 1, ReadWriteMode, CAN1F20R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F20R1_FB31_Values<CAN1::F20R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2372,6 +2438,7 @@ struct CAN1
     using FB29 = CAN1_F20R2_FB29_Values<CAN1::F20R2, 29, 1, ReadWriteMode, CAN1F20R2Base> ;
     using FB30 = CAN1_F20R2_FB30_Values<CAN1::F20R2, 30, 1, ReadWriteMode, CAN1F20R2Base> ;
     using FB31 = CAN1_F20R2_FB31_Values<CAN1::F20R2, 31, 1, ReadWriteMode, CAN1F20R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F20R2_FB31_Values<CAN1::F20R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2414,6 +2481,7 @@ struct CAN1
     using FB29 = CAN1_F21R1_FB29_Values<CAN1::F21R1, 29, 1, ReadWriteMode, CAN1F21R1Base> ;
     using FB30 = CAN1_F21R1_FB30_Values<CAN1::F21R1, 30, 1, ReadWriteMode, CAN1F21R1Base> ;
     using FB31 = CAN1_F21R1_FB31_Values<CAN1::F21R1, 31, 1, ReadWriteMode, CAN1F21R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F21R1_FB31_Values<CAN1::F21R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2456,6 +2524,7 @@ struct CAN1
     using FB29 = CAN1_F21R2_FB29_Values<CAN1::F21R2, 29, 1, ReadWriteMode, CAN1F21R2Base> ;
     using FB30 = CAN1_F21R2_FB30_Values<CAN1::F21R2, 30, 1, ReadWriteMode, CAN1F21R2Base> ;
     using FB31 = CAN1_F21R2_FB31_Values<CAN1::F21R2, 31, 1, ReadWriteMode, CAN1F21R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F21R2_FB31_Values<CAN1::F21R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2498,6 +2567,7 @@ struct CAN1
     using FB29 = CAN1_F22R1_FB29_Values<CAN1::F22R1, 29, 1, ReadWriteMode, CAN1F22R1Base> ;
     using FB30 = CAN1_F22R1_FB30_Values<CAN1::F22R1, 30, 1, ReadWriteMode, CAN1F22R1Base> ;
     using FB31 = CAN1_F22R1_FB31_Values<CAN1::F22R1, 31, 1, ReadWriteMode, CAN1F22R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F22R1_FB31_Values<CAN1::F22R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2540,6 +2610,7 @@ struct CAN1
     using FB29 = CAN1_F22R2_FB29_Values<CAN1::F22R2, 29, 1, ReadWriteMode, CAN1F22R2Base> ;
     using FB30 = CAN1_F22R2_FB30_Values<CAN1::F22R2, 30, 1, ReadWriteMode, CAN1F22R2Base> ;
     using FB31 = CAN1_F22R2_FB31_Values<CAN1::F22R2, 31, 1, ReadWriteMode, CAN1F22R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F22R2_FB31_Values<CAN1::F22R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2582,6 +2653,7 @@ struct CAN1
     using FB29 = CAN1_F23R1_FB29_Values<CAN1::F23R1, 29, 1, ReadWriteMode, CAN1F23R1Base> ;
     using FB30 = CAN1_F23R1_FB30_Values<CAN1::F23R1, 30, 1, ReadWriteMode, CAN1F23R1Base> ;
     using FB31 = CAN1_F23R1_FB31_Values<CAN1::F23R1, 31, 1, ReadWriteMode, CAN1F23R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F23R1_FB31_Values<CAN1::F23R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2624,6 +2696,7 @@ struct CAN1
     using FB29 = CAN1_F23R2_FB29_Values<CAN1::F23R2, 29, 1, ReadWriteMode, CAN1F23R2Base> ;
     using FB30 = CAN1_F23R2_FB30_Values<CAN1::F23R2, 30, 1, ReadWriteMode, CAN1F23R2Base> ;
     using FB31 = CAN1_F23R2_FB31_Values<CAN1::F23R2, 31, 1, ReadWriteMode, CAN1F23R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F23R2_FB31_Values<CAN1::F23R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2666,6 +2739,7 @@ struct CAN1
     using FB29 = CAN1_F24R1_FB29_Values<CAN1::F24R1, 29, 1, ReadWriteMode, CAN1F24R1Base> ;
     using FB30 = CAN1_F24R1_FB30_Values<CAN1::F24R1, 30, 1, ReadWriteMode, CAN1F24R1Base> ;
     using FB31 = CAN1_F24R1_FB31_Values<CAN1::F24R1, 31, 1, ReadWriteMode, CAN1F24R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F24R1_FB31_Values<CAN1::F24R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2708,6 +2782,7 @@ struct CAN1
     using FB29 = CAN1_F24R2_FB29_Values<CAN1::F24R2, 29, 1, ReadWriteMode, CAN1F24R2Base> ;
     using FB30 = CAN1_F24R2_FB30_Values<CAN1::F24R2, 30, 1, ReadWriteMode, CAN1F24R2Base> ;
     using FB31 = CAN1_F24R2_FB31_Values<CAN1::F24R2, 31, 1, ReadWriteMode, CAN1F24R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F24R2_FB31_Values<CAN1::F24R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2750,6 +2825,7 @@ struct CAN1
     using FB29 = CAN1_F25R1_FB29_Values<CAN1::F25R1, 29, 1, ReadWriteMode, CAN1F25R1Base> ;
     using FB30 = CAN1_F25R1_FB30_Values<CAN1::F25R1, 30, 1, ReadWriteMode, CAN1F25R1Base> ;
     using FB31 = CAN1_F25R1_FB31_Values<CAN1::F25R1, 31, 1, ReadWriteMode, CAN1F25R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F25R1_FB31_Values<CAN1::F25R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2792,6 +2868,7 @@ struct CAN1
     using FB29 = CAN1_F25R2_FB29_Values<CAN1::F25R2, 29, 1, ReadWriteMode, CAN1F25R2Base> ;
     using FB30 = CAN1_F25R2_FB30_Values<CAN1::F25R2, 30, 1, ReadWriteMode, CAN1F25R2Base> ;
     using FB31 = CAN1_F25R2_FB31_Values<CAN1::F25R2, 31, 1, ReadWriteMode, CAN1F25R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F25R2_FB31_Values<CAN1::F25R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2834,6 +2911,7 @@ struct CAN1
     using FB29 = CAN1_F26R1_FB29_Values<CAN1::F26R1, 29, 1, ReadWriteMode, CAN1F26R1Base> ;
     using FB30 = CAN1_F26R1_FB30_Values<CAN1::F26R1, 30, 1, ReadWriteMode, CAN1F26R1Base> ;
     using FB31 = CAN1_F26R1_FB31_Values<CAN1::F26R1, 31, 1, ReadWriteMode, CAN1F26R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F26R1_FB31_Values<CAN1::F26R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2876,6 +2954,7 @@ struct CAN1
     using FB29 = CAN1_F26R2_FB29_Values<CAN1::F26R2, 29, 1, ReadWriteMode, CAN1F26R2Base> ;
     using FB30 = CAN1_F26R2_FB30_Values<CAN1::F26R2, 30, 1, ReadWriteMode, CAN1F26R2Base> ;
     using FB31 = CAN1_F26R2_FB31_Values<CAN1::F26R2, 31, 1, ReadWriteMode, CAN1F26R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F26R2_FB31_Values<CAN1::F26R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2918,6 +2997,7 @@ struct CAN1
     using FB29 = CAN1_F27R1_FB29_Values<CAN1::F27R1, 29, 1, ReadWriteMode, CAN1F27R1Base> ;
     using FB30 = CAN1_F27R1_FB30_Values<CAN1::F27R1, 30, 1, ReadWriteMode, CAN1F27R1Base> ;
     using FB31 = CAN1_F27R1_FB31_Values<CAN1::F27R1, 31, 1, ReadWriteMode, CAN1F27R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F27R1_FB31_Values<CAN1::F27R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2960,12 +3040,14 @@ struct CAN1
     using FB29 = CAN1_F27R2_FB29_Values<CAN1::F27R2, 29, 1, ReadWriteMode, CAN1F27R2Base> ;
     using FB30 = CAN1_F27R2_FB30_Values<CAN1::F27R2, 30, 1, ReadWriteMode, CAN1F27R2Base> ;
     using FB31 = CAN1_F27R2_FB31_Values<CAN1::F27R2, 31, 1, ReadWriteMode, CAN1F27R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN1_F27R2_FB31_Values<CAN1::F27R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using F27R2Pack  = Register<0x4000671C, 32, ReadWriteMode, CAN1F27R2Base, T...> ;
 
+  using Registers = TypesList<CAN1::MCR, CAN1::MSR, CAN1::TSR, CAN1::RF0R, CAN1::RF1R, CAN1::IER, CAN1::ESR, CAN1::BTR, CAN1::TI0R, CAN1::TDT0R, CAN1::TDL0R, CAN1::TDH0R, CAN1::TI1R, CAN1::TDT1R, CAN1::TDL1R, CAN1::TDH1R, CAN1::TI2R, CAN1::TDT2R, CAN1::TDL2R, CAN1::TDH2R, CAN1::RI0R, CAN1::RDT0R, CAN1::RDL0R, CAN1::RDH0R, CAN1::RI1R, CAN1::RDT1R, CAN1::RDL1R, CAN1::RDH1R, CAN1::FMR, CAN1::FM1R, CAN1::FS1R, CAN1::FFA1R, CAN1::FA1R, CAN1::F0R1, CAN1::F0R2, CAN1::F1R1, CAN1::F1R2, CAN1::F2R1, CAN1::F2R2, CAN1::F3R1, CAN1::F3R2, CAN1::F4R1, CAN1::F4R2, CAN1::F5R1, CAN1::F5R2, CAN1::F6R1, CAN1::F6R2, CAN1::F7R1, CAN1::F7R2, CAN1::F8R1, CAN1::F8R2, CAN1::F9R1, CAN1::F9R2, CAN1::F10R1, CAN1::F10R2, CAN1::F11R1, CAN1::F11R2, CAN1::F12R1, CAN1::F12R2, CAN1::F13R1, CAN1::F13R2, CAN1::F14R1, CAN1::F14R2, CAN1::F15R1, CAN1::F15R2, CAN1::F16R1, CAN1::F16R2, CAN1::F17R1, CAN1::F17R2, CAN1::F18R1, CAN1::F18R2, CAN1::F19R1, CAN1::F19R2, CAN1::F20R1, CAN1::F20R2, CAN1::F21R1, CAN1::F21R2, CAN1::F22R1, CAN1::F22R2, CAN1::F23R1, CAN1::F23R2, CAN1::F24R1, CAN1::F24R2, CAN1::F25R1, CAN1::F25R2, CAN1::F26R1, CAN1::F26R2, CAN1::F27R1, CAN1::F27R2> ;
 } ;
 
 #endif //#if !defined(CAN1REGISTERS_HPP)
@@ -31,6 +31,7 @@ struct CAN2
     using TXFP = CAN2_MCR_TXFP_Values<CAN2::MCR, 2, 1, ReadWriteMode, CAN2MCRBase> ;
     using SLEEP = CAN2_MCR_SLEEP_Values<CAN2::MCR, 1, 1, ReadWriteMode, CAN2MCRBase> ;
     using INRQ = CAN2_MCR_INRQ_Values<CAN2::MCR, 0, 1, ReadWriteMode, CAN2MCRBase> ;
+    static constexpr Type SnapshotMask = 0x180FFU ;
     using FieldValues = CAN2_MCR_INRQ_Values<CAN2::MCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +51,7 @@ struct CAN2
     using ERRI = CAN2_MSR_ERRI_Values<CAN2::MSR, 2, 1, ReadWriteMode, CAN2MSRBase> ;
     using SLAK = CAN2_MSR_SLAK_Values<CAN2::MSR, 1, 1, ReadMode, CAN2MSRBase> ;
     using INAK = CAN2_MSR_INAK_Values<CAN2::MSR, 0, 1, ReadMode, CAN2MSRBase> ;
+    static constexpr Type SnapshotMask = 0x1CU ;
     using FieldValues = CAN2_MSR_INAK_Values<CAN2::MSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +84,7 @@ struct CAN2
     using ALST0 = CAN2_TSR_ALST0_Values<CAN2::TSR, 2, 1, ReadWriteMode, CAN2TSRBase> ;
     using TXOK0 = CAN2_TSR_TXOK0_Values<CAN2::TSR, 1, 1, ReadWriteMode, CAN2TSRBase> ;
     using RQCP0 = CAN2_TSR_RQCP0_Values<CAN2::TSR, 0, 1, ReadWriteMode, CAN2TSRBase> ;
+    static constexpr Type SnapshotMask = 0x8F8F8FU ;
     using FieldValues = CAN2_TSR_RQCP0_Values<CAN2::TSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +99,7 @@ struct CAN2
     using FOVR0 = CAN2_RF0R_FOVR0_Values<CAN2::RF0R, 4, 1, ReadWriteMode, CAN2RF0RBase> ;
     using FULL0 = CAN2_RF0R_FULL0_Values<CAN2::RF0R, 3, 1, ReadWriteMode, CAN2RF0RBase> ;
     using FMP0 = CAN2_RF0R_FMP0_Values<CAN2::RF0R, 0, 2, ReadMode, CAN2RF0RBase> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN2_RF0R_FMP0_Values<CAN2::RF0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +114,7 @@ struct CAN2
     using FOVR1 = CAN2_RF1R_FOVR1_Values<CAN2::RF1R, 4, 1, ReadWriteMode, CAN2RF1RBase> ;
     using FULL1 = CAN2_RF1R_FULL1_Values<CAN2::RF1R, 3, 1, ReadWriteMode, CAN2RF1RBase> ;
     using FMP1 = CAN2_RF1R_FMP1_Values<CAN2::RF1R, 0, 2, ReadMode, CAN2RF1RBase> ;
+    static constexpr Type SnapshotMask = 0x38U ;
     using FieldValues = CAN2_RF1R_FMP1_Values<CAN2::RF1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +139,7 @@ struct CAN2
     using FFIE0 = CAN2_IER_FFIE0_Values<CAN2::IER, 2, 1, ReadWriteMode, CAN2IERBase> ;
     using FMPIE0 = CAN2_IER_FMPIE0_Values<CAN2::IER, 1, 1, ReadWriteMode, CAN2IERBase> ;
     using TMEIE = CAN2_IER_TMEIE_Values<CAN2::IER, 0, 1, ReadWriteMode, CAN2IERBase> ;
+    static constexpr Type SnapshotMask = 0x38F7FU ;
     using FieldValues = CAN2_IER_TMEIE_Values<CAN2::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +156,7 @@ struct CAN2
     using BOFF = CAN2_ESR_BOFF_Values<CAN2::ESR, 2, 1, ReadMode, CAN2ESRBase> ;
     using EPVF = CAN2_ESR_EPVF_Values<CAN2::ESR, 1, 1, ReadMode, CAN2ESRBase> ;
     using EWGF = CAN2_ESR_EWGF_Values<CAN2::ESR, 0, 1, ReadMode, CAN2ESRBase> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = CAN2_ESR_EWGF_Values<CAN2::ESR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +173,7 @@ struct CAN2
     using TS2 = CAN2_BTR_TS2_Values<CAN2::BTR, 20, 3, ReadWriteMode, CAN2BTRBase> ;
     using TS1 = CAN2_BTR_TS1_Values<CAN2::BTR, 16, 4, ReadWriteMode, CAN2BTRBase> ;
     using BRP = CAN2_BTR_BRP_Values<CAN2::BTR, 0, 10, ReadWriteMode, CAN2BTRBase> ;
+    static constexpr Type SnapshotMask = 0xC37F03FFU ;
     using FieldValues = CAN2_BTR_BRP_Values<CAN2::BTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +189,7 @@ struct CAN2
     using IDE = CAN2_TI0R_IDE_Values<CAN2::TI0R, 2, 1, ReadWriteMode, CAN2TI0RBase> ;
     using RTR = CAN2_TI0R_RTR_Values<CAN2::TI0R, 1, 1, ReadWriteMode, CAN2TI0RBase> ;
     using TXRQ = CAN2_TI0R_TXRQ_Values<CAN2::TI0R, 0, 1, ReadWriteMode, CAN2TI0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TI0R_TXRQ_Values<CAN2::TI0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -194,6 +203,7 @@ struct CAN2
     using TIME = CAN2_TDT0R_TIME_Values<CAN2::TDT0R, 16, 16, ReadWriteMode, CAN2TDT0RBase> ;
     using TGT = CAN2_TDT0R_TGT_Values<CAN2::TDT0R, 8, 1, ReadWriteMode, CAN2TDT0RBase> ;
     using DLC = CAN2_TDT0R_DLC_Values<CAN2::TDT0R, 0, 4, ReadWriteMode, CAN2TDT0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN2_TDT0R_DLC_Values<CAN2::TDT0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -208,6 +218,7 @@ struct CAN2
     using DATA2 = CAN2_TDL0R_DATA2_Values<CAN2::TDL0R, 16, 8, ReadWriteMode, CAN2TDL0RBase> ;
     using DATA1 = CAN2_TDL0R_DATA1_Values<CAN2::TDL0R, 8, 8, ReadWriteMode, CAN2TDL0RBase> ;
     using DATA0 = CAN2_TDL0R_DATA0_Values<CAN2::TDL0R, 0, 8, ReadWriteMode, CAN2TDL0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TDL0R_DATA0_Values<CAN2::TDL0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +233,7 @@ struct CAN2
     using DATA6 = CAN2_TDH0R_DATA6_Values<CAN2::TDH0R, 16, 8, ReadWriteMode, CAN2TDH0RBase> ;
     using DATA5 = CAN2_TDH0R_DATA5_Values<CAN2::TDH0R, 8, 8, ReadWriteMode, CAN2TDH0RBase> ;
     using DATA4 = CAN2_TDH0R_DATA4_Values<CAN2::TDH0R, 0, 8, ReadWriteMode, CAN2TDH0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TDH0R_DATA4_Values<CAN2::TDH0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +249,7 @@ struct CAN2
     using IDE = CAN2_TI1R_IDE_Values<CAN2::TI1R, 2, 1, ReadWriteMode, CAN2TI1RBase> ;
     using RTR = CAN2_TI1R_RTR_Values<CAN2::TI1R, 1, 1, ReadWriteMode, CAN2TI1RBase> ;
     using TXRQ = CAN2_TI1R_TXRQ_Values<CAN2::TI1R, 0, 1, ReadWriteMode, CAN2TI1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TI1R_TXRQ_Values<CAN2::TI1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -250,6 +263,7 @@ struct CAN2
     using TIME = CAN2_TDT1R_TIME_Values<CAN2::TDT1R, 16, 16, ReadWriteMode, CAN2TDT1RBase> ;
     using TGT = CAN2_TDT1R_TGT_Values<CAN2::TDT1R, 8, 1, ReadWriteMode, CAN2TDT1RBase> ;
     using DLC = CAN2_TDT1R_DLC_Values<CAN2::TDT1R, 0, 4, ReadWriteMode, CAN2TDT1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN2_TDT1R_DLC_Values<CAN2::TDT1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +278,7 @@ struct CAN2
     using DATA2 = CAN2_TDL1R_DATA2_Values<CAN2::TDL1R, 16, 8, ReadWriteMode, CAN2TDL1RBase> ;
     using DATA1 = CAN2_TDL1R_DATA1_Values<CAN2::TDL1R, 8, 8, ReadWriteMode, CAN2TDL1RBase> ;
     using DATA0 = CAN2_TDL1R_DATA0_Values<CAN2::TDL1R, 0, 8, ReadWriteMode, CAN2TDL1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TDL1R_DATA0_Values<CAN2::TDL1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +293,7 @@ struct CAN2
     using DATA6 = CAN2_TDH1R_DATA6_Values<CAN2::TDH1R, 16, 8, ReadWriteMode, CAN2TDH1RBase> ;
     using DATA5 = CAN2_TDH1R_DATA5_Values<CAN2::TDH1R, 8, 8, ReadWriteMode, CAN2TDH1RBase> ;
     using DATA4 = CAN2_TDH1R_DATA4_Values<CAN2::TDH1R, 0, 8, ReadWriteMode, CAN2TDH1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TDH1R_DATA4_Values<CAN2::TDH1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,6 +309,7 @@ struct CAN2
     using IDE = CAN2_TI2R_IDE_Values<CAN2::TI2R, 2, 1, ReadWriteMode, CAN2TI2RBase> ;
     using RTR = CAN2_TI2R_RTR_Values<CAN2::TI2R, 1, 1, ReadWriteMode, CAN2TI2RBase> ;
     using TXRQ = CAN2_TI2R_TXRQ_Values<CAN2::TI2R, 0, 1, ReadWriteMode, CAN2TI2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TI2R_TXRQ_Values<CAN2::TI2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +323,7 @@ struct CAN2
     using TIME = CAN2_TDT2R_TIME_Values<CAN2::TDT2R, 16, 16, ReadWriteMode, CAN2TDT2RBase> ;
     using TGT = CAN2_TDT2R_TGT_Values<CAN2::TDT2R, 8, 1, ReadWriteMode, CAN2TDT2RBase> ;
     using DLC = CAN2_TDT2R_DLC_Values<CAN2::TDT2R, 0, 4, ReadWriteMode, CAN2TDT2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF010FU ;
     using FieldValues = CAN2_TDT2R_DLC_Values<CAN2::TDT2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -320,6 +338,7 @@ struct CAN2
     using DATA2 = CAN2_TDL2R_DATA2_Values<CAN2::TDL2R, 16, 8, ReadWriteMode, CAN2TDL2RBase> ;
     using DATA1 = CAN2_TDL2R_DATA1_Values<CAN2::TDL2R, 8, 8, ReadWriteMode, CAN2TDL2RBase> ;
     using DATA0 = CAN2_TDL2R_DATA0_Values<CAN2::TDL2R, 0, 8, ReadWriteMode, CAN2TDL2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TDL2R_DATA0_Values<CAN2::TDL2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -334,6 +353,7 @@ struct CAN2
     using DATA6 = CAN2_TDH2R_DATA6_Values<CAN2::TDH2R, 16, 8, ReadWriteMode, CAN2TDH2RBase> ;
     using DATA5 = CAN2_TDH2R_DATA5_Values<CAN2::TDH2R, 8, 8, ReadWriteMode, CAN2TDH2RBase> ;
     using DATA4 = CAN2_TDH2R_DATA4_Values<CAN2::TDH2R, 0, 8, ReadWriteMode, CAN2TDH2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_TDH2R_DATA4_Values<CAN2::TDH2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -456,6 +476,7 @@ struct CAN2
   {
     using CAN2SB = CAN2_FMR_CAN2SB_Values<CAN2::FMR, 8, 6, ReadWriteMode, CAN2FMRBase> ;
     using FINIT = CAN2_FMR_FINIT_Values<CAN2::FMR, 0, 1, ReadWriteMode, CAN2FMRBase> ;
+    static constexpr Type SnapshotMask = 0x3F01U ;
     using FieldValues = CAN2_FMR_FINIT_Values<CAN2::FMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -494,6 +515,7 @@ struct CAN2
     using FBM25 = CAN2_FM1R_FBM25_Values<CAN2::FM1R, 25, 1, ReadWriteMode, CAN2FM1RBase> ;
     using FBM26 = CAN2_FM1R_FBM26_Values<CAN2::FM1R, 26, 1, ReadWriteMode, CAN2FM1RBase> ;
     using FBM27 = CAN2_FM1R_FBM27_Values<CAN2::FM1R, 27, 1, ReadWriteMode, CAN2FM1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN2_FM1R_FBM27_Values<CAN2::FM1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -532,6 +554,7 @@ struct CAN2
     using FSC25 = CAN2_FS1R_FSC25_Values<CAN2::FS1R, 25, 1, ReadWriteMode, CAN2FS1RBase> ;
     using FSC26 = CAN2_FS1R_FSC26_Values<CAN2::FS1R, 26, 1, ReadWriteMode, CAN2FS1RBase> ;
     using FSC27 = CAN2_FS1R_FSC27_Values<CAN2::FS1R, 27, 1, ReadWriteMode, CAN2FS1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN2_FS1R_FSC27_Values<CAN2::FS1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -570,6 +593,7 @@ struct CAN2
     using FFA25 = CAN2_FFA1R_FFA25_Values<CAN2::FFA1R, 25, 1, ReadWriteMode, CAN2FFA1RBase> ;
     using FFA26 = CAN2_FFA1R_FFA26_Values<CAN2::FFA1R, 26, 1, ReadWriteMode, CAN2FFA1RBase> ;
     using FFA27 = CAN2_FFA1R_FFA27_Values<CAN2::FFA1R, 27, 1, ReadWriteMode, CAN2FFA1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN2_FFA1R_FFA27_Values<CAN2::FFA1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +632,7 @@ struct CAN2
     using FACT25 = CAN2_FA1R_FACT25_Values<CAN2::FA1R, 25, 1, ReadWriteMode, CAN2FA1RBase> ;
     using FACT26 = CAN2_FA1R_FACT26_Values<CAN2::FA1R, 26, 1, ReadWriteMode, CAN2FA1RBase> ;
     using FACT27 = CAN2_FA1R_FACT27_Values<CAN2::FA1R, 27, 1, ReadWriteMode, CAN2FA1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = CAN2_FA1R_FACT27_Values<CAN2::FA1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -650,6 +675,7 @@ struct CAN2
     using FB29 = CAN2_F0R1_FB29_Values<CAN2::F0R1, 29, 1, ReadWriteMode, CAN2F0R1Base> ;
     using FB30 = CAN2_F0R1_FB30_Values<CAN2::F0R1, 30, 1, ReadWriteMode, CAN2F0R1Base> ;
     using FB31 = CAN2_F0R1_FB31_Values<CAN2::F0R1, 31, 1, ReadWriteMode, CAN2F0R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F0R1_FB31_Values<CAN2::F0R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -692,6 +718,7 @@ struct CAN2
     using FB29 = CAN2_F0R2_FB29_Values<CAN2::F0R2, 29, 1, ReadWriteMode, CAN2F0R2Base> ;
     using FB30 = CAN2_F0R2_FB30_Values<CAN2::F0R2, 30, 1, ReadWriteMode, CAN2F0R2Base> ;
     using FB31 = CAN2_F0R2_FB31_Values<CAN2::F0R2, 31, 1, ReadWriteMode, CAN2F0R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F0R2_FB31_Values<CAN2::F0R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -734,6 +761,7 @@ struct CAN2
     using FB29 = CAN2_F1R1_FB29_Values<CAN2::F1R1, 29, 1, ReadWriteMode, CAN2F1R1Base> ;
     using FB30 = CAN2_F1R1_FB30_Values<CAN2::F1R1, 30, 1, ReadWriteMode, CAN2F1R1Base> ;
     using FB31 = CAN2_F1R1_FB31_Values<CAN2::F1R1, 31, 1, ReadWriteMode, CAN2F1R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F1R1_FB31_Values<CAN2::F1R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +804,7 @@ struct CAN2
     using FB29 = CAN2_F1R2_FB29_Values<CAN2::F1R2, 29, 1, ReadWriteMode, CAN2F1R2Base> ;
     using FB30 = CAN2_F1R2_FB30_Values<CAN2::F1R2, 30, 1, ReadWriteMode, CAN2F1R2Base> ;
     using FB31 = CAN2_F1R2_FB31_Values<CAN2::F1R2, 31, 1, ReadWriteMode, CAN2F1R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F1R2_FB31_Values<CAN2::F1R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -818,6 +847,7 @@ struct CAN2
     using FB29 = CAN2_F2R1_FB29_Values<CAN2::F2R1, 29, 1, ReadWriteMode, CAN2F2R1Base> ;
     using FB30 = CAN2_F2R1_FB30_Values<CAN2::F2R1, 30, 1, ReadWriteMode, CAN2F2R1Base> ;
     using FB31 = CAN2_F2R1_FB31_Values<CAN2::F2R1, 31, 1, ReadWriteMode, CAN2F2R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F2R1_FB31_Values<CAN2::F2R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -860,6 +890,7 @@ struct CAN2
     using FB29 = CAN2_F2R2_FB29_Values<CAN2::F2R2, 29, 1, ReadWriteMode, CAN2F2R2Base> ;
     using FB30 = CAN2_F2R2_FB30_Values<CAN2::F2R2, 30, 1, ReadWriteMode, CAN2F2R2Base> ;
     using FB31 = CAN2_F2R2_FB31_Values<CAN2::F2R2, 31, 1, ReadWriteMode, CAN2F2R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F2R2_FB31_Values<CAN2::F2R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -902,6 +933,7 @@ struct CAN2
     using FB29 = CAN2_F3R1_FB29_Values<CAN2::F3R1, 29, 1, ReadWriteMode, CAN2F3R1Base> ;
     using FB30 = CAN2_F3R1_FB30_Values<CAN2::F3R1, 30, 1, ReadWriteMode, CAN2F3R1Base> ;
     using FB31 = CAN2_F3R1_FB31_Values<CAN2::F3R1, 31, 1, ReadWriteMode, CAN2F3R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F3R1_FB31_Values<CAN2::F3R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -944,6 +976,7 @@ struct CAN2
     using FB29 = CAN2_F3R2_FB29_Values<CAN2::F3R2, 29, 1, ReadWriteMode, CAN2F3R2Base> ;
     using FB30 = CAN2_F3R2_FB30_Values<CAN2::F3R2, 30, 1, ReadWriteMode, CAN2F3R2Base> ;
     using FB31 = CAN2_F3R2_FB31_Values<CAN2::F3R2, 31, 1, ReadWriteMode, CAN2F3R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F3R2_FB31_Values<CAN2::F3R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -986,6 +1019,7 @@ struct CAN2
     using FB29 = CAN2_F4R1_FB29_Values<CAN2::F4R1, 29, 1, ReadWriteMode, CAN2F4R1Base> ;
     using FB30 = CAN2_F4R1_FB30_Values<CAN2::F4R1, 30, 1, ReadWriteMode, CAN2F4R1Base> ;
     using FB31 = CAN2_F4R1_FB31_Values<CAN2::F4R1, 31, 1, ReadWriteMode, CAN2F4R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F4R1_FB31_Values<CAN2::F4R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1028,6 +1062,7 @@ struct CAN2
     using FB29 = CAN2_F4R2_FB29_Values<CAN2::F4R2, 29, 1, ReadWriteMode, CAN2F4R2Base> ;
     using FB30 = CAN2_F4R2_FB30_Values<CAN2::F4R2, 30, 1, ReadWriteMode, CAN2F4R2Base> ;
     using FB31 = CAN2_F4R2_FB31_Values<CAN2::F4R2, 31, 1, ReadWriteMode, CAN2F4R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F4R2_FB31_Values<CAN2::F4R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1070,6 +1105,7 @@ struct CAN2
     using FB29 = CAN2_F5R1_FB29_Values<CAN2::F5R1, 29, 1, ReadWriteMode, CAN2F5R1Base> ;
     using FB30 = CAN2_F5R1_FB30_Values<CAN2::F5R1, 30, 1, ReadWriteMode, CAN2F5R1Base> ;
     using FB31 = CAN2_F5R1_FB31_Values<CAN2::F5R1, 31, 1, ReadWriteMode, CAN2F5R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F5R1_FB31_Values<CAN2::F5R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1112,6 +1148,7 @@ struct CAN2
     using FB29 = CAN2_F5R2_FB29_Values<CAN2::F5R2, 29, 1, ReadWriteMode, CAN2F5R2Base> ;
     using FB30 = CAN2_F5R2_FB30_Values<CAN2::F5R2, 30, 1, ReadWriteMode, CAN2F5R2Base> ;
     using FB31 = CAN2_F5R2_FB31_Values<CAN2::F5R2, 31, 1, ReadWriteMode, CAN2F5R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F5R2_FB31_Values<CAN2::F5R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1154,6 +1191,7 @@ struct CAN2
     using FB29 = CAN2_F6R1_FB29_Values<CAN2::F6R1, 29, 1, ReadWriteMode, CAN2F6R1Base> ;
     using FB30 = CAN2_F6R1_FB30_Values<CAN2::F6R1, 30, 1, ReadWriteMode, CAN2F6R1Base> ;
     using FB31 = CAN2_F6R1_FB31_Values<CAN2::F6R1, 31, 1, ReadWriteMode, CAN2F6R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F6R1_FB31_Values<CAN2::F6R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1196,6 +1234,7 @@ struct CAN2
     using FB29 = CAN2_F6R2_FB29_Values<CAN2::F6R2, 29, 1, ReadWriteMode, CAN2F6R2Base> ;
     using FB30 = CAN2_F6R2_FB30_Values<CAN2::F6R2, 30, 1, ReadWriteMode, CAN2F6R2Base> ;
     using FB31 = CAN2_F6R2_FB31_Values<CAN2::F6R2, 31, 1, ReadWriteMode, CAN2F6R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F6R2_FB31_Values<CAN2::F6R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1238,6 +1277,7 @@ struct CAN2
     using FB29 = CAN2_F7R1_FB29_Values<CAN2::F7R1, 29, 1, ReadWriteMode, CAN2F7R1Base> ;
     using FB30 = CAN2_F7R1_FB30_Values<CAN2::F7R1, 30, 1, ReadWriteMode, CAN2F7R1Base> ;
     using FB31 = CAN2_F7R1_FB31_Values<CAN2::F7R1, 31, 1, ReadWriteMode, CAN2F7R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F7R1_FB31_Values<CAN2::F7R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1280,6 +1320,7 @@ struct CAN2
     using FB29 = CAN2_F7R2_FB29_Values<CAN2::F7R2, 29, 1, ReadWriteMode, CAN2F7R2Base> ;
     using FB30 = CAN2_F7R2_FB30_Values<CAN2::F7R2, 30, 1, ReadWriteMode, CAN2F7R2Base> ;
     using FB31 = CAN2_F7R2_FB31_Values<CAN2::F7R2, 31, 1, ReadWriteMode, CAN2F7R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F7R2_FB31_Values<CAN2::F7R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1322,6 +1363,7 @@ struct CAN2
     using FB29 = CAN2_F8R1_FB29_Values<CAN2::F8R1, 29, 1, ReadWriteMode, CAN2F8R1Base> ;
     using FB30 = CAN2_F8R1_FB30_Values<CAN2::F8R1, 30, 1, ReadWriteMode, CAN2F8R1Base> ;
     using FB31 = CAN2_F8R1_FB31_Values<CAN2::F8R1, 31, 1, ReadWriteMode, CAN2F8R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F8R1_FB31_Values<CAN2::F8R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1364,6 +1406,7 @@ struct CAN2
     using FB29 = CAN2_F8R2_FB29_Values<CAN2::F8R2, 29, 1, ReadWriteMode, CAN2F8R2Base> ;
     using FB30 = CAN2_F8R2_FB30_Values<CAN2::F8R2, 30, 1, ReadWriteMode, CAN2F8R2Base> ;
     using FB31 = CAN2_F8R2_FB31_Values<CAN2::F8R2, 31, 1, ReadWriteMode, CAN2F8R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F8R2_FB31_Values<CAN2::F8R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1406,6 +1449,7 @@ struct CAN2
     using FB29 = CAN2_F9R1_FB29_Values<CAN2::F9R1, 29, 1, ReadWriteMode, CAN2F9R1Base> ;
     using FB30 = CAN2_F9R1_FB30_Values<CAN2::F9R1, 30, 1, ReadWriteMode, CAN2F9R1Base> ;
     using FB31 = CAN2_F9R1_FB31_Values<CAN2::F9R1, 31, 1, ReadWriteMode, CAN2F9R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F9R1_FB31_Values<CAN2::F9R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1448,6 +1492,7 @@ struct CAN2
     using FB29 = CAN2_F9R2_FB29_Values<CAN2::F9R2, 29, 1, ReadWriteMode, CAN2F9R2Base> ;
     using FB30 = CAN2_F9R2_FB30_Values<CAN2::F9R2, 30, 1, ReadWriteMode, CAN2F9R2Base> ;
     using FB31 = CAN2_F9R2_FB31_Values<CAN2::F9R2, 31, 1, ReadWriteMode, CAN2F9R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F9R2_FB31_Values<CAN2::F9R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1490,6 +1535,7 @@ struct CAN2
     using FB29 = CAN2_F10R1_FB29_Values<CAN2::F10R1, 29, 1, ReadWriteMode, CAN2F10R1Base> ;
     using FB30 = CAN2_F10R1_FB30_Values<CAN2::F10R1, 30, 1, ReadWriteMode, CAN2F10R1Base> ;
     using FB31 = CAN2_F10R1_FB31_Values<CAN2::F10R1, 31, 1, ReadWriteMode, CAN2F10R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F10R1_FB31_Values<CAN2::F10R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1532,6 +1578,7 @@ struct CAN2
     using FB29 = CAN2_F10R2_FB29_Values<CAN2::F10R2, 29, 1, ReadWriteMode, CAN2F10R2Base> ;
     using FB30 = CAN2_F10R2_FB30_Values<CAN2::F10R2, 30, 1, ReadWriteMode, CAN2F10R2Base> ;
     using FB31 = CAN2_F10R2_FB31_Values<CAN2::F10R2, 31, 1, ReadWriteMode, CAN2F10R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F10R2_FB31_Values<CAN2::F10R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1574,6 +1621,7 @@ struct CAN2
     using FB29 = CAN2_F11R1_FB29_Values<CAN2::F11R1, 29, 1, ReadWriteMode, CAN2F11R1Base> ;
     using FB30 = CAN2_F11R1_FB30_Values<CAN2::F11R1, 30, 1, ReadWriteMode, CAN2F11R1Base> ;
     using FB31 = CAN2_F11R1_FB31_Values<CAN2::F11R1, 31, 1, ReadWriteMode, CAN2F11R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F11R1_FB31_Values<CAN2::F11R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1616,6 +1664,7 @@ struct CAN2
     using FB29 = CAN2_F11R2_FB29_Values<CAN2::F11R2, 29, 1, ReadWriteMode, CAN2F11R2Base> ;
     using FB30 = CAN2_F11R2_FB30_Values<CAN2::F11R2, 30, 1, ReadWriteMode, CAN2F11R2Base> ;
     using FB31 = CAN2_F11R2_FB31_Values<CAN2::F11R2, 31, 1, ReadWriteMode, CAN2F11R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F11R2_FB31_Values<CAN2::F11R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1658,6 +1707,7 @@ struct CAN2
     using FB29 = CAN2_F12R1_FB29_Values<CAN2::F12R1, 29, 1, ReadWriteMode, CAN2F12R1Base> ;
     using FB30 = CAN2_F12R1_FB30_Values<CAN2::F12R1, 30, 1, ReadWriteMode, CAN2F12R1Base> ;
     using FB31 = CAN2_F12R1_FB31_Values<CAN2::F12R1, 31, 1, ReadWriteMode, CAN2F12R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F12R1_FB31_Values<CAN2::F12R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1700,6 +1750,7 @@ struct CAN2
     using FB29 = CAN2_F12R2_FB29_Values<CAN2::F12R2, 29, 1, ReadWriteMode, CAN2F12R2Base> ;
     using FB30 = CAN2_F12R2_FB30_Values<CAN2::F12R2, 30, 1, ReadWriteMode, CAN2F12R2Base> ;
     using FB31 = CAN2_F12R2_FB31_Values<CAN2::F12R2, 31, 1, ReadWriteMode, CAN2F12R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F12R2_FB31_Values<CAN2::F12R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1742,6 +1793,7 @@ struct CAN2
     using FB29 = CAN2_F13R1_FB29_Values<CAN2::F13R1, 29, 1, ReadWriteMode, CAN2F13R1Base> ;
     using FB30 = CAN2_F13R1_FB30_Values<CAN2::F13R1, 30, 1, ReadWriteMode, CAN2F13R1Base> ;
     using FB31 = CAN2_F13R1_FB31_Values<CAN2::F13R1, 31, 1, ReadWriteMode, CAN2F13R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F13R1_FB31_Values<CAN2::F13R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1784,6 +1836,7 @@ struct CAN2
     using FB29 = CAN2_F13R2_FB29_Values<CAN2::F13R2, 29, 1, ReadWriteMode, CAN2F13R2Base> ;
     using FB30 = CAN2_F13R2_FB30_Values<CAN2::F13R2, 30, 1, ReadWriteMode, CAN2F13R2Base> ;
     using FB31 = CAN2_F13R2_FB31_Values<CAN2::F13R2, 31, 1, ReadWriteMode, CAN2F13R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F13R2_FB31_Values<CAN2::F13R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1826,6 +1879,7 @@ struct CAN2
     using FB29 = CAN2_F14R1_FB29_Values<CAN2::F14R1, 29, 1, ReadWriteMode, CAN2F14R1Base> ;
     using FB30 = CAN2_F14R1_FB30_Values<CAN2::F14R1, 30, 1, ReadWriteMode, CAN2F14R1Base> ;
     using FB31 = CAN2_F14R1_FB31_Values<CAN2::F14R1, 31, 1, ReadWriteMode, CAN2F14R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F14R1_FB31_Values<CAN2::F14R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1868,6 +1922,7 @@ struct CAN2
     using FB29 = CAN2_F14R2_FB29_Values<CAN2::F14R2, 29, 1, ReadWriteMode, CAN2F14R2Base> ;
     using FB30 = CAN2_F14R2_FB30_Values<CAN2::F14R2, 30, 1, ReadWriteMode, CAN2F14R2Base> ;
     using FB31 = CAN2_F14R2_FB31_Values<CAN2::F14R2, 31, 1, ReadWriteMode, CAN2F14R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F14R2_FB31_Values<CAN2::F14R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1910,6 +1965,7 @@ struct CAN2
     using FB29 = CAN2_F15R1_FB29_Values<CAN2::F15R1, 29, 1, ReadWriteMode, CAN2F15R1Base> ;
     using FB30 = CAN2_F15R1_FB30_Values<CAN2::F15R1, 30, 1, ReadWriteMode, CAN2F15R1Base> ;
     using FB31 = CAN2_F15R1_FB31_Values<CAN2::F15R1, 31, 1, ReadWriteMode, CAN2F15R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F15R1_FB31_Values<CAN2::F15R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1952,6 +2008,7 @@ struct CAN2
     using FB29 = CAN2_F15R2_FB29_Values<CAN2::F15R2, 29, 1, ReadWriteMode, CAN2F15R2Base> ;
     using FB30 = CAN2_F15R2_FB30_Values<CAN2::F15R2, 30, 1, ReadWriteMode, CAN2F15R2Base> ;
     using FB31 = CAN2_F15R2_FB31_Values<CAN2::F15R2, 31, 1, ReadWriteMode, CAN2F15R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F15R2_FB31_Values<CAN2::F15R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1994,6 +2051,7 @@ struct CAN2
     using FB29 = CAN2_F16R1_FB29_Values<CAN2::F16R1, 29, 1, ReadWriteMode, CAN2F16R1Base> ;
     using FB30 = CAN2_F16R1_FB30_Values<CAN2::F16R1, 30, 1, ReadWriteMode, CAN2F16R1Base> ;
     using FB31 = CAN2_F16R1_FB31_Values<CAN2::F16R1, 31, 1, ReadWriteMode, CAN2F16R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F16R1_FB31_Values<CAN2::F16R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2036,6 +2094,7 @@ struct CAN2
     using FB29 = CAN2_F16R2_FB29_Values<CAN2::F16R2, 29, 1, ReadWriteMode, CAN2F16R2Base> ;
     using FB30 = CAN2_F16R2_FB30_Values<CAN2::F16R2, 30, 1, ReadWriteMode, CAN2F16R2Base> ;
     using FB31 = CAN2_F16R2_FB31_Values<CAN2::F16R2, 31, 1, ReadWriteMode, CAN2F16R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F16R2_FB31_Values<CAN2::F16R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2078,6 +2137,7 @@ struct CAN2
     using FB29 = CAN2_F17R1_FB29_Values<CAN2::F17R1, 29, 1, ReadWriteMode, CAN2F17R1Base> ;
     using FB30 = CAN2_F17R1_FB30_Values<CAN2::F17R1, 30, 1, ReadWriteMode, CAN2F17R1Base> ;
     using FB31 = CAN2_F17R1_FB31_Values<CAN2::F17R1, 31, 1, ReadWriteMode, CAN2F17R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F17R1_FB31_Values<CAN2::F17R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2120,6 +2180,7 @@ struct CAN2
     using FB29 = CAN2_F17R2_FB29_Values<CAN2::F17R2, 29, 1, ReadWriteMode, CAN2F17R2Base> ;
     using FB30 = CAN2_F17R2_FB30_Values<CAN2::F17R2, 30, 1, ReadWriteMode, CAN2F17R2Base> ;
     using FB31 = CAN2_F17R2_FB31_Values<CAN2::F17R2, 31, 1, ReadWriteMode, CAN2F17R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F17R2_FB31_Values<CAN2::F17R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2162,6 +2223,7 @@ struct CAN2
     using FB29 = CAN2_F18R1_FB29_Values<CAN2::F18R1, 29, 1, ReadWriteMode, CAN2F18R1Base> ;
     using FB30 = CAN2_F18R1_FB30_Values<CAN2::F18R1, 30, 1, ReadWriteMode, CAN2F18R1Base> ;
     using FB31 = CAN2_F18R1_FB31_Values<CAN2::F18R1, 31, 1, ReadWriteMode, CAN2F18R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F18R1_FB31_Values<CAN2::F18R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2204,6 +2266,7 @@ struct CAN2
     using FB29 = CAN2_F18R2_FB29_Values<CAN2::F18R2, 29, 1, ReadWriteMode, CAN2F18R2Base> ;
     using FB30 = CAN2_F18R2_FB30_Values<CAN2::F18R2, 30, 1, ReadWriteMode, CAN2F18R2Base> ;
     using FB31 = CAN2_F18R2_FB31_Values<CAN2::F18R2, 31, 1, ReadWriteMode, CAN2F18R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F18R2_FB31_Values<CAN2::F18R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2246,6 +2309,7 @@ struct CAN2
     using FB29 = CAN2_F19R1_FB29_Values<CAN2::F19R1, 29, 1, ReadWriteMode, CAN2F19R1Base> ;
     using FB30 = CAN2_F19R1_FB30_Values<CAN2::F19R1, 30, 1, ReadWriteMode, CAN2F19R1Base> ;
     using FB31 = CAN2_F19R1_FB31_Values<CAN2::F19R1, 31, 1, ReadWriteMode, CAN2F19R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F19R1_FB31_Values<CAN2::F19R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2288,6 +2352,7 @@ struct CAN2
     using FB29 = CAN2_F19R2_FB29_Values<CAN2::F19R2, 29, 1, ReadWriteMode, CAN2F19R2Base> ;
     using FB30 = CAN2_F19R2_FB30_Values<CAN2::F19R2, 30, 1, ReadWriteMode, CAN2F19R2Base> ;
     using FB31 = CAN2_F19R2_FB31_Values<CAN2::F19R2, 31, 1, ReadWriteMode, CAN2F19R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F19R2_FB31_Values<CAN2::F19R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2330,6 +2395,7 @@ struct CAN2
     using FB29 = CAN2_F20R1_FB29_Values<CAN2::F20R1, 29, 1, ReadWriteMode, CAN2F20R1Base> ;
     using FB30 = CAN2_F20R1_FB30_Values<CAN2::F20R1, 30, 1, ReadWriteMode, CAN2F20R1Base> ;
     using FB31 = CAN2_F20R1_FB31_Values<CAN2::F20R1, 31, 1, ReadWriteMode, CAN2F20R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F20R1_FB31_Values<CAN2::F20R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2372,6 +2438,7 @@ struct CAN2
     using FB29 = CAN2_F20R2_FB29_Values<CAN2::F20R2, 29, 1, ReadWriteMode, CAN2F20R2Base> ;
     using FB30 = CAN2_F20R2_FB30_Values<CAN2::F20R2, 30, 1, ReadWriteMode, CAN2F20R2Base> ;
     using FB31 = CAN2_F20R2_FB31_Values<CAN2::F20R2, 31, 1, ReadWriteMode, CAN2F20R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F20R2_FB31_Values<CAN2::F20R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2414,6 +2481,7 @@ struct CAN2
     using FB29 = CAN2_F21R1_FB29_Values<CAN2::F21R1, 29, 1, ReadWriteMode, CAN2F21R1Base> ;
     using FB30 = CAN2_F21R1_FB30_Values<CAN2::F21R1, 30, 1, ReadWriteMode, CAN2F21R1Base> ;
     using FB31 = CAN2_F21R1_FB31_Values<CAN2::F21R1, 31, 1, ReadWriteMode, CAN2F21R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F21R1_FB31_Values<CAN2::F21R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2456,6 +2524,7 @@ struct CAN2
     using FB29 = CAN2_F21R2_FB29_Values<CAN2::F21R2, 29, 1, ReadWriteMode, CAN2F21R2Base> ;
     using FB30 = CAN2_F21R2_FB30_Values<CAN2::F21R2, 30, 1, ReadWriteMode, CAN2F21R2Base> ;
     using FB31 = CAN2_F21R2_FB31_Values<CAN2::F21R2, 31, 1, ReadWriteMode, CAN2F21R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F21R2_FB31_Values<CAN2::F21R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2498,6 +2567,7 @@ struct CAN2
     using FB29 = CAN2_F22R1_FB29_Values<CAN2::F22R1, 29, 1, ReadWriteMode, CAN2F22R1Base> ;
     using FB30 = CAN2_F22R1_FB30_Values<CAN2::F22R1, 30, 1, ReadWriteMode, CAN2F22R1Base> ;
     using FB31 = CAN2_F22R1_FB31_Values<CAN2::F22R1, 31, 1, ReadWriteMode, CAN2F22R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F22R1_FB31_Values<CAN2::F22R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2540,6 +2610,7 @@ struct CAN2
     using FB29 = CAN2_F22R2_FB29_Values<CAN2::F22R2, 29, 1, ReadWriteMode, CAN2F22R2Base> ;
     using FB30 = CAN2_F22R2_FB30_Values<CAN2::F22R2, 30, 1, ReadWriteMode, CAN2F22R2Base> ;
     using FB31 = CAN2_F22R2_FB31_Values<CAN2::F22R2, 31, 1, ReadWriteMode, CAN2F22R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F22R2_FB31_Values<CAN2::F22R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2582,6 +2653,7 @@ struct CAN2
     using FB29 = CAN2_F23R1_FB29_Values<CAN2::F23R1, 29, 1, ReadWriteMode, CAN2F23R1Base> ;
     using FB30 = CAN2_F23R1_FB30_Values<CAN2::F23R1, 30, 1, ReadWriteMode, CAN2F23R1Base> ;
     using FB31 = CAN2_F23R1_FB31_Values<CAN2::F23R1, 31, 1, ReadWriteMode, CAN2F23R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F23R1_FB31_Values<CAN2::F23R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2624,6 +2696,7 @@ struct CAN2
     using FB29 = CAN2_F23R2_FB29_Values<CAN2::F23R2, 29, 1, ReadWriteMode, CAN2F23R2Base> ;
     using FB30 = CAN2_F23R2_FB30_Values<CAN2::F23R2, 30, 1, ReadWriteMode, CAN2F23R2Base> ;
     using FB31 = CAN2_F23R2_FB31_Values<CAN2::F23R2, 31, 1, ReadWriteMode, CAN2F23R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F23R2_FB31_Values<CAN2::F23R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2666,6 +2739,7 @@ struct CAN2
     using FB29 = CAN2_F24R1_FB29_Values<CAN2::F24R1, 29, 1, ReadWriteMode, CAN2F24R1Base> ;
     using FB30 = CAN2_F24R1_FB30_Values<CAN2::F24R1, 30, 1, ReadWriteMode, CAN2F24R1Base> ;
     using FB31 = CAN2_F24R1_FB31_Values<CAN2::F24R1, 31, 1, ReadWriteMode, CAN2F24R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F24R1_FB31_Values<CAN2::F24R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2708,6 +2782,7 @@ struct CAN2
     using FB29 = CAN2_F24R2_FB29_Values<CAN2::F24R2, 29, 1, ReadWriteMode, CAN2F24R2Base> ;
     using FB30 = CAN2_F24R2_FB30_Values<CAN2::F24R2, 30, 1, ReadWriteMode, CAN2F24R2Base> ;
     using FB31 = CAN2_F24R2_FB31_Values<CAN2::F24R2, 31, 1, ReadWriteMode, CAN2F24R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F24R2_FB31_Values<CAN2::F24R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2750,6 +2825,7 @@ struct CAN2
     using FB29 = CAN2_F25R1_FB29_Values<CAN2::F25R1, 29, 1, ReadWriteMode, CAN2F25R1Base> ;
     using FB30 = CAN2_F25R1_FB30_Values<CAN2::F25R1, 30, 1, ReadWriteMode, CAN2F25R1Base> ;
     using FB31 = CAN2_F25R1_FB31_Values<CAN2::F25R1, 31, 1, ReadWriteMode, CAN2F25R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F25R1_FB31_Values<CAN2::F25R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2792,6 +2868,7 @@ struct CAN2
     using FB29 = CAN2_F25R2_FB29_Values<CAN2::F25R2, 29, 1, ReadWriteMode, CAN2F25R2Base> ;
     using FB30 = CAN2_F25R2_FB30_Values<CAN2::F25R2, 30, 1, ReadWriteMode, CAN2F25R2Base> ;
     using FB31 = CAN2_F25R2_FB31_Values<CAN2::F25R2, 31, 1, ReadWriteMode, CAN2F25R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F25R2_FB31_Values<CAN2::F25R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2834,6 +2911,7 @@ struct CAN2
     using FB29 = CAN2_F26R1_FB29_Values<CAN2::F26R1, 29, 1, ReadWriteMode, CAN2F26R1Base> ;
     using FB30 = CAN2_F26R1_FB30_Values<CAN2::F26R1, 30, 1, ReadWriteMode, CAN2F26R1Base> ;
     using FB31 = CAN2_F26R1_FB31_Values<CAN2::F26R1, 31, 1, ReadWriteMode, CAN2F26R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F26R1_FB31_Values<CAN2::F26R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2876,6 +2954,7 @@ struct CAN2
     using FB29 = CAN2_F26R2_FB29_Values<CAN2::F26R2, 29, 1, ReadWriteMode, CAN2F26R2Base> ;
     using FB30 = CAN2_F26R2_FB30_Values<CAN2::F26R2, 30, 1, ReadWriteMode, CAN2F26R2Base> ;
     using FB31 = CAN2_F26R2_FB31_Values<CAN2::F26R2, 31, 1, ReadWriteMode, CAN2F26R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F26R2_FB31_Values<CAN2::F26R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2918,6 +2997,7 @@ struct CAN2
     using FB29 = CAN2_F27R1_FB29_Values<CAN2::F27R1, 29, 1, ReadWriteMode, CAN2F27R1Base> ;
     using FB30 = CAN2_F27R1_FB30_Values<CAN2::F27R1, 30, 1, ReadWriteMode, CAN2F27R1Base> ;
     using FB31 = CAN2_F27R1_FB31_Values<CAN2::F27R1, 31, 1, ReadWriteMode, CAN2F27R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F27R1_FB31_Values<CAN2::F27R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -2960,12 +3040,14 @@ struct CAN2
     using FB29 = CAN2_F27R2_FB29_Values<CAN2::F27R2, 29, 1, ReadWriteMode, CAN2F27R2Base> ;
     using FB30 = CAN2_F27R2_FB30_Values<CAN2::F27R2, 30, 1, ReadWriteMode, CAN2F27R2Base> ;
     using FB31 = CAN2_F27R2_FB31_Values<CAN2::F27R2, 31, 1, ReadWriteMode, CAN2F27R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CAN2_F27R2_FB31_Values<CAN2::F27R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using F27R2Pack  = Register<0x40006B1C, 32, ReadWriteMode, CAN2F27R2Base, T...> ;
 
+  using Registers = TypesList<CAN2::MCR, CAN2::MSR, CAN2::TSR, CAN2::RF0R, CAN2::RF1R, CAN2::IER, CAN2::ESR, CAN2::BTR, CAN2::TI0R, CAN2::TDT0R, CAN2::TDL0R, CAN2::TDH0R, CAN2::TI1R, CAN2::TDT1R, CAN2::TDL1R, CAN2::TDH1R, CAN2::TI2R, CAN2::TDT2R, CAN2::TDL2R, CAN2::TDH2R, CAN2::RI0R, CAN2::RDT0R, CAN2::RDL0R, CAN2::RDH0R, CAN2::RI1R, CAN2::RDT1R, CAN2::RDL1R, CAN2::RDH1R, CAN2::FMR, CAN2::FM1R, CAN2::FS1R, CAN2::FFA1R, CAN2::FA1R, CAN2::F0R1, CAN2::F0R2, CAN2::F1R1, CAN2::F1R2, CAN2::F2R1, CAN2::F2R2, CAN2::F3R1, CAN2::F3R2, CAN2::F4R1, CAN2::F4R2, CAN2::F5R1, CAN2::F5R2, CAN2::F6R1, CAN2::F6R2, CAN2::F7R1, CAN2::F7R2, CAN2::F8R1, CAN2::F8R2, CAN2::F9R1, CAN2::F9R2, CAN2::F10R1, CAN2::F10R2, CAN2::F11R1, CAN2::F11R2, CAN2::F12R1, CAN2::F12R2, CAN2::F13R1, CAN2::F13R2, CAN2::F14R1, CAN2::F14R2, CAN2::F15R1, CAN2::F15R2, CAN2::F16R1, CAN2::F16R2, CAN2::F17R1, CAN2::F17R2, CAN2::F18R1, CAN2::F18R2, CAN2::F19R1, CAN2::F19R2, CAN2::F20R1, CAN2::F20R2, CAN2::F21R1, CAN2::F21R2, CAN2::F22R1, CAN2::F22R2, CAN2::F23R1, CAN2::F23R2, CAN2::F24R1, CAN2::F24R2, CAN2::F25R1, CAN2::F25R2, CAN2::F26R1, CAN2::F26R2, CAN2::F27R1, CAN2::F27R2> ;
 } ;
 
 #endif //#if !defined(CAN2REGISTERS_HPP)
@@ -22,6 +22,7 @@ struct CRC
   struct DR : public RegisterBase<0x40023000, 32, ReadWriteMode>
   {
     using DRField = CRC_DR_DR_Values<CRC::DR, 0, 32, ReadWriteMode, CRCDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CRC_DR_DR_Values<CRC::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct CRC
   struct IDR : public RegisterBase<0x40023004, 32, ReadWriteMode>
   {
     using IDRField = CRC_IDR_IDR_Values<CRC::IDR, 0, 8, ReadWriteMode, CRCIDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = CRC_IDR_IDR_Values<CRC::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +52,7 @@ struct CRC
   template<typename... T> 
   using CRPack  = Register<0x40023008, 32, WriteMode, CRCCRBase, T...> ;
 
+  using Registers = TypesList<CRC::DR, CRC::IDR, CRC::CR> ;
 } ;
 
 #endif //#if !defined(CRCREGISTERS_HPP)
@@ -29,6 +29,7 @@ struct CRYP
     using CRYPEN = CRYP_CR_CRYPEN_Values<CRYP::CR, 15, 1, ReadWriteMode, CRYPCRBase> ;
     using GCM_CCMPH = CRYP_CR_GCM_CCMPH_Values<CRYP::CR, 16, 2, ReadWriteMode, CRYPCRBase> ;
     using ALGOMODE3 = CRYP_CR_ALGOMODE3_Values<CRYP::CR, 19, 1, ReadWriteMode, CRYPCRBase> ;
+    static constexpr Type SnapshotMask = 0xBC3FCU ;
     using FieldValues = CRYP_CR_ALGOMODE3_Values<CRYP::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +56,7 @@ struct CRYP
   struct DIN : public RegisterBase<0x50060008, 32, ReadWriteMode>
   {
     using DATAIN = CRYP_DIN_DATAIN_Values<CRYP::DIN, 0, 32, ReadWriteMode, CRYPDINBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_DIN_DATAIN_Values<CRYP::DIN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +80,7 @@ struct CRYP
   {
     using DOEN = CRYP_DMACR_DOEN_Values<CRYP::DMACR, 1, 1, ReadWriteMode, CRYPDMACRBase> ;
     using DIEN = CRYP_DMACR_DIEN_Values<CRYP::DMACR, 0, 1, ReadWriteMode, CRYPDMACRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = CRYP_DMACR_DIEN_Values<CRYP::DMACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +93,7 @@ struct CRYP
   {
     using OUTIM = CRYP_IMSCR_OUTIM_Values<CRYP::IMSCR, 1, 1, ReadWriteMode, CRYPIMSCRBase> ;
     using INIM = CRYP_IMSCR_INIM_Values<CRYP::IMSCR, 0, 1, ReadWriteMode, CRYPIMSCRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = CRYP_IMSCR_INIM_Values<CRYP::IMSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -492,6 +496,7 @@ struct CRYP
     using IV2 = CRYP_IV0LR_IV2_Values<CRYP::IV0LR, 29, 1, ReadWriteMode, CRYPIV0LRBase> ;
     using IV1 = CRYP_IV0LR_IV1_Values<CRYP::IV0LR, 30, 1, ReadWriteMode, CRYPIV0LRBase> ;
     using IV0 = CRYP_IV0LR_IV0_Values<CRYP::IV0LR, 31, 1, ReadWriteMode, CRYPIV0LRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_IV0LR_IV0_Values<CRYP::IV0LR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -534,6 +539,7 @@ struct CRYP
     using IV34 = CRYP_IV0RR_IV34_Values<CRYP::IV0RR, 29, 1, ReadWriteMode, CRYPIV0RRBase> ;
     using IV33 = CRYP_IV0RR_IV33_Values<CRYP::IV0RR, 30, 1, ReadWriteMode, CRYPIV0RRBase> ;
     using IV32 = CRYP_IV0RR_IV32_Values<CRYP::IV0RR, 31, 1, ReadWriteMode, CRYPIV0RRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_IV0RR_IV32_Values<CRYP::IV0RR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -576,6 +582,7 @@ struct CRYP
     using IV66 = CRYP_IV1LR_IV66_Values<CRYP::IV1LR, 29, 1, ReadWriteMode, CRYPIV1LRBase> ;
     using IV65 = CRYP_IV1LR_IV65_Values<CRYP::IV1LR, 30, 1, ReadWriteMode, CRYPIV1LRBase> ;
     using IV64 = CRYP_IV1LR_IV64_Values<CRYP::IV1LR, 31, 1, ReadWriteMode, CRYPIV1LRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_IV1LR_IV64_Values<CRYP::IV1LR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -618,6 +625,7 @@ struct CRYP
     using IV98 = CRYP_IV1RR_IV98_Values<CRYP::IV1RR, 29, 1, ReadWriteMode, CRYPIV1RRBase> ;
     using IV97 = CRYP_IV1RR_IV97_Values<CRYP::IV1RR, 30, 1, ReadWriteMode, CRYPIV1RRBase> ;
     using IV96 = CRYP_IV1RR_IV96_Values<CRYP::IV1RR, 31, 1, ReadWriteMode, CRYPIV1RRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_IV1RR_IV96_Values<CRYP::IV1RR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -629,6 +637,7 @@ struct CRYP
   struct CSGCMCCM0R : public RegisterBase<0x50060050, 32, ReadWriteMode>
   {
     using CSGCMCCM0RField = CRYP_CSGCMCCM0R_CSGCMCCM0R_Values<CRYP::CSGCMCCM0R, 0, 32, ReadWriteMode, CRYPCSGCMCCM0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM0R_CSGCMCCM0R_Values<CRYP::CSGCMCCM0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -640,6 +649,7 @@ struct CRYP
   struct CSGCMCCM1R : public RegisterBase<0x50060054, 32, ReadWriteMode>
   {
     using CSGCMCCM1RField = CRYP_CSGCMCCM1R_CSGCMCCM1R_Values<CRYP::CSGCMCCM1R, 0, 32, ReadWriteMode, CRYPCSGCMCCM1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM1R_CSGCMCCM1R_Values<CRYP::CSGCMCCM1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -651,6 +661,7 @@ struct CRYP
   struct CSGCMCCM2R : public RegisterBase<0x50060058, 32, ReadWriteMode>
   {
     using CSGCMCCM2RField = CRYP_CSGCMCCM2R_CSGCMCCM2R_Values<CRYP::CSGCMCCM2R, 0, 32, ReadWriteMode, CRYPCSGCMCCM2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM2R_CSGCMCCM2R_Values<CRYP::CSGCMCCM2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -662,6 +673,7 @@ struct CRYP
   struct CSGCMCCM3R : public RegisterBase<0x5006005C, 32, ReadWriteMode>
   {
     using CSGCMCCM3RField = CRYP_CSGCMCCM3R_CSGCMCCM3R_Values<CRYP::CSGCMCCM3R, 0, 32, ReadWriteMode, CRYPCSGCMCCM3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM3R_CSGCMCCM3R_Values<CRYP::CSGCMCCM3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -673,6 +685,7 @@ struct CRYP
   struct CSGCMCCM4R : public RegisterBase<0x50060060, 32, ReadWriteMode>
   {
     using CSGCMCCM4RField = CRYP_CSGCMCCM4R_CSGCMCCM4R_Values<CRYP::CSGCMCCM4R, 0, 32, ReadWriteMode, CRYPCSGCMCCM4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM4R_CSGCMCCM4R_Values<CRYP::CSGCMCCM4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -684,6 +697,7 @@ struct CRYP
   struct CSGCMCCM5R : public RegisterBase<0x50060064, 32, ReadWriteMode>
   {
     using CSGCMCCM5RField = CRYP_CSGCMCCM5R_CSGCMCCM5R_Values<CRYP::CSGCMCCM5R, 0, 32, ReadWriteMode, CRYPCSGCMCCM5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM5R_CSGCMCCM5R_Values<CRYP::CSGCMCCM5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -695,6 +709,7 @@ struct CRYP
   struct CSGCMCCM6R : public RegisterBase<0x50060068, 32, ReadWriteMode>
   {
     using CSGCMCCM6RField = CRYP_CSGCMCCM6R_CSGCMCCM6R_Values<CRYP::CSGCMCCM6R, 0, 32, ReadWriteMode, CRYPCSGCMCCM6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM6R_CSGCMCCM6R_Values<CRYP::CSGCMCCM6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -706,6 +721,7 @@ struct CRYP
   struct CSGCMCCM7R : public RegisterBase<0x5006006C, 32, ReadWriteMode>
   {
     using CSGCMCCM7RField = CRYP_CSGCMCCM7R_CSGCMCCM7R_Values<CRYP::CSGCMCCM7R, 0, 32, ReadWriteMode, CRYPCSGCMCCM7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCMCCM7R_CSGCMCCM7R_Values<CRYP::CSGCMCCM7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -717,6 +733,7 @@ struct CRYP
   struct CSGCM0R : public RegisterBase<0x50060070, 32, ReadWriteMode>
   {
     using CSGCM0RField = CRYP_CSGCM0R_CSGCM0R_Values<CRYP::CSGCM0R, 0, 32, ReadWriteMode, CRYPCSGCM0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM0R_CSGCM0R_Values<CRYP::CSGCM0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -728,6 +745,7 @@ struct CRYP
   struct CSGCM1R : public RegisterBase<0x50060074, 32, ReadWriteMode>
   {
     using CSGCM1RField = CRYP_CSGCM1R_CSGCM1R_Values<CRYP::CSGCM1R, 0, 32, ReadWriteMode, CRYPCSGCM1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM1R_CSGCM1R_Values<CRYP::CSGCM1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -739,6 +757,7 @@ struct CRYP
   struct CSGCM2R : public RegisterBase<0x50060078, 32, ReadWriteMode>
   {
     using CSGCM2RField = CRYP_CSGCM2R_CSGCM2R_Values<CRYP::CSGCM2R, 0, 32, ReadWriteMode, CRYPCSGCM2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM2R_CSGCM2R_Values<CRYP::CSGCM2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -750,6 +769,7 @@ struct CRYP
   struct CSGCM3R : public RegisterBase<0x5006007C, 32, ReadWriteMode>
   {
     using CSGCM3RField = CRYP_CSGCM3R_CSGCM3R_Values<CRYP::CSGCM3R, 0, 32, ReadWriteMode, CRYPCSGCM3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM3R_CSGCM3R_Values<CRYP::CSGCM3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -761,6 +781,7 @@ struct CRYP
   struct CSGCM4R : public RegisterBase<0x50060080, 32, ReadWriteMode>
   {
     using CSGCM4RField = CRYP_CSGCM4R_CSGCM4R_Values<CRYP::CSGCM4R, 0, 32, ReadWriteMode, CRYPCSGCM4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM4R_CSGCM4R_Values<CRYP::CSGCM4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -772,6 +793,7 @@ struct CRYP
   struct CSGCM5R : public RegisterBase<0x50060084, 32, ReadWriteMode>
   {
     using CSGCM5RField = CRYP_CSGCM5R_CSGCM5R_Values<CRYP::CSGCM5R, 0, 32, ReadWriteMode, CRYPCSGCM5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM5R_CSGCM5R_Values<CRYP::CSGCM5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -783,6 +805,7 @@ struct CRYP
   struct CSGCM6R : public RegisterBase<0x50060088, 32, ReadWriteMode>
   {
     using CSGCM6RField = CRYP_CSGCM6R_CSGCM6R_Values<CRYP::CSGCM6R, 0, 32, ReadWriteMode, CRYPCSGCM6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM6R_CSGCM6R_Values<CRYP::CSGCM6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -794,12 +817,14 @@ struct CRYP
   struct CSGCM7R : public RegisterBase<0x5006008C, 32, ReadWriteMode>
   {
     using CSGCM7RField = CRYP_CSGCM7R_CSGCM7R_Values<CRYP::CSGCM7R, 0, 32, ReadWriteMode, CRYPCSGCM7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = CRYP_CSGCM7R_CSGCM7R_Values<CRYP::CSGCM7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSGCM7RPack  = Register<0x5006008C, 32, ReadWriteMode, CRYPCSGCM7RBase, T...> ;
 
+  using Registers = TypesList<CRYP::CR, CRYP::SR, CRYP::DIN, CRYP::DOUT, CRYP::DMACR, CRYP::IMSCR, CRYP::RISR, CRYP::MISR, CRYP::K0LR, CRYP::K0RR, CRYP::K1LR, CRYP::K1RR, CRYP::K2LR, CRYP::K2RR, CRYP::K3LR, CRYP::K3RR, CRYP::IV0LR, CRYP::IV0RR, CRYP::IV1LR, CRYP::IV1RR, CRYP::CSGCMCCM0R, CRYP::CSGCMCCM1R, CRYP::CSGCMCCM2R, CRYP::CSGCMCCM3R, CRYP::CSGCMCCM4R, CRYP::CSGCMCCM5R, CRYP::CSGCMCCM6R, CRYP::CSGCMCCM7R, CRYP::CSGCM0R, CRYP::CSGCM1R, CRYP::CSGCM2R, CRYP::CSGCM3R, CRYP::CSGCM4R, CRYP::CSGCM5R, CRYP::CSGCM6R, CRYP::CSGCM7R> ;
 } ;
 
 #endif //#if !defined(CRYPREGISTERS_HPP)
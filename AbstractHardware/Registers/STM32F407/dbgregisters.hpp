@@ -43,6 +43,7 @@ struct DBG
     using DBG_TIM5_STOP = DBG_DBGMCU_CR_DBG_TIM5_STOP_Values<DBG::DBGMCU_CR, 18, 1, ReadWriteMode, DBGDBGMCU_CRBase> ;
     using DBG_TIM6_STOP = DBG_DBGMCU_CR_DBG_TIM6_STOP_Values<DBG::DBGMCU_CR, 19, 1, ReadWriteMode, DBGDBGMCU_CRBase> ;
     using DBG_TIM7_STOP = DBG_DBGMCU_CR_DBG_TIM7_STOP_Values<DBG::DBGMCU_CR, 20, 1, ReadWriteMode, DBGDBGMCU_CRBase> ;
+    static constexpr Type SnapshotMask = 0x1F00E7U ;
     using FieldValues = DBG_DBGMCU_CR_DBG_TIM7_STOP_Values<DBG::DBGMCU_CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +70,7 @@ struct DBG
     using DBG_J2C3SMBUS_TIMEOUT = DBG_DBGMCU_APB1_FZ_DBG_J2C3SMBUS_TIMEOUT_Values<DBG::DBGMCU_APB1_FZ, 23, 1, ReadWriteMode, DBGDBGMCU_APB1_FZBase> ;
     using DBG_CAN1_STOP = DBG_DBGMCU_APB1_FZ_DBG_CAN1_STOP_Values<DBG::DBGMCU_APB1_FZ, 25, 1, ReadWriteMode, DBGDBGMCU_APB1_FZBase> ;
     using DBG_CAN2_STOP = DBG_DBGMCU_APB1_FZ_DBG_CAN2_STOP_Values<DBG::DBGMCU_APB1_FZ, 26, 1, ReadWriteMode, DBGDBGMCU_APB1_FZBase> ;
+    static constexpr Type SnapshotMask = 0x6E019FFU ;
     using FieldValues = DBG_DBGMCU_APB1_FZ_DBG_CAN2_STOP_Values<DBG::DBGMCU_APB1_FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,12 +86,14 @@ struct DBG
     using DBG_TIM9_STOP = DBG_DBGMCU_APB2_FZ_DBG_TIM9_STOP_Values<DBG::DBGMCU_APB2_FZ, 16, 1, ReadWriteMode, DBGDBGMCU_APB2_FZBase> ;
     using DBG_TIM10_STOP = DBG_DBGMCU_APB2_FZ_DBG_TIM10_STOP_Values<DBG::DBGMCU_APB2_FZ, 17, 1, ReadWriteMode, DBGDBGMCU_APB2_FZBase> ;
     using DBG_TIM11_STOP = DBG_DBGMCU_APB2_FZ_DBG_TIM11_STOP_Values<DBG::DBGMCU_APB2_FZ, 18, 1, ReadWriteMode, DBGDBGMCU_APB2_FZBase> ;
+    static constexpr Type SnapshotMask = 0x70003U ;
     using FieldValues = DBG_DBGMCU_APB2_FZ_DBG_TIM11_STOP_Values<DBG::DBGMCU_APB2_FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DBGMCU_APB2_FZPack  = Register<0xE004200C, 32, ReadWriteMode, DBGDBGMCU_APB2_FZBase, T...> ;
 
+  using Registers = TypesList<DBG::DBGMCU_IDCODE, DBG::DBGMCU_CR, DBG::DBGMCU_APB1_FZ, DBG::DBGMCU_APB2_FZ> ;
 } ;
 
 #endif //#if !defined(DBGREGISTERS_HPP)
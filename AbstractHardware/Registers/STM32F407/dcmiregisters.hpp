@@ -32,6 +32,7 @@ struct DCMI
     using CROP = DCMI_CR_CROP_Values<DCMI::CR, 2, 1, ReadWriteMode, DCMICRBase> ;
     using CM = DCMI_CR_CM_Values<DCMI::CR, 1, 1, ReadWriteMode, DCMICRBase> ;
     using CAPTURE = DCMI_CR_CAPTURE_Values<DCMI::CR, 0, 1, ReadWriteMode, DCMICRBase> ;
+    static constexpr Type SnapshotMask = 0x4FFFU ;
     using FieldValues = DCMI_CR_CAPTURE_Values<DCMI::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +76,7 @@ struct DCMI
     using ERR_IE = DCMI_IER_ERR_IE_Values<DCMI::IER, 2, 1, ReadWriteMode, DCMIIERBase> ;
     using OVR_IE = DCMI_IER_OVR_IE_Values<DCMI::IER, 1, 1, ReadWriteMode, DCMIIERBase> ;
     using FRAME_IE = DCMI_IER_FRAME_IE_Values<DCMI::IER, 0, 1, ReadWriteMode, DCMIIERBase> ;
+    static constexpr Type SnapshotMask = 0x1FU ;
     using FieldValues = DCMI_IER_FRAME_IE_Values<DCMI::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -119,6 +121,7 @@ struct DCMI
     using LEC = DCMI_ESCR_LEC_Values<DCMI::ESCR, 16, 8, ReadWriteMode, DCMIESCRBase> ;
     using LSC = DCMI_ESCR_LSC_Values<DCMI::ESCR, 8, 8, ReadWriteMode, DCMIESCRBase> ;
     using FSC = DCMI_ESCR_FSC_Values<DCMI::ESCR, 0, 8, ReadWriteMode, DCMIESCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DCMI_ESCR_FSC_Values<DCMI::ESCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +136,7 @@ struct DCMI
     using LEU = DCMI_ESUR_LEU_Values<DCMI::ESUR, 16, 8, ReadWriteMode, DCMIESURBase> ;
     using LSU = DCMI_ESUR_LSU_Values<DCMI::ESUR, 8, 8, ReadWriteMode, DCMIESURBase> ;
     using FSU = DCMI_ESUR_FSU_Values<DCMI::ESUR, 0, 8, ReadWriteMode, DCMIESURBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DCMI_ESUR_FSU_Values<DCMI::ESUR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +149,7 @@ struct DCMI
   {
     using VST = DCMI_CWSTRT_VST_Values<DCMI::CWSTRT, 16, 13, ReadWriteMode, DCMICWSTRTBase> ;
     using HOFFCNT = DCMI_CWSTRT_HOFFCNT_Values<DCMI::CWSTRT, 0, 14, ReadWriteMode, DCMICWSTRTBase> ;
+    static constexpr Type SnapshotMask = 0x1FFF3FFFU ;
     using FieldValues = DCMI_CWSTRT_HOFFCNT_Values<DCMI::CWSTRT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +162,7 @@ struct DCMI
   {
     using VLINE = DCMI_CWSIZE_VLINE_Values<DCMI::CWSIZE, 16, 14, ReadWriteMode, DCMICWSIZEBase> ;
     using CAPCNT = DCMI_CWSIZE_CAPCNT_Values<DCMI::CWSIZE, 0, 14, ReadWriteMode, DCMICWSIZEBase> ;
+    static constexpr Type SnapshotMask = 0x3FFF3FFFU ;
     using FieldValues = DCMI_CWSIZE_CAPCNT_Values<DCMI::CWSIZE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -177,6 +183,7 @@ struct DCMI
   template<typename... T> 
   using DRPack  = Register<0x50050028, 32, ReadMode, DCMIDRBase, T...> ;
 
+  using Registers = TypesList<DCMI::CR, DCMI::SR, DCMI::RIS, DCMI::IER, DCMI::MIS, DCMI::ICR, DCMI::ESCR, DCMI::ESUR, DCMI::CWSTRT, DCMI::CWSIZE, DCMI::DR> ;
 } ;
 
 #endif //#if !defined(DCMIREGISTERS_HPP)
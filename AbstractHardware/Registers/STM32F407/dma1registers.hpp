@@ -101,6 +101,9 @@ struct DMA1
     using CTEIF0 = DMA1_LIFCR_CTEIF0_Values<DMA1::LIFCR, 3, 1, ReadWriteMode, DMA1LIFCRBase> ;
     using CDMEIF0 = DMA1_LIFCR_CDMEIF0_Values<DMA1::LIFCR, 2, 1, ReadWriteMode, DMA1LIFCRBase> ;
     using CFEIF0 = DMA1_LIFCR_CFEIF0_Values<DMA1::LIFCR, 0, 1, ReadWriteMode, DMA1LIFCRBase> ;
+    static constexpr Type WritableMask = 0xF7D0F7DU ;
+    static constexpr Type OneToClearMask = 0xF7D0F7DU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = DMA1_LIFCR_CFEIF0_Values<DMA1::LIFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +134,9 @@ struct DMA1
     using CTEIF4 = DMA1_HIFCR_CTEIF4_Values<DMA1::HIFCR, 3, 1, ReadWriteMode, DMA1HIFCRBase> ;
     using CDMEIF4 = DMA1_HIFCR_CDMEIF4_Values<DMA1::HIFCR, 2, 1, ReadWriteMode, DMA1HIFCRBase> ;
     using CFEIF4 = DMA1_HIFCR_CFEIF4_Values<DMA1::HIFCR, 0, 1, ReadWriteMode, DMA1HIFCRBase> ;
+    static constexpr Type WritableMask = 0xF7D0F7DU ;
+    static constexpr Type OneToClearMask = 0xF7D0F7DU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = DMA1_HIFCR_CFEIF4_Values<DMA1::HIFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -160,6 +166,7 @@ struct DMA1
     using TEIE = DMA1_S0CR_TEIE_Values<DMA1::S0CR, 2, 1, ReadWriteMode, DMA1S0CRBase> ;
     using DMEIE = DMA1_S0CR_DMEIE_Values<DMA1::S0CR, 1, 1, ReadWriteMode, DMA1S0CRBase> ;
     using EN = DMA1_S0CR_EN_Values<DMA1::S0CR, 0, 1, ReadWriteMode, DMA1S0CRBase> ;
+    static constexpr Type SnapshotMask = 0xFEFFFFEU ;
     using FieldValues = DMA1_S0CR_EN_Values<DMA1::S0CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +178,7 @@ struct DMA1
   struct S0NDTR : public RegisterBase<0x40026014, 32, ReadWriteMode>
   {
     using NDT = DMA1_S0NDTR_NDT_Values<DMA1::S0NDTR, 0, 16, ReadWriteMode, DMA1S0NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S0NDTR_NDT_Values<DMA1::S0NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -182,6 +190,7 @@ struct DMA1
   struct S0PAR : public RegisterBase<0x40026018, 32, ReadWriteMode>
   {
     using PA = DMA1_S0PAR_PA_Values<DMA1::S0PAR, 0, 32, ReadWriteMode, DMA1S0PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S0PAR_PA_Values<DMA1::S0PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -193,6 +202,7 @@ struct DMA1
   struct S0M0AR : public RegisterBase<0x4002601C, 32, ReadWriteMode>
   {
     using M0A = DMA1_S0M0AR_M0A_Values<DMA1::S0M0AR, 0, 32, ReadWriteMode, DMA1S0M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S0M0AR_M0A_Values<DMA1::S0M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -204,6 +214,7 @@ struct DMA1
   struct S0M1AR : public RegisterBase<0x40026020, 32, ReadWriteMode>
   {
     using M1A = DMA1_S0M1AR_M1A_Values<DMA1::S0M1AR, 0, 32, ReadWriteMode, DMA1S0M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S0M1AR_M1A_Values<DMA1::S0M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +229,7 @@ struct DMA1
     using FS = DMA1_S0FCR_FS_Values<DMA1::S0FCR, 3, 3, ReadMode, DMA1S0FCRBase> ;
     using DMDIS = DMA1_S0FCR_DMDIS_Values<DMA1::S0FCR, 2, 1, ReadWriteMode, DMA1S0FCRBase> ;
     using FTH = DMA1_S0FCR_FTH_Values<DMA1::S0FCR, 0, 2, ReadWriteMode, DMA1S0FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S0FCR_FTH_Values<DMA1::S0FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -248,6 +260,7 @@ struct DMA1
     using TEIE = DMA1_S1CR_TEIE_Values<DMA1::S1CR, 2, 1, ReadWriteMode, DMA1S1CRBase> ;
     using DMEIE = DMA1_S1CR_DMEIE_Values<DMA1::S1CR, 1, 1, ReadWriteMode, DMA1S1CRBase> ;
     using EN = DMA1_S1CR_EN_Values<DMA1::S1CR, 0, 1, ReadWriteMode, DMA1S1CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S1CR_EN_Values<DMA1::S1CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,6 +272,7 @@ struct DMA1
   struct S1NDTR : public RegisterBase<0x4002602C, 32, ReadWriteMode>
   {
     using NDT = DMA1_S1NDTR_NDT_Values<DMA1::S1NDTR, 0, 16, ReadWriteMode, DMA1S1NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S1NDTR_NDT_Values<DMA1::S1NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +284,7 @@ struct DMA1
   struct S1PAR : public RegisterBase<0x40026030, 32, ReadWriteMode>
   {
     using PA = DMA1_S1PAR_PA_Values<DMA1::S1PAR, 0, 32, ReadWriteMode, DMA1S1PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S1PAR_PA_Values<DMA1::S1PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -281,6 +296,7 @@ struct DMA1
   struct S1M0AR : public RegisterBase<0x40026034, 32, ReadWriteMode>
   {
     using M0A = DMA1_S1M0AR_M0A_Values<DMA1::S1M0AR, 0, 32, ReadWriteMode, DMA1S1M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S1M0AR_M0A_Values<DMA1::S1M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -292,6 +308,7 @@ struct DMA1
   struct S1M1AR : public RegisterBase<0x40026038, 32, ReadWriteMode>
   {
     using M1A = DMA1_S1M1AR_M1A_Values<DMA1::S1M1AR, 0, 32, ReadWriteMode, DMA1S1M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S1M1AR_M1A_Values<DMA1::S1M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +323,7 @@ struct DMA1
     using FS = DMA1_S1FCR_FS_Values<DMA1::S1FCR, 3, 3, ReadMode, DMA1S1FCRBase> ;
     using DMDIS = DMA1_S1FCR_DMDIS_Values<DMA1::S1FCR, 2, 1, ReadWriteMode, DMA1S1FCRBase> ;
     using FTH = DMA1_S1FCR_FTH_Values<DMA1::S1FCR, 0, 2, ReadWriteMode, DMA1S1FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S1FCR_FTH_Values<DMA1::S1FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -336,6 +354,7 @@ struct DMA1
     using TEIE = DMA1_S2CR_TEIE_Values<DMA1::S2CR, 2, 1, ReadWriteMode, DMA1S2CRBase> ;
     using DMEIE = DMA1_S2CR_DMEIE_Values<DMA1::S2CR, 1, 1, ReadWriteMode, DMA1S2CRBase> ;
     using EN = DMA1_S2CR_EN_Values<DMA1::S2CR, 0, 1, ReadWriteMode, DMA1S2CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S2CR_EN_Values<DMA1::S2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -347,6 +366,7 @@ struct DMA1
   struct S2NDTR : public RegisterBase<0x40026044, 32, ReadWriteMode>
   {
     using NDT = DMA1_S2NDTR_NDT_Values<DMA1::S2NDTR, 0, 16, ReadWriteMode, DMA1S2NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S2NDTR_NDT_Values<DMA1::S2NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,6 +378,7 @@ struct DMA1
   struct S2PAR : public RegisterBase<0x40026048, 32, ReadWriteMode>
   {
     using PA = DMA1_S2PAR_PA_Values<DMA1::S2PAR, 0, 32, ReadWriteMode, DMA1S2PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S2PAR_PA_Values<DMA1::S2PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -369,6 +390,7 @@ struct DMA1
   struct S2M0AR : public RegisterBase<0x4002604C, 32, ReadWriteMode>
   {
     using M0A = DMA1_S2M0AR_M0A_Values<DMA1::S2M0AR, 0, 32, ReadWriteMode, DMA1S2M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S2M0AR_M0A_Values<DMA1::S2M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -380,6 +402,7 @@ struct DMA1
   struct S2M1AR : public RegisterBase<0x40026050, 32, ReadWriteMode>
   {
     using M1A = DMA1_S2M1AR_M1A_Values<DMA1::S2M1AR, 0, 32, ReadWriteMode, DMA1S2M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S2M1AR_M1A_Values<DMA1::S2M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -394,6 +417,7 @@ struct DMA1
     using FS = DMA1_S2FCR_FS_Values<DMA1::S2FCR, 3, 3, ReadMode, DMA1S2FCRBase> ;
     using DMDIS = DMA1_S2FCR_DMDIS_Values<DMA1::S2FCR, 2, 1, ReadWriteMode, DMA1S2FCRBase> ;
     using FTH = DMA1_S2FCR_FTH_Values<DMA1::S2FCR, 0, 2, ReadWriteMode, DMA1S2FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S2FCR_FTH_Values<DMA1::S2FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -424,6 +448,7 @@ struct DMA1
     using TEIE = DMA1_S3CR_TEIE_Values<DMA1::S3CR, 2, 1, ReadWriteMode, DMA1S3CRBase> ;
     using DMEIE = DMA1_S3CR_DMEIE_Values<DMA1::S3CR, 1, 1, ReadWriteMode, DMA1S3CRBase> ;
     using EN = DMA1_S3CR_EN_Values<DMA1::S3CR, 0, 1, ReadWriteMode, DMA1S3CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S3CR_EN_Values<DMA1::S3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -435,6 +460,7 @@ struct DMA1
   struct S3NDTR : public RegisterBase<0x4002605C, 32, ReadWriteMode>
   {
     using NDT = DMA1_S3NDTR_NDT_Values<DMA1::S3NDTR, 0, 16, ReadWriteMode, DMA1S3NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S3NDTR_NDT_Values<DMA1::S3NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -446,6 +472,7 @@ struct DMA1
   struct S3PAR : public RegisterBase<0x40026060, 32, ReadWriteMode>
   {
     using PA = DMA1_S3PAR_PA_Values<DMA1::S3PAR, 0, 32, ReadWriteMode, DMA1S3PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S3PAR_PA_Values<DMA1::S3PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -457,6 +484,7 @@ struct DMA1
   struct S3M0AR : public RegisterBase<0x40026064, 32, ReadWriteMode>
   {
     using M0A = DMA1_S3M0AR_M0A_Values<DMA1::S3M0AR, 0, 32, ReadWriteMode, DMA1S3M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S3M0AR_M0A_Values<DMA1::S3M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -468,6 +496,7 @@ struct DMA1
   struct S3M1AR : public RegisterBase<0x40026068, 32, ReadWriteMode>
   {
     using M1A = DMA1_S3M1AR_M1A_Values<DMA1::S3M1AR, 0, 32, ReadWriteMode, DMA1S3M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S3M1AR_M1A_Values<DMA1::S3M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -482,6 +511,7 @@ struct DMA1
     using FS = DMA1_S3FCR_FS_Values<DMA1::S3FCR, 3, 3, ReadMode, DMA1S3FCRBase> ;
     using DMDIS = DMA1_S3FCR_DMDIS_Values<DMA1::S3FCR, 2, 1, ReadWriteMode, DMA1S3FCRBase> ;
     using FTH = DMA1_S3FCR_FTH_Values<DMA1::S3FCR, 0, 2, ReadWriteMode, DMA1S3FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S3FCR_FTH_Values<DMA1::S3FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -512,6 +542,7 @@ struct DMA1
     using TEIE = DMA1_S4CR_TEIE_Values<DMA1::S4CR, 2, 1, ReadWriteMode, DMA1S4CRBase> ;
     using DMEIE = DMA1_S4CR_DMEIE_Values<DMA1::S4CR, 1, 1, ReadWriteMode, DMA1S4CRBase> ;
     using EN = DMA1_S4CR_EN_Values<DMA1::S4CR, 0, 1, ReadWriteMode, DMA1S4CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S4CR_EN_Values<DMA1::S4CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -523,6 +554,7 @@ struct DMA1
   struct S4NDTR : public RegisterBase<0x40026074, 32, ReadWriteMode>
   {
     using NDT = DMA1_S4NDTR_NDT_Values<DMA1::S4NDTR, 0, 16, ReadWriteMode, DMA1S4NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S4NDTR_NDT_Values<DMA1::S4NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -534,6 +566,7 @@ struct DMA1
   struct S4PAR : public RegisterBase<0x40026078, 32, ReadWriteMode>
   {
     using PA = DMA1_S4PAR_PA_Values<DMA1::S4PAR, 0, 32, ReadWriteMode, DMA1S4PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S4PAR_PA_Values<DMA1::S4PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -545,6 +578,7 @@ struct DMA1
   struct S4M0AR : public RegisterBase<0x4002607C, 32, ReadWriteMode>
   {
     using M0A = DMA1_S4M0AR_M0A_Values<DMA1::S4M0AR, 0, 32, ReadWriteMode, DMA1S4M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S4M0AR_M0A_Values<DMA1::S4M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -556,6 +590,7 @@ struct DMA1
   struct S4M1AR : public RegisterBase<0x40026080, 32, ReadWriteMode>
   {
     using M1A = DMA1_S4M1AR_M1A_Values<DMA1::S4M1AR, 0, 32, ReadWriteMode, DMA1S4M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S4M1AR_M1A_Values<DMA1::S4M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -570,6 +605,7 @@ struct DMA1
     using FS = DMA1_S4FCR_FS_Values<DMA1::S4FCR, 3, 3, ReadMode, DMA1S4FCRBase> ;
     using DMDIS = DMA1_S4FCR_DMDIS_Values<DMA1::S4FCR, 2, 1, ReadWriteMode, DMA1S4FCRBase> ;
     using FTH = DMA1_S4FCR_FTH_Values<DMA1::S4FCR, 0, 2, ReadWriteMode, DMA1S4FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S4FCR_FTH_Values<DMA1::S4FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -600,6 +636,7 @@ struct DMA1
     using TEIE = DMA1_S5CR_TEIE_Values<DMA1::S5CR, 2, 1, ReadWriteMode, DMA1S5CRBase> ;
     using DMEIE = DMA1_S5CR_DMEIE_Values<DMA1::S5CR, 1, 1, ReadWriteMode, DMA1S5CRBase> ;
     using EN = DMA1_S5CR_EN_Values<DMA1::S5CR, 0, 1, ReadWriteMode, DMA1S5CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S5CR_EN_Values<DMA1::S5CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -611,6 +648,7 @@ struct DMA1
   struct S5NDTR : public RegisterBase<0x4002608C, 32, ReadWriteMode>
   {
     using NDT = DMA1_S5NDTR_NDT_Values<DMA1::S5NDTR, 0, 16, ReadWriteMode, DMA1S5NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S5NDTR_NDT_Values<DMA1::S5NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -622,6 +660,7 @@ struct DMA1
   struct S5PAR : public RegisterBase<0x40026090, 32, ReadWriteMode>
   {
     using PA = DMA1_S5PAR_PA_Values<DMA1::S5PAR, 0, 32, ReadWriteMode, DMA1S5PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S5PAR_PA_Values<DMA1::S5PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -633,6 +672,7 @@ struct DMA1
   struct S5M0AR : public RegisterBase<0x40026094, 32, ReadWriteMode>
   {
     using M0A = DMA1_S5M0AR_M0A_Values<DMA1::S5M0AR, 0, 32, ReadWriteMode, DMA1S5M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S5M0AR_M0A_Values<DMA1::S5M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -644,6 +684,7 @@ struct DMA1
   struct S5M1AR : public RegisterBase<0x40026098, 32, ReadWriteMode>
   {
     using M1A = DMA1_S5M1AR_M1A_Values<DMA1::S5M1AR, 0, 32, ReadWriteMode, DMA1S5M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S5M1AR_M1A_Values<DMA1::S5M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -658,6 +699,7 @@ struct DMA1
     using FS = DMA1_S5FCR_FS_Values<DMA1::S5FCR, 3, 3, ReadMode, DMA1S5FCRBase> ;
     using DMDIS = DMA1_S5FCR_DMDIS_Values<DMA1::S5FCR, 2, 1, ReadWriteMode, DMA1S5FCRBase> ;
     using FTH = DMA1_S5FCR_FTH_Values<DMA1::S5FCR, 0, 2, ReadWriteMode, DMA1S5FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S5FCR_FTH_Values<DMA1::S5FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -688,6 +730,7 @@ struct DMA1
     using TEIE = DMA1_S6CR_TEIE_Values<DMA1::S6CR, 2, 1, ReadWriteMode, DMA1S6CRBase> ;
     using DMEIE = DMA1_S6CR_DMEIE_Values<DMA1::S6CR, 1, 1, ReadWriteMode, DMA1S6CRBase> ;
     using EN = DMA1_S6CR_EN_Values<DMA1::S6CR, 0, 1, ReadWriteMode, DMA1S6CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S6CR_EN_Values<DMA1::S6CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -699,6 +742,7 @@ struct DMA1
   struct S6NDTR : public RegisterBase<0x400260A4, 32, ReadWriteMode>
   {
     using NDT = DMA1_S6NDTR_NDT_Values<DMA1::S6NDTR, 0, 16, ReadWriteMode, DMA1S6NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S6NDTR_NDT_Values<DMA1::S6NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -710,6 +754,7 @@ struct DMA1
   struct S6PAR : public RegisterBase<0x400260A8, 32, ReadWriteMode>
   {
     using PA = DMA1_S6PAR_PA_Values<DMA1::S6PAR, 0, 32, ReadWriteMode, DMA1S6PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S6PAR_PA_Values<DMA1::S6PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -721,6 +766,7 @@ struct DMA1
   struct S6M0AR : public RegisterBase<0x400260AC, 32, ReadWriteMode>
   {
     using M0A = DMA1_S6M0AR_M0A_Values<DMA1::S6M0AR, 0, 32, ReadWriteMode, DMA1S6M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S6M0AR_M0A_Values<DMA1::S6M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -732,6 +778,7 @@ struct DMA1
   struct S6M1AR : public RegisterBase<0x400260B0, 32, ReadWriteMode>
   {
     using M1A = DMA1_S6M1AR_M1A_Values<DMA1::S6M1AR, 0, 32, ReadWriteMode, DMA1S6M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S6M1AR_M1A_Values<DMA1::S6M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -746,6 +793,7 @@ struct DMA1
     using FS = DMA1_S6FCR_FS_Values<DMA1::S6FCR, 3, 3, ReadMode, DMA1S6FCRBase> ;
     using DMDIS = DMA1_S6FCR_DMDIS_Values<DMA1::S6FCR, 2, 1, ReadWriteMode, DMA1S6FCRBase> ;
     using FTH = DMA1_S6FCR_FTH_Values<DMA1::S6FCR, 0, 2, ReadWriteMode, DMA1S6FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S6FCR_FTH_Values<DMA1::S6FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +824,7 @@ struct DMA1
     using TEIE = DMA1_S7CR_TEIE_Values<DMA1::S7CR, 2, 1, ReadWriteMode, DMA1S7CRBase> ;
     using DMEIE = DMA1_S7CR_DMEIE_Values<DMA1::S7CR, 1, 1, ReadWriteMode, DMA1S7CRBase> ;
     using EN = DMA1_S7CR_EN_Values<DMA1::S7CR, 0, 1, ReadWriteMode, DMA1S7CRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
     using FieldValues = DMA1_S7CR_EN_Values<DMA1::S7CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -787,6 +836,7 @@ struct DMA1
   struct S7NDTR : public RegisterBase<0x400260BC, 32, ReadWriteMode>
   {
     using NDT = DMA1_S7NDTR_NDT_Values<DMA1::S7NDTR, 0, 16, ReadWriteMode, DMA1S7NDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_S7NDTR_NDT_Values<DMA1::S7NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -798,6 +848,7 @@ struct DMA1
   struct S7PAR : public RegisterBase<0x400260C0, 32, ReadWriteMode>
   {
     using PA = DMA1_S7PAR_PA_Values<DMA1::S7PAR, 0, 32, ReadWriteMode, DMA1S7PARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S7PAR_PA_Values<DMA1::S7PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -809,6 +860,7 @@ struct DMA1
   struct S7M0AR : public RegisterBase<0x400260C4, 32, ReadWriteMode>
   {
     using M0A = DMA1_S7M0AR_M0A_Values<DMA1::S7M0AR, 0, 32, ReadWriteMode, DMA1S7M0ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S7M0AR_M0A_Values<DMA1::S7M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -820,6 +872,7 @@ struct DMA1
   struct S7M1AR : public RegisterBase<0x400260C8, 32, ReadWriteMode>
   {
     using M1A = DMA1_S7M1AR_M1A_Values<DMA1::S7M1AR, 0, 32, ReadWriteMode, DMA1S7M1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_S7M1AR_M1A_Values<DMA1::S7M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -834,12 +887,14 @@ struct DMA1
     using FS = DMA1_S7FCR_FS_Values<DMA1::S7FCR, 3, 3, ReadMode, DMA1S7FCRBase> ;
     using DMDIS = DMA1_S7FCR_DMDIS_Values<DMA1::S7FCR, 2, 1, ReadWriteMode, DMA1S7FCRBase> ;
     using FTH = DMA1_S7FCR_FTH_Values<DMA1::S7FCR, 0, 2, ReadWriteMode, DMA1S7FCRBase> ;
+    static constexpr Type SnapshotMask = 0x87U ;
     using FieldValues = DMA1_S7FCR_FTH_Values<DMA1::S7FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using S7FCRPack  = Register<0x400260CC, 32, ReadWriteMode, DMA1S7FCRBase, T...> ;
 
+  using Registers = TypesList<DMA1::LISR, DMA1::HISR, DMA1::LIFCR, DMA1::HIFCR, DMA1::S0CR, DMA1::S0NDTR, DMA1::S0PAR, DMA1::S0M0AR, DMA1::S0M1AR, DMA1::S0FCR, DMA1::S1CR, DMA1::S1NDTR, DMA1::S1PAR, DMA1::S1M0AR, DMA1::S1M1AR, DMA1::S1FCR, DMA1::S2CR, DMA1::S2NDTR, DMA1::S2PAR, DMA1::S2M0AR, DMA1::S2M1AR, DMA1::S2FCR, DMA1::S3CR, DMA1::S3NDTR, DMA1::S3PAR, DMA1::S3M0AR, DMA1::S3M1AR, DMA1::S3FCR, DMA1::S4CR, DMA1::S4NDTR, DMA1::S4PAR, DMA1::S4M0AR, DMA1::S4M1AR, DMA1::S4FCR, DMA1::S5CR, DMA1::S5NDTR, DMA1::S5PAR, DMA1::S5M0AR, DMA1::S5M1AR, DMA1::S5FCR, DMA1::S6CR, DMA1::S6NDTR, DMA1::S6PAR, DMA1::S6M0AR, DMA1::S6M1AR, DMA1::S6FCR, DMA1::S7CR, DMA1::S7NDTR, DMA1::S7PAR, DMA1::S7M0AR, DMA1::S7M1AR, DMA1::S7FCR> ;
 } ;
 
 #endif //#if !defined(DMA1REGISTERS_HPP)
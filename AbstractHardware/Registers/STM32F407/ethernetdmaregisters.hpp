@@ -33,6 +33,7 @@ struct Ethernet_DMA
     using FPM = Ethernet_DMA_DMABMR_FPM_Values<Ethernet_DMA::DMABMR, 24, 1, ReadWriteMode, Ethernet_DMADMABMRBase> ;
     using AAB = Ethernet_DMA_DMABMR_AAB_Values<Ethernet_DMA::DMABMR, 25, 1, ReadWriteMode, Ethernet_DMADMABMRBase> ;
     using MB = Ethernet_DMA_DMABMR_MB_Values<Ethernet_DMA::DMABMR, 26, 1, ReadWriteMode, Ethernet_DMADMABMRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = Ethernet_DMA_DMABMR_MB_Values<Ethernet_DMA::DMABMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct Ethernet_DMA
   struct DMATPDR : public RegisterBase<0x40029004, 32, ReadWriteMode>
   {
     using TPD = Ethernet_DMA_DMATPDR_TPD_Values<Ethernet_DMA::DMATPDR, 0, 32, ReadWriteMode, Ethernet_DMADMATPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_DMA_DMATPDR_TPD_Values<Ethernet_DMA::DMATPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +57,7 @@ struct Ethernet_DMA
   struct DMARPDR : public RegisterBase<0x40029008, 32, ReadWriteMode>
   {
     using RPD = Ethernet_DMA_DMARPDR_RPD_Values<Ethernet_DMA::DMARPDR, 0, 32, ReadWriteMode, Ethernet_DMADMARPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_DMA_DMARPDR_RPD_Values<Ethernet_DMA::DMARPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +69,7 @@ struct Ethernet_DMA
   struct DMARDLAR : public RegisterBase<0x4002900C, 32, ReadWriteMode>
   {
     using SRL = Ethernet_DMA_DMARDLAR_SRL_Values<Ethernet_DMA::DMARDLAR, 0, 32, ReadWriteMode, Ethernet_DMADMARDLARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_DMA_DMARDLAR_SRL_Values<Ethernet_DMA::DMARDLAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +81,7 @@ struct Ethernet_DMA
   struct DMATDLAR : public RegisterBase<0x40029010, 32, ReadWriteMode>
   {
     using STL = Ethernet_DMA_DMATDLAR_STL_Values<Ethernet_DMA::DMATDLAR, 0, 32, ReadWriteMode, Ethernet_DMADMATDLARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_DMA_DMATDLAR_STL_Values<Ethernet_DMA::DMATDLAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +113,7 @@ struct Ethernet_DMA
     using MMCS = Ethernet_DMA_DMASR_MMCS_Values<Ethernet_DMA::DMASR, 27, 1, ReadMode, Ethernet_DMADMASRBase> ;
     using PMTS = Ethernet_DMA_DMASR_PMTS_Values<Ethernet_DMA::DMASR, 28, 1, ReadMode, Ethernet_DMADMASRBase> ;
     using TSTS = Ethernet_DMA_DMASR_TSTS_Values<Ethernet_DMA::DMASR, 29, 1, ReadMode, Ethernet_DMADMASRBase> ;
+    static constexpr Type SnapshotMask = 0x1E7FFU ;
     using FieldValues = Ethernet_DMA_DMASR_TSTS_Values<Ethernet_DMA::DMASR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +136,7 @@ struct Ethernet_DMA
     using DFRF = Ethernet_DMA_DMAOMR_DFRF_Values<Ethernet_DMA::DMAOMR, 24, 1, ReadWriteMode, Ethernet_DMADMAOMRBase> ;
     using RSF = Ethernet_DMA_DMAOMR_RSF_Values<Ethernet_DMA::DMAOMR, 25, 1, ReadWriteMode, Ethernet_DMADMAOMRBase> ;
     using DTCEFD = Ethernet_DMA_DMAOMR_DTCEFD_Values<Ethernet_DMA::DMAOMR, 26, 1, ReadWriteMode, Ethernet_DMADMAOMRBase> ;
+    static constexpr Type SnapshotMask = 0x731E0DEU ;
     using FieldValues = Ethernet_DMA_DMAOMR_DTCEFD_Values<Ethernet_DMA::DMAOMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -155,6 +162,7 @@ struct Ethernet_DMA
     using ERIE = Ethernet_DMA_DMAIER_ERIE_Values<Ethernet_DMA::DMAIER, 14, 1, ReadWriteMode, Ethernet_DMADMAIERBase> ;
     using AISE = Ethernet_DMA_DMAIER_AISE_Values<Ethernet_DMA::DMAIER, 15, 1, ReadWriteMode, Ethernet_DMADMAIERBase> ;
     using NISE = Ethernet_DMA_DMAIER_NISE_Values<Ethernet_DMA::DMAIER, 16, 1, ReadWriteMode, Ethernet_DMADMAIERBase> ;
+    static constexpr Type SnapshotMask = 0x1E7FFU ;
     using FieldValues = Ethernet_DMA_DMAIER_NISE_Values<Ethernet_DMA::DMAIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +177,7 @@ struct Ethernet_DMA
     using OMFC = Ethernet_DMA_DMAMFBOCR_OMFC_Values<Ethernet_DMA::DMAMFBOCR, 16, 1, ReadWriteMode, Ethernet_DMADMAMFBOCRBase> ;
     using MFA = Ethernet_DMA_DMAMFBOCR_MFA_Values<Ethernet_DMA::DMAMFBOCR, 17, 11, ReadWriteMode, Ethernet_DMADMAMFBOCRBase> ;
     using OFOC = Ethernet_DMA_DMAMFBOCR_OFOC_Values<Ethernet_DMA::DMAMFBOCR, 28, 1, ReadWriteMode, Ethernet_DMADMAMFBOCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFFU ;
     using FieldValues = Ethernet_DMA_DMAMFBOCR_OFOC_Values<Ethernet_DMA::DMAMFBOCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +189,7 @@ struct Ethernet_DMA
   struct DMARSWTR : public RegisterBase<0x40029024, 32, ReadWriteMode>
   {
     using RSWTC = Ethernet_DMA_DMARSWTR_RSWTC_Values<Ethernet_DMA::DMARSWTR, 0, 8, ReadWriteMode, Ethernet_DMADMARSWTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = Ethernet_DMA_DMARSWTR_RSWTC_Values<Ethernet_DMA::DMARSWTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +240,7 @@ struct Ethernet_DMA
   template<typename... T> 
   using DMACHRBARPack  = Register<0x40029054, 32, ReadMode, Ethernet_DMADMACHRBARBase, T...> ;
 
+  using Registers = TypesList<Ethernet_DMA::DMABMR, Ethernet_DMA::DMATPDR, Ethernet_DMA::DMARPDR, Ethernet_DMA::DMARDLAR, Ethernet_DMA::DMATDLAR, Ethernet_DMA::DMASR, Ethernet_DMA::DMAOMR, Ethernet_DMA::DMAIER, Ethernet_DMA::DMAMFBOCR, Ethernet_DMA::DMARSWTR, Ethernet_DMA::DMACHTDR, Ethernet_DMA::DMACHRDR, Ethernet_DMA::DMACHTBAR, Ethernet_DMA::DMACHRBAR> ;
 } ;
 
 #endif //#if !defined(ETHERNETDMAREGISTERS_HPP)
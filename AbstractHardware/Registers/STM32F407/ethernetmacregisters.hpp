@@ -37,6 +37,7 @@ struct Ethernet_MAC
     using JD = Ethernet_MAC_MACCR_JD_Values<Ethernet_MAC::MACCR, 22, 1, ReadWriteMode, Ethernet_MACMACCRBase> ;
     using WD = Ethernet_MAC_MACCR_WD_Values<Ethernet_MAC::MACCR, 23, 1, ReadWriteMode, Ethernet_MACMACCRBase> ;
     using CSTF = Ethernet_MAC_MACCR_CSTF_Values<Ethernet_MAC::MACCR, 25, 1, ReadWriteMode, Ethernet_MACMACCRBase> ;
+    static constexpr Type SnapshotMask = 0x2CF7EFCU ;
     using FieldValues = Ethernet_MAC_MACCR_CSTF_Values<Ethernet_MAC::MACCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +59,7 @@ struct Ethernet_MAC
     using SAF = Ethernet_MAC_MACFFR_SAF_Values<Ethernet_MAC::MACFFR, 8, 1, ReadWriteMode, Ethernet_MACMACFFRBase> ;
     using HPF = Ethernet_MAC_MACFFR_HPF_Values<Ethernet_MAC::MACFFR, 9, 1, ReadWriteMode, Ethernet_MACMACFFRBase> ;
     using RA = Ethernet_MAC_MACFFR_RA_Values<Ethernet_MAC::MACFFR, 31, 1, ReadWriteMode, Ethernet_MACMACFFRBase> ;
+    static constexpr Type SnapshotMask = 0x800003FFU ;
     using FieldValues = Ethernet_MAC_MACFFR_RA_Values<Ethernet_MAC::MACFFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +71,7 @@ struct Ethernet_MAC
   struct MACHTHR : public RegisterBase<0x40028008, 32, ReadWriteMode>
   {
     using HTH = Ethernet_MAC_MACHTHR_HTH_Values<Ethernet_MAC::MACHTHR, 0, 32, ReadWriteMode, Ethernet_MACMACHTHRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_MAC_MACHTHR_HTH_Values<Ethernet_MAC::MACHTHR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +83,7 @@ struct Ethernet_MAC
   struct MACHTLR : public RegisterBase<0x4002800C, 32, ReadWriteMode>
   {
     using HTL = Ethernet_MAC_MACHTLR_HTL_Values<Ethernet_MAC::MACHTLR, 0, 32, ReadWriteMode, Ethernet_MACMACHTLRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_MAC_MACHTLR_HTL_Values<Ethernet_MAC::MACHTLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +99,7 @@ struct Ethernet_MAC
     using CR = Ethernet_MAC_MACMIIAR_CR_Values<Ethernet_MAC::MACMIIAR, 2, 3, ReadWriteMode, Ethernet_MACMACMIIARBase> ;
     using MR = Ethernet_MAC_MACMIIAR_MR_Values<Ethernet_MAC::MACMIIAR, 6, 5, ReadWriteMode, Ethernet_MACMACMIIARBase> ;
     using PA = Ethernet_MAC_MACMIIAR_PA_Values<Ethernet_MAC::MACMIIAR, 11, 5, ReadWriteMode, Ethernet_MACMACMIIARBase> ;
+    static constexpr Type SnapshotMask = 0xFFDFU ;
     using FieldValues = Ethernet_MAC_MACMIIAR_PA_Values<Ethernet_MAC::MACMIIAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +111,7 @@ struct Ethernet_MAC
   struct MACMIIDR : public RegisterBase<0x40028014, 32, ReadWriteMode>
   {
     using TD = Ethernet_MAC_MACMIIDR_TD_Values<Ethernet_MAC::MACMIIDR, 0, 16, ReadWriteMode, Ethernet_MACMACMIIDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = Ethernet_MAC_MACMIIDR_TD_Values<Ethernet_MAC::MACMIIDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -123,6 +129,7 @@ struct Ethernet_MAC
     using PLT = Ethernet_MAC_MACFCR_PLT_Values<Ethernet_MAC::MACFCR, 4, 2, ReadWriteMode, Ethernet_MACMACFCRBase> ;
     using ZQPD = Ethernet_MAC_MACFCR_ZQPD_Values<Ethernet_MAC::MACFCR, 7, 1, ReadWriteMode, Ethernet_MACMACFCRBase> ;
     using PT = Ethernet_MAC_MACFCR_PT_Values<Ethernet_MAC::MACFCR, 16, 16, ReadWriteMode, Ethernet_MACMACFCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF00BFU ;
     using FieldValues = Ethernet_MAC_MACFCR_PT_Values<Ethernet_MAC::MACFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +142,7 @@ struct Ethernet_MAC
   {
     using VLANTI = Ethernet_MAC_MACVLANTR_VLANTI_Values<Ethernet_MAC::MACVLANTR, 0, 16, ReadWriteMode, Ethernet_MACMACVLANTRBase> ;
     using VLANTC = Ethernet_MAC_MACVLANTR_VLANTC_Values<Ethernet_MAC::MACVLANTR, 16, 1, ReadWriteMode, Ethernet_MACMACVLANTRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
     using FieldValues = Ethernet_MAC_MACVLANTR_VLANTC_Values<Ethernet_MAC::MACVLANTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -152,6 +160,7 @@ struct Ethernet_MAC
     using WFR = Ethernet_MAC_MACPMTCSR_WFR_Values<Ethernet_MAC::MACPMTCSR, 6, 1, ReadWriteMode, Ethernet_MACMACPMTCSRBase> ;
     using GU = Ethernet_MAC_MACPMTCSR_GU_Values<Ethernet_MAC::MACPMTCSR, 9, 1, ReadWriteMode, Ethernet_MACMACPMTCSRBase> ;
     using WFFRPR = Ethernet_MAC_MACPMTCSR_WFFRPR_Values<Ethernet_MAC::MACPMTCSR, 31, 1, ReadWriteMode, Ethernet_MACMACPMTCSRBase> ;
+    static constexpr Type SnapshotMask = 0x80000267U ;
     using FieldValues = Ethernet_MAC_MACPMTCSR_WFFRPR_Values<Ethernet_MAC::MACPMTCSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -183,6 +192,7 @@ struct Ethernet_MAC
     using MMCRS = Ethernet_MAC_MACSR_MMCRS_Values<Ethernet_MAC::MACSR, 5, 1, ReadMode, Ethernet_MACMACSRBase> ;
     using MMCTS = Ethernet_MAC_MACSR_MMCTS_Values<Ethernet_MAC::MACSR, 6, 1, ReadMode, Ethernet_MACMACSRBase> ;
     using TSTS = Ethernet_MAC_MACSR_TSTS_Values<Ethernet_MAC::MACSR, 9, 1, ReadWriteMode, Ethernet_MACMACSRBase> ;
+    static constexpr Type SnapshotMask = 0x200U ;
     using FieldValues = Ethernet_MAC_MACSR_TSTS_Values<Ethernet_MAC::MACSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -195,6 +205,7 @@ struct Ethernet_MAC
   {
     using PMTIM = Ethernet_MAC_MACIMR_PMTIM_Values<Ethernet_MAC::MACIMR, 3, 1, ReadWriteMode, Ethernet_MACMACIMRBase> ;
     using TSTIM = Ethernet_MAC_MACIMR_TSTIM_Values<Ethernet_MAC::MACIMR, 9, 1, ReadWriteMode, Ethernet_MACMACIMRBase> ;
+    static constexpr Type SnapshotMask = 0x208U ;
     using FieldValues = Ethernet_MAC_MACIMR_TSTIM_Values<Ethernet_MAC::MACIMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +218,7 @@ struct Ethernet_MAC
   {
     using MACA0H = Ethernet_MAC_MACA0HR_MACA0H_Values<Ethernet_MAC::MACA0HR, 0, 16, ReadWriteMode, Ethernet_MACMACA0HRBase> ;
     using MO = Ethernet_MAC_MACA0HR_MO_Values<Ethernet_MAC::MACA0HR, 31, 1, ReadMode, Ethernet_MACMACA0HRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = Ethernet_MAC_MACA0HR_MO_Values<Ethernet_MAC::MACA0HR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +230,7 @@ struct Ethernet_MAC
   struct MACA0LR : public RegisterBase<0x40028044, 32, ReadWriteMode>
   {
     using MACA0L = Ethernet_MAC_MACA0LR_MACA0L_Values<Ethernet_MAC::MACA0LR, 0, 32, ReadWriteMode, Ethernet_MACMACA0LRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_MAC_MACA0LR_MACA0L_Values<Ethernet_MAC::MACA0LR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -232,6 +245,7 @@ struct Ethernet_MAC
     using MBC = Ethernet_MAC_MACA1HR_MBC_Values<Ethernet_MAC::MACA1HR, 24, 6, ReadWriteMode, Ethernet_MACMACA1HRBase> ;
     using SA = Ethernet_MAC_MACA1HR_SA_Values<Ethernet_MAC::MACA1HR, 30, 1, ReadWriteMode, Ethernet_MACMACA1HRBase> ;
     using AE = Ethernet_MAC_MACA1HR_AE_Values<Ethernet_MAC::MACA1HR, 31, 1, ReadWriteMode, Ethernet_MACMACA1HRBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFFFU ;
     using FieldValues = Ethernet_MAC_MACA1HR_AE_Values<Ethernet_MAC::MACA1HR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -243,6 +257,7 @@ struct Ethernet_MAC
   struct MACA1LR : public RegisterBase<0x4002804C, 32, ReadWriteMode>
   {
     using MACA1LRField = Ethernet_MAC_MACA1LR_MACA1LR_Values<Ethernet_MAC::MACA1LR, 0, 32, ReadWriteMode, Ethernet_MACMACA1LRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_MAC_MACA1LR_MACA1LR_Values<Ethernet_MAC::MACA1LR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -257,6 +272,7 @@ struct Ethernet_MAC
     using MBC = Ethernet_MAC_MACA2HR_MBC_Values<Ethernet_MAC::MACA2HR, 24, 6, ReadWriteMode, Ethernet_MACMACA2HRBase> ;
     using SA = Ethernet_MAC_MACA2HR_SA_Values<Ethernet_MAC::MACA2HR, 30, 1, ReadWriteMode, Ethernet_MACMACA2HRBase> ;
     using AE = Ethernet_MAC_MACA2HR_AE_Values<Ethernet_MAC::MACA2HR, 31, 1, ReadWriteMode, Ethernet_MACMACA2HRBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFFFU ;
     using FieldValues = Ethernet_MAC_MACA2HR_AE_Values<Ethernet_MAC::MACA2HR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -268,6 +284,7 @@ struct Ethernet_MAC
   struct MACA2LR : public RegisterBase<0x40028054, 32, ReadWriteMode>
   {
     using MACA2L = Ethernet_MAC_MACA2LR_MACA2L_Values<Ethernet_MAC::MACA2LR, 0, 31, ReadWriteMode, Ethernet_MACMACA2LRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = Ethernet_MAC_MACA2LR_MACA2L_Values<Ethernet_MAC::MACA2LR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +299,7 @@ struct Ethernet_MAC
     using MBC = Ethernet_MAC_MACA3HR_MBC_Values<Ethernet_MAC::MACA3HR, 24, 6, ReadWriteMode, Ethernet_MACMACA3HRBase> ;
     using SA = Ethernet_MAC_MACA3HR_SA_Values<Ethernet_MAC::MACA3HR, 30, 1, ReadWriteMode, Ethernet_MACMACA3HRBase> ;
     using AE = Ethernet_MAC_MACA3HR_AE_Values<Ethernet_MAC::MACA3HR, 31, 1, ReadWriteMode, Ethernet_MACMACA3HRBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFFFU ;
     using FieldValues = Ethernet_MAC_MACA3HR_AE_Values<Ethernet_MAC::MACA3HR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -293,12 +311,14 @@ struct Ethernet_MAC
   struct MACA3LR : public RegisterBase<0x4002805C, 32, ReadWriteMode>
   {
     using MBCA3L = Ethernet_MAC_MACA3LR_MBCA3L_Values<Ethernet_MAC::MACA3LR, 0, 32, ReadWriteMode, Ethernet_MACMACA3LRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_MAC_MACA3LR_MBCA3L_Values<Ethernet_MAC::MACA3LR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using MACA3LRPack  = Register<0x4002805C, 32, ReadWriteMode, Ethernet_MACMACA3LRBase, T...> ;
 
+  using Registers = TypesList<Ethernet_MAC::MACCR, Ethernet_MAC::MACFFR, Ethernet_MAC::MACHTHR, Ethernet_MAC::MACHTLR, Ethernet_MAC::MACMIIAR, Ethernet_MAC::MACMIIDR, Ethernet_MAC::MACFCR, Ethernet_MAC::MACVLANTR, Ethernet_MAC::MACPMTCSR, Ethernet_MAC::MACDBGR, Ethernet_MAC::MACSR, Ethernet_MAC::MACIMR, Ethernet_MAC::MACA0HR, Ethernet_MAC::MACA0LR, Ethernet_MAC::MACA1HR, Ethernet_MAC::MACA1LR, Ethernet_MAC::MACA2HR, Ethernet_MAC::MACA2LR, Ethernet_MAC::MACA3HR, Ethernet_MAC::MACA3LR> ;
 } ;
 
 #endif //#if !defined(ETHERNETMACREGISTERS_HPP)
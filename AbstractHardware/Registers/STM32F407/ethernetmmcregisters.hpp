@@ -27,6 +27,7 @@ struct Ethernet_MMC
     using MCF = Ethernet_MMC_MMCCR_MCF_Values<Ethernet_MMC::MMCCR, 3, 1, ReadWriteMode, Ethernet_MMCMMCCRBase> ;
     using MCP = Ethernet_MMC_MMCCR_MCP_Values<Ethernet_MMC::MMCCR, 4, 1, ReadWriteMode, Ethernet_MMCMMCCRBase> ;
     using MCFHP = Ethernet_MMC_MMCCR_MCFHP_Values<Ethernet_MMC::MMCCR, 5, 1, ReadWriteMode, Ethernet_MMCMMCCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = Ethernet_MMC_MMCCR_MCFHP_Values<Ethernet_MMC::MMCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -40,6 +41,7 @@ struct Ethernet_MMC
     using RFCES = Ethernet_MMC_MMCRIR_RFCES_Values<Ethernet_MMC::MMCRIR, 5, 1, ReadWriteMode, Ethernet_MMCMMCRIRBase> ;
     using RFAES = Ethernet_MMC_MMCRIR_RFAES_Values<Ethernet_MMC::MMCRIR, 6, 1, ReadWriteMode, Ethernet_MMCMMCRIRBase> ;
     using RGUFS = Ethernet_MMC_MMCRIR_RGUFS_Values<Ethernet_MMC::MMCRIR, 17, 1, ReadWriteMode, Ethernet_MMCMMCRIRBase> ;
+    static constexpr Type SnapshotMask = 0x20060U ;
     using FieldValues = Ethernet_MMC_MMCRIR_RGUFS_Values<Ethernet_MMC::MMCRIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +68,7 @@ struct Ethernet_MMC
     using RFCEM = Ethernet_MMC_MMCRIMR_RFCEM_Values<Ethernet_MMC::MMCRIMR, 5, 1, ReadWriteMode, Ethernet_MMCMMCRIMRBase> ;
     using RFAEM = Ethernet_MMC_MMCRIMR_RFAEM_Values<Ethernet_MMC::MMCRIMR, 6, 1, ReadWriteMode, Ethernet_MMCMMCRIMRBase> ;
     using RGUFM = Ethernet_MMC_MMCRIMR_RGUFM_Values<Ethernet_MMC::MMCRIMR, 17, 1, ReadWriteMode, Ethernet_MMCMMCRIMRBase> ;
+    static constexpr Type SnapshotMask = 0x20060U ;
     using FieldValues = Ethernet_MMC_MMCRIMR_RGUFM_Values<Ethernet_MMC::MMCRIMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +82,7 @@ struct Ethernet_MMC
     using TGFSCM = Ethernet_MMC_MMCTIMR_TGFSCM_Values<Ethernet_MMC::MMCTIMR, 14, 1, ReadWriteMode, Ethernet_MMCMMCTIMRBase> ;
     using TGFMSCM = Ethernet_MMC_MMCTIMR_TGFMSCM_Values<Ethernet_MMC::MMCTIMR, 15, 1, ReadWriteMode, Ethernet_MMCMMCTIMRBase> ;
     using TGFM = Ethernet_MMC_MMCTIMR_TGFM_Values<Ethernet_MMC::MMCTIMR, 16, 1, ReadWriteMode, Ethernet_MMCMMCTIMRBase> ;
+    static constexpr Type SnapshotMask = 0x1C000U ;
     using FieldValues = Ethernet_MMC_MMCTIMR_TGFM_Values<Ethernet_MMC::MMCTIMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +155,7 @@ struct Ethernet_MMC
   template<typename... T> 
   using MMCRGUFCRPack  = Register<0x400281C4, 32, ReadMode, Ethernet_MMCMMCRGUFCRBase, T...> ;
 
+  using Registers = TypesList<Ethernet_MMC::MMCCR, Ethernet_MMC::MMCRIR, Ethernet_MMC::MMCTIR, Ethernet_MMC::MMCRIMR, Ethernet_MMC::MMCTIMR, Ethernet_MMC::MMCTGFSCCR, Ethernet_MMC::MMCTGFMSCCR, Ethernet_MMC::MMCTGFCR, Ethernet_MMC::MMCRFCECR, Ethernet_MMC::MMCRFAECR, Ethernet_MMC::MMCRGUFCR> ;
 } ;
 
 #endif //#if !defined(ETHERNETMMCREGISTERS_HPP)
@@ -37,6 +37,7 @@ struct Ethernet_PTP
     using TTSARU = Ethernet_PTP_PTPTSCR_TTSARU_Values<Ethernet_PTP::PTPTSCR, 5, 1, ReadWriteMode, Ethernet_PTPPTPTSCRBase> ;
     using TSSARFE = Ethernet_PTP_PTPTSCR_TSSARFE_Values<Ethernet_PTP::PTPTSCR, 8, 1, ReadWriteMode, Ethernet_PTPPTPTSCRBase> ;
     using TSSSR = Ethernet_PTP_PTPTSCR_TSSSR_Values<Ethernet_PTP::PTPTSCR, 9, 1, ReadWriteMode, Ethernet_PTPPTPTSCRBase> ;
+    static constexpr Type SnapshotMask = 0x7FF3FU ;
     using FieldValues = Ethernet_PTP_PTPTSCR_TSSSR_Values<Ethernet_PTP::PTPTSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,6 +49,7 @@ struct Ethernet_PTP
   struct PTPSSIR : public RegisterBase<0x40028704, 32, ReadWriteMode>
   {
     using STSSI = Ethernet_PTP_PTPSSIR_STSSI_Values<Ethernet_PTP::PTPSSIR, 0, 8, ReadWriteMode, Ethernet_PTPPTPSSIRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = Ethernet_PTP_PTPSSIR_STSSI_Values<Ethernet_PTP::PTPSSIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +84,7 @@ struct Ethernet_PTP
   struct PTPTSHUR : public RegisterBase<0x40028710, 32, ReadWriteMode>
   {
     using TSUS = Ethernet_PTP_PTPTSHUR_TSUS_Values<Ethernet_PTP::PTPTSHUR, 0, 32, ReadWriteMode, Ethernet_PTPPTPTSHURBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_PTP_PTPTSHUR_TSUS_Values<Ethernet_PTP::PTPTSHUR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -94,6 +97,7 @@ struct Ethernet_PTP
   {
     using TSUSS = Ethernet_PTP_PTPTSLUR_TSUSS_Values<Ethernet_PTP::PTPTSLUR, 0, 31, ReadWriteMode, Ethernet_PTPPTPTSLURBase> ;
     using TSUPNS = Ethernet_PTP_PTPTSLUR_TSUPNS_Values<Ethernet_PTP::PTPTSLUR, 31, 1, ReadWriteMode, Ethernet_PTPPTPTSLURBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_PTP_PTPTSLUR_TSUPNS_Values<Ethernet_PTP::PTPTSLUR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -105,6 +109,7 @@ struct Ethernet_PTP
   struct PTPTSAR : public RegisterBase<0x40028718, 32, ReadWriteMode>
   {
     using TSA = Ethernet_PTP_PTPTSAR_TSA_Values<Ethernet_PTP::PTPTSAR, 0, 32, ReadWriteMode, Ethernet_PTPPTPTSARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_PTP_PTPTSAR_TSA_Values<Ethernet_PTP::PTPTSAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -116,6 +121,7 @@ struct Ethernet_PTP
   struct PTPTTHR : public RegisterBase<0x4002871C, 32, ReadWriteMode>
   {
     using TTSH = Ethernet_PTP_PTPTTHR_TTSH_Values<Ethernet_PTP::PTPTTHR, 0, 32, ReadWriteMode, Ethernet_PTPPTPTTHRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_PTP_PTPTTHR_TTSH_Values<Ethernet_PTP::PTPTTHR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +133,7 @@ struct Ethernet_PTP
   struct PTPTTLR : public RegisterBase<0x40028720, 32, ReadWriteMode>
   {
     using TTSL = Ethernet_PTP_PTPTTLR_TTSL_Values<Ethernet_PTP::PTPTTLR, 0, 32, ReadWriteMode, Ethernet_PTPPTPTTLRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = Ethernet_PTP_PTPTTLR_TTSL_Values<Ethernet_PTP::PTPTTLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +164,7 @@ struct Ethernet_PTP
   template<typename... T> 
   using PTPPPSCRPack  = Register<0x4002872C, 32, ReadMode, Ethernet_PTPPTPPPSCRBase, T...> ;
 
+  using Registers = TypesList<Ethernet_PTP::PTPTSCR, Ethernet_PTP::PTPSSIR, Ethernet_PTP::PTPTSHR, Ethernet_PTP::PTPTSLR, Ethernet_PTP::PTPTSHUR, Ethernet_PTP::PTPTSLUR, Ethernet_PTP::PTPTSAR, Ethernet_PTP::PTPTTHR, Ethernet_PTP::PTPTTLR, Ethernet_PTP::PTPTSSR, Ethernet_PTP::PTPPPSCR> ;
 } ;
 
 #endif //#if !defined(ETHERNETPTPREGISTERS_HPP)
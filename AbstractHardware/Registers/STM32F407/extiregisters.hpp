@@ -44,6 +44,7 @@ struct EXTI
     using MR20 = EXTI_IMR_MR20_Values<EXTI::IMR, 20, 1, ReadWriteMode, EXTIIMRBase> ;
     using MR21 = EXTI_IMR_MR21_Values<EXTI::IMR, 21, 1, ReadWriteMode, EXTIIMRBase> ;
     using MR22 = EXTI_IMR_MR22_Values<EXTI::IMR, 22, 1, ReadWriteMode, EXTIIMRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFU ;
     using FieldValues = EXTI_IMR_MR22_Values<EXTI::IMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +78,7 @@ struct EXTI
     using MR20 = EXTI_EMR_MR20_Values<EXTI::EMR, 20, 1, ReadWriteMode, EXTIEMRBase> ;
     using MR21 = EXTI_EMR_MR21_Values<EXTI::EMR, 21, 1, ReadWriteMode, EXTIEMRBase> ;
     using MR22 = EXTI_EMR_MR22_Values<EXTI::EMR, 22, 1, ReadWriteMode, EXTIEMRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFU ;
     using FieldValues = EXTI_EMR_MR22_Values<EXTI::EMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +112,7 @@ struct EXTI
     using TR20 = EXTI_RTSR_TR20_Values<EXTI::RTSR, 20, 1, ReadWriteMode, EXTIRTSRBase> ;
     using TR21 = EXTI_RTSR_TR21_Values<EXTI::RTSR, 21, 1, ReadWriteMode, EXTIRTSRBase> ;
     using TR22 = EXTI_RTSR_TR22_Values<EXTI::RTSR, 22, 1, ReadWriteMode, EXTIRTSRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFU ;
     using FieldValues = EXTI_RTSR_TR22_Values<EXTI::RTSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +146,7 @@ struct EXTI
     using TR20 = EXTI_FTSR_TR20_Values<EXTI::FTSR, 20, 1, ReadWriteMode, EXTIFTSRBase> ;
     using TR21 = EXTI_FTSR_TR21_Values<EXTI::FTSR, 21, 1, ReadWriteMode, EXTIFTSRBase> ;
     using TR22 = EXTI_FTSR_TR22_Values<EXTI::FTSR, 22, 1, ReadWriteMode, EXTIFTSRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFU ;
     using FieldValues = EXTI_FTSR_TR22_Values<EXTI::FTSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +180,7 @@ struct EXTI
     using SWIER20 = EXTI_SWIER_SWIER20_Values<EXTI::SWIER, 20, 1, ReadWriteMode, EXTISWIERBase> ;
     using SWIER21 = EXTI_SWIER_SWIER21_Values<EXTI::SWIER, 21, 1, ReadWriteMode, EXTISWIERBase> ;
     using SWIER22 = EXTI_SWIER_SWIER22_Values<EXTI::SWIER, 22, 1, ReadWriteMode, EXTISWIERBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_SWIER_SWIER22_Values<EXTI::SWIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,12 +214,16 @@ struct EXTI
     using PR20 = EXTI_PR_PR20_Values<EXTI::PR, 20, 1, ReadWriteMode, EXTIPRBase> ;
     using PR21 = EXTI_PR_PR21_Values<EXTI::PR, 21, 1, ReadWriteMode, EXTIPRBase> ;
     using PR22 = EXTI_PR_PR22_Values<EXTI::PR, 22, 1, ReadWriteMode, EXTIPRBase> ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type OneToClearMask = 0x7FFFFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PR_PR22_Values<EXTI::PR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PRPack  = Register<0x40013C14, 32, ReadWriteMode, EXTIPRBase, T...> ;
 
+  using Registers = TypesList<EXTI::IMR, EXTI::EMR, EXTI::RTSR, EXTI::FTSR, EXTI::SWIER, EXTI::PR> ;
 } ;
 
 #endif //#if !defined(EXTIREGISTERS_HPP)
@@ -27,6 +27,7 @@ struct FLASH
     using DCEN = FLASH_ACR_DCEN_Values<FLASH::ACR, 10, 1, ReadWriteMode, FLASHACRBase> ;
     using ICRST = FLASH_ACR_ICRST_Values<FLASH::ACR, 11, 1, WriteMode, FLASHACRBase> ;
     using DCRST = FLASH_ACR_DCRST_Values<FLASH::ACR, 12, 1, ReadWriteMode, FLASHACRBase> ;
+    static constexpr Type SnapshotMask = 0x1F07U ;
     using FieldValues = FLASH_ACR_DCRST_Values<FLASH::ACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +67,9 @@ struct FLASH
     using PGPERR = FLASH_SR_PGPERR_Values<FLASH::SR, 6, 1, ReadWriteMode, FLASHSRBase> ;
     using PGSERR = FLASH_SR_PGSERR_Values<FLASH::SR, 7, 1, ReadWriteMode, FLASHSRBase> ;
     using BSY = FLASH_SR_BSY_Values<FLASH::SR, 16, 1, ReadMode, FLASHSRBase> ;
+    static constexpr Type WritableMask = 0xF3U ;
+    static constexpr Type OneToClearMask = 0xF3U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = FLASH_SR_BSY_Values<FLASH::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +89,7 @@ struct FLASH
     using EOPIE = FLASH_CR_EOPIE_Values<FLASH::CR, 24, 1, ReadWriteMode, FLASHCRBase> ;
     using ERRIE = FLASH_CR_ERRIE_Values<FLASH::CR, 25, 1, ReadWriteMode, FLASHCRBase> ;
     using LOCK = FLASH_CR_LOCK_Values<FLASH::CR, 31, 1, ReadWriteMode, FLASHCRBase> ;
+    static constexpr Type SnapshotMask = 0x8300037FU ;
     using FieldValues = FLASH_CR_LOCK_Values<FLASH::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,12 +108,14 @@ struct FLASH
     using nRST_STDBY = FLASH_OPTCR_nRST_STDBY_Values<FLASH::OPTCR, 7, 1, ReadWriteMode, FLASHOPTCRBase> ;
     using RDP = FLASH_OPTCR_RDP_Values<FLASH::OPTCR, 8, 8, ReadWriteMode, FLASHOPTCRBase> ;
     using nWRP = FLASH_OPTCR_nWRP_Values<FLASH::OPTCR, 16, 12, ReadWriteMode, FLASHOPTCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFEFU ;
     using FieldValues = FLASH_OPTCR_nWRP_Values<FLASH::OPTCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OPTCRPack  = Register<0x40023C14, 32, ReadWriteMode, FLASHOPTCRBase, T...> ;
 
+  using Registers = TypesList<FLASH::ACR, FLASH::KEYR, FLASH::OPTKEYR, FLASH::SR, FLASH::CR, FLASH::OPTCR> ;
 } ;
 
 #endif //#if !defined(FLASHREGISTERS_HPP)
@@ -34,6 +34,7 @@ struct FSMC
     using MTYP = FSMC_BCR1_MTYP_Values<FSMC::BCR1, 2, 2, ReadWriteMode, FSMCBCR1Base> ;
     using MUXEN = FSMC_BCR1_MUXEN_Values<FSMC::BCR1, 1, 1, ReadWriteMode, FSMCBCR1Base> ;
     using MBKEN = FSMC_BCR1_MBKEN_Values<FSMC::BCR1, 0, 1, ReadWriteMode, FSMCBCR1Base> ;
+    static constexpr Type SnapshotMask = 0x8FB7FU ;
     using FieldValues = FSMC_BCR1_MBKEN_Values<FSMC::BCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +52,7 @@ struct FSMC
     using DATAST = FSMC_BTR1_DATAST_Values<FSMC::BTR1, 8, 8, ReadWriteMode, FSMCBTR1Base> ;
     using ADDHLD = FSMC_BTR1_ADDHLD_Values<FSMC::BTR1, 4, 4, ReadWriteMode, FSMCBTR1Base> ;
     using ADDSET = FSMC_BTR1_ADDSET_Values<FSMC::BTR1, 0, 4, ReadWriteMode, FSMCBTR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FSMC_BTR1_ADDSET_Values<FSMC::BTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +77,7 @@ struct FSMC
     using MTYP = FSMC_BCR2_MTYP_Values<FSMC::BCR2, 2, 2, ReadWriteMode, FSMCBCR2Base> ;
     using MUXEN = FSMC_BCR2_MUXEN_Values<FSMC::BCR2, 1, 1, ReadWriteMode, FSMCBCR2Base> ;
     using MBKEN = FSMC_BCR2_MBKEN_Values<FSMC::BCR2, 0, 1, ReadWriteMode, FSMCBCR2Base> ;
+    static constexpr Type SnapshotMask = 0x8FF7FU ;
     using FieldValues = FSMC_BCR2_MBKEN_Values<FSMC::BCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +95,7 @@ struct FSMC
     using DATAST = FSMC_BTR2_DATAST_Values<FSMC::BTR2, 8, 8, ReadWriteMode, FSMCBTR2Base> ;
     using ADDHLD = FSMC_BTR2_ADDHLD_Values<FSMC::BTR2, 4, 4, ReadWriteMode, FSMCBTR2Base> ;
     using ADDSET = FSMC_BTR2_ADDSET_Values<FSMC::BTR2, 0, 4, ReadWriteMode, FSMCBTR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FSMC_BTR2_ADDSET_Values<FSMC::BTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -116,6 +120,7 @@ struct FSMC
     using MTYP = FSMC_BCR3_MTYP_Values<FSMC::BCR3, 2, 2, ReadWriteMode, FSMCBCR3Base> ;
     using MUXEN = FSMC_BCR3_MUXEN_Values<FSMC::BCR3, 1, 1, ReadWriteMode, FSMCBCR3Base> ;
     using MBKEN = FSMC_BCR3_MBKEN_Values<FSMC::BCR3, 0, 1, ReadWriteMode, FSMCBCR3Base> ;
+    static constexpr Type SnapshotMask = 0x8FF7FU ;
     using FieldValues = FSMC_BCR3_MBKEN_Values<FSMC::BCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +138,7 @@ struct FSMC
     using DATAST = FSMC_BTR3_DATAST_Values<FSMC::BTR3, 8, 8, ReadWriteMode, FSMCBTR3Base> ;
     using ADDHLD = FSMC_BTR3_ADDHLD_Values<FSMC::BTR3, 4, 4, ReadWriteMode, FSMCBTR3Base> ;
     using ADDSET = FSMC_BTR3_ADDSET_Values<FSMC::BTR3, 0, 4, ReadWriteMode, FSMCBTR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FSMC_BTR3_ADDSET_Values<FSMC::BTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +163,7 @@ struct FSMC
     using MTYP = FSMC_BCR4_MTYP_Values<FSMC::BCR4, 2, 2, ReadWriteMode, FSMCBCR4Base> ;
     using MUXEN = FSMC_BCR4_MUXEN_Values<FSMC::BCR4, 1, 1, ReadWriteMode, FSMCBCR4Base> ;
     using MBKEN = FSMC_BCR4_MBKEN_Values<FSMC::BCR4, 0, 1, ReadWriteMode, FSMCBCR4Base> ;
+    static constexpr Type SnapshotMask = 0x8FF7FU ;
     using FieldValues = FSMC_BCR4_MBKEN_Values<FSMC::BCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -174,6 +181,7 @@ struct FSMC
     using DATAST = FSMC_BTR4_DATAST_Values<FSMC::BTR4, 8, 8, ReadWriteMode, FSMCBTR4Base> ;
     using ADDHLD = FSMC_BTR4_ADDHLD_Values<FSMC::BTR4, 4, 4, ReadWriteMode, FSMCBTR4Base> ;
     using ADDSET = FSMC_BTR4_ADDSET_Values<FSMC::BTR4, 0, 4, ReadWriteMode, FSMCBTR4Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFFFU ;
     using FieldValues = FSMC_BTR4_ADDSET_Values<FSMC::BTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +200,7 @@ struct FSMC
     using PTYP = FSMC_PCR2_PTYP_Values<FSMC::PCR2, 3, 1, ReadWriteMode, FSMCPCR2Base> ;
     using PBKEN = FSMC_PCR2_PBKEN_Values<FSMC::PCR2, 2, 1, ReadWriteMode, FSMCPCR2Base> ;
     using PWAITEN = FSMC_PCR2_PWAITEN_Values<FSMC::PCR2, 1, 1, ReadWriteMode, FSMCPCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFE7EU ;
     using FieldValues = FSMC_PCR2_PWAITEN_Values<FSMC::PCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +218,7 @@ struct FSMC
     using IFS = FSMC_SR2_IFS_Values<FSMC::SR2, 2, 1, ReadWriteMode, FSMCSR2Base> ;
     using ILS = FSMC_SR2_ILS_Values<FSMC::SR2, 1, 1, ReadWriteMode, FSMCSR2Base> ;
     using IRS = FSMC_SR2_IRS_Values<FSMC::SR2, 0, 1, ReadWriteMode, FSMCSR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = FSMC_SR2_IRS_Values<FSMC::SR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +233,7 @@ struct FSMC
     using MEMHOLDx = FSMC_PMEM2_MEMHOLDx_Values<FSMC::PMEM2, 16, 8, ReadWriteMode, FSMCPMEM2Base> ;
     using MEMWAITx = FSMC_PMEM2_MEMWAITx_Values<FSMC::PMEM2, 8, 8, ReadWriteMode, FSMCPMEM2Base> ;
     using MEMSETx = FSMC_PMEM2_MEMSETx_Values<FSMC::PMEM2, 0, 8, ReadWriteMode, FSMCPMEM2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PMEM2_MEMSETx_Values<FSMC::PMEM2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +248,7 @@ struct FSMC
     using ATTHOLDx = FSMC_PATT2_ATTHOLDx_Values<FSMC::PATT2, 16, 8, ReadWriteMode, FSMCPATT2Base> ;
     using ATTWAITx = FSMC_PATT2_ATTWAITx_Values<FSMC::PATT2, 8, 8, ReadWriteMode, FSMCPATT2Base> ;
     using ATTSETx = FSMC_PATT2_ATTSETx_Values<FSMC::PATT2, 0, 8, ReadWriteMode, FSMCPATT2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PATT2_ATTSETx_Values<FSMC::PATT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +278,7 @@ struct FSMC
     using PTYP = FSMC_PCR3_PTYP_Values<FSMC::PCR3, 3, 1, ReadWriteMode, FSMCPCR3Base> ;
     using PBKEN = FSMC_PCR3_PBKEN_Values<FSMC::PCR3, 2, 1, ReadWriteMode, FSMCPCR3Base> ;
     using PWAITEN = FSMC_PCR3_PWAITEN_Values<FSMC::PCR3, 1, 1, ReadWriteMode, FSMCPCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFE7EU ;
     using FieldValues = FSMC_PCR3_PWAITEN_Values<FSMC::PCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -283,6 +296,7 @@ struct FSMC
     using IFS = FSMC_SR3_IFS_Values<FSMC::SR3, 2, 1, ReadWriteMode, FSMCSR3Base> ;
     using ILS = FSMC_SR3_ILS_Values<FSMC::SR3, 1, 1, ReadWriteMode, FSMCSR3Base> ;
     using IRS = FSMC_SR3_IRS_Values<FSMC::SR3, 0, 1, ReadWriteMode, FSMCSR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = FSMC_SR3_IRS_Values<FSMC::SR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -297,6 +311,7 @@ struct FSMC
     using MEMHOLDx = FSMC_PMEM3_MEMHOLDx_Values<FSMC::PMEM3, 16, 8, ReadWriteMode, FSMCPMEM3Base> ;
     using MEMWAITx = FSMC_PMEM3_MEMWAITx_Values<FSMC::PMEM3, 8, 8, ReadWriteMode, FSMCPMEM3Base> ;
     using MEMSETx = FSMC_PMEM3_MEMSETx_Values<FSMC::PMEM3, 0, 8, ReadWriteMode, FSMCPMEM3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PMEM3_MEMSETx_Values<FSMC::PMEM3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -311,6 +326,7 @@ struct FSMC
     using ATTHOLDx = FSMC_PATT3_ATTHOLDx_Values<FSMC::PATT3, 16, 8, ReadWriteMode, FSMCPATT3Base> ;
     using ATTWAITx = FSMC_PATT3_ATTWAITx_Values<FSMC::PATT3, 8, 8, ReadWriteMode, FSMCPATT3Base> ;
     using ATTSETx = FSMC_PATT3_ATTSETx_Values<FSMC::PATT3, 0, 8, ReadWriteMode, FSMCPATT3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PATT3_ATTSETx_Values<FSMC::PATT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +356,7 @@ struct FSMC
     using PTYP = FSMC_PCR4_PTYP_Values<FSMC::PCR4, 3, 1, ReadWriteMode, FSMCPCR4Base> ;
     using PBKEN = FSMC_PCR4_PBKEN_Values<FSMC::PCR4, 2, 1, ReadWriteMode, FSMCPCR4Base> ;
     using PWAITEN = FSMC_PCR4_PWAITEN_Values<FSMC::PCR4, 1, 1, ReadWriteMode, FSMCPCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFE7EU ;
     using FieldValues = FSMC_PCR4_PWAITEN_Values<FSMC::PCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -357,6 +374,7 @@ struct FSMC
     using IFS = FSMC_SR4_IFS_Values<FSMC::SR4, 2, 1, ReadWriteMode, FSMCSR4Base> ;
     using ILS = FSMC_SR4_ILS_Values<FSMC::SR4, 1, 1, ReadWriteMode, FSMCSR4Base> ;
     using IRS = FSMC_SR4_IRS_Values<FSMC::SR4, 0, 1, ReadWriteMode, FSMCSR4Base> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = FSMC_SR4_IRS_Values<FSMC::SR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -371,6 +389,7 @@ struct FSMC
     using MEMHOLDx = FSMC_PMEM4_MEMHOLDx_Values<FSMC::PMEM4, 16, 8, ReadWriteMode, FSMCPMEM4Base> ;
     using MEMWAITx = FSMC_PMEM4_MEMWAITx_Values<FSMC::PMEM4, 8, 8, ReadWriteMode, FSMCPMEM4Base> ;
     using MEMSETx = FSMC_PMEM4_MEMSETx_Values<FSMC::PMEM4, 0, 8, ReadWriteMode, FSMCPMEM4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PMEM4_MEMSETx_Values<FSMC::PMEM4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -385,6 +404,7 @@ struct FSMC
     using ATTHOLDx = FSMC_PATT4_ATTHOLDx_Values<FSMC::PATT4, 16, 8, ReadWriteMode, FSMCPATT4Base> ;
     using ATTWAITx = FSMC_PATT4_ATTWAITx_Values<FSMC::PATT4, 8, 8, ReadWriteMode, FSMCPATT4Base> ;
     using ATTSETx = FSMC_PATT4_ATTSETx_Values<FSMC::PATT4, 0, 8, ReadWriteMode, FSMCPATT4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PATT4_ATTSETx_Values<FSMC::PATT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -399,6 +419,7 @@ struct FSMC
     using IOHOLDx = FSMC_PIO4_IOHOLDx_Values<FSMC::PIO4, 16, 8, ReadWriteMode, FSMCPIO4Base> ;
     using IOWAITx = FSMC_PIO4_IOWAITx_Values<FSMC::PIO4, 8, 8, ReadWriteMode, FSMCPIO4Base> ;
     using IOSETx = FSMC_PIO4_IOSETx_Values<FSMC::PIO4, 0, 8, ReadWriteMode, FSMCPIO4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = FSMC_PIO4_IOSETx_Values<FSMC::PIO4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -415,6 +436,7 @@ struct FSMC
     using DATAST = FSMC_BWTR1_DATAST_Values<FSMC::BWTR1, 8, 8, ReadWriteMode, FSMCBWTR1Base> ;
     using ADDHLD = FSMC_BWTR1_ADDHLD_Values<FSMC::BWTR1, 4, 4, ReadWriteMode, FSMCBWTR1Base> ;
     using ADDSET = FSMC_BWTR1_ADDSET_Values<FSMC::BWTR1, 0, 4, ReadWriteMode, FSMCBWTR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FF0FFFFU ;
     using FieldValues = FSMC_BWTR1_ADDSET_Values<FSMC::BWTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -431,6 +453,7 @@ struct FSMC
     using DATAST = FSMC_BWTR2_DATAST_Values<FSMC::BWTR2, 8, 8, ReadWriteMode, FSMCBWTR2Base> ;
     using ADDHLD = FSMC_BWTR2_ADDHLD_Values<FSMC::BWTR2, 4, 4, ReadWriteMode, FSMCBWTR2Base> ;
     using ADDSET = FSMC_BWTR2_ADDSET_Values<FSMC::BWTR2, 0, 4, ReadWriteMode, FSMCBWTR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FF0FFFFU ;
     using FieldValues = FSMC_BWTR2_ADDSET_Values<FSMC::BWTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -447,6 +470,7 @@ struct FSMC
     using DATAST = FSMC_BWTR3_DATAST_Values<FSMC::BWTR3, 8, 8, ReadWriteMode, FSMCBWTR3Base> ;
     using ADDHLD = FSMC_BWTR3_ADDHLD_Values<FSMC::BWTR3, 4, 4, ReadWriteMode, FSMCBWTR3Base> ;
     using ADDSET = FSMC_BWTR3_ADDSET_Values<FSMC::BWTR3, 0, 4, ReadWriteMode, FSMCBWTR3Base> ;
+    static constexpr Type SnapshotMask = 0x3FF0FFFFU ;
     using FieldValues = FSMC_BWTR3_ADDSET_Values<FSMC::BWTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -463,12 +487,14 @@ struct FSMC
     using DATAST = FSMC_BWTR4_DATAST_Values<FSMC::BWTR4, 8, 8, ReadWriteMode, FSMCBWTR4Base> ;
     using ADDHLD = FSMC_BWTR4_ADDHLD_Values<FSMC::BWTR4, 4, 4, ReadWriteMode, FSMCBWTR4Base> ;
     using ADDSET = FSMC_BWTR4_ADDSET_Values<FSMC::BWTR4, 0, 4, ReadWriteMode, FSMCBWTR4Base> ;
+    static constexpr Type SnapshotMask = 0x3FF0FFFFU ;
     using FieldValues = FSMC_BWTR4_ADDSET_Values<FSMC::BWTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BWTR4Pack  = Register<0xA000011C, 32, ReadWriteMode, FSMCBWTR4Base, T...> ;
 
+  using Registers = TypesList<FSMC::BCR1, FSMC::BTR1, FSMC::BCR2, FSMC::BTR2, FSMC::BCR3, FSMC::BTR3, FSMC::BCR4, FSMC::BTR4, FSMC::PCR2, FSMC::SR2, FSMC::PMEM2, FSMC::PATT2, FSMC::ECCR2, FSMC::PCR3, FSMC::SR3, FSMC::PMEM3, FSMC::PATT3, FSMC::ECCR3, FSMC::PCR4, FSMC::SR4, FSMC::PMEM4, FSMC::PATT4, FSMC::PIO4, FSMC::BWTR1, FSMC::BWTR2, FSMC::BWTR3, FSMC::BWTR4> ;
 } ;
 
 #endif //#if !defined(FSMCREGISTERS_HPP)
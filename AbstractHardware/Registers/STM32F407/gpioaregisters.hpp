@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOA
 {
+  struct BSRR ;
+
   struct GPIOAMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40020000, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOA
     using MODER2 = GPIOA_MODER_MODER2_Values<GPIOA::MODER, 4, 2, ReadWriteMode, GPIOAMODERBase> ;
     using MODER1 = GPIOA_MODER_MODER1_Values<GPIOA::MODER, 2, 2, ReadWriteMode, GPIOAMODERBase> ;
     using MODER0 = GPIOA_MODER_MODER0_Values<GPIOA::MODER, 0, 2, ReadWriteMode, GPIOAMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOA_MODER_MODER0_Values<GPIOA::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOA
     using OT2 = GPIOA_OTYPER_OT2_Values<GPIOA::OTYPER, 2, 1, ReadWriteMode, GPIOAOTYPERBase> ;
     using OT1 = GPIOA_OTYPER_OT1_Values<GPIOA::OTYPER, 1, 1, ReadWriteMode, GPIOAOTYPERBase> ;
     using OT0 = GPIOA_OTYPER_OT0_Values<GPIOA::OTYPER, 0, 1, ReadWriteMode, GPIOAOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOA_OTYPER_OT0_Values<GPIOA::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOA
     using OSPEEDR2 = GPIOA_OSPEEDR_OSPEEDR2_Values<GPIOA::OSPEEDR, 4, 2, ReadWriteMode, GPIOAOSPEEDRBase> ;
     using OSPEEDR1 = GPIOA_OSPEEDR_OSPEEDR1_Values<GPIOA::OSPEEDR, 2, 2, ReadWriteMode, GPIOAOSPEEDRBase> ;
     using OSPEEDR0 = GPIOA_OSPEEDR_OSPEEDR0_Values<GPIOA::OSPEEDR, 0, 2, ReadWriteMode, GPIOAOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOA_OSPEEDR_OSPEEDR0_Values<GPIOA::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOA
     using PUPDR2 = GPIOA_PUPDR_PUPDR2_Values<GPIOA::PUPDR, 4, 2, ReadWriteMode, GPIOAPUPDRBase> ;
     using PUPDR1 = GPIOA_PUPDR_PUPDR1_Values<GPIOA::PUPDR, 2, 2, ReadWriteMode, GPIOAPUPDRBase> ;
     using PUPDR0 = GPIOA_PUPDR_PUPDR0_Values<GPIOA::PUPDR, 0, 2, ReadWriteMode, GPIOAPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOA_PUPDR_PUPDR0_Values<GPIOA::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOA
     using IDR2 = GPIOA_IDR_IDR2_Values<GPIOA::IDR, 2, 1, ReadMode, GPIOAIDRBase> ;
     using IDR1 = GPIOA_IDR_IDR1_Values<GPIOA::IDR, 1, 1, ReadMode, GPIOAIDRBase> ;
     using IDR0 = GPIOA_IDR_IDR0_Values<GPIOA::IDR, 0, 1, ReadMode, GPIOAIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOA_IDR_IDR0_Values<GPIOA::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOA
     using ODR2 = GPIOA_ODR_ODR2_Values<GPIOA::ODR, 2, 1, ReadWriteMode, GPIOAODRBase> ;
     using ODR1 = GPIOA_ODR_ODR1_Values<GPIOA::ODR, 1, 1, ReadWriteMode, GPIOAODRBase> ;
     using ODR0 = GPIOA_ODR_ODR0_Values<GPIOA::ODR, 0, 1, ReadWriteMode, GPIOAODRBase> ;
+    using SetResetRegister = GPIOA::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOA_ODR_ODR0_Values<GPIOA::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOA
     using BS2 = GPIOA_BSRR_BS2_Values<GPIOA::BSRR, 2, 1, WriteMode, GPIOABSRRBase> ;
     using BS1 = GPIOA_BSRR_BS1_Values<GPIOA::BSRR, 1, 1, WriteMode, GPIOABSRRBase> ;
     using BS0 = GPIOA_BSRR_BS0_Values<GPIOA::BSRR, 0, 1, WriteMode, GPIOABSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOA_BSRR_BS0_Values<GPIOA::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOA
     using LCK2 = GPIOA_LCKR_LCK2_Values<GPIOA::LCKR, 2, 1, ReadWriteMode, GPIOALCKRBase> ;
     using LCK1 = GPIOA_LCKR_LCK1_Values<GPIOA::LCKR, 1, 1, ReadWriteMode, GPIOALCKRBase> ;
     using LCK0 = GPIOA_LCKR_LCK0_Values<GPIOA::LCKR, 0, 1, ReadWriteMode, GPIOALCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOA_LCKR_LCK0_Values<GPIOA::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOA
     using AFRL2 = GPIOA_AFRL_AFRL2_Values<GPIOA::AFRL, 8, 4, ReadWriteMode, GPIOAAFRLBase> ;
     using AFRL1 = GPIOA_AFRL_AFRL1_Values<GPIOA::AFRL, 4, 4, ReadWriteMode, GPIOAAFRLBase> ;
     using AFRL0 = GPIOA_AFRL_AFRL0_Values<GPIOA::AFRL, 0, 4, ReadWriteMode, GPIOAAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOA_AFRL_AFRL0_Values<GPIOA::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOA
     using AFRH10 = GPIOA_AFRH_AFRH10_Values<GPIOA::AFRH, 8, 4, ReadWriteMode, GPIOAAFRHBase> ;
     using AFRH9 = GPIOA_AFRH_AFRH9_Values<GPIOA::AFRH, 4, 4, ReadWriteMode, GPIOAAFRHBase> ;
     using AFRH8 = GPIOA_AFRH_AFRH8_Values<GPIOA::AFRH, 0, 4, ReadWriteMode, GPIOAAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOA_AFRH_AFRH8_Values<GPIOA::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40020024, 32, ReadWriteMode, GPIOAAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOA::MODER, GPIOA::OTYPER, GPIOA::OSPEEDR, GPIOA::PUPDR, GPIOA::IDR, GPIOA::ODR, GPIOA::BSRR, GPIOA::LCKR, GPIOA::AFRL, GPIOA::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOAREGISTERS_HPP)
@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOD
 {
+  struct BSRR ;
+
   struct GPIODMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40020C00, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOD
     using MODER2 = GPIOD_MODER_MODER2_Values<GPIOD::MODER, 4, 2, ReadWriteMode, GPIODMODERBase> ;
     using MODER1 = GPIOD_MODER_MODER1_Values<GPIOD::MODER, 2, 2, ReadWriteMode, GPIODMODERBase> ;
     using MODER0 = GPIOD_MODER_MODER0_Values<GPIOD::MODER, 0, 2, ReadWriteMode, GPIODMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOD_MODER_MODER0_Values<GPIOD::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOD
     using OT2 = GPIOD_OTYPER_OT2_Values<GPIOD::OTYPER, 2, 1, ReadWriteMode, GPIODOTYPERBase> ;
     using OT1 = GPIOD_OTYPER_OT1_Values<GPIOD::OTYPER, 1, 1, ReadWriteMode, GPIODOTYPERBase> ;
     using OT0 = GPIOD_OTYPER_OT0_Values<GPIOD::OTYPER, 0, 1, ReadWriteMode, GPIODOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOD_OTYPER_OT0_Values<GPIOD::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOD
     using OSPEEDR2 = GPIOD_OSPEEDR_OSPEEDR2_Values<GPIOD::OSPEEDR, 4, 2, ReadWriteMode, GPIODOSPEEDRBase> ;
     using OSPEEDR1 = GPIOD_OSPEEDR_OSPEEDR1_Values<GPIOD::OSPEEDR, 2, 2, ReadWriteMode, GPIODOSPEEDRBase> ;
     using OSPEEDR0 = GPIOD_OSPEEDR_OSPEEDR0_Values<GPIOD::OSPEEDR, 0, 2, ReadWriteMode, GPIODOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOD_OSPEEDR_OSPEEDR0_Values<GPIOD::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOD
     using PUPDR2 = GPIOD_PUPDR_PUPDR2_Values<GPIOD::PUPDR, 4, 2, ReadWriteMode, GPIODPUPDRBase> ;
     using PUPDR1 = GPIOD_PUPDR_PUPDR1_Values<GPIOD::PUPDR, 2, 2, ReadWriteMode, GPIODPUPDRBase> ;
     using PUPDR0 = GPIOD_PUPDR_PUPDR0_Values<GPIOD::PUPDR, 0, 2, ReadWriteMode, GPIODPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOD_PUPDR_PUPDR0_Values<GPIOD::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOD
     using IDR2 = GPIOD_IDR_IDR2_Values<GPIOD::IDR, 2, 1, ReadMode, GPIODIDRBase> ;
     using IDR1 = GPIOD_IDR_IDR1_Values<GPIOD::IDR, 1, 1, ReadMode, GPIODIDRBase> ;
     using IDR0 = GPIOD_IDR_IDR0_Values<GPIOD::IDR, 0, 1, ReadMode, GPIODIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOD_IDR_IDR0_Values<GPIOD::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOD
     using ODR2 = GPIOD_ODR_ODR2_Values<GPIOD::ODR, 2, 1, ReadWriteMode, GPIODODRBase> ;
     using ODR1 = GPIOD_ODR_ODR1_Values<GPIOD::ODR, 1, 1, ReadWriteMode, GPIODODRBase> ;
     using ODR0 = GPIOD_ODR_ODR0_Values<GPIOD::ODR, 0, 1, ReadWriteMode, GPIODODRBase> ;
+    using SetResetRegister = GPIOD::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOD_ODR_ODR0_Values<GPIOD::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOD
     using BS2 = GPIOD_BSRR_BS2_Values<GPIOD::BSRR, 2, 1, WriteMode, GPIODBSRRBase> ;
     using BS1 = GPIOD_BSRR_BS1_Values<GPIOD::BSRR, 1, 1, WriteMode, GPIODBSRRBase> ;
     using BS0 = GPIOD_BSRR_BS0_Values<GPIOD::BSRR, 0, 1, WriteMode, GPIODBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOD_BSRR_BS0_Values<GPIOD::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOD
     using LCK2 = GPIOD_LCKR_LCK2_Values<GPIOD::LCKR, 2, 1, ReadWriteMode, GPIODLCKRBase> ;
     using LCK1 = GPIOD_LCKR_LCK1_Values<GPIOD::LCKR, 1, 1, ReadWriteMode, GPIODLCKRBase> ;
     using LCK0 = GPIOD_LCKR_LCK0_Values<GPIOD::LCKR, 0, 1, ReadWriteMode, GPIODLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOD_LCKR_LCK0_Values<GPIOD::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOD
     using AFRL2 = GPIOD_AFRL_AFRL2_Values<GPIOD::AFRL, 8, 4, ReadWriteMode, GPIODAFRLBase> ;
     using AFRL1 = GPIOD_AFRL_AFRL1_Values<GPIOD::AFRL, 4, 4, ReadWriteMode, GPIODAFRLBase> ;
     using AFRL0 = GPIOD_AFRL_AFRL0_Values<GPIOD::AFRL, 0, 4, ReadWriteMode, GPIODAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOD_AFRL_AFRL0_Values<GPIOD::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOD
     using AFRH10 = GPIOD_AFRH_AFRH10_Values<GPIOD::AFRH, 8, 4, ReadWriteMode, GPIODAFRHBase> ;
     using AFRH9 = GPIOD_AFRH_AFRH9_Values<GPIOD::AFRH, 4, 4, ReadWriteMode, GPIODAFRHBase> ;
     using AFRH8 = GPIOD_AFRH_AFRH8_Values<GPIOD::AFRH, 0, 4, ReadWriteMode, GPIODAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOD_AFRH_AFRH8_Values<GPIOD::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40020C24, 32, ReadWriteMode, GPIODAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOD::MODER, GPIOD::OTYPER, GPIOD::OSPEEDR, GPIOD::PUPDR, GPIOD::IDR, GPIOD::ODR, GPIOD::BSRR, GPIOD::LCKR, GPIOD::AFRL, GPIOD::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIODREGISTERS_HPP)
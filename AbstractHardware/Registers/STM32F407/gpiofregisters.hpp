@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOF
 {
+  struct BSRR ;
+
   struct GPIOFMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40021400, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOF
     using MODER2 = GPIOF_MODER_MODER2_Values<GPIOF::MODER, 4, 2, ReadWriteMode, GPIOFMODERBase> ;
     using MODER1 = GPIOF_MODER_MODER1_Values<GPIOF::MODER, 2, 2, ReadWriteMode, GPIOFMODERBase> ;
     using MODER0 = GPIOF_MODER_MODER0_Values<GPIOF::MODER, 0, 2, ReadWriteMode, GPIOFMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOF_MODER_MODER0_Values<GPIOF::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOF
     using OT2 = GPIOF_OTYPER_OT2_Values<GPIOF::OTYPER, 2, 1, ReadWriteMode, GPIOFOTYPERBase> ;
     using OT1 = GPIOF_OTYPER_OT1_Values<GPIOF::OTYPER, 1, 1, ReadWriteMode, GPIOFOTYPERBase> ;
     using OT0 = GPIOF_OTYPER_OT0_Values<GPIOF::OTYPER, 0, 1, ReadWriteMode, GPIOFOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOF_OTYPER_OT0_Values<GPIOF::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOF
     using OSPEEDR2 = GPIOF_OSPEEDR_OSPEEDR2_Values<GPIOF::OSPEEDR, 4, 2, ReadWriteMode, GPIOFOSPEEDRBase> ;
     using OSPEEDR1 = GPIOF_OSPEEDR_OSPEEDR1_Values<GPIOF::OSPEEDR, 2, 2, ReadWriteMode, GPIOFOSPEEDRBase> ;
     using OSPEEDR0 = GPIOF_OSPEEDR_OSPEEDR0_Values<GPIOF::OSPEEDR, 0, 2, ReadWriteMode, GPIOFOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOF_OSPEEDR_OSPEEDR0_Values<GPIOF::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOF
     using PUPDR2 = GPIOF_PUPDR_PUPDR2_Values<GPIOF::PUPDR, 4, 2, ReadWriteMode, GPIOFPUPDRBase> ;
     using PUPDR1 = GPIOF_PUPDR_PUPDR1_Values<GPIOF::PUPDR, 2, 2, ReadWriteMode, GPIOFPUPDRBase> ;
     using PUPDR0 = GPIOF_PUPDR_PUPDR0_Values<GPIOF::PUPDR, 0, 2, ReadWriteMode, GPIOFPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOF_PUPDR_PUPDR0_Values<GPIOF::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOF
     using IDR2 = GPIOF_IDR_IDR2_Values<GPIOF::IDR, 2, 1, ReadMode, GPIOFIDRBase> ;
     using IDR1 = GPIOF_IDR_IDR1_Values<GPIOF::IDR, 1, 1, ReadMode, GPIOFIDRBase> ;
     using IDR0 = GPIOF_IDR_IDR0_Values<GPIOF::IDR, 0, 1, ReadMode, GPIOFIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOF_IDR_IDR0_Values<GPIOF::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOF
     using ODR2 = GPIOF_ODR_ODR2_Values<GPIOF::ODR, 2, 1, ReadWriteMode, GPIOFODRBase> ;
     using ODR1 = GPIOF_ODR_ODR1_Values<GPIOF::ODR, 1, 1, ReadWriteMode, GPIOFODRBase> ;
     using ODR0 = GPIOF_ODR_ODR0_Values<GPIOF::ODR, 0, 1, ReadWriteMode, GPIOFODRBase> ;
+    using SetResetRegister = GPIOF::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOF_ODR_ODR0_Values<GPIOF::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOF
     using BS2 = GPIOF_BSRR_BS2_Values<GPIOF::BSRR, 2, 1, WriteMode, GPIOFBSRRBase> ;
     using BS1 = GPIOF_BSRR_BS1_Values<GPIOF::BSRR, 1, 1, WriteMode, GPIOFBSRRBase> ;
     using BS0 = GPIOF_BSRR_BS0_Values<GPIOF::BSRR, 0, 1, WriteMode, GPIOFBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOF_BSRR_BS0_Values<GPIOF::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOF
     using LCK2 = GPIOF_LCKR_LCK2_Values<GPIOF::LCKR, 2, 1, ReadWriteMode, GPIOFLCKRBase> ;
     using LCK1 = GPIOF_LCKR_LCK1_Values<GPIOF::LCKR, 1, 1, ReadWriteMode, GPIOFLCKRBase> ;
     using LCK0 = GPIOF_LCKR_LCK0_Values<GPIOF::LCKR, 0, 1, ReadWriteMode, GPIOFLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOF_LCKR_LCK0_Values<GPIOF::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOF
     using AFRL2 = GPIOF_AFRL_AFRL2_Values<GPIOF::AFRL, 8, 4, ReadWriteMode, GPIOFAFRLBase> ;
     using AFRL1 = GPIOF_AFRL_AFRL1_Values<GPIOF::AFRL, 4, 4, ReadWriteMode, GPIOFAFRLBase> ;
     using AFRL0 = GPIOF_AFRL_AFRL0_Values<GPIOF::AFRL, 0, 4, ReadWriteMode, GPIOFAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOF_AFRL_AFRL0_Values<GPIOF::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOF
     using AFRH10 = GPIOF_AFRH_AFRH10_Values<GPIOF::AFRH, 8, 4, ReadWriteMode, GPIOFAFRHBase> ;
     using AFRH9 = GPIOF_AFRH_AFRH9_Values<GPIOF::AFRH, 4, 4, ReadWriteMode, GPIOFAFRHBase> ;
     using AFRH8 = GPIOF_AFRH_AFRH8_Values<GPIOF::AFRH, 0, 4, ReadWriteMode, GPIOFAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOF_AFRH_AFRH8_Values<GPIOF::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40021424, 32, ReadWriteMode, GPIOFAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOF::MODER, GPIOF::OTYPER, GPIOF::OSPEEDR, GPIOF::PUPDR, GPIOF::IDR, GPIOF::ODR, GPIOF::BSRR, GPIOF::LCKR, GPIOF::AFRL, GPIOF::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOFREGISTERS_HPP)
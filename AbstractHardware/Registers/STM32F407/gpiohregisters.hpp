@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOH
 {
+  struct BSRR ;
+
   struct GPIOHMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40021C00, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOH
     using MODER2 = GPIOH_MODER_MODER2_Values<GPIOH::MODER, 4, 2, ReadWriteMode, GPIOHMODERBase> ;
     using MODER1 = GPIOH_MODER_MODER1_Values<GPIOH::MODER, 2, 2, ReadWriteMode, GPIOHMODERBase> ;
     using MODER0 = GPIOH_MODER_MODER0_Values<GPIOH::MODER, 0, 2, ReadWriteMode, GPIOHMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOH_MODER_MODER0_Values<GPIOH::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOH
     using OT2 = GPIOH_OTYPER_OT2_Values<GPIOH::OTYPER, 2, 1, ReadWriteMode, GPIOHOTYPERBase> ;
     using OT1 = GPIOH_OTYPER_OT1_Values<GPIOH::OTYPER, 1, 1, ReadWriteMode, GPIOHOTYPERBase> ;
     using OT0 = GPIOH_OTYPER_OT0_Values<GPIOH::OTYPER, 0, 1, ReadWriteMode, GPIOHOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOH_OTYPER_OT0_Values<GPIOH::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOH
     using OSPEEDR2 = GPIOH_OSPEEDR_OSPEEDR2_Values<GPIOH::OSPEEDR, 4, 2, ReadWriteMode, GPIOHOSPEEDRBase> ;
     using OSPEEDR1 = GPIOH_OSPEEDR_OSPEEDR1_Values<GPIOH::OSPEEDR, 2, 2, ReadWriteMode, GPIOHOSPEEDRBase> ;
     using OSPEEDR0 = GPIOH_OSPEEDR_OSPEEDR0_Values<GPIOH::OSPEEDR, 0, 2, ReadWriteMode, GPIOHOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOH_OSPEEDR_OSPEEDR0_Values<GPIOH::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOH
     using PUPDR2 = GPIOH_PUPDR_PUPDR2_Values<GPIOH::PUPDR, 4, 2, ReadWriteMode, GPIOHPUPDRBase> ;
     using PUPDR1 = GPIOH_PUPDR_PUPDR1_Values<GPIOH::PUPDR, 2, 2, ReadWriteMode, GPIOHPUPDRBase> ;
     using PUPDR0 = GPIOH_PUPDR_PUPDR0_Values<GPIOH::PUPDR, 0, 2, ReadWriteMode, GPIOHPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOH_PUPDR_PUPDR0_Values<GPIOH::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOH
     using IDR2 = GPIOH_IDR_IDR2_Values<GPIOH::IDR, 2, 1, ReadMode, GPIOHIDRBase> ;
     using IDR1 = GPIOH_IDR_IDR1_Values<GPIOH::IDR, 1, 1, ReadMode, GPIOHIDRBase> ;
     using IDR0 = GPIOH_IDR_IDR0_Values<GPIOH::IDR, 0, 1, ReadMode, GPIOHIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOH_IDR_IDR0_Values<GPIOH::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOH
     using ODR2 = GPIOH_ODR_ODR2_Values<GPIOH::ODR, 2, 1, ReadWriteMode, GPIOHODRBase> ;
     using ODR1 = GPIOH_ODR_ODR1_Values<GPIOH::ODR, 1, 1, ReadWriteMode, GPIOHODRBase> ;
     using ODR0 = GPIOH_ODR_ODR0_Values<GPIOH::ODR, 0, 1, ReadWriteMode, GPIOHODRBase> ;
+    using SetResetRegister = GPIOH::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOH_ODR_ODR0_Values<GPIOH::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOH
     using BS2 = GPIOH_BSRR_BS2_Values<GPIOH::BSRR, 2, 1, WriteMode, GPIOHBSRRBase> ;
     using BS1 = GPIOH_BSRR_BS1_Values<GPIOH::BSRR, 1, 1, WriteMode, GPIOHBSRRBase> ;
     using BS0 = GPIOH_BSRR_BS0_Values<GPIOH::BSRR, 0, 1, WriteMode, GPIOHBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOH_BSRR_BS0_Values<GPIOH::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOH
     using LCK2 = GPIOH_LCKR_LCK2_Values<GPIOH::LCKR, 2, 1, ReadWriteMode, GPIOHLCKRBase> ;
     using LCK1 = GPIOH_LCKR_LCK1_Values<GPIOH::LCKR, 1, 1, ReadWriteMode, GPIOHLCKRBase> ;
     using LCK0 = GPIOH_LCKR_LCK0_Values<GPIOH::LCKR, 0, 1, ReadWriteMode, GPIOHLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOH_LCKR_LCK0_Values<GPIOH::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOH
     using AFRL2 = GPIOH_AFRL_AFRL2_Values<GPIOH::AFRL, 8, 4, ReadWriteMode, GPIOHAFRLBase> ;
     using AFRL1 = GPIOH_AFRL_AFRL1_Values<GPIOH::AFRL, 4, 4, ReadWriteMode, GPIOHAFRLBase> ;
     using AFRL0 = GPIOH_AFRL_AFRL0_Values<GPIOH::AFRL, 0, 4, ReadWriteMode, GPIOHAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOH_AFRL_AFRL0_Values<GPIOH::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOH
     using AFRH10 = GPIOH_AFRH_AFRH10_Values<GPIOH::AFRH, 8, 4, ReadWriteMode, GPIOHAFRHBase> ;
     using AFRH9 = GPIOH_AFRH_AFRH9_Values<GPIOH::AFRH, 4, 4, ReadWriteMode, GPIOHAFRHBase> ;
     using AFRH8 = GPIOH_AFRH_AFRH8_Values<GPIOH::AFRH, 0, 4, ReadWriteMode, GPIOHAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOH_AFRH_AFRH8_Values<GPIOH::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40021C24, 32, ReadWriteMode, GPIOHAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOH::MODER, GPIOH::OTYPER, GPIOH::OSPEEDR, GPIOH::PUPDR, GPIOH::IDR, GPIOH::ODR, GPIOH::BSRR, GPIOH::LCKR, GPIOH::AFRL, GPIOH::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOHREGISTERS_HPP)
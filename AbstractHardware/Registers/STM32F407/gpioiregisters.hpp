@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOI
 {
+  struct BSRR ;
+
   struct GPIOIMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40022000, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOI
     using MODER2 = GPIOI_MODER_MODER2_Values<GPIOI::MODER, 4, 2, ReadWriteMode, GPIOIMODERBase> ;
     using MODER1 = GPIOI_MODER_MODER1_Values<GPIOI::MODER, 2, 2, ReadWriteMode, GPIOIMODERBase> ;
     using MODER0 = GPIOI_MODER_MODER0_Values<GPIOI::MODER, 0, 2, ReadWriteMode, GPIOIMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOI_MODER_MODER0_Values<GPIOI::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOI
     using OT2 = GPIOI_OTYPER_OT2_Values<GPIOI::OTYPER, 2, 1, ReadWriteMode, GPIOIOTYPERBase> ;
     using OT1 = GPIOI_OTYPER_OT1_Values<GPIOI::OTYPER, 1, 1, ReadWriteMode, GPIOIOTYPERBase> ;
     using OT0 = GPIOI_OTYPER_OT0_Values<GPIOI::OTYPER, 0, 1, ReadWriteMode, GPIOIOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOI_OTYPER_OT0_Values<GPIOI::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOI
     using OSPEEDR2 = GPIOI_OSPEEDR_OSPEEDR2_Values<GPIOI::OSPEEDR, 4, 2, ReadWriteMode, GPIOIOSPEEDRBase> ;
     using OSPEEDR1 = GPIOI_OSPEEDR_OSPEEDR1_Values<GPIOI::OSPEEDR, 2, 2, ReadWriteMode, GPIOIOSPEEDRBase> ;
     using OSPEEDR0 = GPIOI_OSPEEDR_OSPEEDR0_Values<GPIOI::OSPEEDR, 0, 2, ReadWriteMode, GPIOIOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOI_OSPEEDR_OSPEEDR0_Values<GPIOI::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOI
     using PUPDR2 = GPIOI_PUPDR_PUPDR2_Values<GPIOI::PUPDR, 4, 2, ReadWriteMode, GPIOIPUPDRBase> ;
     using PUPDR1 = GPIOI_PUPDR_PUPDR1_Values<GPIOI::PUPDR, 2, 2, ReadWriteMode, GPIOIPUPDRBase> ;
     using PUPDR0 = GPIOI_PUPDR_PUPDR0_Values<GPIOI::PUPDR, 0, 2, ReadWriteMode, GPIOIPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOI_PUPDR_PUPDR0_Values<GPIOI::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOI
     using IDR2 = GPIOI_IDR_IDR2_Values<GPIOI::IDR, 2, 1, ReadMode, GPIOIIDRBase> ;
     using IDR1 = GPIOI_IDR_IDR1_Values<GPIOI::IDR, 1, 1, ReadMode, GPIOIIDRBase> ;
     using IDR0 = GPIOI_IDR_IDR0_Values<GPIOI::IDR, 0, 1, ReadMode, GPIOIIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOI_IDR_IDR0_Values<GPIOI::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOI
     using ODR2 = GPIOI_ODR_ODR2_Values<GPIOI::ODR, 2, 1, ReadWriteMode, GPIOIODRBase> ;
     using ODR1 = GPIOI_ODR_ODR1_Values<GPIOI::ODR, 1, 1, ReadWriteMode, GPIOIODRBase> ;
     using ODR0 = GPIOI_ODR_ODR0_Values<GPIOI::ODR, 0, 1, ReadWriteMode, GPIOIODRBase> ;
+    using SetResetRegister = GPIOI::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOI_ODR_ODR0_Values<GPIOI::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOI
     using BS2 = GPIOI_BSRR_BS2_Values<GPIOI::BSRR, 2, 1, WriteMode, GPIOIBSRRBase> ;
     using BS1 = GPIOI_BSRR_BS1_Values<GPIOI::BSRR, 1, 1, WriteMode, GPIOIBSRRBase> ;
     using BS0 = GPIOI_BSRR_BS0_Values<GPIOI::BSRR, 0, 1, WriteMode, GPIOIBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOI_BSRR_BS0_Values<GPIOI::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOI
     using LCK2 = GPIOI_LCKR_LCK2_Values<GPIOI::LCKR, 2, 1, ReadWriteMode, GPIOILCKRBase> ;
     using LCK1 = GPIOI_LCKR_LCK1_Values<GPIOI::LCKR, 1, 1, ReadWriteMode, GPIOILCKRBase> ;
     using LCK0 = GPIOI_LCKR_LCK0_Values<GPIOI::LCKR, 0, 1, ReadWriteMode, GPIOILCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOI_LCKR_LCK0_Values<GPIOI::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOI
     using AFRL2 = GPIOI_AFRL_AFRL2_Values<GPIOI::AFRL, 8, 4, ReadWriteMode, GPIOIAFRLBase> ;
     using AFRL1 = GPIOI_AFRL_AFRL1_Values<GPIOI::AFRL, 4, 4, ReadWriteMode, GPIOIAFRLBase> ;
     using AFRL0 = GPIOI_AFRL_AFRL0_Values<GPIOI::AFRL, 0, 4, ReadWriteMode, GPIOIAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOI_AFRL_AFRL0_Values<GPIOI::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOI
     using AFRH10 = GPIOI_AFRH_AFRH10_Values<GPIOI::AFRH, 8, 4, ReadWriteMode, GPIOIAFRHBase> ;
     using AFRH9 = GPIOI_AFRH_AFRH9_Values<GPIOI::AFRH, 4, 4, ReadWriteMode, GPIOIAFRHBase> ;
     using AFRH8 = GPIOI_AFRH_AFRH8_Values<GPIOI::AFRH, 0, 4, ReadWriteMode, GPIOIAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOI_AFRH_AFRH8_Values<GPIOI::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40022024, 32, ReadWriteMode, GPIOIAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOI::MODER, GPIOI::OTYPER, GPIOI::OSPEEDR, GPIOI::PUPDR, GPIOI::IDR, GPIOI::ODR, GPIOI::BSRR, GPIOI::LCKR, GPIOI::AFRL, GPIOI::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOIREGISTERS_HPP)
@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOJ
 {
+  struct BSRR ;
+
   struct GPIOJMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40022400, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOJ
     using MODER2 = GPIOJ_MODER_MODER2_Values<GPIOJ::MODER, 4, 2, ReadWriteMode, GPIOJMODERBase> ;
     using MODER1 = GPIOJ_MODER_MODER1_Values<GPIOJ::MODER, 2, 2, ReadWriteMode, GPIOJMODERBase> ;
     using MODER0 = GPIOJ_MODER_MODER0_Values<GPIOJ::MODER, 0, 2, ReadWriteMode, GPIOJMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOJ_MODER_MODER0_Values<GPIOJ::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOJ
     using OT2 = GPIOJ_OTYPER_OT2_Values<GPIOJ::OTYPER, 2, 1, ReadWriteMode, GPIOJOTYPERBase> ;
     using OT1 = GPIOJ_OTYPER_OT1_Values<GPIOJ::OTYPER, 1, 1, ReadWriteMode, GPIOJOTYPERBase> ;
     using OT0 = GPIOJ_OTYPER_OT0_Values<GPIOJ::OTYPER, 0, 1, ReadWriteMode, GPIOJOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOJ_OTYPER_OT0_Values<GPIOJ::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOJ
     using OSPEEDR2 = GPIOJ_OSPEEDR_OSPEEDR2_Values<GPIOJ::OSPEEDR, 4, 2, ReadWriteMode, GPIOJOSPEEDRBase> ;
     using OSPEEDR1 = GPIOJ_OSPEEDR_OSPEEDR1_Values<GPIOJ::OSPEEDR, 2, 2, ReadWriteMode, GPIOJOSPEEDRBase> ;
     using OSPEEDR0 = GPIOJ_OSPEEDR_OSPEEDR0_Values<GPIOJ::OSPEEDR, 0, 2, ReadWriteMode, GPIOJOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOJ_OSPEEDR_OSPEEDR0_Values<GPIOJ::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOJ
     using PUPDR2 = GPIOJ_PUPDR_PUPDR2_Values<GPIOJ::PUPDR, 4, 2, ReadWriteMode, GPIOJPUPDRBase> ;
     using PUPDR1 = GPIOJ_PUPDR_PUPDR1_Values<GPIOJ::PUPDR, 2, 2, ReadWriteMode, GPIOJPUPDRBase> ;
     using PUPDR0 = GPIOJ_PUPDR_PUPDR0_Values<GPIOJ::PUPDR, 0, 2, ReadWriteMode, GPIOJPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOJ_PUPDR_PUPDR0_Values<GPIOJ::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOJ
     using IDR2 = GPIOJ_IDR_IDR2_Values<GPIOJ::IDR, 2, 1, ReadMode, GPIOJIDRBase> ;
     using IDR1 = GPIOJ_IDR_IDR1_Values<GPIOJ::IDR, 1, 1, ReadMode, GPIOJIDRBase> ;
     using IDR0 = GPIOJ_IDR_IDR0_Values<GPIOJ::IDR, 0, 1, ReadMode, GPIOJIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOJ_IDR_IDR0_Values<GPIOJ::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOJ
     using ODR2 = GPIOJ_ODR_ODR2_Values<GPIOJ::ODR, 2, 1, ReadWriteMode, GPIOJODRBase> ;
     using ODR1 = GPIOJ_ODR_ODR1_Values<GPIOJ::ODR, 1, 1, ReadWriteMode, GPIOJODRBase> ;
     using ODR0 = GPIOJ_ODR_ODR0_Values<GPIOJ::ODR, 0, 1, ReadWriteMode, GPIOJODRBase> ;
+    using SetResetRegister = GPIOJ::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOJ_ODR_ODR0_Values<GPIOJ::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOJ
     using BS2 = GPIOJ_BSRR_BS2_Values<GPIOJ::BSRR, 2, 1, WriteMode, GPIOJBSRRBase> ;
     using BS1 = GPIOJ_BSRR_BS1_Values<GPIOJ::BSRR, 1, 1, WriteMode, GPIOJBSRRBase> ;
     using BS0 = GPIOJ_BSRR_BS0_Values<GPIOJ::BSRR, 0, 1, WriteMode, GPIOJBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOJ_BSRR_BS0_Values<GPIOJ::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOJ
     using LCK2 = GPIOJ_LCKR_LCK2_Values<GPIOJ::LCKR, 2, 1, ReadWriteMode, GPIOJLCKRBase> ;
     using LCK1 = GPIOJ_LCKR_LCK1_Values<GPIOJ::LCKR, 1, 1, ReadWriteMode, GPIOJLCKRBase> ;
     using LCK0 = GPIOJ_LCKR_LCK0_Values<GPIOJ::LCKR, 0, 1, ReadWriteMode, GPIOJLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOJ_LCKR_LCK0_Values<GPIOJ::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOJ
     using AFRL2 = GPIOJ_AFRL_AFRL2_Values<GPIOJ::AFRL, 8, 4, ReadWriteMode, GPIOJAFRLBase> ;
     using AFRL1 = GPIOJ_AFRL_AFRL1_Values<GPIOJ::AFRL, 4, 4, ReadWriteMode, GPIOJAFRLBase> ;
     using AFRL0 = GPIOJ_AFRL_AFRL0_Values<GPIOJ::AFRL, 0, 4, ReadWriteMode, GPIOJAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOJ_AFRL_AFRL0_Values<GPIOJ::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOJ
     using AFRH10 = GPIOJ_AFRH_AFRH10_Values<GPIOJ::AFRH, 8, 4, ReadWriteMode, GPIOJAFRHBase> ;
     using AFRH9 = GPIOJ_AFRH_AFRH9_Values<GPIOJ::AFRH, 4, 4, ReadWriteMode, GPIOJAFRHBase> ;
     using AFRH8 = GPIOJ_AFRH_AFRH8_Values<GPIOJ::AFRH, 0, 4, ReadWriteMode, GPIOJAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOJ_AFRH_AFRH8_Values<GPIOJ::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40022424, 32, ReadWriteMode, GPIOJAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOJ::MODER, GPIOJ::OTYPER, GPIOJ::OSPEEDR, GPIOJ::PUPDR, GPIOJ::IDR, GPIOJ::ODR, GPIOJ::BSRR, GPIOJ::LCKR, GPIOJ::AFRL, GPIOJ::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOJREGISTERS_HPP)
@@ -14,9 +14,12 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOK
 {
+  struct BSRR ;
+
   struct GPIOKMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40022800, 32, ReadWriteMode>
@@ -37,6 +40,10 @@ struct GPIOK
     using MODER2 = GPIOK_MODER_MODER2_Values<GPIOK::MODER, 4, 2, ReadWriteMode, GPIOKMODERBase> ;
     using MODER1 = GPIOK_MODER_MODER1_Values<GPIOK::MODER, 2, 2, ReadWriteMode, GPIOKMODERBase> ;
     using MODER0 = GPIOK_MODER_MODER0_Values<GPIOK::MODER, 0, 2, ReadWriteMode, GPIOKMODERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
     using FieldValues = GPIOK_MODER_MODER0_Values<GPIOK::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +70,10 @@ struct GPIOK
     using OT2 = GPIOK_OTYPER_OT2_Values<GPIOK::OTYPER, 2, 1, ReadWriteMode, GPIOKOTYPERBase> ;
     using OT1 = GPIOK_OTYPER_OT1_Values<GPIOK::OTYPER, 1, 1, ReadWriteMode, GPIOKOTYPERBase> ;
     using OT0 = GPIOK_OTYPER_OT0_Values<GPIOK::OTYPER, 0, 1, ReadWriteMode, GPIOKOTYPERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
     using FieldValues = GPIOK_OTYPER_OT0_Values<GPIOK::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +100,10 @@ struct GPIOK
     using OSPEEDR2 = GPIOK_OSPEEDR_OSPEEDR2_Values<GPIOK::OSPEEDR, 4, 2, ReadWriteMode, GPIOKOSPEEDRBase> ;
     using OSPEEDR1 = GPIOK_OSPEEDR_OSPEEDR1_Values<GPIOK::OSPEEDR, 2, 2, ReadWriteMode, GPIOKOSPEEDRBase> ;
     using OSPEEDR0 = GPIOK_OSPEEDR_OSPEEDR0_Values<GPIOK::OSPEEDR, 0, 2, ReadWriteMode, GPIOKOSPEEDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
     using FieldValues = GPIOK_OSPEEDR_OSPEEDR0_Values<GPIOK::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +130,10 @@ struct GPIOK
     using PUPDR2 = GPIOK_PUPDR_PUPDR2_Values<GPIOK::PUPDR, 4, 2, ReadWriteMode, GPIOKPUPDRBase> ;
     using PUPDR1 = GPIOK_PUPDR_PUPDR1_Values<GPIOK::PUPDR, 2, 2, ReadWriteMode, GPIOKPUPDRBase> ;
     using PUPDR0 = GPIOK_PUPDR_PUPDR0_Values<GPIOK::PUPDR, 0, 2, ReadWriteMode, GPIOKPUPDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
     using FieldValues = GPIOK_PUPDR_PUPDR0_Values<GPIOK::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +160,9 @@ struct GPIOK
     using IDR2 = GPIOK_IDR_IDR2_Values<GPIOK::IDR, 2, 1, ReadMode, GPIOKIDRBase> ;
     using IDR1 = GPIOK_IDR_IDR1_Values<GPIOK::IDR, 1, 1, ReadMode, GPIOKIDRBase> ;
     using IDR0 = GPIOK_IDR_IDR0_Values<GPIOK::IDR, 0, 1, ReadMode, GPIOKIDRBase> ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
     using FieldValues = GPIOK_IDR_IDR0_Values<GPIOK::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +189,12 @@ struct GPIOK
     using ODR2 = GPIOK_ODR_ODR2_Values<GPIOK::ODR, 2, 1, ReadWriteMode, GPIOKODRBase> ;
     using ODR1 = GPIOK_ODR_ODR1_Values<GPIOK::ODR, 1, 1, ReadWriteMode, GPIOKODRBase> ;
     using ODR0 = GPIOK_ODR_ODR0_Values<GPIOK::ODR, 0, 1, ReadWriteMode, GPIOKODRBase> ;
+    using SetResetRegister = GPIOK::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
     using FieldValues = GPIOK_ODR_ODR0_Values<GPIOK::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +237,8 @@ struct GPIOK
     using BS2 = GPIOK_BSRR_BS2_Values<GPIOK::BSRR, 2, 1, WriteMode, GPIOKBSRRBase> ;
     using BS1 = GPIOK_BSRR_BS1_Values<GPIOK::BSRR, 1, 1, WriteMode, GPIOKBSRRBase> ;
     using BS0 = GPIOK_BSRR_BS0_Values<GPIOK::BSRR, 0, 1, WriteMode, GPIOKBSRRBase> ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
     using FieldValues = GPIOK_BSRR_BS0_Values<GPIOK::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +266,10 @@ struct GPIOK
     using LCK2 = GPIOK_LCKR_LCK2_Values<GPIOK::LCKR, 2, 1, ReadWriteMode, GPIOKLCKRBase> ;
     using LCK1 = GPIOK_LCKR_LCK1_Values<GPIOK::LCKR, 1, 1, ReadWriteMode, GPIOKLCKRBase> ;
     using LCK0 = GPIOK_LCKR_LCK0_Values<GPIOK::LCKR, 0, 1, ReadWriteMode, GPIOKLCKRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFU ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
     using FieldValues = GPIOK_LCKR_LCK0_Values<GPIOK::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +288,10 @@ struct GPIOK
     using AFRL2 = GPIOK_AFRL_AFRL2_Values<GPIOK::AFRL, 8, 4, ReadWriteMode, GPIOKAFRLBase> ;
     using AFRL1 = GPIOK_AFRL_AFRL1_Values<GPIOK::AFRL, 4, 4, ReadWriteMode, GPIOKAFRLBase> ;
     using AFRL0 = GPIOK_AFRL_AFRL0_Values<GPIOK::AFRL, 0, 4, ReadWriteMode, GPIOKAFRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
     using FieldValues = GPIOK_AFRL_AFRL0_Values<GPIOK::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +310,17 @@ struct GPIOK
     using AFRH10 = GPIOK_AFRH_AFRH10_Values<GPIOK::AFRH, 8, 4, ReadWriteMode, GPIOKAFRHBase> ;
     using AFRH9 = GPIOK_AFRH_AFRH9_Values<GPIOK::AFRH, 4, 4, ReadWriteMode, GPIOKAFRHBase> ;
     using AFRH8 = GPIOK_AFRH_AFRH8_Values<GPIOK::AFRH, 0, 4, ReadWriteMode, GPIOKAFRHBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
     using FieldValues = GPIOK_AFRH_AFRH8_Values<GPIOK::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40022824, 32, ReadWriteMode, GPIOKAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOK::MODER, GPIOK::OTYPER, GPIOK::OSPEEDR, GPIOK::PUPDR, GPIOK::IDR, GPIOK::ODR, GPIOK::BSRR, GPIOK::LCKR, GPIOK::AFRL, GPIOK::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOKREGISTERS_HPP)
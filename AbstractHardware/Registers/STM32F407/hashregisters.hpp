@@ -31,6 +31,7 @@ struct HASH
     using MDMAT = HASH_CR_MDMAT_Values<HASH::CR, 13, 1, ReadWriteMode, HASHCRBase> ;
     using LKEY = HASH_CR_LKEY_Values<HASH::CR, 16, 1, ReadWriteMode, HASHCRBase> ;
     using ALGO1 = HASH_CR_ALGO1_Values<HASH::CR, 18, 1, ReadWriteMode, HASHCRBase> ;
+    static constexpr Type SnapshotMask = 0x520FCU ;
     using FieldValues = HASH_CR_ALGO1_Values<HASH::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +43,7 @@ struct HASH
   struct DIN : public RegisterBase<0x50060404, 32, ReadWriteMode>
   {
     using DATAIN = HASH_DIN_DATAIN_Values<HASH::DIN, 0, 32, ReadWriteMode, HASHDINBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_DIN_DATAIN_Values<HASH::DIN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +56,7 @@ struct HASH
   {
     using DCAL = HASH_STR_DCAL_Values<HASH::STR, 8, 1, WriteMode, HASHSTRBase> ;
     using NBLW = HASH_STR_NBLW_Values<HASH::STR, 0, 5, ReadWriteMode, HASHSTRBase> ;
+    static constexpr Type SnapshotMask = 0x11FU ;
     using FieldValues = HASH_STR_NBLW_Values<HASH::STR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +124,7 @@ struct HASH
   {
     using DCIE = HASH_IMR_DCIE_Values<HASH::IMR, 1, 1, ReadWriteMode, HASHIMRBase> ;
     using DINIE = HASH_IMR_DINIE_Values<HASH::IMR, 0, 1, ReadWriteMode, HASHIMRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = HASH_IMR_DINIE_Values<HASH::IMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +139,7 @@ struct HASH
     using DMAS = HASH_SR_DMAS_Values<HASH::SR, 2, 1, ReadMode, HASHSRBase> ;
     using DCIS = HASH_SR_DCIS_Values<HASH::SR, 1, 1, ReadWriteMode, HASHSRBase> ;
     using DINIS = HASH_SR_DINIS_Values<HASH::SR, 0, 1, ReadWriteMode, HASHSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = HASH_SR_DINIS_Values<HASH::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +151,7 @@ struct HASH
   struct CSR0 : public RegisterBase<0x500604F8, 32, ReadWriteMode>
   {
     using CSR0Field = HASH_CSR0_CSR0_Values<HASH::CSR0, 0, 32, ReadWriteMode, HASHCSR0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR0_CSR0_Values<HASH::CSR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +163,7 @@ struct HASH
   struct CSR1 : public RegisterBase<0x500604FC, 32, ReadWriteMode>
   {
     using CSR1Field = HASH_CSR1_CSR1_Values<HASH::CSR1, 0, 32, ReadWriteMode, HASHCSR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR1_CSR1_Values<HASH::CSR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -168,6 +175,7 @@ struct HASH
   struct CSR2 : public RegisterBase<0x50060500, 32, ReadWriteMode>
   {
     using CSR2Field = HASH_CSR2_CSR2_Values<HASH::CSR2, 0, 32, ReadWriteMode, HASHCSR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR2_CSR2_Values<HASH::CSR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -179,6 +187,7 @@ struct HASH
   struct CSR3 : public RegisterBase<0x50060504, 32, ReadWriteMode>
   {
     using CSR3Field = HASH_CSR3_CSR3_Values<HASH::CSR3, 0, 32, ReadWriteMode, HASHCSR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR3_CSR3_Values<HASH::CSR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -190,6 +199,7 @@ struct HASH
   struct CSR4 : public RegisterBase<0x50060508, 32, ReadWriteMode>
   {
     using CSR4Field = HASH_CSR4_CSR4_Values<HASH::CSR4, 0, 32, ReadWriteMode, HASHCSR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR4_CSR4_Values<HASH::CSR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -201,6 +211,7 @@ struct HASH
   struct CSR5 : public RegisterBase<0x5006050C, 32, ReadWriteMode>
   {
     using CSR5Field = HASH_CSR5_CSR5_Values<HASH::CSR5, 0, 32, ReadWriteMode, HASHCSR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR5_CSR5_Values<HASH::CSR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -212,6 +223,7 @@ struct HASH
   struct CSR6 : public RegisterBase<0x50060510, 32, ReadWriteMode>
   {
     using CSR6Field = HASH_CSR6_CSR6_Values<HASH::CSR6, 0, 32, ReadWriteMode, HASHCSR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR6_CSR6_Values<HASH::CSR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +235,7 @@ struct HASH
   struct CSR7 : public RegisterBase<0x50060514, 32, ReadWriteMode>
   {
     using CSR7Field = HASH_CSR7_CSR7_Values<HASH::CSR7, 0, 32, ReadWriteMode, HASHCSR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR7_CSR7_Values<HASH::CSR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -234,6 +247,7 @@ struct HASH
   struct CSR8 : public RegisterBase<0x50060518, 32, ReadWriteMode>
   {
     using CSR8Field = HASH_CSR8_CSR8_Values<HASH::CSR8, 0, 32, ReadWriteMode, HASHCSR8Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR8_CSR8_Values<HASH::CSR8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -245,6 +259,7 @@ struct HASH
   struct CSR9 : public RegisterBase<0x5006051C, 32, ReadWriteMode>
   {
     using CSR9Field = HASH_CSR9_CSR9_Values<HASH::CSR9, 0, 32, ReadWriteMode, HASHCSR9Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR9_CSR9_Values<HASH::CSR9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -256,6 +271,7 @@ struct HASH
   struct CSR10 : public RegisterBase<0x50060520, 32, ReadWriteMode>
   {
     using CSR10Field = HASH_CSR10_CSR10_Values<HASH::CSR10, 0, 32, ReadWriteMode, HASHCSR10Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR10_CSR10_Values<HASH::CSR10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -267,6 +283,7 @@ struct HASH
   struct CSR11 : public RegisterBase<0x50060524, 32, ReadWriteMode>
   {
     using CSR11Field = HASH_CSR11_CSR11_Values<HASH::CSR11, 0, 32, ReadWriteMode, HASHCSR11Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR11_CSR11_Values<HASH::CSR11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +295,7 @@ struct HASH
   struct CSR12 : public RegisterBase<0x50060528, 32, ReadWriteMode>
   {
     using CSR12Field = HASH_CSR12_CSR12_Values<HASH::CSR12, 0, 32, ReadWriteMode, HASHCSR12Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR12_CSR12_Values<HASH::CSR12, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,6 +307,7 @@ struct HASH
   struct CSR13 : public RegisterBase<0x5006052C, 32, ReadWriteMode>
   {
     using CSR13Field = HASH_CSR13_CSR13_Values<HASH::CSR13, 0, 32, ReadWriteMode, HASHCSR13Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR13_CSR13_Values<HASH::CSR13, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -300,6 +319,7 @@ struct HASH
   struct CSR14 : public RegisterBase<0x50060530, 32, ReadWriteMode>
   {
     using CSR14Field = HASH_CSR14_CSR14_Values<HASH::CSR14, 0, 32, ReadWriteMode, HASHCSR14Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR14_CSR14_Values<HASH::CSR14, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -311,6 +331,7 @@ struct HASH
   struct CSR15 : public RegisterBase<0x50060534, 32, ReadWriteMode>
   {
     using CSR15Field = HASH_CSR15_CSR15_Values<HASH::CSR15, 0, 32, ReadWriteMode, HASHCSR15Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR15_CSR15_Values<HASH::CSR15, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -322,6 +343,7 @@ struct HASH
   struct CSR16 : public RegisterBase<0x50060538, 32, ReadWriteMode>
   {
     using CSR16Field = HASH_CSR16_CSR16_Values<HASH::CSR16, 0, 32, ReadWriteMode, HASHCSR16Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR16_CSR16_Values<HASH::CSR16, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -333,6 +355,7 @@ struct HASH
   struct CSR17 : public RegisterBase<0x5006053C, 32, ReadWriteMode>
   {
     using CSR17Field = HASH_CSR17_CSR17_Values<HASH::CSR17, 0, 32, ReadWriteMode, HASHCSR17Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR17_CSR17_Values<HASH::CSR17, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -344,6 +367,7 @@ struct HASH
   struct CSR18 : public RegisterBase<0x50060540, 32, ReadWriteMode>
   {
     using CSR18Field = HASH_CSR18_CSR18_Values<HASH::CSR18, 0, 32, ReadWriteMode, HASHCSR18Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR18_CSR18_Values<HASH::CSR18, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -355,6 +379,7 @@ struct HASH
   struct CSR19 : public RegisterBase<0x50060544, 32, ReadWriteMode>
   {
     using CSR19Field = HASH_CSR19_CSR19_Values<HASH::CSR19, 0, 32, ReadWriteMode, HASHCSR19Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR19_CSR19_Values<HASH::CSR19, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -366,6 +391,7 @@ struct HASH
   struct CSR20 : public RegisterBase<0x50060548, 32, ReadWriteMode>
   {
     using CSR20Field = HASH_CSR20_CSR20_Values<HASH::CSR20, 0, 32, ReadWriteMode, HASHCSR20Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR20_CSR20_Values<HASH::CSR20, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -377,6 +403,7 @@ struct HASH
   struct CSR21 : public RegisterBase<0x5006054C, 32, ReadWriteMode>
   {
     using CSR21Field = HASH_CSR21_CSR21_Values<HASH::CSR21, 0, 32, ReadWriteMode, HASHCSR21Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR21_CSR21_Values<HASH::CSR21, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -388,6 +415,7 @@ struct HASH
   struct CSR22 : public RegisterBase<0x50060550, 32, ReadWriteMode>
   {
     using CSR22Field = HASH_CSR22_CSR22_Values<HASH::CSR22, 0, 32, ReadWriteMode, HASHCSR22Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR22_CSR22_Values<HASH::CSR22, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -399,6 +427,7 @@ struct HASH
   struct CSR23 : public RegisterBase<0x50060554, 32, ReadWriteMode>
   {
     using CSR23Field = HASH_CSR23_CSR23_Values<HASH::CSR23, 0, 32, ReadWriteMode, HASHCSR23Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR23_CSR23_Values<HASH::CSR23, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -410,6 +439,7 @@ struct HASH
   struct CSR24 : public RegisterBase<0x50060558, 32, ReadWriteMode>
   {
     using CSR24Field = HASH_CSR24_CSR24_Values<HASH::CSR24, 0, 32, ReadWriteMode, HASHCSR24Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR24_CSR24_Values<HASH::CSR24, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -421,6 +451,7 @@ struct HASH
   struct CSR25 : public RegisterBase<0x5006055C, 32, ReadWriteMode>
   {
     using CSR25Field = HASH_CSR25_CSR25_Values<HASH::CSR25, 0, 32, ReadWriteMode, HASHCSR25Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR25_CSR25_Values<HASH::CSR25, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -432,6 +463,7 @@ struct HASH
   struct CSR26 : public RegisterBase<0x50060560, 32, ReadWriteMode>
   {
     using CSR26Field = HASH_CSR26_CSR26_Values<HASH::CSR26, 0, 32, ReadWriteMode, HASHCSR26Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR26_CSR26_Values<HASH::CSR26, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -443,6 +475,7 @@ struct HASH
   struct CSR27 : public RegisterBase<0x50060564, 32, ReadWriteMode>
   {
     using CSR27Field = HASH_CSR27_CSR27_Values<HASH::CSR27, 0, 32, ReadWriteMode, HASHCSR27Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR27_CSR27_Values<HASH::CSR27, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -454,6 +487,7 @@ struct HASH
   struct CSR28 : public RegisterBase<0x50060568, 32, ReadWriteMode>
   {
     using CSR28Field = HASH_CSR28_CSR28_Values<HASH::CSR28, 0, 32, ReadWriteMode, HASHCSR28Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR28_CSR28_Values<HASH::CSR28, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -465,6 +499,7 @@ struct HASH
   struct CSR29 : public RegisterBase<0x5006056C, 32, ReadWriteMode>
   {
     using CSR29Field = HASH_CSR29_CSR29_Values<HASH::CSR29, 0, 32, ReadWriteMode, HASHCSR29Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR29_CSR29_Values<HASH::CSR29, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -476,6 +511,7 @@ struct HASH
   struct CSR30 : public RegisterBase<0x50060570, 32, ReadWriteMode>
   {
     using CSR30Field = HASH_CSR30_CSR30_Values<HASH::CSR30, 0, 32, ReadWriteMode, HASHCSR30Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR30_CSR30_Values<HASH::CSR30, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -487,6 +523,7 @@ struct HASH
   struct CSR31 : public RegisterBase<0x50060574, 32, ReadWriteMode>
   {
     using CSR31Field = HASH_CSR31_CSR31_Values<HASH::CSR31, 0, 32, ReadWriteMode, HASHCSR31Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR31_CSR31_Values<HASH::CSR31, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -498,6 +535,7 @@ struct HASH
   struct CSR32 : public RegisterBase<0x50060578, 32, ReadWriteMode>
   {
     using CSR32Field = HASH_CSR32_CSR32_Values<HASH::CSR32, 0, 32, ReadWriteMode, HASHCSR32Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR32_CSR32_Values<HASH::CSR32, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -509,6 +547,7 @@ struct HASH
   struct CSR33 : public RegisterBase<0x5006057C, 32, ReadWriteMode>
   {
     using CSR33Field = HASH_CSR33_CSR33_Values<HASH::CSR33, 0, 32, ReadWriteMode, HASHCSR33Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR33_CSR33_Values<HASH::CSR33, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -520,6 +559,7 @@ struct HASH
   struct CSR34 : public RegisterBase<0x50060580, 32, ReadWriteMode>
   {
     using CSR34Field = HASH_CSR34_CSR34_Values<HASH::CSR34, 0, 32, ReadWriteMode, HASHCSR34Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR34_CSR34_Values<HASH::CSR34, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -531,6 +571,7 @@ struct HASH
   struct CSR35 : public RegisterBase<0x50060584, 32, ReadWriteMode>
   {
     using CSR35Field = HASH_CSR35_CSR35_Values<HASH::CSR35, 0, 32, ReadWriteMode, HASHCSR35Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR35_CSR35_Values<HASH::CSR35, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -542,6 +583,7 @@ struct HASH
   struct CSR36 : public RegisterBase<0x50060588, 32, ReadWriteMode>
   {
     using CSR36Field = HASH_CSR36_CSR36_Values<HASH::CSR36, 0, 32, ReadWriteMode, HASHCSR36Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR36_CSR36_Values<HASH::CSR36, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -553,6 +595,7 @@ struct HASH
   struct CSR37 : public RegisterBase<0x5006058C, 32, ReadWriteMode>
   {
     using CSR37Field = HASH_CSR37_CSR37_Values<HASH::CSR37, 0, 32, ReadWriteMode, HASHCSR37Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR37_CSR37_Values<HASH::CSR37, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -564,6 +607,7 @@ struct HASH
   struct CSR38 : public RegisterBase<0x50060590, 32, ReadWriteMode>
   {
     using CSR38Field = HASH_CSR38_CSR38_Values<HASH::CSR38, 0, 32, ReadWriteMode, HASHCSR38Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR38_CSR38_Values<HASH::CSR38, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -575,6 +619,7 @@ struct HASH
   struct CSR39 : public RegisterBase<0x50060594, 32, ReadWriteMode>
   {
     using CSR39Field = HASH_CSR39_CSR39_Values<HASH::CSR39, 0, 32, ReadWriteMode, HASHCSR39Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR39_CSR39_Values<HASH::CSR39, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -586,6 +631,7 @@ struct HASH
   struct CSR40 : public RegisterBase<0x50060598, 32, ReadWriteMode>
   {
     using CSR40Field = HASH_CSR40_CSR40_Values<HASH::CSR40, 0, 32, ReadWriteMode, HASHCSR40Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR40_CSR40_Values<HASH::CSR40, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -597,6 +643,7 @@ struct HASH
   struct CSR41 : public RegisterBase<0x5006059C, 32, ReadWriteMode>
   {
     using CSR41Field = HASH_CSR41_CSR41_Values<HASH::CSR41, 0, 32, ReadWriteMode, HASHCSR41Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR41_CSR41_Values<HASH::CSR41, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +655,7 @@ struct HASH
   struct CSR42 : public RegisterBase<0x500605A0, 32, ReadWriteMode>
   {
     using CSR42Field = HASH_CSR42_CSR42_Values<HASH::CSR42, 0, 32, ReadWriteMode, HASHCSR42Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR42_CSR42_Values<HASH::CSR42, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -619,6 +667,7 @@ struct HASH
   struct CSR43 : public RegisterBase<0x500605A4, 32, ReadWriteMode>
   {
     using CSR43Field = HASH_CSR43_CSR43_Values<HASH::CSR43, 0, 32, ReadWriteMode, HASHCSR43Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR43_CSR43_Values<HASH::CSR43, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -630,6 +679,7 @@ struct HASH
   struct CSR44 : public RegisterBase<0x500605A8, 32, ReadWriteMode>
   {
     using CSR44Field = HASH_CSR44_CSR44_Values<HASH::CSR44, 0, 32, ReadWriteMode, HASHCSR44Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR44_CSR44_Values<HASH::CSR44, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -641,6 +691,7 @@ struct HASH
   struct CSR45 : public RegisterBase<0x500605AC, 32, ReadWriteMode>
   {
     using CSR45Field = HASH_CSR45_CSR45_Values<HASH::CSR45, 0, 32, ReadWriteMode, HASHCSR45Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR45_CSR45_Values<HASH::CSR45, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -652,6 +703,7 @@ struct HASH
   struct CSR46 : public RegisterBase<0x500605B0, 32, ReadWriteMode>
   {
     using CSR46Field = HASH_CSR46_CSR46_Values<HASH::CSR46, 0, 32, ReadWriteMode, HASHCSR46Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR46_CSR46_Values<HASH::CSR46, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -663,6 +715,7 @@ struct HASH
   struct CSR47 : public RegisterBase<0x500605B4, 32, ReadWriteMode>
   {
     using CSR47Field = HASH_CSR47_CSR47_Values<HASH::CSR47, 0, 32, ReadWriteMode, HASHCSR47Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR47_CSR47_Values<HASH::CSR47, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -674,6 +727,7 @@ struct HASH
   struct CSR48 : public RegisterBase<0x500605B8, 32, ReadWriteMode>
   {
     using CSR48Field = HASH_CSR48_CSR48_Values<HASH::CSR48, 0, 32, ReadWriteMode, HASHCSR48Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR48_CSR48_Values<HASH::CSR48, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -685,6 +739,7 @@ struct HASH
   struct CSR49 : public RegisterBase<0x500605BC, 32, ReadWriteMode>
   {
     using CSR49Field = HASH_CSR49_CSR49_Values<HASH::CSR49, 0, 32, ReadWriteMode, HASHCSR49Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR49_CSR49_Values<HASH::CSR49, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -696,6 +751,7 @@ struct HASH
   struct CSR50 : public RegisterBase<0x500605C0, 32, ReadWriteMode>
   {
     using CSR50Field = HASH_CSR50_CSR50_Values<HASH::CSR50, 0, 32, ReadWriteMode, HASHCSR50Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR50_CSR50_Values<HASH::CSR50, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -707,6 +763,7 @@ struct HASH
   struct CSR51 : public RegisterBase<0x500605C4, 32, ReadWriteMode>
   {
     using CSR51Field = HASH_CSR51_CSR51_Values<HASH::CSR51, 0, 32, ReadWriteMode, HASHCSR51Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR51_CSR51_Values<HASH::CSR51, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -718,6 +775,7 @@ struct HASH
   struct CSR52 : public RegisterBase<0x500605C8, 32, ReadWriteMode>
   {
     using CSR52Field = HASH_CSR52_CSR52_Values<HASH::CSR52, 0, 32, ReadWriteMode, HASHCSR52Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR52_CSR52_Values<HASH::CSR52, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -729,6 +787,7 @@ struct HASH
   struct CSR53 : public RegisterBase<0x500605CC, 32, ReadWriteMode>
   {
     using CSR53Field = HASH_CSR53_CSR53_Values<HASH::CSR53, 0, 32, ReadWriteMode, HASHCSR53Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = HASH_CSR53_CSR53_Values<HASH::CSR53, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -823,6 +882,7 @@ struct HASH
   template<typename... T> 
   using HASH_HR7Pack  = Register<0x5006072C, 32, ReadMode, HASHHASH_HR7Base, T...> ;
 
+  using Registers = TypesList<HASH::CR, HASH::DIN, HASH::STR, HASH::HR0, HASH::HR1, HASH::HR2, HASH::HR3, HASH::HR4, HASH::IMR, HASH::SR, HASH::CSR0, HASH::CSR1, HASH::CSR2, HASH::CSR3, HASH::CSR4, HASH::CSR5, HASH::CSR6, HASH::CSR7, HASH::CSR8, HASH::CSR9, HASH::CSR10, HASH::CSR11, HASH::CSR12, HASH::CSR13, HASH::CSR14, HASH::CSR15, HASH::CSR16, HASH::CSR17, HASH::CSR18, HASH::CSR19, HASH::CSR20, HASH::CSR21, HASH::CSR22, HASH::CSR23, HASH::CSR24, HASH::CSR25, HASH::CSR26, HASH::CSR27, HASH::CSR28, HASH::CSR29, HASH::CSR30, HASH::CSR31, HASH::CSR32, HASH::CSR33, HASH::CSR34, HASH::CSR35, HASH::CSR36, HASH::CSR37, HASH::CSR38, HASH::CSR39, HASH::CSR40, HASH::CSR41, HASH::CSR42, HASH::CSR43, HASH::CSR44, HASH::CSR45, HASH::CSR46, HASH::CSR47, HASH::CSR48, HASH::CSR49, HASH::CSR50, HASH::CSR51, HASH::CSR52, HASH::CSR53, HASH::HASH_HR0, HASH::HASH_HR1, HASH::HASH_HR2, HASH::HASH_HR3, HASH::HASH_HR4, HASH::HASH_HR5, HASH::HASH_HR6, HASH::HASH_HR7> ;
 } ;
 
 #endif //#if !defined(HASHREGISTERS_HPP)
@@ -35,6 +35,8 @@ struct I2S2ext
     using MSTR = I2S2ext_CR1_MSTR_Values<I2S2ext::CR1, 2, 1, ReadWriteMode, I2S2extCR1Base> ;
     using CPOL = I2S2ext_CR1_CPOL_Values<I2S2ext::CR1, 1, 1, ReadWriteMode, I2S2extCR1Base> ;
     using CPHA = I2S2ext_CR1_CPHA_Values<I2S2ext::CR1, 0, 1, ReadWriteMode, I2S2extCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = I2S2ext_CR1_CPHA_Values<I2S2ext::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +54,7 @@ struct I2S2ext
     using SSOE = I2S2ext_CR2_SSOE_Values<I2S2ext::CR2, 2, 1, ReadWriteMode, I2S2extCR2Base> ;
     using TXDMAEN = I2S2ext_CR2_TXDMAEN_Values<I2S2ext::CR2, 1, 1, ReadWriteMode, I2S2extCR2Base> ;
     using RXDMAEN = I2S2ext_CR2_RXDMAEN_Values<I2S2ext::CR2, 0, 1, ReadWriteMode, I2S2extCR2Base> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = I2S2ext_CR2_RXDMAEN_Values<I2S2ext::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +74,9 @@ struct I2S2ext
     using CHSIDE = I2S2ext_SR_CHSIDE_Values<I2S2ext::SR, 2, 1, ReadMode, I2S2extSRBase> ;
     using TXE = I2S2ext_SR_TXE_Values<I2S2ext::SR, 1, 1, ReadMode, I2S2extSRBase> ;
     using RXNE = I2S2ext_SR_RXNE_Values<I2S2ext::SR, 0, 1, ReadMode, I2S2extSRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2S2ext_SR_RXNE_Values<I2S2ext::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +88,7 @@ struct I2S2ext
   struct DR : public RegisterBase<0x4000340C, 32, ReadWriteMode>
   {
     using DRField = I2S2ext_DR_DR_Values<I2S2ext::DR, 0, 16, ReadWriteMode, I2S2extDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2S2ext_DR_DR_Values<I2S2ext::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct I2S2ext
   struct CRCPR : public RegisterBase<0x40003410, 32, ReadWriteMode>
   {
     using CRCPOLY = I2S2ext_CRCPR_CRCPOLY_Values<I2S2ext::CRCPR, 0, 16, ReadWriteMode, I2S2extCRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = I2S2ext_CRCPR_CRCPOLY_Values<I2S2ext::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +141,8 @@ struct I2S2ext
     using CKPOL = I2S2ext_I2SCFGR_CKPOL_Values<I2S2ext::I2SCFGR, 3, 1, ReadWriteMode, I2S2extI2SCFGRBase> ;
     using DATLEN = I2S2ext_I2SCFGR_DATLEN_Values<I2S2ext::I2SCFGR, 1, 2, ReadWriteMode, I2S2extI2SCFGRBase> ;
     using CHLEN = I2S2ext_I2SCFGR_CHLEN_Values<I2S2ext::I2SCFGR, 0, 1, ReadWriteMode, I2S2extI2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = I2S2ext_I2SCFGR_CHLEN_Values<I2S2ext::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +156,14 @@ struct I2S2ext
     using MCKOE = I2S2ext_I2SPR_MCKOE_Values<I2S2ext::I2SPR, 9, 1, ReadWriteMode, I2S2extI2SPRBase> ;
     using ODD = I2S2ext_I2SPR_ODD_Values<I2S2ext::I2SPR, 8, 1, ReadWriteMode, I2S2extI2SPRBase> ;
     using I2SDIV = I2S2ext_I2SPR_I2SDIV_Values<I2S2ext::I2SPR, 0, 8, ReadWriteMode, I2S2extI2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = I2S2ext_I2SPR_I2SDIV_Values<I2S2ext::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003420, 32, ReadWriteMode, I2S2extI2SPRBase, T...> ;
 
+  using Registers = TypesList<I2S2ext::CR1, I2S2ext::CR2, I2S2ext::SR, I2S2ext::DR, I2S2ext::CRCPR, I2S2ext::RXCRCR, I2S2ext::TXCRCR, I2S2ext::I2SCFGR, I2S2ext::I2SPR> ;
 } ;
 
 #endif //#if !defined(I2S2EXTREGISTERS_HPP)
@@ -23,6 +23,7 @@ struct LTDC
   {
     using HSW = LTDC_SSCR_HSW_Values<LTDC::SSCR, 16, 10, ReadWriteMode, LTDCSSCRBase> ;
     using VSH = LTDC_SSCR_VSH_Values<LTDC::SSCR, 0, 11, ReadWriteMode, LTDCSSCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FF07FFU ;
     using FieldValues = LTDC_SSCR_VSH_Values<LTDC::SSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -35,6 +36,7 @@ struct LTDC
   {
     using AHBP = LTDC_BPCR_AHBP_Values<LTDC::BPCR, 16, 10, ReadWriteMode, LTDCBPCRBase> ;
     using AVBP = LTDC_BPCR_AVBP_Values<LTDC::BPCR, 0, 11, ReadWriteMode, LTDCBPCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FF07FFU ;
     using FieldValues = LTDC_BPCR_AVBP_Values<LTDC::BPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +49,7 @@ struct LTDC
   {
     using AAV = LTDC_AWCR_AAV_Values<LTDC::AWCR, 16, 10, ReadWriteMode, LTDCAWCRBase> ;
     using AAH = LTDC_AWCR_AAH_Values<LTDC::AWCR, 0, 11, ReadWriteMode, LTDCAWCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FF07FFU ;
     using FieldValues = LTDC_AWCR_AAH_Values<LTDC::AWCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct LTDC
   {
     using TOTALW = LTDC_TWCR_TOTALW_Values<LTDC::TWCR, 16, 10, ReadWriteMode, LTDCTWCRBase> ;
     using TOTALH = LTDC_TWCR_TOTALH_Values<LTDC::TWCR, 0, 11, ReadWriteMode, LTDCTWCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FF07FFU ;
     using FieldValues = LTDC_TWCR_TOTALH_Values<LTDC::TWCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +82,7 @@ struct LTDC
     using DGW = LTDC_GCR_DGW_Values<LTDC::GCR, 8, 3, ReadMode, LTDCGCRBase> ;
     using DBW = LTDC_GCR_DBW_Values<LTDC::GCR, 4, 3, ReadMode, LTDCGCRBase> ;
     using LTDCEN = LTDC_GCR_LTDCEN_Values<LTDC::GCR, 0, 1, ReadWriteMode, LTDCGCRBase> ;
+    static constexpr Type SnapshotMask = 0xF0010001U ;
     using FieldValues = LTDC_GCR_LTDCEN_Values<LTDC::GCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +95,7 @@ struct LTDC
   {
     using VBR = LTDC_SRCR_VBR_Values<LTDC::SRCR, 1, 1, ReadWriteMode, LTDCSRCRBase> ;
     using IMR = LTDC_SRCR_IMR_Values<LTDC::SRCR, 0, 1, ReadWriteMode, LTDCSRCRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = LTDC_SRCR_IMR_Values<LTDC::SRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +107,7 @@ struct LTDC
   struct BCCR : public RegisterBase<0x4001682C, 32, ReadWriteMode>
   {
     using BC = LTDC_BCCR_BC_Values<LTDC::BCCR, 0, 24, ReadWriteMode, LTDCBCCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = LTDC_BCCR_BC_Values<LTDC::BCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +122,7 @@ struct LTDC
     using TERRIE = LTDC_IER_TERRIE_Values<LTDC::IER, 2, 1, ReadWriteMode, LTDCIERBase> ;
     using FUIE = LTDC_IER_FUIE_Values<LTDC::IER, 1, 1, ReadWriteMode, LTDCIERBase> ;
     using LIE = LTDC_IER_LIE_Values<LTDC::IER, 0, 1, ReadWriteMode, LTDCIERBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = LTDC_IER_LIE_Values<LTDC::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,6 +162,7 @@ struct LTDC
   struct LIPCR : public RegisterBase<0x40016840, 32, ReadWriteMode>
   {
     using LIPOS = LTDC_LIPCR_LIPOS_Values<LTDC::LIPCR, 0, 11, ReadWriteMode, LTDCLIPCRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = LTDC_LIPCR_LIPOS_Values<LTDC::LIPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -193,6 +202,7 @@ struct LTDC
     using CLUTEN = LTDC_L1CR_CLUTEN_Values<LTDC::L1CR, 4, 1, ReadWriteMode, LTDCL1CRBase> ;
     using COLKEN = LTDC_L1CR_COLKEN_Values<LTDC::L1CR, 1, 1, ReadWriteMode, LTDCL1CRBase> ;
     using LEN = LTDC_L1CR_LEN_Values<LTDC::L1CR, 0, 1, ReadWriteMode, LTDCL1CRBase> ;
+    static constexpr Type SnapshotMask = 0x13U ;
     using FieldValues = LTDC_L1CR_LEN_Values<LTDC::L1CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +215,7 @@ struct LTDC
   {
     using WHSPPOS = LTDC_L1WHPCR_WHSPPOS_Values<LTDC::L1WHPCR, 16, 12, ReadWriteMode, LTDCL1WHPCRBase> ;
     using WHSTPOS = LTDC_L1WHPCR_WHSTPOS_Values<LTDC::L1WHPCR, 0, 12, ReadWriteMode, LTDCL1WHPCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = LTDC_L1WHPCR_WHSTPOS_Values<LTDC::L1WHPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -217,6 +228,7 @@ struct LTDC
   {
     using WVSPPOS = LTDC_L1WVPCR_WVSPPOS_Values<LTDC::L1WVPCR, 16, 11, ReadWriteMode, LTDCL1WVPCRBase> ;
     using WVSTPOS = LTDC_L1WVPCR_WVSTPOS_Values<LTDC::L1WVPCR, 0, 11, ReadWriteMode, LTDCL1WVPCRBase> ;
+    static constexpr Type SnapshotMask = 0x7FF07FFU ;
     using FieldValues = LTDC_L1WVPCR_WVSTPOS_Values<LTDC::L1WVPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +242,7 @@ struct LTDC
     using CKRED = LTDC_L1CKCR_CKRED_Values<LTDC::L1CKCR, 16, 8, ReadWriteMode, LTDCL1CKCRBase> ;
     using CKGREEN = LTDC_L1CKCR_CKGREEN_Values<LTDC::L1CKCR, 8, 8, ReadWriteMode, LTDCL1CKCRBase> ;
     using CKBLUE = LTDC_L1CKCR_CKBLUE_Values<LTDC::L1CKCR, 0, 8, ReadWriteMode, LTDCL1CKCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = LTDC_L1CKCR_CKBLUE_Values<LTDC::L1CKCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +254,7 @@ struct LTDC
   struct L1PFCR : public RegisterBase<0x40016894, 32, ReadWriteMode>
   {
     using PF = LTDC_L1PFCR_PF_Values<LTDC::L1PFCR, 0, 3, ReadWriteMode, LTDCL1PFCRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = LTDC_L1PFCR_PF_Values<LTDC::L1PFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +266,7 @@ struct LTDC
   struct L1CACR : public RegisterBase<0x40016898, 32, ReadWriteMode>
   {
     using CONSTA = LTDC_L1CACR_CONSTA_Values<LTDC::L1CACR, 0, 8, ReadWriteMode, LTDCL1CACRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = LTDC_L1CACR_CONSTA_Values<LTDC::L1CACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -266,6 +281,7 @@ struct LTDC
     using DCRED = LTDC_L1DCCR_DCRED_Values<LTDC::L1DCCR, 16, 8, ReadWriteMode, LTDCL1DCCRBase> ;
     using DCGREEN = LTDC_L1DCCR_DCGREEN_Values<LTDC::L1DCCR, 8, 8, ReadWriteMode, LTDCL1DCCRBase> ;
     using DCBLUE = LTDC_L1DCCR_DCBLUE_Values<LTDC::L1DCCR, 0, 8, ReadWriteMode, LTDCL1DCCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LTDC_L1DCCR_DCBLUE_Values<LTDC::L1DCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +294,7 @@ struct LTDC
   {
     using BF1 = LTDC_L1BFCR_BF1_Values<LTDC::L1BFCR, 8, 3, ReadWriteMode, LTDCL1BFCRBase> ;
     using BF2 = LTDC_L1BFCR_BF2_Values<LTDC::L1BFCR, 0, 3, ReadWriteMode, LTDCL1BFCRBase> ;
+    static constexpr Type SnapshotMask = 0x707U ;
     using FieldValues = LTDC_L1BFCR_BF2_Values<LTDC::L1BFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,6 +306,7 @@ struct LTDC
   struct L1CFBAR : public RegisterBase<0x400168AC, 32, ReadWriteMode>
   {
     using CFBADD = LTDC_L1CFBAR_CFBADD_Values<LTDC::L1CFBAR, 0, 32, ReadWriteMode, LTDCL1CFBARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LTDC_L1CFBAR_CFBADD_Values<LTDC::L1CFBAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -301,6 +319,7 @@ struct LTDC
   {
     using CFBP = LTDC_L1CFBLR_CFBP_Values<LTDC::L1CFBLR, 16, 13, ReadWriteMode, LTDCL1CFBLRBase> ;
     using CFBLL = LTDC_L1CFBLR_CFBLL_Values<LTDC::L1CFBLR, 0, 13, ReadWriteMode, LTDCL1CFBLRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFF1FFFU ;
     using FieldValues = LTDC_L1CFBLR_CFBLL_Values<LTDC::L1CFBLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -312,6 +331,7 @@ struct LTDC
   struct L1CFBLNR : public RegisterBase<0x400168B4, 32, ReadWriteMode>
   {
     using CFBLNBR = LTDC_L1CFBLNR_CFBLNBR_Values<LTDC::L1CFBLNR, 0, 11, ReadWriteMode, LTDCL1CFBLNRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = LTDC_L1CFBLNR_CFBLNBR_Values<LTDC::L1CFBLNR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -339,6 +359,7 @@ struct LTDC
     using CLUTEN = LTDC_L2CR_CLUTEN_Values<LTDC::L2CR, 4, 1, ReadWriteMode, LTDCL2CRBase> ;
     using COLKEN = LTDC_L2CR_COLKEN_Values<LTDC::L2CR, 1, 1, ReadWriteMode, LTDCL2CRBase> ;
     using LEN = LTDC_L2CR_LEN_Values<LTDC::L2CR, 0, 1, ReadWriteMode, LTDCL2CRBase> ;
+    static constexpr Type SnapshotMask = 0x13U ;
     using FieldValues = LTDC_L2CR_LEN_Values<LTDC::L2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -351,6 +372,7 @@ struct LTDC
   {
     using WHSPPOS = LTDC_L2WHPCR_WHSPPOS_Values<LTDC::L2WHPCR, 16, 12, ReadWriteMode, LTDCL2WHPCRBase> ;
     using WHSTPOS = LTDC_L2WHPCR_WHSTPOS_Values<LTDC::L2WHPCR, 0, 12, ReadWriteMode, LTDCL2WHPCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = LTDC_L2WHPCR_WHSTPOS_Values<LTDC::L2WHPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -363,6 +385,7 @@ struct LTDC
   {
     using WVSPPOS = LTDC_L2WVPCR_WVSPPOS_Values<LTDC::L2WVPCR, 16, 11, ReadWriteMode, LTDCL2WVPCRBase> ;
     using WVSTPOS = LTDC_L2WVPCR_WVSTPOS_Values<LTDC::L2WVPCR, 0, 11, ReadWriteMode, LTDCL2WVPCRBase> ;
+    static constexpr Type SnapshotMask = 0x7FF07FFU ;
     using FieldValues = LTDC_L2WVPCR_WVSTPOS_Values<LTDC::L2WVPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -376,6 +399,7 @@ struct LTDC
     using CKRED = LTDC_L2CKCR_CKRED_Values<LTDC::L2CKCR, 15, 9, ReadWriteMode, LTDCL2CKCRBase> ;
     using CKGREEN = LTDC_L2CKCR_CKGREEN_Values<LTDC::L2CKCR, 8, 7, ReadWriteMode, LTDCL2CKCRBase> ;
     using CKBLUE = LTDC_L2CKCR_CKBLUE_Values<LTDC::L2CKCR, 0, 8, ReadWriteMode, LTDCL2CKCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = LTDC_L2CKCR_CKBLUE_Values<LTDC::L2CKCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -387,6 +411,7 @@ struct LTDC
   struct L2PFCR : public RegisterBase<0x40016914, 32, ReadWriteMode>
   {
     using PF = LTDC_L2PFCR_PF_Values<LTDC::L2PFCR, 0, 3, ReadWriteMode, LTDCL2PFCRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = LTDC_L2PFCR_PF_Values<LTDC::L2PFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -398,6 +423,7 @@ struct LTDC
   struct L2CACR : public RegisterBase<0x40016918, 32, ReadWriteMode>
   {
     using CONSTA = LTDC_L2CACR_CONSTA_Values<LTDC::L2CACR, 0, 8, ReadWriteMode, LTDCL2CACRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = LTDC_L2CACR_CONSTA_Values<LTDC::L2CACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -412,6 +438,7 @@ struct LTDC
     using DCRED = LTDC_L2DCCR_DCRED_Values<LTDC::L2DCCR, 16, 8, ReadWriteMode, LTDCL2DCCRBase> ;
     using DCGREEN = LTDC_L2DCCR_DCGREEN_Values<LTDC::L2DCCR, 8, 8, ReadWriteMode, LTDCL2DCCRBase> ;
     using DCBLUE = LTDC_L2DCCR_DCBLUE_Values<LTDC::L2DCCR, 0, 8, ReadWriteMode, LTDCL2DCCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LTDC_L2DCCR_DCBLUE_Values<LTDC::L2DCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -424,6 +451,7 @@ struct LTDC
   {
     using BF1 = LTDC_L2BFCR_BF1_Values<LTDC::L2BFCR, 8, 3, ReadWriteMode, LTDCL2BFCRBase> ;
     using BF2 = LTDC_L2BFCR_BF2_Values<LTDC::L2BFCR, 0, 3, ReadWriteMode, LTDCL2BFCRBase> ;
+    static constexpr Type SnapshotMask = 0x707U ;
     using FieldValues = LTDC_L2BFCR_BF2_Values<LTDC::L2BFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -435,6 +463,7 @@ struct LTDC
   struct L2CFBAR : public RegisterBase<0x4001692C, 32, ReadWriteMode>
   {
     using CFBADD = LTDC_L2CFBAR_CFBADD_Values<LTDC::L2CFBAR, 0, 32, ReadWriteMode, LTDCL2CFBARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LTDC_L2CFBAR_CFBADD_Values<LTDC::L2CFBAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -447,6 +476,7 @@ struct LTDC
   {
     using CFBP = LTDC_L2CFBLR_CFBP_Values<LTDC::L2CFBLR, 16, 13, ReadWriteMode, LTDCL2CFBLRBase> ;
     using CFBLL = LTDC_L2CFBLR_CFBLL_Values<LTDC::L2CFBLR, 0, 13, ReadWriteMode, LTDCL2CFBLRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFF1FFFU ;
     using FieldValues = LTDC_L2CFBLR_CFBLL_Values<LTDC::L2CFBLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -458,6 +488,7 @@ struct LTDC
   struct L2CFBLNR : public RegisterBase<0x40016934, 32, ReadWriteMode>
   {
     using CFBLNBR = LTDC_L2CFBLNR_CFBLNBR_Values<LTDC::L2CFBLNR, 0, 11, ReadWriteMode, LTDCL2CFBLNRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = LTDC_L2CFBLNR_CFBLNBR_Values<LTDC::L2CFBLNR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -478,6 +509,7 @@ struct LTDC
   template<typename... T> 
   using L2CLUTWRPack  = Register<0x40016944, 32, WriteMode, LTDCL2CLUTWRBase, T...> ;
 
+  using Registers = TypesList<LTDC::SSCR, LTDC::BPCR, LTDC::AWCR, LTDC::TWCR, LTDC::GCR, LTDC::SRCR, LTDC::BCCR, LTDC::IER, LTDC::ISR, LTDC::ICR, LTDC::LIPCR, LTDC::CPSR, LTDC::CDSR, LTDC::L1CR, LTDC::L1WHPCR, LTDC::L1WVPCR, LTDC::L1CKCR, LTDC::L1PFCR, LTDC::L1CACR, LTDC::L1DCCR, LTDC::L1BFCR, LTDC::L1CFBAR, LTDC::L1CFBLR, LTDC::L1CFBLNR, LTDC::L1CLUTWR, LTDC::L2CR, LTDC::L2WHPCR, LTDC::L2WVPCR, LTDC::L2CKCR, LTDC::L2PFCR, LTDC::L2CACR, LTDC::L2DCCR, LTDC::L2BFCR, LTDC::L2CFBAR, LTDC::L2CFBLR, LTDC::L2CFBLNR, LTDC::L2CLUTWR> ;
 } ;
 
 #endif //#if !defined(LTDCREGISTERS_HPP)
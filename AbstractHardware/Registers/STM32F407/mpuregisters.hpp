@@ -48,6 +48,7 @@ struct MPU
   struct MPU_RNR : public RegisterBase<0xE000ED98, 32, ReadWriteMode>
   {
     using REGION = MPU_MPU_RNR_REGION_Values<MPU::MPU_RNR, 0, 8, ReadWriteMode, MPUMPU_RNRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = MPU_MPU_RNR_REGION_Values<MPU::MPU_RNR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +62,7 @@ struct MPU
     using REGION = MPU_MPU_RBAR_REGION_Values<MPU::MPU_RBAR, 0, 4, ReadWriteMode, MPUMPU_RBARBase> ;
     using VALID = MPU_MPU_RBAR_VALID_Values<MPU::MPU_RBAR, 4, 1, ReadWriteMode, MPUMPU_RBARBase> ;
     using ADDR = MPU_MPU_RBAR_ADDR_Values<MPU::MPU_RBAR, 5, 27, ReadWriteMode, MPUMPU_RBARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = MPU_MPU_RBAR_ADDR_Values<MPU::MPU_RBAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,12 +82,14 @@ struct MPU
     using TEX = MPU_MPU_RASR_TEX_Values<MPU::MPU_RASR, 19, 3, ReadWriteMode, MPUMPU_RASRBase> ;
     using AP = MPU_MPU_RASR_AP_Values<MPU::MPU_RASR, 24, 3, ReadWriteMode, MPUMPU_RASRBase> ;
     using XN = MPU_MPU_RASR_XN_Values<MPU::MPU_RASR, 28, 1, ReadWriteMode, MPUMPU_RASRBase> ;
+    static constexpr Type SnapshotMask = 0x173FFF3FU ;
     using FieldValues = MPU_MPU_RASR_XN_Values<MPU::MPU_RASR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using MPU_RASRPack  = Register<0xE000EDA0, 32, ReadWriteMode, MPUMPU_RASRBase, T...> ;
 
+  using Registers = TypesList<MPU::MPU_TYPER, MPU::MPU_CTRL, MPU::MPU_RNR, MPU::MPU_RBAR, MPU::MPU_RASR> ;
 } ;
 
 #endif //#if !defined(MPUREGISTERS_HPP)
@@ -22,12 +22,14 @@ struct NVIC_STIR
   struct STIR : public RegisterBase<0xE000EF00, 32, ReadWriteMode>
   {
     using INTID = NVIC_STIR_STIR_INTID_Values<NVIC_STIR::STIR, 0, 9, ReadWriteMode, NVIC_STIRSTIRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFU ;
     using FieldValues = NVIC_STIR_STIR_INTID_Values<NVIC_STIR::STIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using STIRPack  = Register<0xE000EF00, 32, ReadWriteMode, NVIC_STIRSTIRBase, T...> ;
 
+  using Registers = TypesList<NVIC_STIR::STIR> ;
 } ;
 
 #endif //#if !defined(NVICSTIRREGISTERS_HPP)
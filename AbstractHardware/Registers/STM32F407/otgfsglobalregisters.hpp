@@ -31,6 +31,7 @@ struct OTG_FS_GLOBAL
     using DBCT = OTG_FS_GLOBAL_FS_GOTGCTL_DBCT_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 17, 1, ReadMode, OTG_FS_GLOBALFS_GOTGCTLBase> ;
     using ASVLD = OTG_FS_GLOBAL_FS_GOTGCTL_ASVLD_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 18, 1, ReadMode, OTG_FS_GLOBALFS_GOTGCTLBase> ;
     using BSVLD = OTG_FS_GLOBAL_FS_GOTGCTL_BSVLD_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 19, 1, ReadMode, OTG_FS_GLOBALFS_GOTGCTLBase> ;
+    static constexpr Type SnapshotMask = 0xE02U ;
     using FieldValues = OTG_FS_GLOBAL_FS_GOTGCTL_BSVLD_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +48,7 @@ struct OTG_FS_GLOBAL
     using HNGDET = OTG_FS_GLOBAL_FS_GOTGINT_HNGDET_Values<OTG_FS_GLOBAL::FS_GOTGINT, 17, 1, ReadWriteMode, OTG_FS_GLOBALFS_GOTGINTBase> ;
     using ADTOCHG = OTG_FS_GLOBAL_FS_GOTGINT_ADTOCHG_Values<OTG_FS_GLOBAL::FS_GOTGINT, 18, 1, ReadWriteMode, OTG_FS_GLOBALFS_GOTGINTBase> ;
     using DBCDNE = OTG_FS_GLOBAL_FS_GOTGINT_DBCDNE_Values<OTG_FS_GLOBAL::FS_GOTGINT, 19, 1, ReadWriteMode, OTG_FS_GLOBALFS_GOTGINTBase> ;
+    static constexpr Type SnapshotMask = 0xE0304U ;
     using FieldValues = OTG_FS_GLOBAL_FS_GOTGINT_DBCDNE_Values<OTG_FS_GLOBAL::FS_GOTGINT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +62,7 @@ struct OTG_FS_GLOBAL
     using GINT = OTG_FS_GLOBAL_FS_GAHBCFG_GINT_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 0, 1, ReadWriteMode, OTG_FS_GLOBALFS_GAHBCFGBase> ;
     using TXFELVL = OTG_FS_GLOBAL_FS_GAHBCFG_TXFELVL_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 7, 1, ReadWriteMode, OTG_FS_GLOBALFS_GAHBCFGBase> ;
     using PTXFELVL = OTG_FS_GLOBAL_FS_GAHBCFG_PTXFELVL_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 8, 1, ReadWriteMode, OTG_FS_GLOBALFS_GAHBCFGBase> ;
+    static constexpr Type SnapshotMask = 0x181U ;
     using FieldValues = OTG_FS_GLOBAL_FS_GAHBCFG_PTXFELVL_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,7 @@ struct OTG_FS_GLOBAL
     using FHMOD = OTG_FS_GLOBAL_FS_GUSBCFG_FHMOD_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 29, 1, ReadWriteMode, OTG_FS_GLOBALFS_GUSBCFGBase> ;
     using FDMOD = OTG_FS_GLOBAL_FS_GUSBCFG_FDMOD_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 30, 1, ReadWriteMode, OTG_FS_GLOBALFS_GUSBCFGBase> ;
     using CTXPKT = OTG_FS_GLOBAL_FS_GUSBCFG_CTXPKT_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 31, 1, ReadWriteMode, OTG_FS_GLOBALFS_GUSBCFGBase> ;
+    static constexpr Type SnapshotMask = 0xE0003F47U ;
     using FieldValues = OTG_FS_GLOBAL_FS_GUSBCFG_CTXPKT_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +99,7 @@ struct OTG_FS_GLOBAL
     using TXFFLSH = OTG_FS_GLOBAL_FS_GRSTCTL_TXFFLSH_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 5, 1, ReadWriteMode, OTG_FS_GLOBALFS_GRSTCTLBase> ;
     using TXFNUM = OTG_FS_GLOBAL_FS_GRSTCTL_TXFNUM_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 6, 5, ReadWriteMode, OTG_FS_GLOBALFS_GRSTCTLBase> ;
     using AHBIDL = OTG_FS_GLOBAL_FS_GRSTCTL_AHBIDL_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 31, 1, ReadMode, OTG_FS_GLOBALFS_GRSTCTLBase> ;
+    static constexpr Type SnapshotMask = 0x7F7U ;
     using FieldValues = OTG_FS_GLOBAL_FS_GRSTCTL_AHBIDL_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +135,7 @@ struct OTG_FS_GLOBAL
     using DISCINT = OTG_FS_GLOBAL_FS_GINTSTS_DISCINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 29, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTSTSBase> ;
     using SRQINT = OTG_FS_GLOBAL_FS_GINTSTS_SRQINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 30, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTSTSBase> ;
     using WKUPINT = OTG_FS_GLOBAL_FS_GINTSTS_WKUPINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 31, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTSTSBase> ;
+    static constexpr Type SnapshotMask = 0xF030FC0AU ;
     using FieldValues = OTG_FS_GLOBAL_FS_GINTSTS_WKUPINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +171,7 @@ struct OTG_FS_GLOBAL
     using DISCINT = OTG_FS_GLOBAL_FS_GINTMSK_DISCINT_Values<OTG_FS_GLOBAL::FS_GINTMSK, 29, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTMSKBase> ;
     using SRQIM = OTG_FS_GLOBAL_FS_GINTMSK_SRQIM_Values<OTG_FS_GLOBAL::FS_GINTMSK, 30, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTMSKBase> ;
     using WUIM = OTG_FS_GLOBAL_FS_GINTMSK_WUIM_Values<OTG_FS_GLOBAL::FS_GINTMSK, 31, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTMSKBase> ;
+    static constexpr Type SnapshotMask = 0xF63EFCFEU ;
     using FieldValues = OTG_FS_GLOBAL_FS_GINTMSK_WUIM_Values<OTG_FS_GLOBAL::FS_GINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +213,7 @@ struct OTG_FS_GLOBAL
   struct FS_GRXFSIZ : public RegisterBase<0x50000024, 32, ReadWriteMode>
   {
     using RXFD = OTG_FS_GLOBAL_FS_GRXFSIZ_RXFD_Values<OTG_FS_GLOBAL::FS_GRXFSIZ, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_GRXFSIZBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_GRXFSIZ_RXFD_Values<OTG_FS_GLOBAL::FS_GRXFSIZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +226,7 @@ struct OTG_FS_GLOBAL
   {
     using TX0FSA = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Device_TX0FSA_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_DeviceBase> ;
     using TX0FD = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Device_TX0FD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_DeviceBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Device_TX0FD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +239,7 @@ struct OTG_FS_GLOBAL
   {
     using NPTXFSA = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Host_NPTXFSA_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_HostBase> ;
     using NPTXFD = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Host_NPTXFD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_HostBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Host_NPTXFD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -257,6 +267,7 @@ struct OTG_FS_GLOBAL
     using VBUSASEN = OTG_FS_GLOBAL_FS_GCCFG_VBUSASEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 18, 1, ReadWriteMode, OTG_FS_GLOBALFS_GCCFGBase> ;
     using VBUSBSEN = OTG_FS_GLOBAL_FS_GCCFG_VBUSBSEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 19, 1, ReadWriteMode, OTG_FS_GLOBALFS_GCCFGBase> ;
     using SOFOUTEN = OTG_FS_GLOBAL_FS_GCCFG_SOFOUTEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 20, 1, ReadWriteMode, OTG_FS_GLOBALFS_GCCFGBase> ;
+    static constexpr Type SnapshotMask = 0x1D0000U ;
     using FieldValues = OTG_FS_GLOBAL_FS_GCCFG_SOFOUTEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -268,6 +279,7 @@ struct OTG_FS_GLOBAL
   struct FS_CID : public RegisterBase<0x5000003C, 32, ReadWriteMode>
   {
     using PRODUCT_ID = OTG_FS_GLOBAL_FS_CID_PRODUCT_ID_Values<OTG_FS_GLOBAL::FS_CID, 0, 32, ReadWriteMode, OTG_FS_GLOBALFS_CIDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_CID_PRODUCT_ID_Values<OTG_FS_GLOBAL::FS_CID, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -280,6 +292,7 @@ struct OTG_FS_GLOBAL
   {
     using PTXSA = OTG_FS_GLOBAL_FS_HPTXFSIZ_PTXSA_Values<OTG_FS_GLOBAL::FS_HPTXFSIZ, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_HPTXFSIZBase> ;
     using PTXFSIZ = OTG_FS_GLOBAL_FS_HPTXFSIZ_PTXFSIZ_Values<OTG_FS_GLOBAL::FS_HPTXFSIZ, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_HPTXFSIZBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_HPTXFSIZ_PTXFSIZ_Values<OTG_FS_GLOBAL::FS_HPTXFSIZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -292,6 +305,7 @@ struct OTG_FS_GLOBAL
   {
     using INEPTXSA = OTG_FS_GLOBAL_FS_DIEPTXF1_INEPTXSA_Values<OTG_FS_GLOBAL::FS_DIEPTXF1, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF1Base> ;
     using INEPTXFD = OTG_FS_GLOBAL_FS_DIEPTXF1_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF1, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_DIEPTXF1_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -304,6 +318,7 @@ struct OTG_FS_GLOBAL
   {
     using INEPTXSA = OTG_FS_GLOBAL_FS_DIEPTXF2_INEPTXSA_Values<OTG_FS_GLOBAL::FS_DIEPTXF2, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF2Base> ;
     using INEPTXFD = OTG_FS_GLOBAL_FS_DIEPTXF2_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF2, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_DIEPTXF2_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -316,12 +331,14 @@ struct OTG_FS_GLOBAL
   {
     using INEPTXSA = OTG_FS_GLOBAL_FS_DIEPTXF3_INEPTXSA_Values<OTG_FS_GLOBAL::FS_DIEPTXF3, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF3Base> ;
     using INEPTXFD = OTG_FS_GLOBAL_FS_DIEPTXF3_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF3, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_FS_GLOBAL_FS_DIEPTXF3_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FS_DIEPTXF3Pack  = Register<0x5000010C, 32, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF3Base, T...> ;
 
+  using Registers = TypesList<OTG_FS_GLOBAL::FS_GOTGCTL, OTG_FS_GLOBAL::FS_GOTGINT, OTG_FS_GLOBAL::FS_GAHBCFG, OTG_FS_GLOBAL::FS_GUSBCFG, OTG_FS_GLOBAL::FS_GRSTCTL, OTG_FS_GLOBAL::FS_GINTSTS, OTG_FS_GLOBAL::FS_GINTMSK, OTG_FS_GLOBAL::FS_GRXSTSR_Device, OTG_FS_GLOBAL::FS_GRXSTSR_Host, OTG_FS_GLOBAL::FS_GRXFSIZ, OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, OTG_FS_GLOBAL::FS_GNPTXSTS, OTG_FS_GLOBAL::FS_GCCFG, OTG_FS_GLOBAL::FS_CID, OTG_FS_GLOBAL::FS_HPTXFSIZ, OTG_FS_GLOBAL::FS_DIEPTXF1, OTG_FS_GLOBAL::FS_DIEPTXF2, OTG_FS_GLOBAL::FS_DIEPTXF3> ;
 } ;
 
 #endif //#if !defined(OTGFSGLOBALREGISTERS_HPP)
@@ -24,12 +24,14 @@ struct OTG_FS_PWRCLK
     using STPPCLK = OTG_FS_PWRCLK_FS_PCGCCTL_STPPCLK_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 0, 1, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase> ;
     using GATEHCLK = OTG_FS_PWRCLK_FS_PCGCCTL_GATEHCLK_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 1, 1, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase> ;
     using PHYSUSP = OTG_FS_PWRCLK_FS_PCGCCTL_PHYSUSP_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 4, 1, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase> ;
+    static constexpr Type SnapshotMask = 0x13U ;
     using FieldValues = OTG_FS_PWRCLK_FS_PCGCCTL_PHYSUSP_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FS_PCGCCTLPack  = Register<0x50000E00, 32, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase, T...> ;
 
+  using Registers = TypesList<OTG_FS_PWRCLK::FS_PCGCCTL> ;
 } ;
 
 #endif //#if !defined(OTGFSPWRCLKREGISTERS_HPP)
@@ -26,6 +26,7 @@ struct OTG_HS_DEVICE
     using DAD = OTG_HS_DEVICE_OTG_HS_DCFG_DAD_Values<OTG_HS_DEVICE::OTG_HS_DCFG, 4, 7, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DCFGBase> ;
     using PFIVL = OTG_HS_DEVICE_OTG_HS_DCFG_PFIVL_Values<OTG_HS_DEVICE::OTG_HS_DCFG, 11, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DCFGBase> ;
     using PERSCHIVL = OTG_HS_DEVICE_OTG_HS_DCFG_PERSCHIVL_Values<OTG_HS_DEVICE::OTG_HS_DCFG, 24, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DCFGBase> ;
+    static constexpr Type SnapshotMask = 0x3001FF7U ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DCFG_PERSCHIVL_Values<OTG_HS_DEVICE::OTG_HS_DCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,6 +47,7 @@ struct OTG_HS_DEVICE
     using SGONAK = OTG_HS_DEVICE_OTG_HS_DCTL_SGONAK_Values<OTG_HS_DEVICE::OTG_HS_DCTL, 9, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DCTLBase> ;
     using CGONAK = OTG_HS_DEVICE_OTG_HS_DCTL_CGONAK_Values<OTG_HS_DEVICE::OTG_HS_DCTL, 10, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DCTLBase> ;
     using POPRGDNE = OTG_HS_DEVICE_OTG_HS_DCTL_POPRGDNE_Values<OTG_HS_DEVICE::OTG_HS_DCTL, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DCTLBase> ;
+    static constexpr Type SnapshotMask = 0xFF3U ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DCTL_POPRGDNE_Values<OTG_HS_DEVICE::OTG_HS_DCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +80,7 @@ struct OTG_HS_DEVICE
     using INEPNEM = OTG_HS_DEVICE_OTG_HS_DIEPMSK_INEPNEM_Values<OTG_HS_DEVICE::OTG_HS_DIEPMSK, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPMSKBase> ;
     using TXFURM = OTG_HS_DEVICE_OTG_HS_DIEPMSK_TXFURM_Values<OTG_HS_DEVICE::OTG_HS_DIEPMSK, 8, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPMSKBase> ;
     using BIM = OTG_HS_DEVICE_OTG_HS_DIEPMSK_BIM_Values<OTG_HS_DEVICE::OTG_HS_DIEPMSK, 9, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPMSKBase> ;
+    static constexpr Type SnapshotMask = 0x37BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPMSK_BIM_Values<OTG_HS_DEVICE::OTG_HS_DIEPMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +98,7 @@ struct OTG_HS_DEVICE
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPMSK_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPMSK, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPMSKBase> ;
     using OPEM = OTG_HS_DEVICE_OTG_HS_DOEPMSK_OPEM_Values<OTG_HS_DEVICE::OTG_HS_DOEPMSK, 8, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPMSKBase> ;
     using BOIM = OTG_HS_DEVICE_OTG_HS_DOEPMSK_BOIM_Values<OTG_HS_DEVICE::OTG_HS_DOEPMSK, 9, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPMSKBase> ;
+    static constexpr Type SnapshotMask = 0x35BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPMSK_BOIM_Values<OTG_HS_DEVICE::OTG_HS_DOEPMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -119,6 +123,7 @@ struct OTG_HS_DEVICE
   {
     using IEPM = OTG_HS_DEVICE_OTG_HS_DAINTMSK_IEPM_Values<OTG_HS_DEVICE::OTG_HS_DAINTMSK, 0, 16, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DAINTMSKBase> ;
     using OEPM = OTG_HS_DEVICE_OTG_HS_DAINTMSK_OEPM_Values<OTG_HS_DEVICE::OTG_HS_DAINTMSK, 16, 16, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DAINTMSKBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DAINTMSK_OEPM_Values<OTG_HS_DEVICE::OTG_HS_DAINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +135,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DVBUSDIS : public RegisterBase<0x40040828, 32, ReadWriteMode>
   {
     using VBUSDT = OTG_HS_DEVICE_OTG_HS_DVBUSDIS_VBUSDT_Values<OTG_HS_DEVICE::OTG_HS_DVBUSDIS, 0, 16, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DVBUSDISBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DVBUSDIS_VBUSDT_Values<OTG_HS_DEVICE::OTG_HS_DVBUSDIS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +147,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DVBUSPULSE : public RegisterBase<0x4004082C, 32, ReadWriteMode>
   {
     using DVBUSP = OTG_HS_DEVICE_OTG_HS_DVBUSPULSE_DVBUSP_Values<OTG_HS_DEVICE::OTG_HS_DVBUSPULSE, 0, 12, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DVBUSPULSEBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DVBUSPULSE_DVBUSP_Values<OTG_HS_DEVICE::OTG_HS_DVBUSPULSE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -157,6 +164,7 @@ struct OTG_HS_DEVICE
     using RXTHREN = OTG_HS_DEVICE_OTG_HS_DTHRCTL_RXTHREN_Values<OTG_HS_DEVICE::OTG_HS_DTHRCTL, 16, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DTHRCTLBase> ;
     using RXTHRLEN = OTG_HS_DEVICE_OTG_HS_DTHRCTL_RXTHRLEN_Values<OTG_HS_DEVICE::OTG_HS_DTHRCTL, 17, 9, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DTHRCTLBase> ;
     using ARPEN = OTG_HS_DEVICE_OTG_HS_DTHRCTL_ARPEN_Values<OTG_HS_DEVICE::OTG_HS_DTHRCTL, 27, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DTHRCTLBase> ;
+    static constexpr Type SnapshotMask = 0xBFF07FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DTHRCTL_ARPEN_Values<OTG_HS_DEVICE::OTG_HS_DTHRCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -168,6 +176,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DIEPEMPMSK : public RegisterBase<0x40040834, 32, ReadWriteMode>
   {
     using INEPTXFEM = OTG_HS_DEVICE_OTG_HS_DIEPEMPMSK_INEPTXFEM_Values<OTG_HS_DEVICE::OTG_HS_DIEPEMPMSK, 0, 16, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPEMPMSKBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPEMPMSK_INEPTXFEM_Values<OTG_HS_DEVICE::OTG_HS_DIEPEMPMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +189,7 @@ struct OTG_HS_DEVICE
   {
     using IEP1INT = OTG_HS_DEVICE_OTG_HS_DEACHINT_IEP1INT_Values<OTG_HS_DEVICE::OTG_HS_DEACHINT, 1, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DEACHINTBase> ;
     using OEP1INT = OTG_HS_DEVICE_OTG_HS_DEACHINT_OEP1INT_Values<OTG_HS_DEVICE::OTG_HS_DEACHINT, 17, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DEACHINTBase> ;
+    static constexpr Type SnapshotMask = 0x20002U ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DEACHINT_OEP1INT_Values<OTG_HS_DEVICE::OTG_HS_DEACHINT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +202,7 @@ struct OTG_HS_DEVICE
   {
     using IEP1INTM = OTG_HS_DEVICE_OTG_HS_DEACHINTMSK_IEP1INTM_Values<OTG_HS_DEVICE::OTG_HS_DEACHINTMSK, 1, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DEACHINTMSKBase> ;
     using OEP1INTM = OTG_HS_DEVICE_OTG_HS_DEACHINTMSK_OEP1INTM_Values<OTG_HS_DEVICE::OTG_HS_DEACHINTMSK, 17, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DEACHINTMSKBase> ;
+    static constexpr Type SnapshotMask = 0x20002U ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DEACHINTMSK_OEP1INTM_Values<OTG_HS_DEVICE::OTG_HS_DEACHINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +222,7 @@ struct OTG_HS_DEVICE
     using TXFURM = OTG_HS_DEVICE_OTG_HS_DIEPEACHMSK1_TXFURM_Values<OTG_HS_DEVICE::OTG_HS_DIEPEACHMSK1, 8, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPEACHMSK1Base> ;
     using BIM = OTG_HS_DEVICE_OTG_HS_DIEPEACHMSK1_BIM_Values<OTG_HS_DEVICE::OTG_HS_DIEPEACHMSK1, 9, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPEACHMSK1Base> ;
     using NAKM = OTG_HS_DEVICE_OTG_HS_DIEPEACHMSK1_NAKM_Values<OTG_HS_DEVICE::OTG_HS_DIEPEACHMSK1, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPEACHMSK1Base> ;
+    static constexpr Type SnapshotMask = 0x237BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPEACHMSK1_NAKM_Values<OTG_HS_DEVICE::OTG_HS_DIEPEACHMSK1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -232,6 +244,7 @@ struct OTG_HS_DEVICE
     using BERRM = OTG_HS_DEVICE_OTG_HS_DOEPEACHMSK1_BERRM_Values<OTG_HS_DEVICE::OTG_HS_DOEPEACHMSK1, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPEACHMSK1Base> ;
     using NAKM = OTG_HS_DEVICE_OTG_HS_DOEPEACHMSK1_NAKM_Values<OTG_HS_DEVICE::OTG_HS_DOEPEACHMSK1, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPEACHMSK1Base> ;
     using NYETM = OTG_HS_DEVICE_OTG_HS_DOEPEACHMSK1_NYETM_Values<OTG_HS_DEVICE::OTG_HS_DOEPEACHMSK1, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPEACHMSK1Base> ;
+    static constexpr Type SnapshotMask = 0x737BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPEACHMSK1_NYETM_Values<OTG_HS_DEVICE::OTG_HS_DOEPEACHMSK1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +268,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL0_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL0, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL0Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL0_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL0, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL0Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL0_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL0, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL0Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL0_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +292,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL1_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL1, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL1Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL1_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL1, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL1Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL1_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL1, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL1_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -301,6 +316,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL2_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL2, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL2Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL2_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL2, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL2Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL2_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL2, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL2Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL2_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -324,6 +340,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL3_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL3, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL3Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL3_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL3, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL3Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL3_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL3, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL3Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL3_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -347,6 +364,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL4_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL4, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL4Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL4_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL4, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL4Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL4_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL4, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL4Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL4_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -370,6 +388,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL5_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL5, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL5Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL5_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL5, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL5Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL5_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL5, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL5Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL5_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -393,6 +412,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL6_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL6, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL6Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL6_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL6, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL6Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL6_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL6, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL6Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL6_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +436,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DIEPCTL7_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL7, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL7Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DIEPCTL7_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL7, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL7Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DIEPCTL7_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL7, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPCTL7Base> ;
+    static constexpr Type SnapshotMask = 0xFFEC87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPCTL7_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DIEPCTL7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -437,6 +458,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT0_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT0, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT0Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT0_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT0, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT0Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT0_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT0, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT0Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT0_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -458,6 +480,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT1_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT1, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT1Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT1_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT1, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT1Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT1_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT1, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT1Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT1_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -479,6 +502,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT2_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT2, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT2Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT2_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT2, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT2Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT2_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT2, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT2Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT2_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -500,6 +524,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT3_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT3, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT3Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT3_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT3, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT3Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT3_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT3, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT3Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT3_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -521,6 +546,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT4_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT4, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT4Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT4_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT4, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT4Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT4_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT4, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT4Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT4_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -542,6 +568,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT5_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT5, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT5Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT5_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT5, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT5Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT5_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT5, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT5Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT5_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -563,6 +590,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT6_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT6, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT6Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT6_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT6, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT6Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT6_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT6, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT6Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT6_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -584,6 +612,7 @@ struct OTG_HS_DEVICE
     using PKTDRPSTS = OTG_HS_DEVICE_OTG_HS_DIEPINT7_PKTDRPSTS_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT7, 11, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT7Base> ;
     using BERR = OTG_HS_DEVICE_OTG_HS_DIEPINT7_BERR_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT7, 12, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT7Base> ;
     using NAK = OTG_HS_DEVICE_OTG_HS_DIEPINT7_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT7, 13, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPINT7Base> ;
+    static constexpr Type SnapshotMask = 0x3B5BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPINT7_NAK_Values<OTG_HS_DEVICE::OTG_HS_DIEPINT7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -596,6 +625,7 @@ struct OTG_HS_DEVICE
   {
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ0_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ0, 0, 7, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ0Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ0_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ0, 19, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ0Base> ;
+    static constexpr Type SnapshotMask = 0x18007FU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ0_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -607,6 +637,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DIEPDMA1 : public RegisterBase<0x40040914, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_DEVICE_OTG_HS_DIEPDMA1_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA1, 0, 32, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPDMA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPDMA1_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -618,6 +649,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DIEPDMA2 : public RegisterBase<0x40040934, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_DEVICE_OTG_HS_DIEPDMA2_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA2, 0, 32, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPDMA2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPDMA2_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -629,6 +661,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DIEPDMA3 : public RegisterBase<0x40040954, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_DEVICE_OTG_HS_DIEPDMA3_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA3, 0, 32, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPDMA3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPDMA3_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -640,6 +673,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DIEPDMA4 : public RegisterBase<0x40040974, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_DEVICE_OTG_HS_DIEPDMA4_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA4, 0, 32, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPDMA4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPDMA4_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -651,6 +685,7 @@ struct OTG_HS_DEVICE
   struct OTG_HS_DIEPDMA5 : public RegisterBase<0x40040994, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_DEVICE_OTG_HS_DIEPDMA5_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA5, 0, 32, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPDMA5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPDMA5_DMAADDR_Values<OTG_HS_DEVICE::OTG_HS_DIEPDMA5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -730,6 +765,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ1_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ1, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ1Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ1_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ1, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ1Base> ;
     using MCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ1_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ1, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ1_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -743,6 +779,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ2_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ2, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ2Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ2_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ2, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ2Base> ;
     using MCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ2_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ2, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ2_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -756,6 +793,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ3_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ3, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ3Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ3_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ3, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ3Base> ;
     using MCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ3_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ3, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ3_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -769,6 +807,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ4_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ4, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ4Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ4_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ4, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ4Base> ;
     using MCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ4_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ4, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ4_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -782,6 +821,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ5_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ5, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ5Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ5_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ5, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ5Base> ;
     using MCNT = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ5_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ5, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DIEPTSIZ5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DIEPTSIZ5_MCNT_Values<OTG_HS_DEVICE::OTG_HS_DIEPTSIZ5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -802,6 +842,7 @@ struct OTG_HS_DEVICE
     using SNAK = OTG_HS_DEVICE_OTG_HS_DOEPCTL0_SNAK_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL0, 27, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL0Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DOEPCTL0_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL0, 30, 1, ReadMode, OTG_HS_DEVICEOTG_HS_DOEPCTL0Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DOEPCTL0_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL0, 31, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL0Base> ;
+    static constexpr Type SnapshotMask = 0x8C300000U ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPCTL0_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -825,6 +866,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DOEPCTL1_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL1, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL1Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DOEPCTL1_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL1, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL1Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DOEPCTL1_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL1, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL1Base> ;
+    static constexpr Type SnapshotMask = 0xFC3C87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPCTL1_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -848,6 +890,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DOEPCTL2_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL2, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL2Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DOEPCTL2_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL2, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL2Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DOEPCTL2_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL2, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL2Base> ;
+    static constexpr Type SnapshotMask = 0xFC3C87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPCTL2_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -871,6 +914,7 @@ struct OTG_HS_DEVICE
     using SODDFRM = OTG_HS_DEVICE_OTG_HS_DOEPCTL3_SODDFRM_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL3, 29, 1, WriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL3Base> ;
     using EPDIS = OTG_HS_DEVICE_OTG_HS_DOEPCTL3_EPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL3, 30, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL3Base> ;
     using EPENA = OTG_HS_DEVICE_OTG_HS_DOEPCTL3_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL3, 31, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPCTL3Base> ;
+    static constexpr Type SnapshotMask = 0xFC3C87FFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPCTL3_EPENA_Values<OTG_HS_DEVICE::OTG_HS_DOEPCTL3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -887,6 +931,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT0_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT0, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT0Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT0_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT0, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT0Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT0_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT0, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT0Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT0_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -903,6 +948,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT1_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT1, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT1Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT1_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT1, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT1Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT1_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT1, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT1Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT1_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -919,6 +965,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT2_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT2, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT2Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT2_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT2, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT2Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT2_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT2, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT2Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT2_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -935,6 +982,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT3_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT3, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT3Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT3_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT3, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT3Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT3_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT3, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT3Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT3_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -951,6 +999,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT4_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT4, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT4Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT4_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT4, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT4Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT4_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT4, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT4Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT4_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -967,6 +1016,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT5_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT5, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT5Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT5_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT5, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT5Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT5_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT5, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT5Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT5_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -983,6 +1033,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT6_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT6, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT6Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT6_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT6, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT6Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT6_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT6, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT6Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT6_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -999,6 +1050,7 @@ struct OTG_HS_DEVICE
     using OTEPDIS = OTG_HS_DEVICE_OTG_HS_DOEPINT7_OTEPDIS_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT7, 4, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT7Base> ;
     using B2BSTUP = OTG_HS_DEVICE_OTG_HS_DOEPINT7_B2BSTUP_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT7, 6, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT7Base> ;
     using NYET = OTG_HS_DEVICE_OTG_HS_DOEPINT7_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT7, 14, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPINT7Base> ;
+    static constexpr Type SnapshotMask = 0x405BU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPINT7_NYET_Values<OTG_HS_DEVICE::OTG_HS_DOEPINT7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1012,6 +1064,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ0_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ0, 0, 7, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ0Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ0_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ0, 19, 1, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ0Base> ;
     using STUPCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ0_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ0, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ0Base> ;
+    static constexpr Type SnapshotMask = 0x6008007FU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ0_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1025,6 +1078,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ1_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ1, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ1Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ1_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ1, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ1Base> ;
     using RXDPID_STUPCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ1_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ1, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ1_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1038,6 +1092,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ2_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ2, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ2Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ2_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ2, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ2Base> ;
     using RXDPID_STUPCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ2_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ2, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ2_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1051,6 +1106,7 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ3_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ3, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ3Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ3_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ3, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ3Base> ;
     using RXDPID_STUPCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ3_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ3, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ3_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1064,12 +1120,14 @@ struct OTG_HS_DEVICE
     using XFRSIZ = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ4_XFRSIZ_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ4, 0, 19, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ4Base> ;
     using PKTCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ4_PKTCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ4, 19, 10, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ4Base> ;
     using RXDPID_STUPCNT = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ4_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ4, 29, 2, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_DEVICE_OTG_HS_DOEPTSIZ4_RXDPID_STUPCNT_Values<OTG_HS_DEVICE::OTG_HS_DOEPTSIZ4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OTG_HS_DOEPTSIZ4Pack  = Register<0x40040B90, 32, ReadWriteMode, OTG_HS_DEVICEOTG_HS_DOEPTSIZ4Base, T...> ;
 
+  using Registers = TypesList<OTG_HS_DEVICE::OTG_HS_DCFG, OTG_HS_DEVICE::OTG_HS_DCTL, OTG_HS_DEVICE::OTG_HS_DSTS, OTG_HS_DEVICE::OTG_HS_DIEPMSK, OTG_HS_DEVICE::OTG_HS_DOEPMSK, OTG_HS_DEVICE::OTG_HS_DAINT, OTG_HS_DEVICE::OTG_HS_DAINTMSK, OTG_HS_DEVICE::OTG_HS_DVBUSDIS, OTG_HS_DEVICE::OTG_HS_DVBUSPULSE, OTG_HS_DEVICE::OTG_HS_DTHRCTL, OTG_HS_DEVICE::OTG_HS_DIEPEMPMSK, OTG_HS_DEVICE::OTG_HS_DEACHINT, OTG_HS_DEVICE::OTG_HS_DEACHINTMSK, OTG_HS_DEVICE::OTG_HS_DIEPEACHMSK1, OTG_HS_DEVICE::OTG_HS_DOEPEACHMSK1, OTG_HS_DEVICE::OTG_HS_DIEPCTL0, OTG_HS_DEVICE::OTG_HS_DIEPCTL1, OTG_HS_DEVICE::OTG_HS_DIEPCTL2, OTG_HS_DEVICE::OTG_HS_DIEPCTL3, OTG_HS_DEVICE::OTG_HS_DIEPCTL4, OTG_HS_DEVICE::OTG_HS_DIEPCTL5, OTG_HS_DEVICE::OTG_HS_DIEPCTL6, OTG_HS_DEVICE::OTG_HS_DIEPCTL7, OTG_HS_DEVICE::OTG_HS_DIEPINT0, OTG_HS_DEVICE::OTG_HS_DIEPINT1, OTG_HS_DEVICE::OTG_HS_DIEPINT2, OTG_HS_DEVICE::OTG_HS_DIEPINT3, OTG_HS_DEVICE::OTG_HS_DIEPINT4, OTG_HS_DEVICE::OTG_HS_DIEPINT5, OTG_HS_DEVICE::OTG_HS_DIEPINT6, OTG_HS_DEVICE::OTG_HS_DIEPINT7, OTG_HS_DEVICE::OTG_HS_DIEPTSIZ0, OTG_HS_DEVICE::OTG_HS_DIEPDMA1, OTG_HS_DEVICE::OTG_HS_DIEPDMA2, OTG_HS_DEVICE::OTG_HS_DIEPDMA3, OTG_HS_DEVICE::OTG_HS_DIEPDMA4, OTG_HS_DEVICE::OTG_HS_DIEPDMA5, OTG_HS_DEVICE::OTG_HS_DTXFSTS0, OTG_HS_DEVICE::OTG_HS_DTXFSTS1, OTG_HS_DEVICE::OTG_HS_DTXFSTS2, OTG_HS_DEVICE::OTG_HS_DTXFSTS3, OTG_HS_DEVICE::OTG_HS_DTXFSTS4, OTG_HS_DEVICE::OTG_HS_DTXFSTS5, OTG_HS_DEVICE::OTG_HS_DIEPTSIZ1, OTG_HS_DEVICE::OTG_HS_DIEPTSIZ2, OTG_HS_DEVICE::OTG_HS_DIEPTSIZ3, OTG_HS_DEVICE::OTG_HS_DIEPTSIZ4, OTG_HS_DEVICE::OTG_HS_DIEPTSIZ5, OTG_HS_DEVICE::OTG_HS_DOEPCTL0, OTG_HS_DEVICE::OTG_HS_DOEPCTL1, OTG_HS_DEVICE::OTG_HS_DOEPCTL2, OTG_HS_DEVICE::OTG_HS_DOEPCTL3, OTG_HS_DEVICE::OTG_HS_DOEPINT0, OTG_HS_DEVICE::OTG_HS_DOEPINT1, OTG_HS_DEVICE::OTG_HS_DOEPINT2, OTG_HS_DEVICE::OTG_HS_DOEPINT3, OTG_HS_DEVICE::OTG_HS_DOEPINT4, OTG_HS_DEVICE::OTG_HS_DOEPINT5, OTG_HS_DEVICE::OTG_HS_DOEPINT6, OTG_HS_DEVICE::OTG_HS_DOEPINT7, OTG_HS_DEVICE::OTG_HS_DOEPTSIZ0, OTG_HS_DEVICE::OTG_HS_DOEPTSIZ1, OTG_HS_DEVICE::OTG_HS_DOEPTSIZ2, OTG_HS_DEVICE::OTG_HS_DOEPTSIZ3, OTG_HS_DEVICE::OTG_HS_DOEPTSIZ4> ;
 } ;
 
 #endif //#if !defined(OTGHSDEVICEREGISTERS_HPP)
@@ -31,6 +31,7 @@ struct OTG_HS_GLOBAL
     using DBCT = OTG_HS_GLOBAL_OTG_HS_GOTGCTL_DBCT_Values<OTG_HS_GLOBAL::OTG_HS_GOTGCTL, 17, 1, ReadMode, OTG_HS_GLOBALOTG_HS_GOTGCTLBase> ;
     using ASVLD = OTG_HS_GLOBAL_OTG_HS_GOTGCTL_ASVLD_Values<OTG_HS_GLOBAL::OTG_HS_GOTGCTL, 18, 1, ReadMode, OTG_HS_GLOBALOTG_HS_GOTGCTLBase> ;
     using BSVLD = OTG_HS_GLOBAL_OTG_HS_GOTGCTL_BSVLD_Values<OTG_HS_GLOBAL::OTG_HS_GOTGCTL, 19, 1, ReadMode, OTG_HS_GLOBALOTG_HS_GOTGCTLBase> ;
+    static constexpr Type SnapshotMask = 0xE02U ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GOTGCTL_BSVLD_Values<OTG_HS_GLOBAL::OTG_HS_GOTGCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +48,7 @@ struct OTG_HS_GLOBAL
     using HNGDET = OTG_HS_GLOBAL_OTG_HS_GOTGINT_HNGDET_Values<OTG_HS_GLOBAL::OTG_HS_GOTGINT, 17, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GOTGINTBase> ;
     using ADTOCHG = OTG_HS_GLOBAL_OTG_HS_GOTGINT_ADTOCHG_Values<OTG_HS_GLOBAL::OTG_HS_GOTGINT, 18, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GOTGINTBase> ;
     using DBCDNE = OTG_HS_GLOBAL_OTG_HS_GOTGINT_DBCDNE_Values<OTG_HS_GLOBAL::OTG_HS_GOTGINT, 19, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GOTGINTBase> ;
+    static constexpr Type SnapshotMask = 0xE0304U ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GOTGINT_DBCDNE_Values<OTG_HS_GLOBAL::OTG_HS_GOTGINT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct OTG_HS_GLOBAL
     using DMAEN = OTG_HS_GLOBAL_OTG_HS_GAHBCFG_DMAEN_Values<OTG_HS_GLOBAL::OTG_HS_GAHBCFG, 5, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GAHBCFGBase> ;
     using TXFELVL = OTG_HS_GLOBAL_OTG_HS_GAHBCFG_TXFELVL_Values<OTG_HS_GLOBAL::OTG_HS_GAHBCFG, 7, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GAHBCFGBase> ;
     using PTXFELVL = OTG_HS_GLOBAL_OTG_HS_GAHBCFG_PTXFELVL_Values<OTG_HS_GLOBAL::OTG_HS_GAHBCFG, 8, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GAHBCFGBase> ;
+    static constexpr Type SnapshotMask = 0x1BFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GAHBCFG_PTXFELVL_Values<OTG_HS_GLOBAL::OTG_HS_GAHBCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +93,7 @@ struct OTG_HS_GLOBAL
     using FHMOD = OTG_HS_GLOBAL_OTG_HS_GUSBCFG_FHMOD_Values<OTG_HS_GLOBAL::OTG_HS_GUSBCFG, 29, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GUSBCFGBase> ;
     using FDMOD = OTG_HS_GLOBAL_OTG_HS_GUSBCFG_FDMOD_Values<OTG_HS_GLOBAL::OTG_HS_GUSBCFG, 30, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GUSBCFGBase> ;
     using CTXPKT = OTG_HS_GLOBAL_OTG_HS_GUSBCFG_CTXPKT_Values<OTG_HS_GLOBAL::OTG_HS_GUSBCFG, 31, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GUSBCFGBase> ;
+    static constexpr Type SnapshotMask = 0xE3FEBF47U ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GUSBCFG_CTXPKT_Values<OTG_HS_GLOBAL::OTG_HS_GUSBCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +112,7 @@ struct OTG_HS_GLOBAL
     using TXFNUM = OTG_HS_GLOBAL_OTG_HS_GRSTCTL_TXFNUM_Values<OTG_HS_GLOBAL::OTG_HS_GRSTCTL, 6, 5, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GRSTCTLBase> ;
     using DMAREQ = OTG_HS_GLOBAL_OTG_HS_GRSTCTL_DMAREQ_Values<OTG_HS_GLOBAL::OTG_HS_GRSTCTL, 30, 1, ReadMode, OTG_HS_GLOBALOTG_HS_GRSTCTLBase> ;
     using AHBIDL = OTG_HS_GLOBAL_OTG_HS_GRSTCTL_AHBIDL_Values<OTG_HS_GLOBAL::OTG_HS_GRSTCTL, 31, 1, ReadMode, OTG_HS_GLOBALOTG_HS_GRSTCTLBase> ;
+    static constexpr Type SnapshotMask = 0x7F7U ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GRSTCTL_AHBIDL_Values<OTG_HS_GLOBAL::OTG_HS_GRSTCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -144,6 +149,7 @@ struct OTG_HS_GLOBAL
     using DISCINT = OTG_HS_GLOBAL_OTG_HS_GINTSTS_DISCINT_Values<OTG_HS_GLOBAL::OTG_HS_GINTSTS, 29, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GINTSTSBase> ;
     using SRQINT = OTG_HS_GLOBAL_OTG_HS_GINTSTS_SRQINT_Values<OTG_HS_GLOBAL::OTG_HS_GINTSTS, 30, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GINTSTSBase> ;
     using WKUINT = OTG_HS_GLOBAL_OTG_HS_GINTSTS_WKUINT_Values<OTG_HS_GLOBAL::OTG_HS_GINTSTS, 31, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GINTSTSBase> ;
+    static constexpr Type SnapshotMask = 0xF070FC0AU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GINTSTS_WKUINT_Values<OTG_HS_GLOBAL::OTG_HS_GINTSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +186,7 @@ struct OTG_HS_GLOBAL
     using DISCINT = OTG_HS_GLOBAL_OTG_HS_GINTMSK_DISCINT_Values<OTG_HS_GLOBAL::OTG_HS_GINTMSK, 29, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GINTMSKBase> ;
     using SRQIM = OTG_HS_GLOBAL_OTG_HS_GINTMSK_SRQIM_Values<OTG_HS_GLOBAL::OTG_HS_GINTMSK, 30, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GINTMSKBase> ;
     using WUIM = OTG_HS_GLOBAL_OTG_HS_GINTMSK_WUIM_Values<OTG_HS_GLOBAL::OTG_HS_GINTMSK, 31, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GINTMSKBase> ;
+    static constexpr Type SnapshotMask = 0xF67EFCFEU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GINTMSK_WUIM_Values<OTG_HS_GLOBAL::OTG_HS_GINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +226,7 @@ struct OTG_HS_GLOBAL
   struct OTG_HS_GRXFSIZ : public RegisterBase<0x40040024, 32, ReadWriteMode>
   {
     using RXFD = OTG_HS_GLOBAL_OTG_HS_GRXFSIZ_RXFD_Values<OTG_HS_GLOBAL::OTG_HS_GRXFSIZ, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GRXFSIZBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GRXFSIZ_RXFD_Values<OTG_HS_GLOBAL::OTG_HS_GRXFSIZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -231,6 +239,7 @@ struct OTG_HS_GLOBAL
   {
     using NPTXFSA = OTG_HS_GLOBAL_OTG_HS_GNPTXFSIZ_Host_NPTXFSA_Values<OTG_HS_GLOBAL::OTG_HS_GNPTXFSIZ_Host, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GNPTXFSIZ_HostBase> ;
     using NPTXFD = OTG_HS_GLOBAL_OTG_HS_GNPTXFSIZ_Host_NPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_GNPTXFSIZ_Host, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GNPTXFSIZ_HostBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GNPTXFSIZ_Host_NPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_GNPTXFSIZ_Host, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -243,6 +252,7 @@ struct OTG_HS_GLOBAL
   {
     using TX0FSA = OTG_HS_GLOBAL_OTG_HS_TX0FSIZ_Peripheral_TX0FSA_Values<OTG_HS_GLOBAL::OTG_HS_TX0FSIZ_Peripheral, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_TX0FSIZ_PeripheralBase> ;
     using TX0FD = OTG_HS_GLOBAL_OTG_HS_TX0FSIZ_Peripheral_TX0FD_Values<OTG_HS_GLOBAL::OTG_HS_TX0FSIZ_Peripheral, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_TX0FSIZ_PeripheralBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_TX0FSIZ_Peripheral_TX0FD_Values<OTG_HS_GLOBAL::OTG_HS_TX0FSIZ_Peripheral, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,6 +282,7 @@ struct OTG_HS_GLOBAL
     using VBUSBSEN = OTG_HS_GLOBAL_OTG_HS_GCCFG_VBUSBSEN_Values<OTG_HS_GLOBAL::OTG_HS_GCCFG, 19, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GCCFGBase> ;
     using SOFOUTEN = OTG_HS_GLOBAL_OTG_HS_GCCFG_SOFOUTEN_Values<OTG_HS_GLOBAL::OTG_HS_GCCFG, 20, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GCCFGBase> ;
     using NOVBUSSENS = OTG_HS_GLOBAL_OTG_HS_GCCFG_NOVBUSSENS_Values<OTG_HS_GLOBAL::OTG_HS_GCCFG, 21, 1, ReadWriteMode, OTG_HS_GLOBALOTG_HS_GCCFGBase> ;
+    static constexpr Type SnapshotMask = 0x3F0000U ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_GCCFG_NOVBUSSENS_Values<OTG_HS_GLOBAL::OTG_HS_GCCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -283,6 +294,7 @@ struct OTG_HS_GLOBAL
   struct OTG_HS_CID : public RegisterBase<0x4004003C, 32, ReadWriteMode>
   {
     using PRODUCT_ID = OTG_HS_GLOBAL_OTG_HS_CID_PRODUCT_ID_Values<OTG_HS_GLOBAL::OTG_HS_CID, 0, 32, ReadWriteMode, OTG_HS_GLOBALOTG_HS_CIDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_CID_PRODUCT_ID_Values<OTG_HS_GLOBAL::OTG_HS_CID, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -295,6 +307,7 @@ struct OTG_HS_GLOBAL
   {
     using PTXSA = OTG_HS_GLOBAL_OTG_HS_HPTXFSIZ_PTXSA_Values<OTG_HS_GLOBAL::OTG_HS_HPTXFSIZ, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_HPTXFSIZBase> ;
     using PTXFD = OTG_HS_GLOBAL_OTG_HS_HPTXFSIZ_PTXFD_Values<OTG_HS_GLOBAL::OTG_HS_HPTXFSIZ, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_HPTXFSIZBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_HPTXFSIZ_PTXFD_Values<OTG_HS_GLOBAL::OTG_HS_HPTXFSIZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,6 +320,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF1_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF1, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF1Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF1_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF1, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF1_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -319,6 +333,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF2_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF2, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF2Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF2_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF2, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF2_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -331,6 +346,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF3_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF3, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF3Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF3_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF3, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF3_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -343,6 +359,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF4_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF4, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF4Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF4_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF4, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF4_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -355,6 +372,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF5_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF5, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF5Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF5_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF5, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF5_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -367,6 +385,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF6_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF6, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF6Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF6_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF6, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF6_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +398,7 @@ struct OTG_HS_GLOBAL
   {
     using INEPTXSA = OTG_HS_GLOBAL_OTG_HS_DIEPTXF7_INEPTXSA_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF7, 0, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF7Base> ;
     using INEPTXFD = OTG_HS_GLOBAL_OTG_HS_DIEPTXF7_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF7, 16, 16, ReadWriteMode, OTG_HS_GLOBALOTG_HS_DIEPTXF7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_GLOBAL_OTG_HS_DIEPTXF7_INEPTXFD_Values<OTG_HS_GLOBAL::OTG_HS_DIEPTXF7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -415,6 +435,7 @@ struct OTG_HS_GLOBAL
   template<typename... T> 
   using OTG_HS_GRXSTSP_PeripheralPack  = Register<0x40040020, 32, ReadMode, OTG_HS_GLOBALOTG_HS_GRXSTSP_PeripheralBase, T...> ;
 
+  using Registers = TypesList<OTG_HS_GLOBAL::OTG_HS_GOTGCTL, OTG_HS_GLOBAL::OTG_HS_GOTGINT, OTG_HS_GLOBAL::OTG_HS_GAHBCFG, OTG_HS_GLOBAL::OTG_HS_GUSBCFG, OTG_HS_GLOBAL::OTG_HS_GRSTCTL, OTG_HS_GLOBAL::OTG_HS_GINTSTS, OTG_HS_GLOBAL::OTG_HS_GINTMSK, OTG_HS_GLOBAL::OTG_HS_GRXSTSR_Host, OTG_HS_GLOBAL::OTG_HS_GRXSTSP_Host, OTG_HS_GLOBAL::OTG_HS_GRXFSIZ, OTG_HS_GLOBAL::OTG_HS_GNPTXFSIZ_Host, OTG_HS_GLOBAL::OTG_HS_TX0FSIZ_Peripheral, OTG_HS_GLOBAL::OTG_HS_GNPTXSTS, OTG_HS_GLOBAL::OTG_HS_GCCFG, OTG_HS_GLOBAL::OTG_HS_CID, OTG_HS_GLOBAL::OTG_HS_HPTXFSIZ, OTG_HS_GLOBAL::OTG_HS_DIEPTXF1, OTG_HS_GLOBAL::OTG_HS_DIEPTXF2, OTG_HS_GLOBAL::OTG_HS_DIEPTXF3, OTG_HS_GLOBAL::OTG_HS_DIEPTXF4, OTG_HS_GLOBAL::OTG_HS_DIEPTXF5, OTG_HS_GLOBAL::OTG_HS_DIEPTXF6, OTG_HS_GLOBAL::OTG_HS_DIEPTXF7, OTG_HS_GLOBAL::OTG_HS_GRXSTSR_Peripheral, OTG_HS_GLOBAL::OTG_HS_GRXSTSP_Peripheral> ;
 } ;
 
 #endif //#if !defined(OTGHSGLOBALREGISTERS_HPP)
@@ -23,6 +23,7 @@ struct OTG_HS_HOST
   {
     using FSLSPCS = OTG_HS_HOST_OTG_HS_HCFG_FSLSPCS_Values<OTG_HS_HOST::OTG_HS_HCFG, 0, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCFGBase> ;
     using FSLSS = OTG_HS_HOST_OTG_HS_HCFG_FSLSS_Values<OTG_HS_HOST::OTG_HS_HCFG, 2, 1, ReadMode, OTG_HS_HOSTOTG_HS_HCFGBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCFG_FSLSS_Values<OTG_HS_HOST::OTG_HS_HCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -34,6 +35,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HFIR : public RegisterBase<0x40040404, 32, ReadWriteMode>
   {
     using FRIVL = OTG_HS_HOST_OTG_HS_HFIR_FRIVL_Values<OTG_HS_HOST::OTG_HS_HFIR, 0, 16, ReadWriteMode, OTG_HS_HOSTOTG_HS_HFIRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HFIR_FRIVL_Values<OTG_HS_HOST::OTG_HS_HFIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +61,7 @@ struct OTG_HS_HOST
     using PTXFSAVL = OTG_HS_HOST_OTG_HS_HPTXSTS_PTXFSAVL_Values<OTG_HS_HOST::OTG_HS_HPTXSTS, 0, 16, ReadWriteMode, OTG_HS_HOSTOTG_HS_HPTXSTSBase> ;
     using PTXQSAV = OTG_HS_HOST_OTG_HS_HPTXSTS_PTXQSAV_Values<OTG_HS_HOST::OTG_HS_HPTXSTS, 16, 8, ReadMode, OTG_HS_HOSTOTG_HS_HPTXSTSBase> ;
     using PTXQTOP = OTG_HS_HOST_OTG_HS_HPTXSTS_PTXQTOP_Values<OTG_HS_HOST::OTG_HS_HPTXSTS, 24, 8, ReadMode, OTG_HS_HOSTOTG_HS_HPTXSTSBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HPTXSTS_PTXQTOP_Values<OTG_HS_HOST::OTG_HS_HPTXSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +84,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HAINTMSK : public RegisterBase<0x40040418, 32, ReadWriteMode>
   {
     using HAINTM = OTG_HS_HOST_OTG_HS_HAINTMSK_HAINTM_Values<OTG_HS_HOST::OTG_HS_HAINTMSK, 0, 16, ReadWriteMode, OTG_HS_HOSTOTG_HS_HAINTMSKBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HAINTMSK_HAINTM_Values<OTG_HS_HOST::OTG_HS_HAINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +108,7 @@ struct OTG_HS_HOST
     using PPWR = OTG_HS_HOST_OTG_HS_HPRT_PPWR_Values<OTG_HS_HOST::OTG_HS_HPRT, 12, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HPRTBase> ;
     using PTCTL = OTG_HS_HOST_OTG_HS_HPRT_PTCTL_Values<OTG_HS_HOST::OTG_HS_HPRT, 13, 4, ReadWriteMode, OTG_HS_HOSTOTG_HS_HPRTBase> ;
     using PSPD = OTG_HS_HOST_OTG_HS_HPRT_PSPD_Values<OTG_HS_HOST::OTG_HS_HPRT, 17, 2, ReadMode, OTG_HS_HOSTOTG_HS_HPRTBase> ;
+    static constexpr Type SnapshotMask = 0x1F1EEU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HPRT_PSPD_Values<OTG_HS_HOST::OTG_HS_HPRT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +129,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR0_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR0, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR0Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR0_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR0, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR0Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR0_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR0, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR0_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -144,6 +150,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR1_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR1, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR1Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR1_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR1, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR1Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR1_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR1, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR1_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +171,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR2_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR2, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR2Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR2_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR2, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR2Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR2_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR2, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR2_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -184,6 +192,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR3_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR3, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR3Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR3_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR3, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR3Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR3_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR3, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR3_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -204,6 +213,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR4_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR4, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR4Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR4_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR4, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR4Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR4_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR4, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR4_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +234,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR5_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR5, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR5Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR5_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR5, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR5Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR5_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR5, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR5_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -244,6 +255,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR6_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR6, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR6Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR6_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR6, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR6Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR6_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR6, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR6_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +276,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR7_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR7, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR7Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR7_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR7, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR7Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR7_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR7, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR7_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +297,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR8_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR8, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR8Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR8_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR8, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR8Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR8_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR8, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR8Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR8_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -304,6 +318,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR9_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR9, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR9Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR9_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR9, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR9Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR9_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR9, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR9Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR9_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -324,6 +339,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR10_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR10, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR10Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR10_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR10, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR10Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR10_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR10, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR10Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR10_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -344,6 +360,7 @@ struct OTG_HS_HOST
     using ODDFRM = OTG_HS_HOST_OTG_HS_HCCHAR11_ODDFRM_Values<OTG_HS_HOST::OTG_HS_HCCHAR11, 29, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR11Base> ;
     using CHDIS = OTG_HS_HOST_OTG_HS_HCCHAR11_CHDIS_Values<OTG_HS_HOST::OTG_HS_HCCHAR11, 30, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR11Base> ;
     using CHENA = OTG_HS_HOST_OTG_HS_HCCHAR11_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR11, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCCHAR11Base> ;
+    static constexpr Type SnapshotMask = 0xFFFEFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCCHAR11_CHENA_Values<OTG_HS_HOST::OTG_HS_HCCHAR11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -359,6 +376,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT0_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT0, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT0Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT0_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT0, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT0Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT0_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT0, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT0Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT0_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -374,6 +392,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT1_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT1, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT1Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT1_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT1, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT1Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT1_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT1, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT1Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT1_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -389,6 +408,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT2_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT2, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT2Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT2_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT2, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT2Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT2_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT2, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT2Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT2_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -404,6 +424,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT3_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT3, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT3Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT3_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT3, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT3Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT3_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT3, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT3Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT3_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -419,6 +440,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT4_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT4, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT4Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT4_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT4, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT4Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT4_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT4, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT4Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT4_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -434,6 +456,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT5_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT5, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT5Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT5_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT5, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT5Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT5_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT5, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT5Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT5_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -449,6 +472,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT6_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT6, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT6Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT6_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT6, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT6Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT6_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT6, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT6Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT6_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -464,6 +488,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT7_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT7, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT7Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT7_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT7, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT7Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT7_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT7, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT7Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT7_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -479,6 +504,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT8_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT8, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT8Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT8_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT8, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT8Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT8_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT8, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT8Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT8_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -494,6 +520,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT9_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT9, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT9Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT9_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT9, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT9Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT9_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT9, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT9Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT9_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -509,6 +536,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT10_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT10, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT10Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT10_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT10, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT10Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT10_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT10, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT10Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT10_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -524,6 +552,7 @@ struct OTG_HS_HOST
     using XACTPOS = OTG_HS_HOST_OTG_HS_HCSPLT11_XACTPOS_Values<OTG_HS_HOST::OTG_HS_HCSPLT11, 14, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT11Base> ;
     using COMPLSPLT = OTG_HS_HOST_OTG_HS_HCSPLT11_COMPLSPLT_Values<OTG_HS_HOST::OTG_HS_HCSPLT11, 16, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT11Base> ;
     using SPLITEN = OTG_HS_HOST_OTG_HS_HCSPLT11_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT11, 31, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCSPLT11Base> ;
+    static constexpr Type SnapshotMask = 0x8001FFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCSPLT11_SPLITEN_Values<OTG_HS_HOST::OTG_HS_HCSPLT11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -545,6 +574,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT0_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT0, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT0Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT0_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT0, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT0Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT0_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT0, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT0Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT0_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -566,6 +596,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT1_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT1, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT1Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT1_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT1, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT1Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT1_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT1, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT1_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -587,6 +618,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT2_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT2, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT2Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT2_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT2, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT2Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT2_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT2, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT2_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -608,6 +640,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT3_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT3, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT3Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT3_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT3, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT3Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT3_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT3, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT3_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -629,6 +662,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT4_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT4, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT4Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT4_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT4, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT4Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT4_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT4, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT4_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -650,6 +684,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT5_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT5, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT5Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT5_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT5, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT5Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT5_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT5, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT5_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -671,6 +706,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT6_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT6, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT6Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT6_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT6, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT6Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT6_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT6, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT6Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT6_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -692,6 +728,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT7_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT7, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT7Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT7_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT7, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT7Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT7_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT7, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT7Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT7_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -713,6 +750,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT8_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT8, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT8Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT8_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT8, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT8Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT8_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT8, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT8Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT8_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -734,6 +772,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT9_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT9, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT9Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT9_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT9, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT9Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT9_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT9, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT9Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT9_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -755,6 +794,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT10_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT10, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT10Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT10_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT10, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT10Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT10_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT10, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT10Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT10_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +816,7 @@ struct OTG_HS_HOST
     using BBERR = OTG_HS_HOST_OTG_HS_HCINT11_BBERR_Values<OTG_HS_HOST::OTG_HS_HCINT11, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT11Base> ;
     using FRMOR = OTG_HS_HOST_OTG_HS_HCINT11_FRMOR_Values<OTG_HS_HOST::OTG_HS_HCINT11, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT11Base> ;
     using DTERR = OTG_HS_HOST_OTG_HS_HCINT11_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT11, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINT11Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINT11_DTERR_Values<OTG_HS_HOST::OTG_HS_HCINT11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -797,6 +838,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK0_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK0, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK0Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK0_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK0, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK0Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK0_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK0, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK0Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK0_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -818,6 +860,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK1_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK1, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK1Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK1_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK1, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK1Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK1_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK1, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK1_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -839,6 +882,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK2_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK2, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK2Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK2_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK2, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK2Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK2_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK2, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK2_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -860,6 +904,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK3_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK3, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK3Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK3_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK3, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK3Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK3_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK3, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK3_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -881,6 +926,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK4_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK4, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK4Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK4_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK4, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK4Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK4_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK4, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK4_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -902,6 +948,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK5_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK5, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK5Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK5_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK5, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK5Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK5_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK5, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK5_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -923,6 +970,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK6_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK6, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK6Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK6_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK6, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK6Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK6_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK6, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK6Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK6_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -944,6 +992,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK7_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK7, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK7Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK7_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK7, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK7Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK7_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK7, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK7Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK7_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -965,6 +1014,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK8_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK8, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK8Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK8_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK8, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK8Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK8_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK8, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK8Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK8_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -986,6 +1036,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK9_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK9, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK9Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK9_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK9, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK9Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK9_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK9, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK9Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK9_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1007,6 +1058,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK10_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK10, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK10Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK10_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK10, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK10Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK10_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK10, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK10Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK10_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1028,6 +1080,7 @@ struct OTG_HS_HOST
     using BBERRM = OTG_HS_HOST_OTG_HS_HCINTMSK11_BBERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK11, 8, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK11Base> ;
     using FRMORM = OTG_HS_HOST_OTG_HS_HCINTMSK11_FRMORM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK11, 9, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK11Base> ;
     using DTERRM = OTG_HS_HOST_OTG_HS_HCINTMSK11_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK11, 10, 1, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCINTMSK11Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCINTMSK11_DTERRM_Values<OTG_HS_HOST::OTG_HS_HCINTMSK11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1041,6 +1094,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ0_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ0, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ0Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ0_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ0, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ0Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ0_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ0, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ0Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ0_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1054,6 +1108,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ1_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ1, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ1Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ1_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ1, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ1Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ1_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ1, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ1_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1067,6 +1122,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ2_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ2, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ2Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ2_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ2, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ2Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ2_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ2, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ2_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1080,6 +1136,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ3_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ3, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ3Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ3_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ3, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ3Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ3_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ3, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ3_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1093,6 +1150,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ4_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ4, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ4Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ4_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ4, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ4Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ4_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ4, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ4_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1106,6 +1164,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ5_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ5, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ5Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ5_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ5, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ5Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ5_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ5, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ5_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1119,6 +1178,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ6_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ6, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ6Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ6_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ6, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ6Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ6_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ6, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ6Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ6_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1132,6 +1192,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ7_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ7, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ7Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ7_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ7, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ7Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ7_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ7, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ7Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ7_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1145,6 +1206,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ8_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ8, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ8Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ8_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ8, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ8Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ8_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ8, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ8Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ8_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1158,6 +1220,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ9_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ9, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ9Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ9_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ9, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ9Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ9_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ9, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ9Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ9_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1171,6 +1234,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ10_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ10, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ10Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ10_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ10, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ10Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ10_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ10, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ10Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ10_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1184,6 +1248,7 @@ struct OTG_HS_HOST
     using XFRSIZ = OTG_HS_HOST_OTG_HS_HCTSIZ11_XFRSIZ_Values<OTG_HS_HOST::OTG_HS_HCTSIZ11, 0, 19, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ11Base> ;
     using PKTCNT = OTG_HS_HOST_OTG_HS_HCTSIZ11_PKTCNT_Values<OTG_HS_HOST::OTG_HS_HCTSIZ11, 19, 10, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ11Base> ;
     using DPID = OTG_HS_HOST_OTG_HS_HCTSIZ11_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ11, 29, 2, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCTSIZ11Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCTSIZ11_DPID_Values<OTG_HS_HOST::OTG_HS_HCTSIZ11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1195,6 +1260,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA0 : public RegisterBase<0x40040514, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA0_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA0, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA0_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1206,6 +1272,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA1 : public RegisterBase<0x40040534, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA1_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA1, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA1_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1217,6 +1284,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA2 : public RegisterBase<0x40040554, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA2_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA2, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA2_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1228,6 +1296,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA3 : public RegisterBase<0x40040574, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA3_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA3, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA3_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1239,6 +1308,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA4 : public RegisterBase<0x40040594, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA4_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA4, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA4_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1250,6 +1320,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA5 : public RegisterBase<0x400405B4, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA5_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA5, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA5_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1261,6 +1332,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA6 : public RegisterBase<0x400405D4, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA6_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA6, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA6_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1272,6 +1344,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA7 : public RegisterBase<0x400405F4, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA7_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA7, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA7_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1283,6 +1356,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA8 : public RegisterBase<0x40040614, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA8_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA8, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA8Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA8_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA8, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1294,6 +1368,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA9 : public RegisterBase<0x40040634, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA9_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA9, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA9Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA9_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA9, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1305,6 +1380,7 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA10 : public RegisterBase<0x40040654, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA10_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA10, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA10Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA10_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA10, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1316,12 +1392,14 @@ struct OTG_HS_HOST
   struct OTG_HS_HCDMA11 : public RegisterBase<0x40040674, 32, ReadWriteMode>
   {
     using DMAADDR = OTG_HS_HOST_OTG_HS_HCDMA11_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA11, 0, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA11Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = OTG_HS_HOST_OTG_HS_HCDMA11_DMAADDR_Values<OTG_HS_HOST::OTG_HS_HCDMA11, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OTG_HS_HCDMA11Pack  = Register<0x40040674, 32, ReadWriteMode, OTG_HS_HOSTOTG_HS_HCDMA11Base, T...> ;
 
+  using Registers = TypesList<OTG_HS_HOST::OTG_HS_HCFG, OTG_HS_HOST::OTG_HS_HFIR, OTG_HS_HOST::OTG_HS_HFNUM, OTG_HS_HOST::OTG_HS_HPTXSTS, OTG_HS_HOST::OTG_HS_HAINT, OTG_HS_HOST::OTG_HS_HAINTMSK, OTG_HS_HOST::OTG_HS_HPRT, OTG_HS_HOST::OTG_HS_HCCHAR0, OTG_HS_HOST::OTG_HS_HCCHAR1, OTG_HS_HOST::OTG_HS_HCCHAR2, OTG_HS_HOST::OTG_HS_HCCHAR3, OTG_HS_HOST::OTG_HS_HCCHAR4, OTG_HS_HOST::OTG_HS_HCCHAR5, OTG_HS_HOST::OTG_HS_HCCHAR6, OTG_HS_HOST::OTG_HS_HCCHAR7, OTG_HS_HOST::OTG_HS_HCCHAR8, OTG_HS_HOST::OTG_HS_HCCHAR9, OTG_HS_HOST::OTG_HS_HCCHAR10, OTG_HS_HOST::OTG_HS_HCCHAR11, OTG_HS_HOST::OTG_HS_HCSPLT0, OTG_HS_HOST::OTG_HS_HCSPLT1, OTG_HS_HOST::OTG_HS_HCSPLT2, OTG_HS_HOST::OTG_HS_HCSPLT3, OTG_HS_HOST::OTG_HS_HCSPLT4, OTG_HS_HOST::OTG_HS_HCSPLT5, OTG_HS_HOST::OTG_HS_HCSPLT6, OTG_HS_HOST::OTG_HS_HCSPLT7, OTG_HS_HOST::OTG_HS_HCSPLT8, OTG_HS_HOST::OTG_HS_HCSPLT9, OTG_HS_HOST::OTG_HS_HCSPLT10, OTG_HS_HOST::OTG_HS_HCSPLT11, OTG_HS_HOST::OTG_HS_HCINT0, OTG_HS_HOST::OTG_HS_HCINT1, OTG_HS_HOST::OTG_HS_HCINT2, OTG_HS_HOST::OTG_HS_HCINT3, OTG_HS_HOST::OTG_HS_HCINT4, OTG_HS_HOST::OTG_HS_HCINT5, OTG_HS_HOST::OTG_HS_HCINT6, OTG_HS_HOST::OTG_HS_HCINT7, OTG_HS_HOST::OTG_HS_HCINT8, OTG_HS_HOST::OTG_HS_HCINT9, OTG_HS_HOST::OTG_HS_HCINT10, OTG_HS_HOST::OTG_HS_HCINT11, OTG_HS_HOST::OTG_HS_HCINTMSK0, OTG_HS_HOST::OTG_HS_HCINTMSK1, OTG_HS_HOST::OTG_HS_HCINTMSK2, OTG_HS_HOST::OTG_HS_HCINTMSK3, OTG_HS_HOST::OTG_HS_HCINTMSK4, OTG_HS_HOST::OTG_HS_HCINTMSK5, OTG_HS_HOST::OTG_HS_HCINTMSK6, OTG_HS_HOST::OTG_HS_HCINTMSK7, OTG_HS_HOST::OTG_HS_HCINTMSK8, OTG_HS_HOST::OTG_HS_HCINTMSK9, OTG_HS_HOST::OTG_HS_HCINTMSK10, OTG_HS_HOST::OTG_HS_HCINTMSK11, OTG_HS_HOST::OTG_HS_HCTSIZ0, OTG_HS_HOST::OTG_HS_HCTSIZ1, OTG_HS_HOST::OTG_HS_HCTSIZ2, OTG_HS_HOST::OTG_HS_HCTSIZ3, OTG_HS_HOST::OTG_HS_HCTSIZ4, OTG_HS_HOST::OTG_HS_HCTSIZ5, OTG_HS_HOST::OTG_HS_HCTSIZ6, OTG_HS_HOST::OTG_HS_HCTSIZ7, OTG_HS_HOST::OTG_HS_HCTSIZ8, OTG_HS_HOST::OTG_HS_HCTSIZ9, OTG_HS_HOST::OTG_HS_HCTSIZ10, OTG_HS_HOST::OTG_HS_HCTSIZ11, OTG_HS_HOST::OTG_HS_HCDMA0, OTG_HS_HOST::OTG_HS_HCDMA1, OTG_HS_HOST::OTG_HS_HCDMA2, OTG_HS_HOST::OTG_HS_HCDMA3, OTG_HS_HOST::OTG_HS_HCDMA4, OTG_HS_HOST::OTG_HS_HCDMA5, OTG_HS_HOST::OTG_HS_HCDMA6, OTG_HS_HOST::OTG_HS_HCDMA7, OTG_HS_HOST::OTG_HS_HCDMA8, OTG_HS_HOST::OTG_HS_HCDMA9, OTG_HS_HOST::OTG_HS_HCDMA10, OTG_HS_HOST::OTG_HS_HCDMA11> ;
 } ;
 
 #endif //#if !defined(OTGHSHOSTREGISTERS_HPP)
@@ -24,12 +24,14 @@ struct OTG_HS_PWRCLK
     using STPPCLK = OTG_HS_PWRCLK_OTG_HS_PCGCR_STPPCLK_Values<OTG_HS_PWRCLK::OTG_HS_PCGCR, 0, 1, ReadWriteMode, OTG_HS_PWRCLKOTG_HS_PCGCRBase> ;
     using GATEHCLK = OTG_HS_PWRCLK_OTG_HS_PCGCR_GATEHCLK_Values<OTG_HS_PWRCLK::OTG_HS_PCGCR, 1, 1, ReadWriteMode, OTG_HS_PWRCLKOTG_HS_PCGCRBase> ;
     using PHYSUSP = OTG_HS_PWRCLK_OTG_HS_PCGCR_PHYSUSP_Values<OTG_HS_PWRCLK::OTG_HS_PCGCR, 4, 1, ReadWriteMode, OTG_HS_PWRCLKOTG_HS_PCGCRBase> ;
+    static constexpr Type SnapshotMask = 0x13U ;
     using FieldValues = OTG_HS_PWRCLK_OTG_HS_PCGCR_PHYSUSP_Values<OTG_HS_PWRCLK::OTG_HS_PCGCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OTG_HS_PCGCRPack  = Register<0x40040E00, 32, ReadWriteMode, OTG_HS_PWRCLKOTG_HS_PCGCRBase, T...> ;
 
+  using Registers = TypesList<OTG_HS_PWRCLK::OTG_HS_PCGCR> ;
 } ;
 
 #endif //#if !defined(OTGHSPWRCLKREGISTERS_HPP)
@@ -29,6 +29,7 @@ struct PWR
     using CWUF = PWR_CR_CWUF_Values<PWR::CR, 2, 1, ReadWriteMode, PWRCRBase> ;
     using PDDS = PWR_CR_PDDS_Values<PWR::CR, 1, 1, ReadWriteMode, PWRCRBase> ;
     using LPDS = PWR_CR_LPDS_Values<PWR::CR, 0, 1, ReadWriteMode, PWRCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = PWR_CR_LPDS_Values<PWR::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,12 +47,14 @@ struct PWR
     using EWUP = PWR_CSR_EWUP_Values<PWR::CSR, 8, 1, ReadWriteMode, PWRCSRBase> ;
     using BRE = PWR_CSR_BRE_Values<PWR::CSR, 9, 1, ReadWriteMode, PWRCSRBase> ;
     using VOSRDY = PWR_CSR_VOSRDY_Values<PWR::CSR, 14, 1, ReadWriteMode, PWRCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = PWR_CSR_VOSRDY_Values<PWR::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSRPack  = Register<0x40007004, 32, ReadWriteMode, PWRCSRBase, T...> ;
 
+  using Registers = TypesList<PWR::CR, PWR::CSR> ;
 } ;
 
 #endif //#if !defined(PWRREGISTERS_HPP)
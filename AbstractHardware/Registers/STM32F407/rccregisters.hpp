@@ -33,6 +33,7 @@ struct RCC
     using HSITRIM = RCC_CR_HSITRIM_Values<RCC::CR, 3, 5, ReadWriteMode, RCCCRBase> ;
     using HSIRDY = RCC_CR_HSIRDY_Values<RCC::CR, 1, 1, ReadMode, RCCCRBase> ;
     using HSION = RCC_CR_HSION_Values<RCC::CR, 0, 1, ReadWriteMode, RCCCRBase> ;
+    static constexpr Type SnapshotMask = 0x50D00F9U ;
     using FieldValues = RCC_CR_HSION_Values<RCC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +66,7 @@ struct RCC
     using PLLM2 = RCC_PLLCFGR_PLLM2_Values<RCC::PLLCFGR, 2, 1, ReadWriteMode, RCCPLLCFGRBase> ;
     using PLLM1 = RCC_PLLCFGR_PLLM1_Values<RCC::PLLCFGR, 1, 1, ReadWriteMode, RCCPLLCFGRBase> ;
     using PLLM0 = RCC_PLLCFGR_PLLM0_Values<RCC::PLLCFGR, 0, 1, ReadWriteMode, RCCPLLCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xF437FFFU ;
     using FieldValues = RCC_PLLCFGR_PLLM0_Values<RCC::PLLCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +90,7 @@ struct RCC
     using SWS0 = RCC_CFGR_SWS0_Values<RCC::CFGR, 2, 1, ReadMode, RCCCFGRBase> ;
     using SW1 = RCC_CFGR_SW1_Values<RCC::CFGR, 1, 1, ReadWriteMode, RCCCFGRBase> ;
     using SW0 = RCC_CFGR_SW0_Values<RCC::CFGR, 0, 1, ReadWriteMode, RCCCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFCF3U ;
     using FieldValues = RCC_CFGR_SW0_Values<RCC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +121,7 @@ struct RCC
     using HSIRDYF = RCC_CIR_HSIRDYF_Values<RCC::CIR, 2, 1, ReadMode, RCCCIRBase> ;
     using LSERDYF = RCC_CIR_LSERDYF_Values<RCC::CIR, 1, 1, ReadMode, RCCCIRBase> ;
     using LSIRDYF = RCC_CIR_LSIRDYF_Values<RCC::CIR, 0, 1, ReadMode, RCCCIRBase> ;
+    static constexpr Type SnapshotMask = 0xBF3F00U ;
     using FieldValues = RCC_CIR_LSIRDYF_Values<RCC::CIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +146,7 @@ struct RCC
     using GPIOCRST = RCC_AHB1RSTR_GPIOCRST_Values<RCC::AHB1RSTR, 2, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
     using GPIOBRST = RCC_AHB1RSTR_GPIOBRST_Values<RCC::AHB1RSTR, 1, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
     using GPIOARST = RCC_AHB1RSTR_GPIOARST_Values<RCC::AHB1RSTR, 0, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x226011FFU ;
     using FieldValues = RCC_AHB1RSTR_GPIOARST_Values<RCC::AHB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -155,6 +160,7 @@ struct RCC
     using OTGFSRST = RCC_AHB2RSTR_OTGFSRST_Values<RCC::AHB2RSTR, 7, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
     using RNGRST = RCC_AHB2RSTR_RNGRST_Values<RCC::AHB2RSTR, 6, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
     using DCMIRST = RCC_AHB2RSTR_DCMIRST_Values<RCC::AHB2RSTR, 0, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
+    static constexpr Type SnapshotMask = 0xC1U ;
     using FieldValues = RCC_AHB2RSTR_DCMIRST_Values<RCC::AHB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +172,7 @@ struct RCC
   struct AHB3RSTR : public RegisterBase<0x40023818, 32, ReadWriteMode>
   {
     using FSMCRST = RCC_AHB3RSTR_FSMCRST_Values<RCC::AHB3RSTR, 0, 1, ReadWriteMode, RCCAHB3RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = RCC_AHB3RSTR_FSMCRST_Values<RCC::AHB3RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -199,6 +206,7 @@ struct RCC
     using TIM4RST = RCC_APB1RSTR_TIM4RST_Values<RCC::APB1RSTR, 2, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using TIM3RST = RCC_APB1RSTR_TIM3RST_Values<RCC::APB1RSTR, 1, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using TIM2RST = RCC_APB1RSTR_TIM2RST_Values<RCC::APB1RSTR, 0, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x36FEC9FFU ;
     using FieldValues = RCC_APB1RSTR_TIM2RST_Values<RCC::APB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -220,6 +228,7 @@ struct RCC
     using USART1RST = RCC_APB2RSTR_USART1RST_Values<RCC::APB2RSTR, 4, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using TIM8RST = RCC_APB2RSTR_TIM8RST_Values<RCC::APB2RSTR, 1, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using TIM1RST = RCC_APB2RSTR_TIM1RST_Values<RCC::APB2RSTR, 0, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x75933U ;
     using FieldValues = RCC_APB2RSTR_TIM1RST_Values<RCC::APB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -249,6 +258,7 @@ struct RCC
     using GPIOCEN = RCC_AHB1ENR_GPIOCEN_Values<RCC::AHB1ENR, 2, 1, ReadWriteMode, RCCAHB1ENRBase> ;
     using GPIOBEN = RCC_AHB1ENR_GPIOBEN_Values<RCC::AHB1ENR, 1, 1, ReadWriteMode, RCCAHB1ENRBase> ;
     using GPIOAEN = RCC_AHB1ENR_GPIOAEN_Values<RCC::AHB1ENR, 0, 1, ReadWriteMode, RCCAHB1ENRBase> ;
+    static constexpr Type SnapshotMask = 0x7E6411FFU ;
     using FieldValues = RCC_AHB1ENR_GPIOAEN_Values<RCC::AHB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +272,7 @@ struct RCC
     using OTGFSEN = RCC_AHB2ENR_OTGFSEN_Values<RCC::AHB2ENR, 7, 1, ReadWriteMode, RCCAHB2ENRBase> ;
     using RNGEN = RCC_AHB2ENR_RNGEN_Values<RCC::AHB2ENR, 6, 1, ReadWriteMode, RCCAHB2ENRBase> ;
     using DCMIEN = RCC_AHB2ENR_DCMIEN_Values<RCC::AHB2ENR, 0, 1, ReadWriteMode, RCCAHB2ENRBase> ;
+    static constexpr Type SnapshotMask = 0xC1U ;
     using FieldValues = RCC_AHB2ENR_DCMIEN_Values<RCC::AHB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +284,7 @@ struct RCC
   struct AHB3ENR : public RegisterBase<0x40023838, 32, ReadWriteMode>
   {
     using FSMCEN = RCC_AHB3ENR_FSMCEN_Values<RCC::AHB3ENR, 0, 1, ReadWriteMode, RCCAHB3ENRBase> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = RCC_AHB3ENR_FSMCEN_Values<RCC::AHB3ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +318,7 @@ struct RCC
     using TIM4EN = RCC_APB1ENR_TIM4EN_Values<RCC::APB1ENR, 2, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using TIM3EN = RCC_APB1ENR_TIM3EN_Values<RCC::APB1ENR, 1, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using TIM2EN = RCC_APB1ENR_TIM2EN_Values<RCC::APB1ENR, 0, 1, ReadWriteMode, RCCAPB1ENRBase> ;
+    static constexpr Type SnapshotMask = 0x36FEC9FFU ;
     using FieldValues = RCC_APB1ENR_TIM2EN_Values<RCC::APB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +342,7 @@ struct RCC
     using USART1EN = RCC_APB2ENR_USART1EN_Values<RCC::APB2ENR, 4, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using TIM8EN = RCC_APB2ENR_TIM8EN_Values<RCC::APB2ENR, 1, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using TIM1EN = RCC_APB2ENR_TIM1EN_Values<RCC::APB2ENR, 0, 1, ReadWriteMode, RCCAPB2ENRBase> ;
+    static constexpr Type SnapshotMask = 0x75F33U ;
     using FieldValues = RCC_APB2ENR_TIM1EN_Values<RCC::APB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -361,6 +375,7 @@ struct RCC
     using GPIOCLPEN = RCC_AHB1LPENR_GPIOCLPEN_Values<RCC::AHB1LPENR, 2, 1, ReadWriteMode, RCCAHB1LPENRBase> ;
     using GPIOBLPEN = RCC_AHB1LPENR_GPIOBLPEN_Values<RCC::AHB1LPENR, 1, 1, ReadWriteMode, RCCAHB1LPENRBase> ;
     using GPIOALPEN = RCC_AHB1LPENR_GPIOALPEN_Values<RCC::AHB1LPENR, 0, 1, ReadWriteMode, RCCAHB1LPENRBase> ;
+    static constexpr Type SnapshotMask = 0x7E6791FFU ;
     using FieldValues = RCC_AHB1LPENR_GPIOALPEN_Values<RCC::AHB1LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -374,6 +389,7 @@ struct RCC
     using OTGFSLPEN = RCC_AHB2LPENR_OTGFSLPEN_Values<RCC::AHB2LPENR, 7, 1, ReadWriteMode, RCCAHB2LPENRBase> ;
     using RNGLPEN = RCC_AHB2LPENR_RNGLPEN_Values<RCC::AHB2LPENR, 6, 1, ReadWriteMode, RCCAHB2LPENRBase> ;
     using DCMILPEN = RCC_AHB2LPENR_DCMILPEN_Values<RCC::AHB2LPENR, 0, 1, ReadWriteMode, RCCAHB2LPENRBase> ;
+    static constexpr Type SnapshotMask = 0xC1U ;
     using FieldValues = RCC_AHB2LPENR_DCMILPEN_Values<RCC::AHB2LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -385,6 +401,7 @@ struct RCC
   struct AHB3LPENR : public RegisterBase<0x40023858, 32, ReadWriteMode>
   {
     using FSMCLPEN = RCC_AHB3LPENR_FSMCLPEN_Values<RCC::AHB3LPENR, 0, 1, ReadWriteMode, RCCAHB3LPENRBase> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = RCC_AHB3LPENR_FSMCLPEN_Values<RCC::AHB3LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -418,6 +435,7 @@ struct RCC
     using TIM4LPEN = RCC_APB1LPENR_TIM4LPEN_Values<RCC::APB1LPENR, 2, 1, ReadWriteMode, RCCAPB1LPENRBase> ;
     using TIM3LPEN = RCC_APB1LPENR_TIM3LPEN_Values<RCC::APB1LPENR, 1, 1, ReadWriteMode, RCCAPB1LPENRBase> ;
     using TIM2LPEN = RCC_APB1LPENR_TIM2LPEN_Values<RCC::APB1LPENR, 0, 1, ReadWriteMode, RCCAPB1LPENRBase> ;
+    static constexpr Type SnapshotMask = 0x36FEC9FFU ;
     using FieldValues = RCC_APB1LPENR_TIM2LPEN_Values<RCC::APB1LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -441,6 +459,7 @@ struct RCC
     using USART1LPEN = RCC_APB2LPENR_USART1LPEN_Values<RCC::APB2LPENR, 4, 1, ReadWriteMode, RCCAPB2LPENRBase> ;
     using TIM8LPEN = RCC_APB2LPENR_TIM8LPEN_Values<RCC::APB2LPENR, 1, 1, ReadWriteMode, RCCAPB2LPENRBase> ;
     using TIM1LPEN = RCC_APB2LPENR_TIM1LPEN_Values<RCC::APB2LPENR, 0, 1, ReadWriteMode, RCCAPB2LPENRBase> ;
+    static constexpr Type SnapshotMask = 0x75F33U ;
     using FieldValues = RCC_APB2LPENR_TIM1LPEN_Values<RCC::APB2LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -458,6 +477,7 @@ struct RCC
     using LSEBYP = RCC_BDCR_LSEBYP_Values<RCC::BDCR, 2, 1, ReadWriteMode, RCCBDCRBase> ;
     using LSERDY = RCC_BDCR_LSERDY_Values<RCC::BDCR, 1, 1, ReadMode, RCCBDCRBase> ;
     using LSEON = RCC_BDCR_LSEON_Values<RCC::BDCR, 0, 1, ReadWriteMode, RCCBDCRBase> ;
+    static constexpr Type SnapshotMask = 0x18305U ;
     using FieldValues = RCC_BDCR_LSEON_Values<RCC::BDCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -478,6 +498,7 @@ struct RCC
     using RMVF = RCC_CSR_RMVF_Values<RCC::CSR, 24, 1, ReadWriteMode, RCCCSRBase> ;
     using LSIRDY = RCC_CSR_LSIRDY_Values<RCC::CSR, 1, 1, ReadMode, RCCCSRBase> ;
     using LSION = RCC_CSR_LSION_Values<RCC::CSR, 0, 1, ReadWriteMode, RCCCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RCC_CSR_LSION_Values<RCC::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -492,6 +513,7 @@ struct RCC
     using SPREADSEL = RCC_SSCGR_SPREADSEL_Values<RCC::SSCGR, 30, 1, ReadWriteMode, RCCSSCGRBase> ;
     using INCSTEP = RCC_SSCGR_INCSTEP_Values<RCC::SSCGR, 13, 15, ReadWriteMode, RCCSSCGRBase> ;
     using MODPER = RCC_SSCGR_MODPER_Values<RCC::SSCGR, 0, 13, ReadWriteMode, RCCSSCGRBase> ;
+    static constexpr Type SnapshotMask = 0xCFFFFFFFU ;
     using FieldValues = RCC_SSCGR_MODPER_Values<RCC::SSCGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -504,12 +526,14 @@ struct RCC
   {
     using PLLI2SRx = RCC_PLLI2SCFGR_PLLI2SRx_Values<RCC::PLLI2SCFGR, 28, 3, ReadWriteMode, RCCPLLI2SCFGRBase> ;
     using PLLI2SNx = RCC_PLLI2SCFGR_PLLI2SNx_Values<RCC::PLLI2SCFGR, 6, 9, ReadWriteMode, RCCPLLI2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0x70007FC0U ;
     using FieldValues = RCC_PLLI2SCFGR_PLLI2SNx_Values<RCC::PLLI2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PLLI2SCFGRPack  = Register<0x40023884, 32, ReadWriteMode, RCCPLLI2SCFGRBase, T...> ;
 
+  using Registers = TypesList<RCC::CR, RCC::PLLCFGR, RCC::CFGR, RCC::CIR, RCC::AHB1RSTR, RCC::AHB2RSTR, RCC::AHB3RSTR, RCC::APB1RSTR, RCC::APB2RSTR, RCC::AHB1ENR, RCC::AHB2ENR, RCC::AHB3ENR, RCC::APB1ENR, RCC::APB2ENR, RCC::AHB1LPENR, RCC::AHB2LPENR, RCC::AHB3LPENR, RCC::APB1LPENR, RCC::APB2LPENR, RCC::BDCR, RCC::CSR, RCC::SSCGR, RCC::PLLI2SCFGR> ;
 } ;
 
 #endif //#if !defined(RCCREGISTERS_HPP)
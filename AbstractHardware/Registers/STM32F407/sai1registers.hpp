@@ -33,6 +33,7 @@ struct SAI1
     using SAIAEN = SAI1_SAI_ACR1_SAIAEN_Values<SAI1::SAI_ACR1, 16, 1, ReadWriteMode, SAI1SAI_ACR1Base> ;
     using DMAEN = SAI1_SAI_ACR1_DMAEN_Values<SAI1::SAI_ACR1, 17, 1, ReadWriteMode, SAI1SAI_ACR1Base> ;
     using NODIV = SAI1_SAI_ACR1_NODIV_Values<SAI1::SAI_ACR1, 19, 1, ReadWriteMode, SAI1SAI_ACR1Base> ;
+    static constexpr Type SnapshotMask = 0xFB3FEFU ;
     using FieldValues = SAI1_SAI_ACR1_NODIV_Values<SAI1::SAI_ACR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +56,7 @@ struct SAI1
     using DMAEN = SAI1_SAI_BCR1_DMAEN_Values<SAI1::SAI_BCR1, 17, 1, ReadWriteMode, SAI1SAI_BCR1Base> ;
     using NODIV = SAI1_SAI_BCR1_NODIV_Values<SAI1::SAI_BCR1, 19, 1, ReadWriteMode, SAI1SAI_BCR1Base> ;
     using MCKDIV = SAI1_SAI_BCR1_MCKDIV_Values<SAI1::SAI_BCR1, 20, 4, ReadWriteMode, SAI1SAI_BCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFB3FEFU ;
     using FieldValues = SAI1_SAI_BCR1_MCKDIV_Values<SAI1::SAI_BCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +75,7 @@ struct SAI1
     using MUTECNT = SAI1_SAI_ACR2_MUTECNT_Values<SAI1::SAI_ACR2, 7, 6, ReadWriteMode, SAI1SAI_ACR2Base> ;
     using CPL = SAI1_SAI_ACR2_CPL_Values<SAI1::SAI_ACR2, 13, 1, ReadWriteMode, SAI1SAI_ACR2Base> ;
     using COMP = SAI1_SAI_ACR2_COMP_Values<SAI1::SAI_ACR2, 14, 2, ReadWriteMode, SAI1SAI_ACR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SAI1_SAI_ACR2_COMP_Values<SAI1::SAI_ACR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +94,7 @@ struct SAI1
     using MUTECNT = SAI1_SAI_BCR2_MUTECNT_Values<SAI1::SAI_BCR2, 7, 6, ReadWriteMode, SAI1SAI_BCR2Base> ;
     using CPL = SAI1_SAI_BCR2_CPL_Values<SAI1::SAI_BCR2, 13, 1, ReadWriteMode, SAI1SAI_BCR2Base> ;
     using COMP = SAI1_SAI_BCR2_COMP_Values<SAI1::SAI_BCR2, 14, 2, ReadWriteMode, SAI1SAI_BCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SAI1_SAI_BCR2_COMP_Values<SAI1::SAI_BCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -106,6 +110,7 @@ struct SAI1
     using FSDEF = SAI1_SAI_AFRCR_FSDEF_Values<SAI1::SAI_AFRCR, 16, 1, ReadMode, SAI1SAI_AFRCRBase> ;
     using FSPOL = SAI1_SAI_AFRCR_FSPOL_Values<SAI1::SAI_AFRCR, 17, 1, ReadWriteMode, SAI1SAI_AFRCRBase> ;
     using FSOFF = SAI1_SAI_AFRCR_FSOFF_Values<SAI1::SAI_AFRCR, 18, 1, ReadWriteMode, SAI1SAI_AFRCRBase> ;
+    static constexpr Type SnapshotMask = 0x67FFFU ;
     using FieldValues = SAI1_SAI_AFRCR_FSOFF_Values<SAI1::SAI_AFRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +126,7 @@ struct SAI1
     using FSDEF = SAI1_SAI_BFRCR_FSDEF_Values<SAI1::SAI_BFRCR, 16, 1, ReadMode, SAI1SAI_BFRCRBase> ;
     using FSPOL = SAI1_SAI_BFRCR_FSPOL_Values<SAI1::SAI_BFRCR, 17, 1, ReadWriteMode, SAI1SAI_BFRCRBase> ;
     using FSOFF = SAI1_SAI_BFRCR_FSOFF_Values<SAI1::SAI_BFRCR, 18, 1, ReadWriteMode, SAI1SAI_BFRCRBase> ;
+    static constexpr Type SnapshotMask = 0x67FFFU ;
     using FieldValues = SAI1_SAI_BFRCR_FSOFF_Values<SAI1::SAI_BFRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +141,7 @@ struct SAI1
     using SLOTSZ = SAI1_SAI_ASLOTR_SLOTSZ_Values<SAI1::SAI_ASLOTR, 6, 2, ReadWriteMode, SAI1SAI_ASLOTRBase> ;
     using NBSLOT = SAI1_SAI_ASLOTR_NBSLOT_Values<SAI1::SAI_ASLOTR, 8, 4, ReadWriteMode, SAI1SAI_ASLOTRBase> ;
     using SLOTEN = SAI1_SAI_ASLOTR_SLOTEN_Values<SAI1::SAI_ASLOTR, 16, 16, ReadWriteMode, SAI1SAI_ASLOTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF0FDFU ;
     using FieldValues = SAI1_SAI_ASLOTR_SLOTEN_Values<SAI1::SAI_ASLOTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -149,6 +156,7 @@ struct SAI1
     using SLOTSZ = SAI1_SAI_BSLOTR_SLOTSZ_Values<SAI1::SAI_BSLOTR, 6, 2, ReadWriteMode, SAI1SAI_BSLOTRBase> ;
     using NBSLOT = SAI1_SAI_BSLOTR_NBSLOT_Values<SAI1::SAI_BSLOTR, 8, 4, ReadWriteMode, SAI1SAI_BSLOTRBase> ;
     using SLOTEN = SAI1_SAI_BSLOTR_SLOTEN_Values<SAI1::SAI_BSLOTR, 16, 16, ReadWriteMode, SAI1SAI_BSLOTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF0FDFU ;
     using FieldValues = SAI1_SAI_BSLOTR_SLOTEN_Values<SAI1::SAI_BSLOTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +174,7 @@ struct SAI1
     using CNRDYIE = SAI1_SAI_AIM_CNRDYIE_Values<SAI1::SAI_AIM, 4, 1, ReadWriteMode, SAI1SAI_AIMBase> ;
     using AFSDETIE = SAI1_SAI_AIM_AFSDETIE_Values<SAI1::SAI_AIM, 5, 1, ReadWriteMode, SAI1SAI_AIMBase> ;
     using LFSDETIE = SAI1_SAI_AIM_LFSDETIE_Values<SAI1::SAI_AIM, 6, 1, ReadWriteMode, SAI1SAI_AIMBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = SAI1_SAI_AIM_LFSDETIE_Values<SAI1::SAI_AIM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -183,6 +192,7 @@ struct SAI1
     using CNRDYIE = SAI1_SAI_BIM_CNRDYIE_Values<SAI1::SAI_BIM, 4, 1, ReadWriteMode, SAI1SAI_BIMBase> ;
     using AFSDETIE = SAI1_SAI_BIM_AFSDETIE_Values<SAI1::SAI_BIM, 5, 1, ReadWriteMode, SAI1SAI_BIMBase> ;
     using LFSDETIE = SAI1_SAI_BIM_LFSDETIE_Values<SAI1::SAI_BIM, 6, 1, ReadWriteMode, SAI1SAI_BIMBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = SAI1_SAI_BIM_LFSDETIE_Values<SAI1::SAI_BIM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -235,6 +245,7 @@ struct SAI1
     using CCNRDY = SAI1_SAI_ACLRFR_CCNRDY_Values<SAI1::SAI_ACLRFR, 4, 1, ReadWriteMode, SAI1SAI_ACLRFRBase> ;
     using CAFSDET = SAI1_SAI_ACLRFR_CAFSDET_Values<SAI1::SAI_ACLRFR, 5, 1, ReadWriteMode, SAI1SAI_ACLRFRBase> ;
     using CLFSDET = SAI1_SAI_ACLRFR_CLFSDET_Values<SAI1::SAI_ACLRFR, 6, 1, ReadWriteMode, SAI1SAI_ACLRFRBase> ;
+    static constexpr Type SnapshotMask = 0x77U ;
     using FieldValues = SAI1_SAI_ACLRFR_CLFSDET_Values<SAI1::SAI_ACLRFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +262,7 @@ struct SAI1
     using CCNRDY = SAI1_SAI_BCLRFR_CCNRDY_Values<SAI1::SAI_BCLRFR, 4, 1, ReadWriteMode, SAI1SAI_BCLRFRBase> ;
     using CAFSDET = SAI1_SAI_BCLRFR_CAFSDET_Values<SAI1::SAI_BCLRFR, 5, 1, ReadWriteMode, SAI1SAI_BCLRFRBase> ;
     using CLFSDET = SAI1_SAI_BCLRFR_CLFSDET_Values<SAI1::SAI_BCLRFR, 6, 1, ReadWriteMode, SAI1SAI_BCLRFRBase> ;
+    static constexpr Type SnapshotMask = 0x77U ;
     using FieldValues = SAI1_SAI_BCLRFR_CLFSDET_Values<SAI1::SAI_BCLRFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +274,7 @@ struct SAI1
   struct SAI_ADR : public RegisterBase<0x40015820, 32, ReadWriteMode>
   {
     using DATA = SAI1_SAI_ADR_DATA_Values<SAI1::SAI_ADR, 0, 32, ReadWriteMode, SAI1SAI_ADRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SAI1_SAI_ADR_DATA_Values<SAI1::SAI_ADR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,12 +286,14 @@ struct SAI1
   struct SAI_BDR : public RegisterBase<0x40015840, 32, ReadWriteMode>
   {
     using DATA = SAI1_SAI_BDR_DATA_Values<SAI1::SAI_BDR, 0, 32, ReadWriteMode, SAI1SAI_BDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SAI1_SAI_BDR_DATA_Values<SAI1::SAI_BDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SAI_BDRPack  = Register<0x40015840, 32, ReadWriteMode, SAI1SAI_BDRBase, T...> ;
 
+  using Registers = TypesList<SAI1::SAI_ACR1, SAI1::SAI_BCR1, SAI1::SAI_ACR2, SAI1::SAI_BCR2, SAI1::SAI_AFRCR, SAI1::SAI_BFRCR, SAI1::SAI_ASLOTR, SAI1::SAI_BSLOTR, SAI1::SAI_AIM, SAI1::SAI_BIM, SAI1::SAI_ASR, SAI1::SAI_BSR, SAI1::SAI_ACLRFR, SAI1::SAI_BCLRFR, SAI1::SAI_ADR, SAI1::SAI_BDR> ;
 } ;
 
 #endif //#if !defined(SAI1REGISTERS_HPP)
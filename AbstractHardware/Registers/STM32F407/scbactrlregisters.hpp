@@ -26,12 +26,14 @@ struct SCB_ACTRL
     using DISFOLD = SCB_ACTRL_ACTRL_DISFOLD_Values<SCB_ACTRL::ACTRL, 2, 1, ReadWriteMode, SCB_ACTRLACTRLBase> ;
     using DISFPCA = SCB_ACTRL_ACTRL_DISFPCA_Values<SCB_ACTRL::ACTRL, 8, 1, ReadWriteMode, SCB_ACTRLACTRLBase> ;
     using DISOOFP = SCB_ACTRL_ACTRL_DISOOFP_Values<SCB_ACTRL::ACTRL, 9, 1, ReadWriteMode, SCB_ACTRLACTRLBase> ;
+    static constexpr Type SnapshotMask = 0x307U ;
     using FieldValues = SCB_ACTRL_ACTRL_DISOOFP_Values<SCB_ACTRL::ACTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ACTRLPack  = Register<0xE000E008, 32, ReadWriteMode, SCB_ACTRLACTRLBase, T...> ;
 
+  using Registers = TypesList<SCB_ACTRL::ACTRL> ;
 } ;
 
 #endif //#if !defined(SCBACTRLREGISTERS_HPP)
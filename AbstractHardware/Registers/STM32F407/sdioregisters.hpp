@@ -22,6 +22,7 @@ struct SDIO
   struct POWER : public RegisterBase<0x40012C00, 32, ReadWriteMode>
   {
     using PWRCTRL = SDIO_POWER_PWRCTRL_Values<SDIO::POWER, 0, 2, ReadWriteMode, SDIOPOWERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = SDIO_POWER_PWRCTRL_Values<SDIO::POWER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -39,6 +40,7 @@ struct SDIO
     using PWRSAV = SDIO_CLKCR_PWRSAV_Values<SDIO::CLKCR, 9, 1, ReadWriteMode, SDIOCLKCRBase> ;
     using CLKEN = SDIO_CLKCR_CLKEN_Values<SDIO::CLKCR, 8, 1, ReadWriteMode, SDIOCLKCRBase> ;
     using CLKDIV = SDIO_CLKCR_CLKDIV_Values<SDIO::CLKCR, 0, 8, ReadWriteMode, SDIOCLKCRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SDIO_CLKCR_CLKDIV_Values<SDIO::CLKCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +52,7 @@ struct SDIO
   struct ARG : public RegisterBase<0x40012C08, 32, ReadWriteMode>
   {
     using CMDARG = SDIO_ARG_CMDARG_Values<SDIO::ARG, 0, 32, ReadWriteMode, SDIOARGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SDIO_ARG_CMDARG_Values<SDIO::ARG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +72,7 @@ struct SDIO
     using WAITINT = SDIO_CMD_WAITINT_Values<SDIO::CMD, 8, 1, ReadWriteMode, SDIOCMDBase> ;
     using WAITRESP = SDIO_CMD_WAITRESP_Values<SDIO::CMD, 6, 2, ReadWriteMode, SDIOCMDBase> ;
     using CMDINDEX = SDIO_CMD_CMDINDEX_Values<SDIO::CMD, 0, 6, ReadWriteMode, SDIOCMDBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SDIO_CMD_CMDINDEX_Values<SDIO::CMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +139,7 @@ struct SDIO
   struct DTIMER : public RegisterBase<0x40012C24, 32, ReadWriteMode>
   {
     using DATATIME = SDIO_DTIMER_DATATIME_Values<SDIO::DTIMER, 0, 32, ReadWriteMode, SDIODTIMERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SDIO_DTIMER_DATATIME_Values<SDIO::DTIMER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +151,7 @@ struct SDIO
   struct DLEN : public RegisterBase<0x40012C28, 32, ReadWriteMode>
   {
     using DATALENGTH = SDIO_DLEN_DATALENGTH_Values<SDIO::DLEN, 0, 25, ReadWriteMode, SDIODLENBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFU ;
     using FieldValues = SDIO_DLEN_DATALENGTH_Values<SDIO::DLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +171,7 @@ struct SDIO
     using DTMODE = SDIO_DCTRL_DTMODE_Values<SDIO::DCTRL, 2, 1, ReadWriteMode, SDIODCTRLBase> ;
     using DTDIR = SDIO_DCTRL_DTDIR_Values<SDIO::DCTRL, 1, 1, ReadWriteMode, SDIODCTRLBase> ;
     using DTEN = SDIO_DCTRL_DTEN_Values<SDIO::DCTRL, 0, 1, ReadWriteMode, SDIODCTRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = SDIO_DCTRL_DTEN_Values<SDIO::DCTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +240,7 @@ struct SDIO
     using CTIMEOUTC = SDIO_ICR_CTIMEOUTC_Values<SDIO::ICR, 2, 1, ReadWriteMode, SDIOICRBase> ;
     using DCRCFAILC = SDIO_ICR_DCRCFAILC_Values<SDIO::ICR, 1, 1, ReadWriteMode, SDIOICRBase> ;
     using CCRCFAILC = SDIO_ICR_CCRCFAILC_Values<SDIO::ICR, 0, 1, ReadWriteMode, SDIOICRBase> ;
+    static constexpr Type SnapshotMask = 0xC007FFU ;
     using FieldValues = SDIO_ICR_CCRCFAILC_Values<SDIO::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -267,6 +275,7 @@ struct SDIO
     using CTIMEOUTIE = SDIO_MASK_CTIMEOUTIE_Values<SDIO::MASK, 2, 1, ReadWriteMode, SDIOMASKBase> ;
     using DCRCFAILIE = SDIO_MASK_DCRCFAILIE_Values<SDIO::MASK, 1, 1, ReadWriteMode, SDIOMASKBase> ;
     using CCRCFAILIE = SDIO_MASK_CCRCFAILIE_Values<SDIO::MASK, 0, 1, ReadWriteMode, SDIOMASKBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = SDIO_MASK_CCRCFAILIE_Values<SDIO::MASK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,12 +298,14 @@ struct SDIO
   struct FIFO : public RegisterBase<0x40012C80, 32, ReadWriteMode>
   {
     using FIFOData = SDIO_FIFO_FIFOData_Values<SDIO::FIFO, 0, 32, ReadWriteMode, SDIOFIFOBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SDIO_FIFO_FIFOData_Values<SDIO::FIFO, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FIFOPack  = Register<0x40012C80, 32, ReadWriteMode, SDIOFIFOBase, T...> ;
 
+  using Registers = TypesList<SDIO::POWER, SDIO::CLKCR, SDIO::ARG, SDIO::CMD, SDIO::RESPCMD, SDIO::RESP1, SDIO::RESP2, SDIO::RESP3, SDIO::RESP4, SDIO::DTIMER, SDIO::DLEN, SDIO::DCTRL, SDIO::DCOUNT, SDIO::STA, SDIO::ICR, SDIO::MASK, SDIO::FIFOCNT, SDIO::FIFO> ;
 } ;
 
 #endif //#if !defined(SDIOREGISTERS_HPP)
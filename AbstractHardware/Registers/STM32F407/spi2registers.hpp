@@ -35,6 +35,8 @@ struct SPI2
     using MSTR = SPI2_CR1_MSTR_Values<SPI2::CR1, 2, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPOL = SPI2_CR1_CPOL_Values<SPI2::CR1, 1, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPHA = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 1, ReadWriteMode, SPI2CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +54,7 @@ struct SPI2
     using SSOE = SPI2_CR2_SSOE_Values<SPI2::CR2, 2, 1, ReadWriteMode, SPI2CR2Base> ;
     using TXDMAEN = SPI2_CR2_TXDMAEN_Values<SPI2::CR2, 1, 1, ReadWriteMode, SPI2CR2Base> ;
     using RXDMAEN = SPI2_CR2_RXDMAEN_Values<SPI2::CR2, 0, 1, ReadWriteMode, SPI2CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = SPI2_CR2_RXDMAEN_Values<SPI2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +74,9 @@ struct SPI2
     using CHSIDE = SPI2_SR_CHSIDE_Values<SPI2::SR, 2, 1, ReadMode, SPI2SRBase> ;
     using TXE = SPI2_SR_TXE_Values<SPI2::SR, 1, 1, ReadMode, SPI2SRBase> ;
     using RXNE = SPI2_SR_RXNE_Values<SPI2::SR, 0, 1, ReadMode, SPI2SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_SR_RXNE_Values<SPI2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +88,7 @@ struct SPI2
   struct DR : public RegisterBase<0x4000380C, 32, ReadWriteMode>
   {
     using DRField = SPI2_DR_DR_Values<SPI2::DR, 0, 16, ReadWriteMode, SPI2DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_DR_DR_Values<SPI2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct SPI2
   struct CRCPR : public RegisterBase<0x40003810, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 16, ReadWriteMode, SPI2CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +141,8 @@ struct SPI2
     using CKPOL = SPI2_I2SCFGR_CKPOL_Values<SPI2::I2SCFGR, 3, 1, ReadWriteMode, SPI2I2SCFGRBase> ;
     using DATLEN = SPI2_I2SCFGR_DATLEN_Values<SPI2::I2SCFGR, 1, 2, ReadWriteMode, SPI2I2SCFGRBase> ;
     using CHLEN = SPI2_I2SCFGR_CHLEN_Values<SPI2::I2SCFGR, 0, 1, ReadWriteMode, SPI2I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI2_I2SCFGR_CHLEN_Values<SPI2::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +156,14 @@ struct SPI2
     using MCKOE = SPI2_I2SPR_MCKOE_Values<SPI2::I2SPR, 9, 1, ReadWriteMode, SPI2I2SPRBase> ;
     using ODD = SPI2_I2SPR_ODD_Values<SPI2::I2SPR, 8, 1, ReadWriteMode, SPI2I2SPRBase> ;
     using I2SDIV = SPI2_I2SPR_I2SDIV_Values<SPI2::I2SPR, 0, 8, ReadWriteMode, SPI2I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI2_I2SPR_I2SDIV_Values<SPI2::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003820, 32, ReadWriteMode, SPI2I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI2::CR1, SPI2::CR2, SPI2::SR, SPI2::DR, SPI2::CRCPR, SPI2::RXCRCR, SPI2::TXCRCR, SPI2::I2SCFGR, SPI2::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI2REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI3
     using MSTR = SPI3_CR1_MSTR_Values<SPI3::CR1, 2, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPOL = SPI3_CR1_CPOL_Values<SPI3::CR1, 1, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPHA = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 1, ReadWriteMode, SPI3CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +54,7 @@ struct SPI3
     using SSOE = SPI3_CR2_SSOE_Values<SPI3::CR2, 2, 1, ReadWriteMode, SPI3CR2Base> ;
     using TXDMAEN = SPI3_CR2_TXDMAEN_Values<SPI3::CR2, 1, 1, ReadWriteMode, SPI3CR2Base> ;
     using RXDMAEN = SPI3_CR2_RXDMAEN_Values<SPI3::CR2, 0, 1, ReadWriteMode, SPI3CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = SPI3_CR2_RXDMAEN_Values<SPI3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +74,9 @@ struct SPI3
     using CHSIDE = SPI3_SR_CHSIDE_Values<SPI3::SR, 2, 1, ReadMode, SPI3SRBase> ;
     using TXE = SPI3_SR_TXE_Values<SPI3::SR, 1, 1, ReadMode, SPI3SRBase> ;
     using RXNE = SPI3_SR_RXNE_Values<SPI3::SR, 0, 1, ReadMode, SPI3SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI3_SR_RXNE_Values<SPI3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +88,7 @@ struct SPI3
   struct DR : public RegisterBase<0x40003C0C, 32, ReadWriteMode>
   {
     using DRField = SPI3_DR_DR_Values<SPI3::DR, 0, 16, ReadWriteMode, SPI3DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI3_DR_DR_Values<SPI3::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct SPI3
   struct CRCPR : public RegisterBase<0x40003C10, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 16, ReadWriteMode, SPI3CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +141,8 @@ struct SPI3
     using CKPOL = SPI3_I2SCFGR_CKPOL_Values<SPI3::I2SCFGR, 3, 1, ReadWriteMode, SPI3I2SCFGRBase> ;
     using DATLEN = SPI3_I2SCFGR_DATLEN_Values<SPI3::I2SCFGR, 1, 2, ReadWriteMode, SPI3I2SCFGRBase> ;
     using CHLEN = SPI3_I2SCFGR_CHLEN_Values<SPI3::I2SCFGR, 0, 1, ReadWriteMode, SPI3I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI3_I2SCFGR_CHLEN_Values<SPI3::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +156,14 @@ struct SPI3
     using MCKOE = SPI3_I2SPR_MCKOE_Values<SPI3::I2SPR, 9, 1, ReadWriteMode, SPI3I2SPRBase> ;
     using ODD = SPI3_I2SPR_ODD_Values<SPI3::I2SPR, 8, 1, ReadWriteMode, SPI3I2SPRBase> ;
     using I2SDIV = SPI3_I2SPR_I2SDIV_Values<SPI3::I2SPR, 0, 8, ReadWriteMode, SPI3I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI3_I2SPR_I2SDIV_Values<SPI3::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003C20, 32, ReadWriteMode, SPI3I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI3::CR1, SPI3::CR2, SPI3::SR, SPI3::DR, SPI3::CRCPR, SPI3::RXCRCR, SPI3::TXCRCR, SPI3::I2SCFGR, SPI3::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI3REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI4
     using MSTR = SPI4_CR1_MSTR_Values<SPI4::CR1, 2, 1, ReadWriteMode, SPI4CR1Base> ;
     using CPOL = SPI4_CR1_CPOL_Values<SPI4::CR1, 1, 1, ReadWriteMode, SPI4CR1Base> ;
     using CPHA = SPI4_CR1_CPHA_Values<SPI4::CR1, 0, 1, ReadWriteMode, SPI4CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI4_CR1_CPHA_Values<SPI4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +54,7 @@ struct SPI4
     using SSOE = SPI4_CR2_SSOE_Values<SPI4::CR2, 2, 1, ReadWriteMode, SPI4CR2Base> ;
     using TXDMAEN = SPI4_CR2_TXDMAEN_Values<SPI4::CR2, 1, 1, ReadWriteMode, SPI4CR2Base> ;
     using RXDMAEN = SPI4_CR2_RXDMAEN_Values<SPI4::CR2, 0, 1, ReadWriteMode, SPI4CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = SPI4_CR2_RXDMAEN_Values<SPI4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +74,9 @@ struct SPI4
     using CHSIDE = SPI4_SR_CHSIDE_Values<SPI4::SR, 2, 1, ReadMode, SPI4SRBase> ;
     using TXE = SPI4_SR_TXE_Values<SPI4::SR, 1, 1, ReadMode, SPI4SRBase> ;
     using RXNE = SPI4_SR_RXNE_Values<SPI4::SR, 0, 1, ReadMode, SPI4SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI4_SR_RXNE_Values<SPI4::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +88,7 @@ struct SPI4
   struct DR : public RegisterBase<0x4001340C, 32, ReadWriteMode>
   {
     using DRField = SPI4_DR_DR_Values<SPI4::DR, 0, 16, ReadWriteMode, SPI4DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI4_DR_DR_Values<SPI4::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct SPI4
   struct CRCPR : public RegisterBase<0x40013410, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI4_CRCPR_CRCPOLY_Values<SPI4::CRCPR, 0, 16, ReadWriteMode, SPI4CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI4_CRCPR_CRCPOLY_Values<SPI4::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +141,8 @@ struct SPI4
     using CKPOL = SPI4_I2SCFGR_CKPOL_Values<SPI4::I2SCFGR, 3, 1, ReadWriteMode, SPI4I2SCFGRBase> ;
     using DATLEN = SPI4_I2SCFGR_DATLEN_Values<SPI4::I2SCFGR, 1, 2, ReadWriteMode, SPI4I2SCFGRBase> ;
     using CHLEN = SPI4_I2SCFGR_CHLEN_Values<SPI4::I2SCFGR, 0, 1, ReadWriteMode, SPI4I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI4_I2SCFGR_CHLEN_Values<SPI4::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +156,14 @@ struct SPI4
     using MCKOE = SPI4_I2SPR_MCKOE_Values<SPI4::I2SPR, 9, 1, ReadWriteMode, SPI4I2SPRBase> ;
     using ODD = SPI4_I2SPR_ODD_Values<SPI4::I2SPR, 8, 1, ReadWriteMode, SPI4I2SPRBase> ;
     using I2SDIV = SPI4_I2SPR_I2SDIV_Values<SPI4::I2SPR, 0, 8, ReadWriteMode, SPI4I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI4_I2SPR_I2SDIV_Values<SPI4::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40013420, 32, ReadWriteMode, SPI4I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI4::CR1, SPI4::CR2, SPI4::SR, SPI4::DR, SPI4::CRCPR, SPI4::RXCRCR, SPI4::TXCRCR, SPI4::I2SCFGR, SPI4::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI4REGISTERS_HPP)
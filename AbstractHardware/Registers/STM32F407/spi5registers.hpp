@@ -35,6 +35,8 @@ struct SPI5
     using MSTR = SPI5_CR1_MSTR_Values<SPI5::CR1, 2, 1, ReadWriteMode, SPI5CR1Base> ;
     using CPOL = SPI5_CR1_CPOL_Values<SPI5::CR1, 1, 1, ReadWriteMode, SPI5CR1Base> ;
     using CPHA = SPI5_CR1_CPHA_Values<SPI5::CR1, 0, 1, ReadWriteMode, SPI5CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI5_CR1_CPHA_Values<SPI5::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +54,7 @@ struct SPI5
     using SSOE = SPI5_CR2_SSOE_Values<SPI5::CR2, 2, 1, ReadWriteMode, SPI5CR2Base> ;
     using TXDMAEN = SPI5_CR2_TXDMAEN_Values<SPI5::CR2, 1, 1, ReadWriteMode, SPI5CR2Base> ;
     using RXDMAEN = SPI5_CR2_RXDMAEN_Values<SPI5::CR2, 0, 1, ReadWriteMode, SPI5CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = SPI5_CR2_RXDMAEN_Values<SPI5::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +74,9 @@ struct SPI5
     using CHSIDE = SPI5_SR_CHSIDE_Values<SPI5::SR, 2, 1, ReadMode, SPI5SRBase> ;
     using TXE = SPI5_SR_TXE_Values<SPI5::SR, 1, 1, ReadMode, SPI5SRBase> ;
     using RXNE = SPI5_SR_RXNE_Values<SPI5::SR, 0, 1, ReadMode, SPI5SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI5_SR_RXNE_Values<SPI5::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +88,7 @@ struct SPI5
   struct DR : public RegisterBase<0x4001500C, 32, ReadWriteMode>
   {
     using DRField = SPI5_DR_DR_Values<SPI5::DR, 0, 16, ReadWriteMode, SPI5DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI5_DR_DR_Values<SPI5::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct SPI5
   struct CRCPR : public RegisterBase<0x40015010, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI5_CRCPR_CRCPOLY_Values<SPI5::CRCPR, 0, 16, ReadWriteMode, SPI5CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI5_CRCPR_CRCPOLY_Values<SPI5::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +141,8 @@ struct SPI5
     using CKPOL = SPI5_I2SCFGR_CKPOL_Values<SPI5::I2SCFGR, 3, 1, ReadWriteMode, SPI5I2SCFGRBase> ;
     using DATLEN = SPI5_I2SCFGR_DATLEN_Values<SPI5::I2SCFGR, 1, 2, ReadWriteMode, SPI5I2SCFGRBase> ;
     using CHLEN = SPI5_I2SCFGR_CHLEN_Values<SPI5::I2SCFGR, 0, 1, ReadWriteMode, SPI5I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI5_I2SCFGR_CHLEN_Values<SPI5::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +156,14 @@ struct SPI5
     using MCKOE = SPI5_I2SPR_MCKOE_Values<SPI5::I2SPR, 9, 1, ReadWriteMode, SPI5I2SPRBase> ;
     using ODD = SPI5_I2SPR_ODD_Values<SPI5::I2SPR, 8, 1, ReadWriteMode, SPI5I2SPRBase> ;
     using I2SDIV = SPI5_I2SPR_I2SDIV_Values<SPI5::I2SPR, 0, 8, ReadWriteMode, SPI5I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI5_I2SPR_I2SDIV_Values<SPI5::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40015020, 32, ReadWriteMode, SPI5I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI5::CR1, SPI5::CR2, SPI5::SR, SPI5::DR, SPI5::CRCPR, SPI5::RXCRCR, SPI5::TXCRCR, SPI5::I2SCFGR, SPI5::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI5REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI6
     using MSTR = SPI6_CR1_MSTR_Values<SPI6::CR1, 2, 1, ReadWriteMode, SPI6CR1Base> ;
     using CPOL = SPI6_CR1_CPOL_Values<SPI6::CR1, 1, 1, ReadWriteMode, SPI6CR1Base> ;
     using CPHA = SPI6_CR1_CPHA_Values<SPI6::CR1, 0, 1, ReadWriteMode, SPI6CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI6_CR1_CPHA_Values<SPI6::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +54,7 @@ struct SPI6
     using SSOE = SPI6_CR2_SSOE_Values<SPI6::CR2, 2, 1, ReadWriteMode, SPI6CR2Base> ;
     using TXDMAEN = SPI6_CR2_TXDMAEN_Values<SPI6::CR2, 1, 1, ReadWriteMode, SPI6CR2Base> ;
     using RXDMAEN = SPI6_CR2_RXDMAEN_Values<SPI6::CR2, 0, 1, ReadWriteMode, SPI6CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = SPI6_CR2_RXDMAEN_Values<SPI6::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +74,9 @@ struct SPI6
     using CHSIDE = SPI6_SR_CHSIDE_Values<SPI6::SR, 2, 1, ReadMode, SPI6SRBase> ;
     using TXE = SPI6_SR_TXE_Values<SPI6::SR, 1, 1, ReadMode, SPI6SRBase> ;
     using RXNE = SPI6_SR_RXNE_Values<SPI6::SR, 0, 1, ReadMode, SPI6SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI6_SR_RXNE_Values<SPI6::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +88,7 @@ struct SPI6
   struct DR : public RegisterBase<0x4001540C, 32, ReadWriteMode>
   {
     using DRField = SPI6_DR_DR_Values<SPI6::DR, 0, 16, ReadWriteMode, SPI6DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI6_DR_DR_Values<SPI6::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct SPI6
   struct CRCPR : public RegisterBase<0x40015410, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI6_CRCPR_CRCPOLY_Values<SPI6::CRCPR, 0, 16, ReadWriteMode, SPI6CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI6_CRCPR_CRCPOLY_Values<SPI6::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +141,8 @@ struct SPI6
     using CKPOL = SPI6_I2SCFGR_CKPOL_Values<SPI6::I2SCFGR, 3, 1, ReadWriteMode, SPI6I2SCFGRBase> ;
     using DATLEN = SPI6_I2SCFGR_DATLEN_Values<SPI6::I2SCFGR, 1, 2, ReadWriteMode, SPI6I2SCFGRBase> ;
     using CHLEN = SPI6_I2SCFGR_CHLEN_Values<SPI6::I2SCFGR, 0, 1, ReadWriteMode, SPI6I2SCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
     using FieldValues = SPI6_I2SCFGR_CHLEN_Values<SPI6::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +156,14 @@ struct SPI6
     using MCKOE = SPI6_I2SPR_MCKOE_Values<SPI6::I2SPR, 9, 1, ReadWriteMode, SPI6I2SPRBase> ;
     using ODD = SPI6_I2SPR_ODD_Values<SPI6::I2SPR, 8, 1, ReadWriteMode, SPI6I2SPRBase> ;
     using I2SDIV = SPI6_I2SPR_I2SDIV_Values<SPI6::I2SPR, 0, 8, ReadWriteMode, SPI6I2SPRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = SPI6_I2SPR_I2SDIV_Values<SPI6::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40015420, 32, ReadWriteMode, SPI6I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI6::CR1, SPI6::CR2, SPI6::SR, SPI6::DR, SPI6::CRCPR, SPI6::RXCRCR, SPI6::TXCRCR, SPI6::I2SCFGR, SPI6::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI6REGISTERS_HPP)
@@ -25,6 +25,7 @@ struct STK
     using TICKINT = STK_CTRL_TICKINT_Values<STK::CTRL, 1, 1, ReadWriteMode, STKCTRLBase> ;
     using CLKSOURCE = STK_CTRL_CLKSOURCE_Values<STK::CTRL, 2, 1, ReadWriteMode, STKCTRLBase> ;
     using COUNTFLAG = STK_CTRL_COUNTFLAG_Values<STK::CTRL, 16, 1, ReadWriteMode, STKCTRLBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = STK_CTRL_COUNTFLAG_Values<STK::CTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -36,6 +37,7 @@ struct STK
   struct LOAD : public RegisterBase<0xE000E014, 32, ReadWriteMode>
   {
     using RELOAD = STK_LOAD_RELOAD_Values<STK::LOAD, 0, 24, ReadWriteMode, STKLOADBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = STK_LOAD_RELOAD_Values<STK::LOAD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +49,7 @@ struct STK
   struct VAL : public RegisterBase<0xE000E018, 32, ReadWriteMode>
   {
     using CURRENT = STK_VAL_CURRENT_Values<STK::VAL, 0, 24, ReadWriteMode, STKVALBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = STK_VAL_CURRENT_Values<STK::VAL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,12 +63,14 @@ struct STK
     using TENMS = STK_CALIB_TENMS_Values<STK::CALIB, 0, 24, ReadWriteMode, STKCALIBBase> ;
     using SKEW = STK_CALIB_SKEW_Values<STK::CALIB, 30, 1, ReadWriteMode, STKCALIBBase> ;
     using NOREF = STK_CALIB_NOREF_Values<STK::CALIB, 31, 1, ReadWriteMode, STKCALIBBase> ;
+    static constexpr Type SnapshotMask = 0xC0FFFFFFU ;
     using FieldValues = STK_CALIB_NOREF_Values<STK::CALIB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALIBPack  = Register<0xE000E01C, 32, ReadWriteMode, STKCALIBBase, T...> ;
 
+  using Registers = TypesList<STK::CTRL, STK::LOAD, STK::VAL, STK::CALIB> ;
 } ;
 
 #endif //#if !defined(STKREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct SYSCFG
   struct MEMRM : public RegisterBase<0x40013800, 32, ReadWriteMode>
   {
     using MEM_MODE = SYSCFG_MEMRM_MEM_MODE_Values<SYSCFG::MEMRM, 0, 2, ReadWriteMode, SYSCFGMEMRMBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = SYSCFG_MEMRM_MEM_MODE_Values<SYSCFG::MEMRM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct SYSCFG
   struct PMC : public RegisterBase<0x40013804, 32, ReadWriteMode>
   {
     using MII_RMII_SEL = SYSCFG_PMC_MII_RMII_SEL_Values<SYSCFG::PMC, 23, 1, ReadWriteMode, SYSCFGPMCBase> ;
+    static constexpr Type SnapshotMask = 0x800000U ;
     using FieldValues = SYSCFG_PMC_MII_RMII_SEL_Values<SYSCFG::PMC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +49,7 @@ struct SYSCFG
     using EXTI2 = SYSCFG_EXTICR1_EXTI2_Values<SYSCFG::EXTICR1, 8, 4, ReadWriteMode, SYSCFGEXTICR1Base> ;
     using EXTI1 = SYSCFG_EXTICR1_EXTI1_Values<SYSCFG::EXTICR1, 4, 4, ReadWriteMode, SYSCFGEXTICR1Base> ;
     using EXTI0 = SYSCFG_EXTICR1_EXTI0_Values<SYSCFG::EXTICR1, 0, 4, ReadWriteMode, SYSCFGEXTICR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_EXTICR1_EXTI0_Values<SYSCFG::EXTICR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +64,7 @@ struct SYSCFG
     using EXTI6 = SYSCFG_EXTICR2_EXTI6_Values<SYSCFG::EXTICR2, 8, 4, ReadWriteMode, SYSCFGEXTICR2Base> ;
     using EXTI5 = SYSCFG_EXTICR2_EXTI5_Values<SYSCFG::EXTICR2, 4, 4, ReadWriteMode, SYSCFGEXTICR2Base> ;
     using EXTI4 = SYSCFG_EXTICR2_EXTI4_Values<SYSCFG::EXTICR2, 0, 4, ReadWriteMode, SYSCFGEXTICR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_EXTICR2_EXTI4_Values<SYSCFG::EXTICR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +79,7 @@ struct SYSCFG
     using EXTI10 = SYSCFG_EXTICR3_EXTI10_Values<SYSCFG::EXTICR3, 8, 4, ReadWriteMode, SYSCFGEXTICR3Base> ;
     using EXTI9 = SYSCFG_EXTICR3_EXTI9_Values<SYSCFG::EXTICR3, 4, 4, ReadWriteMode, SYSCFGEXTICR3Base> ;
     using EXTI8 = SYSCFG_EXTICR3_EXTI8_Values<SYSCFG::EXTICR3, 0, 4, ReadWriteMode, SYSCFGEXTICR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_EXTICR3_EXTI8_Values<SYSCFG::EXTICR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +94,7 @@ struct SYSCFG
     using EXTI14 = SYSCFG_EXTICR4_EXTI14_Values<SYSCFG::EXTICR4, 8, 4, ReadWriteMode, SYSCFGEXTICR4Base> ;
     using EXTI13 = SYSCFG_EXTICR4_EXTI13_Values<SYSCFG::EXTICR4, 4, 4, ReadWriteMode, SYSCFGEXTICR4Base> ;
     using EXTI12 = SYSCFG_EXTICR4_EXTI12_Values<SYSCFG::EXTICR4, 0, 4, ReadWriteMode, SYSCFGEXTICR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SYSCFG_EXTICR4_EXTI12_Values<SYSCFG::EXTICR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -107,6 +113,7 @@ struct SYSCFG
   template<typename... T> 
   using CMPCRPack  = Register<0x40013820, 32, ReadMode, SYSCFGCMPCRBase, T...> ;
 
+  using Registers = TypesList<SYSCFG::MEMRM, SYSCFG::PMC, SYSCFG::EXTICR1, SYSCFG::EXTICR2, SYSCFG::EXTICR3, SYSCFG::EXTICR4, SYSCFG::CMPCR> ;
 } ;
 
 #endif //#if !defined(SYSCFGREGISTERS_HPP)
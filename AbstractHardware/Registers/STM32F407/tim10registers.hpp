@@ -26,6 +26,8 @@ struct TIM10
     using URS = TIM10_CR1_URS_Values<TIM10::CR1, 2, 1, ReadWriteMode, TIM10CR1Base> ;
     using UDIS = TIM10_CR1_UDIS_Values<TIM10::CR1, 1, 1, ReadWriteMode, TIM10CR1Base> ;
     using CEN = TIM10_CR1_CEN_Values<TIM10::CR1, 0, 1, ReadWriteMode, TIM10CR1Base> ;
+    static constexpr Type SnapshotMask = 0x386U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM10_CR1_CEN_Values<TIM10::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM10
   {
     using CC1IE = TIM10_DIER_CC1IE_Values<TIM10::DIER, 1, 1, ReadWriteMode, TIM10DIERBase> ;
     using UIE = TIM10_DIER_UIE_Values<TIM10::DIER, 0, 1, ReadWriteMode, TIM10DIERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TIM10_DIER_UIE_Values<TIM10::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,9 @@ struct TIM10
     using CC1OF = TIM10_SR_CC1OF_Values<TIM10::SR, 9, 1, ReadWriteMode, TIM10SRBase> ;
     using CC1IF = TIM10_SR_CC1IF_Values<TIM10::SR, 1, 1, ReadWriteMode, TIM10SRBase> ;
     using UIF = TIM10_SR_UIF_Values<TIM10::SR, 0, 1, ReadWriteMode, TIM10SRBase> ;
+    static constexpr Type WritableMask = 0x203U ;
+    static constexpr Type ZeroToClearMask = 0x203U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM10_SR_UIF_Values<TIM10::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +83,7 @@ struct TIM10
     using OC1PE = TIM10_CCMR1_Output_OC1PE_Values<TIM10::CCMR1_Output, 3, 1, ReadWriteMode, TIM10CCMR1_OutputBase> ;
     using OC1FE = TIM10_CCMR1_Output_OC1FE_Values<TIM10::CCMR1_Output, 2, 1, ReadWriteMode, TIM10CCMR1_OutputBase> ;
     using CC1S = TIM10_CCMR1_Output_CC1S_Values<TIM10::CCMR1_Output, 0, 2, ReadWriteMode, TIM10CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = TIM10_CCMR1_Output_CC1S_Values<TIM10::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +97,7 @@ struct TIM10
     using IC1F = TIM10_CCMR1_Input_IC1F_Values<TIM10::CCMR1_Input, 4, 4, ReadWriteMode, TIM10CCMR1_InputBase> ;
     using ICPCS = TIM10_CCMR1_Input_ICPCS_Values<TIM10::CCMR1_Input, 2, 2, ReadWriteMode, TIM10CCMR1_InputBase> ;
     using CC1S = TIM10_CCMR1_Input_CC1S_Values<TIM10::CCMR1_Input, 0, 2, ReadWriteMode, TIM10CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM10_CCMR1_Input_CC1S_Values<TIM10::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +111,7 @@ struct TIM10
     using CC1NP = TIM10_CCER_CC1NP_Values<TIM10::CCER, 3, 1, ReadWriteMode, TIM10CCERBase> ;
     using CC1P = TIM10_CCER_CC1P_Values<TIM10::CCER, 1, 1, ReadWriteMode, TIM10CCERBase> ;
     using CC1E = TIM10_CCER_CC1E_Values<TIM10::CCER, 0, 1, ReadWriteMode, TIM10CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBU ;
     using FieldValues = TIM10_CCER_CC1E_Values<TIM10::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +123,7 @@ struct TIM10
   struct CNT : public RegisterBase<0x40014424, 32, ReadWriteMode>
   {
     using CNTField = TIM10_CNT_CNT_Values<TIM10::CNT, 0, 16, ReadWriteMode, TIM10CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM10_CNT_CNT_Values<TIM10::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +135,7 @@ struct TIM10
   struct PSC : public RegisterBase<0x40014428, 32, ReadWriteMode>
   {
     using PSCField = TIM10_PSC_PSC_Values<TIM10::PSC, 0, 16, ReadWriteMode, TIM10PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM10_PSC_PSC_Values<TIM10::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +147,7 @@ struct TIM10
   struct ARR : public RegisterBase<0x4001442C, 32, ReadWriteMode>
   {
     using ARRField = TIM10_ARR_ARR_Values<TIM10::ARR, 0, 16, ReadWriteMode, TIM10ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM10_ARR_ARR_Values<TIM10::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,12 +159,14 @@ struct TIM10
   struct CCR1 : public RegisterBase<0x40014434, 32, ReadWriteMode>
   {
     using CCR1Field = TIM10_CCR1_CCR1_Values<TIM10::CCR1, 0, 16, ReadWriteMode, TIM10CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM10_CCR1_CCR1_Values<TIM10::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCR1Pack  = Register<0x40014434, 32, ReadWriteMode, TIM10CCR1Base, T...> ;
 
+  using Registers = TypesList<TIM10::CR1, TIM10::DIER, TIM10::SR, TIM10::EGR, TIM10::CCMR1_Output, TIM10::CCMR1_Input, TIM10::CCER, TIM10::CNT, TIM10::PSC, TIM10::ARR, TIM10::CCR1> ;
 } ;
 
 #endif //#if !defined(TIM10REGISTERS_HPP)
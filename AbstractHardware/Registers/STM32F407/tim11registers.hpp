@@ -26,6 +26,8 @@ struct TIM11
     using URS = TIM11_CR1_URS_Values<TIM11::CR1, 2, 1, ReadWriteMode, TIM11CR1Base> ;
     using UDIS = TIM11_CR1_UDIS_Values<TIM11::CR1, 1, 1, ReadWriteMode, TIM11CR1Base> ;
     using CEN = TIM11_CR1_CEN_Values<TIM11::CR1, 0, 1, ReadWriteMode, TIM11CR1Base> ;
+    static constexpr Type SnapshotMask = 0x386U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM11_CR1_CEN_Values<TIM11::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM11
   {
     using CC1IE = TIM11_DIER_CC1IE_Values<TIM11::DIER, 1, 1, ReadWriteMode, TIM11DIERBase> ;
     using UIE = TIM11_DIER_UIE_Values<TIM11::DIER, 0, 1, ReadWriteMode, TIM11DIERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TIM11_DIER_UIE_Values<TIM11::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,9 @@ struct TIM11
     using CC1OF = TIM11_SR_CC1OF_Values<TIM11::SR, 9, 1, ReadWriteMode, TIM11SRBase> ;
     using CC1IF = TIM11_SR_CC1IF_Values<TIM11::SR, 1, 1, ReadWriteMode, TIM11SRBase> ;
     using UIF = TIM11_SR_UIF_Values<TIM11::SR, 0, 1, ReadWriteMode, TIM11SRBase> ;
+    static constexpr Type WritableMask = 0x203U ;
+    static constexpr Type ZeroToClearMask = 0x203U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM11_SR_UIF_Values<TIM11::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +83,7 @@ struct TIM11
     using OC1PE = TIM11_CCMR1_Output_OC1PE_Values<TIM11::CCMR1_Output, 3, 1, ReadWriteMode, TIM11CCMR1_OutputBase> ;
     using OC1FE = TIM11_CCMR1_Output_OC1FE_Values<TIM11::CCMR1_Output, 2, 1, ReadWriteMode, TIM11CCMR1_OutputBase> ;
     using CC1S = TIM11_CCMR1_Output_CC1S_Values<TIM11::CCMR1_Output, 0, 2, ReadWriteMode, TIM11CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = TIM11_CCMR1_Output_CC1S_Values<TIM11::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +97,7 @@ struct TIM11
     using IC1F = TIM11_CCMR1_Input_IC1F_Values<TIM11::CCMR1_Input, 4, 4, ReadWriteMode, TIM11CCMR1_InputBase> ;
     using ICPCS = TIM11_CCMR1_Input_ICPCS_Values<TIM11::CCMR1_Input, 2, 2, ReadWriteMode, TIM11CCMR1_InputBase> ;
     using CC1S = TIM11_CCMR1_Input_CC1S_Values<TIM11::CCMR1_Input, 0, 2, ReadWriteMode, TIM11CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM11_CCMR1_Input_CC1S_Values<TIM11::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +111,7 @@ struct TIM11
     using CC1NP = TIM11_CCER_CC1NP_Values<TIM11::CCER, 3, 1, ReadWriteMode, TIM11CCERBase> ;
     using CC1P = TIM11_CCER_CC1P_Values<TIM11::CCER, 1, 1, ReadWriteMode, TIM11CCERBase> ;
     using CC1E = TIM11_CCER_CC1E_Values<TIM11::CCER, 0, 1, ReadWriteMode, TIM11CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBU ;
     using FieldValues = TIM11_CCER_CC1E_Values<TIM11::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +123,7 @@ struct TIM11
   struct CNT : public RegisterBase<0x40014824, 32, ReadWriteMode>
   {
     using CNTField = TIM11_CNT_CNT_Values<TIM11::CNT, 0, 16, ReadWriteMode, TIM11CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM11_CNT_CNT_Values<TIM11::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +135,7 @@ struct TIM11
   struct PSC : public RegisterBase<0x40014828, 32, ReadWriteMode>
   {
     using PSCField = TIM11_PSC_PSC_Values<TIM11::PSC, 0, 16, ReadWriteMode, TIM11PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM11_PSC_PSC_Values<TIM11::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +147,7 @@ struct TIM11
   struct ARR : public RegisterBase<0x4001482C, 32, ReadWriteMode>
   {
     using ARRField = TIM11_ARR_ARR_Values<TIM11::ARR, 0, 16, ReadWriteMode, TIM11ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM11_ARR_ARR_Values<TIM11::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,6 +159,7 @@ struct TIM11
   struct CCR1 : public RegisterBase<0x40014834, 32, ReadWriteMode>
   {
     using CCR1Field = TIM11_CCR1_CCR1_Values<TIM11::CCR1, 0, 16, ReadWriteMode, TIM11CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM11_CCR1_CCR1_Values<TIM11::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,12 +171,14 @@ struct TIM11
   struct OR : public RegisterBase<0x40014850, 32, ReadWriteMode>
   {
     using RMP = TIM11_OR_RMP_Values<TIM11::OR, 0, 2, ReadWriteMode, TIM11ORBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TIM11_OR_RMP_Values<TIM11::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40014850, 32, ReadWriteMode, TIM11ORBase, T...> ;
 
+  using Registers = TypesList<TIM11::CR1, TIM11::DIER, TIM11::SR, TIM11::EGR, TIM11::CCMR1_Output, TIM11::CCMR1_Input, TIM11::CCER, TIM11::CNT, TIM11::PSC, TIM11::ARR, TIM11::CCR1, TIM11::OR> ;
 } ;
 
 #endif //#if !defined(TIM11REGISTERS_HPP)
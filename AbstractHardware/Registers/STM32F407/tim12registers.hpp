@@ -27,6 +27,8 @@ struct TIM12
     using URS = TIM12_CR1_URS_Values<TIM12::CR1, 2, 1, ReadWriteMode, TIM12CR1Base> ;
     using UDIS = TIM12_CR1_UDIS_Values<TIM12::CR1, 1, 1, ReadWriteMode, TIM12CR1Base> ;
     using CEN = TIM12_CR1_CEN_Values<TIM12::CR1, 0, 1, ReadWriteMode, TIM12CR1Base> ;
+    static constexpr Type SnapshotMask = 0x38EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM12_CR1_CEN_Values<TIM12::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM12
   struct CR2 : public RegisterBase<0x40001804, 32, ReadWriteMode>
   {
     using MMS = TIM12_CR2_MMS_Values<TIM12::CR2, 4, 3, ReadWriteMode, TIM12CR2Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIM12_CR2_MMS_Values<TIM12::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,7 @@ struct TIM12
     using MSM = TIM12_SMCR_MSM_Values<TIM12::SMCR, 7, 1, ReadWriteMode, TIM12SMCRBase> ;
     using TS = TIM12_SMCR_TS_Values<TIM12::SMCR, 4, 3, ReadWriteMode, TIM12SMCRBase> ;
     using SMS = TIM12_SMCR_SMS_Values<TIM12::SMCR, 0, 3, ReadWriteMode, TIM12SMCRBase> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = TIM12_SMCR_SMS_Values<TIM12::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +69,7 @@ struct TIM12
     using CC2IE = TIM12_DIER_CC2IE_Values<TIM12::DIER, 2, 1, ReadWriteMode, TIM12DIERBase> ;
     using CC1IE = TIM12_DIER_CC1IE_Values<TIM12::DIER, 1, 1, ReadWriteMode, TIM12DIERBase> ;
     using UIE = TIM12_DIER_UIE_Values<TIM12::DIER, 0, 1, ReadWriteMode, TIM12DIERBase> ;
+    static constexpr Type SnapshotMask = 0x47U ;
     using FieldValues = TIM12_DIER_UIE_Values<TIM12::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +86,9 @@ struct TIM12
     using CC2IF = TIM12_SR_CC2IF_Values<TIM12::SR, 2, 1, ReadWriteMode, TIM12SRBase> ;
     using CC1IF = TIM12_SR_CC1IF_Values<TIM12::SR, 1, 1, ReadWriteMode, TIM12SRBase> ;
     using UIF = TIM12_SR_UIF_Values<TIM12::SR, 0, 1, ReadWriteMode, TIM12SRBase> ;
+    static constexpr Type WritableMask = 0x647U ;
+    static constexpr Type ZeroToClearMask = 0x647U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM12_SR_UIF_Values<TIM12::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +121,7 @@ struct TIM12
     using OC1PE = TIM12_CCMR1_Output_OC1PE_Values<TIM12::CCMR1_Output, 3, 1, ReadWriteMode, TIM12CCMR1_OutputBase> ;
     using OC1FE = TIM12_CCMR1_Output_OC1FE_Values<TIM12::CCMR1_Output, 2, 1, ReadWriteMode, TIM12CCMR1_OutputBase> ;
     using CC1S = TIM12_CCMR1_Output_CC1S_Values<TIM12::CCMR1_Output, 0, 2, ReadWriteMode, TIM12CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7F7FU ;
     using FieldValues = TIM12_CCMR1_Output_CC1S_Values<TIM12::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -129,6 +138,7 @@ struct TIM12
     using IC1F = TIM12_CCMR1_Input_IC1F_Values<TIM12::CCMR1_Input, 4, 3, ReadWriteMode, TIM12CCMR1_InputBase> ;
     using ICPCS = TIM12_CCMR1_Input_ICPCS_Values<TIM12::CCMR1_Input, 2, 2, ReadWriteMode, TIM12CCMR1_InputBase> ;
     using CC1S = TIM12_CCMR1_Input_CC1S_Values<TIM12::CCMR1_Input, 0, 2, ReadWriteMode, TIM12CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0x7F7FU ;
     using FieldValues = TIM12_CCMR1_Input_CC1S_Values<TIM12::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +155,7 @@ struct TIM12
     using CC1NP = TIM12_CCER_CC1NP_Values<TIM12::CCER, 3, 1, ReadWriteMode, TIM12CCERBase> ;
     using CC1P = TIM12_CCER_CC1P_Values<TIM12::CCER, 1, 1, ReadWriteMode, TIM12CCERBase> ;
     using CC1E = TIM12_CCER_CC1E_Values<TIM12::CCER, 0, 1, ReadWriteMode, TIM12CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBU ;
     using FieldValues = TIM12_CCER_CC1E_Values<TIM12::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -156,6 +167,7 @@ struct TIM12
   struct CNT : public RegisterBase<0x40001824, 32, ReadWriteMode>
   {
     using CNTField = TIM12_CNT_CNT_Values<TIM12::CNT, 0, 16, ReadWriteMode, TIM12CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM12_CNT_CNT_Values<TIM12::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +179,7 @@ struct TIM12
   struct PSC : public RegisterBase<0x40001828, 32, ReadWriteMode>
   {
     using PSCField = TIM12_PSC_PSC_Values<TIM12::PSC, 0, 16, ReadWriteMode, TIM12PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM12_PSC_PSC_Values<TIM12::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -178,6 +191,7 @@ struct TIM12
   struct ARR : public RegisterBase<0x4000182C, 32, ReadWriteMode>
   {
     using ARRField = TIM12_ARR_ARR_Values<TIM12::ARR, 0, 16, ReadWriteMode, TIM12ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM12_ARR_ARR_Values<TIM12::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +203,7 @@ struct TIM12
   struct CCR1 : public RegisterBase<0x40001834, 32, ReadWriteMode>
   {
     using CCR1Field = TIM12_CCR1_CCR1_Values<TIM12::CCR1, 0, 16, ReadWriteMode, TIM12CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM12_CCR1_CCR1_Values<TIM12::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -200,12 +215,14 @@ struct TIM12
   struct CCR2 : public RegisterBase<0x40001838, 32, ReadWriteMode>
   {
     using CCR2Field = TIM12_CCR2_CCR2_Values<TIM12::CCR2, 0, 16, ReadWriteMode, TIM12CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM12_CCR2_CCR2_Values<TIM12::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCR2Pack  = Register<0x40001838, 32, ReadWriteMode, TIM12CCR2Base, T...> ;
 
+  using Registers = TypesList<TIM12::CR1, TIM12::CR2, TIM12::SMCR, TIM12::DIER, TIM12::SR, TIM12::EGR, TIM12::CCMR1_Output, TIM12::CCMR1_Input, TIM12::CCER, TIM12::CNT, TIM12::PSC, TIM12::ARR, TIM12::CCR1, TIM12::CCR2> ;
 } ;
 
 #endif //#if !defined(TIM12REGISTERS_HPP)
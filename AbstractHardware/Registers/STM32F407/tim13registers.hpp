@@ -26,6 +26,8 @@ struct TIM13
     using URS = TIM13_CR1_URS_Values<TIM13::CR1, 2, 1, ReadWriteMode, TIM13CR1Base> ;
     using UDIS = TIM13_CR1_UDIS_Values<TIM13::CR1, 1, 1, ReadWriteMode, TIM13CR1Base> ;
     using CEN = TIM13_CR1_CEN_Values<TIM13::CR1, 0, 1, ReadWriteMode, TIM13CR1Base> ;
+    static constexpr Type SnapshotMask = 0x386U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM13_CR1_CEN_Values<TIM13::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM13
   {
     using CC1IE = TIM13_DIER_CC1IE_Values<TIM13::DIER, 1, 1, ReadWriteMode, TIM13DIERBase> ;
     using UIE = TIM13_DIER_UIE_Values<TIM13::DIER, 0, 1, ReadWriteMode, TIM13DIERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TIM13_DIER_UIE_Values<TIM13::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,9 @@ struct TIM13
     using CC1OF = TIM13_SR_CC1OF_Values<TIM13::SR, 9, 1, ReadWriteMode, TIM13SRBase> ;
     using CC1IF = TIM13_SR_CC1IF_Values<TIM13::SR, 1, 1, ReadWriteMode, TIM13SRBase> ;
     using UIF = TIM13_SR_UIF_Values<TIM13::SR, 0, 1, ReadWriteMode, TIM13SRBase> ;
+    static constexpr Type WritableMask = 0x203U ;
+    static constexpr Type ZeroToClearMask = 0x203U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM13_SR_UIF_Values<TIM13::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +83,7 @@ struct TIM13
     using OC1PE = TIM13_CCMR1_Output_OC1PE_Values<TIM13::CCMR1_Output, 3, 1, ReadWriteMode, TIM13CCMR1_OutputBase> ;
     using OC1FE = TIM13_CCMR1_Output_OC1FE_Values<TIM13::CCMR1_Output, 2, 1, ReadWriteMode, TIM13CCMR1_OutputBase> ;
     using CC1S = TIM13_CCMR1_Output_CC1S_Values<TIM13::CCMR1_Output, 0, 2, ReadWriteMode, TIM13CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = TIM13_CCMR1_Output_CC1S_Values<TIM13::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +97,7 @@ struct TIM13
     using IC1F = TIM13_CCMR1_Input_IC1F_Values<TIM13::CCMR1_Input, 4, 4, ReadWriteMode, TIM13CCMR1_InputBase> ;
     using ICPCS = TIM13_CCMR1_Input_ICPCS_Values<TIM13::CCMR1_Input, 2, 2, ReadWriteMode, TIM13CCMR1_InputBase> ;
     using CC1S = TIM13_CCMR1_Input_CC1S_Values<TIM13::CCMR1_Input, 0, 2, ReadWriteMode, TIM13CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM13_CCMR1_Input_CC1S_Values<TIM13::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +111,7 @@ struct TIM13
     using CC1NP = TIM13_CCER_CC1NP_Values<TIM13::CCER, 3, 1, ReadWriteMode, TIM13CCERBase> ;
     using CC1P = TIM13_CCER_CC1P_Values<TIM13::CCER, 1, 1, ReadWriteMode, TIM13CCERBase> ;
     using CC1E = TIM13_CCER_CC1E_Values<TIM13::CCER, 0, 1, ReadWriteMode, TIM13CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBU ;
     using FieldValues = TIM13_CCER_CC1E_Values<TIM13::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +123,7 @@ struct TIM13
   struct CNT : public RegisterBase<0x40001C24, 32, ReadWriteMode>
   {
     using CNTField = TIM13_CNT_CNT_Values<TIM13::CNT, 0, 16, ReadWriteMode, TIM13CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM13_CNT_CNT_Values<TIM13::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +135,7 @@ struct TIM13
   struct PSC : public RegisterBase<0x40001C28, 32, ReadWriteMode>
   {
     using PSCField = TIM13_PSC_PSC_Values<TIM13::PSC, 0, 16, ReadWriteMode, TIM13PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM13_PSC_PSC_Values<TIM13::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +147,7 @@ struct TIM13
   struct ARR : public RegisterBase<0x40001C2C, 32, ReadWriteMode>
   {
     using ARRField = TIM13_ARR_ARR_Values<TIM13::ARR, 0, 16, ReadWriteMode, TIM13ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM13_ARR_ARR_Values<TIM13::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,12 +159,14 @@ struct TIM13
   struct CCR1 : public RegisterBase<0x40001C34, 32, ReadWriteMode>
   {
     using CCR1Field = TIM13_CCR1_CCR1_Values<TIM13::CCR1, 0, 16, ReadWriteMode, TIM13CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM13_CCR1_CCR1_Values<TIM13::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCR1Pack  = Register<0x40001C34, 32, ReadWriteMode, TIM13CCR1Base, T...> ;
 
+  using Registers = TypesList<TIM13::CR1, TIM13::DIER, TIM13::SR, TIM13::EGR, TIM13::CCMR1_Output, TIM13::CCMR1_Input, TIM13::CCER, TIM13::CNT, TIM13::PSC, TIM13::ARR, TIM13::CCR1> ;
 } ;
 
 #endif //#if !defined(TIM13REGISTERS_HPP)
@@ -26,6 +26,8 @@ struct TIM14
     using URS = TIM14_CR1_URS_Values<TIM14::CR1, 2, 1, ReadWriteMode, TIM14CR1Base> ;
     using UDIS = TIM14_CR1_UDIS_Values<TIM14::CR1, 1, 1, ReadWriteMode, TIM14CR1Base> ;
     using CEN = TIM14_CR1_CEN_Values<TIM14::CR1, 0, 1, ReadWriteMode, TIM14CR1Base> ;
+    static constexpr Type SnapshotMask = 0x386U ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM14_CR1_CEN_Values<TIM14::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM14
   {
     using CC1IE = TIM14_DIER_CC1IE_Values<TIM14::DIER, 1, 1, ReadWriteMode, TIM14DIERBase> ;
     using UIE = TIM14_DIER_UIE_Values<TIM14::DIER, 0, 1, ReadWriteMode, TIM14DIERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TIM14_DIER_UIE_Values<TIM14::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,9 @@ struct TIM14
     using CC1OF = TIM14_SR_CC1OF_Values<TIM14::SR, 9, 1, ReadWriteMode, TIM14SRBase> ;
     using CC1IF = TIM14_SR_CC1IF_Values<TIM14::SR, 1, 1, ReadWriteMode, TIM14SRBase> ;
     using UIF = TIM14_SR_UIF_Values<TIM14::SR, 0, 1, ReadWriteMode, TIM14SRBase> ;
+    static constexpr Type WritableMask = 0x203U ;
+    static constexpr Type ZeroToClearMask = 0x203U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM14_SR_UIF_Values<TIM14::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +83,7 @@ struct TIM14
     using OC1PE = TIM14_CCMR1_Output_OC1PE_Values<TIM14::CCMR1_Output, 3, 1, ReadWriteMode, TIM14CCMR1_OutputBase> ;
     using OC1FE = TIM14_CCMR1_Output_OC1FE_Values<TIM14::CCMR1_Output, 2, 1, ReadWriteMode, TIM14CCMR1_OutputBase> ;
     using CC1S = TIM14_CCMR1_Output_CC1S_Values<TIM14::CCMR1_Output, 0, 2, ReadWriteMode, TIM14CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = TIM14_CCMR1_Output_CC1S_Values<TIM14::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +97,7 @@ struct TIM14
     using IC1F = TIM14_CCMR1_Input_IC1F_Values<TIM14::CCMR1_Input, 4, 4, ReadWriteMode, TIM14CCMR1_InputBase> ;
     using ICPCS = TIM14_CCMR1_Input_ICPCS_Values<TIM14::CCMR1_Input, 2, 2, ReadWriteMode, TIM14CCMR1_InputBase> ;
     using CC1S = TIM14_CCMR1_Input_CC1S_Values<TIM14::CCMR1_Input, 0, 2, ReadWriteMode, TIM14CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM14_CCMR1_Input_CC1S_Values<TIM14::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +111,7 @@ struct TIM14
     using CC1NP = TIM14_CCER_CC1NP_Values<TIM14::CCER, 3, 1, ReadWriteMode, TIM14CCERBase> ;
     using CC1P = TIM14_CCER_CC1P_Values<TIM14::CCER, 1, 1, ReadWriteMode, TIM14CCERBase> ;
     using CC1E = TIM14_CCER_CC1E_Values<TIM14::CCER, 0, 1, ReadWriteMode, TIM14CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBU ;
     using FieldValues = TIM14_CCER_CC1E_Values<TIM14::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +123,7 @@ struct TIM14
   struct CNT : public RegisterBase<0x40002024, 32, ReadWriteMode>
   {
     using CNTField = TIM14_CNT_CNT_Values<TIM14::CNT, 0, 16, ReadWriteMode, TIM14CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM14_CNT_CNT_Values<TIM14::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +135,7 @@ struct TIM14
   struct PSC : public RegisterBase<0x40002028, 32, ReadWriteMode>
   {
     using PSCField = TIM14_PSC_PSC_Values<TIM14::PSC, 0, 16, ReadWriteMode, TIM14PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM14_PSC_PSC_Values<TIM14::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +147,7 @@ struct TIM14
   struct ARR : public RegisterBase<0x4000202C, 32, ReadWriteMode>
   {
     using ARRField = TIM14_ARR_ARR_Values<TIM14::ARR, 0, 16, ReadWriteMode, TIM14ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM14_ARR_ARR_Values<TIM14::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,12 +159,14 @@ struct TIM14
   struct CCR1 : public RegisterBase<0x40002034, 32, ReadWriteMode>
   {
     using CCR1Field = TIM14_CCR1_CCR1_Values<TIM14::CCR1, 0, 16, ReadWriteMode, TIM14CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM14_CCR1_CCR1_Values<TIM14::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCR1Pack  = Register<0x40002034, 32, ReadWriteMode, TIM14CCR1Base, T...> ;
 
+  using Registers = TypesList<TIM14::CR1, TIM14::DIER, TIM14::SR, TIM14::EGR, TIM14::CCMR1_Output, TIM14::CCMR1_Input, TIM14::CCER, TIM14::CNT, TIM14::PSC, TIM14::ARR, TIM14::CCR1> ;
 } ;
 
 #endif //#if !defined(TIM14REGISTERS_HPP)
@@ -29,6 +29,8 @@ struct TIM1
     using URS = TIM1_CR1_URS_Values<TIM1::CR1, 2, 1, ReadWriteMode, TIM1CR1Base> ;
     using UDIS = TIM1_CR1_UDIS_Values<TIM1::CR1, 1, 1, ReadWriteMode, TIM1CR1Base> ;
     using CEN = TIM1_CR1_CEN_Values<TIM1::CR1, 0, 1, ReadWriteMode, TIM1CR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM1_CR1_CEN_Values<TIM1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +53,7 @@ struct TIM1
     using CCDS = TIM1_CR2_CCDS_Values<TIM1::CR2, 3, 1, ReadWriteMode, TIM1CR2Base> ;
     using CCUS = TIM1_CR2_CCUS_Values<TIM1::CR2, 2, 1, ReadWriteMode, TIM1CR2Base> ;
     using CCPC = TIM1_CR2_CCPC_Values<TIM1::CR2, 0, 1, ReadWriteMode, TIM1CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFDU ;
     using FieldValues = TIM1_CR2_CCPC_Values<TIM1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -68,6 +71,7 @@ struct TIM1
     using MSM = TIM1_SMCR_MSM_Values<TIM1::SMCR, 7, 1, ReadWriteMode, TIM1SMCRBase> ;
     using TS = TIM1_SMCR_TS_Values<TIM1::SMCR, 4, 3, ReadWriteMode, TIM1SMCRBase> ;
     using SMS = TIM1_SMCR_SMS_Values<TIM1::SMCR, 0, 3, ReadWriteMode, TIM1SMCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIM1_SMCR_SMS_Values<TIM1::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +97,7 @@ struct TIM1
     using UIE = TIM1_DIER_UIE_Values<TIM1::DIER, 0, 1, ReadWriteMode, TIM1DIERBase> ;
     using BIE = TIM1_DIER_BIE_Values<TIM1::DIER, 7, 1, ReadWriteMode, TIM1DIERBase> ;
     using COMIE = TIM1_DIER_COMIE_Values<TIM1::DIER, 5, 1, ReadWriteMode, TIM1DIERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = TIM1_DIER_COMIE_Values<TIM1::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +120,9 @@ struct TIM1
     using CC2IF = TIM1_SR_CC2IF_Values<TIM1::SR, 2, 1, ReadWriteMode, TIM1SRBase> ;
     using CC1IF = TIM1_SR_CC1IF_Values<TIM1::SR, 1, 1, ReadWriteMode, TIM1SRBase> ;
     using UIF = TIM1_SR_UIF_Values<TIM1::SR, 0, 1, ReadWriteMode, TIM1SRBase> ;
+    static constexpr Type WritableMask = 0x1EFFU ;
+    static constexpr Type ZeroToClearMask = 0x1EFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM1_SR_UIF_Values<TIM1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +161,7 @@ struct TIM1
     using OC1PE = TIM1_CCMR1_Output_OC1PE_Values<TIM1::CCMR1_Output, 3, 1, ReadWriteMode, TIM1CCMR1_OutputBase> ;
     using OC1FE = TIM1_CCMR1_Output_OC1FE_Values<TIM1::CCMR1_Output, 2, 1, ReadWriteMode, TIM1CCMR1_OutputBase> ;
     using CC1S = TIM1_CCMR1_Output_CC1S_Values<TIM1::CCMR1_Output, 0, 2, ReadWriteMode, TIM1CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCMR1_Output_CC1S_Values<TIM1::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +178,7 @@ struct TIM1
     using IC1F = TIM1_CCMR1_Input_IC1F_Values<TIM1::CCMR1_Input, 4, 4, ReadWriteMode, TIM1CCMR1_InputBase> ;
     using ICPCS = TIM1_CCMR1_Input_ICPCS_Values<TIM1::CCMR1_Input, 2, 2, ReadWriteMode, TIM1CCMR1_InputBase> ;
     using CC1S = TIM1_CCMR1_Input_CC1S_Values<TIM1::CCMR1_Input, 0, 2, ReadWriteMode, TIM1CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCMR1_Input_CC1S_Values<TIM1::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +199,7 @@ struct TIM1
     using OC3PE = TIM1_CCMR2_Output_OC3PE_Values<TIM1::CCMR2_Output, 3, 1, ReadWriteMode, TIM1CCMR2_OutputBase> ;
     using OC3FE = TIM1_CCMR2_Output_OC3FE_Values<TIM1::CCMR2_Output, 2, 1, ReadWriteMode, TIM1CCMR2_OutputBase> ;
     using CC3S = TIM1_CCMR2_Output_CC3S_Values<TIM1::CCMR2_Output, 0, 2, ReadWriteMode, TIM1CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCMR2_Output_CC3S_Values<TIM1::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +216,7 @@ struct TIM1
     using IC3F = TIM1_CCMR2_Input_IC3F_Values<TIM1::CCMR2_Input, 4, 4, ReadWriteMode, TIM1CCMR2_InputBase> ;
     using IC3PSC = TIM1_CCMR2_Input_IC3PSC_Values<TIM1::CCMR2_Input, 2, 2, ReadWriteMode, TIM1CCMR2_InputBase> ;
     using CC3S = TIM1_CCMR2_Input_CC3S_Values<TIM1::CCMR2_Input, 0, 2, ReadWriteMode, TIM1CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCMR2_Input_CC3S_Values<TIM1::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +241,7 @@ struct TIM1
     using CC1NE = TIM1_CCER_CC1NE_Values<TIM1::CCER, 2, 1, ReadWriteMode, TIM1CCERBase> ;
     using CC1P = TIM1_CCER_CC1P_Values<TIM1::CCER, 1, 1, ReadWriteMode, TIM1CCERBase> ;
     using CC1E = TIM1_CCER_CC1E_Values<TIM1::CCER, 0, 1, ReadWriteMode, TIM1CCERBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFU ;
     using FieldValues = TIM1_CCER_CC1E_Values<TIM1::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +253,7 @@ struct TIM1
   struct CNT : public RegisterBase<0x40010024, 32, ReadWriteMode>
   {
     using CNTField = TIM1_CNT_CNT_Values<TIM1::CNT, 0, 16, ReadWriteMode, TIM1CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM1_CNT_CNT_Values<TIM1::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +265,7 @@ struct TIM1
   struct PSC : public RegisterBase<0x40010028, 32, ReadWriteMode>
   {
     using PSCField = TIM1_PSC_PSC_Values<TIM1::PSC, 0, 16, ReadWriteMode, TIM1PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_PSC_PSC_Values<TIM1::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +277,7 @@ struct TIM1
   struct ARR : public RegisterBase<0x4001002C, 32, ReadWriteMode>
   {
     using ARRField = TIM1_ARR_ARR_Values<TIM1::ARR, 0, 16, ReadWriteMode, TIM1ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_ARR_ARR_Values<TIM1::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +289,7 @@ struct TIM1
   struct CCR1 : public RegisterBase<0x40010034, 32, ReadWriteMode>
   {
     using CCR1Field = TIM1_CCR1_CCR1_Values<TIM1::CCR1, 0, 16, ReadWriteMode, TIM1CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR1_CCR1_Values<TIM1::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +301,7 @@ struct TIM1
   struct CCR2 : public RegisterBase<0x40010038, 32, ReadWriteMode>
   {
     using CCR2Field = TIM1_CCR2_CCR2_Values<TIM1::CCR2, 0, 16, ReadWriteMode, TIM1CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR2_CCR2_Values<TIM1::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -295,6 +313,7 @@ struct TIM1
   struct CCR3 : public RegisterBase<0x4001003C, 32, ReadWriteMode>
   {
     using CCR3Field = TIM1_CCR3_CCR3_Values<TIM1::CCR3, 0, 16, ReadWriteMode, TIM1CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR3_CCR3_Values<TIM1::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +325,7 @@ struct TIM1
   struct CCR4 : public RegisterBase<0x40010040, 32, ReadWriteMode>
   {
     using CCR4Field = TIM1_CCR4_CCR4_Values<TIM1::CCR4, 0, 16, ReadWriteMode, TIM1CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_CCR4_CCR4_Values<TIM1::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -318,6 +338,7 @@ struct TIM1
   {
     using DBL = TIM1_DCR_DBL_Values<TIM1::DCR, 8, 5, ReadWriteMode, TIM1DCRBase> ;
     using DBA = TIM1_DCR_DBA_Values<TIM1::DCR, 0, 5, ReadWriteMode, TIM1DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM1_DCR_DBA_Values<TIM1::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +350,7 @@ struct TIM1
   struct DMAR : public RegisterBase<0x4001004C, 32, ReadWriteMode>
   {
     using DMAB = TIM1_DMAR_DMAB_Values<TIM1::DMAR, 0, 16, ReadWriteMode, TIM1DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_DMAR_DMAB_Values<TIM1::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +362,7 @@ struct TIM1
   struct RCR : public RegisterBase<0x40010030, 32, ReadWriteMode>
   {
     using REP = TIM1_RCR_REP_Values<TIM1::RCR, 0, 8, ReadWriteMode, TIM1RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM1_RCR_REP_Values<TIM1::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,12 +381,14 @@ struct TIM1
     using OSSI = TIM1_BDTR_OSSI_Values<TIM1::BDTR, 10, 1, ReadWriteMode, TIM1BDTRBase> ;
     using LOCK = TIM1_BDTR_LOCK_Values<TIM1::BDTR, 8, 2, ReadWriteMode, TIM1BDTRBase> ;
     using DTG = TIM1_BDTR_DTG_Values<TIM1::BDTR, 0, 8, ReadWriteMode, TIM1BDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM1_BDTR_DTG_Values<TIM1::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BDTRPack  = Register<0x40010044, 32, ReadWriteMode, TIM1BDTRBase, T...> ;
 
+  using Registers = TypesList<TIM1::CR1, TIM1::CR2, TIM1::SMCR, TIM1::DIER, TIM1::SR, TIM1::EGR, TIM1::CCMR1_Output, TIM1::CCMR1_Input, TIM1::CCMR2_Output, TIM1::CCMR2_Input, TIM1::CCER, TIM1::CNT, TIM1::PSC, TIM1::ARR, TIM1::CCR1, TIM1::CCR2, TIM1::CCR3, TIM1::CCR4, TIM1::DCR, TIM1::DMAR, TIM1::RCR, TIM1::BDTR> ;
 } ;
 
 #endif //#if !defined(TIM1REGISTERS_HPP)
@@ -29,6 +29,8 @@ struct TIM4
     using URS = TIM4_CR1_URS_Values<TIM4::CR1, 2, 1, ReadWriteMode, TIM4CR1Base> ;
     using UDIS = TIM4_CR1_UDIS_Values<TIM4::CR1, 1, 1, ReadWriteMode, TIM4CR1Base> ;
     using CEN = TIM4_CR1_CEN_Values<TIM4::CR1, 0, 1, ReadWriteMode, TIM4CR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM4_CR1_CEN_Values<TIM4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +44,7 @@ struct TIM4
     using TI1S = TIM4_CR2_TI1S_Values<TIM4::CR2, 7, 1, ReadWriteMode, TIM4CR2Base> ;
     using MMS = TIM4_CR2_MMS_Values<TIM4::CR2, 4, 3, ReadWriteMode, TIM4CR2Base> ;
     using CCDS = TIM4_CR2_CCDS_Values<TIM4::CR2, 3, 1, ReadWriteMode, TIM4CR2Base> ;
+    static constexpr Type SnapshotMask = 0xF8U ;
     using FieldValues = TIM4_CR2_CCDS_Values<TIM4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +62,7 @@ struct TIM4
     using MSM = TIM4_SMCR_MSM_Values<TIM4::SMCR, 7, 1, ReadWriteMode, TIM4SMCRBase> ;
     using TS = TIM4_SMCR_TS_Values<TIM4::SMCR, 4, 3, ReadWriteMode, TIM4SMCRBase> ;
     using SMS = TIM4_SMCR_SMS_Values<TIM4::SMCR, 0, 3, ReadWriteMode, TIM4SMCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFF7U ;
     using FieldValues = TIM4_SMCR_SMS_Values<TIM4::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct TIM4
     using CC2IE = TIM4_DIER_CC2IE_Values<TIM4::DIER, 2, 1, ReadWriteMode, TIM4DIERBase> ;
     using CC1IE = TIM4_DIER_CC1IE_Values<TIM4::DIER, 1, 1, ReadWriteMode, TIM4DIERBase> ;
     using UIE = TIM4_DIER_UIE_Values<TIM4::DIER, 0, 1, ReadWriteMode, TIM4DIERBase> ;
+    static constexpr Type SnapshotMask = 0x5F5FU ;
     using FieldValues = TIM4_DIER_UIE_Values<TIM4::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +106,9 @@ struct TIM4
     using CC2IF = TIM4_SR_CC2IF_Values<TIM4::SR, 2, 1, ReadWriteMode, TIM4SRBase> ;
     using CC1IF = TIM4_SR_CC1IF_Values<TIM4::SR, 1, 1, ReadWriteMode, TIM4SRBase> ;
     using UIF = TIM4_SR_UIF_Values<TIM4::SR, 0, 1, ReadWriteMode, TIM4SRBase> ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM4_SR_UIF_Values<TIM4::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +145,7 @@ struct TIM4
     using OC1PE = TIM4_CCMR1_Output_OC1PE_Values<TIM4::CCMR1_Output, 3, 1, ReadWriteMode, TIM4CCMR1_OutputBase> ;
     using OC1FE = TIM4_CCMR1_Output_OC1FE_Values<TIM4::CCMR1_Output, 2, 1, ReadWriteMode, TIM4CCMR1_OutputBase> ;
     using CC1S = TIM4_CCMR1_Output_CC1S_Values<TIM4::CCMR1_Output, 0, 2, ReadWriteMode, TIM4CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_CCMR1_Output_CC1S_Values<TIM4::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +162,7 @@ struct TIM4
     using IC1F = TIM4_CCMR1_Input_IC1F_Values<TIM4::CCMR1_Input, 4, 4, ReadWriteMode, TIM4CCMR1_InputBase> ;
     using ICPCS = TIM4_CCMR1_Input_ICPCS_Values<TIM4::CCMR1_Input, 2, 2, ReadWriteMode, TIM4CCMR1_InputBase> ;
     using CC1S = TIM4_CCMR1_Input_CC1S_Values<TIM4::CCMR1_Input, 0, 2, ReadWriteMode, TIM4CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_CCMR1_Input_CC1S_Values<TIM4::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +183,7 @@ struct TIM4
     using OC3PE = TIM4_CCMR2_Output_OC3PE_Values<TIM4::CCMR2_Output, 3, 1, ReadWriteMode, TIM4CCMR2_OutputBase> ;
     using OC3FE = TIM4_CCMR2_Output_OC3FE_Values<TIM4::CCMR2_Output, 2, 1, ReadWriteMode, TIM4CCMR2_OutputBase> ;
     using CC3S = TIM4_CCMR2_Output_CC3S_Values<TIM4::CCMR2_Output, 0, 2, ReadWriteMode, TIM4CCMR2_OutputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_CCMR2_Output_CC3S_Values<TIM4::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +200,7 @@ struct TIM4
     using IC3F = TIM4_CCMR2_Input_IC3F_Values<TIM4::CCMR2_Input, 4, 4, ReadWriteMode, TIM4CCMR2_InputBase> ;
     using IC3PSC = TIM4_CCMR2_Input_IC3PSC_Values<TIM4::CCMR2_Input, 2, 2, ReadWriteMode, TIM4CCMR2_InputBase> ;
     using CC3S = TIM4_CCMR2_Input_CC3S_Values<TIM4::CCMR2_Input, 0, 2, ReadWriteMode, TIM4CCMR2_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_CCMR2_Input_CC3S_Values<TIM4::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +223,7 @@ struct TIM4
     using CC1NP = TIM4_CCER_CC1NP_Values<TIM4::CCER, 3, 1, ReadWriteMode, TIM4CCERBase> ;
     using CC1P = TIM4_CCER_CC1P_Values<TIM4::CCER, 1, 1, ReadWriteMode, TIM4CCERBase> ;
     using CC1E = TIM4_CCER_CC1E_Values<TIM4::CCER, 0, 1, ReadWriteMode, TIM4CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBBBU ;
     using FieldValues = TIM4_CCER_CC1E_Values<TIM4::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +236,7 @@ struct TIM4
   {
     using CNT_H = TIM4_CNT_CNT_H_Values<TIM4::CNT, 16, 16, ReadWriteMode, TIM4CNTBase> ;
     using CNT_L = TIM4_CNT_CNT_L_Values<TIM4::CNT, 0, 16, ReadWriteMode, TIM4CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM4_CNT_CNT_L_Values<TIM4::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -234,6 +248,7 @@ struct TIM4
   struct PSC : public RegisterBase<0x40000828, 32, ReadWriteMode>
   {
     using PSCField = TIM4_PSC_PSC_Values<TIM4::PSC, 0, 16, ReadWriteMode, TIM4PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_PSC_PSC_Values<TIM4::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -246,6 +261,7 @@ struct TIM4
   {
     using ARR_H = TIM4_ARR_ARR_H_Values<TIM4::ARR, 16, 16, ReadWriteMode, TIM4ARRBase> ;
     using ARR_L = TIM4_ARR_ARR_L_Values<TIM4::ARR, 0, 16, ReadWriteMode, TIM4ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_ARR_ARR_L_Values<TIM4::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -258,6 +274,7 @@ struct TIM4
   {
     using CCR1_H = TIM4_CCR1_CCR1_H_Values<TIM4::CCR1, 16, 16, ReadWriteMode, TIM4CCR1Base> ;
     using CCR1_L = TIM4_CCR1_CCR1_L_Values<TIM4::CCR1, 0, 16, ReadWriteMode, TIM4CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR1_CCR1_L_Values<TIM4::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +287,7 @@ struct TIM4
   {
     using CCR2_H = TIM4_CCR2_CCR2_H_Values<TIM4::CCR2, 16, 16, ReadWriteMode, TIM4CCR2Base> ;
     using CCR2_L = TIM4_CCR2_CCR2_L_Values<TIM4::CCR2, 0, 16, ReadWriteMode, TIM4CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR2_CCR2_L_Values<TIM4::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +300,7 @@ struct TIM4
   {
     using CCR3_H = TIM4_CCR3_CCR3_H_Values<TIM4::CCR3, 16, 16, ReadWriteMode, TIM4CCR3Base> ;
     using CCR3_L = TIM4_CCR3_CCR3_L_Values<TIM4::CCR3, 0, 16, ReadWriteMode, TIM4CCR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR3_CCR3_L_Values<TIM4::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -294,6 +313,7 @@ struct TIM4
   {
     using CCR4_H = TIM4_CCR4_CCR4_H_Values<TIM4::CCR4, 16, 16, ReadWriteMode, TIM4CCR4Base> ;
     using CCR4_L = TIM4_CCR4_CCR4_L_Values<TIM4::CCR4, 0, 16, ReadWriteMode, TIM4CCR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TIM4_CCR4_CCR4_L_Values<TIM4::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +326,7 @@ struct TIM4
   {
     using DBL = TIM4_DCR_DBL_Values<TIM4::DCR, 8, 5, ReadWriteMode, TIM4DCRBase> ;
     using DBA = TIM4_DCR_DBA_Values<TIM4::DCR, 0, 5, ReadWriteMode, TIM4DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM4_DCR_DBA_Values<TIM4::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -317,12 +338,14 @@ struct TIM4
   struct DMAR : public RegisterBase<0x4000084C, 32, ReadWriteMode>
   {
     using DMAB = TIM4_DMAR_DMAB_Values<TIM4::DMAR, 0, 16, ReadWriteMode, TIM4DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM4_DMAR_DMAB_Values<TIM4::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4000084C, 32, ReadWriteMode, TIM4DMARBase, T...> ;
 
+  using Registers = TypesList<TIM4::CR1, TIM4::CR2, TIM4::SMCR, TIM4::DIER, TIM4::SR, TIM4::EGR, TIM4::CCMR1_Output, TIM4::CCMR1_Input, TIM4::CCMR2_Output, TIM4::CCMR2_Input, TIM4::CCER, TIM4::CNT, TIM4::PSC, TIM4::ARR, TIM4::CCR1, TIM4::CCR2, TIM4::CCR3, TIM4::CCR4, TIM4::DCR, TIM4::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM4REGISTERS_HPP)
@@ -26,6 +26,8 @@ struct TIM6
     using URS = TIM6_CR1_URS_Values<TIM6::CR1, 2, 1, ReadWriteMode, TIM6CR1Base> ;
     using UDIS = TIM6_CR1_UDIS_Values<TIM6::CR1, 1, 1, ReadWriteMode, TIM6CR1Base> ;
     using CEN = TIM6_CR1_CEN_Values<TIM6::CR1, 0, 1, ReadWriteMode, TIM6CR1Base> ;
+    static constexpr Type SnapshotMask = 0x8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM6_CR1_CEN_Values<TIM6::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -37,6 +39,7 @@ struct TIM6
   struct CR2 : public RegisterBase<0x40001004, 32, ReadWriteMode>
   {
     using MMS = TIM6_CR2_MMS_Values<TIM6::CR2, 4, 3, ReadWriteMode, TIM6CR2Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIM6_CR2_MMS_Values<TIM6::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -49,6 +52,7 @@ struct TIM6
   {
     using UDE = TIM6_DIER_UDE_Values<TIM6::DIER, 8, 1, ReadWriteMode, TIM6DIERBase> ;
     using UIE = TIM6_DIER_UIE_Values<TIM6::DIER, 0, 1, ReadWriteMode, TIM6DIERBase> ;
+    static constexpr Type SnapshotMask = 0x101U ;
     using FieldValues = TIM6_DIER_UIE_Values<TIM6::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +64,9 @@ struct TIM6
   struct SR : public RegisterBase<0x40001010, 32, ReadWriteMode>
   {
     using UIF = TIM6_SR_UIF_Values<TIM6::SR, 0, 1, ReadWriteMode, TIM6SRBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM6_SR_UIF_Values<TIM6::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +89,7 @@ struct TIM6
   struct CNT : public RegisterBase<0x40001024, 32, ReadWriteMode>
   {
     using CNTField = TIM6_CNT_CNT_Values<TIM6::CNT, 0, 16, ReadWriteMode, TIM6CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM6_CNT_CNT_Values<TIM6::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +101,7 @@ struct TIM6
   struct PSC : public RegisterBase<0x40001028, 32, ReadWriteMode>
   {
     using PSCField = TIM6_PSC_PSC_Values<TIM6::PSC, 0, 16, ReadWriteMode, TIM6PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM6_PSC_PSC_Values<TIM6::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,12 +113,14 @@ struct TIM6
   struct ARR : public RegisterBase<0x4000102C, 32, ReadWriteMode>
   {
     using ARRField = TIM6_ARR_ARR_Values<TIM6::ARR, 0, 16, ReadWriteMode, TIM6ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM6_ARR_ARR_Values<TIM6::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ARRPack  = Register<0x4000102C, 32, ReadWriteMode, TIM6ARRBase, T...> ;
 
+  using Registers = TypesList<TIM6::CR1, TIM6::CR2, TIM6::DIER, TIM6::SR, TIM6::EGR, TIM6::CNT, TIM6::PSC, TIM6::ARR> ;
 } ;
 
 #endif //#if !defined(TIM6REGISTERS_HPP)
@@ -27,6 +27,8 @@ struct TIM9
     using URS = TIM9_CR1_URS_Values<TIM9::CR1, 2, 1, ReadWriteMode, TIM9CR1Base> ;
     using UDIS = TIM9_CR1_UDIS_Values<TIM9::CR1, 1, 1, ReadWriteMode, TIM9CR1Base> ;
     using CEN = TIM9_CR1_CEN_Values<TIM9::CR1, 0, 1, ReadWriteMode, TIM9CR1Base> ;
+    static constexpr Type SnapshotMask = 0x38EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM9_CR1_CEN_Values<TIM9::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +40,7 @@ struct TIM9
   struct CR2 : public RegisterBase<0x40014004, 32, ReadWriteMode>
   {
     using MMS = TIM9_CR2_MMS_Values<TIM9::CR2, 4, 3, ReadWriteMode, TIM9CR2Base> ;
+    static constexpr Type SnapshotMask = 0x70U ;
     using FieldValues = TIM9_CR2_MMS_Values<TIM9::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +54,7 @@ struct TIM9
     using MSM = TIM9_SMCR_MSM_Values<TIM9::SMCR, 7, 1, ReadWriteMode, TIM9SMCRBase> ;
     using TS = TIM9_SMCR_TS_Values<TIM9::SMCR, 4, 3, ReadWriteMode, TIM9SMCRBase> ;
     using SMS = TIM9_SMCR_SMS_Values<TIM9::SMCR, 0, 3, ReadWriteMode, TIM9SMCRBase> ;
+    static constexpr Type SnapshotMask = 0xF7U ;
     using FieldValues = TIM9_SMCR_SMS_Values<TIM9::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +69,7 @@ struct TIM9
     using CC2IE = TIM9_DIER_CC2IE_Values<TIM9::DIER, 2, 1, ReadWriteMode, TIM9DIERBase> ;
     using CC1IE = TIM9_DIER_CC1IE_Values<TIM9::DIER, 1, 1, ReadWriteMode, TIM9DIERBase> ;
     using UIE = TIM9_DIER_UIE_Values<TIM9::DIER, 0, 1, ReadWriteMode, TIM9DIERBase> ;
+    static constexpr Type SnapshotMask = 0x47U ;
     using FieldValues = TIM9_DIER_UIE_Values<TIM9::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +86,9 @@ struct TIM9
     using CC2IF = TIM9_SR_CC2IF_Values<TIM9::SR, 2, 1, ReadWriteMode, TIM9SRBase> ;
     using CC1IF = TIM9_SR_CC1IF_Values<TIM9::SR, 1, 1, ReadWriteMode, TIM9SRBase> ;
     using UIF = TIM9_SR_UIF_Values<TIM9::SR, 0, 1, ReadWriteMode, TIM9SRBase> ;
+    static constexpr Type WritableMask = 0x647U ;
+    static constexpr Type ZeroToClearMask = 0x647U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM9_SR_UIF_Values<TIM9::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +121,7 @@ struct TIM9
     using OC1PE = TIM9_CCMR1_Output_OC1PE_Values<TIM9::CCMR1_Output, 3, 1, ReadWriteMode, TIM9CCMR1_OutputBase> ;
     using OC1FE = TIM9_CCMR1_Output_OC1FE_Values<TIM9::CCMR1_Output, 2, 1, ReadWriteMode, TIM9CCMR1_OutputBase> ;
     using CC1S = TIM9_CCMR1_Output_CC1S_Values<TIM9::CCMR1_Output, 0, 2, ReadWriteMode, TIM9CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x7F7FU ;
     using FieldValues = TIM9_CCMR1_Output_CC1S_Values<TIM9::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -129,6 +138,7 @@ struct TIM9
     using IC1F = TIM9_CCMR1_Input_IC1F_Values<TIM9::CCMR1_Input, 4, 3, ReadWriteMode, TIM9CCMR1_InputBase> ;
     using ICPCS = TIM9_CCMR1_Input_ICPCS_Values<TIM9::CCMR1_Input, 2, 2, ReadWriteMode, TIM9CCMR1_InputBase> ;
     using CC1S = TIM9_CCMR1_Input_CC1S_Values<TIM9::CCMR1_Input, 0, 2, ReadWriteMode, TIM9CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0x7F7FU ;
     using FieldValues = TIM9_CCMR1_Input_CC1S_Values<TIM9::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +155,7 @@ struct TIM9
     using CC1NP = TIM9_CCER_CC1NP_Values<TIM9::CCER, 3, 1, ReadWriteMode, TIM9CCERBase> ;
     using CC1P = TIM9_CCER_CC1P_Values<TIM9::CCER, 1, 1, ReadWriteMode, TIM9CCERBase> ;
     using CC1E = TIM9_CCER_CC1E_Values<TIM9::CCER, 0, 1, ReadWriteMode, TIM9CCERBase> ;
+    static constexpr Type SnapshotMask = 0xBBU ;
     using FieldValues = TIM9_CCER_CC1E_Values<TIM9::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -156,6 +167,7 @@ struct TIM9
   struct CNT : public RegisterBase<0x40014024, 32, ReadWriteMode>
   {
     using CNTField = TIM9_CNT_CNT_Values<TIM9::CNT, 0, 16, ReadWriteMode, TIM9CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM9_CNT_CNT_Values<TIM9::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +179,7 @@ struct TIM9
   struct PSC : public RegisterBase<0x40014028, 32, ReadWriteMode>
   {
     using PSCField = TIM9_PSC_PSC_Values<TIM9::PSC, 0, 16, ReadWriteMode, TIM9PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM9_PSC_PSC_Values<TIM9::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -178,6 +191,7 @@ struct TIM9
   struct ARR : public RegisterBase<0x4001402C, 32, ReadWriteMode>
   {
     using ARRField = TIM9_ARR_ARR_Values<TIM9::ARR, 0, 16, ReadWriteMode, TIM9ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM9_ARR_ARR_Values<TIM9::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +203,7 @@ struct TIM9
   struct CCR1 : public RegisterBase<0x40014034, 32, ReadWriteMode>
   {
     using CCR1Field = TIM9_CCR1_CCR1_Values<TIM9::CCR1, 0, 16, ReadWriteMode, TIM9CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM9_CCR1_CCR1_Values<TIM9::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -200,12 +215,14 @@ struct TIM9
   struct CCR2 : public RegisterBase<0x40014038, 32, ReadWriteMode>
   {
     using CCR2Field = TIM9_CCR2_CCR2_Values<TIM9::CCR2, 0, 16, ReadWriteMode, TIM9CCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM9_CCR2_CCR2_Values<TIM9::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCR2Pack  = Register<0x40014038, 32, ReadWriteMode, TIM9CCR2Base, T...> ;
 
+  using Registers = TypesList<TIM9::CR1, TIM9::CR2, TIM9::SMCR, TIM9::DIER, TIM9::SR, TIM9::EGR, TIM9::CCMR1_Output, TIM9::CCMR1_Input, TIM9::CCER, TIM9::CNT, TIM9::PSC, TIM9::ARR, TIM9::CCR1, TIM9::CCR2> ;
 } ;
 
 #endif //#if !defined(TIM9REGISTERS_HPP)
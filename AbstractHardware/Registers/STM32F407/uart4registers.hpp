@@ -30,6 +30,9 @@ struct UART4
     using NF = UART4_SR_NF_Values<UART4::SR, 2, 1, ReadMode, UART4SRBase> ;
     using FE = UART4_SR_FE_Values<UART4::SR, 1, 1, ReadMode, UART4SRBase> ;
     using PE = UART4_SR_PE_Values<UART4::SR, 0, 1, ReadMode, UART4SRBase> ;
+    static constexpr Type WritableMask = 0x160U ;
+    static constexpr Type ZeroToClearMask = 0x160U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART4_SR_PE_Values<UART4::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +44,7 @@ struct UART4
   struct DR : public RegisterBase<0x40004C04, 32, ReadWriteMode>
   {
     using DRField = UART4_DR_DR_Values<UART4::DR, 0, 9, ReadWriteMode, UART4DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART4_DR_DR_Values<UART4::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +57,7 @@ struct UART4
   {
     using DIV_Mantissa = UART4_BRR_DIV_Mantissa_Values<UART4::BRR, 4, 12, ReadWriteMode, UART4BRRBase> ;
     using DIV_Fraction = UART4_BRR_DIV_Fraction_Values<UART4::BRR, 0, 4, ReadWriteMode, UART4BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART4_BRR_DIV_Fraction_Values<UART4::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct UART4
     using RE = UART4_CR1_RE_Values<UART4::CR1, 2, 1, ReadWriteMode, UART4CR1Base> ;
     using RWU = UART4_CR1_RWU_Values<UART4::CR1, 1, 1, ReadWriteMode, UART4CR1Base> ;
     using SBK = UART4_CR1_SBK_Values<UART4::CR1, 0, 1, ReadWriteMode, UART4CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = UART4_CR1_SBK_Values<UART4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct UART4
     using LBDIE = UART4_CR2_LBDIE_Values<UART4::CR2, 6, 1, ReadWriteMode, UART4CR2Base> ;
     using LBDL = UART4_CR2_LBDL_Values<UART4::CR2, 5, 1, ReadWriteMode, UART4CR2Base> ;
     using ADD = UART4_CR2_ADD_Values<UART4::CR2, 0, 4, ReadWriteMode, UART4CR2Base> ;
+    static constexpr Type SnapshotMask = 0x706FU ;
     using FieldValues = UART4_CR2_ADD_Values<UART4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,12 +118,14 @@ struct UART4
     using IRLP = UART4_CR3_IRLP_Values<UART4::CR3, 2, 1, ReadWriteMode, UART4CR3Base> ;
     using IREN = UART4_CR3_IREN_Values<UART4::CR3, 1, 1, ReadWriteMode, UART4CR3Base> ;
     using EIE = UART4_CR3_EIE_Values<UART4::CR3, 0, 1, ReadWriteMode, UART4CR3Base> ;
+    static constexpr Type SnapshotMask = 0x8CFU ;
     using FieldValues = UART4_CR3_EIE_Values<UART4::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CR3Pack  = Register<0x40004C14, 32, ReadWriteMode, UART4CR3Base, T...> ;
 
+  using Registers = TypesList<UART4::SR, UART4::DR, UART4::BRR, UART4::CR1, UART4::CR2, UART4::CR3> ;
 } ;
 
 #endif //#if !defined(UART4REGISTERS_HPP)
@@ -30,6 +30,9 @@ struct UART5
     using NF = UART5_SR_NF_Values<UART5::SR, 2, 1, ReadMode, UART5SRBase> ;
     using FE = UART5_SR_FE_Values<UART5::SR, 1, 1, ReadMode, UART5SRBase> ;
     using PE = UART5_SR_PE_Values<UART5::SR, 0, 1, ReadMode, UART5SRBase> ;
+    static constexpr Type WritableMask = 0x160U ;
+    static constexpr Type ZeroToClearMask = 0x160U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART5_SR_PE_Values<UART5::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +44,7 @@ struct UART5
   struct DR : public RegisterBase<0x40005004, 32, ReadWriteMode>
   {
     using DRField = UART5_DR_DR_Values<UART5::DR, 0, 9, ReadWriteMode, UART5DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART5_DR_DR_Values<UART5::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +57,7 @@ struct UART5
   {
     using DIV_Mantissa = UART5_BRR_DIV_Mantissa_Values<UART5::BRR, 4, 12, ReadWriteMode, UART5BRRBase> ;
     using DIV_Fraction = UART5_BRR_DIV_Fraction_Values<UART5::BRR, 0, 4, ReadWriteMode, UART5BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART5_BRR_DIV_Fraction_Values<UART5::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct UART5
     using RE = UART5_CR1_RE_Values<UART5::CR1, 2, 1, ReadWriteMode, UART5CR1Base> ;
     using RWU = UART5_CR1_RWU_Values<UART5::CR1, 1, 1, ReadWriteMode, UART5CR1Base> ;
     using SBK = UART5_CR1_SBK_Values<UART5::CR1, 0, 1, ReadWriteMode, UART5CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = UART5_CR1_SBK_Values<UART5::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct UART5
     using LBDIE = UART5_CR2_LBDIE_Values<UART5::CR2, 6, 1, ReadWriteMode, UART5CR2Base> ;
     using LBDL = UART5_CR2_LBDL_Values<UART5::CR2, 5, 1, ReadWriteMode, UART5CR2Base> ;
     using ADD = UART5_CR2_ADD_Values<UART5::CR2, 0, 4, ReadWriteMode, UART5CR2Base> ;
+    static constexpr Type SnapshotMask = 0x706FU ;
     using FieldValues = UART5_CR2_ADD_Values<UART5::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,12 +118,14 @@ struct UART5
     using IRLP = UART5_CR3_IRLP_Values<UART5::CR3, 2, 1, ReadWriteMode, UART5CR3Base> ;
     using IREN = UART5_CR3_IREN_Values<UART5::CR3, 1, 1, ReadWriteMode, UART5CR3Base> ;
     using EIE = UART5_CR3_EIE_Values<UART5::CR3, 0, 1, ReadWriteMode, UART5CR3Base> ;
+    static constexpr Type SnapshotMask = 0x8CFU ;
     using FieldValues = UART5_CR3_EIE_Values<UART5::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CR3Pack  = Register<0x40005014, 32, ReadWriteMode, UART5CR3Base, T...> ;
 
+  using Registers = TypesList<UART5::SR, UART5::DR, UART5::BRR, UART5::CR1, UART5::CR2, UART5::CR3> ;
 } ;
 
 #endif //#if !defined(UART5REGISTERS_HPP)
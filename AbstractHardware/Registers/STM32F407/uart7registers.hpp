@@ -30,6 +30,9 @@ struct UART7
     using NF = UART7_SR_NF_Values<UART7::SR, 2, 1, ReadMode, UART7SRBase> ;
     using FE = UART7_SR_FE_Values<UART7::SR, 1, 1, ReadMode, UART7SRBase> ;
     using PE = UART7_SR_PE_Values<UART7::SR, 0, 1, ReadMode, UART7SRBase> ;
+    static constexpr Type WritableMask = 0x160U ;
+    static constexpr Type ZeroToClearMask = 0x160U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART7_SR_PE_Values<UART7::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +44,7 @@ struct UART7
   struct DR : public RegisterBase<0x40007804, 32, ReadWriteMode>
   {
     using DRField = UART7_DR_DR_Values<UART7::DR, 0, 9, ReadWriteMode, UART7DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART7_DR_DR_Values<UART7::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +57,7 @@ struct UART7
   {
     using DIV_Mantissa = UART7_BRR_DIV_Mantissa_Values<UART7::BRR, 4, 12, ReadWriteMode, UART7BRRBase> ;
     using DIV_Fraction = UART7_BRR_DIV_Fraction_Values<UART7::BRR, 0, 4, ReadWriteMode, UART7BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART7_BRR_DIV_Fraction_Values<UART7::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct UART7
     using RE = UART7_CR1_RE_Values<UART7::CR1, 2, 1, ReadWriteMode, UART7CR1Base> ;
     using RWU = UART7_CR1_RWU_Values<UART7::CR1, 1, 1, ReadWriteMode, UART7CR1Base> ;
     using SBK = UART7_CR1_SBK_Values<UART7::CR1, 0, 1, ReadWriteMode, UART7CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = UART7_CR1_SBK_Values<UART7::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct UART7
     using LBDIE = UART7_CR2_LBDIE_Values<UART7::CR2, 6, 1, ReadWriteMode, UART7CR2Base> ;
     using LBDL = UART7_CR2_LBDL_Values<UART7::CR2, 5, 1, ReadWriteMode, UART7CR2Base> ;
     using ADD = UART7_CR2_ADD_Values<UART7::CR2, 0, 4, ReadWriteMode, UART7CR2Base> ;
+    static constexpr Type SnapshotMask = 0x706FU ;
     using FieldValues = UART7_CR2_ADD_Values<UART7::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,12 +118,14 @@ struct UART7
     using IRLP = UART7_CR3_IRLP_Values<UART7::CR3, 2, 1, ReadWriteMode, UART7CR3Base> ;
     using IREN = UART7_CR3_IREN_Values<UART7::CR3, 1, 1, ReadWriteMode, UART7CR3Base> ;
     using EIE = UART7_CR3_EIE_Values<UART7::CR3, 0, 1, ReadWriteMode, UART7CR3Base> ;
+    static constexpr Type SnapshotMask = 0x8CFU ;
     using FieldValues = UART7_CR3_EIE_Values<UART7::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CR3Pack  = Register<0x40007814, 32, ReadWriteMode, UART7CR3Base, T...> ;
 
+  using Registers = TypesList<UART7::SR, UART7::DR, UART7::BRR, UART7::CR1, UART7::CR2, UART7::CR3> ;
 } ;
 
 #endif //#if !defined(UART7REGISTERS_HPP)
@@ -30,6 +30,9 @@ struct UART8
     using NF = UART8_SR_NF_Values<UART8::SR, 2, 1, ReadMode, UART8SRBase> ;
     using FE = UART8_SR_FE_Values<UART8::SR, 1, 1, ReadMode, UART8SRBase> ;
     using PE = UART8_SR_PE_Values<UART8::SR, 0, 1, ReadMode, UART8SRBase> ;
+    static constexpr Type WritableMask = 0x160U ;
+    static constexpr Type ZeroToClearMask = 0x160U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART8_SR_PE_Values<UART8::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +44,7 @@ struct UART8
   struct DR : public RegisterBase<0x40007C04, 32, ReadWriteMode>
   {
     using DRField = UART8_DR_DR_Values<UART8::DR, 0, 9, ReadWriteMode, UART8DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART8_DR_DR_Values<UART8::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +57,7 @@ struct UART8
   {
     using DIV_Mantissa = UART8_BRR_DIV_Mantissa_Values<UART8::BRR, 4, 12, ReadWriteMode, UART8BRRBase> ;
     using DIV_Fraction = UART8_BRR_DIV_Fraction_Values<UART8::BRR, 0, 4, ReadWriteMode, UART8BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART8_BRR_DIV_Fraction_Values<UART8::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +83,8 @@ struct UART8
     using RE = UART8_CR1_RE_Values<UART8::CR1, 2, 1, ReadWriteMode, UART8CR1Base> ;
     using RWU = UART8_CR1_RWU_Values<UART8::CR1, 1, 1, ReadWriteMode, UART8CR1Base> ;
     using SBK = UART8_CR1_SBK_Values<UART8::CR1, 0, 1, ReadWriteMode, UART8CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = UART8_CR1_SBK_Values<UART8::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +100,7 @@ struct UART8
     using LBDIE = UART8_CR2_LBDIE_Values<UART8::CR2, 6, 1, ReadWriteMode, UART8CR2Base> ;
     using LBDL = UART8_CR2_LBDL_Values<UART8::CR2, 5, 1, ReadWriteMode, UART8CR2Base> ;
     using ADD = UART8_CR2_ADD_Values<UART8::CR2, 0, 4, ReadWriteMode, UART8CR2Base> ;
+    static constexpr Type SnapshotMask = 0x706FU ;
     using FieldValues = UART8_CR2_ADD_Values<UART8::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,12 +118,14 @@ struct UART8
     using IRLP = UART8_CR3_IRLP_Values<UART8::CR3, 2, 1, ReadWriteMode, UART8CR3Base> ;
     using IREN = UART8_CR3_IREN_Values<UART8::CR3, 1, 1, ReadWriteMode, UART8CR3Base> ;
     using EIE = UART8_CR3_EIE_Values<UART8::CR3, 0, 1, ReadWriteMode, UART8CR3Base> ;
+    static constexpr Type SnapshotMask = 0x8CFU ;
     using FieldValues = UART8_CR3_EIE_Values<UART8::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CR3Pack  = Register<0x40007C14, 32, ReadWriteMode, UART8CR3Base, T...> ;
 
+  using Registers = TypesList<UART8::SR, UART8::DR, UART8::BRR, UART8::CR1, UART8::CR2, UART8::CR3> ;
 } ;
 
 #endif //#if !defined(UART8REGISTERS_HPP)
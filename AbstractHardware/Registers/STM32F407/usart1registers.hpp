@@ -31,6 +31,9 @@ struct USART1
     using NF = USART1_SR_NF_Values<USART1::SR, 2, 1, ReadMode, USART1SRBase> ;
     using FE = USART1_SR_FE_Values<USART1::SR, 1, 1, ReadMode, USART1SRBase> ;
     using PE = USART1_SR_PE_Values<USART1::SR, 0, 1, ReadMode, USART1SRBase> ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART1_SR_PE_Values<USART1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +45,7 @@ struct USART1
   struct DR : public RegisterBase<0x40011004, 32, ReadWriteMode>
   {
     using DRField = USART1_DR_DR_Values<USART1::DR, 0, 9, ReadWriteMode, USART1DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART1_DR_DR_Values<USART1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +58,7 @@ struct USART1
   {
     using DIV_Mantissa = USART1_BRR_DIV_Mantissa_Values<USART1::BRR, 4, 12, ReadWriteMode, USART1BRRBase> ;
     using DIV_Fraction = USART1_BRR_DIV_Fraction_Values<USART1::BRR, 0, 4, ReadWriteMode, USART1BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART1_BRR_DIV_Fraction_Values<USART1::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +84,8 @@ struct USART1
     using RE = USART1_CR1_RE_Values<USART1::CR1, 2, 1, ReadWriteMode, USART1CR1Base> ;
     using RWU = USART1_CR1_RWU_Values<USART1::CR1, 1, 1, ReadWriteMode, USART1CR1Base> ;
     using SBK = USART1_CR1_SBK_Values<USART1::CR1, 0, 1, ReadWriteMode, USART1CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = USART1_CR1_SBK_Values<USART1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +105,7 @@ struct USART1
     using LBDIE = USART1_CR2_LBDIE_Values<USART1::CR2, 6, 1, ReadWriteMode, USART1CR2Base> ;
     using LBDL = USART1_CR2_LBDL_Values<USART1::CR2, 5, 1, ReadWriteMode, USART1CR2Base> ;
     using ADD = USART1_CR2_ADD_Values<USART1::CR2, 0, 4, ReadWriteMode, USART1CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7F6FU ;
     using FieldValues = USART1_CR2_ADD_Values<USART1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +128,7 @@ struct USART1
     using IRLP = USART1_CR3_IRLP_Values<USART1::CR3, 2, 1, ReadWriteMode, USART1CR3Base> ;
     using IREN = USART1_CR3_IREN_Values<USART1::CR3, 1, 1, ReadWriteMode, USART1CR3Base> ;
     using EIE = USART1_CR3_EIE_Values<USART1::CR3, 0, 1, ReadWriteMode, USART1CR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = USART1_CR3_EIE_Values<USART1::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,12 +141,14 @@ struct USART1
   {
     using GT = USART1_GTPR_GT_Values<USART1::GTPR, 8, 8, ReadWriteMode, USART1GTPRBase> ;
     using PSC = USART1_GTPR_PSC_Values<USART1::GTPR, 0, 8, ReadWriteMode, USART1GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART1_GTPR_PSC_Values<USART1::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GTPRPack  = Register<0x40011018, 32, ReadWriteMode, USART1GTPRBase, T...> ;
 
+  using Registers = TypesList<USART1::SR, USART1::DR, USART1::BRR, USART1::CR1, USART1::CR2, USART1::CR3, USART1::GTPR> ;
 } ;
 
 #endif //#if !defined(USART1REGISTERS_HPP)
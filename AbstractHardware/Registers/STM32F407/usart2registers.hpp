@@ -31,6 +31,9 @@ struct USART2
     using NF = USART2_SR_NF_Values<USART2::SR, 2, 1, ReadMode, USART2SRBase> ;
     using FE = USART2_SR_FE_Values<USART2::SR, 1, 1, ReadMode, USART2SRBase> ;
     using PE = USART2_SR_PE_Values<USART2::SR, 0, 1, ReadMode, USART2SRBase> ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART2_SR_PE_Values<USART2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +45,7 @@ struct USART2
   struct DR : public RegisterBase<0x40004404, 32, ReadWriteMode>
   {
     using DRField = USART2_DR_DR_Values<USART2::DR, 0, 9, ReadWriteMode, USART2DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART2_DR_DR_Values<USART2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +58,7 @@ struct USART2
   {
     using DIV_Mantissa = USART2_BRR_DIV_Mantissa_Values<USART2::BRR, 4, 12, ReadWriteMode, USART2BRRBase> ;
     using DIV_Fraction = USART2_BRR_DIV_Fraction_Values<USART2::BRR, 0, 4, ReadWriteMode, USART2BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART2_BRR_DIV_Fraction_Values<USART2::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +84,8 @@ struct USART2
     using RE = USART2_CR1_RE_Values<USART2::CR1, 2, 1, ReadWriteMode, USART2CR1Base> ;
     using RWU = USART2_CR1_RWU_Values<USART2::CR1, 1, 1, ReadWriteMode, USART2CR1Base> ;
     using SBK = USART2_CR1_SBK_Values<USART2::CR1, 0, 1, ReadWriteMode, USART2CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = USART2_CR1_SBK_Values<USART2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +105,7 @@ struct USART2
     using LBDIE = USART2_CR2_LBDIE_Values<USART2::CR2, 6, 1, ReadWriteMode, USART2CR2Base> ;
     using LBDL = USART2_CR2_LBDL_Values<USART2::CR2, 5, 1, ReadWriteMode, USART2CR2Base> ;
     using ADD = USART2_CR2_ADD_Values<USART2::CR2, 0, 4, ReadWriteMode, USART2CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7F6FU ;
     using FieldValues = USART2_CR2_ADD_Values<USART2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +128,7 @@ struct USART2
     using IRLP = USART2_CR3_IRLP_Values<USART2::CR3, 2, 1, ReadWriteMode, USART2CR3Base> ;
     using IREN = USART2_CR3_IREN_Values<USART2::CR3, 1, 1, ReadWriteMode, USART2CR3Base> ;
     using EIE = USART2_CR3_EIE_Values<USART2::CR3, 0, 1, ReadWriteMode, USART2CR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = USART2_CR3_EIE_Values<USART2::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,12 +141,14 @@ struct USART2
   {
     using GT = USART2_GTPR_GT_Values<USART2::GTPR, 8, 8, ReadWriteMode, USART2GTPRBase> ;
     using PSC = USART2_GTPR_PSC_Values<USART2::GTPR, 0, 8, ReadWriteMode, USART2GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART2_GTPR_PSC_Values<USART2::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GTPRPack  = Register<0x40004418, 32, ReadWriteMode, USART2GTPRBase, T...> ;
 
+  using Registers = TypesList<USART2::SR, USART2::DR, USART2::BRR, USART2::CR1, USART2::CR2, USART2::CR3, USART2::GTPR> ;
 } ;
 
 #endif //#if !defined(USART2REGISTERS_HPP)
@@ -31,6 +31,9 @@ struct USART3
     using NF = USART3_SR_NF_Values<USART3::SR, 2, 1, ReadMode, USART3SRBase> ;
     using FE = USART3_SR_FE_Values<USART3::SR, 1, 1, ReadMode, USART3SRBase> ;
     using PE = USART3_SR_PE_Values<USART3::SR, 0, 1, ReadMode, USART3SRBase> ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART3_SR_PE_Values<USART3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +45,7 @@ struct USART3
   struct DR : public RegisterBase<0x40004804, 32, ReadWriteMode>
   {
     using DRField = USART3_DR_DR_Values<USART3::DR, 0, 9, ReadWriteMode, USART3DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART3_DR_DR_Values<USART3::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +58,7 @@ struct USART3
   {
     using DIV_Mantissa = USART3_BRR_DIV_Mantissa_Values<USART3::BRR, 4, 12, ReadWriteMode, USART3BRRBase> ;
     using DIV_Fraction = USART3_BRR_DIV_Fraction_Values<USART3::BRR, 0, 4, ReadWriteMode, USART3BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART3_BRR_DIV_Fraction_Values<USART3::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +84,8 @@ struct USART3
     using RE = USART3_CR1_RE_Values<USART3::CR1, 2, 1, ReadWriteMode, USART3CR1Base> ;
     using RWU = USART3_CR1_RWU_Values<USART3::CR1, 1, 1, ReadWriteMode, USART3CR1Base> ;
     using SBK = USART3_CR1_SBK_Values<USART3::CR1, 0, 1, ReadWriteMode, USART3CR1Base> ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
     using FieldValues = USART3_CR1_SBK_Values<USART3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +105,7 @@ struct USART3
     using LBDIE = USART3_CR2_LBDIE_Values<USART3::CR2, 6, 1, ReadWriteMode, USART3CR2Base> ;
     using LBDL = USART3_CR2_LBDL_Values<USART3::CR2, 5, 1, ReadWriteMode, USART3CR2Base> ;
     using ADD = USART3_CR2_ADD_Values<USART3::CR2, 0, 4, ReadWriteMode, USART3CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7F6FU ;
     using FieldValues = USART3_CR2_ADD_Values<USART3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +128,7 @@ struct USART3
     using IRLP = USART3_CR3_IRLP_Values<USART3::CR3, 2, 1, ReadWriteMode, USART3CR3Base> ;
     using IREN = USART3_CR3_IREN_Values<USART3::CR3, 1, 1, ReadWriteMode, USART3CR3Base> ;
     using EIE = USART3_CR3_EIE_Values<USART3::CR3, 0, 1, ReadWriteMode, USART3CR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = USART3_CR3_EIE_Values<USART3::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,12 +141,14 @@ struct USART3
   {
     using GT = USART3_GTPR_GT_Values<USART3::GTPR, 8, 8, ReadWriteMode, USART3GTPRBase> ;
     using PSC = USART3_GTPR_PSC_Values<USART3::GTPR, 0, 8, ReadWriteMode, USART3GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART3_GTPR_PSC_Values<USART3::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GTPRPack  = Register<0x40004818, 32, ReadWriteMode, USART3GTPRBase, T...> ;
 
+  using Registers = TypesList<USART3::SR, USART3::DR, USART3::BRR, USART3::CR1, USART3::CR2, USART3::CR3, USART3::GTPR> ;
 } ;
 
 #endif //#if !defined(USART3REGISTERS_HPP)
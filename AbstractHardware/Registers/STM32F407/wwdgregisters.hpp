@@ -23,6 +23,7 @@ struct WWDG
   {
     using WDGA = WWDG_CR_WDGA_Values<WWDG::CR, 7, 1, ReadWriteMode, WWDGCRBase> ;
     using T = WWDG_CR_T_Values<WWDG::CR, 0, 7, ReadWriteMode, WWDGCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = WWDG_CR_T_Values<WWDG::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -37,6 +38,7 @@ struct WWDG
     using WDGTB1 = WWDG_CFR_WDGTB1_Values<WWDG::CFR, 8, 1, ReadWriteMode, WWDGCFRBase> ;
     using WDGTB0 = WWDG_CFR_WDGTB0_Values<WWDG::CFR, 7, 1, ReadWriteMode, WWDGCFRBase> ;
     using W = WWDG_CFR_W_Values<WWDG::CFR, 0, 7, ReadWriteMode, WWDGCFRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = WWDG_CFR_W_Values<WWDG::CFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,12 +50,16 @@ struct WWDG
   struct SR : public RegisterBase<0x40002C08, 32, ReadWriteMode>
   {
     using EWIF = WWDG_SR_EWIF_Values<WWDG::SR, 0, 1, ReadWriteMode, WWDGSRBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = WWDG_SR_EWIF_Values<WWDG::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SRPack  = Register<0x40002C08, 32, ReadWriteMode, WWDGSRBase, T...> ;
 
+  using Registers = TypesList<WWDG::CR, WWDG::CFR, WWDG::SR> ;
 } ;
 
 #endif //#if !defined(WWDGREGISTERS_HPP)
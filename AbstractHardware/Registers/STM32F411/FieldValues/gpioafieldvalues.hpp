@@ -71,7 +71,7 @@ template <typename Reg, size_t offset, size_t size, typename AccessMode, typenam
 struct GPIOA_MODER_MODER5_Values: public GPIOA_MODER_MODER15_Values<Reg, offset,size, AccessMode,BaseType>
 {
 		template<typename Reg::Type val,
-		        typename  = typename std::enable_if_t<(size >= sizeof(Reg::Type) * 8U) || (val < (1U << size))>>
+		        typename  = typename std::enable_if_t<(size >= sizeof(typename Reg::Type) * 8U) || (val < (1U << size))>>
 		using Value = FieldValue<GPIOA_MODER_MODER5_Values, BaseType, val>;
 } ;
 
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct ADC1
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40012000U ;
+
   struct ADC1SRBase {} ;
 
   struct SR : public RegisterBase<0x40012000, 32, ReadWriteMode>
@@ -27,6 +32,12 @@ struct ADC1
     using JEOC = ADC1_SR_JEOC_Values<ADC1::SR, 2, 1, ReadWriteMode, ADC1SRBase> ;
     using EOC = ADC1_SR_EOC_Values<ADC1::SR, 1, 1, ReadWriteMode, ADC1SRBase> ;
     using AWD = ADC1_SR_AWD_Values<ADC1::SR, 0, 1, ReadWriteMode, ADC1SRBase> ;
+    static constexpr Type VolatileMask = 0x3FU ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ZeroToClearMask = 0x3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_SR_AWD_Values<ADC1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +62,9 @@ struct ADC1
     using AWDIE = ADC1_CR1_AWDIE_Values<ADC1::CR1, 6, 1, ReadWriteMode, ADC1CR1Base> ;
     using EOCIE = ADC1_CR1_EOCIE_Values<ADC1::CR1, 5, 1, ReadWriteMode, ADC1CR1Base> ;
     using AWDCH = ADC1_CR1_AWDCH_Values<ADC1::CR1, 0, 5, ReadWriteMode, ADC1CR1Base> ;
+    static constexpr Type WritableMask = 0x7C0FFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_CR1_AWDCH_Values<ADC1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +87,12 @@ struct ADC1
     using DMA = ADC1_CR2_DMA_Values<ADC1::CR2, 8, 1, ReadWriteMode, ADC1CR2Base> ;
     using CONT = ADC1_CR2_CONT_Values<ADC1::CR2, 1, 1, ReadWriteMode, ADC1CR2Base> ;
     using ADON = ADC1_CR2_ADON_Values<ADC1::CR2, 0, 1, ReadWriteMode, ADC1CR2Base> ;
+    static constexpr Type VolatileMask = 0x40400000U ;
+    static constexpr Type WritableMask = 0x7F7F0F03U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x3F3F0F02U ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_CR2_ADON_Values<ADC1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +112,12 @@ struct ADC1
     using SMP12 = ADC1_SMPR1_SMPx_x_Values<ADC1::SMPR1, 6, 3, ReadWriteMode, ADC1SMPR1Base> ;
     using SMP11 = ADC1_SMPR1_SMPx_x_Values<ADC1::SMPR1, 3, 3, ReadWriteMode, ADC1SMPR1Base> ;
     using SMP10 = ADC1_SMPR1_SMPx_x_Values<ADC1::SMPR1, 0, 3, ReadWriteMode, ADC1SMPR1Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using SMPArray = FieldArray<10U, SMP10, SMP11, SMP12, SMP13, SMP14, SMP15, SMP16, SMP17, SMP18> ;
+    template<std::size_t index>
+    using Field = typename SMPArray::template Field<index> ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_SMPR1_SMPx_x_Values<ADC1::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +138,12 @@ struct ADC1
     using SMP2 = ADC1_SMPR2_SMPx_x_Values<ADC1::SMPR2, 6, 3, ReadWriteMode, ADC1SMPR1Base> ;
     using SMP1 = ADC1_SMPR2_SMPx_x_Values<ADC1::SMPR2, 3, 3, ReadWriteMode, ADC1SMPR1Base> ;
     using SMP0 = ADC1_SMPR2_SMPx_x_Values<ADC1::SMPR2, 0, 3, ReadWriteMode, ADC1SMPR1Base> ;
+    static constexpr Type WritableMask = 0x3FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using SMPArray = FieldArray<0U, SMP0, SMP1, SMP2, SMP3, SMP4, SMP5, SMP6, SMP7, SMP8, SMP9> ;
+    template<std::size_t index>
+    using Field = typename SMPArray::template Field<index> ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_SMPR2_SMPx_x_Values<ADC1::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -123,6 +155,9 @@ struct ADC1
   struct JOFR1 : public RegisterBase<0x40012014, 32, ReadWriteMode>
   {
     using JOFFSET1 = ADC1_JOFR1_JOFFSET1_Values<ADC1::JOFR1, 0, 12, ReadWriteMode, ADC1JOFR1Base> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JOFR1_JOFFSET1_Values<ADC1::JOFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +169,9 @@ struct ADC1
   struct JOFR2 : public RegisterBase<0x40012018, 32, ReadWriteMode>
   {
     using JOFFSET2 = ADC1_JOFR2_JOFFSET2_Values<ADC1::JOFR2, 0, 12, ReadWriteMode, ADC1JOFR2Base> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JOFR2_JOFFSET2_Values<ADC1::JOFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +183,9 @@ struct ADC1
   struct JOFR3 : public RegisterBase<0x4001201C, 32, ReadWriteMode>
   {
     using JOFFSET3 = ADC1_JOFR3_JOFFSET3_Values<ADC1::JOFR3, 0, 12, ReadWriteMode, ADC1JOFR3Base> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JOFR3_JOFFSET3_Values<ADC1::JOFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -156,6 +197,9 @@ struct ADC1
   struct JOFR4 : public RegisterBase<0x40012020, 32, ReadWriteMode>
   {
     using JOFFSET4 = ADC1_JOFR4_JOFFSET4_Values<ADC1::JOFR4, 0, 12, ReadWriteMode, ADC1JOFR4Base> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JOFR4_JOFFSET4_Values<ADC1::JOFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +211,9 @@ struct ADC1
   struct HTR : public RegisterBase<0x40012024, 32, ReadWriteMode>
   {
     using HT = ADC1_HTR_HT_Values<ADC1::HTR, 0, 12, ReadWriteMode, ADC1HTRBase> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0xFFFU ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_HTR_HT_Values<ADC1::HTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -178,6 +225,9 @@ struct ADC1
   struct LTR : public RegisterBase<0x40012028, 32, ReadWriteMode>
   {
     using LT = ADC1_LTR_LT_Values<ADC1::LTR, 0, 12, ReadWriteMode, ADC1LTRBase> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_LTR_LT_Values<ADC1::LTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -193,6 +243,12 @@ struct ADC1
     using SQ15 = ADC1_SQR1_SQ15_Values<ADC1::SQR1, 10, 5, ReadWriteMode, ADC1SQR1Base> ;
     using SQ14 = ADC1_SQR1_SQ14_Values<ADC1::SQR1, 5, 5, ReadWriteMode, ADC1SQR1Base> ;
     using SQ13 = ADC1_SQR1_SQ13_Values<ADC1::SQR1, 0, 5, ReadWriteMode, ADC1SQR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using SQArray = FieldArray<13U, SQ13, SQ14, SQ15, SQ16> ;
+    template<std::size_t index>
+    using Field = typename SQArray::template Field<index> ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_SQR1_SQ13_Values<ADC1::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +265,12 @@ struct ADC1
     using SQ9 = ADC1_SQR2_SQ9_Values<ADC1::SQR2, 10, 5, ReadWriteMode, ADC1SQR2Base> ;
     using SQ8 = ADC1_SQR2_SQ8_Values<ADC1::SQR2, 5, 5, ReadWriteMode, ADC1SQR2Base> ;
     using SQ7 = ADC1_SQR2_SQ7_Values<ADC1::SQR2, 0, 5, ReadWriteMode, ADC1SQR2Base> ;
+    static constexpr Type WritableMask = 0x3FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using SQArray = FieldArray<7U, SQ7, SQ8, SQ9, SQ10, SQ11, SQ12> ;
+    template<std::size_t index>
+    using Field = typename SQArray::template Field<index> ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_SQR2_SQ7_Values<ADC1::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -225,6 +287,12 @@ struct ADC1
     using SQ3 = ADC1_SQR3_SQ3_Values<ADC1::SQR3, 10, 5, ReadWriteMode, ADC1SQR3Base> ;
     using SQ2 = ADC1_SQR3_SQ2_Values<ADC1::SQR3, 5, 5, ReadWriteMode, ADC1SQR3Base> ;
     using SQ1 = ADC1_SQR3_SQ1_Values<ADC1::SQR3, 0, 5, ReadWriteMode, ADC1SQR3Base> ;
+    static constexpr Type WritableMask = 0x3FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using SQArray = FieldArray<1U, SQ1, SQ2, SQ3, SQ4, SQ5, SQ6> ;
+    template<std::size_t index>
+    using Field = typename SQArray::template Field<index> ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_SQR3_SQ1_Values<ADC1::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +308,12 @@ struct ADC1
     using JSQ3 = ADC1_JSQR_JSQ3_Values<ADC1::JSQR, 10, 5, ReadWriteMode, ADC1JSQRBase> ;
     using JSQ2 = ADC1_JSQR_JSQ2_Values<ADC1::JSQR, 5, 5, ReadWriteMode, ADC1JSQRBase> ;
     using JSQ1 = ADC1_JSQR_JSQ1_Values<ADC1::JSQR, 0, 5, ReadWriteMode, ADC1JSQRBase> ;
+    static constexpr Type WritableMask = 0x3FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using JSQArray = FieldArray<1U, JSQ1, JSQ2, JSQ3, JSQ4> ;
+    template<std::size_t index>
+    using Field = typename JSQArray::template Field<index> ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JSQR_JSQ1_Values<ADC1::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +325,9 @@ struct ADC1
   struct JDR1 : public RegisterBase<0x4001203C, 32, ReadMode>
   {
     using JDATA = ADC1_JDR1_JDATA_Values<ADC1::JDR1, 0, 16, ReadMode, ADC1JDR1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JDR1_JDATA_Values<ADC1::JDR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +339,9 @@ struct ADC1
   struct JDR2 : public RegisterBase<0x40012040, 32, ReadMode>
   {
     using JDATA = ADC1_JDR2_JDATA_Values<ADC1::JDR2, 0, 16, ReadMode, ADC1JDR2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JDR2_JDATA_Values<ADC1::JDR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +353,9 @@ struct ADC1
   struct JDR3 : public RegisterBase<0x40012044, 32, ReadMode>
   {
     using JDATA = ADC1_JDR3_JDATA_Values<ADC1::JDR3, 0, 16, ReadMode, ADC1JDR3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JDR3_JDATA_Values<ADC1::JDR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +367,9 @@ struct ADC1
   struct JDR4 : public RegisterBase<0x40012048, 32, ReadMode>
   {
     using JDATA = ADC1_JDR4_JDATA_Values<ADC1::JDR4, 0, 16, ReadMode, ADC1JDR4Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_JDR4_JDATA_Values<ADC1::JDR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -295,12 +381,22 @@ struct ADC1
   struct DR : public RegisterBase<0x4001204C, 32, ReadMode>
   {
     using DATA = ADC1_DR_DATA_Values<ADC1::DR, 0, 16, ReadMode, ADC1DRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC1 ;
     using FieldValues = ADC1_DR_DATA_Values<ADC1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DRPack  = Register<0x4001204C, 32, ReadMode, ADC1DRBase, T...> ;
 
+  template<std::size_t index>
+  using JOFR = IndexedType<index, 1U, ADC1::JOFR1, ADC1::JOFR2, ADC1::JOFR3, ADC1::JOFR4> ;
+
+  template<std::size_t index>
+  using JDR = IndexedType<index, 1U, ADC1::JDR1, ADC1::JDR2, ADC1::JDR3, ADC1::JDR4> ;
+
+  using Registers = TypesList<ADC1::SR, ADC1::CR1, ADC1::CR2, ADC1::SMPR1, ADC1::SMPR2, ADC1::JOFR1, ADC1::JOFR2, ADC1::JOFR3, ADC1::JOFR4, ADC1::HTR, ADC1::LTR, ADC1::SQR1, ADC1::SQR2, ADC1::SQR3, ADC1::JSQR, ADC1::JDR1, ADC1::JDR2, ADC1::JDR3, ADC1::JDR4, ADC1::DR> ;
 } ;
 
 #endif //#if !defined(ADC1REGISTERS_HPP)
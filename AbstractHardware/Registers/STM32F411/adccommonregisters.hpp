@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct ADC_Common
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40012300U ;
+
   struct ADC_CommonCSRBase {} ;
 
   struct CSR : public RegisterBase<0x40012300, 32, ReadMode>
@@ -39,6 +44,15 @@ struct ADC_Common
     using JEOC1 = ADC_Common_CSR_JEOC1_Values<ADC_Common::CSR, 2, 1, ReadMode, ADC_CommonCSRBase> ;
     using EOC1 = ADC_Common_CSR_EOC1_Values<ADC_Common::CSR, 1, 1, ReadMode, ADC_CommonCSRBase> ;
     using AWD1 = ADC_Common_CSR_AWD1_Values<ADC_Common::CSR, 0, 1, ReadMode, ADC_CommonCSRBase> ;
+    static constexpr Type VolatileMask = 0x3F3F3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using OVRArray = FieldArray<1U, OVR1, OVR2, OVR3> ;
+    using STRTArray = FieldArray<1U, STRT1, STRT2, STRT3> ;
+    using JSTRTArray = FieldArray<1U, JSTRT1, JSTRT2, JSTRT3> ;
+    using JEOCArray = FieldArray<1U, JEOC1, JEOC2, JEOC3> ;
+    using EOCArray = FieldArray<1U, EOC1, EOC2, EOC3> ;
+    using AWDArray = FieldArray<1U, AWD1, AWD2, AWD3> ;
+    using Peripheral = ADC_Common ;
     using FieldValues = ADC_Common_CSR_AWD1_Values<ADC_Common::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,12 +69,16 @@ struct ADC_Common
     using DMA = ADC_Common_CCR_DMA_Values<ADC_Common::CCR, 14, 2, ReadWriteMode, ADC_CommonCCRBase> ;
     using DDS = ADC_Common_CCR_DDS_Values<ADC_Common::CCR, 13, 1, ReadWriteMode, ADC_CommonCCRBase> ;
     using DELAY = ADC_Common_CCR_DELAY_Values<ADC_Common::CCR, 8, 4, ReadWriteMode, ADC_CommonCCRBase> ;
+    static constexpr Type WritableMask = 0xC3EF00U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = ADC_Common ;
     using FieldValues = ADC_Common_CCR_DELAY_Values<ADC_Common::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCRPack  = Register<0x40012304, 32, ReadWriteMode, ADC_CommonCCRBase, T...> ;
 
+  using Registers = TypesList<ADC_Common::CSR, ADC_Common::CCR> ;
 } ;
 
 #endif //#if !defined(ADCCOMMONREGISTERS_HPP)
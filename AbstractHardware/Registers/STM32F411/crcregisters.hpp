@@ -14,14 +14,24 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct CRC
 {
+  using Bus = Ahb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40023000U ;
+
   struct CRCDRBase {} ;
 
   struct DR : public RegisterBase<0x40023000, 32, ReadWriteMode>
   {
     using DRField = CRC_DR_DR_Values<CRC::DR, 0, 32, ReadWriteMode, CRCDRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0xFFFFFFFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = CRC ;
     using FieldValues = CRC_DR_DR_Values<CRC::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +43,11 @@ struct CRC
   struct IDR : public RegisterBase<0x40023004, 32, ReadWriteMode>
   {
     using IDRField = CRC_IDR_IDR_Values<CRC::IDR, 0, 8, ReadWriteMode, CRCIDRBase> ;
+    static constexpr Type VolatileMask = 0xFFU ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = CRC ;
     using FieldValues = CRC_IDR_IDR_Values<CRC::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,12 +59,16 @@ struct CRC
   struct CR : public RegisterBase<0x40023008, 32, WriteMode>
   {
     using CRField = CRC_CR_CR_Values<CRC::CR, 0, 1, WriteMode, CRCCRBase> ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = CRC ;
     using FieldValues = CRC_CR_CR_Values<CRC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CRPack  = Register<0x40023008, 32, WriteMode, CRCCRBase, T...> ;
 
+  using Registers = TypesList<CRC::DR, CRC::IDR, CRC::CR> ;
 } ;
 
 #endif //#if !defined(CRCREGISTERS_HPP)
@@ -14,15 +14,23 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct DBG
 {
+  using Bus = PpbBus ;
+  static constexpr std::uintptr_t BaseAddress = 0xE0042000U ;
+
   struct DBGDBGMCU_IDCODEBase {} ;
 
   struct DBGMCU_IDCODE : public RegisterBase<0xE0042000, 32, ReadMode>
   {
     using DEV_ID = DBG_DBGMCU_IDCODE_DEV_ID_Values<DBG::DBGMCU_IDCODE, 0, 12, ReadMode, DBGDBGMCU_IDCODEBase> ;
     using REV_ID = DBG_DBGMCU_IDCODE_REV_ID_Values<DBG::DBGMCU_IDCODE, 16, 16, ReadMode, DBGDBGMCU_IDCODEBase> ;
+    static constexpr Type VolatileMask = 0xFFFF0FFFU ;
+    static constexpr Type ResetValue = 0x10006411U ;
+    using Peripheral = DBG ;
     using FieldValues = DBG_DBGMCU_IDCODE_REV_ID_Values<DBG::DBGMCU_IDCODE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +46,9 @@ struct DBG
     using DBG_STANDBY = DBG_DBGMCU_CR_DBG_STANDBY_Values<DBG::DBGMCU_CR, 2, 1, ReadWriteMode, DBGDBGMCU_CRBase> ;
     using TRACE_IOEN = DBG_DBGMCU_CR_TRACE_IOEN_Values<DBG::DBGMCU_CR, 5, 1, ReadWriteMode, DBGDBGMCU_CRBase> ;
     using TRACE_MODE = DBG_DBGMCU_CR_TRACE_MODE_Values<DBG::DBGMCU_CR, 6, 2, ReadWriteMode, DBGDBGMCU_CRBase> ;
+    static constexpr Type WritableMask = 0xE7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DBG ;
     using FieldValues = DBG_DBGMCU_CR_TRACE_MODE_Values<DBG::DBGMCU_CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +69,9 @@ struct DBG
     using DBG_I2C1_SMBUS_TIMEOUT = DBG_DBGMCU_APB1_FZ_DBG_I2C1_SMBUS_TIMEOUT_Values<DBG::DBGMCU_APB1_FZ, 21, 1, ReadWriteMode, DBGDBGMCU_APB1_FZBase> ;
     using DBG_I2C2_SMBUS_TIMEOUT = DBG_DBGMCU_APB1_FZ_DBG_I2C2_SMBUS_TIMEOUT_Values<DBG::DBGMCU_APB1_FZ, 22, 1, ReadWriteMode, DBGDBGMCU_APB1_FZBase> ;
     using DBG_I2C3SMBUS_TIMEOUT = DBG_DBGMCU_APB1_FZ_DBG_I2C3SMBUS_TIMEOUT_Values<DBG::DBGMCU_APB1_FZ, 23, 1, ReadWriteMode, DBGDBGMCU_APB1_FZBase> ;
+    static constexpr Type WritableMask = 0xE01C0FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DBG ;
     using FieldValues = DBG_DBGMCU_APB1_FZ_DBG_I2C3SMBUS_TIMEOUT_Values<DBG::DBGMCU_APB1_FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,12 +86,16 @@ struct DBG
     using DBG_TIM9_STOP = DBG_DBGMCU_APB2_FZ_DBG_TIM9_STOP_Values<DBG::DBGMCU_APB2_FZ, 16, 1, ReadWriteMode, DBGDBGMCU_APB2_FZBase> ;
     using DBG_TIM10_STOP = DBG_DBGMCU_APB2_FZ_DBG_TIM10_STOP_Values<DBG::DBGMCU_APB2_FZ, 17, 1, ReadWriteMode, DBGDBGMCU_APB2_FZBase> ;
     using DBG_TIM11_STOP = DBG_DBGMCU_APB2_FZ_DBG_TIM11_STOP_Values<DBG::DBGMCU_APB2_FZ, 18, 1, ReadWriteMode, DBGDBGMCU_APB2_FZBase> ;
+    static constexpr Type WritableMask = 0x70001U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DBG ;
     using FieldValues = DBG_DBGMCU_APB2_FZ_DBG_TIM11_STOP_Values<DBG::DBGMCU_APB2_FZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DBGMCU_APB2_FZPack  = Register<0xE004200C, 32, ReadWriteMode, DBGDBGMCU_APB2_FZBase, T...> ;
 
+  using Registers = TypesList<DBG::DBGMCU_IDCODE, DBG::DBGMCU_CR, DBG::DBGMCU_APB1_FZ, DBG::DBGMCU_APB2_FZ> ;
 } ;
 
 #endif //#if !defined(DBGREGISTERS_HPP)
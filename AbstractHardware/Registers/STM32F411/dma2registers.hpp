@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct DMA2
 {
+  using Bus = Ahb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40026400U ;
+
   struct DMA2LISRBase {} ;
 
   struct LISR : public RegisterBase<0x40026400, 32, ReadMode>
@@ -41,6 +46,9 @@ struct DMA2
     using TEIF0 = DMA2_LISR_TEIF0_Values<DMA2::LISR, 3, 1, ReadMode, DMA2LISRBase> ;
     using DMEIF0 = DMA2_LISR_DMEIF0_Values<DMA2::LISR, 2, 1, ReadMode, DMA2LISRBase> ;
     using FEIF0 = DMA2_LISR_FEIF0_Values<DMA2::LISR, 0, 1, ReadMode, DMA2LISRBase> ;
+    static constexpr Type VolatileMask = 0xF7D0F7DU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_LISR_FEIF0_Values<DMA2::LISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +79,9 @@ struct DMA2
     using TEIF4 = DMA2_HISR_TEIF4_Values<DMA2::HISR, 3, 1, ReadMode, DMA2HISRBase> ;
     using DMEIF4 = DMA2_HISR_DMEIF4_Values<DMA2::HISR, 2, 1, ReadMode, DMA2HISRBase> ;
     using FEIF4 = DMA2_HISR_FEIF4_Values<DMA2::HISR, 0, 1, ReadMode, DMA2HISRBase> ;
+    static constexpr Type VolatileMask = 0xF7D0F7DU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_HISR_FEIF4_Values<DMA2::HISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +112,10 @@ struct DMA2
     using CTEIF0 = DMA2_LIFCR_CTEIF0_Values<DMA2::LIFCR, 3, 1, WriteMode, DMA2LIFCRBase> ;
     using CDMEIF0 = DMA2_LIFCR_CDMEIF0_Values<DMA2::LIFCR, 2, 1, WriteMode, DMA2LIFCRBase> ;
     using CFEIF0 = DMA2_LIFCR_CFEIF0_Values<DMA2::LIFCR, 0, 1, WriteMode, DMA2LIFCRBase> ;
+    static constexpr Type WritableMask = 0xF7D0F7DU ;
+    static constexpr Type OneToClearMask = 0xF7D0F7DU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_LIFCR_CFEIF0_Values<DMA2::LIFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +146,10 @@ struct DMA2
     using CTEIF4 = DMA2_HIFCR_CTEIF4_Values<DMA2::HIFCR, 3, 1, WriteMode, DMA2HIFCRBase> ;
     using CDMEIF4 = DMA2_HIFCR_CDMEIF4_Values<DMA2::HIFCR, 2, 1, WriteMode, DMA2HIFCRBase> ;
     using CFEIF4 = DMA2_HIFCR_CFEIF4_Values<DMA2::HIFCR, 0, 1, WriteMode, DMA2HIFCRBase> ;
+    static constexpr Type WritableMask = 0xF7D0F7DU ;
+    static constexpr Type OneToClearMask = 0xF7D0F7DU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_HIFCR_CFEIF4_Values<DMA2::HIFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -160,6 +179,11 @@ struct DMA2
     using TEIE = DMA2_S0CR_TEIE_Values<DMA2::S0CR, 2, 1, ReadWriteMode, DMA2S0CRBase> ;
     using DMEIE = DMA2_S0CR_DMEIE_Values<DMA2::S0CR, 1, 1, ReadWriteMode, DMA2S0CRBase> ;
     using EN = DMA2_S0CR_EN_Values<DMA2::S0CR, 0, 1, ReadWriteMode, DMA2S0CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFEFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFEFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S0CR_EN_Values<DMA2::S0CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +195,10 @@ struct DMA2
   struct S0NDTR : public RegisterBase<0x40026414, 32, ReadWriteMode>
   {
     using NDT = DMA2_S0NDTR_NDT_Values<DMA2::S0NDTR, 0, 16, ReadWriteMode, DMA2S0NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S0NDTR_NDT_Values<DMA2::S0NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -182,6 +210,9 @@ struct DMA2
   struct S0PAR : public RegisterBase<0x40026418, 32, ReadWriteMode>
   {
     using PA = DMA2_S0PAR_PA_Values<DMA2::S0PAR, 0, 32, ReadWriteMode, DMA2S0PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S0PAR_PA_Values<DMA2::S0PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -193,6 +224,9 @@ struct DMA2
   struct S0M0AR : public RegisterBase<0x4002641C, 32, ReadWriteMode>
   {
     using M0A = DMA2_S0M0AR_M0A_Values<DMA2::S0M0AR, 0, 32, ReadWriteMode, DMA2S0M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S0M0AR_M0A_Values<DMA2::S0M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -204,6 +238,9 @@ struct DMA2
   struct S0M1AR : public RegisterBase<0x40026420, 32, ReadWriteMode>
   {
     using M1A = DMA2_S0M1AR_M1A_Values<DMA2::S0M1AR, 0, 32, ReadWriteMode, DMA2S0M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S0M1AR_M1A_Values<DMA2::S0M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +255,10 @@ struct DMA2
     using FS = DMA2_S0FCR_FS_Values<DMA2::S0FCR, 3, 3, ReadMode, DMA2S0FCRBase> ;
     using DMDIS = DMA2_S0FCR_DMDIS_Values<DMA2::S0FCR, 2, 1, ReadWriteMode, DMA2S0FCRBase> ;
     using FTH = DMA2_S0FCR_FTH_Values<DMA2::S0FCR, 0, 2, ReadWriteMode, DMA2S0FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S0FCR_FTH_Values<DMA2::S0FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -248,6 +289,11 @@ struct DMA2
     using TEIE = DMA2_S1CR_TEIE_Values<DMA2::S1CR, 2, 1, ReadWriteMode, DMA2S1CRBase> ;
     using DMEIE = DMA2_S1CR_DMEIE_Values<DMA2::S1CR, 1, 1, ReadWriteMode, DMA2S1CRBase> ;
     using EN = DMA2_S1CR_EN_Values<DMA2::S1CR, 0, 1, ReadWriteMode, DMA2S1CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S1CR_EN_Values<DMA2::S1CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,6 +305,10 @@ struct DMA2
   struct S1NDTR : public RegisterBase<0x4002642C, 32, ReadWriteMode>
   {
     using NDT = DMA2_S1NDTR_NDT_Values<DMA2::S1NDTR, 0, 16, ReadWriteMode, DMA2S1NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S1NDTR_NDT_Values<DMA2::S1NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +320,9 @@ struct DMA2
   struct S1PAR : public RegisterBase<0x40026430, 32, ReadWriteMode>
   {
     using PA = DMA2_S1PAR_PA_Values<DMA2::S1PAR, 0, 32, ReadWriteMode, DMA2S1PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S1PAR_PA_Values<DMA2::S1PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -281,6 +334,9 @@ struct DMA2
   struct S1M0AR : public RegisterBase<0x40026434, 32, ReadWriteMode>
   {
     using M0A = DMA2_S1M0AR_M0A_Values<DMA2::S1M0AR, 0, 32, ReadWriteMode, DMA2S1M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S1M0AR_M0A_Values<DMA2::S1M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -292,6 +348,9 @@ struct DMA2
   struct S1M1AR : public RegisterBase<0x40026438, 32, ReadWriteMode>
   {
     using M1A = DMA2_S1M1AR_M1A_Values<DMA2::S1M1AR, 0, 32, ReadWriteMode, DMA2S1M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S1M1AR_M1A_Values<DMA2::S1M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +365,10 @@ struct DMA2
     using FS = DMA2_S1FCR_FS_Values<DMA2::S1FCR, 3, 3, ReadMode, DMA2S1FCRBase> ;
     using DMDIS = DMA2_S1FCR_DMDIS_Values<DMA2::S1FCR, 2, 1, ReadWriteMode, DMA2S1FCRBase> ;
     using FTH = DMA2_S1FCR_FTH_Values<DMA2::S1FCR, 0, 2, ReadWriteMode, DMA2S1FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S1FCR_FTH_Values<DMA2::S1FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -336,6 +399,11 @@ struct DMA2
     using TEIE = DMA2_S2CR_TEIE_Values<DMA2::S2CR, 2, 1, ReadWriteMode, DMA2S2CRBase> ;
     using DMEIE = DMA2_S2CR_DMEIE_Values<DMA2::S2CR, 1, 1, ReadWriteMode, DMA2S2CRBase> ;
     using EN = DMA2_S2CR_EN_Values<DMA2::S2CR, 0, 1, ReadWriteMode, DMA2S2CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S2CR_EN_Values<DMA2::S2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -347,6 +415,10 @@ struct DMA2
   struct S2NDTR : public RegisterBase<0x40026444, 32, ReadWriteMode>
   {
     using NDT = DMA2_S2NDTR_NDT_Values<DMA2::S2NDTR, 0, 16, ReadWriteMode, DMA2S2NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S2NDTR_NDT_Values<DMA2::S2NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,6 +430,9 @@ struct DMA2
   struct S2PAR : public RegisterBase<0x40026448, 32, ReadWriteMode>
   {
     using PA = DMA2_S2PAR_PA_Values<DMA2::S2PAR, 0, 32, ReadWriteMode, DMA2S2PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S2PAR_PA_Values<DMA2::S2PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -369,6 +444,9 @@ struct DMA2
   struct S2M0AR : public RegisterBase<0x4002644C, 32, ReadWriteMode>
   {
     using M0A = DMA2_S2M0AR_M0A_Values<DMA2::S2M0AR, 0, 32, ReadWriteMode, DMA2S2M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S2M0AR_M0A_Values<DMA2::S2M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -380,6 +458,9 @@ struct DMA2
   struct S2M1AR : public RegisterBase<0x40026450, 32, ReadWriteMode>
   {
     using M1A = DMA2_S2M1AR_M1A_Values<DMA2::S2M1AR, 0, 32, ReadWriteMode, DMA2S2M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S2M1AR_M1A_Values<DMA2::S2M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -394,6 +475,10 @@ struct DMA2
     using FS = DMA2_S2FCR_FS_Values<DMA2::S2FCR, 3, 3, ReadMode, DMA2S2FCRBase> ;
     using DMDIS = DMA2_S2FCR_DMDIS_Values<DMA2::S2FCR, 2, 1, ReadWriteMode, DMA2S2FCRBase> ;
     using FTH = DMA2_S2FCR_FTH_Values<DMA2::S2FCR, 0, 2, ReadWriteMode, DMA2S2FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S2FCR_FTH_Values<DMA2::S2FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -424,6 +509,11 @@ struct DMA2
     using TEIE = DMA2_S3CR_TEIE_Values<DMA2::S3CR, 2, 1, ReadWriteMode, DMA2S3CRBase> ;
     using DMEIE = DMA2_S3CR_DMEIE_Values<DMA2::S3CR, 1, 1, ReadWriteMode, DMA2S3CRBase> ;
     using EN = DMA2_S3CR_EN_Values<DMA2::S3CR, 0, 1, ReadWriteMode, DMA2S3CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S3CR_EN_Values<DMA2::S3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -435,6 +525,10 @@ struct DMA2
   struct S3NDTR : public RegisterBase<0x4002645C, 32, ReadWriteMode>
   {
     using NDT = DMA2_S3NDTR_NDT_Values<DMA2::S3NDTR, 0, 16, ReadWriteMode, DMA2S3NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S3NDTR_NDT_Values<DMA2::S3NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -446,6 +540,9 @@ struct DMA2
   struct S3PAR : public RegisterBase<0x40026460, 32, ReadWriteMode>
   {
     using PA = DMA2_S3PAR_PA_Values<DMA2::S3PAR, 0, 32, ReadWriteMode, DMA2S3PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S3PAR_PA_Values<DMA2::S3PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -457,6 +554,9 @@ struct DMA2
   struct S3M0AR : public RegisterBase<0x40026464, 32, ReadWriteMode>
   {
     using M0A = DMA2_S3M0AR_M0A_Values<DMA2::S3M0AR, 0, 32, ReadWriteMode, DMA2S3M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S3M0AR_M0A_Values<DMA2::S3M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -468,6 +568,9 @@ struct DMA2
   struct S3M1AR : public RegisterBase<0x40026468, 32, ReadWriteMode>
   {
     using M1A = DMA2_S3M1AR_M1A_Values<DMA2::S3M1AR, 0, 32, ReadWriteMode, DMA2S3M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S3M1AR_M1A_Values<DMA2::S3M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -482,6 +585,10 @@ struct DMA2
     using FS = DMA2_S3FCR_FS_Values<DMA2::S3FCR, 3, 3, ReadMode, DMA2S3FCRBase> ;
     using DMDIS = DMA2_S3FCR_DMDIS_Values<DMA2::S3FCR, 2, 1, ReadWriteMode, DMA2S3FCRBase> ;
     using FTH = DMA2_S3FCR_FTH_Values<DMA2::S3FCR, 0, 2, ReadWriteMode, DMA2S3FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S3FCR_FTH_Values<DMA2::S3FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -512,6 +619,11 @@ struct DMA2
     using TEIE = DMA2_S4CR_TEIE_Values<DMA2::S4CR, 2, 1, ReadWriteMode, DMA2S4CRBase> ;
     using DMEIE = DMA2_S4CR_DMEIE_Values<DMA2::S4CR, 1, 1, ReadWriteMode, DMA2S4CRBase> ;
     using EN = DMA2_S4CR_EN_Values<DMA2::S4CR, 0, 1, ReadWriteMode, DMA2S4CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S4CR_EN_Values<DMA2::S4CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -523,6 +635,10 @@ struct DMA2
   struct S4NDTR : public RegisterBase<0x40026474, 32, ReadWriteMode>
   {
     using NDT = DMA2_S4NDTR_NDT_Values<DMA2::S4NDTR, 0, 16, ReadWriteMode, DMA2S4NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S4NDTR_NDT_Values<DMA2::S4NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -534,6 +650,9 @@ struct DMA2
   struct S4PAR : public RegisterBase<0x40026478, 32, ReadWriteMode>
   {
     using PA = DMA2_S4PAR_PA_Values<DMA2::S4PAR, 0, 32, ReadWriteMode, DMA2S4PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S4PAR_PA_Values<DMA2::S4PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -545,6 +664,9 @@ struct DMA2
   struct S4M0AR : public RegisterBase<0x4002647C, 32, ReadWriteMode>
   {
     using M0A = DMA2_S4M0AR_M0A_Values<DMA2::S4M0AR, 0, 32, ReadWriteMode, DMA2S4M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S4M0AR_M0A_Values<DMA2::S4M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -556,6 +678,9 @@ struct DMA2
   struct S4M1AR : public RegisterBase<0x40026480, 32, ReadWriteMode>
   {
     using M1A = DMA2_S4M1AR_M1A_Values<DMA2::S4M1AR, 0, 32, ReadWriteMode, DMA2S4M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S4M1AR_M1A_Values<DMA2::S4M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -570,6 +695,10 @@ struct DMA2
     using FS = DMA2_S4FCR_FS_Values<DMA2::S4FCR, 3, 3, ReadMode, DMA2S4FCRBase> ;
     using DMDIS = DMA2_S4FCR_DMDIS_Values<DMA2::S4FCR, 2, 1, ReadWriteMode, DMA2S4FCRBase> ;
     using FTH = DMA2_S4FCR_FTH_Values<DMA2::S4FCR, 0, 2, ReadWriteMode, DMA2S4FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S4FCR_FTH_Values<DMA2::S4FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -600,6 +729,11 @@ struct DMA2
     using TEIE = DMA2_S5CR_TEIE_Values<DMA2::S5CR, 2, 1, ReadWriteMode, DMA2S5CRBase> ;
     using DMEIE = DMA2_S5CR_DMEIE_Values<DMA2::S5CR, 1, 1, ReadWriteMode, DMA2S5CRBase> ;
     using EN = DMA2_S5CR_EN_Values<DMA2::S5CR, 0, 1, ReadWriteMode, DMA2S5CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S5CR_EN_Values<DMA2::S5CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -611,6 +745,10 @@ struct DMA2
   struct S5NDTR : public RegisterBase<0x4002648C, 32, ReadWriteMode>
   {
     using NDT = DMA2_S5NDTR_NDT_Values<DMA2::S5NDTR, 0, 16, ReadWriteMode, DMA2S5NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S5NDTR_NDT_Values<DMA2::S5NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -622,6 +760,9 @@ struct DMA2
   struct S5PAR : public RegisterBase<0x40026490, 32, ReadWriteMode>
   {
     using PA = DMA2_S5PAR_PA_Values<DMA2::S5PAR, 0, 32, ReadWriteMode, DMA2S5PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S5PAR_PA_Values<DMA2::S5PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -633,6 +774,9 @@ struct DMA2
   struct S5M0AR : public RegisterBase<0x40026494, 32, ReadWriteMode>
   {
     using M0A = DMA2_S5M0AR_M0A_Values<DMA2::S5M0AR, 0, 32, ReadWriteMode, DMA2S5M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S5M0AR_M0A_Values<DMA2::S5M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -644,6 +788,9 @@ struct DMA2
   struct S5M1AR : public RegisterBase<0x40026498, 32, ReadWriteMode>
   {
     using M1A = DMA2_S5M1AR_M1A_Values<DMA2::S5M1AR, 0, 32, ReadWriteMode, DMA2S5M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S5M1AR_M1A_Values<DMA2::S5M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -658,6 +805,10 @@ struct DMA2
     using FS = DMA2_S5FCR_FS_Values<DMA2::S5FCR, 3, 3, ReadMode, DMA2S5FCRBase> ;
     using DMDIS = DMA2_S5FCR_DMDIS_Values<DMA2::S5FCR, 2, 1, ReadWriteMode, DMA2S5FCRBase> ;
     using FTH = DMA2_S5FCR_FTH_Values<DMA2::S5FCR, 0, 2, ReadWriteMode, DMA2S5FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S5FCR_FTH_Values<DMA2::S5FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -688,6 +839,11 @@ struct DMA2
     using TEIE = DMA2_S6CR_TEIE_Values<DMA2::S6CR, 2, 1, ReadWriteMode, DMA2S6CRBase> ;
     using DMEIE = DMA2_S6CR_DMEIE_Values<DMA2::S6CR, 1, 1, ReadWriteMode, DMA2S6CRBase> ;
     using EN = DMA2_S6CR_EN_Values<DMA2::S6CR, 0, 1, ReadWriteMode, DMA2S6CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S6CR_EN_Values<DMA2::S6CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -699,6 +855,10 @@ struct DMA2
   struct S6NDTR : public RegisterBase<0x400264A4, 32, ReadWriteMode>
   {
     using NDT = DMA2_S6NDTR_NDT_Values<DMA2::S6NDTR, 0, 16, ReadWriteMode, DMA2S6NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S6NDTR_NDT_Values<DMA2::S6NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -710,6 +870,9 @@ struct DMA2
   struct S6PAR : public RegisterBase<0x400264A8, 32, ReadWriteMode>
   {
     using PA = DMA2_S6PAR_PA_Values<DMA2::S6PAR, 0, 32, ReadWriteMode, DMA2S6PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S6PAR_PA_Values<DMA2::S6PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -721,6 +884,9 @@ struct DMA2
   struct S6M0AR : public RegisterBase<0x400264AC, 32, ReadWriteMode>
   {
     using M0A = DMA2_S6M0AR_M0A_Values<DMA2::S6M0AR, 0, 32, ReadWriteMode, DMA2S6M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S6M0AR_M0A_Values<DMA2::S6M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -732,6 +898,9 @@ struct DMA2
   struct S6M1AR : public RegisterBase<0x400264B0, 32, ReadWriteMode>
   {
     using M1A = DMA2_S6M1AR_M1A_Values<DMA2::S6M1AR, 0, 32, ReadWriteMode, DMA2S6M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S6M1AR_M1A_Values<DMA2::S6M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -746,6 +915,10 @@ struct DMA2
     using FS = DMA2_S6FCR_FS_Values<DMA2::S6FCR, 3, 3, ReadMode, DMA2S6FCRBase> ;
     using DMDIS = DMA2_S6FCR_DMDIS_Values<DMA2::S6FCR, 2, 1, ReadWriteMode, DMA2S6FCRBase> ;
     using FTH = DMA2_S6FCR_FTH_Values<DMA2::S6FCR, 0, 2, ReadWriteMode, DMA2S6FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S6FCR_FTH_Values<DMA2::S6FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -776,6 +949,11 @@ struct DMA2
     using TEIE = DMA2_S7CR_TEIE_Values<DMA2::S7CR, 2, 1, ReadWriteMode, DMA2S7CRBase> ;
     using DMEIE = DMA2_S7CR_DMEIE_Values<DMA2::S7CR, 1, 1, ReadWriteMode, DMA2S7CRBase> ;
     using EN = DMA2_S7CR_EN_Values<DMA2::S7CR, 0, 1, ReadWriteMode, DMA2S7CRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFFFFFEU ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S7CR_EN_Values<DMA2::S7CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -787,6 +965,10 @@ struct DMA2
   struct S7NDTR : public RegisterBase<0x400264BC, 32, ReadWriteMode>
   {
     using NDT = DMA2_S7NDTR_NDT_Values<DMA2::S7NDTR, 0, 16, ReadWriteMode, DMA2S7NDTRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S7NDTR_NDT_Values<DMA2::S7NDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -798,6 +980,9 @@ struct DMA2
   struct S7PAR : public RegisterBase<0x400264C0, 32, ReadWriteMode>
   {
     using PA = DMA2_S7PAR_PA_Values<DMA2::S7PAR, 0, 32, ReadWriteMode, DMA2S7PARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S7PAR_PA_Values<DMA2::S7PAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -809,6 +994,9 @@ struct DMA2
   struct S7M0AR : public RegisterBase<0x400264C4, 32, ReadWriteMode>
   {
     using M0A = DMA2_S7M0AR_M0A_Values<DMA2::S7M0AR, 0, 32, ReadWriteMode, DMA2S7M0ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S7M0AR_M0A_Values<DMA2::S7M0AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -820,6 +1008,9 @@ struct DMA2
   struct S7M1AR : public RegisterBase<0x400264C8, 32, ReadWriteMode>
   {
     using M1A = DMA2_S7M1AR_M1A_Values<DMA2::S7M1AR, 0, 32, ReadWriteMode, DMA2S7M1ARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S7M1AR_M1A_Values<DMA2::S7M1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -834,12 +1025,27 @@ struct DMA2
     using FS = DMA2_S7FCR_FS_Values<DMA2::S7FCR, 3, 3, ReadMode, DMA2S7FCRBase> ;
     using DMDIS = DMA2_S7FCR_DMDIS_Values<DMA2::S7FCR, 2, 1, ReadWriteMode, DMA2S7FCRBase> ;
     using FTH = DMA2_S7FCR_FTH_Values<DMA2::S7FCR, 0, 2, ReadWriteMode, DMA2S7FCRBase> ;
+    static constexpr Type VolatileMask = 0x38U ;
+    static constexpr Type WritableMask = 0x87U ;
+    static constexpr Type ResetValue = 0x21U ;
+    using Peripheral = DMA2 ;
     using FieldValues = DMA2_S7FCR_FTH_Values<DMA2::S7FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using S7FCRPack  = Register<0x400264CC, 32, ReadWriteMode, DMA2S7FCRBase, T...> ;
 
+  template<std::size_t index>
+  struct S
+  {
+    using NDTR = IndexedType<index, 0U, DMA2::S0NDTR, DMA2::S1NDTR, DMA2::S2NDTR, DMA2::S3NDTR, DMA2::S4NDTR, DMA2::S5NDTR, DMA2::S6NDTR, DMA2::S7NDTR> ;
+    using PAR = IndexedType<index, 0U, DMA2::S0PAR, DMA2::S1PAR, DMA2::S2PAR, DMA2::S3PAR, DMA2::S4PAR, DMA2::S5PAR, DMA2::S6PAR, DMA2::S7PAR> ;
+    using M0AR = IndexedType<index, 0U, DMA2::S0M0AR, DMA2::S1M0AR, DMA2::S2M0AR, DMA2::S3M0AR, DMA2::S4M0AR, DMA2::S5M0AR, DMA2::S6M0AR, DMA2::S7M0AR> ;
+    using M1AR = IndexedType<index, 0U, DMA2::S0M1AR, DMA2::S1M1AR, DMA2::S2M1AR, DMA2::S3M1AR, DMA2::S4M1AR, DMA2::S5M1AR, DMA2::S6M1AR, DMA2::S7M1AR> ;
+    using FCR = IndexedType<index, 0U, DMA2::S0FCR, DMA2::S1FCR, DMA2::S2FCR, DMA2::S3FCR, DMA2::S4FCR, DMA2::S5FCR, DMA2::S6FCR, DMA2::S7FCR> ;
+  } ;
+
+  using Registers = TypesList<DMA2::LISR, DMA2::HISR, DMA2::LIFCR, DMA2::HIFCR, DMA2::S0CR, DMA2::S0NDTR, DMA2::S0PAR, DMA2::S0M0AR, DMA2::S0M1AR, DMA2::S0FCR, DMA2::S1CR, DMA2::S1NDTR, DMA2::S1PAR, DMA2::S1M0AR, DMA2::S1M1AR, DMA2::S1FCR, DMA2::S2CR, DMA2::S2NDTR, DMA2::S2PAR, DMA2::S2M0AR, DMA2::S2M1AR, DMA2::S2FCR, DMA2::S3CR, DMA2::S3NDTR, DMA2::S3PAR, DMA2::S3M0AR, DMA2::S3M1AR, DMA2::S3FCR, DMA2::S4CR, DMA2::S4NDTR, DMA2::S4PAR, DMA2::S4M0AR, DMA2::S4M1AR, DMA2::S4FCR, DMA2::S5CR, DMA2::S5NDTR, DMA2::S5PAR, DMA2::S5M0AR, DMA2::S5M1AR, DMA2::S5FCR, DMA2::S6CR, DMA2::S6NDTR, DMA2::S6PAR, DMA2::S6M0AR, DMA2::S6M1AR, DMA2::S6FCR, DMA2::S7CR, DMA2::S7NDTR, DMA2::S7PAR, DMA2::S7M0AR, DMA2::S7M1AR, DMA2::S7FCR> ;
 } ;
 
 #endif //#if !defined(DMA2REGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct EXTI
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40013C00U ;
+
   struct EXTIIMRBase {} ;
 
   struct IMR : public RegisterBase<0x40013C00, 32, ReadWriteMode>
@@ -44,6 +49,12 @@ struct EXTI
     using MR20 = EXTI_IMR_MR20_Values<EXTI::IMR, 20, 1, ReadWriteMode, EXTIIMRBase> ;
     using MR21 = EXTI_IMR_MR21_Values<EXTI::IMR, 21, 1, ReadWriteMode, EXTIIMRBase> ;
     using MR22 = EXTI_IMR_MR22_Values<EXTI::IMR, 22, 1, ReadWriteMode, EXTIIMRBase> ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using MRArray = FieldArray<0U, MR0, MR1, MR2, MR3, MR4, MR5, MR6, MR7, MR8, MR9, MR10, MR11, MR12, MR13, MR14, MR15, MR16, MR17, MR18, MR19, MR20, MR21, MR22> ;
+    template<std::size_t index>
+    using Field = typename MRArray::template Field<index> ;
+    using Peripheral = EXTI ;
     using FieldValues = EXTI_IMR_MR22_Values<EXTI::IMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +88,12 @@ struct EXTI
     using MR20 = EXTI_EMR_MR20_Values<EXTI::EMR, 20, 1, ReadWriteMode, EXTIEMRBase> ;
     using MR21 = EXTI_EMR_MR21_Values<EXTI::EMR, 21, 1, ReadWriteMode, EXTIEMRBase> ;
     using MR22 = EXTI_EMR_MR22_Values<EXTI::EMR, 22, 1, ReadWriteMode, EXTIEMRBase> ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using MRArray = FieldArray<0U, MR0, MR1, MR2, MR3, MR4, MR5, MR6, MR7, MR8, MR9, MR10, MR11, MR12, MR13, MR14, MR15, MR16, MR17, MR18, MR19, MR20, MR21, MR22> ;
+    template<std::size_t index>
+    using Field = typename MRArray::template Field<index> ;
+    using Peripheral = EXTI ;
     using FieldValues = EXTI_EMR_MR22_Values<EXTI::EMR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +127,12 @@ struct EXTI
     using TR20 = EXTI_RTSR_TR20_Values<EXTI::RTSR, 20, 1, ReadWriteMode, EXTIRTSRBase> ;
     using TR21 = EXTI_RTSR_TR21_Values<EXTI::RTSR, 21, 1, ReadWriteMode, EXTIRTSRBase> ;
     using TR22 = EXTI_RTSR_TR22_Values<EXTI::RTSR, 22, 1, ReadWriteMode, EXTIRTSRBase> ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using TRArray = FieldArray<0U, TR0, TR1, TR2, TR3, TR4, TR5, TR6, TR7, TR8, TR9, TR10, TR11, TR12, TR13, TR14, TR15, TR16, TR17, TR18, TR19, TR20, TR21, TR22> ;
+    template<std::size_t index>
+    using Field = typename TRArray::template Field<index> ;
+    using Peripheral = EXTI ;
     using FieldValues = EXTI_RTSR_TR22_Values<EXTI::RTSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +166,12 @@ struct EXTI
     using TR20 = EXTI_FTSR_TR20_Values<EXTI::FTSR, 20, 1, ReadWriteMode, EXTIFTSRBase> ;
     using TR21 = EXTI_FTSR_TR21_Values<EXTI::FTSR, 21, 1, ReadWriteMode, EXTIFTSRBase> ;
     using TR22 = EXTI_FTSR_TR22_Values<EXTI::FTSR, 22, 1, ReadWriteMode, EXTIFTSRBase> ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using TRArray = FieldArray<0U, TR0, TR1, TR2, TR3, TR4, TR5, TR6, TR7, TR8, TR9, TR10, TR11, TR12, TR13, TR14, TR15, TR16, TR17, TR18, TR19, TR20, TR21, TR22> ;
+    template<std::size_t index>
+    using Field = typename TRArray::template Field<index> ;
+    using Peripheral = EXTI ;
     using FieldValues = EXTI_FTSR_TR22_Values<EXTI::FTSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +205,13 @@ struct EXTI
     using SWIER20 = EXTI_SWIER_SWIER20_Values<EXTI::SWIER, 20, 1, ReadWriteMode, EXTISWIERBase> ;
     using SWIER21 = EXTI_SWIER_SWIER21_Values<EXTI::SWIER, 21, 1, ReadWriteMode, EXTISWIERBase> ;
     using SWIER22 = EXTI_SWIER_SWIER22_Values<EXTI::SWIER, 22, 1, ReadWriteMode, EXTISWIERBase> ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using SWIERArray = FieldArray<0U, SWIER0, SWIER1, SWIER2, SWIER3, SWIER4, SWIER5, SWIER6, SWIER7, SWIER8, SWIER9, SWIER10, SWIER11, SWIER12, SWIER13, SWIER14, SWIER15, SWIER16, SWIER17, SWIER18, SWIER19, SWIER20, SWIER21, SWIER22> ;
+    template<std::size_t index>
+    using Field = typename SWIERArray::template Field<index> ;
+    using Peripheral = EXTI ;
     using FieldValues = EXTI_SWIER_SWIER22_Values<EXTI::SWIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,12 +245,22 @@ struct EXTI
     using PR20 = EXTI_PR_PR20_Values<EXTI::PR, 20, 1, ReadWriteMode, EXTIPRBase> ;
     using PR21 = EXTI_PR_PR21_Values<EXTI::PR, 21, 1, ReadWriteMode, EXTIPRBase> ;
     using PR22 = EXTI_PR_PR22_Values<EXTI::PR, 22, 1, ReadWriteMode, EXTIPRBase> ;
+    static constexpr Type VolatileMask = 0x7FFFFFU ;
+    static constexpr Type WritableMask = 0x7FFFFFU ;
+    static constexpr Type OneToClearMask = 0x7FFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using PRArray = FieldArray<0U, PR0, PR1, PR2, PR3, PR4, PR5, PR6, PR7, PR8, PR9, PR10, PR11, PR12, PR13, PR14, PR15, PR16, PR17, PR18, PR19, PR20, PR21, PR22> ;
+    template<std::size_t index>
+    using Field = typename PRArray::template Field<index> ;
+    using Peripheral = EXTI ;
     using FieldValues = EXTI_PR_PR22_Values<EXTI::PR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PRPack  = Register<0x40013C14, 32, ReadWriteMode, EXTIPRBase, T...> ;
 
+  using Registers = TypesList<EXTI::IMR, EXTI::EMR, EXTI::RTSR, EXTI::FTSR, EXTI::SWIER, EXTI::PR> ;
 } ;
 
 #endif //#if !defined(EXTIREGISTERS_HPP)
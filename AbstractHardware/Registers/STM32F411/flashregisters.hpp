@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct FLASH
 {
+  using Bus = Ahb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40023C00U ;
+
   struct FLASHACRBase {} ;
 
   struct ACR : public RegisterBase<0x40023C00, 32, ReadWriteMode>
@@ -27,6 +32,9 @@ struct FLASH
     using DCEN = FLASH_ACR_DCEN_Values<FLASH::ACR, 10, 1, ReadWriteMode, FLASHACRBase> ;
     using ICRST = FLASH_ACR_ICRST_Values<FLASH::ACR, 11, 1, WriteMode, FLASHACRBase> ;
     using DCRST = FLASH_ACR_DCRST_Values<FLASH::ACR, 12, 1, ReadWriteMode, FLASHACRBase> ;
+    static constexpr Type WritableMask = 0x1F07U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FLASH ;
     using FieldValues = FLASH_ACR_DCRST_Values<FLASH::ACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +46,9 @@ struct FLASH
   struct KEYR : public RegisterBase<0x40023C04, 32, WriteMode>
   {
     using KEY = FLASH_KEYR_KEY_Values<FLASH::KEYR, 0, 32, WriteMode, FLASHKEYRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FLASH ;
     using FieldValues = FLASH_KEYR_KEY_Values<FLASH::KEYR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -49,6 +60,9 @@ struct FLASH
   struct OPTKEYR : public RegisterBase<0x40023C08, 32, WriteMode>
   {
     using OPTKEY = FLASH_OPTKEYR_OPTKEY_Values<FLASH::OPTKEYR, 0, 32, WriteMode, FLASHOPTKEYRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = FLASH ;
     using FieldValues = FLASH_OPTKEYR_OPTKEY_Values<FLASH::OPTKEYR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +80,12 @@ struct FLASH
     using PGPERR = FLASH_SR_PGPERR_Values<FLASH::SR, 6, 1, ReadWriteMode, FLASHSRBase> ;
     using PGSERR = FLASH_SR_PGSERR_Values<FLASH::SR, 7, 1, ReadWriteMode, FLASHSRBase> ;
     using BSY = FLASH_SR_BSY_Values<FLASH::SR, 16, 1, ReadMode, FLASHSRBase> ;
+    static constexpr Type VolatileMask = 0x100F3U ;
+    static constexpr Type WritableMask = 0xF3U ;
+    static constexpr Type OneToClearMask = 0xF3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = FLASH ;
     using FieldValues = FLASH_SR_BSY_Values<FLASH::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +105,11 @@ struct FLASH
     using EOPIE = FLASH_CR_EOPIE_Values<FLASH::CR, 24, 1, ReadWriteMode, FLASHCRBase> ;
     using ERRIE = FLASH_CR_ERRIE_Values<FLASH::CR, 25, 1, ReadWriteMode, FLASHCRBase> ;
     using LOCK = FLASH_CR_LOCK_Values<FLASH::CR, 31, 1, ReadWriteMode, FLASHCRBase> ;
+    static constexpr Type VolatileMask = 0x10000U ;
+    static constexpr Type WritableMask = 0x8301037FU ;
+    static constexpr Type ResetValue = 0x80000000U ;
+    static constexpr Type SnapshotMask = 0x8300037FU ;
+    using Peripheral = FLASH ;
     using FieldValues = FLASH_CR_LOCK_Values<FLASH::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,12 +128,16 @@ struct FLASH
     using nRST_STDBY = FLASH_OPTCR_nRST_STDBY_Values<FLASH::OPTCR, 7, 1, ReadWriteMode, FLASHOPTCRBase> ;
     using RDP = FLASH_OPTCR_RDP_Values<FLASH::OPTCR, 8, 8, ReadWriteMode, FLASHOPTCRBase> ;
     using nWRP = FLASH_OPTCR_nWRP_Values<FLASH::OPTCR, 16, 12, ReadWriteMode, FLASHOPTCRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFEFU ;
+    static constexpr Type ResetValue = 0x14U ;
+    using Peripheral = FLASH ;
     using FieldValues = FLASH_OPTCR_nWRP_Values<FLASH::OPTCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OPTCRPack  = Register<0x40023C14, 32, ReadWriteMode, FLASHOPTCRBase, T...> ;
 
+  using Registers = TypesList<FLASH::ACR, FLASH::KEYR, FLASH::OPTKEYR, FLASH::SR, FLASH::CR, FLASH::OPTCR> ;
 } ;
 
 #endif //#if !defined(FLASHREGISTERS_HPP)
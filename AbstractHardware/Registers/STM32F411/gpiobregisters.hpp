@@ -14,9 +14,16 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOB
 {
+  using Bus = Ahb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40020400U ;
+
+  struct BSRR ;
+
   struct GPIOBMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40020400, 32, ReadWriteMode>
@@ -37,6 +44,12 @@ struct GPIOB
     using MODER2 = GPIOB_MODER_MODER2_Values<GPIOB::MODER, 4, 2, ReadWriteMode, GPIOBMODERBase> ;
     using MODER1 = GPIOB_MODER_MODER1_Values<GPIOB::MODER, 2, 2, ReadWriteMode, GPIOBMODERBase> ;
     using MODER0 = GPIOB_MODER_MODER0_Values<GPIOB::MODER, 0, 2, ReadWriteMode, GPIOBMODERBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x280U ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_MODER_MODER0_Values<GPIOB::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +76,12 @@ struct GPIOB
     using OT2 = GPIOB_OTYPER_OT2_Values<GPIOB::OTYPER, 2, 1, ReadWriteMode, GPIOBOTYPERBase> ;
     using OT1 = GPIOB_OTYPER_OT1_Values<GPIOB::OTYPER, 1, 1, ReadWriteMode, GPIOBOTYPERBase> ;
     using OT0 = GPIOB_OTYPER_OT0_Values<GPIOB::OTYPER, 0, 1, ReadWriteMode, GPIOBOTYPERBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_OTYPER_OT0_Values<GPIOB::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +108,12 @@ struct GPIOB
     using OSPEEDR2 = GPIOB_OSPEEDR_OSPEEDR2_Values<GPIOB::OSPEEDR, 4, 2, ReadWriteMode, GPIOBOSPEEDRBase> ;
     using OSPEEDR1 = GPIOB_OSPEEDR_OSPEEDR1_Values<GPIOB::OSPEEDR, 2, 2, ReadWriteMode, GPIOBOSPEEDRBase> ;
     using OSPEEDR0 = GPIOB_OSPEEDR_OSPEEDR0_Values<GPIOB::OSPEEDR, 0, 2, ReadWriteMode, GPIOBOSPEEDRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0xC0U ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_OSPEEDR_OSPEEDR0_Values<GPIOB::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +140,12 @@ struct GPIOB
     using PUPDR2 = GPIOB_PUPDR_PUPDR2_Values<GPIOB::PUPDR, 4, 2, ReadWriteMode, GPIOBPUPDRBase> ;
     using PUPDR1 = GPIOB_PUPDR_PUPDR1_Values<GPIOB::PUPDR, 2, 2, ReadWriteMode, GPIOBPUPDRBase> ;
     using PUPDR0 = GPIOB_PUPDR_PUPDR0_Values<GPIOB::PUPDR, 0, 2, ReadWriteMode, GPIOBPUPDRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x100U ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_PUPDR_PUPDR0_Values<GPIOB::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +172,12 @@ struct GPIOB
     using IDR2 = GPIOB_IDR_IDR2_Values<GPIOB::IDR, 2, 1, ReadMode, GPIOBIDRBase> ;
     using IDR1 = GPIOB_IDR_IDR1_Values<GPIOB::IDR, 1, 1, ReadMode, GPIOBIDRBase> ;
     using IDR0 = GPIOB_IDR_IDR0_Values<GPIOB::IDR, 0, 1, ReadMode, GPIOBIDRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_IDR_IDR0_Values<GPIOB::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +204,14 @@ struct GPIOB
     using ODR2 = GPIOB_ODR_ODR2_Values<GPIOB::ODR, 2, 1, ReadWriteMode, GPIOBODRBase> ;
     using ODR1 = GPIOB_ODR_ODR1_Values<GPIOB::ODR, 1, 1, ReadWriteMode, GPIOBODRBase> ;
     using ODR0 = GPIOB_ODR_ODR0_Values<GPIOB::ODR, 0, 1, ReadWriteMode, GPIOBODRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    using SetResetRegister = GPIOB::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_ODR_ODR0_Values<GPIOB::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +254,11 @@ struct GPIOB
     using BS2 = GPIOB_BSRR_BS2_Values<GPIOB::BSRR, 2, 1, WriteMode, GPIOBBSRRBase> ;
     using BS1 = GPIOB_BSRR_BS1_Values<GPIOB::BSRR, 1, 1, WriteMode, GPIOBBSRRBase> ;
     using BS0 = GPIOB_BSRR_BS0_Values<GPIOB::BSRR, 0, 1, WriteMode, GPIOBBSRRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_BSRR_BS0_Values<GPIOB::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +286,12 @@ struct GPIOB
     using LCK2 = GPIOB_LCKR_LCK2_Values<GPIOB::LCKR, 2, 1, ReadWriteMode, GPIOBLCKRBase> ;
     using LCK1 = GPIOB_LCKR_LCK1_Values<GPIOB::LCKR, 1, 1, ReadWriteMode, GPIOBLCKRBase> ;
     using LCK0 = GPIOB_LCKR_LCK0_Values<GPIOB::LCKR, 0, 1, ReadWriteMode, GPIOBLCKRBase> ;
+    static constexpr Type WritableMask = 0x1FFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_LCKR_LCK0_Values<GPIOB::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +310,12 @@ struct GPIOB
     using AFRL2 = GPIOB_AFRL_AFRL2_Values<GPIOB::AFRL, 8, 4, ReadWriteMode, GPIOBAFRLBase> ;
     using AFRL1 = GPIOB_AFRL_AFRL1_Values<GPIOB::AFRL, 4, 4, ReadWriteMode, GPIOBAFRLBase> ;
     using AFRL0 = GPIOB_AFRL_AFRL0_Values<GPIOB::AFRL, 0, 4, ReadWriteMode, GPIOBAFRLBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_AFRL_AFRL0_Values<GPIOB::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +334,19 @@ struct GPIOB
     using AFRH10 = GPIOB_AFRH_AFRH10_Values<GPIOB::AFRH, 8, 4, ReadWriteMode, GPIOBAFRHBase> ;
     using AFRH9 = GPIOB_AFRH_AFRH9_Values<GPIOB::AFRH, 4, 4, ReadWriteMode, GPIOBAFRHBase> ;
     using AFRH8 = GPIOB_AFRH_AFRH8_Values<GPIOB::AFRH, 0, 4, ReadWriteMode, GPIOBAFRHBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
+    using Peripheral = GPIOB ;
     using FieldValues = GPIOB_AFRH_AFRH8_Values<GPIOB::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40020424, 32, ReadWriteMode, GPIOBAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOB::MODER, GPIOB::OTYPER, GPIOB::OSPEEDR, GPIOB::PUPDR, GPIOB::IDR, GPIOB::ODR, GPIOB::BSRR, GPIOB::LCKR, GPIOB::AFRL, GPIOB::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOBREGISTERS_HPP)
@@ -14,9 +14,16 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct GPIOE
 {
+  using Bus = Ahb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40021000U ;
+
+  struct BSRR ;
+
   struct GPIOEMODERBase {} ;
 
   struct MODER : public RegisterBase<0x40021000, 32, ReadWriteMode>
@@ -37,6 +44,12 @@ struct GPIOE
     using MODER2 = GPIOE_MODER_MODER2_Values<GPIOE::MODER, 4, 2, ReadWriteMode, GPIOEMODERBase> ;
     using MODER1 = GPIOE_MODER_MODER1_Values<GPIOE::MODER, 2, 2, ReadWriteMode, GPIOEMODERBase> ;
     using MODER0 = GPIOE_MODER_MODER0_Values<GPIOE::MODER, 0, 2, ReadWriteMode, GPIOEMODERBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using MODERArray = FieldArray<0U, MODER0, MODER1, MODER2, MODER3, MODER4, MODER5, MODER6, MODER7, MODER8, MODER9, MODER10, MODER11, MODER12, MODER13, MODER14, MODER15> ;
+    template<std::size_t index>
+    using Field = typename MODERArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_MODER_MODER0_Values<GPIOE::MODER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +76,12 @@ struct GPIOE
     using OT2 = GPIOE_OTYPER_OT2_Values<GPIOE::OTYPER, 2, 1, ReadWriteMode, GPIOEOTYPERBase> ;
     using OT1 = GPIOE_OTYPER_OT1_Values<GPIOE::OTYPER, 1, 1, ReadWriteMode, GPIOEOTYPERBase> ;
     using OT0 = GPIOE_OTYPER_OT0_Values<GPIOE::OTYPER, 0, 1, ReadWriteMode, GPIOEOTYPERBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using OTArray = FieldArray<0U, OT0, OT1, OT2, OT3, OT4, OT5, OT6, OT7, OT8, OT9, OT10, OT11, OT12, OT13, OT14, OT15> ;
+    template<std::size_t index>
+    using Field = typename OTArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_OTYPER_OT0_Values<GPIOE::OTYPER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +108,12 @@ struct GPIOE
     using OSPEEDR2 = GPIOE_OSPEEDR_OSPEEDR2_Values<GPIOE::OSPEEDR, 4, 2, ReadWriteMode, GPIOEOSPEEDRBase> ;
     using OSPEEDR1 = GPIOE_OSPEEDR_OSPEEDR1_Values<GPIOE::OSPEEDR, 2, 2, ReadWriteMode, GPIOEOSPEEDRBase> ;
     using OSPEEDR0 = GPIOE_OSPEEDR_OSPEEDR0_Values<GPIOE::OSPEEDR, 0, 2, ReadWriteMode, GPIOEOSPEEDRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using OSPEEDRArray = FieldArray<0U, OSPEEDR0, OSPEEDR1, OSPEEDR2, OSPEEDR3, OSPEEDR4, OSPEEDR5, OSPEEDR6, OSPEEDR7, OSPEEDR8, OSPEEDR9, OSPEEDR10, OSPEEDR11, OSPEEDR12, OSPEEDR13, OSPEEDR14, OSPEEDR15> ;
+    template<std::size_t index>
+    using Field = typename OSPEEDRArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_OSPEEDR_OSPEEDR0_Values<GPIOE::OSPEEDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +140,12 @@ struct GPIOE
     using PUPDR2 = GPIOE_PUPDR_PUPDR2_Values<GPIOE::PUPDR, 4, 2, ReadWriteMode, GPIOEPUPDRBase> ;
     using PUPDR1 = GPIOE_PUPDR_PUPDR1_Values<GPIOE::PUPDR, 2, 2, ReadWriteMode, GPIOEPUPDRBase> ;
     using PUPDR0 = GPIOE_PUPDR_PUPDR0_Values<GPIOE::PUPDR, 0, 2, ReadWriteMode, GPIOEPUPDRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using PUPDRArray = FieldArray<0U, PUPDR0, PUPDR1, PUPDR2, PUPDR3, PUPDR4, PUPDR5, PUPDR6, PUPDR7, PUPDR8, PUPDR9, PUPDR10, PUPDR11, PUPDR12, PUPDR13, PUPDR14, PUPDR15> ;
+    template<std::size_t index>
+    using Field = typename PUPDRArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_PUPDR_PUPDR0_Values<GPIOE::PUPDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -141,6 +172,12 @@ struct GPIOE
     using IDR2 = GPIOE_IDR_IDR2_Values<GPIOE::IDR, 2, 1, ReadMode, GPIOEIDRBase> ;
     using IDR1 = GPIOE_IDR_IDR1_Values<GPIOE::IDR, 1, 1, ReadMode, GPIOEIDRBase> ;
     using IDR0 = GPIOE_IDR_IDR0_Values<GPIOE::IDR, 0, 1, ReadMode, GPIOEIDRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using IDRArray = FieldArray<0U, IDR0, IDR1, IDR2, IDR3, IDR4, IDR5, IDR6, IDR7, IDR8, IDR9, IDR10, IDR11, IDR12, IDR13, IDR14, IDR15> ;
+    template<std::size_t index>
+    using Field = typename IDRArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_IDR_IDR0_Values<GPIOE::IDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -167,6 +204,14 @@ struct GPIOE
     using ODR2 = GPIOE_ODR_ODR2_Values<GPIOE::ODR, 2, 1, ReadWriteMode, GPIOEODRBase> ;
     using ODR1 = GPIOE_ODR_ODR1_Values<GPIOE::ODR, 1, 1, ReadWriteMode, GPIOEODRBase> ;
     using ODR0 = GPIOE_ODR_ODR0_Values<GPIOE::ODR, 0, 1, ReadWriteMode, GPIOEODRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    using SetResetRegister = GPIOE::BSRR ;
+    static constexpr std::size_t SetResetShift = 16U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using ODRArray = FieldArray<0U, ODR0, ODR1, ODR2, ODR3, ODR4, ODR5, ODR6, ODR7, ODR8, ODR9, ODR10, ODR11, ODR12, ODR13, ODR14, ODR15> ;
+    template<std::size_t index>
+    using Field = typename ODRArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_ODR_ODR0_Values<GPIOE::ODR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -209,6 +254,11 @@ struct GPIOE
     using BS2 = GPIOE_BSRR_BS2_Values<GPIOE::BSRR, 2, 1, WriteMode, GPIOEBSRRBase> ;
     using BS1 = GPIOE_BSRR_BS1_Values<GPIOE::BSRR, 1, 1, WriteMode, GPIOEBSRRBase> ;
     using BS0 = GPIOE_BSRR_BS0_Values<GPIOE::BSRR, 0, 1, WriteMode, GPIOEBSRRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using BRArray = FieldArray<0U, BR0, BR1, BR2, BR3, BR4, BR5, BR6, BR7, BR8, BR9, BR10, BR11, BR12, BR13, BR14, BR15> ;
+    using BSArray = FieldArray<0U, BS0, BS1, BS2, BS3, BS4, BS5, BS6, BS7, BS8, BS9, BS10, BS11, BS12, BS13, BS14, BS15> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_BSRR_BS0_Values<GPIOE::BSRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +286,12 @@ struct GPIOE
     using LCK2 = GPIOE_LCKR_LCK2_Values<GPIOE::LCKR, 2, 1, ReadWriteMode, GPIOELCKRBase> ;
     using LCK1 = GPIOE_LCKR_LCK1_Values<GPIOE::LCKR, 1, 1, ReadWriteMode, GPIOELCKRBase> ;
     using LCK0 = GPIOE_LCKR_LCK0_Values<GPIOE::LCKR, 0, 1, ReadWriteMode, GPIOELCKRBase> ;
+    static constexpr Type WritableMask = 0x1FFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using LCKArray = FieldArray<0U, LCK0, LCK1, LCK2, LCK3, LCK4, LCK5, LCK6, LCK7, LCK8, LCK9, LCK10, LCK11, LCK12, LCK13, LCK14, LCK15> ;
+    template<std::size_t index>
+    using Field = typename LCKArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_LCKR_LCK0_Values<GPIOE::LCKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -254,6 +310,12 @@ struct GPIOE
     using AFRL2 = GPIOE_AFRL_AFRL2_Values<GPIOE::AFRL, 8, 4, ReadWriteMode, GPIOEAFRLBase> ;
     using AFRL1 = GPIOE_AFRL_AFRL1_Values<GPIOE::AFRL, 4, 4, ReadWriteMode, GPIOEAFRLBase> ;
     using AFRL0 = GPIOE_AFRL_AFRL0_Values<GPIOE::AFRL, 0, 4, ReadWriteMode, GPIOEAFRLBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using AFRLArray = FieldArray<0U, AFRL0, AFRL1, AFRL2, AFRL3, AFRL4, AFRL5, AFRL6, AFRL7> ;
+    template<std::size_t index>
+    using Field = typename AFRLArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_AFRL_AFRL0_Values<GPIOE::AFRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -272,12 +334,19 @@ struct GPIOE
     using AFRH10 = GPIOE_AFRH_AFRH10_Values<GPIOE::AFRH, 8, 4, ReadWriteMode, GPIOEAFRHBase> ;
     using AFRH9 = GPIOE_AFRH_AFRH9_Values<GPIOE::AFRH, 4, 4, ReadWriteMode, GPIOEAFRHBase> ;
     using AFRH8 = GPIOE_AFRH_AFRH8_Values<GPIOE::AFRH, 0, 4, ReadWriteMode, GPIOEAFRHBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using AFRHArray = FieldArray<8U, AFRH8, AFRH9, AFRH10, AFRH11, AFRH12, AFRH13, AFRH14, AFRH15> ;
+    template<std::size_t index>
+    using Field = typename AFRHArray::template Field<index> ;
+    using Peripheral = GPIOE ;
     using FieldValues = GPIOE_AFRH_AFRH8_Values<GPIOE::AFRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFRHPack  = Register<0x40021024, 32, ReadWriteMode, GPIOEAFRHBase, T...> ;
 
+  using Registers = TypesList<GPIOE::MODER, GPIOE::OTYPER, GPIOE::OSPEEDR, GPIOE::PUPDR, GPIOE::IDR, GPIOE::ODR, GPIOE::BSRR, GPIOE::LCKR, GPIOE::AFRL, GPIOE::AFRH> ;
 } ;
 
 #endif //#if !defined(GPIOEREGISTERS_HPP)
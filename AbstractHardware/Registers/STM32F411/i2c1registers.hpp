@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct I2C1
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40005400U ;
+
   struct I2C1CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40005400, 32, ReadWriteMode>
@@ -35,6 +40,12 @@ struct I2C1
     using SMBTYPE = I2C1_CR1_SMBTYPE_Values<I2C1::CR1, 3, 1, ReadWriteMode, I2C1CR1Base> ;
     using SMBUS = I2C1_CR1_SMBUS_Values<I2C1::CR1, 1, 1, ReadWriteMode, I2C1CR1Base> ;
     using PE = I2C1_CR1_PE_Values<I2C1::CR1, 0, 1, ReadWriteMode, I2C1CR1Base> ;
+    static constexpr Type VolatileMask = 0x300U ;
+    static constexpr Type WritableMask = 0xBFFBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBCFAU ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_CR1_PE_Values<I2C1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +62,9 @@ struct I2C1
     using ITEVTEN = I2C1_CR2_ITEVTEN_Values<I2C1::CR2, 9, 1, ReadWriteMode, I2C1CR2Base> ;
     using ITERREN = I2C1_CR2_ITERREN_Values<I2C1::CR2, 8, 1, ReadWriteMode, I2C1CR2Base> ;
     using FREQ = I2C1_CR2_FREQ_Values<I2C1::CR2, 0, 6, ReadWriteMode, I2C1CR2Base> ;
+    static constexpr Type WritableMask = 0x1F3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_CR2_FREQ_Values<I2C1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +79,9 @@ struct I2C1
     using ADD10 = I2C1_OAR1_ADD10_Values<I2C1::OAR1, 8, 2, ReadWriteMode, I2C1OAR1Base> ;
     using ADD7 = I2C1_OAR1_ADD7_Values<I2C1::OAR1, 1, 7, ReadWriteMode, I2C1OAR1Base> ;
     using ADD0 = I2C1_OAR1_ADD0_Values<I2C1::OAR1, 0, 1, ReadWriteMode, I2C1OAR1Base> ;
+    static constexpr Type WritableMask = 0x83FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_OAR1_ADD0_Values<I2C1::OAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +94,9 @@ struct I2C1
   {
     using ADD2 = I2C1_OAR2_ADD2_Values<I2C1::OAR2, 1, 7, ReadWriteMode, I2C1OAR2Base> ;
     using ENDUAL = I2C1_OAR2_ENDUAL_Values<I2C1::OAR2, 0, 1, ReadWriteMode, I2C1OAR2Base> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_OAR2_ENDUAL_Values<I2C1::OAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +108,11 @@ struct I2C1
   struct DR : public RegisterBase<0x40005410, 32, ReadWriteMode>
   {
     using DRField = I2C1_DR_DR_Values<I2C1::DR, 0, 8, ReadWriteMode, I2C1DRBase> ;
+    static constexpr Type VolatileMask = 0xFFU ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_DR_DR_Values<I2C1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +137,12 @@ struct I2C1
     using BTF = I2C1_SR1_BTF_Values<I2C1::SR1, 2, 1, ReadMode, I2C1SR1Base> ;
     using ADDR = I2C1_SR1_ADDR_Values<I2C1::SR1, 1, 1, ReadMode, I2C1SR1Base> ;
     using SB = I2C1_SR1_SB_Values<I2C1::SR1, 0, 1, ReadMode, I2C1SR1Base> ;
+    static constexpr Type VolatileMask = 0xDFU ;
+    static constexpr Type WritableMask = 0xDF00U ;
+    static constexpr Type ZeroToClearMask = 0xDF00U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_SR1_SB_Values<I2C1::SR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +161,9 @@ struct I2C1
     using TRA = I2C1_SR2_TRA_Values<I2C1::SR2, 2, 1, ReadMode, I2C1SR2Base> ;
     using BUSY = I2C1_SR2_BUSY_Values<I2C1::SR2, 1, 1, ReadMode, I2C1SR2Base> ;
     using MSL = I2C1_SR2_MSL_Values<I2C1::SR2, 0, 1, ReadMode, I2C1SR2Base> ;
+    static constexpr Type VolatileMask = 0xFFF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_SR2_MSL_Values<I2C1::SR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +177,9 @@ struct I2C1
     using F_S = I2C1_CCR_F_S_Values<I2C1::CCR, 15, 1, ReadWriteMode, I2C1CCRBase> ;
     using DUTY = I2C1_CCR_DUTY_Values<I2C1::CCR, 14, 1, ReadWriteMode, I2C1CCRBase> ;
     using CCRField = I2C1_CCR_CCR_Values<I2C1::CCR, 0, 12, ReadWriteMode, I2C1CCRBase> ;
+    static constexpr Type WritableMask = 0xCFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_CCR_CCR_Values<I2C1::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,12 +191,16 @@ struct I2C1
   struct TRISE : public RegisterBase<0x40005420, 32, ReadWriteMode>
   {
     using TRISEField = I2C1_TRISE_TRISE_Values<I2C1::TRISE, 0, 6, ReadWriteMode, I2C1TRISEBase> ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ResetValue = 0x2U ;
+    using Peripheral = I2C1 ;
     using FieldValues = I2C1_TRISE_TRISE_Values<I2C1::TRISE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TRISEPack  = Register<0x40005420, 32, ReadWriteMode, I2C1TRISEBase, T...> ;
 
+  using Registers = TypesList<I2C1::CR1, I2C1::CR2, I2C1::OAR1, I2C1::OAR2, I2C1::DR, I2C1::SR1, I2C1::SR2, I2C1::CCR, I2C1::TRISE> ;
 } ;
 
 #endif //#if !defined(I2C1REGISTERS_HPP)
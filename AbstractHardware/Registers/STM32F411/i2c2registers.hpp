@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct I2C2
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40005800U ;
+
   struct I2C2CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40005800, 32, ReadWriteMode>
@@ -35,6 +40,12 @@ struct I2C2
     using SMBTYPE = I2C2_CR1_SMBTYPE_Values<I2C2::CR1, 3, 1, ReadWriteMode, I2C2CR1Base> ;
     using SMBUS = I2C2_CR1_SMBUS_Values<I2C2::CR1, 1, 1, ReadWriteMode, I2C2CR1Base> ;
     using PE = I2C2_CR1_PE_Values<I2C2::CR1, 0, 1, ReadWriteMode, I2C2CR1Base> ;
+    static constexpr Type VolatileMask = 0x300U ;
+    static constexpr Type WritableMask = 0xBFFBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBCFAU ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_CR1_PE_Values<I2C2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +62,9 @@ struct I2C2
     using ITEVTEN = I2C2_CR2_ITEVTEN_Values<I2C2::CR2, 9, 1, ReadWriteMode, I2C2CR2Base> ;
     using ITERREN = I2C2_CR2_ITERREN_Values<I2C2::CR2, 8, 1, ReadWriteMode, I2C2CR2Base> ;
     using FREQ = I2C2_CR2_FREQ_Values<I2C2::CR2, 0, 6, ReadWriteMode, I2C2CR2Base> ;
+    static constexpr Type WritableMask = 0x1F3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_CR2_FREQ_Values<I2C2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,6 +79,9 @@ struct I2C2
     using ADD10 = I2C2_OAR1_ADD10_Values<I2C2::OAR1, 8, 2, ReadWriteMode, I2C2OAR1Base> ;
     using ADD7 = I2C2_OAR1_ADD7_Values<I2C2::OAR1, 1, 7, ReadWriteMode, I2C2OAR1Base> ;
     using ADD0 = I2C2_OAR1_ADD0_Values<I2C2::OAR1, 0, 1, ReadWriteMode, I2C2OAR1Base> ;
+    static constexpr Type WritableMask = 0x83FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_OAR1_ADD0_Values<I2C2::OAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +94,9 @@ struct I2C2
   {
     using ADD2 = I2C2_OAR2_ADD2_Values<I2C2::OAR2, 1, 7, ReadWriteMode, I2C2OAR2Base> ;
     using ENDUAL = I2C2_OAR2_ENDUAL_Values<I2C2::OAR2, 0, 1, ReadWriteMode, I2C2OAR2Base> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_OAR2_ENDUAL_Values<I2C2::OAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +108,11 @@ struct I2C2
   struct DR : public RegisterBase<0x40005810, 32, ReadWriteMode>
   {
     using DRField = I2C2_DR_DR_Values<I2C2::DR, 0, 8, ReadWriteMode, I2C2DRBase> ;
+    static constexpr Type VolatileMask = 0xFFU ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_DR_DR_Values<I2C2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +137,12 @@ struct I2C2
     using BTF = I2C2_SR1_BTF_Values<I2C2::SR1, 2, 1, ReadMode, I2C2SR1Base> ;
     using ADDR = I2C2_SR1_ADDR_Values<I2C2::SR1, 1, 1, ReadMode, I2C2SR1Base> ;
     using SB = I2C2_SR1_SB_Values<I2C2::SR1, 0, 1, ReadMode, I2C2SR1Base> ;
+    static constexpr Type VolatileMask = 0xDFU ;
+    static constexpr Type WritableMask = 0xDF00U ;
+    static constexpr Type ZeroToClearMask = 0xDF00U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_SR1_SB_Values<I2C2::SR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +161,9 @@ struct I2C2
     using TRA = I2C2_SR2_TRA_Values<I2C2::SR2, 2, 1, ReadMode, I2C2SR2Base> ;
     using BUSY = I2C2_SR2_BUSY_Values<I2C2::SR2, 1, 1, ReadMode, I2C2SR2Base> ;
     using MSL = I2C2_SR2_MSL_Values<I2C2::SR2, 0, 1, ReadMode, I2C2SR2Base> ;
+    static constexpr Type VolatileMask = 0xFFF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_SR2_MSL_Values<I2C2::SR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +177,9 @@ struct I2C2
     using F_S = I2C2_CCR_F_S_Values<I2C2::CCR, 15, 1, ReadWriteMode, I2C2CCRBase> ;
     using DUTY = I2C2_CCR_DUTY_Values<I2C2::CCR, 14, 1, ReadWriteMode, I2C2CCRBase> ;
     using CCRField = I2C2_CCR_CCR_Values<I2C2::CCR, 0, 12, ReadWriteMode, I2C2CCRBase> ;
+    static constexpr Type WritableMask = 0xCFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_CCR_CCR_Values<I2C2::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,12 +191,16 @@ struct I2C2
   struct TRISE : public RegisterBase<0x40005820, 32, ReadWriteMode>
   {
     using TRISEField = I2C2_TRISE_TRISE_Values<I2C2::TRISE, 0, 6, ReadWriteMode, I2C2TRISEBase> ;
+    static constexpr Type WritableMask = 0x3FU ;
+    static constexpr Type ResetValue = 0x2U ;
+    using Peripheral = I2C2 ;
     using FieldValues = I2C2_TRISE_TRISE_Values<I2C2::TRISE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TRISEPack  = Register<0x40005820, 32, ReadWriteMode, I2C2TRISEBase, T...> ;
 
+  using Registers = TypesList<I2C2::CR1, I2C2::CR2, I2C2::OAR1, I2C2::OAR2, I2C2::DR, I2C2::SR1, I2C2::SR2, I2C2::CCR, I2C2::TRISE> ;
 } ;
 
 #endif //#if !defined(I2C2REGISTERS_HPP)
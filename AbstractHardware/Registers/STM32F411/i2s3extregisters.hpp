@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct I2S3ext
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40004000U ;
+
   struct I2S3extCR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40004000, 32, ReadWriteMode>
@@ -35,6 +40,11 @@ struct I2S3ext
     using MSTR = I2S3ext_CR1_MSTR_Values<I2S3ext::CR1, 2, 1, ReadWriteMode, I2S3extCR1Base> ;
     using CPOL = I2S3ext_CR1_CPOL_Values<I2S3ext::CR1, 1, 1, ReadWriteMode, I2S3extCR1Base> ;
     using CPHA = I2S3ext_CR1_CPHA_Values<I2S3ext::CR1, 0, 1, ReadWriteMode, I2S3extCR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_CR1_CPHA_Values<I2S3ext::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +62,9 @@ struct I2S3ext
     using SSOE = I2S3ext_CR2_SSOE_Values<I2S3ext::CR2, 2, 1, ReadWriteMode, I2S3extCR2Base> ;
     using TXDMAEN = I2S3ext_CR2_TXDMAEN_Values<I2S3ext::CR2, 1, 1, ReadWriteMode, I2S3extCR2Base> ;
     using RXDMAEN = I2S3ext_CR2_RXDMAEN_Values<I2S3ext::CR2, 0, 1, ReadWriteMode, I2S3extCR2Base> ;
+    static constexpr Type WritableMask = 0xF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_CR2_RXDMAEN_Values<I2S3ext::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +84,12 @@ struct I2S3ext
     using CHSIDE = I2S3ext_SR_CHSIDE_Values<I2S3ext::SR, 2, 1, ReadMode, I2S3extSRBase> ;
     using TXE = I2S3ext_SR_TXE_Values<I2S3ext::SR, 1, 1, ReadMode, I2S3extSRBase> ;
     using RXNE = I2S3ext_SR_RXNE_Values<I2S3ext::SR, 0, 1, ReadMode, I2S3extSRBase> ;
+    static constexpr Type VolatileMask = 0x1FFU ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type ResetValue = 0x2U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_SR_RXNE_Values<I2S3ext::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +101,11 @@ struct I2S3ext
   struct DR : public RegisterBase<0x4000400C, 32, ReadWriteMode>
   {
     using DRField = I2S3ext_DR_DR_Values<I2S3ext::DR, 0, 16, ReadWriteMode, I2S3extDRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_DR_DR_Values<I2S3ext::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +117,9 @@ struct I2S3ext
   struct CRCPR : public RegisterBase<0x40004010, 32, ReadWriteMode>
   {
     using CRCPOLY = I2S3ext_CRCPR_CRCPOLY_Values<I2S3ext::CRCPR, 0, 16, ReadWriteMode, I2S3extCRCPRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x7U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_CRCPR_CRCPOLY_Values<I2S3ext::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +131,9 @@ struct I2S3ext
   struct RXCRCR : public RegisterBase<0x40004014, 32, ReadMode>
   {
     using RxCRC = I2S3ext_RXCRCR_RxCRC_Values<I2S3ext::RXCRCR, 0, 16, ReadMode, I2S3extRXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_RXCRCR_RxCRC_Values<I2S3ext::RXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +145,9 @@ struct I2S3ext
   struct TXCRCR : public RegisterBase<0x40004018, 32, ReadMode>
   {
     using TxCRC = I2S3ext_TXCRCR_TxCRC_Values<I2S3ext::TXCRCR, 0, 16, ReadMode, I2S3extTXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_TXCRCR_TxCRC_Values<I2S3ext::TXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +166,11 @@ struct I2S3ext
     using CKPOL = I2S3ext_I2SCFGR_CKPOL_Values<I2S3ext::I2SCFGR, 3, 1, ReadWriteMode, I2S3extI2SCFGRBase> ;
     using DATLEN = I2S3ext_I2SCFGR_DATLEN_Values<I2S3ext::I2SCFGR, 1, 2, ReadWriteMode, I2S3extI2SCFGRBase> ;
     using CHLEN = I2S3ext_I2SCFGR_CHLEN_Values<I2S3ext::I2SCFGR, 0, 1, ReadWriteMode, I2S3extI2SCFGRBase> ;
+    static constexpr Type WritableMask = 0xFBFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_I2SCFGR_CHLEN_Values<I2S3ext::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +184,16 @@ struct I2S3ext
     using MCKOE = I2S3ext_I2SPR_MCKOE_Values<I2S3ext::I2SPR, 9, 1, ReadWriteMode, I2S3extI2SPRBase> ;
     using ODD = I2S3ext_I2SPR_ODD_Values<I2S3ext::I2SPR, 8, 1, ReadWriteMode, I2S3extI2SPRBase> ;
     using I2SDIV = I2S3ext_I2SPR_I2SDIV_Values<I2S3ext::I2SPR, 0, 8, ReadWriteMode, I2S3extI2SPRBase> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0xAU ;
+    using Peripheral = I2S3ext ;
     using FieldValues = I2S3ext_I2SPR_I2SDIV_Values<I2S3ext::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40004020, 32, ReadWriteMode, I2S3extI2SPRBase, T...> ;
 
+  using Registers = TypesList<I2S3ext::CR1, I2S3ext::CR2, I2S3ext::SR, I2S3ext::DR, I2S3ext::CRCPR, I2S3ext::RXCRCR, I2S3ext::TXCRCR, I2S3ext::I2SCFGR, I2S3ext::I2SPR> ;
 } ;
 
 #endif //#if !defined(I2S3EXTREGISTERS_HPP)
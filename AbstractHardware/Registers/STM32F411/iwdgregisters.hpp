@@ -14,14 +14,22 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct IWDG
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40003000U ;
+
   struct IWDGKRBase {} ;
 
   struct KR : public RegisterBase<0x40003000, 32, WriteMode>
   {
     using KEY = IWDG_KR_KEY_Values<IWDG::KR, 0, 16, WriteMode, IWDGKRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = IWDG ;
     using FieldValues = IWDG_KR_KEY_Values<IWDG::KR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +41,11 @@ struct IWDG
   struct PR : public RegisterBase<0x40003004, 32, ReadWriteMode>
   {
     using PRField = IWDG_PR_PR_Values<IWDG::PR, 0, 3, ReadWriteMode, IWDGPRBase> ;
+    static constexpr Type VolatileMask = 0x7U ;
+    static constexpr Type WritableMask = 0x7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = IWDG ;
     using FieldValues = IWDG_PR_PR_Values<IWDG::PR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +57,9 @@ struct IWDG
   struct RLR : public RegisterBase<0x40003008, 32, ReadWriteMode>
   {
     using RL = IWDG_RLR_RL_Values<IWDG::RLR, 0, 12, ReadWriteMode, IWDGRLRBase> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0xFFFU ;
+    using Peripheral = IWDG ;
     using FieldValues = IWDG_RLR_RL_Values<IWDG::RLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -56,12 +72,16 @@ struct IWDG
   {
     using RVU = IWDG_SR_RVU_Values<IWDG::SR, 1, 1, ReadMode, IWDGSRBase> ;
     using PVU = IWDG_SR_PVU_Values<IWDG::SR, 0, 1, ReadMode, IWDGSRBase> ;
+    static constexpr Type VolatileMask = 0x3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = IWDG ;
     using FieldValues = IWDG_SR_PVU_Values<IWDG::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SRPack  = Register<0x4000300C, 32, ReadMode, IWDGSRBase, T...> ;
 
+  using Registers = TypesList<IWDG::KR, IWDG::PR, IWDG::RLR, IWDG::SR> ;
 } ;
 
 #endif //#if !defined(IWDGREGISTERS_HPP)
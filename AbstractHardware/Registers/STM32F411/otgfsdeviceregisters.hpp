@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct OTG_FS_DEVICE
 {
+  using Bus = Ahb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x50000800U ;
+
   struct OTG_FS_DEVICEFS_DCFGBase {} ;
 
   struct FS_DCFG : public RegisterBase<0x50000800, 32, ReadWriteMode>
@@ -25,6 +30,9 @@ struct OTG_FS_DEVICE
     using NZLSOHSK = OTG_FS_DEVICE_FS_DCFG_NZLSOHSK_Values<OTG_FS_DEVICE::FS_DCFG, 2, 1, ReadWriteMode, OTG_FS_DEVICEFS_DCFGBase> ;
     using DAD = OTG_FS_DEVICE_FS_DCFG_DAD_Values<OTG_FS_DEVICE::FS_DCFG, 4, 7, ReadWriteMode, OTG_FS_DEVICEFS_DCFGBase> ;
     using PFIVL = OTG_FS_DEVICE_FS_DCFG_PFIVL_Values<OTG_FS_DEVICE::FS_DCFG, 11, 2, ReadWriteMode, OTG_FS_DEVICEFS_DCFGBase> ;
+    static constexpr Type WritableMask = 0x1FF7U ;
+    static constexpr Type ResetValue = 0x2200000U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DCFG_PFIVL_Values<OTG_FS_DEVICE::FS_DCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -45,6 +53,10 @@ struct OTG_FS_DEVICE
     using SGONAK = OTG_FS_DEVICE_FS_DCTL_SGONAK_Values<OTG_FS_DEVICE::FS_DCTL, 9, 1, ReadWriteMode, OTG_FS_DEVICEFS_DCTLBase> ;
     using CGONAK = OTG_FS_DEVICE_FS_DCTL_CGONAK_Values<OTG_FS_DEVICE::FS_DCTL, 10, 1, ReadWriteMode, OTG_FS_DEVICEFS_DCTLBase> ;
     using POPRGDNE = OTG_FS_DEVICE_FS_DCTL_POPRGDNE_Values<OTG_FS_DEVICE::FS_DCTL, 11, 1, ReadWriteMode, OTG_FS_DEVICEFS_DCTLBase> ;
+    static constexpr Type VolatileMask = 0xCU ;
+    static constexpr Type WritableMask = 0xFF3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DCTL_POPRGDNE_Values<OTG_FS_DEVICE::FS_DCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +71,9 @@ struct OTG_FS_DEVICE
     using ENUMSPD = OTG_FS_DEVICE_FS_DSTS_ENUMSPD_Values<OTG_FS_DEVICE::FS_DSTS, 1, 2, ReadMode, OTG_FS_DEVICEFS_DSTSBase> ;
     using EERR = OTG_FS_DEVICE_FS_DSTS_EERR_Values<OTG_FS_DEVICE::FS_DSTS, 3, 1, ReadMode, OTG_FS_DEVICEFS_DSTSBase> ;
     using FNSOF = OTG_FS_DEVICE_FS_DSTS_FNSOF_Values<OTG_FS_DEVICE::FS_DSTS, 8, 14, ReadMode, OTG_FS_DEVICEFS_DSTSBase> ;
+    static constexpr Type VolatileMask = 0x3FFF0FU ;
+    static constexpr Type ResetValue = 0x10U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DSTS_FNSOF_Values<OTG_FS_DEVICE::FS_DSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +90,9 @@ struct OTG_FS_DEVICE
     using ITTXFEMSK = OTG_FS_DEVICE_FS_DIEPMSK_ITTXFEMSK_Values<OTG_FS_DEVICE::FS_DIEPMSK, 4, 1, ReadWriteMode, OTG_FS_DEVICEFS_DIEPMSKBase> ;
     using INEPNMM = OTG_FS_DEVICE_FS_DIEPMSK_INEPNMM_Values<OTG_FS_DEVICE::FS_DIEPMSK, 5, 1, ReadWriteMode, OTG_FS_DEVICEFS_DIEPMSKBase> ;
     using INEPNEM = OTG_FS_DEVICE_FS_DIEPMSK_INEPNEM_Values<OTG_FS_DEVICE::FS_DIEPMSK, 6, 1, ReadWriteMode, OTG_FS_DEVICEFS_DIEPMSKBase> ;
+    static constexpr Type WritableMask = 0x7BU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DIEPMSK_INEPNEM_Values<OTG_FS_DEVICE::FS_DIEPMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +107,9 @@ struct OTG_FS_DEVICE
     using EPDM = OTG_FS_DEVICE_FS_DOEPMSK_EPDM_Values<OTG_FS_DEVICE::FS_DOEPMSK, 1, 1, ReadWriteMode, OTG_FS_DEVICEFS_DOEPMSKBase> ;
     using STUPM = OTG_FS_DEVICE_FS_DOEPMSK_STUPM_Values<OTG_FS_DEVICE::FS_DOEPMSK, 3, 1, ReadWriteMode, OTG_FS_DEVICEFS_DOEPMSKBase> ;
     using OTEPDM = OTG_FS_DEVICE_FS_DOEPMSK_OTEPDM_Values<OTG_FS_DEVICE::FS_DOEPMSK, 4, 1, ReadWriteMode, OTG_FS_DEVICEFS_DOEPMSKBase> ;
+    static constexpr Type WritableMask = 0x1BU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DOEPMSK_OTEPDM_Values<OTG_FS_DEVICE::FS_DOEPMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +122,9 @@ struct OTG_FS_DEVICE
   {
     using IEPINT = OTG_FS_DEVICE_FS_DAINT_IEPINT_Values<OTG_FS_DEVICE::FS_DAINT, 0, 16, ReadMode, OTG_FS_DEVICEFS_DAINTBase> ;
     using OEPINT = OTG_FS_DEVICE_FS_DAINT_OEPINT_Values<OTG_FS_DEVICE::FS_DAINT, 16, 16, ReadMode, OTG_FS_DEVICEFS_DAINTBase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DAINT_OEPINT_Values<OTG_FS_DEVICE::FS_DAINT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +137,9 @@ struct OTG_FS_DEVICE
   {
     using IEPM = OTG_FS_DEVICE_FS_DAINTMSK_IEPM_Values<OTG_FS_DEVICE::FS_DAINTMSK, 0, 16, ReadWriteMode, OTG_FS_DEVICEFS_DAINTMSKBase> ;
     using OEPINT = OTG_FS_DEVICE_FS_DAINTMSK_OEPINT_Values<OTG_FS_DEVICE::FS_DAINTMSK, 16, 16, ReadWriteMode, OTG_FS_DEVICEFS_DAINTMSKBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DAINTMSK_OEPINT_Values<OTG_FS_DEVICE::FS_DAINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +151,9 @@ struct OTG_FS_DEVICE
   struct DVBUSDIS : public RegisterBase<0x50000828, 32, ReadWriteMode>
   {
     using VBUSDT = OTG_FS_DEVICE_DVBUSDIS_VBUSDT_Values<OTG_FS_DEVICE::DVBUSDIS, 0, 16, ReadWriteMode, OTG_FS_DEVICEDVBUSDISBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x17D7U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DVBUSDIS_VBUSDT_Values<OTG_FS_DEVICE::DVBUSDIS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +165,9 @@ struct OTG_FS_DEVICE
   struct DVBUSPULSE : public RegisterBase<0x5000082C, 32, ReadWriteMode>
   {
     using DVBUSP = OTG_FS_DEVICE_DVBUSPULSE_DVBUSP_Values<OTG_FS_DEVICE::DVBUSPULSE, 0, 12, ReadWriteMode, OTG_FS_DEVICEDVBUSPULSEBase> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x5B8U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DVBUSPULSE_DVBUSP_Values<OTG_FS_DEVICE::DVBUSPULSE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +179,9 @@ struct OTG_FS_DEVICE
   struct DIEPEMPMSK : public RegisterBase<0x50000834, 32, ReadWriteMode>
   {
     using INEPTXFEM = OTG_FS_DEVICE_DIEPEMPMSK_INEPTXFEM_Values<OTG_FS_DEVICE::DIEPEMPMSK, 0, 16, ReadWriteMode, OTG_FS_DEVICEDIEPEMPMSKBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPEMPMSK_INEPTXFEM_Values<OTG_FS_DEVICE::DIEPEMPMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +202,10 @@ struct OTG_FS_DEVICE
     using SNAK = OTG_FS_DEVICE_FS_DIEPCTL0_SNAK_Values<OTG_FS_DEVICE::FS_DIEPCTL0, 27, 1, WriteMode, OTG_FS_DEVICEFS_DIEPCTL0Base> ;
     using EPDIS = OTG_FS_DEVICE_FS_DIEPCTL0_EPDIS_Values<OTG_FS_DEVICE::FS_DIEPCTL0, 30, 1, ReadMode, OTG_FS_DEVICEFS_DIEPCTL0Base> ;
     using EPENA = OTG_FS_DEVICE_FS_DIEPCTL0_EPENA_Values<OTG_FS_DEVICE::FS_DIEPCTL0, 31, 1, ReadMode, OTG_FS_DEVICEFS_DIEPCTL0Base> ;
+    static constexpr Type VolatileMask = 0xC00E8000U ;
+    static constexpr Type WritableMask = 0xFE00003U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_FS_DIEPCTL0_EPENA_Values<OTG_FS_DEVICE::FS_DIEPCTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +229,10 @@ struct OTG_FS_DEVICE
     using EONUM_DPID = OTG_FS_DEVICE_DIEPCTL1_EONUM_DPID_Values<OTG_FS_DEVICE::DIEPCTL1, 16, 1, ReadMode, OTG_FS_DEVICEDIEPCTL1Base> ;
     using USBAEP = OTG_FS_DEVICE_DIEPCTL1_USBAEP_Values<OTG_FS_DEVICE::DIEPCTL1, 15, 1, ReadWriteMode, OTG_FS_DEVICEDIEPCTL1Base> ;
     using MPSIZ = OTG_FS_DEVICE_DIEPCTL1_MPSIZ_Values<OTG_FS_DEVICE::DIEPCTL1, 0, 11, ReadWriteMode, OTG_FS_DEVICEDIEPCTL1Base> ;
+    static constexpr Type VolatileMask = 0x30000U ;
+    static constexpr Type WritableMask = 0xFFEC87FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPCTL1_MPSIZ_Values<OTG_FS_DEVICE::DIEPCTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -212,6 +256,10 @@ struct OTG_FS_DEVICE
     using EONUM_DPID = OTG_FS_DEVICE_DIEPCTL2_EONUM_DPID_Values<OTG_FS_DEVICE::DIEPCTL2, 16, 1, ReadMode, OTG_FS_DEVICEDIEPCTL2Base> ;
     using USBAEP = OTG_FS_DEVICE_DIEPCTL2_USBAEP_Values<OTG_FS_DEVICE::DIEPCTL2, 15, 1, ReadWriteMode, OTG_FS_DEVICEDIEPCTL2Base> ;
     using MPSIZ = OTG_FS_DEVICE_DIEPCTL2_MPSIZ_Values<OTG_FS_DEVICE::DIEPCTL2, 0, 11, ReadWriteMode, OTG_FS_DEVICEDIEPCTL2Base> ;
+    static constexpr Type VolatileMask = 0x30000U ;
+    static constexpr Type WritableMask = 0xFFEC87FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPCTL2_MPSIZ_Values<OTG_FS_DEVICE::DIEPCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -235,6 +283,10 @@ struct OTG_FS_DEVICE
     using EONUM_DPID = OTG_FS_DEVICE_DIEPCTL3_EONUM_DPID_Values<OTG_FS_DEVICE::DIEPCTL3, 16, 1, ReadMode, OTG_FS_DEVICEDIEPCTL3Base> ;
     using USBAEP = OTG_FS_DEVICE_DIEPCTL3_USBAEP_Values<OTG_FS_DEVICE::DIEPCTL3, 15, 1, ReadWriteMode, OTG_FS_DEVICEDIEPCTL3Base> ;
     using MPSIZ = OTG_FS_DEVICE_DIEPCTL3_MPSIZ_Values<OTG_FS_DEVICE::DIEPCTL3, 0, 11, ReadWriteMode, OTG_FS_DEVICEDIEPCTL3Base> ;
+    static constexpr Type VolatileMask = 0x30000U ;
+    static constexpr Type WritableMask = 0xFFEC87FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPCTL3_MPSIZ_Values<OTG_FS_DEVICE::DIEPCTL3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +307,10 @@ struct OTG_FS_DEVICE
     using NAKSTS = OTG_FS_DEVICE_DOEPCTL0_NAKSTS_Values<OTG_FS_DEVICE::DOEPCTL0, 17, 1, ReadMode, OTG_FS_DEVICEDOEPCTL0Base> ;
     using USBAEP = OTG_FS_DEVICE_DOEPCTL0_USBAEP_Values<OTG_FS_DEVICE::DOEPCTL0, 15, 1, ReadMode, OTG_FS_DEVICEDOEPCTL0Base> ;
     using MPSIZ = OTG_FS_DEVICE_DOEPCTL0_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL0, 0, 2, ReadMode, OTG_FS_DEVICEDOEPCTL0Base> ;
+    static constexpr Type VolatileMask = 0x400E8003U ;
+    static constexpr Type WritableMask = 0x8C300000U ;
+    static constexpr Type ResetValue = 0x8000U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPCTL0_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +334,10 @@ struct OTG_FS_DEVICE
     using EONUM_DPID = OTG_FS_DEVICE_DOEPCTL1_EONUM_DPID_Values<OTG_FS_DEVICE::DOEPCTL1, 16, 1, ReadMode, OTG_FS_DEVICEDOEPCTL1Base> ;
     using USBAEP = OTG_FS_DEVICE_DOEPCTL1_USBAEP_Values<OTG_FS_DEVICE::DOEPCTL1, 15, 1, ReadWriteMode, OTG_FS_DEVICEDOEPCTL1Base> ;
     using MPSIZ = OTG_FS_DEVICE_DOEPCTL1_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL1, 0, 11, ReadWriteMode, OTG_FS_DEVICEDOEPCTL1Base> ;
+    static constexpr Type VolatileMask = 0x30000U ;
+    static constexpr Type WritableMask = 0xFC3C87FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPCTL1_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -301,6 +361,10 @@ struct OTG_FS_DEVICE
     using EONUM_DPID = OTG_FS_DEVICE_DOEPCTL2_EONUM_DPID_Values<OTG_FS_DEVICE::DOEPCTL2, 16, 1, ReadMode, OTG_FS_DEVICEDOEPCTL2Base> ;
     using USBAEP = OTG_FS_DEVICE_DOEPCTL2_USBAEP_Values<OTG_FS_DEVICE::DOEPCTL2, 15, 1, ReadWriteMode, OTG_FS_DEVICEDOEPCTL2Base> ;
     using MPSIZ = OTG_FS_DEVICE_DOEPCTL2_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL2, 0, 11, ReadWriteMode, OTG_FS_DEVICEDOEPCTL2Base> ;
+    static constexpr Type VolatileMask = 0x30000U ;
+    static constexpr Type WritableMask = 0xFC3C87FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPCTL2_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -324,6 +388,10 @@ struct OTG_FS_DEVICE
     using EONUM_DPID = OTG_FS_DEVICE_DOEPCTL3_EONUM_DPID_Values<OTG_FS_DEVICE::DOEPCTL3, 16, 1, ReadMode, OTG_FS_DEVICEDOEPCTL3Base> ;
     using USBAEP = OTG_FS_DEVICE_DOEPCTL3_USBAEP_Values<OTG_FS_DEVICE::DOEPCTL3, 15, 1, ReadWriteMode, OTG_FS_DEVICEDOEPCTL3Base> ;
     using MPSIZ = OTG_FS_DEVICE_DOEPCTL3_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL3, 0, 11, ReadWriteMode, OTG_FS_DEVICEDOEPCTL3Base> ;
+    static constexpr Type VolatileMask = 0x30000U ;
+    static constexpr Type WritableMask = 0xFC3C87FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPCTL3_MPSIZ_Values<OTG_FS_DEVICE::DOEPCTL3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +408,10 @@ struct OTG_FS_DEVICE
     using TOC = OTG_FS_DEVICE_DIEPINT0_TOC_Values<OTG_FS_DEVICE::DIEPINT0, 3, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT0Base> ;
     using EPDISD = OTG_FS_DEVICE_DIEPINT0_EPDISD_Values<OTG_FS_DEVICE::DIEPINT0, 1, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT0Base> ;
     using XFRC = OTG_FS_DEVICE_DIEPINT0_XFRC_Values<OTG_FS_DEVICE::DIEPINT0, 0, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT0Base> ;
+    static constexpr Type VolatileMask = 0x80U ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPINT0_XFRC_Values<OTG_FS_DEVICE::DIEPINT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -356,6 +428,10 @@ struct OTG_FS_DEVICE
     using TOC = OTG_FS_DEVICE_DIEPINT1_TOC_Values<OTG_FS_DEVICE::DIEPINT1, 3, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT1Base> ;
     using EPDISD = OTG_FS_DEVICE_DIEPINT1_EPDISD_Values<OTG_FS_DEVICE::DIEPINT1, 1, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT1Base> ;
     using XFRC = OTG_FS_DEVICE_DIEPINT1_XFRC_Values<OTG_FS_DEVICE::DIEPINT1, 0, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT1Base> ;
+    static constexpr Type VolatileMask = 0x80U ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPINT1_XFRC_Values<OTG_FS_DEVICE::DIEPINT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -372,6 +448,10 @@ struct OTG_FS_DEVICE
     using TOC = OTG_FS_DEVICE_DIEPINT2_TOC_Values<OTG_FS_DEVICE::DIEPINT2, 3, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT2Base> ;
     using EPDISD = OTG_FS_DEVICE_DIEPINT2_EPDISD_Values<OTG_FS_DEVICE::DIEPINT2, 1, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT2Base> ;
     using XFRC = OTG_FS_DEVICE_DIEPINT2_XFRC_Values<OTG_FS_DEVICE::DIEPINT2, 0, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT2Base> ;
+    static constexpr Type VolatileMask = 0x80U ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPINT2_XFRC_Values<OTG_FS_DEVICE::DIEPINT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -388,6 +468,10 @@ struct OTG_FS_DEVICE
     using TOC = OTG_FS_DEVICE_DIEPINT3_TOC_Values<OTG_FS_DEVICE::DIEPINT3, 3, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT3Base> ;
     using EPDISD = OTG_FS_DEVICE_DIEPINT3_EPDISD_Values<OTG_FS_DEVICE::DIEPINT3, 1, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT3Base> ;
     using XFRC = OTG_FS_DEVICE_DIEPINT3_XFRC_Values<OTG_FS_DEVICE::DIEPINT3, 0, 1, ReadWriteMode, OTG_FS_DEVICEDIEPINT3Base> ;
+    static constexpr Type VolatileMask = 0x80U ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPINT3_XFRC_Values<OTG_FS_DEVICE::DIEPINT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -403,6 +487,9 @@ struct OTG_FS_DEVICE
     using STUP = OTG_FS_DEVICE_DOEPINT0_STUP_Values<OTG_FS_DEVICE::DOEPINT0, 3, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT0Base> ;
     using EPDISD = OTG_FS_DEVICE_DOEPINT0_EPDISD_Values<OTG_FS_DEVICE::DOEPINT0, 1, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT0Base> ;
     using XFRC = OTG_FS_DEVICE_DOEPINT0_XFRC_Values<OTG_FS_DEVICE::DOEPINT0, 0, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT0Base> ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPINT0_XFRC_Values<OTG_FS_DEVICE::DOEPINT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -418,6 +505,9 @@ struct OTG_FS_DEVICE
     using STUP = OTG_FS_DEVICE_DOEPINT1_STUP_Values<OTG_FS_DEVICE::DOEPINT1, 3, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT1Base> ;
     using EPDISD = OTG_FS_DEVICE_DOEPINT1_EPDISD_Values<OTG_FS_DEVICE::DOEPINT1, 1, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT1Base> ;
     using XFRC = OTG_FS_DEVICE_DOEPINT1_XFRC_Values<OTG_FS_DEVICE::DOEPINT1, 0, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT1Base> ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPINT1_XFRC_Values<OTG_FS_DEVICE::DOEPINT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -433,6 +523,9 @@ struct OTG_FS_DEVICE
     using STUP = OTG_FS_DEVICE_DOEPINT2_STUP_Values<OTG_FS_DEVICE::DOEPINT2, 3, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT2Base> ;
     using EPDISD = OTG_FS_DEVICE_DOEPINT2_EPDISD_Values<OTG_FS_DEVICE::DOEPINT2, 1, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT2Base> ;
     using XFRC = OTG_FS_DEVICE_DOEPINT2_XFRC_Values<OTG_FS_DEVICE::DOEPINT2, 0, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT2Base> ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPINT2_XFRC_Values<OTG_FS_DEVICE::DOEPINT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -448,6 +541,9 @@ struct OTG_FS_DEVICE
     using STUP = OTG_FS_DEVICE_DOEPINT3_STUP_Values<OTG_FS_DEVICE::DOEPINT3, 3, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT3Base> ;
     using EPDISD = OTG_FS_DEVICE_DOEPINT3_EPDISD_Values<OTG_FS_DEVICE::DOEPINT3, 1, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT3Base> ;
     using XFRC = OTG_FS_DEVICE_DOEPINT3_XFRC_Values<OTG_FS_DEVICE::DOEPINT3, 0, 1, ReadWriteMode, OTG_FS_DEVICEDOEPINT3Base> ;
+    static constexpr Type WritableMask = 0x5BU ;
+    static constexpr Type ResetValue = 0x80U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPINT3_XFRC_Values<OTG_FS_DEVICE::DOEPINT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -460,6 +556,9 @@ struct OTG_FS_DEVICE
   {
     using PKTCNT = OTG_FS_DEVICE_DIEPTSIZ0_PKTCNT_Values<OTG_FS_DEVICE::DIEPTSIZ0, 19, 2, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ0Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DIEPTSIZ0_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ0, 0, 7, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ0Base> ;
+    static constexpr Type WritableMask = 0x18007FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPTSIZ0_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -473,6 +572,9 @@ struct OTG_FS_DEVICE
     using STUPCNT = OTG_FS_DEVICE_DOEPTSIZ0_STUPCNT_Values<OTG_FS_DEVICE::DOEPTSIZ0, 29, 2, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ0Base> ;
     using PKTCNT = OTG_FS_DEVICE_DOEPTSIZ0_PKTCNT_Values<OTG_FS_DEVICE::DOEPTSIZ0, 19, 1, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ0Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DOEPTSIZ0_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ0, 0, 7, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ0Base> ;
+    static constexpr Type WritableMask = 0x6008007FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPTSIZ0_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -486,6 +588,9 @@ struct OTG_FS_DEVICE
     using MCNT = OTG_FS_DEVICE_DIEPTSIZ1_MCNT_Values<OTG_FS_DEVICE::DIEPTSIZ1, 29, 2, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ1Base> ;
     using PKTCNT = OTG_FS_DEVICE_DIEPTSIZ1_PKTCNT_Values<OTG_FS_DEVICE::DIEPTSIZ1, 19, 10, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ1Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DIEPTSIZ1_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ1, 0, 19, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ1Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPTSIZ1_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -499,6 +604,9 @@ struct OTG_FS_DEVICE
     using MCNT = OTG_FS_DEVICE_DIEPTSIZ2_MCNT_Values<OTG_FS_DEVICE::DIEPTSIZ2, 29, 2, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ2Base> ;
     using PKTCNT = OTG_FS_DEVICE_DIEPTSIZ2_PKTCNT_Values<OTG_FS_DEVICE::DIEPTSIZ2, 19, 10, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ2Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DIEPTSIZ2_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ2, 0, 19, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ2Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPTSIZ2_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -512,6 +620,9 @@ struct OTG_FS_DEVICE
     using MCNT = OTG_FS_DEVICE_DIEPTSIZ3_MCNT_Values<OTG_FS_DEVICE::DIEPTSIZ3, 29, 2, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ3Base> ;
     using PKTCNT = OTG_FS_DEVICE_DIEPTSIZ3_PKTCNT_Values<OTG_FS_DEVICE::DIEPTSIZ3, 19, 10, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ3Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DIEPTSIZ3_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ3, 0, 19, ReadWriteMode, OTG_FS_DEVICEDIEPTSIZ3Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DIEPTSIZ3_XFRSIZ_Values<OTG_FS_DEVICE::DIEPTSIZ3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -523,6 +634,9 @@ struct OTG_FS_DEVICE
   struct DTXFSTS0 : public RegisterBase<0x50000918, 32, ReadMode>
   {
     using INEPTFSAV = OTG_FS_DEVICE_DTXFSTS0_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS0, 0, 16, ReadMode, OTG_FS_DEVICEDTXFSTS0Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DTXFSTS0_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -534,6 +648,9 @@ struct OTG_FS_DEVICE
   struct DTXFSTS1 : public RegisterBase<0x50000938, 32, ReadMode>
   {
     using INEPTFSAV = OTG_FS_DEVICE_DTXFSTS1_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS1, 0, 16, ReadMode, OTG_FS_DEVICEDTXFSTS1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DTXFSTS1_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -545,6 +662,9 @@ struct OTG_FS_DEVICE
   struct DTXFSTS2 : public RegisterBase<0x50000958, 32, ReadMode>
   {
     using INEPTFSAV = OTG_FS_DEVICE_DTXFSTS2_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS2, 0, 16, ReadMode, OTG_FS_DEVICEDTXFSTS2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DTXFSTS2_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -556,6 +676,9 @@ struct OTG_FS_DEVICE
   struct DTXFSTS3 : public RegisterBase<0x50000978, 32, ReadMode>
   {
     using INEPTFSAV = OTG_FS_DEVICE_DTXFSTS3_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS3, 0, 16, ReadMode, OTG_FS_DEVICEDTXFSTS3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DTXFSTS3_INEPTFSAV_Values<OTG_FS_DEVICE::DTXFSTS3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -569,6 +692,9 @@ struct OTG_FS_DEVICE
     using RXDPID_STUPCNT = OTG_FS_DEVICE_DOEPTSIZ1_RXDPID_STUPCNT_Values<OTG_FS_DEVICE::DOEPTSIZ1, 29, 2, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ1Base> ;
     using PKTCNT = OTG_FS_DEVICE_DOEPTSIZ1_PKTCNT_Values<OTG_FS_DEVICE::DOEPTSIZ1, 19, 10, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ1Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DOEPTSIZ1_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ1, 0, 19, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ1Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPTSIZ1_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -582,6 +708,9 @@ struct OTG_FS_DEVICE
     using RXDPID_STUPCNT = OTG_FS_DEVICE_DOEPTSIZ2_RXDPID_STUPCNT_Values<OTG_FS_DEVICE::DOEPTSIZ2, 29, 2, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ2Base> ;
     using PKTCNT = OTG_FS_DEVICE_DOEPTSIZ2_PKTCNT_Values<OTG_FS_DEVICE::DOEPTSIZ2, 19, 10, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ2Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DOEPTSIZ2_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ2, 0, 19, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ2Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPTSIZ2_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -595,12 +724,25 @@ struct OTG_FS_DEVICE
     using RXDPID_STUPCNT = OTG_FS_DEVICE_DOEPTSIZ3_RXDPID_STUPCNT_Values<OTG_FS_DEVICE::DOEPTSIZ3, 29, 2, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ3Base> ;
     using PKTCNT = OTG_FS_DEVICE_DOEPTSIZ3_PKTCNT_Values<OTG_FS_DEVICE::DOEPTSIZ3, 19, 10, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ3Base> ;
     using XFRSIZ = OTG_FS_DEVICE_DOEPTSIZ3_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ3, 0, 19, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ3Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_DEVICE ;
     using FieldValues = OTG_FS_DEVICE_DOEPTSIZ3_XFRSIZ_Values<OTG_FS_DEVICE::DOEPTSIZ3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DOEPTSIZ3Pack  = Register<0x50000B70, 32, ReadWriteMode, OTG_FS_DEVICEDOEPTSIZ3Base, T...> ;
 
+  template<std::size_t index>
+  using DIEPINT = IndexedType<index, 0U, OTG_FS_DEVICE::DIEPINT0, OTG_FS_DEVICE::DIEPINT1, OTG_FS_DEVICE::DIEPINT2, OTG_FS_DEVICE::DIEPINT3> ;
+
+  template<std::size_t index>
+  using DOEPINT = IndexedType<index, 0U, OTG_FS_DEVICE::DOEPINT0, OTG_FS_DEVICE::DOEPINT1, OTG_FS_DEVICE::DOEPINT2, OTG_FS_DEVICE::DOEPINT3> ;
+
+  template<std::size_t index>
+  using DTXFSTS = IndexedType<index, 0U, OTG_FS_DEVICE::DTXFSTS0, OTG_FS_DEVICE::DTXFSTS1, OTG_FS_DEVICE::DTXFSTS2, OTG_FS_DEVICE::DTXFSTS3> ;
+
+  using Registers = TypesList<OTG_FS_DEVICE::FS_DCFG, OTG_FS_DEVICE::FS_DCTL, OTG_FS_DEVICE::FS_DSTS, OTG_FS_DEVICE::FS_DIEPMSK, OTG_FS_DEVICE::FS_DOEPMSK, OTG_FS_DEVICE::FS_DAINT, OTG_FS_DEVICE::FS_DAINTMSK, OTG_FS_DEVICE::DVBUSDIS, OTG_FS_DEVICE::DVBUSPULSE, OTG_FS_DEVICE::DIEPEMPMSK, OTG_FS_DEVICE::FS_DIEPCTL0, OTG_FS_DEVICE::DIEPCTL1, OTG_FS_DEVICE::DIEPCTL2, OTG_FS_DEVICE::DIEPCTL3, OTG_FS_DEVICE::DOEPCTL0, OTG_FS_DEVICE::DOEPCTL1, OTG_FS_DEVICE::DOEPCTL2, OTG_FS_DEVICE::DOEPCTL3, OTG_FS_DEVICE::DIEPINT0, OTG_FS_DEVICE::DIEPINT1, OTG_FS_DEVICE::DIEPINT2, OTG_FS_DEVICE::DIEPINT3, OTG_FS_DEVICE::DOEPINT0, OTG_FS_DEVICE::DOEPINT1, OTG_FS_DEVICE::DOEPINT2, OTG_FS_DEVICE::DOEPINT3, OTG_FS_DEVICE::DIEPTSIZ0, OTG_FS_DEVICE::DOEPTSIZ0, OTG_FS_DEVICE::DIEPTSIZ1, OTG_FS_DEVICE::DIEPTSIZ2, OTG_FS_DEVICE::DIEPTSIZ3, OTG_FS_DEVICE::DTXFSTS0, OTG_FS_DEVICE::DTXFSTS1, OTG_FS_DEVICE::DTXFSTS2, OTG_FS_DEVICE::DTXFSTS3, OTG_FS_DEVICE::DOEPTSIZ1, OTG_FS_DEVICE::DOEPTSIZ2, OTG_FS_DEVICE::DOEPTSIZ3> ;
 } ;
 
 #endif //#if !defined(OTGFSDEVICEREGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct OTG_FS_GLOBAL
 {
+  using Bus = Ahb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x50000000U ;
+
   struct OTG_FS_GLOBALFS_GOTGCTLBase {} ;
 
   struct FS_GOTGCTL : public RegisterBase<0x50000000, 32, ReadWriteMode>
@@ -31,6 +36,10 @@ struct OTG_FS_GLOBAL
     using DBCT = OTG_FS_GLOBAL_FS_GOTGCTL_DBCT_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 17, 1, ReadMode, OTG_FS_GLOBALFS_GOTGCTLBase> ;
     using ASVLD = OTG_FS_GLOBAL_FS_GOTGCTL_ASVLD_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 18, 1, ReadMode, OTG_FS_GLOBALFS_GOTGCTLBase> ;
     using BSVLD = OTG_FS_GLOBAL_FS_GOTGCTL_BSVLD_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 19, 1, ReadMode, OTG_FS_GLOBALFS_GOTGCTLBase> ;
+    static constexpr Type VolatileMask = 0xF0101U ;
+    static constexpr Type WritableMask = 0xE02U ;
+    static constexpr Type ResetValue = 0x800U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GOTGCTL_BSVLD_Values<OTG_FS_GLOBAL::FS_GOTGCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +56,9 @@ struct OTG_FS_GLOBAL
     using HNGDET = OTG_FS_GLOBAL_FS_GOTGINT_HNGDET_Values<OTG_FS_GLOBAL::FS_GOTGINT, 17, 1, ReadWriteMode, OTG_FS_GLOBALFS_GOTGINTBase> ;
     using ADTOCHG = OTG_FS_GLOBAL_FS_GOTGINT_ADTOCHG_Values<OTG_FS_GLOBAL::FS_GOTGINT, 18, 1, ReadWriteMode, OTG_FS_GLOBALFS_GOTGINTBase> ;
     using DBCDNE = OTG_FS_GLOBAL_FS_GOTGINT_DBCDNE_Values<OTG_FS_GLOBAL::FS_GOTGINT, 19, 1, ReadWriteMode, OTG_FS_GLOBALFS_GOTGINTBase> ;
+    static constexpr Type WritableMask = 0xE0304U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GOTGINT_DBCDNE_Values<OTG_FS_GLOBAL::FS_GOTGINT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +72,9 @@ struct OTG_FS_GLOBAL
     using GINT = OTG_FS_GLOBAL_FS_GAHBCFG_GINT_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 0, 1, ReadWriteMode, OTG_FS_GLOBALFS_GAHBCFGBase> ;
     using TXFELVL = OTG_FS_GLOBAL_FS_GAHBCFG_TXFELVL_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 7, 1, ReadWriteMode, OTG_FS_GLOBALFS_GAHBCFGBase> ;
     using PTXFELVL = OTG_FS_GLOBAL_FS_GAHBCFG_PTXFELVL_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 8, 1, ReadWriteMode, OTG_FS_GLOBALFS_GAHBCFGBase> ;
+    static constexpr Type WritableMask = 0x181U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GAHBCFG_PTXFELVL_Values<OTG_FS_GLOBAL::FS_GAHBCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +93,9 @@ struct OTG_FS_GLOBAL
     using FHMOD = OTG_FS_GLOBAL_FS_GUSBCFG_FHMOD_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 29, 1, ReadWriteMode, OTG_FS_GLOBALFS_GUSBCFGBase> ;
     using FDMOD = OTG_FS_GLOBAL_FS_GUSBCFG_FDMOD_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 30, 1, ReadWriteMode, OTG_FS_GLOBALFS_GUSBCFGBase> ;
     using CTXPKT = OTG_FS_GLOBAL_FS_GUSBCFG_CTXPKT_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 31, 1, ReadWriteMode, OTG_FS_GLOBALFS_GUSBCFGBase> ;
+    static constexpr Type WritableMask = 0xE0003F47U ;
+    static constexpr Type ResetValue = 0xA00U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GUSBCFG_CTXPKT_Values<OTG_FS_GLOBAL::FS_GUSBCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +113,10 @@ struct OTG_FS_GLOBAL
     using TXFFLSH = OTG_FS_GLOBAL_FS_GRSTCTL_TXFFLSH_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 5, 1, ReadWriteMode, OTG_FS_GLOBALFS_GRSTCTLBase> ;
     using TXFNUM = OTG_FS_GLOBAL_FS_GRSTCTL_TXFNUM_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 6, 5, ReadWriteMode, OTG_FS_GLOBALFS_GRSTCTLBase> ;
     using AHBIDL = OTG_FS_GLOBAL_FS_GRSTCTL_AHBIDL_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 31, 1, ReadMode, OTG_FS_GLOBALFS_GRSTCTLBase> ;
+    static constexpr Type VolatileMask = 0x80000000U ;
+    static constexpr Type WritableMask = 0x7F7U ;
+    static constexpr Type ResetValue = 0x20000000U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GRSTCTL_AHBIDL_Values<OTG_FS_GLOBAL::FS_GRSTCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -130,6 +152,10 @@ struct OTG_FS_GLOBAL
     using DISCINT = OTG_FS_GLOBAL_FS_GINTSTS_DISCINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 29, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTSTSBase> ;
     using SRQINT = OTG_FS_GLOBAL_FS_GINTSTS_SRQINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 30, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTSTSBase> ;
     using WKUPINT = OTG_FS_GLOBAL_FS_GINTSTS_WKUPINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 31, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTSTSBase> ;
+    static constexpr Type VolatileMask = 0x70C00F5U ;
+    static constexpr Type WritableMask = 0xF030FC0AU ;
+    static constexpr Type ResetValue = 0x4000020U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GINTSTS_WKUPINT_Values<OTG_FS_GLOBAL::FS_GINTSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +191,10 @@ struct OTG_FS_GLOBAL
     using DISCINT = OTG_FS_GLOBAL_FS_GINTMSK_DISCINT_Values<OTG_FS_GLOBAL::FS_GINTMSK, 29, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTMSKBase> ;
     using SRQIM = OTG_FS_GLOBAL_FS_GINTMSK_SRQIM_Values<OTG_FS_GLOBAL::FS_GINTMSK, 30, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTMSKBase> ;
     using WUIM = OTG_FS_GLOBAL_FS_GINTMSK_WUIM_Values<OTG_FS_GLOBAL::FS_GINTMSK, 31, 1, ReadWriteMode, OTG_FS_GLOBALFS_GINTMSKBase> ;
+    static constexpr Type VolatileMask = 0x1000000U ;
+    static constexpr Type WritableMask = 0xF63EFCFEU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GINTMSK_WUIM_Values<OTG_FS_GLOBAL::FS_GINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +210,9 @@ struct OTG_FS_GLOBAL
     using DPID = OTG_FS_GLOBAL_FS_GRXSTSR_Device_DPID_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Device, 15, 2, ReadMode, OTG_FS_GLOBALFS_GRXSTSR_DeviceBase> ;
     using PKTSTS = OTG_FS_GLOBAL_FS_GRXSTSR_Device_PKTSTS_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Device, 17, 4, ReadMode, OTG_FS_GLOBALFS_GRXSTSR_DeviceBase> ;
     using FRMNUM = OTG_FS_GLOBAL_FS_GRXSTSR_Device_FRMNUM_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Device, 21, 4, ReadMode, OTG_FS_GLOBALFS_GRXSTSR_DeviceBase> ;
+    static constexpr Type VolatileMask = 0x1FFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GRXSTSR_Device_FRMNUM_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Device, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -195,6 +228,9 @@ struct OTG_FS_GLOBAL
     using DPID = OTG_FS_GLOBAL_FS_GRXSTSR_Host_DPID_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Host, 15, 2, ReadMode, OTG_FS_GLOBALFS_GRXSTSR_HostBase> ;
     using PKTSTS = OTG_FS_GLOBAL_FS_GRXSTSR_Host_PKTSTS_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Host, 17, 4, ReadMode, OTG_FS_GLOBALFS_GRXSTSR_HostBase> ;
     using FRMNUM = OTG_FS_GLOBAL_FS_GRXSTSR_Host_FRMNUM_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Host, 21, 4, ReadMode, OTG_FS_GLOBALFS_GRXSTSR_HostBase> ;
+    static constexpr Type VolatileMask = 0x1FFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GRXSTSR_Host_FRMNUM_Values<OTG_FS_GLOBAL::FS_GRXSTSR_Host, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +242,9 @@ struct OTG_FS_GLOBAL
   struct FS_GRXFSIZ : public RegisterBase<0x50000024, 32, ReadWriteMode>
   {
     using RXFD = OTG_FS_GLOBAL_FS_GRXFSIZ_RXFD_Values<OTG_FS_GLOBAL::FS_GRXFSIZ, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_GRXFSIZBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x200U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GRXFSIZ_RXFD_Values<OTG_FS_GLOBAL::FS_GRXFSIZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -218,6 +257,9 @@ struct OTG_FS_GLOBAL
   {
     using TX0FSA = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Device_TX0FSA_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_DeviceBase> ;
     using TX0FD = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Device_TX0FD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_DeviceBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x200U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Device_TX0FD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +272,9 @@ struct OTG_FS_GLOBAL
   {
     using NPTXFSA = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Host_NPTXFSA_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_HostBase> ;
     using NPTXFD = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Host_NPTXFD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_GNPTXFSIZ_HostBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x200U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GNPTXFSIZ_Host_NPTXFD_Values<OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -243,6 +288,9 @@ struct OTG_FS_GLOBAL
     using NPTXFSAV = OTG_FS_GLOBAL_FS_GNPTXSTS_NPTXFSAV_Values<OTG_FS_GLOBAL::FS_GNPTXSTS, 0, 16, ReadMode, OTG_FS_GLOBALFS_GNPTXSTSBase> ;
     using NPTQXSAV = OTG_FS_GLOBAL_FS_GNPTXSTS_NPTQXSAV_Values<OTG_FS_GLOBAL::FS_GNPTXSTS, 16, 8, ReadMode, OTG_FS_GLOBALFS_GNPTXSTSBase> ;
     using NPTXQTOP = OTG_FS_GLOBAL_FS_GNPTXSTS_NPTXQTOP_Values<OTG_FS_GLOBAL::FS_GNPTXSTS, 24, 7, ReadMode, OTG_FS_GLOBALFS_GNPTXSTSBase> ;
+    static constexpr Type VolatileMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x80200U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GNPTXSTS_NPTXQTOP_Values<OTG_FS_GLOBAL::FS_GNPTXSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -257,6 +305,9 @@ struct OTG_FS_GLOBAL
     using VBUSASEN = OTG_FS_GLOBAL_FS_GCCFG_VBUSASEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 18, 1, ReadWriteMode, OTG_FS_GLOBALFS_GCCFGBase> ;
     using VBUSBSEN = OTG_FS_GLOBAL_FS_GCCFG_VBUSBSEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 19, 1, ReadWriteMode, OTG_FS_GLOBALFS_GCCFGBase> ;
     using SOFOUTEN = OTG_FS_GLOBAL_FS_GCCFG_SOFOUTEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 20, 1, ReadWriteMode, OTG_FS_GLOBALFS_GCCFGBase> ;
+    static constexpr Type WritableMask = 0x1D0000U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_GCCFG_SOFOUTEN_Values<OTG_FS_GLOBAL::FS_GCCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -268,6 +319,9 @@ struct OTG_FS_GLOBAL
   struct FS_CID : public RegisterBase<0x5000003C, 32, ReadWriteMode>
   {
     using PRODUCT_ID = OTG_FS_GLOBAL_FS_CID_PRODUCT_ID_Values<OTG_FS_GLOBAL::FS_CID, 0, 32, ReadWriteMode, OTG_FS_GLOBALFS_CIDBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x1000U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_CID_PRODUCT_ID_Values<OTG_FS_GLOBAL::FS_CID, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -280,6 +334,9 @@ struct OTG_FS_GLOBAL
   {
     using PTXSA = OTG_FS_GLOBAL_FS_HPTXFSIZ_PTXSA_Values<OTG_FS_GLOBAL::FS_HPTXFSIZ, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_HPTXFSIZBase> ;
     using PTXFSIZ = OTG_FS_GLOBAL_FS_HPTXFSIZ_PTXFSIZ_Values<OTG_FS_GLOBAL::FS_HPTXFSIZ, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_HPTXFSIZBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x2000600U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_HPTXFSIZ_PTXFSIZ_Values<OTG_FS_GLOBAL::FS_HPTXFSIZ, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -292,6 +349,9 @@ struct OTG_FS_GLOBAL
   {
     using INEPTXSA = OTG_FS_GLOBAL_FS_DIEPTXF1_INEPTXSA_Values<OTG_FS_GLOBAL::FS_DIEPTXF1, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF1Base> ;
     using INEPTXFD = OTG_FS_GLOBAL_FS_DIEPTXF1_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF1, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF1Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x2000400U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_DIEPTXF1_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -304,6 +364,9 @@ struct OTG_FS_GLOBAL
   {
     using INEPTXSA = OTG_FS_GLOBAL_FS_DIEPTXF2_INEPTXSA_Values<OTG_FS_GLOBAL::FS_DIEPTXF2, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF2Base> ;
     using INEPTXFD = OTG_FS_GLOBAL_FS_DIEPTXF2_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF2, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF2Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x2000400U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_DIEPTXF2_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -316,12 +379,19 @@ struct OTG_FS_GLOBAL
   {
     using INEPTXSA = OTG_FS_GLOBAL_FS_DIEPTXF3_INEPTXSA_Values<OTG_FS_GLOBAL::FS_DIEPTXF3, 0, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF3Base> ;
     using INEPTXFD = OTG_FS_GLOBAL_FS_DIEPTXF3_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF3, 16, 16, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF3Base> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x2000400U ;
+    using Peripheral = OTG_FS_GLOBAL ;
     using FieldValues = OTG_FS_GLOBAL_FS_DIEPTXF3_INEPTXFD_Values<OTG_FS_GLOBAL::FS_DIEPTXF3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FS_DIEPTXF3Pack  = Register<0x5000010C, 32, ReadWriteMode, OTG_FS_GLOBALFS_DIEPTXF3Base, T...> ;
 
+  template<std::size_t index>
+  using FS_DIEPTXF = IndexedType<index, 1U, OTG_FS_GLOBAL::FS_DIEPTXF1, OTG_FS_GLOBAL::FS_DIEPTXF2, OTG_FS_GLOBAL::FS_DIEPTXF3> ;
+
+  using Registers = TypesList<OTG_FS_GLOBAL::FS_GOTGCTL, OTG_FS_GLOBAL::FS_GOTGINT, OTG_FS_GLOBAL::FS_GAHBCFG, OTG_FS_GLOBAL::FS_GUSBCFG, OTG_FS_GLOBAL::FS_GRSTCTL, OTG_FS_GLOBAL::FS_GINTSTS, OTG_FS_GLOBAL::FS_GINTMSK, OTG_FS_GLOBAL::FS_GRXSTSR_Device, OTG_FS_GLOBAL::FS_GRXSTSR_Host, OTG_FS_GLOBAL::FS_GRXFSIZ, OTG_FS_GLOBAL::FS_GNPTXFSIZ_Device, OTG_FS_GLOBAL::FS_GNPTXFSIZ_Host, OTG_FS_GLOBAL::FS_GNPTXSTS, OTG_FS_GLOBAL::FS_GCCFG, OTG_FS_GLOBAL::FS_CID, OTG_FS_GLOBAL::FS_HPTXFSIZ, OTG_FS_GLOBAL::FS_DIEPTXF1, OTG_FS_GLOBAL::FS_DIEPTXF2, OTG_FS_GLOBAL::FS_DIEPTXF3> ;
 } ;
 
 #endif //#if !defined(OTGFSGLOBALREGISTERS_HPP)
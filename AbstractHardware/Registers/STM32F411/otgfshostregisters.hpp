@@ -14,15 +14,24 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct OTG_FS_HOST
 {
+  using Bus = Ahb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x50000400U ;
+
   struct OTG_FS_HOSTFS_HCFGBase {} ;
 
   struct FS_HCFG : public RegisterBase<0x50000400, 32, ReadWriteMode>
   {
     using FSLSPCS = OTG_FS_HOST_FS_HCFG_FSLSPCS_Values<OTG_FS_HOST::FS_HCFG, 0, 2, ReadWriteMode, OTG_FS_HOSTFS_HCFGBase> ;
     using FSLSS = OTG_FS_HOST_FS_HCFG_FSLSS_Values<OTG_FS_HOST::FS_HCFG, 2, 1, ReadMode, OTG_FS_HOSTFS_HCFGBase> ;
+    static constexpr Type VolatileMask = 0x4U ;
+    static constexpr Type WritableMask = 0x3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCFG_FSLSS_Values<OTG_FS_HOST::FS_HCFG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -34,6 +43,9 @@ struct OTG_FS_HOST
   struct HFIR : public RegisterBase<0x50000404, 32, ReadWriteMode>
   {
     using FRIVL = OTG_FS_HOST_HFIR_FRIVL_Values<OTG_FS_HOST::HFIR, 0, 16, ReadWriteMode, OTG_FS_HOSTHFIRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0xEA60U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_HFIR_FRIVL_Values<OTG_FS_HOST::HFIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -46,6 +58,9 @@ struct OTG_FS_HOST
   {
     using FRNUM = OTG_FS_HOST_FS_HFNUM_FRNUM_Values<OTG_FS_HOST::FS_HFNUM, 0, 16, ReadMode, OTG_FS_HOSTFS_HFNUMBase> ;
     using FTREM = OTG_FS_HOST_FS_HFNUM_FTREM_Values<OTG_FS_HOST::FS_HFNUM, 16, 16, ReadMode, OTG_FS_HOSTFS_HFNUMBase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x3FFFU ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HFNUM_FTREM_Values<OTG_FS_HOST::FS_HFNUM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +74,10 @@ struct OTG_FS_HOST
     using PTXFSAVL = OTG_FS_HOST_FS_HPTXSTS_PTXFSAVL_Values<OTG_FS_HOST::FS_HPTXSTS, 0, 16, ReadWriteMode, OTG_FS_HOSTFS_HPTXSTSBase> ;
     using PTXQSAV = OTG_FS_HOST_FS_HPTXSTS_PTXQSAV_Values<OTG_FS_HOST::FS_HPTXSTS, 16, 8, ReadMode, OTG_FS_HOSTFS_HPTXSTSBase> ;
     using PTXQTOP = OTG_FS_HOST_FS_HPTXSTS_PTXQTOP_Values<OTG_FS_HOST::FS_HPTXSTS, 24, 8, ReadMode, OTG_FS_HOSTFS_HPTXSTSBase> ;
+    static constexpr Type VolatileMask = 0xFFFF0000U ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x80100U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HPTXSTS_PTXQTOP_Values<OTG_FS_HOST::FS_HPTXSTS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +89,9 @@ struct OTG_FS_HOST
   struct HAINT : public RegisterBase<0x50000414, 32, ReadMode>
   {
     using HAINTField = OTG_FS_HOST_HAINT_HAINT_Values<OTG_FS_HOST::HAINT, 0, 16, ReadMode, OTG_FS_HOSTHAINTBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_HAINT_HAINT_Values<OTG_FS_HOST::HAINT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +103,9 @@ struct OTG_FS_HOST
   struct HAINTMSK : public RegisterBase<0x50000418, 32, ReadWriteMode>
   {
     using HAINTM = OTG_FS_HOST_HAINTMSK_HAINTM_Values<OTG_FS_HOST::HAINTMSK, 0, 16, ReadWriteMode, OTG_FS_HOSTHAINTMSKBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_HAINTMSK_HAINTM_Values<OTG_FS_HOST::HAINTMSK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +129,10 @@ struct OTG_FS_HOST
     using PPWR = OTG_FS_HOST_FS_HPRT_PPWR_Values<OTG_FS_HOST::FS_HPRT, 12, 1, ReadWriteMode, OTG_FS_HOSTFS_HPRTBase> ;
     using PTCTL = OTG_FS_HOST_FS_HPRT_PTCTL_Values<OTG_FS_HOST::FS_HPRT, 13, 4, ReadWriteMode, OTG_FS_HOSTFS_HPRTBase> ;
     using PSPD = OTG_FS_HOST_FS_HPRT_PSPD_Values<OTG_FS_HOST::FS_HPRT, 17, 2, ReadMode, OTG_FS_HOSTFS_HPRTBase> ;
+    static constexpr Type VolatileMask = 0x60C11U ;
+    static constexpr Type WritableMask = 0x1F1EEU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HPRT_PSPD_Values<OTG_FS_HOST::FS_HPRT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +153,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR0_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR0, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR0Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR0_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR0, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR0Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR0_CHENA_Values<OTG_FS_HOST::FS_HCCHAR0, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR0Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR0_CHENA_Values<OTG_FS_HOST::FS_HCCHAR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -144,6 +176,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR1_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR1, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR1Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR1_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR1, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR1Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR1_CHENA_Values<OTG_FS_HOST::FS_HCCHAR1, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR1Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR1_CHENA_Values<OTG_FS_HOST::FS_HCCHAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +199,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR2_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR2, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR2Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR2_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR2, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR2Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR2_CHENA_Values<OTG_FS_HOST::FS_HCCHAR2, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR2Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR2_CHENA_Values<OTG_FS_HOST::FS_HCCHAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -184,6 +222,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR3_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR3, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR3Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR3_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR3, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR3Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR3_CHENA_Values<OTG_FS_HOST::FS_HCCHAR3, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR3Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR3_CHENA_Values<OTG_FS_HOST::FS_HCCHAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -204,6 +245,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR4_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR4, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR4Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR4_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR4, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR4Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR4_CHENA_Values<OTG_FS_HOST::FS_HCCHAR4, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR4Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR4_CHENA_Values<OTG_FS_HOST::FS_HCCHAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +268,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR5_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR5, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR5Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR5_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR5, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR5Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR5_CHENA_Values<OTG_FS_HOST::FS_HCCHAR5, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR5Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR5_CHENA_Values<OTG_FS_HOST::FS_HCCHAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -244,6 +291,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR6_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR6, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR6Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR6_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR6, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR6Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR6_CHENA_Values<OTG_FS_HOST::FS_HCCHAR6, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR6Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR6_CHENA_Values<OTG_FS_HOST::FS_HCCHAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +314,9 @@ struct OTG_FS_HOST
     using ODDFRM = OTG_FS_HOST_FS_HCCHAR7_ODDFRM_Values<OTG_FS_HOST::FS_HCCHAR7, 29, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR7Base> ;
     using CHDIS = OTG_FS_HOST_FS_HCCHAR7_CHDIS_Values<OTG_FS_HOST::FS_HCCHAR7, 30, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR7Base> ;
     using CHENA = OTG_FS_HOST_FS_HCCHAR7_CHENA_Values<OTG_FS_HOST::FS_HCCHAR7, 31, 1, ReadWriteMode, OTG_FS_HOSTFS_HCCHAR7Base> ;
+    static constexpr Type WritableMask = 0xFFFEFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCCHAR7_CHENA_Values<OTG_FS_HOST::FS_HCCHAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -283,6 +336,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT0_BBERR_Values<OTG_FS_HOST::FS_HCINT0, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT0Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT0_FRMOR_Values<OTG_FS_HOST::FS_HCINT0, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT0Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT0_DTERR_Values<OTG_FS_HOST::FS_HCINT0, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT0Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT0_DTERR_Values<OTG_FS_HOST::FS_HCINT0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -302,6 +358,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT1_BBERR_Values<OTG_FS_HOST::FS_HCINT1, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT1Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT1_FRMOR_Values<OTG_FS_HOST::FS_HCINT1, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT1Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT1_DTERR_Values<OTG_FS_HOST::FS_HCINT1, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT1Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT1_DTERR_Values<OTG_FS_HOST::FS_HCINT1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -321,6 +380,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT2_BBERR_Values<OTG_FS_HOST::FS_HCINT2, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT2Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT2_FRMOR_Values<OTG_FS_HOST::FS_HCINT2, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT2Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT2_DTERR_Values<OTG_FS_HOST::FS_HCINT2, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT2Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT2_DTERR_Values<OTG_FS_HOST::FS_HCINT2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +402,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT3_BBERR_Values<OTG_FS_HOST::FS_HCINT3, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT3Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT3_FRMOR_Values<OTG_FS_HOST::FS_HCINT3, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT3Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT3_DTERR_Values<OTG_FS_HOST::FS_HCINT3, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT3Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT3_DTERR_Values<OTG_FS_HOST::FS_HCINT3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -359,6 +424,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT4_BBERR_Values<OTG_FS_HOST::FS_HCINT4, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT4Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT4_FRMOR_Values<OTG_FS_HOST::FS_HCINT4, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT4Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT4_DTERR_Values<OTG_FS_HOST::FS_HCINT4, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT4Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT4_DTERR_Values<OTG_FS_HOST::FS_HCINT4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -378,6 +446,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT5_BBERR_Values<OTG_FS_HOST::FS_HCINT5, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT5Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT5_FRMOR_Values<OTG_FS_HOST::FS_HCINT5, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT5Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT5_DTERR_Values<OTG_FS_HOST::FS_HCINT5, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT5Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT5_DTERR_Values<OTG_FS_HOST::FS_HCINT5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -397,6 +468,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT6_BBERR_Values<OTG_FS_HOST::FS_HCINT6, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT6Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT6_FRMOR_Values<OTG_FS_HOST::FS_HCINT6, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT6Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT6_DTERR_Values<OTG_FS_HOST::FS_HCINT6, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT6Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT6_DTERR_Values<OTG_FS_HOST::FS_HCINT6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +490,9 @@ struct OTG_FS_HOST
     using BBERR = OTG_FS_HOST_FS_HCINT7_BBERR_Values<OTG_FS_HOST::FS_HCINT7, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT7Base> ;
     using FRMOR = OTG_FS_HOST_FS_HCINT7_FRMOR_Values<OTG_FS_HOST::FS_HCINT7, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT7Base> ;
     using DTERR = OTG_FS_HOST_FS_HCINT7_DTERR_Values<OTG_FS_HOST::FS_HCINT7, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINT7Base> ;
+    static constexpr Type WritableMask = 0x7BBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINT7_DTERR_Values<OTG_FS_HOST::FS_HCINT7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -436,6 +513,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK0_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK0, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK0Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK0_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK0, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK0Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK0_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK0, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK0Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK0_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -456,6 +536,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK1_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK1, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK1Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK1_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK1, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK1Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK1_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK1, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK1Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK1_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -476,6 +559,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK2_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK2, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK2Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK2_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK2, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK2Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK2_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK2, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK2Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK2_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -496,6 +582,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK3_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK3, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK3Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK3_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK3, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK3Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK3_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK3, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK3Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK3_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -516,6 +605,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK4_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK4, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK4Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK4_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK4, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK4Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK4_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK4, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK4Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK4_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -536,6 +628,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK5_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK5, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK5Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK5_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK5, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK5Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK5_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK5, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK5Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK5_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -556,6 +651,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK6_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK6, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK6Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK6_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK6, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK6Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK6_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK6, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK6Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK6_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -576,6 +674,9 @@ struct OTG_FS_HOST
     using BBERRM = OTG_FS_HOST_FS_HCINTMSK7_BBERRM_Values<OTG_FS_HOST::FS_HCINTMSK7, 8, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK7Base> ;
     using FRMORM = OTG_FS_HOST_FS_HCINTMSK7_FRMORM_Values<OTG_FS_HOST::FS_HCINTMSK7, 9, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK7Base> ;
     using DTERRM = OTG_FS_HOST_FS_HCINTMSK7_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK7, 10, 1, ReadWriteMode, OTG_FS_HOSTFS_HCINTMSK7Base> ;
+    static constexpr Type WritableMask = 0x7FBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCINTMSK7_DTERRM_Values<OTG_FS_HOST::FS_HCINTMSK7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -589,6 +690,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ0_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ0, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ0Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ0_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ0, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ0Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ0_DPID_Values<OTG_FS_HOST::FS_HCTSIZ0, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ0Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ0_DPID_Values<OTG_FS_HOST::FS_HCTSIZ0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -602,6 +706,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ1_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ1, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ1Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ1_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ1, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ1Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ1_DPID_Values<OTG_FS_HOST::FS_HCTSIZ1, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ1Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ1_DPID_Values<OTG_FS_HOST::FS_HCTSIZ1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -615,6 +722,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ2_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ2, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ2Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ2_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ2, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ2Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ2_DPID_Values<OTG_FS_HOST::FS_HCTSIZ2, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ2Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ2_DPID_Values<OTG_FS_HOST::FS_HCTSIZ2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -628,6 +738,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ3_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ3, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ3Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ3_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ3, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ3Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ3_DPID_Values<OTG_FS_HOST::FS_HCTSIZ3, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ3Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ3_DPID_Values<OTG_FS_HOST::FS_HCTSIZ3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -641,6 +754,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ4_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ4, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ4Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ4_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ4, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ4Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ4_DPID_Values<OTG_FS_HOST::FS_HCTSIZ4, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ4Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ4_DPID_Values<OTG_FS_HOST::FS_HCTSIZ4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -654,6 +770,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ5_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ5, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ5Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ5_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ5, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ5Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ5_DPID_Values<OTG_FS_HOST::FS_HCTSIZ5, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ5Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ5_DPID_Values<OTG_FS_HOST::FS_HCTSIZ5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -667,6 +786,9 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ6_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ6, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ6Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ6_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ6, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ6Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ6_DPID_Values<OTG_FS_HOST::FS_HCTSIZ6, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ6Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ6_DPID_Values<OTG_FS_HOST::FS_HCTSIZ6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -680,12 +802,28 @@ struct OTG_FS_HOST
     using XFRSIZ = OTG_FS_HOST_FS_HCTSIZ7_XFRSIZ_Values<OTG_FS_HOST::FS_HCTSIZ7, 0, 19, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ7Base> ;
     using PKTCNT = OTG_FS_HOST_FS_HCTSIZ7_PKTCNT_Values<OTG_FS_HOST::FS_HCTSIZ7, 19, 10, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ7Base> ;
     using DPID = OTG_FS_HOST_FS_HCTSIZ7_DPID_Values<OTG_FS_HOST::FS_HCTSIZ7, 29, 2, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ7Base> ;
+    static constexpr Type WritableMask = 0x7FFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_HOST ;
     using FieldValues = OTG_FS_HOST_FS_HCTSIZ7_DPID_Values<OTG_FS_HOST::FS_HCTSIZ7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FS_HCTSIZ7Pack  = Register<0x500005F0, 32, ReadWriteMode, OTG_FS_HOSTFS_HCTSIZ7Base, T...> ;
 
+  template<std::size_t index>
+  using FS_HCCHAR = IndexedType<index, 0U, OTG_FS_HOST::FS_HCCHAR0, OTG_FS_HOST::FS_HCCHAR1, OTG_FS_HOST::FS_HCCHAR2, OTG_FS_HOST::FS_HCCHAR3, OTG_FS_HOST::FS_HCCHAR4, OTG_FS_HOST::FS_HCCHAR5, OTG_FS_HOST::FS_HCCHAR6, OTG_FS_HOST::FS_HCCHAR7> ;
+
+  template<std::size_t index>
+  using FS_HCINT = IndexedType<index, 0U, OTG_FS_HOST::FS_HCINT0, OTG_FS_HOST::FS_HCINT1, OTG_FS_HOST::FS_HCINT2, OTG_FS_HOST::FS_HCINT3, OTG_FS_HOST::FS_HCINT4, OTG_FS_HOST::FS_HCINT5, OTG_FS_HOST::FS_HCINT6, OTG_FS_HOST::FS_HCINT7> ;
+
+  template<std::size_t index>
+  using FS_HCINTMSK = IndexedType<index, 0U, OTG_FS_HOST::FS_HCINTMSK0, OTG_FS_HOST::FS_HCINTMSK1, OTG_FS_HOST::FS_HCINTMSK2, OTG_FS_HOST::FS_HCINTMSK3, OTG_FS_HOST::FS_HCINTMSK4, OTG_FS_HOST::FS_HCINTMSK5, OTG_FS_HOST::FS_HCINTMSK6, OTG_FS_HOST::FS_HCINTMSK7> ;
+
+  template<std::size_t index>
+  using FS_HCTSIZ = IndexedType<index, 0U, OTG_FS_HOST::FS_HCTSIZ0, OTG_FS_HOST::FS_HCTSIZ1, OTG_FS_HOST::FS_HCTSIZ2, OTG_FS_HOST::FS_HCTSIZ3, OTG_FS_HOST::FS_HCTSIZ4, OTG_FS_HOST::FS_HCTSIZ5, OTG_FS_HOST::FS_HCTSIZ6, OTG_FS_HOST::FS_HCTSIZ7> ;
+
+  using Registers = TypesList<OTG_FS_HOST::FS_HCFG, OTG_FS_HOST::HFIR, OTG_FS_HOST::FS_HFNUM, OTG_FS_HOST::FS_HPTXSTS, OTG_FS_HOST::HAINT, OTG_FS_HOST::HAINTMSK, OTG_FS_HOST::FS_HPRT, OTG_FS_HOST::FS_HCCHAR0, OTG_FS_HOST::FS_HCCHAR1, OTG_FS_HOST::FS_HCCHAR2, OTG_FS_HOST::FS_HCCHAR3, OTG_FS_HOST::FS_HCCHAR4, OTG_FS_HOST::FS_HCCHAR5, OTG_FS_HOST::FS_HCCHAR6, OTG_FS_HOST::FS_HCCHAR7, OTG_FS_HOST::FS_HCINT0, OTG_FS_HOST::FS_HCINT1, OTG_FS_HOST::FS_HCINT2, OTG_FS_HOST::FS_HCINT3, OTG_FS_HOST::FS_HCINT4, OTG_FS_HOST::FS_HCINT5, OTG_FS_HOST::FS_HCINT6, OTG_FS_HOST::FS_HCINT7, OTG_FS_HOST::FS_HCINTMSK0, OTG_FS_HOST::FS_HCINTMSK1, OTG_FS_HOST::FS_HCINTMSK2, OTG_FS_HOST::FS_HCINTMSK3, OTG_FS_HOST::FS_HCINTMSK4, OTG_FS_HOST::FS_HCINTMSK5, OTG_FS_HOST::FS_HCINTMSK6, OTG_FS_HOST::FS_HCINTMSK7, OTG_FS_HOST::FS_HCTSIZ0, OTG_FS_HOST::FS_HCTSIZ1, OTG_FS_HOST::FS_HCTSIZ2, OTG_FS_HOST::FS_HCTSIZ3, OTG_FS_HOST::FS_HCTSIZ4, OTG_FS_HOST::FS_HCTSIZ5, OTG_FS_HOST::FS_HCTSIZ6, OTG_FS_HOST::FS_HCTSIZ7> ;
 } ;
 
 #endif //#if !defined(OTGFSHOSTREGISTERS_HPP)
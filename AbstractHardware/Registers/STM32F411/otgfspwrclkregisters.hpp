@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct OTG_FS_PWRCLK
 {
+  using Bus = Ahb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x50000E00U ;
+
   struct OTG_FS_PWRCLKFS_PCGCCTLBase {} ;
 
   struct FS_PCGCCTL : public RegisterBase<0x50000E00, 32, ReadWriteMode>
@@ -24,12 +29,16 @@ struct OTG_FS_PWRCLK
     using STPPCLK = OTG_FS_PWRCLK_FS_PCGCCTL_STPPCLK_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 0, 1, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase> ;
     using GATEHCLK = OTG_FS_PWRCLK_FS_PCGCCTL_GATEHCLK_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 1, 1, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase> ;
     using PHYSUSP = OTG_FS_PWRCLK_FS_PCGCCTL_PHYSUSP_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 4, 1, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase> ;
+    static constexpr Type WritableMask = 0x13U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = OTG_FS_PWRCLK ;
     using FieldValues = OTG_FS_PWRCLK_FS_PCGCCTL_PHYSUSP_Values<OTG_FS_PWRCLK::FS_PCGCCTL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FS_PCGCCTLPack  = Register<0x50000E00, 32, ReadWriteMode, OTG_FS_PWRCLKFS_PCGCCTLBase, T...> ;
 
+  using Registers = TypesList<OTG_FS_PWRCLK::FS_PCGCCTL> ;
 } ;
 
 #endif //#if !defined(OTGFSPWRCLKREGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct PWR
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40007000U ;
+
   struct PWRCRBase {} ;
 
   struct CR : public RegisterBase<0x40007000, 32, ReadWriteMode>
@@ -31,6 +36,9 @@ struct PWR
     using CWUF = PWR_CR_CWUF_Values<PWR::CR, 2, 1, ReadWriteMode, PWRCRBase> ;
     using PDDS = PWR_CR_PDDS_Values<PWR::CR, 1, 1, ReadWriteMode, PWRCRBase> ;
     using LPDS = PWR_CR_LPDS_Values<PWR::CR, 0, 1, ReadWriteMode, PWRCRBase> ;
+    static constexpr Type WritableMask = 0xE3FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = PWR ;
     using FieldValues = PWR_CR_LPDS_Values<PWR::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,12 +56,18 @@ struct PWR
     using EWUP = PWR_CSR_EWUP_Values<PWR::CSR, 8, 1, ReadWriteMode, PWRCSRBase> ;
     using BRE = PWR_CSR_BRE_Values<PWR::CSR, 9, 1, ReadWriteMode, PWRCSRBase> ;
     using VOSRDY = PWR_CSR_VOSRDY_Values<PWR::CSR, 14, 1, ReadWriteMode, PWRCSRBase> ;
+    static constexpr Type VolatileMask = 0x430FU ;
+    static constexpr Type WritableMask = 0x4300U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = PWR ;
     using FieldValues = PWR_CSR_VOSRDY_Values<PWR::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSRPack  = Register<0x40007004, 32, ReadWriteMode, PWRCSRBase, T...> ;
 
+  using Registers = TypesList<PWR::CR, PWR::CSR> ;
 } ;
 
 #endif //#if !defined(PWRREGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct RCC
 {
+  using Bus = Ahb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40023800U ;
+
   struct RCCCRBase {} ;
 
   struct CR : public RegisterBase<0x40023800, 32, ReadWriteMode>
@@ -33,6 +38,10 @@ struct RCC
     using HSITRIM = RCC_CR_HSITRIM_Values<RCC::CR, 3, 5, ReadWriteMode, RCCCRBase> ;
     using HSIRDY = RCC_CR_HSIRDY_Values<RCC::CR, 1, 1, ReadMode, RCCCRBase> ;
     using HSION = RCC_CR_HSION_Values<RCC::CR, 0, 1, ReadWriteMode, RCCCRBase> ;
+    static constexpr Type VolatileMask = 0xA02FF02U ;
+    static constexpr Type WritableMask = 0x50D00F9U ;
+    static constexpr Type ResetValue = 0x83U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_CR_HSION_Values<RCC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +56,9 @@ struct RCC
     using PLLSRC = RCC_PLLCFGR_PLLSRC_Values<RCC::PLLCFGR, 22, 1, ReadWriteMode, RCCPLLCFGRBase> ;
     using PLLP0 = RCC_PLLCFGR_PLLP_Values<RCC::PLLCFGR, 16, 2, ReadWriteMode, RCCPLLCFGRBase> ;
     using PLLN0 = RCC_PLLCFGR_PLLN_Values<RCC::PLLCFGR, 6, 9, ReadWriteMode, RCCPLLCFGRBase> ;
+    static constexpr Type WritableMask = 0xF437FFFU ;
+    static constexpr Type ResetValue = 0x24003010U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_PLLCFGR_PLLM_Values<RCC::PLLCFGR, 0, 5, NoAccess, NoAccess> ;
   } ;
 
@@ -68,6 +80,12 @@ struct RCC
     using HPRE = RCC_CFGR_HPRE_Values<RCC::CFGR, 4, 4, ReadWriteMode, RCCCFGRBase> ;
     using SWS = RCC_CFGR_SWS_Values<RCC::CFGR, 2, 2, ReadMode, RCCCFGRBase> ;
     using SW = RCC_CFGR_SW_Values<RCC::CFGR, 0, 2, ReadWriteMode, RCCCFGRBase> ;
+    static constexpr Type VolatileMask = 0xCU ;
+    static constexpr Type WritableMask = 0xFFFFFCF3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using MCOArray = FieldArray<1U, MCO1, MCO2> ;
+    using PPREArray = FieldArray<1U, PPRE1, PPRE2> ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_CFGR_SW_Values<RCC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +116,10 @@ struct RCC
     using HSIRDYF = RCC_CIR_HSIRDYF_Values<RCC::CIR, 2, 1, ReadMode, RCCCIRBase> ;
     using LSERDYF = RCC_CIR_LSERDYF_Values<RCC::CIR, 1, 1, ReadMode, RCCCIRBase> ;
     using LSIRDYF = RCC_CIR_LSIRDYF_Values<RCC::CIR, 0, 1, ReadMode, RCCCIRBase> ;
+    static constexpr Type VolatileMask = 0xBFU ;
+    static constexpr Type WritableMask = 0xBF3F00U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_CIR_LSIRDYF_Values<RCC::CIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +139,9 @@ struct RCC
     using GPIOCRST = RCC_AHB1RSTR_GPIOCRST_Values<RCC::AHB1RSTR, 2, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
     using GPIOBRST = RCC_AHB1RSTR_GPIOBRST_Values<RCC::AHB1RSTR, 1, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
     using GPIOARST = RCC_AHB1RSTR_GPIOARST_Values<RCC::AHB1RSTR, 0, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
+    static constexpr Type WritableMask = 0x60109FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_AHB1RSTR_GPIOARST_Values<RCC::AHB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -128,6 +153,9 @@ struct RCC
   struct AHB2RSTR : public RegisterBase<0x40023814, 32, ReadWriteMode>
   {
     using OTGFSRST = RCC_AHB2RSTR_OTGFSRST_Values<RCC::AHB2RSTR, 7, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
+    static constexpr Type WritableMask = 0x80U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_AHB2RSTR_OTGFSRST_Values<RCC::AHB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +178,9 @@ struct RCC
     using TIM4RST = RCC_APB1RSTR_TIM4RST_Values<RCC::APB1RSTR, 2, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using TIM3RST = RCC_APB1RSTR_TIM3RST_Values<RCC::APB1RSTR, 1, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
     using TIM2RST = RCC_APB1RSTR_TIM2RST_Values<RCC::APB1RSTR, 0, 1, ReadWriteMode, RCCAPB1RSTRBase> ;
+    static constexpr Type WritableMask = 0x10E2C80FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_APB1RSTR_TIM2RST_Values<RCC::APB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -170,6 +201,9 @@ struct RCC
     using USART6RST = RCC_APB2RSTR_USART6RST_Values<RCC::APB2RSTR, 5, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using USART1RST = RCC_APB2RSTR_USART1RST_Values<RCC::APB2RSTR, 4, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using TIM1RST = RCC_APB2RSTR_TIM1RST_Values<RCC::APB2RSTR, 0, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
+    static constexpr Type WritableMask = 0x75931U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_APB2RSTR_TIM1RST_Values<RCC::APB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +223,9 @@ struct RCC
     using GPIOCEN = RCC_AHB1ENR_GPIOCEN_Values<RCC::AHB1ENR, 2, 1, ReadWriteMode, RCCAHB1ENRBase> ;
     using GPIOBEN = RCC_AHB1ENR_GPIOBEN_Values<RCC::AHB1ENR, 1, 1, ReadWriteMode, RCCAHB1ENRBase> ;
     using GPIOAEN = RCC_AHB1ENR_GPIOAEN_Values<RCC::AHB1ENR, 0, 1, ReadWriteMode, RCCAHB1ENRBase> ;
+    static constexpr Type WritableMask = 0x60109FU ;
+    static constexpr Type ResetValue = 0x100000U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_AHB1ENR_GPIOAEN_Values<RCC::AHB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -200,6 +237,9 @@ struct RCC
   struct AHB2ENR : public RegisterBase<0x40023834, 32, ReadWriteMode>
   {
     using OTGFSEN = RCC_AHB2ENR_OTGFSEN_Values<RCC::AHB2ENR, 7, 1, ReadWriteMode, RCCAHB2ENRBase> ;
+    static constexpr Type WritableMask = 0x80U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_AHB2ENR_OTGFSEN_Values<RCC::AHB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +262,9 @@ struct RCC
     using TIM4EN = RCC_APB1ENR_TIM4EN_Values<RCC::APB1ENR, 2, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using TIM3EN = RCC_APB1ENR_TIM3EN_Values<RCC::APB1ENR, 1, 1, ReadWriteMode, RCCAPB1ENRBase> ;
     using TIM2EN = RCC_APB1ENR_TIM2EN_Values<RCC::APB1ENR, 0, 1, ReadWriteMode, RCCAPB1ENRBase> ;
+    static constexpr Type WritableMask = 0x10E2C80FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_APB1ENR_TIM2EN_Values<RCC::APB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -243,6 +286,9 @@ struct RCC
     using TIM9EN = RCC_APB2ENR_TIM9EN_Values<RCC::APB2ENR, 16, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using TIM10EN = RCC_APB2ENR_TIM10EN_Values<RCC::APB2ENR, 17, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using TIM11EN = RCC_APB2ENR_TIM11EN_Values<RCC::APB2ENR, 18, 1, ReadWriteMode, RCCAPB2ENRBase> ;
+    static constexpr Type WritableMask = 0x77931U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_APB2ENR_TIM11EN_Values<RCC::APB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -264,6 +310,9 @@ struct RCC
     using GPIOCLPEN = RCC_AHB1LPENR_GPIOCLPEN_Values<RCC::AHB1LPENR, 2, 1, ReadWriteMode, RCCAHB1LPENRBase> ;
     using GPIOBLPEN = RCC_AHB1LPENR_GPIOBLPEN_Values<RCC::AHB1LPENR, 1, 1, ReadWriteMode, RCCAHB1LPENRBase> ;
     using GPIOALPEN = RCC_AHB1LPENR_GPIOALPEN_Values<RCC::AHB1LPENR, 0, 1, ReadWriteMode, RCCAHB1LPENRBase> ;
+    static constexpr Type WritableMask = 0x61909FU ;
+    static constexpr Type ResetValue = 0x7E6791FFU ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_AHB1LPENR_GPIOALPEN_Values<RCC::AHB1LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -275,6 +324,9 @@ struct RCC
   struct AHB2LPENR : public RegisterBase<0x40023854, 32, ReadWriteMode>
   {
     using OTGFSLPEN = RCC_AHB2LPENR_OTGFSLPEN_Values<RCC::AHB2LPENR, 7, 1, ReadWriteMode, RCCAHB2LPENRBase> ;
+    static constexpr Type WritableMask = 0x80U ;
+    static constexpr Type ResetValue = 0xF1U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_AHB2LPENR_OTGFSLPEN_Values<RCC::AHB2LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -297,6 +349,9 @@ struct RCC
     using TIM4LPEN = RCC_APB1LPENR_TIM4LPEN_Values<RCC::APB1LPENR, 2, 1, ReadWriteMode, RCCAPB1LPENRBase> ;
     using TIM3LPEN = RCC_APB1LPENR_TIM3LPEN_Values<RCC::APB1LPENR, 1, 1, ReadWriteMode, RCCAPB1LPENRBase> ;
     using TIM2LPEN = RCC_APB1LPENR_TIM2LPEN_Values<RCC::APB1LPENR, 0, 1, ReadWriteMode, RCCAPB1LPENRBase> ;
+    static constexpr Type WritableMask = 0x10E2C80FU ;
+    static constexpr Type ResetValue = 0x36FEC9FFU ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_APB1LPENR_TIM2LPEN_Values<RCC::APB1LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -318,6 +373,9 @@ struct RCC
     using TIM9LPEN = RCC_APB2LPENR_TIM9LPEN_Values<RCC::APB2LPENR, 16, 1, ReadWriteMode, RCCAPB2LPENRBase> ;
     using TIM10LPEN = RCC_APB2LPENR_TIM10LPEN_Values<RCC::APB2LPENR, 17, 1, ReadWriteMode, RCCAPB2LPENRBase> ;
     using TIM11LPEN = RCC_APB2LPENR_TIM11LPEN_Values<RCC::APB2LPENR, 18, 1, ReadWriteMode, RCCAPB2LPENRBase> ;
+    static constexpr Type WritableMask = 0x77931U ;
+    static constexpr Type ResetValue = 0x75F33U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_APB2LPENR_TIM11LPEN_Values<RCC::APB2LPENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -334,6 +392,10 @@ struct RCC
     using LSEBYP = RCC_BDCR_LSEBYP_Values<RCC::BDCR, 2, 1, ReadWriteMode, RCCBDCRBase> ;
     using LSERDY = RCC_BDCR_LSERDY_Values<RCC::BDCR, 1, 1, ReadMode, RCCBDCRBase> ;
     using LSEON = RCC_BDCR_LSEON_Values<RCC::BDCR, 0, 1, ReadWriteMode, RCCBDCRBase> ;
+    static constexpr Type VolatileMask = 0x18307U ;
+    static constexpr Type WritableMask = 0x18305U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_BDCR_LSEON_Values<RCC::BDCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -354,6 +416,11 @@ struct RCC
     using RMVF = RCC_CSR_RMVF_Values<RCC::CSR, 24, 1, ReadWriteMode, RCCCSRBase> ;
     using LSIRDY = RCC_CSR_LSIRDY_Values<RCC::CSR, 1, 1, ReadMode, RCCCSRBase> ;
     using LSION = RCC_CSR_LSION_Values<RCC::CSR, 0, 1, ReadWriteMode, RCCCSRBase> ;
+    static constexpr Type VolatileMask = 0xFF000003U ;
+    static constexpr Type WritableMask = 0xFF000001U ;
+    static constexpr Type ResetValue = 0xE000000U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_CSR_LSION_Values<RCC::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -368,6 +435,9 @@ struct RCC
     using SPREADSEL = RCC_SSCGR_SPREADSEL_Values<RCC::SSCGR, 30, 1, ReadWriteMode, RCCSSCGRBase> ;
     using INCSTEP = RCC_SSCGR_INCSTEP_Values<RCC::SSCGR, 13, 15, ReadWriteMode, RCCSSCGRBase> ;
     using MODPER = RCC_SSCGR_MODPER_Values<RCC::SSCGR, 0, 13, ReadWriteMode, RCCSSCGRBase> ;
+    static constexpr Type WritableMask = 0xCFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_SSCGR_MODPER_Values<RCC::SSCGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -380,12 +450,16 @@ struct RCC
   {
     using PLLI2SRx = RCC_PLLI2SCFGR_PLLI2SRx_Values<RCC::PLLI2SCFGR, 28, 3, ReadWriteMode, RCCPLLI2SCFGRBase> ;
     using PLLI2SNx = RCC_PLLI2SCFGR_PLLI2SNx_Values<RCC::PLLI2SCFGR, 6, 9, ReadWriteMode, RCCPLLI2SCFGRBase> ;
+    static constexpr Type WritableMask = 0x70007FC0U ;
+    static constexpr Type ResetValue = 0x20003000U ;
+    using Peripheral = RCC ;
     using FieldValues = RCC_PLLI2SCFGR_PLLI2SNx_Values<RCC::PLLI2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PLLI2SCFGRPack  = Register<0x40023884, 32, ReadWriteMode, RCCPLLI2SCFGRBase, T...> ;
 
+  using Registers = TypesList<RCC::CR, RCC::PLLCFGR, RCC::CFGR, RCC::CIR, RCC::AHB1RSTR, RCC::AHB2RSTR, RCC::APB1RSTR, RCC::APB2RSTR, RCC::AHB1ENR, RCC::AHB2ENR, RCC::APB1ENR, RCC::APB2ENR, RCC::AHB1LPENR, RCC::AHB2LPENR, RCC::APB1LPENR, RCC::APB2LPENR, RCC::BDCR, RCC::CSR, RCC::SSCGR, RCC::PLLI2SCFGR> ;
 } ;
 
 #endif //#if !defined(RCCREGISTERS_HPP)
@@ -0,0 +1,11037 @@
+/*******************************************************************************
+* Filename      : registerdb.hpp
+*
+* Details       : Database of registers and fields with the perfect hash index
+*                 over names. This header file is auto-generated for STM32F411
+*                 device.
+*
+*
+*******************************************************************************/
+
+#if !defined(REGISTERDB_HPP)
+#define REGISTERDB_HPP
+
+#include "registerdatabase.hpp"   //for RegisterDbRegister, RegisterDbField, RegisterDbKey
+
+struct RegisterDb
+{
+  static constexpr const char* Peripherals[] = {
+    "ADC_Common",
+    "ADC1",
+    "CRC",
+    "DBG",
+    "EXTI",
+    "FLASH",
+    "IWDG",
+    "OTG_FS_DEVICE",
+    "OTG_FS_GLOBAL",
+    "OTG_FS_HOST",
+    "OTG_FS_PWRCLK",
+    "PWR",
+    "RCC",
+    "RTC",
+    "SDIO",
+    "SYSCFG",
+    "TIM1",
+    "TIM8",
+    "TIM10",
+    "TIM11",
+    "TIM2",
+    "TIM3",
+    "TIM4",
+    "TIM5",
+    "TIM9",
+    "USART1",
+    "USART2",
+    "USART6",
+    "WWDG",
+    "DMA2",
+    "DMA1",
+    "GPIOH",
+    "GPIOE",
+    "GPIOD",
+    "GPIOC",
+    "GPIOB",
+    "GPIOA",
+    "I2C3",
+    "I2C2",
+    "I2C1",
+    "I2S2ext",
+    "I2S3ext",
+    "SPI1",
+    "SPI2",
+    "SPI3",
+    "SPI4",
+    "SPI5",
+    "NVIC",
+    "FPU",
+    "MPU",
+    "STK",
+    "SCB",
+    "NVIC_STIR",
+    "FPU_CPACR",
+    "SCB_ACTRL",
+  } ;
+
+  static constexpr RegisterDbRegister Registers[] = {
+    {"CSR", 0x40012300U, 0U, 18U, 0U, 32U, RegisterDbAccess::Read},
+    {"CCR", 0x40012304U, 18U, 6U, 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40012000U, 24U, 6U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40012004U, 30U, 14U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40012008U, 44U, 12U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMPR1", 0x4001200CU, 56U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMPR2", 0x40012010U, 57U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"JOFR1", 0x40012014U, 58U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"JOFR2", 0x40012018U, 59U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"JOFR3", 0x4001201CU, 60U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"JOFR4", 0x40012020U, 61U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"HTR", 0x40012024U, 62U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"LTR", 0x40012028U, 63U, 1U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"SQR1", 0x4001202CU, 64U, 5U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"SQR2", 0x40012030U, 69U, 6U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"SQR3", 0x40012034U, 75U, 6U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"JSQR", 0x40012038U, 81U, 5U, 1U, 32U, RegisterDbAccess::ReadWrite},
+    {"JDR1", 0x4001203CU, 86U, 1U, 1U, 32U, RegisterDbAccess::Read},
+    {"JDR2", 0x40012040U, 87U, 1U, 1U, 32U, RegisterDbAccess::Read},
+    {"JDR3", 0x40012044U, 88U, 1U, 1U, 32U, RegisterDbAccess::Read},
+    {"JDR4", 0x40012048U, 89U, 1U, 1U, 32U, RegisterDbAccess::Read},
+    {"DR", 0x4001204CU, 90U, 1U, 1U, 32U, RegisterDbAccess::Read},
+    {"DR", 0x40023000U, 91U, 1U, 2U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40023004U, 92U, 1U, 2U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR", 0x40023008U, 93U, 1U, 2U, 32U, RegisterDbAccess::Write},
+    {"DBGMCU_IDCODE", 0xE0042000U, 94U, 2U, 3U, 32U, RegisterDbAccess::Read},
+    {"DBGMCU_CR", 0xE0042004U, 96U, 5U, 3U, 32U, RegisterDbAccess::ReadWrite},
+    {"DBGMCU_APB1_FZ", 0xE0042008U, 101U, 10U, 3U, 32U, RegisterDbAccess::ReadWrite},
+    {"DBGMCU_APB2_FZ", 0xE004200CU, 111U, 4U, 3U, 32U, RegisterDbAccess::ReadWrite},
+    {"IMR", 0x40013C00U, 115U, 23U, 4U, 32U, RegisterDbAccess::ReadWrite},
+    {"EMR", 0x40013C04U, 138U, 23U, 4U, 32U, RegisterDbAccess::ReadWrite},
+    {"RTSR", 0x40013C08U, 161U, 23U, 4U, 32U, RegisterDbAccess::ReadWrite},
+    {"FTSR", 0x40013C0CU, 184U, 23U, 4U, 32U, RegisterDbAccess::ReadWrite},
+    {"SWIER", 0x40013C10U, 207U, 23U, 4U, 32U, RegisterDbAccess::ReadWrite},
+    {"PR", 0x40013C14U, 230U, 23U, 4U, 32U, RegisterDbAccess::ReadWrite},
+    {"ACR", 0x40023C00U, 253U, 6U, 5U, 32U, RegisterDbAccess::ReadWrite},
+    {"KEYR", 0x40023C04U, 259U, 1U, 5U, 32U, RegisterDbAccess::Write},
+    {"OPTKEYR", 0x40023C08U, 260U, 1U, 5U, 32U, RegisterDbAccess::Write},
+    {"SR", 0x40023C0CU, 261U, 7U, 5U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR", 0x40023C10U, 268U, 9U, 5U, 32U, RegisterDbAccess::ReadWrite},
+    {"OPTCR", 0x40023C14U, 277U, 8U, 5U, 32U, RegisterDbAccess::ReadWrite},
+    {"KR", 0x40003000U, 285U, 1U, 6U, 32U, RegisterDbAccess::Write},
+    {"PR", 0x40003004U, 286U, 1U, 6U, 32U, RegisterDbAccess::ReadWrite},
+    {"RLR", 0x40003008U, 287U, 1U, 6U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x4000300CU, 288U, 2U, 6U, 32U, RegisterDbAccess::Read},
+    {"FS_DCFG", 0x50000800U, 290U, 4U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DCTL", 0x50000804U, 294U, 10U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DSTS", 0x50000808U, 304U, 4U, 7U, 32U, RegisterDbAccess::Read},
+    {"FS_DIEPMSK", 0x50000810U, 308U, 6U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DOEPMSK", 0x50000814U, 314U, 4U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DAINT", 0x50000818U, 318U, 2U, 7U, 32U, RegisterDbAccess::Read},
+    {"FS_DAINTMSK", 0x5000081CU, 320U, 2U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DVBUSDIS", 0x50000828U, 322U, 1U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DVBUSPULSE", 0x5000082CU, 323U, 1U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPEMPMSK", 0x50000834U, 324U, 1U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DIEPCTL0", 0x50000900U, 325U, 10U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPCTL1", 0x50000920U, 335U, 13U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPCTL2", 0x50000940U, 348U, 13U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPCTL3", 0x50000960U, 361U, 13U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPCTL0", 0x50000B00U, 374U, 10U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPCTL1", 0x50000B20U, 384U, 13U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPCTL2", 0x50000B40U, 397U, 13U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPCTL3", 0x50000B60U, 410U, 13U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPINT0", 0x50000908U, 423U, 6U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPINT1", 0x50000928U, 429U, 6U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPINT2", 0x50000948U, 435U, 6U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPINT3", 0x50000968U, 441U, 6U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPINT0", 0x50000B08U, 447U, 5U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPINT1", 0x50000B28U, 452U, 5U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPINT2", 0x50000B48U, 457U, 5U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPINT3", 0x50000B68U, 462U, 5U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPTSIZ0", 0x50000910U, 467U, 2U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPTSIZ0", 0x50000B10U, 469U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPTSIZ1", 0x50000930U, 472U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPTSIZ2", 0x50000950U, 475U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIEPTSIZ3", 0x50000970U, 478U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DTXFSTS0", 0x50000918U, 481U, 1U, 7U, 32U, RegisterDbAccess::Read},
+    {"DTXFSTS1", 0x50000938U, 482U, 1U, 7U, 32U, RegisterDbAccess::Read},
+    {"DTXFSTS2", 0x50000958U, 483U, 1U, 7U, 32U, RegisterDbAccess::Read},
+    {"DTXFSTS3", 0x50000978U, 484U, 1U, 7U, 32U, RegisterDbAccess::Read},
+    {"DOEPTSIZ1", 0x50000B30U, 485U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPTSIZ2", 0x50000B50U, 488U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"DOEPTSIZ3", 0x50000B70U, 491U, 3U, 7U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GOTGCTL", 0x50000000U, 494U, 10U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GOTGINT", 0x50000004U, 504U, 6U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GAHBCFG", 0x50000008U, 510U, 3U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GUSBCFG", 0x5000000CU, 513U, 8U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GRSTCTL", 0x50000010U, 521U, 7U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GINTSTS", 0x50000014U, 528U, 25U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GINTMSK", 0x50000018U, 553U, 25U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GRXSTSR_Device", 0x5000001CU, 578U, 5U, 8U, 32U, RegisterDbAccess::Read},
+    {"FS_GRXSTSR_Host", 0x5000001CU, 583U, 5U, 8U, 32U, RegisterDbAccess::Read},
+    {"FS_GRXFSIZ", 0x50000024U, 588U, 1U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GNPTXFSIZ_Device", 0x50000028U, 589U, 2U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GNPTXFSIZ_Host", 0x50000028U, 591U, 2U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_GNPTXSTS", 0x5000002CU, 593U, 3U, 8U, 32U, RegisterDbAccess::Read},
+    {"FS_GCCFG", 0x50000038U, 596U, 4U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_CID", 0x5000003CU, 600U, 1U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HPTXFSIZ", 0x50000100U, 601U, 2U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DIEPTXF1", 0x50000104U, 603U, 2U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DIEPTXF2", 0x50000108U, 605U, 2U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_DIEPTXF3", 0x5000010CU, 607U, 2U, 8U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCFG", 0x50000400U, 609U, 2U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"HFIR", 0x50000404U, 611U, 1U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HFNUM", 0x50000408U, 612U, 2U, 9U, 32U, RegisterDbAccess::Read},
+    {"FS_HPTXSTS", 0x50000410U, 614U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"HAINT", 0x50000414U, 617U, 1U, 9U, 32U, RegisterDbAccess::Read},
+    {"HAINTMSK", 0x50000418U, 618U, 1U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HPRT", 0x50000440U, 619U, 13U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR0", 0x50000500U, 632U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR1", 0x50000520U, 642U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR2", 0x50000540U, 652U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR3", 0x50000560U, 662U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR4", 0x50000580U, 672U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR5", 0x500005A0U, 682U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR6", 0x500005C0U, 692U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCCHAR7", 0x500005E0U, 702U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT0", 0x50000508U, 712U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT1", 0x50000528U, 721U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT2", 0x50000548U, 730U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT3", 0x50000568U, 739U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT4", 0x50000588U, 748U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT5", 0x500005A8U, 757U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT6", 0x500005C8U, 766U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINT7", 0x500005E8U, 775U, 9U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK0", 0x5000050CU, 784U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK1", 0x5000052CU, 794U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK2", 0x5000054CU, 804U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK3", 0x5000056CU, 814U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK4", 0x5000058CU, 824U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK5", 0x500005ACU, 834U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK6", 0x500005CCU, 844U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCINTMSK7", 0x500005ECU, 854U, 10U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ0", 0x50000510U, 864U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ1", 0x50000530U, 867U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ2", 0x50000550U, 870U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ3", 0x50000570U, 873U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ4", 0x50000590U, 876U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ5", 0x500005B0U, 879U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ6", 0x500005D0U, 882U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_HCTSIZ7", 0x500005F0U, 885U, 3U, 9U, 32U, RegisterDbAccess::ReadWrite},
+    {"FS_PCGCCTL", 0x50000E00U, 888U, 3U, 10U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR", 0x40007000U, 891U, 10U, 11U, 32U, RegisterDbAccess::ReadWrite},
+    {"CSR", 0x40007004U, 901U, 7U, 11U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR", 0x40023800U, 908U, 12U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"PLLCFGR", 0x40023804U, 920U, 22U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"CFGR", 0x40023808U, 942U, 13U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"CIR", 0x4002380CU, 955U, 20U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"AHB1RSTR", 0x40023810U, 975U, 9U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"AHB2RSTR", 0x40023814U, 984U, 1U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"APB1RSTR", 0x40023820U, 985U, 12U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"APB2RSTR", 0x40023824U, 997U, 10U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"AHB1ENR", 0x40023830U, 1007U, 9U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"AHB2ENR", 0x40023834U, 1016U, 1U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"APB1ENR", 0x40023840U, 1017U, 12U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"APB2ENR", 0x40023844U, 1029U, 11U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"AHB1LPENR", 0x40023850U, 1040U, 11U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"AHB2LPENR", 0x40023854U, 1051U, 1U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"APB1LPENR", 0x40023860U, 1052U, 12U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"APB2LPENR", 0x40023864U, 1064U, 11U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"BDCR", 0x40023870U, 1075U, 7U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"CSR", 0x40023874U, 1082U, 10U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"SSCGR", 0x40023880U, 1092U, 4U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"PLLI2SCFGR", 0x40023884U, 1096U, 2U, 12U, 32U, RegisterDbAccess::ReadWrite},
+    {"TR", 0x40002800U, 1098U, 7U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40002804U, 1105U, 7U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR", 0x40002808U, 1112U, 21U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISR", 0x4000280CU, 1133U, 16U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"PRER", 0x40002810U, 1149U, 2U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"WUTR", 0x40002814U, 1151U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"CALIBR", 0x40002818U, 1152U, 2U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"ALRMAR", 0x4000281CU, 1154U, 14U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"ALRMBR", 0x40002820U, 1168U, 14U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"WPR", 0x40002824U, 1182U, 1U, 13U, 32U, RegisterDbAccess::Write},
+    {"SSR", 0x40002828U, 1183U, 1U, 13U, 32U, RegisterDbAccess::Read},
+    {"SHIFTR", 0x4000282CU, 1184U, 2U, 13U, 32U, RegisterDbAccess::Write},
+    {"TSTR", 0x40002830U, 1186U, 7U, 13U, 32U, RegisterDbAccess::Read},
+    {"TSDR", 0x40002834U, 1193U, 5U, 13U, 32U, RegisterDbAccess::Read},
+    {"TSSSR", 0x40002838U, 1198U, 1U, 13U, 32U, RegisterDbAccess::Read},
+    {"CALR", 0x4000283CU, 1199U, 4U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"TAFCR", 0x40002840U, 1203U, 13U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"ALRMASSR", 0x40002844U, 1216U, 2U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"ALRMBSSR", 0x40002848U, 1218U, 2U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP0R", 0x40002850U, 1220U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP1R", 0x40002854U, 1221U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP2R", 0x40002858U, 1222U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP3R", 0x4000285CU, 1223U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP4R", 0x40002860U, 1224U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP5R", 0x40002864U, 1225U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP6R", 0x40002868U, 1226U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP7R", 0x4000286CU, 1227U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP8R", 0x40002870U, 1228U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP9R", 0x40002874U, 1229U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP10R", 0x40002878U, 1230U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP11R", 0x4000287CU, 1231U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP12R", 0x40002880U, 1232U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP13R", 0x40002884U, 1233U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP14R", 0x40002888U, 1234U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP15R", 0x4000288CU, 1235U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP16R", 0x40002890U, 1236U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP17R", 0x40002894U, 1237U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP18R", 0x40002898U, 1238U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP19R", 0x4000289CU, 1239U, 1U, 13U, 32U, RegisterDbAccess::ReadWrite},
+    {"POWER", 0x40012C00U, 1240U, 1U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLKCR", 0x40012C04U, 1241U, 7U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARG", 0x40012C08U, 1248U, 1U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"CMD", 0x40012C0CU, 1249U, 9U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"RESPCMD", 0x40012C10U, 1258U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"RESP1", 0x40012C14U, 1259U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"RESP2", 0x40012C18U, 1260U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"RESP3", 0x40012C1CU, 1261U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"RESP4", 0x40012C20U, 1262U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"DTIMER", 0x40012C24U, 1263U, 1U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"DLEN", 0x40012C28U, 1264U, 1U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCTRL", 0x40012C2CU, 1265U, 9U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCOUNT", 0x40012C30U, 1274U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"STA", 0x40012C34U, 1275U, 24U, 14U, 32U, RegisterDbAccess::Read},
+    {"ICR", 0x40012C38U, 1299U, 13U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"MASK", 0x40012C3CU, 1312U, 24U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"FIFOCNT", 0x40012C48U, 1336U, 1U, 14U, 32U, RegisterDbAccess::Read},
+    {"FIFO", 0x40012C80U, 1337U, 1U, 14U, 32U, RegisterDbAccess::ReadWrite},
+    {"MEMRM", 0x40013800U, 1338U, 1U, 15U, 32U, RegisterDbAccess::ReadWrite},
+    {"PMC", 0x40013804U, 1339U, 1U, 15U, 32U, RegisterDbAccess::ReadWrite},
+    {"EXTICR1", 0x40013808U, 1340U, 4U, 15U, 32U, RegisterDbAccess::ReadWrite},
+    {"EXTICR2", 0x4001380CU, 1344U, 4U, 15U, 32U, RegisterDbAccess::ReadWrite},
+    {"EXTICR3", 0x40013810U, 1348U, 4U, 15U, 32U, RegisterDbAccess::ReadWrite},
+    {"EXTICR4", 0x40013814U, 1352U, 4U, 15U, 32U, RegisterDbAccess::ReadWrite},
+    {"CMPCR", 0x40013820U, 1356U, 2U, 15U, 32U, RegisterDbAccess::Read},
+    {"CR1", 0x40010000U, 1358U, 8U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40010004U, 1366U, 12U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40010008U, 1378U, 7U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4001000CU, 1385U, 15U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40010010U, 1400U, 12U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40010014U, 1412U, 8U, 16U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40010018U, 1420U, 10U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40010018U, 1430U, 6U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Output", 0x4001001CU, 1436U, 10U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Input", 0x4001001CU, 1446U, 6U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40010020U, 1452U, 14U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40010024U, 1466U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40010028U, 1467U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4001002CU, 1468U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40010034U, 1469U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40010038U, 1470U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0x4001003CU, 1471U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0x40010040U, 1472U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCR", 0x40010048U, 1473U, 2U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 0x4001004CU, 1475U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"RCR", 0x40010030U, 1476U, 1U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"BDTR", 0x40010044U, 1477U, 8U, 16U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40010400U, 1485U, 8U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40010404U, 1493U, 12U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40010408U, 1505U, 7U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4001040CU, 1512U, 15U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40010410U, 1527U, 12U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40010414U, 1539U, 8U, 17U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40010418U, 1547U, 10U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40010418U, 1557U, 6U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Output", 0x4001041CU, 1563U, 10U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Input", 0x4001041CU, 1573U, 6U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40010420U, 1579U, 14U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40010424U, 1593U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40010428U, 1594U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4001042CU, 1595U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40010434U, 1596U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40010438U, 1597U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0x4001043CU, 1598U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0x40010440U, 1599U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCR", 0x40010448U, 1600U, 2U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 0x4001044CU, 1602U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"RCR", 0x40010430U, 1603U, 1U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"BDTR", 0x40010444U, 1604U, 8U, 17U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40014400U, 1612U, 5U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4001440CU, 1617U, 2U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40014410U, 1619U, 3U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40014414U, 1622U, 2U, 18U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40014418U, 1624U, 4U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40014418U, 1628U, 3U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40014420U, 1631U, 3U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40014424U, 1634U, 1U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40014428U, 1635U, 1U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4001442CU, 1636U, 1U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40014434U, 1637U, 1U, 18U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40014800U, 1638U, 5U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4001480CU, 1643U, 2U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40014810U, 1645U, 3U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40014814U, 1648U, 2U, 19U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40014818U, 1650U, 4U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40014818U, 1654U, 3U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40014820U, 1657U, 3U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40014824U, 1660U, 1U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40014828U, 1661U, 1U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4001482CU, 1662U, 1U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40014834U, 1663U, 1U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"OR", 0x40014850U, 1664U, 1U, 19U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40000000U, 1665U, 8U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40000004U, 1673U, 3U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40000008U, 1676U, 7U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4000000CU, 1683U, 12U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40000010U, 1695U, 10U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40000014U, 1705U, 6U, 20U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40000018U, 1711U, 10U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40000018U, 1721U, 6U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Output", 0x4000001CU, 1727U, 10U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Input", 0x4000001CU, 1737U, 6U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40000020U, 1743U, 12U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40000024U, 1755U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40000028U, 1757U, 1U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4000002CU, 1758U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40000034U, 1760U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40000038U, 1762U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0x4000003CU, 1764U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0x40000040U, 1766U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCR", 0x40000048U, 1768U, 2U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 0x4000004CU, 1770U, 1U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"OR", 0x40000050U, 1771U, 1U, 20U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40000400U, 1772U, 8U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40000404U, 1780U, 3U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40000408U, 1783U, 7U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4000040CU, 1790U, 12U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40000410U, 1802U, 10U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40000414U, 1812U, 6U, 21U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40000418U, 1818U, 10U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40000418U, 1828U, 6U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Output", 0x4000041CU, 1834U, 10U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Input", 0x4000041CU, 1844U, 6U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40000420U, 1850U, 12U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40000424U, 1862U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40000428U, 1864U, 1U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4000042CU, 1865U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40000434U, 1867U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40000438U, 1869U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0x4000043CU, 1871U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0x40000440U, 1873U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCR", 0x40000448U, 1875U, 2U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 0x4000044CU, 1877U, 1U, 21U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40000800U, 1878U, 8U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40000804U, 1886U, 3U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40000808U, 1889U, 7U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4000080CU, 1896U, 12U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40000810U, 1908U, 10U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40000814U, 1918U, 6U, 22U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40000818U, 1924U, 10U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40000818U, 1934U, 6U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Output", 0x4000081CU, 1940U, 10U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Input", 0x4000081CU, 1950U, 6U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40000820U, 1956U, 12U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40000824U, 1968U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40000828U, 1970U, 1U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4000082CU, 1971U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40000834U, 1973U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40000838U, 1975U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0x4000083CU, 1977U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0x40000840U, 1979U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCR", 0x40000848U, 1981U, 2U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 0x4000084CU, 1983U, 1U, 22U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40000C00U, 1984U, 8U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40000C04U, 1992U, 3U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40000C08U, 1995U, 7U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x40000C0CU, 2002U, 12U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40000C10U, 2014U, 10U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40000C14U, 2024U, 6U, 23U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40000C18U, 2030U, 10U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40000C18U, 2040U, 6U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Output", 0x40000C1CU, 2046U, 10U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR2_Input", 0x40000C1CU, 2056U, 6U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40000C20U, 2062U, 12U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40000C24U, 2074U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40000C28U, 2076U, 1U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x40000C2CU, 2077U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40000C34U, 2079U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40000C38U, 2081U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0x40000C3CU, 2083U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0x40000C40U, 2085U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"DCR", 0x40000C48U, 2087U, 2U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 0x40000C4CU, 2089U, 1U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"OR", 0x40000C50U, 2090U, 1U, 23U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40014000U, 2091U, 6U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40014004U, 2097U, 1U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMCR", 0x40014008U, 2098U, 3U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"DIER", 0x4001400CU, 2101U, 4U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40014010U, 2105U, 6U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"EGR", 0x40014014U, 2111U, 4U, 24U, 32U, RegisterDbAccess::Write},
+    {"CCMR1_Output", 0x40014018U, 2115U, 8U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCMR1_Input", 0x40014018U, 2123U, 6U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCER", 0x40014020U, 2129U, 6U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0x40014024U, 2135U, 1U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0x40014028U, 2136U, 1U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0x4001402CU, 2137U, 1U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0x40014034U, 2138U, 1U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0x40014038U, 2139U, 1U, 24U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40011000U, 2140U, 10U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40011004U, 2150U, 1U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"BRR", 0x40011008U, 2151U, 2U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x4001100CU, 2153U, 15U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40011010U, 2168U, 9U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR3", 0x40011014U, 2177U, 12U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"GTPR", 0x40011018U, 2189U, 2U, 25U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40004400U, 2191U, 10U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40004404U, 2201U, 1U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"BRR", 0x40004408U, 2202U, 2U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x4000440CU, 2204U, 15U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40004410U, 2219U, 9U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR3", 0x40004414U, 2228U, 12U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"GTPR", 0x40004418U, 2240U, 2U, 26U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40011400U, 2242U, 10U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40011404U, 2252U, 1U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"BRR", 0x40011408U, 2253U, 2U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x4001140CU, 2255U, 15U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40011410U, 2270U, 9U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR3", 0x40011414U, 2279U, 12U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"GTPR", 0x40011418U, 2291U, 2U, 27U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR", 0x40002C00U, 2293U, 2U, 28U, 32U, RegisterDbAccess::ReadWrite},
+    {"CFR", 0x40002C04U, 2295U, 4U, 28U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40002C08U, 2299U, 1U, 28U, 32U, RegisterDbAccess::ReadWrite},
+    {"LISR", 0x40026400U, 2300U, 20U, 29U, 32U, RegisterDbAccess::Read},
+    {"HISR", 0x40026404U, 2320U, 20U, 29U, 32U, RegisterDbAccess::Read},
+    {"LIFCR", 0x40026408U, 2340U, 20U, 29U, 32U, RegisterDbAccess::Write},
+    {"HIFCR", 0x4002640CU, 2360U, 20U, 29U, 32U, RegisterDbAccess::Write},
+    {"S0CR", 0x40026410U, 2380U, 19U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0NDTR", 0x40026414U, 2399U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0PAR", 0x40026418U, 2400U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0M0AR", 0x4002641CU, 2401U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0M1AR", 0x40026420U, 2402U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0FCR", 0x40026424U, 2403U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1CR", 0x40026428U, 2407U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1NDTR", 0x4002642CU, 2427U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1PAR", 0x40026430U, 2428U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1M0AR", 0x40026434U, 2429U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1M1AR", 0x40026438U, 2430U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1FCR", 0x4002643CU, 2431U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2CR", 0x40026440U, 2435U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2NDTR", 0x40026444U, 2455U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2PAR", 0x40026448U, 2456U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2M0AR", 0x4002644CU, 2457U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2M1AR", 0x40026450U, 2458U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2FCR", 0x40026454U, 2459U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3CR", 0x40026458U, 2463U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3NDTR", 0x4002645CU, 2483U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3PAR", 0x40026460U, 2484U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3M0AR", 0x40026464U, 2485U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3M1AR", 0x40026468U, 2486U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3FCR", 0x4002646CU, 2487U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4CR", 0x40026470U, 2491U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4NDTR", 0x40026474U, 2511U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4PAR", 0x40026478U, 2512U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4M0AR", 0x4002647CU, 2513U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4M1AR", 0x40026480U, 2514U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4FCR", 0x40026484U, 2515U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5CR", 0x40026488U, 2519U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5NDTR", 0x4002648CU, 2539U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5PAR", 0x40026490U, 2540U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5M0AR", 0x40026494U, 2541U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5M1AR", 0x40026498U, 2542U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5FCR", 0x4002649CU, 2543U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6CR", 0x400264A0U, 2547U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6NDTR", 0x400264A4U, 2567U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6PAR", 0x400264A8U, 2568U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6M0AR", 0x400264ACU, 2569U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6M1AR", 0x400264B0U, 2570U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6FCR", 0x400264B4U, 2571U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7CR", 0x400264B8U, 2575U, 20U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7NDTR", 0x400264BCU, 2595U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7PAR", 0x400264C0U, 2596U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7M0AR", 0x400264C4U, 2597U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7M1AR", 0x400264C8U, 2598U, 1U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7FCR", 0x400264CCU, 2599U, 4U, 29U, 32U, RegisterDbAccess::ReadWrite},
+    {"LISR", 0x40026000U, 2603U, 20U, 30U, 32U, RegisterDbAccess::Read},
+    {"HISR", 0x40026004U, 2623U, 20U, 30U, 32U, RegisterDbAccess::Read},
+    {"LIFCR", 0x40026008U, 2643U, 20U, 30U, 32U, RegisterDbAccess::Write},
+    {"HIFCR", 0x4002600CU, 2663U, 20U, 30U, 32U, RegisterDbAccess::Write},
+    {"S0CR", 0x40026010U, 2683U, 19U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0NDTR", 0x40026014U, 2702U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0PAR", 0x40026018U, 2703U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0M0AR", 0x4002601CU, 2704U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0M1AR", 0x40026020U, 2705U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S0FCR", 0x40026024U, 2706U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1CR", 0x40026028U, 2710U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1NDTR", 0x4002602CU, 2730U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1PAR", 0x40026030U, 2731U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1M0AR", 0x40026034U, 2732U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1M1AR", 0x40026038U, 2733U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S1FCR", 0x4002603CU, 2734U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2CR", 0x40026040U, 2738U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2NDTR", 0x40026044U, 2758U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2PAR", 0x40026048U, 2759U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2M0AR", 0x4002604CU, 2760U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2M1AR", 0x40026050U, 2761U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S2FCR", 0x40026054U, 2762U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3CR", 0x40026058U, 2766U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3NDTR", 0x4002605CU, 2786U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3PAR", 0x40026060U, 2787U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3M0AR", 0x40026064U, 2788U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3M1AR", 0x40026068U, 2789U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S3FCR", 0x4002606CU, 2790U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4CR", 0x40026070U, 2794U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4NDTR", 0x40026074U, 2814U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4PAR", 0x40026078U, 2815U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4M0AR", 0x4002607CU, 2816U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4M1AR", 0x40026080U, 2817U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S4FCR", 0x40026084U, 2818U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5CR", 0x40026088U, 2822U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5NDTR", 0x4002608CU, 2842U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5PAR", 0x40026090U, 2843U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5M0AR", 0x40026094U, 2844U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5M1AR", 0x40026098U, 2845U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S5FCR", 0x4002609CU, 2846U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6CR", 0x400260A0U, 2850U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6NDTR", 0x400260A4U, 2870U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6PAR", 0x400260A8U, 2871U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6M0AR", 0x400260ACU, 2872U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6M1AR", 0x400260B0U, 2873U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S6FCR", 0x400260B4U, 2874U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7CR", 0x400260B8U, 2878U, 20U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7NDTR", 0x400260BCU, 2898U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7PAR", 0x400260C0U, 2899U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7M0AR", 0x400260C4U, 2900U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7M1AR", 0x400260C8U, 2901U, 1U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"S7FCR", 0x400260CCU, 2902U, 4U, 30U, 32U, RegisterDbAccess::ReadWrite},
+    {"MODER", 0x40021C00U, 2906U, 16U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"OTYPER", 0x40021C04U, 2922U, 16U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR", 0x40021C08U, 2938U, 16U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"PUPDR", 0x40021C0CU, 2954U, 16U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40021C10U, 2970U, 16U, 31U, 32U, RegisterDbAccess::Read},
+    {"ODR", 0x40021C14U, 2986U, 16U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"BSRR", 0x40021C18U, 3002U, 32U, 31U, 32U, RegisterDbAccess::Write},
+    {"LCKR", 0x40021C1CU, 3034U, 17U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRL", 0x40021C20U, 3051U, 8U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRH", 0x40021C24U, 3059U, 8U, 31U, 32U, RegisterDbAccess::ReadWrite},
+    {"MODER", 0x40021000U, 3067U, 16U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"OTYPER", 0x40021004U, 3083U, 16U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR", 0x40021008U, 3099U, 16U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"PUPDR", 0x4002100CU, 3115U, 16U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40021010U, 3131U, 16U, 32U, 32U, RegisterDbAccess::Read},
+    {"ODR", 0x40021014U, 3147U, 16U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"BSRR", 0x40021018U, 3163U, 32U, 32U, 32U, RegisterDbAccess::Write},
+    {"LCKR", 0x4002101CU, 3195U, 17U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRL", 0x40021020U, 3212U, 8U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRH", 0x40021024U, 3220U, 8U, 32U, 32U, RegisterDbAccess::ReadWrite},
+    {"MODER", 0x40020C00U, 3228U, 16U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"OTYPER", 0x40020C04U, 3244U, 16U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR", 0x40020C08U, 3260U, 16U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"PUPDR", 0x40020C0CU, 3276U, 16U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40020C10U, 3292U, 16U, 33U, 32U, RegisterDbAccess::Read},
+    {"ODR", 0x40020C14U, 3308U, 16U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"BSRR", 0x40020C18U, 3324U, 32U, 33U, 32U, RegisterDbAccess::Write},
+    {"LCKR", 0x40020C1CU, 3356U, 17U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRL", 0x40020C20U, 3373U, 8U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRH", 0x40020C24U, 3381U, 8U, 33U, 32U, RegisterDbAccess::ReadWrite},
+    {"MODER", 0x40020800U, 3389U, 16U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"OTYPER", 0x40020804U, 3405U, 16U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR", 0x40020808U, 3421U, 16U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"PUPDR", 0x4002080CU, 3437U, 16U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40020810U, 3453U, 16U, 34U, 32U, RegisterDbAccess::Read},
+    {"ODR", 0x40020814U, 3469U, 16U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"BSRR", 0x40020818U, 3485U, 32U, 34U, 32U, RegisterDbAccess::Write},
+    {"LCKR", 0x4002081CU, 3517U, 17U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRL", 0x40020820U, 3534U, 8U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRH", 0x40020824U, 3542U, 8U, 34U, 32U, RegisterDbAccess::ReadWrite},
+    {"MODER", 0x40020400U, 3550U, 16U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"OTYPER", 0x40020404U, 3566U, 16U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR", 0x40020408U, 3582U, 16U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"PUPDR", 0x4002040CU, 3598U, 16U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40020410U, 3614U, 16U, 35U, 32U, RegisterDbAccess::Read},
+    {"ODR", 0x40020414U, 3630U, 16U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"BSRR", 0x40020418U, 3646U, 32U, 35U, 32U, RegisterDbAccess::Write},
+    {"LCKR", 0x4002041CU, 3678U, 17U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRL", 0x40020420U, 3695U, 8U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRH", 0x40020424U, 3703U, 8U, 35U, 32U, RegisterDbAccess::ReadWrite},
+    {"MODER", 0x40020000U, 3711U, 16U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"OTYPER", 0x40020004U, 3727U, 16U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR", 0x40020008U, 3743U, 16U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"PUPDR", 0x4002000CU, 3759U, 16U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0x40020010U, 3775U, 16U, 36U, 32U, RegisterDbAccess::Read},
+    {"ODR", 0x40020014U, 3791U, 16U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"BSRR", 0x40020018U, 3807U, 32U, 36U, 32U, RegisterDbAccess::Write},
+    {"LCKR", 0x4002001CU, 3839U, 17U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRL", 0x40020020U, 3856U, 8U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFRH", 0x40020024U, 3864U, 8U, 36U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40005C00U, 3872U, 14U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40005C04U, 3886U, 6U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"OAR1", 0x40005C08U, 3892U, 4U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"OAR2", 0x40005C0CU, 3896U, 2U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40005C10U, 3898U, 1U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR1", 0x40005C14U, 3899U, 14U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR2", 0x40005C18U, 3913U, 8U, 37U, 32U, RegisterDbAccess::Read},
+    {"CCR", 0x40005C1CU, 3921U, 3U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"TRISE", 0x40005C20U, 3924U, 1U, 37U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40005800U, 3925U, 14U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40005804U, 3939U, 6U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"OAR1", 0x40005808U, 3945U, 4U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"OAR2", 0x4000580CU, 3949U, 2U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40005810U, 3951U, 1U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR1", 0x40005814U, 3952U, 14U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR2", 0x40005818U, 3966U, 8U, 38U, 32U, RegisterDbAccess::Read},
+    {"CCR", 0x4000581CU, 3974U, 3U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"TRISE", 0x40005820U, 3977U, 1U, 38U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40005400U, 3978U, 14U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40005404U, 3992U, 6U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"OAR1", 0x40005408U, 3998U, 4U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"OAR2", 0x4000540CU, 4002U, 2U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40005410U, 4004U, 1U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR1", 0x40005414U, 4005U, 14U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR2", 0x40005418U, 4019U, 8U, 39U, 32U, RegisterDbAccess::Read},
+    {"CCR", 0x4000541CU, 4027U, 3U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"TRISE", 0x40005420U, 4030U, 1U, 39U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40003400U, 4031U, 14U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40003404U, 4045U, 7U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40003408U, 4052U, 9U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x4000340CU, 4061U, 1U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40003410U, 4062U, 1U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40003414U, 4063U, 1U, 40U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40003418U, 4064U, 1U, 40U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x4000341CU, 4065U, 8U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40003420U, 4073U, 3U, 40U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40004000U, 4076U, 14U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40004004U, 4090U, 7U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40004008U, 4097U, 9U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x4000400CU, 4106U, 1U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40004010U, 4107U, 1U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40004014U, 4108U, 1U, 41U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40004018U, 4109U, 1U, 41U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x4000401CU, 4110U, 8U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40004020U, 4118U, 3U, 41U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40013000U, 4121U, 14U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40013004U, 4135U, 7U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40013008U, 4142U, 9U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x4001300CU, 4151U, 1U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40013010U, 4152U, 1U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40013014U, 4153U, 1U, 42U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40013018U, 4154U, 1U, 42U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x4001301CU, 4155U, 8U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40013020U, 4163U, 3U, 42U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40003800U, 4166U, 14U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40003804U, 4180U, 7U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40003808U, 4187U, 9U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x4000380CU, 4196U, 1U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40003810U, 4197U, 1U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40003814U, 4198U, 1U, 43U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40003818U, 4199U, 1U, 43U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x4000381CU, 4200U, 8U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40003820U, 4208U, 3U, 43U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40003C00U, 4211U, 14U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40003C04U, 4225U, 7U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40003C08U, 4232U, 9U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x40003C0CU, 4241U, 1U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40003C10U, 4242U, 1U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40003C14U, 4243U, 1U, 44U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40003C18U, 4244U, 1U, 44U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x40003C1CU, 4245U, 8U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40003C20U, 4253U, 3U, 44U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40013400U, 4256U, 14U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40013404U, 4270U, 7U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40013408U, 4277U, 9U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x4001340CU, 4286U, 1U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40013410U, 4287U, 1U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40013414U, 4288U, 1U, 45U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40013418U, 4289U, 1U, 45U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x4001341CU, 4290U, 8U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40013420U, 4298U, 3U, 45U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR1", 0x40015000U, 4301U, 14U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"CR2", 0x40015004U, 4315U, 7U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"SR", 0x40015008U, 4322U, 9U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"DR", 0x4001500CU, 4331U, 1U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"CRCPR", 0x40015010U, 4332U, 1U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"RXCRCR", 0x40015014U, 4333U, 1U, 46U, 32U, RegisterDbAccess::Read},
+    {"TXCRCR", 0x40015018U, 4334U, 1U, 46U, 32U, RegisterDbAccess::Read},
+    {"I2SCFGR", 0x4001501CU, 4335U, 8U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"I2SPR", 0x40015020U, 4343U, 3U, 46U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISER0", 0xE000E100U, 4346U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISER1", 0xE000E104U, 4347U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISER2", 0xE000E108U, 4348U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ICER0", 0xE000E180U, 4349U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ICER1", 0xE000E184U, 4350U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ICER2", 0xE000E188U, 4351U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISPR0", 0xE000E200U, 4352U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISPR1", 0xE000E204U, 4353U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ISPR2", 0xE000E208U, 4354U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ICPR0", 0xE000E280U, 4355U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ICPR1", 0xE000E284U, 4356U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"ICPR2", 0xE000E288U, 4357U, 1U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IABR0", 0xE000E300U, 4358U, 1U, 47U, 32U, RegisterDbAccess::Read},
+    {"IABR1", 0xE000E304U, 4359U, 1U, 47U, 32U, RegisterDbAccess::Read},
+    {"IABR2", 0xE000E308U, 4360U, 1U, 47U, 32U, RegisterDbAccess::Read},
+    {"IPR0", 0xE000E400U, 4361U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR1", 0xE000E404U, 4365U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR2", 0xE000E408U, 4369U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR3", 0xE000E40CU, 4373U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR4", 0xE000E410U, 4377U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR5", 0xE000E414U, 4381U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR6", 0xE000E418U, 4385U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR7", 0xE000E41CU, 4389U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR8", 0xE000E420U, 4393U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR9", 0xE000E424U, 4397U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR10", 0xE000E428U, 4401U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR11", 0xE000E42CU, 4405U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR12", 0xE000E430U, 4409U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR13", 0xE000E434U, 4413U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR14", 0xE000E438U, 4417U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR15", 0xE000E43CU, 4421U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR16", 0xE000E440U, 4425U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR17", 0xE000E444U, 4429U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR18", 0xE000E448U, 4433U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"IPR19", 0xE000E44CU, 4437U, 4U, 47U, 32U, RegisterDbAccess::ReadWrite},
+    {"FPCCR", 0xE000EF34U, 4441U, 9U, 48U, 32U, RegisterDbAccess::ReadWrite},
+    {"FPCAR", 0xE000EF38U, 4450U, 1U, 48U, 32U, RegisterDbAccess::ReadWrite},
+    {"FPSCR", 0xE000EF3CU, 4451U, 14U, 48U, 32U, RegisterDbAccess::ReadWrite},
+    {"MPU_TYPER", 0xE000ED90U, 4465U, 3U, 49U, 32U, RegisterDbAccess::Read},
+    {"MPU_CTRL", 0xE000ED94U, 4468U, 3U, 49U, 32U, RegisterDbAccess::Read},
+    {"MPU_RNR", 0xE000ED98U, 4471U, 1U, 49U, 32U, RegisterDbAccess::ReadWrite},
+    {"MPU_RBAR", 0xE000ED9CU, 4472U, 3U, 49U, 32U, RegisterDbAccess::ReadWrite},
+    {"MPU_RASR", 0xE000EDA0U, 4475U, 9U, 49U, 32U, RegisterDbAccess::ReadWrite},
+    {"CTRL", 0xE000E010U, 4484U, 4U, 50U, 32U, RegisterDbAccess::ReadWrite},
+    {"LOAD", 0xE000E014U, 4488U, 1U, 50U, 32U, RegisterDbAccess::ReadWrite},
+    {"VAL", 0xE000E018U, 4489U, 1U, 50U, 32U, RegisterDbAccess::ReadWrite},
+    {"CALIB", 0xE000E01CU, 4490U, 3U, 50U, 32U, RegisterDbAccess::ReadWrite},
+    {"CPUID", 0xE000ED00U, 4493U, 5U, 51U, 32U, RegisterDbAccess::Read},
+    {"ICSR", 0xE000ED04U, 4498U, 9U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"VTOR", 0xE000ED08U, 4507U, 1U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"AIRCR", 0xE000ED0CU, 4508U, 6U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"SCR", 0xE000ED10U, 4514U, 3U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"CCR", 0xE000ED14U, 4517U, 6U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"SHPR1", 0xE000ED18U, 4523U, 3U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"SHPR2", 0xE000ED1CU, 4526U, 1U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"SHPR3", 0xE000ED20U, 4527U, 2U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"SHCRS", 0xE000ED24U, 4529U, 14U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"CFSR_UFSR_BFSR_MMFSR", 0xE000ED28U, 4543U, 18U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"HFSR", 0xE000ED2CU, 4561U, 3U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"MMFAR", 0xE000ED34U, 4564U, 1U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"BFAR", 0xE000ED38U, 4565U, 1U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"AFSR", 0xE000ED3CU, 4566U, 1U, 51U, 32U, RegisterDbAccess::ReadWrite},
+    {"STIR", 0xE000EF00U, 4567U, 1U, 52U, 32U, RegisterDbAccess::ReadWrite},
+    {"CPACR", 0xE000ED88U, 4568U, 1U, 53U, 32U, RegisterDbAccess::ReadWrite},
+    {"ACTRL", 0xE000E008U, 4569U, 5U, 54U, 32U, RegisterDbAccess::ReadWrite},
+  } ;
+
+  static constexpr RegisterDbField Fields[] = {
+    {"OVR3", 21U, 1U, RegisterDbAccess::Read},
+    {"STRT3", 20U, 1U, RegisterDbAccess::Read},
+    {"JSTRT3", 19U, 1U, RegisterDbAccess::Read},
+    {"JEOC3", 18U, 1U, RegisterDbAccess::Read},
+    {"EOC3", 17U, 1U, RegisterDbAccess::Read},
+    {"AWD3", 16U, 1U, RegisterDbAccess::Read},
+    {"OVR2", 13U, 1U, RegisterDbAccess::Read},
+    {"STRT2", 12U, 1U, RegisterDbAccess::Read},
+    {"JSTRT2", 11U, 1U, RegisterDbAccess::Read},
+    {"JEOC2", 10U, 1U, RegisterDbAccess::Read},
+    {"EOC2", 9U, 1U, RegisterDbAccess::Read},
+    {"AWD2", 8U, 1U, RegisterDbAccess::Read},
+    {"OVR1", 5U, 1U, RegisterDbAccess::Read},
+    {"STRT1", 4U, 1U, RegisterDbAccess::Read},
+    {"JSTRT1", 3U, 1U, RegisterDbAccess::Read},
+    {"JEOC1", 2U, 1U, RegisterDbAccess::Read},
+    {"EOC1", 1U, 1U, RegisterDbAccess::Read},
+    {"AWD1", 0U, 1U, RegisterDbAccess::Read},
+    {"TSVREFE", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"VBATE", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADCPRE", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"DMA", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"DDS", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"DELAY", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"OVR", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"STRT", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"JSTRT", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"JEOC", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"EOC", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"AWD", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OVRIE", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"RES", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"AWDEN", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"JAWDEN", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISCNUM", 13U, 3U, RegisterDbAccess::ReadWrite},
+    {"JDISCEN", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISCEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"JAUTO", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"AWDSGL", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SCAN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"JEOCIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"AWDIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"EOCIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"AWDCH", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"SWSTART", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"EXTEN", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"EXTSEL", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"JSWSTART", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"JEXTEN", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"JEXTSEL", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"ALIGN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"EOCS", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"DDS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMA", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CONT", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADON", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMPx_x", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SMPx_x", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"JOFFSET1", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"JOFFSET2", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"JOFFSET3", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"JOFFSET4", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"HT", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"LT", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"L", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"SQ16", 15U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ15", 10U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ14", 5U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ13", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ12", 25U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ11", 20U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ10", 15U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ9", 10U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ8", 5U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ7", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ6", 25U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ5", 20U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ4", 15U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ3", 10U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ2", 5U, 5U, RegisterDbAccess::ReadWrite},
+    {"SQ1", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"JL", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"JSQ4", 15U, 5U, RegisterDbAccess::ReadWrite},
+    {"JSQ3", 10U, 5U, RegisterDbAccess::ReadWrite},
+    {"JSQ2", 5U, 5U, RegisterDbAccess::ReadWrite},
+    {"JSQ1", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"JDATA", 0U, 16U, RegisterDbAccess::Read},
+    {"JDATA", 0U, 16U, RegisterDbAccess::Read},
+    {"JDATA", 0U, 16U, RegisterDbAccess::Read},
+    {"JDATA", 0U, 16U, RegisterDbAccess::Read},
+    {"DATA", 0U, 16U, RegisterDbAccess::Read},
+    {"DR", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"IDR", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"CR", 0U, 1U, RegisterDbAccess::Write},
+    {"DEV_ID", 0U, 12U, RegisterDbAccess::Read},
+    {"REV_ID", 16U, 16U, RegisterDbAccess::Read},
+    {"DBG_SLEEP", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_STOP", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_STANDBY", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TRACE_IOEN", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TRACE_MODE", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM2_STOP", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM3_STOP", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM4_STOP", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM5_STOP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_RTC_Stop", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_WWDG_STOP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_IWDEG_STOP", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_I2C1_SMBUS_TIMEOUT", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_I2C2_SMBUS_TIMEOUT", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_I2C3SMBUS_TIMEOUT", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM1_STOP", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM9_STOP", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM10_STOP", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBG_TIM11_STOP", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR16", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR17", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR18", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR19", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR20", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR21", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR22", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR16", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR17", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR18", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR19", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR20", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR21", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"MR22", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR16", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR17", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR18", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR19", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR20", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR21", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR22", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR16", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR17", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR18", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR19", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR20", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR21", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"TR22", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER16", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER17", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER18", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER19", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER20", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER21", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"SWIER22", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR16", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR17", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR18", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR19", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR20", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR21", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"PR22", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"LATENCY", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"PRFTEN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ICEN", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DCEN", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ICRST", 11U, 1U, RegisterDbAccess::Write},
+    {"DCRST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"KEY", 0U, 32U, RegisterDbAccess::Write},
+    {"OPTKEY", 0U, 32U, RegisterDbAccess::Write},
+    {"EOP", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPERR", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"WRPERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"PGAERR", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"PGPERR", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"PGSERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BSY", 16U, 1U, RegisterDbAccess::Read},
+    {"PG", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"SER", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"MER", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"SNB", 3U, 4U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"STRT", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"EOPIE", 24U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"LOCK", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPTLOCK", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPTSTRT", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"BOR_LEV", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"WDG_SW", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"nRST_STOP", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"nRST_STDBY", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RDP", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"nWRP", 16U, 12U, RegisterDbAccess::ReadWrite},
+    {"KEY", 0U, 16U, RegisterDbAccess::Write},
+    {"PR", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"RL", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"RVU", 1U, 1U, RegisterDbAccess::Read},
+    {"PVU", 0U, 1U, RegisterDbAccess::Read},
+    {"DSPD", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"NZLSOHSK", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DAD", 4U, 7U, RegisterDbAccess::ReadWrite},
+    {"PFIVL", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"RWUSIG", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"GINSTS", 2U, 1U, RegisterDbAccess::Read},
+    {"GONSTS", 3U, 1U, RegisterDbAccess::Read},
+    {"TCTL", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SGINAK", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CGINAK", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"SGONAK", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CGONAK", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"POPRGDNE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"SUSPSTS", 0U, 1U, RegisterDbAccess::Read},
+    {"ENUMSPD", 1U, 2U, RegisterDbAccess::Read},
+    {"EERR", 3U, 1U, RegisterDbAccess::Read},
+    {"FNSOF", 8U, 14U, RegisterDbAccess::Read},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TOM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITTXFEMSK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"INEPNMM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"INEPNEM", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STUPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTEPDM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"IEPINT", 0U, 16U, RegisterDbAccess::Read},
+    {"OEPINT", 16U, 16U, RegisterDbAccess::Read},
+    {"IEPM", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"OEPINT", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"VBUSDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DVBUSP", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"INEPTXFEM", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::Read},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::Read},
+    {"STALL", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFNUM", 22U, 4U, RegisterDbAccess::ReadWrite},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::Read},
+    {"EPENA", 31U, 1U, RegisterDbAccess::Read},
+    {"EPENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"SODDFRM_SD1PID", 29U, 1U, RegisterDbAccess::Write},
+    {"SD0PID_SEVNFRM", 28U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"TXFNUM", 22U, 4U, RegisterDbAccess::ReadWrite},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EONUM_DPID", 16U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"SODDFRM", 29U, 1U, RegisterDbAccess::Write},
+    {"SD0PID_SEVNFRM", 28U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"TXFNUM", 22U, 4U, RegisterDbAccess::ReadWrite},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EONUM_DPID", 16U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"SODDFRM", 29U, 1U, RegisterDbAccess::Write},
+    {"SD0PID_SEVNFRM", 28U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"TXFNUM", 22U, 4U, RegisterDbAccess::ReadWrite},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EONUM_DPID", 16U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPENA", 31U, 1U, RegisterDbAccess::Write},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::Read},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"SNPM", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::Read},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::Read},
+    {"MPSIZ", 0U, 2U, RegisterDbAccess::Read},
+    {"EPENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"SODDFRM", 29U, 1U, RegisterDbAccess::Write},
+    {"SD0PID_SEVNFRM", 28U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"SNPM", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EONUM_DPID", 16U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"SODDFRM", 29U, 1U, RegisterDbAccess::Write},
+    {"SD0PID_SEVNFRM", 28U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"SNPM", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EONUM_DPID", 16U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"SODDFRM", 29U, 1U, RegisterDbAccess::Write},
+    {"SD0PID_SEVNFRM", 28U, 1U, RegisterDbAccess::Write},
+    {"SNAK", 27U, 1U, RegisterDbAccess::Write},
+    {"CNAK", 26U, 1U, RegisterDbAccess::Write},
+    {"Stall", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"SNPM", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"NAKSTS", 17U, 1U, RegisterDbAccess::Read},
+    {"EONUM_DPID", 16U, 1U, RegisterDbAccess::Read},
+    {"USBAEP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"TXFE", 7U, 1U, RegisterDbAccess::Read},
+    {"INEPNE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITTXFE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TOC", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFE", 7U, 1U, RegisterDbAccess::Read},
+    {"INEPNE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITTXFE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TOC", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFE", 7U, 1U, RegisterDbAccess::Read},
+    {"INEPNE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITTXFE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TOC", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFE", 7U, 1U, RegisterDbAccess::Read},
+    {"INEPNE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITTXFE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TOC", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"B2BSTUP", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTEPDIS", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"STUP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"B2BSTUP", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTEPDIS", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"STUP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"B2BSTUP", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTEPDIS", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"STUP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"B2BSTUP", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTEPDIS", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"STUP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPDISD", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 7U, RegisterDbAccess::ReadWrite},
+    {"STUPCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 7U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"INEPTFSAV", 0U, 16U, RegisterDbAccess::Read},
+    {"INEPTFSAV", 0U, 16U, RegisterDbAccess::Read},
+    {"INEPTFSAV", 0U, 16U, RegisterDbAccess::Read},
+    {"INEPTFSAV", 0U, 16U, RegisterDbAccess::Read},
+    {"RXDPID_STUPCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"RXDPID_STUPCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"RXDPID_STUPCNT", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"SRQSCS", 0U, 1U, RegisterDbAccess::Read},
+    {"SRQ", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"HNGSCS", 8U, 1U, RegisterDbAccess::Read},
+    {"HNPRQ", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSHNPEN", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"DHNPEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIDSTS", 16U, 1U, RegisterDbAccess::Read},
+    {"DBCT", 17U, 1U, RegisterDbAccess::Read},
+    {"ASVLD", 18U, 1U, RegisterDbAccess::Read},
+    {"BSVLD", 19U, 1U, RegisterDbAccess::Read},
+    {"SEDET", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"SRSSCHG", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"HNSSCHG", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"HNGDET", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADTOCHG", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBCDNE", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"GINT", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFELVL", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PTXFELVL", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TOCAL", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"PHYSEL", 6U, 1U, RegisterDbAccess::Write},
+    {"SRPCAP", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"HNPCAP", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TRDT", 10U, 4U, RegisterDbAccess::ReadWrite},
+    {"FHMOD", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"FDMOD", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTXPKT", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"CSRST", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSRST", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"FCRST", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXFFLSH", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFFLSH", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFNUM", 6U, 5U, RegisterDbAccess::ReadWrite},
+    {"AHBIDL", 31U, 1U, RegisterDbAccess::Read},
+    {"CMOD", 0U, 1U, RegisterDbAccess::Read},
+    {"MMIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTGINT", 2U, 1U, RegisterDbAccess::Read},
+    {"SOF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXFLVL", 4U, 1U, RegisterDbAccess::Read},
+    {"NPTXFE", 5U, 1U, RegisterDbAccess::Read},
+    {"GINAKEFF", 6U, 1U, RegisterDbAccess::Read},
+    {"GOUTNAKEFF", 7U, 1U, RegisterDbAccess::Read},
+    {"ESUSP", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"USBSUSP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"USBRST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENUMDNE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ISOODRP", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"EOPF", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"IEPINT", 18U, 1U, RegisterDbAccess::Read},
+    {"OEPINT", 19U, 1U, RegisterDbAccess::Read},
+    {"IISOIXFR", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"IPXFR_INCOMPISOOUT", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"HPRTINT", 24U, 1U, RegisterDbAccess::Read},
+    {"HCINT", 25U, 1U, RegisterDbAccess::Read},
+    {"PTXFE", 26U, 1U, RegisterDbAccess::Read},
+    {"CIDSCHG", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISCINT", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"SRQINT", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"WKUPINT", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMISM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTGINT", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"SOFM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXFLVLM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"NPTXFEM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"GINAKEFFM", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"GONAKEFFM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ESUSPM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"USBSUSPM", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"USBRST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENUMDNEM", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ISOODRPM", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"EOPFM", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPMISM", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"IEPINT", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"OEPINT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"IISOIXFRM", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"IPXFRM_IISOOXFRM", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRTIM", 24U, 1U, RegisterDbAccess::Read},
+    {"HCIM", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"PTXFEM", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIDSCHGM", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISCINT", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"SRQIM", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"WUIM", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 0U, 4U, RegisterDbAccess::Read},
+    {"BCNT", 4U, 11U, RegisterDbAccess::Read},
+    {"DPID", 15U, 2U, RegisterDbAccess::Read},
+    {"PKTSTS", 17U, 4U, RegisterDbAccess::Read},
+    {"FRMNUM", 21U, 4U, RegisterDbAccess::Read},
+    {"EPNUM", 0U, 4U, RegisterDbAccess::Read},
+    {"BCNT", 4U, 11U, RegisterDbAccess::Read},
+    {"DPID", 15U, 2U, RegisterDbAccess::Read},
+    {"PKTSTS", 17U, 4U, RegisterDbAccess::Read},
+    {"FRMNUM", 21U, 4U, RegisterDbAccess::Read},
+    {"RXFD", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"TX0FSA", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"TX0FD", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"NPTXFSA", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"NPTXFD", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"NPTXFSAV", 0U, 16U, RegisterDbAccess::Read},
+    {"NPTQXSAV", 16U, 8U, RegisterDbAccess::Read},
+    {"NPTXQTOP", 24U, 7U, RegisterDbAccess::Read},
+    {"PWRDWN", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"VBUSASEN", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"VBUSBSEN", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"SOFOUTEN", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRODUCT_ID", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"PTXSA", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PTXFSIZ", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"INEPTXSA", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"INEPTXFD", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"INEPTXSA", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"INEPTXFD", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"INEPTXSA", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"INEPTXFD", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"FSLSPCS", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"FSLSS", 2U, 1U, RegisterDbAccess::Read},
+    {"FRIVL", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"FRNUM", 0U, 16U, RegisterDbAccess::Read},
+    {"FTREM", 16U, 16U, RegisterDbAccess::Read},
+    {"PTXFSAVL", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PTXQSAV", 16U, 8U, RegisterDbAccess::Read},
+    {"PTXQTOP", 24U, 8U, RegisterDbAccess::Read},
+    {"HAINT", 0U, 16U, RegisterDbAccess::Read},
+    {"HAINTM", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PCSTS", 0U, 1U, RegisterDbAccess::Read},
+    {"PCDET", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENA", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENCHNG", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"POCA", 4U, 1U, RegisterDbAccess::Read},
+    {"POCCHNG", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRES", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"PSUSP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRST", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLSTS", 10U, 2U, RegisterDbAccess::Read},
+    {"PPWR", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"PTCTL", 13U, 4U, RegisterDbAccess::ReadWrite},
+    {"PSPD", 17U, 2U, RegisterDbAccess::Read},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MPSIZ", 0U, 11U, RegisterDbAccess::ReadWrite},
+    {"EPNUM", 11U, 4U, RegisterDbAccess::ReadWrite},
+    {"EPDIR", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSDEV", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"EPTYP", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCNT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"DAD", 22U, 7U, RegisterDbAccess::ReadWrite},
+    {"ODDFRM", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHDIS", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHENA", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHH", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERR", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMOR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRCM", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CHHM", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"STALLM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"NAKM", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACKM", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NYET", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXERRM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"BBERRM", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRMORM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTERRM", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"XFRSIZ", 0U, 19U, RegisterDbAccess::ReadWrite},
+    {"PKTCNT", 19U, 10U, RegisterDbAccess::ReadWrite},
+    {"DPID", 29U, 2U, RegisterDbAccess::ReadWrite},
+    {"STPPCLK", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"GATEHCLK", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PHYSUSP", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"VOS", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"ADCDC1", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"FPDS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBP", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLS", 5U, 3U, RegisterDbAccess::ReadWrite},
+    {"PVDE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CSBF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CWUF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"PDDS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LPDS", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"WUF", 0U, 1U, RegisterDbAccess::Read},
+    {"SBF", 1U, 1U, RegisterDbAccess::Read},
+    {"PVDO", 2U, 1U, RegisterDbAccess::Read},
+    {"BRR", 3U, 1U, RegisterDbAccess::Read},
+    {"EWUP", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"BRE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"VOSRDY", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLI2SRDY", 27U, 1U, RegisterDbAccess::Read},
+    {"PLLI2SON", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLRDY", 25U, 1U, RegisterDbAccess::Read},
+    {"PLLON", 24U, 1U, RegisterDbAccess::ReadWrite},
+    {"CSSON", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSEBYP", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSERDY", 17U, 1U, RegisterDbAccess::Read},
+    {"HSEON", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSICAL", 8U, 8U, RegisterDbAccess::Read},
+    {"HSITRIM", 3U, 5U, RegisterDbAccess::ReadWrite},
+    {"HSIRDY", 1U, 1U, RegisterDbAccess::Read},
+    {"HSION", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLQ3", 27U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLQ2", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLQ1", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLQ0", 24U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLSRC", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLP1", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLP0", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN8", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN7", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN6", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN5", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN4", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN3", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN2", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN1", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLN0", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLM5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLM4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLM3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLM2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLM1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLM0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCO2", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MCO2PRE", 27U, 3U, RegisterDbAccess::ReadWrite},
+    {"MCO1PRE", 24U, 3U, RegisterDbAccess::ReadWrite},
+    {"I2SSRC", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCO1", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"RTCPRE", 16U, 5U, RegisterDbAccess::ReadWrite},
+    {"PPRE2", 13U, 3U, RegisterDbAccess::ReadWrite},
+    {"PPRE1", 10U, 3U, RegisterDbAccess::ReadWrite},
+    {"HPRE", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"SWS1", 3U, 1U, RegisterDbAccess::Read},
+    {"SWS0", 2U, 1U, RegisterDbAccess::Read},
+    {"SW1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SW0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CSSC", 23U, 1U, RegisterDbAccess::Write},
+    {"PLLI2SRDYC", 21U, 1U, RegisterDbAccess::Write},
+    {"PLLRDYC", 20U, 1U, RegisterDbAccess::Write},
+    {"HSERDYC", 19U, 1U, RegisterDbAccess::Write},
+    {"HSIRDYC", 18U, 1U, RegisterDbAccess::Write},
+    {"LSERDYC", 17U, 1U, RegisterDbAccess::Write},
+    {"LSIRDYC", 16U, 1U, RegisterDbAccess::Write},
+    {"PLLI2SRDYIE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"PLLRDYIE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSERDYIE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"HSIRDYIE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSERDYIE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSIRDYIE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CSSF", 7U, 1U, RegisterDbAccess::Read},
+    {"PLLI2SRDYF", 5U, 1U, RegisterDbAccess::Read},
+    {"PLLRDYF", 4U, 1U, RegisterDbAccess::Read},
+    {"HSERDYF", 3U, 1U, RegisterDbAccess::Read},
+    {"HSIRDYF", 2U, 1U, RegisterDbAccess::Read},
+    {"LSERDYF", 1U, 1U, RegisterDbAccess::Read},
+    {"LSIRDYF", 0U, 1U, RegisterDbAccess::Read},
+    {"DMA2RST", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMA1RST", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCRST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOHRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOERST", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIODRST", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOCRST", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOBRST", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOARST", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTGFSRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PWRRST", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C3RST", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C2RST", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C1RST", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"UART2RST", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI3RST", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI2RST", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"WWDGRST", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM5RST", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM4RST", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM3RST", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM2RST", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM11RST", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM10RST", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM9RST", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"SYSCFGRST", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI1RST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIORST", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADCRST", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART6RST", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART1RST", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM1RST", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMA2EN", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMA1EN", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOHEN", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOEEN", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIODEN", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOCEN", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOBEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTGFSEN", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PWREN", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C3EN", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C2EN", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C1EN", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART2EN", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI3EN", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI2EN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"WWDGEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM5EN", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM4EN", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM3EN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM2EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM1EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART1EN", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART6EN", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADC1EN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIOEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI1EN", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI4EN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"SYSCFGEN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM9EN", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM10EN", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM11EN", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMA2LPEN", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMA1LPEN", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"SRAM1LPEN", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"FLITFLPEN", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCLPEN", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOHLPEN", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOELPEN", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIODLPEN", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOCLPEN", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOBLPEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"GPIOALPEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OTGFSLPEN", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"PWRLPEN", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C3LPEN", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C2LPEN", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2C1LPEN", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART2LPEN", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI3LPEN", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI2LPEN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"WWDGLPEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM5LPEN", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM4LPEN", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM3LPEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM2LPEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM1LPEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART1LPEN", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"USART6LPEN", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADC1LPEN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIOLPEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI1LPEN", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPI4LPEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"SYSCFGLPEN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM9LPEN", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM10LPEN", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIM11LPEN", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"BDRST", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"RTCEN", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"RTCSEL1", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"RTCSEL0", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSEBYP", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSERDY", 1U, 1U, RegisterDbAccess::Read},
+    {"LSEON", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LPWRRSTF", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"WWDGRSTF", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"WDGRSTF", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"SFTRSTF", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"PORRSTF", 27U, 1U, RegisterDbAccess::ReadWrite},
+    {"PADRSTF", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"BORRSTF", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"RMVF", 24U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSIRDY", 1U, 1U, RegisterDbAccess::Read},
+    {"LSION", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSCGEN", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPREADSEL", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"INCSTEP", 13U, 15U, RegisterDbAccess::ReadWrite},
+    {"MODPER", 0U, 13U, RegisterDbAccess::ReadWrite},
+    {"PLLI2SRx", 28U, 3U, RegisterDbAccess::ReadWrite},
+    {"PLLI2SNx", 6U, 9U, RegisterDbAccess::ReadWrite},
+    {"PM", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"HT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"HU", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"MNT", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"MNU", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"ST", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SU", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"YT", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"YU", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"WDU", 13U, 3U, RegisterDbAccess::ReadWrite},
+    {"MT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"MU", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"DT", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"DU", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"COE", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSEL", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"POL", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"COSEL", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"BKP", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"SUB1H", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD1H", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"TSIE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"WUTIE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALRBIE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALRAIE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"TSE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"WUTE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALRBE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALRAE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DCE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FMT", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BYPSHAD", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"REFCKON", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TSEDGE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"WCKSEL", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"ALRAWF", 0U, 1U, RegisterDbAccess::Read},
+    {"ALRBWF", 1U, 1U, RegisterDbAccess::Read},
+    {"WUTWF", 2U, 1U, RegisterDbAccess::Read},
+    {"SHPF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"INITS", 4U, 1U, RegisterDbAccess::Read},
+    {"RSF", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"INITF", 6U, 1U, RegisterDbAccess::Read},
+    {"INIT", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALRAF", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALRBF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"WUTF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"TSF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"TSOVF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP1F", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP2F", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"RECALPF", 16U, 1U, RegisterDbAccess::Read},
+    {"PREDIV_A", 16U, 7U, RegisterDbAccess::ReadWrite},
+    {"PREDIV_S", 0U, 15U, RegisterDbAccess::ReadWrite},
+    {"WUT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DCS", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"DC", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"MSK4", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"WDSEL", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"DT", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"DU", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK3", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"PM", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"HT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"HU", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK2", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MNT", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"MNU", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK1", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ST", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SU", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK4", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"WDSEL", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"DT", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"DU", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK3", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"PM", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"HT", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"HU", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK2", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MNT", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"MNU", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSK1", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ST", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SU", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"KEY", 0U, 8U, RegisterDbAccess::Write},
+    {"SS", 0U, 16U, RegisterDbAccess::Read},
+    {"ADD1S", 31U, 1U, RegisterDbAccess::Write},
+    {"SUBFS", 0U, 15U, RegisterDbAccess::Write},
+    {"PM", 22U, 1U, RegisterDbAccess::Read},
+    {"HT", 20U, 2U, RegisterDbAccess::Read},
+    {"HU", 16U, 4U, RegisterDbAccess::Read},
+    {"MNT", 12U, 3U, RegisterDbAccess::Read},
+    {"MNU", 8U, 4U, RegisterDbAccess::Read},
+    {"ST", 4U, 3U, RegisterDbAccess::Read},
+    {"SU", 0U, 4U, RegisterDbAccess::Read},
+    {"WDU", 13U, 3U, RegisterDbAccess::Read},
+    {"MT", 12U, 1U, RegisterDbAccess::Read},
+    {"MU", 8U, 4U, RegisterDbAccess::Read},
+    {"DT", 4U, 2U, RegisterDbAccess::Read},
+    {"DU", 0U, 4U, RegisterDbAccess::Read},
+    {"SS", 0U, 16U, RegisterDbAccess::Read},
+    {"CALP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"CALW8", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CALW16", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CALM", 0U, 9U, RegisterDbAccess::ReadWrite},
+    {"ALARMOUTTYPE", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"TSINSEL", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP1INSEL", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMPPUDIS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMPPRCH", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"TAMPFLT", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"TAMPFREQ", 8U, 3U, RegisterDbAccess::ReadWrite},
+    {"TAMPTS", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP2TRG", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP2E", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMPIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP1TRG", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"TAMP1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MASKSS", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"SS", 0U, 15U, RegisterDbAccess::ReadWrite},
+    {"MASKSS", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"SS", 0U, 15U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BKP", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"PWRCTRL", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"HWFC_EN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"NEGEDGE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"WIDBUS", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"BYPASS", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PWRSAV", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CLKEN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CLKDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"CMDARG", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CE_ATACMD", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"nIEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENCMDcompl", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIOSuspend", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPSMEN", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"WAITPEND", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"WAITINT", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"WAITRESP", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"CMDINDEX", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"RESPCMD", 0U, 6U, RegisterDbAccess::Read},
+    {"CARDSTATUS1", 0U, 32U, RegisterDbAccess::Read},
+    {"CARDSTATUS2", 0U, 32U, RegisterDbAccess::Read},
+    {"CARDSTATUS3", 0U, 32U, RegisterDbAccess::Read},
+    {"CARDSTATUS4", 0U, 32U, RegisterDbAccess::Read},
+    {"DATATIME", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"DATALENGTH", 0U, 25U, RegisterDbAccess::ReadWrite},
+    {"SDIOEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RWMOD", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"RWSTOP", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"RWSTART", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBLOCKSIZE", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"DMAEN", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTMODE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTDIR", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATACOUNT", 0U, 25U, RegisterDbAccess::Read},
+    {"CEATAEND", 23U, 1U, RegisterDbAccess::Read},
+    {"SDIOIT", 22U, 1U, RegisterDbAccess::Read},
+    {"RXDAVL", 21U, 1U, RegisterDbAccess::Read},
+    {"TXDAVL", 20U, 1U, RegisterDbAccess::Read},
+    {"RXFIFOE", 19U, 1U, RegisterDbAccess::Read},
+    {"TXFIFOE", 18U, 1U, RegisterDbAccess::Read},
+    {"RXFIFOF", 17U, 1U, RegisterDbAccess::Read},
+    {"TXFIFOF", 16U, 1U, RegisterDbAccess::Read},
+    {"RXFIFOHF", 15U, 1U, RegisterDbAccess::Read},
+    {"TXFIFOHE", 14U, 1U, RegisterDbAccess::Read},
+    {"RXACT", 13U, 1U, RegisterDbAccess::Read},
+    {"TXACT", 12U, 1U, RegisterDbAccess::Read},
+    {"CMDACT", 11U, 1U, RegisterDbAccess::Read},
+    {"DBCKEND", 10U, 1U, RegisterDbAccess::Read},
+    {"STBITERR", 9U, 1U, RegisterDbAccess::Read},
+    {"DATAEND", 8U, 1U, RegisterDbAccess::Read},
+    {"CMDSENT", 7U, 1U, RegisterDbAccess::Read},
+    {"CMDREND", 6U, 1U, RegisterDbAccess::Read},
+    {"RXOVERR", 5U, 1U, RegisterDbAccess::Read},
+    {"TXUNDERR", 4U, 1U, RegisterDbAccess::Read},
+    {"DTIMEOUT", 3U, 1U, RegisterDbAccess::Read},
+    {"CTIMEOUT", 2U, 1U, RegisterDbAccess::Read},
+    {"DCRCFAIL", 1U, 1U, RegisterDbAccess::Read},
+    {"CCRCFAIL", 0U, 1U, RegisterDbAccess::Read},
+    {"CEATAENDC", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIOITC", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBCKENDC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"STBITERRC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATAENDC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMDSENTC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMDRENDC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXOVERRC", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXUNDERRC", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTIMEOUTC", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTIMEOUTC", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DCRCFAILC", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCRCFAILC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEATAENDIE", 23U, 1U, RegisterDbAccess::ReadWrite},
+    {"SDIOITIE", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDAVLIE", 21U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDAVLIE", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXFIFOEIE", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFIFOEIE", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXFIFOFIE", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFIFOFIE", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXFIFOHFIE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXFIFOHEIE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXACTIE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXACTIE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMDACTIE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBCKENDIE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"STBITERRIE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATAENDIE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMDSENTIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMDRENDIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXOVERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXUNDERRIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"DTIMEOUTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTIMEOUTIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DCRCFAILIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCRCFAILIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"FIFOCOUNT", 0U, 24U, RegisterDbAccess::Read},
+    {"FIFOData", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"MEM_MODE", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"ADC1DC2", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"EXTI3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI7", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI6", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI5", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI4", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI15", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI14", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI13", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"EXTI12", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"READY", 8U, 1U, RegisterDbAccess::Read},
+    {"CMP_PD", 0U, 1U, RegisterDbAccess::Read},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMS", 5U, 2U, RegisterDbAccess::ReadWrite},
+    {"DIR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS4", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS3N", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS3", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS2N", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS2", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS1N", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS1", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TI1S", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"CCDS", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCUS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCPC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ECE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETPS", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"ETF", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TDE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"COMDE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4DE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3DE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2DE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1DE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"COMIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4OF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3OF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIF", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"COMIF", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BG", 7U, 1U, RegisterDbAccess::Write},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"COMG", 5U, 1U, RegisterDbAccess::Write},
+    {"CC4G", 4U, 1U, RegisterDbAccess::Write},
+    {"CC3G", 3U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC4CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC4PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC3CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC3PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC4F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC4PSC", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC3F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC3PSC", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4P", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4E", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3P", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3E", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DBL", 8U, 5U, RegisterDbAccess::ReadWrite},
+    {"DBA", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"DMAB", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"REP", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"MOE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"AOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"BKP", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"BKE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSSR", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSSI", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LOCK", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"DTG", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMS", 5U, 2U, RegisterDbAccess::ReadWrite},
+    {"DIR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS4", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS3N", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS3", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS2N", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS2", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS1N", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OIS1", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TI1S", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"CCDS", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCUS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCPC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ECE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETPS", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"ETF", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TDE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"COMDE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4DE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3DE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2DE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1DE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"COMIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4OF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3OF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIF", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"COMIF", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BG", 7U, 1U, RegisterDbAccess::Write},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"COMG", 5U, 1U, RegisterDbAccess::Write},
+    {"CC4G", 4U, 1U, RegisterDbAccess::Write},
+    {"CC3G", 3U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC4CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC4PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC3CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC3PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC4F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC4PSC", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC3F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC3PSC", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4P", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4E", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3P", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3E", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DBL", 8U, 5U, RegisterDbAccess::ReadWrite},
+    {"DBA", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"DMAB", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"REP", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"MOE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"AOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"BKP", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"BKE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSSR", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSSI", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LOCK", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"DTG", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RMP", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMS", 5U, 2U, RegisterDbAccess::ReadWrite},
+    {"DIR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TI1S", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"CCDS", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ECE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETPS", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"ETF", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TDE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4DE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3DE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2DE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1DE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4OF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3OF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"CC4G", 4U, 1U, RegisterDbAccess::Write},
+    {"CC3G", 3U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"O24CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC4PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC3CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC3PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC4F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC4PSC", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC3F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC3PSC", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4NP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4P", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4E", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3P", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3E", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CNT_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DBL", 8U, 5U, RegisterDbAccess::ReadWrite},
+    {"DBA", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"DMAB", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ITR1_RMP", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMS", 5U, 2U, RegisterDbAccess::ReadWrite},
+    {"DIR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TI1S", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"CCDS", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ECE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETPS", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"ETF", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TDE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4DE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3DE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2DE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1DE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4OF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3OF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"CC4G", 4U, 1U, RegisterDbAccess::Write},
+    {"CC3G", 3U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"O24CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC4PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC3CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC3PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC4F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC4PSC", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC3F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC3PSC", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4NP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4P", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4E", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3P", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3E", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CNT_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DBL", 8U, 5U, RegisterDbAccess::ReadWrite},
+    {"DBA", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"DMAB", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMS", 5U, 2U, RegisterDbAccess::ReadWrite},
+    {"DIR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TI1S", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"CCDS", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ECE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETPS", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"ETF", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TDE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4DE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3DE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2DE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1DE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4OF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3OF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"CC4G", 4U, 1U, RegisterDbAccess::Write},
+    {"CC3G", 3U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"O24CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC4PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC3CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC3PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC4F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC4PSC", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC3F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC3PSC", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4NP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4P", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4E", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3P", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3E", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CNT_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DBL", 8U, 5U, RegisterDbAccess::ReadWrite},
+    {"DBA", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"DMAB", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CMS", 5U, 2U, RegisterDbAccess::ReadWrite},
+    {"DIR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TI1S", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"CCDS", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ECE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ETPS", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"ETF", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TDE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4DE", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3DE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2DE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1DE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4OF", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3OF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4IF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3IF", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"CC4G", 4U, 1U, RegisterDbAccess::Write},
+    {"CC3G", 3U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"O24CE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC4PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC4FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC3CE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC3PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC3FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC4F", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC4PSC", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC3F", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"IC3PSC", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC3S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC4NP", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4P", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC4E", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3NP", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3P", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC3E", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CNT_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR3_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_H", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR4_L", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"DBL", 8U, 5U, RegisterDbAccess::ReadWrite},
+    {"DBA", 0U, 5U, RegisterDbAccess::ReadWrite},
+    {"DMAB", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"IT4_RMP", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKD", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ARPE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OPM", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"URS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDIS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSM", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TS", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"SMS", 0U, 3U, RegisterDbAccess::ReadWrite},
+    {"TIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2OF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1OF", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIF", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2IF", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1IF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TG", 6U, 1U, RegisterDbAccess::Write},
+    {"CC2G", 2U, 1U, RegisterDbAccess::Write},
+    {"CC1G", 1U, 1U, RegisterDbAccess::Write},
+    {"UG", 0U, 1U, RegisterDbAccess::Write},
+    {"OC2M", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC2PE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC2FE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OC1M", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"OC1PE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OC1FE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC2F", 12U, 3U, RegisterDbAccess::ReadWrite},
+    {"IC2PCS", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2S", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"IC1F", 4U, 3U, RegisterDbAccess::ReadWrite},
+    {"ICPCS", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC1S", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CC2NP", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2P", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC2E", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1NP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1P", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CC1E", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"CNT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"ARR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR1", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CCR2", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CTS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXE", 7U, 1U, RegisterDbAccess::Read},
+    {"TC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDLE", 4U, 1U, RegisterDbAccess::Read},
+    {"ORE", 3U, 1U, RegisterDbAccess::Read},
+    {"NF", 2U, 1U, RegisterDbAccess::Read},
+    {"FE", 1U, 1U, RegisterDbAccess::Read},
+    {"PE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 9U, RegisterDbAccess::ReadWrite},
+    {"DIV_Mantissa", 4U, 12U, RegisterDbAccess::ReadWrite},
+    {"DIV_Fraction", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"OVER8", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"UE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"M", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"WAKE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"PCE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"PEIE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDLEIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"RE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"RWU", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SBK", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LINEN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"STOP", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"CLKEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBCL", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBDIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBDL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"ONEBIT", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTSIE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTSE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"RTSE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAT", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"SCEN", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NACK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HDSEL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"IRLP", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"IREN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"GT", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"CTS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXE", 7U, 1U, RegisterDbAccess::Read},
+    {"TC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDLE", 4U, 1U, RegisterDbAccess::Read},
+    {"ORE", 3U, 1U, RegisterDbAccess::Read},
+    {"NF", 2U, 1U, RegisterDbAccess::Read},
+    {"FE", 1U, 1U, RegisterDbAccess::Read},
+    {"PE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 9U, RegisterDbAccess::ReadWrite},
+    {"DIV_Mantissa", 4U, 12U, RegisterDbAccess::ReadWrite},
+    {"DIV_Fraction", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"OVER8", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"UE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"M", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"WAKE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"PCE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"PEIE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDLEIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"RE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"RWU", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SBK", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LINEN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"STOP", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"CLKEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBCL", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBDIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBDL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"ONEBIT", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTSIE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTSE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"RTSE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAT", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"SCEN", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NACK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HDSEL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"IRLP", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"IREN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"GT", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"CTS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXE", 7U, 1U, RegisterDbAccess::Read},
+    {"TC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDLE", 4U, 1U, RegisterDbAccess::Read},
+    {"ORE", 3U, 1U, RegisterDbAccess::Read},
+    {"NF", 2U, 1U, RegisterDbAccess::Read},
+    {"FE", 1U, 1U, RegisterDbAccess::Read},
+    {"PE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 9U, RegisterDbAccess::ReadWrite},
+    {"DIV_Mantissa", 4U, 12U, RegisterDbAccess::ReadWrite},
+    {"DIV_Fraction", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"OVER8", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"UE", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"M", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"WAKE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"PCE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PS", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"PEIE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDLEIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"TE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"RE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"RWU", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SBK", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LINEN", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"STOP", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"CLKEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBCL", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBDIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LBDL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"ONEBIT", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTSIE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"CTSE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"RTSE", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAT", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAR", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"SCEN", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"NACK", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HDSEL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"IRLP", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"IREN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EIE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"GT", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"PSC", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"WDGA", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"T", 0U, 7U, RegisterDbAccess::ReadWrite},
+    {"EWI", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"WDGTB1", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"WDGTB0", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"W", 0U, 7U, RegisterDbAccess::ReadWrite},
+    {"EWIF", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIF3", 27U, 1U, RegisterDbAccess::Read},
+    {"HTIF3", 26U, 1U, RegisterDbAccess::Read},
+    {"TEIF3", 25U, 1U, RegisterDbAccess::Read},
+    {"DMEIF3", 24U, 1U, RegisterDbAccess::Read},
+    {"FEIF3", 22U, 1U, RegisterDbAccess::Read},
+    {"TCIF2", 21U, 1U, RegisterDbAccess::Read},
+    {"HTIF2", 20U, 1U, RegisterDbAccess::Read},
+    {"TEIF2", 19U, 1U, RegisterDbAccess::Read},
+    {"DMEIF2", 18U, 1U, RegisterDbAccess::Read},
+    {"FEIF2", 16U, 1U, RegisterDbAccess::Read},
+    {"TCIF1", 11U, 1U, RegisterDbAccess::Read},
+    {"HTIF1", 10U, 1U, RegisterDbAccess::Read},
+    {"TEIF1", 9U, 1U, RegisterDbAccess::Read},
+    {"DMEIF1", 8U, 1U, RegisterDbAccess::Read},
+    {"FEIF1", 6U, 1U, RegisterDbAccess::Read},
+    {"TCIF0", 5U, 1U, RegisterDbAccess::Read},
+    {"HTIF0", 4U, 1U, RegisterDbAccess::Read},
+    {"TEIF0", 3U, 1U, RegisterDbAccess::Read},
+    {"DMEIF0", 2U, 1U, RegisterDbAccess::Read},
+    {"FEIF0", 0U, 1U, RegisterDbAccess::Read},
+    {"TCIF7", 27U, 1U, RegisterDbAccess::Read},
+    {"HTIF7", 26U, 1U, RegisterDbAccess::Read},
+    {"TEIF7", 25U, 1U, RegisterDbAccess::Read},
+    {"DMEIF7", 24U, 1U, RegisterDbAccess::Read},
+    {"FEIF7", 22U, 1U, RegisterDbAccess::Read},
+    {"TCIF6", 21U, 1U, RegisterDbAccess::Read},
+    {"HTIF6", 20U, 1U, RegisterDbAccess::Read},
+    {"TEIF6", 19U, 1U, RegisterDbAccess::Read},
+    {"DMEIF6", 18U, 1U, RegisterDbAccess::Read},
+    {"FEIF6", 16U, 1U, RegisterDbAccess::Read},
+    {"TCIF5", 11U, 1U, RegisterDbAccess::Read},
+    {"HTIF5", 10U, 1U, RegisterDbAccess::Read},
+    {"TEIF5", 9U, 1U, RegisterDbAccess::Read},
+    {"DMEIF5", 8U, 1U, RegisterDbAccess::Read},
+    {"FEIF5", 6U, 1U, RegisterDbAccess::Read},
+    {"TCIF4", 5U, 1U, RegisterDbAccess::Read},
+    {"HTIF4", 4U, 1U, RegisterDbAccess::Read},
+    {"TEIF4", 3U, 1U, RegisterDbAccess::Read},
+    {"DMEIF4", 2U, 1U, RegisterDbAccess::Read},
+    {"FEIF4", 0U, 1U, RegisterDbAccess::Read},
+    {"CTCIF3", 27U, 1U, RegisterDbAccess::Write},
+    {"CHTIF3", 26U, 1U, RegisterDbAccess::Write},
+    {"CTEIF3", 25U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF3", 24U, 1U, RegisterDbAccess::Write},
+    {"CFEIF3", 22U, 1U, RegisterDbAccess::Write},
+    {"CTCIF2", 21U, 1U, RegisterDbAccess::Write},
+    {"CHTIF2", 20U, 1U, RegisterDbAccess::Write},
+    {"CTEIF2", 19U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF2", 18U, 1U, RegisterDbAccess::Write},
+    {"CFEIF2", 16U, 1U, RegisterDbAccess::Write},
+    {"CTCIF1", 11U, 1U, RegisterDbAccess::Write},
+    {"CHTIF1", 10U, 1U, RegisterDbAccess::Write},
+    {"CTEIF1", 9U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF1", 8U, 1U, RegisterDbAccess::Write},
+    {"CFEIF1", 6U, 1U, RegisterDbAccess::Write},
+    {"CTCIF0", 5U, 1U, RegisterDbAccess::Write},
+    {"CHTIF0", 4U, 1U, RegisterDbAccess::Write},
+    {"CTEIF0", 3U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF0", 2U, 1U, RegisterDbAccess::Write},
+    {"CFEIF0", 0U, 1U, RegisterDbAccess::Write},
+    {"CTCIF7", 27U, 1U, RegisterDbAccess::Write},
+    {"CHTIF7", 26U, 1U, RegisterDbAccess::Write},
+    {"CTEIF7", 25U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF7", 24U, 1U, RegisterDbAccess::Write},
+    {"CFEIF7", 22U, 1U, RegisterDbAccess::Write},
+    {"CTCIF6", 21U, 1U, RegisterDbAccess::Write},
+    {"CHTIF6", 20U, 1U, RegisterDbAccess::Write},
+    {"CTEIF6", 19U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF6", 18U, 1U, RegisterDbAccess::Write},
+    {"CFEIF6", 16U, 1U, RegisterDbAccess::Write},
+    {"CTCIF5", 11U, 1U, RegisterDbAccess::Write},
+    {"CHTIF5", 10U, 1U, RegisterDbAccess::Write},
+    {"CTEIF5", 9U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF5", 8U, 1U, RegisterDbAccess::Write},
+    {"CFEIF5", 6U, 1U, RegisterDbAccess::Write},
+    {"CTCIF4", 5U, 1U, RegisterDbAccess::Write},
+    {"CHTIF4", 4U, 1U, RegisterDbAccess::Write},
+    {"CTEIF4", 3U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF4", 2U, 1U, RegisterDbAccess::Write},
+    {"CFEIF4", 0U, 1U, RegisterDbAccess::Write},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"TCIF3", 27U, 1U, RegisterDbAccess::Read},
+    {"HTIF3", 26U, 1U, RegisterDbAccess::Read},
+    {"TEIF3", 25U, 1U, RegisterDbAccess::Read},
+    {"DMEIF3", 24U, 1U, RegisterDbAccess::Read},
+    {"FEIF3", 22U, 1U, RegisterDbAccess::Read},
+    {"TCIF2", 21U, 1U, RegisterDbAccess::Read},
+    {"HTIF2", 20U, 1U, RegisterDbAccess::Read},
+    {"TEIF2", 19U, 1U, RegisterDbAccess::Read},
+    {"DMEIF2", 18U, 1U, RegisterDbAccess::Read},
+    {"FEIF2", 16U, 1U, RegisterDbAccess::Read},
+    {"TCIF1", 11U, 1U, RegisterDbAccess::Read},
+    {"HTIF1", 10U, 1U, RegisterDbAccess::Read},
+    {"TEIF1", 9U, 1U, RegisterDbAccess::Read},
+    {"DMEIF1", 8U, 1U, RegisterDbAccess::Read},
+    {"FEIF1", 6U, 1U, RegisterDbAccess::Read},
+    {"TCIF0", 5U, 1U, RegisterDbAccess::Read},
+    {"HTIF0", 4U, 1U, RegisterDbAccess::Read},
+    {"TEIF0", 3U, 1U, RegisterDbAccess::Read},
+    {"DMEIF0", 2U, 1U, RegisterDbAccess::Read},
+    {"FEIF0", 0U, 1U, RegisterDbAccess::Read},
+    {"TCIF7", 27U, 1U, RegisterDbAccess::Read},
+    {"HTIF7", 26U, 1U, RegisterDbAccess::Read},
+    {"TEIF7", 25U, 1U, RegisterDbAccess::Read},
+    {"DMEIF7", 24U, 1U, RegisterDbAccess::Read},
+    {"FEIF7", 22U, 1U, RegisterDbAccess::Read},
+    {"TCIF6", 21U, 1U, RegisterDbAccess::Read},
+    {"HTIF6", 20U, 1U, RegisterDbAccess::Read},
+    {"TEIF6", 19U, 1U, RegisterDbAccess::Read},
+    {"DMEIF6", 18U, 1U, RegisterDbAccess::Read},
+    {"FEIF6", 16U, 1U, RegisterDbAccess::Read},
+    {"TCIF5", 11U, 1U, RegisterDbAccess::Read},
+    {"HTIF5", 10U, 1U, RegisterDbAccess::Read},
+    {"TEIF5", 9U, 1U, RegisterDbAccess::Read},
+    {"DMEIF5", 8U, 1U, RegisterDbAccess::Read},
+    {"FEIF5", 6U, 1U, RegisterDbAccess::Read},
+    {"TCIF4", 5U, 1U, RegisterDbAccess::Read},
+    {"HTIF4", 4U, 1U, RegisterDbAccess::Read},
+    {"TEIF4", 3U, 1U, RegisterDbAccess::Read},
+    {"DMEIF4", 2U, 1U, RegisterDbAccess::Read},
+    {"FEIF4", 0U, 1U, RegisterDbAccess::Read},
+    {"CTCIF3", 27U, 1U, RegisterDbAccess::Write},
+    {"CHTIF3", 26U, 1U, RegisterDbAccess::Write},
+    {"CTEIF3", 25U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF3", 24U, 1U, RegisterDbAccess::Write},
+    {"CFEIF3", 22U, 1U, RegisterDbAccess::Write},
+    {"CTCIF2", 21U, 1U, RegisterDbAccess::Write},
+    {"CHTIF2", 20U, 1U, RegisterDbAccess::Write},
+    {"CTEIF2", 19U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF2", 18U, 1U, RegisterDbAccess::Write},
+    {"CFEIF2", 16U, 1U, RegisterDbAccess::Write},
+    {"CTCIF1", 11U, 1U, RegisterDbAccess::Write},
+    {"CHTIF1", 10U, 1U, RegisterDbAccess::Write},
+    {"CTEIF1", 9U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF1", 8U, 1U, RegisterDbAccess::Write},
+    {"CFEIF1", 6U, 1U, RegisterDbAccess::Write},
+    {"CTCIF0", 5U, 1U, RegisterDbAccess::Write},
+    {"CHTIF0", 4U, 1U, RegisterDbAccess::Write},
+    {"CTEIF0", 3U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF0", 2U, 1U, RegisterDbAccess::Write},
+    {"CFEIF0", 0U, 1U, RegisterDbAccess::Write},
+    {"CTCIF7", 27U, 1U, RegisterDbAccess::Write},
+    {"CHTIF7", 26U, 1U, RegisterDbAccess::Write},
+    {"CTEIF7", 25U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF7", 24U, 1U, RegisterDbAccess::Write},
+    {"CFEIF7", 22U, 1U, RegisterDbAccess::Write},
+    {"CTCIF6", 21U, 1U, RegisterDbAccess::Write},
+    {"CHTIF6", 20U, 1U, RegisterDbAccess::Write},
+    {"CTEIF6", 19U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF6", 18U, 1U, RegisterDbAccess::Write},
+    {"CFEIF6", 16U, 1U, RegisterDbAccess::Write},
+    {"CTCIF5", 11U, 1U, RegisterDbAccess::Write},
+    {"CHTIF5", 10U, 1U, RegisterDbAccess::Write},
+    {"CTEIF5", 9U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF5", 8U, 1U, RegisterDbAccess::Write},
+    {"CFEIF5", 6U, 1U, RegisterDbAccess::Write},
+    {"CTCIF4", 5U, 1U, RegisterDbAccess::Write},
+    {"CHTIF4", 4U, 1U, RegisterDbAccess::Write},
+    {"CTEIF4", 3U, 1U, RegisterDbAccess::Write},
+    {"CDMEIF4", 2U, 1U, RegisterDbAccess::Write},
+    {"CFEIF4", 0U, 1U, RegisterDbAccess::Write},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHSEL", 25U, 3U, RegisterDbAccess::ReadWrite},
+    {"MBURST", 23U, 2U, RegisterDbAccess::ReadWrite},
+    {"PBURST", 21U, 2U, RegisterDbAccess::ReadWrite},
+    {"ACK", 20U, 1U, RegisterDbAccess::ReadWrite},
+    {"CT", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"DBM", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"PL", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PINCOS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSIZE", 13U, 2U, RegisterDbAccess::ReadWrite},
+    {"PSIZE", 11U, 2U, RegisterDbAccess::ReadWrite},
+    {"MINC", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"PINC", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"CIRC", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIR", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PFCTRL", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"TCIE", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"HTIE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEIE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMEIE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"EN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"NDT", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"PA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M0A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"M1A", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"FEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"FS", 3U, 3U, RegisterDbAccess::Read},
+    {"DMDIS", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"FTH", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OT15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IDR15", 15U, 1U, RegisterDbAccess::Read},
+    {"IDR14", 14U, 1U, RegisterDbAccess::Read},
+    {"IDR13", 13U, 1U, RegisterDbAccess::Read},
+    {"IDR12", 12U, 1U, RegisterDbAccess::Read},
+    {"IDR11", 11U, 1U, RegisterDbAccess::Read},
+    {"IDR10", 10U, 1U, RegisterDbAccess::Read},
+    {"IDR9", 9U, 1U, RegisterDbAccess::Read},
+    {"IDR8", 8U, 1U, RegisterDbAccess::Read},
+    {"IDR7", 7U, 1U, RegisterDbAccess::Read},
+    {"IDR6", 6U, 1U, RegisterDbAccess::Read},
+    {"IDR5", 5U, 1U, RegisterDbAccess::Read},
+    {"IDR4", 4U, 1U, RegisterDbAccess::Read},
+    {"IDR3", 3U, 1U, RegisterDbAccess::Read},
+    {"IDR2", 2U, 1U, RegisterDbAccess::Read},
+    {"IDR1", 1U, 1U, RegisterDbAccess::Read},
+    {"IDR0", 0U, 1U, RegisterDbAccess::Read},
+    {"ODR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR15", 31U, 1U, RegisterDbAccess::Write},
+    {"BR14", 30U, 1U, RegisterDbAccess::Write},
+    {"BR13", 29U, 1U, RegisterDbAccess::Write},
+    {"BR12", 28U, 1U, RegisterDbAccess::Write},
+    {"BR11", 27U, 1U, RegisterDbAccess::Write},
+    {"BR10", 26U, 1U, RegisterDbAccess::Write},
+    {"BR9", 25U, 1U, RegisterDbAccess::Write},
+    {"BR8", 24U, 1U, RegisterDbAccess::Write},
+    {"BR7", 23U, 1U, RegisterDbAccess::Write},
+    {"BR6", 22U, 1U, RegisterDbAccess::Write},
+    {"BR5", 21U, 1U, RegisterDbAccess::Write},
+    {"BR4", 20U, 1U, RegisterDbAccess::Write},
+    {"BR3", 19U, 1U, RegisterDbAccess::Write},
+    {"BR2", 18U, 1U, RegisterDbAccess::Write},
+    {"BR1", 17U, 1U, RegisterDbAccess::Write},
+    {"BR0", 16U, 1U, RegisterDbAccess::Write},
+    {"BS15", 15U, 1U, RegisterDbAccess::Write},
+    {"BS14", 14U, 1U, RegisterDbAccess::Write},
+    {"BS13", 13U, 1U, RegisterDbAccess::Write},
+    {"BS12", 12U, 1U, RegisterDbAccess::Write},
+    {"BS11", 11U, 1U, RegisterDbAccess::Write},
+    {"BS10", 10U, 1U, RegisterDbAccess::Write},
+    {"BS9", 9U, 1U, RegisterDbAccess::Write},
+    {"BS8", 8U, 1U, RegisterDbAccess::Write},
+    {"BS7", 7U, 1U, RegisterDbAccess::Write},
+    {"BS6", 6U, 1U, RegisterDbAccess::Write},
+    {"BS5", 5U, 1U, RegisterDbAccess::Write},
+    {"BS4", 4U, 1U, RegisterDbAccess::Write},
+    {"BS3", 3U, 1U, RegisterDbAccess::Write},
+    {"BS2", 2U, 1U, RegisterDbAccess::Write},
+    {"BS1", 1U, 1U, RegisterDbAccess::Write},
+    {"BS0", 0U, 1U, RegisterDbAccess::Write},
+    {"LCKK", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"AFRL7", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL6", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL5", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL4", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH15", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH14", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH13", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH12", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"MODER15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OT15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IDR15", 15U, 1U, RegisterDbAccess::Read},
+    {"IDR14", 14U, 1U, RegisterDbAccess::Read},
+    {"IDR13", 13U, 1U, RegisterDbAccess::Read},
+    {"IDR12", 12U, 1U, RegisterDbAccess::Read},
+    {"IDR11", 11U, 1U, RegisterDbAccess::Read},
+    {"IDR10", 10U, 1U, RegisterDbAccess::Read},
+    {"IDR9", 9U, 1U, RegisterDbAccess::Read},
+    {"IDR8", 8U, 1U, RegisterDbAccess::Read},
+    {"IDR7", 7U, 1U, RegisterDbAccess::Read},
+    {"IDR6", 6U, 1U, RegisterDbAccess::Read},
+    {"IDR5", 5U, 1U, RegisterDbAccess::Read},
+    {"IDR4", 4U, 1U, RegisterDbAccess::Read},
+    {"IDR3", 3U, 1U, RegisterDbAccess::Read},
+    {"IDR2", 2U, 1U, RegisterDbAccess::Read},
+    {"IDR1", 1U, 1U, RegisterDbAccess::Read},
+    {"IDR0", 0U, 1U, RegisterDbAccess::Read},
+    {"ODR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR15", 31U, 1U, RegisterDbAccess::Write},
+    {"BR14", 30U, 1U, RegisterDbAccess::Write},
+    {"BR13", 29U, 1U, RegisterDbAccess::Write},
+    {"BR12", 28U, 1U, RegisterDbAccess::Write},
+    {"BR11", 27U, 1U, RegisterDbAccess::Write},
+    {"BR10", 26U, 1U, RegisterDbAccess::Write},
+    {"BR9", 25U, 1U, RegisterDbAccess::Write},
+    {"BR8", 24U, 1U, RegisterDbAccess::Write},
+    {"BR7", 23U, 1U, RegisterDbAccess::Write},
+    {"BR6", 22U, 1U, RegisterDbAccess::Write},
+    {"BR5", 21U, 1U, RegisterDbAccess::Write},
+    {"BR4", 20U, 1U, RegisterDbAccess::Write},
+    {"BR3", 19U, 1U, RegisterDbAccess::Write},
+    {"BR2", 18U, 1U, RegisterDbAccess::Write},
+    {"BR1", 17U, 1U, RegisterDbAccess::Write},
+    {"BR0", 16U, 1U, RegisterDbAccess::Write},
+    {"BS15", 15U, 1U, RegisterDbAccess::Write},
+    {"BS14", 14U, 1U, RegisterDbAccess::Write},
+    {"BS13", 13U, 1U, RegisterDbAccess::Write},
+    {"BS12", 12U, 1U, RegisterDbAccess::Write},
+    {"BS11", 11U, 1U, RegisterDbAccess::Write},
+    {"BS10", 10U, 1U, RegisterDbAccess::Write},
+    {"BS9", 9U, 1U, RegisterDbAccess::Write},
+    {"BS8", 8U, 1U, RegisterDbAccess::Write},
+    {"BS7", 7U, 1U, RegisterDbAccess::Write},
+    {"BS6", 6U, 1U, RegisterDbAccess::Write},
+    {"BS5", 5U, 1U, RegisterDbAccess::Write},
+    {"BS4", 4U, 1U, RegisterDbAccess::Write},
+    {"BS3", 3U, 1U, RegisterDbAccess::Write},
+    {"BS2", 2U, 1U, RegisterDbAccess::Write},
+    {"BS1", 1U, 1U, RegisterDbAccess::Write},
+    {"BS0", 0U, 1U, RegisterDbAccess::Write},
+    {"LCKK", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"AFRL7", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL6", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL5", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL4", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH15", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH14", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH13", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH12", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"MODER15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OT15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IDR15", 15U, 1U, RegisterDbAccess::Read},
+    {"IDR14", 14U, 1U, RegisterDbAccess::Read},
+    {"IDR13", 13U, 1U, RegisterDbAccess::Read},
+    {"IDR12", 12U, 1U, RegisterDbAccess::Read},
+    {"IDR11", 11U, 1U, RegisterDbAccess::Read},
+    {"IDR10", 10U, 1U, RegisterDbAccess::Read},
+    {"IDR9", 9U, 1U, RegisterDbAccess::Read},
+    {"IDR8", 8U, 1U, RegisterDbAccess::Read},
+    {"IDR7", 7U, 1U, RegisterDbAccess::Read},
+    {"IDR6", 6U, 1U, RegisterDbAccess::Read},
+    {"IDR5", 5U, 1U, RegisterDbAccess::Read},
+    {"IDR4", 4U, 1U, RegisterDbAccess::Read},
+    {"IDR3", 3U, 1U, RegisterDbAccess::Read},
+    {"IDR2", 2U, 1U, RegisterDbAccess::Read},
+    {"IDR1", 1U, 1U, RegisterDbAccess::Read},
+    {"IDR0", 0U, 1U, RegisterDbAccess::Read},
+    {"ODR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR15", 31U, 1U, RegisterDbAccess::Write},
+    {"BR14", 30U, 1U, RegisterDbAccess::Write},
+    {"BR13", 29U, 1U, RegisterDbAccess::Write},
+    {"BR12", 28U, 1U, RegisterDbAccess::Write},
+    {"BR11", 27U, 1U, RegisterDbAccess::Write},
+    {"BR10", 26U, 1U, RegisterDbAccess::Write},
+    {"BR9", 25U, 1U, RegisterDbAccess::Write},
+    {"BR8", 24U, 1U, RegisterDbAccess::Write},
+    {"BR7", 23U, 1U, RegisterDbAccess::Write},
+    {"BR6", 22U, 1U, RegisterDbAccess::Write},
+    {"BR5", 21U, 1U, RegisterDbAccess::Write},
+    {"BR4", 20U, 1U, RegisterDbAccess::Write},
+    {"BR3", 19U, 1U, RegisterDbAccess::Write},
+    {"BR2", 18U, 1U, RegisterDbAccess::Write},
+    {"BR1", 17U, 1U, RegisterDbAccess::Write},
+    {"BR0", 16U, 1U, RegisterDbAccess::Write},
+    {"BS15", 15U, 1U, RegisterDbAccess::Write},
+    {"BS14", 14U, 1U, RegisterDbAccess::Write},
+    {"BS13", 13U, 1U, RegisterDbAccess::Write},
+    {"BS12", 12U, 1U, RegisterDbAccess::Write},
+    {"BS11", 11U, 1U, RegisterDbAccess::Write},
+    {"BS10", 10U, 1U, RegisterDbAccess::Write},
+    {"BS9", 9U, 1U, RegisterDbAccess::Write},
+    {"BS8", 8U, 1U, RegisterDbAccess::Write},
+    {"BS7", 7U, 1U, RegisterDbAccess::Write},
+    {"BS6", 6U, 1U, RegisterDbAccess::Write},
+    {"BS5", 5U, 1U, RegisterDbAccess::Write},
+    {"BS4", 4U, 1U, RegisterDbAccess::Write},
+    {"BS3", 3U, 1U, RegisterDbAccess::Write},
+    {"BS2", 2U, 1U, RegisterDbAccess::Write},
+    {"BS1", 1U, 1U, RegisterDbAccess::Write},
+    {"BS0", 0U, 1U, RegisterDbAccess::Write},
+    {"LCKK", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"AFRL7", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL6", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL5", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL4", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH15", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH14", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH13", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH12", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"MODER15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OT15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IDR15", 15U, 1U, RegisterDbAccess::Read},
+    {"IDR14", 14U, 1U, RegisterDbAccess::Read},
+    {"IDR13", 13U, 1U, RegisterDbAccess::Read},
+    {"IDR12", 12U, 1U, RegisterDbAccess::Read},
+    {"IDR11", 11U, 1U, RegisterDbAccess::Read},
+    {"IDR10", 10U, 1U, RegisterDbAccess::Read},
+    {"IDR9", 9U, 1U, RegisterDbAccess::Read},
+    {"IDR8", 8U, 1U, RegisterDbAccess::Read},
+    {"IDR7", 7U, 1U, RegisterDbAccess::Read},
+    {"IDR6", 6U, 1U, RegisterDbAccess::Read},
+    {"IDR5", 5U, 1U, RegisterDbAccess::Read},
+    {"IDR4", 4U, 1U, RegisterDbAccess::Read},
+    {"IDR3", 3U, 1U, RegisterDbAccess::Read},
+    {"IDR2", 2U, 1U, RegisterDbAccess::Read},
+    {"IDR1", 1U, 1U, RegisterDbAccess::Read},
+    {"IDR0", 0U, 1U, RegisterDbAccess::Read},
+    {"ODR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR15", 31U, 1U, RegisterDbAccess::Write},
+    {"BR14", 30U, 1U, RegisterDbAccess::Write},
+    {"BR13", 29U, 1U, RegisterDbAccess::Write},
+    {"BR12", 28U, 1U, RegisterDbAccess::Write},
+    {"BR11", 27U, 1U, RegisterDbAccess::Write},
+    {"BR10", 26U, 1U, RegisterDbAccess::Write},
+    {"BR9", 25U, 1U, RegisterDbAccess::Write},
+    {"BR8", 24U, 1U, RegisterDbAccess::Write},
+    {"BR7", 23U, 1U, RegisterDbAccess::Write},
+    {"BR6", 22U, 1U, RegisterDbAccess::Write},
+    {"BR5", 21U, 1U, RegisterDbAccess::Write},
+    {"BR4", 20U, 1U, RegisterDbAccess::Write},
+    {"BR3", 19U, 1U, RegisterDbAccess::Write},
+    {"BR2", 18U, 1U, RegisterDbAccess::Write},
+    {"BR1", 17U, 1U, RegisterDbAccess::Write},
+    {"BR0", 16U, 1U, RegisterDbAccess::Write},
+    {"BS15", 15U, 1U, RegisterDbAccess::Write},
+    {"BS14", 14U, 1U, RegisterDbAccess::Write},
+    {"BS13", 13U, 1U, RegisterDbAccess::Write},
+    {"BS12", 12U, 1U, RegisterDbAccess::Write},
+    {"BS11", 11U, 1U, RegisterDbAccess::Write},
+    {"BS10", 10U, 1U, RegisterDbAccess::Write},
+    {"BS9", 9U, 1U, RegisterDbAccess::Write},
+    {"BS8", 8U, 1U, RegisterDbAccess::Write},
+    {"BS7", 7U, 1U, RegisterDbAccess::Write},
+    {"BS6", 6U, 1U, RegisterDbAccess::Write},
+    {"BS5", 5U, 1U, RegisterDbAccess::Write},
+    {"BS4", 4U, 1U, RegisterDbAccess::Write},
+    {"BS3", 3U, 1U, RegisterDbAccess::Write},
+    {"BS2", 2U, 1U, RegisterDbAccess::Write},
+    {"BS1", 1U, 1U, RegisterDbAccess::Write},
+    {"BS0", 0U, 1U, RegisterDbAccess::Write},
+    {"LCKK", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"AFRL7", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL6", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL5", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL4", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH15", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH14", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH13", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH12", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"MODER15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OT15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IDR15", 15U, 1U, RegisterDbAccess::Read},
+    {"IDR14", 14U, 1U, RegisterDbAccess::Read},
+    {"IDR13", 13U, 1U, RegisterDbAccess::Read},
+    {"IDR12", 12U, 1U, RegisterDbAccess::Read},
+    {"IDR11", 11U, 1U, RegisterDbAccess::Read},
+    {"IDR10", 10U, 1U, RegisterDbAccess::Read},
+    {"IDR9", 9U, 1U, RegisterDbAccess::Read},
+    {"IDR8", 8U, 1U, RegisterDbAccess::Read},
+    {"IDR7", 7U, 1U, RegisterDbAccess::Read},
+    {"IDR6", 6U, 1U, RegisterDbAccess::Read},
+    {"IDR5", 5U, 1U, RegisterDbAccess::Read},
+    {"IDR4", 4U, 1U, RegisterDbAccess::Read},
+    {"IDR3", 3U, 1U, RegisterDbAccess::Read},
+    {"IDR2", 2U, 1U, RegisterDbAccess::Read},
+    {"IDR1", 1U, 1U, RegisterDbAccess::Read},
+    {"IDR0", 0U, 1U, RegisterDbAccess::Read},
+    {"ODR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR15", 31U, 1U, RegisterDbAccess::Write},
+    {"BR14", 30U, 1U, RegisterDbAccess::Write},
+    {"BR13", 29U, 1U, RegisterDbAccess::Write},
+    {"BR12", 28U, 1U, RegisterDbAccess::Write},
+    {"BR11", 27U, 1U, RegisterDbAccess::Write},
+    {"BR10", 26U, 1U, RegisterDbAccess::Write},
+    {"BR9", 25U, 1U, RegisterDbAccess::Write},
+    {"BR8", 24U, 1U, RegisterDbAccess::Write},
+    {"BR7", 23U, 1U, RegisterDbAccess::Write},
+    {"BR6", 22U, 1U, RegisterDbAccess::Write},
+    {"BR5", 21U, 1U, RegisterDbAccess::Write},
+    {"BR4", 20U, 1U, RegisterDbAccess::Write},
+    {"BR3", 19U, 1U, RegisterDbAccess::Write},
+    {"BR2", 18U, 1U, RegisterDbAccess::Write},
+    {"BR1", 17U, 1U, RegisterDbAccess::Write},
+    {"BR0", 16U, 1U, RegisterDbAccess::Write},
+    {"BS15", 15U, 1U, RegisterDbAccess::Write},
+    {"BS14", 14U, 1U, RegisterDbAccess::Write},
+    {"BS13", 13U, 1U, RegisterDbAccess::Write},
+    {"BS12", 12U, 1U, RegisterDbAccess::Write},
+    {"BS11", 11U, 1U, RegisterDbAccess::Write},
+    {"BS10", 10U, 1U, RegisterDbAccess::Write},
+    {"BS9", 9U, 1U, RegisterDbAccess::Write},
+    {"BS8", 8U, 1U, RegisterDbAccess::Write},
+    {"BS7", 7U, 1U, RegisterDbAccess::Write},
+    {"BS6", 6U, 1U, RegisterDbAccess::Write},
+    {"BS5", 5U, 1U, RegisterDbAccess::Write},
+    {"BS4", 4U, 1U, RegisterDbAccess::Write},
+    {"BS3", 3U, 1U, RegisterDbAccess::Write},
+    {"BS2", 2U, 1U, RegisterDbAccess::Write},
+    {"BS1", 1U, 1U, RegisterDbAccess::Write},
+    {"BS0", 0U, 1U, RegisterDbAccess::Write},
+    {"LCKK", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"AFRL7", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL6", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL5", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL4", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH15", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH14", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH13", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH12", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"MODER15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"MODER0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"OT15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OT0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"OSPEEDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR15", 30U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR14", 28U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR13", 26U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR12", 24U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR11", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR10", 20U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR9", 18U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR8", 16U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR7", 14U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR6", 12U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR5", 10U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR4", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR3", 6U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR2", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR1", 2U, 2U, RegisterDbAccess::ReadWrite},
+    {"PUPDR0", 0U, 2U, RegisterDbAccess::ReadWrite},
+    {"IDR15", 15U, 1U, RegisterDbAccess::Read},
+    {"IDR14", 14U, 1U, RegisterDbAccess::Read},
+    {"IDR13", 13U, 1U, RegisterDbAccess::Read},
+    {"IDR12", 12U, 1U, RegisterDbAccess::Read},
+    {"IDR11", 11U, 1U, RegisterDbAccess::Read},
+    {"IDR10", 10U, 1U, RegisterDbAccess::Read},
+    {"IDR9", 9U, 1U, RegisterDbAccess::Read},
+    {"IDR8", 8U, 1U, RegisterDbAccess::Read},
+    {"IDR7", 7U, 1U, RegisterDbAccess::Read},
+    {"IDR6", 6U, 1U, RegisterDbAccess::Read},
+    {"IDR5", 5U, 1U, RegisterDbAccess::Read},
+    {"IDR4", 4U, 1U, RegisterDbAccess::Read},
+    {"IDR3", 3U, 1U, RegisterDbAccess::Read},
+    {"IDR2", 2U, 1U, RegisterDbAccess::Read},
+    {"IDR1", 1U, 1U, RegisterDbAccess::Read},
+    {"IDR0", 0U, 1U, RegisterDbAccess::Read},
+    {"ODR15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODR0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR15", 31U, 1U, RegisterDbAccess::Write},
+    {"BR14", 30U, 1U, RegisterDbAccess::Write},
+    {"BR13", 29U, 1U, RegisterDbAccess::Write},
+    {"BR12", 28U, 1U, RegisterDbAccess::Write},
+    {"BR11", 27U, 1U, RegisterDbAccess::Write},
+    {"BR10", 26U, 1U, RegisterDbAccess::Write},
+    {"BR9", 25U, 1U, RegisterDbAccess::Write},
+    {"BR8", 24U, 1U, RegisterDbAccess::Write},
+    {"BR7", 23U, 1U, RegisterDbAccess::Write},
+    {"BR6", 22U, 1U, RegisterDbAccess::Write},
+    {"BR5", 21U, 1U, RegisterDbAccess::Write},
+    {"BR4", 20U, 1U, RegisterDbAccess::Write},
+    {"BR3", 19U, 1U, RegisterDbAccess::Write},
+    {"BR2", 18U, 1U, RegisterDbAccess::Write},
+    {"BR1", 17U, 1U, RegisterDbAccess::Write},
+    {"BR0", 16U, 1U, RegisterDbAccess::Write},
+    {"BS15", 15U, 1U, RegisterDbAccess::Write},
+    {"BS14", 14U, 1U, RegisterDbAccess::Write},
+    {"BS13", 13U, 1U, RegisterDbAccess::Write},
+    {"BS12", 12U, 1U, RegisterDbAccess::Write},
+    {"BS11", 11U, 1U, RegisterDbAccess::Write},
+    {"BS10", 10U, 1U, RegisterDbAccess::Write},
+    {"BS9", 9U, 1U, RegisterDbAccess::Write},
+    {"BS8", 8U, 1U, RegisterDbAccess::Write},
+    {"BS7", 7U, 1U, RegisterDbAccess::Write},
+    {"BS6", 6U, 1U, RegisterDbAccess::Write},
+    {"BS5", 5U, 1U, RegisterDbAccess::Write},
+    {"BS4", 4U, 1U, RegisterDbAccess::Write},
+    {"BS3", 3U, 1U, RegisterDbAccess::Write},
+    {"BS2", 2U, 1U, RegisterDbAccess::Write},
+    {"BS1", 1U, 1U, RegisterDbAccess::Write},
+    {"BS0", 0U, 1U, RegisterDbAccess::Write},
+    {"LCKK", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK15", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK14", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK13", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK12", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK11", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK10", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK9", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK8", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK7", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK6", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK5", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK4", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK3", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK2", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK1", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"LCK0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"AFRL7", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL6", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL5", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL4", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL3", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL2", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL1", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRL0", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH15", 28U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH14", 24U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH13", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH12", 16U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH11", 12U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH10", 8U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH9", 4U, 4U, RegisterDbAccess::ReadWrite},
+    {"AFRH8", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"SWRST", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALERT", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"PEC", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"POS", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"STOP", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"START", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"NOSTRETCH", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENGC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENPEC", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENARP", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMBTYPE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMBUS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LAST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITBUFEN", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITEVTEN", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITERREN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FREQ", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"ADDMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD10", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ADD7", 1U, 7U, RegisterDbAccess::ReadWrite},
+    {"ADD0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD2", 1U, 7U, RegisterDbAccess::ReadWrite},
+    {"ENDUAL", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DR", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"SMBALERT", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIMEOUT", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"PECERR", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OVR", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"AF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ARLO", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"BERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TxE", 7U, 1U, RegisterDbAccess::Read},
+    {"RxNE", 6U, 1U, RegisterDbAccess::Read},
+    {"STOPF", 4U, 1U, RegisterDbAccess::Read},
+    {"ADD10", 3U, 1U, RegisterDbAccess::Read},
+    {"BTF", 2U, 1U, RegisterDbAccess::Read},
+    {"ADDR", 1U, 1U, RegisterDbAccess::Read},
+    {"SB", 0U, 1U, RegisterDbAccess::Read},
+    {"PEC", 8U, 8U, RegisterDbAccess::Read},
+    {"DUALF", 7U, 1U, RegisterDbAccess::Read},
+    {"SMBHOST", 6U, 1U, RegisterDbAccess::Read},
+    {"SMBDEFAULT", 5U, 1U, RegisterDbAccess::Read},
+    {"GENCALL", 4U, 1U, RegisterDbAccess::Read},
+    {"TRA", 2U, 1U, RegisterDbAccess::Read},
+    {"BUSY", 1U, 1U, RegisterDbAccess::Read},
+    {"MSL", 0U, 1U, RegisterDbAccess::Read},
+    {"F_S", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"DUTY", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCR", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"TRISE", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"SWRST", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALERT", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"PEC", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"POS", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"STOP", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"START", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"NOSTRETCH", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENGC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENPEC", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENARP", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMBTYPE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMBUS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LAST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITBUFEN", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITEVTEN", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITERREN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FREQ", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"ADDMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD10", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ADD7", 1U, 7U, RegisterDbAccess::ReadWrite},
+    {"ADD0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD2", 1U, 7U, RegisterDbAccess::ReadWrite},
+    {"ENDUAL", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DR", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"SMBALERT", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIMEOUT", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"PECERR", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OVR", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"AF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ARLO", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"BERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TxE", 7U, 1U, RegisterDbAccess::Read},
+    {"RxNE", 6U, 1U, RegisterDbAccess::Read},
+    {"STOPF", 4U, 1U, RegisterDbAccess::Read},
+    {"ADD10", 3U, 1U, RegisterDbAccess::Read},
+    {"BTF", 2U, 1U, RegisterDbAccess::Read},
+    {"ADDR", 1U, 1U, RegisterDbAccess::Read},
+    {"SB", 0U, 1U, RegisterDbAccess::Read},
+    {"PEC", 8U, 8U, RegisterDbAccess::Read},
+    {"DUALF", 7U, 1U, RegisterDbAccess::Read},
+    {"SMBHOST", 6U, 1U, RegisterDbAccess::Read},
+    {"SMBDEFAULT", 5U, 1U, RegisterDbAccess::Read},
+    {"GENCALL", 4U, 1U, RegisterDbAccess::Read},
+    {"TRA", 2U, 1U, RegisterDbAccess::Read},
+    {"BUSY", 1U, 1U, RegisterDbAccess::Read},
+    {"MSL", 0U, 1U, RegisterDbAccess::Read},
+    {"F_S", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"DUTY", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCR", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"TRISE", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"SWRST", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ALERT", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"PEC", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"POS", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ACK", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"STOP", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"START", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"NOSTRETCH", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENGC", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENPEC", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENARP", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMBTYPE", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"SMBUS", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"PE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"LAST", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DMAEN", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITBUFEN", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITEVTEN", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ITERREN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"FREQ", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"ADDMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD10", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"ADD7", 1U, 7U, RegisterDbAccess::ReadWrite},
+    {"ADD0", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADD2", 1U, 7U, RegisterDbAccess::ReadWrite},
+    {"ENDUAL", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DR", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"SMBALERT", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIMEOUT", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"PECERR", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"OVR", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"AF", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"ARLO", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"BERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"TxE", 7U, 1U, RegisterDbAccess::Read},
+    {"RxNE", 6U, 1U, RegisterDbAccess::Read},
+    {"STOPF", 4U, 1U, RegisterDbAccess::Read},
+    {"ADD10", 3U, 1U, RegisterDbAccess::Read},
+    {"BTF", 2U, 1U, RegisterDbAccess::Read},
+    {"ADDR", 1U, 1U, RegisterDbAccess::Read},
+    {"SB", 0U, 1U, RegisterDbAccess::Read},
+    {"PEC", 8U, 8U, RegisterDbAccess::Read},
+    {"DUALF", 7U, 1U, RegisterDbAccess::Read},
+    {"SMBHOST", 6U, 1U, RegisterDbAccess::Read},
+    {"SMBDEFAULT", 5U, 1U, RegisterDbAccess::Read},
+    {"GENCALL", 4U, 1U, RegisterDbAccess::Read},
+    {"TRA", 2U, 1U, RegisterDbAccess::Read},
+    {"BUSY", 1U, 1U, RegisterDbAccess::Read},
+    {"MSL", 0U, 1U, RegisterDbAccess::Read},
+    {"F_S", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"DUTY", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CCR", 0U, 12U, RegisterDbAccess::ReadWrite},
+    {"TRISE", 0U, 6U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"BIDIMODE", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"BIDIOE", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCEN", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"CRCNEXT", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"DFF", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXONLY", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSM", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSI", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSBFIRST", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"SPE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"BR", 3U, 3U, RegisterDbAccess::ReadWrite},
+    {"MSTR", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CPHA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXEIE", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXNEIE", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"ERRIE", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"FRF", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"SSOE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"TXDMAEN", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"RXDMAEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TIFRFE", 8U, 1U, RegisterDbAccess::Read},
+    {"BSY", 7U, 1U, RegisterDbAccess::Read},
+    {"OVR", 6U, 1U, RegisterDbAccess::Read},
+    {"MODF", 5U, 1U, RegisterDbAccess::Read},
+    {"CRCERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"UDR", 3U, 1U, RegisterDbAccess::Read},
+    {"CHSIDE", 2U, 1U, RegisterDbAccess::Read},
+    {"TXE", 1U, 1U, RegisterDbAccess::Read},
+    {"RXNE", 0U, 1U, RegisterDbAccess::Read},
+    {"DR", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"CRCPOLY", 0U, 16U, RegisterDbAccess::ReadWrite},
+    {"RxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"TxCRC", 0U, 16U, RegisterDbAccess::Read},
+    {"I2SMOD", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SE", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SCFG", 8U, 2U, RegisterDbAccess::ReadWrite},
+    {"PCMSYNC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SSTD", 4U, 2U, RegisterDbAccess::ReadWrite},
+    {"CKPOL", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DATLEN", 1U, 2U, RegisterDbAccess::ReadWrite},
+    {"CHLEN", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"MCKOE", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"ODD", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"I2SDIV", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"SETENA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SETENA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SETENA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLRENA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLRENA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLRENA", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SETPEND", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SETPEND", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"SETPEND", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLRPEND", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLRPEND", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"CLRPEND", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"ACTIVE", 0U, 32U, RegisterDbAccess::Read},
+    {"ACTIVE", 0U, 32U, RegisterDbAccess::Read},
+    {"ACTIVE", 0U, 32U, RegisterDbAccess::Read},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N0", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N1", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N2", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"IPR_N3", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"LSPACT", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"USER", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"THREAD", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"HFRDY", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMRDY", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"BFRDY", 6U, 1U, RegisterDbAccess::ReadWrite},
+    {"MONRDY", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSPEN", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"ASPEN", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADDRESS", 3U, 29U, RegisterDbAccess::ReadWrite},
+    {"IOC", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DZC", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"OFC", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"UFC", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"IXC", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"IDC", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"RMode", 22U, 2U, RegisterDbAccess::ReadWrite},
+    {"FZ", 24U, 1U, RegisterDbAccess::ReadWrite},
+    {"DN", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"AHP", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"V", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"C", 29U, 1U, RegisterDbAccess::ReadWrite},
+    {"Z", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"N", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"SEPARATE", 0U, 1U, RegisterDbAccess::Read},
+    {"DREGION", 8U, 8U, RegisterDbAccess::Read},
+    {"IREGION", 16U, 8U, RegisterDbAccess::Read},
+    {"ENABLE", 0U, 1U, RegisterDbAccess::Read},
+    {"HFNMIENA", 1U, 1U, RegisterDbAccess::Read},
+    {"PRIVDEFENA", 2U, 1U, RegisterDbAccess::Read},
+    {"REGION", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"REGION", 0U, 4U, RegisterDbAccess::ReadWrite},
+    {"VALID", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"ADDR", 5U, 27U, RegisterDbAccess::ReadWrite},
+    {"ENABLE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"SIZE", 1U, 5U, RegisterDbAccess::ReadWrite},
+    {"SRD", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"B", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"C", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"S", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"TEX", 19U, 3U, RegisterDbAccess::ReadWrite},
+    {"AP", 24U, 3U, RegisterDbAccess::ReadWrite},
+    {"XN", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"ENABLE", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"TICKINT", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"CLKSOURCE", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"COUNTFLAG", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"RELOAD", 0U, 24U, RegisterDbAccess::ReadWrite},
+    {"CURRENT", 0U, 24U, RegisterDbAccess::ReadWrite},
+    {"TENMS", 0U, 24U, RegisterDbAccess::ReadWrite},
+    {"SKEW", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"NOREF", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"Revision", 0U, 4U, RegisterDbAccess::Read},
+    {"PartNo", 4U, 12U, RegisterDbAccess::Read},
+    {"Constant", 16U, 4U, RegisterDbAccess::Read},
+    {"Variant", 20U, 4U, RegisterDbAccess::Read},
+    {"Implementer", 24U, 8U, RegisterDbAccess::Read},
+    {"VECTACTIVE", 0U, 9U, RegisterDbAccess::ReadWrite},
+    {"RETTOBASE", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"VECTPENDING", 12U, 7U, RegisterDbAccess::ReadWrite},
+    {"ISRPENDING", 22U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENDSTCLR", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENDSTSET", 26U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENDSVCLR", 27U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENDSVSET", 28U, 1U, RegisterDbAccess::ReadWrite},
+    {"NMIPENDSET", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"TBLOFF", 9U, 21U, RegisterDbAccess::ReadWrite},
+    {"VECTRESET", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"VECTCLRACTIVE", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SYSRESETREQ", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRIGROUP", 8U, 3U, RegisterDbAccess::ReadWrite},
+    {"ENDIANESS", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"VECTKEYSTAT", 16U, 16U, RegisterDbAccess::ReadWrite},
+    {"SLEEPONEXIT", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"SLEEPDEEP", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"SEVEONPEND", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"NONBASETHRDENA", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"USERSETMPEND", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"UNALIGN__TRP", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIV_0_TRP", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"BFHFNMIGN", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"STKALIGN", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRI_4", 0U, 8U, RegisterDbAccess::ReadWrite},
+    {"PRI_5", 8U, 8U, RegisterDbAccess::ReadWrite},
+    {"PRI_6", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"PRI_11", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"PRI_14", 16U, 8U, RegisterDbAccess::ReadWrite},
+    {"PRI_15", 24U, 8U, RegisterDbAccess::ReadWrite},
+    {"MEMFAULTACT", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"BUSFAULTACT", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"USGFAULTACT", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"SVCALLACT", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"MONITORACT", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"PENDSVACT", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"SYSTICKACT", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"USGFAULTPENDED", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"MEMFAULTPENDED", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"BUSFAULTPENDED", 14U, 1U, RegisterDbAccess::ReadWrite},
+    {"SVCALLPENDED", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"MEMFAULTENA", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"BUSFAULTENA", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"USGFAULTENA", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"IACCVIOL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"MUNSTKERR", 3U, 1U, RegisterDbAccess::ReadWrite},
+    {"MSTKERR", 4U, 1U, RegisterDbAccess::ReadWrite},
+    {"MLSPERR", 5U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMARVALID", 7U, 1U, RegisterDbAccess::ReadWrite},
+    {"IBUSERR", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"PRECISERR", 9U, 1U, RegisterDbAccess::ReadWrite},
+    {"IMPRECISERR", 10U, 1U, RegisterDbAccess::ReadWrite},
+    {"UNSTKERR", 11U, 1U, RegisterDbAccess::ReadWrite},
+    {"STKERR", 12U, 1U, RegisterDbAccess::ReadWrite},
+    {"LSPERR", 13U, 1U, RegisterDbAccess::ReadWrite},
+    {"BFARVALID", 15U, 1U, RegisterDbAccess::ReadWrite},
+    {"UNDEFINSTR", 16U, 1U, RegisterDbAccess::ReadWrite},
+    {"INVSTATE", 17U, 1U, RegisterDbAccess::ReadWrite},
+    {"INVPC", 18U, 1U, RegisterDbAccess::ReadWrite},
+    {"NOCP", 19U, 1U, RegisterDbAccess::ReadWrite},
+    {"UNALIGNED", 24U, 1U, RegisterDbAccess::ReadWrite},
+    {"DIVBYZERO", 25U, 1U, RegisterDbAccess::ReadWrite},
+    {"VECTTBL", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"FORCED", 30U, 1U, RegisterDbAccess::ReadWrite},
+    {"DEBUG_VT", 31U, 1U, RegisterDbAccess::ReadWrite},
+    {"MMFAR", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"BFAR", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"IMPDEF", 0U, 32U, RegisterDbAccess::ReadWrite},
+    {"INTID", 0U, 9U, RegisterDbAccess::ReadWrite},
+    {"CP", 20U, 4U, RegisterDbAccess::ReadWrite},
+    {"DISMCYCINT", 0U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISDEFWBUF", 1U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISFOLD", 2U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISFPCA", 8U, 1U, RegisterDbAccess::ReadWrite},
+    {"DISOOFP", 9U, 1U, RegisterDbAccess::ReadWrite},
+  } ;
+
+  static constexpr std::int16_t Seeds[] = {
+    0, -5305, -5304, 1, -5301, 0, -5296, -5293, -5288, 0, -5283, 0, 1, 1, -5282, -5279,
+    -5277, 0, 3, -5276, 0, 2, -5271, -5264, 3, 0, -5263, 2, 0, 0, -5262, 0,
+    1, -5257, 1, 0, -5253, 0, -5252, 2, -5251, 0, -5249, 1, -5246, -5242, 1, -5241,
+    0, 0, -5239, -5238, -5235, -5231, 0, 0, 2, 2, 3, 0, 1, 0, -5227, 0,
+    0, 2, 0, 0, -5221, 0, 1, 2, -5219, 1, -5218, -5217, 0, 0, 0, 0,
+    -5216, 0, -5212, -5209, -5207, 2, -5206, 3, -5205, 0, -5200, -5199, 2, 0, -5198, -5195,
+    -5187, 0, 1, 1, -5186, -5183, -5182, 1, -5180, 1, 1, 0, 1, 0, 0, 2,
+    0, -5179, 0, 0, -5176, -5170, -5169, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, -5168, 0, 0, 1, -5164, -5163, 4, -5162, 1, 0,
+    0, -5160, 2, 0, 0, 1, -5157, 1, -5155, -5153, 2, 0, 0, 0, 0, 0,
+    0, 0, 3, 4, -5152, 0, 0, 0, 0, -5151, 0, 0, 0, 0, 1, -5148,
+    -5147, 2, 0, 1, 0, -5146, 8, 2, -5145, 2, 1, -5143, -5137, 1, -5135, -5134,
+    -5132, 2, 1, -5130, 0, -5128, -5127, 3, 0, 0, 1, 0, 0, -5126, 1, 1,
+    0, -5124, 1, 0, -5122, 0, 0, 1, 0, 0, -5118, -5115, 1, 0, 0, 0,
+    4, 0, 3, 2, -5114, 4, -5106, 0, 0, -5098, 0, -5092, 1, 0, -5091, -5085,
+    -5077, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -5076, 0, -5075, 1,
+    0, 1, 0, 0, 2, -5074, 2, -5072, 4, 0, -5070, -5066, 1, -5057, 0, -5055,
+    0, -5054, 0, 1, 0, 5, 0, 0, -5052, 1, 0, 0, 0, 1, -5051, -5050,
+    2, 1, 0, 0, 2, 0, -5049, -5048, 1, 1, -5046, 2, -5044, -5039, -5037, 0,
+    1, 4, 0, -5036, 0, -5033, -5030, -5026, -5025, -5022, 1, 0, 0, 0, -5021, 0,
+    2, -5016, 4, -5013, -5012, 0, 0, 1, 1, -5011, 1, 0, 0, 0, 1, -5010,
+    0, 0, 0, 4, 0, -5008, 0, -5007, 0, 1, 0, 0, 1, 0, 0, 1,
+    1, -5005, 0, 0, -5003, 0, 6, 0, -5002, 0, 0, 1, -5001, -4995, 1, 0,
+    -4992, -4991, -4989, 0, 0, 2, 1, 4, -4987, -4986, 0, 2, -4984, 0, 1, -4983,
+    1, -4981, 1, -4976, 0, 1, -4975, 0, 0, 0, -4974, 5, 1, -4973, 0, 2,
+    -4969, 2, -4967, 0, -4965, 2, -4964, 0, 3, 0, 1, 0, 0, -4962, -4961, 0,
+    0, -4959, 0, -4955, 0, 0, -4952, -4951, -4947, 2, 2, -4945, 0, 0, -4942, 4,
+    -4936, 0, 0, -4931, 0, 2, -4929, -4928, 1, -4927, -4925, -4923, 1, 0, 0, -4922,
+    0, -4921, -4912, 4, -4909, -4908, -4907, 0, 3, -4903, -4899, -4893, -4883, -4882, 1, 2,
+    -4877, 3, -4875, -4873, 0, 1, 0, 1, 1, -4871, 2, 2, 2, 0, 0, -4864,
+    0, -4861, -4858, 0, -4852, 1, 0, -4845, 1, 0, 2, 0, 0, -4842, -4841, -4840,
+    1, -4839, 1, 1, 0, -4831, 0, 0, 0, 5, 1, 0, 0, 0, -4829, 1,
+    -4827, 0, 2, 3, 1, 2, 1, 0, -4824, -4823, 0, 0, -4822, 0, 3, -4818,
+    0, 0, -4817, -4814, 0, -4808, 0, 0, 0, 0, -4796, 0, -4794, 0, -4793, 1,
+    -4790, 0, -4784, 0, 2, 0, -4783, 1, 0, 6, 1, -4768, 0, -4767, 1, -4765,
+    1, 0, 0, -4764, -4757, -4753, 0, -4749, -4748, -4746, 0, 1, 2, -4743, 1, -4724,
+    -4723, 0, 0, 0, -4714, 2, 0, -4713, -4711, 0, 0, -4710, 0, 1, -4708, 0,
+    1, -4700, 1, 0, 0, 2, 0, 2, -4699, 0, -4698, -4693, 1, 1, 1, -4692,
+    -4690, 0, 0, 0, -4686, 1, -4682, -4681, 1, -4678, -4666, 0, -4664, -4660, 0, 0,
+    0, 0, -4659, 0, 0, 0, 0, 1, 0, 2, -4658, -4656, 0, -4651, -4649, 2,
+    2, -4644, -4637, 4, -4634, 2, 0, -4633, -4632, 0, -4627, 1, 0, -4625, 0, 0,
+    3, 0, 0, 0, -4624, 0, -4620, -4618, 3, 3, 0, -4616, -4611, 3, -4609, 0,
+    0, 1, -4608, 1, 1, 0, 0, 0, -4607, -4606, -4605, -4603, -4596, 1, -4594, 0,
+    -4591, 0, -4590, -4588, 2, 0, -4587, 1, 2, 0, -4586, -4581, 0, -4580, 2, -4578,
+    -4576, 0, 0, 1, 0, -4575, 2, 1, 3, -4572, 0, 0, -4569, 0, 1, 4,
+    0, 0, -4567, -4565, 1, 0, 0, 0, -4561, -4560, 0, 0, -4558, 1, 0, -4550,
+    1, 0, -4548, -4543, 0, -4541, 0, 0, 0, 3, -4539, 1, -4536, -4535, 2, -4534,
+    0, -4533, -4530, 2, 3, 2, 0, 0, 0, 0, 0, 0, -4519, 0, 0, -4515,
+    -4512, 0, 0, 1, -4506, 0, 1, -4505, 3, 0, 0, -4501, 0, 2, 0, 6,
+    2, -4500, 0, -4498, 1, -4497, 1, 3, 0, 1, -4495, -4494, 0, -4486, 2, 0,
+    -4484, 3, 0, 0, -4480, 0, 1, 0, 0, 0, 4, -4477, -4474, -4473, 0, 0,
+    1, -4466, -4465, 3, 0, 2, -4460, -4457, 0, 0, 2, -4455, 1, 1, 3, -4450,
+    0, 2, 1, 0, 2, -4448, 0, -4447, -4444, -4442, 0, 0, 2, -4441, 3, -4439,
+    4, 1, 0, -4438, 1, -4437, 4, 0, -4432, -4431, -4429, 0, 1, -4426, 0, -4425,
+    -4421, -4420, -4418, -4417, -4412, 0, 0, 1, 0, -4411, -4410, 0, 0, -4403, -4402, 2,
+    0, -4401, -4397, -4393, -4390, 4, 0, -4389, -4388, -4387, 0, 4, -4382, 0, -4375, -4368,
+    1, 0, -4366, 0, 2, -4365, -4362, 7, 0, 0, 0, 0, 0, 0, 0, 2,
+    -4361, 0, 1, 1, 4, -4360, 0, 0, -4359, 0, -4357, -4355, 0, -4351, -4350, 0,
+    1, 1, -4349, 0, 1, -4348, 0, 0, -4346, -4345, 1, -4344, -4342, 0, 0, -4339,
+    -4336, -4329, 1, -4328, 0, 0, 0, -4327, 0, 1, 0, -4326, 0, -4325, -4324, -4319,
+    0, 0, -4316, 0, -4315, -4309, 0, -4308, -4307, 1, 0, -4305, 2, -4300, 4, -4295,
+    -4294, 1, 0, -4292, 0, -4291, -4284, 0, -4280, 0, 0, 1, -4276, 0, 3, 0,
+    1, -4266, -4265, 10, -4257, 1, 1, 0, 0, 0, -4256, -4255, 0, 0, 0, 2,
+    0, -4251, -4249, -4248, -4247, -4246, 0, 0, -4244, 0, 0, 0, -4242, -4240, 1, 0,
+    3, 0, -4238, -4236, 0, 1, 0, 1, -4232, -4230, 1, 0, 0, -4227, -4226, 3,
+    -4225, -4224, 3, 0, -4221, -4214, 4, 0, -4204, -4202, -4201, -4198, 2, -4187, -4185, 0,
+    0, 0, -4183, 0, 0, 0, 0, -4178, -4174, -4172, 0, -4171, -4170, -4168, 0, 0,
+    -4166, 0, -4161, 0, 2, 3, 0, 1, 0, -4160, 1, -4159, -4156, -4154, -4152, 0,
+    0, -4151, -4149, 0, -4148, 1, 0, 0, -4147, -4146, 0, 0, 0, -4145, -4143, -4140,
+    0, -4134, 0, 0, 0, -4133, -4132, 4, 1, 1, 0, 2, 1, 0, -4131, -4130,
+    -4129, 0, 0, 1, 1, -4128, 1, 0, -4124, -4122, -4121, 0, -4116, -4114, 0, 0,
+    0, 1, 1, 0, 0, -4113, -4112, 1, -4111, 0, 0, -4108, 1, 1, -4107, 0,
+    -4104, 0, 1, 1, -4099, -4089, 1, 7, 1, 0, -4088, 0, 0, 1, -4087, 0,
+    -4085, -4083, -4076, 2, -4074, -4072, 0, -4068, -4067, -4064, -4063, -4061, 0, -4060, 0, -4056,
+    -4055, 0, -4054, -4049, 0, -4047, 0, 0, 0, 0, 2, 0, -4046, 0, 1, -4043,
+    0, 0, 0, 0, 2, -4038, 3, 3, -4036, 0, -4032, 0, 0, -4029, -4024, 0,
+    1, 1, 7, 3, 0, -4022, -4015, -4013, -4010, 0, 0, 0, 6, 2, 0, -4005,
+    0, 0, 0, -3996, 0, 0, -3995, -3994, 1, -3992, -3991, 0, 0, 0, 1, 0,
+    0, -3990, -3989, 1, 0, -3987, -3986, 3, -3984, 0, -3983, -3978, 0, 2, 0, 1,
+    -3976, 1, 0, 2, -3974, -3969, -3968, 0, 0, 0, -3967, 0, -3965, 0, -3959, 3,
+    0, 0, 1, -3955, 0, 0, -3954, 0, 0, -3951, 1, 1, -3948, 1, 1, 0,
+    1, 2, 5, 2, -3945, 1, 0, -3944, 0, -3943, 0, 0, 1, 0, 2, 0,
+    0, 0, 1, -3941, -3940, -3936, 0, -3935, 0, 1, 0, -3933, 0, 0, 1, 1,
+    -3932, -3931, -3930, -3927, 3, -3916, -3911, -3910, -3909, 1, -3907, 0, 0, -3904, -3903, 0,
+    0, 0, 1, 0, 1, 0, 0, 0, -3902, 1, 0, 1, 0, -3901, 1, 0,
+    -3896, 1, 2, 0, -3894, -3892, 2, -3891, -3889, -3888, 0, -3887, 0, 0, -3883, 1,
+    0, 1, 1, 1, 0, 1, 1, -3878, 0, 0, -3872, -3871, -3866, 0, 0, 1,
+    1, 2, -3863, 0, -3862, 0, -3861, 0, 1, 1, -3860, 1, 0, -3858, 1, 0,
+    -3856, -3855, -3850, 2, 0, -3849, 0, -3846, -3845, 1, 1, 0, -3844, 1, -3843, 0,
+    -3841, -3839, 0, -3836, -3835, 0, 6, 2, 3, -3826, 2, 3, 0, -3825, -3824, -3823,
+    -3822, 1, -3819, -3817, 0, -3810, 0, 0, 0, -3806, -3804, 0, 0, 0, 0, -3802,
+    0, 4, 6, 2, 0, 2, 0, 1, -3800, -3799, 4, 0, -3798, 3, -3793, 2,
+    -3785, 0, -3783, 1, 0, -3781, -3778, 1, 3, -3777, 0, -3774, 1, 0, 1, -3769,
+    -3765, -3764, -3763, -3760, -3758, 0, -3755, -3751, 0, 0, 0, 0, 0, -3750, -3744, -3743,
+    1, 0, 0, -3742, -3738, 0, 0, -3730, -3729, 0, -3723, 1, 0, 0, -3721, 0,
+    0, 1, 1, -3716, 1, 2, -3710, -3709, 3, -3708, -3707, -3704, 0, 0, 0, 0,
+    0, 3, 0, 0, -3702, 1, 4, -3700, -3695, 1, -3692, 0, 0, 2, 0, 2,
+    0, -3690, 0, 0, 0, -3689, -3688, 0, 0, 0, -3687, 0, -3684, 3, 1, -3682,
+    0, -3681, 0, 0, 0, -3679, 1, -3677, 1, 0, 0, 0, 0, -3672, -3671, -3669,
+    0, 0, 6, -3664, -3651, -3648, 0, -3645, -3643, -3642, 2, 0, -3639, -3638, 0, 0,
+    0, 0, 0, -3634, -3633, 0, 0, -3632, 1, 0, 6, 0, 0, 0, -3630, 0,
+    1, -3629, -3627, 0, 2, 0, 0, 1, 1, 1, 2, -3626, 1, 4, -3624, 0,
+    -3619, 0, 1, 0, -3617, -3615, 3, -3612, 0, 3, 4, -3610, 2, -3608, 2, -3606,
+    -3605, 0, 0, 0, 0, -3604, 0, 1, -3603, 0, 0, -3600, 0, 1, 1, 0,
+    -3598, -3597, 0, 0, 2, -3594, -3592, 1, 2, -3585, -3582, 0, 3, 0, 0, -3578,
+    0, 0, -3576, 0, 5, -3574, 1, 3, -3572, -3571, 0, -3568, 0, 1, 0, 0,
+    2, 1, 0, 0, -3565, 0, 1, -3564, -3561, -3559, 0, 0, -3553, 0, 1, 0,
+    0, -3552, 1, 0, -3550, -3549, -3546, 1, 0, -3545, 0, 0, -3543, 0, 0, -3542,
+    -3536, 7, 1, -3535, -3526, 0, 0, 2, 1, 1, -3524, 1, 0, -3519, 0, -3516,
+    -3510, -3506, -3504, 0, 0, -3502, -3501, 4, 7, -3500, 2, 0, 0, -3496, 1, 1,
+    1, 1, -3491, 0, 7, 0, 0, -3490, 0, -3489, 0, -3486, -3485, -3484, 0, 2,
+    0, 0, -3483, 0, 1, 1, -3481, 0, 0, -3480, -3477, -3472, 2, -3471, 2, -3468,
+    0, 0, 0, 2, 2, 6, 0, 0, -3462, -3459, 6, 0, -3457, -3456, 2, 0,
+    -3452, 0, 0, -3450, -3442, 0, 1, -3440, -3438, 9, 0, 0, 0, -3430, 0, 0,
+    -3427, -3426, 2, 0, 0, 0, -3422, 0, 1, -3419, -3418, 1, 0, -3415, 0, 0,
+    -3413, 0, -3411, 0, -3407, 0, 3, 1, 0, 0, 0, -3404, -3402, 3, 0, 0,
+    0, 0, 1, 0, -3399, 4, -3398, -3397, -3393, -3387, 0, 5, 0, 0, 1, 2,
+    1, 2, 0, 0, 2, 0, 0, 4, -3385, 0, 0, 2, 1, 1, 2, 1,
+    0, 0, 0, -3383, 1, 0, -3381, 3, 0, 0, 1, -3375, 0, 3, -3374, 0,
+    -3373, 1, 0, 2, 0, 0, -3366, 0, 1, 0, -3364, 1, 3, -3360, -3359, 0,
+    1, 0, 2, -3358, -3357, 1, 1, -3356, 3, 0, 0, 0, 0, -3355, 0, -3351,
+    -3349, 1, 2, 0, -3345, 0, -3344, 0, 0, 3, -3342, 0, -3341, 5, -3339, -3336,
+    0, -3330, -3325, -3324, 1, 0, 0, -3320, -3314, -3311, 0, 5, 0, -3306, -3305, 2,
+    0, 0, 0, 1, 0, 2, -3303, 2, 2, 0, 0, 6, -3301, 0, 0, 5,
+    0, 1, -3298, 1, -3295, 0, 0, 0, -3289, -3288, 0, -3285, -3278, 0, 1, 2,
+    -3277, 0, -3274, -3272, -3271, -3268, -3267, 0, -3265, 0, -3264, -3257, 1, 0, -3255, 0,
+    0, -3252, 0, 0, 0, 0, 0, 0, 2, 0, -3250, 0, 0, 0, 0, 0,
+    -3249, -3245, -3243, 0, -3241, 1, -3238, 0, 0, -3236, -3232, 3, 1, -3229, -3225, 0,
+    0, 0, 3, -3224, 0, 0, -3216, 1, 3, 0, 0, -3214, 0, -3212, 1, -3211,
+    0, 0, 1, 0, 8, -3209, 0, -3206, 0, -3205, 0, -3204, 0, 0, -3203, 2,
+    2, -3202, 0, 0, -3197, -3196, 2, -3194, -3192, 0, 0, 0, 0, 0, 5, 0,
+    1, 0, -3189, 0, 1, 1, 1, 2, 0, 1, 4, -3185, 0, 8, 0, 0,
+    1, 0, 0, 0, 0, 1, 0, 2, -3183, -3181, -3180, 4, 2, 1, -3179, -3177,
+    -3175, -3173, -3172, 1, 1, 0, -3165, 3, 2, 6, 2, 0, 2, -3161, 0, -3156,
+    -3155, -3152, -3150, 0, -3148, -3145, 0, -3141, 1, 0, -3134, 0, 0, -3133, 0, -3131,
+    1, 0, 5, 0, -3130, -3127, -3125, 1, 1, 0, -3123, 0, 5, 1, 4, 0,
+    2, 0, -3121, -3119, -3118, -3114, 0, -3113, -3109, 0, -3108, -3104, 2, 3, -3102, -3100,
+    1, 0, -3099, 0, 2, 6, 2, 0, 0, 0, -3098, 1, 0, 2, -3096, 0,
+    -3095, -3094, 0, -3091, -3090, 2, -3089, -3088, 0, -3081, 0, 3, 0, 1, 7, -3078,
+    -3071, 0, -3068, -3065, -3064, -3063, -3061, 1, -3058, -3057, 1, 2, -3054, 0, 1, -3050,
+    1, 1, 0, 0, 0, -3047, 0, 0, -3046, 0, -3044, 2, -3039, 0, 0, 0,
+    0, 0, -3037, 2, -3033, 1, -3030, 0, 0, 5, 3, 1, 1, 0, 0, -3028,
+    0, 0, 0, 0, 0, -3027, -3023, 0, 1, 3, 0, 1, -3022, -3021, 0, 0,
+    -3017, -3015, -3014, 0, -3008, -3004, -3003, 0, 1, 6, 0, 0, -2999, 0, -2997, 4,
+    -2991, 0, -2986, 0, 4, 0, 2, 1, -2983, -2982, -2975, -2972, -2968, 1, -2967, -2965,
+    0, 3, 0, 0, -2964, 0, -2959, -2954, 0, 0, 0, -2952, -2944, -2938, 0, -2937,
+    0, 0, 8, 1, 0, -2935, 1, -2934, 0, 2, 2, 1, 1, -2933, -2932, -2930,
+    1, 1, -2928, -2926, -2923, -2919, 1, -2917, 2, 3, -2916, 0, 0, 3, 0, -2906,
+    3, 0, 1, 2, 0, 0, 1, -2902, 0, 1, -2901, 4, 1, 0, 0, 3,
+    1, 5, 2, -2894, -2892, 1, -2887, 0, -2877, 0, -2873, 4, 1, -2872, -2870, 6,
+    1, 0, 2, 2, -2868, -2866, 0, 1, 0, -2862, -2860, -2858, -2855, 1, 2, -2854,
+    -2853, 0, 1, 1, -2848, 1, 0, -2845, 0, 0, 0, 0, 1, 1, -2840, 3,
+    0, 1, -2837, 1, -2831, -2830, -2829, 2, -2828, 0, -2823, 2, 2, 0, 12, 4,
+    -2820, -2818, 1, -2816, -2814, 0, 0, 1, -2812, 0, 0, 0, 0, -2811, 0, 0,
+    -2808, -2805, 0, 0, 0, 0, 0, 6, 0, -2800, -2798, 0, 5, 0, -2797, 3,
+    -2796, -2795, 0, 0, 1, 1, -2791, -2788, 0, 0, -2777, -2768, 4, 2, 1, -2765,
+    1, 1, -2763, -2759, -2758, 1, 0, 3, 0, 0, 3, 0, 0, -2757, 1, 1,
+    1, -2756, 5, 0, -2754, -2753, -2750, 4, -2747, 0, 0, 1, -2745, 4, 0, 0,
+    1, 0, -2744, -2742, 0, -2741, 2, -2738, 0, 4, 1, -2736, 0, 0, 0, 2,
+    -2731, 1, -2730, -2725, 0, 3, 0, 4, 2, 0, 0, 0, 4, 0, 3, -2723,
+    0, 0, -2721, 0, -2720, 2, 2, 0, 0, 9, -2716, 0, 0, 0, 0, -2709,
+    -2707, -2705, -2703, 2, 0, 0, 0, -2699, 1, -2697, 0, 0, 0, -2695, -2693, 1,
+    -2688, 0, 1, 0, 5, -2686, 0, 1, -2683, -2680, -2679, 1, 2, 0, 0, 0,
+    0, 0, 0, 1, 2, -2668, 8, 0, 0, 0, -2667, -2659, -2656, 1, -2653, 2,
+    -2651, -2649, 0, -2643, 0, 0, 1, 0, 0, 0, -2642, -2636, 0, -2634, 0, 0,
+    5, 3, -2631, 0, 2, -2629, 0, 0, -2623, 0, 6, 0, -2621, 5, -2619, 0,
+    1, -2617, -2609, 0, 0, 2, 0, 0, -2607, -2606, -2603, 0, 1, 0, 0, -2600,
+    -2594, 0, -2593, 0, 11, -2592, 0, 1, 0, 0, 1, -2591, 1, -2589, 0, -2586,
+    1, 1, 2, 1, -2585, -2582, -2580, 0, -2577, -2569, 0, 4, 0, 3, -2566, 0,
+    5, 1, 1, 0, 0, 0, -2564, 0, -2561, 0, -2555, -2543, 0, -2541, -2537, -2536,
+    0, -2534, -2532, 1, -2531, 1, -2526, 0, 3, 6, -2522, 2, -2520, 0, -2518, 0,
+    0, 2, -2517, 0, 0, -2516, 0, -2514, 4, -2508, 0, -2504, 0, 0, 3, -2500,
+    0, -2497, 0, 0, 0, -2495, -2491, -2490, -2486, 0, -2485, 0, 2, 0, 2, -2484,
+    0, -2475, -2472, 25, 0, 0, 0, 0, 0, 2, 0, 0, 0, -2470, 0, 3,
+    -2468, -2466, 0, -2455, -2453, 2, 0, -2452, -2449, 0, 1, 0, 0, -2446, 0, 1,
+    0, -2444, 0, -2443, 0, -2442, -2438, 1, 0, -2436, -2433, -2431, 0, -2430, 0, 3,
+    0, -2428, 0, 0, -2425, -2423, -2420, 3, -2417, -2416, 0, 0, 0, 0, -2412, -2411,
+    2, 0, 0, 3, -2408, 0, 1, 0, 1, -2406, 11, 0, 0, 0, -2404, 4,
+    -2403, -2402, -2401, 9, 7, 0, 2, 0, 1, 0, 0, 1, -2399, 1, -2397, -2395,
+    1, -2393, 0, 0, -2392, 0, -2390, 1, 0, -2387, 2, -2384, -2383, -2381, 0, 0,
+    2, -2380, -2376, 0, 2, 1, -2373, 0, -2366, -2365, 0, 2, 8, -2360, 4, 10,
+    1, 1, 0, 0, -2358, 1, -2352, 0, -2343, -2338, 4, 11, 1, 0, -2335, -2334,
+    2, -2330, 0, 2, -2328, -2324, 7, 4, 3, 0, 0, -2323, 1, 7, 0, 0,
+    0, 0, 5, 3, -2322, 1, 0, 0, -2321, 0, 0, 0, 0, 0, -2316, 5,
+    0, 10, 0, -2314, 1, -2313, 0, 1, 2, 0, 2, 0, -2310, 0, 0, 0,
+    0, 3, -2309, 0, 1, -2307, 8, 0, 1, 4, -2303, -2302, 1, 2, 7, 0,
+    -2300, 1, 2, 0, -2299, 2, -2297, 0, 0, 3, 1, 0, 0, -2296, -2294, -2293,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2, -2290, 1, -2289, 28,
+    -2288, 0, 0, 4, 1, -2287, 0, -2286, 3, 1, -2280, -2279, -2277, 1, 1, 0,
+    0, 0, 4, -2276, -2275, 0, -2274, 1, 0, 0, -2271, 0, -2268, 3, -2264, 1,
+    2, -2262, -2261, 0, 1, -2256, 0, 0, -2253, 9, 1, 0, 2, 0, 2, -2252,
+    -2250, 1, 0, 0, 1, 0, 0, 0, 6, 8, 0, -2247, -2245, 0, -2243, 1,
+    0, 5, 0, 2, 3, 0, 4, 0, 0, 6, 0, 0, 0, -2240, -2239, 2,
+    -2236, 0, 3, 0, 2, 3, -2235, -2233, -2232, 2, -2227, -2226, 1, -2219, -2218, 5,
+    0, 1, -2213, -2204, 0, 3, 0, 0, -2199, 1, -2195, 0, -2192, -2184, 1, -2183,
+    0, -2178, -2177, -2174, 1, 2, -2172, 0, 0, -2171, -2168, 0, -2164, -2163, 1, -2159,
+    8, -2154, 0, -2152, 0, 0, -2151, -2145, 0, -2144, 0, 2, -2142, 1, -2138, 0,
+    0, 0, 0, -2132, 0, 7, 0, 1, 0, 0, 0, 0, 1, -2131, 0, 1,
+    0, -2127, 0, -2126, 2, 1, 3, -2123, 0, -2121, -2120, 10, 0, 1, -2118, 0,
+    -2117, 0, 0, -2114, -2113, 4, 0, -2112, -2109, -2107, -2104, 0, 5, -2103, -2102, 0,
+    -2098, 0, -2097, 7, 0, 5, 0, 0, -2090, -2086, 0, -2083, 3, 0, 0, 0,
+    0, -2080, -2077, 0, 1, 3, 0, -2074, 0, -2072, 0, 4, -2071, 12, 3, 5,
+    -2069, -2068, 4, 2, -2067, -2064, -2060, -2051, -2050, -2046, 0, -2045, 0, 1, -2040, 0,
+    0, 0, 2, -2038, -2036, 9, 0, -2034, 0, -2032, 0, -2027, 1, 0, 0, 0,
+    7, 0, 0, -2021, 0, -2020, 4, 1, -2018, 0, -2017, 0, -2014, 0, -2012, 0,
+    1, -2010, -2009, -2005, 0, 0, 1, 2, 0, 1, 1, 0, 0, 1, -2003, 1,
+    0, -2001, -1994, 0, -1993, -1988, -1987, 1, -1978, -1976, -1973, 6, 4, 0, 0, -1971,
+    0, 0, -1968, 1, 5, 4, -1966, -1961, 1, -1959, -1952, 1, 6, 0, 2, 1,
+    0, 2, 1, 0, -1951, 0, 1, 1, 0, 0, 4, 0, 5, -1950, -1947, 0,
+    -1946, 0, -1944, -1938, 2, 0, -1937, 4, -1936, 0, 2, 1, -1935, 0, 0, 1,
+    0, 0, 0, 0, -1933, 2, -1932, -1931, -1927, 5, 0, 0, 0, 9, 0, -1926,
+    1, 1, 1, 24, 0, -1924, 5, -1918, 0, -1917, -1908, -1906, 3, 7, 0, 0,
+    2, 0, 8, 0, 0, 1, -1903, 0, -1898, -1895, 4, 1, -1894, 0, 0, 0,
+    -1893, 0, -1892, 3, 1, 4, 0, 2, 0, 0, -1891, -1880, 9, -1879, -1878, -1877,
+    1, -1876, 0, 0, 0, 0, 2, 1, 0, -1875, -1874, 0, 0, -1872, 0, -1871,
+    1, 0, 1, -1869, 0, 0, 0, 0, 0, -1867, 3, 0, 0, 4, 1, 0,
+    -1866, 0, -1865, -1864, 8, 0, 1, -1863, 0, -1859, -1855, 0, 0, 0, 4, 0,
+    0, 0, 0, -1852, 0, 27, -1847, 0, 1, 0, 0, 1, -1846, 0, -1845, 2,
+    -1844, 0, 0, -1841, 0, -1840, 1, -1839, 0, 0, -1834, 6, -1833, 0, 4, -1828,
+    2, 0, -1826, -1824, 3, -1822, -1821, 1, 2, 1, -1819, 0, 0, 2, -1817, 5,
+    -1816, 3, -1813, 0, 0, -1812, 0, -1811, -1810, -1807, 0, -1806, 3, -1803, 0, 2,
+    -1801, -1800, -1796, 3, -1794, -1793, -1791, -1787, -1784, -1783, -1776, 0, 2, 1, 0, 0,
+    0, -1773, 0, 18, -1772, 3, -1770, 0, 2, 3, -1769, 1, -1768, 0, -1765, 0,
+    0, 3, 0, 0, 20, 0, -1764, 0, 4, -1763, 3, 3, 1, 0, 0, -1761,
+    1, -1760, 0, -1758, 0, -1756, -1754, -1751, -1750, 0, 0, 0, 0, -1749, -1743, 1,
+    0, 0, 0, -1739, 0, 0, -1738, -1735, -1732, -1727, -1725, 0, 0, 0, 0, 6,
+    0, 0, 0, 0, 0, -1723, 1, -1720, -1719, -1717, -1716, 0, 0, 0, 4, 0,
+    -1705, -1704, 0, 1, -1702, 0, -1696, 0, 3, -1695, -1690, 5, -1689, 0, 0, -1688,
+    2, 0, 0, 0, -1685, 0, -1682, 5, 0, 1, -1680, 2, -1679, 0, -1676, 0,
+    -1674, 0, -1671, 14, 0, 0, -1668, 7, -1667, -1666, 1, 3, 0, 5, -1660, -1656,
+    -1653, 4, -1646, -1645, -1642, 0, -1641, 0, 0, -1638, 2, -1634, -1633, -1629, -1628, 0,
+    0, 1, 2, -1625, -1621, -1616, 4, 0, 1, -1615, 12, 0, -1613, -1611, -1605, 3,
+    0, 1, 0, -1603, 0, -1601, 0, -1596, 0, 0, -1595, -1593, -1587, 0, 1, 1,
+    -1586, 0, -1585, 1, -1580, -1577, -1574, -1573, 16, 1, 12, -1572, -1566, 2, -1564, 0,
+    -1563, -1561, -1557, 3, 3, -1552, 0, 0, 1, 2, -1547, 0, 0, -1543, 0, -1540,
+    -1538, -1537, -1535, -1530, 2, 0, 7, -1527, -1521, 2, 9, 6, 3, 0, 1, -1520,
+    -1514, 1, -1513, 0, -1510, 6, 5, 1, -1505, 0, 1, 0, -1504, 0, 0, -1503,
+    1, -1502, -1498, 0, -1494, 0, -1491, 1, -1488, 0, -1481, -1480, 0, 0, 2, -1477,
+    -1470, 1, -1468, 2, -1466, 1, 0, -1463, 0, 8, 7, 0, -1462, 0, -1461, -1456,
+    0, -1455, -1453, -1449, 2, -1448, 0, -1447, 2, -1442, -1441, 5, 0, -1433, -1432, 0,
+    2, 6, 0, 3, 1, -1428, -1426, 0, 0, 13, 0, 4, 0, -1425, 2, 0,
+    -1423, -1414, -1413, -1412, 1, 0, -1406, 0, 7, 4, 8, -1405, 2, -1404, -1402, 0,
+    0, 0, -1401, -1399, 8, 0, 0, 1, 1, 3, 0, -1397, 2, 6, -1394, -1389,
+    4, 0, 0, 0, 0, 20, -1383, 3, -1382, -1380, -1379, 2, 0, 0, 0, 0,
+    0, 2, -1377, -1376, -1374, 0, -1369, -1368, -1365, -1364, 1, 0, 0, -1362, 2, -1360,
+    0, 9, 0, -1359, -1358, 1, 0, 1, 0, 12, -1356, -1355, -1354, 2, 0, -1353,
+    6, 0, 6, -1350, -1349, 2, -1342, 0, 2, -1340, 7, 0, -1339, 1, 1, 0,
+    -1336, 0, -1334, -1333, 0, -1328, 4, -1325, 0, 0, -1324, 0, 0, 1, -1323, -1315,
+    0, -1314, 0, 0, -1310, 0, 11, 0, -1308, -1306, 0, 0, 2, -1304, 9, -1303,
+    -1302, 0, -1301, 2, 3, 0, 7, -1299, 6, -1297, 0, 10, 20, 2, -1296, -1295,
+    1, -1293, 1, 0, -1288, 0, -1287, -1283, -1280, 2, 9, 5, -1279, 0, -1272, 0,
+    -1270, 0, 0, 0, -1269, 1, 0, -1268, 0, 0, 3, -1266, -1265, 0, 0, -1264,
+    -1263, -1261, 0, -1256, -1253, 1, 0, -1251, 8, -1250, -1249, -1248, 2, -1245, 0, -1234,
+    3, 0, -1233, 0, 6, 0, -1230, -1225, 0, 0, 0, -1224, 0, -1222, 2, 0,
+    4, 5, 3, 0, 0, -1221, 3, 0, 12, 0, 1, 0, -1220, 0, -1208, -1205,
+    -1200, -1199, 9, 0, 0, 0, 0, -1196, -1195, 6, -1191, -1190, 0, 0, -1187, -1182,
+    0, 0, -1177, 3, -1174, 0, 0, 2, 0, 0, -1172, 0, -1167, 4, 0, -1166,
+    3, -1165, -1163, 2, 1, -1158, -1154, 0, 0, 6, 0, 0, 1, 0, -1151, 0,
+    1, 5, -1150, 3, 0, -1149, 0, 0, 15, -1145, -1144, 0, 0, -1143, 0, -1141,
+    -1137, 1, 11, -1135, 0, 0, 0, -1134, 0, -1133, 0, 12, 0, -1128, 2, -1127,
+    -1126, 1, 2, -1125, -1120, 0, 4, -1118, -1115, 0, 0, 1, 1, 0, -1114, 0,
+    -1112, 13, -1109, -1108, -1107, -1103, 0, 0, 0, 0, -1102, 3, -1101, 3, 0, 0,
+    0, 0, 0, 1, 2, -1100, -1098, -1090, 4, 0, 3, 0, -1086, -1085, -1083, 5,
+    12, 2, 1, -1081, 0, 3, 11, 3, -1077, 0, 12, -1075, -1073, 5, 3, -1071,
+    1, 4, 0, 0, -1066, -1065, -1060, -1057, 0, 3, 3, 0, 0, 0, -1054, 0,
+    0, -1051, 0, 1, 0, 0, 0, -1050, 0, 0, 0, 0, -1048, -1044, 0, 2,
+    0, 2, -1043, 1, 0, 0, -1037, 0, 0, 0, 0, 0, 0, 6, -1035, 11,
+    1, 3, 10, -1031, -1027, -1020, -1012, -1010, -1009, 0, -1008, 22, 1, 1, 1, -1006,
+    -1005, -1004, 0, -1002, 0, -1001, 0, 2, -1000, 0, 8, 2, -994, 3, 0, 5,
+    -992, 0, -978, 3, 0, 0, -974, 0, 0, 0, 1, 2, 3, -973, 0, 0,
+    -971, -969, 0, -968, -963, 0, 0, -962, 1, 1, 0, 0, -956, 0, -953, 0,
+    -952, 2, -950, 0, 0, 5, 9, 0, 0, -949, -948, -946, -941, 5, 4, 2,
+    -939, 7, -938, -937, -934, 1, 2, -933, 0, 0, 0, 0, 0, -931, -926, 0,
+    -924, 0, -921, -916, 2, -914, 0, 0, 0, -912, 0, 3, -911, 0, 1, 0,
+    0, 0, -910, -908, 0, 0, -904, -902, 0, 4, 2, 0, 0, -899, 0, 1,
+    0, 1, 4, 4, 0, -897, 0, 0, 5, 1, 0, 10, 0, 0, 0, 0,
+    -896, -895, -893, -890, 0, 2, 1, 3, 0, -883, -882, -878, -876, 0, 0, -874,
+    0, 0, -869, 8, 0, -860, 0, 0, -859, 0, -856, 3, -849, 0, -846, 0,
+    -844, -842, -840, 7, 1, -838, -833, 0, -831, 0, 0, 0, 0, -825, -822, 1,
+    -817, -816, 0, -815, 0, 0, 1, 0, -810, -808, -806, -803, 6, 1, -801, 0,
+    -800, 8, -799, -790, -789, 2, 2, 0, 1, 1, -785, 5, -784, 0, 0, 0,
+    -782, -781, -778, 0, -777, 0, -773, 4, 1, 0, 0, 0, 0, -772, 1, -766,
+    2, 3, 0, -763, 0, -760, 2, -758, 0, 0, -755, 0, 0, -752, 0, 6,
+    -740, -735, 13, -730, 1, 0, 0, -727, 3, -726, 1, -724, 0, 1, 1, 0,
+    -722, 3, -720, 0, 0, -717, 0, 4, -711, 0, 0, -706, -704, 5, -703, 1,
+    -700, 0, 7, -698, 2, 0, -693, -691, 1, 0, 2, 0, 2, 0, -689, 0,
+    -686, -678, 2, -674, 11, 0, -672, 0, 5, 0, 0, 16, 0, 5, -669, 0,
+    0, 0, 1, 0, 0, -667, 0, -666, 0, -659, -658, 12, 4, -657, 12, 0,
+    4, -655, 0, 0, 32, 0, 0, 11, 0, -654, -649, -645, 1, 0, 0, 0,
+    0, 7, 1, -643, 0, -635, 0, 0, -634, 0, 8, 3, 0, -633, 0, -632,
+    0, 0, -631, 1, -626, 0, 2, 0, -625, -621, -620, -618, 14, -617, -613, 4,
+    0, 0, 0, 4, -611, 1, -608, 0, 0, 0, 1, 1, 11, 1, 0, -604,
+    -603, -597, 0, -596, 0, 0, 13, 0, 1, -595, -592, 0, 0, 0, 0, 0,
+    -591, 0, 0, 6, -579, -577, -576, -574, -568, -566, 0, -565, 0, 0, 13, 0,
+    -564, -560, 0, -559, 0, -556, -553, 0, -552, -548, 0, -544, 0, -541, -540, 0,
+    0, -536, -532, 0, 0, 1, -529, 0, 0, 5, 0, 1, -526, 0, 0, 2,
+    0, 0, -520, -519, 0, -517, 0, 0, 6, 0, -512, -507, 0, -506, 2, -496,
+    8, 3, -494, -493, 0, 15, -492, 0, 11, 6, 0, 7, -488, -487, -485, 0,
+    3, -484, 4, -482, -479, 0, -478, -470, -468, 0, -466, 2, 9, 4, -464, -463,
+    0, 0, 1, 0, -462, 5, 0, 0, -461, 0, -456, -452, 0, -450, 0, 0,
+    -447, -445, -441, -439, 6, 4, 0, 16, 0, -438, -432, -430, 0, 4, 0, 3,
+    0, -429, 0, -428, 6, 0, 1, 1, -425, 0, 0, 1, 0, 1, 0, 0,
+    5, -424, 6, 1, 0, 0, 13, 0, 0, 5, -423, -422, 2, 1, 11, -420,
+    3, -415, 1, 0, -413, -405, -400, -396, -394, -387, 0, -386, 0, 10, 0, 9,
+    -384, 1, 0, -381, -380, 0, -378, -375, 1, 0, -372, -368, 3, 0, 0, 1,
+    -365, 9, -360, -359, 3, -358, 0, 2, 0, 0, 0, 0, 0, -354, 15, -353,
+    13, -351, 7, -350, 0, 0, 10, -349, 0, 6, -343, -341, -340, -339, 13, 4,
+    0, -337, -335, 13, -334, 0, -333, 1, 1, 20, 0, 0, -331, -328, -326, 0,
+    -324, 0, 0, -322, 0, 0, 0, 0, 0, 0, -320, -311, 0, 0, 0, -310,
+    -307, 0, -305, 0, -304, 0, -303, -300, 0, 21, 0, 1, 0, 1, 0, 2,
+    0, 0, 1, -295, 0, -293, 0, 0, -292, 0, 0, 0, 0, 0, 0, -291,
+    8, 0, 2, -288, 0, 7, -284, 3, -278, -277, 0, -272, 3, 0, 2, 0,
+    0, 7, 0, 5, 0, -269, 0, -266, 1, -265, 0, 0, 0, 1, 9, 0,
+    3, -264, -262, -257, 0, 3, -255, -254, -252, -251, -250, 6, 0, 0, 0, -247,
+    -244, 0, 0, 6, -241, 0, -240, 1, 0, 6, -239, 4, 0, 0, 10, -237,
+    0, -236, 0, 3, 1, 0, -235, 0, -234, 0, 0, 6, 0, 4, 0, 0,
+    0, -233, 4, 0, 8, 0, 0, -231, 0, -228, 3, 4, 0, 9, -225, 2,
+    8, 0, 0, 2, 0, 0, -223, -219, -217, 0, -211, -209, 4, -206, -205, -204,
+    7, 2, -202, 0, 0, 0, -197, 1, 0, -189, -184, 0, 0, 3, 0, 20,
+    -182, 0, 29, 1, -180, 0, -178, 0, 0, -173, 1, -172, 4, -171, -167, -165,
+    -163, 12, 6, 0, -162, -161, -157, 2, 0, 3, 6, 0, 0, 0, 1, 0,
+    -154, 0, 0, 0, 0, -138, -137, -136, 0, 1, -135, -132, -131, 0, -127, 1,
+    0, 0, 1, -126, 1, -123, 43, 0, -121, 13, 0, 0, 0, 3, -120, 14,
+    -117, 0, 0, 19, 0, -116, 14, 0, 2, 0, 2, 0, 6, 0, 3, 1,
+    1, -114, 1, 0, 7, 0, 7, -110, 21, -109, 6, 0, 0, 5, -108, 0,
+    -107, 0, 4, -106, 0, 0, 0, 3, -101, 2, 2, 0, 0, 1, 0, -99,
+    0, 0, 0, 0, -98, 0, 1, 0, 2, -94, -92, 0, 2, 0, 0, -91,
+    -89, 0, -85, 1, -83, 0, 0, 0, -81, 3, 1, -77, -74, 0, 6, 9,
+    1, -68, -64, -62, 5, 2, 2, 5, 3, 0, -59, 0, 11, -58, -47, 0,
+    -46, 3, 9, 3, 15, 23, 0, -45, 1, 0, -44, -43, -41, -38, 0, 0,
+    0, 5, 0, -36, 2, 1, 0, -29, 0, 0, -23, -22, -17, 0, 0, -16,
+    -13, 2, 2, -11, 12, 0, 12, -9, -8, -6, 6, -2,
+  } ;
+
+  static constexpr RegisterDbKey Keys[] = {
+    {293U, RegisterDbKey::NoField}, //TIM11.CCR1
+    {545U, 3354U}, //GPIOD.BSRR.BS1
+    {115U, 695U}, //OTG_FS_HOST.FS_HCCHAR6.LSDEV
+    {295U, 1670U}, //TIM2.CR1.URS
+    {84U, 506U}, //OTG_FS_GLOBAL.FS_GOTGINT.HNSSCHG
+    {613U, 4066U}, //I2S2ext.I2SCFGR.I2SE
+    {26U, 96U}, //DBG.DBGMCU_CR.DBG_SLEEP
+    {456U, 2567U}, //DMA2.S6NDTR.NDT
+    {550U, 3418U}, //GPIOC.OTYPER.OT2
+    {120U, 740U}, //OTG_FS_HOST.FS_HCINT3.CHH
+    {367U, 2075U}, //TIM5.CNT.CNT_L
+    {495U, 2800U}, //DMA1.S4CR.PL
+    {90U, 578U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Device.EPNUM
+    {304U, 1738U}, //TIM2.CCMR2_Input.IC4PSC
+    {276U, 1626U}, //TIM10.CCMR1_Output.OC1FE
+    {341U, 1920U}, //TIM4.EGR.CC3G
+    {32U, 184U}, //EXTI.FTSR.TR0
+    {536U, 3203U}, //GPIOE.LCKR.LCK8
+    {698U, 4419U}, //NVIC.IPR14.IPR_N2
+    {471U, 2688U}, //DMA1.S0CR.PL
+    {725U, 4536U}, //SCB.SHCRS.USGFAULTPENDED
+    {513U, 2880U}, //DMA1.S7CR.PBURST
+    {527U, 3052U}, //GPIOH.AFRL.AFRL6
+    {606U, RegisterDbKey::NoField}, //I2S2ext.CR1
+    {561U, 3585U}, //GPIOB.OSPEEDR.OSPEEDR12
+    {60U, 394U}, //OTG_FS_DEVICE.DOEPCTL1.EONUM_DPID
+    {397U, 2190U}, //USART1.GTPR.PSC
+    {258U, 1566U}, //TIM8.CCMR2_Output.OC4FE
+    {667U, 4336U}, //SPI5.I2SCFGR.I2SE
+    {597U, 3978U}, //I2C1.CR1.SWRST
+    {146U, 949U}, //RCC.CFGR.PPRE1
+    {633U, 4178U}, //SPI2.CR1.CPOL
+    {100U, 605U}, //OTG_FS_GLOBAL.FS_DIEPTXF2.INEPTXSA
+    {255U, 1540U}, //TIM8.EGR.TG
+    {233U, 1414U}, //TIM1.EGR.COMG
+    {157U, 1051U}, //RCC.AHB2LPENR.OTGFSLPEN
+    {53U, 323U}, //OTG_FS_DEVICE.DVBUSPULSE.DVBUSP
+    {637U, 4197U}, //SPI2.CRCPR.CRCPOLY
+    {0U, 5U}, //ADC_Common.CSR.AWD3
+    {108U, 625U}, //OTG_FS_HOST.FS_HPRT.PRES
+    {113U, 678U}, //OTG_FS_HOST.FS_HCCHAR4.DAD
+    {256U, 1551U}, //TIM8.CCMR1_Output.CC2S
+    {653U, 4284U}, //SPI4.SR.TXE
+    {138U, 880U}, //OTG_FS_HOST.FS_HCTSIZ5.PKTCNT
+    {508U, RegisterDbKey::NoField}, //DMA1.S6NDTR
+    {577U, 3856U}, //GPIOA.AFRL.AFRL7
+    {559U, 3563U}, //GPIOB.MODER.MODER2
+    {322U, 1825U}, //TIM3.CCMR1_Output.OC1PE
+    {532U, 3125U}, //GPIOE.PUPDR.PUPDR5
+    {565U, 3657U}, //GPIOB.BSRR.BR4
+    {394U, 2166U}, //USART1.CR1.RWU
+    {314U, 1770U}, //TIM2.DMAR.DMAB
+    {544U, 3316U}, //GPIOD.ODR.ODR7
+    {586U, 3923U}, //I2C3.CCR.CCR
+    {112U, 671U}, //OTG_FS_HOST.FS_HCCHAR3.CHENA
+    {704U, 4447U}, //FPU.FPCCR.MONRDY
+    {468U, 2624U}, //DMA1.HISR.HTIF7
+    {424U, RegisterDbKey::NoField}, //DMA2.S0FCR
+    {662U, 4326U}, //SPI5.SR.CRCERR
+    {449U, 2527U}, //DMA2.S5CR.MSIZE
+    {61U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPCTL2
+    {68U, 455U}, //OTG_FS_DEVICE.DOEPINT1.EPDISD
+    {320U, 1803U}, //TIM3.SR.CC3OF
+    {135U, 872U}, //OTG_FS_HOST.FS_HCTSIZ2.DPID
+    {501U, 2838U}, //DMA1.S5CR.HTIE
+    {114U, 682U}, //OTG_FS_HOST.FS_HCCHAR5.MPSIZ
+    {196U, RegisterDbKey::NoField}, //RTC.BKP13R
+    {638U, 4198U}, //SPI2.RXCRCR.RxCRC
+    {66U, 445U}, //OTG_FS_DEVICE.DIEPINT3.EPDISD
+    {381U, 2107U}, //TIM9.SR.TIF
+    {374U, 2087U}, //TIM5.DCR.DBL
+    {128U, 820U}, //OTG_FS_HOST.FS_HCINTMSK3.TXERRM
+    {235U, RegisterDbKey::NoField}, //TIM1.CCMR1_Input
+    {531U, 3100U}, //GPIOE.OSPEEDR.OSPEEDR14
+    {123U, 766U}, //OTG_FS_HOST.FS_HCINT6.XFRC
+    {3U, 37U}, //ADC1.CR1.JAUTO
+    {633U, RegisterDbKey::NoField}, //SPI2.CR1
+    {543U, 3301U}, //GPIOD.IDR.IDR6
+    {342U, 1924U}, //TIM4.CCMR1_Output.OC2CE
+    {633U, 4169U}, //SPI2.CR1.CRCNEXT
+    {518U, 2904U}, //DMA1.S7FCR.DMDIS
+    {524U, 2998U}, //GPIOH.ODR.ODR3
+    {608U, 4059U}, //I2S2ext.SR.TXE
+    {364U, 2054U}, //TIM5.CCMR2_Output.OC3FE
+    {449U, 2530U}, //DMA2.S5CR.PINC
+    {648U, RegisterDbKey::NoField}, //SPI3.TXCRCR
+    {150U, 992U}, //RCC.APB1RSTR.WWDGRST
+    {147U, 971U}, //RCC.CIR.HSERDYF
+    {366U, 2065U}, //TIM5.CCER.CC3NP
+    {602U, 4014U}, //I2C1.SR1.STOPF
+    {500U, 2820U}, //DMA1.S4FCR.DMDIS
+    {242U, 1469U}, //TIM1.CCR1.CCR1
+    {204U, 1244U}, //SDIO.CLKCR.BYPASS
+    {608U, 4058U}, //I2S2ext.SR.CHSIDE
+    {531U, 3109U}, //GPIOE.OSPEEDR.OSPEEDR5
+    {575U, 3836U}, //GPIOA.BSRR.BS2
+    {443U, 2499U}, //DMA2.S4CR.MSIZE
+    {116U, 705U}, //OTG_FS_HOST.FS_HCCHAR7.LSDEV
+    {652U, 4275U}, //SPI4.CR2.TXDMAEN
+    {558U, RegisterDbKey::NoField}, //GPIOC.AFRH
+    {460U, 2571U}, //DMA2.S6FCR.FEIE
+    {543U, 3297U}, //GPIOD.IDR.IDR10
+    {584U, 3911U}, //I2C3.SR1.ADDR
+    {532U, 3116U}, //GPIOE.PUPDR.PUPDR14
+    {542U, 3290U}, //GPIOD.PUPDR.PUPDR1
+    {404U, 2241U}, //USART2.GTPR.PSC
+    {88U, 544U}, //OTG_FS_GLOBAL.FS_GINTSTS.IISOIXFR
+    {364U, 2050U}, //TIM5.CCMR2_Output.CC4S
+    {507U, 2850U}, //DMA1.S6CR.CHSEL
+    {565U, 3667U}, //GPIOB.BSRR.BS10
+    {715U, 4490U}, //STK.CALIB.TENMS
+    {340U, 1911U}, //TIM4.SR.CC1OF
+    {278U, 1631U}, //TIM10.CCER.CC1NP
+    {593U, RegisterDbKey::NoField}, //I2C2.SR1
+    {144U, 917U}, //RCC.CR.HSITRIM
+    {466U, 2601U}, //DMA2.S7FCR.DMDIS
+    {535U, 3191U}, //GPIOE.BSRR.BS3
+    {527U, 3058U}, //GPIOH.AFRL.AFRL0
+    {649U, 4249U}, //SPI3.I2SCFGR.I2SSTD
+    {304U, 1739U}, //TIM2.CCMR2_Input.CC4S
+    {326U, 1852U}, //TIM3.CCER.CC4E
+    {317U, RegisterDbKey::NoField}, //TIM3.CR2
+    {218U, 1312U}, //SDIO.MASK.CEATAENDIE
+    {565U, 3673U}, //GPIOB.BSRR.BS4
+    {691U, 4391U}, //NVIC.IPR7.IPR_N2
+    {521U, 2946U}, //GPIOH.OSPEEDR.OSPEEDR7
+    {220U, RegisterDbKey::NoField}, //SDIO.FIFO
+    {693U, 4398U}, //NVIC.IPR9.IPR_N1
+    {501U, 2830U}, //DMA1.S5CR.MSIZE
+    {461U, 2577U}, //DMA2.S7CR.PBURST
+    {501U, 2823U}, //DMA1.S5CR.MBURST
+    {229U, 1372U}, //TIM1.CR2.OIS1
+    {239U, RegisterDbKey::NoField}, //TIM1.CNT
+    {421U, RegisterDbKey::NoField}, //DMA2.S0PAR
+    {517U, 2901U}, //DMA1.S7M1AR.M1A
+    {556U, 3531U}, //GPIOC.LCKR.LCK2
+    {35U, 255U}, //FLASH.ACR.ICEN
+    {449U, 2534U}, //DMA2.S5CR.TCIE
+    {316U, 1778U}, //TIM3.CR1.UDIS
+    {88U, 549U}, //OTG_FS_GLOBAL.FS_GINTSTS.CIDSCHG
+    {304U, 1737U}, //TIM2.CCMR2_Input.IC4F
+    {563U, 3614U}, //GPIOB.IDR.IDR15
+    {500U, 2818U}, //DMA1.S4FCR.FEIE
+    {309U, 1761U}, //TIM2.CCR1.CCR1_L
+    {307U, RegisterDbKey::NoField}, //TIM2.PSC
+    {531U, 3112U}, //GPIOE.OSPEEDR.OSPEEDR2
+    {115U, 693U}, //OTG_FS_HOST.FS_HCCHAR6.EPNUM
+    {287U, 1650U}, //TIM11.CCMR1_Output.OC1M
+    {719U, 4509U}, //SCB.AIRCR.VECTCLRACTIVE
+    {629U, 4153U}, //SPI1.RXCRCR.RxCRC
+    {427U, 2428U}, //DMA2.S1PAR.PA
+    {332U, RegisterDbKey::NoField}, //TIM3.CCR3
+    {732U, 4568U}, //FPU_CPACR.CPACR.CP
+    {461U, 2586U}, //DMA2.S7CR.PINC
+    {384U, 2124U}, //TIM9.CCMR1_Input.IC2PCS
+    {167U, RegisterDbKey::NoField}, //RTC.ISR
+    {130U, 840U}, //OTG_FS_HOST.FS_HCINTMSK5.TXERRM
+    {520U, 2937U}, //GPIOH.OTYPER.OT0
+    {483U, 2744U}, //DMA1.S2CR.PL
+    {542U, 3291U}, //GPIOD.PUPDR.PUPDR0
+    {35U, 253U}, //FLASH.ACR.LATENCY
+    {31U, 169U}, //EXTI.RTSR.TR8
+    {556U, 3521U}, //GPIOC.LCKR.LCK12
+    {598U, 3996U}, //I2C1.CR2.ITERREN
+    {96U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GCCFG
+    {489U, 2778U}, //DMA1.S3CR.CIRC
+    {597U, 3980U}, //I2C1.CR1.PEC
+    {473U, RegisterDbKey::NoField}, //DMA1.S0PAR
+    {177U, 1194U}, //RTC.TSDR.MT
+    {384U, 2126U}, //TIM9.CCMR1_Input.IC1F
+    {180U, 1210U}, //RTC.TAFCR.TAMPTS
+    {0U, 14U}, //ADC_Common.CSR.JSTRT1
+    {4U, 48U}, //ADC1.CR2.JEXTEN
+    {60U, 386U}, //OTG_FS_DEVICE.DOEPCTL1.SODDFRM
+    {339U, RegisterDbKey::NoField}, //TIM4.DIER
+    {74U, 475U}, //OTG_FS_DEVICE.DIEPTSIZ2.MCNT
+    {9U, RegisterDbKey::NoField}, //ADC1.JOFR3
+    {43U, RegisterDbKey::NoField}, //IWDG.RLR
+    {303U, 1729U}, //TIM2.CCMR2_Output.OC4PE
+    {285U, 1647U}, //TIM11.SR.UIF
+    {340U, 1917U}, //TIM4.SR.UIF
+    {123U, 773U}, //OTG_FS_HOST.FS_HCINT6.FRMOR
+    {527U, 3057U}, //GPIOH.AFRL.AFRL1
+    {128U, 818U}, //OTG_FS_HOST.FS_HCINTMSK3.ACKM
+    {298U, 1685U}, //TIM2.DIER.CC3DE
+    {608U, 4055U}, //I2S2ext.SR.MODF
+    {565U, 3648U}, //GPIOB.BSRR.BR13
+    {608U, RegisterDbKey::NoField}, //I2S2ext.SR
+    {194U, RegisterDbKey::NoField}, //RTC.BKP11R
+    {29U, 121U}, //EXTI.IMR.MR6
+    {569U, 3726U}, //GPIOA.MODER.MODER0
+    {418U, 2373U}, //DMA2.HIFCR.CDMEIF5
+    {468U, 2639U}, //DMA1.HISR.HTIF4
+    {125U, 784U}, //OTG_FS_HOST.FS_HCINTMSK0.XFRCM
+    {649U, RegisterDbKey::NoField}, //SPI3.I2SCFGR
+    {400U, 2203U}, //USART2.BRR.DIV_Fraction
+    {501U, 2832U}, //DMA1.S5CR.MINC
+    {143U, 902U}, //PWR.CSR.SBF
+    {186U, 1223U}, //RTC.BKP3R.BKP
+    {58U, 362U}, //OTG_FS_DEVICE.DIEPCTL3.EPDIS
+    {469U, 2651U}, //DMA1.LIFCR.CDMEIF2
+    {442U, RegisterDbKey::NoField}, //DMA2.S3FCR
+    {138U, 881U}, //OTG_FS_HOST.FS_HCTSIZ5.DPID
+    {634U, 4186U}, //SPI2.CR2.RXDMAEN
+    {624U, 4130U}, //SPI1.CR1.SPE
+    {122U, 760U}, //OTG_FS_HOST.FS_HCINT5.NAK
+    {299U, 1702U}, //TIM2.SR.CC2IF
+    {617U, 4099U}, //I2S3ext.SR.OVR
+    {471U, 2691U}, //DMA1.S0CR.PSIZE
+    {685U, 4368U}, //NVIC.IPR1.IPR_N3
+    {166U, 1117U}, //RTC.CR.SUB1H
+    {525U, 3027U}, //GPIOH.BSRR.BS6
+    {384U, 2127U}, //TIM9.CCMR1_Input.ICPCS
+    {147U, 955U}, //RCC.CIR.CSSC
+    {572U, 3770U}, //GPIOA.PUPDR.PUPDR4
+    {154U, 1026U}, //RCC.APB1ENR.TIM4EN
+    {84U, 504U}, //OTG_FS_GLOBAL.FS_GOTGINT.SEDET
+    {311U, 1765U}, //TIM2.CCR3.CCR3_L
+    {232U, 1406U}, //TIM1.SR.COMIF
+    {258U, 1563U}, //TIM8.CCMR2_Output.OC4CE
+    {45U, 292U}, //OTG_FS_DEVICE.FS_DCFG.DAD
+    {133U, 864U}, //OTG_FS_HOST.FS_HCTSIZ0.XFRSIZ
+    {445U, 2512U}, //DMA2.S4PAR.PA
+    {156U, 1048U}, //RCC.AHB1LPENR.GPIOCLPEN
+    {507U, 2858U}, //DMA1.S6CR.MSIZE
+    {395U, 2168U}, //USART1.CR2.LINEN
+    {575U, 3827U}, //GPIOA.BSRR.BS11
+    {67U, 447U}, //OTG_FS_DEVICE.DOEPINT0.B2BSTUP
+    {396U, RegisterDbKey::NoField}, //USART1.CR3
+    {126U, 796U}, //OTG_FS_HOST.FS_HCINTMSK1.STALLM
+    {535U, 3166U}, //GPIOE.BSRR.BR12
+    {533U, 3132U}, //GPIOE.IDR.IDR14
+    {546U, 3369U}, //GPIOD.LCKR.LCK3
+    {546U, RegisterDbKey::NoField}, //GPIOD.LCKR
+    {576U, 3839U}, //GPIOA.LCKR.LCKK
+    {541U, 3263U}, //GPIOD.OSPEEDR.OSPEEDR12
+    {255U, RegisterDbKey::NoField}, //TIM8.EGR
+    {129U, 827U}, //OTG_FS_HOST.FS_HCINTMSK4.NAKM
+    {579U, RegisterDbKey::NoField}, //I2C3.CR1
+    {431U, 2439U}, //DMA2.S2CR.CT
+    {523U, 2974U}, //GPIOH.IDR.IDR11
+    {359U, 2011U}, //TIM5.DIER.CC2IE
+    {84U, 509U}, //OTG_FS_GLOBAL.FS_GOTGINT.DBCDNE
+    {537U, 3212U}, //GPIOE.AFRL.AFRL7
+    {258U, 1565U}, //TIM8.CCMR2_Output.OC4PE
+    {526U, 3037U}, //GPIOH.LCKR.LCK13
+    {530U, 3083U}, //GPIOE.OTYPER.OT15
+    {403U, 2230U}, //USART2.CR3.CTSE
+    {59U, 377U}, //OTG_FS_DEVICE.DOEPCTL0.CNAK
+    {62U, 418U}, //OTG_FS_DEVICE.DOEPCTL3.EPTYP
+    {55U, 328U}, //OTG_FS_DEVICE.FS_DIEPCTL0.EPTYP
+    {554U, 3472U}, //GPIOC.ODR.ODR12
+    {152U, 1013U}, //RCC.AHB1ENR.GPIOCEN
+    {522U, 2955U}, //GPIOH.PUPDR.PUPDR14
+    {341U, 1918U}, //TIM4.EGR.TG
+    {652U, 4273U}, //SPI4.CR2.FRF
+    {269U, 1602U}, //TIM8.DMAR.DMAB
+    {575U, 3829U}, //GPIOA.BSRR.BS9
+    {526U, 3034U}, //GPIOH.LCKR.LCKK
+    {705U, RegisterDbKey::NoField}, //FPU.FPCAR
+    {569U, 3715U}, //GPIOA.MODER.MODER11
+    {359U, RegisterDbKey::NoField}, //TIM5.DIER
+    {31U, 177U}, //EXTI.RTSR.TR16
+    {344U, 1945U}, //TIM4.CCMR2_Output.OC3CE
+    {477U, 2717U}, //DMA1.S1CR.PINCOS
+    {593U, 3957U}, //I2C2.SR1.ARLO
+    {304U, 1742U}, //TIM2.CCMR2_Input.CC3S
+    {180U, 1213U}, //RTC.TAFCR.TAMPIE
+    {126U, 802U}, //OTG_FS_HOST.FS_HCINTMSK1.FRMORM
+    {416U, 2338U}, //DMA2.HISR.DMEIF4
+    {687U, 4374U}, //NVIC.IPR3.IPR_N1
+    {564U, 3636U}, //GPIOB.ODR.ODR9
+    {287U, 1652U}, //TIM11.CCMR1_Output.OC1FE
+    {536U, 3200U}, //GPIOE.LCKR.LCK11
+    {288U, 1656U}, //TIM11.CCMR1_Input.CC1S
+    {234U, 1425U}, //TIM1.CCMR1_Output.OC1CE
+    {49U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DOEPMSK
+    {443U, 2505U}, //DMA2.S4CR.PFCTRL
+    {566U, 3689U}, //GPIOB.LCKR.LCK5
+    {561U, 3583U}, //GPIOB.OSPEEDR.OSPEEDR14
+    {529U, 3078U}, //GPIOE.MODER.MODER4
+    {143U, 903U}, //PWR.CSR.PVDO
+    {569U, 3722U}, //GPIOA.MODER.MODER4
+    {380U, RegisterDbKey::NoField}, //TIM9.DIER
+    {602U, 4013U}, //I2C1.SR1.RxNE
+    {470U, 2676U}, //DMA1.HIFCR.CDMEIF5
+    {426U, RegisterDbKey::NoField}, //DMA2.S1NDTR
+    {552U, 3439U}, //GPIOC.PUPDR.PUPDR13
+    {591U, RegisterDbKey::NoField}, //I2C2.OAR2
+    {332U, 1872U}, //TIM3.CCR3.CCR3_L
+    {362U, 2031U}, //TIM5.CCMR1_Output.OC2M
+    {467U, 2614U}, //DMA1.LISR.HTIF1
+    {105U, 615U}, //OTG_FS_HOST.FS_HPTXSTS.PTXQSAV
+    {471U, 2698U}, //DMA1.S0CR.HTIE
+    {151U, RegisterDbKey::NoField}, //RCC.APB2RSTR
+    {214U, 1273U}, //SDIO.DCTRL.DTEN
+    {326U, 1853U}, //TIM3.CCER.CC3NP
+    {45U, 293U}, //OTG_FS_DEVICE.FS_DCFG.PFIVL
+    {251U, 1502U}, //TIM8.CR2.CCDS
+    {558U, 3546U}, //GPIOC.AFRH.AFRH11
+    {636U, 4196U}, //SPI2.DR.DR
+    {585U, 3919U}, //I2C3.SR2.BUSY
+    {409U, 2272U}, //USART6.CR2.CLKEN
+    {394U, 2164U}, //USART1.CR1.TE
+    {469U, 2647U}, //DMA1.LIFCR.CFEIF3
+    {403U, 2231U}, //USART2.CR3.RTSE
+    {209U, 1260U}, //SDIO.RESP2.CARDSTATUS2
+    {568U, 3707U}, //GPIOB.AFRH.AFRH11
+    {538U, 3227U}, //GPIOE.AFRH.AFRH8
+    {82U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPTSIZ3
+    {642U, 4219U}, //SPI3.CR1.LSBFIRST
+    {721U, 4517U}, //SCB.CCR.NONBASETHRDENA
+    {540U, 3254U}, //GPIOD.OTYPER.OT5
+    {340U, RegisterDbKey::NoField}, //TIM4.SR
+    {152U, 1015U}, //RCC.AHB1ENR.GPIOAEN
+    {570U, 3736U}, //GPIOA.OTYPER.OT6
+    {591U, 3949U}, //I2C2.OAR2.ADD2
+    {42U, 286U}, //IWDG.PR.PR
+    {359U, 2007U}, //TIM5.DIER.UDE
+    {172U, 1178U}, //RTC.ALRMBR.MNU
+    {297U, 1678U}, //TIM2.SMCR.ETPS
+    {155U, 1029U}, //RCC.APB2ENR.TIM1EN
+    {226U, 1352U}, //SYSCFG.EXTICR4.EXTI15
+    {258U, 1569U}, //TIM8.CCMR2_Output.OC3M
+    {170U, 1153U}, //RTC.CALIBR.DC
+    {31U, 180U}, //EXTI.RTSR.TR19
+    {147U, 963U}, //RCC.CIR.PLLRDYIE
+    {134U, 869U}, //OTG_FS_HOST.FS_HCTSIZ1.DPID
+    {525U, 3002U}, //GPIOH.BSRR.BR15
+    {87U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GRSTCTL
+    {61U, 402U}, //OTG_FS_DEVICE.DOEPCTL2.CNAK
+    {617U, 4098U}, //I2S3ext.SR.BSY
+    {306U, 1756U}, //TIM2.CNT.CNT_L
+    {216U, 1287U}, //SDIO.STA.CMDACT
+    {231U, 1397U}, //TIM1.DIER.CC2IE
+    {626U, 4147U}, //SPI1.SR.UDR
+    {568U, 3709U}, //GPIOB.AFRH.AFRH9
+    {554U, 3473U}, //GPIOC.ODR.ODR11
+    {712U, 4486U}, //STK.CTRL.CLKSOURCE
+    {501U, 2827U}, //DMA1.S5CR.DBM
+    {555U, 3516U}, //GPIOC.BSRR.BS0
+    {410U, 2289U}, //USART6.CR3.IREN
+    {9U, 60U}, //ADC1.JOFR3.JOFFSET3
+    {0U, 10U}, //ADC_Common.CSR.EOC2
+    {471U, 2696U}, //DMA1.S0CR.PFCTRL
+    {122U, 761U}, //OTG_FS_HOST.FS_HCINT5.ACK
+    {86U, 514U}, //OTG_FS_GLOBAL.FS_GUSBCFG.PHYSEL
+    {729U, RegisterDbKey::NoField}, //SCB.BFAR
+    {270U, 1603U}, //TIM8.RCR.REP
+    {415U, 2311U}, //DMA2.LISR.HTIF1
+    {573U, 3777U}, //GPIOA.IDR.IDR13
+    {564U, 3643U}, //GPIOB.ODR.ODR2
+    {193U, 1230U}, //RTC.BKP10R.BKP
+    {125U, 785U}, //OTG_FS_HOST.FS_HCINTMSK0.CHHM
+    {16U, 84U}, //ADC1.JSQR.JSQ2
+    {545U, 3344U}, //GPIOD.BSRR.BS11
+    {108U, 631U}, //OTG_FS_HOST.FS_HPRT.PSPD
+    {578U, 3868U}, //GPIOA.AFRH.AFRH11
+    {571U, 3758U}, //GPIOA.OSPEEDR.OSPEEDR0
+    {130U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK5
+    {331U, RegisterDbKey::NoField}, //TIM3.CCR2
+    {560U, 3580U}, //GPIOB.OTYPER.OT1
+    {545U, 3349U}, //GPIOD.BSRR.BS6
+    {643U, 4226U}, //SPI3.CR2.RXNEIE
+    {112U, 669U}, //OTG_FS_HOST.FS_HCCHAR3.ODDFRM
+    {613U, 4067U}, //I2S2ext.I2SCFGR.I2SCFG
+    {526U, 3046U}, //GPIOH.LCKR.LCK4
+    {27U, 103U}, //DBG.DBGMCU_APB1_FZ.DBG_TIM4_STOP
+    {30U, 143U}, //EXTI.EMR.MR5
+    {555U, RegisterDbKey::NoField}, //GPIOC.BSRR
+    {443U, 2507U}, //DMA2.S4CR.HTIE
+    {553U, 3454U}, //GPIOC.IDR.IDR14
+    {121U, 748U}, //OTG_FS_HOST.FS_HCINT4.XFRC
+    {177U, 1196U}, //RTC.TSDR.DT
+    {192U, 1229U}, //RTC.BKP9R.BKP
+    {711U, 4478U}, //MPU.MPU_RASR.B
+    {658U, 4290U}, //SPI4.I2SCFGR.I2SMOD
+    {65U, 435U}, //OTG_FS_DEVICE.DIEPINT2.TXFE
+    {344U, 1946U}, //TIM4.CCMR2_Output.OC3M
+    {256U, 1550U}, //TIM8.CCMR1_Output.OC2FE
+    {395U, 2170U}, //USART1.CR2.CLKEN
+    {145U, 934U}, //RCC.PLLCFGR.PLLN1
+    {122U, 764U}, //OTG_FS_HOST.FS_HCINT5.FRMOR
+    {501U, 2825U}, //DMA1.S5CR.ACK
+    {160U, RegisterDbKey::NoField}, //RCC.BDCR
+    {436U, RegisterDbKey::NoField}, //DMA2.S2FCR
+    {542U, 3282U}, //GPIOD.PUPDR.PUPDR9
+    {238U, 1463U}, //TIM1.CCER.CC1NE
+    {113U, 679U}, //OTG_FS_HOST.FS_HCCHAR4.ODDFRM
+    {305U, 1750U}, //TIM2.CCER.CC2P
+    {469U, 2661U}, //DMA1.LIFCR.CDMEIF0
+    {555U, 3500U}, //GPIOC.BSRR.BR0
+    {523U, 2977U}, //GPIOH.IDR.IDR8
+    {519U, 2910U}, //GPIOH.MODER.MODER11
+    {483U, 2745U}, //DMA1.S2CR.PINCOS
+    {310U, RegisterDbKey::NoField}, //TIM2.CCR2
+    {660U, 4309U}, //SPI5.CR1.LSBFIRST
+    {301U, 1715U}, //TIM2.CCMR1_Output.CC2S
+    {394U, 2153U}, //USART1.CR1.OVER8
+    {416U, 2328U}, //DMA2.HISR.DMEIF6
+    {546U, 3367U}, //GPIOD.LCKR.LCK5
+    {233U, 1418U}, //TIM1.EGR.CC1G
+    {29U, 131U}, //EXTI.IMR.MR16
+    {119U, 732U}, //OTG_FS_HOST.FS_HCINT2.STALL
+    {534U, 3160U}, //GPIOE.ODR.ODR2
+    {698U, RegisterDbKey::NoField}, //NVIC.IPR14
+    {525U, 3026U}, //GPIOH.BSRR.BS7
+    {579U, 3883U}, //I2C3.CR1.SMBTYPE
+    {254U, 1527U}, //TIM8.SR.CC4OF
+    {612U, 4064U}, //I2S2ext.TXCRCR.TxCRC
+    {249U, 1482U}, //TIM1.BDTR.OSSI
+    {694U, 4402U}, //NVIC.IPR10.IPR_N1
+    {338U, 1891U}, //TIM4.SMCR.ETPS
+    {58U, 372U}, //OTG_FS_DEVICE.DIEPCTL3.USBAEP
+    {532U, 3117U}, //GPIOE.PUPDR.PUPDR13
+    {370U, 2080U}, //TIM5.CCR1.CCR1_L
+    {162U, 1093U}, //RCC.SSCGR.SPREADSEL
+    {208U, 1259U}, //SDIO.RESP1.CARDSTATUS1
+    {347U, 1969U}, //TIM4.CNT.CNT_L
+    {88U, 541U}, //OTG_FS_GLOBAL.FS_GINTSTS.EOPF
+    {519U, 2912U}, //GPIOH.MODER.MODER9
+    {55U, 327U}, //OTG_FS_DEVICE.FS_DIEPCTL0.NAKSTS
+    {218U, 1334U}, //SDIO.MASK.DCRCFAILIE
+    {540U, RegisterDbKey::NoField}, //GPIOD.OTYPER
+    {425U, 2415U}, //DMA2.S1CR.MSIZE
+    {160U, 1076U}, //RCC.BDCR.RTCEN
+    {39U, RegisterDbKey::NoField}, //FLASH.CR
+    {410U, 2290U}, //USART6.CR3.EIE
+    {643U, RegisterDbKey::NoField}, //SPI3.CR2
+    {613U, 4069U}, //I2S2ext.I2SCFGR.I2SSTD
+    {31U, 164U}, //EXTI.RTSR.TR3
+    {536U, 3208U}, //GPIOE.LCKR.LCK3
+    {530U, 3094U}, //GPIOE.OTYPER.OT4
+    {19U, 88U}, //ADC1.JDR3.JDATA
+    {272U, RegisterDbKey::NoField}, //TIM10.CR1
+    {523U, 2980U}, //GPIOH.IDR.IDR5
+    {34U, 238U}, //EXTI.PR.PR8
+    {650U, 4253U}, //SPI3.I2SPR.MCKOE
+    {469U, 2658U}, //DMA1.LIFCR.CTCIF0
+    {144U, 912U}, //RCC.CR.CSSON
+    {530U, 3095U}, //GPIOE.OTYPER.OT3
+    {544U, 3310U}, //GPIOD.ODR.ODR13
+    {58U, 371U}, //OTG_FS_DEVICE.DIEPCTL3.EONUM_DPID
+    {30U, 155U}, //EXTI.EMR.MR17
+    {418U, 2364U}, //DMA2.HIFCR.CFEIF7
+    {437U, 2469U}, //DMA2.S3CR.PL
+    {604U, RegisterDbKey::NoField}, //I2C1.CCR
+    {357U, 1993U}, //TIM5.CR2.MMS
+    {471U, 2694U}, //DMA1.S0CR.CIRC
+    {550U, 3416U}, //GPIOC.OTYPER.OT4
+    {156U, 1042U}, //RCC.AHB1LPENR.SRAM1LPEN
+    {83U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GOTGCTL
+    {266U, RegisterDbKey::NoField}, //TIM8.CCR3
+    {561U, 3594U}, //GPIOB.OSPEEDR.OSPEEDR3
+    {361U, 2025U}, //TIM5.EGR.CC4G
+    {725U, 4533U}, //SCB.SHCRS.MONITORACT
+    {555U, 3498U}, //GPIOC.BSRR.BR2
+    {418U, 2374U}, //DMA2.HIFCR.CFEIF5
+    {253U, 1522U}, //TIM8.DIER.CC4IE
+    {181U, 1216U}, //RTC.ALRMASSR.MASKSS
+    {548U, 3383U}, //GPIOD.AFRH.AFRH13
+    {304U, 1741U}, //TIM2.CCMR2_Input.IC3PSC
+    {267U, RegisterDbKey::NoField}, //TIM8.CCR4
+    {322U, 1818U}, //TIM3.CCMR1_Output.OC2CE
+    {339U, 1896U}, //TIM4.DIER.TDE
+    {566U, 3681U}, //GPIOB.LCKR.LCK13
+    {565U, 3665U}, //GPIOB.BSRR.BS12
+    {305U, 1749U}, //TIM2.CCER.CC2NP
+    {381U, 2106U}, //TIM9.SR.CC1OF
+    {507U, 2863U}, //DMA1.S6CR.DIR
+    {323U, 1828U}, //TIM3.CCMR1_Input.IC2F
+    {594U, 3968U}, //I2C2.SR2.SMBHOST
+    {576U, 3855U}, //GPIOA.LCKR.LCK0
+    {512U, 2875U}, //DMA1.S6FCR.FS
+    {615U, RegisterDbKey::NoField}, //I2S3ext.CR1
+    {238U, 1454U}, //TIM1.CCER.CC3NP
+    {519U, 2916U}, //GPIOH.MODER.MODER5
+    {285U, 1646U}, //TIM11.SR.CC1IF
+    {437U, 2481U}, //DMA2.S3CR.DMEIE
+    {716U, 4495U}, //SCB.CPUID.Constant
+    {585U, 3920U}, //I2C3.SR2.MSL
+    {358U, 1997U}, //TIM5.SMCR.ETPS
+    {124U, 776U}, //OTG_FS_HOST.FS_HCINT7.CHH
+    {164U, 1098U}, //RTC.TR.PM
+    {2U, 25U}, //ADC1.SR.STRT
+    {624U, 4121U}, //SPI1.CR1.BIDIMODE
+    {62U, 415U}, //OTG_FS_DEVICE.DOEPCTL3.CNAK
+    {663U, RegisterDbKey::NoField}, //SPI5.DR
+    {555U, 3510U}, //GPIOC.BSRR.BS6
+    {477U, 2725U}, //DMA1.S1CR.TCIE
+    {651U, 4264U}, //SPI4.CR1.LSBFIRST
+    {26U, 97U}, //DBG.DBGMCU_CR.DBG_STOP
+    {295U, 1666U}, //TIM2.CR1.ARPE
+    {624U, 4132U}, //SPI1.CR1.MSTR
+    {564U, RegisterDbKey::NoField}, //GPIOB.ODR
+    {268U, 1601U}, //TIM8.DCR.DBA
+    {185U, RegisterDbKey::NoField}, //RTC.BKP2R
+    {227U, 1357U}, //SYSCFG.CMPCR.CMP_PD
+    {443U, 2496U}, //DMA2.S4CR.DBM
+    {254U, 1535U}, //TIM8.SR.CC3IF
+    {62U, 422U}, //OTG_FS_DEVICE.DOEPCTL3.MPSIZ
+    {584U, 3900U}, //I2C3.SR1.TIMEOUT
+    {299U, 1695U}, //TIM2.SR.CC4OF
+    {56U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPCTL1
+    {660U, RegisterDbKey::NoField}, //SPI5.CR1
+    {533U, 3140U}, //GPIOE.IDR.IDR6
+    {545U, 3333U}, //GPIOD.BSRR.BR6
+    {579U, 3884U}, //I2C3.CR1.SMBUS
+    {468U, 2637U}, //DMA1.HISR.FEIF5
+    {443U, 2497U}, //DMA2.S4CR.PL
+    {45U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DCFG
+    {166U, 1114U}, //RTC.CR.POL
+    {534U, 3159U}, //GPIOE.ODR.ODR3
+    {566U, 3679U}, //GPIOB.LCKR.LCK15
+    {167U, 1137U}, //RTC.ISR.INITS
+    {550U, RegisterDbKey::NoField}, //GPIOC.OTYPER
+    {181U, 1217U}, //RTC.ALRMASSR.SS
+    {525U, 3032U}, //GPIOH.BSRR.BS1
+    {524U, 2994U}, //GPIOH.ODR.ODR7
+    {531U, 3102U}, //GPIOE.OSPEEDR.OSPEEDR12
+    {578U, 3866U}, //GPIOA.AFRH.AFRH13
+    {455U, 2557U}, //DMA2.S6CR.MINC
+    {551U, 3421U}, //GPIOC.OSPEEDR.OSPEEDR15
+    {571U, 3748U}, //GPIOA.OSPEEDR.OSPEEDR10
+    {10U, 61U}, //ADC1.JOFR4.JOFFSET4
+    {579U, 3878U}, //I2C3.CR1.START
+    {40U, 277U}, //FLASH.OPTCR.OPTLOCK
+    {483U, 2741U}, //DMA1.S2CR.ACK
+    {628U, RegisterDbKey::NoField}, //SPI1.CRCPR
+    {415U, 2313U}, //DMA2.LISR.DMEIF1
+    {208U, RegisterDbKey::NoField}, //SDIO.RESP1
+    {561U, 3582U}, //GPIOB.OSPEEDR.OSPEEDR15
+    {13U, RegisterDbKey::NoField}, //ADC1.SQR1
+    {482U, 2737U}, //DMA1.S1FCR.FTH
+    {272U, 1613U}, //TIM10.CR1.ARPE
+    {129U, 825U}, //OTG_FS_HOST.FS_HCINTMSK4.CHHM
+    {574U, 3801U}, //GPIOA.ODR.ODR5
+    {632U, RegisterDbKey::NoField}, //SPI1.I2SPR
+    {350U, 1973U}, //TIM4.CCR1.CCR1_H
+    {697U, RegisterDbKey::NoField}, //NVIC.IPR13
+    {253U, 1518U}, //TIM8.DIER.UDE
+    {176U, 1190U}, //RTC.TSTR.MNU
+    {327U, 1863U}, //TIM3.CNT.CNT_L
+    {570U, 3738U}, //GPIOA.OTYPER.OT4
+    {77U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DTXFSTS1
+    {354U, 1981U}, //TIM4.DCR.DBL
+    {88U, 546U}, //OTG_FS_GLOBAL.FS_GINTSTS.HPRTINT
+    {644U, 4233U}, //SPI3.SR.BSY
+    {254U, 1528U}, //TIM8.SR.CC3OF
+    {316U, RegisterDbKey::NoField}, //TIM3.CR1
+    {155U, RegisterDbKey::NoField}, //RCC.APB2ENR
+    {232U, 1402U}, //TIM1.SR.CC2OF
+    {83U, 503U}, //OTG_FS_GLOBAL.FS_GOTGCTL.BSVLD
+    {574U, 3795U}, //GPIOA.ODR.ODR11
+    {231U, 1396U}, //TIM1.DIER.CC3IE
+    {507U, 2860U}, //DMA1.S6CR.MINC
+    {215U, RegisterDbKey::NoField}, //SDIO.DCOUNT
+    {130U, 843U}, //OTG_FS_HOST.FS_HCINTMSK5.DTERRM
+    {256U, 1553U}, //TIM8.CCMR1_Output.OC1M
+    {535U, 3186U}, //GPIOE.BSRR.BS8
+    {543U, 3293U}, //GPIOD.IDR.IDR14
+    {603U, 4021U}, //I2C1.SR2.SMBHOST
+    {702U, 4434U}, //NVIC.IPR18.IPR_N1
+    {549U, 3401U}, //GPIOC.MODER.MODER3
+    {392U, RegisterDbKey::NoField}, //USART1.DR
+    {8U, RegisterDbKey::NoField}, //ADC1.JOFR2
+    {468U, RegisterDbKey::NoField}, //DMA1.HISR
+    {136U, 874U}, //OTG_FS_HOST.FS_HCTSIZ3.PKTCNT
+    {214U, RegisterDbKey::NoField}, //SDIO.DCTRL
+    {62U, 411U}, //OTG_FS_DEVICE.DOEPCTL3.EPDIS
+    {344U, 1940U}, //TIM4.CCMR2_Output.O24CE
+    {531U, 3105U}, //GPIOE.OSPEEDR.OSPEEDR9
+    {301U, RegisterDbKey::NoField}, //TIM2.CCMR1_Output
+    {33U, 213U}, //EXTI.SWIER.SWIER6
+    {131U, 849U}, //OTG_FS_HOST.FS_HCINTMSK6.NYET
+    {198U, 1235U}, //RTC.BKP15R.BKP
+    {639U, RegisterDbKey::NoField}, //SPI2.TXCRCR
+    {3U, 36U}, //ADC1.CR1.DISCEN
+    {299U, 1703U}, //TIM2.SR.CC1IF
+    {417U, 2359U}, //DMA2.LIFCR.CFEIF0
+    {537U, 3218U}, //GPIOE.AFRL.AFRL1
+    {64U, 433U}, //OTG_FS_DEVICE.DIEPINT1.EPDISD
+    {172U, 1171U}, //RTC.ALRMBR.DU
+    {356U, 1985U}, //TIM5.CR1.ARPE
+    {704U, 4443U}, //FPU.FPCCR.THREAD
+    {470U, 2667U}, //DMA1.HIFCR.CFEIF7
+    {75U, 478U}, //OTG_FS_DEVICE.DIEPTSIZ3.MCNT
+    {158U, 1060U}, //RCC.APB1LPENR.TIM5LPEN
+    {408U, 2262U}, //USART6.CR1.TXEIE
+    {563U, 3617U}, //GPIOB.IDR.IDR12
+    {418U, 2375U}, //DMA2.HIFCR.CTCIF4
+    {594U, 3966U}, //I2C2.SR2.PEC
+    {229U, 1367U}, //TIM1.CR2.OIS3N
+    {2U, RegisterDbKey::NoField}, //ADC1.SR
+    {145U, RegisterDbKey::NoField}, //RCC.PLLCFGR
+    {383U, 2116U}, //TIM9.CCMR1_Output.OC2PE
+    {431U, 2441U}, //DMA2.S2CR.PL
+    {228U, 1362U}, //TIM1.CR1.OPM
+    {155U, 1031U}, //RCC.APB2ENR.USART6EN
+    {255U, 1539U}, //TIM8.EGR.BG
+    {542U, 3285U}, //GPIOD.PUPDR.PUPDR6
+    {554U, 3470U}, //GPIOC.ODR.ODR14
+    {38U, 267U}, //FLASH.SR.BSY
+    {402U, 2220U}, //USART2.CR2.STOP
+    {642U, 4217U}, //SPI3.CR1.SSM
+    {692U, RegisterDbKey::NoField}, //NVIC.IPR8
+    {454U, 2546U}, //DMA2.S5FCR.FTH
+    {535U, 3189U}, //GPIOE.BSRR.BS5
+    {563U, 3619U}, //GPIOB.IDR.IDR10
+    {712U, 4484U}, //STK.CTRL.ENABLE
+    {347U, 1968U}, //TIM4.CNT.CNT_H
+    {682U, RegisterDbKey::NoField}, //NVIC.IABR1
+    {398U, 2194U}, //USART2.SR.TC
+    {88U, 537U}, //OTG_FS_GLOBAL.FS_GINTSTS.USBSUSP
+    {351U, RegisterDbKey::NoField}, //TIM4.CCR2
+    {723U, 4526U}, //SCB.SHPR2.PRI_11
+    {448U, 2518U}, //DMA2.S4FCR.FTH
+    {477U, RegisterDbKey::NoField}, //DMA1.S1CR
+    {589U, 3941U}, //I2C2.CR2.ITBUFEN
+    {513U, 2887U}, //DMA1.S7CR.PSIZE
+    {521U, 2952U}, //GPIOH.OSPEEDR.OSPEEDR1
+    {58U, 363U}, //OTG_FS_DEVICE.DIEPCTL3.SODDFRM
+    {653U, 4283U}, //SPI4.SR.CHSIDE
+    {167U, 1145U}, //RTC.ISR.TSOVF
+    {154U, 1022U}, //RCC.APB1ENR.SPI3EN
+    {539U, 3241U}, //GPIOD.MODER.MODER2
+    {238U, 1465U}, //TIM1.CCER.CC1E
+    {226U, 1353U}, //SYSCFG.EXTICR4.EXTI14
+    {365U, 2060U}, //TIM5.CCMR2_Input.IC3PSC
+    {292U, RegisterDbKey::NoField}, //TIM11.ARR
+    {487U, RegisterDbKey::NoField}, //DMA1.S2M1AR
+    {210U, RegisterDbKey::NoField}, //SDIO.RESP3
+    {556U, 3529U}, //GPIOC.LCKR.LCK4
+    {725U, 4535U}, //SCB.SHCRS.SYSTICKACT
+    {483U, 2743U}, //DMA1.S2CR.DBM
+    {88U, 547U}, //OTG_FS_GLOBAL.FS_GINTSTS.HCINT
+    {341U, 1923U}, //TIM4.EGR.UG
+    {366U, 2064U}, //TIM5.CCER.CC4E
+    {60U, 384U}, //OTG_FS_DEVICE.DOEPCTL1.EPENA
+    {467U, 2618U}, //DMA1.LISR.TCIF0
+    {489U, 2774U}, //DMA1.S3CR.MSIZE
+    {59U, 375U}, //OTG_FS_DEVICE.DOEPCTL0.EPDIS
+    {252U, 1506U}, //TIM8.SMCR.ECE
+    {4U, 53U}, //ADC1.CR2.DMA
+    {89U, 553U}, //OTG_FS_GLOBAL.FS_GINTMSK.MMISM
+    {136U, 873U}, //OTG_FS_HOST.FS_HCTSIZ3.XFRSIZ
+    {494U, 2790U}, //DMA1.S3FCR.FEIE
+    {112U, 668U}, //OTG_FS_HOST.FS_HCCHAR3.DAD
+    {112U, 666U}, //OTG_FS_HOST.FS_HCCHAR3.EPTYP
+    {279U, RegisterDbKey::NoField}, //TIM10.CNT
+    {696U, 4410U}, //NVIC.IPR12.IPR_N1
+    {495U, 2795U}, //DMA1.S4CR.MBURST
+    {116U, 710U}, //OTG_FS_HOST.FS_HCCHAR7.CHDIS
+    {483U, 2738U}, //DMA1.S2CR.CHSEL
+    {483U, 2748U}, //DMA1.S2CR.MINC
+    {583U, RegisterDbKey::NoField}, //I2C3.DR
+    {146U, 945U}, //RCC.CFGR.I2SSRC
+    {712U, RegisterDbKey::NoField}, //STK.CTRL
+    {539U, 3234U}, //GPIOD.MODER.MODER9
+    {203U, 1240U}, //SDIO.POWER.PWRCTRL
+    {553U, 3468U}, //GPIOC.IDR.IDR0
+    {233U, RegisterDbKey::NoField}, //TIM1.EGR
+    {216U, 1289U}, //SDIO.STA.STBITERR
+    {520U, 2931U}, //GPIOH.OTYPER.OT6
+    {338U, 1889U}, //TIM4.SMCR.ETP
+    {575U, 3821U}, //GPIOA.BSRR.BR1
+    {725U, 4531U}, //SCB.SHCRS.USGFAULTACT
+    {346U, 1958U}, //TIM4.CCER.CC4E
+    {89U, 571U}, //OTG_FS_GLOBAL.FS_GINTMSK.PRTIM
+    {544U, 3317U}, //GPIOD.ODR.ODR6
+    {359U, 2005U}, //TIM5.DIER.CC2DE
+    {102U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCFG
+    {260U, 1586U}, //TIM8.CCER.CC2NE
+    {539U, 3233U}, //GPIOD.MODER.MODER10
+    {111U, 655U}, //OTG_FS_HOST.FS_HCCHAR2.LSDEV
+    {112U, 663U}, //OTG_FS_HOST.FS_HCCHAR3.EPNUM
+    {0U, 1U}, //ADC_Common.CSR.STRT3
+    {546U, 3362U}, //GPIOD.LCKR.LCK10
+    {555U, 3506U}, //GPIOC.BSRR.BS10
+    {232U, 1403U}, //TIM1.SR.CC1OF
+    {454U, 2545U}, //DMA2.S5FCR.DMDIS
+    {532U, 3126U}, //GPIOE.PUPDR.PUPDR4
+    {488U, 2763U}, //DMA1.S2FCR.FS
+    {415U, RegisterDbKey::NoField}, //DMA2.LISR
+    {143U, 906U}, //PWR.CSR.BRE
+    {726U, 4553U}, //SCB.CFSR_UFSR_BFSR_MMFSR.LSPERR
+    {506U, RegisterDbKey::NoField}, //DMA1.S5FCR
+    {122U, 762U}, //OTG_FS_HOST.FS_HCINT5.TXERR
+    {156U, RegisterDbKey::NoField}, //RCC.AHB1LPENR
+    {256U, 1548U}, //TIM8.CCMR1_Output.OC2M
+    {668U, 4344U}, //SPI5.I2SPR.ODD
+    {562U, 3607U}, //GPIOB.PUPDR.PUPDR6
+    {34U, 251U}, //EXTI.PR.PR21
+    {118U, 725U}, //OTG_FS_HOST.FS_HCINT1.ACK
+    {489U, 2782U}, //DMA1.S3CR.HTIE
+    {346U, 1959U}, //TIM4.CCER.CC3NP
+    {88U, 528U}, //OTG_FS_GLOBAL.FS_GINTSTS.CMOD
+    {528U, 3065U}, //GPIOH.AFRH.AFRH9
+    {536U, 3196U}, //GPIOE.LCKR.LCK15
+    {530U, 3088U}, //GPIOE.OTYPER.OT10
+    {127U, 807U}, //OTG_FS_HOST.FS_HCINTMSK2.NAKM
+    {301U, 1717U}, //TIM2.CCMR1_Output.OC1M
+    {120U, 747U}, //OTG_FS_HOST.FS_HCINT3.DTERR
+    {573U, 3781U}, //GPIOA.IDR.IDR9
+    {543U, 3299U}, //GPIOD.IDR.IDR8
+    {161U, 1086U}, //RCC.CSR.PORRSTF
+    {145U, 938U}, //RCC.PLLCFGR.PLLM3
+    {562U, 3605U}, //GPIOB.PUPDR.PUPDR8
+    {410U, 2280U}, //USART6.CR3.CTSIE
+    {557U, 3538U}, //GPIOC.AFRL.AFRL3
+    {522U, 2958U}, //GPIOH.PUPDR.PUPDR11
+    {642U, 4222U}, //SPI3.CR1.MSTR
+    {353U, RegisterDbKey::NoField}, //TIM4.CCR4
+    {119U, 738U}, //OTG_FS_HOST.FS_HCINT2.DTERR
+    {606U, 4032U}, //I2S2ext.CR1.BIDIOE
+    {602U, 4017U}, //I2C1.SR1.ADDR
+    {584U, 3905U}, //I2C3.SR1.BERR
+    {319U, 1797U}, //TIM3.DIER.CC4IE
+    {643U, 4229U}, //SPI3.CR2.SSOE
+    {725U, RegisterDbKey::NoField}, //SCB.SHCRS
+    {572U, 3772U}, //GPIOA.PUPDR.PUPDR2
+    {303U, 1736U}, //TIM2.CCMR2_Output.CC3S
+    {723U, RegisterDbKey::NoField}, //SCB.SHPR2
+    {581U, 3893U}, //I2C3.OAR1.ADD10
+    {409U, 2278U}, //USART6.CR2.ADD
+    {84U, 508U}, //OTG_FS_GLOBAL.FS_GOTGINT.ADTOCHG
+    {175U, 1185U}, //RTC.SHIFTR.SUBFS
+    {118U, 729U}, //OTG_FS_HOST.FS_HCINT1.DTERR
+    {172U, 1168U}, //RTC.ALRMBR.MSK4
+    {405U, RegisterDbKey::NoField}, //USART6.SR
+    {62U, 414U}, //OTG_FS_DEVICE.DOEPCTL3.SNAK
+    {540U, 3245U}, //GPIOD.OTYPER.OT14
+    {61U, 403U}, //OTG_FS_DEVICE.DOEPCTL2.Stall
+    {448U, 2516U}, //DMA2.S4FCR.FS
+    {33U, 226U}, //EXTI.SWIER.SWIER19
+    {516U, 2900U}, //DMA1.S7M0AR.M0A
+    {396U, 2187U}, //USART1.CR3.IREN
+    {520U, 2927U}, //GPIOH.OTYPER.OT10
+    {33U, 223U}, //EXTI.SWIER.SWIER16
+    {599U, 4001U}, //I2C1.OAR1.ADD0
+    {710U, RegisterDbKey::NoField}, //MPU.MPU_RBAR
+    {564U, 3634U}, //GPIOB.ODR.ODR11
+    {318U, 1786U}, //TIM3.SMCR.ETF
+    {76U, 481U}, //OTG_FS_DEVICE.DTXFSTS0.INEPTFSAV
+    {537U, 3219U}, //GPIOE.AFRL.AFRL0
+    {547U, 3380U}, //GPIOD.AFRL.AFRL0
+    {57U, 357U}, //OTG_FS_DEVICE.DIEPCTL2.NAKSTS
+    {73U, 474U}, //OTG_FS_DEVICE.DIEPTSIZ1.XFRSIZ
+    {541U, 3262U}, //GPIOD.OSPEEDR.OSPEEDR13
+    {662U, 4325U}, //SPI5.SR.MODF
+    {711U, 4476U}, //MPU.MPU_RASR.SIZE
+    {685U, RegisterDbKey::NoField}, //NVIC.IPR1
+    {536U, 3197U}, //GPIOE.LCKR.LCK14
+    {260U, RegisterDbKey::NoField}, //TIM8.CCER
+    {216U, 1281U}, //SDIO.STA.RXFIFOF
+    {95U, 594U}, //OTG_FS_GLOBAL.FS_GNPTXSTS.NPTQXSAV
+    {346U, 1962U}, //TIM4.CCER.CC2NP
+    {381U, 2109U}, //TIM9.SR.CC1IF
+    {594U, 3972U}, //I2C2.SR2.BUSY
+    {177U, RegisterDbKey::NoField}, //RTC.TSDR
+    {481U, RegisterDbKey::NoField}, //DMA1.S1M1AR
+    {127U, 811U}, //OTG_FS_HOST.FS_HCINTMSK2.BBERRM
+    {34U, 236U}, //EXTI.PR.PR6
+    {0U, 6U}, //ADC_Common.CSR.OVR2
+    {3U, 30U}, //ADC1.CR1.OVRIE
+    {89U, 554U}, //OTG_FS_GLOBAL.FS_GINTMSK.OTGINT
+    {204U, 1242U}, //SDIO.CLKCR.NEGEDGE
+    {160U, 1077U}, //RCC.BDCR.RTCSEL1
+    {31U, 171U}, //EXTI.RTSR.TR10
+    {495U, 2810U}, //DMA1.S4CR.HTIE
+    {314U, RegisterDbKey::NoField}, //TIM2.DMAR
+    {122U, 759U}, //OTG_FS_HOST.FS_HCINT5.STALL
+    {575U, 3837U}, //GPIOA.BSRR.BS1
+    {281U, RegisterDbKey::NoField}, //TIM10.ARR
+    {141U, 888U}, //OTG_FS_PWRCLK.FS_PCGCCTL.STPPCLK
+    {540U, 3251U}, //GPIOD.OTYPER.OT8
+    {437U, 2474U}, //DMA2.S3CR.PINC
+    {555U, 3492U}, //GPIOC.BSRR.BR8
+    {624U, 4124U}, //SPI1.CR1.CRCNEXT
+    {423U, RegisterDbKey::NoField}, //DMA2.S0M1AR
+    {431U, 2446U}, //DMA2.S2CR.PINC
+    {30U, 149U}, //EXTI.EMR.MR11
+    {498U, 2816U}, //DMA1.S4M0AR.M0A
+    {374U, 2088U}, //TIM5.DCR.DBA
+    {566U, 3694U}, //GPIOB.LCKR.LCK0
+    {110U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR1
+    {506U, 2846U}, //DMA1.S5FCR.FEIE
+    {129U, 830U}, //OTG_FS_HOST.FS_HCINTMSK4.TXERRM
+    {658U, 4293U}, //SPI4.I2SCFGR.PCMSYNC
+    {110U, 642U}, //OTG_FS_HOST.FS_HCCHAR1.MPSIZ
+    {344U, RegisterDbKey::NoField}, //TIM4.CCMR2_Output
+    {111U, 652U}, //OTG_FS_HOST.FS_HCCHAR2.MPSIZ
+    {526U, 3047U}, //GPIOH.LCKR.LCK3
+    {467U, 2615U}, //DMA1.LISR.TEIF1
+    {167U, 1143U}, //RTC.ISR.WUTF
+    {273U, RegisterDbKey::NoField}, //TIM10.DIER
+    {468U, 2627U}, //DMA1.HISR.FEIF7
+    {319U, 1799U}, //TIM3.DIER.CC2IE
+    {651U, 4262U}, //SPI4.CR1.SSM
+    {395U, 2169U}, //USART1.CR2.STOP
+    {413U, 2298U}, //WWDG.CFR.W
+    {415U, 2302U}, //DMA2.LISR.TEIF3
+    {732U, RegisterDbKey::NoField}, //FPU_CPACR.CPACR
+    {425U, 2422U}, //DMA2.S1CR.TCIE
+    {471U, 2686U}, //DMA1.S0CR.CT
+    {412U, 2293U}, //WWDG.CR.WDGA
+    {4U, 54U}, //ADC1.CR2.CONT
+    {552U, 3437U}, //GPIOC.PUPDR.PUPDR15
+    {469U, 2650U}, //DMA1.LIFCR.CTEIF2
+    {535U, 3182U}, //GPIOE.BSRR.BS12
+    {692U, 4393U}, //NVIC.IPR8.IPR_N0
+    {46U, 297U}, //OTG_FS_DEVICE.FS_DCTL.GONSTS
+    {31U, 167U}, //EXTI.RTSR.TR6
+    {274U, 1621U}, //TIM10.SR.UIF
+    {579U, 3872U}, //I2C3.CR1.SWRST
+    {356U, 1990U}, //TIM5.CR1.UDIS
+    {87U, 522U}, //OTG_FS_GLOBAL.FS_GRSTCTL.HSRST
+    {658U, 4291U}, //SPI4.I2SCFGR.I2SE
+    {575U, 3822U}, //GPIOA.BSRR.BR0
+    {618U, RegisterDbKey::NoField}, //I2S3ext.DR
+    {657U, RegisterDbKey::NoField}, //SPI4.TXCRCR
+    {358U, 2000U}, //TIM5.SMCR.TS
+    {471U, 2699U}, //DMA1.S0CR.TEIE
+    {489U, 2777U}, //DMA1.S3CR.PINC
+    {218U, 1321U}, //SDIO.MASK.TXFIFOHEIE
+    {184U, RegisterDbKey::NoField}, //RTC.BKP1R
+    {424U, 2406U}, //DMA2.S0FCR.FTH
+    {346U, 1961U}, //TIM4.CCER.CC3E
+    {726U, 4558U}, //SCB.CFSR_UFSR_BFSR_MMFSR.NOCP
+    {416U, 2331U}, //DMA2.HISR.HTIF5
+    {590U, 3947U}, //I2C2.OAR1.ADD7
+    {416U, 2330U}, //DMA2.HISR.TCIF5
+    {116U, 707U}, //OTG_FS_HOST.FS_HCCHAR7.MCNT
+    {495U, 2799U}, //DMA1.S4CR.DBM
+    {548U, 3388U}, //GPIOD.AFRH.AFRH8
+    {263U, RegisterDbKey::NoField}, //TIM8.ARR
+    {670U, 4347U}, //NVIC.ISER1.SETENA
+    {633U, 4170U}, //SPI2.CR1.DFF
+    {288U, 1654U}, //TIM11.CCMR1_Input.IC1F
+    {44U, 288U}, //IWDG.SR.RVU
+    {676U, 4353U}, //NVIC.ISPR1.SETPEND
+    {94U, 591U}, //OTG_FS_GLOBAL.FS_GNPTXFSIZ_Host.NPTXFSA
+    {235U, 1431U}, //TIM1.CCMR1_Input.IC2PCS
+    {652U, RegisterDbKey::NoField}, //SPI4.CR2
+    {563U, 3626U}, //GPIOB.IDR.IDR3
+    {448U, 2515U}, //DMA2.S4FCR.FEIE
+    {316U, 1777U}, //TIM3.CR1.URS
+    {228U, 1360U}, //TIM1.CR1.CMS
+    {525U, 3010U}, //GPIOH.BSRR.BR7
+    {489U, 2773U}, //DMA1.S3CR.PINCOS
+    {258U, 1570U}, //TIM8.CCMR2_Output.OC3PE
+    {216U, 1285U}, //SDIO.STA.RXACT
+    {483U, 2755U}, //DMA1.S2CR.TEIE
+    {255U, 1544U}, //TIM8.EGR.CC2G
+    {89U, 573U}, //OTG_FS_GLOBAL.FS_GINTMSK.PTXFEM
+    {3U, 41U}, //ADC1.CR1.AWDIE
+    {616U, 4091U}, //I2S3ext.CR2.RXNEIE
+    {105U, 616U}, //OTG_FS_HOST.FS_HPTXSTS.PTXQTOP
+    {709U, RegisterDbKey::NoField}, //MPU.MPU_RNR
+    {17U, RegisterDbKey::NoField}, //ADC1.JDR1
+    {234U, 1422U}, //TIM1.CCMR1_Output.OC2PE
+    {179U, 1202U}, //RTC.CALR.CALM
+    {545U, 3337U}, //GPIOD.BSRR.BR2
+    {546U, 3372U}, //GPIOD.LCKR.LCK0
+    {346U, 1965U}, //TIM4.CCER.CC1NP
+    {523U, 2971U}, //GPIOH.IDR.IDR14
+    {606U, 4041U}, //I2S2ext.CR1.BR
+    {313U, RegisterDbKey::NoField}, //TIM2.DCR
+    {323U, 1830U}, //TIM3.CCMR1_Input.CC2S
+    {73U, 472U}, //OTG_FS_DEVICE.DIEPTSIZ1.MCNT
+    {235U, 1430U}, //TIM1.CCMR1_Input.IC2F
+    {495U, 2813U}, //DMA1.S4CR.EN
+    {547U, RegisterDbKey::NoField}, //GPIOD.AFRL
+    {73U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPTSIZ1
+    {125U, 792U}, //OTG_FS_HOST.FS_HCINTMSK0.FRMORM
+    {78U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DTXFSTS2
+    {595U, 3974U}, //I2C2.CCR.F_S
+    {322U, 1821U}, //TIM3.CCMR1_Output.OC2FE
+    {513U, 2885U}, //DMA1.S7CR.PINCOS
+    {305U, 1752U}, //TIM2.CCER.CC1NP
+    {132U, 857U}, //OTG_FS_HOST.FS_HCINTMSK7.NAKM
+    {272U, 1616U}, //TIM10.CR1.CEN
+    {180U, 1203U}, //RTC.TAFCR.ALARMOUTTYPE
+    {619U, RegisterDbKey::NoField}, //I2S3ext.CRCPR
+    {142U, 894U}, //PWR.CR.DBP
+    {536U, 3195U}, //GPIOE.LCKR.LCKK
+    {287U, 1651U}, //TIM11.CCMR1_Output.OC1PE
+    {145U, 928U}, //RCC.PLLCFGR.PLLN7
+    {68U, 456U}, //OTG_FS_DEVICE.DOEPINT1.XFRC
+    {127U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK2
+    {431U, 2442U}, //DMA2.S2CR.PINCOS
+    {681U, RegisterDbKey::NoField}, //NVIC.IABR0
+    {258U, 1572U}, //TIM8.CCMR2_Output.CC3S
+    {437U, 2467U}, //DMA2.S3CR.CT
+    {298U, 1687U}, //TIM2.DIER.CC1DE
+    {81U, 490U}, //OTG_FS_DEVICE.DOEPTSIZ2.XFRSIZ
+    {396U, 2178U}, //USART1.CR3.CTSIE
+    {159U, 1073U}, //RCC.APB2LPENR.TIM10LPEN
+    {703U, 4438U}, //NVIC.IPR19.IPR_N1
+    {216U, 1293U}, //SDIO.STA.RXOVERR
+    {641U, 4210U}, //SPI2.I2SPR.I2SDIV
+    {518U, RegisterDbKey::NoField}, //DMA1.S7FCR
+    {308U, RegisterDbKey::NoField}, //TIM2.ARR
+    {449U, 2525U}, //DMA2.S5CR.PL
+    {55U, 326U}, //OTG_FS_DEVICE.FS_DIEPCTL0.USBAEP
+    {471U, 2689U}, //DMA1.S0CR.PINCOS
+    {218U, 1315U}, //SDIO.MASK.TXDAVLIE
+    {713U, RegisterDbKey::NoField}, //STK.LOAD
+    {83U, 495U}, //OTG_FS_GLOBAL.FS_GOTGCTL.SRQ
+    {362U, 2037U}, //TIM5.CCMR1_Output.OC1PE
+    {69U, 460U}, //OTG_FS_DEVICE.DOEPINT2.EPDISD
+    {571U, 3752U}, //GPIOA.OSPEEDR.OSPEEDR6
+    {180U, 1209U}, //RTC.TAFCR.TAMPFREQ
+    {319U, 1790U}, //TIM3.DIER.TDE
+    {467U, 2607U}, //DMA1.LISR.FEIF3
+    {535U, 3177U}, //GPIOE.BSRR.BR1
+    {416U, 2324U}, //DMA2.HISR.FEIF7
+    {560U, 3581U}, //GPIOB.OTYPER.OT0
+    {110U, 650U}, //OTG_FS_HOST.FS_HCCHAR1.CHDIS
+    {415U, 2305U}, //DMA2.LISR.TCIF2
+    {483U, RegisterDbKey::NoField}, //DMA1.S2CR
+    {326U, 1850U}, //TIM3.CCER.CC4NP
+    {501U, 2829U}, //DMA1.S5CR.PINCOS
+    {495U, 2796U}, //DMA1.S4CR.PBURST
+    {711U, 4480U}, //MPU.MPU_RASR.S
+    {31U, 181U}, //EXTI.RTSR.TR20
+    {576U, 3850U}, //GPIOA.LCKR.LCK5
+    {458U, RegisterDbKey::NoField}, //DMA2.S6M0AR
+    {721U, 4522U}, //SCB.CCR.STKALIGN
+    {396U, 2188U}, //USART1.CR3.EIE
+    {248U, RegisterDbKey::NoField}, //TIM1.RCR
+    {206U, 1253U}, //SDIO.CMD.CPSMEN
+    {449U, 2536U}, //DMA2.S5CR.TEIE
+    {611U, 4063U}, //I2S2ext.RXCRCR.RxCRC
+    {299U, 1697U}, //TIM2.SR.CC2OF
+    {146U, 943U}, //RCC.CFGR.MCO2PRE
+    {137U, 877U}, //OTG_FS_HOST.FS_HCTSIZ4.PKTCNT
+    {154U, 1017U}, //RCC.APB1ENR.PWREN
+    {119U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT2
+    {257U, 1557U}, //TIM8.CCMR1_Input.IC2F
+    {659U, 4300U}, //SPI4.I2SPR.I2SDIV
+    {549U, 3398U}, //GPIOC.MODER.MODER6
+    {8U, 59U}, //ADC1.JOFR2.JOFFSET2
+    {572U, RegisterDbKey::NoField}, //GPIOA.PUPDR
+    {14U, RegisterDbKey::NoField}, //ADC1.SQR2
+    {536U, 3207U}, //GPIOE.LCKR.LCK4
+    {660U, 4313U}, //SPI5.CR1.CPOL
+    {64U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPINT1
+    {61U, 405U}, //OTG_FS_DEVICE.DOEPCTL2.EPTYP
+    {545U, 3353U}, //GPIOD.BSRR.BS2
+    {575U, 3826U}, //GPIOA.BSRR.BS12
+    {559U, 3557U}, //GPIOB.MODER.MODER8
+    {550U, 3419U}, //GPIOC.OTYPER.OT1
+    {340U, 1909U}, //TIM4.SR.CC3OF
+    {560U, 3574U}, //GPIOB.OTYPER.OT7
+    {529U, RegisterDbKey::NoField}, //GPIOE.MODER
+    {86U, 513U}, //OTG_FS_GLOBAL.FS_GUSBCFG.TOCAL
+    {424U, 2404U}, //DMA2.S0FCR.FS
+    {523U, 2978U}, //GPIOH.IDR.IDR7
+    {65U, 436U}, //OTG_FS_DEVICE.DIEPINT2.INEPNE
+    {531U, 3108U}, //GPIOE.OSPEEDR.OSPEEDR6
+    {652U, 4271U}, //SPI4.CR2.RXNEIE
+    {565U, 3651U}, //GPIOB.BSRR.BR10
+    {363U, 2044U}, //TIM5.CCMR1_Input.ICPCS
+    {463U, 2596U}, //DMA2.S7PAR.PA
+    {425U, 2411U}, //DMA2.S1CR.CT
+    {525U, 3013U}, //GPIOH.BSRR.BR4
+    {32U, 185U}, //EXTI.FTSR.TR1
+    {527U, 3051U}, //GPIOH.AFRL.AFRL7
+    {447U, RegisterDbKey::NoField}, //DMA2.S4M1AR
+    {577U, RegisterDbKey::NoField}, //GPIOA.AFRL
+    {393U, 2151U}, //USART1.BRR.DIV_Mantissa
+    {232U, 1408U}, //TIM1.SR.CC3IF
+    {315U, 1771U}, //TIM2.OR.ITR1_RMP
+    {596U, 3977U}, //I2C2.TRISE.TRISE
+    {575U, 3818U}, //GPIOA.BSRR.BR4
+    {561U, 3587U}, //GPIOB.OSPEEDR.OSPEEDR10
+    {575U, RegisterDbKey::NoField}, //GPIOA.BSRR
+    {721U, RegisterDbKey::NoField}, //SCB.CCR
+    {132U, 861U}, //OTG_FS_HOST.FS_HCINTMSK7.BBERRM
+    {521U, RegisterDbKey::NoField}, //GPIOH.OSPEEDR
+    {416U, 2320U}, //DMA2.HISR.TCIF7
+    {251U, 1493U}, //TIM8.CR2.OIS4
+    {202U, 1239U}, //RTC.BKP19R.BKP
+    {402U, 2225U}, //USART2.CR2.LBDIE
+    {573U, 3789U}, //GPIOA.IDR.IDR1
+    {536U, 3202U}, //GPIOE.LCKR.LCK9
+    {698U, 4418U}, //NVIC.IPR14.IPR_N1
+    {123U, 767U}, //OTG_FS_HOST.FS_HCINT6.CHH
+    {501U, 2834U}, //DMA1.S5CR.CIRC
+    {642U, 4213U}, //SPI3.CR1.CRCEN
+    {585U, 3918U}, //I2C3.SR2.TRA
+    {236U, 1439U}, //TIM1.CCMR2_Output.OC4FE
+    {390U, RegisterDbKey::NoField}, //TIM9.CCR2
+    {725U, 4537U}, //SCB.SHCRS.MEMFAULTPENDED
+    {259U, 1578U}, //TIM8.CCMR2_Input.CC3S
+    {130U, 834U}, //OTG_FS_HOST.FS_HCINTMSK5.XFRCM
+    {34U, 232U}, //EXTI.PR.PR2
+    {165U, 1107U}, //RTC.DR.WDU
+    {530U, 3089U}, //GPIOE.OTYPER.OT9
+    {559U, 3562U}, //GPIOB.MODER.MODER3
+    {542U, 3281U}, //GPIOD.PUPDR.PUPDR10
+    {335U, 1877U}, //TIM3.DMAR.DMAB
+    {144U, 918U}, //RCC.CR.HSIRDY
+    {96U, 597U}, //OTG_FS_GLOBAL.FS_GCCFG.VBUSASEN
+    {305U, 1745U}, //TIM2.CCER.CC4E
+    {342U, 1929U}, //TIM4.CCMR1_Output.OC1CE
+    {172U, RegisterDbKey::NoField}, //RTC.ALRMBR
+    {363U, 2042U}, //TIM5.CCMR1_Input.CC2S
+    {206U, 1249U}, //SDIO.CMD.CE_ATACMD
+    {360U, 2019U}, //TIM5.SR.CC4IF
+    {673U, 4350U}, //NVIC.ICER1.CLRENA
+    {548U, 3385U}, //GPIOD.AFRH.AFRH11
+    {385U, 2129U}, //TIM9.CCER.CC2NP
+    {417U, 2340U}, //DMA2.LIFCR.CTCIF3
+    {154U, 1025U}, //RCC.APB1ENR.TIM5EN
+    {298U, 1691U}, //TIM2.DIER.CC3IE
+    {214U, 1266U}, //SDIO.DCTRL.RWMOD
+    {574U, 3802U}, //GPIOA.ODR.ODR4
+    {265U, RegisterDbKey::NoField}, //TIM8.CCR2
+    {645U, RegisterDbKey::NoField}, //SPI3.DR
+    {558U, 3549U}, //GPIOC.AFRH.AFRH8
+    {127U, 805U}, //OTG_FS_HOST.FS_HCINTMSK2.CHHM
+    {96U, 599U}, //OTG_FS_GLOBAL.FS_GCCFG.SOFOUTEN
+    {449U, 2521U}, //DMA2.S5CR.PBURST
+    {57U, 350U}, //OTG_FS_DEVICE.DIEPCTL2.SODDFRM
+    {524U, 2999U}, //GPIOH.ODR.ODR2
+    {730U, 4566U}, //SCB.AFSR.IMPDEF
+    {30U, 160U}, //EXTI.EMR.MR22
+    {419U, 2396U}, //DMA2.S0CR.TEIE
+    {531U, 3099U}, //GPIOE.OSPEEDR.OSPEEDR15
+    {634U, 4180U}, //SPI2.CR2.TXEIE
+    {706U, 4451U}, //FPU.FPSCR.IOC
+    {344U, 1948U}, //TIM4.CCMR2_Output.OC3FE
+    {328U, 1864U}, //TIM3.PSC.PSC
+    {520U, 2929U}, //GPIOH.OTYPER.OT8
+    {550U, 3406U}, //GPIOC.OTYPER.OT14
+    {695U, RegisterDbKey::NoField}, //NVIC.IPR11
+    {41U, 285U}, //IWDG.KR.KEY
+    {150U, 990U}, //RCC.APB1RSTR.SPI3RST
+    {34U, 239U}, //EXTI.PR.PR9
+    {642U, 4220U}, //SPI3.CR1.SPE
+    {339U, 1899U}, //TIM4.DIER.CC2DE
+    {160U, 1078U}, //RCC.BDCR.RTCSEL0
+    {546U, 3360U}, //GPIOD.LCKR.LCK12
+    {228U, 1363U}, //TIM1.CR1.URS
+    {543U, 3300U}, //GPIOD.IDR.IDR7
+    {570U, 3733U}, //GPIOA.OTYPER.OT9
+    {584U, 3901U}, //I2C3.SR1.PECERR
+    {228U, 1361U}, //TIM1.CR1.DIR
+    {545U, 3339U}, //GPIOD.BSRR.BR0
+    {581U, 3895U}, //I2C3.OAR1.ADD0
+    {411U, 2292U}, //USART6.GTPR.PSC
+    {3U, RegisterDbKey::NoField}, //ADC1.CR1
+    {453U, RegisterDbKey::NoField}, //DMA2.S5M1AR
+    {597U, 3985U}, //I2C1.CR1.NOSTRETCH
+    {124U, 778U}, //OTG_FS_HOST.FS_HCINT7.NAK
+    {274U, 1619U}, //TIM10.SR.CC1OF
+    {28U, 111U}, //DBG.DBGMCU_APB2_FZ.DBG_TIM1_STOP
+    {7U, 58U}, //ADC1.JOFR1.JOFFSET1
+    {108U, 628U}, //OTG_FS_HOST.FS_HPRT.PLSTS
+    {33U, 221U}, //EXTI.SWIER.SWIER14
+    {29U, 116U}, //EXTI.IMR.MR1
+    {489U, 2780U}, //DMA1.S3CR.PFCTRL
+    {365U, 2058U}, //TIM5.CCMR2_Input.CC4S
+    {552U, 3445U}, //GPIOC.PUPDR.PUPDR7
+    {66U, 446U}, //OTG_FS_DEVICE.DIEPINT3.XFRC
+    {504U, RegisterDbKey::NoField}, //DMA1.S5M0AR
+    {687U, RegisterDbKey::NoField}, //NVIC.IPR3
+    {359U, 2002U}, //TIM5.DIER.TDE
+    {589U, 3940U}, //I2C2.CR2.DMAEN
+    {89U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GINTMSK
+    {593U, 3959U}, //I2C2.SR1.TxE
+    {533U, 3144U}, //GPIOE.IDR.IDR2
+    {415U, 2307U}, //DMA2.LISR.TEIF2
+    {167U, 1140U}, //RTC.ISR.INIT
+    {427U, RegisterDbKey::NoField}, //DMA2.S1PAR
+    {562U, 3604U}, //GPIOB.PUPDR.PUPDR9
+    {520U, 2930U}, //GPIOH.OTYPER.OT7
+    {417U, 2355U}, //DMA2.LIFCR.CTCIF0
+    {327U, RegisterDbKey::NoField}, //TIM3.CNT
+    {429U, 2430U}, //DMA2.S1M1AR.M1A
+    {642U, 4221U}, //SPI3.CR1.BR
+    {726U, 4557U}, //SCB.CFSR_UFSR_BFSR_MMFSR.INVPC
+    {461U, 2592U}, //DMA2.S7CR.TEIE
+    {523U, 2983U}, //GPIOH.IDR.IDR2
+    {489U, 2776U}, //DMA1.S3CR.MINC
+    {233U, 1415U}, //TIM1.EGR.CC4G
+    {433U, 2456U}, //DMA2.S2PAR.PA
+    {535U, 3192U}, //GPIOE.BSRR.BS2
+    {174U, 1183U}, //RTC.SSR.SS
+    {613U, 4071U}, //I2S2ext.I2SCFGR.DATLEN
+    {565U, 3672U}, //GPIOB.BSRR.BS5
+    {145U, 921U}, //RCC.PLLCFGR.PLLQ2
+    {488U, 2762U}, //DMA1.S2FCR.FEIE
+    {532U, 3127U}, //GPIOE.PUPDR.PUPDR3
+    {402U, 2219U}, //USART2.CR2.LINEN
+    {549U, 3399U}, //GPIOC.MODER.MODER5
+    {561U, 3593U}, //GPIOB.OSPEEDR.OSPEEDR4
+    {144U, 910U}, //RCC.CR.PLLRDY
+    {114U, 686U}, //OTG_FS_HOST.FS_HCCHAR5.EPTYP
+    {521U, 2949U}, //GPIOH.OSPEEDR.OSPEEDR4
+    {123U, 771U}, //OTG_FS_HOST.FS_HCINT6.TXERR
+    {383U, 2121U}, //TIM9.CCMR1_Output.OC1FE
+    {250U, 1489U}, //TIM8.CR1.OPM
+    {373U, RegisterDbKey::NoField}, //TIM5.CCR4
+    {631U, 4155U}, //SPI1.I2SCFGR.I2SMOD
+    {584U, 3903U}, //I2C3.SR1.AF
+    {229U, 1370U}, //TIM1.CR2.OIS2
+    {268U, RegisterDbKey::NoField}, //TIM8.DCR
+    {563U, 3615U}, //GPIOB.IDR.IDR14
+    {129U, 832U}, //OTG_FS_HOST.FS_HCINTMSK4.FRMORM
+    {199U, 1236U}, //RTC.BKP16R.BKP
+    {556U, 3532U}, //GPIOC.LCKR.LCK1
+    {211U, 1262U}, //SDIO.RESP4.CARDSTATUS4
+    {240U, RegisterDbKey::NoField}, //TIM1.PSC
+    {566U, 3685U}, //GPIOB.LCKR.LCK9
+    {385U, 2130U}, //TIM9.CCER.CC2P
+    {715U, RegisterDbKey::NoField}, //STK.CALIB
+    {411U, 2291U}, //USART6.GTPR.GT
+    {416U, 2325U}, //DMA2.HISR.TCIF6
+    {88U, 529U}, //OTG_FS_GLOBAL.FS_GINTSTS.MMIS
+    {551U, 3423U}, //GPIOC.OSPEEDR.OSPEEDR13
+    {704U, 4445U}, //FPU.FPCCR.MMRDY
+    {485U, 2759U}, //DMA1.S2PAR.PA
+    {68U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPINT1
+    {305U, 1746U}, //TIM2.CCER.CC3NP
+    {54U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPEMPMSK
+    {153U, 1016U}, //RCC.AHB2ENR.OTGFSEN
+    {91U, 585U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Host.DPID
+    {519U, 2920U}, //GPIOH.MODER.MODER1
+    {651U, 4263U}, //SPI4.CR1.SSI
+    {701U, 4432U}, //NVIC.IPR17.IPR_N3
+    {556U, 3520U}, //GPIOC.LCKR.LCK13
+    {572U, 3763U}, //GPIOA.PUPDR.PUPDR11
+    {627U, RegisterDbKey::NoField}, //SPI1.DR
+    {365U, 2057U}, //TIM5.CCMR2_Input.IC4PSC
+    {86U, 517U}, //OTG_FS_GLOBAL.FS_GUSBCFG.TRDT
+    {165U, 1106U}, //RTC.DR.YU
+    {342U, RegisterDbKey::NoField}, //TIM4.CCMR1_Output
+    {449U, 2524U}, //DMA2.S5CR.DBM
+    {119U, 733U}, //OTG_FS_HOST.FS_HCINT2.NAK
+    {640U, 4202U}, //SPI2.I2SCFGR.I2SCFG
+    {539U, 3239U}, //GPIOD.MODER.MODER4
+    {115U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR6
+    {733U, 4572U}, //SCB_ACTRL.ACTRL.DISFPCA
+    {391U, 2144U}, //USART1.SR.RXNE
+    {291U, RegisterDbKey::NoField}, //TIM11.PSC
+    {40U, 278U}, //FLASH.OPTCR.OPTSTRT
+    {442U, 2490U}, //DMA2.S3FCR.FTH
+    {526U, 3048U}, //GPIOH.LCKR.LCK2
+    {556U, 3518U}, //GPIOC.LCKR.LCK15
+    {636U, RegisterDbKey::NoField}, //SPI2.DR
+    {682U, 4359U}, //NVIC.IABR1.ACTIVE
+    {255U, 1545U}, //TIM8.EGR.CC1G
+    {488U, 2765U}, //DMA1.S2FCR.FTH
+    {363U, 2045U}, //TIM5.CCMR1_Input.CC1S
+    {238U, 1452U}, //TIM1.CCER.CC4P
+    {29U, 122U}, //EXTI.IMR.MR7
+    {452U, 2541U}, //DMA2.S5M0AR.M0A
+    {418U, 2378U}, //DMA2.HIFCR.CDMEIF4
+    {538U, 3223U}, //GPIOE.AFRH.AFRH12
+    {546U, 3357U}, //GPIOD.LCKR.LCK15
+    {410U, 2287U}, //USART6.CR3.HDSEL
+    {622U, 4117U}, //I2S3ext.I2SCFGR.CHLEN
+    {206U, 1252U}, //SDIO.CMD.SDIOSuspend
+    {161U, 1089U}, //RCC.CSR.RMVF
+    {446U, RegisterDbKey::NoField}, //DMA2.S4M0AR
+    {466U, RegisterDbKey::NoField}, //DMA2.S7FCR
+    {467U, 2617U}, //DMA1.LISR.FEIF1
+    {576U, 3840U}, //GPIOA.LCKR.LCK15
+    {536U, 3199U}, //GPIOE.LCKR.LCK12
+    {251U, 1501U}, //TIM8.CR2.MMS
+    {622U, 4113U}, //I2S3ext.I2SCFGR.PCMSYNC
+    {31U, 163U}, //EXTI.RTSR.TR2
+    {0U, 13U}, //ADC_Common.CSR.STRT1
+    {574U, 3803U}, //GPIOA.ODR.ODR3
+    {322U, 1827U}, //TIM3.CCMR1_Output.CC1S
+    {545U, RegisterDbKey::NoField}, //GPIOD.BSRR
+    {360U, 2023U}, //TIM5.SR.UIF
+    {284U, 1643U}, //TIM11.DIER.CC1IE
+    {483U, 2753U}, //DMA1.S2CR.TCIE
+    {116U, 711U}, //OTG_FS_HOST.FS_HCCHAR7.CHENA
+    {572U, 3767U}, //GPIOA.PUPDR.PUPDR7
+    {218U, RegisterDbKey::NoField}, //SDIO.MASK
+    {218U, 1331U}, //SDIO.MASK.TXUNDERRIE
+    {535U, 3167U}, //GPIOE.BSRR.BR11
+    {129U, 833U}, //OTG_FS_HOST.FS_HCINTMSK4.DTERRM
+    {535U, 3194U}, //GPIOE.BSRR.BS0
+    {635U, 4192U}, //SPI2.SR.UDR
+    {234U, 1427U}, //TIM1.CCMR1_Output.OC1PE
+    {408U, RegisterDbKey::NoField}, //USART6.CR1
+    {356U, 1986U}, //TIM5.CR1.CMS
+    {166U, RegisterDbKey::NoField}, //RTC.CR
+    {142U, 896U}, //PWR.CR.PVDE
+    {33U, 229U}, //EXTI.SWIER.SWIER22
+    {526U, 3041U}, //GPIOH.LCKR.LCK9
+    {57U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPCTL2
+    {593U, 3952U}, //I2C2.SR1.SMBALERT
+    {297U, RegisterDbKey::NoField}, //TIM2.SMCR
+    {533U, 3131U}, //GPIOE.IDR.IDR15
+    {305U, 1748U}, //TIM2.CCER.CC3E
+    {471U, 2687U}, //DMA1.S0CR.DBM
+    {521U, 2941U}, //GPIOH.OSPEEDR.OSPEEDR12
+    {85U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GAHBCFG
+    {625U, 4137U}, //SPI1.CR2.ERRIE
+    {266U, 1598U}, //TIM8.CCR3.CCR3
+    {525U, 3003U}, //GPIOH.BSRR.BR14
+    {442U, 2487U}, //DMA2.S3FCR.FEIE
+    {440U, 2485U}, //DMA2.S3M0AR.M0A
+    {596U, RegisterDbKey::NoField}, //I2C2.TRISE
+    {46U, 296U}, //OTG_FS_DEVICE.FS_DCTL.GINSTS
+    {46U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DCTL
+    {132U, 863U}, //OTG_FS_HOST.FS_HCINTMSK7.DTERRM
+    {526U, 3038U}, //GPIOH.LCKR.LCK12
+    {281U, 1636U}, //TIM10.ARR.ARR
+    {235U, 1435U}, //TIM1.CCMR1_Input.CC1S
+    {622U, 4114U}, //I2S3ext.I2SCFGR.I2SSTD
+    {403U, 2237U}, //USART2.CR3.IRLP
+    {718U, RegisterDbKey::NoField}, //SCB.VTOR
+    {125U, 788U}, //OTG_FS_HOST.FS_HCINTMSK0.ACKM
+    {154U, 1019U}, //RCC.APB1ENR.I2C2EN
+    {525U, 3019U}, //GPIOH.BSRR.BS14
+    {523U, 2975U}, //GPIOH.IDR.IDR10
+    {537U, 3213U}, //GPIOE.AFRL.AFRL6
+    {224U, 1344U}, //SYSCFG.EXTICR2.EXTI7
+    {575U, 3830U}, //GPIOA.BSRR.BS8
+    {61U, 399U}, //OTG_FS_DEVICE.DOEPCTL2.SODDFRM
+    {598U, 3993U}, //I2C1.CR2.DMAEN
+    {358U, 1995U}, //TIM5.SMCR.ETP
+    {561U, RegisterDbKey::NoField}, //GPIOB.OSPEEDR
+    {31U, 176U}, //EXTI.RTSR.TR15
+    {573U, 3783U}, //GPIOA.IDR.IDR7
+    {554U, 3471U}, //GPIOC.ODR.ODR13
+    {644U, 4232U}, //SPI3.SR.TIFRFE
+    {726U, 4560U}, //SCB.CFSR_UFSR_BFSR_MMFSR.DIVBYZERO
+    {535U, 3172U}, //GPIOE.BSRR.BR6
+    {150U, 985U}, //RCC.APB1RSTR.PWRRST
+    {706U, 4455U}, //FPU.FPSCR.IXC
+    {449U, 2538U}, //DMA2.S5CR.EN
+    {366U, 2067U}, //TIM5.CCER.CC3E
+    {385U, 2132U}, //TIM9.CCER.CC1NP
+    {706U, 4454U}, //FPU.FPSCR.UFC
+    {33U, 208U}, //EXTI.SWIER.SWIER1
+    {722U, RegisterDbKey::NoField}, //SCB.SHPR1
+    {126U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK1
+    {471U, 2701U}, //DMA1.S0CR.EN
+    {143U, 905U}, //PWR.CSR.EWUP
+    {321U, 1816U}, //TIM3.EGR.CC1G
+    {282U, RegisterDbKey::NoField}, //TIM10.CCR1
+    {575U, 3832U}, //GPIOA.BSRR.BS6
+    {547U, 3374U}, //GPIOD.AFRL.AFRL6
+    {494U, 2791U}, //DMA1.S3FCR.FS
+    {549U, 3397U}, //GPIOC.MODER.MODER7
+    {33U, 210U}, //EXTI.SWIER.SWIER3
+    {704U, 4442U}, //FPU.FPCCR.USER
+    {401U, 2215U}, //USART2.CR1.TE
+    {514U, 2898U}, //DMA1.S7NDTR.NDT
+    {539U, 3236U}, //GPIOD.MODER.MODER7
+    {415U, 2316U}, //DMA2.LISR.HTIF0
+    {237U, 1448U}, //TIM1.CCMR2_Input.CC4S
+    {690U, 4387U}, //NVIC.IPR6.IPR_N2
+    {102U, 609U}, //OTG_FS_HOST.FS_HCFG.FSLSPCS
+    {438U, 2483U}, //DMA2.S3NDTR.NDT
+    {625U, 4140U}, //SPI1.CR2.TXDMAEN
+    {131U, 845U}, //OTG_FS_HOST.FS_HCINTMSK6.CHHM
+    {182U, RegisterDbKey::NoField}, //RTC.ALRMBSSR
+    {660U, 4304U}, //SPI5.CR1.CRCNEXT
+    {193U, RegisterDbKey::NoField}, //RTC.BKP10R
+    {254U, 1530U}, //TIM8.SR.CC1OF
+    {87U, 526U}, //OTG_FS_GLOBAL.FS_GRSTCTL.TXFNUM
+    {401U, RegisterDbKey::NoField}, //USART2.CR1
+    {285U, RegisterDbKey::NoField}, //TIM11.SR
+    {230U, 1380U}, //TIM1.SMCR.ETPS
+    {391U, 2141U}, //USART1.SR.LBD
+    {110U, 651U}, //OTG_FS_HOST.FS_HCCHAR1.CHENA
+    {158U, 1061U}, //RCC.APB1LPENR.TIM4LPEN
+    {385U, 2131U}, //TIM9.CCER.CC2E
+    {326U, 1859U}, //TIM3.CCER.CC1NP
+    {642U, 4212U}, //SPI3.CR1.BIDIOE
+    {232U, 1405U}, //TIM1.SR.TIF
+    {117U, 714U}, //OTG_FS_HOST.FS_HCINT0.STALL
+    {127U, 809U}, //OTG_FS_HOST.FS_HCINTMSK2.NYET
+    {143U, RegisterDbKey::NoField}, //PWR.CSR
+    {658U, 4297U}, //SPI4.I2SCFGR.CHLEN
+    {3U, 38U}, //ADC1.CR1.AWDSGL
+    {666U, RegisterDbKey::NoField}, //SPI5.TXCRCR
+    {71U, 468U}, //OTG_FS_DEVICE.DIEPTSIZ0.XFRSIZ
+    {5U, 56U}, //ADC1.SMPR1.SMPx_x
+    {318U, 1788U}, //TIM3.SMCR.TS
+    {717U, 4505U}, //SCB.ICSR.PENDSVSET
+    {359U, 2010U}, //TIM5.DIER.CC3IE
+    {710U, 4472U}, //MPU.MPU_RBAR.REGION
+    {409U, 2274U}, //USART6.CR2.CPHA
+    {467U, 2619U}, //DMA1.LISR.HTIF0
+    {95U, 595U}, //OTG_FS_GLOBAL.FS_GNPTXSTS.NPTXQTOP
+    {141U, 890U}, //OTG_FS_PWRCLK.FS_PCGCCTL.PHYSUSP
+    {575U, 3807U}, //GPIOA.BSRR.BR15
+    {626U, RegisterDbKey::NoField}, //SPI1.SR
+    {587U, RegisterDbKey::NoField}, //I2C3.TRISE
+    {698U, 4420U}, //NVIC.IPR14.IPR_N3
+    {375U, 2089U}, //TIM5.DMAR.DMAB
+    {84U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GOTGINT
+    {579U, 3881U}, //I2C3.CR1.ENPEC
+    {26U, 98U}, //DBG.DBGMCU_CR.DBG_STANDBY
+    {469U, 2652U}, //DMA1.LIFCR.CFEIF2
+    {680U, 4357U}, //NVIC.ICPR2.CLRPEND
+    {525U, 3020U}, //GPIOH.BSRR.BS13
+    {109U, 634U}, //OTG_FS_HOST.FS_HCCHAR0.EPDIR
+    {565U, 3656U}, //GPIOB.BSRR.BR5
+    {410U, 2286U}, //USART6.CR3.NACK
+    {422U, RegisterDbKey::NoField}, //DMA2.S0M0AR
+    {0U, 4U}, //ADC_Common.CSR.EOC3
+    {172U, 1177U}, //RTC.ALRMBR.MNT
+    {346U, 1966U}, //TIM4.CCER.CC1P
+    {253U, 1526U}, //TIM8.DIER.UIE
+    {108U, 623U}, //OTG_FS_HOST.FS_HPRT.POCA
+    {51U, 321U}, //OTG_FS_DEVICE.FS_DAINTMSK.OEPINT
+    {118U, 724U}, //OTG_FS_HOST.FS_HCINT1.NAK
+    {74U, 477U}, //OTG_FS_DEVICE.DIEPTSIZ2.XFRSIZ
+    {564U, 3642U}, //GPIOB.ODR.ODR3
+    {419U, 2391U}, //DMA2.S0CR.CIRC
+    {113U, 681U}, //OTG_FS_HOST.FS_HCCHAR4.CHENA
+    {257U, 1562U}, //TIM8.CCMR1_Input.CC1S
+    {137U, 876U}, //OTG_FS_HOST.FS_HCTSIZ4.XFRSIZ
+    {287U, RegisterDbKey::NoField}, //TIM11.CCMR1_Output
+    {530U, 3090U}, //GPIOE.OTYPER.OT8
+    {31U, 179U}, //EXTI.RTSR.TR18
+    {689U, RegisterDbKey::NoField}, //NVIC.IPR5
+    {382U, RegisterDbKey::NoField}, //TIM9.EGR
+    {707U, 4467U}, //MPU.MPU_TYPER.IREGION
+    {359U, 2012U}, //TIM5.DIER.CC1IE
+    {606U, 4037U}, //I2S2ext.CR1.SSM
+    {380U, 2102U}, //TIM9.DIER.CC2IE
+    {161U, 1088U}, //RCC.CSR.BORRSTF
+    {173U, 1182U}, //RTC.WPR.KEY
+    {468U, 2623U}, //DMA1.HISR.TCIF7
+    {553U, 3459U}, //GPIOC.IDR.IDR9
+    {419U, 2394U}, //DMA2.S0CR.TCIE
+    {108U, 629U}, //OTG_FS_HOST.FS_HPRT.PPWR
+    {4U, RegisterDbKey::NoField}, //ADC1.CR2
+    {575U, 3811U}, //GPIOA.BSRR.BR11
+    {249U, 1481U}, //TIM1.BDTR.OSSR
+    {431U, 2454U}, //DMA2.S2CR.EN
+    {704U, 4444U}, //FPU.FPCCR.HFRDY
+    {166U, 1131U}, //RTC.CR.TSEDGE
+    {535U, 3176U}, //GPIOE.BSRR.BR2
+    {97U, 600U}, //OTG_FS_GLOBAL.FS_CID.PRODUCT_ID
+    {167U, 1147U}, //RTC.ISR.TAMP2F
+    {391U, 2148U}, //USART1.SR.FE
+    {145U, 935U}, //RCC.PLLCFGR.PLLN0
+    {608U, 4060U}, //I2S2ext.SR.RXNE
+    {378U, RegisterDbKey::NoField}, //TIM9.CR2
+    {364U, 2049U}, //TIM5.CCMR2_Output.OC4FE
+    {382U, 2111U}, //TIM9.EGR.TG
+    {415U, 2306U}, //DMA2.LISR.HTIF2
+    {54U, 324U}, //OTG_FS_DEVICE.DIEPEMPMSK.INEPTXFEM
+    {130U, 835U}, //OTG_FS_HOST.FS_HCINTMSK5.CHHM
+    {436U, 2462U}, //DMA2.S2FCR.FTH
+    {38U, 266U}, //FLASH.SR.PGSERR
+    {468U, 2641U}, //DMA1.HISR.DMEIF4
+    {585U, 3913U}, //I2C3.SR2.PEC
+    {416U, 2321U}, //DMA2.HISR.HTIF7
+    {129U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK4
+    {724U, 4527U}, //SCB.SHPR3.PRI_14
+    {234U, 1423U}, //TIM1.CCMR1_Output.OC2FE
+    {252U, 1505U}, //TIM8.SMCR.ETP
+    {640U, 4206U}, //SPI2.I2SCFGR.DATLEN
+    {601U, 4004U}, //I2C1.DR.DR
+    {646U, RegisterDbKey::NoField}, //SPI3.CRCPR
+    {360U, 2017U}, //TIM5.SR.CC1OF
+    {29U, 130U}, //EXTI.IMR.MR15
+    {26U, RegisterDbKey::NoField}, //DBG.DBGMCU_CR
+    {81U, 489U}, //OTG_FS_DEVICE.DOEPTSIZ2.PKTCNT
+    {699U, RegisterDbKey::NoField}, //NVIC.IPR15
+    {509U, 2871U}, //DMA1.S6PAR.PA
+    {362U, 2039U}, //TIM5.CCMR1_Output.CC1S
+    {504U, 2844U}, //DMA1.S5M0AR.M0A
+    {227U, 1356U}, //SYSCFG.CMPCR.READY
+    {395U, 2173U}, //USART1.CR2.LBCL
+    {694U, 4401U}, //NVIC.IPR10.IPR_N0
+    {236U, 1441U}, //TIM1.CCMR2_Output.OC3CE
+    {569U, 3723U}, //GPIOA.MODER.MODER3
+    {275U, RegisterDbKey::NoField}, //TIM10.EGR
+    {34U, 241U}, //EXTI.PR.PR11
+    {89U, 576U}, //OTG_FS_GLOBAL.FS_GINTMSK.SRQIM
+    {688U, 4378U}, //NVIC.IPR4.IPR_N1
+    {42U, RegisterDbKey::NoField}, //IWDG.PR
+    {519U, 2911U}, //GPIOH.MODER.MODER10
+    {544U, 3308U}, //GPIOD.ODR.ODR15
+    {651U, 4268U}, //SPI4.CR1.CPOL
+    {524U, 2997U}, //GPIOH.ODR.ODR4
+    {374U, RegisterDbKey::NoField}, //TIM5.DCR
+    {309U, RegisterDbKey::NoField}, //TIM2.CCR1
+    {575U, 3817U}, //GPIOA.BSRR.BR5
+    {644U, 4240U}, //SPI3.SR.RXNE
+    {513U, 2896U}, //DMA1.S7CR.DMEIE
+    {540U, 3246U}, //GPIOD.OTYPER.OT13
+    {545U, 3350U}, //GPIOD.BSRR.BS5
+    {55U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DIEPCTL0
+    {32U, 203U}, //EXTI.FTSR.TR19
+    {310U, 1763U}, //TIM2.CCR2.CCR2_L
+    {304U, RegisterDbKey::NoField}, //TIM2.CCMR2_Input
+    {417U, 2346U}, //DMA2.LIFCR.CHTIF2
+    {367U, 2074U}, //TIM5.CNT.CNT_H
+    {205U, 1248U}, //SDIO.ARG.CMDARG
+    {156U, 1043U}, //RCC.AHB1LPENR.FLITFLPEN
+    {571U, 3755U}, //GPIOA.OSPEEDR.OSPEEDR3
+    {338U, 1890U}, //TIM4.SMCR.ECE
+    {635U, 4193U}, //SPI2.SR.CHSIDE
+    {455U, 2564U}, //DMA2.S6CR.TEIE
+    {142U, 897U}, //PWR.CR.CSBF
+    {527U, 3056U}, //GPIOH.AFRL.AFRL2
+    {127U, 804U}, //OTG_FS_HOST.FS_HCINTMSK2.XFRCM
+    {327U, 1862U}, //TIM3.CNT.CNT_H
+    {533U, 3143U}, //GPIOE.IDR.IDR3
+    {56U, 341U}, //OTG_FS_DEVICE.DIEPCTL1.TXFNUM
+    {126U, 801U}, //OTG_FS_HOST.FS_HCINTMSK1.BBERRM
+    {129U, 824U}, //OTG_FS_HOST.FS_HCINTMSK4.XFRCM
+    {135U, 870U}, //OTG_FS_HOST.FS_HCTSIZ2.XFRSIZ
+    {572U, 3769U}, //GPIOA.PUPDR.PUPDR5
+    {20U, 89U}, //ADC1.JDR4.JDATA
+    {505U, 2845U}, //DMA1.S5M1AR.M1A
+    {142U, 898U}, //PWR.CR.CWUF
+    {540U, 3250U}, //GPIOD.OTYPER.OT9
+    {121U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT4
+    {507U, 2855U}, //DMA1.S6CR.DBM
+    {419U, 2397U}, //DMA2.S0CR.DMEIE
+    {301U, 1712U}, //TIM2.CCMR1_Output.OC2M
+    {401U, 2205U}, //USART2.CR1.UE
+    {706U, 4462U}, //FPU.FPSCR.C
+    {103U, 611U}, //OTG_FS_HOST.HFIR.FRIVL
+    {35U, RegisterDbKey::NoField}, //FLASH.ACR
+    {322U, 1823U}, //TIM3.CCMR1_Output.OC1CE
+    {139U, 882U}, //OTG_FS_HOST.FS_HCTSIZ6.XFRSIZ
+    {550U, 3420U}, //GPIOC.OTYPER.OT0
+    {168U, RegisterDbKey::NoField}, //RTC.PRER
+    {635U, 4187U}, //SPI2.SR.TIFRFE
+    {419U, 2384U}, //DMA2.S0CR.DBM
+    {543U, 3305U}, //GPIOD.IDR.IDR2
+    {469U, 2643U}, //DMA1.LIFCR.CTCIF3
+    {530U, 3096U}, //GPIOE.OTYPER.OT2
+    {477U, 2716U}, //DMA1.S1CR.PL
+    {616U, RegisterDbKey::NoField}, //I2S3ext.CR2
+    {467U, 2605U}, //DMA1.LISR.TEIF3
+    {78U, 483U}, //OTG_FS_DEVICE.DTXFSTS2.INEPTFSAV
+    {345U, RegisterDbKey::NoField}, //TIM4.CCMR2_Input
+    {166U, 1127U}, //RTC.CR.DCE
+    {156U, 1040U}, //RCC.AHB1LPENR.DMA2LPEN
+    {159U, 1069U}, //RCC.APB2LPENR.SPI1LPEN
+    {579U, 3880U}, //I2C3.CR1.ENGC
+    {234U, 1426U}, //TIM1.CCMR1_Output.OC1M
+    {156U, 1041U}, //RCC.AHB1LPENR.DMA1LPEN
+    {565U, 3653U}, //GPIOB.BSRR.BR8
+    {613U, 4068U}, //I2S2ext.I2SCFGR.PCMSYNC
+    {548U, 3384U}, //GPIOD.AFRH.AFRH12
+    {1U, 18U}, //ADC_Common.CCR.TSVREFE
+    {112U, 664U}, //OTG_FS_HOST.FS_HCCHAR3.EPDIR
+    {451U, RegisterDbKey::NoField}, //DMA2.S5PAR
+    {223U, 1340U}, //SYSCFG.EXTICR1.EXTI3
+    {231U, 1390U}, //TIM1.DIER.CC1DE
+    {543U, 3292U}, //GPIOD.IDR.IDR15
+    {319U, 1791U}, //TIM3.DIER.CC4DE
+    {554U, 3479U}, //GPIOC.ODR.ODR5
+    {584U, 3907U}, //I2C3.SR1.RxNE
+    {425U, 2414U}, //DMA2.S1CR.PINCOS
+    {358U, 1996U}, //TIM5.SMCR.ECE
+    {560U, 3579U}, //GPIOB.OTYPER.OT2
+    {167U, 1144U}, //RTC.ISR.TSF
+    {667U, 4341U}, //SPI5.I2SCFGR.DATLEN
+    {410U, 2281U}, //USART6.CR3.CTSE
+    {418U, 2367U}, //DMA2.HIFCR.CTEIF6
+    {525U, 3015U}, //GPIOH.BSRR.BR2
+    {545U, 3325U}, //GPIOD.BSRR.BR14
+    {253U, 1519U}, //TIM8.DIER.BIE
+    {413U, 2295U}, //WWDG.CFR.EWI
+    {149U, RegisterDbKey::NoField}, //RCC.AHB2RSTR
+    {640U, RegisterDbKey::NoField}, //SPI2.I2SCFGR
+    {468U, 2635U}, //DMA1.HISR.TEIF5
+    {637U, RegisterDbKey::NoField}, //SPI2.CRCPR
+    {557U, RegisterDbKey::NoField}, //GPIOC.AFRL
+    {534U, 3158U}, //GPIOE.ODR.ODR4
+    {474U, 2704U}, //DMA1.S0M0AR.M0A
+    {419U, 2398U}, //DMA2.S0CR.EN
+    {56U, 347U}, //OTG_FS_DEVICE.DIEPCTL1.MPSIZ
+    {253U, 1512U}, //TIM8.DIER.TDE
+    {525U, 3033U}, //GPIOH.BSRR.BS0
+    {616U, 4093U}, //I2S3ext.CR2.FRF
+    {461U, 2594U}, //DMA2.S7CR.EN
+    {624U, 4125U}, //SPI1.CR1.DFF
+    {56U, 343U}, //OTG_FS_DEVICE.DIEPCTL1.EPTYP
+    {584U, 3909U}, //I2C3.SR1.ADD10
+    {545U, 3330U}, //GPIOD.BSRR.BR9
+    {154U, 1020U}, //RCC.APB1ENR.I2C1EN
+    {365U, RegisterDbKey::NoField}, //TIM5.CCMR2_Input
+    {152U, 1011U}, //RCC.AHB1ENR.GPIOEEN
+    {704U, 4441U}, //FPU.FPCCR.LSPACT
+    {711U, 4483U}, //MPU.MPU_RASR.XN
+    {349U, 1971U}, //TIM4.ARR.ARR_H
+    {563U, 3625U}, //GPIOB.IDR.IDR4
+    {360U, 2014U}, //TIM5.SR.CC4OF
+    {477U, 2728U}, //DMA1.S1CR.DMEIE
+    {75U, 479U}, //OTG_FS_DEVICE.DIEPTSIZ3.PKTCNT
+    {320U, 1806U}, //TIM3.SR.TIF
+    {145U, 925U}, //RCC.PLLCFGR.PLLP1
+    {206U, 1257U}, //SDIO.CMD.CMDINDEX
+    {522U, 2956U}, //GPIOH.PUPDR.PUPDR13
+    {641U, 4208U}, //SPI2.I2SPR.MCKOE
+    {445U, RegisterDbKey::NoField}, //DMA2.S4PAR
+    {417U, 2347U}, //DMA2.LIFCR.CTEIF2
+    {561U, 3596U}, //GPIOB.OSPEEDR.OSPEEDR1
+    {588U, 3937U}, //I2C2.CR1.SMBUS
+    {545U, 3334U}, //GPIOD.BSRR.BR5
+    {576U, 3846U}, //GPIOA.LCKR.LCK9
+    {60U, 396U}, //OTG_FS_DEVICE.DOEPCTL1.MPSIZ
+    {531U, 3101U}, //GPIOE.OSPEEDR.OSPEEDR13
+    {470U, 2678U}, //DMA1.HIFCR.CTCIF4
+    {659U, 4298U}, //SPI4.I2SPR.MCKOE
+    {719U, 4511U}, //SCB.AIRCR.PRIGROUP
+    {151U, 1004U}, //RCC.APB2RSTR.USART6RST
+    {28U, 114U}, //DBG.DBGMCU_APB2_FZ.DBG_TIM11_STOP
+    {615U, 4080U}, //I2S3ext.CR1.DFF
+    {496U, RegisterDbKey::NoField}, //DMA1.S4NDTR
+    {231U, 1391U}, //TIM1.DIER.UDE
+    {58U, 365U}, //OTG_FS_DEVICE.DIEPCTL3.SNAK
+    {511U, RegisterDbKey::NoField}, //DMA1.S6M1AR
+    {633U, 4175U}, //SPI2.CR1.SPE
+    {541U, 3274U}, //GPIOD.OSPEEDR.OSPEEDR1
+    {631U, 4156U}, //SPI1.I2SCFGR.I2SE
+    {298U, 1690U}, //TIM2.DIER.CC4IE
+    {548U, 3386U}, //GPIOD.AFRH.AFRH10
+    {702U, 4435U}, //NVIC.IPR18.IPR_N2
+    {344U, 1949U}, //TIM4.CCMR2_Output.CC3S
+    {238U, 1460U}, //TIM1.CCER.CC2P
+    {305U, 1743U}, //TIM2.CCER.CC4NP
+    {68U, 454U}, //OTG_FS_DEVICE.DOEPINT1.STUP
+    {48U, 308U}, //OTG_FS_DEVICE.FS_DIEPMSK.XFRCM
+    {38U, RegisterDbKey::NoField}, //FLASH.SR
+    {726U, 4552U}, //SCB.CFSR_UFSR_BFSR_MMFSR.STKERR
+    {108U, 626U}, //OTG_FS_HOST.FS_HPRT.PSUSP
+    {562U, 3611U}, //GPIOB.PUPDR.PUPDR2
+    {520U, 2935U}, //GPIOH.OTYPER.OT2
+    {89U, 570U}, //OTG_FS_GLOBAL.FS_GINTMSK.IPXFRM_IISOOXFRM
+    {701U, RegisterDbKey::NoField}, //NVIC.IPR17
+    {525U, 3029U}, //GPIOH.BSRR.BS4
+    {555U, 3490U}, //GPIOC.BSRR.BR10
+    {232U, 1409U}, //TIM1.SR.CC2IF
+    {702U, 4433U}, //NVIC.IPR18.IPR_N0
+    {89U, 569U}, //OTG_FS_GLOBAL.FS_GINTMSK.IISOIXFRM
+    {527U, 3054U}, //GPIOH.AFRL.AFRL4
+    {625U, 4139U}, //SPI1.CR2.SSOE
+    {696U, RegisterDbKey::NoField}, //NVIC.IPR12
+    {543U, 3306U}, //GPIOD.IDR.IDR1
+    {303U, 1727U}, //TIM2.CCMR2_Output.O24CE
+    {470U, 2672U}, //DMA1.HIFCR.CFEIF6
+    {150U, RegisterDbKey::NoField}, //RCC.APB1RSTR
+    {570U, 3735U}, //GPIOA.OTYPER.OT7
+    {60U, 390U}, //OTG_FS_DEVICE.DOEPCTL1.Stall
+    {297U, 1680U}, //TIM2.SMCR.MSM
+    {573U, 3784U}, //GPIOA.IDR.IDR6
+    {0U, RegisterDbKey::NoField}, //ADC_Common.CSR
+    {476U, 2709U}, //DMA1.S0FCR.FTH
+    {513U, 2888U}, //DMA1.S7CR.MINC
+    {455U, 2562U}, //DMA2.S6CR.TCIE
+    {716U, RegisterDbKey::NoField}, //SCB.CPUID
+    {364U, 2046U}, //TIM5.CCMR2_Output.O24CE
+    {635U, 4194U}, //SPI2.SR.TXE
+    {23U, 92U}, //CRC.IDR.IDR
+    {570U, 3727U}, //GPIOA.OTYPER.OT15
+    {361U, RegisterDbKey::NoField}, //TIM5.EGR
+    {225U, 1348U}, //SYSCFG.EXTICR3.EXTI11
+    {394U, 2167U}, //USART1.CR1.SBK
+    {549U, 3402U}, //GPIOC.MODER.MODER2
+    {2U, 26U}, //ADC1.SR.JSTRT
+    {693U, RegisterDbKey::NoField}, //NVIC.IPR9
+    {416U, 2323U}, //DMA2.HISR.DMEIF7
+    {576U, 3853U}, //GPIOA.LCKR.LCK2
+    {179U, 1199U}, //RTC.CALR.CALP
+    {161U, 1084U}, //RCC.CSR.WDGRSTF
+    {142U, 899U}, //PWR.CR.PDDS
+    {523U, 2981U}, //GPIOH.IDR.IDR4
+    {534U, 3153U}, //GPIOE.ODR.ODR9
+    {588U, 3931U}, //I2C2.CR1.START
+    {565U, 3664U}, //GPIOB.BSRR.BS13
+    {513U, 2893U}, //DMA1.S7CR.TCIE
+    {584U, 3910U}, //I2C3.SR1.BTF
+    {477U, 2729U}, //DMA1.S1CR.EN
+    {229U, 1366U}, //TIM1.CR2.OIS4
+    {325U, 1849U}, //TIM3.CCMR2_Input.CC3S
+    {51U, 320U}, //OTG_FS_DEVICE.FS_DAINTMSK.IEPM
+    {602U, 4010U}, //I2C1.SR1.ARLO
+    {571U, 3743U}, //GPIOA.OSPEEDR.OSPEEDR15
+    {626U, 4143U}, //SPI1.SR.BSY
+    {368U, 2076U}, //TIM5.PSC.PSC
+    {552U, 3451U}, //GPIOC.PUPDR.PUPDR1
+    {418U, 2370U}, //DMA2.HIFCR.CTCIF5
+    {109U, 639U}, //OTG_FS_HOST.FS_HCCHAR0.ODDFRM
+    {217U, 1301U}, //SDIO.ICR.DBCKENDC
+    {529U, 3076U}, //GPIOE.MODER.MODER6
+    {156U, 1049U}, //RCC.AHB1LPENR.GPIOBLPEN
+    {319U, 1793U}, //TIM3.DIER.CC2DE
+    {477U, 2722U}, //DMA1.S1CR.CIRC
+    {162U, 1094U}, //RCC.SSCGR.INCSTEP
+    {88U, 534U}, //OTG_FS_GLOBAL.FS_GINTSTS.GINAKEFF
+    {82U, 491U}, //OTG_FS_DEVICE.DOEPTSIZ3.RXDPID_STUPCNT
+    {418U, 2369U}, //DMA2.HIFCR.CFEIF6
+    {651U, 4269U}, //SPI4.CR1.CPHA
+    {594U, 3971U}, //I2C2.SR2.TRA
+    {467U, 2613U}, //DMA1.LISR.TCIF1
+    {556U, 3527U}, //GPIOC.LCKR.LCK6
+    {544U, 3322U}, //GPIOD.ODR.ODR1
+    {544U, 3320U}, //GPIOD.ODR.ODR3
+    {501U, 2836U}, //DMA1.S5CR.PFCTRL
+    {65U, 439U}, //OTG_FS_DEVICE.DIEPINT2.EPDISD
+    {216U, 1288U}, //SDIO.STA.DBCKEND
+    {69U, 458U}, //OTG_FS_DEVICE.DOEPINT2.OTEPDIS
+    {256U, 1554U}, //TIM8.CCMR1_Output.OC1PE
+    {441U, RegisterDbKey::NoField}, //DMA2.S3M1AR
+    {525U, 3018U}, //GPIOH.BSRR.BS15
+    {696U, 4411U}, //NVIC.IPR12.IPR_N2
+    {555U, 3489U}, //GPIOC.BSRR.BR11
+    {102U, 610U}, //OTG_FS_HOST.FS_HCFG.FSLSS
+    {458U, 2569U}, //DMA2.S6M0AR.M0A
+    {280U, RegisterDbKey::NoField}, //TIM10.PSC
+    {30U, 145U}, //EXTI.EMR.MR7
+    {58U, 361U}, //OTG_FS_DEVICE.DIEPCTL3.EPENA
+    {271U, RegisterDbKey::NoField}, //TIM8.BDTR
+    {495U, 2805U}, //DMA1.S4CR.PINC
+    {535U, 3190U}, //GPIOE.BSRR.BS4
+    {356U, 1984U}, //TIM5.CR1.CKD
+    {544U, 3311U}, //GPIOD.ODR.ODR12
+    {549U, 3404U}, //GPIOC.MODER.MODER0
+    {31U, 165U}, //EXTI.RTSR.TR4
+    {324U, 1842U}, //TIM3.CCMR2_Output.OC3FE
+    {260U, 1588U}, //TIM8.CCER.CC2E
+    {36U, RegisterDbKey::NoField}, //FLASH.KEYR
+    {689U, 4381U}, //NVIC.IPR5.IPR_N0
+    {495U, 2798U}, //DMA1.S4CR.CT
+    {529U, 3069U}, //GPIOE.MODER.MODER13
+    {667U, 4335U}, //SPI5.I2SCFGR.I2SMOD
+    {578U, 3870U}, //GPIOA.AFRH.AFRH9
+    {572U, 3760U}, //GPIOA.PUPDR.PUPDR14
+    {147U, 967U}, //RCC.CIR.LSIRDYIE
+    {525U, 3031U}, //GPIOH.BSRR.BS2
+    {568U, 3704U}, //GPIOB.AFRH.AFRH14
+    {604U, 4027U}, //I2C1.CCR.F_S
+    {572U, 3766U}, //GPIOA.PUPDR.PUPDR8
+    {148U, 977U}, //RCC.AHB1RSTR.CRCRST
+    {599U, 4000U}, //I2C1.OAR1.ADD7
+    {565U, 3669U}, //GPIOB.BSRR.BS8
+    {29U, 117U}, //EXTI.IMR.MR2
+    {276U, 1624U}, //TIM10.CCMR1_Output.OC1M
+    {476U, RegisterDbKey::NoField}, //DMA1.S0FCR
+    {622U, 4112U}, //I2S3ext.I2SCFGR.I2SCFG
+    {168U, 1150U}, //RTC.PRER.PREDIV_S
+    {419U, RegisterDbKey::NoField}, //DMA2.S0CR
+    {150U, 989U}, //RCC.APB1RSTR.UART2RST
+    {598U, 3995U}, //I2C1.CR2.ITEVTEN
+    {164U, 1104U}, //RTC.TR.SU
+    {88U, 533U}, //OTG_FS_GLOBAL.FS_GINTSTS.NPTXFE
+    {562U, 3606U}, //GPIOB.PUPDR.PUPDR7
+    {611U, RegisterDbKey::NoField}, //I2S2ext.RXCRCR
+    {436U, 2460U}, //DMA2.S2FCR.FS
+    {326U, 1858U}, //TIM3.CCER.CC2E
+    {32U, 205U}, //EXTI.FTSR.TR21
+    {397U, 2189U}, //USART1.GTPR.GT
+    {342U, 1925U}, //TIM4.CCMR1_Output.OC2M
+    {383U, 2122U}, //TIM9.CCMR1_Output.CC1S
+    {163U, RegisterDbKey::NoField}, //RCC.PLLI2SCFGR
+    {164U, 1099U}, //RTC.TR.HT
+    {145U, 930U}, //RCC.PLLCFGR.PLLN5
+    {324U, 1840U}, //TIM3.CCMR2_Output.OC3M
+    {172U, 1173U}, //RTC.ALRMBR.PM
+    {721U, 4518U}, //SCB.CCR.USERSETMPEND
+    {690U, RegisterDbKey::NoField}, //NVIC.IPR6
+    {289U, RegisterDbKey::NoField}, //TIM11.CCER
+    {250U, 1492U}, //TIM8.CR1.CEN
+    {124U, 782U}, //OTG_FS_HOST.FS_HCINT7.FRMOR
+    {477U, 2714U}, //DMA1.S1CR.CT
+    {16U, 81U}, //ADC1.JSQR.JL
+    {419U, 2382U}, //DMA2.S0CR.PBURST
+    {176U, 1191U}, //RTC.TSTR.ST
+    {366U, 2073U}, //TIM5.CCER.CC1E
+    {210U, 1261U}, //SDIO.RESP3.CARDSTATUS3
+    {534U, 3152U}, //GPIOE.ODR.ODR10
+    {48U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DIEPMSK
+    {581U, 3892U}, //I2C3.OAR1.ADDMODE
+    {443U, RegisterDbKey::NoField}, //DMA2.S4CR
+    {436U, 2461U}, //DMA2.S2FCR.DMDIS
+    {110U, 649U}, //OTG_FS_HOST.FS_HCCHAR1.ODDFRM
+    {568U, 3703U}, //GPIOB.AFRH.AFRH15
+    {489U, 2781U}, //DMA1.S3CR.TCIE
+    {563U, 3627U}, //GPIOB.IDR.IDR2
+    {470U, 2669U}, //DMA1.HIFCR.CHTIF6
+    {126U, 797U}, //OTG_FS_HOST.FS_HCINTMSK1.NAKM
+    {282U, 1637U}, //TIM10.CCR1.CCR1
+    {258U, 1567U}, //TIM8.CCMR2_Output.CC4S
+    {652U, 4274U}, //SPI4.CR2.SSOE
+    {258U, RegisterDbKey::NoField}, //TIM8.CCMR2_Output
+    {300U, RegisterDbKey::NoField}, //TIM2.EGR
+    {540U, 3244U}, //GPIOD.OTYPER.OT15
+    {309U, 1760U}, //TIM2.CCR1.CCR1_H
+    {171U, 1167U}, //RTC.ALRMAR.SU
+    {654U, RegisterDbKey::NoField}, //SPI4.DR
+    {90U, 582U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Device.FRMNUM
+    {0U, 17U}, //ADC_Common.CSR.AWD1
+    {88U, 543U}, //OTG_FS_GLOBAL.FS_GINTSTS.OEPINT
+    {33U, 222U}, //EXTI.SWIER.SWIER15
+    {341U, RegisterDbKey::NoField}, //TIM4.EGR
+    {109U, 633U}, //OTG_FS_HOST.FS_HCCHAR0.EPNUM
+    {528U, 3064U}, //GPIOH.AFRH.AFRH10
+    {585U, 3916U}, //I2C3.SR2.SMBDEFAULT
+    {27U, 108U}, //DBG.DBGMCU_APB1_FZ.DBG_I2C1_SMBUS_TIMEOUT
+    {525U, 3025U}, //GPIOH.BSRR.BS8
+    {547U, 3379U}, //GPIOD.AFRL.AFRL1
+    {607U, 4045U}, //I2S2ext.CR2.TXEIE
+    {546U, 3365U}, //GPIOD.LCKR.LCK7
+    {455U, 2551U}, //DMA2.S6CR.CT
+    {204U, 1246U}, //SDIO.CLKCR.CLKEN
+    {726U, 4559U}, //SCB.CFSR_UFSR_BFSR_MMFSR.UNALIGNED
+    {398U, 2196U}, //USART2.SR.IDLE
+    {332U, 1871U}, //TIM3.CCR3.CCR3_H
+    {249U, 1484U}, //TIM1.BDTR.DTG
+    {294U, RegisterDbKey::NoField}, //TIM11.OR
+    {539U, 3230U}, //GPIOD.MODER.MODER13
+    {434U, RegisterDbKey::NoField}, //DMA2.S2M0AR
+    {302U, 1724U}, //TIM2.CCMR1_Input.IC1F
+    {143U, 901U}, //PWR.CSR.WUF
+    {175U, 1184U}, //RTC.SHIFTR.ADD1S
+    {558U, 3545U}, //GPIOC.AFRH.AFRH12
+    {381U, 2110U}, //TIM9.SR.UIF
+    {600U, RegisterDbKey::NoField}, //I2C1.OAR2
+    {166U, 1125U}, //RTC.CR.ALRBE
+    {553U, 3458U}, //GPIOC.IDR.IDR10
+    {259U, RegisterDbKey::NoField}, //TIM8.CCMR2_Input
+    {616U, 4090U}, //I2S3ext.CR2.TXEIE
+    {137U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ4
+    {319U, 1792U}, //TIM3.DIER.CC3DE
+    {33U, 220U}, //EXTI.SWIER.SWIER13
+    {554U, 3483U}, //GPIOC.ODR.ODR1
+    {525U, 3017U}, //GPIOH.BSRR.BR0
+    {542U, 3288U}, //GPIOD.PUPDR.PUPDR3
+    {422U, 2401U}, //DMA2.S0M0AR.M0A
+    {722U, 4524U}, //SCB.SHPR1.PRI_5
+    {557U, 3536U}, //GPIOC.AFRL.AFRL5
+    {71U, 467U}, //OTG_FS_DEVICE.DIEPTSIZ0.PKTCNT
+    {324U, 1841U}, //TIM3.CCMR2_Output.OC3PE
+    {570U, 3740U}, //GPIOA.OTYPER.OT2
+    {34U, 250U}, //EXTI.PR.PR20
+    {353U, 1980U}, //TIM4.CCR4.CCR4_L
+    {530U, 3087U}, //GPIOE.OTYPER.OT11
+    {727U, RegisterDbKey::NoField}, //SCB.HFSR
+    {606U, 4036U}, //I2S2ext.CR1.RXONLY
+    {417U, 2345U}, //DMA2.LIFCR.CTCIF2
+    {109U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR0
+    {364U, RegisterDbKey::NoField}, //TIM5.CCMR2_Output
+    {461U, 2576U}, //DMA2.S7CR.MBURST
+    {573U, 3782U}, //GPIOA.IDR.IDR8
+    {522U, 2964U}, //GPIOH.PUPDR.PUPDR5
+    {260U, 1583U}, //TIM8.CCER.CC3P
+    {522U, 2959U}, //GPIOH.PUPDR.PUPDR10
+    {396U, 2185U}, //USART1.CR3.HDSEL
+    {651U, 4266U}, //SPI4.CR1.BR
+    {152U, 1010U}, //RCC.AHB1ENR.GPIOHEN
+    {528U, 3059U}, //GPIOH.AFRH.AFRH15
+    {501U, RegisterDbKey::NoField}, //DMA1.S5CR
+    {706U, 4456U}, //FPU.FPSCR.IDC
+    {616U, 4094U}, //I2S3ext.CR2.SSOE
+    {728U, RegisterDbKey::NoField}, //SCB.MMFAR
+    {567U, 3702U}, //GPIOB.AFRL.AFRL0
+    {391U, 2142U}, //USART1.SR.TXE
+    {419U, 2381U}, //DMA2.S0CR.MBURST
+    {48U, 310U}, //OTG_FS_DEVICE.FS_DIEPMSK.TOM
+    {301U, 1711U}, //TIM2.CCMR1_Output.OC2CE
+    {229U, 1376U}, //TIM1.CR2.CCUS
+    {34U, 235U}, //EXTI.PR.PR5
+    {489U, 2785U}, //DMA1.S3CR.EN
+    {523U, 2985U}, //GPIOH.IDR.IDR0
+    {577U, 3860U}, //GPIOA.AFRL.AFRL3
+    {692U, 4396U}, //NVIC.IPR8.IPR_N3
+    {238U, 1462U}, //TIM1.CCER.CC1NP
+    {118U, 726U}, //OTG_FS_HOST.FS_HCINT1.TXERR
+    {318U, 1785U}, //TIM3.SMCR.ETPS
+    {80U, 485U}, //OTG_FS_DEVICE.DOEPTSIZ1.RXDPID_STUPCNT
+    {477U, 2727U}, //DMA1.S1CR.TEIE
+    {242U, RegisterDbKey::NoField}, //TIM1.CCR1
+    {662U, 4323U}, //SPI5.SR.BSY
+    {575U, 3819U}, //GPIOA.BSRR.BR3
+    {695U, 4407U}, //NVIC.IPR11.IPR_N2
+    {530U, 3093U}, //GPIOE.OTYPER.OT5
+    {260U, 1584U}, //TIM8.CCER.CC3E
+    {469U, 2659U}, //DMA1.LIFCR.CHTIF0
+    {554U, 3469U}, //GPIOC.ODR.ODR15
+    {419U, 2380U}, //DMA2.S0CR.CHSEL
+    {125U, 790U}, //OTG_FS_HOST.FS_HCINTMSK0.TXERRM
+    {575U, 3824U}, //GPIOA.BSRR.BS14
+    {165U, 1108U}, //RTC.DR.MT
+    {562U, 3598U}, //GPIOB.PUPDR.PUPDR15
+    {36U, 259U}, //FLASH.KEYR.KEY
+    {402U, 2226U}, //USART2.CR2.LBDL
+    {106U, RegisterDbKey::NoField}, //OTG_FS_HOST.HAINT
+    {525U, RegisterDbKey::NoField}, //GPIOH.BSRR
+    {575U, 3838U}, //GPIOA.BSRR.BS0
+    {116U, 709U}, //OTG_FS_HOST.FS_HCCHAR7.ODDFRM
+    {128U, 814U}, //OTG_FS_HOST.FS_HCINTMSK3.XFRCM
+    {495U, 2804U}, //DMA1.S4CR.MINC
+    {555U, 3491U}, //GPIOC.BSRR.BR9
+    {414U, 2299U}, //WWDG.SR.EWIF
+    {551U, 3426U}, //GPIOC.OSPEEDR.OSPEEDR10
+    {171U, 1162U}, //RTC.ALRMAR.MSK2
+    {30U, 148U}, //EXTI.EMR.MR10
+    {472U, RegisterDbKey::NoField}, //DMA1.S0NDTR
+    {710U, 4474U}, //MPU.MPU_RBAR.ADDR
+    {109U, 636U}, //OTG_FS_HOST.FS_HCCHAR0.EPTYP
+    {522U, 2962U}, //GPIOH.PUPDR.PUPDR7
+    {553U, 3465U}, //GPIOC.IDR.IDR3
+    {525U, 3008U}, //GPIOH.BSRR.BR9
+    {34U, 243U}, //EXTI.PR.PR13
+    {356U, 1991U}, //TIM5.CR1.CEN
+    {322U, RegisterDbKey::NoField}, //TIM3.CCMR1_Output
+    {144U, RegisterDbKey::NoField}, //RCC.CR
+    {658U, 4296U}, //SPI4.I2SCFGR.DATLEN
+    {513U, 2894U}, //DMA1.S7CR.HTIE
+    {470U, 2670U}, //DMA1.HIFCR.CTEIF6
+    {213U, RegisterDbKey::NoField}, //SDIO.DLEN
+    {594U, 3967U}, //I2C2.SR2.DUALF
+    {678U, 4355U}, //NVIC.ICPR0.CLRPEND
+    {535U, 3181U}, //GPIOE.BSRR.BS13
+    {549U, 3394U}, //GPIOC.MODER.MODER10
+    {419U, 2387U}, //DMA2.S0CR.MSIZE
+    {70U, 466U}, //OTG_FS_DEVICE.DOEPINT3.XFRC
+    {152U, 1009U}, //RCC.AHB1ENR.CRCEN
+    {109U, 632U}, //OTG_FS_HOST.FS_HCCHAR0.MPSIZ
+    {405U, 2250U}, //USART6.SR.FE
+    {718U, 4507U}, //SCB.VTOR.TBLOFF
+    {358U, 2001U}, //TIM5.SMCR.SMS
+    {88U, 548U}, //OTG_FS_GLOBAL.FS_GINTSTS.PTXFE
+    {694U, RegisterDbKey::NoField}, //NVIC.IPR10
+    {4U, 44U}, //ADC1.CR2.SWSTART
+    {511U, 2873U}, //DMA1.S6M1AR.M1A
+    {283U, 1640U}, //TIM11.CR1.URS
+    {251U, 1497U}, //TIM8.CR2.OIS2
+    {164U, 1102U}, //RTC.TR.MNU
+    {413U, 2296U}, //WWDG.CFR.WDGTB1
+    {306U, 1755U}, //TIM2.CNT.CNT_H
+    {60U, 393U}, //OTG_FS_DEVICE.DOEPCTL1.NAKSTS
+    {554U, 3475U}, //GPIOC.ODR.ODR9
+    {34U, 244U}, //EXTI.PR.PR14
+    {302U, 1722U}, //TIM2.CCMR1_Input.IC2PCS
+    {260U, 1592U}, //TIM8.CCER.CC1E
+    {574U, 3797U}, //GPIOA.ODR.ODR9
+    {525U, 3011U}, //GPIOH.BSRR.BR6
+    {589U, 3943U}, //I2C2.CR2.ITERREN
+    {615U, 4085U}, //I2S3ext.CR1.SPE
+    {565U, 3658U}, //GPIOB.BSRR.BR3
+    {216U, 1275U}, //SDIO.STA.CEATAEND
+    {634U, 4184U}, //SPI2.CR2.SSOE
+    {640U, 4200U}, //SPI2.I2SCFGR.I2SMOD
+    {653U, 4281U}, //SPI4.SR.CRCERR
+    {170U, 1152U}, //RTC.CALIBR.DCS
+    {151U, 1000U}, //RCC.APB2RSTR.SYSCFGRST
+    {578U, RegisterDbKey::NoField}, //GPIOA.AFRH
+    {411U, RegisterDbKey::NoField}, //USART6.GTPR
+    {79U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DTXFSTS3
+    {295U, 1668U}, //TIM2.CR1.DIR
+    {561U, 3589U}, //GPIOB.OSPEEDR.OSPEEDR8
+    {333U, 1874U}, //TIM3.CCR4.CCR4_L
+    {456U, RegisterDbKey::NoField}, //DMA2.S6NDTR
+    {391U, 2143U}, //USART1.SR.TC
+    {277U, 1629U}, //TIM10.CCMR1_Input.ICPCS
+    {108U, 622U}, //OTG_FS_HOST.FS_HPRT.PENCHNG
+    {27U, 107U}, //DBG.DBGMCU_APB1_FZ.DBG_IWDEG_STOP
+    {717U, 4500U}, //SCB.ICSR.VECTPENDING
+    {72U, 470U}, //OTG_FS_DEVICE.DOEPTSIZ0.PKTCNT
+    {172U, 1169U}, //RTC.ALRMBR.WDSEL
+    {725U, 4529U}, //SCB.SHCRS.MEMFAULTACT
+    {364U, 2053U}, //TIM5.CCMR2_Output.OC3PE
+    {259U, 1576U}, //TIM8.CCMR2_Input.IC3F
+    {662U, 4322U}, //SPI5.SR.TIFRFE
+    {159U, 1066U}, //RCC.APB2LPENR.USART6LPEN
+    {77U, 482U}, //OTG_FS_DEVICE.DTXFSTS1.INEPTFSAV
+    {57U, 352U}, //OTG_FS_DEVICE.DIEPCTL2.SNAK
+    {706U, 4453U}, //FPU.FPSCR.OFC
+    {467U, 2622U}, //DMA1.LISR.FEIF0
+    {149U, 984U}, //RCC.AHB2RSTR.OTGFSRST
+    {589U, RegisterDbKey::NoField}, //I2C2.CR2
+    {117U, 716U}, //OTG_FS_HOST.FS_HCINT0.ACK
+    {295U, 1669U}, //TIM2.CR1.OPM
+    {415U, 2300U}, //DMA2.LISR.TCIF3
+    {623U, 4120U}, //I2S3ext.I2SPR.I2SDIV
+    {166U, 1132U}, //RTC.CR.WCKSEL
+    {126U, 803U}, //OTG_FS_HOST.FS_HCINTMSK1.DTERRM
+    {571U, 3749U}, //GPIOA.OSPEEDR.OSPEEDR9
+    {688U, 4377U}, //NVIC.IPR4.IPR_N0
+    {588U, 3926U}, //I2C2.CR1.ALERT
+    {34U, 242U}, //EXTI.PR.PR12
+    {63U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPINT0
+    {172U, 1170U}, //RTC.ALRMBR.DT
+    {684U, 4364U}, //NVIC.IPR0.IPR_N3
+    {514U, RegisterDbKey::NoField}, //DMA1.S7NDTR
+    {253U, 1524U}, //TIM8.DIER.CC2IE
+    {590U, 3945U}, //I2C2.OAR1.ADDMODE
+    {147U, 969U}, //RCC.CIR.PLLI2SRDYF
+    {469U, 2644U}, //DMA1.LIFCR.CHTIF3
+    {150U, 991U}, //RCC.APB1RSTR.SPI2RST
+    {320U, 1808U}, //TIM3.SR.CC3IF
+    {155U, 1034U}, //RCC.APB2ENR.SPI1EN
+    {391U, 2140U}, //USART1.SR.CTS
+    {116U, 708U}, //OTG_FS_HOST.FS_HCCHAR7.DAD
+    {218U, 1330U}, //SDIO.MASK.RXOVERRIE
+    {319U, 1795U}, //TIM3.DIER.UDE
+    {32U, 193U}, //EXTI.FTSR.TR9
+    {330U, 1868U}, //TIM3.CCR1.CCR1_L
+    {58U, 364U}, //OTG_FS_DEVICE.DIEPCTL3.SD0PID_SEVNFRM
+    {33U, 209U}, //EXTI.SWIER.SWIER2
+    {584U, 3912U}, //I2C3.SR1.SB
+    {301U, 1718U}, //TIM2.CCMR1_Output.OC1PE
+    {120U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT3
+    {546U, 3356U}, //GPIOD.LCKR.LCKK
+    {532U, 3129U}, //GPIOE.PUPDR.PUPDR1
+    {471U, 2684U}, //DMA1.S0CR.MBURST
+    {394U, 2159U}, //USART1.CR1.PEIE
+    {131U, 847U}, //OTG_FS_HOST.FS_HCINTMSK6.NAKM
+    {115U, 696U}, //OTG_FS_HOST.FS_HCCHAR6.EPTYP
+    {488U, 2764U}, //DMA1.S2FCR.DMDIS
+    {345U, 1955U}, //TIM4.CCMR2_Input.CC3S
+    {32U, 197U}, //EXTI.FTSR.TR13
+    {545U, 3332U}, //GPIOD.BSRR.BR7
+    {524U, 2988U}, //GPIOH.ODR.ODR13
+    {533U, 3133U}, //GPIOE.IDR.IDR13
+    {559U, 3556U}, //GPIOB.MODER.MODER9
+    {301U, 1714U}, //TIM2.CCMR1_Output.OC2FE
+    {635U, 4188U}, //SPI2.SR.BSY
+    {57U, 348U}, //OTG_FS_DEVICE.DIEPCTL2.EPENA
+    {231U, 1392U}, //TIM1.DIER.BIE
+    {583U, 3898U}, //I2C3.DR.DR
+    {325U, 1845U}, //TIM3.CCMR2_Input.IC4PSC
+    {540U, 3256U}, //GPIOD.OTYPER.OT3
+    {531U, 3110U}, //GPIOE.OSPEEDR.OSPEEDR4
+    {664U, RegisterDbKey::NoField}, //SPI5.CRCPR
+    {160U, 1079U}, //RCC.BDCR.LSEBYP
+    {7U, RegisterDbKey::NoField}, //ADC1.JOFR1
+    {642U, 4214U}, //SPI3.CR1.CRCNEXT
+    {687U, 4376U}, //NVIC.IPR3.IPR_N3
+    {114U, 688U}, //OTG_FS_HOST.FS_HCCHAR5.DAD
+    {580U, 3888U}, //I2C3.CR2.ITBUFEN
+    {425U, 2413U}, //DMA2.S1CR.PL
+    {234U, 1420U}, //TIM1.CCMR1_Output.OC2CE
+    {303U, 1732U}, //TIM2.CCMR2_Output.OC3CE
+    {112U, 670U}, //OTG_FS_HOST.FS_HCCHAR3.CHDIS
+    {483U, 2756U}, //DMA1.S2CR.DMEIE
+    {542U, 3278U}, //GPIOD.PUPDR.PUPDR13
+    {250U, RegisterDbKey::NoField}, //TIM8.CR1
+    {603U, 4025U}, //I2C1.SR2.BUSY
+    {573U, 3790U}, //GPIOA.IDR.IDR0
+    {605U, 4030U}, //I2C1.TRISE.TRISE
+    {698U, 4417U}, //NVIC.IPR14.IPR_N0
+    {699U, 4423U}, //NVIC.IPR15.IPR_N2
+    {264U, 1596U}, //TIM8.CCR1.CCR1
+    {342U, 1926U}, //TIM4.CCMR1_Output.OC2PE
+    {246U, RegisterDbKey::NoField}, //TIM1.DCR
+    {381U, RegisterDbKey::NoField}, //TIM9.SR
+    {147U, 965U}, //RCC.CIR.HSIRDYIE
+    {237U, 1451U}, //TIM1.CCMR2_Input.CC3S
+    {552U, RegisterDbKey::NoField}, //GPIOC.PUPDR
+    {706U, 4461U}, //FPU.FPSCR.V
+    {385U, 2134U}, //TIM9.CCER.CC1E
+    {543U, 3294U}, //GPIOD.IDR.IDR13
+    {147U, 959U}, //RCC.CIR.HSIRDYC
+    {501U, 2837U}, //DMA1.S5CR.TCIE
+    {271U, 1607U}, //TIM8.BDTR.BKE
+    {166U, 1129U}, //RTC.CR.BYPSHAD
+    {56U, 344U}, //OTG_FS_DEVICE.DIEPCTL1.NAKSTS
+    {361U, 2024U}, //TIM5.EGR.TG
+    {697U, 4416U}, //NVIC.IPR13.IPR_N3
+    {501U, 2824U}, //DMA1.S5CR.PBURST
+    {626U, 4142U}, //SPI1.SR.TIFRFE
+    {529U, 3081U}, //GPIOE.MODER.MODER1
+    {525U, 3009U}, //GPIOH.BSRR.BR8
+    {545U, 3327U}, //GPIOD.BSRR.BR12
+    {253U, RegisterDbKey::NoField}, //TIM8.DIER
+    {551U, 3429U}, //GPIOC.OSPEEDR.OSPEEDR7
+    {342U, 1932U}, //TIM4.CCMR1_Output.OC1FE
+    {243U, RegisterDbKey::NoField}, //TIM1.CCR2
+    {251U, 1504U}, //TIM8.CR2.CCPC
+    {406U, 2252U}, //USART6.DR.DR
+    {604U, 4029U}, //I2C1.CCR.CCR
+    {17U, 86U}, //ADC1.JDR1.JDATA
+    {541U, 3265U}, //GPIOD.OSPEEDR.OSPEEDR10
+    {485U, RegisterDbKey::NoField}, //DMA1.S2PAR
+    {541U, 3269U}, //GPIOD.OSPEEDR.OSPEEDR6
+    {455U, 2548U}, //DMA2.S6CR.MBURST
+    {662U, 4324U}, //SPI5.SR.OVR
+    {717U, RegisterDbKey::NoField}, //SCB.ICSR
+    {325U, 1848U}, //TIM3.CCMR2_Input.IC3PSC
+    {660U, 4308U}, //SPI5.CR1.SSI
+    {46U, 294U}, //OTG_FS_DEVICE.FS_DCTL.RWUSIG
+    {296U, 1675U}, //TIM2.CR2.CCDS
+    {717U, 4504U}, //SCB.ICSR.PENDSVCLR
+    {542U, 3283U}, //GPIOD.PUPDR.PUPDR8
+    {130U, 836U}, //OTG_FS_HOST.FS_HCINTMSK5.STALLM
+    {128U, 819U}, //OTG_FS_HOST.FS_HCINTMSK3.NYET
+    {601U, RegisterDbKey::NoField}, //I2C1.DR
+    {384U, RegisterDbKey::NoField}, //TIM9.CCMR1_Input
+    {570U, 3734U}, //GPIOA.OTYPER.OT8
+    {630U, 4154U}, //SPI1.TXCRCR.TxCRC
+    {180U, 1204U}, //RTC.TAFCR.TSINSEL
+    {340U, 1908U}, //TIM4.SR.CC4OF
+    {107U, 618U}, //OTG_FS_HOST.HAINTMSK.HAINTM
+    {451U, 2540U}, //DMA2.S5PAR.PA
+    {449U, RegisterDbKey::NoField}, //DMA2.S5CR
+    {218U, 1320U}, //SDIO.MASK.RXFIFOHFIE
+    {30U, 146U}, //EXTI.EMR.MR8
+    {477U, 2710U}, //DMA1.S1CR.CHSEL
+    {650U, 4254U}, //SPI3.I2SPR.ODD
+    {521U, 2944U}, //GPIOH.OSPEEDR.OSPEEDR9
+    {259U, 1577U}, //TIM8.CCMR2_Input.IC3PSC
+    {597U, 3979U}, //I2C1.CR1.ALERT
+    {657U, 4289U}, //SPI4.TXCRCR.TxCRC
+    {714U, 4489U}, //STK.VAL.CURRENT
+    {40U, 283U}, //FLASH.OPTCR.RDP
+    {12U, RegisterDbKey::NoField}, //ADC1.LTR
+    {109U, 640U}, //OTG_FS_HOST.FS_HCCHAR0.CHDIS
+    {507U, 2866U}, //DMA1.S6CR.HTIE
+    {478U, 2730U}, //DMA1.S1NDTR.NDT
+    {555U, 3514U}, //GPIOC.BSRR.BS2
+    {552U, 3446U}, //GPIOC.PUPDR.PUPDR6
+    {207U, 1258U}, //SDIO.RESPCMD.RESPCMD
+    {115U, 697U}, //OTG_FS_HOST.FS_HCCHAR6.MCNT
+    {359U, 2013U}, //TIM5.DIER.UIE
+    {574U, 3798U}, //GPIOA.ODR.ODR8
+    {117U, 712U}, //OTG_FS_HOST.FS_HCINT0.XFRC
+    {565U, 3649U}, //GPIOB.BSRR.BR12
+    {184U, 1221U}, //RTC.BKP1R.BKP
+    {50U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DAINT
+    {470U, 2673U}, //DMA1.HIFCR.CTCIF5
+    {378U, 2097U}, //TIM9.CR2.MMS
+    {360U, 2015U}, //TIM5.SR.CC3OF
+    {59U, 378U}, //OTG_FS_DEVICE.DOEPCTL0.Stall
+    {544U, 3319U}, //GPIOD.ODR.ODR4
+    {83U, 497U}, //OTG_FS_GLOBAL.FS_GOTGCTL.HNPRQ
+    {396U, 2177U}, //USART1.CR3.ONEBIT
+    {465U, 2598U}, //DMA2.S7M1AR.M1A
+    {176U, 1189U}, //RTC.TSTR.MNT
+    {613U, 4070U}, //I2S2ext.I2SCFGR.CKPOL
+    {260U, 1580U}, //TIM8.CCER.CC4E
+    {187U, RegisterDbKey::NoField}, //RTC.BKP4R
+    {107U, RegisterDbKey::NoField}, //OTG_FS_HOST.HAINTMSK
+    {417U, 2350U}, //DMA2.LIFCR.CTCIF1
+    {110U, 647U}, //OTG_FS_HOST.FS_HCCHAR1.MCNT
+    {172U, 1175U}, //RTC.ALRMBR.HU
+    {623U, 4119U}, //I2S3ext.I2SPR.ODD
+    {217U, 1309U}, //SDIO.ICR.CTIMEOUTC
+    {726U, 4548U}, //SCB.CFSR_UFSR_BFSR_MMFSR.IBUSERR
+    {132U, 860U}, //OTG_FS_HOST.FS_HCINTMSK7.TXERRM
+    {34U, 240U}, //EXTI.PR.PR10
+    {336U, 1878U}, //TIM4.CR1.CKD
+    {160U, 1081U}, //RCC.BDCR.LSEON
+    {418U, 2366U}, //DMA2.HIFCR.CHTIF6
+    {249U, RegisterDbKey::NoField}, //TIM1.BDTR
+    {535U, 3175U}, //GPIOE.BSRR.BR3
+    {565U, 3675U}, //GPIOB.BSRR.BS2
+    {651U, 4260U}, //SPI4.CR1.DFF
+    {655U, RegisterDbKey::NoField}, //SPI4.CRCPR
+    {532U, 3128U}, //GPIOE.PUPDR.PUPDR2
+    {555U, 3493U}, //GPIOC.BSRR.BR7
+    {30U, 140U}, //EXTI.EMR.MR2
+    {178U, RegisterDbKey::NoField}, //RTC.TSSSR
+    {398U, 2200U}, //USART2.SR.PE
+    {31U, 175U}, //EXTI.RTSR.TR14
+    {559U, 3552U}, //GPIOB.MODER.MODER13
+    {633U, 4167U}, //SPI2.CR1.BIDIOE
+    {425U, 2426U}, //DMA2.S1CR.EN
+    {616U, 4092U}, //I2S3ext.CR2.ERRIE
+    {158U, 1063U}, //RCC.APB1LPENR.TIM2LPEN
+    {461U, 2591U}, //DMA2.S7CR.HTIE
+    {217U, 1311U}, //SDIO.ICR.CCRCFAILC
+    {513U, 2895U}, //DMA1.S7CR.TEIE
+    {585U, RegisterDbKey::NoField}, //I2C3.SR2
+    {521U, 2948U}, //GPIOH.OSPEEDR.OSPEEDR5
+    {364U, 2048U}, //TIM5.CCMR2_Output.OC4PE
+    {545U, 3340U}, //GPIOD.BSRR.BS15
+    {394U, 2163U}, //USART1.CR1.IDLEIE
+    {626U, 4150U}, //SPI1.SR.RXNE
+    {495U, 2809U}, //DMA1.S4CR.TCIE
+    {229U, 1368U}, //TIM1.CR2.OIS3
+    {38U, 262U}, //FLASH.SR.OPERR
+    {88U, 532U}, //OTG_FS_GLOBAL.FS_GINTSTS.RXFLVL
+    {12U, 63U}, //ADC1.LTR.LT
+    {236U, 1437U}, //TIM1.CCMR2_Output.OC4M
+    {461U, 2578U}, //DMA2.S7CR.ACK
+    {145U, 936U}, //RCC.PLLCFGR.PLLM5
+    {727U, 4561U}, //SCB.HFSR.VECTTBL
+    {604U, 4028U}, //I2C1.CCR.DUTY
+    {524U, 2993U}, //GPIOH.ODR.ODR8
+    {653U, 4282U}, //SPI4.SR.UDR
+    {23U, RegisterDbKey::NoField}, //CRC.IDR
+    {526U, 3042U}, //GPIOH.LCKR.LCK8
+    {398U, 2199U}, //USART2.SR.FE
+    {519U, 2919U}, //GPIOH.MODER.MODER2
+    {171U, 1161U}, //RTC.ALRMAR.HU
+    {533U, RegisterDbKey::NoField}, //GPIOE.IDR
+    {225U, 1350U}, //SYSCFG.EXTICR3.EXTI9
+    {589U, 3939U}, //I2C2.CR2.LAST
+    {565U, 3668U}, //GPIOB.BSRR.BS9
+    {551U, 3430U}, //GPIOC.OSPEEDR.OSPEEDR6
+    {30U, 147U}, //EXTI.EMR.MR9
+    {443U, 2508U}, //DMA2.S4CR.TEIE
+    {29U, 126U}, //EXTI.IMR.MR11
+    {380U, 2103U}, //TIM9.DIER.CC1IE
+    {89U, 577U}, //OTG_FS_GLOBAL.FS_GINTMSK.WUIM
+    {67U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPINT0
+    {231U, 1388U}, //TIM1.DIER.CC3DE
+    {476U, 2708U}, //DMA1.S0FCR.DMDIS
+    {316U, 1774U}, //TIM3.CR1.CMS
+    {711U, 4482U}, //MPU.MPU_RASR.AP
+    {544U, 3312U}, //GPIOD.ODR.ODR11
+    {556U, 3523U}, //GPIOC.LCKR.LCK10
+    {250U, 1486U}, //TIM8.CR1.ARPE
+    {572U, 3762U}, //GPIOA.PUPDR.PUPDR12
+    {0U, 2U}, //ADC_Common.CSR.JSTRT3
+    {88U, 540U}, //OTG_FS_GLOBAL.FS_GINTSTS.ISOODRP
+    {606U, 4031U}, //I2S2ext.CR1.BIDIMODE
+    {564U, 3631U}, //GPIOB.ODR.ODR14
+    {565U, 3650U}, //GPIOB.BSRR.BR11
+    {489U, 2768U}, //DMA1.S3CR.PBURST
+    {539U, 3238U}, //GPIOD.MODER.MODER5
+    {29U, 119U}, //EXTI.IMR.MR4
+    {585U, 3914U}, //I2C3.SR2.DUALF
+    {513U, 2878U}, //DMA1.S7CR.CHSEL
+    {112U, 662U}, //OTG_FS_HOST.FS_HCCHAR3.MPSIZ
+    {571U, 3747U}, //GPIOA.OSPEEDR.OSPEEDR11
+    {33U, RegisterDbKey::NoField}, //EXTI.SWIER
+    {216U, 1279U}, //SDIO.STA.RXFIFOE
+    {567U, 3696U}, //GPIOB.AFRL.AFRL6
+    {254U, 1529U}, //TIM8.SR.CC2OF
+    {364U, 2055U}, //TIM5.CCMR2_Output.CC3S
+    {253U, 1521U}, //TIM8.DIER.COMIE
+    {401U, 2210U}, //USART2.CR1.PEIE
+    {617U, 4103U}, //I2S3ext.SR.CHSIDE
+    {41U, RegisterDbKey::NoField}, //IWDG.KR
+    {597U, 3981U}, //I2C1.CR1.POS
+    {326U, 1861U}, //TIM3.CCER.CC1E
+    {546U, 3358U}, //GPIOD.LCKR.LCK14
+    {507U, 2865U}, //DMA1.S6CR.TCIE
+    {425U, 2417U}, //DMA2.S1CR.MINC
+    {131U, 853U}, //OTG_FS_HOST.FS_HCINTMSK6.DTERRM
+    {377U, 2091U}, //TIM9.CR1.CKD
+    {323U, 1832U}, //TIM3.CCMR1_Input.ICPCS
+    {364U, 2047U}, //TIM5.CCMR2_Output.OC4M
+    {3U, 31U}, //ADC1.CR1.RES
+    {339U, 1905U}, //TIM4.DIER.CC2IE
+    {416U, RegisterDbKey::NoField}, //DMA2.HISR
+    {536U, 3198U}, //GPIOE.LCKR.LCK13
+    {648U, 4244U}, //SPI3.TXCRCR.TxCRC
+    {218U, 1327U}, //SDIO.MASK.DATAENDIE
+    {70U, 465U}, //OTG_FS_DEVICE.DOEPINT3.EPDISD
+    {686U, 4372U}, //NVIC.IPR2.IPR_N3
+    {26U, 100U}, //DBG.DBGMCU_CR.TRACE_MODE
+    {535U, RegisterDbKey::NoField}, //GPIOE.BSRR
+    {409U, 2271U}, //USART6.CR2.STOP
+    {79U, 484U}, //OTG_FS_DEVICE.DTXFSTS3.INEPTFSAV
+    {500U, 2819U}, //DMA1.S4FCR.FS
+    {633U, 4173U}, //SPI2.CR1.SSI
+    {695U, 4408U}, //NVIC.IPR11.IPR_N3
+    {526U, 3044U}, //GPIOH.LCKR.LCK6
+    {471U, RegisterDbKey::NoField}, //DMA1.S0CR
+    {271U, 1604U}, //TIM8.BDTR.MOE
+    {449U, 2537U}, //DMA2.S5CR.DMEIE
+    {568U, 3708U}, //GPIOB.AFRH.AFRH10
+    {574U, 3804U}, //GPIOA.ODR.ODR2
+    {483U, 2754U}, //DMA1.S2CR.HTIE
+    {521U, 2940U}, //GPIOH.OSPEEDR.OSPEEDR13
+    {491U, RegisterDbKey::NoField}, //DMA1.S3PAR
+    {600U, 4002U}, //I2C1.OAR2.ADD2
+    {715U, 4492U}, //STK.CALIB.NOREF
+    {216U, 1283U}, //SDIO.STA.RXFIFOHF
+    {495U, 2808U}, //DMA1.S4CR.PFCTRL
+    {409U, 2277U}, //USART6.CR2.LBDL
+    {399U, RegisterDbKey::NoField}, //USART2.DR
+    {585U, 3915U}, //I2C3.SR2.SMBHOST
+    {188U, RegisterDbKey::NoField}, //RTC.BKP5R
+    {556U, RegisterDbKey::NoField}, //GPIOC.LCKR
+    {386U, RegisterDbKey::NoField}, //TIM9.CNT
+    {672U, RegisterDbKey::NoField}, //NVIC.ICER0
+    {356U, 1987U}, //TIM5.CR1.DIR
+    {408U, 2267U}, //USART6.CR1.RE
+    {270U, RegisterDbKey::NoField}, //TIM8.RCR
+    {536U, 3211U}, //GPIOE.LCKR.LCK0
+    {154U, 1028U}, //RCC.APB1ENR.TIM2EN
+    {14U, 73U}, //ADC1.SQR2.SQ8
+    {408U, 2259U}, //USART6.CR1.PCE
+    {409U, 2270U}, //USART6.CR2.LINEN
+    {473U, 2703U}, //DMA1.S0PAR.PA
+    {148U, 976U}, //RCC.AHB1RSTR.DMA1RST
+    {548U, 3387U}, //GPIOD.AFRH.AFRH9
+    {121U, 750U}, //OTG_FS_HOST.FS_HCINT4.STALL
+    {105U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HPTXSTS
+    {179U, 1201U}, //RTC.CALR.CALW16
+    {599U, 3998U}, //I2C1.OAR1.ADDMODE
+    {370U, 2079U}, //TIM5.CCR1.CCR1_H
+    {534U, 3150U}, //GPIOE.ODR.ODR12
+    {35U, 256U}, //FLASH.ACR.DCEN
+    {551U, RegisterDbKey::NoField}, //GPIOC.OSPEEDR
+    {687U, 4375U}, //NVIC.IPR3.IPR_N2
+    {174U, RegisterDbKey::NoField}, //RTC.SSR
+    {300U, 1707U}, //TIM2.EGR.CC3G
+    {303U, 1734U}, //TIM2.CCMR2_Output.OC3PE
+    {57U, 358U}, //OTG_FS_DEVICE.DIEPCTL2.EONUM_DPID
+    {131U, 846U}, //OTG_FS_HOST.FS_HCINTMSK6.STALLM
+    {381U, 2105U}, //TIM9.SR.CC2OF
+    {408U, 2269U}, //USART6.CR1.SBK
+    {145U, 937U}, //RCC.PLLCFGR.PLLM4
+    {232U, 1400U}, //TIM1.SR.CC4OF
+    {725U, 4541U}, //SCB.SHCRS.BUSFAULTENA
+    {260U, 1582U}, //TIM8.CCER.CC3NE
+    {216U, RegisterDbKey::NoField}, //SDIO.STA
+    {305U, 1754U}, //TIM2.CCER.CC1E
+    {510U, RegisterDbKey::NoField}, //DMA1.S6M0AR
+    {3U, 33U}, //ADC1.CR1.JAWDEN
+    {569U, 3720U}, //GPIOA.MODER.MODER6
+    {530U, 3098U}, //GPIOE.OTYPER.OT0
+    {160U, 1080U}, //RCC.BDCR.LSERDY
+    {470U, 2666U}, //DMA1.HIFCR.CDMEIF7
+    {653U, 4280U}, //SPI4.SR.MODF
+    {238U, RegisterDbKey::NoField}, //TIM1.CCER
+    {448U, 2517U}, //DMA2.S4FCR.DMDIS
+    {152U, 1014U}, //RCC.AHB1ENR.GPIOBEN
+    {693U, 4399U}, //NVIC.IPR9.IPR_N2
+    {708U, 4469U}, //MPU.MPU_CTRL.HFNMIENA
+    {250U, 1491U}, //TIM8.CR1.UDIS
+    {15U, 80U}, //ADC1.SQR3.SQ1
+    {29U, 136U}, //EXTI.IMR.MR21
+    {200U, 1237U}, //RTC.BKP17R.BKP
+    {381U, 2108U}, //TIM9.SR.CC2IF
+    {686U, 4371U}, //NVIC.IPR2.IPR_N2
+    {640U, 4203U}, //SPI2.I2SCFGR.PCMSYNC
+    {711U, 4477U}, //MPU.MPU_RASR.SRD
+    {537U, 3214U}, //GPIOE.AFRL.AFRL5
+    {513U, 2886U}, //DMA1.S7CR.MSIZE
+    {32U, 190U}, //EXTI.FTSR.TR6
+    {577U, 3857U}, //GPIOA.AFRL.AFRL6
+    {575U, 3833U}, //GPIOA.BSRR.BS5
+    {230U, 1384U}, //TIM1.SMCR.SMS
+    {172U, 1181U}, //RTC.ALRMBR.SU
+    {146U, 948U}, //RCC.CFGR.PPRE2
+    {405U, 2249U}, //USART6.SR.NF
+    {720U, RegisterDbKey::NoField}, //SCB.SCR
+    {602U, 4018U}, //I2C1.SR1.SB
+    {350U, RegisterDbKey::NoField}, //TIM4.CCR1
+    {127U, 808U}, //OTG_FS_HOST.FS_HCINTMSK2.ACKM
+    {292U, 1662U}, //TIM11.ARR.ARR
+    {113U, 672U}, //OTG_FS_HOST.FS_HCCHAR4.MPSIZ
+    {573U, 3778U}, //GPIOA.IDR.IDR12
+    {675U, RegisterDbKey::NoField}, //NVIC.ISPR0
+    {548U, RegisterDbKey::NoField}, //GPIOD.AFRH
+    {119U, 734U}, //OTG_FS_HOST.FS_HCINT2.ACK
+    {386U, 2135U}, //TIM9.CNT.CNT
+    {89U, 565U}, //OTG_FS_GLOBAL.FS_GINTMSK.EOPFM
+    {644U, RegisterDbKey::NoField}, //SPI3.SR
+    {1U, 22U}, //ADC_Common.CCR.DDS
+    {552U, 3441U}, //GPIOC.PUPDR.PUPDR11
+    {303U, 1735U}, //TIM2.CCMR2_Output.OC3FE
+    {68U, 452U}, //OTG_FS_DEVICE.DOEPINT1.B2BSTUP
+    {527U, RegisterDbKey::NoField}, //GPIOH.AFRL
+    {534U, RegisterDbKey::NoField}, //GPIOE.ODR
+    {575U, 3808U}, //GPIOA.BSRR.BR14
+    {21U, RegisterDbKey::NoField}, //ADC1.DR
+    {455U, 2565U}, //DMA2.S6CR.DMEIE
+    {444U, 2511U}, //DMA2.S4NDTR.NDT
+    {626U, 4149U}, //SPI1.SR.TXE
+    {115U, 698U}, //OTG_FS_HOST.FS_HCCHAR6.DAD
+    {363U, RegisterDbKey::NoField}, //TIM5.CCMR1_Input
+    {467U, 2604U}, //DMA1.LISR.HTIF3
+    {661U, 4320U}, //SPI5.CR2.TXDMAEN
+    {539U, RegisterDbKey::NoField}, //GPIOD.MODER
+    {547U, 3376U}, //GPIOD.AFRL.AFRL4
+    {522U, 2967U}, //GPIOH.PUPDR.PUPDR2
+    {557U, 3541U}, //GPIOC.AFRL.AFRL0
+    {607U, 4047U}, //I2S2ext.CR2.ERRIE
+    {528U, 3066U}, //GPIOH.AFRH.AFRH8
+    {56U, 342U}, //OTG_FS_DEVICE.DIEPCTL1.Stall
+    {127U, 810U}, //OTG_FS_HOST.FS_HCINTMSK2.TXERRM
+    {124U, 775U}, //OTG_FS_HOST.FS_HCINT7.XFRC
+    {680U, RegisterDbKey::NoField}, //NVIC.ICPR2
+    {274U, 1620U}, //TIM10.SR.CC1IF
+    {558U, 3544U}, //GPIOC.AFRH.AFRH13
+    {101U, 607U}, //OTG_FS_GLOBAL.FS_DIEPTXF3.INEPTXSA
+    {609U, 4061U}, //I2S2ext.DR.DR
+    {443U, 2503U}, //DMA2.S4CR.CIRC
+    {217U, 1310U}, //SDIO.ICR.DCRCFAILC
+    {470U, RegisterDbKey::NoField}, //DMA1.HIFCR
+    {428U, RegisterDbKey::NoField}, //DMA2.S1M0AR
+    {261U, RegisterDbKey::NoField}, //TIM8.CNT
+    {459U, 2570U}, //DMA2.S6M1AR.M1A
+    {177U, 1193U}, //RTC.TSDR.WDU
+    {74U, 476U}, //OTG_FS_DEVICE.DIEPTSIZ2.PKTCNT
+    {55U, 332U}, //OTG_FS_DEVICE.FS_DIEPCTL0.SNAK
+    {395U, 2174U}, //USART1.CR2.LBDIE
+    {64U, 431U}, //OTG_FS_DEVICE.DIEPINT1.ITTXFE
+    {355U, RegisterDbKey::NoField}, //TIM4.DMAR
+    {466U, 2599U}, //DMA2.S7FCR.FEIE
+    {86U, 516U}, //OTG_FS_GLOBAL.FS_GUSBCFG.HNPCAP
+    {562U, 3600U}, //GPIOB.PUPDR.PUPDR13
+    {83U, 498U}, //OTG_FS_GLOBAL.FS_GOTGCTL.HSHNPEN
+    {550U, 3410U}, //GPIOC.OTYPER.OT10
+    {501U, 2840U}, //DMA1.S5CR.DMEIE
+    {148U, 979U}, //RCC.AHB1RSTR.GPIOERST
+    {272U, 1612U}, //TIM10.CR1.CKD
+    {431U, 2452U}, //DMA2.S2CR.TEIE
+    {283U, RegisterDbKey::NoField}, //TIM11.CR1
+    {721U, 4519U}, //SCB.CCR.UNALIGN__TRP
+    {416U, 2329U}, //DMA2.HISR.FEIF6
+    {651U, 4267U}, //SPI4.CR1.MSTR
+    {71U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPTSIZ0
+    {419U, 2389U}, //DMA2.S0CR.MINC
+    {172U, 1174U}, //RTC.ALRMBR.HT
+    {410U, 2283U}, //USART6.CR3.DMAT
+    {167U, 1133U}, //RTC.ISR.ALRAWF
+    {145U, 932U}, //RCC.PLLCFGR.PLLN3
+    {388U, 2137U}, //TIM9.ARR.ARR
+    {247U, 1475U}, //TIM1.DMAR.DMAB
+    {373U, 2086U}, //TIM5.CCR4.CCR4_L
+    {362U, 2033U}, //TIM5.CCMR1_Output.OC2FE
+    {117U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT0
+    {223U, RegisterDbKey::NoField}, //SYSCFG.EXTICR1
+    {614U, 4073U}, //I2S2ext.I2SPR.MCKOE
+    {241U, 1468U}, //TIM1.ARR.ARR
+    {471U, 2692U}, //DMA1.S0CR.MINC
+    {118U, 728U}, //OTG_FS_HOST.FS_HCINT1.FRMOR
+    {403U, 2239U}, //USART2.CR3.EIE
+    {416U, 2336U}, //DMA2.HISR.HTIF4
+    {60U, 385U}, //OTG_FS_DEVICE.DOEPCTL1.EPDIS
+    {532U, 3115U}, //GPIOE.PUPDR.PUPDR15
+    {25U, 95U}, //DBG.DBGMCU_IDCODE.REV_ID
+    {607U, 4051U}, //I2S2ext.CR2.RXDMAEN
+    {425U, 2420U}, //DMA2.S1CR.DIR
+    {32U, 202U}, //EXTI.FTSR.TR18
+    {725U, 4539U}, //SCB.SHCRS.SVCALLPENDED
+    {562U, 3603U}, //GPIOB.PUPDR.PUPDR10
+    {145U, 920U}, //RCC.PLLCFGR.PLLQ3
+    {449U, 2522U}, //DMA2.S5CR.ACK
+    {594U, 3970U}, //I2C2.SR2.GENCALL
+    {229U, 1373U}, //TIM1.CR2.TI1S
+    {216U, 1280U}, //SDIO.STA.TXFIFOE
+    {417U, 2341U}, //DMA2.LIFCR.CHTIF3
+    {245U, 1472U}, //TIM1.CCR4.CCR4
+    {437U, 2464U}, //DMA2.S3CR.MBURST
+    {302U, 1723U}, //TIM2.CCMR1_Input.CC2S
+    {560U, 3577U}, //GPIOB.OTYPER.OT4
+    {40U, 281U}, //FLASH.OPTCR.nRST_STOP
+    {403U, 2238U}, //USART2.CR3.IREN
+    {455U, 2556U}, //DMA2.S6CR.PSIZE
+    {398U, 2195U}, //USART2.SR.RXNE
+    {410U, 2288U}, //USART6.CR3.IRLP
+    {588U, RegisterDbKey::NoField}, //I2C2.CR1
+    {344U, 1944U}, //TIM4.CCMR2_Output.CC4S
+    {201U, RegisterDbKey::NoField}, //RTC.BKP18R
+    {86U, 520U}, //OTG_FS_GLOBAL.FS_GUSBCFG.CTXPKT
+    {119U, 735U}, //OTG_FS_HOST.FS_HCINT2.TXERR
+    {324U, 1835U}, //TIM3.CCMR2_Output.OC4M
+    {566U, 3678U}, //GPIOB.LCKR.LCKK
+    {461U, 2580U}, //DMA2.S7CR.DBM
+    {346U, RegisterDbKey::NoField}, //TIM4.CCER
+    {527U, 3055U}, //GPIOH.AFRL.AFRL3
+    {326U, 1854U}, //TIM3.CCER.CC3P
+    {301U, 1720U}, //TIM2.CCMR1_Output.CC1S
+    {555U, 3502U}, //GPIOC.BSRR.BS14
+    {31U, 162U}, //EXTI.RTSR.TR1
+    {355U, 1983U}, //TIM4.DMAR.DMAB
+    {455U, 2563U}, //DMA2.S6CR.HTIE
+    {298U, 1689U}, //TIM2.DIER.TIE
+    {489U, 2767U}, //DMA1.S3CR.MBURST
+    {324U, 1838U}, //TIM3.CCMR2_Output.CC4S
+    {218U, 1314U}, //SDIO.MASK.RXDAVLIE
+    {154U, 1021U}, //RCC.APB1ENR.USART2EN
+    {179U, 1200U}, //RTC.CALR.CALW8
+    {152U, 1007U}, //RCC.AHB1ENR.DMA2EN
+    {334U, RegisterDbKey::NoField}, //TIM3.DCR
+    {708U, 4470U}, //MPU.MPU_CTRL.PRIVDEFENA
+    {122U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT5
+    {147U, 962U}, //RCC.CIR.PLLI2SRDYIE
+    {58U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPCTL3
+    {425U, 2416U}, //DMA2.S1CR.PSIZE
+    {515U, RegisterDbKey::NoField}, //DMA1.S7PAR
+    {214U, 1272U}, //SDIO.DCTRL.DTDIR
+    {565U, RegisterDbKey::NoField}, //GPIOB.BSRR
+    {419U, 2395U}, //DMA2.S0CR.HTIE
+    {468U, 2628U}, //DMA1.HISR.TCIF6
+    {526U, 3035U}, //GPIOH.LCKR.LCK15
+    {114U, 685U}, //OTG_FS_HOST.FS_HCCHAR5.LSDEV
+    {684U, 4361U}, //NVIC.IPR0.IPR_N0
+    {469U, 2648U}, //DMA1.LIFCR.CTCIF2
+    {449U, 2529U}, //DMA2.S5CR.MINC
+    {577U, 3861U}, //GPIOA.AFRL.AFRL2
+    {148U, RegisterDbKey::NoField}, //RCC.AHB1RSTR
+    {653U, 4278U}, //SPI4.SR.BSY
+    {244U, RegisterDbKey::NoField}, //TIM1.CCR3
+    {218U, 1333U}, //SDIO.MASK.CTIMEOUTIE
+    {211U, RegisterDbKey::NoField}, //SDIO.RESP4
+    {513U, 2890U}, //DMA1.S7CR.CIRC
+    {108U, 627U}, //OTG_FS_HOST.FS_HPRT.PRST
+    {32U, 192U}, //EXTI.FTSR.TR8
+    {594U, 3973U}, //I2C2.SR2.MSL
+    {542U, 3277U}, //GPIOD.PUPDR.PUPDR14
+    {560U, 3578U}, //GPIOB.OTYPER.OT3
+    {540U, 3247U}, //GPIOD.OTYPER.OT12
+    {455U, 2560U}, //DMA2.S6CR.DIR
+    {499U, 2817U}, //DMA1.S4M1AR.M1A
+    {70U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPINT3
+    {84U, 507U}, //OTG_FS_GLOBAL.FS_GOTGINT.HNGDET
+    {467U, 2620U}, //DMA1.LISR.TEIF0
+    {250U, 1485U}, //TIM8.CR1.CKD
+    {671U, RegisterDbKey::NoField}, //NVIC.ISER2
+    {519U, 2918U}, //GPIOH.MODER.MODER3
+    {216U, 1278U}, //SDIO.STA.TXDAVL
+    {319U, RegisterDbKey::NoField}, //TIM3.DIER
+    {359U, 2006U}, //TIM5.DIER.CC1DE
+    {150U, 994U}, //RCC.APB1RSTR.TIM4RST
+    {344U, 1947U}, //TIM4.CCMR2_Output.OC3PE
+    {312U, 1767U}, //TIM2.CCR4.CCR4_L
+    {3U, 42U}, //ADC1.CR1.EOCIE
+    {710U, 4473U}, //MPU.MPU_RBAR.VALID
+    {712U, 4487U}, //STK.CTRL.COUNTFLAG
+    {122U, 763U}, //OTG_FS_HOST.FS_HCINT5.BBERR
+    {561U, 3586U}, //GPIOB.OSPEEDR.OSPEEDR11
+    {632U, 4163U}, //SPI1.I2SPR.MCKOE
+    {520U, 2928U}, //GPIOH.OTYPER.OT9
+    {73U, 473U}, //OTG_FS_DEVICE.DIEPTSIZ1.PKTCNT
+    {118U, 723U}, //OTG_FS_HOST.FS_HCINT1.STALL
+    {417U, 2342U}, //DMA2.LIFCR.CTEIF3
+    {147U, 972U}, //RCC.CIR.HSIRDYF
+    {361U, 2029U}, //TIM5.EGR.UG
+    {324U, 1836U}, //TIM3.CCMR2_Output.OC4PE
+    {580U, 3891U}, //I2C3.CR2.FREQ
+    {545U, 3335U}, //GPIOD.BSRR.BR4
+    {63U, 424U}, //OTG_FS_DEVICE.DIEPINT0.INEPNE
+    {89U, 558U}, //OTG_FS_GLOBAL.FS_GINTMSK.GINAKEFFM
+    {493U, 2789U}, //DMA1.S3M1AR.M1A
+    {30U, 158U}, //EXTI.EMR.MR20
+    {418U, 2362U}, //DMA2.HIFCR.CTEIF7
+    {641U, RegisterDbKey::NoField}, //SPI2.I2SPR
+    {417U, 2348U}, //DMA2.LIFCR.CDMEIF2
+    {524U, 2996U}, //GPIOH.ODR.ODR5
+    {651U, 4265U}, //SPI4.CR1.SPE
+    {574U, 3793U}, //GPIOA.ODR.ODR13
+    {13U, 67U}, //ADC1.SQR1.SQ14
+    {623U, 4118U}, //I2S3ext.I2SPR.MCKOE
+    {477U, 2713U}, //DMA1.S1CR.ACK
+    {602U, 4011U}, //I2C1.SR1.BERR
+    {534U, 3157U}, //GPIOE.ODR.ODR5
+    {108U, 619U}, //OTG_FS_HOST.FS_HPRT.PCSTS
+    {489U, 2783U}, //DMA1.S3CR.TEIE
+    {346U, 1963U}, //TIM4.CCER.CC2P
+    {430U, 2433U}, //DMA2.S1FCR.DMDIS
+    {679U, RegisterDbKey::NoField}, //NVIC.ICPR1
+    {626U, 4145U}, //SPI1.SR.MODF
+    {674U, RegisterDbKey::NoField}, //NVIC.ICER2
+    {408U, 2256U}, //USART6.CR1.UE
+    {318U, 1787U}, //TIM3.SMCR.MSM
+    {575U, 3834U}, //GPIOA.BSRR.BS4
+    {59U, 380U}, //OTG_FS_DEVICE.DOEPCTL0.EPTYP
+    {615U, 4079U}, //I2S3ext.CR1.CRCNEXT
+    {408U, 2265U}, //USART6.CR1.IDLEIE
+    {32U, 195U}, //EXTI.FTSR.TR11
+    {430U, 2431U}, //DMA2.S1FCR.FEIE
+    {377U, RegisterDbKey::NoField}, //TIM9.CR1
+    {594U, RegisterDbKey::NoField}, //I2C2.SR2
+    {431U, 2435U}, //DMA2.S2CR.CHSEL
+    {726U, 4550U}, //SCB.CFSR_UFSR_BFSR_MMFSR.IMPRECISERR
+    {497U, 2815U}, //DMA1.S4PAR.PA
+    {455U, 2547U}, //DMA2.S6CR.CHSEL
+    {534U, 3148U}, //GPIOE.ODR.ODR14
+    {127U, 806U}, //OTG_FS_HOST.FS_HCINTMSK2.STALLM
+    {13U, 66U}, //ADC1.SQR1.SQ15
+    {229U, 1375U}, //TIM1.CR2.CCDS
+    {520U, 2925U}, //GPIOH.OTYPER.OT12
+    {529U, 3074U}, //GPIOE.MODER.MODER8
+    {251U, RegisterDbKey::NoField}, //TIM8.CR2
+    {561U, 3595U}, //GPIOB.OSPEEDR.OSPEEDR2
+    {48U, 312U}, //OTG_FS_DEVICE.FS_DIEPMSK.INEPNMM
+    {256U, 1552U}, //TIM8.CCMR1_Output.OC1CE
+    {81U, 488U}, //OTG_FS_DEVICE.DOEPTSIZ2.RXDPID_STUPCNT
+    {48U, 313U}, //OTG_FS_DEVICE.FS_DIEPMSK.INEPNEM
+    {376U, 2090U}, //TIM5.OR.IT4_RMP
+    {691U, 4390U}, //NVIC.IPR7.IPR_N1
+    {70U, 462U}, //OTG_FS_DEVICE.DOEPINT3.B2BSTUP
+    {311U, RegisterDbKey::NoField}, //TIM2.CCR3
+    {147U, 958U}, //RCC.CIR.HSERDYC
+    {10U, RegisterDbKey::NoField}, //ADC1.JOFR4
+    {377U, 2096U}, //TIM9.CR1.CEN
+    {67U, 450U}, //OTG_FS_DEVICE.DOEPINT0.EPDISD
+    {534U, 3156U}, //GPIOE.ODR.ODR6
+    {468U, 2631U}, //DMA1.HISR.DMEIF6
+    {33U, 211U}, //EXTI.SWIER.SWIER4
+    {574U, 3796U}, //GPIOA.ODR.ODR10
+    {552U, 3452U}, //GPIOC.PUPDR.PUPDR0
+    {560U, 3570U}, //GPIOB.OTYPER.OT11
+    {720U, 4514U}, //SCB.SCR.SLEEPONEXIT
+    {231U, 1389U}, //TIM1.DIER.CC2DE
+    {691U, RegisterDbKey::NoField}, //NVIC.IPR7
+    {582U, 3896U}, //I2C3.OAR2.ADD2
+    {146U, 953U}, //RCC.CFGR.SW1
+    {155U, 1037U}, //RCC.APB2ENR.TIM9EN
+    {532U, 3119U}, //GPIOE.PUPDR.PUPDR11
+    {542U, 3289U}, //GPIOD.PUPDR.PUPDR2
+    {462U, 2595U}, //DMA2.S7NDTR.NDT
+    {129U, 828U}, //OTG_FS_HOST.FS_HCINTMSK4.ACKM
+    {620U, RegisterDbKey::NoField}, //I2S3ext.RXCRCR
+    {320U, 1807U}, //TIM3.SR.CC4IF
+    {520U, 2934U}, //GPIOH.OTYPER.OT3
+    {121U, 751U}, //OTG_FS_HOST.FS_HCINT4.NAK
+    {700U, RegisterDbKey::NoField}, //NVIC.IPR16
+    {121U, 756U}, //OTG_FS_HOST.FS_HCINT4.DTERR
+    {164U, 1101U}, //RTC.TR.MNT
+    {252U, 1511U}, //TIM8.SMCR.SMS
+    {455U, 2552U}, //DMA2.S6CR.DBM
+    {350U, 1974U}, //TIM4.CCR1.CCR1_L
+    {221U, 1338U}, //SYSCFG.MEMRM.MEM_MODE
+    {640U, 4201U}, //SPI2.I2SCFGR.I2SE
+    {529U, 3079U}, //GPIOE.MODER.MODER3
+    {30U, 142U}, //EXTI.EMR.MR4
+    {376U, RegisterDbKey::NoField}, //TIM5.OR
+    {470U, 2677U}, //DMA1.HIFCR.CFEIF5
+    {57U, 349U}, //OTG_FS_DEVICE.DIEPCTL2.EPDIS
+    {584U, 3908U}, //I2C3.SR1.STOPF
+    {158U, 1053U}, //RCC.APB1LPENR.I2C3LPEN
+    {30U, 138U}, //EXTI.EMR.MR0
+    {728U, 4564U}, //SCB.MMFAR.MMFAR
+    {713U, 4488U}, //STK.LOAD.RELOAD
+    {580U, 3887U}, //I2C3.CR2.DMAEN
+    {559U, 3550U}, //GPIOB.MODER.MODER15
+    {659U, RegisterDbKey::NoField}, //SPI4.I2SPR
+    {14U, 74U}, //ADC1.SQR2.SQ7
+    {151U, 1002U}, //RCC.APB2RSTR.SDIORST
+    {88U, 536U}, //OTG_FS_GLOBAL.FS_GINTSTS.ESUSP
+    {661U, 4316U}, //SPI5.CR2.RXNEIE
+    {570U, 3730U}, //GPIOA.OTYPER.OT12
+    {111U, 660U}, //OTG_FS_HOST.FS_HCCHAR2.CHDIS
+    {608U, 4057U}, //I2S2ext.SR.UDR
+    {578U, 3871U}, //GPIOA.AFRH.AFRH8
+    {525U, 3007U}, //GPIOH.BSRR.BR10
+    {572U, 3759U}, //GPIOA.PUPDR.PUPDR15
+    {171U, 1160U}, //RTC.ALRMAR.HT
+    {130U, 837U}, //OTG_FS_HOST.FS_HCINTMSK5.NAKM
+    {255U, 1546U}, //TIM8.EGR.UG
+    {409U, RegisterDbKey::NoField}, //USART6.CR2
+    {394U, 2160U}, //USART1.CR1.TXEIE
+    {610U, 4062U}, //I2S2ext.CRCPR.CRCPOLY
+    {523U, 2982U}, //GPIOH.IDR.IDR3
+    {131U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK6
+    {692U, 4395U}, //NVIC.IPR8.IPR_N2
+    {392U, 2150U}, //USART1.DR.DR
+    {320U, 1804U}, //TIM3.SR.CC2OF
+    {33U, 216U}, //EXTI.SWIER.SWIER9
+    {166U, 1119U}, //RTC.CR.TSIE
+    {651U, 4257U}, //SPI4.CR1.BIDIOE
+    {30U, 152U}, //EXTI.EMR.MR14
+    {108U, 621U}, //OTG_FS_HOST.FS_HPRT.PENA
+    {379U, 2099U}, //TIM9.SMCR.TS
+    {212U, 1263U}, //SDIO.DTIMER.DATATIME
+    {536U, 3201U}, //GPIOE.LCKR.LCK10
+    {688U, 4379U}, //NVIC.IPR4.IPR_N2
+    {66U, 443U}, //OTG_FS_DEVICE.DIEPINT3.ITTXFE
+    {154U, 1018U}, //RCC.APB1ENR.I2C3EN
+    {308U, 1759U}, //TIM2.ARR.ARR_L
+    {117U, 715U}, //OTG_FS_HOST.FS_HCINT0.NAK
+    {156U, 1050U}, //RCC.AHB1LPENR.GPIOALPEN
+    {145U, 931U}, //RCC.PLLCFGR.PLLN4
+    {138U, 879U}, //OTG_FS_HOST.FS_HCTSIZ5.XFRSIZ
+    {80U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPTSIZ1
+    {60U, 389U}, //OTG_FS_DEVICE.DOEPCTL1.CNAK
+    {333U, RegisterDbKey::NoField}, //TIM3.CCR4
+    {90U, 581U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Device.PKTSTS
+    {656U, RegisterDbKey::NoField}, //SPI4.RXCRCR
+    {667U, RegisterDbKey::NoField}, //SPI5.I2SCFGR
+    {151U, 1003U}, //RCC.APB2RSTR.ADCRST
+    {549U, 3390U}, //GPIOC.MODER.MODER14
+    {151U, 1006U}, //RCC.APB2RSTR.TIM1RST
+    {151U, 997U}, //RCC.APB2RSTR.TIM11RST
+    {65U, 440U}, //OTG_FS_DEVICE.DIEPINT2.XFRC
+    {340U, 1910U}, //TIM4.SR.CC2OF
+    {321U, 1812U}, //TIM3.EGR.TG
+    {556U, 3522U}, //GPIOC.LCKR.LCK11
+    {382U, 2113U}, //TIM9.EGR.CC1G
+    {151U, 1001U}, //RCC.APB2RSTR.SPI1RST
+    {401U, 2206U}, //USART2.CR1.M
+    {60U, 387U}, //OTG_FS_DEVICE.DOEPCTL1.SD0PID_SEVNFRM
+    {176U, 1192U}, //RTC.TSTR.SU
+    {297U, 1677U}, //TIM2.SMCR.ECE
+    {534U, 3151U}, //GPIOE.ODR.ODR11
+    {495U, 2807U}, //DMA1.S4CR.DIR
+    {590U, RegisterDbKey::NoField}, //I2C2.OAR1
+    {45U, 291U}, //OTG_FS_DEVICE.FS_DCFG.NZLSOHSK
+    {726U, RegisterDbKey::NoField}, //SCB.CFSR_UFSR_BFSR_MMFSR
+    {535U, 3168U}, //GPIOE.BSRR.BR10
+    {1U, RegisterDbKey::NoField}, //ADC_Common.CCR
+    {431U, 2437U}, //DMA2.S2CR.PBURST
+    {377U, 2093U}, //TIM9.CR1.OPM
+    {532U, 3130U}, //GPIOE.PUPDR.PUPDR0
+    {402U, RegisterDbKey::NoField}, //USART2.CR2
+    {576U, 3852U}, //GPIOA.LCKR.LCK3
+    {574U, 3799U}, //GPIOA.ODR.ODR7
+    {733U, 4573U}, //SCB_ACTRL.ACTRL.DISOOFP
+    {706U, 4452U}, //FPU.FPSCR.DZC
+    {91U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GRXSTSR_Host
+    {401U, 2207U}, //USART2.CR1.WAKE
+    {529U, 3072U}, //GPIOE.MODER.MODER10
+    {142U, 893U}, //PWR.CR.FPDS
+    {449U, 2528U}, //DMA2.S5CR.PSIZE
+    {383U, 2120U}, //TIM9.CCMR1_Output.OC1PE
+    {394U, 2155U}, //USART1.CR1.M
+    {525U, 3030U}, //GPIOH.BSRR.BS3
+    {39U, 275U}, //FLASH.CR.ERRIE
+    {667U, 4337U}, //SPI5.I2SCFGR.I2SCFG
+    {413U, 2297U}, //WWDG.CFR.WDGTB0
+    {334U, 1875U}, //TIM3.DCR.DBL
+    {351U, 1976U}, //TIM4.CCR2.CCR2_L
+    {726U, 4555U}, //SCB.CFSR_UFSR_BFSR_MMFSR.UNDEFINSTR
+    {393U, RegisterDbKey::NoField}, //USART1.BRR
+    {615U, 4084U}, //I2S3ext.CR1.LSBFIRST
+    {134U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ1
+    {339U, 1904U}, //TIM4.DIER.CC3IE
+    {235U, 1432U}, //TIM1.CCMR1_Input.CC2S
+    {439U, RegisterDbKey::NoField}, //DMA2.S3PAR
+    {147U, 957U}, //RCC.CIR.PLLRDYC
+    {543U, 3303U}, //GPIOD.IDR.IDR4
+    {272U, 1614U}, //TIM10.CR1.URS
+    {171U, RegisterDbKey::NoField}, //RTC.ALRMAR
+    {58U, 369U}, //OTG_FS_DEVICE.DIEPCTL3.EPTYP
+    {643U, 4227U}, //SPI3.CR2.ERRIE
+    {298U, 1693U}, //TIM2.DIER.CC1IE
+    {222U, RegisterDbKey::NoField}, //SYSCFG.PMC
+    {236U, 1444U}, //TIM1.CCMR2_Output.OC3FE
+    {417U, RegisterDbKey::NoField}, //DMA2.LIFCR
+    {146U, RegisterDbKey::NoField}, //RCC.CFGR
+    {146U, 947U}, //RCC.CFGR.RTCPRE
+    {24U, 93U}, //CRC.CR.CR
+    {164U, 1100U}, //RTC.TR.HU
+    {237U, 1446U}, //TIM1.CCMR2_Input.IC4F
+    {14U, 69U}, //ADC1.SQR2.SQ12
+    {33U, 217U}, //EXTI.SWIER.SWIER10
+    {603U, 4020U}, //I2C1.SR2.DUALF
+    {731U, 4567U}, //NVIC_STIR.STIR.INTID
+    {145U, 940U}, //RCC.PLLCFGR.PLLM1
+    {559U, 3565U}, //GPIOB.MODER.MODER0
+    {535U, 3164U}, //GPIOE.BSRR.BR14
+    {557U, 3540U}, //GPIOC.AFRL.AFRL1
+    {597U, 3991U}, //I2C1.CR1.PE
+    {94U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GNPTXFSIZ_Host
+    {63U, 428U}, //OTG_FS_DEVICE.DIEPINT0.XFRC
+    {642U, 4215U}, //SPI3.CR1.DFF
+    {530U, 3086U}, //GPIOE.OTYPER.OT12
+    {580U, 3886U}, //I2C3.CR2.LAST
+    {89U, 560U}, //OTG_FS_GLOBAL.FS_GINTMSK.ESUSPM
+    {391U, RegisterDbKey::NoField}, //USART1.SR
+    {551U, 3424U}, //GPIOC.OSPEEDR.OSPEEDR12
+    {341U, 1921U}, //TIM4.EGR.CC2G
+    {396U, 2180U}, //USART1.CR3.RTSE
+    {104U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HFNUM
+    {607U, 4046U}, //I2S2ext.CR2.RXNEIE
+    {563U, 3624U}, //GPIOB.IDR.IDR5
+    {257U, 1560U}, //TIM8.CCMR1_Input.IC1F
+    {535U, 3185U}, //GPIOE.BSRR.BS9
+    {565U, 3659U}, //GPIOB.BSRR.BR2
+    {455U, 2550U}, //DMA2.S6CR.ACK
+    {88U, 545U}, //OTG_FS_GLOBAL.FS_GINTSTS.IPXFR_INCOMPISOOUT
+    {513U, 2884U}, //DMA1.S7CR.PL
+    {725U, 4532U}, //SCB.SHCRS.SVCALLACT
+    {148U, 982U}, //RCC.AHB1RSTR.GPIOBRST
+    {635U, 4191U}, //SPI2.SR.CRCERR
+    {404U, 2240U}, //USART2.GTPR.GT
+    {299U, 1698U}, //TIM2.SR.CC1OF
+    {61U, 406U}, //OTG_FS_DEVICE.DOEPCTL2.NAKSTS
+    {661U, 4318U}, //SPI5.CR2.FRF
+    {167U, 1138U}, //RTC.ISR.RSF
+    {701U, 4431U}, //NVIC.IPR17.IPR_N2
+    {237U, RegisterDbKey::NoField}, //TIM1.CCMR2_Input
+    {443U, 2504U}, //DMA2.S4CR.DIR
+    {632U, 4165U}, //SPI1.I2SPR.I2SDIV
+    {229U, RegisterDbKey::NoField}, //TIM1.CR2
+    {283U, 1642U}, //TIM11.CR1.CEN
+    {396U, 2183U}, //USART1.CR3.SCEN
+    {4U, 45U}, //ADC1.CR2.EXTEN
+    {396U, 2181U}, //USART1.CR3.DMAT
+    {528U, 3060U}, //GPIOH.AFRH.AFRH14
+    {616U, 4095U}, //I2S3ext.CR2.TXDMAEN
+    {537U, RegisterDbKey::NoField}, //GPIOE.AFRL
+    {461U, 2587U}, //DMA2.S7CR.CIRC
+    {117U, 713U}, //OTG_FS_HOST.FS_HCINT0.CHH
+    {144U, 915U}, //RCC.CR.HSEON
+    {524U, 2986U}, //GPIOH.ODR.ODR15
+    {70U, 464U}, //OTG_FS_DEVICE.DOEPINT3.STUP
+    {690U, 4388U}, //NVIC.IPR6.IPR_N3
+    {567U, 3701U}, //GPIOB.AFRL.AFRL1
+    {469U, 2657U}, //DMA1.LIFCR.CFEIF1
+    {277U, RegisterDbKey::NoField}, //TIM10.CCMR1_Input
+    {644U, 4239U}, //SPI3.SR.TXE
+    {125U, 793U}, //OTG_FS_HOST.FS_HCINTMSK0.DTERRM
+    {1U, 20U}, //ADC_Common.CCR.ADCPRE
+    {216U, 1295U}, //SDIO.STA.DTIMEOUT
+    {234U, RegisterDbKey::NoField}, //TIM1.CCMR1_Output
+    {38U, 261U}, //FLASH.SR.EOP
+    {536U, RegisterDbKey::NoField}, //GPIOE.LCKR
+    {34U, 234U}, //EXTI.PR.PR4
+    {275U, 1622U}, //TIM10.EGR.CC1G
+    {126U, 798U}, //OTG_FS_HOST.FS_HCINTMSK1.ACKM
+    {89U, 574U}, //OTG_FS_GLOBAL.FS_GINTMSK.CIDSCHGM
+    {213U, 1264U}, //SDIO.DLEN.DATALENGTH
+    {195U, RegisterDbKey::NoField}, //RTC.BKP12R
+    {415U, 2319U}, //DMA2.LISR.FEIF0
+    {703U, 4437U}, //NVIC.IPR19.IPR_N0
+    {652U, 4276U}, //SPI4.CR2.RXDMAEN
+    {575U, 3813U}, //GPIOA.BSRR.BR9
+    {321U, 1814U}, //TIM3.EGR.CC3G
+    {582U, RegisterDbKey::NoField}, //I2C3.OAR2
+    {570U, 3739U}, //GPIOA.OTYPER.OT3
+    {127U, 812U}, //OTG_FS_HOST.FS_HCINTMSK2.FRMORM
+    {27U, 102U}, //DBG.DBGMCU_APB1_FZ.DBG_TIM3_STOP
+    {335U, RegisterDbKey::NoField}, //TIM3.DMAR
+    {405U, 2245U}, //USART6.SR.TC
+    {443U, 2494U}, //DMA2.S4CR.ACK
+    {171U, 1158U}, //RTC.ALRMAR.MSK3
+    {112U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR3
+    {147U, RegisterDbKey::NoField}, //RCC.CIR
+    {228U, RegisterDbKey::NoField}, //TIM1.CR1
+    {318U, 1784U}, //TIM3.SMCR.ECE
+    {522U, 2963U}, //GPIOH.PUPDR.PUPDR6
+    {359U, 2003U}, //TIM5.DIER.CC4DE
+    {230U, 1379U}, //TIM1.SMCR.ECE
+    {432U, RegisterDbKey::NoField}, //DMA2.S2NDTR
+    {662U, 4330U}, //SPI5.SR.RXNE
+    {729U, 4565U}, //SCB.BFAR.BFAR
+    {298U, 1684U}, //TIM2.DIER.CC4DE
+    {289U, 1659U}, //TIM11.CCER.CC1E
+    {47U, 304U}, //OTG_FS_DEVICE.FS_DSTS.SUSPSTS
+    {606U, 4038U}, //I2S2ext.CR1.SSI
+    {692U, 4394U}, //NVIC.IPR8.IPR_N1
+    {733U, 4570U}, //SCB_ACTRL.ACTRL.DISDEFWBUF
+    {100U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_DIEPTXF2
+    {396U, 2182U}, //USART1.CR3.DMAR
+    {726U, 4549U}, //SCB.CFSR_UFSR_BFSR_MMFSR.PRECISERR
+    {441U, 2486U}, //DMA2.S3M1AR.M1A
+    {477U, 2720U}, //DMA1.S1CR.MINC
+    {597U, 3990U}, //I2C1.CR1.SMBUS
+    {223U, 1343U}, //SYSCFG.EXTICR1.EXTI0
+    {130U, 838U}, //OTG_FS_HOST.FS_HCINTMSK5.ACKM
+    {589U, 3944U}, //I2C2.CR2.FREQ
+    {383U, 2115U}, //TIM9.CCMR1_Output.OC2M
+    {564U, 3630U}, //GPIOB.ODR.ODR15
+    {32U, 191U}, //EXTI.FTSR.TR7
+    {299U, 1696U}, //TIM2.SR.CC3OF
+    {67U, 449U}, //OTG_FS_DEVICE.DOEPINT0.STUP
+    {401U, 2214U}, //USART2.CR1.IDLEIE
+    {623U, RegisterDbKey::NoField}, //I2S3ext.I2SPR
+    {119U, 736U}, //OTG_FS_HOST.FS_HCINT2.BBERR
+    {554U, 3476U}, //GPIOC.ODR.ODR8
+    {302U, 1726U}, //TIM2.CCMR1_Input.CC1S
+    {216U, 1277U}, //SDIO.STA.RXDAVL
+    {535U, 3165U}, //GPIOE.BSRR.BR13
+    {469U, 2654U}, //DMA1.LIFCR.CHTIF1
+    {62U, 413U}, //OTG_FS_DEVICE.DOEPCTL3.SD0PID_SEVNFRM
+    {338U, RegisterDbKey::NoField}, //TIM4.SMCR
+    {60U, 395U}, //OTG_FS_DEVICE.DOEPCTL1.USBAEP
+    {606U, 4039U}, //I2S2ext.CR1.LSBFIRST
+    {316U, 1773U}, //TIM3.CR1.ARPE
+    {562U, 3599U}, //GPIOB.PUPDR.PUPDR14
+    {683U, RegisterDbKey::NoField}, //NVIC.IABR2
+    {155U, 1035U}, //RCC.APB2ENR.SPI4EN
+    {254U, 1533U}, //TIM8.SR.COMIF
+    {361U, 2028U}, //TIM5.EGR.CC1G
+    {229U, 1374U}, //TIM1.CR2.MMS
+    {61U, 404U}, //OTG_FS_DEVICE.DOEPCTL2.SNPM
+    {552U, 3442U}, //GPIOC.PUPDR.PUPDR10
+    {501U, 2822U}, //DMA1.S5CR.CHSEL
+    {46U, 301U}, //OTG_FS_DEVICE.FS_DCTL.SGONAK
+    {76U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DTXFSTS0
+    {320U, 1811U}, //TIM3.SR.UIF
+    {569U, RegisterDbKey::NoField}, //GPIOA.MODER
+    {519U, 2906U}, //GPIOH.MODER.MODER15
+    {482U, 2735U}, //DMA1.S1FCR.FS
+    {216U, 1294U}, //SDIO.STA.TXUNDERR
+    {699U, 4422U}, //NVIC.IPR15.IPR_N1
+    {522U, 2965U}, //GPIOH.PUPDR.PUPDR4
+    {662U, RegisterDbKey::NoField}, //SPI5.SR
+    {216U, 1292U}, //SDIO.STA.CMDREND
+    {621U, 4109U}, //I2S3ext.TXCRCR.TxCRC
+    {561U, 3588U}, //GPIOB.OSPEEDR.OSPEEDR9
+    {523U, 2976U}, //GPIOH.IDR.IDR9
+    {252U, 1508U}, //TIM8.SMCR.ETF
+    {128U, 815U}, //OTG_FS_HOST.FS_HCINTMSK3.CHHM
+    {336U, 1885U}, //TIM4.CR1.CEN
+    {72U, 471U}, //OTG_FS_DEVICE.DOEPTSIZ0.XFRSIZ
+    {394U, 2158U}, //USART1.CR1.PS
+    {125U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK0
+    {216U, 1282U}, //SDIO.STA.TXFIFOF
+    {489U, 2775U}, //DMA1.S3CR.PSIZE
+    {437U, 2471U}, //DMA2.S3CR.MSIZE
+    {366U, 2071U}, //TIM5.CCER.CC1NP
+    {553U, 3457U}, //GPIOC.IDR.IDR11
+    {46U, 295U}, //OTG_FS_DEVICE.FS_DCTL.SDIS
+    {546U, 3366U}, //GPIOD.LCKR.LCK6
+    {469U, 2645U}, //DMA1.LIFCR.CTEIF3
+    {29U, 134U}, //EXTI.IMR.MR19
+    {704U, 4446U}, //FPU.FPCCR.BFRDY
+    {265U, 1597U}, //TIM8.CCR2.CCR2
+    {501U, 2833U}, //DMA1.S5CR.PINC
+    {418U, 2371U}, //DMA2.HIFCR.CHTIF5
+    {634U, 4182U}, //SPI2.CR2.ERRIE
+    {228U, 1359U}, //TIM1.CR1.ARPE
+    {549U, 3393U}, //GPIOC.MODER.MODER11
+    {533U, 3137U}, //GPIOE.IDR.IDR9
+    {203U, RegisterDbKey::NoField}, //SDIO.POWER
+    {534U, 3161U}, //GPIOE.ODR.ODR1
+    {56U, 336U}, //OTG_FS_DEVICE.DIEPCTL1.EPDIS
+    {3U, 32U}, //ADC1.CR1.AWDEN
+    {253U, 1516U}, //TIM8.DIER.CC2DE
+    {425U, 2421U}, //DMA2.S1CR.PFCTRL
+    {59U, 374U}, //OTG_FS_DEVICE.DOEPCTL0.EPENA
+    {532U, 3120U}, //GPIOE.PUPDR.PUPDR10
+    {59U, 382U}, //OTG_FS_DEVICE.DOEPCTL0.USBAEP
+    {34U, 248U}, //EXTI.PR.PR18
+    {114U, 689U}, //OTG_FS_HOST.FS_HCCHAR5.ODDFRM
+    {217U, 1305U}, //SDIO.ICR.CMDRENDC
+    {166U, 1116U}, //RTC.CR.BKP
+    {571U, 3750U}, //GPIOA.OSPEEDR.OSPEEDR8
+    {158U, 1056U}, //RCC.APB1LPENR.USART2LPEN
+    {558U, 3548U}, //GPIOC.AFRH.AFRH9
+    {92U, 588U}, //OTG_FS_GLOBAL.FS_GRXFSIZ.RXFD
+    {129U, 829U}, //OTG_FS_HOST.FS_HCINTMSK4.NYET
+    {112U, 665U}, //OTG_FS_HOST.FS_HCCHAR3.LSDEV
+    {287U, 1653U}, //TIM11.CCMR1_Output.CC1S
+    {524U, RegisterDbKey::NoField}, //GPIOH.ODR
+    {507U, 2854U}, //DMA1.S6CR.CT
+    {542U, 3276U}, //GPIOD.PUPDR.PUPDR15
+    {564U, 3640U}, //GPIOB.ODR.ODR5
+    {569U, 3714U}, //GPIOA.MODER.MODER12
+    {726U, 4556U}, //SCB.CFSR_UFSR_BFSR_MMFSR.INVSTATE
+    {606U, 4034U}, //I2S2ext.CR1.CRCNEXT
+    {214U, 1271U}, //SDIO.DCTRL.DTMODE
+    {89U, 563U}, //OTG_FS_GLOBAL.FS_GINTMSK.ENUMDNEM
+    {575U, 3814U}, //GPIOA.BSRR.BR8
+    {324U, 1843U}, //TIM3.CCMR2_Output.CC3S
+    {726U, 4545U}, //SCB.CFSR_UFSR_BFSR_MMFSR.MSTKERR
+    {382U, 2112U}, //TIM9.EGR.CC2G
+    {409U, 2275U}, //USART6.CR2.LBCL
+    {492U, 2788U}, //DMA1.S3M0AR.M0A
+    {499U, RegisterDbKey::NoField}, //DMA1.S4M1AR
+    {555U, 3513U}, //GPIOC.BSRR.BS3
+    {579U, 3879U}, //I2C3.CR1.NOSTRETCH
+    {426U, 2427U}, //DMA2.S1NDTR.NDT
+    {536U, 3209U}, //GPIOE.LCKR.LCK2
+    {642U, RegisterDbKey::NoField}, //SPI3.CR1
+    {402U, 2222U}, //USART2.CR2.CPOL
+    {258U, 1571U}, //TIM8.CCMR2_Output.OC3FE
+    {255U, 1542U}, //TIM8.EGR.CC4G
+    {22U, 91U}, //CRC.DR.DR
+    {457U, RegisterDbKey::NoField}, //DMA2.S6PAR
+    {468U, 2630U}, //DMA1.HISR.TEIF6
+    {0U, 7U}, //ADC_Common.CSR.STRT2
+    {385U, RegisterDbKey::NoField}, //TIM9.CCER
+    {536U, 3205U}, //GPIOE.LCKR.LCK6
+    {218U, 1317U}, //SDIO.MASK.TXFIFOEIE
+    {367U, RegisterDbKey::NoField}, //TIM5.CNT
+    {576U, 3848U}, //GPIOA.LCKR.LCK7
+    {320U, 1810U}, //TIM3.SR.CC1IF
+    {581U, RegisterDbKey::NoField}, //I2C3.OAR1
+    {531U, 3113U}, //GPIOE.OSPEEDR.OSPEEDR1
+    {311U, 1764U}, //TIM2.CCR3.CCR3_H
+    {383U, RegisterDbKey::NoField}, //TIM9.CCMR1_Output
+    {606U, 4042U}, //I2S2ext.CR1.MSTR
+    {272U, 1615U}, //TIM10.CR1.UDIS
+    {290U, RegisterDbKey::NoField}, //TIM11.CNT
+    {57U, 359U}, //OTG_FS_DEVICE.DIEPCTL2.USBAEP
+    {276U, 1627U}, //TIM10.CCMR1_Output.CC1S
+    {408U, 2266U}, //USART6.CR1.TE
+    {507U, 2861U}, //DMA1.S6CR.PINC
+    {519U, 2915U}, //GPIOH.MODER.MODER6
+    {118U, 721U}, //OTG_FS_HOST.FS_HCINT1.XFRC
+    {541U, 3270U}, //GPIOD.OSPEEDR.OSPEEDR5
+    {241U, RegisterDbKey::NoField}, //TIM1.ARR
+    {251U, 1495U}, //TIM8.CR2.OIS3
+    {301U, 1719U}, //TIM2.CCMR1_Output.OC1FE
+    {716U, 4494U}, //SCB.CPUID.PartNo
+    {160U, 1075U}, //RCC.BDCR.BDRST
+    {410U, 2285U}, //USART6.CR3.SCEN
+    {99U, 603U}, //OTG_FS_GLOBAL.FS_DIEPTXF1.INEPTXSA
+    {28U, RegisterDbKey::NoField}, //DBG.DBGMCU_APB2_FZ
+    {322U, 1819U}, //TIM3.CCMR1_Output.OC2M
+    {395U, 2175U}, //USART1.CR2.LBDL
+    {259U, 1573U}, //TIM8.CCMR2_Input.IC4F
+    {55U, 333U}, //OTG_FS_DEVICE.FS_DIEPCTL0.EPDIS
+    {702U, RegisterDbKey::NoField}, //NVIC.IPR18
+    {608U, 4052U}, //I2S2ext.SR.TIFRFE
+    {111U, 654U}, //OTG_FS_HOST.FS_HCCHAR2.EPDIR
+    {541U, 3264U}, //GPIOD.OSPEEDR.OSPEEDR11
+    {588U, 3927U}, //I2C2.CR1.PEC
+    {273U, 1617U}, //TIM10.DIER.CC1IE
+    {546U, 3371U}, //GPIOD.LCKR.LCK1
+    {707U, RegisterDbKey::NoField}, //MPU.MPU_TYPER
+    {540U, 3259U}, //GPIOD.OTYPER.OT0
+    {501U, 2828U}, //DMA1.S5CR.PL
+    {651U, 4259U}, //SPI4.CR1.CRCNEXT
+    {236U, 1440U}, //TIM1.CCMR2_Output.CC4S
+    {216U, 1290U}, //SDIO.STA.DATAEND
+    {442U, 2488U}, //DMA2.S3FCR.FS
+    {62U, 420U}, //OTG_FS_DEVICE.DOEPCTL3.EONUM_DPID
+    {460U, 2572U}, //DMA2.S6FCR.FS
+    {163U, 1096U}, //RCC.PLLI2SCFGR.PLLI2SRx
+    {468U, 2632U}, //DMA1.HISR.FEIF6
+    {296U, 1674U}, //TIM2.CR2.MMS
+    {553U, 3453U}, //GPIOC.IDR.IDR15
+    {442U, 2489U}, //DMA2.S3FCR.DMDIS
+    {116U, 704U}, //OTG_FS_HOST.FS_HCCHAR7.EPDIR
+    {639U, 4199U}, //SPI2.TXCRCR.TxCRC
+    {106U, 617U}, //OTG_FS_HOST.HAINT.HAINT
+    {340U, 1915U}, //TIM4.SR.CC2IF
+    {455U, 2554U}, //DMA2.S6CR.PINCOS
+    {577U, 3859U}, //GPIOA.AFRL.AFRL4
+    {689U, 4382U}, //NVIC.IPR5.IPR_N1
+    {439U, 2484U}, //DMA2.S3PAR.PA
+    {206U, 1254U}, //SDIO.CMD.WAITPEND
+    {123U, 769U}, //OTG_FS_HOST.FS_HCINT6.NAK
+    {573U, 3787U}, //GPIOA.IDR.IDR3
+    {339U, 1902U}, //TIM4.DIER.TIE
+    {559U, 3560U}, //GPIOB.MODER.MODER5
+    {339U, 1903U}, //TIM4.DIER.CC4IE
+    {130U, 841U}, //OTG_FS_HOST.FS_HCINTMSK5.BBERRM
+    {113U, 675U}, //OTG_FS_HOST.FS_HCCHAR4.LSDEV
+    {576U, 3844U}, //GPIOA.LCKR.LCK11
+    {32U, 187U}, //EXTI.FTSR.TR3
+    {466U, 2602U}, //DMA2.S7FCR.FTH
+    {59U, 381U}, //OTG_FS_DEVICE.DOEPCTL0.NAKSTS
+    {498U, RegisterDbKey::NoField}, //DMA1.S4M0AR
+    {307U, 1757U}, //TIM2.PSC.PSC
+    {34U, 230U}, //EXTI.PR.PR0
+    {529U, 3082U}, //GPIOE.MODER.MODER0
+    {471U, 2695U}, //DMA1.S0CR.DIR
+    {418U, 2360U}, //DMA2.HIFCR.CTCIF7
+    {305U, RegisterDbKey::NoField}, //TIM2.CCER
+    {87U, 527U}, //OTG_FS_GLOBAL.FS_GRSTCTL.AHBIDL
+    {425U, 2409U}, //DMA2.S1CR.PBURST
+    {561U, 3592U}, //GPIOB.OSPEEDR.OSPEEDR5
+    {602U, 4015U}, //I2C1.SR1.ADD10
+    {162U, RegisterDbKey::NoField}, //RCC.SSCGR
+    {139U, 884U}, //OTG_FS_HOST.FS_HCTSIZ6.DPID
+    {354U, 1982U}, //TIM4.DCR.DBA
+    {286U, 1648U}, //TIM11.EGR.CC1G
+    {545U, 3326U}, //GPIOD.BSRR.BR13
+    {471U, 2690U}, //DMA1.S0CR.MSIZE
+    {531U, 3106U}, //GPIOE.OSPEEDR.OSPEEDR8
+    {249U, 1478U}, //TIM1.BDTR.AOE
+    {522U, 2961U}, //GPIOH.PUPDR.PUPDR8
+    {339U, 1900U}, //TIM4.DIER.CC1DE
+    {5U, RegisterDbKey::NoField}, //ADC1.SMPR1
+    {389U, 2138U}, //TIM9.CCR1.CCR1
+    {574U, 3800U}, //GPIOA.ODR.ODR6
+    {128U, 816U}, //OTG_FS_HOST.FS_HCINTMSK3.STALLM
+    {644U, 4234U}, //SPI3.SR.OVR
+    {615U, 4081U}, //I2S3ext.CR1.RXONLY
+    {115U, 700U}, //OTG_FS_HOST.FS_HCCHAR6.CHDIS
+    {716U, 4497U}, //SCB.CPUID.Implementer
+    {166U, 1120U}, //RTC.CR.WUTIE
+    {550U, 3408U}, //GPIOC.OTYPER.OT12
+    {618U, 4106U}, //I2S3ext.DR.DR
+    {171U, 1154U}, //RTC.ALRMAR.MSK4
+    {190U, RegisterDbKey::NoField}, //RTC.BKP7R
+    {166U, 1124U}, //RTC.CR.WUTE
+    {121U, 753U}, //OTG_FS_HOST.FS_HCINT4.TXERR
+    {495U, RegisterDbKey::NoField}, //DMA1.S4CR
+    {570U, 3728U}, //GPIOA.OTYPER.OT14
+    {507U, 2851U}, //DMA1.S6CR.MBURST
+    {253U, 1513U}, //TIM8.DIER.COMDE
+    {625U, 4135U}, //SPI1.CR2.TXEIE
+    {233U, 1416U}, //TIM1.EGR.CC3G
+    {555U, 3485U}, //GPIOC.BSRR.BR15
+    {123U, 772U}, //OTG_FS_HOST.FS_HCINT6.BBERR
+    {555U, 3486U}, //GPIOC.BSRR.BR14
+    {153U, RegisterDbKey::NoField}, //RCC.AHB2ENR
+    {68U, 453U}, //OTG_FS_DEVICE.DOEPINT1.OTEPDIS
+    {528U, 3061U}, //GPIOH.AFRH.AFRH13
+    {109U, 635U}, //OTG_FS_HOST.FS_HCCHAR0.LSDEV
+    {113U, 680U}, //OTG_FS_HOST.FS_HCCHAR4.CHDIS
+    {321U, 1815U}, //TIM3.EGR.CC2G
+    {543U, 3302U}, //GPIOD.IDR.IDR5
+    {615U, 4082U}, //I2S3ext.CR1.SSM
+    {146U, 946U}, //RCC.CFGR.MCO1
+    {30U, 144U}, //EXTI.EMR.MR6
+    {62U, 412U}, //OTG_FS_DEVICE.DOEPCTL3.SODDFRM
+    {133U, 865U}, //OTG_FS_HOST.FS_HCTSIZ0.PKTCNT
+    {399U, 2201U}, //USART2.DR.DR
+    {337U, 1888U}, //TIM4.CR2.CCDS
+    {235U, 1433U}, //TIM1.CCMR1_Input.IC1F
+    {467U, 2606U}, //DMA1.LISR.DMEIF3
+    {159U, 1072U}, //RCC.APB2LPENR.TIM9LPEN
+    {418U, 2361U}, //DMA2.HIFCR.CHTIF7
+    {403U, 2233U}, //USART2.CR3.DMAR
+    {624U, 4123U}, //SPI1.CR1.CRCEN
+    {90U, 579U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Device.BCNT
+    {122U, 765U}, //OTG_FS_HOST.FS_HCINT5.DTERR
+    {271U, 1609U}, //TIM8.BDTR.OSSI
+    {177U, 1197U}, //RTC.TSDR.DU
+    {134U, 868U}, //OTG_FS_HOST.FS_HCTSIZ1.PKTCNT
+    {3U, 39U}, //ADC1.CR1.SCAN
+    {603U, RegisterDbKey::NoField}, //I2C1.SR2
+    {167U, 1142U}, //RTC.ISR.ALRBF
+    {649U, 4251U}, //SPI3.I2SCFGR.DATLEN
+    {434U, 2457U}, //DMA2.S2M0AR.M0A
+    {6U, 57U}, //ADC1.SMPR2.SMPx_x
+    {461U, 2589U}, //DMA2.S7CR.PFCTRL
+    {334U, 1876U}, //TIM3.DCR.DBA
+    {658U, 4294U}, //SPI4.I2SCFGR.I2SSTD
+    {372U, 2084U}, //TIM5.CCR3.CCR3_L
+    {552U, 3447U}, //GPIOC.PUPDR.PUPDR5
+    {435U, RegisterDbKey::NoField}, //DMA2.S2M1AR
+    {621U, RegisterDbKey::NoField}, //I2S3ext.TXCRCR
+    {89U, 559U}, //OTG_FS_GLOBAL.FS_GINTMSK.GONAKEFFM
+    {296U, 1673U}, //TIM2.CR2.TI1S
+    {431U, 2453U}, //DMA2.S2CR.DMEIE
+    {437U, 2476U}, //DMA2.S3CR.DIR
+    {96U, 596U}, //OTG_FS_GLOBAL.FS_GCCFG.PWRDWN
+    {565U, 3662U}, //GPIOB.BSRR.BS15
+    {359U, 2008U}, //TIM5.DIER.TIE
+    {158U, 1059U}, //RCC.APB1LPENR.WWDGLPEN
+    {89U, 557U}, //OTG_FS_GLOBAL.FS_GINTMSK.NPTXFEM
+    {59U, 376U}, //OTG_FS_DEVICE.DOEPCTL0.SNAK
+    {544U, 3318U}, //GPIOD.ODR.ODR5
+    {344U, 1942U}, //TIM4.CCMR2_Output.OC4PE
+    {161U, 1087U}, //RCC.CSR.PADRSTF
+    {21U, 90U}, //ADC1.DR.DATA
+    {565U, 3674U}, //GPIOB.BSRR.BS3
+    {354U, RegisterDbKey::NoField}, //TIM4.DCR
+    {31U, 161U}, //EXTI.RTSR.TR0
+    {15U, 78U}, //ADC1.SQR3.SQ3
+    {555U, 3494U}, //GPIOC.BSRR.BR6
+    {518U, 2902U}, //DMA1.S7FCR.FEIE
+    {122U, 758U}, //OTG_FS_HOST.FS_HCINT5.CHH
+    {238U, 1455U}, //TIM1.CCER.CC3NE
+    {44U, 289U}, //IWDG.SR.PVU
+    {554U, 3484U}, //GPIOC.ODR.ODR0
+    {697U, 4415U}, //NVIC.IPR13.IPR_N2
+    {521U, 2947U}, //GPIOH.OSPEEDR.OSPEEDR6
+    {260U, 1581U}, //TIM8.CCER.CC3NP
+    {608U, 4054U}, //I2S2ext.SR.OVR
+    {555U, 3508U}, //GPIOC.BSRR.BS8
+    {521U, 2951U}, //GPIOH.OSPEEDR.OSPEEDR2
+    {89U, 555U}, //OTG_FS_GLOBAL.FS_GINTMSK.SOFM
+    {584U, RegisterDbKey::NoField}, //I2C3.SR1
+    {132U, 854U}, //OTG_FS_HOST.FS_HCINTMSK7.XFRCM
+    {3U, 34U}, //ADC1.CR1.DISCNUM
+    {545U, 3341U}, //GPIOD.BSRR.BS14
+    {593U, 3965U}, //I2C2.SR1.SB
+    {92U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GRXFSIZ
+    {556U, 3526U}, //GPIOC.LCKR.LCK7
+    {726U, 4547U}, //SCB.CFSR_UFSR_BFSR_MMFSR.MMARVALID
+    {471U, 2700U}, //DMA1.S0CR.DMEIE
+    {507U, 2859U}, //DMA1.S6CR.PSIZE
+    {346U, 1956U}, //TIM4.CCER.CC4NP
+    {61U, 401U}, //OTG_FS_DEVICE.DOEPCTL2.SNAK
+    {364U, 2051U}, //TIM5.CCMR2_Output.OC3CE
+    {401U, 2218U}, //USART2.CR1.SBK
+    {690U, 4386U}, //NVIC.IPR6.IPR_N1
+    {599U, 3999U}, //I2C1.OAR1.ADD10
+    {580U, 3889U}, //I2C3.CR2.ITEVTEN
+    {700U, 4427U}, //NVIC.IPR16.IPR_N2
+    {322U, 1822U}, //TIM3.CCMR1_Output.CC2S
+    {39U, 276U}, //FLASH.CR.LOCK
+    {105U, 614U}, //OTG_FS_HOST.FS_HPTXSTS.PTXFSAVL
+    {349U, 1972U}, //TIM4.ARR.ARR_L
+    {438U, RegisterDbKey::NoField}, //DMA2.S3NDTR
+    {126U, 795U}, //OTG_FS_HOST.FS_HCINTMSK1.CHHM
+    {31U, 170U}, //EXTI.RTSR.TR9
+    {176U, 1187U}, //RTC.TSTR.HT
+    {33U, 212U}, //EXTI.SWIER.SWIER5
+    {545U, 3351U}, //GPIOD.BSRR.BS4
+    {279U, 1634U}, //TIM10.CNT.CNT
+    {528U, 3062U}, //GPIOH.AFRH.AFRH12
+    {29U, 125U}, //EXTI.IMR.MR10
+    {416U, 2337U}, //DMA2.HISR.TEIF4
+    {468U, 2626U}, //DMA1.HISR.DMEIF7
+    {233U, 1412U}, //TIM1.EGR.BG
+    {544U, RegisterDbKey::NoField}, //GPIOD.ODR
+    {566U, 3688U}, //GPIOB.LCKR.LCK6
+    {549U, 3392U}, //GPIOC.MODER.MODER12
+    {556U, 3524U}, //GPIOC.LCKR.LCK9
+    {717U, 4503U}, //SCB.ICSR.PENDSTSET
+    {62U, 421U}, //OTG_FS_DEVICE.DOEPCTL3.USBAEP
+    {544U, 3313U}, //GPIOD.ODR.ODR10
+    {513U, 2892U}, //DMA1.S7CR.PFCTRL
+    {57U, 360U}, //OTG_FS_DEVICE.DIEPCTL2.MPSIZ
+    {143U, 907U}, //PWR.CSR.VOSRDY
+    {597U, RegisterDbKey::NoField}, //I2C1.CR1
+    {562U, 3610U}, //GPIOB.PUPDR.PUPDR3
+    {572U, 3761U}, //GPIOA.PUPDR.PUPDR13
+    {613U, RegisterDbKey::NoField}, //I2S2ext.I2SCFGR
+    {483U, 2746U}, //DMA1.S2CR.MSIZE
+    {29U, 120U}, //EXTI.IMR.MR5
+    {257U, RegisterDbKey::NoField}, //TIM8.CCMR1_Input
+    {158U, RegisterDbKey::NoField}, //RCC.APB1LPENR
+    {237U, 1449U}, //TIM1.CCMR2_Input.IC3F
+    {360U, 2020U}, //TIM5.SR.CC3IF
+    {545U, 3329U}, //GPIOD.BSRR.BR10
+    {251U, 1494U}, //TIM8.CR2.OIS3N
+    {357U, RegisterDbKey::NoField}, //TIM5.CR2
+    {553U, 3460U}, //GPIOC.IDR.IDR8
+    {706U, 4458U}, //FPU.FPSCR.FZ
+    {686U, RegisterDbKey::NoField}, //NVIC.IPR2
+    {571U, 3746U}, //GPIOA.OSPEEDR.OSPEEDR12
+    {377U, 2092U}, //TIM9.CR1.ARPE
+    {27U, RegisterDbKey::NoField}, //DBG.DBGMCU_APB1_FZ
+    {196U, 1233U}, //RTC.BKP13R.BKP
+    {189U, 1226U}, //RTC.BKP6R.BKP
+    {261U, 1593U}, //TIM8.CNT.CNT
+    {163U, 1097U}, //RCC.PLLI2SCFGR.PLLI2SNx
+    {57U, 355U}, //OTG_FS_DEVICE.DIEPCTL2.Stall
+    {154U, 1024U}, //RCC.APB1ENR.WWDGEN
+    {685U, 4365U}, //NVIC.IPR1.IPR_N0
+    {40U, 280U}, //FLASH.OPTCR.WDG_SW
+    {369U, 2078U}, //TIM5.ARR.ARR_L
+    {406U, RegisterDbKey::NoField}, //USART6.DR
+    {630U, RegisterDbKey::NoField}, //SPI1.TXCRCR
+    {572U, 3773U}, //GPIOA.PUPDR.PUPDR1
+    {410U, 2284U}, //USART6.CR3.DMAR
+    {300U, 1710U}, //TIM2.EGR.UG
+    {249U, 1480U}, //TIM1.BDTR.BKE
+    {649U, 4252U}, //SPI3.I2SCFGR.CHLEN
+    {532U, 3124U}, //GPIOE.PUPDR.PUPDR6
+    {320U, RegisterDbKey::NoField}, //TIM3.SR
+    {39U, 269U}, //FLASH.CR.SER
+    {624U, 4134U}, //SPI1.CR1.CPHA
+    {398U, 2192U}, //USART2.SR.LBD
+    {626U, 4148U}, //SPI1.SR.CHSIDE
+    {608U, 4053U}, //I2S2ext.SR.BSY
+    {483U, 2740U}, //DMA1.S2CR.PBURST
+    {151U, 999U}, //RCC.APB2RSTR.TIM9RST
+    {543U, 3296U}, //GPIOD.IDR.IDR11
+    {108U, 620U}, //OTG_FS_HOST.FS_HPRT.PCDET
+    {62U, 416U}, //OTG_FS_DEVICE.DOEPCTL3.Stall
+    {519U, 2913U}, //GPIOH.MODER.MODER8
+    {658U, 4295U}, //SPI4.I2SCFGR.CKPOL
+    {256U, RegisterDbKey::NoField}, //TIM8.CCMR1_Output
+    {401U, 2208U}, //USART2.CR1.PCE
+    {312U, RegisterDbKey::NoField}, //TIM2.CCR4
+    {635U, RegisterDbKey::NoField}, //SPI2.SR
+    {33U, 227U}, //EXTI.SWIER.SWIER20
+    {537U, 3216U}, //GPIOE.AFRL.AFRL3
+    {470U, 2679U}, //DMA1.HIFCR.CHTIF4
+    {529U, 3068U}, //GPIOE.MODER.MODER14
+    {543U, RegisterDbKey::NoField}, //GPIOD.IDR
+    {216U, 1276U}, //SDIO.STA.SDIOIT
+    {660U, 4301U}, //SPI5.CR1.BIDIMODE
+    {454U, 2543U}, //DMA2.S5FCR.FEIE
+    {526U, 3040U}, //GPIOH.LCKR.LCK10
+    {110U, 643U}, //OTG_FS_HOST.FS_HCCHAR1.EPNUM
+    {34U, 246U}, //EXTI.PR.PR16
+    {508U, 2870U}, //DMA1.S6NDTR.NDT
+    {166U, 1123U}, //RTC.CR.TSE
+    {536U, 3204U}, //GPIOE.LCKR.LCK7
+    {303U, 1731U}, //TIM2.CCMR2_Output.CC4S
+    {588U, 3933U}, //I2C2.CR1.ENGC
+    {82U, 492U}, //OTG_FS_DEVICE.DOEPTSIZ3.PKTCNT
+    {99U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_DIEPTXF1
+    {61U, 398U}, //OTG_FS_DEVICE.DOEPCTL2.EPDIS
+    {86U, 519U}, //OTG_FS_GLOBAL.FS_GUSBCFG.FDMOD
+    {528U, 3063U}, //GPIOH.AFRH.AFRH11
+    {387U, 2136U}, //TIM9.PSC.PSC
+    {154U, 1023U}, //RCC.APB1ENR.SPI2EN
+    {569U, 3712U}, //GPIOA.MODER.MODER14
+    {133U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ0
+    {31U, 174U}, //EXTI.RTSR.TR13
+    {65U, 438U}, //OTG_FS_DEVICE.DIEPINT2.TOC
+    {719U, 4510U}, //SCB.AIRCR.SYSRESETREQ
+    {51U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DAINTMSK
+    {576U, 3845U}, //GPIOA.LCKR.LCK10
+    {507U, 2856U}, //DMA1.S6CR.PL
+    {418U, 2365U}, //DMA2.HIFCR.CTCIF6
+    {477U, 2718U}, //DMA1.S1CR.MSIZE
+    {576U, 3854U}, //GPIOA.LCKR.LCK1
+    {29U, 137U}, //EXTI.IMR.MR22
+    {120U, 739U}, //OTG_FS_HOST.FS_HCINT3.XFRC
+    {523U, 2973U}, //GPIOH.IDR.IDR12
+    {405U, 2248U}, //USART6.SR.ORE
+    {38U, 265U}, //FLASH.SR.PGPERR
+    {579U, 3875U}, //I2C3.CR1.POS
+    {570U, 3731U}, //GPIOA.OTYPER.OT11
+    {85U, 511U}, //OTG_FS_GLOBAL.FS_GAHBCFG.TXFELVL
+    {561U, 3584U}, //GPIOB.OSPEEDR.OSPEEDR13
+    {662U, 4328U}, //SPI5.SR.CHSIDE
+    {317U, 1782U}, //TIM3.CR2.CCDS
+    {538U, 3221U}, //GPIOE.AFRH.AFRH14
+    {145U, 924U}, //RCC.PLLCFGR.PLLSRC
+    {553U, 3461U}, //GPIOC.IDR.IDR7
+    {470U, 2671U}, //DMA1.HIFCR.CDMEIF6
+    {289U, 1658U}, //TIM11.CCER.CC1P
+    {131U, 851U}, //OTG_FS_HOST.FS_HCINTMSK6.BBERRM
+    {37U, RegisterDbKey::NoField}, //FLASH.OPTKEYR
+    {415U, 2310U}, //DMA2.LISR.TCIF1
+    {468U, 2642U}, //DMA1.HISR.FEIF4
+    {297U, 1676U}, //TIM2.SMCR.ETP
+    {231U, 1393U}, //TIM1.DIER.TIE
+    {545U, 3352U}, //GPIOD.BSRR.BS3
+    {322U, 1820U}, //TIM3.CCMR1_Output.OC2PE
+    {349U, RegisterDbKey::NoField}, //TIM4.ARR
+    {0U, 0U}, //ADC_Common.CSR.OVR3
+    {653U, 4279U}, //SPI4.SR.OVR
+    {393U, 2152U}, //USART1.BRR.DIV_Fraction
+    {564U, 3641U}, //GPIOB.ODR.ODR4
+    {63U, 425U}, //OTG_FS_DEVICE.DIEPINT0.ITTXFE
+    {615U, 4089U}, //I2S3ext.CR1.CPHA
+    {545U, 3347U}, //GPIOD.BSRR.BS8
+    {452U, RegisterDbKey::NoField}, //DMA2.S5M0AR
+    {467U, 2609U}, //DMA1.LISR.HTIF2
+    {656U, 4288U}, //SPI4.RXCRCR.RxCRC
+    {477U, 2721U}, //DMA1.S1CR.PINC
+    {3U, 43U}, //ADC1.CR1.AWDCH
+    {166U, 1128U}, //RTC.CR.FMT
+    {615U, 4086U}, //I2S3ext.CR1.BR
+    {396U, 2186U}, //USART1.CR3.IRLP
+    {59U, 379U}, //OTG_FS_DEVICE.DOEPCTL0.SNPM
+    {575U, 3815U}, //GPIOA.BSRR.BR7
+    {533U, 3135U}, //GPIOE.IDR.IDR11
+    {11U, RegisterDbKey::NoField}, //ADC1.HTR
+    {541U, 3268U}, //GPIOD.OSPEEDR.OSPEEDR7
+    {547U, 3375U}, //GPIOD.AFRL.AFRL5
+    {566U, 3686U}, //GPIOB.LCKR.LCK8
+    {147U, 966U}, //RCC.CIR.LSERDYIE
+    {524U, 2989U}, //GPIOH.ODR.ODR12
+    {726U, 4543U}, //SCB.CFSR_UFSR_BFSR_MMFSR.IACCVIOL
+    {123U, 774U}, //OTG_FS_HOST.FS_HCINT6.DTERR
+    {115U, 701U}, //OTG_FS_HOST.FS_HCCHAR6.CHENA
+    {347U, RegisterDbKey::NoField}, //TIM4.CNT
+    {218U, 1328U}, //SDIO.MASK.CMDSENTIE
+    {291U, 1661U}, //TIM11.PSC.PSC
+    {489U, 2784U}, //DMA1.S3CR.DMEIE
+    {546U, 3359U}, //GPIOD.LCKR.LCK13
+    {255U, 1541U}, //TIM8.EGR.COMG
+    {501U, 2835U}, //DMA1.S5CR.DIR
+    {525U, 3022U}, //GPIOH.BSRR.BS11
+    {55U, 329U}, //OTG_FS_DEVICE.FS_DIEPCTL0.STALL
+    {195U, 1232U}, //RTC.BKP12R.BKP
+    {18U, RegisterDbKey::NoField}, //ADC1.JDR2
+    {61U, 397U}, //OTG_FS_DEVICE.DOEPCTL2.EPENA
+    {565U, 3654U}, //GPIOB.BSRR.BR7
+    {660U, 4314U}, //SPI5.CR1.CPHA
+    {13U, 64U}, //ADC1.SQR1.L
+    {563U, 3629U}, //GPIOB.IDR.IDR0
+    {522U, 2966U}, //GPIOH.PUPDR.PUPDR3
+    {218U, 1326U}, //SDIO.MASK.STBITERRIE
+    {668U, RegisterDbKey::NoField}, //SPI5.I2SPR
+    {299U, 1704U}, //TIM2.SR.UIF
+    {22U, RegisterDbKey::NoField}, //CRC.DR
+    {333U, 1873U}, //TIM3.CCR4.CCR4_H
+    {558U, 3542U}, //GPIOC.AFRH.AFRH15
+    {470U, 2682U}, //DMA1.HIFCR.CFEIF4
+    {152U, 1012U}, //RCC.AHB1ENR.GPIODEN
+    {543U, 3295U}, //GPIOD.IDR.IDR12
+    {49U, 315U}, //OTG_FS_DEVICE.FS_DOEPMSK.EPDM
+    {172U, 1180U}, //RTC.ALRMBR.ST
+    {111U, 659U}, //OTG_FS_HOST.FS_HCCHAR2.ODDFRM
+    {126U, 799U}, //OTG_FS_HOST.FS_HCINTMSK1.NYET
+    {238U, 1458U}, //TIM1.CCER.CC2NP
+    {56U, 345U}, //OTG_FS_DEVICE.DIEPCTL1.EONUM_DPID
+    {526U, 3036U}, //GPIOH.LCKR.LCK14
+    {62U, 417U}, //OTG_FS_DEVICE.DOEPCTL3.SNPM
+    {415U, 2314U}, //DMA2.LISR.FEIF1
+    {368U, RegisterDbKey::NoField}, //TIM5.PSC
+    {602U, 4016U}, //I2C1.SR1.BTF
+    {437U, 2468U}, //DMA2.S3CR.DBM
+    {88U, 535U}, //OTG_FS_GLOBAL.FS_GINTSTS.GOUTNAKEFF
+    {624U, 4122U}, //SPI1.CR1.BIDIOE
+    {246U, 1474U}, //TIM1.DCR.DBA
+    {554U, 3482U}, //GPIOC.ODR.ODR2
+    {562U, 3601U}, //GPIOB.PUPDR.PUPDR12
+    {254U, 1537U}, //TIM8.SR.CC1IF
+    {550U, 3409U}, //GPIOC.OTYPER.OT11
+    {222U, 1339U}, //SYSCFG.PMC.ADC1DC2
+    {555U, 3511U}, //GPIOC.BSRR.BS5
+    {703U, 4439U}, //NVIC.IPR19.IPR_N2
+    {145U, 933U}, //RCC.PLLCFGR.PLLN2
+    {489U, 2772U}, //DMA1.S3CR.PL
+    {362U, RegisterDbKey::NoField}, //TIM5.CCMR1_Output
+    {297U, 1681U}, //TIM2.SMCR.TS
+    {469U, RegisterDbKey::NoField}, //DMA1.LIFCR
+    {75U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPTSIZ3
+    {223U, 1342U}, //SYSCFG.EXTICR1.EXTI1
+    {529U, 3077U}, //GPIOE.MODER.MODER5
+    {567U, 3695U}, //GPIOB.AFRL.AFRL7
+    {523U, RegisterDbKey::NoField}, //GPIOH.IDR
+    {339U, 1907U}, //TIM4.DIER.UIE
+    {224U, 1345U}, //SYSCFG.EXTICR2.EXTI6
+    {336U, 1879U}, //TIM4.CR1.ARPE
+    {547U, 3378U}, //GPIOD.AFRL.AFRL2
+    {588U, 3936U}, //I2C2.CR1.SMBTYPE
+    {114U, 687U}, //OTG_FS_HOST.FS_HCCHAR5.MCNT
+    {565U, 3647U}, //GPIOB.BSRR.BR14
+    {253U, 1523U}, //TIM8.DIER.CC3IE
+    {597U, 3983U}, //I2C1.CR1.STOP
+    {420U, RegisterDbKey::NoField}, //DMA2.S0NDTR
+    {319U, 1798U}, //TIM3.DIER.CC3IE
+    {161U, RegisterDbKey::NoField}, //RCC.CSR
+    {418U, 2363U}, //DMA2.HIFCR.CDMEIF7
+    {345U, 1954U}, //TIM4.CCMR2_Input.IC3PSC
+    {4U, 46U}, //ADC1.CR2.EXTSEL
+    {144U, 909U}, //RCC.CR.PLLI2SON
+    {120U, 745U}, //OTG_FS_HOST.FS_HCINT3.BBERR
+    {338U, 1895U}, //TIM4.SMCR.SMS
+    {89U, 567U}, //OTG_FS_GLOBAL.FS_GINTMSK.IEPINT
+    {571U, 3756U}, //GPIOA.OSPEEDR.OSPEEDR2
+    {562U, 3602U}, //GPIOB.PUPDR.PUPDR11
+    {229U, 1369U}, //TIM1.CR2.OIS2N
+    {170U, RegisterDbKey::NoField}, //RTC.CALIBR
+    {39U, 271U}, //FLASH.CR.SNB
+    {331U, 1870U}, //TIM3.CCR2.CCR2_L
+    {240U, 1467U}, //TIM1.PSC.PSC
+    {49U, 314U}, //OTG_FS_DEVICE.FS_DOEPMSK.XFRCM
+    {575U, 3810U}, //GPIOA.BSRR.BR12
+    {431U, 2440U}, //DMA2.S2CR.DBM
+    {416U, 2339U}, //DMA2.HISR.FEIF4
+    {366U, 2069U}, //TIM5.CCER.CC2P
+    {294U, 1664U}, //TIM11.OR.RMP
+    {562U, 3612U}, //GPIOB.PUPDR.PUPDR1
+    {455U, 2553U}, //DMA2.S6CR.PL
+    {429U, RegisterDbKey::NoField}, //DMA2.S1M1AR
+    {111U, 657U}, //OTG_FS_HOST.FS_HCCHAR2.MCNT
+    {214U, 1268U}, //SDIO.DCTRL.RWSTART
+    {540U, 3249U}, //GPIOD.OTYPER.OT10
+    {398U, 2191U}, //USART2.SR.CTS
+    {360U, 2016U}, //TIM5.SR.CC2OF
+    {329U, 1866U}, //TIM3.ARR.ARR_L
+    {624U, 4127U}, //SPI1.CR1.SSM
+    {57U, 356U}, //OTG_FS_DEVICE.DIEPCTL2.EPTYP
+    {30U, RegisterDbKey::NoField}, //EXTI.EMR
+    {464U, RegisterDbKey::NoField}, //DMA2.S7M0AR
+    {633U, 4166U}, //SPI2.CR1.BIDIMODE
+    {533U, 3146U}, //GPIOE.IDR.IDR0
+    {699U, 4424U}, //NVIC.IPR15.IPR_N3
+    {576U, 3847U}, //GPIOA.LCKR.LCK8
+    {579U, 3882U}, //I2C3.CR1.ENARP
+    {542U, 3287U}, //GPIOD.PUPDR.PUPDR4
+    {530U, 3097U}, //GPIOE.OTYPER.OT1
+    {443U, 2510U}, //DMA2.S4CR.EN
+    {534U, 3155U}, //GPIOE.ODR.ODR7
+    {431U, RegisterDbKey::NoField}, //DMA2.S2CR
+    {199U, RegisterDbKey::NoField}, //RTC.BKP16R
+    {2U, 24U}, //ADC1.SR.OVR
+    {673U, RegisterDbKey::NoField}, //NVIC.ICER1
+    {140U, 885U}, //OTG_FS_HOST.FS_HCTSIZ7.XFRSIZ
+    {574U, 3794U}, //GPIOA.ODR.ODR12
+    {32U, 201U}, //EXTI.FTSR.TR17
+    {46U, 302U}, //OTG_FS_DEVICE.FS_DCTL.CGONAK
+    {290U, 1660U}, //TIM11.CNT.CNT
+    {216U, 1298U}, //SDIO.STA.CCRCFAIL
+    {667U, 4339U}, //SPI5.I2SCFGR.I2SSTD
+    {533U, 3141U}, //GPIOE.IDR.IDR5
+    {206U, 1256U}, //SDIO.CMD.WAITRESP
+    {417U, 2354U}, //DMA2.LIFCR.CFEIF1
+    {232U, 1407U}, //TIM1.SR.CC4IF
+    {565U, 3646U}, //GPIOB.BSRR.BR15
+    {217U, 1299U}, //SDIO.ICR.CEATAENDC
+    {607U, 4048U}, //I2S2ext.CR2.FRF
+    {348U, RegisterDbKey::NoField}, //TIM4.PSC
+    {301U, 1716U}, //TIM2.CCMR1_Output.OC1CE
+    {252U, 1510U}, //TIM8.SMCR.TS
+    {401U, 2204U}, //USART2.CR1.OVER8
+    {50U, 319U}, //OTG_FS_DEVICE.FS_DAINT.OEPINT
+    {455U, 2559U}, //DMA2.S6CR.CIRC
+    {231U, 1394U}, //TIM1.DIER.COMIE
+    {359U, 2004U}, //TIM5.DIER.CC3DE
+    {572U, 3764U}, //GPIOA.PUPDR.PUPDR10
+    {660U, 4305U}, //SPI5.CR1.DFF
+    {394U, 2156U}, //USART1.CR1.WAKE
+    {410U, RegisterDbKey::NoField}, //USART6.CR3
+    {454U, RegisterDbKey::NoField}, //DMA2.S5FCR
+    {172U, 1172U}, //RTC.ALRMBR.MSK3
+    {684U, 4362U}, //NVIC.IPR0.IPR_N1
+    {540U, 3248U}, //GPIOD.OTYPER.OT11
+    {584U, 3902U}, //I2C3.SR1.OVR
+    {553U, 3455U}, //GPIOC.IDR.IDR13
+    {709U, 4471U}, //MPU.MPU_RNR.REGION
+    {271U, 1605U}, //TIM8.BDTR.AOE
+    {577U, 3862U}, //GPIOA.AFRL.AFRL1
+    {321U, 1817U}, //TIM3.EGR.UG
+    {338U, 1893U}, //TIM4.SMCR.MSM
+    {519U, 2921U}, //GPIOH.MODER.MODER0
+    {408U, 2258U}, //USART6.CR1.WAKE
+    {145U, 941U}, //RCC.PLLCFGR.PLLM0
+    {336U, 1882U}, //TIM4.CR1.OPM
+    {591U, 3950U}, //I2C2.OAR2.ENDUAL
+    {325U, RegisterDbKey::NoField}, //TIM3.CCMR2_Input
+    {622U, 4111U}, //I2S3ext.I2SCFGR.I2SE
+    {642U, 4216U}, //SPI3.CR1.RXONLY
+    {461U, 2579U}, //DMA2.S7CR.CT
+    {362U, 2036U}, //TIM5.CCMR1_Output.OC1M
+    {43U, 287U}, //IWDG.RLR.RL
+    {461U, 2585U}, //DMA2.S7CR.MINC
+    {128U, 821U}, //OTG_FS_HOST.FS_HCINTMSK3.BBERRM
+    {617U, 4104U}, //I2S3ext.SR.TXE
+    {215U, 1274U}, //SDIO.DCOUNT.DATACOUNT
+    {494U, 2792U}, //DMA1.S3FCR.DMDIS
+    {424U, 2405U}, //DMA2.S0FCR.DMDIS
+    {539U, 3240U}, //GPIOD.MODER.MODER3
+    {304U, 1740U}, //TIM2.CCMR2_Input.IC3F
+    {158U, 1055U}, //RCC.APB1LPENR.I2C1LPEN
+    {26U, 99U}, //DBG.DBGMCU_CR.TRACE_IOEN
+    {253U, 1515U}, //TIM8.DIER.CC3DE
+    {449U, 2526U}, //DMA2.S5CR.PINCOS
+    {268U, 1600U}, //TIM8.DCR.DBL
+    {365U, 2056U}, //TIM5.CCMR2_Input.IC4F
+    {30U, 159U}, //EXTI.EMR.MR21
+    {216U, 1286U}, //SDIO.STA.TXACT
+    {417U, 2357U}, //DMA2.LIFCR.CTEIF0
+    {125U, 787U}, //OTG_FS_HOST.FS_HCINTMSK0.NAKM
+    {545U, 3336U}, //GPIOD.BSRR.BR3
+    {567U, 3699U}, //GPIOB.AFRL.AFRL3
+    {293U, 1663U}, //TIM11.CCR1.CCR1
+    {415U, 2308U}, //DMA2.LISR.DMEIF2
+    {468U, 2625U}, //DMA1.HISR.TEIF7
+    {417U, 2353U}, //DMA2.LIFCR.CDMEIF1
+    {256U, 1556U}, //TIM8.CCMR1_Output.CC1S
+    {326U, 1860U}, //TIM3.CCER.CC1P
+    {425U, 2408U}, //DMA2.S1CR.MBURST
+    {489U, 2766U}, //DMA1.S3CR.CHSEL
+    {47U, 306U}, //OTG_FS_DEVICE.FS_DSTS.EERR
+    {230U, 1383U}, //TIM1.SMCR.TS
+    {678U, RegisterDbKey::NoField}, //NVIC.ICPR0
+    {598U, 3992U}, //I2C1.CR2.LAST
+    {69U, 461U}, //OTG_FS_DEVICE.DOEPINT2.XFRC
+    {660U, 4307U}, //SPI5.CR1.SSM
+    {183U, RegisterDbKey::NoField}, //RTC.BKP0R
+    {217U, 1307U}, //SDIO.ICR.TXUNDERRC
+    {366U, 2068U}, //TIM5.CCER.CC2NP
+    {280U, 1635U}, //TIM10.PSC.PSC
+    {614U, RegisterDbKey::NoField}, //I2S2ext.I2SPR
+    {544U, 3309U}, //GPIOD.ODR.ODR14
+    {234U, 1421U}, //TIM1.CCMR1_Output.OC2M
+    {389U, RegisterDbKey::NoField}, //TIM9.CCR1
+    {366U, 2063U}, //TIM5.CCER.CC4P
+    {205U, RegisterDbKey::NoField}, //SDIO.ARG
+    {555U, 3488U}, //GPIOC.BSRR.BR12
+    {113U, 676U}, //OTG_FS_HOST.FS_HCCHAR4.EPTYP
+    {595U, 3976U}, //I2C2.CCR.CCR
+    {606U, 4040U}, //I2S2ext.CR1.SPE
+    {185U, 1222U}, //RTC.BKP2R.BKP
+    {574U, 3806U}, //GPIOA.ODR.ODR0
+    {408U, 2263U}, //USART6.CR1.TCIE
+    {535U, 3170U}, //GPIOE.BSRR.BR8
+    {626U, 4144U}, //SPI1.SR.OVR
+    {491U, 2787U}, //DMA1.S3PAR.PA
+    {231U, 1398U}, //TIM1.DIER.CC1IE
+    {625U, 4138U}, //SPI1.CR2.FRF
+    {159U, 1070U}, //RCC.APB2LPENR.SPI4LPEN
+    {570U, 3741U}, //GPIOA.OTYPER.OT1
+    {706U, 4460U}, //FPU.FPSCR.AHP
+    {231U, 1399U}, //TIM1.DIER.UIE
+    {430U, RegisterDbKey::NoField}, //DMA2.S1FCR
+    {135U, 871U}, //OTG_FS_HOST.FS_HCTSIZ2.PKTCNT
+    {2U, 28U}, //ADC1.SR.EOC
+    {288U, 1655U}, //TIM11.CCMR1_Input.ICPCS
+    {595U, RegisterDbKey::NoField}, //I2C2.CCR
+    {515U, 2899U}, //DMA1.S7PAR.PA
+    {501U, 2839U}, //DMA1.S5CR.TEIE
+    {305U, 1744U}, //TIM2.CCER.CC4P
+    {717U, 4501U}, //SCB.ICSR.ISRPENDING
+    {104U, 613U}, //OTG_FS_HOST.FS_HFNUM.FTREM
+    {384U, 2128U}, //TIM9.CCMR1_Input.CC1S
+    {449U, 2535U}, //DMA2.S5CR.HTIE
+    {560U, 3571U}, //GPIOB.OTYPER.OT10
+    {691U, 4389U}, //NVIC.IPR7.IPR_N0
+    {146U, 942U}, //RCC.CFGR.MCO2
+    {684U, RegisterDbKey::NoField}, //NVIC.IPR0
+    {615U, 4088U}, //I2S3ext.CR1.CPOL
+    {233U, 1413U}, //TIM1.EGR.TG
+    {380U, 2104U}, //TIM9.DIER.UIE
+    {232U, 1404U}, //TIM1.SR.BIF
+    {524U, 3001U}, //GPIOH.ODR.ODR0
+    {483U, 2752U}, //DMA1.S2CR.PFCTRL
+    {35U, 254U}, //FLASH.ACR.PRFTEN
+    {233U, 1417U}, //TIM1.EGR.CC2G
+    {562U, 3609U}, //GPIOB.PUPDR.PUPDR4
+    {344U, 1943U}, //TIM4.CCMR2_Output.OC4FE
+    {431U, 2447U}, //DMA2.S2CR.CIRC
+    {703U, RegisterDbKey::NoField}, //NVIC.IPR19
+    {480U, 2732U}, //DMA1.S1M0AR.M0A
+    {633U, 4177U}, //SPI2.CR1.MSTR
+    {252U, 1507U}, //TIM8.SMCR.ETPS
+    {658U, 4292U}, //SPI4.I2SCFGR.I2SCFG
+    {148U, 981U}, //RCC.AHB1RSTR.GPIOCRST
+    {207U, RegisterDbKey::NoField}, //SDIO.RESPCMD
+    {98U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_HPTXFSIZ
+    {278U, 1633U}, //TIM10.CCER.CC1E
+    {555U, 3487U}, //GPIOC.BSRR.BR13
+    {443U, 2491U}, //DMA2.S4CR.CHSEL
+    {180U, 1207U}, //RTC.TAFCR.TAMPPRCH
+    {565U, 3671U}, //GPIOB.BSRR.BS6
+    {572U, 3765U}, //GPIOA.PUPDR.PUPDR9
+    {130U, 842U}, //OTG_FS_HOST.FS_HCINTMSK5.FRMORM
+    {489U, 2771U}, //DMA1.S3CR.DBM
+    {693U, 4400U}, //NVIC.IPR9.IPR_N3
+    {337U, 1886U}, //TIM4.CR2.TI1S
+    {559U, 3551U}, //GPIOB.MODER.MODER14
+    {556U, 3519U}, //GPIOC.LCKR.LCK14
+    {231U, 1387U}, //TIM1.DIER.CC4DE
+    {256U, 1547U}, //TIM8.CCMR1_Output.OC2CE
+    {408U, 2268U}, //USART6.CR1.RWU
+    {551U, 3428U}, //GPIOC.OSPEEDR.OSPEEDR8
+    {33U, 215U}, //EXTI.SWIER.SWIER8
+    {56U, 337U}, //OTG_FS_DEVICE.DIEPCTL1.SODDFRM_SD1PID
+    {296U, RegisterDbKey::NoField}, //TIM2.CR2
+    {402U, 2223U}, //USART2.CR2.CPHA
+    {560U, 3568U}, //GPIOB.OTYPER.OT13
+    {525U, 3006U}, //GPIOH.BSRR.BR11
+    {521U, 2942U}, //GPIOH.OSPEEDR.OSPEEDR11
+    {635U, 4195U}, //SPI2.SR.RXNE
+    {430U, 2434U}, //DMA2.S1FCR.FTH
+    {297U, 1679U}, //TIM2.SMCR.ETF
+    {131U, 848U}, //OTG_FS_HOST.FS_HCINTMSK6.ACKM
+    {103U, RegisterDbKey::NoField}, //OTG_FS_HOST.HFIR
+    {90U, 580U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Device.DPID
+    {377U, 2095U}, //TIM9.CR1.UDIS
+    {111U, 658U}, //OTG_FS_HOST.FS_HCCHAR2.DAD
+    {539U, 3235U}, //GPIOD.MODER.MODER8
+    {550U, 3413U}, //GPIOC.OTYPER.OT7
+    {171U, 1156U}, //RTC.ALRMAR.DT
+    {47U, 307U}, //OTG_FS_DEVICE.FS_DSTS.FNSOF
+    {507U, RegisterDbKey::NoField}, //DMA1.S6CR
+    {720U, 4516U}, //SCB.SCR.SEVEONPEND
+    {602U, RegisterDbKey::NoField}, //I2C1.SR1
+    {91U, 583U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Host.EPNUM
+    {642U, 4223U}, //SPI3.CR1.CPOL
+    {171U, 1155U}, //RTC.ALRMAR.WDSEL
+    {165U, 1111U}, //RTC.DR.DU
+    {544U, 3323U}, //GPIOD.ODR.ODR0
+    {415U, 2318U}, //DMA2.LISR.DMEIF0
+    {187U, 1224U}, //RTC.BKP4R.BKP
+    {510U, 2872U}, //DMA1.S6M0AR.M0A
+    {284U, 1644U}, //TIM11.DIER.UIE
+    {118U, 722U}, //OTG_FS_HOST.FS_HCINT1.CHH
+    {545U, 3346U}, //GPIOD.BSRR.BS9
+    {501U, 2841U}, //DMA1.S5CR.EN
+    {81U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPTSIZ2
+    {579U, 3874U}, //I2C3.CR1.PEC
+    {495U, 2794U}, //DMA1.S4CR.CHSEL
+    {278U, 1632U}, //TIM10.CCER.CC1P
+    {418U, 2379U}, //DMA2.HIFCR.CFEIF4
+    {503U, RegisterDbKey::NoField}, //DMA1.S5PAR
+    {597U, 3984U}, //I2C1.CR1.START
+    {549U, 3389U}, //GPIOC.MODER.MODER15
+    {450U, RegisterDbKey::NoField}, //DMA2.S5NDTR
+    {144U, 919U}, //RCC.CR.HSION
+    {677U, 4354U}, //NVIC.ISPR2.SETPEND
+    {574U, RegisterDbKey::NoField}, //GPIOA.ODR
+    {670U, RegisterDbKey::NoField}, //NVIC.ISER1
+    {501U, 2826U}, //DMA1.S5CR.CT
+    {701U, 4429U}, //NVIC.IPR17.IPR_N0
+    {257U, 1559U}, //TIM8.CCMR1_Input.CC2S
+    {564U, 3635U}, //GPIOB.ODR.ODR10
+    {114U, 684U}, //OTG_FS_HOST.FS_HCCHAR5.EPDIR
+    {342U, 1928U}, //TIM4.CCMR1_Output.CC2S
+    {594U, 3969U}, //I2C2.SR2.SMBDEFAULT
+    {29U, 123U}, //EXTI.IMR.MR8
+    {111U, 653U}, //OTG_FS_HOST.FS_HCCHAR2.EPNUM
+    {405U, 2251U}, //USART6.SR.PE
+    {575U, 3820U}, //GPIOA.BSRR.BR2
+    {93U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GNPTXFSIZ_Device
+    {140U, 886U}, //OTG_FS_HOST.FS_HCTSIZ7.PKTCNT
+    {477U, 2724U}, //DMA1.S1CR.PFCTRL
+    {398U, RegisterDbKey::NoField}, //USART2.SR
+    {460U, RegisterDbKey::NoField}, //DMA2.S6FCR
+    {543U, 3307U}, //GPIOD.IDR.IDR0
+    {652U, 4272U}, //SPI4.CR2.ERRIE
+    {476U, 2706U}, //DMA1.S0FCR.FEIE
+    {696U, 4412U}, //NVIC.IPR12.IPR_N3
+    {55U, 330U}, //OTG_FS_DEVICE.FS_DIEPCTL0.TXFNUM
+    {166U, 1122U}, //RTC.CR.ALRAIE
+    {28U, 113U}, //DBG.DBGMCU_APB2_FZ.DBG_TIM10_STOP
+    {478U, RegisterDbKey::NoField}, //DMA1.S1NDTR
+    {529U, 3071U}, //GPIOE.MODER.MODER11
+    {96U, 598U}, //OTG_FS_GLOBAL.FS_GCCFG.VBUSBSEN
+    {403U, 2234U}, //USART2.CR3.SCEN
+    {72U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPTSIZ0
+    {551U, 3427U}, //GPIOC.OSPEEDR.OSPEEDR9
+    {152U, RegisterDbKey::NoField}, //RCC.AHB1ENR
+    {295U, 1672U}, //TIM2.CR1.CEN
+    {501U, 2831U}, //DMA1.S5CR.PSIZE
+    {419U, 2386U}, //DMA2.S0CR.PINCOS
+    {555U, 3501U}, //GPIOC.BSRR.BS15
+    {725U, 4540U}, //SCB.SHCRS.MEMFAULTENA
+    {133U, 866U}, //OTG_FS_HOST.FS_HCTSIZ0.DPID
+    {29U, 115U}, //EXTI.IMR.MR0
+    {217U, 1304U}, //SDIO.ICR.CMDSENTC
+    {655U, 4287U}, //SPI4.CRCPR.CRCPOLY
+    {588U, 3934U}, //I2C2.CR1.ENPEC
+    {484U, RegisterDbKey::NoField}, //DMA1.S2NDTR
+    {88U, 550U}, //OTG_FS_GLOBAL.FS_GINTSTS.DISCINT
+    {369U, 2077U}, //TIM5.ARR.ARR_H
+    {519U, 2908U}, //GPIOH.MODER.MODER13
+    {33U, 218U}, //EXTI.SWIER.SWIER11
+    {15U, 76U}, //ADC1.SQR3.SQ5
+    {394U, RegisterDbKey::NoField}, //USART1.CR1
+    {286U, 1649U}, //TIM11.EGR.UG
+    {643U, 4231U}, //SPI3.CR2.RXDMAEN
+    {569U, 3719U}, //GPIOA.MODER.MODER7
+    {58U, 367U}, //OTG_FS_DEVICE.DIEPCTL3.TXFNUM
+    {530U, 3085U}, //GPIOE.OTYPER.OT13
+    {167U, 1141U}, //RTC.ISR.ALRAF
+    {597U, 3982U}, //I2C1.CR1.ACK
+    {100U, 606U}, //OTG_FS_GLOBAL.FS_DIEPTXF2.INEPTXFD
+    {522U, 2957U}, //GPIOH.PUPDR.PUPDR12
+    {608U, 4056U}, //I2S2ext.SR.CRCERR
+    {677U, RegisterDbKey::NoField}, //NVIC.ISPR2
+    {147U, 974U}, //RCC.CIR.LSIRDYF
+    {425U, 2410U}, //DMA2.S1CR.ACK
+    {688U, RegisterDbKey::NoField}, //NVIC.IPR4
+    {218U, 1318U}, //SDIO.MASK.RXFIFOFIE
+    {190U, 1227U}, //RTC.BKP7R.BKP
+    {665U, RegisterDbKey::NoField}, //SPI5.RXCRCR
+    {689U, 4384U}, //NVIC.IPR5.IPR_N3
+    {552U, 3449U}, //GPIOC.PUPDR.PUPDR3
+    {30U, 157U}, //EXTI.EMR.MR19
+    {544U, 3315U}, //GPIOD.ODR.ODR8
+    {634U, 4185U}, //SPI2.CR2.TXDMAEN
+    {468U, 2634U}, //DMA1.HISR.HTIF5
+    {217U, 1306U}, //SDIO.ICR.RXOVERRC
+    {617U, 4097U}, //I2S3ext.SR.TIFRFE
+    {383U, 2117U}, //TIM9.CCMR1_Output.OC2FE
+    {597U, 3987U}, //I2C1.CR1.ENPEC
+    {366U, 2066U}, //TIM5.CCER.CC3P
+    {575U, 3831U}, //GPIOA.BSRR.BS7
+    {259U, 1574U}, //TIM8.CCMR2_Input.IC4PSC
+    {142U, 895U}, //PWR.CR.PLS
+    {339U, 1901U}, //TIM4.DIER.UDE
+    {69U, 457U}, //OTG_FS_DEVICE.DOEPINT2.B2BSTUP
+    {405U, 2246U}, //USART6.SR.RXNE
+    {254U, 1532U}, //TIM8.SR.TIF
+    {80U, 486U}, //OTG_FS_DEVICE.DOEPTSIZ1.PKTCNT
+    {300U, 1705U}, //TIM2.EGR.TG
+    {606U, 4033U}, //I2S2ext.CR1.CRCEN
+    {326U, RegisterDbKey::NoField}, //TIM3.CCER
+    {489U, 2779U}, //DMA1.S3CR.DIR
+    {169U, 1151U}, //RTC.WUTR.WUT
+    {526U, 3049U}, //GPIOH.LCKR.LCK1
+    {326U, 1856U}, //TIM3.CCER.CC2NP
+    {4U, 52U}, //ADC1.CR2.DDS
+    {563U, 3620U}, //GPIOB.IDR.IDR9
+    {542U, RegisterDbKey::NoField}, //GPIOD.PUPDR
+    {183U, 1220U}, //RTC.BKP0R.BKP
+    {232U, 1411U}, //TIM1.SR.UIF
+    {30U, 150U}, //EXTI.EMR.MR12
+    {564U, 3633U}, //GPIOB.ODR.ODR12
+    {119U, 730U}, //OTG_FS_HOST.FS_HCINT2.XFRC
+    {436U, 2459U}, //DMA2.S2FCR.FEIE
+    {110U, 645U}, //OTG_FS_HOST.FS_HCCHAR1.LSDEV
+    {547U, 3377U}, //GPIOD.AFRL.AFRL3
+    {49U, 316U}, //OTG_FS_DEVICE.FS_DOEPMSK.STUPM
+    {437U, 2478U}, //DMA2.S3CR.TCIE
+    {56U, 338U}, //OTG_FS_DEVICE.DIEPCTL1.SD0PID_SEVNFRM
+    {606U, 4044U}, //I2S2ext.CR1.CPHA
+    {602U, 4005U}, //I2C1.SR1.SMBALERT
+    {31U, RegisterDbKey::NoField}, //EXTI.RTSR
+    {539U, 3243U}, //GPIOD.MODER.MODER0
+    {609U, RegisterDbKey::NoField}, //I2S2ext.DR
+    {108U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HPRT
+    {121U, 749U}, //OTG_FS_HOST.FS_HCINT4.CHH
+    {557U, 3537U}, //GPIOC.AFRL.AFRL4
+    {58U, 366U}, //OTG_FS_DEVICE.DIEPCTL3.CNAK
+    {166U, 1130U}, //RTC.CR.REFCKON
+    {260U, 1585U}, //TIM8.CCER.CC2NP
+    {129U, 826U}, //OTG_FS_HOST.FS_HCINTMSK4.STALLM
+    {566U, 3687U}, //GPIOB.LCKR.LCK7
+    {564U, 3644U}, //GPIOB.ODR.ODR1
+    {553U, 3467U}, //GPIOC.IDR.IDR1
+    {150U, 996U}, //RCC.APB1RSTR.TIM2RST
+    {32U, 186U}, //EXTI.FTSR.TR2
+    {651U, 4256U}, //SPI4.CR1.BIDIMODE
+    {668U, 4343U}, //SPI5.I2SPR.MCKOE
+    {417U, 2343U}, //DMA2.LIFCR.CDMEIF3
+    {189U, RegisterDbKey::NoField}, //RTC.BKP6R
+    {568U, 3705U}, //GPIOB.AFRH.AFRH13
+    {401U, 2209U}, //USART2.CR1.PS
+    {477U, 2711U}, //DMA1.S1CR.MBURST
+    {470U, 2680U}, //DMA1.HIFCR.CTEIF4
+    {597U, 3986U}, //I2C1.CR1.ENGC
+    {540U, 3252U}, //GPIOD.OTYPER.OT7
+    {480U, RegisterDbKey::NoField}, //DMA1.S1M0AR
+    {147U, 956U}, //RCC.CIR.PLLI2SRDYC
+    {541U, 3273U}, //GPIOD.OSPEEDR.OSPEEDR2
+    {322U, 1826U}, //TIM3.CCMR1_Output.OC1FE
+    {512U, RegisterDbKey::NoField}, //DMA1.S6FCR
+    {131U, 844U}, //OTG_FS_HOST.FS_HCINTMSK6.XFRCM
+    {512U, 2876U}, //DMA1.S6FCR.DMDIS
+    {161U, 1090U}, //RCC.CSR.LSIRDY
+    {295U, 1671U}, //TIM2.CR1.UDIS
+    {111U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR2
+    {509U, RegisterDbKey::NoField}, //DMA1.S6PAR
+    {661U, 4317U}, //SPI5.CR2.ERRIE
+    {232U, RegisterDbKey::NoField}, //TIM1.SR
+    {528U, RegisterDbKey::NoField}, //GPIOH.AFRH
+    {303U, 1730U}, //TIM2.CCMR2_Output.OC4FE
+    {343U, 1939U}, //TIM4.CCMR1_Input.CC1S
+    {39U, 272U}, //FLASH.CR.PSIZE
+    {298U, 1683U}, //TIM2.DIER.TDE
+    {554U, 3477U}, //GPIOC.ODR.ODR7
+    {593U, 3963U}, //I2C2.SR1.BTF
+    {461U, 2590U}, //DMA2.S7CR.TCIE
+    {234U, 1429U}, //TIM1.CCMR1_Output.CC1S
+    {415U, 2304U}, //DMA2.LISR.FEIF3
+    {20U, RegisterDbKey::NoField}, //ADC1.JDR4
+    {461U, 2584U}, //DMA2.S7CR.PSIZE
+    {573U, 3779U}, //GPIOA.IDR.IDR11
+    {606U, 4043U}, //I2S2ext.CR1.CPOL
+    {483U, 2742U}, //DMA1.S2CR.CT
+    {471U, 2693U}, //DMA1.S0CR.PINC
+    {165U, 1110U}, //RTC.DR.DT
+    {216U, 1296U}, //SDIO.STA.CTIMEOUT
+    {433U, RegisterDbKey::NoField}, //DMA2.S2PAR
+    {150U, 987U}, //RCC.APB1RSTR.I2C2RST
+    {475U, 2705U}, //DMA1.S0M1AR.M1A
+    {214U, 1267U}, //SDIO.DCTRL.RWSTOP
+    {526U, 3045U}, //GPIOH.LCKR.LCK5
+    {32U, 188U}, //EXTI.FTSR.TR4
+    {233U, 1419U}, //TIM1.EGR.UG
+    {419U, 2393U}, //DMA2.S0CR.PFCTRL
+    {588U, 3929U}, //I2C2.CR1.ACK
+    {624U, RegisterDbKey::NoField}, //SPI1.CR1
+    {16U, 82U}, //ADC1.JSQR.JSQ4
+    {545U, 3342U}, //GPIOD.BSRR.BS13
+    {159U, RegisterDbKey::NoField}, //RCC.APB2LPENR
+    {144U, 908U}, //RCC.CR.PLLI2SRDY
+    {132U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK7
+    {425U, 2412U}, //DMA2.S1CR.DBM
+    {142U, RegisterDbKey::NoField}, //PWR.CR
+    {138U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ5
+    {524U, 2987U}, //GPIOH.ODR.ODR14
+    {146U, 952U}, //RCC.CFGR.SWS0
+    {278U, RegisterDbKey::NoField}, //TIM10.CCER
+    {319U, 1794U}, //TIM3.DIER.CC1DE
+    {416U, 2326U}, //DMA2.HISR.HTIF6
+    {119U, 737U}, //OTG_FS_HOST.FS_HCINT2.FRMOR
+    {200U, RegisterDbKey::NoField}, //RTC.BKP17R
+    {520U, 2922U}, //GPIOH.OTYPER.OT15
+    {593U, 3956U}, //I2C2.SR1.AF
+    {535U, 3169U}, //GPIOE.BSRR.BR9
+    {507U, 2862U}, //DMA1.S6CR.CIRC
+    {35U, 257U}, //FLASH.ACR.ICRST
+    {449U, 2531U}, //DMA2.S5CR.CIRC
+    {502U, RegisterDbKey::NoField}, //DMA1.S5NDTR
+    {549U, 3395U}, //GPIOC.MODER.MODER9
+    {613U, 4072U}, //I2S2ext.I2SCFGR.CHLEN
+    {519U, 2907U}, //GPIOH.MODER.MODER14
+    {57U, 354U}, //OTG_FS_DEVICE.DIEPCTL2.TXFNUM
+    {418U, 2376U}, //DMA2.HIFCR.CHTIF4
+    {563U, 3623U}, //GPIOB.IDR.IDR6
+    {581U, 3894U}, //I2C3.OAR1.ADD7
+    {249U, 1477U}, //TIM1.BDTR.MOE
+    {431U, 2444U}, //DMA2.S2CR.PSIZE
+    {319U, 1796U}, //TIM3.DIER.TIE
+    {330U, RegisterDbKey::NoField}, //TIM3.CCR1
+    {4U, 50U}, //ADC1.CR2.ALIGN
+    {602U, 4009U}, //I2C1.SR1.AF
+    {373U, 2085U}, //TIM5.CCR4.CCR4_H
+    {490U, RegisterDbKey::NoField}, //DMA1.S3NDTR
+    {603U, 4022U}, //I2C1.SR2.SMBDEFAULT
+    {403U, 2236U}, //USART2.CR3.HDSEL
+    {191U, RegisterDbKey::NoField}, //RTC.BKP8R
+    {343U, 1934U}, //TIM4.CCMR1_Input.IC2F
+    {568U, RegisterDbKey::NoField}, //GPIOB.AFRH
+    {157U, RegisterDbKey::NoField}, //RCC.AHB2LPENR
+    {437U, 2470U}, //DMA2.S3CR.PINCOS
+    {533U, 3138U}, //GPIOE.IDR.IDR8
+    {551U, 3431U}, //GPIOC.OSPEEDR.OSPEEDR5
+    {554U, 3474U}, //GPIOC.ODR.ODR10
+    {24U, RegisterDbKey::NoField}, //CRC.CR
+    {29U, 133U}, //EXTI.IMR.MR18
+    {534U, 3162U}, //GPIOE.ODR.ODR0
+    {560U, 3573U}, //GPIOB.OTYPER.OT8
+    {230U, RegisterDbKey::NoField}, //TIM1.SMCR
+    {89U, 562U}, //OTG_FS_GLOBAL.FS_GINTMSK.USBRST
+    {625U, 4141U}, //SPI1.CR2.RXDMAEN
+    {384U, 2125U}, //TIM9.CCMR1_Input.CC2S
+    {457U, 2568U}, //DMA2.S6PAR.PA
+    {318U, RegisterDbKey::NoField}, //TIM3.SMCR
+    {694U, 4404U}, //NVIC.IPR10.IPR_N3
+    {167U, 1139U}, //RTC.ISR.INITF
+    {216U, 1291U}, //SDIO.STA.CMDSENT
+    {206U, 1251U}, //SDIO.CMD.ENCMDcompl
+    {132U, 858U}, //OTG_FS_HOST.FS_HCINTMSK7.ACKM
+    {212U, RegisterDbKey::NoField}, //SDIO.DTIMER
+    {128U, 823U}, //OTG_FS_HOST.FS_HCINTMSK3.DTERRM
+    {29U, 132U}, //EXTI.IMR.MR17
+    {74U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPTSIZ2
+    {34U, 249U}, //EXTI.PR.PR19
+    {180U, 1211U}, //RTC.TAFCR.TAMP2TRG
+    {550U, 3411U}, //GPIOC.OTYPER.OT9
+    {161U, 1091U}, //RCC.CSR.LSION
+    {180U, 1214U}, //RTC.TAFCR.TAMP1TRG
+    {513U, 2882U}, //DMA1.S7CR.CT
+    {120U, 746U}, //OTG_FS_HOST.FS_HCINT3.FRMOR
+    {417U, 2351U}, //DMA2.LIFCR.CHTIF1
+    {569U, 3713U}, //GPIOA.MODER.MODER13
+    {535U, 3174U}, //GPIOE.BSRR.BR4
+    {31U, 166U}, //EXTI.RTSR.TR5
+    {419U, 2385U}, //DMA2.S0CR.PL
+    {530U, 3092U}, //GPIOE.OTYPER.OT6
+    {520U, 2933U}, //GPIOH.OTYPER.OT4
+    {144U, 913U}, //RCC.CR.HSEBYP
+    {338U, 1892U}, //TIM4.SMCR.ETF
+    {231U, 1386U}, //TIM1.DIER.COMDE
+    {425U, 2424U}, //DMA2.S1CR.TEIE
+    {132U, 862U}, //OTG_FS_HOST.FS_HCINTMSK7.FRMORM
+    {118U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT1
+    {110U, 644U}, //OTG_FS_HOST.FS_HCCHAR1.EPDIR
+    {507U, 2868U}, //DMA1.S6CR.DMEIE
+    {408U, 2255U}, //USART6.CR1.OVER8
+    {564U, 3638U}, //GPIOB.ODR.ODR7
+    {556U, 3533U}, //GPIOC.LCKR.LCK0
+    {588U, 3930U}, //I2C2.CR1.STOP
+    {362U, 2032U}, //TIM5.CCMR1_Output.OC2PE
+    {217U, 1308U}, //SDIO.ICR.DTIMEOUTC
+    {606U, 4035U}, //I2S2ext.CR1.DFF
+    {467U, 2621U}, //DMA1.LISR.DMEIF0
+    {576U, 3841U}, //GPIOA.LCKR.LCK14
+    {536U, 3210U}, //GPIOE.LCKR.LCK1
+    {142U, 891U}, //PWR.CR.VOS
+    {526U, 3039U}, //GPIOH.LCKR.LCK11
+    {342U, 1933U}, //TIM4.CCMR1_Output.CC1S
+    {531U, RegisterDbKey::NoField}, //GPIOE.OSPEEDR
+    {167U, 1134U}, //RTC.ISR.ALRBWF
+    {443U, 2500U}, //DMA2.S4CR.PSIZE
+    {486U, 2760U}, //DMA1.S2M0AR.M0A
+    {305U, 1751U}, //TIM2.CCER.CC2E
+    {595U, 3975U}, //I2C2.CCR.DUTY
+    {513U, 2891U}, //DMA1.S7CR.DIR
+    {93U, 589U}, //OTG_FS_GLOBAL.FS_GNPTXFSIZ_Device.TX0FSA
+    {305U, 1747U}, //TIM2.CCER.CC3P
+    {60U, 391U}, //OTG_FS_DEVICE.DOEPCTL1.SNPM
+    {550U, 3414U}, //GPIOC.OTYPER.OT6
+    {449U, 2533U}, //DMA2.S5CR.PFCTRL
+    {571U, 3754U}, //GPIOA.OSPEEDR.OSPEEDR4
+    {408U, 2264U}, //USART6.CR1.RXNEIE
+    {340U, 1914U}, //TIM4.SR.CC3IF
+    {47U, 305U}, //OTG_FS_DEVICE.FS_DSTS.ENUMSPD
+    {113U, 677U}, //OTG_FS_HOST.FS_HCCHAR4.MCNT
+    {548U, 3381U}, //GPIOD.AFRH.AFRH15
+    {563U, 3621U}, //GPIOB.IDR.IDR8
+    {300U, 1708U}, //TIM2.EGR.CC2G
+    {262U, RegisterDbKey::NoField}, //TIM8.PSC
+    {519U, 2914U}, //GPIOH.MODER.MODER7
+    {540U, 3257U}, //GPIOD.OTYPER.OT2
+    {622U, 4116U}, //I2S3ext.I2SCFGR.DATLEN
+    {551U, 3435U}, //GPIOC.OSPEEDR.OSPEEDR1
+    {67U, 448U}, //OTG_FS_DEVICE.DOEPINT0.OTEPDIS
+    {158U, 1062U}, //RCC.APB1LPENR.TIM3LPEN
+    {33U, 207U}, //EXTI.SWIER.SWIER0
+    {220U, 1337U}, //SDIO.FIFO.FIFOData
+    {540U, 3258U}, //GPIOD.OTYPER.OT1
+    {566U, 3683U}, //GPIOB.LCKR.LCK11
+    {244U, 1471U}, //TIM1.CCR3.CCR3
+    {431U, 2443U}, //DMA2.S2CR.MSIZE
+    {555U, 3512U}, //GPIOC.BSRR.BS4
+    {345U, 1953U}, //TIM4.CCMR2_Input.IC3F
+    {675U, 4352U}, //NVIC.ISPR0.SETPEND
+    {83U, 494U}, //OTG_FS_GLOBAL.FS_GOTGCTL.SRQSCS
+    {643U, 4225U}, //SPI3.CR2.TXEIE
+    {558U, 3543U}, //GPIOC.AFRH.AFRH14
+    {128U, 817U}, //OTG_FS_HOST.FS_HCINTMSK3.NAKM
+    {443U, 2495U}, //DMA2.S4CR.CT
+    {345U, 1950U}, //TIM4.CCMR2_Input.IC4F
+    {627U, 4151U}, //SPI1.DR.DR
+    {88U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GINTSTS
+    {407U, 2253U}, //USART6.BRR.DIV_Mantissa
+    {274U, RegisterDbKey::NoField}, //TIM10.SR
+    {559U, 3559U}, //GPIOB.MODER.MODER6
+    {617U, RegisterDbKey::NoField}, //I2S3ext.SR
+    {628U, 4152U}, //SPI1.CRCPR.CRCPOLY
+    {15U, 75U}, //ADC1.SQR3.SQ6
+    {33U, 224U}, //EXTI.SWIER.SWIER17
+    {619U, 4107U}, //I2S3ext.CRCPR.CRCPOLY
+    {83U, 500U}, //OTG_FS_GLOBAL.FS_GOTGCTL.CIDSTS
+    {486U, RegisterDbKey::NoField}, //DMA1.S2M0AR
+    {114U, 683U}, //OTG_FS_HOST.FS_HCCHAR5.EPNUM
+    {64U, 429U}, //OTG_FS_DEVICE.DIEPINT1.TXFE
+    {236U, 1438U}, //TIM1.CCMR2_Output.OC4PE
+    {479U, 2731U}, //DMA1.S1PAR.PA
+    {179U, RegisterDbKey::NoField}, //RTC.CALR
+    {506U, 2847U}, //DMA1.S5FCR.FS
+    {489U, 2769U}, //DMA1.S3CR.ACK
+    {161U, 1083U}, //RCC.CSR.WWDGRSTF
+    {524U, 3000U}, //GPIOH.ODR.ODR1
+    {531U, 3104U}, //GPIOE.OSPEEDR.OSPEEDR10
+    {251U, 1499U}, //TIM8.CR2.OIS1
+    {188U, 1225U}, //RTC.BKP5R.BKP
+    {341U, 1922U}, //TIM4.EGR.CC1G
+    {557U, 3535U}, //GPIOC.AFRL.AFRL6
+    {731U, RegisterDbKey::NoField}, //NVIC_STIR.STIR
+    {219U, 1336U}, //SDIO.FIFOCNT.FIFOCOUNT
+    {238U, 1464U}, //TIM1.CCER.CC1P
+    {32U, 199U}, //EXTI.FTSR.TR15
+    {158U, 1052U}, //RCC.APB1LPENR.PWRLPEN
+    {124U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT7
+    {647U, 4243U}, //SPI3.RXCRCR.RxCRC
+    {449U, 2520U}, //DMA2.S5CR.MBURST
+    {0U, 9U}, //ADC_Common.CSR.JEOC2
+    {469U, 2649U}, //DMA1.LIFCR.CHTIF2
+    {651U, 4261U}, //SPI4.CR1.RXONLY
+    {34U, 231U}, //EXTI.PR.PR1
+    {477U, 2723U}, //DMA1.S1CR.DIR
+    {108U, 624U}, //OTG_FS_HOST.FS_HPRT.POCCHNG
+    {726U, 4554U}, //SCB.CFSR_UFSR_BFSR_MMFSR.BFARVALID
+    {299U, RegisterDbKey::NoField}, //TIM2.SR
+    {229U, 1371U}, //TIM1.CR2.OIS1N
+    {275U, 1623U}, //TIM10.EGR.UG
+    {561U, 3591U}, //GPIOB.OSPEEDR.OSPEEDR6
+    {697U, 4414U}, //NVIC.IPR13.IPR_N1
+    {57U, 353U}, //OTG_FS_DEVICE.DIEPCTL2.CNAK
+    {145U, 929U}, //RCC.PLLCFGR.PLLN6
+    {303U, 1728U}, //TIM2.CCMR2_Output.OC4M
+    {622U, RegisterDbKey::NoField}, //I2S3ext.I2SCFGR
+    {470U, 2663U}, //DMA1.HIFCR.CTCIF7
+    {440U, RegisterDbKey::NoField}, //DMA2.S3M0AR
+    {553U, 3466U}, //GPIOC.IDR.IDR2
+    {453U, 2542U}, //DMA2.S5M1AR.M1A
+    {666U, 4334U}, //SPI5.TXCRCR.TxCRC
+    {238U, 1457U}, //TIM1.CCER.CC3E
+    {641U, 4209U}, //SPI2.I2SPR.ODD
+    {254U, 1536U}, //TIM8.SR.CC2IF
+    {437U, 2482U}, //DMA2.S3CR.EN
+    {719U, 4508U}, //SCB.AIRCR.VECTRESET
+    {574U, 3792U}, //GPIOA.ODR.ODR14
+    {602U, 4007U}, //I2C1.SR1.PECERR
+    {707U, 4466U}, //MPU.MPU_TYPER.DREGION
+    {668U, 4345U}, //SPI5.I2SPR.I2SDIV
+    {467U, RegisterDbKey::NoField}, //DMA1.LISR
+    {295U, 1665U}, //TIM2.CR1.CKD
+    {99U, 604U}, //OTG_FS_GLOBAL.FS_DIEPTXF1.INEPTXFD
+    {263U, 1595U}, //TIM8.ARR.ARR
+    {37U, 260U}, //FLASH.OPTKEYR.OPTKEY
+    {545U, 3338U}, //GPIOD.BSRR.BR1
+    {597U, 3989U}, //I2C1.CR1.SMBTYPE
+    {156U, 1046U}, //RCC.AHB1LPENR.GPIOELPEN
+    {302U, RegisterDbKey::NoField}, //TIM2.CCMR1_Input
+    {565U, 3663U}, //GPIOB.BSRR.BS14
+    {328U, RegisterDbKey::NoField}, //TIM3.PSC
+    {683U, 4360U}, //NVIC.IABR2.ACTIVE
+    {560U, RegisterDbKey::NoField}, //GPIOB.OTYPER
+    {640U, 4205U}, //SPI2.I2SCFGR.CKPOL
+    {319U, 1800U}, //TIM3.DIER.CC1IE
+    {437U, 2472U}, //DMA2.S3CR.PSIZE
+    {535U, 3187U}, //GPIOE.BSRR.BS7
+    {226U, 1355U}, //SYSCFG.EXTICR4.EXTI12
+    {431U, 2445U}, //DMA2.S2CR.MINC
+    {362U, 2034U}, //TIM5.CCMR1_Output.CC2S
+    {343U, RegisterDbKey::NoField}, //TIM4.CCMR1_Input
+    {535U, 3184U}, //GPIOE.BSRR.BS10
+    {649U, 4245U}, //SPI3.I2SCFGR.I2SMOD
+    {522U, RegisterDbKey::NoField}, //GPIOH.PUPDR
+    {602U, 4008U}, //I2C1.SR1.OVR
+    {140U, 887U}, //OTG_FS_HOST.FS_HCTSIZ7.DPID
+    {553U, RegisterDbKey::NoField}, //GPIOC.IDR
+    {552U, 3443U}, //GPIOC.PUPDR.PUPDR9
+    {651U, 4258U}, //SPI4.CR1.CRCEN
+    {562U, 3613U}, //GPIOB.PUPDR.PUPDR0
+    {538U, RegisterDbKey::NoField}, //GPIOE.AFRH
+    {467U, 2611U}, //DMA1.LISR.DMEIF2
+    {137U, 878U}, //OTG_FS_HOST.FS_HCTSIZ4.DPID
+    {60U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPCTL1
+    {238U, 1456U}, //TIM1.CCER.CC3P
+    {101U, 608U}, //OTG_FS_GLOBAL.FS_DIEPTXF3.INEPTXFD
+    {308U, 1758U}, //TIM2.ARR.ARR_H
+    {146U, 951U}, //RCC.CFGR.SWS1
+    {380U, 2101U}, //TIM9.DIER.TIE
+    {649U, 4250U}, //SPI3.I2SCFGR.CKPOL
+    {487U, 2761U}, //DMA1.S2M1AR.M1A
+    {147U, 964U}, //RCC.CIR.HSERDYIE
+    {66U, 444U}, //OTG_FS_DEVICE.DIEPINT3.TOC
+    {562U, RegisterDbKey::NoField}, //GPIOB.PUPDR
+    {612U, RegisterDbKey::NoField}, //I2S2ext.TXCRCR
+    {236U, 1445U}, //TIM1.CCMR2_Output.CC3S
+    {267U, 1599U}, //TIM8.CCR4.CCR4
+    {455U, 2561U}, //DMA2.S6CR.PFCTRL
+    {404U, RegisterDbKey::NoField}, //USART2.GTPR
+    {566U, 3693U}, //GPIOB.LCKR.LCK1
+    {395U, 2172U}, //USART1.CR2.CPHA
+    {700U, 4426U}, //NVIC.IPR16.IPR_N1
+    {521U, 2938U}, //GPIOH.OSPEEDR.OSPEEDR15
+    {541U, 3272U}, //GPIOD.OSPEEDR.OSPEEDR3
+    {29U, 128U}, //EXTI.IMR.MR13
+    {69U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPINT2
+    {236U, 1443U}, //TIM1.CCMR2_Output.OC3PE
+    {27U, 104U}, //DBG.DBGMCU_APB1_FZ.DBG_TIM5_STOP
+    {338U, 1894U}, //TIM4.SMCR.TS
+    {180U, 1215U}, //RTC.TAFCR.TAMP1E
+    {53U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DVBUSPULSE
+    {539U, 3231U}, //GPIOD.MODER.MODER12
+    {97U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_CID
+    {560U, 3566U}, //GPIOB.OTYPER.OT15
+    {289U, 1657U}, //TIM11.CCER.CC1NP
+    {543U, 3298U}, //GPIOD.IDR.IDR9
+    {521U, 2945U}, //GPIOH.OSPEEDR.OSPEEDR8
+    {232U, 1401U}, //TIM1.SR.CC3OF
+    {568U, 3710U}, //GPIOB.AFRH.AFRH8
+    {145U, 922U}, //RCC.PLLCFGR.PLLQ1
+    {483U, 2757U}, //DMA1.S2CR.EN
+    {15U, 79U}, //ADC1.SQR3.SQ2
+    {260U, 1579U}, //TIM8.CCER.CC4P
+    {110U, 648U}, //OTG_FS_HOST.FS_HCCHAR1.DAD
+    {424U, 2403U}, //DMA2.S0FCR.FEIE
+    {358U, RegisterDbKey::NoField}, //TIM5.SMCR
+    {236U, 1436U}, //TIM1.CCMR2_Output.OC4CE
+    {89U, 568U}, //OTG_FS_GLOBAL.FS_GINTMSK.OEPINT
+    {546U, 3368U}, //GPIOD.LCKR.LCK4
+    {394U, 2154U}, //USART1.CR1.UE
+    {316U, 1772U}, //TIM3.CR1.CKD
+    {409U, 2273U}, //USART6.CR2.CPOL
+    {55U, 325U}, //OTG_FS_DEVICE.FS_DIEPCTL0.MPSIZ
+    {647U, RegisterDbKey::NoField}, //SPI3.RXCRCR
+    {144U, 914U}, //RCC.CR.HSERDY
+    {326U, 1855U}, //TIM3.CCER.CC3E
+    {563U, 3618U}, //GPIOB.IDR.IDR11
+    {271U, 1608U}, //TIM8.BDTR.OSSR
+    {218U, 1313U}, //SDIO.MASK.SDIOITIE
+    {324U, 1834U}, //TIM3.CCMR2_Output.O24CE
+    {545U, 3328U}, //GPIOD.BSRR.BR11
+    {575U, 3823U}, //GPIOA.BSRR.BS15
+    {365U, 2061U}, //TIM5.CCMR2_Input.CC3S
+    {167U, 1135U}, //RTC.ISR.WUTWF
+    {405U, 2244U}, //USART6.SR.TXE
+    {159U, 1067U}, //RCC.APB2LPENR.ADC1LPEN
+    {312U, 1766U}, //TIM2.CCR4.CCR4_H
+    {617U, 4102U}, //I2S3ext.SR.UDR
+    {461U, 2583U}, //DMA2.S7CR.MSIZE
+    {371U, 2082U}, //TIM5.CCR2.CCR2_L
+    {733U, RegisterDbKey::NoField}, //SCB_ACTRL.ACTRL
+    {513U, 2897U}, //DMA1.S7CR.EN
+    {243U, 1470U}, //TIM1.CCR2.CCR2
+    {83U, 496U}, //OTG_FS_GLOBAL.FS_GOTGCTL.HNGSCS
+    {357U, 1992U}, //TIM5.CR2.TI1S
+    {166U, 1121U}, //RTC.CR.ALRBIE
+    {164U, 1103U}, //RTC.TR.ST
+    {593U, 3958U}, //I2C2.SR1.BERR
+    {615U, 4087U}, //I2S3ext.CR1.MSTR
+    {324U, RegisterDbKey::NoField}, //TIM3.CCMR2_Output
+    {325U, 1844U}, //TIM3.CCMR2_Input.IC4F
+    {227U, RegisterDbKey::NoField}, //SYSCFG.CMPCR
+    {551U, 3432U}, //GPIOC.OSPEEDR.OSPEEDR4
+    {518U, 2903U}, //DMA1.S7FCR.FS
+    {532U, 3121U}, //GPIOE.PUPDR.PUPDR9
+    {513U, 2889U}, //DMA1.S7CR.PINC
+    {416U, 2322U}, //DMA2.HISR.TEIF7
+    {650U, 4255U}, //SPI3.I2SPR.I2SDIV
+    {351U, 1975U}, //TIM4.CCR2.CCR2_H
+    {573U, 3788U}, //GPIOA.IDR.IDR2
+    {579U, 3873U}, //I2C3.CR1.ALERT
+    {549U, 3391U}, //GPIOC.MODER.MODER13
+    {375U, RegisterDbKey::NoField}, //TIM5.DMAR
+    {362U, 2030U}, //TIM5.CCMR1_Output.OC2CE
+    {61U, 400U}, //OTG_FS_DEVICE.DOEPCTL2.SD0PID_SEVNFRM
+    {217U, 1303U}, //SDIO.ICR.DATAENDC
+    {603U, 4023U}, //I2C1.SR2.GENCALL
+    {526U, 3043U}, //GPIOH.LCKR.LCK7
+    {366U, 2062U}, //TIM5.CCER.CC4NP
+    {529U, 3067U}, //GPIOE.MODER.MODER15
+    {271U, 1610U}, //TIM8.BDTR.LOCK
+    {549U, RegisterDbKey::NoField}, //GPIOC.MODER
+    {283U, 1638U}, //TIM11.CR1.CKD
+    {361U, 2027U}, //TIM5.EGR.CC2G
+    {117U, 720U}, //OTG_FS_HOST.FS_HCINT0.DTERR
+    {447U, 2514U}, //DMA2.S4M1AR.M1A
+    {34U, 247U}, //EXTI.PR.PR17
+    {391U, 2149U}, //USART1.SR.PE
+    {336U, 1881U}, //TIM4.CR1.DIR
+    {192U, RegisterDbKey::NoField}, //RTC.BKP9R
+    {111U, 656U}, //OTG_FS_HOST.FS_HCCHAR2.EPTYP
+    {567U, 3698U}, //GPIOB.AFRL.AFRL4
+    {2U, 27U}, //ADC1.SR.JEOC
+    {387U, RegisterDbKey::NoField}, //TIM9.PSC
+    {613U, 4065U}, //I2S2ext.I2SCFGR.I2SMOD
+    {467U, 2612U}, //DMA1.LISR.FEIF2
+    {251U, 1498U}, //TIM8.CR2.OIS1N
+    {580U, RegisterDbKey::NoField}, //I2C3.CR2
+    {507U, 2852U}, //DMA1.S6CR.PBURST
+    {132U, 855U}, //OTG_FS_HOST.FS_HCINTMSK7.CHHM
+    {407U, RegisterDbKey::NoField}, //USART6.BRR
+    {86U, 515U}, //OTG_FS_GLOBAL.FS_GUSBCFG.SRPCAP
+    {206U, RegisterDbKey::NoField}, //SDIO.CMD
+    {145U, 939U}, //RCC.PLLCFGR.PLLM2
+    {124U, 783U}, //OTG_FS_HOST.FS_HCINT7.DTERR
+    {14U, 70U}, //ADC1.SQR2.SQ11
+    {565U, 3677U}, //GPIOB.BSRR.BS0
+    {313U, 1769U}, //TIM2.DCR.DBA
+    {495U, 2802U}, //DMA1.S4CR.MSIZE
+    {572U, 3774U}, //GPIOA.PUPDR.PUPDR0
+    {363U, 2040U}, //TIM5.CCMR1_Input.IC2F
+    {415U, 2301U}, //DMA2.LISR.HTIF3
+    {11U, 62U}, //ADC1.HTR.HT
+    {593U, 3964U}, //I2C2.SR1.ADDR
+    {362U, 2038U}, //TIM5.CCMR1_Output.OC1FE
+    {681U, 4358U}, //NVIC.IABR0.ACTIVE
+    {120U, 741U}, //OTG_FS_HOST.FS_HCINT3.STALL
+    {253U, 1514U}, //TIM8.DIER.CC4DE
+    {276U, 1625U}, //TIM10.CCMR1_Output.OC1PE
+    {582U, 3897U}, //I2C3.OAR2.ENDUAL
+    {702U, 4436U}, //NVIC.IPR18.IPR_N3
+    {343U, 1936U}, //TIM4.CCMR1_Input.CC2S
+    {523U, 2970U}, //GPIOH.IDR.IDR15
+    {142U, 892U}, //PWR.CR.ADCDC1
+    {132U, 859U}, //OTG_FS_HOST.FS_HCINTMSK7.NYET
+    {686U, 4369U}, //NVIC.IPR2.IPR_N0
+    {449U, 2519U}, //DMA2.S5CR.CHSEL
+    {584U, 3904U}, //I2C3.SR1.ARLO
+    {461U, 2581U}, //DMA2.S7CR.PL
+    {27U, 106U}, //DBG.DBGMCU_APB1_FZ.DBG_WWDG_STOP
+    {461U, RegisterDbKey::NoField}, //DMA2.S7CR
+    {89U, 564U}, //OTG_FS_GLOBAL.FS_GINTMSK.ISOODRPM
+    {695U, 4406U}, //NVIC.IPR11.IPR_N1
+    {537U, 3217U}, //GPIOE.AFRL.AFRL2
+    {575U, 3835U}, //GPIOA.BSRR.BS3
+    {121U, 752U}, //OTG_FS_HOST.FS_HCINT4.ACK
+    {559U, 3554U}, //GPIOB.MODER.MODER11
+    {89U, 572U}, //OTG_FS_GLOBAL.FS_GINTMSK.HCIM
+    {271U, 1606U}, //TIM8.BDTR.BKP
+    {317U, 1780U}, //TIM3.CR2.TI1S
+    {56U, 340U}, //OTG_FS_DEVICE.DIEPCTL1.CNAK
+    {4U, 55U}, //ADC1.CR2.ADON
+    {142U, 900U}, //PWR.CR.LPDS
+    {477U, 2712U}, //DMA1.S1CR.PBURST
+    {395U, RegisterDbKey::NoField}, //USART1.CR2
+    {585U, 3917U}, //I2C3.SR2.GENCALL
+    {622U, 4110U}, //I2S3ext.I2SCFGR.I2SMOD
+    {566U, 3692U}, //GPIOB.LCKR.LCK2
+    {553U, 3462U}, //GPIOC.IDR.IDR6
+    {352U, RegisterDbKey::NoField}, //TIM4.CCR3
+    {607U, 4050U}, //I2S2ext.CR2.TXDMAEN
+    {719U, 4513U}, //SCB.AIRCR.VECTKEYSTAT
+    {401U, 2213U}, //USART2.CR1.RXNEIE
+    {55U, 331U}, //OTG_FS_DEVICE.FS_DIEPCTL0.CNAK
+    {428U, 2429U}, //DMA2.S1M0AR.M0A
+    {569U, 3711U}, //GPIOA.MODER.MODER15
+    {140U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ7
+    {31U, 173U}, //EXTI.RTSR.TR12
+    {461U, 2588U}, //DMA2.S7CR.DIR
+    {379U, RegisterDbKey::NoField}, //TIM9.SMCR
+    {525U, 3014U}, //GPIOH.BSRR.BR3
+    {535U, 3180U}, //GPIOE.BSRR.BS14
+    {257U, 1561U}, //TIM8.CCMR1_Input.ICPCS
+    {472U, 2702U}, //DMA1.S0NDTR.NDT
+    {414U, RegisterDbKey::NoField}, //WWDG.SR
+    {483U, 2749U}, //DMA1.S2CR.PINC
+    {118U, 727U}, //OTG_FS_HOST.FS_HCINT1.BBERR
+    {146U, 950U}, //RCC.CFGR.HPRE
+    {566U, 3680U}, //GPIOB.LCKR.LCK14
+    {127U, 813U}, //OTG_FS_HOST.FS_HCINTMSK2.DTERRM
+    {303U, 1733U}, //TIM2.CCMR2_Output.OC3M
+    {87U, 525U}, //OTG_FS_GLOBAL.FS_GRSTCTL.TXFFLSH
+    {455U, 2558U}, //DMA2.S6CR.PINC
+    {360U, 2021U}, //TIM5.SR.CC2IF
+    {48U, 311U}, //OTG_FS_DEVICE.FS_DIEPMSK.ITTXFEMSK
+    {409U, 2276U}, //USART6.CR2.LBDIE
+    {431U, 2450U}, //DMA2.S2CR.TCIE
+    {348U, 1970U}, //TIM4.PSC.PSC
+    {557U, 3539U}, //GPIOC.AFRL.AFRL2
+    {525U, 3016U}, //GPIOH.BSRR.BR1
+    {493U, RegisterDbKey::NoField}, //DMA1.S3M1AR
+    {454U, 2544U}, //DMA2.S5FCR.FS
+    {431U, 2448U}, //DMA2.S2CR.DIR
+    {115U, 692U}, //OTG_FS_HOST.FS_HCCHAR6.MPSIZ
+    {570U, RegisterDbKey::NoField}, //GPIOA.OTYPER
+    {329U, RegisterDbKey::NoField}, //TIM3.ARR
+    {525U, 3023U}, //GPIOH.BSRR.BS10
+    {379U, 2100U}, //TIM9.SMCR.SMS
+    {237U, 1447U}, //TIM1.CCMR2_Input.IC4PSC
+    {19U, RegisterDbKey::NoField}, //ADC1.JDR3
+    {565U, 3655U}, //GPIOB.BSRR.BR6
+    {316U, 1775U}, //TIM3.CR1.DIR
+    {573U, 3776U}, //GPIOA.IDR.IDR14
+    {46U, 300U}, //OTG_FS_DEVICE.FS_DCTL.CGINAK
+    {468U, 2640U}, //DMA1.HISR.TEIF4
+    {719U, RegisterDbKey::NoField}, //SCB.AIRCR
+    {588U, 3935U}, //I2C2.CR1.ENARP
+    {469U, 2660U}, //DMA1.LIFCR.CTEIF0
+    {257U, 1558U}, //TIM8.CCMR1_Input.IC2PCS
+    {360U, RegisterDbKey::NoField}, //TIM5.SR
+    {526U, 3050U}, //GPIOH.LCKR.LCK0
+    {298U, 1694U}, //TIM2.DIER.UIE
+    {634U, 4183U}, //SPI2.CR2.FRF
+    {324U, 1839U}, //TIM3.CCMR2_Output.OC3CE
+    {57U, 351U}, //OTG_FS_DEVICE.DIEPCTL2.SD0PID_SEVNFRM
+    {383U, 2118U}, //TIM9.CCMR1_Output.CC2S
+    {633U, 4179U}, //SPI2.CR1.CPHA
+    {575U, 3816U}, //GPIOA.BSRR.BR6
+    {32U, 206U}, //EXTI.FTSR.TR22
+    {58U, 373U}, //OTG_FS_DEVICE.DIEPCTL3.MPSIZ
+    {573U, 3780U}, //GPIOA.IDR.IDR10
+    {150U, 988U}, //RCC.APB1RSTR.I2C1RST
+    {352U, 1977U}, //TIM4.CCR3.CCR3_H
+    {592U, RegisterDbKey::NoField}, //I2C2.DR
+    {524U, 2990U}, //GPIOH.ODR.ODR11
+    {602U, 4012U}, //I2C1.SR1.TxE
+    {644U, 4235U}, //SPI3.SR.MODF
+    {461U, 2593U}, //DMA2.S7CR.DMEIE
+    {565U, 3661U}, //GPIOB.BSRR.BR0
+    {40U, 279U}, //FLASH.OPTCR.BOR_LEV
+    {66U, 442U}, //OTG_FS_DEVICE.DIEPINT3.INEPNE
+    {250U, 1488U}, //TIM8.CR1.DIR
+    {88U, 530U}, //OTG_FS_GLOBAL.FS_GINTSTS.OTGINT
+    {27U, 109U}, //DBG.DBGMCU_APB1_FZ.DBG_I2C2_SMBUS_TIMEOUT
+    {324U, 1837U}, //TIM3.CCMR2_Output.OC4FE
+    {652U, 4270U}, //SPI4.CR2.TXEIE
+    {61U, 409U}, //OTG_FS_DEVICE.DOEPCTL2.MPSIZ
+    {300U, 1709U}, //TIM2.EGR.CC1G
+    {175U, RegisterDbKey::NoField}, //RTC.SHIFTR
+    {607U, 4049U}, //I2S2ext.CR2.SSOE
+    {507U, 2857U}, //DMA1.S6CR.PINCOS
+    {471U, 2697U}, //DMA1.S0CR.TCIE
+    {116U, 702U}, //OTG_FS_HOST.FS_HCCHAR7.MPSIZ
+    {563U, 3628U}, //GPIOB.IDR.IDR1
+    {522U, 2969U}, //GPIOH.PUPDR.PUPDR0
+    {589U, 3942U}, //I2C2.CR2.ITEVTEN
+    {402U, 2224U}, //USART2.CR2.LBCL
+    {725U, 4530U}, //SCB.SHCRS.BUSFAULTACT
+    {610U, RegisterDbKey::NoField}, //I2S2ext.CRCPR
+    {660U, 4311U}, //SPI5.CR1.BR
+    {578U, 3864U}, //GPIOA.AFRH.AFRH15
+    {28U, 112U}, //DBG.DBGMCU_APB2_FZ.DBG_TIM9_STOP
+    {363U, 2041U}, //TIM5.CCMR1_Input.IC2PCS
+    {254U, 1538U}, //TIM8.SR.UIF
+    {336U, 1880U}, //TIM4.CR1.CMS
+    {4U, 51U}, //ADC1.CR2.EOCS
+    {564U, 3639U}, //GPIOB.ODR.ODR6
+    {448U, RegisterDbKey::NoField}, //DMA2.S4FCR
+    {156U, 1044U}, //RCC.AHB1LPENR.CRCLPEN
+    {16U, 83U}, //ADC1.JSQR.JSQ3
+    {460U, 2573U}, //DMA2.S6FCR.DMDIS
+    {147U, 961U}, //RCC.CIR.LSIRDYC
+    {546U, 3370U}, //GPIOD.LCKR.LCK2
+    {310U, 1762U}, //TIM2.CCR2.CCR2_H
+    {703U, 4440U}, //NVIC.IPR19.IPR_N3
+    {662U, 4329U}, //SPI5.SR.TXE
+    {223U, 1341U}, //SYSCFG.EXTICR1.EXTI2
+    {403U, 2235U}, //USART2.CR3.NACK
+    {90U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GRXSTSR_Device
+    {401U, 2211U}, //USART2.CR1.TXEIE
+    {63U, 427U}, //OTG_FS_DEVICE.DIEPINT0.EPDISD
+    {586U, 3922U}, //I2C3.CCR.DUTY
+    {532U, RegisterDbKey::NoField}, //GPIOE.PUPDR
+    {437U, 2479U}, //DMA2.S3CR.HTIE
+    {125U, 789U}, //OTG_FS_HOST.FS_HCINTMSK0.NYET
+    {561U, 3597U}, //GPIOB.OSPEEDR.OSPEEDR0
+    {418U, 2368U}, //DMA2.HIFCR.CDMEIF6
+    {391U, 2147U}, //USART1.SR.NF
+    {224U, 1346U}, //SYSCFG.EXTICR2.EXTI5
+    {394U, 2157U}, //USART1.CR1.PCE
+    {538U, 3225U}, //GPIOE.AFRH.AFRH10
+    {60U, 388U}, //OTG_FS_DEVICE.DOEPCTL1.SNAK
+    {535U, 3171U}, //GPIOE.BSRR.BR7
+    {167U, 1136U}, //RTC.ISR.SHPF
+    {256U, 1549U}, //TIM8.CCMR1_Output.OC2PE
+    {31U, 183U}, //EXTI.RTSR.TR22
+    {588U, 3932U}, //I2C2.CR1.NOSTRETCH
+    {56U, 335U}, //OTG_FS_DEVICE.DIEPCTL1.EPENA
+    {541U, RegisterDbKey::NoField}, //GPIOD.OSPEEDR
+    {251U, 1500U}, //TIM8.CR2.TI1S
+    {353U, 1979U}, //TIM4.CCR4.CCR4_H
+    {123U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINT6
+    {225U, RegisterDbKey::NoField}, //SYSCFG.EXTICR3
+    {463U, RegisterDbKey::NoField}, //DMA2.S7PAR
+    {254U, 1534U}, //TIM8.SR.CC4IF
+    {3U, 40U}, //ADC1.CR1.JEOCIE
+    {555U, 3496U}, //GPIOC.BSRR.BR4
+    {65U, 437U}, //OTG_FS_DEVICE.DIEPINT2.ITTXFE
+    {538U, 3224U}, //GPIOE.AFRH.AFRH11
+    {249U, 1483U}, //TIM1.BDTR.LOCK
+    {64U, 432U}, //OTG_FS_DEVICE.DIEPINT1.TOC
+    {505U, RegisterDbKey::NoField}, //DMA1.S5M1AR
+    {167U, 1148U}, //RTC.ISR.RECALPF
+    {519U, 2909U}, //GPIOH.MODER.MODER12
+    {468U, 2638U}, //DMA1.HISR.TCIF4
+    {323U, 1829U}, //TIM3.CCMR1_Input.IC2PCS
+    {34U, 252U}, //EXTI.PR.PR22
+    {29U, 127U}, //EXTI.IMR.MR12
+    {56U, 346U}, //OTG_FS_DEVICE.DIEPCTL1.USBAEP
+    {733U, 4571U}, //SCB_ACTRL.ACTRL.DISFOLD
+    {419U, 2383U}, //DMA2.S0CR.CT
+    {216U, 1284U}, //SDIO.STA.TXFIFOHE
+    {699U, 4421U}, //NVIC.IPR15.IPR_N0
+    {214U, 1270U}, //SDIO.DCTRL.DMAEN
+    {165U, 1109U}, //RTC.DR.MU
+    {416U, 2334U}, //DMA2.HISR.FEIF5
+    {560U, 3575U}, //GPIOB.OTYPER.OT6
+    {360U, 2022U}, //TIM5.SR.CC1IF
+    {415U, 2315U}, //DMA2.LISR.TCIF0
+    {542U, 3286U}, //GPIOD.PUPDR.PUPDR5
+    {236U, 1442U}, //TIM1.CCMR2_Output.OC3M
+    {465U, RegisterDbKey::NoField}, //DMA2.S7M1AR
+    {66U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPINT3
+    {633U, 4176U}, //SPI2.CR1.BR
+    {643U, 4230U}, //SPI3.CR2.TXDMAEN
+    {724U, RegisterDbKey::NoField}, //SCB.SHPR3
+    {171U, 1159U}, //RTC.ALRMAR.PM
+    {144U, 916U}, //RCC.CR.HSICAL
+    {180U, 1212U}, //RTC.TAFCR.TAMP2E
+    {31U, 182U}, //EXTI.RTSR.TR21
+    {356U, RegisterDbKey::NoField}, //TIM5.CR1
+    {145U, 927U}, //RCC.PLLCFGR.PLLN8
+    {546U, 3363U}, //GPIOD.LCKR.LCK9
+    {83U, 502U}, //OTG_FS_GLOBAL.FS_GOTGCTL.ASVLD
+    {555U, 3504U}, //GPIOC.BSRR.BS12
+    {545U, 3355U}, //GPIOD.BSRR.BS0
+    {32U, 200U}, //EXTI.FTSR.TR16
+    {113U, 674U}, //OTG_FS_HOST.FS_HCCHAR4.EPDIR
+    {271U, 1611U}, //TIM8.BDTR.DTG
+    {631U, 4158U}, //SPI1.I2SCFGR.PCMSYNC
+    {346U, 1964U}, //TIM4.CCER.CC2E
+    {482U, RegisterDbKey::NoField}, //DMA1.S1FCR
+    {720U, 4515U}, //SCB.SCR.SLEEPDEEP
+    {550U, 3417U}, //GPIOC.OTYPER.OT3
+    {254U, RegisterDbKey::NoField}, //TIM8.SR
+    {603U, 4026U}, //I2C1.SR2.MSL
+    {216U, 1297U}, //SDIO.STA.DCRCFAIL
+    {543U, 3304U}, //GPIOD.IDR.IDR3
+    {593U, 3960U}, //I2C2.SR1.RxNE
+    {320U, 1802U}, //TIM3.SR.CC4OF
+    {555U, 3507U}, //GPIOC.BSRR.BS9
+    {533U, 3142U}, //GPIOE.IDR.IDR4
+    {417U, 2349U}, //DMA2.LIFCR.CFEIF2
+    {495U, 2806U}, //DMA1.S4CR.CIRC
+    {253U, 1517U}, //TIM8.DIER.CC1DE
+    {527U, 3053U}, //GPIOH.AFRL.AFRL5
+    {262U, 1594U}, //TIM8.PSC.PSC
+    {64U, 434U}, //OTG_FS_DEVICE.DIEPINT1.XFRC
+    {559U, 3553U}, //GPIOB.MODER.MODER12
+    {560U, 3572U}, //GPIOB.OTYPER.OT9
+    {707U, 4465U}, //MPU.MPU_TYPER.SEPARATE
+    {88U, 552U}, //OTG_FS_GLOBAL.FS_GINTSTS.WKUPINT
+    {542U, 3280U}, //GPIOD.PUPDR.PUPDR11
+    {529U, 3070U}, //GPIOE.MODER.MODER12
+    {251U, 1503U}, //TIM8.CR2.CCUS
+    {166U, 1115U}, //RTC.CR.COSEL
+    {525U, 3004U}, //GPIOH.BSRR.BR13
+    {141U, RegisterDbKey::NoField}, //OTG_FS_PWRCLK.FS_PCGCCTL
+    {38U, 263U}, //FLASH.SR.WRPERR
+    {417U, 2356U}, //DMA2.LIFCR.CHTIF0
+    {318U, 1783U}, //TIM3.SMCR.ETP
+    {542U, 3279U}, //GPIOD.PUPDR.PUPDR12
+    {437U, 2477U}, //DMA2.S3CR.PFCTRL
+    {616U, 4096U}, //I2S3ext.CR2.RXDMAEN
+    {306U, RegisterDbKey::NoField}, //TIM2.CNT
+    {364U, 2052U}, //TIM5.CCMR2_Output.OC3M
+    {172U, 1176U}, //RTC.ALRMBR.MSK2
+    {684U, 4363U}, //NVIC.IPR0.IPR_N2
+    {530U, 3091U}, //GPIOE.OTYPER.OT7
+    {577U, 3863U}, //GPIOA.AFRL.AFRL0
+    {669U, RegisterDbKey::NoField}, //NVIC.ISER0
+    {730U, RegisterDbKey::NoField}, //SCB.AFSR
+    {578U, 3865U}, //GPIOA.AFRH.AFRH14
+    {559U, 3564U}, //GPIOB.MODER.MODER1
+    {584U, 3899U}, //I2C3.SR1.SMBALERT
+    {492U, RegisterDbKey::NoField}, //DMA1.S3M0AR
+    {470U, 2675U}, //DMA1.HIFCR.CTEIF5
+    {126U, 794U}, //OTG_FS_HOST.FS_HCINTMSK1.XFRCM
+    {139U, 883U}, //OTG_FS_HOST.FS_HCTSIZ6.PKTCNT
+    {727U, 4563U}, //SCB.HFSR.DEBUG_VT
+    {520U, 2924U}, //GPIOH.OTYPER.OT13
+    {607U, RegisterDbKey::NoField}, //I2S2ext.CR2
+    {432U, 2455U}, //DMA2.S2NDTR.NDT
+    {711U, 4479U}, //MPU.MPU_RASR.C
+    {516U, RegisterDbKey::NoField}, //DMA1.S7M0AR
+    {614U, 4074U}, //I2S2ext.I2SPR.ODD
+    {466U, 2600U}, //DMA2.S7FCR.FS
+    {82U, 493U}, //OTG_FS_DEVICE.DOEPTSIZ3.XFRSIZ
+    {126U, 800U}, //OTG_FS_HOST.FS_HCINTMSK1.TXERRM
+    {345U, 1951U}, //TIM4.CCMR2_Input.IC4PSC
+    {523U, 2972U}, //GPIOH.IDR.IDR13
+    {435U, 2458U}, //DMA2.S2M1AR.M1A
+    {570U, 3732U}, //GPIOA.OTYPER.OT10
+    {117U, 719U}, //OTG_FS_HOST.FS_HCINT0.FRMOR
+    {425U, 2419U}, //DMA2.S1CR.CIRC
+    {586U, RegisterDbKey::NoField}, //I2C3.CCR
+    {0U, 11U}, //ADC_Common.CSR.AWD2
+    {372U, RegisterDbKey::NoField}, //TIM5.CCR3
+    {61U, 407U}, //OTG_FS_DEVICE.DOEPCTL2.EONUM_DPID
+    {418U, RegisterDbKey::NoField}, //DMA2.HIFCR
+    {295U, 1667U}, //TIM2.CR1.CMS
+    {336U, RegisterDbKey::NoField}, //TIM4.CR1
+    {217U, RegisterDbKey::NoField}, //SDIO.ICR
+    {415U, 2303U}, //DMA2.LISR.DMEIF3
+    {49U, 317U}, //OTG_FS_DEVICE.FS_DOEPMSK.OTEPDM
+    {62U, 410U}, //OTG_FS_DEVICE.DOEPCTL3.EPENA
+    {443U, 2506U}, //DMA2.S4CR.TCIE
+    {325U, 1846U}, //TIM3.CCMR2_Input.CC4S
+    {206U, 1255U}, //SDIO.CMD.WAITINT
+    {93U, 590U}, //OTG_FS_GLOBAL.FS_GNPTXFSIZ_Device.TX0FD
+    {423U, 2402U}, //DMA2.S0M1AR.M1A
+    {579U, 3885U}, //I2C3.CR1.PE
+    {663U, 4331U}, //SPI5.DR.DR
+    {539U, 3228U}, //GPIOD.MODER.MODER15
+    {468U, 2629U}, //DMA1.HISR.HTIF6
+    {669U, 4346U}, //NVIC.ISER0.SETENA
+    {344U, 1941U}, //TIM4.CCMR2_Output.OC4M
+    {551U, 3425U}, //GPIOC.OSPEEDR.OSPEEDR11
+    {571U, 3744U}, //GPIOA.OSPEEDR.OSPEEDR14
+    {631U, 4160U}, //SPI1.I2SCFGR.CKPOL
+    {303U, RegisterDbKey::NoField}, //TIM2.CCMR2_Output
+    {144U, 911U}, //RCC.CR.PLLON
+    {437U, 2466U}, //DMA2.S3CR.ACK
+    {531U, 3114U}, //GPIOE.OSPEEDR.OSPEEDR0
+    {704U, RegisterDbKey::NoField}, //FPU.FPCCR
+    {413U, RegisterDbKey::NoField}, //WWDG.CFR
+    {476U, 2707U}, //DMA1.S0FCR.FS
+    {273U, 1618U}, //TIM10.DIER.UIE
+    {615U, 4083U}, //I2S3ext.CR1.SSI
+    {417U, 2352U}, //DMA2.LIFCR.CTEIF1
+    {109U, 638U}, //OTG_FS_HOST.FS_HCCHAR0.DAD
+    {88U, 538U}, //OTG_FS_GLOBAL.FS_GINTSTS.USBRST
+    {1U, 23U}, //ADC_Common.CCR.DELAY
+    {700U, 4425U}, //NVIC.IPR16.IPR_N0
+    {535U, 3179U}, //GPIOE.BSRR.BS15
+    {1U, 19U}, //ADC_Common.CCR.VBATE
+    {455U, 2566U}, //DMA2.S6CR.EN
+    {443U, 2502U}, //DMA2.S4CR.PINC
+    {417U, 2358U}, //DMA2.LIFCR.CDMEIF0
+    {124U, 779U}, //OTG_FS_HOST.FS_HCINT7.ACK
+    {419U, 2392U}, //DMA2.S0CR.DIR
+    {722U, 4523U}, //SCB.SHPR1.PRI_4
+    {166U, 1126U}, //RTC.CR.ALRAE
+    {251U, 1496U}, //TIM8.CR2.OIS2N
+    {459U, RegisterDbKey::NoField}, //DMA2.S6M1AR
+    {552U, 3440U}, //GPIOC.PUPDR.PUPDR12
+    {155U, 1030U}, //RCC.APB2ENR.USART1EN
+    {396U, 2184U}, //USART1.CR3.NACK
+    {496U, 2814U}, //DMA1.S4NDTR.NDT
+    {410U, 2279U}, //USART6.CR3.ONEBIT
+    {91U, 587U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Host.FRMNUM
+    {403U, 2228U}, //USART2.CR3.ONEBIT
+    {470U, 2681U}, //DMA1.HIFCR.CDMEIF4
+    {84U, 505U}, //OTG_FS_GLOBAL.FS_GOTGINT.SRSSCHG
+    {33U, 228U}, //EXTI.SWIER.SWIER21
+    {326U, 1857U}, //TIM3.CCER.CC2P
+    {722U, 4525U}, //SCB.SHPR1.PRI_6
+    {217U, 1300U}, //SDIO.ICR.SDIOITC
+    {711U, 4481U}, //MPU.MPU_RASR.TEX
+    {693U, 4397U}, //NVIC.IPR9.IPR_N0
+    {256U, 1555U}, //TIM8.CCMR1_Output.OC1FE
+    {218U, 1316U}, //SDIO.MASK.RXFIFOEIE
+    {725U, 4534U}, //SCB.SHCRS.PENDSVACT
+    {372U, 2083U}, //TIM5.CCR3.CCR3_H
+    {471U, 2685U}, //DMA1.S0CR.PBURST
+    {570U, 3742U}, //GPIOA.OTYPER.OT0
+    {450U, 2539U}, //DMA2.S5NDTR.NDT
+    {520U, 2936U}, //GPIOH.OTYPER.OT1
+    {13U, 68U}, //ADC1.SQR1.SQ13
+    {362U, 2035U}, //TIM5.CCMR1_Output.OC1CE
+    {88U, 531U}, //OTG_FS_GLOBAL.FS_GINTSTS.SOF
+    {634U, 4181U}, //SPI2.CR2.RXNEIE
+    {385U, 2133U}, //TIM9.CCER.CC1P
+    {218U, 1332U}, //SDIO.MASK.DTIMEOUTIE
+    {236U, RegisterDbKey::NoField}, //TIM1.CCMR2_Output
+    {129U, 831U}, //OTG_FS_HOST.FS_HCINTMSK4.BBERRM
+    {431U, 2438U}, //DMA2.S2CR.ACK
+    {115U, 699U}, //OTG_FS_HOST.FS_HCCHAR6.ODDFRM
+    {691U, 4392U}, //NVIC.IPR7.IPR_N3
+    {521U, 2950U}, //GPIOH.OSPEEDR.OSPEEDR3
+    {535U, 3178U}, //GPIOE.BSRR.BR0
+    {565U, 3670U}, //GPIOB.BSRR.BS7
+    {34U, 233U}, //EXTI.PR.PR3
+    {631U, 4162U}, //SPI1.I2SCFGR.CHLEN
+    {408U, 2260U}, //USART6.CR1.PS
+    {165U, RegisterDbKey::NoField}, //RTC.DR
+    {177U, 1195U}, //RTC.TSDR.MU
+    {122U, 757U}, //OTG_FS_HOST.FS_HCINT5.XFRC
+    {86U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GUSBCFG
+    {341U, 1919U}, //TIM4.EGR.CC4G
+    {554U, 3480U}, //GPIOC.ODR.ODR4
+    {443U, 2498U}, //DMA2.S4CR.PINCOS
+    {345U, 1952U}, //TIM4.CCMR2_Input.CC4S
+    {115U, 694U}, //OTG_FS_HOST.FS_HCCHAR6.EPDIR
+    {371U, RegisterDbKey::NoField}, //TIM5.CCR2
+    {197U, 1234U}, //RTC.BKP14R.BKP
+    {232U, 1410U}, //TIM1.SR.CC1IF
+    {497U, RegisterDbKey::NoField}, //DMA1.S4PAR
+    {556U, 3530U}, //GPIOC.LCKR.LCK3
+    {521U, 2943U}, //GPIOH.OSPEEDR.OSPEEDR10
+    {180U, 1205U}, //RTC.TAFCR.TAMP1INSEL
+    {545U, 3345U}, //GPIOD.BSRR.BS10
+    {708U, 4468U}, //MPU.MPU_CTRL.ENABLE
+    {479U, RegisterDbKey::NoField}, //DMA1.S1PAR
+    {617U, 4101U}, //I2S3ext.SR.CRCERR
+    {571U, RegisterDbKey::NoField}, //GPIOA.OSPEEDR
+    {523U, 2984U}, //GPIOH.IDR.IDR1
+    {319U, 1801U}, //TIM3.DIER.UIE
+    {412U, 2294U}, //WWDG.CR.T
+    {541U, 3266U}, //GPIOD.OSPEEDR.OSPEEDR9
+    {252U, RegisterDbKey::NoField}, //TIM8.SMCR
+    {277U, 1630U}, //TIM10.CCMR1_Input.CC1S
+    {295U, RegisterDbKey::NoField}, //TIM2.CR1
+    {443U, 2501U}, //DMA2.S4CR.MINC
+    {565U, 3676U}, //GPIOB.BSRR.BS1
+    {631U, 4159U}, //SPI1.I2SCFGR.I2SSTD
+    {123U, 770U}, //OTG_FS_HOST.FS_HCINT6.ACK
+    {724U, 4528U}, //SCB.SHPR3.PRI_15
+    {31U, 168U}, //EXTI.RTSR.TR7
+    {4U, 47U}, //ADC1.CR2.JSWSTART
+    {166U, 1112U}, //RTC.CR.COE
+    {425U, 2423U}, //DMA2.S1CR.HTIE
+    {343U, 1938U}, //TIM4.CCMR1_Input.ICPCS
+    {560U, 3569U}, //GPIOB.OTYPER.OT12
+    {204U, 1245U}, //SDIO.CLKCR.PWRSAV
+    {551U, 3433U}, //GPIOC.OSPEEDR.OSPEEDR3
+    {0U, 8U}, //ADC_Common.CSR.JSTRT2
+    {15U, 77U}, //ADC1.SQR3.SQ4
+    {708U, RegisterDbKey::NoField}, //MPU.MPU_CTRL
+    {540U, 3253U}, //GPIOD.OTYPER.OT6
+    {539U, 3237U}, //GPIOD.MODER.MODER6
+    {631U, RegisterDbKey::NoField}, //SPI1.I2SCFGR
+    {625U, 4136U}, //SPI1.CR2.RXNEIE
+    {113U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR4
+    {654U, 4286U}, //SPI4.DR.DR
+    {711U, 4475U}, //MPU.MPU_RASR.ENABLE
+    {238U, 1459U}, //TIM1.CCER.CC2NE
+    {475U, RegisterDbKey::NoField}, //DMA1.S0M1AR
+    {331U, 1869U}, //TIM3.CCR2.CCR2_H
+    {717U, 4502U}, //SCB.ICSR.PENDSTCLR
+    {112U, 667U}, //OTG_FS_HOST.FS_HCCHAR3.MCNT
+    {87U, 524U}, //OTG_FS_GLOBAL.FS_GRSTCTL.RXFFLSH
+    {437U, 2475U}, //DMA2.S3CR.CIRC
+    {506U, 2849U}, //DMA1.S5FCR.FTH
+    {231U, RegisterDbKey::NoField}, //TIM1.DIER
+    {408U, 2257U}, //USART6.CR1.M
+    {569U, 3717U}, //GPIOA.MODER.MODER9
+    {665U, 4333U}, //SPI5.RXCRCR.RxCRC
+    {588U, 3938U}, //I2C2.CR1.PE
+    {640U, 4207U}, //SPI2.I2SCFGR.CHLEN
+    {339U, 1897U}, //TIM4.DIER.CC4DE
+    {214U, 1269U}, //SDIO.DCTRL.DBLOCKSIZE
+    {512U, 2874U}, //DMA1.S6FCR.FEIE
+    {131U, 850U}, //OTG_FS_HOST.FS_HCINTMSK6.TXERRM
+    {158U, 1057U}, //RCC.APB1LPENR.SPI3LPEN
+    {553U, 3464U}, //GPIOC.IDR.IDR4
+    {316U, 1779U}, //TIM3.CR1.CEN
+    {615U, 4078U}, //I2S3ext.CR1.CRCEN
+    {696U, 4409U}, //NVIC.IPR12.IPR_N0
+    {470U, 2664U}, //DMA1.HIFCR.CHTIF7
+    {474U, RegisterDbKey::NoField}, //DMA1.S0M0AR
+    {330U, 1867U}, //TIM3.CCR1.CCR1_H
+    {522U, 2960U}, //GPIOH.PUPDR.PUPDR9
+    {644U, 4238U}, //SPI3.SR.CHSIDE
+    {544U, 3321U}, //GPIOD.ODR.ODR2
+    {418U, 2377U}, //DMA2.HIFCR.CTEIF4
+    {646U, 4242U}, //SPI3.CRCPR.CRCPOLY
+    {204U, 1241U}, //SDIO.CLKCR.HWFC_EN
+    {326U, 1851U}, //TIM3.CCER.CC4P
+    {525U, 3028U}, //GPIOH.BSRR.BS5
+    {407U, 2254U}, //USART6.BRR.DIV_Fraction
+    {725U, 4538U}, //SCB.SHCRS.BUSFAULTPENDED
+    {250U, 1490U}, //TIM8.CR1.URS
+    {569U, 3724U}, //GPIOA.MODER.MODER2
+    {566U, RegisterDbKey::NoField}, //GPIOB.LCKR
+    {662U, 4327U}, //SPI5.SR.UDR
+    {259U, 1575U}, //TIM8.CCMR2_Input.CC4S
+    {214U, 1265U}, //SDIO.DCTRL.SDIOEN
+    {437U, 2463U}, //DMA2.S3CR.CHSEL
+    {574U, 3805U}, //GPIOA.ODR.ODR1
+    {370U, RegisterDbKey::NoField}, //TIM5.CCR1
+    {172U, 1179U}, //RTC.ALRMBR.MSK1
+    {47U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.FS_DSTS
+    {237U, 1450U}, //TIM1.CCMR2_Input.IC3PSC
+    {695U, 4405U}, //NVIC.IPR11.IPR_N0
+    {339U, 1906U}, //TIM4.DIER.CC1IE
+    {417U, 2344U}, //DMA2.LIFCR.CFEIF3
+    {46U, 303U}, //OTG_FS_DEVICE.FS_DCTL.POPRGDNE
+    {598U, 3994U}, //I2C1.CR2.ITBUFEN
+    {29U, 129U}, //EXTI.IMR.MR14
+    {489U, RegisterDbKey::NoField}, //DMA1.S3CR
+    {484U, 2758U}, //DMA1.S2NDTR.NDT
+    {685U, 4367U}, //NVIC.IPR1.IPR_N2
+    {323U, 1833U}, //TIM3.CCMR1_Input.CC1S
+    {481U, 2733U}, //DMA1.S1M1AR.M1A
+    {634U, RegisterDbKey::NoField}, //SPI2.CR2
+    {539U, 3229U}, //GPIOD.MODER.MODER14
+    {569U, 3718U}, //GPIOA.MODER.MODER8
+    {599U, RegisterDbKey::NoField}, //I2C1.OAR1
+    {661U, RegisterDbKey::NoField}, //SPI5.CR2
+    {98U, 601U}, //OTG_FS_GLOBAL.FS_HPTXFSIZ.PTXSA
+    {182U, 1218U}, //RTC.ALRMBSSR.MASKSS
+    {155U, 1033U}, //RCC.APB2ENR.SDIOEN
+    {111U, 661U}, //OTG_FS_HOST.FS_HCCHAR2.CHENA
+    {719U, 4512U}, //SCB.AIRCR.ENDIANESS
+    {313U, 1768U}, //TIM2.DCR.DBL
+    {299U, 1700U}, //TIM2.SR.CC4IF
+    {544U, 3314U}, //GPIOD.ODR.ODR9
+    {109U, 641U}, //OTG_FS_HOST.FS_HCCHAR0.CHENA
+    {390U, 2139U}, //TIM9.CCR2.CCR2
+    {461U, 2582U}, //DMA2.S7CR.PINCOS
+    {91U, 584U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Host.BCNT
+    {253U, 1525U}, //TIM8.DIER.CC1IE
+    {513U, RegisterDbKey::NoField}, //DMA1.S7CR
+    {530U, 3084U}, //GPIOE.OTYPER.OT14
+    {425U, 2407U}, //DMA2.S1CR.CHSEL
+    {29U, 124U}, //EXTI.IMR.MR9
+    {249U, 1479U}, //TIM1.BDTR.BKP
+    {563U, 3622U}, //GPIOB.IDR.IDR7
+    {470U, 2674U}, //DMA1.HIFCR.CHTIF5
+    {31U, 178U}, //EXTI.RTSR.TR17
+    {121U, 754U}, //OTG_FS_HOST.FS_HCINT4.BBERR
+    {87U, 523U}, //OTG_FS_GLOBAL.FS_GRSTCTL.FCRST
+    {55U, 334U}, //OTG_FS_DEVICE.FS_DIEPCTL0.EPENA
+    {254U, 1531U}, //TIM8.SR.BIF
+    {573U, 3785U}, //GPIOA.IDR.IDR5
+    {676U, RegisterDbKey::NoField}, //NVIC.ISPR1
+    {85U, 512U}, //OTG_FS_GLOBAL.FS_GAHBCFG.PTXFELVL
+    {687U, 4373U}, //NVIC.IPR3.IPR_N0
+    {159U, 1074U}, //RCC.APB2LPENR.TIM11LPEN
+    {321U, RegisterDbKey::NoField}, //TIM3.EGR
+    {437U, 2473U}, //DMA2.S3CR.MINC
+    {716U, 4493U}, //SCB.CPUID.Revision
+    {33U, 219U}, //EXTI.SWIER.SWIER12
+    {689U, 4383U}, //NVIC.IPR5.IPR_N2
+    {721U, 4520U}, //SCB.CCR.DIV_0_TRP
+    {30U, 156U}, //EXTI.EMR.MR18
+    {398U, 2193U}, //USART2.SR.TXE
+    {506U, 2848U}, //DMA1.S5FCR.DMDIS
+    {537U, 3215U}, //GPIOE.AFRL.AFRL4
+    {569U, 3721U}, //GPIOA.MODER.MODER5
+    {412U, RegisterDbKey::NoField}, //WWDG.CR
+    {238U, 1461U}, //TIM1.CCER.CC2E
+    {16U, 85U}, //ADC1.JSQR.JSQ1
+    {649U, 4248U}, //SPI3.I2SCFGR.PCMSYNC
+    {644U, 4237U}, //SPI3.SR.UDR
+    {565U, 3666U}, //GPIOB.BSRR.BS11
+    {539U, 3242U}, //GPIOD.MODER.MODER1
+    {61U, 408U}, //OTG_FS_DEVICE.DOEPCTL2.USBAEP
+    {52U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DVBUSDIS
+    {564U, 3637U}, //GPIOB.ODR.ODR8
+    {494U, 2793U}, //DMA1.S3FCR.FTH
+    {403U, RegisterDbKey::NoField}, //USART2.CR3
+    {397U, RegisterDbKey::NoField}, //USART1.GTPR
+    {706U, 4457U}, //FPU.FPSCR.RMode
+    {444U, RegisterDbKey::NoField}, //DMA2.S4NDTR
+    {588U, 3925U}, //I2C2.CR1.SWRST
+    {564U, 3645U}, //GPIOB.ODR.ODR0
+    {18U, 87U}, //ADC1.JDR2.JDATA
+    {171U, 1166U}, //RTC.ALRMAR.ST
+    {32U, 189U}, //EXTI.FTSR.TR5
+    {645U, 4241U}, //SPI3.DR.DR
+    {469U, 2646U}, //DMA1.LIFCR.CDMEIF3
+    {89U, 556U}, //OTG_FS_GLOBAL.FS_GINTMSK.RXFLVLM
+    {661U, 4315U}, //SPI5.CR2.TXEIE
+    {554U, 3478U}, //GPIOC.ODR.ODR6
+    {538U, 3226U}, //GPIOE.AFRH.AFRH9
+    {631U, 4157U}, //SPI1.I2SCFGR.I2SCFG
+    {679U, 4356U}, //NVIC.ICPR1.CLRPEND
+    {443U, 2493U}, //DMA2.S4CR.PBURST
+    {540U, 3255U}, //GPIOD.OTYPER.OT4
+    {576U, 3849U}, //GPIOA.LCKR.LCK6
+    {615U, 4076U}, //I2S3ext.CR1.BIDIMODE
+    {624U, 4129U}, //SPI1.CR1.LSBFIRST
+    {64U, 430U}, //OTG_FS_DEVICE.DIEPINT1.INEPNE
+    {298U, 1688U}, //TIM2.DIER.UDE
+    {706U, RegisterDbKey::NoField}, //FPU.FPSCR
+    {228U, 1365U}, //TIM1.CR1.CEN
+    {171U, 1165U}, //RTC.ALRMAR.MSK1
+    {44U, RegisterDbKey::NoField}, //IWDG.SR
+    {114U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR5
+    {167U, 1146U}, //RTC.ISR.TAMP1F
+    {30U, 153U}, //EXTI.EMR.MR15
+    {660U, 4302U}, //SPI5.CR1.BIDIOE
+    {557U, 3534U}, //GPIOC.AFRL.AFRL7
+    {359U, 2009U}, //TIM5.DIER.CC4IE
+    {416U, 2332U}, //DMA2.HISR.TEIF5
+    {305U, 1753U}, //TIM2.CCER.CC1P
+    {490U, 2786U}, //DMA1.S3NDTR.NDT
+    {260U, 1591U}, //TIM8.CCER.CC1P
+    {30U, 151U}, //EXTI.EMR.MR13
+    {545U, 3343U}, //GPIOD.BSRR.BS12
+    {58U, 368U}, //OTG_FS_DEVICE.DIEPCTL3.Stall
+    {415U, 2309U}, //DMA2.LISR.FEIF2
+    {598U, RegisterDbKey::NoField}, //I2C1.CR2
+    {161U, 1082U}, //RCC.CSR.LPWRRSTF
+    {88U, 539U}, //OTG_FS_GLOBAL.FS_GINTSTS.ENUMDNE
+    {717U, 4506U}, //SCB.ICSR.NMIPENDSET
+    {258U, 1564U}, //TIM8.CCMR2_Output.OC4M
+    {218U, 1329U}, //SDIO.MASK.CMDRENDIE
+    {566U, 3690U}, //GPIOB.LCKR.LCK4
+    {0U, 16U}, //ADC_Common.CSR.EOC1
+    {461U, 2575U}, //DMA2.S7CR.CHSEL
+    {218U, 1335U}, //SDIO.MASK.CCRCFAILIE
+    {558U, 3547U}, //GPIOC.AFRH.AFRH10
+    {541U, 3275U}, //GPIOD.OSPEEDR.OSPEEDR0
+    {468U, 2636U}, //DMA1.HISR.DMEIF5
+    {667U, 4340U}, //SPI5.I2SCFGR.CKPOL
+    {649U, 4247U}, //SPI3.I2SCFGR.I2SCFG
+    {34U, RegisterDbKey::NoField}, //EXTI.PR
+    {469U, 2662U}, //DMA1.LIFCR.CFEIF0
+    {166U, 1118U}, //RTC.CR.ADD1H
+    {148U, 978U}, //RCC.AHB1RSTR.GPIOHRST
+    {25U, 94U}, //DBG.DBGMCU_IDCODE.DEV_ID
+    {166U, 1113U}, //RTC.CR.OSEL
+    {593U, 3962U}, //I2C2.SR1.ADD10
+    {711U, RegisterDbKey::NoField}, //MPU.MPU_RASR
+    {27U, 105U}, //DBG.DBGMCU_APB1_FZ.DBG_RTC_Stop
+    {108U, 630U}, //OTG_FS_HOST.FS_HPRT.PTCTL
+    {340U, 1912U}, //TIM4.SR.TIF
+    {554U, RegisterDbKey::NoField}, //GPIOC.ODR
+    {559U, 3561U}, //GPIOB.MODER.MODER4
+    {593U, 3961U}, //I2C2.SR1.STOPF
+    {653U, 4285U}, //SPI4.SR.RXNE
+    {169U, RegisterDbKey::NoField}, //RTC.WUTR
+    {550U, 3405U}, //GPIOC.OTYPER.OT15
+    {396U, 2179U}, //USART1.CR3.CTSE
+    {520U, 2923U}, //GPIOH.OTYPER.OT14
+    {614U, 4075U}, //I2S2ext.I2SPR.I2SDIV
+    {366U, 2072U}, //TIM5.CCER.CC1P
+    {715U, 4491U}, //STK.CALIB.SKEW
+    {672U, 4349U}, //NVIC.ICER0.CLRENA
+    {564U, 3632U}, //GPIOB.ODR.ODR13
+    {35U, 258U}, //FLASH.ACR.DCRST
+    {25U, RegisterDbKey::NoField}, //DBG.DBGMCU_IDCODE
+    {218U, 1322U}, //SDIO.MASK.RXACTIE
+    {529U, 3073U}, //GPIOE.MODER.MODER9
+    {337U, 1887U}, //TIM4.CR2.MMS
+    {131U, 852U}, //OTG_FS_HOST.FS_HCINTMSK6.FRMORM
+    {286U, RegisterDbKey::NoField}, //TIM11.EGR
+    {357U, 1994U}, //TIM5.CR2.CCDS
+    {136U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ3
+    {116U, 703U}, //OTG_FS_HOST.FS_HCCHAR7.EPNUM
+    {39U, 273U}, //FLASH.CR.STRT
+    {302U, 1725U}, //TIM2.CCMR1_Input.ICPCS
+    {226U, RegisterDbKey::NoField}, //SYSCFG.EXTICR4
+    {298U, 1692U}, //TIM2.DIER.CC2IE
+    {507U, 2869U}, //DMA1.S6CR.EN
+    {469U, 2656U}, //DMA1.LIFCR.CDMEIF1
+    {555U, 3497U}, //GPIOC.BSRR.BR3
+    {712U, 4485U}, //STK.CTRL.TICKINT
+    {356U, 1988U}, //TIM5.CR1.OPM
+    {584U, 3906U}, //I2C3.SR1.TxE
+    {575U, 3809U}, //GPIOA.BSRR.BR13
+    {226U, 1354U}, //SYSCFG.EXTICR4.EXTI13
+    {635U, 4189U}, //SPI2.SR.OVR
+    {91U, 586U}, //OTG_FS_GLOBAL.FS_GRXSTSR_Host.PKTSTS
+    {101U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_DIEPTXF3
+    {401U, 2216U}, //USART2.CR1.RE
+    {469U, 2655U}, //DMA1.LIFCR.CTEIF1
+    {145U, 923U}, //RCC.PLLCFGR.PLLQ0
+    {418U, 2372U}, //DMA2.HIFCR.CTEIF5
+    {716U, 4496U}, //SCB.CPUID.Variant
+    {494U, RegisterDbKey::NoField}, //DMA1.S3FCR
+    {85U, 510U}, //OTG_FS_GLOBAL.FS_GAHBCFG.GINT
+    {135U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ2
+    {555U, 3515U}, //GPIOC.BSRR.BS1
+    {125U, 791U}, //OTG_FS_HOST.FS_HCINTMSK0.BBERRM
+    {120U, 742U}, //OTG_FS_HOST.FS_HCINT3.NAK
+    {694U, 4403U}, //NVIC.IPR10.IPR_N2
+    {228U, 1358U}, //TIM1.CR1.CKD
+    {235U, 1434U}, //TIM1.CCMR1_Input.ICPCS
+    {361U, 2026U}, //TIM5.EGR.CC3G
+    {27U, 101U}, //DBG.DBGMCU_APB1_FZ.DBG_TIM2_STOP
+    {159U, 1065U}, //RCC.APB2LPENR.USART1LPEN
+    {624U, 4126U}, //SPI1.CR1.RXONLY
+    {706U, 4464U}, //FPU.FPSCR.N
+    {567U, RegisterDbKey::NoField}, //GPIOB.AFRL
+    {733U, 4569U}, //SCB_ACTRL.ACTRL.DISMCYCINT
+    {340U, 1916U}, //TIM4.SR.CC1IF
+    {171U, 1157U}, //RTC.ALRMAR.DU
+    {150U, 993U}, //RCC.APB1RSTR.TIM5RST
+    {151U, 998U}, //RCC.APB2RSTR.TIM10RST
+    {538U, 3222U}, //GPIOE.AFRH.AFRH13
+    {377U, 2094U}, //TIM9.CR1.URS
+    {483U, 2747U}, //DMA1.S2CR.PSIZE
+    {416U, 2327U}, //DMA2.HISR.TEIF6
+    {416U, 2333U}, //DMA2.HISR.DMEIF5
+    {39U, 274U}, //FLASH.CR.EOPIE
+    {346U, 1960U}, //TIM4.CCER.CC3P
+    {87U, 521U}, //OTG_FS_GLOBAL.FS_GRSTCTL.CSRST
+    {541U, 3260U}, //GPIOD.OSPEEDR.OSPEEDR15
+    {302U, 1721U}, //TIM2.CCMR1_Input.IC2F
+    {247U, RegisterDbKey::NoField}, //TIM1.DMAR
+    {155U, 1039U}, //RCC.APB2ENR.TIM11EN
+    {495U, 2812U}, //DMA1.S4CR.DMEIE
+    {110U, 646U}, //OTG_FS_HOST.FS_HCCHAR1.EPTYP
+    {342U, 1930U}, //TIM4.CCMR1_Output.OC1M
+    {421U, 2400U}, //DMA2.S0PAR.PA
+    {512U, 2877U}, //DMA1.S6FCR.FTH
+    {52U, 322U}, //OTG_FS_DEVICE.DVBUSDIS.VBUSDT
+    {191U, 1228U}, //RTC.BKP8R.BKP
+    {578U, 3869U}, //GPIOA.AFRH.AFRH10
+    {566U, 3691U}, //GPIOB.LCKR.LCK3
+    {533U, 3145U}, //GPIOE.IDR.IDR1
+    {633U, 4172U}, //SPI2.CR1.SSM
+    {642U, 4218U}, //SPI3.CR1.SSI
+    {150U, 986U}, //RCC.APB1RSTR.I2C3RST
+    {571U, 3757U}, //GPIOA.OSPEEDR.OSPEEDR1
+    {346U, 1967U}, //TIM4.CCER.CC1E
+    {513U, 2879U}, //DMA1.S7CR.MBURST
+    {152U, 1008U}, //RCC.AHB1ENR.DMA1EN
+    {644U, 4236U}, //SPI3.SR.CRCERR
+    {573U, RegisterDbKey::NoField}, //GPIOA.IDR
+    {603U, 4024U}, //I2C1.SR2.TRA
+    {238U, 1453U}, //TIM1.CCER.CC4E
+    {116U, 706U}, //OTG_FS_HOST.FS_HCCHAR7.EPTYP
+    {384U, 2123U}, //TIM9.CCMR1_Input.IC2F
+    {575U, 3812U}, //GPIOA.BSRR.BR10
+    {148U, 983U}, //RCC.AHB1RSTR.GPIOARST
+    {534U, 3147U}, //GPIOE.ODR.ODR15
+    {34U, 245U}, //EXTI.PR.PR15
+    {120U, 744U}, //OTG_FS_HOST.FS_HCINT3.TXERR
+    {29U, 135U}, //EXTI.IMR.MR20
+    {3U, 35U}, //ADC1.CR1.JDISCEN
+    {571U, 3753U}, //GPIOA.OSPEEDR.OSPEEDR5
+    {405U, 2242U}, //USART6.SR.CTS
+    {204U, 1247U}, //SDIO.CLKCR.CLKDIV
+    {356U, 1989U}, //TIM5.CR1.URS
+    {449U, 2523U}, //DMA2.S5CR.CT
+    {229U, 1377U}, //TIM1.CR2.CCPC
+    {62U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPCTL3
+    {371U, 2081U}, //TIM5.CCR2.CCR2_H
+    {176U, RegisterDbKey::NoField}, //RTC.TSTR
+    {519U, 2917U}, //GPIOH.MODER.MODER4
+    {217U, 1302U}, //SDIO.ICR.STBITERRC
+    {483U, 2751U}, //DMA1.S2CR.DIR
+    {46U, 298U}, //OTG_FS_DEVICE.FS_DCTL.TCTL
+    {206U, 1250U}, //SDIO.CMD.nIEN
+    {48U, 309U}, //OTG_FS_DEVICE.FS_DIEPMSK.EPDM
+    {569U, 3725U}, //GPIOA.MODER.MODER1
+    {624U, 4128U}, //SPI1.CR1.SSI
+    {495U, 2801U}, //DMA1.S4CR.PINCOS
+    {431U, 2436U}, //DMA2.S2CR.MBURST
+    {661U, 4321U}, //SPI5.CR2.RXDMAEN
+    {500U, RegisterDbKey::NoField}, //DMA1.S4FCR
+    {336U, 1884U}, //TIM4.CR1.UDIS
+    {532U, 3118U}, //GPIOE.PUPDR.PUPDR12
+    {425U, RegisterDbKey::NoField}, //DMA2.S1CR
+    {550U, 3412U}, //GPIOC.OTYPER.OT8
+    {700U, 4428U}, //NVIC.IPR16.IPR_N3
+    {63U, 426U}, //OTG_FS_DEVICE.DIEPINT0.TOC
+    {158U, 1054U}, //RCC.APB1LPENR.I2C2LPEN
+    {40U, 282U}, //FLASH.OPTCR.nRST_STDBY
+    {489U, 2770U}, //DMA1.S3CR.CT
+    {533U, 3136U}, //GPIOE.IDR.IDR10
+    {164U, RegisterDbKey::NoField}, //RTC.TR
+    {688U, 4380U}, //NVIC.IPR4.IPR_N3
+    {535U, 3173U}, //GPIOE.BSRR.BR5
+    {402U, 2227U}, //USART2.CR2.ADD
+    {661U, 4319U}, //SPI5.CR2.SSOE
+    {555U, 3499U}, //GPIOC.BSRR.BR1
+    {346U, 1957U}, //TIM4.CCER.CC4P
+    {366U, RegisterDbKey::NoField}, //TIM5.CCER
+    {615U, 4077U}, //I2S3ext.CR1.BIDIOE
+    {323U, RegisterDbKey::NoField}, //TIM3.CCMR1_Input
+    {443U, 2492U}, //DMA2.S4CR.MBURST
+    {617U, 4105U}, //I2S3ext.SR.RXNE
+    {147U, 960U}, //RCC.CIR.LSERDYC
+    {534U, 3154U}, //GPIOE.ODR.ODR8
+    {697U, 4413U}, //NVIC.IPR13.IPR_N0
+    {566U, 3682U}, //GPIOB.LCKR.LCK12
+    {633U, 4171U}, //SPI2.CR1.RXONLY
+    {483U, 2739U}, //DMA1.S2CR.MBURST
+    {482U, 2736U}, //DMA1.S1FCR.DMDIS
+    {706U, 4463U}, //FPU.FPSCR.Z
+    {706U, 4459U}, //FPU.FPSCR.DN
+    {323U, 1831U}, //TIM3.CCMR1_Input.IC1F
+    {578U, 3867U}, //GPIOA.AFRH.AFRH12
+    {520U, 2932U}, //GPIOH.OTYPER.OT5
+    {551U, 3422U}, //GPIOC.OSPEEDR.OSPEEDR14
+    {571U, 3745U}, //GPIOA.OSPEEDR.OSPEEDR13
+    {464U, 2597U}, //DMA2.S7M0AR.M0A
+    {245U, RegisterDbKey::NoField}, //TIM1.CCR4
+    {32U, 196U}, //EXTI.FTSR.TR12
+    {109U, 637U}, //OTG_FS_HOST.FS_HCCHAR0.MCNT
+    {0U, 15U}, //ADC_Common.CSR.JEOC1
+    {165U, 1105U}, //RTC.DR.YT
+    {640U, 4204U}, //SPI2.I2SCFGR.I2SSTD
+    {339U, 1898U}, //TIM4.DIER.CC3DE
+    {576U, RegisterDbKey::NoField}, //GPIOA.LCKR
+    {563U, RegisterDbKey::NoField}, //GPIOB.IDR
+    {495U, 2803U}, //DMA1.S4CR.PSIZE
+    {531U, 3111U}, //GPIOE.OSPEEDR.OSPEEDR3
+    {276U, RegisterDbKey::NoField}, //TIM10.CCMR1_Output
+    {469U, 2653U}, //DMA1.LIFCR.CTCIF1
+    {32U, RegisterDbKey::NoField}, //EXTI.FTSR
+    {219U, RegisterDbKey::NoField}, //SDIO.FIFOCNT
+    {143U, 904U}, //PWR.CSR.BRR
+    {561U, 3590U}, //GPIOB.OSPEEDR.OSPEEDR7
+    {32U, 194U}, //EXTI.FTSR.TR10
+    {88U, 551U}, //OTG_FS_GLOBAL.FS_GINTSTS.SRQINT
+    {130U, 839U}, //OTG_FS_HOST.FS_HCINTMSK5.NYET
+    {721U, 4521U}, //SCB.CCR.BFHFNMIGN
+    {531U, 3103U}, //GPIOE.OSPEEDR.OSPEEDR11
+    {470U, 2668U}, //DMA1.HIFCR.CTCIF6
+    {147U, 970U}, //RCC.CIR.PLLRDYF
+    {588U, 3928U}, //I2C2.CR1.POS
+    {502U, 2842U}, //DMA1.S5NDTR.NDT
+    {194U, 1231U}, //RTC.BKP11R.BKP
+    {120U, 743U}, //OTG_FS_HOST.FS_HCINT3.ACK
+    {603U, 4019U}, //I2C1.SR2.PEC
+    {552U, 3450U}, //GPIOC.PUPDR.PUPDR2
+    {151U, 1005U}, //RCC.APB2RSTR.USART1RST
+    {113U, 673U}, //OTG_FS_HOST.FS_HCCHAR4.EPNUM
+    {574U, 3791U}, //GPIOA.ODR.ODR15
+    {597U, 3988U}, //I2C1.CR1.ENARP
+    {550U, 3415U}, //GPIOC.OTYPER.OT5
+    {518U, 2905U}, //DMA1.S7FCR.FTH
+    {46U, 299U}, //OTG_FS_DEVICE.FS_DCTL.SGINAK
+    {40U, RegisterDbKey::NoField}, //FLASH.OPTCR
+    {674U, 4351U}, //NVIC.ICER2.CLRENA
+    {204U, 1243U}, //SDIO.CLKCR.WIDBUS
+    {643U, 4228U}, //SPI3.CR2.FRF
+    {572U, 3768U}, //GPIOA.PUPDR.PUPDR6
+    {580U, 3890U}, //I2C3.CR2.ITERREN
+    {548U, 3382U}, //GPIOD.AFRH.AFRH14
+    {239U, 1466U}, //TIM1.CNT.CNT
+    {391U, 2145U}, //USART1.SR.IDLE
+    {125U, 786U}, //OTG_FS_HOST.FS_HCINTMSK0.STALLM
+    {363U, 2043U}, //TIM5.CCMR1_Input.IC1F
+    {297U, 1682U}, //TIM2.SMCR.SMS
+    {633U, 4174U}, //SPI2.CR1.LSBFIRST
+    {575U, 3828U}, //GPIOA.BSRR.BS10
+    {551U, 3434U}, //GPIOC.OSPEEDR.OSPEEDR2
+    {642U, 4211U}, //SPI3.CR1.BIDIMODE
+    {180U, 1208U}, //RTC.TAFCR.TAMPFLT
+    {124U, 781U}, //OTG_FS_HOST.FS_HCINT7.BBERR
+    {650U, RegisterDbKey::NoField}, //SPI3.I2SPR
+    {649U, 4246U}, //SPI3.I2SCFGR.I2SE
+    {168U, 1149U}, //RTC.PRER.PREDIV_A
+    {155U, 1038U}, //RCC.APB2ENR.TIM10EN
+    {477U, 2726U}, //DMA1.S1CR.HTIE
+    {690U, 4385U}, //NVIC.IPR6.IPR_N0
+    {162U, 1092U}, //RCC.SSCGR.SSCGEN
+    {551U, 3436U}, //GPIOC.OSPEEDR.OSPEEDR0
+    {566U, 3684U}, //GPIOB.LCKR.LCK10
+    {653U, 4277U}, //SPI4.SR.TIFRFE
+    {573U, 3786U}, //GPIOA.IDR.IDR4
+    {321U, 1813U}, //TIM3.EGR.CC4G
+    {467U, 2616U}, //DMA1.LISR.DMEIF1
+    {75U, 480U}, //OTG_FS_DEVICE.DIEPTSIZ3.XFRSIZ
+    {284U, RegisterDbKey::NoField}, //TIM11.DIER
+    {134U, 867U}, //OTG_FS_HOST.FS_HCTSIZ1.XFRSIZ
+    {631U, 4161U}, //SPI1.I2SCFGR.DATLEN
+    {658U, RegisterDbKey::NoField}, //SPI4.I2SCFGR
+    {500U, 2821U}, //DMA1.S4FCR.FTH
+    {337U, RegisterDbKey::NoField}, //TIM4.CR2
+    {542U, 3284U}, //GPIOD.PUPDR.PUPDR7
+    {541U, 3267U}, //GPIOD.OSPEEDR.OSPEEDR8
+    {401U, 2217U}, //USART2.CR1.RWU
+    {155U, 1032U}, //RCC.APB2ENR.ADC1EN
+    {320U, 1809U}, //TIM3.SR.CC2IF
+    {717U, 4499U}, //SCB.ICSR.RETTOBASE
+    {121U, 755U}, //OTG_FS_HOST.FS_HCINT4.FRMOR
+    {218U, 1319U}, //SDIO.MASK.TXFIFOFIE
+    {128U, 822U}, //OTG_FS_HOST.FS_HCINTMSK3.FRMORM
+    {425U, 2425U}, //DMA2.S1CR.DMEIE
+    {69U, 459U}, //OTG_FS_DEVICE.DOEPINT2.STUP
+    {398U, 2198U}, //USART2.SR.NF
+    {541U, 3271U}, //GPIOD.OSPEEDR.OSPEEDR4
+    {534U, 3149U}, //GPIOE.ODR.ODR13
+    {593U, 3953U}, //I2C2.SR1.TIMEOUT
+    {117U, 718U}, //OTG_FS_HOST.FS_HCINT0.BBERR
+    {322U, 1824U}, //TIM3.CCMR1_Output.OC1M
+    {593U, 3954U}, //I2C2.SR1.PECERR
+    {549U, 3400U}, //GPIOC.MODER.MODER4
+    {559U, 3558U}, //GPIOB.MODER.MODER7
+    {488U, RegisterDbKey::NoField}, //DMA1.S2FCR
+    {352U, 1978U}, //TIM4.CCR3.CCR3_L
+    {576U, 3842U}, //GPIOA.LCKR.LCK13
+    {569U, 3716U}, //GPIOA.MODER.MODER10
+    {660U, 4312U}, //SPI5.CR1.MSTR
+    {230U, 1381U}, //TIM1.SMCR.ETF
+    {586U, 3921U}, //I2C3.CCR.F_S
+    {318U, 1789U}, //TIM3.SMCR.SMS
+    {171U, 1163U}, //RTC.ALRMAR.MNT
+    {524U, 2995U}, //GPIOH.ODR.ODR6
+    {403U, 2229U}, //USART2.CR3.CTSIE
+    {358U, 1998U}, //TIM5.SMCR.ETF
+    {532U, 3123U}, //GPIOE.PUPDR.PUPDR7
+    {529U, 3080U}, //GPIOE.MODER.MODER2
+    {503U, 2843U}, //DMA1.S5PAR.PA
+    {660U, 4310U}, //SPI5.CR1.SPE
+    {260U, 1589U}, //TIM8.CCER.CC1NP
+    {204U, RegisterDbKey::NoField}, //SDIO.CLKCR
+    {532U, 3122U}, //GPIOE.PUPDR.PUPDR8
+    {467U, 2603U}, //DMA1.LISR.TCIF3
+    {525U, 3021U}, //GPIOH.BSRR.BS12
+    {449U, 2532U}, //DMA2.S5CR.DIR
+    {146U, 944U}, //RCC.CFGR.MCO1PRE
+    {0U, 3U}, //ADC_Common.CSR.JEOC3
+    {366U, 2070U}, //TIM5.CCER.CC2E
+    {519U, RegisterDbKey::NoField}, //GPIOH.MODER
+    {171U, 1164U}, //RTC.ALRMAR.MNU
+    {570U, 3737U}, //GPIOA.OTYPER.OT5
+    {717U, 4498U}, //SCB.ICSR.VECTACTIVE
+    {400U, 2202U}, //USART2.BRR.DIV_Mantissa
+    {248U, 1476U}, //TIM1.RCR.REP
+    {726U, 4544U}, //SCB.CFSR_UFSR_BFSR_MMFSR.MUNSTKERR
+    {13U, 65U}, //ADC1.SQR1.SQ16
+    {27U, 110U}, //DBG.DBGMCU_APB1_FZ.DBG_I2C3SMBUS_TIMEOUT
+    {437U, RegisterDbKey::NoField}, //DMA2.S3CR
+    {299U, 1699U}, //TIM2.SR.TIF
+    {522U, 2954U}, //GPIOH.PUPDR.PUPDR15
+    {405U, 2247U}, //USART6.SR.IDLE
+    {178U, 1198U}, //RTC.TSSSR.SS
+    {664U, 4332U}, //SPI5.CRCPR.CRCPOLY
+    {14U, 72U}, //ADC1.SQR2.SQ9
+    {403U, 2232U}, //USART2.CR3.DMAT
+    {123U, 768U}, //OTG_FS_HOST.FS_HCINT6.STALL
+    {33U, 214U}, //EXTI.SWIER.SWIER7
+    {443U, 2509U}, //DMA2.S4CR.DMEIE
+    {161U, 1085U}, //RCC.CSR.SFTRSTF
+    {198U, RegisterDbKey::NoField}, //RTC.BKP15R
+    {255U, 1543U}, //TIM8.EGR.CC3G
+    {556U, 3525U}, //GPIOC.LCKR.LCK8
+    {467U, 2608U}, //DMA1.LISR.TCIF2
+    {336U, 1883U}, //TIM4.CR1.URS
+    {30U, 139U}, //EXTI.EMR.MR1
+    {342U, 1927U}, //TIM4.CCMR1_Output.OC2FE
+    {535U, 3188U}, //GPIOE.BSRR.BS6
+    {88U, 542U}, //OTG_FS_GLOBAL.FS_GINTSTS.IEPINT
+    {141U, 889U}, //OTG_FS_PWRCLK.FS_PCGCCTL.GATEHCLK
+    {559U, 3555U}, //GPIOB.MODER.MODER10
+    {651U, RegisterDbKey::NoField}, //SPI4.CR1
+    {555U, 3505U}, //GPIOC.BSRR.BS11
+    {483U, 2750U}, //DMA1.S2CR.CIRC
+    {202U, RegisterDbKey::NoField}, //RTC.BKP19R
+    {230U, 1378U}, //TIM1.SMCR.ETP
+    {568U, 3706U}, //GPIOB.AFRH.AFRH12
+    {545U, 3324U}, //GPIOD.BSRR.BR15
+    {420U, 2399U}, //DMA2.S0NDTR.NDT
+    {260U, 1587U}, //TIM8.CCER.CC2P
+    {495U, 2811U}, //DMA1.S4CR.TEIE
+    {455U, RegisterDbKey::NoField}, //DMA2.S6CR
+    {395U, 2171U}, //USART1.CR2.CPOL
+    {228U, 1364U}, //TIM1.CR1.UDIS
+    {521U, 2953U}, //GPIOH.OSPEEDR.OSPEEDR0
+    {562U, 3608U}, //GPIOB.PUPDR.PUPDR5
+    {60U, 392U}, //OTG_FS_DEVICE.DOEPCTL1.EPTYP
+    {552U, 3444U}, //GPIOC.PUPDR.PUPDR8
+    {533U, 3134U}, //GPIOE.IDR.IDR12
+    {29U, 118U}, //EXTI.IMR.MR3
+    {59U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DOEPCTL0
+    {382U, 2114U}, //TIM9.EGR.UG
+    {391U, 2146U}, //USART1.SR.ORE
+    {579U, 3876U}, //I2C3.CR1.ACK
+    {234U, 1424U}, //TIM1.CCMR1_Output.CC2S
+    {602U, 4006U}, //I2C1.SR1.TIMEOUT
+    {460U, 2574U}, //DMA2.S6FCR.FTH
+    {298U, RegisterDbKey::NoField}, //TIM2.DIER
+    {209U, RegisterDbKey::NoField}, //SDIO.RESP2
+    {365U, 2059U}, //TIM5.CCMR2_Input.IC3F
+    {556U, 3528U}, //GPIOC.LCKR.LCK5
+    {667U, 4338U}, //SPI5.I2SCFGR.PCMSYNC
+    {598U, 3997U}, //I2C1.CR2.FREQ
+    {6U, RegisterDbKey::NoField}, //ADC1.SMPR2
+    {521U, 2939U}, //GPIOH.OSPEEDR.OSPEEDR14
+    {626U, 4146U}, //SPI1.SR.CRCERR
+    {316U, 1776U}, //TIM3.CR1.OPM
+    {119U, 731U}, //OTG_FS_HOST.FS_HCINT2.CHH
+    {388U, RegisterDbKey::NoField}, //TIM9.ARR
+    {419U, 2390U}, //DMA2.S0CR.PINC
+    {298U, 1686U}, //TIM2.DIER.CC2DE
+    {560U, 3567U}, //GPIOB.OTYPER.OT14
+    {446U, 2513U}, //DMA2.S4M0AR.M0A
+    {147U, 968U}, //RCC.CIR.CSSF
+    {572U, 3771U}, //GPIOA.PUPDR.PUPDR3
+    {253U, 1520U}, //TIM8.DIER.TIE
+    {394U, 2162U}, //USART1.CR1.RXNEIE
+    {182U, 1219U}, //RTC.ALRMBSSR.SS
+    {146U, 954U}, //RCC.CFGR.SW0
+    {560U, 3576U}, //GPIOB.OTYPER.OT5
+    {159U, 1071U}, //RCC.APB2LPENR.SYSCFGLPEN
+    {145U, 926U}, //RCC.PLLCFGR.PLLP0
+    {250U, 1487U}, //TIM8.CR1.CMS
+    {415U, 2317U}, //DMA2.LISR.TEIF0
+    {617U, 4100U}, //I2S3ext.SR.MODF
+    {526U, RegisterDbKey::NoField}, //GPIOH.LCKR
+    {395U, 2176U}, //USART1.CR2.ADD
+    {482U, 2734U}, //DMA1.S1FCR.FEIE
+    {408U, 2261U}, //USART6.CR1.PEIE
+    {358U, 1999U}, //TIM5.SMCR.MSM
+    {530U, RegisterDbKey::NoField}, //GPIOE.OTYPER
+    {539U, 3232U}, //GPIOD.MODER.MODER11
+    {701U, 4430U}, //NVIC.IPR17.IPR_N1
+    {507U, 2853U}, //DMA1.S6CR.ACK
+    {147U, 973U}, //RCC.CIR.LSERDYF
+    {288U, RegisterDbKey::NoField}, //TIM11.CCMR1_Input
+    {38U, 264U}, //FLASH.SR.PGAERR
+    {258U, 1568U}, //TIM8.CCMR2_Output.OC3CE
+    {517U, RegisterDbKey::NoField}, //DMA1.S7M1AR
+    {343U, 1937U}, //TIM4.CCMR1_Input.IC1F
+    {230U, 1382U}, //TIM1.SMCR.MSM
+    {369U, RegisterDbKey::NoField}, //TIM5.ARR
+    {234U, 1428U}, //TIM1.CCMR1_Output.OC1FE
+    {180U, RegisterDbKey::NoField}, //RTC.TAFCR
+    {62U, 419U}, //OTG_FS_DEVICE.DOEPCTL3.NAKSTS
+    {546U, 3361U}, //GPIOD.LCKR.LCK11
+    {225U, 1349U}, //SYSCFG.EXTICR3.EXTI10
+    {552U, 3448U}, //GPIOC.PUPDR.PUPDR4
+    {507U, 2864U}, //DMA1.S6CR.PFCTRL
+    {225U, 1351U}, //SYSCFG.EXTICR3.EXTI8
+    {40U, 284U}, //FLASH.OPTCR.nWRP
+    {437U, 2480U}, //DMA2.S3CR.TEIE
+    {507U, 2867U}, //DMA1.S6CR.TEIE
+    {320U, 1805U}, //TIM3.SR.CC1OF
+    {437U, 2465U}, //DMA2.S3CR.PBURST
+    {114U, 691U}, //OTG_FS_HOST.FS_HCCHAR5.CHENA
+    {154U, RegisterDbKey::NoField}, //RCC.APB1ENR
+    {0U, 12U}, //ADC_Common.CSR.OVR1
+    {559U, RegisterDbKey::NoField}, //GPIOB.MODER
+    {545U, 3348U}, //GPIOD.BSRR.BS7
+    {642U, 4224U}, //SPI3.CR1.CPHA
+    {139U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCTSIZ6
+    {31U, 172U}, //EXTI.RTSR.TR11
+    {625U, RegisterDbKey::NoField}, //SPI1.CR2
+    {554U, 3481U}, //GPIOC.ODR.ODR3
+    {114U, 690U}, //OTG_FS_HOST.FS_HCCHAR5.CHDIS
+    {576U, 3843U}, //GPIOA.LCKR.LCK12
+    {132U, 856U}, //OTG_FS_HOST.FS_HCINTMSK7.STALLM
+    {89U, 575U}, //OTG_FS_GLOBAL.FS_GINTMSK.DISCINT
+    {39U, 268U}, //FLASH.CR.PG
+    {1U, 21U}, //ADC_Common.CCR.DMA
+    {401U, 2212U}, //USART2.CR1.TCIE
+    {535U, 3163U}, //GPIOE.BSRR.BR15
+    {283U, 1641U}, //TIM11.CR1.UDIS
+    {95U, RegisterDbKey::NoField}, //OTG_FS_GLOBAL.FS_GNPTXSTS
+    {277U, 1628U}, //TIM10.CCMR1_Input.IC1F
+    {546U, 3364U}, //GPIOD.LCKR.LCK8
+    {524U, 2992U}, //GPIOH.ODR.ODR9
+    {520U, RegisterDbKey::NoField}, //GPIOH.OTYPER
+    {726U, 4546U}, //SCB.CFSR_UFSR_BFSR_MMFSR.MLSPERR
+    {430U, 2432U}, //DMA2.S1FCR.FS
+    {402U, 2221U}, //USART2.CR2.CLKEN
+    {14U, 71U}, //ADC1.SQR2.SQ10
+    {725U, 4542U}, //SCB.SHCRS.USGFAULTENA
+    {158U, 1058U}, //RCC.APB1LPENR.SPI2LPEN
+    {470U, 2665U}, //DMA1.HIFCR.CTEIF7
+    {150U, 995U}, //RCC.APB1RSTR.TIM3RST
+    {400U, RegisterDbKey::NoField}, //USART2.BRR
+    {416U, 2335U}, //DMA2.HISR.TCIF4
+    {33U, 225U}, //EXTI.SWIER.SWIER18
+    {727U, 4562U}, //SCB.HFSR.FORCED
+    {567U, 3700U}, //GPIOB.AFRL.AFRL2
+    {16U, RegisterDbKey::NoField}, //ADC1.JSQR
+    {592U, 3951U}, //I2C2.DR.DR
+    {2U, 29U}, //ADC1.SR.AWD
+    {633U, 4168U}, //SPI2.CR1.CRCEN
+    {252U, 1509U}, //TIM8.SMCR.MSM
+    {124U, 777U}, //OTG_FS_HOST.FS_HCINT7.STALL
+    {329U, 1865U}, //TIM3.ARR.ARR_H
+    {659U, 4299U}, //SPI4.I2SPR.ODD
+    {686U, 4370U}, //NVIC.IPR2.IPR_N1
+    {34U, 237U}, //EXTI.PR.PR7
+    {431U, 2451U}, //DMA2.S2CR.HTIE
+    {577U, 3858U}, //GPIOA.AFRL.AFRL5
+    {83U, 501U}, //OTG_FS_GLOBAL.FS_GOTGCTL.DBCT
+    {570U, 3729U}, //GPIOA.OTYPER.OT13
+    {343U, 1935U}, //TIM4.CCMR1_Input.IC2PCS
+    {283U, 1639U}, //TIM11.CR1.ARPE
+    {317U, 1781U}, //TIM3.CR2.MMS
+    {394U, 2161U}, //USART1.CR1.TCIE
+    {455U, 2549U}, //DMA2.S6CR.PBURST
+    {553U, 3463U}, //GPIOC.IDR.IDR5
+    {525U, 3024U}, //GPIOH.BSRR.BS9
+    {50U, 318U}, //OTG_FS_DEVICE.FS_DAINT.IEPINT
+    {72U, 469U}, //OTG_FS_DEVICE.DOEPTSIZ0.STUPCNT
+    {471U, 2683U}, //DMA1.S0CR.CHSEL
+    {398U, 2197U}, //USART2.SR.ORE
+    {80U, 487U}, //OTG_FS_DEVICE.DOEPTSIZ1.XFRSIZ
+    {39U, 270U}, //FLASH.CR.MER
+    {524U, 2991U}, //GPIOH.ODR.ODR10
+    {83U, 499U}, //OTG_FS_GLOBAL.FS_GOTGCTL.DHNPEN
+    {264U, RegisterDbKey::NoField}, //TIM8.CCR1
+    {552U, 3438U}, //GPIOC.PUPDR.PUPDR14
+    {431U, 2449U}, //DMA2.S2CR.PFCTRL
+    {590U, 3948U}, //I2C2.OAR1.ADD0
+    {30U, 141U}, //EXTI.EMR.MR3
+    {520U, 2926U}, //GPIOH.OTYPER.OT11
+    {549U, 3396U}, //GPIOC.MODER.MODER8
+    {299U, 1701U}, //TIM2.SR.CC3IF
+    {30U, 154U}, //EXTI.EMR.MR16
+    {587U, 3924U}, //I2C3.TRISE.TRISE
+    {218U, 1325U}, //SDIO.MASK.DBCKENDIE
+    {624U, 4133U}, //SPI1.CR1.CPOL
+    {547U, 3373U}, //GPIOD.AFRL.AFRL7
+    {301U, 1713U}, //TIM2.CCMR1_Output.OC2PE
+    {638U, RegisterDbKey::NoField}, //SPI2.RXCRCR
+    {394U, 2165U}, //USART1.CR1.RE
+    {605U, RegisterDbKey::NoField}, //I2C1.TRISE
+    {419U, 2388U}, //DMA2.S0CR.PSIZE
+    {522U, 2968U}, //GPIOH.PUPDR.PUPDR1
+    {635U, 4190U}, //SPI2.SR.MODF
+    {565U, 3660U}, //GPIOB.BSRR.BR1
+    {4U, 49U}, //ADC1.CR2.JEXTSEL
+    {593U, 3955U}, //I2C2.SR1.OVR
+    {285U, 1645U}, //TIM11.SR.CC1OF
+    {63U, 423U}, //OTG_FS_DEVICE.DIEPINT0.TXFE
+    {685U, 4366U}, //NVIC.IPR1.IPR_N1
+    {535U, 3183U}, //GPIOE.BSRR.BS11
+    {624U, 4131U}, //SPI1.CR1.BR
+    {573U, 3775U}, //GPIOA.IDR.IDR15
+    {269U, RegisterDbKey::NoField}, //TIM8.DMAR
+    {549U, 3403U}, //GPIOC.MODER.MODER1
+    {726U, 4551U}, //SCB.CFSR_UFSR_BFSR_MMFSR.UNSTKERR
+    {704U, 4449U}, //FPU.FPCCR.ASPEN
+    {176U, 1186U}, //RTC.TSTR.PM
+    {86U, 518U}, //OTG_FS_GLOBAL.FS_GUSBCFG.FHMOD
+    {186U, RegisterDbKey::NoField}, //RTC.BKP3R
+    {181U, RegisterDbKey::NoField}, //RTC.ALRMASSR
+    {159U, 1064U}, //RCC.APB2LPENR.TIM1LPEN
+    {579U, 3877U}, //I2C3.CR1.STOP
+    {124U, 780U}, //OTG_FS_HOST.FS_HCINT7.TXERR
+    {410U, 2282U}, //USART6.CR3.RTSE
+    {116U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCCHAR7
+    {231U, 1385U}, //TIM1.DIER.TDE
+    {600U, 4003U}, //I2C1.OAR2.ENDUAL
+    {629U, RegisterDbKey::NoField}, //SPI1.RXCRCR
+    {67U, 451U}, //OTG_FS_DEVICE.DOEPINT0.XFRC
+    {550U, 3407U}, //GPIOC.OTYPER.OT13
+    {156U, 1045U}, //RCC.AHB1LPENR.GPIOHLPEN
+    {660U, 4303U}, //SPI5.CR1.CRCEN
+    {128U, RegisterDbKey::NoField}, //OTG_FS_HOST.FS_HCINTMSK3
+    {155U, 1036U}, //RCC.APB2ENR.SYSCFGEN
+    {705U, 4450U}, //FPU.FPCAR.ADDRESS
+    {553U, 3456U}, //GPIOC.IDR.IDR12
+    {477U, 2715U}, //DMA1.S1CR.DBM
+    {197U, RegisterDbKey::NoField}, //RTC.BKP14R
+    {59U, 383U}, //OTG_FS_DEVICE.DOEPCTL0.MPSIZ
+    {477U, 2719U}, //DMA1.S1CR.PSIZE
+    {529U, 3075U}, //GPIOE.MODER.MODER7
+    {567U, 3697U}, //GPIOB.AFRL.AFRL5
+    {590U, 3946U}, //I2C2.OAR1.ADD10
+    {555U, 3509U}, //GPIOC.BSRR.BS7
+    {224U, 1347U}, //SYSCFG.EXTICR2.EXTI4
+    {415U, 2312U}, //DMA2.LISR.TEIF1
+    {148U, 975U}, //RCC.AHB1RSTR.DMA2RST
+    {538U, 3220U}, //GPIOE.AFRH.AFRH15
+    {32U, 198U}, //EXTI.FTSR.TR14
+    {224U, RegisterDbKey::NoField}, //SYSCFG.EXTICR2
+    {535U, 3193U}, //GPIOE.BSRR.BS1
+    {162U, 1095U}, //RCC.SSCGR.MODPER
+    {671U, 4348U}, //NVIC.ISER2.SETENA
+    {555U, 3495U}, //GPIOC.BSRR.BR5
+    {136U, 875U}, //OTG_FS_HOST.FS_HCTSIZ3.DPID
+    {667U, 4342U}, //SPI5.I2SCFGR.CHLEN
+    {340U, 1913U}, //TIM4.SR.CC4IF
+    {94U, 592U}, //OTG_FS_GLOBAL.FS_GNPTXFSIZ_Host.NPTXFD
+    {173U, RegisterDbKey::NoField}, //RTC.WPR
+    {32U, 204U}, //EXTI.FTSR.TR20
+    {159U, 1068U}, //RCC.APB2LPENR.SDIOLPEN
+    {545U, 3331U}, //GPIOD.BSRR.BR8
+    {704U, 4448U}, //FPU.FPCCR.LSPEN
+    {455U, 2555U}, //DMA2.S6CR.MSIZE
+    {660U, 4306U}, //SPI5.CR1.RXONLY
+    {379U, 2098U}, //TIM9.SMCR.MSM
+    {260U, 1590U}, //TIM8.CCER.CC1NE
+    {556U, 3517U}, //GPIOC.LCKR.LCKK
+    {571U, 3751U}, //GPIOA.OSPEEDR.OSPEEDR7
+    {218U, 1324U}, //SDIO.MASK.CMDACTIE
+    {89U, 561U}, //OTG_FS_GLOBAL.FS_GINTMSK.USBSUSPM
+    {45U, 290U}, //OTG_FS_DEVICE.FS_DCFG.DSPD
+    {58U, 370U}, //OTG_FS_DEVICE.DIEPCTL3.NAKSTS
+    {56U, 339U}, //OTG_FS_DEVICE.DIEPCTL1.SNAK
+    {467U, 2610U}, //DMA1.LISR.TEIF2
+    {201U, 1238U}, //RTC.BKP18R.BKP
+    {315U, RegisterDbKey::NoField}, //TIM2.OR
+    {342U, 1931U}, //TIM4.CCMR1_Output.OC1PE
+    {513U, 2881U}, //DMA1.S7CR.ACK
+    {513U, 2883U}, //DMA1.S7CR.DBM
+    {246U, 1473U}, //TIM1.DCR.DBL
+    {66U, 441U}, //OTG_FS_DEVICE.DIEPINT3.TXFE
+    {576U, 3851U}, //GPIOA.LCKR.LCK4
+    {180U, 1206U}, //RTC.TAFCR.TAMPPUDIS
+    {565U, 3652U}, //GPIOB.BSRR.BR9
+    {714U, RegisterDbKey::NoField}, //STK.VAL
+    {104U, 612U}, //OTG_FS_HOST.FS_HFNUM.FRNUM
+    {425U, 2418U}, //DMA2.S1CR.PINC
+    {148U, 980U}, //RCC.AHB1RSTR.GPIODRST
+    {495U, 2797U}, //DMA1.S4CR.ACK
+    {156U, 1047U}, //RCC.AHB1LPENR.GPIODLPEN
+    {555U, 3503U}, //GPIOC.BSRR.BS13
+    {468U, 2633U}, //DMA1.HISR.TCIF5
+    {218U, 1323U}, //SDIO.MASK.TXACTIE
+    {563U, 3616U}, //GPIOB.IDR.IDR13
+    {98U, 602U}, //OTG_FS_GLOBAL.FS_HPTXFSIZ.PTXFSIZ
+    {95U, 593U}, //OTG_FS_GLOBAL.FS_GNPTXSTS.NPTXFSAV
+    {117U, 717U}, //OTG_FS_HOST.FS_HCINT0.TXERR
+    {176U, 1188U}, //RTC.TSTR.HU
+    {221U, RegisterDbKey::NoField}, //SYSCFG.MEMRM
+    {15U, RegisterDbKey::NoField}, //ADC1.SQR3
+    {405U, 2243U}, //USART6.SR.LBD
+    {300U, 1706U}, //TIM2.EGR.CC4G
+    {632U, 4164U}, //SPI1.I2SPR.ODD
+    {536U, 3206U}, //GPIOE.LCKR.LCK5
+    {462U, RegisterDbKey::NoField}, //DMA2.S7NDTR
+    {575U, 3825U}, //GPIOA.BSRR.BS13
+    {325U, 1847U}, //TIM3.CCMR2_Input.IC3F
+    {533U, 3139U}, //GPIOE.IDR.IDR7
+    {65U, RegisterDbKey::NoField}, //OTG_FS_DEVICE.DIEPINT2
+    {622U, 4115U}, //I2S3ext.I2SCFGR.CKPOL
+    {360U, 2018U}, //TIM5.SR.TIF
+    {653U, RegisterDbKey::NoField}, //SPI4.SR
+    {541U, 3261U}, //GPIOD.OSPEEDR.OSPEEDR14
+    {523U, 2979U}, //GPIOH.IDR.IDR6
+    {620U, 4108U}, //I2S3ext.RXCRCR.RxCRC
+    {531U, 3107U}, //GPIOE.OSPEEDR.OSPEEDR7
+    {231U, 1395U}, //TIM1.DIER.CC4IE
+    {383U, 2119U}, //TIM9.CCMR1_Output.OC1M
+    {154U, 1027U}, //RCC.APB1ENR.TIM3EN
+    {70U, 463U}, //OTG_FS_DEVICE.DOEPINT3.OTEPDIS
+    {29U, RegisterDbKey::NoField}, //EXTI.IMR
+    {525U, 3012U}, //GPIOH.BSRR.BR5
+    {525U, 3005U}, //GPIOH.BSRR.BR12
+    {89U, 566U}, //OTG_FS_GLOBAL.FS_GINTMSK.EPMISM
+  } ;
+} ;
+
+#endif //#if !defined(REGISTERDB_HPP)
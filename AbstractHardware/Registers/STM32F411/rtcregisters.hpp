@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct RTC
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40002800U ;
+
   struct RTCTRBase {} ;
 
   struct TR : public RegisterBase<0x40002800, 32, ReadWriteMode>
@@ -28,6 +33,11 @@ struct RTC
     using MNU = RTC_TR_MNU_Values<RTC::TR, 8, 4, ReadWriteMode, RTCTRBase> ;
     using ST = RTC_TR_ST_Values<RTC::TR, 4, 3, ReadWriteMode, RTCTRBase> ;
     using SU = RTC_TR_SU_Values<RTC::TR, 0, 4, ReadWriteMode, RTCTRBase> ;
+    static constexpr Type VolatileMask = 0x7F7F7FU ;
+    static constexpr Type WritableMask = 0x7F7F7FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_TR_SU_Values<RTC::TR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -45,6 +55,11 @@ struct RTC
     using MU = RTC_DR_MU_Values<RTC::DR, 8, 4, ReadWriteMode, RTCDRBase> ;
     using DT = RTC_DR_DT_Values<RTC::DR, 4, 2, ReadWriteMode, RTCDRBase> ;
     using DU = RTC_DR_DU_Values<RTC::DR, 0, 4, ReadWriteMode, RTCDRBase> ;
+    static constexpr Type VolatileMask = 0xFFFF3FU ;
+    static constexpr Type WritableMask = 0xFFFF3FU ;
+    static constexpr Type ResetValue = 0x2101U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_DR_DU_Values<RTC::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +91,9 @@ struct RTC
     using REFCKON = RTC_CR_REFCKON_Values<RTC::CR, 4, 1, ReadWriteMode, RTCCRBase> ;
     using TSEDGE = RTC_CR_TSEDGE_Values<RTC::CR, 3, 1, ReadWriteMode, RTCCRBase> ;
     using WCKSEL = RTC_CR_WCKSEL_Values<RTC::CR, 0, 3, ReadWriteMode, RTCCRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_CR_WCKSEL_Values<RTC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +120,12 @@ struct RTC
     using TAMP1F = RTC_ISR_TAMP1F_Values<RTC::ISR, 13, 1, ReadWriteMode, RTCISRBase> ;
     using TAMP2F = RTC_ISR_TAMP2F_Values<RTC::ISR, 14, 1, ReadWriteMode, RTCISRBase> ;
     using RECALPF = RTC_ISR_RECALPF_Values<RTC::ISR, 16, 1, ReadMode, RTCISRBase> ;
+    static constexpr Type VolatileMask = 0x17FFFU ;
+    static constexpr Type WritableMask = 0x7FA8U ;
+    static constexpr Type ZeroToClearMask = 0x7F20U ;
+    static constexpr Type ResetValue = 0x7U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_ISR_RECALPF_Values<RTC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +138,9 @@ struct RTC
   {
     using PREDIV_A = RTC_PRER_PREDIV_A_Values<RTC::PRER, 16, 7, ReadWriteMode, RTCPRERBase> ;
     using PREDIV_S = RTC_PRER_PREDIV_S_Values<RTC::PRER, 0, 15, ReadWriteMode, RTCPRERBase> ;
+    static constexpr Type WritableMask = 0x7F7FFFU ;
+    static constexpr Type ResetValue = 0x7F00FFU ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_PRER_PREDIV_S_Values<RTC::PRER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +152,9 @@ struct RTC
   struct WUTR : public RegisterBase<0x40002814, 32, ReadWriteMode>
   {
     using WUT = RTC_WUTR_WUT_Values<RTC::WUTR, 0, 16, ReadWriteMode, RTCWUTRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0xFFFFU ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_WUTR_WUT_Values<RTC::WUTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +167,9 @@ struct RTC
   {
     using DCS = RTC_CALIBR_DCS_Values<RTC::CALIBR, 7, 1, ReadWriteMode, RTCCALIBRBase> ;
     using DC = RTC_CALIBR_DC_Values<RTC::CALIBR, 0, 5, ReadWriteMode, RTCCALIBRBase> ;
+    static constexpr Type WritableMask = 0x9FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_CALIBR_DC_Values<RTC::CALIBR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +194,12 @@ struct RTC
     using MSK1 = RTC_ALRMAR_MSK1_Values<RTC::ALRMAR, 7, 1, ReadWriteMode, RTCALRMARBase> ;
     using ST = RTC_ALRMAR_ST_Values<RTC::ALRMAR, 4, 3, ReadWriteMode, RTCALRMARBase> ;
     using SU = RTC_ALRMAR_SU_Values<RTC::ALRMAR, 0, 4, ReadWriteMode, RTCALRMARBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using MSKArray = FieldArray<1U, MSK1, MSK2, MSK3, MSK4> ;
+    template<std::size_t index>
+    using Field = typename MSKArray::template Field<index> ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_ALRMAR_SU_Values<RTC::ALRMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -185,6 +224,12 @@ struct RTC
     using MSK1 = RTC_ALRMBR_MSK1_Values<RTC::ALRMBR, 7, 1, ReadWriteMode, RTCALRMBRBase> ;
     using ST = RTC_ALRMBR_ST_Values<RTC::ALRMBR, 4, 3, ReadWriteMode, RTCALRMBRBase> ;
     using SU = RTC_ALRMBR_SU_Values<RTC::ALRMBR, 0, 4, ReadWriteMode, RTCALRMBRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using MSKArray = FieldArray<1U, MSK1, MSK2, MSK3, MSK4> ;
+    template<std::size_t index>
+    using Field = typename MSKArray::template Field<index> ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_ALRMBR_SU_Values<RTC::ALRMBR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +241,9 @@ struct RTC
   struct WPR : public RegisterBase<0x40002824, 32, WriteMode>
   {
     using KEY = RTC_WPR_KEY_Values<RTC::WPR, 0, 8, WriteMode, RTCWPRBase> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_WPR_KEY_Values<RTC::WPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +255,9 @@ struct RTC
   struct SSR : public RegisterBase<0x40002828, 32, ReadMode>
   {
     using SS = RTC_SSR_SS_Values<RTC::SSR, 0, 16, ReadMode, RTCSSRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_SSR_SS_Values<RTC::SSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +270,9 @@ struct RTC
   {
     using ADD1S = RTC_SHIFTR_ADD1S_Values<RTC::SHIFTR, 31, 1, WriteMode, RTCSHIFTRBase> ;
     using SUBFS = RTC_SHIFTR_SUBFS_Values<RTC::SHIFTR, 0, 15, WriteMode, RTCSHIFTRBase> ;
+    static constexpr Type WritableMask = 0x80007FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_SHIFTR_SUBFS_Values<RTC::SHIFTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,6 +290,9 @@ struct RTC
     using MNU = RTC_TSTR_MNU_Values<RTC::TSTR, 8, 4, ReadMode, RTCTSTRBase> ;
     using ST = RTC_TSTR_ST_Values<RTC::TSTR, 4, 3, ReadMode, RTCTSTRBase> ;
     using SU = RTC_TSTR_SU_Values<RTC::TSTR, 0, 4, ReadMode, RTCTSTRBase> ;
+    static constexpr Type VolatileMask = 0x7F7F7FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_TSTR_SU_Values<RTC::TSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +308,9 @@ struct RTC
     using MU = RTC_TSDR_MU_Values<RTC::TSDR, 8, 4, ReadMode, RTCTSDRBase> ;
     using DT = RTC_TSDR_DT_Values<RTC::TSDR, 4, 2, ReadMode, RTCTSDRBase> ;
     using DU = RTC_TSDR_DU_Values<RTC::TSDR, 0, 4, ReadMode, RTCTSDRBase> ;
+    static constexpr Type VolatileMask = 0xFF3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_TSDR_DU_Values<RTC::TSDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +322,9 @@ struct RTC
   struct TSSSR : public RegisterBase<0x40002838, 32, ReadMode>
   {
     using SS = RTC_TSSSR_SS_Values<RTC::TSSSR, 0, 16, ReadMode, RTCTSSSRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_TSSSR_SS_Values<RTC::TSSSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -276,6 +339,9 @@ struct RTC
     using CALW8 = RTC_CALR_CALW8_Values<RTC::CALR, 14, 1, ReadWriteMode, RTCCALRBase> ;
     using CALW16 = RTC_CALR_CALW16_Values<RTC::CALR, 13, 1, ReadWriteMode, RTCCALRBase> ;
     using CALM = RTC_CALR_CALM_Values<RTC::CALR, 0, 9, ReadWriteMode, RTCCALRBase> ;
+    static constexpr Type WritableMask = 0xE1FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_CALR_CALM_Values<RTC::CALR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -299,6 +365,9 @@ struct RTC
     using TAMPIE = RTC_TAFCR_TAMPIE_Values<RTC::TAFCR, 2, 1, ReadWriteMode, RTCTAFCRBase> ;
     using TAMP1TRG = RTC_TAFCR_TAMP1TRG_Values<RTC::TAFCR, 1, 1, ReadWriteMode, RTCTAFCRBase> ;
     using TAMP1E = RTC_TAFCR_TAMP1E_Values<RTC::TAFCR, 0, 1, ReadWriteMode, RTCTAFCRBase> ;
+    static constexpr Type WritableMask = 0x7FF9FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_TAFCR_TAMP1E_Values<RTC::TAFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -311,6 +380,9 @@ struct RTC
   {
     using MASKSS = RTC_ALRMASSR_MASKSS_Values<RTC::ALRMASSR, 24, 4, ReadWriteMode, RTCALRMASSRBase> ;
     using SS = RTC_ALRMASSR_SS_Values<RTC::ALRMASSR, 0, 15, ReadWriteMode, RTCALRMASSRBase> ;
+    static constexpr Type WritableMask = 0xF007FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_ALRMASSR_SS_Values<RTC::ALRMASSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -323,6 +395,9 @@ struct RTC
   {
     using MASKSS = RTC_ALRMBSSR_MASKSS_Values<RTC::ALRMBSSR, 24, 4, ReadWriteMode, RTCALRMBSSRBase> ;
     using SS = RTC_ALRMBSSR_SS_Values<RTC::ALRMBSSR, 0, 15, ReadWriteMode, RTCALRMBSSRBase> ;
+    static constexpr Type WritableMask = 0xF007FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_ALRMBSSR_SS_Values<RTC::ALRMBSSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -334,6 +409,9 @@ struct RTC
   struct BKP0R : public RegisterBase<0x40002850, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP0R_BKP_Values<RTC::BKP0R, 0, 32, ReadWriteMode, RTCBKP0RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP0R_BKP_Values<RTC::BKP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -345,6 +423,9 @@ struct RTC
   struct BKP1R : public RegisterBase<0x40002854, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP1R_BKP_Values<RTC::BKP1R, 0, 32, ReadWriteMode, RTCBKP1RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP1R_BKP_Values<RTC::BKP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -356,6 +437,9 @@ struct RTC
   struct BKP2R : public RegisterBase<0x40002858, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP2R_BKP_Values<RTC::BKP2R, 0, 32, ReadWriteMode, RTCBKP2RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP2R_BKP_Values<RTC::BKP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -367,6 +451,9 @@ struct RTC
   struct BKP3R : public RegisterBase<0x4000285C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP3R_BKP_Values<RTC::BKP3R, 0, 32, ReadWriteMode, RTCBKP3RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP3R_BKP_Values<RTC::BKP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -378,6 +465,9 @@ struct RTC
   struct BKP4R : public RegisterBase<0x40002860, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP4R_BKP_Values<RTC::BKP4R, 0, 32, ReadWriteMode, RTCBKP4RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP4R_BKP_Values<RTC::BKP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -389,6 +479,9 @@ struct RTC
   struct BKP5R : public RegisterBase<0x40002864, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP5R_BKP_Values<RTC::BKP5R, 0, 32, ReadWriteMode, RTCBKP5RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP5R_BKP_Values<RTC::BKP5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -400,6 +493,9 @@ struct RTC
   struct BKP6R : public RegisterBase<0x40002868, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP6R_BKP_Values<RTC::BKP6R, 0, 32, ReadWriteMode, RTCBKP6RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP6R_BKP_Values<RTC::BKP6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -411,6 +507,9 @@ struct RTC
   struct BKP7R : public RegisterBase<0x4000286C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP7R_BKP_Values<RTC::BKP7R, 0, 32, ReadWriteMode, RTCBKP7RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP7R_BKP_Values<RTC::BKP7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -422,6 +521,9 @@ struct RTC
   struct BKP8R : public RegisterBase<0x40002870, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP8R_BKP_Values<RTC::BKP8R, 0, 32, ReadWriteMode, RTCBKP8RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP8R_BKP_Values<RTC::BKP8R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -433,6 +535,9 @@ struct RTC
   struct BKP9R : public RegisterBase<0x40002874, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP9R_BKP_Values<RTC::BKP9R, 0, 32, ReadWriteMode, RTCBKP9RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP9R_BKP_Values<RTC::BKP9R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -444,6 +549,9 @@ struct RTC
   struct BKP10R : public RegisterBase<0x40002878, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP10R_BKP_Values<RTC::BKP10R, 0, 32, ReadWriteMode, RTCBKP10RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP10R_BKP_Values<RTC::BKP10R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -455,6 +563,9 @@ struct RTC
   struct BKP11R : public RegisterBase<0x4000287C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP11R_BKP_Values<RTC::BKP11R, 0, 32, ReadWriteMode, RTCBKP11RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP11R_BKP_Values<RTC::BKP11R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -466,6 +577,9 @@ struct RTC
   struct BKP12R : public RegisterBase<0x40002880, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP12R_BKP_Values<RTC::BKP12R, 0, 32, ReadWriteMode, RTCBKP12RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP12R_BKP_Values<RTC::BKP12R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -477,6 +591,9 @@ struct RTC
   struct BKP13R : public RegisterBase<0x40002884, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP13R_BKP_Values<RTC::BKP13R, 0, 32, ReadWriteMode, RTCBKP13RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP13R_BKP_Values<RTC::BKP13R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -488,6 +605,9 @@ struct RTC
   struct BKP14R : public RegisterBase<0x40002888, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP14R_BKP_Values<RTC::BKP14R, 0, 32, ReadWriteMode, RTCBKP14RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP14R_BKP_Values<RTC::BKP14R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -499,6 +619,9 @@ struct RTC
   struct BKP15R : public RegisterBase<0x4000288C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP15R_BKP_Values<RTC::BKP15R, 0, 32, ReadWriteMode, RTCBKP15RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP15R_BKP_Values<RTC::BKP15R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -510,6 +633,9 @@ struct RTC
   struct BKP16R : public RegisterBase<0x40002890, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP16R_BKP_Values<RTC::BKP16R, 0, 32, ReadWriteMode, RTCBKP16RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP16R_BKP_Values<RTC::BKP16R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -521,6 +647,9 @@ struct RTC
   struct BKP17R : public RegisterBase<0x40002894, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP17R_BKP_Values<RTC::BKP17R, 0, 32, ReadWriteMode, RTCBKP17RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP17R_BKP_Values<RTC::BKP17R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -532,6 +661,9 @@ struct RTC
   struct BKP18R : public RegisterBase<0x40002898, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP18R_BKP_Values<RTC::BKP18R, 0, 32, ReadWriteMode, RTCBKP18RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP18R_BKP_Values<RTC::BKP18R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -543,12 +675,22 @@ struct RTC
   struct BKP19R : public RegisterBase<0x4000289C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP19R_BKP_Values<RTC::BKP19R, 0, 32, ReadWriteMode, RTCBKP19RBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = RTC ;
     using FieldValues = RTC_BKP19R_BKP_Values<RTC::BKP19R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BKP19RPack  = Register<0x4000289C, 32, ReadWriteMode, RTCBKP19RBase, T...> ;
 
+  template<std::size_t index>
+  struct BKP
+  {
+    using R = IndexedType<index, 0U, RTC::BKP0R, RTC::BKP1R, RTC::BKP2R, RTC::BKP3R, RTC::BKP4R, RTC::BKP5R, RTC::BKP6R, RTC::BKP7R, RTC::BKP8R, RTC::BKP9R, RTC::BKP10R, RTC::BKP11R, RTC::BKP12R, RTC::BKP13R, RTC::BKP14R, RTC::BKP15R, RTC::BKP16R, RTC::BKP17R, RTC::BKP18R, RTC::BKP19R> ;
+  } ;
+
+  using Registers = TypesList<RTC::TR, RTC::DR, RTC::CR, RTC::ISR, RTC::PRER, RTC::WUTR, RTC::CALIBR, RTC::ALRMAR, RTC::ALRMBR, RTC::WPR, RTC::SSR, RTC::SHIFTR, RTC::TSTR, RTC::TSDR, RTC::TSSSR, RTC::CALR, RTC::TAFCR, RTC::ALRMASSR, RTC::ALRMBSSR, RTC::BKP0R, RTC::BKP1R, RTC::BKP2R, RTC::BKP3R, RTC::BKP4R, RTC::BKP5R, RTC::BKP6R, RTC::BKP7R, RTC::BKP8R, RTC::BKP9R, RTC::BKP10R, RTC::BKP11R, RTC::BKP12R, RTC::BKP13R, RTC::BKP14R, RTC::BKP15R, RTC::BKP16R, RTC::BKP17R, RTC::BKP18R, RTC::BKP19R> ;
 } ;
 
 #endif //#if !defined(RTCREGISTERS_HPP)
@@ -14,14 +14,22 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SDIO
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40012C00U ;
+
   struct SDIOPOWERBase {} ;
 
   struct POWER : public RegisterBase<0x40012C00, 32, ReadWriteMode>
   {
     using PWRCTRL = SDIO_POWER_PWRCTRL_Values<SDIO::POWER, 0, 2, ReadWriteMode, SDIOPOWERBase> ;
+    static constexpr Type WritableMask = 0x3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_POWER_PWRCTRL_Values<SDIO::POWER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -39,6 +47,9 @@ struct SDIO
     using PWRSAV = SDIO_CLKCR_PWRSAV_Values<SDIO::CLKCR, 9, 1, ReadWriteMode, SDIOCLKCRBase> ;
     using CLKEN = SDIO_CLKCR_CLKEN_Values<SDIO::CLKCR, 8, 1, ReadWriteMode, SDIOCLKCRBase> ;
     using CLKDIV = SDIO_CLKCR_CLKDIV_Values<SDIO::CLKCR, 0, 8, ReadWriteMode, SDIOCLKCRBase> ;
+    static constexpr Type WritableMask = 0x7FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_CLKCR_CLKDIV_Values<SDIO::CLKCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +61,9 @@ struct SDIO
   struct ARG : public RegisterBase<0x40012C08, 32, ReadWriteMode>
   {
     using CMDARG = SDIO_ARG_CMDARG_Values<SDIO::ARG, 0, 32, ReadWriteMode, SDIOARGBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_ARG_CMDARG_Values<SDIO::ARG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +83,9 @@ struct SDIO
     using WAITINT = SDIO_CMD_WAITINT_Values<SDIO::CMD, 8, 1, ReadWriteMode, SDIOCMDBase> ;
     using WAITRESP = SDIO_CMD_WAITRESP_Values<SDIO::CMD, 6, 2, ReadWriteMode, SDIOCMDBase> ;
     using CMDINDEX = SDIO_CMD_CMDINDEX_Values<SDIO::CMD, 0, 6, ReadWriteMode, SDIOCMDBase> ;
+    static constexpr Type WritableMask = 0x7FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_CMD_CMDINDEX_Values<SDIO::CMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +97,9 @@ struct SDIO
   struct RESPCMD : public RegisterBase<0x40012C10, 32, ReadMode>
   {
     using RESPCMDField = SDIO_RESPCMD_RESPCMD_Values<SDIO::RESPCMD, 0, 6, ReadMode, SDIORESPCMDBase> ;
+    static constexpr Type VolatileMask = 0x3FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_RESPCMD_RESPCMD_Values<SDIO::RESPCMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +111,9 @@ struct SDIO
   struct RESP1 : public RegisterBase<0x40012C14, 32, ReadMode>
   {
     using CARDSTATUS1 = SDIO_RESP1_CARDSTATUS1_Values<SDIO::RESP1, 0, 32, ReadMode, SDIORESP1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_RESP1_CARDSTATUS1_Values<SDIO::RESP1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +125,9 @@ struct SDIO
   struct RESP2 : public RegisterBase<0x40012C18, 32, ReadMode>
   {
     using CARDSTATUS2 = SDIO_RESP2_CARDSTATUS2_Values<SDIO::RESP2, 0, 32, ReadMode, SDIORESP2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_RESP2_CARDSTATUS2_Values<SDIO::RESP2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -113,6 +139,9 @@ struct SDIO
   struct RESP3 : public RegisterBase<0x40012C1C, 32, ReadMode>
   {
     using CARDSTATUS3 = SDIO_RESP3_CARDSTATUS3_Values<SDIO::RESP3, 0, 32, ReadMode, SDIORESP3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_RESP3_CARDSTATUS3_Values<SDIO::RESP3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -124,6 +153,9 @@ struct SDIO
   struct RESP4 : public RegisterBase<0x40012C20, 32, ReadMode>
   {
     using CARDSTATUS4 = SDIO_RESP4_CARDSTATUS4_Values<SDIO::RESP4, 0, 32, ReadMode, SDIORESP4Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_RESP4_CARDSTATUS4_Values<SDIO::RESP4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +167,9 @@ struct SDIO
   struct DTIMER : public RegisterBase<0x40012C24, 32, ReadWriteMode>
   {
     using DATATIME = SDIO_DTIMER_DATATIME_Values<SDIO::DTIMER, 0, 32, ReadWriteMode, SDIODTIMERBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_DTIMER_DATATIME_Values<SDIO::DTIMER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +181,9 @@ struct SDIO
   struct DLEN : public RegisterBase<0x40012C28, 32, ReadWriteMode>
   {
     using DATALENGTH = SDIO_DLEN_DATALENGTH_Values<SDIO::DLEN, 0, 25, ReadWriteMode, SDIODLENBase> ;
+    static constexpr Type WritableMask = 0x1FFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_DLEN_DATALENGTH_Values<SDIO::DLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +203,9 @@ struct SDIO
     using DTMODE = SDIO_DCTRL_DTMODE_Values<SDIO::DCTRL, 2, 1, ReadWriteMode, SDIODCTRLBase> ;
     using DTDIR = SDIO_DCTRL_DTDIR_Values<SDIO::DCTRL, 1, 1, ReadWriteMode, SDIODCTRLBase> ;
     using DTEN = SDIO_DCTRL_DTEN_Values<SDIO::DCTRL, 0, 1, ReadWriteMode, SDIODCTRLBase> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_DCTRL_DTEN_Values<SDIO::DCTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -176,6 +217,9 @@ struct SDIO
   struct DCOUNT : public RegisterBase<0x40012C30, 32, ReadMode>
   {
     using DATACOUNT = SDIO_DCOUNT_DATACOUNT_Values<SDIO::DCOUNT, 0, 25, ReadMode, SDIODCOUNTBase> ;
+    static constexpr Type VolatileMask = 0x1FFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_DCOUNT_DATACOUNT_Values<SDIO::DCOUNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +254,9 @@ struct SDIO
     using CTIMEOUT = SDIO_STA_CTIMEOUT_Values<SDIO::STA, 2, 1, ReadMode, SDIOSTABase> ;
     using DCRCFAIL = SDIO_STA_DCRCFAIL_Values<SDIO::STA, 1, 1, ReadMode, SDIOSTABase> ;
     using CCRCFAIL = SDIO_STA_CCRCFAIL_Values<SDIO::STA, 0, 1, ReadMode, SDIOSTABase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_STA_CCRCFAIL_Values<SDIO::STA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +280,9 @@ struct SDIO
     using CTIMEOUTC = SDIO_ICR_CTIMEOUTC_Values<SDIO::ICR, 2, 1, ReadWriteMode, SDIOICRBase> ;
     using DCRCFAILC = SDIO_ICR_DCRCFAILC_Values<SDIO::ICR, 1, 1, ReadWriteMode, SDIOICRBase> ;
     using CCRCFAILC = SDIO_ICR_CCRCFAILC_Values<SDIO::ICR, 0, 1, ReadWriteMode, SDIOICRBase> ;
+    static constexpr Type WritableMask = 0xC007FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_ICR_CCRCFAILC_Values<SDIO::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -267,6 +317,9 @@ struct SDIO
     using CTIMEOUTIE = SDIO_MASK_CTIMEOUTIE_Values<SDIO::MASK, 2, 1, ReadWriteMode, SDIOMASKBase> ;
     using DCRCFAILIE = SDIO_MASK_DCRCFAILIE_Values<SDIO::MASK, 1, 1, ReadWriteMode, SDIOMASKBase> ;
     using CCRCFAILIE = SDIO_MASK_CCRCFAILIE_Values<SDIO::MASK, 0, 1, ReadWriteMode, SDIOMASKBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_MASK_CCRCFAILIE_Values<SDIO::MASK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -278,6 +331,9 @@ struct SDIO
   struct FIFOCNT : public RegisterBase<0x40012C48, 32, ReadMode>
   {
     using FIFOCOUNT = SDIO_FIFOCNT_FIFOCOUNT_Values<SDIO::FIFOCNT, 0, 24, ReadMode, SDIOFIFOCNTBase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_FIFOCNT_FIFOCOUNT_Values<SDIO::FIFOCNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,12 +345,19 @@ struct SDIO
   struct FIFO : public RegisterBase<0x40012C80, 32, ReadWriteMode>
   {
     using FIFOData = SDIO_FIFO_FIFOData_Values<SDIO::FIFO, 0, 32, ReadWriteMode, SDIOFIFOBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SDIO ;
     using FieldValues = SDIO_FIFO_FIFOData_Values<SDIO::FIFO, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FIFOPack  = Register<0x40012C80, 32, ReadWriteMode, SDIOFIFOBase, T...> ;
 
+  template<std::size_t index>
+  using RESP = IndexedType<index, 1U, SDIO::RESP1, SDIO::RESP2, SDIO::RESP3, SDIO::RESP4> ;
+
+  using Registers = TypesList<SDIO::POWER, SDIO::CLKCR, SDIO::ARG, SDIO::CMD, SDIO::RESPCMD, SDIO::RESP1, SDIO::RESP2, SDIO::RESP3, SDIO::RESP4, SDIO::DTIMER, SDIO::DLEN, SDIO::DCTRL, SDIO::DCOUNT, SDIO::STA, SDIO::ICR, SDIO::MASK, SDIO::FIFOCNT, SDIO::FIFO> ;
 } ;
 
 #endif //#if !defined(SDIOREGISTERS_HPP)
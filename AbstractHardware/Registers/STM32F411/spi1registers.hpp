@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SPI1
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40013000U ;
+
   struct SPI1CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40013000, 32, ReadWriteMode>
@@ -35,6 +40,11 @@ struct SPI1
     using MSTR = SPI1_CR1_MSTR_Values<SPI1::CR1, 2, 1, ReadWriteMode, SPI1CR1Base> ;
     using CPOL = SPI1_CR1_CPOL_Values<SPI1::CR1, 1, 1, ReadWriteMode, SPI1CR1Base> ;
     using CPHA = SPI1_CR1_CPHA_Values<SPI1::CR1, 0, 1, ReadWriteMode, SPI1CR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_CR1_CPHA_Values<SPI1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +62,9 @@ struct SPI1
     using SSOE = SPI1_CR2_SSOE_Values<SPI1::CR2, 2, 1, ReadWriteMode, SPI1CR2Base> ;
     using TXDMAEN = SPI1_CR2_TXDMAEN_Values<SPI1::CR2, 1, 1, ReadWriteMode, SPI1CR2Base> ;
     using RXDMAEN = SPI1_CR2_RXDMAEN_Values<SPI1::CR2, 0, 1, ReadWriteMode, SPI1CR2Base> ;
+    static constexpr Type WritableMask = 0xF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_CR2_RXDMAEN_Values<SPI1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +84,12 @@ struct SPI1
     using CHSIDE = SPI1_SR_CHSIDE_Values<SPI1::SR, 2, 1, ReadMode, SPI1SRBase> ;
     using TXE = SPI1_SR_TXE_Values<SPI1::SR, 1, 1, ReadMode, SPI1SRBase> ;
     using RXNE = SPI1_SR_RXNE_Values<SPI1::SR, 0, 1, ReadMode, SPI1SRBase> ;
+    static constexpr Type VolatileMask = 0x1FFU ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type ResetValue = 0x2U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_SR_RXNE_Values<SPI1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +101,11 @@ struct SPI1
   struct DR : public RegisterBase<0x4001300C, 32, ReadWriteMode>
   {
     using DRField = SPI1_DR_DR_Values<SPI1::DR, 0, 16, ReadWriteMode, SPI1DRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_DR_DR_Values<SPI1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +117,9 @@ struct SPI1
   struct CRCPR : public RegisterBase<0x40013010, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI1_CRCPR_CRCPOLY_Values<SPI1::CRCPR, 0, 16, ReadWriteMode, SPI1CRCPRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x7U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_CRCPR_CRCPOLY_Values<SPI1::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +131,9 @@ struct SPI1
   struct RXCRCR : public RegisterBase<0x40013014, 32, ReadMode>
   {
     using RxCRC = SPI1_RXCRCR_RxCRC_Values<SPI1::RXCRCR, 0, 16, ReadMode, SPI1RXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_RXCRCR_RxCRC_Values<SPI1::RXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +145,9 @@ struct SPI1
   struct TXCRCR : public RegisterBase<0x40013018, 32, ReadMode>
   {
     using TxCRC = SPI1_TXCRCR_TxCRC_Values<SPI1::TXCRCR, 0, 16, ReadMode, SPI1TXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_TXCRCR_TxCRC_Values<SPI1::TXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +166,11 @@ struct SPI1
     using CKPOL = SPI1_I2SCFGR_CKPOL_Values<SPI1::I2SCFGR, 3, 1, ReadWriteMode, SPI1I2SCFGRBase> ;
     using DATLEN = SPI1_I2SCFGR_DATLEN_Values<SPI1::I2SCFGR, 1, 2, ReadWriteMode, SPI1I2SCFGRBase> ;
     using CHLEN = SPI1_I2SCFGR_CHLEN_Values<SPI1::I2SCFGR, 0, 1, ReadWriteMode, SPI1I2SCFGRBase> ;
+    static constexpr Type WritableMask = 0xFBFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_I2SCFGR_CHLEN_Values<SPI1::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +184,16 @@ struct SPI1
     using MCKOE = SPI1_I2SPR_MCKOE_Values<SPI1::I2SPR, 9, 1, ReadWriteMode, SPI1I2SPRBase> ;
     using ODD = SPI1_I2SPR_ODD_Values<SPI1::I2SPR, 8, 1, ReadWriteMode, SPI1I2SPRBase> ;
     using I2SDIV = SPI1_I2SPR_I2SDIV_Values<SPI1::I2SPR, 0, 8, ReadWriteMode, SPI1I2SPRBase> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0xAU ;
+    using Peripheral = SPI1 ;
     using FieldValues = SPI1_I2SPR_I2SDIV_Values<SPI1::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40013020, 32, ReadWriteMode, SPI1I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI1::CR1, SPI1::CR2, SPI1::SR, SPI1::DR, SPI1::CRCPR, SPI1::RXCRCR, SPI1::TXCRCR, SPI1::I2SCFGR, SPI1::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI1REGISTERS_HPP)
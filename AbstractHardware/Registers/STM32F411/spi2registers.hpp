@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SPI2
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40003800U ;
+
   struct SPI2CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40003800, 32, ReadWriteMode>
@@ -35,6 +40,11 @@ struct SPI2
     using MSTR = SPI2_CR1_MSTR_Values<SPI2::CR1, 2, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPOL = SPI2_CR1_CPOL_Values<SPI2::CR1, 1, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPHA = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 1, ReadWriteMode, SPI2CR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +62,9 @@ struct SPI2
     using SSOE = SPI2_CR2_SSOE_Values<SPI2::CR2, 2, 1, ReadWriteMode, SPI2CR2Base> ;
     using TXDMAEN = SPI2_CR2_TXDMAEN_Values<SPI2::CR2, 1, 1, ReadWriteMode, SPI2CR2Base> ;
     using RXDMAEN = SPI2_CR2_RXDMAEN_Values<SPI2::CR2, 0, 1, ReadWriteMode, SPI2CR2Base> ;
+    static constexpr Type WritableMask = 0xF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_CR2_RXDMAEN_Values<SPI2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +84,12 @@ struct SPI2
     using CHSIDE = SPI2_SR_CHSIDE_Values<SPI2::SR, 2, 1, ReadMode, SPI2SRBase> ;
     using TXE = SPI2_SR_TXE_Values<SPI2::SR, 1, 1, ReadMode, SPI2SRBase> ;
     using RXNE = SPI2_SR_RXNE_Values<SPI2::SR, 0, 1, ReadMode, SPI2SRBase> ;
+    static constexpr Type VolatileMask = 0x1FFU ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type ResetValue = 0x2U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_SR_RXNE_Values<SPI2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +101,11 @@ struct SPI2
   struct DR : public RegisterBase<0x4000380C, 32, ReadWriteMode>
   {
     using DRField = SPI2_DR_DR_Values<SPI2::DR, 0, 16, ReadWriteMode, SPI2DRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_DR_DR_Values<SPI2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +117,9 @@ struct SPI2
   struct CRCPR : public RegisterBase<0x40003810, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 16, ReadWriteMode, SPI2CRCPRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x7U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +131,9 @@ struct SPI2
   struct RXCRCR : public RegisterBase<0x40003814, 32, ReadMode>
   {
     using RxCRC = SPI2_RXCRCR_RxCRC_Values<SPI2::RXCRCR, 0, 16, ReadMode, SPI2RXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_RXCRCR_RxCRC_Values<SPI2::RXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +145,9 @@ struct SPI2
   struct TXCRCR : public RegisterBase<0x40003818, 32, ReadMode>
   {
     using TxCRC = SPI2_TXCRCR_TxCRC_Values<SPI2::TXCRCR, 0, 16, ReadMode, SPI2TXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_TXCRCR_TxCRC_Values<SPI2::TXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +166,11 @@ struct SPI2
     using CKPOL = SPI2_I2SCFGR_CKPOL_Values<SPI2::I2SCFGR, 3, 1, ReadWriteMode, SPI2I2SCFGRBase> ;
     using DATLEN = SPI2_I2SCFGR_DATLEN_Values<SPI2::I2SCFGR, 1, 2, ReadWriteMode, SPI2I2SCFGRBase> ;
     using CHLEN = SPI2_I2SCFGR_CHLEN_Values<SPI2::I2SCFGR, 0, 1, ReadWriteMode, SPI2I2SCFGRBase> ;
+    static constexpr Type WritableMask = 0xFBFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_I2SCFGR_CHLEN_Values<SPI2::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +184,16 @@ struct SPI2
     using MCKOE = SPI2_I2SPR_MCKOE_Values<SPI2::I2SPR, 9, 1, ReadWriteMode, SPI2I2SPRBase> ;
     using ODD = SPI2_I2SPR_ODD_Values<SPI2::I2SPR, 8, 1, ReadWriteMode, SPI2I2SPRBase> ;
     using I2SDIV = SPI2_I2SPR_I2SDIV_Values<SPI2::I2SPR, 0, 8, ReadWriteMode, SPI2I2SPRBase> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0xAU ;
+    using Peripheral = SPI2 ;
     using FieldValues = SPI2_I2SPR_I2SDIV_Values<SPI2::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003820, 32, ReadWriteMode, SPI2I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI2::CR1, SPI2::CR2, SPI2::SR, SPI2::DR, SPI2::CRCPR, SPI2::RXCRCR, SPI2::TXCRCR, SPI2::I2SCFGR, SPI2::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI2REGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SPI3
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40003C00U ;
+
   struct SPI3CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40003C00, 32, ReadWriteMode>
@@ -35,6 +40,11 @@ struct SPI3
     using MSTR = SPI3_CR1_MSTR_Values<SPI3::CR1, 2, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPOL = SPI3_CR1_CPOL_Values<SPI3::CR1, 1, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPHA = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 1, ReadWriteMode, SPI3CR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +62,9 @@ struct SPI3
     using SSOE = SPI3_CR2_SSOE_Values<SPI3::CR2, 2, 1, ReadWriteMode, SPI3CR2Base> ;
     using TXDMAEN = SPI3_CR2_TXDMAEN_Values<SPI3::CR2, 1, 1, ReadWriteMode, SPI3CR2Base> ;
     using RXDMAEN = SPI3_CR2_RXDMAEN_Values<SPI3::CR2, 0, 1, ReadWriteMode, SPI3CR2Base> ;
+    static constexpr Type WritableMask = 0xF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_CR2_RXDMAEN_Values<SPI3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +84,12 @@ struct SPI3
     using CHSIDE = SPI3_SR_CHSIDE_Values<SPI3::SR, 2, 1, ReadMode, SPI3SRBase> ;
     using TXE = SPI3_SR_TXE_Values<SPI3::SR, 1, 1, ReadMode, SPI3SRBase> ;
     using RXNE = SPI3_SR_RXNE_Values<SPI3::SR, 0, 1, ReadMode, SPI3SRBase> ;
+    static constexpr Type VolatileMask = 0x1FFU ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type ResetValue = 0x2U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_SR_RXNE_Values<SPI3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +101,11 @@ struct SPI3
   struct DR : public RegisterBase<0x40003C0C, 32, ReadWriteMode>
   {
     using DRField = SPI3_DR_DR_Values<SPI3::DR, 0, 16, ReadWriteMode, SPI3DRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_DR_DR_Values<SPI3::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +117,9 @@ struct SPI3
   struct CRCPR : public RegisterBase<0x40003C10, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 16, ReadWriteMode, SPI3CRCPRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x7U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +131,9 @@ struct SPI3
   struct RXCRCR : public RegisterBase<0x40003C14, 32, ReadMode>
   {
     using RxCRC = SPI3_RXCRCR_RxCRC_Values<SPI3::RXCRCR, 0, 16, ReadMode, SPI3RXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_RXCRCR_RxCRC_Values<SPI3::RXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +145,9 @@ struct SPI3
   struct TXCRCR : public RegisterBase<0x40003C18, 32, ReadMode>
   {
     using TxCRC = SPI3_TXCRCR_TxCRC_Values<SPI3::TXCRCR, 0, 16, ReadMode, SPI3TXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_TXCRCR_TxCRC_Values<SPI3::TXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +166,11 @@ struct SPI3
     using CKPOL = SPI3_I2SCFGR_CKPOL_Values<SPI3::I2SCFGR, 3, 1, ReadWriteMode, SPI3I2SCFGRBase> ;
     using DATLEN = SPI3_I2SCFGR_DATLEN_Values<SPI3::I2SCFGR, 1, 2, ReadWriteMode, SPI3I2SCFGRBase> ;
     using CHLEN = SPI3_I2SCFGR_CHLEN_Values<SPI3::I2SCFGR, 0, 1, ReadWriteMode, SPI3I2SCFGRBase> ;
+    static constexpr Type WritableMask = 0xFBFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_I2SCFGR_CHLEN_Values<SPI3::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +184,16 @@ struct SPI3
     using MCKOE = SPI3_I2SPR_MCKOE_Values<SPI3::I2SPR, 9, 1, ReadWriteMode, SPI3I2SPRBase> ;
     using ODD = SPI3_I2SPR_ODD_Values<SPI3::I2SPR, 8, 1, ReadWriteMode, SPI3I2SPRBase> ;
     using I2SDIV = SPI3_I2SPR_I2SDIV_Values<SPI3::I2SPR, 0, 8, ReadWriteMode, SPI3I2SPRBase> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0xAU ;
+    using Peripheral = SPI3 ;
     using FieldValues = SPI3_I2SPR_I2SDIV_Values<SPI3::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40003C20, 32, ReadWriteMode, SPI3I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI3::CR1, SPI3::CR2, SPI3::SR, SPI3::DR, SPI3::CRCPR, SPI3::RXCRCR, SPI3::TXCRCR, SPI3::I2SCFGR, SPI3::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI3REGISTERS_HPP)
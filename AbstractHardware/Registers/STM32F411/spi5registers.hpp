@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SPI5
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40015000U ;
+
   struct SPI5CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40015000, 32, ReadWriteMode>
@@ -35,6 +40,11 @@ struct SPI5
     using MSTR = SPI5_CR1_MSTR_Values<SPI5::CR1, 2, 1, ReadWriteMode, SPI5CR1Base> ;
     using CPOL = SPI5_CR1_CPOL_Values<SPI5::CR1, 1, 1, ReadWriteMode, SPI5CR1Base> ;
     using CPHA = SPI5_CR1_CPHA_Values<SPI5::CR1, 0, 1, ReadWriteMode, SPI5CR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_CR1_CPHA_Values<SPI5::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +62,9 @@ struct SPI5
     using SSOE = SPI5_CR2_SSOE_Values<SPI5::CR2, 2, 1, ReadWriteMode, SPI5CR2Base> ;
     using TXDMAEN = SPI5_CR2_TXDMAEN_Values<SPI5::CR2, 1, 1, ReadWriteMode, SPI5CR2Base> ;
     using RXDMAEN = SPI5_CR2_RXDMAEN_Values<SPI5::CR2, 0, 1, ReadWriteMode, SPI5CR2Base> ;
+    static constexpr Type WritableMask = 0xF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_CR2_RXDMAEN_Values<SPI5::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +84,12 @@ struct SPI5
     using CHSIDE = SPI5_SR_CHSIDE_Values<SPI5::SR, 2, 1, ReadMode, SPI5SRBase> ;
     using TXE = SPI5_SR_TXE_Values<SPI5::SR, 1, 1, ReadMode, SPI5SRBase> ;
     using RXNE = SPI5_SR_RXNE_Values<SPI5::SR, 0, 1, ReadMode, SPI5SRBase> ;
+    static constexpr Type VolatileMask = 0x1FFU ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type ResetValue = 0x2U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_SR_RXNE_Values<SPI5::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +101,11 @@ struct SPI5
   struct DR : public RegisterBase<0x4001500C, 32, ReadWriteMode>
   {
     using DRField = SPI5_DR_DR_Values<SPI5::DR, 0, 16, ReadWriteMode, SPI5DRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_DR_DR_Values<SPI5::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +117,9 @@ struct SPI5
   struct CRCPR : public RegisterBase<0x40015010, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI5_CRCPR_CRCPOLY_Values<SPI5::CRCPR, 0, 16, ReadWriteMode, SPI5CRCPRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x7U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_CRCPR_CRCPOLY_Values<SPI5::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +131,9 @@ struct SPI5
   struct RXCRCR : public RegisterBase<0x40015014, 32, ReadMode>
   {
     using RxCRC = SPI5_RXCRCR_RxCRC_Values<SPI5::RXCRCR, 0, 16, ReadMode, SPI5RXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_RXCRCR_RxCRC_Values<SPI5::RXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +145,9 @@ struct SPI5
   struct TXCRCR : public RegisterBase<0x40015018, 32, ReadMode>
   {
     using TxCRC = SPI5_TXCRCR_TxCRC_Values<SPI5::TXCRCR, 0, 16, ReadMode, SPI5TXCRCRBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_TXCRCR_TxCRC_Values<SPI5::TXCRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +166,11 @@ struct SPI5
     using CKPOL = SPI5_I2SCFGR_CKPOL_Values<SPI5::I2SCFGR, 3, 1, ReadWriteMode, SPI5I2SCFGRBase> ;
     using DATLEN = SPI5_I2SCFGR_DATLEN_Values<SPI5::I2SCFGR, 1, 2, ReadWriteMode, SPI5I2SCFGRBase> ;
     using CHLEN = SPI5_I2SCFGR_CHLEN_Values<SPI5::I2SCFGR, 0, 1, ReadWriteMode, SPI5I2SCFGRBase> ;
+    static constexpr Type WritableMask = 0xFBFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0xBBFU ;
+    static constexpr Type EnableMask = 0x400U ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_I2SCFGR_CHLEN_Values<SPI5::I2SCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,12 +184,16 @@ struct SPI5
     using MCKOE = SPI5_I2SPR_MCKOE_Values<SPI5::I2SPR, 9, 1, ReadWriteMode, SPI5I2SPRBase> ;
     using ODD = SPI5_I2SPR_ODD_Values<SPI5::I2SPR, 8, 1, ReadWriteMode, SPI5I2SPRBase> ;
     using I2SDIV = SPI5_I2SPR_I2SDIV_Values<SPI5::I2SPR, 0, 8, ReadWriteMode, SPI5I2SPRBase> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0xAU ;
+    using Peripheral = SPI5 ;
     using FieldValues = SPI5_I2SPR_I2SDIV_Values<SPI5::I2SPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using I2SPRPack  = Register<0x40015020, 32, ReadWriteMode, SPI5I2SPRBase, T...> ;
 
+  using Registers = TypesList<SPI5::CR1, SPI5::CR2, SPI5::SR, SPI5::DR, SPI5::CRCPR, SPI5::RXCRCR, SPI5::TXCRCR, SPI5::I2SCFGR, SPI5::I2SPR> ;
 } ;
 
 #endif //#if !defined(SPI5REGISTERS_HPP)
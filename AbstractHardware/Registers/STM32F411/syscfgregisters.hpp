@@ -14,14 +14,22 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct SYSCFG
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40013800U ;
+
   struct SYSCFGMEMRMBase {} ;
 
   struct MEMRM : public RegisterBase<0x40013800, 32, ReadWriteMode>
   {
     using MEM_MODE = SYSCFG_MEMRM_MEM_MODE_Values<SYSCFG::MEMRM, 0, 2, ReadWriteMode, SYSCFGMEMRMBase> ;
+    static constexpr Type WritableMask = 0x3U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_MEMRM_MEM_MODE_Values<SYSCFG::MEMRM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +41,9 @@ struct SYSCFG
   struct PMC : public RegisterBase<0x40013804, 32, ReadWriteMode>
   {
     using ADC1DC2 = SYSCFG_PMC_ADC1DC2_Values<SYSCFG::PMC, 16, 1, ReadWriteMode, SYSCFGPMCBase> ;
+    static constexpr Type WritableMask = 0x10000U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_PMC_ADC1DC2_Values<SYSCFG::PMC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +58,12 @@ struct SYSCFG
     using EXTI2 = SYSCFG_EXTICR1_EXTI2_Values<SYSCFG::EXTICR1, 8, 4, ReadWriteMode, SYSCFGEXTICR1Base> ;
     using EXTI1 = SYSCFG_EXTICR1_EXTI1_Values<SYSCFG::EXTICR1, 4, 4, ReadWriteMode, SYSCFGEXTICR1Base> ;
     using EXTI0 = SYSCFG_EXTICR1_EXTI0_Values<SYSCFG::EXTICR1, 0, 4, ReadWriteMode, SYSCFGEXTICR1Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using EXTIArray = FieldArray<0U, EXTI0, EXTI1, EXTI2, EXTI3> ;
+    template<std::size_t index>
+    using Field = typename EXTIArray::template Field<index> ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_EXTICR1_EXTI0_Values<SYSCFG::EXTICR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +78,12 @@ struct SYSCFG
     using EXTI6 = SYSCFG_EXTICR2_EXTI6_Values<SYSCFG::EXTICR2, 8, 4, ReadWriteMode, SYSCFGEXTICR2Base> ;
     using EXTI5 = SYSCFG_EXTICR2_EXTI5_Values<SYSCFG::EXTICR2, 4, 4, ReadWriteMode, SYSCFGEXTICR2Base> ;
     using EXTI4 = SYSCFG_EXTICR2_EXTI4_Values<SYSCFG::EXTICR2, 0, 4, ReadWriteMode, SYSCFGEXTICR2Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using EXTIArray = FieldArray<4U, EXTI4, EXTI5, EXTI6, EXTI7> ;
+    template<std::size_t index>
+    using Field = typename EXTIArray::template Field<index> ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_EXTICR2_EXTI4_Values<SYSCFG::EXTICR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +98,12 @@ struct SYSCFG
     using EXTI10 = SYSCFG_EXTICR3_EXTI10_Values<SYSCFG::EXTICR3, 8, 4, ReadWriteMode, SYSCFGEXTICR3Base> ;
     using EXTI9 = SYSCFG_EXTICR3_EXTI9_Values<SYSCFG::EXTICR3, 4, 4, ReadWriteMode, SYSCFGEXTICR3Base> ;
     using EXTI8 = SYSCFG_EXTICR3_EXTI8_Values<SYSCFG::EXTICR3, 0, 4, ReadWriteMode, SYSCFGEXTICR3Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using EXTIArray = FieldArray<8U, EXTI8, EXTI9, EXTI10, EXTI11> ;
+    template<std::size_t index>
+    using Field = typename EXTIArray::template Field<index> ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_EXTICR3_EXTI8_Values<SYSCFG::EXTICR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -89,6 +118,12 @@ struct SYSCFG
     using EXTI14 = SYSCFG_EXTICR4_EXTI14_Values<SYSCFG::EXTICR4, 8, 4, ReadWriteMode, SYSCFGEXTICR4Base> ;
     using EXTI13 = SYSCFG_EXTICR4_EXTI13_Values<SYSCFG::EXTICR4, 4, 4, ReadWriteMode, SYSCFGEXTICR4Base> ;
     using EXTI12 = SYSCFG_EXTICR4_EXTI12_Values<SYSCFG::EXTICR4, 0, 4, ReadWriteMode, SYSCFGEXTICR4Base> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using EXTIArray = FieldArray<12U, EXTI12, EXTI13, EXTI14, EXTI15> ;
+    template<std::size_t index>
+    using Field = typename EXTIArray::template Field<index> ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_EXTICR4_EXTI12_Values<SYSCFG::EXTICR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,12 +136,19 @@ struct SYSCFG
   {
     using READY = SYSCFG_CMPCR_READY_Values<SYSCFG::CMPCR, 8, 1, ReadMode, SYSCFGCMPCRBase> ;
     using CMP_PD = SYSCFG_CMPCR_CMP_PD_Values<SYSCFG::CMPCR, 0, 1, ReadMode, SYSCFGCMPCRBase> ;
+    static constexpr Type VolatileMask = 0x101U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = SYSCFG ;
     using FieldValues = SYSCFG_CMPCR_CMP_PD_Values<SYSCFG::CMPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CMPCRPack  = Register<0x40013820, 32, ReadMode, SYSCFGCMPCRBase, T...> ;
 
+  template<std::size_t index>
+  using EXTICR = IndexedType<index, 1U, SYSCFG::EXTICR1, SYSCFG::EXTICR2, SYSCFG::EXTICR3, SYSCFG::EXTICR4> ;
+
+  using Registers = TypesList<SYSCFG::MEMRM, SYSCFG::PMC, SYSCFG::EXTICR1, SYSCFG::EXTICR2, SYSCFG::EXTICR3, SYSCFG::EXTICR4, SYSCFG::CMPCR> ;
 } ;
 
 #endif //#if !defined(SYSCFGREGISTERS_HPP)
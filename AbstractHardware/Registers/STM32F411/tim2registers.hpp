@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct TIM2
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40000000U ;
+
   struct TIM2CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40000000, 32, ReadWriteMode>
@@ -29,6 +34,11 @@ struct TIM2
     using URS = TIM2_CR1_URS_Values<TIM2::CR1, 2, 1, ReadWriteMode, TIM2CR1Base> ;
     using UDIS = TIM2_CR1_UDIS_Values<TIM2::CR1, 1, 1, ReadWriteMode, TIM2CR1Base> ;
     using CEN = TIM2_CR1_CEN_Values<TIM2::CR1, 0, 1, ReadWriteMode, TIM2CR1Base> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CR1_CEN_Values<TIM2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +52,9 @@ struct TIM2
     using TI1S = TIM2_CR2_TI1S_Values<TIM2::CR2, 7, 1, ReadWriteMode, TIM2CR2Base> ;
     using MMS = TIM2_CR2_MMS_Values<TIM2::CR2, 4, 3, ReadWriteMode, TIM2CR2Base> ;
     using CCDS = TIM2_CR2_CCDS_Values<TIM2::CR2, 3, 1, ReadWriteMode, TIM2CR2Base> ;
+    static constexpr Type WritableMask = 0xF8U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CR2_CCDS_Values<TIM2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +72,9 @@ struct TIM2
     using MSM = TIM2_SMCR_MSM_Values<TIM2::SMCR, 7, 1, ReadWriteMode, TIM2SMCRBase> ;
     using TS = TIM2_SMCR_TS_Values<TIM2::SMCR, 4, 3, ReadWriteMode, TIM2SMCRBase> ;
     using SMS = TIM2_SMCR_SMS_Values<TIM2::SMCR, 0, 3, ReadWriteMode, TIM2SMCRBase> ;
+    static constexpr Type WritableMask = 0xFFF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_SMCR_SMS_Values<TIM2::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +97,9 @@ struct TIM2
     using CC2IE = TIM2_DIER_CC2IE_Values<TIM2::DIER, 2, 1, ReadWriteMode, TIM2DIERBase> ;
     using CC1IE = TIM2_DIER_CC1IE_Values<TIM2::DIER, 1, 1, ReadWriteMode, TIM2DIERBase> ;
     using UIE = TIM2_DIER_UIE_Values<TIM2::DIER, 0, 1, ReadWriteMode, TIM2DIERBase> ;
+    static constexpr Type WritableMask = 0x5F5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_DIER_UIE_Values<TIM2::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +120,12 @@ struct TIM2
     using CC2IF = TIM2_SR_CC2IF_Values<TIM2::SR, 2, 1, ReadWriteMode, TIM2SRBase> ;
     using CC1IF = TIM2_SR_CC1IF_Values<TIM2::SR, 1, 1, ReadWriteMode, TIM2SRBase> ;
     using UIF = TIM2_SR_UIF_Values<TIM2::SR, 0, 1, ReadWriteMode, TIM2SRBase> ;
+    static constexpr Type VolatileMask = 0x1E5FU ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_SR_UIF_Values<TIM2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +142,9 @@ struct TIM2
     using CC2G = TIM2_EGR_CC2G_Values<TIM2::EGR, 2, 1, WriteMode, TIM2EGRBase> ;
     using CC1G = TIM2_EGR_CC1G_Values<TIM2::EGR, 1, 1, WriteMode, TIM2EGRBase> ;
     using UG = TIM2_EGR_UG_Values<TIM2::EGR, 0, 1, WriteMode, TIM2EGRBase> ;
+    static constexpr Type WritableMask = 0x5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_EGR_UG_Values<TIM2::EGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +165,9 @@ struct TIM2
     using OC1PE = TIM2_CCMR1_Output_OC1PE_Values<TIM2::CCMR1_Output, 3, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
     using OC1FE = TIM2_CCMR1_Output_OC1FE_Values<TIM2::CCMR1_Output, 2, 1, ReadWriteMode, TIM2CCMR1_OutputBase> ;
     using CC1S = TIM2_CCMR1_Output_CC1S_Values<TIM2::CCMR1_Output, 0, 2, ReadWriteMode, TIM2CCMR1_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCMR1_Output_CC1S_Values<TIM2::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +184,9 @@ struct TIM2
     using IC1F = TIM2_CCMR1_Input_IC1F_Values<TIM2::CCMR1_Input, 4, 4, ReadWriteMode, TIM2CCMR1_InputBase> ;
     using ICPCS = TIM2_CCMR1_Input_ICPCS_Values<TIM2::CCMR1_Input, 2, 2, ReadWriteMode, TIM2CCMR1_InputBase> ;
     using CC1S = TIM2_CCMR1_Input_CC1S_Values<TIM2::CCMR1_Input, 0, 2, ReadWriteMode, TIM2CCMR1_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCMR1_Input_CC1S_Values<TIM2::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +207,9 @@ struct TIM2
     using OC3PE = TIM2_CCMR2_Output_OC3PE_Values<TIM2::CCMR2_Output, 3, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
     using OC3FE = TIM2_CCMR2_Output_OC3FE_Values<TIM2::CCMR2_Output, 2, 1, ReadWriteMode, TIM2CCMR2_OutputBase> ;
     using CC3S = TIM2_CCMR2_Output_CC3S_Values<TIM2::CCMR2_Output, 0, 2, ReadWriteMode, TIM2CCMR2_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCMR2_Output_CC3S_Values<TIM2::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +226,9 @@ struct TIM2
     using IC3F = TIM2_CCMR2_Input_IC3F_Values<TIM2::CCMR2_Input, 4, 4, ReadWriteMode, TIM2CCMR2_InputBase> ;
     using IC3PSC = TIM2_CCMR2_Input_IC3PSC_Values<TIM2::CCMR2_Input, 2, 2, ReadWriteMode, TIM2CCMR2_InputBase> ;
     using CC3S = TIM2_CCMR2_Input_CC3S_Values<TIM2::CCMR2_Input, 0, 2, ReadWriteMode, TIM2CCMR2_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCMR2_Input_CC3S_Values<TIM2::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +251,9 @@ struct TIM2
     using CC1NP = TIM2_CCER_CC1NP_Values<TIM2::CCER, 3, 1, ReadWriteMode, TIM2CCERBase> ;
     using CC1P = TIM2_CCER_CC1P_Values<TIM2::CCER, 1, 1, ReadWriteMode, TIM2CCERBase> ;
     using CC1E = TIM2_CCER_CC1E_Values<TIM2::CCER, 0, 1, ReadWriteMode, TIM2CCERBase> ;
+    static constexpr Type WritableMask = 0xBBBBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCER_CC1E_Values<TIM2::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -221,6 +264,11 @@ struct TIM2
 
   struct CNT : public RegisterBase<0x40000024, 32, ReadWriteMode>
   {
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM2 ;
   } ;
 
   template<typename... T> 
@@ -231,6 +279,9 @@ struct TIM2
   struct PSC : public RegisterBase<0x40000028, 32, ReadWriteMode>
   {
     using PSCField = TIM2_PSC_PSC_Values<TIM2::PSC, 0, 16, ReadWriteMode, TIM2PSCBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_PSC_PSC_Values<TIM2::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +293,9 @@ struct TIM2
   struct ARR : public RegisterBase<0x4000002C, 32, ReadWriteMode>
   {
 
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
   } ;
 
   template<typename... T> 
@@ -253,6 +307,10 @@ struct TIM2
   {
     
     using CCR1Field = TIM2_CCR1_CCR1_Values<TIM2::CCR1, 0, 32, ReadWriteMode, TIM2CCR1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCR1_CCR1_Values<TIM2::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -265,6 +323,10 @@ struct TIM2
   {
     
     using CCR2Field = TIM2_CCR2_CCR2_Values<TIM2::CCR2, 0, 32, ReadWriteMode, TIM2CCR2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCR2_CCR2_Values<TIM2::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -277,6 +339,10 @@ struct TIM2
   {
     
     using CCR3Field = TIM2_CCR3_CCR3_Values<TIM2::CCR3, 0, 32, ReadWriteMode, TIM2CCR3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCR3_CCR3_Values<TIM2::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,6 +355,10 @@ struct TIM2
   {
     
     using CCR4Field = TIM2_CCR4_CCR4_Values<TIM2::CCR4, 0, 32, ReadWriteMode, TIM2CCR4Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_CCR4_CCR4_Values<TIM2::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -301,6 +371,9 @@ struct TIM2
   {
     using DBL = TIM2_DCR_DBL_Values<TIM2::DCR, 8, 5, ReadWriteMode, TIM2DCRBase> ;
     using DBA = TIM2_DCR_DBA_Values<TIM2::DCR, 0, 5, ReadWriteMode, TIM2DCRBase> ;
+    static constexpr Type WritableMask = 0x1F1FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_DCR_DBA_Values<TIM2::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -312,6 +385,9 @@ struct TIM2
   struct DMAR : public RegisterBase<0x4000004C, 32, ReadWriteMode>
   {
     using DMAB = TIM2_DMAR_DMAB_Values<TIM2::DMAR, 0, 16, ReadWriteMode, TIM2DMARBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_DMAR_DMAB_Values<TIM2::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -323,12 +399,19 @@ struct TIM2
   struct OR : public RegisterBase<0x40000050, 32, ReadWriteMode>
   {
     using ITR1_RMP = TIM2_OR_ITR1_RMP_Values<TIM2::OR, 10, 2, ReadWriteMode, TIM2ORBase> ;
+    static constexpr Type WritableMask = 0xC00U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM2 ;
     using FieldValues = TIM2_OR_ITR1_RMP_Values<TIM2::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40000050, 32, ReadWriteMode, TIM2ORBase, T...> ;
 
+  template<std::size_t index>
+  using CCR = IndexedType<index, 1U, TIM2::CCR1, TIM2::CCR2, TIM2::CCR3, TIM2::CCR4> ;
+
+  using Registers = TypesList<TIM2::CR1, TIM2::CR2, TIM2::SMCR, TIM2::DIER, TIM2::SR, TIM2::EGR, TIM2::CCMR1_Output, TIM2::CCMR1_Input, TIM2::CCMR2_Output, TIM2::CCMR2_Input, TIM2::CCER, TIM2::CNT, TIM2::PSC, TIM2::ARR, TIM2::CCR1, TIM2::CCR2, TIM2::CCR3, TIM2::CCR4, TIM2::DCR, TIM2::DMAR, TIM2::OR> ;
 } ;
 
 #endif //#if !defined(TIM2REGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct TIM3
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40000400U ;
+
   struct TIM3CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40000400, 32, ReadWriteMode>
@@ -29,6 +34,11 @@ struct TIM3
     using URS = TIM3_CR1_URS_Values<TIM3::CR1, 2, 1, ReadWriteMode, TIM3CR1Base> ;
     using UDIS = TIM3_CR1_UDIS_Values<TIM3::CR1, 1, 1, ReadWriteMode, TIM3CR1Base> ;
     using CEN = TIM3_CR1_CEN_Values<TIM3::CR1, 0, 1, ReadWriteMode, TIM3CR1Base> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CR1_CEN_Values<TIM3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +52,9 @@ struct TIM3
     using TI1S = TIM3_CR2_TI1S_Values<TIM3::CR2, 7, 1, ReadWriteMode, TIM3CR2Base> ;
     using MMS = TIM3_CR2_MMS_Values<TIM3::CR2, 4, 3, ReadWriteMode, TIM3CR2Base> ;
     using CCDS = TIM3_CR2_CCDS_Values<TIM3::CR2, 3, 1, ReadWriteMode, TIM3CR2Base> ;
+    static constexpr Type WritableMask = 0xF8U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CR2_CCDS_Values<TIM3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +72,9 @@ struct TIM3
     using MSM = TIM3_SMCR_MSM_Values<TIM3::SMCR, 7, 1, ReadWriteMode, TIM3SMCRBase> ;
     using TS = TIM3_SMCR_TS_Values<TIM3::SMCR, 4, 3, ReadWriteMode, TIM3SMCRBase> ;
     using SMS = TIM3_SMCR_SMS_Values<TIM3::SMCR, 0, 3, ReadWriteMode, TIM3SMCRBase> ;
+    static constexpr Type WritableMask = 0xFFF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_SMCR_SMS_Values<TIM3::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +97,9 @@ struct TIM3
     using CC2IE = TIM3_DIER_CC2IE_Values<TIM3::DIER, 2, 1, ReadWriteMode, TIM3DIERBase> ;
     using CC1IE = TIM3_DIER_CC1IE_Values<TIM3::DIER, 1, 1, ReadWriteMode, TIM3DIERBase> ;
     using UIE = TIM3_DIER_UIE_Values<TIM3::DIER, 0, 1, ReadWriteMode, TIM3DIERBase> ;
+    static constexpr Type WritableMask = 0x5F5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_DIER_UIE_Values<TIM3::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +120,12 @@ struct TIM3
     using CC2IF = TIM3_SR_CC2IF_Values<TIM3::SR, 2, 1, ReadWriteMode, TIM3SRBase> ;
     using CC1IF = TIM3_SR_CC1IF_Values<TIM3::SR, 1, 1, ReadWriteMode, TIM3SRBase> ;
     using UIF = TIM3_SR_UIF_Values<TIM3::SR, 0, 1, ReadWriteMode, TIM3SRBase> ;
+    static constexpr Type VolatileMask = 0x1E5FU ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_SR_UIF_Values<TIM3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +142,9 @@ struct TIM3
     using CC2G = TIM3_EGR_CC2G_Values<TIM3::EGR, 2, 1, WriteMode, TIM3EGRBase> ;
     using CC1G = TIM3_EGR_CC1G_Values<TIM3::EGR, 1, 1, WriteMode, TIM3EGRBase> ;
     using UG = TIM3_EGR_UG_Values<TIM3::EGR, 0, 1, WriteMode, TIM3EGRBase> ;
+    static constexpr Type WritableMask = 0x5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_EGR_UG_Values<TIM3::EGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +165,9 @@ struct TIM3
     using OC1PE = TIM3_CCMR1_Output_OC1PE_Values<TIM3::CCMR1_Output, 3, 1, ReadWriteMode, TIM3CCMR1_OutputBase> ;
     using OC1FE = TIM3_CCMR1_Output_OC1FE_Values<TIM3::CCMR1_Output, 2, 1, ReadWriteMode, TIM3CCMR1_OutputBase> ;
     using CC1S = TIM3_CCMR1_Output_CC1S_Values<TIM3::CCMR1_Output, 0, 2, ReadWriteMode, TIM3CCMR1_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCMR1_Output_CC1S_Values<TIM3::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +184,9 @@ struct TIM3
     using IC1F = TIM3_CCMR1_Input_IC1F_Values<TIM3::CCMR1_Input, 4, 4, ReadWriteMode, TIM3CCMR1_InputBase> ;
     using ICPCS = TIM3_CCMR1_Input_ICPCS_Values<TIM3::CCMR1_Input, 2, 2, ReadWriteMode, TIM3CCMR1_InputBase> ;
     using CC1S = TIM3_CCMR1_Input_CC1S_Values<TIM3::CCMR1_Input, 0, 2, ReadWriteMode, TIM3CCMR1_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCMR1_Input_CC1S_Values<TIM3::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +207,9 @@ struct TIM3
     using OC3PE = TIM3_CCMR2_Output_OC3PE_Values<TIM3::CCMR2_Output, 3, 1, ReadWriteMode, TIM3CCMR2_OutputBase> ;
     using OC3FE = TIM3_CCMR2_Output_OC3FE_Values<TIM3::CCMR2_Output, 2, 1, ReadWriteMode, TIM3CCMR2_OutputBase> ;
     using CC3S = TIM3_CCMR2_Output_CC3S_Values<TIM3::CCMR2_Output, 0, 2, ReadWriteMode, TIM3CCMR2_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCMR2_Output_CC3S_Values<TIM3::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +226,9 @@ struct TIM3
     using IC3F = TIM3_CCMR2_Input_IC3F_Values<TIM3::CCMR2_Input, 4, 4, ReadWriteMode, TIM3CCMR2_InputBase> ;
     using IC3PSC = TIM3_CCMR2_Input_IC3PSC_Values<TIM3::CCMR2_Input, 2, 2, ReadWriteMode, TIM3CCMR2_InputBase> ;
     using CC3S = TIM3_CCMR2_Input_CC3S_Values<TIM3::CCMR2_Input, 0, 2, ReadWriteMode, TIM3CCMR2_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCMR2_Input_CC3S_Values<TIM3::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +251,9 @@ struct TIM3
     using CC1NP = TIM3_CCER_CC1NP_Values<TIM3::CCER, 3, 1, ReadWriteMode, TIM3CCERBase> ;
     using CC1P = TIM3_CCER_CC1P_Values<TIM3::CCER, 1, 1, ReadWriteMode, TIM3CCERBase> ;
     using CC1E = TIM3_CCER_CC1E_Values<TIM3::CCER, 0, 1, ReadWriteMode, TIM3CCERBase> ;
+    static constexpr Type WritableMask = 0xBBBBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCER_CC1E_Values<TIM3::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +266,11 @@ struct TIM3
   {
     using CNT_H = TIM3_CNT_CNT_H_Values<TIM3::CNT, 16, 16, ReadWriteMode, TIM3CNTBase> ;
     using CNT_L = TIM3_CNT_CNT_L_Values<TIM3::CNT, 0, 16, ReadWriteMode, TIM3CNTBase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CNT_CNT_L_Values<TIM3::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -234,6 +282,9 @@ struct TIM3
   struct PSC : public RegisterBase<0x40000428, 32, ReadWriteMode>
   {
     using PSCField = TIM3_PSC_PSC_Values<TIM3::PSC, 0, 16, ReadWriteMode, TIM3PSCBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_PSC_PSC_Values<TIM3::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -246,6 +297,9 @@ struct TIM3
   {
     using ARR_H = TIM3_ARR_ARR_H_Values<TIM3::ARR, 16, 16, ReadWriteMode, TIM3ARRBase> ;
     using ARR_L = TIM3_ARR_ARR_L_Values<TIM3::ARR, 0, 16, ReadWriteMode, TIM3ARRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_ARR_ARR_L_Values<TIM3::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -258,6 +312,10 @@ struct TIM3
   {
     using CCR1_H = TIM3_CCR1_CCR1_H_Values<TIM3::CCR1, 16, 16, ReadWriteMode, TIM3CCR1Base> ;
     using CCR1_L = TIM3_CCR1_CCR1_L_Values<TIM3::CCR1, 0, 16, ReadWriteMode, TIM3CCR1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCR1_CCR1_L_Values<TIM3::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +328,10 @@ struct TIM3
   {
     using CCR2_H = TIM3_CCR2_CCR2_H_Values<TIM3::CCR2, 16, 16, ReadWriteMode, TIM3CCR2Base> ;
     using CCR2_L = TIM3_CCR2_CCR2_L_Values<TIM3::CCR2, 0, 16, ReadWriteMode, TIM3CCR2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCR2_CCR2_L_Values<TIM3::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +344,10 @@ struct TIM3
   {
     using CCR3_H = TIM3_CCR3_CCR3_H_Values<TIM3::CCR3, 16, 16, ReadWriteMode, TIM3CCR3Base> ;
     using CCR3_L = TIM3_CCR3_CCR3_L_Values<TIM3::CCR3, 0, 16, ReadWriteMode, TIM3CCR3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCR3_CCR3_L_Values<TIM3::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -294,6 +360,10 @@ struct TIM3
   {
     using CCR4_H = TIM3_CCR4_CCR4_H_Values<TIM3::CCR4, 16, 16, ReadWriteMode, TIM3CCR4Base> ;
     using CCR4_L = TIM3_CCR4_CCR4_L_Values<TIM3::CCR4, 0, 16, ReadWriteMode, TIM3CCR4Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_CCR4_CCR4_L_Values<TIM3::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +376,9 @@ struct TIM3
   {
     using DBL = TIM3_DCR_DBL_Values<TIM3::DCR, 8, 5, ReadWriteMode, TIM3DCRBase> ;
     using DBA = TIM3_DCR_DBA_Values<TIM3::DCR, 0, 5, ReadWriteMode, TIM3DCRBase> ;
+    static constexpr Type WritableMask = 0x1F1FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_DCR_DBA_Values<TIM3::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -317,12 +390,19 @@ struct TIM3
   struct DMAR : public RegisterBase<0x4000044C, 32, ReadWriteMode>
   {
     using DMAB = TIM3_DMAR_DMAB_Values<TIM3::DMAR, 0, 16, ReadWriteMode, TIM3DMARBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM3 ;
     using FieldValues = TIM3_DMAR_DMAB_Values<TIM3::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4000044C, 32, ReadWriteMode, TIM3DMARBase, T...> ;
 
+  template<std::size_t index>
+  using CCR = IndexedType<index, 1U, TIM3::CCR1, TIM3::CCR2, TIM3::CCR3, TIM3::CCR4> ;
+
+  using Registers = TypesList<TIM3::CR1, TIM3::CR2, TIM3::SMCR, TIM3::DIER, TIM3::SR, TIM3::EGR, TIM3::CCMR1_Output, TIM3::CCMR1_Input, TIM3::CCMR2_Output, TIM3::CCMR2_Input, TIM3::CCER, TIM3::CNT, TIM3::PSC, TIM3::ARR, TIM3::CCR1, TIM3::CCR2, TIM3::CCR3, TIM3::CCR4, TIM3::DCR, TIM3::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM3REGISTERS_HPP)
@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct TIM5
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40000C00U ;
+
   struct TIM5CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40000C00, 32, ReadWriteMode>
@@ -29,6 +34,11 @@ struct TIM5
     using URS = TIM5_CR1_URS_Values<TIM5::CR1, 2, 1, ReadWriteMode, TIM5CR1Base> ;
     using UDIS = TIM5_CR1_UDIS_Values<TIM5::CR1, 1, 1, ReadWriteMode, TIM5CR1Base> ;
     using CEN = TIM5_CR1_CEN_Values<TIM5::CR1, 0, 1, ReadWriteMode, TIM5CR1Base> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CR1_CEN_Values<TIM5::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +52,9 @@ struct TIM5
     using TI1S = TIM5_CR2_TI1S_Values<TIM5::CR2, 7, 1, ReadWriteMode, TIM5CR2Base> ;
     using MMS = TIM5_CR2_MMS_Values<TIM5::CR2, 4, 3, ReadWriteMode, TIM5CR2Base> ;
     using CCDS = TIM5_CR2_CCDS_Values<TIM5::CR2, 3, 1, ReadWriteMode, TIM5CR2Base> ;
+    static constexpr Type WritableMask = 0xF8U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CR2_CCDS_Values<TIM5::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +72,9 @@ struct TIM5
     using MSM = TIM5_SMCR_MSM_Values<TIM5::SMCR, 7, 1, ReadWriteMode, TIM5SMCRBase> ;
     using TS = TIM5_SMCR_TS_Values<TIM5::SMCR, 4, 3, ReadWriteMode, TIM5SMCRBase> ;
     using SMS = TIM5_SMCR_SMS_Values<TIM5::SMCR, 0, 3, ReadWriteMode, TIM5SMCRBase> ;
+    static constexpr Type WritableMask = 0xFFF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_SMCR_SMS_Values<TIM5::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +97,9 @@ struct TIM5
     using CC2IE = TIM5_DIER_CC2IE_Values<TIM5::DIER, 2, 1, ReadWriteMode, TIM5DIERBase> ;
     using CC1IE = TIM5_DIER_CC1IE_Values<TIM5::DIER, 1, 1, ReadWriteMode, TIM5DIERBase> ;
     using UIE = TIM5_DIER_UIE_Values<TIM5::DIER, 0, 1, ReadWriteMode, TIM5DIERBase> ;
+    static constexpr Type WritableMask = 0x5F5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_DIER_UIE_Values<TIM5::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +120,12 @@ struct TIM5
     using CC2IF = TIM5_SR_CC2IF_Values<TIM5::SR, 2, 1, ReadWriteMode, TIM5SRBase> ;
     using CC1IF = TIM5_SR_CC1IF_Values<TIM5::SR, 1, 1, ReadWriteMode, TIM5SRBase> ;
     using UIF = TIM5_SR_UIF_Values<TIM5::SR, 0, 1, ReadWriteMode, TIM5SRBase> ;
+    static constexpr Type VolatileMask = 0x1E5FU ;
+    static constexpr Type WritableMask = 0x1E5FU ;
+    static constexpr Type ZeroToClearMask = 0x1E5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_SR_UIF_Values<TIM5::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -117,6 +142,9 @@ struct TIM5
     using CC2G = TIM5_EGR_CC2G_Values<TIM5::EGR, 2, 1, WriteMode, TIM5EGRBase> ;
     using CC1G = TIM5_EGR_CC1G_Values<TIM5::EGR, 1, 1, WriteMode, TIM5EGRBase> ;
     using UG = TIM5_EGR_UG_Values<TIM5::EGR, 0, 1, WriteMode, TIM5EGRBase> ;
+    static constexpr Type WritableMask = 0x5FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_EGR_UG_Values<TIM5::EGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +165,9 @@ struct TIM5
     using OC1PE = TIM5_CCMR1_Output_OC1PE_Values<TIM5::CCMR1_Output, 3, 1, ReadWriteMode, TIM5CCMR1_OutputBase> ;
     using OC1FE = TIM5_CCMR1_Output_OC1FE_Values<TIM5::CCMR1_Output, 2, 1, ReadWriteMode, TIM5CCMR1_OutputBase> ;
     using CC1S = TIM5_CCMR1_Output_CC1S_Values<TIM5::CCMR1_Output, 0, 2, ReadWriteMode, TIM5CCMR1_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCMR1_Output_CC1S_Values<TIM5::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +184,9 @@ struct TIM5
     using IC1F = TIM5_CCMR1_Input_IC1F_Values<TIM5::CCMR1_Input, 4, 4, ReadWriteMode, TIM5CCMR1_InputBase> ;
     using ICPCS = TIM5_CCMR1_Input_ICPCS_Values<TIM5::CCMR1_Input, 2, 2, ReadWriteMode, TIM5CCMR1_InputBase> ;
     using CC1S = TIM5_CCMR1_Input_CC1S_Values<TIM5::CCMR1_Input, 0, 2, ReadWriteMode, TIM5CCMR1_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCMR1_Input_CC1S_Values<TIM5::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -173,6 +207,9 @@ struct TIM5
     using OC3PE = TIM5_CCMR2_Output_OC3PE_Values<TIM5::CCMR2_Output, 3, 1, ReadWriteMode, TIM5CCMR2_OutputBase> ;
     using OC3FE = TIM5_CCMR2_Output_OC3FE_Values<TIM5::CCMR2_Output, 2, 1, ReadWriteMode, TIM5CCMR2_OutputBase> ;
     using CC3S = TIM5_CCMR2_Output_CC3S_Values<TIM5::CCMR2_Output, 0, 2, ReadWriteMode, TIM5CCMR2_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCMR2_Output_CC3S_Values<TIM5::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +226,9 @@ struct TIM5
     using IC3F = TIM5_CCMR2_Input_IC3F_Values<TIM5::CCMR2_Input, 4, 4, ReadWriteMode, TIM5CCMR2_InputBase> ;
     using IC3PSC = TIM5_CCMR2_Input_IC3PSC_Values<TIM5::CCMR2_Input, 2, 2, ReadWriteMode, TIM5CCMR2_InputBase> ;
     using CC3S = TIM5_CCMR2_Input_CC3S_Values<TIM5::CCMR2_Input, 0, 2, ReadWriteMode, TIM5CCMR2_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCMR2_Input_CC3S_Values<TIM5::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +251,9 @@ struct TIM5
     using CC1NP = TIM5_CCER_CC1NP_Values<TIM5::CCER, 3, 1, ReadWriteMode, TIM5CCERBase> ;
     using CC1P = TIM5_CCER_CC1P_Values<TIM5::CCER, 1, 1, ReadWriteMode, TIM5CCERBase> ;
     using CC1E = TIM5_CCER_CC1E_Values<TIM5::CCER, 0, 1, ReadWriteMode, TIM5CCERBase> ;
+    static constexpr Type WritableMask = 0xBBBBU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCER_CC1E_Values<TIM5::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +266,11 @@ struct TIM5
   {
     using CNT_H = TIM5_CNT_CNT_H_Values<TIM5::CNT, 16, 16, ReadWriteMode, TIM5CNTBase> ;
     using CNT_L = TIM5_CNT_CNT_L_Values<TIM5::CNT, 0, 16, ReadWriteMode, TIM5CNTBase> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CNT_CNT_L_Values<TIM5::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -234,6 +282,9 @@ struct TIM5
   struct PSC : public RegisterBase<0x40000C28, 32, ReadWriteMode>
   {
     using PSCField = TIM5_PSC_PSC_Values<TIM5::PSC, 0, 16, ReadWriteMode, TIM5PSCBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_PSC_PSC_Values<TIM5::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -246,6 +297,9 @@ struct TIM5
   {
     using ARR_H = TIM5_ARR_ARR_H_Values<TIM5::ARR, 16, 16, ReadWriteMode, TIM5ARRBase> ;
     using ARR_L = TIM5_ARR_ARR_L_Values<TIM5::ARR, 0, 16, ReadWriteMode, TIM5ARRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_ARR_ARR_L_Values<TIM5::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -258,6 +312,10 @@ struct TIM5
   {
     using CCR1_H = TIM5_CCR1_CCR1_H_Values<TIM5::CCR1, 16, 16, ReadWriteMode, TIM5CCR1Base> ;
     using CCR1_L = TIM5_CCR1_CCR1_L_Values<TIM5::CCR1, 0, 16, ReadWriteMode, TIM5CCR1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCR1_CCR1_L_Values<TIM5::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +328,10 @@ struct TIM5
   {
     using CCR2_H = TIM5_CCR2_CCR2_H_Values<TIM5::CCR2, 16, 16, ReadWriteMode, TIM5CCR2Base> ;
     using CCR2_L = TIM5_CCR2_CCR2_L_Values<TIM5::CCR2, 0, 16, ReadWriteMode, TIM5CCR2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCR2_CCR2_L_Values<TIM5::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +344,10 @@ struct TIM5
   {
     using CCR3_H = TIM5_CCR3_CCR3_H_Values<TIM5::CCR3, 16, 16, ReadWriteMode, TIM5CCR3Base> ;
     using CCR3_L = TIM5_CCR3_CCR3_L_Values<TIM5::CCR3, 0, 16, ReadWriteMode, TIM5CCR3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCR3_CCR3_L_Values<TIM5::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -294,6 +360,10 @@ struct TIM5
   {
     using CCR4_H = TIM5_CCR4_CCR4_H_Values<TIM5::CCR4, 16, 16, ReadWriteMode, TIM5CCR4Base> ;
     using CCR4_L = TIM5_CCR4_CCR4_L_Values<TIM5::CCR4, 0, 16, ReadWriteMode, TIM5CCR4Base> ;
+    static constexpr Type VolatileMask = 0xFFFFFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_CCR4_CCR4_L_Values<TIM5::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +376,9 @@ struct TIM5
   {
     using DBL = TIM5_DCR_DBL_Values<TIM5::DCR, 8, 5, ReadWriteMode, TIM5DCRBase> ;
     using DBA = TIM5_DCR_DBA_Values<TIM5::DCR, 0, 5, ReadWriteMode, TIM5DCRBase> ;
+    static constexpr Type WritableMask = 0x1F1FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_DCR_DBA_Values<TIM5::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -317,6 +390,9 @@ struct TIM5
   struct DMAR : public RegisterBase<0x40000C4C, 32, ReadWriteMode>
   {
     using DMAB = TIM5_DMAR_DMAB_Values<TIM5::DMAR, 0, 16, ReadWriteMode, TIM5DMARBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_DMAR_DMAB_Values<TIM5::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -328,12 +404,19 @@ struct TIM5
   struct OR : public RegisterBase<0x40000C50, 32, ReadWriteMode>
   {
     using IT4_RMP = TIM5_OR_IT4_RMP_Values<TIM5::OR, 6, 2, ReadWriteMode, TIM5ORBase> ;
+    static constexpr Type WritableMask = 0xC0U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM5 ;
     using FieldValues = TIM5_OR_IT4_RMP_Values<TIM5::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ORPack  = Register<0x40000C50, 32, ReadWriteMode, TIM5ORBase, T...> ;
 
+  template<std::size_t index>
+  using CCR = IndexedType<index, 1U, TIM5::CCR1, TIM5::CCR2, TIM5::CCR3, TIM5::CCR4> ;
+
+  using Registers = TypesList<TIM5::CR1, TIM5::CR2, TIM5::SMCR, TIM5::DIER, TIM5::SR, TIM5::EGR, TIM5::CCMR1_Output, TIM5::CCMR1_Input, TIM5::CCMR2_Output, TIM5::CCMR2_Input, TIM5::CCER, TIM5::CNT, TIM5::PSC, TIM5::ARR, TIM5::CCR1, TIM5::CCR2, TIM5::CCR3, TIM5::CCR4, TIM5::DCR, TIM5::DMAR, TIM5::OR> ;
 } ;
 
 #endif //#if !defined(TIM5REGISTERS_HPP)
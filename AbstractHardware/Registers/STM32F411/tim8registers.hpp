@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct TIM8
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40010400U ;
+
   struct TIM8CR1Base {} ;
 
   struct CR1 : public RegisterBase<0x40010400, 32, ReadWriteMode>
@@ -29,6 +34,11 @@ struct TIM8
     using URS = TIM8_CR1_URS_Values<TIM8::CR1, 2, 1, ReadWriteMode, TIM8CR1Base> ;
     using UDIS = TIM8_CR1_UDIS_Values<TIM8::CR1, 1, 1, ReadWriteMode, TIM8CR1Base> ;
     using CEN = TIM8_CR1_CEN_Values<TIM8::CR1, 0, 1, ReadWriteMode, TIM8CR1Base> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x3FEU ;
+    static constexpr Type EnableMask = 0x1U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CR1_CEN_Values<TIM8::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +61,12 @@ struct TIM8
     using CCDS = TIM8_CR2_CCDS_Values<TIM8::CR2, 3, 1, ReadWriteMode, TIM8CR2Base> ;
     using CCUS = TIM8_CR2_CCUS_Values<TIM8::CR2, 2, 1, ReadWriteMode, TIM8CR2Base> ;
     using CCPC = TIM8_CR2_CCPC_Values<TIM8::CR2, 0, 1, ReadWriteMode, TIM8CR2Base> ;
+    static constexpr Type WritableMask = 0x7FFDU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using OISArray = FieldArray<1U, OIS1, OIS2, OIS3, OIS4> ;
+    template<std::size_t index>
+    using Field = typename OISArray::template Field<index> ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CR2_CCPC_Values<TIM8::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -68,6 +84,9 @@ struct TIM8
     using MSM = TIM8_SMCR_MSM_Values<TIM8::SMCR, 7, 1, ReadWriteMode, TIM8SMCRBase> ;
     using TS = TIM8_SMCR_TS_Values<TIM8::SMCR, 4, 3, ReadWriteMode, TIM8SMCRBase> ;
     using SMS = TIM8_SMCR_SMS_Values<TIM8::SMCR, 0, 3, ReadWriteMode, TIM8SMCRBase> ;
+    static constexpr Type WritableMask = 0xFFF7U ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_SMCR_SMS_Values<TIM8::SMCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +112,9 @@ struct TIM8
     using CC2IE = TIM8_DIER_CC2IE_Values<TIM8::DIER, 2, 1, ReadWriteMode, TIM8DIERBase> ;
     using CC1IE = TIM8_DIER_CC1IE_Values<TIM8::DIER, 1, 1, ReadWriteMode, TIM8DIERBase> ;
     using UIE = TIM8_DIER_UIE_Values<TIM8::DIER, 0, 1, ReadWriteMode, TIM8DIERBase> ;
+    static constexpr Type WritableMask = 0x7FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_DIER_UIE_Values<TIM8::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +137,12 @@ struct TIM8
     using CC2IF = TIM8_SR_CC2IF_Values<TIM8::SR, 2, 1, ReadWriteMode, TIM8SRBase> ;
     using CC1IF = TIM8_SR_CC1IF_Values<TIM8::SR, 1, 1, ReadWriteMode, TIM8SRBase> ;
     using UIF = TIM8_SR_UIF_Values<TIM8::SR, 0, 1, ReadWriteMode, TIM8SRBase> ;
+    static constexpr Type VolatileMask = 0x1EFFU ;
+    static constexpr Type WritableMask = 0x1EFFU ;
+    static constexpr Type ZeroToClearMask = 0x1EFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_SR_UIF_Values<TIM8::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +161,9 @@ struct TIM8
     using CC2G = TIM8_EGR_CC2G_Values<TIM8::EGR, 2, 1, WriteMode, TIM8EGRBase> ;
     using CC1G = TIM8_EGR_CC1G_Values<TIM8::EGR, 1, 1, WriteMode, TIM8EGRBase> ;
     using UG = TIM8_EGR_UG_Values<TIM8::EGR, 0, 1, WriteMode, TIM8EGRBase> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_EGR_UG_Values<TIM8::EGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +184,9 @@ struct TIM8
     using OC1PE = TIM8_CCMR1_Output_OC1PE_Values<TIM8::CCMR1_Output, 3, 1, ReadWriteMode, TIM8CCMR1_OutputBase> ;
     using OC1FE = TIM8_CCMR1_Output_OC1FE_Values<TIM8::CCMR1_Output, 2, 1, ReadWriteMode, TIM8CCMR1_OutputBase> ;
     using CC1S = TIM8_CCMR1_Output_CC1S_Values<TIM8::CCMR1_Output, 0, 2, ReadWriteMode, TIM8CCMR1_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCMR1_Output_CC1S_Values<TIM8::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +203,9 @@ struct TIM8
     using IC1F = TIM8_CCMR1_Input_IC1F_Values<TIM8::CCMR1_Input, 4, 4, ReadWriteMode, TIM8CCMR1_InputBase> ;
     using ICPCS = TIM8_CCMR1_Input_ICPCS_Values<TIM8::CCMR1_Input, 2, 2, ReadWriteMode, TIM8CCMR1_InputBase> ;
     using CC1S = TIM8_CCMR1_Input_CC1S_Values<TIM8::CCMR1_Input, 0, 2, ReadWriteMode, TIM8CCMR1_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCMR1_Input_CC1S_Values<TIM8::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +226,9 @@ struct TIM8
     using OC3PE = TIM8_CCMR2_Output_OC3PE_Values<TIM8::CCMR2_Output, 3, 1, ReadWriteMode, TIM8CCMR2_OutputBase> ;
     using OC3FE = TIM8_CCMR2_Output_OC3FE_Values<TIM8::CCMR2_Output, 2, 1, ReadWriteMode, TIM8CCMR2_OutputBase> ;
     using CC3S = TIM8_CCMR2_Output_CC3S_Values<TIM8::CCMR2_Output, 0, 2, ReadWriteMode, TIM8CCMR2_OutputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCMR2_Output_CC3S_Values<TIM8::CCMR2_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -205,6 +245,9 @@ struct TIM8
     using IC3F = TIM8_CCMR2_Input_IC3F_Values<TIM8::CCMR2_Input, 4, 4, ReadWriteMode, TIM8CCMR2_InputBase> ;
     using IC3PSC = TIM8_CCMR2_Input_IC3PSC_Values<TIM8::CCMR2_Input, 2, 2, ReadWriteMode, TIM8CCMR2_InputBase> ;
     using CC3S = TIM8_CCMR2_Input_CC3S_Values<TIM8::CCMR2_Input, 0, 2, ReadWriteMode, TIM8CCMR2_InputBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCMR2_Input_CC3S_Values<TIM8::CCMR2_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +272,9 @@ struct TIM8
     using CC1NE = TIM8_CCER_CC1NE_Values<TIM8::CCER, 2, 1, ReadWriteMode, TIM8CCERBase> ;
     using CC1P = TIM8_CCER_CC1P_Values<TIM8::CCER, 1, 1, ReadWriteMode, TIM8CCERBase> ;
     using CC1E = TIM8_CCER_CC1E_Values<TIM8::CCER, 0, 1, ReadWriteMode, TIM8CCERBase> ;
+    static constexpr Type WritableMask = 0x3FFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCER_CC1E_Values<TIM8::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -240,6 +286,11 @@ struct TIM8
   struct CNT : public RegisterBase<0x40010424, 32, ReadWriteMode>
   {
     using CNTField = TIM8_CNT_CNT_Values<TIM8::CNT, 0, 16, ReadWriteMode, TIM8CNTBase> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CNT_CNT_Values<TIM8::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -251,6 +302,9 @@ struct TIM8
   struct PSC : public RegisterBase<0x40010428, 32, ReadWriteMode>
   {
     using PSCField = TIM8_PSC_PSC_Values<TIM8::PSC, 0, 16, ReadWriteMode, TIM8PSCBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_PSC_PSC_Values<TIM8::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +316,9 @@ struct TIM8
   struct ARR : public RegisterBase<0x4001042C, 32, ReadWriteMode>
   {
     using ARRField = TIM8_ARR_ARR_Values<TIM8::ARR, 0, 16, ReadWriteMode, TIM8ARRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_ARR_ARR_Values<TIM8::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +330,10 @@ struct TIM8
   struct CCR1 : public RegisterBase<0x40010434, 32, ReadWriteMode>
   {
     using CCR1Field = TIM8_CCR1_CCR1_Values<TIM8::CCR1, 0, 16, ReadWriteMode, TIM8CCR1Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCR1_CCR1_Values<TIM8::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +345,10 @@ struct TIM8
   struct CCR2 : public RegisterBase<0x40010438, 32, ReadWriteMode>
   {
     using CCR2Field = TIM8_CCR2_CCR2_Values<TIM8::CCR2, 0, 16, ReadWriteMode, TIM8CCR2Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCR2_CCR2_Values<TIM8::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -295,6 +360,10 @@ struct TIM8
   struct CCR3 : public RegisterBase<0x4001043C, 32, ReadWriteMode>
   {
     using CCR3Field = TIM8_CCR3_CCR3_Values<TIM8::CCR3, 0, 16, ReadWriteMode, TIM8CCR3Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCR3_CCR3_Values<TIM8::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -306,6 +375,10 @@ struct TIM8
   struct CCR4 : public RegisterBase<0x40010440, 32, ReadWriteMode>
   {
     using CCR4Field = TIM8_CCR4_CCR4_Values<TIM8::CCR4, 0, 16, ReadWriteMode, TIM8CCR4Base> ;
+    static constexpr Type VolatileMask = 0xFFFFU ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_CCR4_CCR4_Values<TIM8::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -318,6 +391,9 @@ struct TIM8
   {
     using DBL = TIM8_DCR_DBL_Values<TIM8::DCR, 8, 5, ReadWriteMode, TIM8DCRBase> ;
     using DBA = TIM8_DCR_DBA_Values<TIM8::DCR, 0, 5, ReadWriteMode, TIM8DCRBase> ;
+    static constexpr Type WritableMask = 0x1F1FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_DCR_DBA_Values<TIM8::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +405,9 @@ struct TIM8
   struct DMAR : public RegisterBase<0x4001044C, 32, ReadWriteMode>
   {
     using DMAB = TIM8_DMAR_DMAB_Values<TIM8::DMAR, 0, 16, ReadWriteMode, TIM8DMARBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_DMAR_DMAB_Values<TIM8::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +419,9 @@ struct TIM8
   struct RCR : public RegisterBase<0x40010430, 32, ReadWriteMode>
   {
     using REP = TIM8_RCR_REP_Values<TIM8::RCR, 0, 8, ReadWriteMode, TIM8RCRBase> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_RCR_REP_Values<TIM8::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -358,12 +440,19 @@ struct TIM8
     using OSSI = TIM8_BDTR_OSSI_Values<TIM8::BDTR, 10, 1, ReadWriteMode, TIM8BDTRBase> ;
     using LOCK = TIM8_BDTR_LOCK_Values<TIM8::BDTR, 8, 2, ReadWriteMode, TIM8BDTRBase> ;
     using DTG = TIM8_BDTR_DTG_Values<TIM8::BDTR, 0, 8, ReadWriteMode, TIM8BDTRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = TIM8 ;
     using FieldValues = TIM8_BDTR_DTG_Values<TIM8::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BDTRPack  = Register<0x40010444, 32, ReadWriteMode, TIM8BDTRBase, T...> ;
 
+  template<std::size_t index>
+  using CCR = IndexedType<index, 1U, TIM8::CCR1, TIM8::CCR2, TIM8::CCR3, TIM8::CCR4> ;
+
+  using Registers = TypesList<TIM8::CR1, TIM8::CR2, TIM8::SMCR, TIM8::DIER, TIM8::SR, TIM8::EGR, TIM8::CCMR1_Output, TIM8::CCMR1_Input, TIM8::CCMR2_Output, TIM8::CCMR2_Input, TIM8::CCER, TIM8::CNT, TIM8::PSC, TIM8::ARR, TIM8::CCR1, TIM8::CCR2, TIM8::CCR3, TIM8::CCR4, TIM8::DCR, TIM8::DMAR, TIM8::RCR, TIM8::BDTR> ;
 } ;
 
 #endif //#if !defined(TIM8REGISTERS_HPP)
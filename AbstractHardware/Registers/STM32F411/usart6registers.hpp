@@ -14,9 +14,14 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct USART6
 {
+  using Bus = Apb2Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40011400U ;
+
   struct USART6SRBase {} ;
 
   struct SR : public RegisterBase<0x40011400, 32, ReadWriteMode>
@@ -31,6 +36,12 @@ struct USART6
     using NF = USART6_SR_NF_Values<USART6::SR, 2, 1, ReadMode, USART6SRBase> ;
     using FE = USART6_SR_FE_Values<USART6::SR, 1, 1, ReadMode, USART6SRBase> ;
     using PE = USART6_SR_PE_Values<USART6::SR, 0, 1, ReadMode, USART6SRBase> ;
+    static constexpr Type VolatileMask = 0x3FFU ;
+    static constexpr Type WritableMask = 0x360U ;
+    static constexpr Type ZeroToClearMask = 0x360U ;
+    static constexpr Type ResetValue = 0xC00000U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_SR_PE_Values<USART6::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -42,6 +53,11 @@ struct USART6
   struct DR : public RegisterBase<0x40011404, 32, ReadWriteMode>
   {
     using DRField = USART6_DR_DR_Values<USART6::DR, 0, 9, ReadWriteMode, USART6DRBase> ;
+    static constexpr Type VolatileMask = 0x1FFU ;
+    static constexpr Type WritableMask = 0x1FFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_DR_DR_Values<USART6::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -54,6 +70,9 @@ struct USART6
   {
     using DIV_Mantissa = USART6_BRR_DIV_Mantissa_Values<USART6::BRR, 4, 12, ReadWriteMode, USART6BRRBase> ;
     using DIV_Fraction = USART6_BRR_DIV_Fraction_Values<USART6::BRR, 0, 4, ReadWriteMode, USART6BRRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_BRR_DIV_Fraction_Values<USART6::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -79,6 +98,11 @@ struct USART6
     using RE = USART6_CR1_RE_Values<USART6::CR1, 2, 1, ReadWriteMode, USART6CR1Base> ;
     using RWU = USART6_CR1_RWU_Values<USART6::CR1, 1, 1, ReadWriteMode, USART6CR1Base> ;
     using SBK = USART6_CR1_SBK_Values<USART6::CR1, 0, 1, ReadWriteMode, USART6CR1Base> ;
+    static constexpr Type WritableMask = 0xBFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x9FFFU ;
+    static constexpr Type EnableMask = 0x2000U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_CR1_SBK_Values<USART6::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +122,9 @@ struct USART6
     using LBDIE = USART6_CR2_LBDIE_Values<USART6::CR2, 6, 1, ReadWriteMode, USART6CR2Base> ;
     using LBDL = USART6_CR2_LBDL_Values<USART6::CR2, 5, 1, ReadWriteMode, USART6CR2Base> ;
     using ADD = USART6_CR2_ADD_Values<USART6::CR2, 0, 4, ReadWriteMode, USART6CR2Base> ;
+    static constexpr Type WritableMask = 0x7F6FU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_CR2_ADD_Values<USART6::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +147,9 @@ struct USART6
     using IRLP = USART6_CR3_IRLP_Values<USART6::CR3, 2, 1, ReadWriteMode, USART6CR3Base> ;
     using IREN = USART6_CR3_IREN_Values<USART6::CR3, 1, 1, ReadWriteMode, USART6CR3Base> ;
     using EIE = USART6_CR3_EIE_Values<USART6::CR3, 0, 1, ReadWriteMode, USART6CR3Base> ;
+    static constexpr Type WritableMask = 0xFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_CR3_EIE_Values<USART6::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,12 +162,16 @@ struct USART6
   {
     using GT = USART6_GTPR_GT_Values<USART6::GTPR, 8, 8, ReadWriteMode, USART6GTPRBase> ;
     using PSC = USART6_GTPR_PSC_Values<USART6::GTPR, 0, 8, ReadWriteMode, USART6GTPRBase> ;
+    static constexpr Type WritableMask = 0xFFFFU ;
+    static constexpr Type ResetValue = 0x0U ;
+    using Peripheral = USART6 ;
     using FieldValues = USART6_GTPR_PSC_Values<USART6::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using GTPRPack  = Register<0x40011418, 32, ReadWriteMode, USART6GTPRBase, T...> ;
 
+  using Registers = TypesList<USART6::SR, USART6::DR, USART6::BRR, USART6::CR1, USART6::CR2, USART6::CR3, USART6::GTPR> ;
 } ;
 
 #endif //#if !defined(USART6REGISTERS_HPP)
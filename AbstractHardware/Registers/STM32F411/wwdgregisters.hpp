@@ -14,15 +14,23 @@
 #include "registerbase.hpp"   //for RegisterBase
 #include "register.hpp"       //for Register
 #include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  
+#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  
+#include "fieldarray.hpp"     //for FieldArray, IndexedType
 
 struct WWDG
 {
+  using Bus = Apb1Bus ;
+  static constexpr std::uintptr_t BaseAddress = 0x40002C00U ;
+
   struct WWDGCRBase {} ;
 
   struct CR : public RegisterBase<0x40002C00, 32, ReadWriteMode>
   {
     using WDGA = WWDG_CR_WDGA_Values<WWDG::CR, 7, 1, ReadWriteMode, WWDGCRBase> ;
     using T = WWDG_CR_T_Values<WWDG::CR, 0, 7, ReadWriteMode, WWDGCRBase> ;
+    static constexpr Type WritableMask = 0xFFU ;
+    static constexpr Type ResetValue = 0x7FU ;
+    using Peripheral = WWDG ;
     using FieldValues = WWDG_CR_T_Values<WWDG::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -37,6 +45,12 @@ struct WWDG
     using WDGTB1 = WWDG_CFR_WDGTB1_Values<WWDG::CFR, 8, 1, ReadWriteMode, WWDGCFRBase> ;
     using WDGTB0 = WWDG_CFR_WDGTB0_Values<WWDG::CFR, 7, 1, ReadWriteMode, WWDGCFRBase> ;
     using W = WWDG_CFR_W_Values<WWDG::CFR, 0, 7, ReadWriteMode, WWDGCFRBase> ;
+    static constexpr Type WritableMask = 0x3FFU ;
+    static constexpr Type ResetValue = 0x7FU ;
+    using WDGTBArray = FieldArray<0U, WDGTB0, WDGTB1> ;
+    template<std::size_t index>
+    using Field = typename WDGTBArray::template Field<index> ;
+    using Peripheral = WWDG ;
     using FieldValues = WWDG_CFR_W_Values<WWDG::CFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -48,12 +62,19 @@ struct WWDG
   struct SR : public RegisterBase<0x40002C08, 32, ReadWriteMode>
   {
     using EWIF = WWDG_SR_EWIF_Values<WWDG::SR, 0, 1, ReadWriteMode, WWDGSRBase> ;
+    static constexpr Type VolatileMask = 0x1U ;
+    static constexpr Type WritableMask = 0x1U ;
+    static constexpr Type ZeroToClearMask = 0x1U ;
+    static constexpr Type ResetValue = 0x0U ;
+    static constexpr Type SnapshotMask = 0x0U ;
+    using Peripheral = WWDG ;
     using FieldValues = WWDG_SR_EWIF_Values<WWDG::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SRPack  = Register<0x40002C08, 32, ReadWriteMode, WWDGSRBase, T...> ;
 
+  using Registers = TypesList<WWDG::CR, WWDG::CFR, WWDG::SR> ;
 } ;
 
 #endif //#if !defined(WWDGREGISTERS_HPP)
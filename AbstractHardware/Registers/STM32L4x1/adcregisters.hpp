@@ -32,6 +32,9 @@ struct ADC
     using EOC = ADC_ISR_EOC_Values<ADC::ISR, 2, 1, ReadWriteMode, ADCISRBase> ;
     using EOSMP = ADC_ISR_EOSMP_Values<ADC::ISR, 1, 1, ReadWriteMode, ADCISRBase> ;
     using ADRDY = ADC_ISR_ADRDY_Values<ADC::ISR, 0, 1, ReadWriteMode, ADCISRBase> ;
+    static constexpr Type WritableMask = 0x7FFU ;
+    static constexpr Type OneToClearMask = 0x7FFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = ADC_ISR_ADRDY_Values<ADC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -53,6 +56,7 @@ struct ADC
     using EOCIE = ADC_IER_EOCIE_Values<ADC::IER, 2, 1, ReadWriteMode, ADCIERBase> ;
     using EOSMPIE = ADC_IER_EOSMPIE_Values<ADC::IER, 1, 1, ReadWriteMode, ADCIERBase> ;
     using ADRDYIE = ADC_IER_ADRDYIE_Values<ADC::IER, 0, 1, ReadWriteMode, ADCIERBase> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = ADC_IER_ADRDYIE_Values<ADC::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -73,6 +77,7 @@ struct ADC
     using ADSTART = ADC_CR_ADSTART_Values<ADC::CR, 2, 1, ReadWriteMode, ADCCRBase> ;
     using ADDIS = ADC_CR_ADDIS_Values<ADC::CR, 1, 1, ReadWriteMode, ADCCRBase> ;
     using ADEN = ADC_CR_ADEN_Values<ADC::CR, 0, 1, ReadWriteMode, ADCCRBase> ;
+    static constexpr Type SnapshotMask = 0xF000003FU ;
     using FieldValues = ADC_CR_ADEN_Values<ADC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -102,6 +107,7 @@ struct ADC
     using RES = ADC_CFGR_RES_Values<ADC::CFGR, 3, 2, ReadWriteMode, ADCCFGRBase> ;
     using DMACFG = ADC_CFGR_DMACFG_Values<ADC::CFGR, 1, 1, ReadWriteMode, ADCCFGRBase> ;
     using DMAEN = ADC_CFGR_DMAEN_Values<ADC::CFGR, 0, 1, ReadWriteMode, ADCCFGRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFBU ;
     using FieldValues = ADC_CFGR_DMAEN_Values<ADC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +124,7 @@ struct ADC
     using OVSR = ADC_CFGR2_OVSR_Values<ADC::CFGR2, 2, 3, ReadWriteMode, ADCCFGR2Base> ;
     using JOVSE = ADC_CFGR2_JOVSE_Values<ADC::CFGR2, 1, 1, ReadWriteMode, ADCCFGR2Base> ;
     using ROVSE = ADC_CFGR2_ROVSE_Values<ADC::CFGR2, 0, 1, ReadWriteMode, ADCCFGR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFU ;
     using FieldValues = ADC_CFGR2_ROVSE_Values<ADC::CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +144,7 @@ struct ADC
     using SMP3 = ADC_SMPR1_SMP3_Values<ADC::SMPR1, 9, 3, ReadWriteMode, ADCSMPR1Base> ;
     using SMP2 = ADC_SMPR1_SMP2_Values<ADC::SMPR1, 6, 3, ReadWriteMode, ADCSMPR1Base> ;
     using SMP1 = ADC_SMPR1_SMP1_Values<ADC::SMPR1, 3, 3, ReadWriteMode, ADCSMPR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFF8U ;
     using FieldValues = ADC_SMPR1_SMP1_Values<ADC::SMPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -156,6 +164,7 @@ struct ADC
     using SMP12 = ADC_SMPR2_SMP12_Values<ADC::SMPR2, 6, 3, ReadWriteMode, ADCSMPR2Base> ;
     using SMP11 = ADC_SMPR2_SMP11_Values<ADC::SMPR2, 3, 3, ReadWriteMode, ADCSMPR2Base> ;
     using SMP10 = ADC_SMPR2_SMP10_Values<ADC::SMPR2, 0, 3, ReadWriteMode, ADCSMPR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = ADC_SMPR2_SMP10_Values<ADC::SMPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -168,6 +177,7 @@ struct ADC
   {
     using HT1 = ADC_TR1_HT1_Values<ADC::TR1, 16, 12, ReadWriteMode, ADCTR1Base> ;
     using LT1 = ADC_TR1_LT1_Values<ADC::TR1, 0, 12, ReadWriteMode, ADCTR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = ADC_TR1_LT1_Values<ADC::TR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +190,7 @@ struct ADC
   {
     using HT2 = ADC_TR2_HT2_Values<ADC::TR2, 16, 8, ReadWriteMode, ADCTR2Base> ;
     using LT2 = ADC_TR2_LT2_Values<ADC::TR2, 0, 8, ReadWriteMode, ADCTR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC_TR2_LT2_Values<ADC::TR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +203,7 @@ struct ADC
   {
     using HT3 = ADC_TR3_HT3_Values<ADC::TR3, 16, 8, ReadWriteMode, ADCTR3Base> ;
     using LT3 = ADC_TR3_LT3_Values<ADC::TR3, 0, 8, ReadWriteMode, ADCTR3Base> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = ADC_TR3_LT3_Values<ADC::TR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +219,7 @@ struct ADC
     using SQ2 = ADC_SQR1_SQ2_Values<ADC::SQR1, 12, 5, ReadWriteMode, ADCSQR1Base> ;
     using SQ1 = ADC_SQR1_SQ1_Values<ADC::SQR1, 6, 5, ReadWriteMode, ADCSQR1Base> ;
     using L3 = ADC_SQR1_L3_Values<ADC::SQR1, 0, 4, ReadWriteMode, ADCSQR1Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7CFU ;
     using FieldValues = ADC_SQR1_L3_Values<ADC::SQR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +235,7 @@ struct ADC
     using SQ7 = ADC_SQR2_SQ7_Values<ADC::SQR2, 12, 5, ReadWriteMode, ADCSQR2Base> ;
     using SQ6 = ADC_SQR2_SQ6_Values<ADC::SQR2, 6, 5, ReadWriteMode, ADCSQR2Base> ;
     using SQ5 = ADC_SQR2_SQ5_Values<ADC::SQR2, 0, 5, ReadWriteMode, ADCSQR2Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC_SQR2_SQ5_Values<ADC::SQR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +251,7 @@ struct ADC
     using SQ12 = ADC_SQR3_SQ12_Values<ADC::SQR3, 12, 5, ReadWriteMode, ADCSQR3Base> ;
     using SQ11 = ADC_SQR3_SQ11_Values<ADC::SQR3, 6, 5, ReadWriteMode, ADCSQR3Base> ;
     using SQ10 = ADC_SQR3_SQ10_Values<ADC::SQR3, 0, 5, ReadWriteMode, ADCSQR3Base> ;
+    static constexpr Type SnapshotMask = 0x1F7DF7DFU ;
     using FieldValues = ADC_SQR3_SQ10_Values<ADC::SQR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -249,6 +264,7 @@ struct ADC
   {
     using SQ16 = ADC_SQR4_SQ16_Values<ADC::SQR4, 6, 5, ReadWriteMode, ADCSQR4Base> ;
     using SQ15 = ADC_SQR4_SQ15_Values<ADC::SQR4, 0, 5, ReadWriteMode, ADCSQR4Base> ;
+    static constexpr Type SnapshotMask = 0x7DFU ;
     using FieldValues = ADC_SQR4_SQ15_Values<ADC::SQR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -277,6 +293,7 @@ struct ADC
     using JEXTEN = ADC_JSQR_JEXTEN_Values<ADC::JSQR, 6, 2, ReadWriteMode, ADCJSQRBase> ;
     using JEXTSEL = ADC_JSQR_JEXTSEL_Values<ADC::JSQR, 2, 4, ReadWriteMode, ADCJSQRBase> ;
     using JL = ADC_JSQR_JL_Values<ADC::JSQR, 0, 2, ReadWriteMode, ADCJSQRBase> ;
+    static constexpr Type SnapshotMask = 0x7DF7DFFFU ;
     using FieldValues = ADC_JSQR_JL_Values<ADC::JSQR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -290,6 +307,7 @@ struct ADC
     using OFFSET1_EN = ADC_OFR1_OFFSET1_EN_Values<ADC::OFR1, 31, 1, ReadWriteMode, ADCOFR1Base> ;
     using OFFSET1_CH = ADC_OFR1_OFFSET1_CH_Values<ADC::OFR1, 26, 5, ReadWriteMode, ADCOFR1Base> ;
     using OFFSET1 = ADC_OFR1_OFFSET1_Values<ADC::OFR1, 0, 12, ReadWriteMode, ADCOFR1Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC_OFR1_OFFSET1_Values<ADC::OFR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -303,6 +321,7 @@ struct ADC
     using OFFSET2_EN = ADC_OFR2_OFFSET2_EN_Values<ADC::OFR2, 31, 1, ReadWriteMode, ADCOFR2Base> ;
     using OFFSET2_CH = ADC_OFR2_OFFSET2_CH_Values<ADC::OFR2, 26, 5, ReadWriteMode, ADCOFR2Base> ;
     using OFFSET2 = ADC_OFR2_OFFSET2_Values<ADC::OFR2, 0, 12, ReadWriteMode, ADCOFR2Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC_OFR2_OFFSET2_Values<ADC::OFR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -316,6 +335,7 @@ struct ADC
     using OFFSET3_EN = ADC_OFR3_OFFSET3_EN_Values<ADC::OFR3, 31, 1, ReadWriteMode, ADCOFR3Base> ;
     using OFFSET3_CH = ADC_OFR3_OFFSET3_CH_Values<ADC::OFR3, 26, 5, ReadWriteMode, ADCOFR3Base> ;
     using OFFSET3 = ADC_OFR3_OFFSET3_Values<ADC::OFR3, 0, 12, ReadWriteMode, ADCOFR3Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC_OFR3_OFFSET3_Values<ADC::OFR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +349,7 @@ struct ADC
     using OFFSET4_EN = ADC_OFR4_OFFSET4_EN_Values<ADC::OFR4, 31, 1, ReadWriteMode, ADCOFR4Base> ;
     using OFFSET4_CH = ADC_OFR4_OFFSET4_CH_Values<ADC::OFR4, 26, 5, ReadWriteMode, ADCOFR4Base> ;
     using OFFSET4 = ADC_OFR4_OFFSET4_Values<ADC::OFR4, 0, 12, ReadWriteMode, ADCOFR4Base> ;
+    static constexpr Type SnapshotMask = 0xFC000FFFU ;
     using FieldValues = ADC_OFR4_OFFSET4_Values<ADC::OFR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -384,6 +405,7 @@ struct ADC
   struct AWD2CR : public RegisterBase<0x500400A0, 32, ReadWriteMode>
   {
     using AWD2CH = ADC_AWD2CR_AWD2CH_Values<ADC::AWD2CR, 1, 18, ReadWriteMode, ADCAWD2CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC_AWD2CR_AWD2CH_Values<ADC::AWD2CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -395,6 +417,7 @@ struct ADC
   struct AWD3CR : public RegisterBase<0x500400A4, 32, ReadWriteMode>
   {
     using AWD3CH = ADC_AWD3CR_AWD3CH_Values<ADC::AWD3CR, 1, 18, ReadWriteMode, ADCAWD3CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFEU ;
     using FieldValues = ADC_AWD3CR_AWD3CH_Values<ADC::AWD3CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -407,6 +430,7 @@ struct ADC
   {
     using DIFSEL_1_15 = ADC_DIFSEL_DIFSEL_1_15_Values<ADC::DIFSEL, 1, 15, ReadWriteMode, ADCDIFSELBase> ;
     using DIFSEL_16_18 = ADC_DIFSEL_DIFSEL_16_18_Values<ADC::DIFSEL, 16, 3, ReadMode, ADCDIFSELBase> ;
+    static constexpr Type SnapshotMask = 0xFFFEU ;
     using FieldValues = ADC_DIFSEL_DIFSEL_16_18_Values<ADC::DIFSEL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -419,12 +443,14 @@ struct ADC
   {
     using CALFACT_D = ADC_CALFACT_CALFACT_D_Values<ADC::CALFACT, 16, 7, ReadWriteMode, ADCCALFACTBase> ;
     using CALFACT_S = ADC_CALFACT_CALFACT_S_Values<ADC::CALFACT, 0, 7, ReadWriteMode, ADCCALFACTBase> ;
+    static constexpr Type SnapshotMask = 0x7F007FU ;
     using FieldValues = ADC_CALFACT_CALFACT_S_Values<ADC::CALFACT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CALFACTPack  = Register<0x500400B4, 32, ReadWriteMode, ADCCALFACTBase, T...> ;
 
+  using Registers = TypesList<ADC::ISR, ADC::IER, ADC::CR, ADC::CFGR, ADC::CFGR2, ADC::SMPR1, ADC::SMPR2, ADC::TR1, ADC::TR2, ADC::TR3, ADC::SQR1, ADC::SQR2, ADC::SQR3, ADC::SQR4, ADC::DR, ADC::JSQR, ADC::OFR1, ADC::OFR2, ADC::OFR3, ADC::OFR4, ADC::JDR1, ADC::JDR2, ADC::JDR3, ADC::JDR4, ADC::AWD2CR, ADC::AWD3CR, ADC::DIFSEL, ADC::CALFACT> ;
 } ;
 
 #endif //#if !defined(ADCREGISTERS_HPP)
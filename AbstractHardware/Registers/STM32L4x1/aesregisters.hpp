@@ -31,6 +31,7 @@ struct AES
     using MODE = AES_CR_MODE_Values<AES::CR, 3, 2, ReadWriteMode, AESCRBase> ;
     using DATATYPE = AES_CR_DATATYPE_Values<AES::CR, 1, 2, ReadWriteMode, AESCRBase> ;
     using EN = AES_CR_EN_Values<AES::CR, 0, 1, ReadWriteMode, AESCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFU ;
     using FieldValues = AES_CR_EN_Values<AES::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +56,7 @@ struct AES
   struct DINR : public RegisterBase<0x50060008, 32, ReadWriteMode>
   {
     using AES_DINR = AES_DINR_AES_DINR_Values<AES::DINR, 0, 32, ReadWriteMode, AESDINRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_DINR_AES_DINR_Values<AES::DINR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +79,7 @@ struct AES
   struct KEYR0 : public RegisterBase<0x50060010, 32, ReadWriteMode>
   {
     using AES_KEYR0 = AES_KEYR0_AES_KEYR0_Values<AES::KEYR0, 0, 32, ReadWriteMode, AESKEYR0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_KEYR0_AES_KEYR0_Values<AES::KEYR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +91,7 @@ struct AES
   struct KEYR1 : public RegisterBase<0x50060014, 32, ReadWriteMode>
   {
     using AES_KEYR1 = AES_KEYR1_AES_KEYR1_Values<AES::KEYR1, 0, 32, ReadWriteMode, AESKEYR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_KEYR1_AES_KEYR1_Values<AES::KEYR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +103,7 @@ struct AES
   struct KEYR2 : public RegisterBase<0x50060018, 32, ReadWriteMode>
   {
     using AES_KEYR2 = AES_KEYR2_AES_KEYR2_Values<AES::KEYR2, 0, 32, ReadWriteMode, AESKEYR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_KEYR2_AES_KEYR2_Values<AES::KEYR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -110,6 +115,7 @@ struct AES
   struct KEYR3 : public RegisterBase<0x5006001C, 32, ReadWriteMode>
   {
     using AES_KEYR3 = AES_KEYR3_AES_KEYR3_Values<AES::KEYR3, 0, 32, ReadWriteMode, AESKEYR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_KEYR3_AES_KEYR3_Values<AES::KEYR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +127,7 @@ struct AES
   struct IVR0 : public RegisterBase<0x50060020, 32, ReadWriteMode>
   {
     using AES_IVR0 = AES_IVR0_AES_IVR0_Values<AES::IVR0, 0, 32, ReadWriteMode, AESIVR0Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_IVR0_AES_IVR0_Values<AES::IVR0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -132,6 +139,7 @@ struct AES
   struct IVR1 : public RegisterBase<0x50060024, 32, ReadWriteMode>
   {
     using AES_IVR1 = AES_IVR1_AES_IVR1_Values<AES::IVR1, 0, 32, ReadWriteMode, AESIVR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_IVR1_AES_IVR1_Values<AES::IVR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -143,6 +151,7 @@ struct AES
   struct IVR2 : public RegisterBase<0x50060028, 32, ReadWriteMode>
   {
     using AES_IVR2 = AES_IVR2_AES_IVR2_Values<AES::IVR2, 0, 32, ReadWriteMode, AESIVR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_IVR2_AES_IVR2_Values<AES::IVR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -154,12 +163,14 @@ struct AES
   struct IVR3 : public RegisterBase<0x5006002C, 32, ReadWriteMode>
   {
     using AES_IVR3 = AES_IVR3_AES_IVR3_Values<AES::IVR3, 0, 32, ReadWriteMode, AESIVR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = AES_IVR3_AES_IVR3_Values<AES::IVR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using IVR3Pack  = Register<0x5006002C, 32, ReadWriteMode, AESIVR3Base, T...> ;
 
+  using Registers = TypesList<AES::CR, AES::SR, AES::DINR, AES::DOUTR, AES::KEYR0, AES::KEYR1, AES::KEYR2, AES::KEYR3, AES::IVR0, AES::IVR1, AES::IVR2, AES::IVR3> ;
 } ;
 
 #endif //#if !defined(AESREGISTERS_HPP)
@@ -33,6 +33,7 @@ struct COMP
     using COMP1_INMESEL = COMP_COMP1_CSR_COMP1_INMESEL_Values<COMP::COMP1_CSR, 25, 2, ReadWriteMode, COMPCOMP1_CSRBase> ;
     using COMP1_VALUE = COMP_COMP1_CSR_COMP1_VALUE_Values<COMP::COMP1_CSR, 30, 1, ReadMode, COMPCOMP1_CSRBase> ;
     using COMP1_LOCK = COMP_COMP1_CSR_COMP1_LOCK_Values<COMP::COMP1_CSR, 31, 1, WriteMode, COMPCOMP1_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x86DF81FDU ;
     using FieldValues = COMP_COMP1_CSR_COMP1_LOCK_Values<COMP::COMP1_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -56,12 +57,14 @@ struct COMP
     using COMP2_INMESEL = COMP_COMP2_CSR_COMP2_INMESEL_Values<COMP::COMP2_CSR, 25, 2, ReadWriteMode, COMPCOMP2_CSRBase> ;
     using COMP2_VALUE = COMP_COMP2_CSR_COMP2_VALUE_Values<COMP::COMP2_CSR, 30, 1, ReadMode, COMPCOMP2_CSRBase> ;
     using COMP2_LOCK = COMP_COMP2_CSR_COMP2_LOCK_Values<COMP::COMP2_CSR, 31, 1, WriteMode, COMPCOMP2_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x86DF83FDU ;
     using FieldValues = COMP_COMP2_CSR_COMP2_LOCK_Values<COMP::COMP2_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using COMP2_CSRPack  = Register<0x40010204, 32, ReadWriteMode, COMPCOMP2_CSRBase, T...> ;
 
+  using Registers = TypesList<COMP::COMP1_CSR, COMP::COMP2_CSR> ;
 } ;
 
 #endif //#if !defined(COMPREGISTERS_HPP)
@@ -29,6 +29,7 @@ struct CRS
     using ERRIE = CRS_CR_ERRIE_Values<CRS::CR, 2, 1, ReadWriteMode, CRSCRBase> ;
     using SYNCWARNIE = CRS_CR_SYNCWARNIE_Values<CRS::CR, 1, 1, ReadWriteMode, CRSCRBase> ;
     using SYNCOKIE = CRS_CR_SYNCOKIE_Values<CRS::CR, 0, 1, ReadWriteMode, CRSCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FEFU ;
     using FieldValues = CRS_CR_SYNCOKIE_Values<CRS::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct CRS
     using SYNCDIV = CRS_CFGR_SYNCDIV_Values<CRS::CFGR, 24, 3, ReadWriteMode, CRSCFGRBase> ;
     using FELIM = CRS_CFGR_FELIM_Values<CRS::CFGR, 16, 8, ReadWriteMode, CRSCFGRBase> ;
     using RELOAD = CRS_CFGR_RELOAD_Values<CRS::CFGR, 0, 16, ReadWriteMode, CRSCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xB7FFFFFFU ;
     using FieldValues = CRS_CFGR_RELOAD_Values<CRS::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,12 +79,14 @@ struct CRS
     using ERRC = CRS_ICR_ERRC_Values<CRS::ICR, 2, 1, ReadWriteMode, CRSICRBase> ;
     using SYNCWARNC = CRS_ICR_SYNCWARNC_Values<CRS::ICR, 1, 1, ReadWriteMode, CRSICRBase> ;
     using SYNCOKC = CRS_ICR_SYNCOKC_Values<CRS::ICR, 0, 1, ReadWriteMode, CRSICRBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = CRS_ICR_SYNCOKC_Values<CRS::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ICRPack  = Register<0x4000600C, 32, ReadWriteMode, CRSICRBase, T...> ;
 
+  using Registers = TypesList<CRS::CR, CRS::CFGR, CRS::ISR, CRS::ICR> ;
 } ;
 
 #endif //#if !defined(CRSREGISTERS_HPP)
@@ -37,6 +37,7 @@ struct DAC1
     using DMAEN2 = DAC1_CR_DMAEN2_Values<DAC1::CR, 28, 1, ReadWriteMode, DAC1CRBase> ;
     using DMAUDRIE2 = DAC1_CR_DMAUDRIE2_Values<DAC1::CR, 29, 1, ReadWriteMode, DAC1CRBase> ;
     using CEN2 = DAC1_CR_CEN2_Values<DAC1::CR, 30, 1, ReadWriteMode, DAC1CRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFD7FFDU ;
     using FieldValues = DAC1_CR_CEN2_Values<DAC1::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -60,6 +61,7 @@ struct DAC1
   struct DHR12R1 : public RegisterBase<0x40007408, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC1_DHR12R1_DACC1DHR_Values<DAC1::DHR12R1, 0, 12, ReadWriteMode, DAC1DHR12R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC1_DHR12R1_DACC1DHR_Values<DAC1::DHR12R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct DAC1
   struct DHR12L1 : public RegisterBase<0x4000740C, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC1_DHR12L1_DACC1DHR_Values<DAC1::DHR12L1, 4, 12, ReadWriteMode, DAC1DHR12L1Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC1_DHR12L1_DACC1DHR_Values<DAC1::DHR12L1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -82,6 +85,7 @@ struct DAC1
   struct DHR8R1 : public RegisterBase<0x40007410, 32, ReadWriteMode>
   {
     using DACC1DHR = DAC1_DHR8R1_DACC1DHR_Values<DAC1::DHR8R1, 0, 8, ReadWriteMode, DAC1DHR8R1Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC1_DHR8R1_DACC1DHR_Values<DAC1::DHR8R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -93,6 +97,7 @@ struct DAC1
   struct DHR12R2 : public RegisterBase<0x40007414, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC1_DHR12R2_DACC2DHR_Values<DAC1::DHR12R2, 0, 12, ReadWriteMode, DAC1DHR12R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = DAC1_DHR12R2_DACC2DHR_Values<DAC1::DHR12R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -104,6 +109,7 @@ struct DAC1
   struct DHR12L2 : public RegisterBase<0x40007418, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC1_DHR12L2_DACC2DHR_Values<DAC1::DHR12L2, 4, 12, ReadWriteMode, DAC1DHR12L2Base> ;
+    static constexpr Type SnapshotMask = 0xFFF0U ;
     using FieldValues = DAC1_DHR12L2_DACC2DHR_Values<DAC1::DHR12L2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +121,7 @@ struct DAC1
   struct DHR8R2 : public RegisterBase<0x4000741C, 32, ReadWriteMode>
   {
     using DACC2DHR = DAC1_DHR8R2_DACC2DHR_Values<DAC1::DHR8R2, 0, 8, ReadWriteMode, DAC1DHR8R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DAC1_DHR8R2_DACC2DHR_Values<DAC1::DHR8R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +134,7 @@ struct DAC1
   {
     using DACC1DHR = DAC1_DHR12RD_DACC1DHR_Values<DAC1::DHR12RD, 0, 12, ReadWriteMode, DAC1DHR12RDBase> ;
     using DACC2DHR = DAC1_DHR12RD_DACC2DHR_Values<DAC1::DHR12RD, 16, 12, ReadWriteMode, DAC1DHR12RDBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFFU ;
     using FieldValues = DAC1_DHR12RD_DACC2DHR_Values<DAC1::DHR12RD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -139,6 +147,7 @@ struct DAC1
   {
     using DACC1DHR = DAC1_DHR12LD_DACC1DHR_Values<DAC1::DHR12LD, 4, 12, ReadWriteMode, DAC1DHR12LDBase> ;
     using DACC2DHR = DAC1_DHR12LD_DACC2DHR_Values<DAC1::DHR12LD, 20, 12, ReadWriteMode, DAC1DHR12LDBase> ;
+    static constexpr Type SnapshotMask = 0xFFF0FFF0U ;
     using FieldValues = DAC1_DHR12LD_DACC2DHR_Values<DAC1::DHR12LD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +160,7 @@ struct DAC1
   {
     using DACC1DHR = DAC1_DHR8RD_DACC1DHR_Values<DAC1::DHR8RD, 0, 8, ReadWriteMode, DAC1DHR8RDBase> ;
     using DACC2DHR = DAC1_DHR8RD_DACC2DHR_Values<DAC1::DHR8RD, 8, 8, ReadWriteMode, DAC1DHR8RDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DAC1_DHR8RD_DACC2DHR_Values<DAC1::DHR8RD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +199,7 @@ struct DAC1
     using DMAUDR2 = DAC1_SR_DMAUDR2_Values<DAC1::SR, 29, 1, ReadWriteMode, DAC1SRBase> ;
     using CAL_FLAG2 = DAC1_SR_CAL_FLAG2_Values<DAC1::SR, 30, 1, ReadMode, DAC1SRBase> ;
     using BWST2 = DAC1_SR_BWST2_Values<DAC1::SR, 31, 1, ReadMode, DAC1SRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = DAC1_SR_BWST2_Values<DAC1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -201,6 +212,7 @@ struct DAC1
   {
     using OTRIM1 = DAC1_CCR_OTRIM1_Values<DAC1::CCR, 0, 5, ReadWriteMode, DAC1CCRBase> ;
     using OTRIM2 = DAC1_CCR_OTRIM2_Values<DAC1::CCR, 16, 5, ReadWriteMode, DAC1CCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F001FU ;
     using FieldValues = DAC1_CCR_OTRIM2_Values<DAC1::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -213,6 +225,7 @@ struct DAC1
   {
     using MODE1 = DAC1_MCR_MODE1_Values<DAC1::MCR, 0, 3, ReadWriteMode, DAC1MCRBase> ;
     using MODE2 = DAC1_MCR_MODE2_Values<DAC1::MCR, 16, 3, ReadWriteMode, DAC1MCRBase> ;
+    static constexpr Type SnapshotMask = 0x70007U ;
     using FieldValues = DAC1_MCR_MODE2_Values<DAC1::MCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +237,7 @@ struct DAC1
   struct SHSR1 : public RegisterBase<0x40007440, 32, ReadWriteMode>
   {
     using TSAMPLE1 = DAC1_SHSR1_TSAMPLE1_Values<DAC1::SHSR1, 0, 10, ReadWriteMode, DAC1SHSR1Base> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = DAC1_SHSR1_TSAMPLE1_Values<DAC1::SHSR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -235,6 +249,7 @@ struct DAC1
   struct SHSR2 : public RegisterBase<0x40007444, 32, ReadWriteMode>
   {
     using TSAMPLE2 = DAC1_SHSR2_TSAMPLE2_Values<DAC1::SHSR2, 0, 10, ReadWriteMode, DAC1SHSR2Base> ;
+    static constexpr Type SnapshotMask = 0x3FFU ;
     using FieldValues = DAC1_SHSR2_TSAMPLE2_Values<DAC1::SHSR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -247,6 +262,7 @@ struct DAC1
   {
     using THOLD1 = DAC1_SHHR_THOLD1_Values<DAC1::SHHR, 0, 10, ReadWriteMode, DAC1SHHRBase> ;
     using THOLD2 = DAC1_SHHR_THOLD2_Values<DAC1::SHHR, 16, 10, ReadWriteMode, DAC1SHHRBase> ;
+    static constexpr Type SnapshotMask = 0x3FF03FFU ;
     using FieldValues = DAC1_SHHR_THOLD2_Values<DAC1::SHHR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,12 +275,14 @@ struct DAC1
   {
     using TREFRESH1 = DAC1_SHRR_TREFRESH1_Values<DAC1::SHRR, 0, 8, ReadWriteMode, DAC1SHRRBase> ;
     using TREFRESH2 = DAC1_SHRR_TREFRESH2_Values<DAC1::SHRR, 16, 8, ReadWriteMode, DAC1SHRRBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = DAC1_SHRR_TREFRESH2_Values<DAC1::SHRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using SHRRPack  = Register<0x4000744C, 32, ReadWriteMode, DAC1SHRRBase, T...> ;
 
+  using Registers = TypesList<DAC1::CR, DAC1::SWTRIGR, DAC1::DHR12R1, DAC1::DHR12L1, DAC1::DHR8R1, DAC1::DHR12R2, DAC1::DHR12L2, DAC1::DHR8R2, DAC1::DHR12RD, DAC1::DHR12LD, DAC1::DHR8RD, DAC1::DOR1, DAC1::DOR2, DAC1::SR, DAC1::CCR, DAC1::MCR, DAC1::SHSR1, DAC1::SHSR2, DAC1::SHHR, DAC1::SHRR> ;
 } ;
 
 #endif //#if !defined(DAC1REGISTERS_HPP)
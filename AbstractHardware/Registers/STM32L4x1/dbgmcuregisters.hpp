@@ -38,6 +38,7 @@ struct DBGMCU
     using DBG_STANDBY = DBGMCU_CR_DBG_STANDBY_Values<DBGMCU::CR, 2, 1, ReadWriteMode, DBGMCUCRBase> ;
     using TRACE_IOEN = DBGMCU_CR_TRACE_IOEN_Values<DBGMCU::CR, 5, 1, ReadWriteMode, DBGMCUCRBase> ;
     using TRACE_MODE = DBGMCU_CR_TRACE_MODE_Values<DBGMCU::CR, 6, 2, ReadWriteMode, DBGMCUCRBase> ;
+    static constexpr Type SnapshotMask = 0xE7U ;
     using FieldValues = DBGMCU_CR_TRACE_MODE_Values<DBGMCU::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -59,6 +60,7 @@ struct DBGMCU
     using DBG_I2C3_STOP = DBGMCU_APB1FZR1_DBG_I2C3_STOP_Values<DBGMCU::APB1FZR1, 23, 1, ReadWriteMode, DBGMCUAPB1FZR1Base> ;
     using DBG_CAN_STOP = DBGMCU_APB1FZR1_DBG_CAN_STOP_Values<DBGMCU::APB1FZR1, 25, 1, ReadWriteMode, DBGMCUAPB1FZR1Base> ;
     using DBG_LPTIM1_STOP = DBGMCU_APB1FZR1_DBG_LPTIM1_STOP_Values<DBGMCU::APB1FZR1, 31, 1, ReadWriteMode, DBGMCUAPB1FZR1Base> ;
+    static constexpr Type SnapshotMask = 0x82E01C31U ;
     using FieldValues = DBGMCU_APB1FZR1_DBG_LPTIM1_STOP_Values<DBGMCU::APB1FZR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +72,7 @@ struct DBGMCU
   struct APB1FZR2 : public RegisterBase<0xE004200C, 32, ReadWriteMode>
   {
     using DBG_LPTIM2_STOP = DBGMCU_APB1FZR2_DBG_LPTIM2_STOP_Values<DBGMCU::APB1FZR2, 5, 1, ReadWriteMode, DBGMCUAPB1FZR2Base> ;
+    static constexpr Type SnapshotMask = 0x20U ;
     using FieldValues = DBGMCU_APB1FZR2_DBG_LPTIM2_STOP_Values<DBGMCU::APB1FZR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -83,12 +86,14 @@ struct DBGMCU
     using DBG_TIM1_STOP = DBGMCU_APB2FZR_DBG_TIM1_STOP_Values<DBGMCU::APB2FZR, 11, 1, ReadWriteMode, DBGMCUAPB2FZRBase> ;
     using DBG_TIM15_STOP = DBGMCU_APB2FZR_DBG_TIM15_STOP_Values<DBGMCU::APB2FZR, 16, 1, ReadWriteMode, DBGMCUAPB2FZRBase> ;
     using DBG_TIM16_STOP = DBGMCU_APB2FZR_DBG_TIM16_STOP_Values<DBGMCU::APB2FZR, 17, 1, ReadWriteMode, DBGMCUAPB2FZRBase> ;
+    static constexpr Type SnapshotMask = 0x30800U ;
     using FieldValues = DBGMCU_APB2FZR_DBG_TIM16_STOP_Values<DBGMCU::APB2FZR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using APB2FZRPack  = Register<0xE0042010, 32, ReadWriteMode, DBGMCUAPB2FZRBase, T...> ;
 
+  using Registers = TypesList<DBGMCU::IDCODE, DBGMCU::CR, DBGMCU::APB1FZR1, DBGMCU::APB1FZR2, DBGMCU::APB2FZR> ;
 } ;
 
 #endif //#if !defined(DBGMCUREGISTERS_HPP)
@@ -32,6 +32,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG0R1_SCDEN_Values<DFSDM::CHCFG0R1, 5, 1, ReadWriteMode, DFSDMCHCFG0R1Base> ;
     using SPICKSEL = DFSDM_CHCFG0R1_SPICKSEL_Values<DFSDM::CHCFG0R1, 2, 2, ReadWriteMode, DFSDMCHCFG0R1Base> ;
     using SITP = DFSDM_CHCFG0R1_SITP_Values<DFSDM::CHCFG0R1, 0, 2, ReadWriteMode, DFSDMCHCFG0R1Base> ;
+    static constexpr Type SnapshotMask = 0xC0FFF1EFU ;
     using FieldValues = DFSDM_CHCFG0R1_SITP_Values<DFSDM::CHCFG0R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG0R2_OFFSET_Values<DFSDM::CHCFG0R2, 8, 24, ReadWriteMode, DFSDMCHCFG0R2Base> ;
     using DTRBS = DFSDM_CHCFG0R2_DTRBS_Values<DFSDM::CHCFG0R2, 3, 5, ReadWriteMode, DFSDMCHCFG0R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG0R2_DTRBS_Values<DFSDM::CHCFG0R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +60,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD0R_AWFOSR_Values<DFSDM::AWSCD0R, 16, 5, ReadWriteMode, DFSDMAWSCD0RBase> ;
     using BKSCD = DFSDM_AWSCD0R_BKSCD_Values<DFSDM::AWSCD0R, 12, 4, ReadWriteMode, DFSDMAWSCD0RBase> ;
     using SCDT = DFSDM_AWSCD0R_SCDT_Values<DFSDM::AWSCD0R, 0, 8, ReadWriteMode, DFSDMAWSCD0RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD0R_SCDT_Values<DFSDM::AWSCD0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +72,7 @@ struct DFSDM
   struct CHWDAT0R : public RegisterBase<0x4001600C, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT0R_WDATA_Values<DFSDM::CHWDAT0R, 0, 16, ReadWriteMode, DFSDMCHWDAT0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT0R_WDATA_Values<DFSDM::CHWDAT0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +85,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN0R_INDAT1_Values<DFSDM::CHDATIN0R, 16, 16, ReadWriteMode, DFSDMCHDATIN0RBase> ;
     using INDAT0 = DFSDM_CHDATIN0R_INDAT0_Values<DFSDM::CHDATIN0R, 0, 16, ReadWriteMode, DFSDMCHDATIN0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN0R_INDAT0_Values<DFSDM::CHDATIN0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -99,6 +104,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG1R1_SCDEN_Values<DFSDM::CHCFG1R1, 5, 1, ReadWriteMode, DFSDMCHCFG1R1Base> ;
     using SPICKSEL = DFSDM_CHCFG1R1_SPICKSEL_Values<DFSDM::CHCFG1R1, 2, 2, ReadWriteMode, DFSDMCHCFG1R1Base> ;
     using SITP = DFSDM_CHCFG1R1_SITP_Values<DFSDM::CHCFG1R1, 0, 2, ReadWriteMode, DFSDMCHCFG1R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG1R1_SITP_Values<DFSDM::CHCFG1R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +117,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG1R2_OFFSET_Values<DFSDM::CHCFG1R2, 8, 24, ReadWriteMode, DFSDMCHCFG1R2Base> ;
     using DTRBS = DFSDM_CHCFG1R2_DTRBS_Values<DFSDM::CHCFG1R2, 3, 5, ReadWriteMode, DFSDMCHCFG1R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG1R2_DTRBS_Values<DFSDM::CHCFG1R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +132,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD1R_AWFOSR_Values<DFSDM::AWSCD1R, 16, 5, ReadWriteMode, DFSDMAWSCD1RBase> ;
     using BKSCD = DFSDM_AWSCD1R_BKSCD_Values<DFSDM::AWSCD1R, 12, 4, ReadWriteMode, DFSDMAWSCD1RBase> ;
     using SCDT = DFSDM_AWSCD1R_SCDT_Values<DFSDM::AWSCD1R, 0, 8, ReadWriteMode, DFSDMAWSCD1RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD1R_SCDT_Values<DFSDM::AWSCD1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +144,7 @@ struct DFSDM
   struct CHWDAT1R : public RegisterBase<0x4001602C, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT1R_WDATA_Values<DFSDM::CHWDAT1R, 0, 16, ReadWriteMode, DFSDMCHWDAT1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT1R_WDATA_Values<DFSDM::CHWDAT1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -148,6 +157,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN1R_INDAT1_Values<DFSDM::CHDATIN1R, 16, 16, ReadWriteMode, DFSDMCHDATIN1RBase> ;
     using INDAT0 = DFSDM_CHDATIN1R_INDAT0_Values<DFSDM::CHDATIN1R, 0, 16, ReadWriteMode, DFSDMCHDATIN1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN1R_INDAT0_Values<DFSDM::CHDATIN1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -166,6 +176,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG2R1_SCDEN_Values<DFSDM::CHCFG2R1, 5, 1, ReadWriteMode, DFSDMCHCFG2R1Base> ;
     using SPICKSEL = DFSDM_CHCFG2R1_SPICKSEL_Values<DFSDM::CHCFG2R1, 2, 2, ReadWriteMode, DFSDMCHCFG2R1Base> ;
     using SITP = DFSDM_CHCFG2R1_SITP_Values<DFSDM::CHCFG2R1, 0, 2, ReadWriteMode, DFSDMCHCFG2R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG2R1_SITP_Values<DFSDM::CHCFG2R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -178,6 +189,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG2R2_OFFSET_Values<DFSDM::CHCFG2R2, 8, 24, ReadWriteMode, DFSDMCHCFG2R2Base> ;
     using DTRBS = DFSDM_CHCFG2R2_DTRBS_Values<DFSDM::CHCFG2R2, 3, 5, ReadWriteMode, DFSDMCHCFG2R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG2R2_DTRBS_Values<DFSDM::CHCFG2R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -192,6 +204,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD2R_AWFOSR_Values<DFSDM::AWSCD2R, 16, 5, ReadWriteMode, DFSDMAWSCD2RBase> ;
     using BKSCD = DFSDM_AWSCD2R_BKSCD_Values<DFSDM::AWSCD2R, 12, 4, ReadWriteMode, DFSDMAWSCD2RBase> ;
     using SCDT = DFSDM_AWSCD2R_SCDT_Values<DFSDM::AWSCD2R, 0, 8, ReadWriteMode, DFSDMAWSCD2RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD2R_SCDT_Values<DFSDM::AWSCD2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -203,6 +216,7 @@ struct DFSDM
   struct CHWDAT2R : public RegisterBase<0x4001604C, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT2R_WDATA_Values<DFSDM::CHWDAT2R, 0, 16, ReadWriteMode, DFSDMCHWDAT2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT2R_WDATA_Values<DFSDM::CHWDAT2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -215,6 +229,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN2R_INDAT1_Values<DFSDM::CHDATIN2R, 16, 16, ReadWriteMode, DFSDMCHDATIN2RBase> ;
     using INDAT0 = DFSDM_CHDATIN2R_INDAT0_Values<DFSDM::CHDATIN2R, 0, 16, ReadWriteMode, DFSDMCHDATIN2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN2R_INDAT0_Values<DFSDM::CHDATIN2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +248,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG3R1_SCDEN_Values<DFSDM::CHCFG3R1, 5, 1, ReadWriteMode, DFSDMCHCFG3R1Base> ;
     using SPICKSEL = DFSDM_CHCFG3R1_SPICKSEL_Values<DFSDM::CHCFG3R1, 2, 2, ReadWriteMode, DFSDMCHCFG3R1Base> ;
     using SITP = DFSDM_CHCFG3R1_SITP_Values<DFSDM::CHCFG3R1, 0, 2, ReadWriteMode, DFSDMCHCFG3R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG3R1_SITP_Values<DFSDM::CHCFG3R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -245,6 +261,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG3R2_OFFSET_Values<DFSDM::CHCFG3R2, 8, 24, ReadWriteMode, DFSDMCHCFG3R2Base> ;
     using DTRBS = DFSDM_CHCFG3R2_DTRBS_Values<DFSDM::CHCFG3R2, 3, 5, ReadWriteMode, DFSDMCHCFG3R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG3R2_DTRBS_Values<DFSDM::CHCFG3R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,6 +276,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD3R_AWFOSR_Values<DFSDM::AWSCD3R, 16, 5, ReadWriteMode, DFSDMAWSCD3RBase> ;
     using BKSCD = DFSDM_AWSCD3R_BKSCD_Values<DFSDM::AWSCD3R, 12, 4, ReadWriteMode, DFSDMAWSCD3RBase> ;
     using SCDT = DFSDM_AWSCD3R_SCDT_Values<DFSDM::AWSCD3R, 0, 8, ReadWriteMode, DFSDMAWSCD3RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD3R_SCDT_Values<DFSDM::AWSCD3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -270,6 +288,7 @@ struct DFSDM
   struct CHWDAT3R : public RegisterBase<0x4001606C, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT3R_WDATA_Values<DFSDM::CHWDAT3R, 0, 16, ReadWriteMode, DFSDMCHWDAT3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT3R_WDATA_Values<DFSDM::CHWDAT3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -282,6 +301,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN3R_INDAT1_Values<DFSDM::CHDATIN3R, 16, 16, ReadWriteMode, DFSDMCHDATIN3RBase> ;
     using INDAT0 = DFSDM_CHDATIN3R_INDAT0_Values<DFSDM::CHDATIN3R, 0, 16, ReadWriteMode, DFSDMCHDATIN3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN3R_INDAT0_Values<DFSDM::CHDATIN3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -300,6 +320,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG4R1_SCDEN_Values<DFSDM::CHCFG4R1, 5, 1, ReadWriteMode, DFSDMCHCFG4R1Base> ;
     using SPICKSEL = DFSDM_CHCFG4R1_SPICKSEL_Values<DFSDM::CHCFG4R1, 2, 2, ReadWriteMode, DFSDMCHCFG4R1Base> ;
     using SITP = DFSDM_CHCFG4R1_SITP_Values<DFSDM::CHCFG4R1, 0, 2, ReadWriteMode, DFSDMCHCFG4R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG4R1_SITP_Values<DFSDM::CHCFG4R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -312,6 +333,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG4R2_OFFSET_Values<DFSDM::CHCFG4R2, 8, 24, ReadWriteMode, DFSDMCHCFG4R2Base> ;
     using DTRBS = DFSDM_CHCFG4R2_DTRBS_Values<DFSDM::CHCFG4R2, 3, 5, ReadWriteMode, DFSDMCHCFG4R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG4R2_DTRBS_Values<DFSDM::CHCFG4R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -326,6 +348,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD4R_AWFOSR_Values<DFSDM::AWSCD4R, 16, 5, ReadWriteMode, DFSDMAWSCD4RBase> ;
     using BKSCD = DFSDM_AWSCD4R_BKSCD_Values<DFSDM::AWSCD4R, 12, 4, ReadWriteMode, DFSDMAWSCD4RBase> ;
     using SCDT = DFSDM_AWSCD4R_SCDT_Values<DFSDM::AWSCD4R, 0, 8, ReadWriteMode, DFSDMAWSCD4RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD4R_SCDT_Values<DFSDM::AWSCD4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -337,6 +360,7 @@ struct DFSDM
   struct CHWDAT4R : public RegisterBase<0x4001608C, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT4R_WDATA_Values<DFSDM::CHWDAT4R, 0, 16, ReadWriteMode, DFSDMCHWDAT4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT4R_WDATA_Values<DFSDM::CHWDAT4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -349,6 +373,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN4R_INDAT1_Values<DFSDM::CHDATIN4R, 16, 16, ReadWriteMode, DFSDMCHDATIN4RBase> ;
     using INDAT0 = DFSDM_CHDATIN4R_INDAT0_Values<DFSDM::CHDATIN4R, 0, 16, ReadWriteMode, DFSDMCHDATIN4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN4R_INDAT0_Values<DFSDM::CHDATIN4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -367,6 +392,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG5R1_SCDEN_Values<DFSDM::CHCFG5R1, 5, 1, ReadWriteMode, DFSDMCHCFG5R1Base> ;
     using SPICKSEL = DFSDM_CHCFG5R1_SPICKSEL_Values<DFSDM::CHCFG5R1, 2, 2, ReadWriteMode, DFSDMCHCFG5R1Base> ;
     using SITP = DFSDM_CHCFG5R1_SITP_Values<DFSDM::CHCFG5R1, 0, 2, ReadWriteMode, DFSDMCHCFG5R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG5R1_SITP_Values<DFSDM::CHCFG5R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -379,6 +405,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG5R2_OFFSET_Values<DFSDM::CHCFG5R2, 8, 24, ReadWriteMode, DFSDMCHCFG5R2Base> ;
     using DTRBS = DFSDM_CHCFG5R2_DTRBS_Values<DFSDM::CHCFG5R2, 3, 5, ReadWriteMode, DFSDMCHCFG5R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG5R2_DTRBS_Values<DFSDM::CHCFG5R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -393,6 +420,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD5R_AWFOSR_Values<DFSDM::AWSCD5R, 16, 5, ReadWriteMode, DFSDMAWSCD5RBase> ;
     using BKSCD = DFSDM_AWSCD5R_BKSCD_Values<DFSDM::AWSCD5R, 12, 4, ReadWriteMode, DFSDMAWSCD5RBase> ;
     using SCDT = DFSDM_AWSCD5R_SCDT_Values<DFSDM::AWSCD5R, 0, 8, ReadWriteMode, DFSDMAWSCD5RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD5R_SCDT_Values<DFSDM::AWSCD5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -404,6 +432,7 @@ struct DFSDM
   struct CHWDAT5R : public RegisterBase<0x400160AC, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT5R_WDATA_Values<DFSDM::CHWDAT5R, 0, 16, ReadWriteMode, DFSDMCHWDAT5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT5R_WDATA_Values<DFSDM::CHWDAT5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -416,6 +445,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN5R_INDAT1_Values<DFSDM::CHDATIN5R, 16, 16, ReadWriteMode, DFSDMCHDATIN5RBase> ;
     using INDAT0 = DFSDM_CHDATIN5R_INDAT0_Values<DFSDM::CHDATIN5R, 0, 16, ReadWriteMode, DFSDMCHDATIN5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN5R_INDAT0_Values<DFSDM::CHDATIN5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -434,6 +464,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG6R1_SCDEN_Values<DFSDM::CHCFG6R1, 5, 1, ReadWriteMode, DFSDMCHCFG6R1Base> ;
     using SPICKSEL = DFSDM_CHCFG6R1_SPICKSEL_Values<DFSDM::CHCFG6R1, 2, 2, ReadWriteMode, DFSDMCHCFG6R1Base> ;
     using SITP = DFSDM_CHCFG6R1_SITP_Values<DFSDM::CHCFG6R1, 0, 2, ReadWriteMode, DFSDMCHCFG6R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG6R1_SITP_Values<DFSDM::CHCFG6R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -446,6 +477,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG6R2_OFFSET_Values<DFSDM::CHCFG6R2, 8, 24, ReadWriteMode, DFSDMCHCFG6R2Base> ;
     using DTRBS = DFSDM_CHCFG6R2_DTRBS_Values<DFSDM::CHCFG6R2, 3, 5, ReadWriteMode, DFSDMCHCFG6R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG6R2_DTRBS_Values<DFSDM::CHCFG6R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -460,6 +492,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD6R_AWFOSR_Values<DFSDM::AWSCD6R, 16, 5, ReadWriteMode, DFSDMAWSCD6RBase> ;
     using BKSCD = DFSDM_AWSCD6R_BKSCD_Values<DFSDM::AWSCD6R, 12, 4, ReadWriteMode, DFSDMAWSCD6RBase> ;
     using SCDT = DFSDM_AWSCD6R_SCDT_Values<DFSDM::AWSCD6R, 0, 8, ReadWriteMode, DFSDMAWSCD6RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD6R_SCDT_Values<DFSDM::AWSCD6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -471,6 +504,7 @@ struct DFSDM
   struct CHWDAT6R : public RegisterBase<0x400160CC, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT6R_WDATA_Values<DFSDM::CHWDAT6R, 0, 16, ReadWriteMode, DFSDMCHWDAT6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT6R_WDATA_Values<DFSDM::CHWDAT6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -483,6 +517,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN6R_INDAT1_Values<DFSDM::CHDATIN6R, 16, 16, ReadWriteMode, DFSDMCHDATIN6RBase> ;
     using INDAT0 = DFSDM_CHDATIN6R_INDAT0_Values<DFSDM::CHDATIN6R, 0, 16, ReadWriteMode, DFSDMCHDATIN6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN6R_INDAT0_Values<DFSDM::CHDATIN6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -501,6 +536,7 @@ struct DFSDM
     using SCDEN = DFSDM_CHCFG7R1_SCDEN_Values<DFSDM::CHCFG7R1, 5, 1, ReadWriteMode, DFSDMCHCFG7R1Base> ;
     using SPICKSEL = DFSDM_CHCFG7R1_SPICKSEL_Values<DFSDM::CHCFG7R1, 2, 2, ReadWriteMode, DFSDMCHCFG7R1Base> ;
     using SITP = DFSDM_CHCFG7R1_SITP_Values<DFSDM::CHCFG7R1, 0, 2, ReadWriteMode, DFSDMCHCFG7R1Base> ;
+    static constexpr Type SnapshotMask = 0xF1EFU ;
     using FieldValues = DFSDM_CHCFG7R1_SITP_Values<DFSDM::CHCFG7R1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -513,6 +549,7 @@ struct DFSDM
   {
     using OFFSET = DFSDM_CHCFG7R2_OFFSET_Values<DFSDM::CHCFG7R2, 8, 24, ReadWriteMode, DFSDMCHCFG7R2Base> ;
     using DTRBS = DFSDM_CHCFG7R2_DTRBS_Values<DFSDM::CHCFG7R2, 3, 5, ReadWriteMode, DFSDMCHCFG7R2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = DFSDM_CHCFG7R2_DTRBS_Values<DFSDM::CHCFG7R2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -527,6 +564,7 @@ struct DFSDM
     using AWFOSR = DFSDM_AWSCD7R_AWFOSR_Values<DFSDM::AWSCD7R, 16, 5, ReadWriteMode, DFSDMAWSCD7RBase> ;
     using BKSCD = DFSDM_AWSCD7R_BKSCD_Values<DFSDM::AWSCD7R, 12, 4, ReadWriteMode, DFSDMAWSCD7RBase> ;
     using SCDT = DFSDM_AWSCD7R_SCDT_Values<DFSDM::AWSCD7R, 0, 8, ReadWriteMode, DFSDMAWSCD7RBase> ;
+    static constexpr Type SnapshotMask = 0xDFF0FFU ;
     using FieldValues = DFSDM_AWSCD7R_SCDT_Values<DFSDM::AWSCD7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -538,6 +576,7 @@ struct DFSDM
   struct CHWDAT7R : public RegisterBase<0x400160EC, 32, ReadWriteMode>
   {
     using WDATA = DFSDM_CHWDAT7R_WDATA_Values<DFSDM::CHWDAT7R, 0, 16, ReadWriteMode, DFSDMCHWDAT7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_CHWDAT7R_WDATA_Values<DFSDM::CHWDAT7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -550,6 +589,7 @@ struct DFSDM
   {
     using INDAT1 = DFSDM_CHDATIN7R_INDAT1_Values<DFSDM::CHDATIN7R, 16, 16, ReadWriteMode, DFSDMCHDATIN7RBase> ;
     using INDAT0 = DFSDM_CHDATIN7R_INDAT0_Values<DFSDM::CHDATIN7R, 0, 16, ReadWriteMode, DFSDMCHDATIN7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DFSDM_CHDATIN7R_INDAT0_Values<DFSDM::CHDATIN7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -574,6 +614,7 @@ struct DFSDM
     using JSYNC = DFSDM_DFSDM0_CR1_JSYNC_Values<DFSDM::DFSDM0_CR1, 3, 1, ReadWriteMode, DFSDMDFSDM0_CR1Base> ;
     using JSWSTART = DFSDM_DFSDM0_CR1_JSWSTART_Values<DFSDM::DFSDM0_CR1, 1, 1, ReadWriteMode, DFSDMDFSDM0_CR1Base> ;
     using DFEN = DFSDM_DFSDM0_CR1_DFEN_Values<DFSDM::DFSDM0_CR1, 0, 1, ReadWriteMode, DFSDMDFSDM0_CR1Base> ;
+    static constexpr Type SnapshotMask = 0x672E673BU ;
     using FieldValues = DFSDM_DFSDM0_CR1_DFEN_Values<DFSDM::DFSDM0_CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -593,6 +634,7 @@ struct DFSDM
     using JOVRIE = DFSDM_DFSDM0_CR2_JOVRIE_Values<DFSDM::DFSDM0_CR2, 2, 1, ReadWriteMode, DFSDMDFSDM0_CR2Base> ;
     using REOCIE = DFSDM_DFSDM0_CR2_REOCIE_Values<DFSDM::DFSDM0_CR2, 1, 1, ReadWriteMode, DFSDMDFSDM0_CR2Base> ;
     using JEOCIE = DFSDM_DFSDM0_CR2_JEOCIE_Values<DFSDM::DFSDM0_CR2, 0, 1, ReadWriteMode, DFSDMDFSDM0_CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF7FU ;
     using FieldValues = DFSDM_DFSDM0_CR2_JEOCIE_Values<DFSDM::DFSDM0_CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -626,6 +668,7 @@ struct DFSDM
     using CLRCKABF = DFSDM_DFSDM0_ICR_CLRCKABF_Values<DFSDM::DFSDM0_ICR, 16, 8, ReadWriteMode, DFSDMDFSDM0_ICRBase> ;
     using CLRROVRF = DFSDM_DFSDM0_ICR_CLRROVRF_Values<DFSDM::DFSDM0_ICR, 3, 1, ReadWriteMode, DFSDMDFSDM0_ICRBase> ;
     using CLRJOVRF = DFSDM_DFSDM0_ICR_CLRJOVRF_Values<DFSDM::DFSDM0_ICR, 2, 1, ReadWriteMode, DFSDMDFSDM0_ICRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF000CU ;
     using FieldValues = DFSDM_DFSDM0_ICR_CLRJOVRF_Values<DFSDM::DFSDM0_ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -637,6 +680,7 @@ struct DFSDM
   struct DFSDM0_JCHGR : public RegisterBase<0x40016110, 32, ReadWriteMode>
   {
     using JCHG = DFSDM_DFSDM0_JCHGR_JCHG_Values<DFSDM::DFSDM0_JCHGR, 0, 8, ReadWriteMode, DFSDMDFSDM0_JCHGRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DFSDM_DFSDM0_JCHGR_JCHG_Values<DFSDM::DFSDM0_JCHGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -650,6 +694,7 @@ struct DFSDM
     using FORD = DFSDM_DFSDM0_FCR_FORD_Values<DFSDM::DFSDM0_FCR, 29, 3, ReadWriteMode, DFSDMDFSDM0_FCRBase> ;
     using FOSR = DFSDM_DFSDM0_FCR_FOSR_Values<DFSDM::DFSDM0_FCR, 16, 10, ReadWriteMode, DFSDMDFSDM0_FCRBase> ;
     using IOSR = DFSDM_DFSDM0_FCR_IOSR_Values<DFSDM::DFSDM0_FCR, 0, 8, ReadWriteMode, DFSDMDFSDM0_FCRBase> ;
+    static constexpr Type SnapshotMask = 0xE3FF00FFU ;
     using FieldValues = DFSDM_DFSDM0_FCR_IOSR_Values<DFSDM::DFSDM0_FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -687,6 +732,7 @@ struct DFSDM
   {
     using AWHT = DFSDM_DFSDM0_AWHTR_AWHT_Values<DFSDM::DFSDM0_AWHTR, 8, 24, ReadWriteMode, DFSDMDFSDM0_AWHTRBase> ;
     using BKAWH = DFSDM_DFSDM0_AWHTR_BKAWH_Values<DFSDM::DFSDM0_AWHTR, 0, 4, ReadWriteMode, DFSDMDFSDM0_AWHTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM0_AWHTR_BKAWH_Values<DFSDM::DFSDM0_AWHTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -699,6 +745,7 @@ struct DFSDM
   {
     using AWLT = DFSDM_DFSDM0_AWLTR_AWLT_Values<DFSDM::DFSDM0_AWLTR, 8, 24, ReadWriteMode, DFSDMDFSDM0_AWLTRBase> ;
     using BKAWL = DFSDM_DFSDM0_AWLTR_BKAWL_Values<DFSDM::DFSDM0_AWLTR, 0, 4, ReadWriteMode, DFSDMDFSDM0_AWLTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM0_AWLTR_BKAWL_Values<DFSDM::DFSDM0_AWLTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -723,6 +770,7 @@ struct DFSDM
   {
     using CLRAWHTF = DFSDM_DFSDM0_AWCFR_CLRAWHTF_Values<DFSDM::DFSDM0_AWCFR, 8, 8, ReadWriteMode, DFSDMDFSDM0_AWCFRBase> ;
     using CLRAWLTF = DFSDM_DFSDM0_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM0_AWCFR, 0, 8, ReadWriteMode, DFSDMDFSDM0_AWCFRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_DFSDM0_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM0_AWCFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -782,6 +830,7 @@ struct DFSDM
     using JSYNC = DFSDM_DFSDM1_CR1_JSYNC_Values<DFSDM::DFSDM1_CR1, 3, 1, ReadWriteMode, DFSDMDFSDM1_CR1Base> ;
     using JSWSTART = DFSDM_DFSDM1_CR1_JSWSTART_Values<DFSDM::DFSDM1_CR1, 1, 1, ReadWriteMode, DFSDMDFSDM1_CR1Base> ;
     using DFEN = DFSDM_DFSDM1_CR1_DFEN_Values<DFSDM::DFSDM1_CR1, 0, 1, ReadWriteMode, DFSDMDFSDM1_CR1Base> ;
+    static constexpr Type SnapshotMask = 0x672E673BU ;
     using FieldValues = DFSDM_DFSDM1_CR1_DFEN_Values<DFSDM::DFSDM1_CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -801,6 +850,7 @@ struct DFSDM
     using JOVRIE = DFSDM_DFSDM1_CR2_JOVRIE_Values<DFSDM::DFSDM1_CR2, 2, 1, ReadWriteMode, DFSDMDFSDM1_CR2Base> ;
     using REOCIE = DFSDM_DFSDM1_CR2_REOCIE_Values<DFSDM::DFSDM1_CR2, 1, 1, ReadWriteMode, DFSDMDFSDM1_CR2Base> ;
     using JEOCIE = DFSDM_DFSDM1_CR2_JEOCIE_Values<DFSDM::DFSDM1_CR2, 0, 1, ReadWriteMode, DFSDMDFSDM1_CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF7FU ;
     using FieldValues = DFSDM_DFSDM1_CR2_JEOCIE_Values<DFSDM::DFSDM1_CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -834,6 +884,7 @@ struct DFSDM
     using CLRCKABF = DFSDM_DFSDM1_ICR_CLRCKABF_Values<DFSDM::DFSDM1_ICR, 16, 8, ReadWriteMode, DFSDMDFSDM1_ICRBase> ;
     using CLRROVRF = DFSDM_DFSDM1_ICR_CLRROVRF_Values<DFSDM::DFSDM1_ICR, 3, 1, ReadWriteMode, DFSDMDFSDM1_ICRBase> ;
     using CLRJOVRF = DFSDM_DFSDM1_ICR_CLRJOVRF_Values<DFSDM::DFSDM1_ICR, 2, 1, ReadWriteMode, DFSDMDFSDM1_ICRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF000CU ;
     using FieldValues = DFSDM_DFSDM1_ICR_CLRJOVRF_Values<DFSDM::DFSDM1_ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -845,6 +896,7 @@ struct DFSDM
   struct DFSDM1_JCHGR : public RegisterBase<0x40016210, 32, ReadWriteMode>
   {
     using JCHG = DFSDM_DFSDM1_JCHGR_JCHG_Values<DFSDM::DFSDM1_JCHGR, 0, 8, ReadWriteMode, DFSDMDFSDM1_JCHGRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DFSDM_DFSDM1_JCHGR_JCHG_Values<DFSDM::DFSDM1_JCHGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -858,6 +910,7 @@ struct DFSDM
     using FORD = DFSDM_DFSDM1_FCR_FORD_Values<DFSDM::DFSDM1_FCR, 29, 3, ReadWriteMode, DFSDMDFSDM1_FCRBase> ;
     using FOSR = DFSDM_DFSDM1_FCR_FOSR_Values<DFSDM::DFSDM1_FCR, 16, 10, ReadWriteMode, DFSDMDFSDM1_FCRBase> ;
     using IOSR = DFSDM_DFSDM1_FCR_IOSR_Values<DFSDM::DFSDM1_FCR, 0, 8, ReadWriteMode, DFSDMDFSDM1_FCRBase> ;
+    static constexpr Type SnapshotMask = 0xE3FF00FFU ;
     using FieldValues = DFSDM_DFSDM1_FCR_IOSR_Values<DFSDM::DFSDM1_FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -895,6 +948,7 @@ struct DFSDM
   {
     using AWHT = DFSDM_DFSDM1_AWHTR_AWHT_Values<DFSDM::DFSDM1_AWHTR, 8, 24, ReadWriteMode, DFSDMDFSDM1_AWHTRBase> ;
     using BKAWH = DFSDM_DFSDM1_AWHTR_BKAWH_Values<DFSDM::DFSDM1_AWHTR, 0, 4, ReadWriteMode, DFSDMDFSDM1_AWHTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM1_AWHTR_BKAWH_Values<DFSDM::DFSDM1_AWHTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -907,6 +961,7 @@ struct DFSDM
   {
     using AWLT = DFSDM_DFSDM1_AWLTR_AWLT_Values<DFSDM::DFSDM1_AWLTR, 8, 24, ReadWriteMode, DFSDMDFSDM1_AWLTRBase> ;
     using BKAWL = DFSDM_DFSDM1_AWLTR_BKAWL_Values<DFSDM::DFSDM1_AWLTR, 0, 4, ReadWriteMode, DFSDMDFSDM1_AWLTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM1_AWLTR_BKAWL_Values<DFSDM::DFSDM1_AWLTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -931,6 +986,7 @@ struct DFSDM
   {
     using CLRAWHTF = DFSDM_DFSDM1_AWCFR_CLRAWHTF_Values<DFSDM::DFSDM1_AWCFR, 8, 8, ReadWriteMode, DFSDMDFSDM1_AWCFRBase> ;
     using CLRAWLTF = DFSDM_DFSDM1_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM1_AWCFR, 0, 8, ReadWriteMode, DFSDMDFSDM1_AWCFRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_DFSDM1_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM1_AWCFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -990,6 +1046,7 @@ struct DFSDM
     using JSYNC = DFSDM_DFSDM2_CR1_JSYNC_Values<DFSDM::DFSDM2_CR1, 3, 1, ReadWriteMode, DFSDMDFSDM2_CR1Base> ;
     using JSWSTART = DFSDM_DFSDM2_CR1_JSWSTART_Values<DFSDM::DFSDM2_CR1, 1, 1, ReadWriteMode, DFSDMDFSDM2_CR1Base> ;
     using DFEN = DFSDM_DFSDM2_CR1_DFEN_Values<DFSDM::DFSDM2_CR1, 0, 1, ReadWriteMode, DFSDMDFSDM2_CR1Base> ;
+    static constexpr Type SnapshotMask = 0x672E673BU ;
     using FieldValues = DFSDM_DFSDM2_CR1_DFEN_Values<DFSDM::DFSDM2_CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1009,6 +1066,7 @@ struct DFSDM
     using JOVRIE = DFSDM_DFSDM2_CR2_JOVRIE_Values<DFSDM::DFSDM2_CR2, 2, 1, ReadWriteMode, DFSDMDFSDM2_CR2Base> ;
     using REOCIE = DFSDM_DFSDM2_CR2_REOCIE_Values<DFSDM::DFSDM2_CR2, 1, 1, ReadWriteMode, DFSDMDFSDM2_CR2Base> ;
     using JEOCIE = DFSDM_DFSDM2_CR2_JEOCIE_Values<DFSDM::DFSDM2_CR2, 0, 1, ReadWriteMode, DFSDMDFSDM2_CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF7FU ;
     using FieldValues = DFSDM_DFSDM2_CR2_JEOCIE_Values<DFSDM::DFSDM2_CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1042,6 +1100,7 @@ struct DFSDM
     using CLRCKABF = DFSDM_DFSDM2_ICR_CLRCKABF_Values<DFSDM::DFSDM2_ICR, 16, 8, ReadWriteMode, DFSDMDFSDM2_ICRBase> ;
     using CLRROVRF = DFSDM_DFSDM2_ICR_CLRROVRF_Values<DFSDM::DFSDM2_ICR, 3, 1, ReadWriteMode, DFSDMDFSDM2_ICRBase> ;
     using CLRJOVRF = DFSDM_DFSDM2_ICR_CLRJOVRF_Values<DFSDM::DFSDM2_ICR, 2, 1, ReadWriteMode, DFSDMDFSDM2_ICRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF000CU ;
     using FieldValues = DFSDM_DFSDM2_ICR_CLRJOVRF_Values<DFSDM::DFSDM2_ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1053,6 +1112,7 @@ struct DFSDM
   struct DFSDM2_JCHGR : public RegisterBase<0x40016310, 32, ReadWriteMode>
   {
     using JCHG = DFSDM_DFSDM2_JCHGR_JCHG_Values<DFSDM::DFSDM2_JCHGR, 0, 8, ReadWriteMode, DFSDMDFSDM2_JCHGRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DFSDM_DFSDM2_JCHGR_JCHG_Values<DFSDM::DFSDM2_JCHGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1066,6 +1126,7 @@ struct DFSDM
     using FORD = DFSDM_DFSDM2_FCR_FORD_Values<DFSDM::DFSDM2_FCR, 29, 3, ReadWriteMode, DFSDMDFSDM2_FCRBase> ;
     using FOSR = DFSDM_DFSDM2_FCR_FOSR_Values<DFSDM::DFSDM2_FCR, 16, 10, ReadWriteMode, DFSDMDFSDM2_FCRBase> ;
     using IOSR = DFSDM_DFSDM2_FCR_IOSR_Values<DFSDM::DFSDM2_FCR, 0, 8, ReadWriteMode, DFSDMDFSDM2_FCRBase> ;
+    static constexpr Type SnapshotMask = 0xE3FF00FFU ;
     using FieldValues = DFSDM_DFSDM2_FCR_IOSR_Values<DFSDM::DFSDM2_FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1103,6 +1164,7 @@ struct DFSDM
   {
     using AWHT = DFSDM_DFSDM2_AWHTR_AWHT_Values<DFSDM::DFSDM2_AWHTR, 8, 24, ReadWriteMode, DFSDMDFSDM2_AWHTRBase> ;
     using BKAWH = DFSDM_DFSDM2_AWHTR_BKAWH_Values<DFSDM::DFSDM2_AWHTR, 0, 4, ReadWriteMode, DFSDMDFSDM2_AWHTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM2_AWHTR_BKAWH_Values<DFSDM::DFSDM2_AWHTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1115,6 +1177,7 @@ struct DFSDM
   {
     using AWLT = DFSDM_DFSDM2_AWLTR_AWLT_Values<DFSDM::DFSDM2_AWLTR, 8, 24, ReadWriteMode, DFSDMDFSDM2_AWLTRBase> ;
     using BKAWL = DFSDM_DFSDM2_AWLTR_BKAWL_Values<DFSDM::DFSDM2_AWLTR, 0, 4, ReadWriteMode, DFSDMDFSDM2_AWLTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM2_AWLTR_BKAWL_Values<DFSDM::DFSDM2_AWLTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1139,6 +1202,7 @@ struct DFSDM
   {
     using CLRAWHTF = DFSDM_DFSDM2_AWCFR_CLRAWHTF_Values<DFSDM::DFSDM2_AWCFR, 8, 8, ReadWriteMode, DFSDMDFSDM2_AWCFRBase> ;
     using CLRAWLTF = DFSDM_DFSDM2_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM2_AWCFR, 0, 8, ReadWriteMode, DFSDMDFSDM2_AWCFRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_DFSDM2_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM2_AWCFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1198,6 +1262,7 @@ struct DFSDM
     using JSYNC = DFSDM_DFSDM3_CR1_JSYNC_Values<DFSDM::DFSDM3_CR1, 3, 1, ReadWriteMode, DFSDMDFSDM3_CR1Base> ;
     using JSWSTART = DFSDM_DFSDM3_CR1_JSWSTART_Values<DFSDM::DFSDM3_CR1, 1, 1, ReadWriteMode, DFSDMDFSDM3_CR1Base> ;
     using DFEN = DFSDM_DFSDM3_CR1_DFEN_Values<DFSDM::DFSDM3_CR1, 0, 1, ReadWriteMode, DFSDMDFSDM3_CR1Base> ;
+    static constexpr Type SnapshotMask = 0x672E673BU ;
     using FieldValues = DFSDM_DFSDM3_CR1_DFEN_Values<DFSDM::DFSDM3_CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1217,6 +1282,7 @@ struct DFSDM
     using JOVRIE = DFSDM_DFSDM3_CR2_JOVRIE_Values<DFSDM::DFSDM3_CR2, 2, 1, ReadWriteMode, DFSDMDFSDM3_CR2Base> ;
     using REOCIE = DFSDM_DFSDM3_CR2_REOCIE_Values<DFSDM::DFSDM3_CR2, 1, 1, ReadWriteMode, DFSDMDFSDM3_CR2Base> ;
     using JEOCIE = DFSDM_DFSDM3_CR2_JEOCIE_Values<DFSDM::DFSDM3_CR2, 0, 1, ReadWriteMode, DFSDMDFSDM3_CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF7FU ;
     using FieldValues = DFSDM_DFSDM3_CR2_JEOCIE_Values<DFSDM::DFSDM3_CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1250,6 +1316,7 @@ struct DFSDM
     using CLRCKABF = DFSDM_DFSDM3_ICR_CLRCKABF_Values<DFSDM::DFSDM3_ICR, 16, 8, ReadWriteMode, DFSDMDFSDM3_ICRBase> ;
     using CLRROVRF = DFSDM_DFSDM3_ICR_CLRROVRF_Values<DFSDM::DFSDM3_ICR, 3, 1, ReadWriteMode, DFSDMDFSDM3_ICRBase> ;
     using CLRJOVRF = DFSDM_DFSDM3_ICR_CLRJOVRF_Values<DFSDM::DFSDM3_ICR, 2, 1, ReadWriteMode, DFSDMDFSDM3_ICRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF000CU ;
     using FieldValues = DFSDM_DFSDM3_ICR_CLRJOVRF_Values<DFSDM::DFSDM3_ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1261,6 +1328,7 @@ struct DFSDM
   struct DFSDM3_JCHGR : public RegisterBase<0x40016410, 32, ReadWriteMode>
   {
     using JCHG = DFSDM_DFSDM3_JCHGR_JCHG_Values<DFSDM::DFSDM3_JCHGR, 0, 8, ReadWriteMode, DFSDMDFSDM3_JCHGRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = DFSDM_DFSDM3_JCHGR_JCHG_Values<DFSDM::DFSDM3_JCHGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1274,6 +1342,7 @@ struct DFSDM
     using FORD = DFSDM_DFSDM3_FCR_FORD_Values<DFSDM::DFSDM3_FCR, 29, 3, ReadWriteMode, DFSDMDFSDM3_FCRBase> ;
     using FOSR = DFSDM_DFSDM3_FCR_FOSR_Values<DFSDM::DFSDM3_FCR, 16, 10, ReadWriteMode, DFSDMDFSDM3_FCRBase> ;
     using IOSR = DFSDM_DFSDM3_FCR_IOSR_Values<DFSDM::DFSDM3_FCR, 0, 8, ReadWriteMode, DFSDMDFSDM3_FCRBase> ;
+    static constexpr Type SnapshotMask = 0xE3FF00FFU ;
     using FieldValues = DFSDM_DFSDM3_FCR_IOSR_Values<DFSDM::DFSDM3_FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1311,6 +1380,7 @@ struct DFSDM
   {
     using AWHT = DFSDM_DFSDM3_AWHTR_AWHT_Values<DFSDM::DFSDM3_AWHTR, 8, 24, ReadWriteMode, DFSDMDFSDM3_AWHTRBase> ;
     using BKAWH = DFSDM_DFSDM3_AWHTR_BKAWH_Values<DFSDM::DFSDM3_AWHTR, 0, 4, ReadWriteMode, DFSDMDFSDM3_AWHTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM3_AWHTR_BKAWH_Values<DFSDM::DFSDM3_AWHTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1323,6 +1393,7 @@ struct DFSDM
   {
     using AWLT = DFSDM_DFSDM3_AWLTR_AWLT_Values<DFSDM::DFSDM3_AWLTR, 8, 24, ReadWriteMode, DFSDMDFSDM3_AWLTRBase> ;
     using BKAWL = DFSDM_DFSDM3_AWLTR_BKAWL_Values<DFSDM::DFSDM3_AWLTR, 0, 4, ReadWriteMode, DFSDMDFSDM3_AWLTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF0FU ;
     using FieldValues = DFSDM_DFSDM3_AWLTR_BKAWL_Values<DFSDM::DFSDM3_AWLTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1347,6 +1418,7 @@ struct DFSDM
   {
     using CLRAWHTF = DFSDM_DFSDM3_AWCFR_CLRAWHTF_Values<DFSDM::DFSDM3_AWCFR, 8, 8, ReadWriteMode, DFSDMDFSDM3_AWCFRBase> ;
     using CLRAWLTF = DFSDM_DFSDM3_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM3_AWCFR, 0, 8, ReadWriteMode, DFSDMDFSDM3_AWCFRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DFSDM_DFSDM3_AWCFR_CLRAWLTF_Values<DFSDM::DFSDM3_AWCFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -1388,6 +1460,7 @@ struct DFSDM
   template<typename... T> 
   using DFSDM3_CNVTIMRPack  = Register<0x40016438, 32, ReadMode, DFSDMDFSDM3_CNVTIMRBase, T...> ;
 
+  using Registers = TypesList<DFSDM::CHCFG0R1, DFSDM::CHCFG0R2, DFSDM::AWSCD0R, DFSDM::CHWDAT0R, DFSDM::CHDATIN0R, DFSDM::CHCFG1R1, DFSDM::CHCFG1R2, DFSDM::AWSCD1R, DFSDM::CHWDAT1R, DFSDM::CHDATIN1R, DFSDM::CHCFG2R1, DFSDM::CHCFG2R2, DFSDM::AWSCD2R, DFSDM::CHWDAT2R, DFSDM::CHDATIN2R, DFSDM::CHCFG3R1, DFSDM::CHCFG3R2, DFSDM::AWSCD3R, DFSDM::CHWDAT3R, DFSDM::CHDATIN3R, DFSDM::CHCFG4R1, DFSDM::CHCFG4R2, DFSDM::AWSCD4R, DFSDM::CHWDAT4R, DFSDM::CHDATIN4R, DFSDM::CHCFG5R1, DFSDM::CHCFG5R2, DFSDM::AWSCD5R, DFSDM::CHWDAT5R, DFSDM::CHDATIN5R, DFSDM::CHCFG6R1, DFSDM::CHCFG6R2, DFSDM::AWSCD6R, DFSDM::CHWDAT6R, DFSDM::CHDATIN6R, DFSDM::CHCFG7R1, DFSDM::CHCFG7R2, DFSDM::AWSCD7R, DFSDM::CHWDAT7R, DFSDM::CHDATIN7R, DFSDM::DFSDM0_CR1, DFSDM::DFSDM0_CR2, DFSDM::DFSDM0_ISR, DFSDM::DFSDM0_ICR, DFSDM::DFSDM0_JCHGR, DFSDM::DFSDM0_FCR, DFSDM::DFSDM0_JDATAR, DFSDM::DFSDM0_RDATAR, DFSDM::DFSDM0_AWHTR, DFSDM::DFSDM0_AWLTR, DFSDM::DFSDM0_AWSR, DFSDM::DFSDM0_AWCFR, DFSDM::DFSDM0_EXMAX, DFSDM::DFSDM0_EXMIN, DFSDM::DFSDM0_CNVTIMR, DFSDM::DFSDM1_CR1, DFSDM::DFSDM1_CR2, DFSDM::DFSDM1_ISR, DFSDM::DFSDM1_ICR, DFSDM::DFSDM1_JCHGR, DFSDM::DFSDM1_FCR, DFSDM::DFSDM1_JDATAR, DFSDM::DFSDM1_RDATAR, DFSDM::DFSDM1_AWHTR, DFSDM::DFSDM1_AWLTR, DFSDM::DFSDM1_AWSR, DFSDM::DFSDM1_AWCFR, DFSDM::DFSDM1_EXMAX, DFSDM::DFSDM1_EXMIN, DFSDM::DFSDM1_CNVTIMR, DFSDM::DFSDM2_CR1, DFSDM::DFSDM2_CR2, DFSDM::DFSDM2_ISR, DFSDM::DFSDM2_ICR, DFSDM::DFSDM2_JCHGR, DFSDM::DFSDM2_FCR, DFSDM::DFSDM2_JDATAR, DFSDM::DFSDM2_RDATAR, DFSDM::DFSDM2_AWHTR, DFSDM::DFSDM2_AWLTR, DFSDM::DFSDM2_AWSR, DFSDM::DFSDM2_AWCFR, DFSDM::DFSDM2_EXMAX, DFSDM::DFSDM2_EXMIN, DFSDM::DFSDM2_CNVTIMR, DFSDM::DFSDM3_CR1, DFSDM::DFSDM3_CR2, DFSDM::DFSDM3_ISR, DFSDM::DFSDM3_ICR, DFSDM::DFSDM3_JCHGR, DFSDM::DFSDM3_FCR, DFSDM::DFSDM3_JDATAR, DFSDM::DFSDM3_RDATAR, DFSDM::DFSDM3_AWHTR, DFSDM::DFSDM3_AWLTR, DFSDM::DFSDM3_AWSR, DFSDM::DFSDM3_AWCFR, DFSDM::DFSDM3_EXMAX, DFSDM::DFSDM3_EXMIN, DFSDM::DFSDM3_CNVTIMR> ;
 } ;
 
 #endif //#if !defined(DFSDMREGISTERS_HPP)
@@ -87,6 +87,8 @@ struct DMA1
     using CHTIF1 = DMA1_IFCR_CHTIF1_Values<DMA1::IFCR, 2, 1, WriteMode, DMA1IFCRBase> ;
     using CTCIF1 = DMA1_IFCR_CTCIF1_Values<DMA1::IFCR, 1, 1, WriteMode, DMA1IFCRBase> ;
     using CGIF1 = DMA1_IFCR_CGIF1_Values<DMA1::IFCR, 0, 1, WriteMode, DMA1IFCRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type OneToClearMask = 0xFFFFFFFU ;
     using FieldValues = DMA1_IFCR_CGIF1_Values<DMA1::IFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +111,8 @@ struct DMA1
     using HTIE = DMA1_CCR1_HTIE_Values<DMA1::CCR1, 2, 1, ReadWriteMode, DMA1CCR1Base> ;
     using TCIE = DMA1_CCR1_TCIE_Values<DMA1::CCR1, 1, 1, ReadWriteMode, DMA1CCR1Base> ;
     using EN = DMA1_CCR1_EN_Values<DMA1::CCR1, 0, 1, ReadWriteMode, DMA1CCR1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR1_EN_Values<DMA1::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +124,7 @@ struct DMA1
   struct CNDTR1 : public RegisterBase<0x4002000C, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR1_NDT_Values<DMA1::CNDTR1, 0, 16, ReadWriteMode, DMA1CNDTR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR1_NDT_Values<DMA1::CNDTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct DMA1
   struct CPAR1 : public RegisterBase<0x40020010, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR1_PA_Values<DMA1::CPAR1, 0, 32, ReadWriteMode, DMA1CPAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR1_PA_Values<DMA1::CPAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +148,7 @@ struct DMA1
   struct CMAR1 : public RegisterBase<0x40020014, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR1_MA_Values<DMA1::CMAR1, 0, 32, ReadWriteMode, DMA1CMAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR1_MA_Values<DMA1::CMAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +171,8 @@ struct DMA1
     using HTIE = DMA1_CCR2_HTIE_Values<DMA1::CCR2, 2, 1, ReadWriteMode, DMA1CCR2Base> ;
     using TCIE = DMA1_CCR2_TCIE_Values<DMA1::CCR2, 1, 1, ReadWriteMode, DMA1CCR2Base> ;
     using EN = DMA1_CCR2_EN_Values<DMA1::CCR2, 0, 1, ReadWriteMode, DMA1CCR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR2_EN_Values<DMA1::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -175,6 +184,7 @@ struct DMA1
   struct CNDTR2 : public RegisterBase<0x40020020, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR2_NDT_Values<DMA1::CNDTR2, 0, 16, ReadWriteMode, DMA1CNDTR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR2_NDT_Values<DMA1::CNDTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -186,6 +196,7 @@ struct DMA1
   struct CPAR2 : public RegisterBase<0x40020024, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR2_PA_Values<DMA1::CPAR2, 0, 32, ReadWriteMode, DMA1CPAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR2_PA_Values<DMA1::CPAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,6 +208,7 @@ struct DMA1
   struct CMAR2 : public RegisterBase<0x40020028, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR2_MA_Values<DMA1::CMAR2, 0, 32, ReadWriteMode, DMA1CMAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR2_MA_Values<DMA1::CMAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +231,8 @@ struct DMA1
     using HTIE = DMA1_CCR3_HTIE_Values<DMA1::CCR3, 2, 1, ReadWriteMode, DMA1CCR3Base> ;
     using TCIE = DMA1_CCR3_TCIE_Values<DMA1::CCR3, 1, 1, ReadWriteMode, DMA1CCR3Base> ;
     using EN = DMA1_CCR3_EN_Values<DMA1::CCR3, 0, 1, ReadWriteMode, DMA1CCR3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR3_EN_Values<DMA1::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +244,7 @@ struct DMA1
   struct CNDTR3 : public RegisterBase<0x40020034, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR3_NDT_Values<DMA1::CNDTR3, 0, 16, ReadWriteMode, DMA1CNDTR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR3_NDT_Values<DMA1::CNDTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +256,7 @@ struct DMA1
   struct CPAR3 : public RegisterBase<0x40020038, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR3_PA_Values<DMA1::CPAR3, 0, 32, ReadWriteMode, DMA1CPAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR3_PA_Values<DMA1::CPAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +268,7 @@ struct DMA1
   struct CMAR3 : public RegisterBase<0x4002003C, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR3_MA_Values<DMA1::CMAR3, 0, 32, ReadWriteMode, DMA1CMAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR3_MA_Values<DMA1::CMAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +291,8 @@ struct DMA1
     using HTIE = DMA1_CCR4_HTIE_Values<DMA1::CCR4, 2, 1, ReadWriteMode, DMA1CCR4Base> ;
     using TCIE = DMA1_CCR4_TCIE_Values<DMA1::CCR4, 1, 1, ReadWriteMode, DMA1CCR4Base> ;
     using EN = DMA1_CCR4_EN_Values<DMA1::CCR4, 0, 1, ReadWriteMode, DMA1CCR4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR4_EN_Values<DMA1::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -285,6 +304,7 @@ struct DMA1
   struct CNDTR4 : public RegisterBase<0x40020048, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR4_NDT_Values<DMA1::CNDTR4, 0, 16, ReadWriteMode, DMA1CNDTR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR4_NDT_Values<DMA1::CNDTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct DMA1
   struct CPAR4 : public RegisterBase<0x4002004C, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR4_PA_Values<DMA1::CPAR4, 0, 32, ReadWriteMode, DMA1CPAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR4_PA_Values<DMA1::CPAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,6 +328,7 @@ struct DMA1
   struct CMAR4 : public RegisterBase<0x40020050, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR4_MA_Values<DMA1::CMAR4, 0, 32, ReadWriteMode, DMA1CMAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR4_MA_Values<DMA1::CMAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +351,8 @@ struct DMA1
     using HTIE = DMA1_CCR5_HTIE_Values<DMA1::CCR5, 2, 1, ReadWriteMode, DMA1CCR5Base> ;
     using TCIE = DMA1_CCR5_TCIE_Values<DMA1::CCR5, 1, 1, ReadWriteMode, DMA1CCR5Base> ;
     using EN = DMA1_CCR5_EN_Values<DMA1::CCR5, 0, 1, ReadWriteMode, DMA1CCR5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR5_EN_Values<DMA1::CCR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +364,7 @@ struct DMA1
   struct CNDTR5 : public RegisterBase<0x4002005C, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR5_NDT_Values<DMA1::CNDTR5, 0, 16, ReadWriteMode, DMA1CNDTR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR5_NDT_Values<DMA1::CNDTR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -351,6 +376,7 @@ struct DMA1
   struct CPAR5 : public RegisterBase<0x40020060, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR5_PA_Values<DMA1::CPAR5, 0, 32, ReadWriteMode, DMA1CPAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR5_PA_Values<DMA1::CPAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -362,6 +388,7 @@ struct DMA1
   struct CMAR5 : public RegisterBase<0x40020064, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR5_MA_Values<DMA1::CMAR5, 0, 32, ReadWriteMode, DMA1CMAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR5_MA_Values<DMA1::CMAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -384,6 +411,8 @@ struct DMA1
     using HTIE = DMA1_CCR6_HTIE_Values<DMA1::CCR6, 2, 1, ReadWriteMode, DMA1CCR6Base> ;
     using TCIE = DMA1_CCR6_TCIE_Values<DMA1::CCR6, 1, 1, ReadWriteMode, DMA1CCR6Base> ;
     using EN = DMA1_CCR6_EN_Values<DMA1::CCR6, 0, 1, ReadWriteMode, DMA1CCR6Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR6_EN_Values<DMA1::CCR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -395,6 +424,7 @@ struct DMA1
   struct CNDTR6 : public RegisterBase<0x40020070, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR6_NDT_Values<DMA1::CNDTR6, 0, 16, ReadWriteMode, DMA1CNDTR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR6_NDT_Values<DMA1::CNDTR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -406,6 +436,7 @@ struct DMA1
   struct CPAR6 : public RegisterBase<0x40020074, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR6_PA_Values<DMA1::CPAR6, 0, 32, ReadWriteMode, DMA1CPAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR6_PA_Values<DMA1::CPAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -417,6 +448,7 @@ struct DMA1
   struct CMAR6 : public RegisterBase<0x40020078, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR6_MA_Values<DMA1::CMAR6, 0, 32, ReadWriteMode, DMA1CMAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR6_MA_Values<DMA1::CMAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,6 +471,8 @@ struct DMA1
     using HTIE = DMA1_CCR7_HTIE_Values<DMA1::CCR7, 2, 1, ReadWriteMode, DMA1CCR7Base> ;
     using TCIE = DMA1_CCR7_TCIE_Values<DMA1::CCR7, 1, 1, ReadWriteMode, DMA1CCR7Base> ;
     using EN = DMA1_CCR7_EN_Values<DMA1::CCR7, 0, 1, ReadWriteMode, DMA1CCR7Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA1_CCR7_EN_Values<DMA1::CCR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -450,6 +484,7 @@ struct DMA1
   struct CNDTR7 : public RegisterBase<0x40020084, 32, ReadWriteMode>
   {
     using NDT = DMA1_CNDTR7_NDT_Values<DMA1::CNDTR7, 0, 16, ReadWriteMode, DMA1CNDTR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA1_CNDTR7_NDT_Values<DMA1::CNDTR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -461,6 +496,7 @@ struct DMA1
   struct CPAR7 : public RegisterBase<0x40020088, 32, ReadWriteMode>
   {
     using PA = DMA1_CPAR7_PA_Values<DMA1::CPAR7, 0, 32, ReadWriteMode, DMA1CPAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CPAR7_PA_Values<DMA1::CPAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -472,6 +508,7 @@ struct DMA1
   struct CMAR7 : public RegisterBase<0x4002008C, 32, ReadWriteMode>
   {
     using MA = DMA1_CMAR7_MA_Values<DMA1::CMAR7, 0, 32, ReadWriteMode, DMA1CMAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA1_CMAR7_MA_Values<DMA1::CMAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -489,12 +526,14 @@ struct DMA1
     using C3S = DMA1_CSELR_C3S_Values<DMA1::CSELR, 8, 4, ReadWriteMode, DMA1CSELRBase> ;
     using C2S = DMA1_CSELR_C2S_Values<DMA1::CSELR, 4, 4, ReadWriteMode, DMA1CSELRBase> ;
     using C1S = DMA1_CSELR_C1S_Values<DMA1::CSELR, 0, 4, ReadWriteMode, DMA1CSELRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = DMA1_CSELR_C1S_Values<DMA1::CSELR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSELRPack  = Register<0x400200A8, 32, ReadWriteMode, DMA1CSELRBase, T...> ;
 
+  using Registers = TypesList<DMA1::ISR, DMA1::IFCR, DMA1::CCR1, DMA1::CNDTR1, DMA1::CPAR1, DMA1::CMAR1, DMA1::CCR2, DMA1::CNDTR2, DMA1::CPAR2, DMA1::CMAR2, DMA1::CCR3, DMA1::CNDTR3, DMA1::CPAR3, DMA1::CMAR3, DMA1::CCR4, DMA1::CNDTR4, DMA1::CPAR4, DMA1::CMAR4, DMA1::CCR5, DMA1::CNDTR5, DMA1::CPAR5, DMA1::CMAR5, DMA1::CCR6, DMA1::CNDTR6, DMA1::CPAR6, DMA1::CMAR6, DMA1::CCR7, DMA1::CNDTR7, DMA1::CPAR7, DMA1::CMAR7, DMA1::CSELR> ;
 } ;
 
 #endif //#if !defined(DMA1REGISTERS_HPP)
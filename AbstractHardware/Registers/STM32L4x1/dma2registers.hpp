@@ -87,6 +87,8 @@ struct DMA2
     using CHTIF1 = DMA2_IFCR_CHTIF1_Values<DMA2::IFCR, 2, 1, WriteMode, DMA2IFCRBase> ;
     using CTCIF1 = DMA2_IFCR_CTCIF1_Values<DMA2::IFCR, 1, 1, WriteMode, DMA2IFCRBase> ;
     using CGIF1 = DMA2_IFCR_CGIF1_Values<DMA2::IFCR, 0, 1, WriteMode, DMA2IFCRBase> ;
+    static constexpr Type WritableMask = 0xFFFFFFFU ;
+    static constexpr Type OneToClearMask = 0xFFFFFFFU ;
     using FieldValues = DMA2_IFCR_CGIF1_Values<DMA2::IFCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +111,8 @@ struct DMA2
     using HTIE = DMA2_CCR1_HTIE_Values<DMA2::CCR1, 2, 1, ReadWriteMode, DMA2CCR1Base> ;
     using TCIE = DMA2_CCR1_TCIE_Values<DMA2::CCR1, 1, 1, ReadWriteMode, DMA2CCR1Base> ;
     using EN = DMA2_CCR1_EN_Values<DMA2::CCR1, 0, 1, ReadWriteMode, DMA2CCR1Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR1_EN_Values<DMA2::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +124,7 @@ struct DMA2
   struct CNDTR1 : public RegisterBase<0x4002040C, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR1_NDT_Values<DMA2::CNDTR1, 0, 16, ReadWriteMode, DMA2CNDTR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR1_NDT_Values<DMA2::CNDTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct DMA2
   struct CPAR1 : public RegisterBase<0x40020410, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR1_PA_Values<DMA2::CPAR1, 0, 32, ReadWriteMode, DMA2CPAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR1_PA_Values<DMA2::CPAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +148,7 @@ struct DMA2
   struct CMAR1 : public RegisterBase<0x40020414, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR1_MA_Values<DMA2::CMAR1, 0, 32, ReadWriteMode, DMA2CMAR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR1_MA_Values<DMA2::CMAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +171,8 @@ struct DMA2
     using HTIE = DMA2_CCR2_HTIE_Values<DMA2::CCR2, 2, 1, ReadWriteMode, DMA2CCR2Base> ;
     using TCIE = DMA2_CCR2_TCIE_Values<DMA2::CCR2, 1, 1, ReadWriteMode, DMA2CCR2Base> ;
     using EN = DMA2_CCR2_EN_Values<DMA2::CCR2, 0, 1, ReadWriteMode, DMA2CCR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR2_EN_Values<DMA2::CCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -175,6 +184,7 @@ struct DMA2
   struct CNDTR2 : public RegisterBase<0x40020420, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR2_NDT_Values<DMA2::CNDTR2, 0, 16, ReadWriteMode, DMA2CNDTR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR2_NDT_Values<DMA2::CNDTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -186,6 +196,7 @@ struct DMA2
   struct CPAR2 : public RegisterBase<0x40020424, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR2_PA_Values<DMA2::CPAR2, 0, 32, ReadWriteMode, DMA2CPAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR2_PA_Values<DMA2::CPAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,6 +208,7 @@ struct DMA2
   struct CMAR2 : public RegisterBase<0x40020428, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR2_MA_Values<DMA2::CMAR2, 0, 32, ReadWriteMode, DMA2CMAR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR2_MA_Values<DMA2::CMAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -219,6 +231,8 @@ struct DMA2
     using HTIE = DMA2_CCR3_HTIE_Values<DMA2::CCR3, 2, 1, ReadWriteMode, DMA2CCR3Base> ;
     using TCIE = DMA2_CCR3_TCIE_Values<DMA2::CCR3, 1, 1, ReadWriteMode, DMA2CCR3Base> ;
     using EN = DMA2_CCR3_EN_Values<DMA2::CCR3, 0, 1, ReadWriteMode, DMA2CCR3Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR3_EN_Values<DMA2::CCR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -230,6 +244,7 @@ struct DMA2
   struct CNDTR3 : public RegisterBase<0x40020434, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR3_NDT_Values<DMA2::CNDTR3, 0, 16, ReadWriteMode, DMA2CNDTR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR3_NDT_Values<DMA2::CNDTR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +256,7 @@ struct DMA2
   struct CPAR3 : public RegisterBase<0x40020438, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR3_PA_Values<DMA2::CPAR3, 0, 32, ReadWriteMode, DMA2CPAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR3_PA_Values<DMA2::CPAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -252,6 +268,7 @@ struct DMA2
   struct CMAR3 : public RegisterBase<0x4002043C, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR3_MA_Values<DMA2::CMAR3, 0, 32, ReadWriteMode, DMA2CMAR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR3_MA_Values<DMA2::CMAR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +291,8 @@ struct DMA2
     using HTIE = DMA2_CCR4_HTIE_Values<DMA2::CCR4, 2, 1, ReadWriteMode, DMA2CCR4Base> ;
     using TCIE = DMA2_CCR4_TCIE_Values<DMA2::CCR4, 1, 1, ReadWriteMode, DMA2CCR4Base> ;
     using EN = DMA2_CCR4_EN_Values<DMA2::CCR4, 0, 1, ReadWriteMode, DMA2CCR4Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR4_EN_Values<DMA2::CCR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -285,6 +304,7 @@ struct DMA2
   struct CNDTR4 : public RegisterBase<0x40020448, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR4_NDT_Values<DMA2::CNDTR4, 0, 16, ReadWriteMode, DMA2CNDTR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR4_NDT_Values<DMA2::CNDTR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +316,7 @@ struct DMA2
   struct CPAR4 : public RegisterBase<0x4002044C, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR4_PA_Values<DMA2::CPAR4, 0, 32, ReadWriteMode, DMA2CPAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR4_PA_Values<DMA2::CPAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -307,6 +328,7 @@ struct DMA2
   struct CMAR4 : public RegisterBase<0x40020450, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR4_MA_Values<DMA2::CMAR4, 0, 32, ReadWriteMode, DMA2CMAR4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR4_MA_Values<DMA2::CMAR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -329,6 +351,8 @@ struct DMA2
     using HTIE = DMA2_CCR5_HTIE_Values<DMA2::CCR5, 2, 1, ReadWriteMode, DMA2CCR5Base> ;
     using TCIE = DMA2_CCR5_TCIE_Values<DMA2::CCR5, 1, 1, ReadWriteMode, DMA2CCR5Base> ;
     using EN = DMA2_CCR5_EN_Values<DMA2::CCR5, 0, 1, ReadWriteMode, DMA2CCR5Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR5_EN_Values<DMA2::CCR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -340,6 +364,7 @@ struct DMA2
   struct CNDTR5 : public RegisterBase<0x4002045C, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR5_NDT_Values<DMA2::CNDTR5, 0, 16, ReadWriteMode, DMA2CNDTR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR5_NDT_Values<DMA2::CNDTR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -351,6 +376,7 @@ struct DMA2
   struct CPAR5 : public RegisterBase<0x40020460, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR5_PA_Values<DMA2::CPAR5, 0, 32, ReadWriteMode, DMA2CPAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR5_PA_Values<DMA2::CPAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -362,6 +388,7 @@ struct DMA2
   struct CMAR5 : public RegisterBase<0x40020464, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR5_MA_Values<DMA2::CMAR5, 0, 32, ReadWriteMode, DMA2CMAR5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR5_MA_Values<DMA2::CMAR5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -384,6 +411,8 @@ struct DMA2
     using HTIE = DMA2_CCR6_HTIE_Values<DMA2::CCR6, 2, 1, ReadWriteMode, DMA2CCR6Base> ;
     using TCIE = DMA2_CCR6_TCIE_Values<DMA2::CCR6, 1, 1, ReadWriteMode, DMA2CCR6Base> ;
     using EN = DMA2_CCR6_EN_Values<DMA2::CCR6, 0, 1, ReadWriteMode, DMA2CCR6Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR6_EN_Values<DMA2::CCR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -395,6 +424,7 @@ struct DMA2
   struct CNDTR6 : public RegisterBase<0x40020470, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR6_NDT_Values<DMA2::CNDTR6, 0, 16, ReadWriteMode, DMA2CNDTR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR6_NDT_Values<DMA2::CNDTR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -406,6 +436,7 @@ struct DMA2
   struct CPAR6 : public RegisterBase<0x40020474, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR6_PA_Values<DMA2::CPAR6, 0, 32, ReadWriteMode, DMA2CPAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR6_PA_Values<DMA2::CPAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -417,6 +448,7 @@ struct DMA2
   struct CMAR6 : public RegisterBase<0x40020478, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR6_MA_Values<DMA2::CMAR6, 0, 32, ReadWriteMode, DMA2CMAR6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR6_MA_Values<DMA2::CMAR6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -439,6 +471,8 @@ struct DMA2
     using HTIE = DMA2_CCR7_HTIE_Values<DMA2::CCR7, 2, 1, ReadWriteMode, DMA2CCR7Base> ;
     using TCIE = DMA2_CCR7_TCIE_Values<DMA2::CCR7, 1, 1, ReadWriteMode, DMA2CCR7Base> ;
     using EN = DMA2_CCR7_EN_Values<DMA2::CCR7, 0, 1, ReadWriteMode, DMA2CCR7Base> ;
+    static constexpr Type SnapshotMask = 0x7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = DMA2_CCR7_EN_Values<DMA2::CCR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -450,6 +484,7 @@ struct DMA2
   struct CNDTR7 : public RegisterBase<0x40020484, 32, ReadWriteMode>
   {
     using NDT = DMA2_CNDTR7_NDT_Values<DMA2::CNDTR7, 0, 16, ReadWriteMode, DMA2CNDTR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = DMA2_CNDTR7_NDT_Values<DMA2::CNDTR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -461,6 +496,7 @@ struct DMA2
   struct CPAR7 : public RegisterBase<0x40020488, 32, ReadWriteMode>
   {
     using PA = DMA2_CPAR7_PA_Values<DMA2::CPAR7, 0, 32, ReadWriteMode, DMA2CPAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CPAR7_PA_Values<DMA2::CPAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -472,6 +508,7 @@ struct DMA2
   struct CMAR7 : public RegisterBase<0x4002048C, 32, ReadWriteMode>
   {
     using MA = DMA2_CMAR7_MA_Values<DMA2::CMAR7, 0, 32, ReadWriteMode, DMA2CMAR7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = DMA2_CMAR7_MA_Values<DMA2::CMAR7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -489,12 +526,14 @@ struct DMA2
     using C3S = DMA2_CSELR_C3S_Values<DMA2::CSELR, 8, 4, ReadWriteMode, DMA2CSELRBase> ;
     using C2S = DMA2_CSELR_C2S_Values<DMA2::CSELR, 4, 4, ReadWriteMode, DMA2CSELRBase> ;
     using C1S = DMA2_CSELR_C1S_Values<DMA2::CSELR, 0, 4, ReadWriteMode, DMA2CSELRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFU ;
     using FieldValues = DMA2_CSELR_C1S_Values<DMA2::CSELR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CSELRPack  = Register<0x400204A8, 32, ReadWriteMode, DMA2CSELRBase, T...> ;
 
+  using Registers = TypesList<DMA2::ISR, DMA2::IFCR, DMA2::CCR1, DMA2::CNDTR1, DMA2::CPAR1, DMA2::CMAR1, DMA2::CCR2, DMA2::CNDTR2, DMA2::CPAR2, DMA2::CMAR2, DMA2::CCR3, DMA2::CNDTR3, DMA2::CPAR3, DMA2::CMAR3, DMA2::CCR4, DMA2::CNDTR4, DMA2::CPAR4, DMA2::CMAR4, DMA2::CCR5, DMA2::CNDTR5, DMA2::CPAR5, DMA2::CMAR5, DMA2::CCR6, DMA2::CNDTR6, DMA2::CPAR6, DMA2::CMAR6, DMA2::CCR7, DMA2::CNDTR7, DMA2::CPAR7, DMA2::CMAR7, DMA2::CSELR> ;
 } ;
 
 #endif //#if !defined(DMA2REGISTERS_HPP)
@@ -53,6 +53,7 @@ struct EXTI
     using MR29 = EXTI_IMR1_MR29_Values<EXTI::IMR1, 29, 1, ReadWriteMode, EXTIIMR1Base> ;
     using MR30 = EXTI_IMR1_MR30_Values<EXTI::IMR1, 30, 1, ReadWriteMode, EXTIIMR1Base> ;
     using MR31 = EXTI_IMR1_MR31_Values<EXTI::IMR1, 31, 1, ReadWriteMode, EXTIIMR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = EXTI_IMR1_MR31_Values<EXTI::IMR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -95,6 +96,7 @@ struct EXTI
     using MR29 = EXTI_EMR1_MR29_Values<EXTI::EMR1, 29, 1, ReadWriteMode, EXTIEMR1Base> ;
     using MR30 = EXTI_EMR1_MR30_Values<EXTI::EMR1, 30, 1, ReadWriteMode, EXTIEMR1Base> ;
     using MR31 = EXTI_EMR1_MR31_Values<EXTI::EMR1, 31, 1, ReadWriteMode, EXTIEMR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = EXTI_EMR1_MR31_Values<EXTI::EMR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +129,7 @@ struct EXTI
     using TR20 = EXTI_RTSR1_TR20_Values<EXTI::RTSR1, 20, 1, ReadWriteMode, EXTIRTSR1Base> ;
     using TR21 = EXTI_RTSR1_TR21_Values<EXTI::RTSR1, 21, 1, ReadWriteMode, EXTIRTSR1Base> ;
     using TR22 = EXTI_RTSR1_TR22_Values<EXTI::RTSR1, 22, 1, ReadWriteMode, EXTIRTSR1Base> ;
+    static constexpr Type SnapshotMask = 0x7DFFFFU ;
     using FieldValues = EXTI_RTSR1_TR22_Values<EXTI::RTSR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -159,6 +162,7 @@ struct EXTI
     using TR20 = EXTI_FTSR1_TR20_Values<EXTI::FTSR1, 20, 1, ReadWriteMode, EXTIFTSR1Base> ;
     using TR21 = EXTI_FTSR1_TR21_Values<EXTI::FTSR1, 21, 1, ReadWriteMode, EXTIFTSR1Base> ;
     using TR22 = EXTI_FTSR1_TR22_Values<EXTI::FTSR1, 22, 1, ReadWriteMode, EXTIFTSR1Base> ;
+    static constexpr Type SnapshotMask = 0x7DFFFFU ;
     using FieldValues = EXTI_FTSR1_TR22_Values<EXTI::FTSR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +195,7 @@ struct EXTI
     using SWIER20 = EXTI_SWIER1_SWIER20_Values<EXTI::SWIER1, 20, 1, ReadWriteMode, EXTISWIER1Base> ;
     using SWIER21 = EXTI_SWIER1_SWIER21_Values<EXTI::SWIER1, 21, 1, ReadWriteMode, EXTISWIER1Base> ;
     using SWIER22 = EXTI_SWIER1_SWIER22_Values<EXTI::SWIER1, 22, 1, ReadWriteMode, EXTISWIER1Base> ;
+    static constexpr Type SnapshotMask = 0x7DFFFFU ;
     using FieldValues = EXTI_SWIER1_SWIER22_Values<EXTI::SWIER1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -223,6 +228,9 @@ struct EXTI
     using PR20 = EXTI_PR1_PR20_Values<EXTI::PR1, 20, 1, ReadWriteMode, EXTIPR1Base> ;
     using PR21 = EXTI_PR1_PR21_Values<EXTI::PR1, 21, 1, ReadWriteMode, EXTIPR1Base> ;
     using PR22 = EXTI_PR1_PR22_Values<EXTI::PR1, 22, 1, ReadWriteMode, EXTIPR1Base> ;
+    static constexpr Type WritableMask = 0x7DFFFFU ;
+    static constexpr Type OneToClearMask = 0x7DFFFFU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PR1_PR22_Values<EXTI::PR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +249,7 @@ struct EXTI
     using MR37 = EXTI_IMR2_MR37_Values<EXTI::IMR2, 5, 1, ReadWriteMode, EXTIIMR2Base> ;
     using MR38 = EXTI_IMR2_MR38_Values<EXTI::IMR2, 6, 1, ReadWriteMode, EXTIIMR2Base> ;
     using MR39 = EXTI_IMR2_MR39_Values<EXTI::IMR2, 7, 1, ReadWriteMode, EXTIIMR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = EXTI_IMR2_MR39_Values<EXTI::IMR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,6 +268,7 @@ struct EXTI
     using MR37 = EXTI_EMR2_MR37_Values<EXTI::EMR2, 5, 1, ReadWriteMode, EXTIEMR2Base> ;
     using MR38 = EXTI_EMR2_MR38_Values<EXTI::EMR2, 6, 1, ReadWriteMode, EXTIEMR2Base> ;
     using MR39 = EXTI_EMR2_MR39_Values<EXTI::EMR2, 7, 1, ReadWriteMode, EXTIEMR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = EXTI_EMR2_MR39_Values<EXTI::EMR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,6 +283,7 @@ struct EXTI
     using RT36 = EXTI_RTSR2_RT36_Values<EXTI::RTSR2, 4, 1, ReadWriteMode, EXTIRTSR2Base> ;
     using RT37 = EXTI_RTSR2_RT37_Values<EXTI::RTSR2, 5, 1, ReadWriteMode, EXTIRTSR2Base> ;
     using RT38 = EXTI_RTSR2_RT38_Values<EXTI::RTSR2, 6, 1, ReadWriteMode, EXTIRTSR2Base> ;
+    static constexpr Type SnapshotMask = 0x78U ;
     using FieldValues = EXTI_RTSR2_RT38_Values<EXTI::RTSR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -287,6 +298,7 @@ struct EXTI
     using FT36 = EXTI_FTSR2_FT36_Values<EXTI::FTSR2, 4, 1, ReadWriteMode, EXTIFTSR2Base> ;
     using FT37 = EXTI_FTSR2_FT37_Values<EXTI::FTSR2, 5, 1, ReadWriteMode, EXTIFTSR2Base> ;
     using FT38 = EXTI_FTSR2_FT38_Values<EXTI::FTSR2, 6, 1, ReadWriteMode, EXTIFTSR2Base> ;
+    static constexpr Type SnapshotMask = 0x78U ;
     using FieldValues = EXTI_FTSR2_FT38_Values<EXTI::FTSR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -301,6 +313,7 @@ struct EXTI
     using SWI36 = EXTI_SWIER2_SWI36_Values<EXTI::SWIER2, 4, 1, ReadWriteMode, EXTISWIER2Base> ;
     using SWI37 = EXTI_SWIER2_SWI37_Values<EXTI::SWIER2, 5, 1, ReadWriteMode, EXTISWIER2Base> ;
     using SWI38 = EXTI_SWIER2_SWI38_Values<EXTI::SWIER2, 6, 1, ReadWriteMode, EXTISWIER2Base> ;
+    static constexpr Type SnapshotMask = 0x78U ;
     using FieldValues = EXTI_SWIER2_SWI38_Values<EXTI::SWIER2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -315,12 +328,16 @@ struct EXTI
     using PIF36 = EXTI_PR2_PIF36_Values<EXTI::PR2, 4, 1, ReadWriteMode, EXTIPR2Base> ;
     using PIF37 = EXTI_PR2_PIF37_Values<EXTI::PR2, 5, 1, ReadWriteMode, EXTIPR2Base> ;
     using PIF38 = EXTI_PR2_PIF38_Values<EXTI::PR2, 6, 1, ReadWriteMode, EXTIPR2Base> ;
+    static constexpr Type WritableMask = 0x78U ;
+    static constexpr Type OneToClearMask = 0x78U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = EXTI_PR2_PIF38_Values<EXTI::PR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PR2Pack  = Register<0x40010434, 32, ReadWriteMode, EXTIPR2Base, T...> ;
 
+  using Registers = TypesList<EXTI::IMR1, EXTI::EMR1, EXTI::RTSR1, EXTI::FTSR1, EXTI::SWIER1, EXTI::PR1, EXTI::IMR2, EXTI::EMR2, EXTI::RTSR2, EXTI::FTSR2, EXTI::SWIER2, EXTI::PR2> ;
 } ;
 
 #endif //#if !defined(EXTIREGISTERS_HPP)
@@ -22,6 +22,7 @@ struct FIREWALL
   struct CSSA : public RegisterBase<0x40011C00, 32, ReadWriteMode>
   {
     using ADD = FIREWALL_CSSA_ADD_Values<FIREWALL::CSSA, 8, 16, ReadWriteMode, FIREWALLCSSABase> ;
+    static constexpr Type SnapshotMask = 0xFFFF00U ;
     using FieldValues = FIREWALL_CSSA_ADD_Values<FIREWALL::CSSA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -33,6 +34,7 @@ struct FIREWALL
   struct CSL : public RegisterBase<0x40011C04, 32, ReadWriteMode>
   {
     using LENG = FIREWALL_CSL_LENG_Values<FIREWALL::CSL, 8, 14, ReadWriteMode, FIREWALLCSLBase> ;
+    static constexpr Type SnapshotMask = 0x3FFF00U ;
     using FieldValues = FIREWALL_CSL_LENG_Values<FIREWALL::CSL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +46,7 @@ struct FIREWALL
   struct NVDSSA : public RegisterBase<0x40011C08, 32, ReadWriteMode>
   {
     using ADD = FIREWALL_NVDSSA_ADD_Values<FIREWALL::NVDSSA, 8, 16, ReadWriteMode, FIREWALLNVDSSABase> ;
+    static constexpr Type SnapshotMask = 0xFFFF00U ;
     using FieldValues = FIREWALL_NVDSSA_ADD_Values<FIREWALL::NVDSSA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +58,7 @@ struct FIREWALL
   struct NVDSL : public RegisterBase<0x40011C0C, 32, ReadWriteMode>
   {
     using LENG = FIREWALL_NVDSL_LENG_Values<FIREWALL::NVDSL, 8, 14, ReadWriteMode, FIREWALLNVDSLBase> ;
+    static constexpr Type SnapshotMask = 0x3FFF00U ;
     using FieldValues = FIREWALL_NVDSL_LENG_Values<FIREWALL::NVDSL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +70,7 @@ struct FIREWALL
   struct VDSSA : public RegisterBase<0x40011C10, 32, ReadWriteMode>
   {
     using ADD = FIREWALL_VDSSA_ADD_Values<FIREWALL::VDSSA, 6, 10, ReadWriteMode, FIREWALLVDSSABase> ;
+    static constexpr Type SnapshotMask = 0xFFC0U ;
     using FieldValues = FIREWALL_VDSSA_ADD_Values<FIREWALL::VDSSA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -77,6 +82,7 @@ struct FIREWALL
   struct VDSL : public RegisterBase<0x40011C14, 32, ReadWriteMode>
   {
     using LENG = FIREWALL_VDSL_LENG_Values<FIREWALL::VDSL, 6, 10, ReadWriteMode, FIREWALLVDSLBase> ;
+    static constexpr Type SnapshotMask = 0xFFC0U ;
     using FieldValues = FIREWALL_VDSL_LENG_Values<FIREWALL::VDSL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,12 +96,14 @@ struct FIREWALL
     using VDE = FIREWALL_CR_VDE_Values<FIREWALL::CR, 2, 1, ReadWriteMode, FIREWALLCRBase> ;
     using VDS = FIREWALL_CR_VDS_Values<FIREWALL::CR, 1, 1, ReadWriteMode, FIREWALLCRBase> ;
     using FPA = FIREWALL_CR_FPA_Values<FIREWALL::CR, 0, 1, ReadWriteMode, FIREWALLCRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = FIREWALL_CR_FPA_Values<FIREWALL::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CRPack  = Register<0x40011C20, 32, ReadWriteMode, FIREWALLCRBase, T...> ;
 
+  using Registers = TypesList<FIREWALL::CSSA, FIREWALL::CSL, FIREWALL::NVDSSA, FIREWALL::NVDSL, FIREWALL::VDSSA, FIREWALL::VDSL, FIREWALL::CR> ;
 } ;
 
 #endif //#if !defined(FIREWALLREGISTERS_HPP)
@@ -29,6 +29,7 @@ struct FLASH
     using DCRST = FLASH_ACR_DCRST_Values<FLASH::ACR, 12, 1, ReadWriteMode, FLASHACRBase> ;
     using RUN_PD = FLASH_ACR_RUN_PD_Values<FLASH::ACR, 13, 1, ReadWriteMode, FLASHACRBase> ;
     using SLEEP_PD = FLASH_ACR_SLEEP_PD_Values<FLASH::ACR, 14, 1, ReadWriteMode, FLASHACRBase> ;
+    static constexpr Type SnapshotMask = 0x7F07U ;
     using FieldValues = FLASH_ACR_SLEEP_PD_Values<FLASH::ACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -84,6 +85,9 @@ struct FLASH
     using RDERR = FLASH_SR_RDERR_Values<FLASH::SR, 14, 1, ReadWriteMode, FLASHSRBase> ;
     using OPTVERR = FLASH_SR_OPTVERR_Values<FLASH::SR, 15, 1, ReadWriteMode, FLASHSRBase> ;
     using BSY = FLASH_SR_BSY_Values<FLASH::SR, 16, 1, ReadMode, FLASHSRBase> ;
+    static constexpr Type WritableMask = 0xC3FBU ;
+    static constexpr Type OneToClearMask = 0xC3FBU ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = FLASH_SR_BSY_Values<FLASH::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +113,7 @@ struct FLASH
     using OBL_LAUNCH = FLASH_CR_OBL_LAUNCH_Values<FLASH::CR, 27, 1, ReadWriteMode, FLASHCRBase> ;
     using OPTLOCK = FLASH_CR_OPTLOCK_Values<FLASH::CR, 30, 1, ReadWriteMode, FLASHCRBase> ;
     using LOCK = FLASH_CR_LOCK_Values<FLASH::CR, 31, 1, ReadWriteMode, FLASHCRBase> ;
+    static constexpr Type SnapshotMask = 0xCF078FFFU ;
     using FieldValues = FLASH_CR_LOCK_Values<FLASH::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +130,7 @@ struct FLASH
     using ECCIE = FLASH_ECCR_ECCIE_Values<FLASH::ECCR, 24, 1, ReadWriteMode, FLASHECCRBase> ;
     using ECCC = FLASH_ECCR_ECCC_Values<FLASH::ECCR, 30, 1, ReadWriteMode, FLASHECCRBase> ;
     using ECCD = FLASH_ECCR_ECCD_Values<FLASH::ECCR, 31, 1, ReadWriteMode, FLASHECCRBase> ;
+    static constexpr Type SnapshotMask = 0xC1000000U ;
     using FieldValues = FLASH_ECCR_ECCD_Values<FLASH::ECCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -148,6 +154,7 @@ struct FLASH
     using nBOOT1 = FLASH_OPTR_nBOOT1_Values<FLASH::OPTR, 23, 1, ReadWriteMode, FLASHOPTRBase> ;
     using SRAM2_PE = FLASH_OPTR_SRAM2_PE_Values<FLASH::OPTR, 24, 1, ReadWriteMode, FLASHOPTRBase> ;
     using SRAM2_RST = FLASH_OPTR_SRAM2_RST_Values<FLASH::OPTR, 25, 1, ReadWriteMode, FLASHOPTRBase> ;
+    static constexpr Type SnapshotMask = 0x3BF37FFU ;
     using FieldValues = FLASH_OPTR_SRAM2_RST_Values<FLASH::OPTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -159,6 +166,7 @@ struct FLASH
   struct PCROP1SR : public RegisterBase<0x40022024, 32, ReadWriteMode>
   {
     using PCROP1_STRT = FLASH_PCROP1SR_PCROP1_STRT_Values<FLASH::PCROP1SR, 0, 16, ReadWriteMode, FLASHPCROP1SRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = FLASH_PCROP1SR_PCROP1_STRT_Values<FLASH::PCROP1SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +179,7 @@ struct FLASH
   {
     using PCROP1_END = FLASH_PCROP1ER_PCROP1_END_Values<FLASH::PCROP1ER, 0, 16, ReadWriteMode, FLASHPCROP1ERBase> ;
     using PCROP_RDP = FLASH_PCROP1ER_PCROP_RDP_Values<FLASH::PCROP1ER, 31, 1, ReadWriteMode, FLASHPCROP1ERBase> ;
+    static constexpr Type SnapshotMask = 0x8000FFFFU ;
     using FieldValues = FLASH_PCROP1ER_PCROP_RDP_Values<FLASH::PCROP1ER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -183,6 +192,7 @@ struct FLASH
   {
     using WRP1A_STRT = FLASH_WRP1AR_WRP1A_STRT_Values<FLASH::WRP1AR, 0, 8, ReadWriteMode, FLASHWRP1ARBase> ;
     using WRP1A_END = FLASH_WRP1AR_WRP1A_END_Values<FLASH::WRP1AR, 16, 8, ReadWriteMode, FLASHWRP1ARBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = FLASH_WRP1AR_WRP1A_END_Values<FLASH::WRP1AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -195,6 +205,7 @@ struct FLASH
   {
     using WRP1B_STRT = FLASH_WRP1BR_WRP1B_STRT_Values<FLASH::WRP1BR, 16, 8, ReadWriteMode, FLASHWRP1BRBase> ;
     using WRP1B_END = FLASH_WRP1BR_WRP1B_END_Values<FLASH::WRP1BR, 0, 8, ReadWriteMode, FLASHWRP1BRBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = FLASH_WRP1BR_WRP1B_END_Values<FLASH::WRP1BR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -206,6 +217,7 @@ struct FLASH
   struct PCROP2SR : public RegisterBase<0x40022044, 32, ReadWriteMode>
   {
     using PCROP2_STRT = FLASH_PCROP2SR_PCROP2_STRT_Values<FLASH::PCROP2SR, 0, 16, ReadWriteMode, FLASHPCROP2SRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = FLASH_PCROP2SR_PCROP2_STRT_Values<FLASH::PCROP2SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -217,6 +229,7 @@ struct FLASH
   struct PCROP2ER : public RegisterBase<0x40022048, 32, ReadWriteMode>
   {
     using PCROP2_END = FLASH_PCROP2ER_PCROP2_END_Values<FLASH::PCROP2ER, 0, 16, ReadWriteMode, FLASHPCROP2ERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = FLASH_PCROP2ER_PCROP2_END_Values<FLASH::PCROP2ER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -229,6 +242,7 @@ struct FLASH
   {
     using WRP2A_STRT = FLASH_WRP2AR_WRP2A_STRT_Values<FLASH::WRP2AR, 0, 8, ReadWriteMode, FLASHWRP2ARBase> ;
     using WRP2A_END = FLASH_WRP2AR_WRP2A_END_Values<FLASH::WRP2AR, 16, 8, ReadWriteMode, FLASHWRP2ARBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = FLASH_WRP2AR_WRP2A_END_Values<FLASH::WRP2AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,12 +255,14 @@ struct FLASH
   {
     using WRP2B_STRT = FLASH_WRP2BR_WRP2B_STRT_Values<FLASH::WRP2BR, 0, 8, ReadWriteMode, FLASHWRP2BRBase> ;
     using WRP2B_END = FLASH_WRP2BR_WRP2B_END_Values<FLASH::WRP2BR, 16, 8, ReadWriteMode, FLASHWRP2BRBase> ;
+    static constexpr Type SnapshotMask = 0xFF00FFU ;
     using FieldValues = FLASH_WRP2BR_WRP2B_END_Values<FLASH::WRP2BR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using WRP2BRPack  = Register<0x40022050, 32, ReadWriteMode, FLASHWRP2BRBase, T...> ;
 
+  using Registers = TypesList<FLASH::ACR, FLASH::PDKEYR, FLASH::KEYR, FLASH::OPTKEYR, FLASH::SR, FLASH::CR, FLASH::ECCR, FLASH::OPTR, FLASH::PCROP1SR, FLASH::PCROP1ER, FLASH::WRP1AR, FLASH::WRP1BR, FLASH::PCROP2SR, FLASH::PCROP2ER, FLASH::WRP2AR, FLASH::WRP2BR> ;
 } ;
 
 #endif //#if !defined(FLASHREGISTERS_HPP)
@@ -22,12 +22,14 @@ struct FPU_CPACR
   struct CPACR : public RegisterBase<0xE000ED88, 32, ReadWriteMode>
   {
     using CP = FPU_CPACR_CPACR_CP_Values<FPU_CPACR::CPACR, 20, 4, ReadWriteMode, FPU_CPACRCPACRBase> ;
+    static constexpr Type SnapshotMask = 0xF00000U ;
     using FieldValues = FPU_CPACR_CPACR_CP_Values<FPU_CPACR::CPACR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CPACRPack  = Register<0xE000ED88, 32, ReadWriteMode, FPU_CPACRCPACRBase, T...> ;
 
+  using Registers = TypesList<FPU_CPACR::CPACR> ;
 } ;
 
 #endif //#if !defined(FPUCPACRREGISTERS_HPP)
@@ -30,6 +30,7 @@ struct FPU
     using MONRDY = FPU_FPCCR_MONRDY_Values<FPU::FPCCR, 8, 1, ReadWriteMode, FPUFPCCRBase> ;
     using LSPEN = FPU_FPCCR_LSPEN_Values<FPU::FPCCR, 30, 1, ReadWriteMode, FPUFPCCRBase> ;
     using ASPEN = FPU_FPCCR_ASPEN_Values<FPU::FPCCR, 31, 1, ReadWriteMode, FPUFPCCRBase> ;
+    static constexpr Type SnapshotMask = 0xC000017BU ;
     using FieldValues = FPU_FPCCR_ASPEN_Values<FPU::FPCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -41,6 +42,7 @@ struct FPU
   struct FPCAR : public RegisterBase<0xE000EF38, 32, ReadWriteMode>
   {
     using ADDRESS = FPU_FPCAR_ADDRESS_Values<FPU::FPCAR, 3, 29, ReadWriteMode, FPUFPCARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFF8U ;
     using FieldValues = FPU_FPCAR_ADDRESS_Values<FPU::FPCAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -65,12 +67,14 @@ struct FPU
     using C = FPU_FPSCR_C_Values<FPU::FPSCR, 29, 1, ReadWriteMode, FPUFPSCRBase> ;
     using Z = FPU_FPSCR_Z_Values<FPU::FPSCR, 30, 1, ReadWriteMode, FPUFPSCRBase> ;
     using N = FPU_FPSCR_N_Values<FPU::FPSCR, 31, 1, ReadWriteMode, FPUFPSCRBase> ;
+    static constexpr Type SnapshotMask = 0xF7C0009FU ;
     using FieldValues = FPU_FPSCR_N_Values<FPU::FPSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FPSCRPack  = Register<0xE000EF3C, 32, ReadWriteMode, FPUFPSCRBase, T...> ;
 
+  using Registers = TypesList<FPU::FPCCR, FPU::FPCAR, FPU::FPSCR> ;
 } ;
 
 #endif //#if !defined(FPUREGISTERS_HPP)
@@ -41,6 +41,8 @@ struct I2C2
     using SMBDEN = I2C2_CR1_SMBDEN_Values<I2C2::CR1, 21, 1, ReadWriteMode, I2C2CR1Base> ;
     using ALERTEN = I2C2_CR1_ALERTEN_Values<I2C2::CR1, 22, 1, ReadWriteMode, I2C2CR1Base> ;
     using PECEN = I2C2_CR1_PECEN_Values<I2C2::CR1, 23, 1, ReadWriteMode, I2C2CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFDFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = I2C2_CR1_PECEN_Values<I2C2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct I2C2
     using ADD10 = I2C2_CR2_ADD10_Values<I2C2::CR2, 11, 1, ReadWriteMode, I2C2CR2Base> ;
     using RD_WRN = I2C2_CR2_RD_WRN_Values<I2C2::CR2, 10, 1, ReadWriteMode, I2C2CR2Base> ;
     using SADD = I2C2_CR2_SADD_Values<I2C2::CR2, 0, 10, ReadWriteMode, I2C2CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = I2C2_CR2_SADD_Values<I2C2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +78,7 @@ struct I2C2
     using OA1 = I2C2_OAR1_OA1_Values<I2C2::OAR1, 0, 10, ReadWriteMode, I2C2OAR1Base> ;
     using OA1MODE = I2C2_OAR1_OA1MODE_Values<I2C2::OAR1, 10, 1, ReadWriteMode, I2C2OAR1Base> ;
     using OA1EN = I2C2_OAR1_OA1EN_Values<I2C2::OAR1, 15, 1, ReadWriteMode, I2C2OAR1Base> ;
+    static constexpr Type SnapshotMask = 0x87FFU ;
     using FieldValues = I2C2_OAR1_OA1EN_Values<I2C2::OAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +92,7 @@ struct I2C2
     using OA2 = I2C2_OAR2_OA2_Values<I2C2::OAR2, 1, 7, ReadWriteMode, I2C2OAR2Base> ;
     using OA2MSK = I2C2_OAR2_OA2MSK_Values<I2C2::OAR2, 8, 3, ReadWriteMode, I2C2OAR2Base> ;
     using OA2EN = I2C2_OAR2_OA2EN_Values<I2C2::OAR2, 15, 1, ReadWriteMode, I2C2OAR2Base> ;
+    static constexpr Type SnapshotMask = 0x87FEU ;
     using FieldValues = I2C2_OAR2_OA2EN_Values<I2C2::OAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +108,7 @@ struct I2C2
     using SDADEL = I2C2_TIMINGR_SDADEL_Values<I2C2::TIMINGR, 16, 4, ReadWriteMode, I2C2TIMINGRBase> ;
     using SCLDEL = I2C2_TIMINGR_SCLDEL_Values<I2C2::TIMINGR, 20, 4, ReadWriteMode, I2C2TIMINGRBase> ;
     using PRESC = I2C2_TIMINGR_PRESC_Values<I2C2::TIMINGR, 28, 4, ReadWriteMode, I2C2TIMINGRBase> ;
+    static constexpr Type SnapshotMask = 0xF0FFFFFFU ;
     using FieldValues = I2C2_TIMINGR_PRESC_Values<I2C2::TIMINGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +124,7 @@ struct I2C2
     using TIMOUTEN = I2C2_TIMEOUTR_TIMOUTEN_Values<I2C2::TIMEOUTR, 15, 1, ReadWriteMode, I2C2TIMEOUTRBase> ;
     using TIMEOUTB = I2C2_TIMEOUTR_TIMEOUTB_Values<I2C2::TIMEOUTR, 16, 12, ReadWriteMode, I2C2TIMEOUTRBase> ;
     using TEXTEN = I2C2_TIMEOUTR_TEXTEN_Values<I2C2::TIMEOUTR, 31, 1, ReadWriteMode, I2C2TIMEOUTRBase> ;
+    static constexpr Type SnapshotMask = 0x8FFF9FFFU ;
     using FieldValues = I2C2_TIMEOUTR_TEXTEN_Values<I2C2::TIMEOUTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +152,7 @@ struct I2C2
     using RXNE = I2C2_ISR_RXNE_Values<I2C2::ISR, 2, 1, ReadMode, I2C2ISRBase> ;
     using TXIS = I2C2_ISR_TXIS_Values<I2C2::ISR, 1, 1, ReadWriteMode, I2C2ISRBase> ;
     using TXE = I2C2_ISR_TXE_Values<I2C2::ISR, 0, 1, ReadWriteMode, I2C2ISRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C2_ISR_TXE_Values<I2C2::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,12 +205,14 @@ struct I2C2
   struct TXDR : public RegisterBase<0x40005828, 32, ReadWriteMode>
   {
     using TXDATA = I2C2_TXDR_TXDATA_Values<I2C2::TXDR, 0, 8, ReadWriteMode, I2C2TXDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C2_TXDR_TXDATA_Values<I2C2::TXDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TXDRPack  = Register<0x40005828, 32, ReadWriteMode, I2C2TXDRBase, T...> ;
 
+  using Registers = TypesList<I2C2::CR1, I2C2::CR2, I2C2::OAR1, I2C2::OAR2, I2C2::TIMINGR, I2C2::TIMEOUTR, I2C2::ISR, I2C2::ICR, I2C2::PECR, I2C2::RXDR, I2C2::TXDR> ;
 } ;
 
 #endif //#if !defined(I2C2REGISTERS_HPP)
@@ -41,6 +41,8 @@ struct I2C4
     using SMBDEN = I2C4_CR1_SMBDEN_Values<I2C4::CR1, 21, 1, ReadWriteMode, I2C4CR1Base> ;
     using ALERTEN = I2C4_CR1_ALERTEN_Values<I2C4::CR1, 22, 1, ReadWriteMode, I2C4CR1Base> ;
     using PECEN = I2C4_CR1_PECEN_Values<I2C4::CR1, 23, 1, ReadWriteMode, I2C4CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFDFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = I2C4_CR1_PECEN_Values<I2C4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +64,7 @@ struct I2C4
     using ADD10 = I2C4_CR2_ADD10_Values<I2C4::CR2, 11, 1, ReadWriteMode, I2C4CR2Base> ;
     using RD_WRN = I2C4_CR2_RD_WRN_Values<I2C4::CR2, 10, 1, ReadWriteMode, I2C4CR2Base> ;
     using SADD = I2C4_CR2_SADD_Values<I2C4::CR2, 0, 10, ReadWriteMode, I2C4CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFU ;
     using FieldValues = I2C4_CR2_SADD_Values<I2C4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -75,6 +78,7 @@ struct I2C4
     using OA1 = I2C4_OAR1_OA1_Values<I2C4::OAR1, 0, 10, ReadWriteMode, I2C4OAR1Base> ;
     using OA1MODE = I2C4_OAR1_OA1MODE_Values<I2C4::OAR1, 10, 1, ReadWriteMode, I2C4OAR1Base> ;
     using OA1EN = I2C4_OAR1_OA1EN_Values<I2C4::OAR1, 15, 1, ReadWriteMode, I2C4OAR1Base> ;
+    static constexpr Type SnapshotMask = 0x87FFU ;
     using FieldValues = I2C4_OAR1_OA1EN_Values<I2C4::OAR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +92,7 @@ struct I2C4
     using OA2 = I2C4_OAR2_OA2_Values<I2C4::OAR2, 1, 7, ReadWriteMode, I2C4OAR2Base> ;
     using OA2MSK = I2C4_OAR2_OA2MSK_Values<I2C4::OAR2, 8, 3, ReadWriteMode, I2C4OAR2Base> ;
     using OA2EN = I2C4_OAR2_OA2EN_Values<I2C4::OAR2, 15, 1, ReadWriteMode, I2C4OAR2Base> ;
+    static constexpr Type SnapshotMask = 0x87FEU ;
     using FieldValues = I2C4_OAR2_OA2EN_Values<I2C4::OAR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +108,7 @@ struct I2C4
     using SDADEL = I2C4_TIMINGR_SDADEL_Values<I2C4::TIMINGR, 16, 4, ReadWriteMode, I2C4TIMINGRBase> ;
     using SCLDEL = I2C4_TIMINGR_SCLDEL_Values<I2C4::TIMINGR, 20, 4, ReadWriteMode, I2C4TIMINGRBase> ;
     using PRESC = I2C4_TIMINGR_PRESC_Values<I2C4::TIMINGR, 28, 4, ReadWriteMode, I2C4TIMINGRBase> ;
+    static constexpr Type SnapshotMask = 0xF0FFFFFFU ;
     using FieldValues = I2C4_TIMINGR_PRESC_Values<I2C4::TIMINGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -118,6 +124,7 @@ struct I2C4
     using TIMOUTEN = I2C4_TIMEOUTR_TIMOUTEN_Values<I2C4::TIMEOUTR, 15, 1, ReadWriteMode, I2C4TIMEOUTRBase> ;
     using TIMEOUTB = I2C4_TIMEOUTR_TIMEOUTB_Values<I2C4::TIMEOUTR, 16, 12, ReadWriteMode, I2C4TIMEOUTRBase> ;
     using TEXTEN = I2C4_TIMEOUTR_TEXTEN_Values<I2C4::TIMEOUTR, 31, 1, ReadWriteMode, I2C4TIMEOUTRBase> ;
+    static constexpr Type SnapshotMask = 0x8FFF9FFFU ;
     using FieldValues = I2C4_TIMEOUTR_TEXTEN_Values<I2C4::TIMEOUTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +152,7 @@ struct I2C4
     using RXNE = I2C4_ISR_RXNE_Values<I2C4::ISR, 2, 1, ReadMode, I2C4ISRBase> ;
     using TXIS = I2C4_ISR_TXIS_Values<I2C4::ISR, 1, 1, ReadWriteMode, I2C4ISRBase> ;
     using TXE = I2C4_ISR_TXE_Values<I2C4::ISR, 0, 1, ReadWriteMode, I2C4ISRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C4_ISR_TXE_Values<I2C4::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,12 +205,14 @@ struct I2C4
   struct TXDR : public RegisterBase<0x40008428, 32, ReadWriteMode>
   {
     using TXDATA = I2C4_TXDR_TXDATA_Values<I2C4::TXDR, 0, 8, ReadWriteMode, I2C4TXDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = I2C4_TXDR_TXDATA_Values<I2C4::TXDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TXDRPack  = Register<0x40008428, 32, ReadWriteMode, I2C4TXDRBase, T...> ;
 
+  using Registers = TypesList<I2C4::CR1, I2C4::CR2, I2C4::OAR1, I2C4::OAR2, I2C4::TIMINGR, I2C4::TIMEOUTR, I2C4::ISR, I2C4::ICR, I2C4::PECR, I2C4::RXDR, I2C4::TXDR> ;
 } ;
 
 #endif //#if !defined(I2C4REGISTERS_HPP)
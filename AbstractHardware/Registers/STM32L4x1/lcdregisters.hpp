@@ -27,6 +27,7 @@ struct LCD
     using LCDEN = LCD_CR_LCDEN_Values<LCD::CR, 0, 1, ReadWriteMode, LCDCRBase> ;
     using MUX_SEG = LCD_CR_MUX_SEG_Values<LCD::CR, 7, 1, ReadWriteMode, LCDCRBase> ;
     using BUFEN = LCD_CR_BUFEN_Values<LCD::CR, 8, 1, ReadWriteMode, LCDCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFU ;
     using FieldValues = LCD_CR_BUFEN_Values<LCD::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -47,6 +48,7 @@ struct LCD
     using UDDIE = LCD_FCR_UDDIE_Values<LCD::FCR, 3, 1, ReadWriteMode, LCDFCRBase> ;
     using SOFIE = LCD_FCR_SOFIE_Values<LCD::FCR, 1, 1, ReadWriteMode, LCDFCRBase> ;
     using HD = LCD_FCR_HD_Values<LCD::FCR, 0, 1, ReadWriteMode, LCDFCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFFBU ;
     using FieldValues = LCD_FCR_HD_Values<LCD::FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -63,6 +65,7 @@ struct LCD
     using UDR = LCD_SR_UDR_Values<LCD::SR, 2, 1, WriteMode, LCDSRBase> ;
     using SOF = LCD_SR_SOF_Values<LCD::SR, 1, 1, ReadMode, LCDSRBase> ;
     using ENS = LCD_SR_ENS_Values<LCD::SR, 0, 1, ReadMode, LCDSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = LCD_SR_ENS_Values<LCD::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -116,6 +119,7 @@ struct LCD
     using S02 = LCD_RAM_COM0_S02_Values<LCD::RAM_COM0, 2, 1, ReadWriteMode, LCDRAM_COM0Base> ;
     using S01 = LCD_RAM_COM0_S01_Values<LCD::RAM_COM0, 1, 1, ReadWriteMode, LCDRAM_COM0Base> ;
     using S00 = LCD_RAM_COM0_S00_Values<LCD::RAM_COM0, 0, 1, ReadWriteMode, LCDRAM_COM0Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFFFFFU ;
     using FieldValues = LCD_RAM_COM0_S00_Values<LCD::RAM_COM0, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +162,7 @@ struct LCD
     using S02 = LCD_RAM_COM1_S02_Values<LCD::RAM_COM1, 2, 1, ReadWriteMode, LCDRAM_COM1Base> ;
     using S01 = LCD_RAM_COM1_S01_Values<LCD::RAM_COM1, 1, 1, ReadWriteMode, LCDRAM_COM1Base> ;
     using S00 = LCD_RAM_COM1_S00_Values<LCD::RAM_COM1, 0, 1, ReadWriteMode, LCDRAM_COM1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM1_S00_Values<LCD::RAM_COM1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -200,6 +205,7 @@ struct LCD
     using S02 = LCD_RAM_COM2_S02_Values<LCD::RAM_COM2, 2, 1, ReadWriteMode, LCDRAM_COM2Base> ;
     using S01 = LCD_RAM_COM2_S01_Values<LCD::RAM_COM2, 1, 1, ReadWriteMode, LCDRAM_COM2Base> ;
     using S00 = LCD_RAM_COM2_S00_Values<LCD::RAM_COM2, 0, 1, ReadWriteMode, LCDRAM_COM2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM2_S00_Values<LCD::RAM_COM2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -242,6 +248,7 @@ struct LCD
     using S02 = LCD_RAM_COM3_S02_Values<LCD::RAM_COM3, 2, 1, ReadWriteMode, LCDRAM_COM3Base> ;
     using S01 = LCD_RAM_COM3_S01_Values<LCD::RAM_COM3, 1, 1, ReadWriteMode, LCDRAM_COM3Base> ;
     using S00 = LCD_RAM_COM3_S00_Values<LCD::RAM_COM3, 0, 1, ReadWriteMode, LCDRAM_COM3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM3_S00_Values<LCD::RAM_COM3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -284,6 +291,7 @@ struct LCD
     using S02 = LCD_RAM_COM4_S02_Values<LCD::RAM_COM4, 2, 1, ReadWriteMode, LCDRAM_COM4Base> ;
     using S01 = LCD_RAM_COM4_S01_Values<LCD::RAM_COM4, 1, 1, ReadWriteMode, LCDRAM_COM4Base> ;
     using S00 = LCD_RAM_COM4_S00_Values<LCD::RAM_COM4, 0, 1, ReadWriteMode, LCDRAM_COM4Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM4_S00_Values<LCD::RAM_COM4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -326,6 +334,7 @@ struct LCD
     using S02 = LCD_RAM_COM5_S02_Values<LCD::RAM_COM5, 2, 1, ReadWriteMode, LCDRAM_COM5Base> ;
     using S01 = LCD_RAM_COM5_S01_Values<LCD::RAM_COM5, 1, 1, ReadWriteMode, LCDRAM_COM5Base> ;
     using S00 = LCD_RAM_COM5_S00_Values<LCD::RAM_COM5, 0, 1, ReadWriteMode, LCDRAM_COM5Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM5_S00_Values<LCD::RAM_COM5, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -368,6 +377,7 @@ struct LCD
     using S02 = LCD_RAM_COM6_S02_Values<LCD::RAM_COM6, 2, 1, ReadWriteMode, LCDRAM_COM6Base> ;
     using S01 = LCD_RAM_COM6_S01_Values<LCD::RAM_COM6, 1, 1, ReadWriteMode, LCDRAM_COM6Base> ;
     using S00 = LCD_RAM_COM6_S00_Values<LCD::RAM_COM6, 0, 1, ReadWriteMode, LCDRAM_COM6Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM6_S00_Values<LCD::RAM_COM6, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -410,12 +420,14 @@ struct LCD
     using S02 = LCD_RAM_COM7_S02_Values<LCD::RAM_COM7, 2, 1, ReadWriteMode, LCDRAM_COM7Base> ;
     using S01 = LCD_RAM_COM7_S01_Values<LCD::RAM_COM7, 1, 1, ReadWriteMode, LCDRAM_COM7Base> ;
     using S00 = LCD_RAM_COM7_S00_Values<LCD::RAM_COM7, 0, 1, ReadWriteMode, LCDRAM_COM7Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = LCD_RAM_COM7_S00_Values<LCD::RAM_COM7, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using RAM_COM7Pack  = Register<0x4000244C, 32, ReadWriteMode, LCDRAM_COM7Base, T...> ;
 
+  using Registers = TypesList<LCD::CR, LCD::FCR, LCD::SR, LCD::CLR, LCD::RAM_COM0, LCD::RAM_COM1, LCD::RAM_COM2, LCD::RAM_COM3, LCD::RAM_COM4, LCD::RAM_COM5, LCD::RAM_COM6, LCD::RAM_COM7> ;
 } ;
 
 #endif //#if !defined(LCDREGISTERS_HPP)
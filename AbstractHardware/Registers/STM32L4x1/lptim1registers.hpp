@@ -62,6 +62,7 @@ struct LPTIM1
     using EXTTRIGIE = LPTIM1_IER_EXTTRIGIE_Values<LPTIM1::IER, 2, 1, ReadWriteMode, LPTIM1IERBase> ;
     using ARRMIE = LPTIM1_IER_ARRMIE_Values<LPTIM1::IER, 1, 1, ReadWriteMode, LPTIM1IERBase> ;
     using CMPMIE = LPTIM1_IER_CMPMIE_Values<LPTIM1::IER, 0, 1, ReadWriteMode, LPTIM1IERBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = LPTIM1_IER_CMPMIE_Values<LPTIM1::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +86,7 @@ struct LPTIM1
     using CKFLT = LPTIM1_CFGR_CKFLT_Values<LPTIM1::CFGR, 3, 2, ReadWriteMode, LPTIM1CFGRBase> ;
     using CKPOL = LPTIM1_CFGR_CKPOL_Values<LPTIM1::CFGR, 1, 2, ReadWriteMode, LPTIM1CFGRBase> ;
     using CKSEL = LPTIM1_CFGR_CKSEL_Values<LPTIM1::CFGR, 0, 1, ReadWriteMode, LPTIM1CFGRBase> ;
+    static constexpr Type SnapshotMask = 0x1FEEEDFU ;
     using FieldValues = LPTIM1_CFGR_CKSEL_Values<LPTIM1::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +100,7 @@ struct LPTIM1
     using CNTSTRT = LPTIM1_CR_CNTSTRT_Values<LPTIM1::CR, 2, 1, ReadWriteMode, LPTIM1CRBase> ;
     using SNGSTRT = LPTIM1_CR_SNGSTRT_Values<LPTIM1::CR, 1, 1, ReadWriteMode, LPTIM1CRBase> ;
     using ENABLE = LPTIM1_CR_ENABLE_Values<LPTIM1::CR, 0, 1, ReadWriteMode, LPTIM1CRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = LPTIM1_CR_ENABLE_Values<LPTIM1::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +112,7 @@ struct LPTIM1
   struct CMP : public RegisterBase<0x40007C14, 32, ReadWriteMode>
   {
     using CMPField = LPTIM1_CMP_CMP_Values<LPTIM1::CMP, 0, 16, ReadWriteMode, LPTIM1CMPBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = LPTIM1_CMP_CMP_Values<LPTIM1::CMP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +124,7 @@ struct LPTIM1
   struct ARR : public RegisterBase<0x40007C18, 32, ReadWriteMode>
   {
     using ARRField = LPTIM1_ARR_ARR_Values<LPTIM1::ARR, 0, 16, ReadWriteMode, LPTIM1ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = LPTIM1_ARR_ARR_Values<LPTIM1::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +142,7 @@ struct LPTIM1
   template<typename... T> 
   using CNTPack  = Register<0x40007C1C, 32, ReadMode, LPTIM1CNTBase, T...> ;
 
+  using Registers = TypesList<LPTIM1::ISR, LPTIM1::ICR, LPTIM1::IER, LPTIM1::CFGR, LPTIM1::CR, LPTIM1::CMP, LPTIM1::ARR, LPTIM1::CNT> ;
 } ;
 
 #endif //#if !defined(LPTIM1REGISTERS_HPP)
@@ -62,6 +62,7 @@ struct LPTIM2
     using EXTTRIGIE = LPTIM2_IER_EXTTRIGIE_Values<LPTIM2::IER, 2, 1, ReadWriteMode, LPTIM2IERBase> ;
     using ARRMIE = LPTIM2_IER_ARRMIE_Values<LPTIM2::IER, 1, 1, ReadWriteMode, LPTIM2IERBase> ;
     using CMPMIE = LPTIM2_IER_CMPMIE_Values<LPTIM2::IER, 0, 1, ReadWriteMode, LPTIM2IERBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = LPTIM2_IER_CMPMIE_Values<LPTIM2::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +86,7 @@ struct LPTIM2
     using CKFLT = LPTIM2_CFGR_CKFLT_Values<LPTIM2::CFGR, 3, 2, ReadWriteMode, LPTIM2CFGRBase> ;
     using CKPOL = LPTIM2_CFGR_CKPOL_Values<LPTIM2::CFGR, 1, 2, ReadWriteMode, LPTIM2CFGRBase> ;
     using CKSEL = LPTIM2_CFGR_CKSEL_Values<LPTIM2::CFGR, 0, 1, ReadWriteMode, LPTIM2CFGRBase> ;
+    static constexpr Type SnapshotMask = 0x1FEEEDFU ;
     using FieldValues = LPTIM2_CFGR_CKSEL_Values<LPTIM2::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +100,7 @@ struct LPTIM2
     using CNTSTRT = LPTIM2_CR_CNTSTRT_Values<LPTIM2::CR, 2, 1, ReadWriteMode, LPTIM2CRBase> ;
     using SNGSTRT = LPTIM2_CR_SNGSTRT_Values<LPTIM2::CR, 1, 1, ReadWriteMode, LPTIM2CRBase> ;
     using ENABLE = LPTIM2_CR_ENABLE_Values<LPTIM2::CR, 0, 1, ReadWriteMode, LPTIM2CRBase> ;
+    static constexpr Type SnapshotMask = 0x7U ;
     using FieldValues = LPTIM2_CR_ENABLE_Values<LPTIM2::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +112,7 @@ struct LPTIM2
   struct CMP : public RegisterBase<0x40009414, 32, ReadWriteMode>
   {
     using CMPField = LPTIM2_CMP_CMP_Values<LPTIM2::CMP, 0, 16, ReadWriteMode, LPTIM2CMPBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = LPTIM2_CMP_CMP_Values<LPTIM2::CMP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -120,6 +124,7 @@ struct LPTIM2
   struct ARR : public RegisterBase<0x40009418, 32, ReadWriteMode>
   {
     using ARRField = LPTIM2_ARR_ARR_Values<LPTIM2::ARR, 0, 16, ReadWriteMode, LPTIM2ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = LPTIM2_ARR_ARR_Values<LPTIM2::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +142,7 @@ struct LPTIM2
   template<typename... T> 
   using CNTPack  = Register<0x4000941C, 32, ReadMode, LPTIM2CNTBase, T...> ;
 
+  using Registers = TypesList<LPTIM2::ISR, LPTIM2::ICR, LPTIM2::IER, LPTIM2::CFGR, LPTIM2::CR, LPTIM2::CMP, LPTIM2::ARR, LPTIM2::CNT> ;
 } ;
 
 #endif //#if !defined(LPTIM2REGISTERS_HPP)
@@ -47,6 +47,8 @@ struct LPUART1
     using RE = LPUART1_CR1_RE_Values<LPUART1::CR1, 2, 1, ReadWriteMode, LPUART1CR1Base> ;
     using UESM = LPUART1_CR1_UESM_Values<LPUART1::CR1, 1, 1, ReadWriteMode, LPUART1CR1Base> ;
     using UE = LPUART1_CR1_UE_Values<LPUART1::CR1, 0, 1, ReadWriteMode, LPUART1CR1Base> ;
+    static constexpr Type SnapshotMask = 0x13FF7FFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = LPUART1_CR1_UE_Values<LPUART1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -67,6 +69,7 @@ struct LPUART1
     using STOP = LPUART1_CR2_STOP_Values<LPUART1::CR2, 12, 2, ReadWriteMode, LPUART1CR2Base> ;
     using CLKEN = LPUART1_CR2_CLKEN_Values<LPUART1::CR2, 11, 1, ReadWriteMode, LPUART1CR2Base> ;
     using ADDM7 = LPUART1_CR2_ADDM7_Values<LPUART1::CR2, 4, 1, ReadWriteMode, LPUART1CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF0FB810U ;
     using FieldValues = LPUART1_CR2_ADDM7_Values<LPUART1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +93,7 @@ struct LPUART1
     using DMAR = LPUART1_CR3_DMAR_Values<LPUART1::CR3, 6, 1, ReadWriteMode, LPUART1CR3Base> ;
     using HDSEL = LPUART1_CR3_HDSEL_Values<LPUART1::CR3, 3, 1, ReadWriteMode, LPUART1CR3Base> ;
     using EIE = LPUART1_CR3_EIE_Values<LPUART1::CR3, 0, 1, ReadWriteMode, LPUART1CR3Base> ;
+    static constexpr Type SnapshotMask = 0x70F7C9U ;
     using FieldValues = LPUART1_CR3_EIE_Values<LPUART1::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +105,7 @@ struct LPUART1
   struct BRR : public RegisterBase<0x4000800C, 32, ReadWriteMode>
   {
     using BRRField = LPUART1_BRR_BRR_Values<LPUART1::BRR, 0, 20, ReadWriteMode, LPUART1BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = LPUART1_BRR_BRR_Values<LPUART1::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -160,6 +165,8 @@ struct LPUART1
     using NCF = LPUART1_ICR_NCF_Values<LPUART1::ICR, 2, 1, WriteMode, LPUART1ICRBase> ;
     using FECF = LPUART1_ICR_FECF_Values<LPUART1::ICR, 1, 1, WriteMode, LPUART1ICRBase> ;
     using PECF = LPUART1_ICR_PECF_Values<LPUART1::ICR, 0, 1, WriteMode, LPUART1ICRBase> ;
+    static constexpr Type WritableMask = 0x12025FU ;
+    static constexpr Type OneToClearMask = 0x12025FU ;
     using FieldValues = LPUART1_ICR_PECF_Values<LPUART1::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -182,12 +189,14 @@ struct LPUART1
   struct TDR : public RegisterBase<0x40008028, 32, ReadWriteMode>
   {
     using TDRField = LPUART1_TDR_TDR_Values<LPUART1::TDR, 0, 9, ReadWriteMode, LPUART1TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = LPUART1_TDR_TDR_Values<LPUART1::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40008028, 32, ReadWriteMode, LPUART1TDRBase, T...> ;
 
+  using Registers = TypesList<LPUART1::CR1, LPUART1::CR2, LPUART1::CR3, LPUART1::BRR, LPUART1::RQR, LPUART1::ISR, LPUART1::ICR, LPUART1::RDR, LPUART1::TDR> ;
 } ;
 
 #endif //#if !defined(LPUART1REGISTERS_HPP)
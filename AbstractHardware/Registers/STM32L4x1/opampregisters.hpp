@@ -32,6 +32,7 @@ struct OPAMP
     using USERTRIM = OPAMP_OPAMP1_CSR_USERTRIM_Values<OPAMP::OPAMP1_CSR, 14, 1, ReadWriteMode, OPAMPOPAMP1_CSRBase> ;
     using CALOUT = OPAMP_OPAMP1_CSR_CALOUT_Values<OPAMP::OPAMP1_CSR, 15, 1, ReadWriteMode, OPAMPOPAMP1_CSRBase> ;
     using OPA_RANGE = OPAMP_OPAMP1_CSR_OPA_RANGE_Values<OPAMP::OPAMP1_CSR, 31, 1, ReadWriteMode, OPAMPOPAMP1_CSRBase> ;
+    static constexpr Type SnapshotMask = 0x8000F73FU ;
     using FieldValues = OPAMP_OPAMP1_CSR_OPA_RANGE_Values<OPAMP::OPAMP1_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct OPAMP
   {
     using TRIMOFFSETN = OPAMP_OPAMP1_OTR_TRIMOFFSETN_Values<OPAMP::OPAMP1_OTR, 0, 5, ReadWriteMode, OPAMPOPAMP1_OTRBase> ;
     using TRIMOFFSETP = OPAMP_OPAMP1_OTR_TRIMOFFSETP_Values<OPAMP::OPAMP1_OTR, 8, 5, ReadWriteMode, OPAMPOPAMP1_OTRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = OPAMP_OPAMP1_OTR_TRIMOFFSETP_Values<OPAMP::OPAMP1_OTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -56,6 +58,7 @@ struct OPAMP
   {
     using TRIMLPOFFSETN = OPAMP_OPAMP1_LPOTR_TRIMLPOFFSETN_Values<OPAMP::OPAMP1_LPOTR, 0, 5, ReadWriteMode, OPAMPOPAMP1_LPOTRBase> ;
     using TRIMLPOFFSETP = OPAMP_OPAMP1_LPOTR_TRIMLPOFFSETP_Values<OPAMP::OPAMP1_LPOTR, 8, 5, ReadWriteMode, OPAMPOPAMP1_LPOTRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = OPAMP_OPAMP1_LPOTR_TRIMLPOFFSETP_Values<OPAMP::OPAMP1_LPOTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +79,7 @@ struct OPAMP
     using CALSEL = OPAMP_OPAMP2_CSR_CALSEL_Values<OPAMP::OPAMP2_CSR, 13, 1, ReadWriteMode, OPAMPOPAMP2_CSRBase> ;
     using USERTRIM = OPAMP_OPAMP2_CSR_USERTRIM_Values<OPAMP::OPAMP2_CSR, 14, 1, ReadWriteMode, OPAMPOPAMP2_CSRBase> ;
     using CALOUT = OPAMP_OPAMP2_CSR_CALOUT_Values<OPAMP::OPAMP2_CSR, 15, 1, ReadWriteMode, OPAMPOPAMP2_CSRBase> ;
+    static constexpr Type SnapshotMask = 0xF73FU ;
     using FieldValues = OPAMP_OPAMP2_CSR_CALOUT_Values<OPAMP::OPAMP2_CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -88,6 +92,7 @@ struct OPAMP
   {
     using TRIMOFFSETN = OPAMP_OPAMP2_OTR_TRIMOFFSETN_Values<OPAMP::OPAMP2_OTR, 0, 5, ReadWriteMode, OPAMPOPAMP2_OTRBase> ;
     using TRIMOFFSETP = OPAMP_OPAMP2_OTR_TRIMOFFSETP_Values<OPAMP::OPAMP2_OTR, 8, 5, ReadWriteMode, OPAMPOPAMP2_OTRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = OPAMP_OPAMP2_OTR_TRIMOFFSETP_Values<OPAMP::OPAMP2_OTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,12 +105,14 @@ struct OPAMP
   {
     using TRIMLPOFFSETN = OPAMP_OPAMP2_LPOTR_TRIMLPOFFSETN_Values<OPAMP::OPAMP2_LPOTR, 0, 5, ReadWriteMode, OPAMPOPAMP2_LPOTRBase> ;
     using TRIMLPOFFSETP = OPAMP_OPAMP2_LPOTR_TRIMLPOFFSETP_Values<OPAMP::OPAMP2_LPOTR, 8, 5, ReadWriteMode, OPAMPOPAMP2_LPOTRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = OPAMP_OPAMP2_LPOTR_TRIMLPOFFSETP_Values<OPAMP::OPAMP2_LPOTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using OPAMP2_LPOTRPack  = Register<0x40007818, 32, ReadWriteMode, OPAMPOPAMP2_LPOTRBase, T...> ;
 
+  using Registers = TypesList<OPAMP::OPAMP1_CSR, OPAMP::OPAMP1_OTR, OPAMP::OPAMP1_LPOTR, OPAMP::OPAMP2_CSR, OPAMP::OPAMP2_OTR, OPAMP::OPAMP2_LPOTR> ;
 } ;
 
 #endif //#if !defined(OPAMPREGISTERS_HPP)
@@ -25,6 +25,7 @@ struct PWR
     using VOS = PWR_CR1_VOS_Values<PWR::CR1, 9, 2, ReadWriteMode, PWRCR1Base> ;
     using DBP = PWR_CR1_DBP_Values<PWR::CR1, 8, 1, ReadWriteMode, PWRCR1Base> ;
     using LPMS = PWR_CR1_LPMS_Values<PWR::CR1, 0, 3, ReadWriteMode, PWRCR1Base> ;
+    static constexpr Type SnapshotMask = 0x4707U ;
     using FieldValues = PWR_CR1_LPMS_Values<PWR::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +44,7 @@ struct PWR
     using PVME1 = PWR_CR2_PVME1_Values<PWR::CR2, 4, 1, ReadWriteMode, PWRCR2Base> ;
     using PLS = PWR_CR2_PLS_Values<PWR::CR2, 1, 3, ReadWriteMode, PWRCR2Base> ;
     using PVDE = PWR_CR2_PVDE_Values<PWR::CR2, 0, 1, ReadWriteMode, PWRCR2Base> ;
+    static constexpr Type SnapshotMask = 0x6FFU ;
     using FieldValues = PWR_CR2_PVDE_Values<PWR::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -61,6 +63,7 @@ struct PWR
     using EWUP3 = PWR_CR3_EWUP3_Values<PWR::CR3, 2, 1, ReadWriteMode, PWRCR3Base> ;
     using EWUP2 = PWR_CR3_EWUP2_Values<PWR::CR3, 1, 1, ReadWriteMode, PWRCR3Base> ;
     using EWUP1 = PWR_CR3_EWUP1_Values<PWR::CR3, 0, 1, ReadWriteMode, PWRCR3Base> ;
+    static constexpr Type SnapshotMask = 0x851FU ;
     using FieldValues = PWR_CR3_EWUP1_Values<PWR::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +81,7 @@ struct PWR
     using WP3 = PWR_CR4_WP3_Values<PWR::CR4, 2, 1, ReadWriteMode, PWRCR4Base> ;
     using WP2 = PWR_CR4_WP2_Values<PWR::CR4, 1, 1, ReadWriteMode, PWRCR4Base> ;
     using WP1 = PWR_CR4_WP1_Values<PWR::CR4, 0, 1, ReadWriteMode, PWRCR4Base> ;
+    static constexpr Type SnapshotMask = 0x31FU ;
     using FieldValues = PWR_CR4_WP1_Values<PWR::CR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -155,6 +159,7 @@ struct PWR
     using PU2 = PWR_PUCRA_PU2_Values<PWR::PUCRA, 2, 1, ReadWriteMode, PWRPUCRABase> ;
     using PU1 = PWR_PUCRA_PU1_Values<PWR::PUCRA, 1, 1, ReadWriteMode, PWRPUCRABase> ;
     using PU0 = PWR_PUCRA_PU0_Values<PWR::PUCRA, 0, 1, ReadWriteMode, PWRPUCRABase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRA_PU0_Values<PWR::PUCRA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -181,6 +186,7 @@ struct PWR
     using PD2 = PWR_PDCRA_PD2_Values<PWR::PDCRA, 2, 1, ReadWriteMode, PWRPDCRABase> ;
     using PD1 = PWR_PDCRA_PD1_Values<PWR::PDCRA, 1, 1, ReadWriteMode, PWRPDCRABase> ;
     using PD0 = PWR_PDCRA_PD0_Values<PWR::PDCRA, 0, 1, ReadWriteMode, PWRPDCRABase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRA_PD0_Values<PWR::PDCRA, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -207,6 +213,7 @@ struct PWR
     using PU2 = PWR_PUCRB_PU2_Values<PWR::PUCRB, 2, 1, ReadWriteMode, PWRPUCRBBase> ;
     using PU1 = PWR_PUCRB_PU1_Values<PWR::PUCRB, 1, 1, ReadWriteMode, PWRPUCRBBase> ;
     using PU0 = PWR_PUCRB_PU0_Values<PWR::PUCRB, 0, 1, ReadWriteMode, PWRPUCRBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRB_PU0_Values<PWR::PUCRB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +240,7 @@ struct PWR
     using PD2 = PWR_PDCRB_PD2_Values<PWR::PDCRB, 2, 1, ReadWriteMode, PWRPDCRBBase> ;
     using PD1 = PWR_PDCRB_PD1_Values<PWR::PDCRB, 1, 1, ReadWriteMode, PWRPDCRBBase> ;
     using PD0 = PWR_PDCRB_PD0_Values<PWR::PDCRB, 0, 1, ReadWriteMode, PWRPDCRBBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRB_PD0_Values<PWR::PDCRB, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -259,6 +267,7 @@ struct PWR
     using PU2 = PWR_PUCRC_PU2_Values<PWR::PUCRC, 2, 1, ReadWriteMode, PWRPUCRCBase> ;
     using PU1 = PWR_PUCRC_PU1_Values<PWR::PUCRC, 1, 1, ReadWriteMode, PWRPUCRCBase> ;
     using PU0 = PWR_PUCRC_PU0_Values<PWR::PUCRC, 0, 1, ReadWriteMode, PWRPUCRCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRC_PU0_Values<PWR::PUCRC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -285,6 +294,7 @@ struct PWR
     using PD2 = PWR_PDCRC_PD2_Values<PWR::PDCRC, 2, 1, ReadWriteMode, PWRPDCRCBase> ;
     using PD1 = PWR_PDCRC_PD1_Values<PWR::PDCRC, 1, 1, ReadWriteMode, PWRPDCRCBase> ;
     using PD0 = PWR_PDCRC_PD0_Values<PWR::PDCRC, 0, 1, ReadWriteMode, PWRPDCRCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRC_PD0_Values<PWR::PDCRC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -311,6 +321,7 @@ struct PWR
     using PU2 = PWR_PUCRD_PU2_Values<PWR::PUCRD, 2, 1, ReadWriteMode, PWRPUCRDBase> ;
     using PU1 = PWR_PUCRD_PU1_Values<PWR::PUCRD, 1, 1, ReadWriteMode, PWRPUCRDBase> ;
     using PU0 = PWR_PUCRD_PU0_Values<PWR::PUCRD, 0, 1, ReadWriteMode, PWRPUCRDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRD_PU0_Values<PWR::PUCRD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -337,6 +348,7 @@ struct PWR
     using PD2 = PWR_PDCRD_PD2_Values<PWR::PDCRD, 2, 1, ReadWriteMode, PWRPDCRDBase> ;
     using PD1 = PWR_PDCRD_PD1_Values<PWR::PDCRD, 1, 1, ReadWriteMode, PWRPDCRDBase> ;
     using PD0 = PWR_PDCRD_PD0_Values<PWR::PDCRD, 0, 1, ReadWriteMode, PWRPDCRDBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRD_PD0_Values<PWR::PDCRD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -363,6 +375,7 @@ struct PWR
     using PU2 = PWR_PUCRE_PU2_Values<PWR::PUCRE, 2, 1, ReadWriteMode, PWRPUCREBase> ;
     using PU1 = PWR_PUCRE_PU1_Values<PWR::PUCRE, 1, 1, ReadWriteMode, PWRPUCREBase> ;
     using PU0 = PWR_PUCRE_PU0_Values<PWR::PUCRE, 0, 1, ReadWriteMode, PWRPUCREBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRE_PU0_Values<PWR::PUCRE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -389,6 +402,7 @@ struct PWR
     using PD2 = PWR_PDCRE_PD2_Values<PWR::PDCRE, 2, 1, ReadWriteMode, PWRPDCREBase> ;
     using PD1 = PWR_PDCRE_PD1_Values<PWR::PDCRE, 1, 1, ReadWriteMode, PWRPDCREBase> ;
     using PD0 = PWR_PDCRE_PD0_Values<PWR::PDCRE, 0, 1, ReadWriteMode, PWRPDCREBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRE_PD0_Values<PWR::PDCRE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -415,6 +429,7 @@ struct PWR
     using PU2 = PWR_PUCRF_PU2_Values<PWR::PUCRF, 2, 1, ReadWriteMode, PWRPUCRFBase> ;
     using PU1 = PWR_PUCRF_PU1_Values<PWR::PUCRF, 1, 1, ReadWriteMode, PWRPUCRFBase> ;
     using PU0 = PWR_PUCRF_PU0_Values<PWR::PUCRF, 0, 1, ReadWriteMode, PWRPUCRFBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRF_PU0_Values<PWR::PUCRF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -441,6 +456,7 @@ struct PWR
     using PD2 = PWR_PDCRF_PD2_Values<PWR::PDCRF, 2, 1, ReadWriteMode, PWRPDCRFBase> ;
     using PD1 = PWR_PDCRF_PD1_Values<PWR::PDCRF, 1, 1, ReadWriteMode, PWRPDCRFBase> ;
     using PD0 = PWR_PDCRF_PD0_Values<PWR::PDCRF, 0, 1, ReadWriteMode, PWRPDCRFBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRF_PD0_Values<PWR::PDCRF, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -467,6 +483,7 @@ struct PWR
     using PU2 = PWR_PUCRG_PU2_Values<PWR::PUCRG, 2, 1, ReadWriteMode, PWRPUCRGBase> ;
     using PU1 = PWR_PUCRG_PU1_Values<PWR::PUCRG, 1, 1, ReadWriteMode, PWRPUCRGBase> ;
     using PU0 = PWR_PUCRG_PU0_Values<PWR::PUCRG, 0, 1, ReadWriteMode, PWRPUCRGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PUCRG_PU0_Values<PWR::PUCRG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -493,6 +510,7 @@ struct PWR
     using PD2 = PWR_PDCRG_PD2_Values<PWR::PDCRG, 2, 1, ReadWriteMode, PWRPDCRGBase> ;
     using PD1 = PWR_PDCRG_PD1_Values<PWR::PDCRG, 1, 1, ReadWriteMode, PWRPDCRGBase> ;
     using PD0 = PWR_PDCRG_PD0_Values<PWR::PDCRG, 0, 1, ReadWriteMode, PWRPDCRGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = PWR_PDCRG_PD0_Values<PWR::PDCRG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -505,6 +523,7 @@ struct PWR
   {
     using PU1 = PWR_PUCRH_PU1_Values<PWR::PUCRH, 1, 1, ReadWriteMode, PWRPUCRHBase> ;
     using PU0 = PWR_PUCRH_PU0_Values<PWR::PUCRH, 0, 1, ReadWriteMode, PWRPUCRHBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = PWR_PUCRH_PU0_Values<PWR::PUCRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -517,12 +536,14 @@ struct PWR
   {
     using PD1 = PWR_PDCRH_PD1_Values<PWR::PDCRH, 1, 1, ReadWriteMode, PWRPDCRHBase> ;
     using PD0 = PWR_PDCRH_PD0_Values<PWR::PDCRH, 0, 1, ReadWriteMode, PWRPDCRHBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = PWR_PDCRH_PD0_Values<PWR::PDCRH, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using PDCRHPack  = Register<0x4000705C, 32, ReadWriteMode, PWRPDCRHBase, T...> ;
 
+  using Registers = TypesList<PWR::CR1, PWR::CR2, PWR::CR3, PWR::CR4, PWR::SR1, PWR::SR2, PWR::SCR, PWR::PUCRA, PWR::PDCRA, PWR::PUCRB, PWR::PDCRB, PWR::PUCRC, PWR::PDCRC, PWR::PUCRD, PWR::PDCRD, PWR::PUCRE, PWR::PDCRE, PWR::PUCRF, PWR::PDCRF, PWR::PUCRG, PWR::PDCRG, PWR::PUCRH, PWR::PDCRH> ;
 } ;
 
 #endif //#if !defined(PWRREGISTERS_HPP)
@@ -37,6 +37,7 @@ struct QUADSPI
     using DMAEN = QUADSPI_CR_DMAEN_Values<QUADSPI::CR, 2, 1, ReadWriteMode, QUADSPICRBase> ;
     using ABORT = QUADSPI_CR_ABORT_Values<QUADSPI::CR, 1, 1, ReadWriteMode, QUADSPICRBase> ;
     using EN = QUADSPI_CR_EN_Values<QUADSPI::CR, 0, 1, ReadWriteMode, QUADSPICRBase> ;
+    static constexpr Type SnapshotMask = 0xFFDF1FDFU ;
     using FieldValues = QUADSPI_CR_EN_Values<QUADSPI::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +51,7 @@ struct QUADSPI
     using FSIZE = QUADSPI_DCR_FSIZE_Values<QUADSPI::DCR, 16, 5, ReadWriteMode, QUADSPIDCRBase> ;
     using CSHT = QUADSPI_DCR_CSHT_Values<QUADSPI::DCR, 8, 3, ReadWriteMode, QUADSPIDCRBase> ;
     using CKMODE = QUADSPI_DCR_CKMODE_Values<QUADSPI::DCR, 0, 1, ReadWriteMode, QUADSPIDCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F0701U ;
     using FieldValues = QUADSPI_DCR_CKMODE_Values<QUADSPI::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -81,6 +83,7 @@ struct QUADSPI
     using CSMF = QUADSPI_FCR_CSMF_Values<QUADSPI::FCR, 3, 1, ReadWriteMode, QUADSPIFCRBase> ;
     using CTCF = QUADSPI_FCR_CTCF_Values<QUADSPI::FCR, 1, 1, ReadWriteMode, QUADSPIFCRBase> ;
     using CTEF = QUADSPI_FCR_CTEF_Values<QUADSPI::FCR, 0, 1, ReadWriteMode, QUADSPIFCRBase> ;
+    static constexpr Type SnapshotMask = 0x1BU ;
     using FieldValues = QUADSPI_FCR_CTEF_Values<QUADSPI::FCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -92,6 +95,7 @@ struct QUADSPI
   struct DLR : public RegisterBase<0xA0001010, 32, ReadWriteMode>
   {
     using DL = QUADSPI_DLR_DL_Values<QUADSPI::DLR, 0, 32, ReadWriteMode, QUADSPIDLRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = QUADSPI_DLR_DL_Values<QUADSPI::DLR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +118,7 @@ struct QUADSPI
     using ADMODE = QUADSPI_CCR_ADMODE_Values<QUADSPI::CCR, 10, 2, ReadWriteMode, QUADSPICCRBase> ;
     using IMODE = QUADSPI_CCR_IMODE_Values<QUADSPI::CCR, 8, 2, ReadWriteMode, QUADSPICCRBase> ;
     using INSTRUCTION = QUADSPI_CCR_INSTRUCTION_Values<QUADSPI::CCR, 0, 8, ReadWriteMode, QUADSPICCRBase> ;
+    static constexpr Type SnapshotMask = 0xDF7FFFFFU ;
     using FieldValues = QUADSPI_CCR_INSTRUCTION_Values<QUADSPI::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +130,7 @@ struct QUADSPI
   struct AR : public RegisterBase<0xA0001018, 32, ReadWriteMode>
   {
     using ADDRESS = QUADSPI_AR_ADDRESS_Values<QUADSPI::AR, 0, 32, ReadWriteMode, QUADSPIARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = QUADSPI_AR_ADDRESS_Values<QUADSPI::AR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -136,6 +142,7 @@ struct QUADSPI
   struct ABR : public RegisterBase<0xA000101C, 32, ReadWriteMode>
   {
     using ALTERNATE = QUADSPI_ABR_ALTERNATE_Values<QUADSPI::ABR, 0, 32, ReadWriteMode, QUADSPIABRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = QUADSPI_ABR_ALTERNATE_Values<QUADSPI::ABR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,6 +154,7 @@ struct QUADSPI
   struct DR : public RegisterBase<0xA0001020, 32, ReadWriteMode>
   {
     using DATA = QUADSPI_DR_DATA_Values<QUADSPI::DR, 0, 32, ReadWriteMode, QUADSPIDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = QUADSPI_DR_DATA_Values<QUADSPI::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +166,7 @@ struct QUADSPI
   struct PSMKR : public RegisterBase<0xA0001024, 32, ReadWriteMode>
   {
     using MASK = QUADSPI_PSMKR_MASK_Values<QUADSPI::PSMKR, 0, 32, ReadWriteMode, QUADSPIPSMKRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = QUADSPI_PSMKR_MASK_Values<QUADSPI::PSMKR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +178,7 @@ struct QUADSPI
   struct PSMAR : public RegisterBase<0xA0001028, 32, ReadWriteMode>
   {
     using MATCH = QUADSPI_PSMAR_MATCH_Values<QUADSPI::PSMAR, 0, 32, ReadWriteMode, QUADSPIPSMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = QUADSPI_PSMAR_MATCH_Values<QUADSPI::PSMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +190,7 @@ struct QUADSPI
   struct PIR : public RegisterBase<0xA000102C, 32, ReadWriteMode>
   {
     using INTERVAL = QUADSPI_PIR_INTERVAL_Values<QUADSPI::PIR, 0, 16, ReadWriteMode, QUADSPIPIRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = QUADSPI_PIR_INTERVAL_Values<QUADSPI::PIR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,12 +202,14 @@ struct QUADSPI
   struct LPTR : public RegisterBase<0xA0001030, 32, ReadWriteMode>
   {
     using TIMEOUT = QUADSPI_LPTR_TIMEOUT_Values<QUADSPI::LPTR, 0, 16, ReadWriteMode, QUADSPILPTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = QUADSPI_LPTR_TIMEOUT_Values<QUADSPI::LPTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using LPTRPack  = Register<0xA0001030, 32, ReadWriteMode, QUADSPILPTRBase, T...> ;
 
+  using Registers = TypesList<QUADSPI::CR, QUADSPI::DCR, QUADSPI::SR, QUADSPI::FCR, QUADSPI::DLR, QUADSPI::CCR, QUADSPI::AR, QUADSPI::ABR, QUADSPI::DR, QUADSPI::PSMKR, QUADSPI::PSMAR, QUADSPI::PIR, QUADSPI::LPTR> ;
 } ;
 
 #endif //#if !defined(QUADSPIREGISTERS_HPP)
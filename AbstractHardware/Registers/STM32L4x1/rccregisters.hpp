@@ -38,6 +38,7 @@ struct RCC
     using MSIPLLEN = RCC_CR_MSIPLLEN_Values<RCC::CR, 2, 1, ReadWriteMode, RCCCRBase> ;
     using MSIRDY = RCC_CR_MSIRDY_Values<RCC::CR, 1, 1, ReadMode, RCCCRBase> ;
     using MSION = RCC_CR_MSION_Values<RCC::CR, 0, 1, ReadWriteMode, RCCCRBase> ;
+    static constexpr Type SnapshotMask = 0x50D0BFDU ;
     using FieldValues = RCC_CR_MSION_Values<RCC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -52,6 +53,7 @@ struct RCC
     using HSICAL = RCC_ICSCR_HSICAL_Values<RCC::ICSCR, 16, 8, ReadMode, RCCICSCRBase> ;
     using MSITRIM = RCC_ICSCR_MSITRIM_Values<RCC::ICSCR, 8, 8, ReadWriteMode, RCCICSCRBase> ;
     using MSICAL = RCC_ICSCR_MSICAL_Values<RCC::ICSCR, 0, 8, ReadMode, RCCICSCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F00FF00U ;
     using FieldValues = RCC_ICSCR_MSICAL_Values<RCC::ICSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -70,6 +72,7 @@ struct RCC
     using HPRE = RCC_CFGR_HPRE_Values<RCC::CFGR, 4, 4, ReadWriteMode, RCCCFGRBase> ;
     using SWS = RCC_CFGR_SWS_Values<RCC::CFGR, 2, 2, ReadMode, RCCCFGRBase> ;
     using SW = RCC_CFGR_SW_Values<RCC::CFGR, 0, 2, ReadWriteMode, RCCCFGRBase> ;
+    static constexpr Type SnapshotMask = 0x700BFF3U ;
     using FieldValues = RCC_CFGR_SW_Values<RCC::CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -90,6 +93,7 @@ struct RCC
     using PLLM = RCC_PLLCFGR_PLLM_Values<RCC::PLLCFGR, 4, 3, ReadWriteMode, RCCPLLCFGRBase> ;
     using PLLSRC = RCC_PLLCFGR_PLLSRC_Values<RCC::PLLCFGR, 0, 2, ReadWriteMode, RCCPLLCFGRBase> ;
     using PLLPDIV = RCC_PLLCFGR_PLLPDIV_Values<RCC::PLLCFGR, 27, 5, ReadWriteMode, RCCPLLCFGRBase> ;
+    static constexpr Type SnapshotMask = 0xFF737F73U ;
     using FieldValues = RCC_PLLCFGR_PLLPDIV_Values<RCC::PLLCFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +112,7 @@ struct RCC
     using PLLSAI1PEN = RCC_PLLSAI1CFGR_PLLSAI1PEN_Values<RCC::PLLSAI1CFGR, 16, 1, ReadWriteMode, RCCPLLSAI1CFGRBase> ;
     using PLLSAI1N = RCC_PLLSAI1CFGR_PLLSAI1N_Values<RCC::PLLSAI1CFGR, 8, 7, ReadWriteMode, RCCPLLSAI1CFGRBase> ;
     using PLLSAI1PDIV = RCC_PLLSAI1CFGR_PLLSAI1PDIV_Values<RCC::PLLSAI1CFGR, 27, 5, ReadWriteMode, RCCPLLSAI1CFGRBase> ;
+    static constexpr Type SnapshotMask = 0xFF737F00U ;
     using FieldValues = RCC_PLLSAI1CFGR_PLLSAI1PDIV_Values<RCC::PLLSAI1CFGR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +132,7 @@ struct RCC
     using LSERDYIE = RCC_CIER_LSERDYIE_Values<RCC::CIER, 1, 1, ReadWriteMode, RCCCIERBase> ;
     using LSIRDYIE = RCC_CIER_LSIRDYIE_Values<RCC::CIER, 0, 1, ReadWriteMode, RCCCIERBase> ;
     using HSI48RDYIE = RCC_CIER_HSI48RDYIE_Values<RCC::CIER, 10, 1, ReadWriteMode, RCCCIERBase> ;
+    static constexpr Type SnapshotMask = 0x67FU ;
     using FieldValues = RCC_CIER_HSI48RDYIE_Values<RCC::CIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -182,6 +188,7 @@ struct RCC
     using FLASHRST = RCC_AHB1RSTR_FLASHRST_Values<RCC::AHB1RSTR, 8, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
     using DMA2RST = RCC_AHB1RSTR_DMA2RST_Values<RCC::AHB1RSTR, 1, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
     using DMA1RST = RCC_AHB1RSTR_DMA1RST_Values<RCC::AHB1RSTR, 0, 1, ReadWriteMode, RCCAHB1RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x10903U ;
     using FieldValues = RCC_AHB1RSTR_DMA1RST_Values<RCC::AHB1RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -201,6 +208,7 @@ struct RCC
     using GPIOCRST = RCC_AHB2RSTR_GPIOCRST_Values<RCC::AHB2RSTR, 2, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
     using GPIOBRST = RCC_AHB2RSTR_GPIOBRST_Values<RCC::AHB2RSTR, 1, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
     using GPIOARST = RCC_AHB2RSTR_GPIOARST_Values<RCC::AHB2RSTR, 0, 1, ReadWriteMode, RCCAHB2RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x5209FU ;
     using FieldValues = RCC_AHB2RSTR_GPIOARST_Values<RCC::AHB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -212,6 +220,7 @@ struct RCC
   struct AHB3RSTR : public RegisterBase<0x40021030, 32, ReadWriteMode>
   {
     using QSPIRST = RCC_AHB3RSTR_QSPIRST_Values<RCC::AHB3RSTR, 8, 1, ReadWriteMode, RCCAHB3RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x100U ;
     using FieldValues = RCC_AHB3RSTR_QSPIRST_Values<RCC::AHB3RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -241,6 +250,7 @@ struct RCC
     using I2C2RST = RCC_APB1RSTR1_I2C2RST_Values<RCC::APB1RSTR1, 22, 1, ReadWriteMode, RCCAPB1RSTR1Base> ;
     using CRSRST = RCC_APB1RSTR1_CRSRST_Values<RCC::APB1RSTR1, 24, 1, ReadWriteMode, RCCAPB1RSTR1Base> ;
     using USBFSRST = RCC_APB1RSTR1_USBFSRST_Values<RCC::APB1RSTR1, 26, 1, ReadWriteMode, RCCAPB1RSTR1Base> ;
+    static constexpr Type SnapshotMask = 0xF7EEC231U ;
     using FieldValues = RCC_APB1RSTR1_USBFSRST_Values<RCC::APB1RSTR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +265,7 @@ struct RCC
     using SWPMI1RST = RCC_APB1RSTR2_SWPMI1RST_Values<RCC::APB1RSTR2, 2, 1, ReadWriteMode, RCCAPB1RSTR2Base> ;
     using LPUART1RST = RCC_APB1RSTR2_LPUART1RST_Values<RCC::APB1RSTR2, 0, 1, ReadWriteMode, RCCAPB1RSTR2Base> ;
     using I2C4RST = RCC_APB1RSTR2_I2C4RST_Values<RCC::APB1RSTR2, 1, 1, ReadWriteMode, RCCAPB1RSTR2Base> ;
+    static constexpr Type SnapshotMask = 0x27U ;
     using FieldValues = RCC_APB1RSTR2_I2C4RST_Values<RCC::APB1RSTR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -274,6 +285,7 @@ struct RCC
     using SDMMCRST = RCC_APB2RSTR_SDMMCRST_Values<RCC::APB2RSTR, 10, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using SYSCFGRST = RCC_APB2RSTR_SYSCFGRST_Values<RCC::APB2RSTR, 0, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
     using DFSDMRST = RCC_APB2RSTR_DFSDMRST_Values<RCC::APB2RSTR, 24, 1, ReadWriteMode, RCCAPB2RSTRBase> ;
+    static constexpr Type SnapshotMask = 0x1235C01U ;
     using FieldValues = RCC_APB2RSTR_DFSDMRST_Values<RCC::APB2RSTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,6 +301,7 @@ struct RCC
     using FLASHEN = RCC_AHB1ENR_FLASHEN_Values<RCC::AHB1ENR, 8, 1, ReadWriteMode, RCCAHB1ENRBase> ;
     using DMA2EN = RCC_AHB1ENR_DMA2EN_Values<RCC::AHB1ENR, 1, 1, ReadWriteMode, RCCAHB1ENRBase> ;
     using DMA1EN = RCC_AHB1ENR_DMA1EN_Values<RCC::AHB1ENR, 0, 1, ReadWriteMode, RCCAHB1ENRBase> ;
+    static constexpr Type SnapshotMask = 0x11103U ;
     using FieldValues = RCC_AHB1ENR_DMA1EN_Values<RCC::AHB1ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -308,6 +321,7 @@ struct RCC
     using GPIOCEN = RCC_AHB2ENR_GPIOCEN_Values<RCC::AHB2ENR, 2, 1, ReadWriteMode, RCCAHB2ENRBase> ;
     using GPIOBEN = RCC_AHB2ENR_GPIOBEN_Values<RCC::AHB2ENR, 1, 1, ReadWriteMode, RCCAHB2ENRBase> ;
     using GPIOAEN = RCC_AHB2ENR_GPIOAEN_Values<RCC::AHB2ENR, 0, 1, ReadWriteMode, RCCAHB2ENRBase> ;
+    static constexpr Type SnapshotMask = 0x5209FU ;
     using FieldValues = RCC_AHB2ENR_GPIOAEN_Values<RCC::AHB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -319,6 +333,7 @@ struct RCC
   struct AHB3ENR : public RegisterBase<0x40021050, 32, ReadWriteMode>
   {
     using QSPIEN = RCC_AHB3ENR_QSPIEN_Values<RCC::AHB3ENR, 8, 1, ReadWriteMode, RCCAHB3ENRBase> ;
+    static constexpr Type SnapshotMask = 0x100U ;
     using FieldValues = RCC_AHB3ENR_QSPIEN_Values<RCC::AHB3ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -351,6 +366,7 @@ struct RCC
     using TIM3EN = RCC_APB1ENR1_TIM3EN_Values<RCC::APB1ENR1, 1, 1, ReadWriteMode, RCCAPB1ENR1Base> ;
     using UART4EN = RCC_APB1ENR1_UART4EN_Values<RCC::APB1ENR1, 19, 1, ReadWriteMode, RCCAPB1ENR1Base> ;
     using I2C2EN = RCC_APB1ENR1_I2C2EN_Values<RCC::APB1ENR1, 22, 1, ReadWriteMode, RCCAPB1ENR1Base> ;
+    static constexpr Type SnapshotMask = 0xF7EECE33U ;
     using FieldValues = RCC_APB1ENR1_I2C2EN_Values<RCC::APB1ENR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -366,6 +382,7 @@ struct RCC
     using LPUART1EN = RCC_APB1ENR2_LPUART1EN_Values<RCC::APB1ENR2, 0, 1, ReadWriteMode, RCCAPB1ENR2Base> ;
     using DFSDMEN = RCC_APB1ENR2_DFSDMEN_Values<RCC::APB1ENR2, 24, 1, ReadWriteMode, RCCAPB1ENR2Base> ;
     using I2C4EN = RCC_APB1ENR2_I2C4EN_Values<RCC::APB1ENR2, 1, 1, ReadWriteMode, RCCAPB1ENR2Base> ;
+    static constexpr Type SnapshotMask = 0x1000027U ;
     using FieldValues = RCC_APB1ENR2_I2C4EN_Values<RCC::APB1ENR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -385,6 +402,7 @@ struct RCC
     using SDMMCEN = RCC_APB2ENR_SDMMCEN_Values<RCC::APB2ENR, 10, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using FIREWALLEN = RCC_APB2ENR_FIREWALLEN_Values<RCC::APB2ENR, 7, 1, ReadWriteMode, RCCAPB2ENRBase> ;
     using SYSCFGEN = RCC_APB2ENR_SYSCFGEN_Values<RCC::APB2ENR, 0, 1, ReadWriteMode, RCCAPB2ENRBase> ;
+    static constexpr Type SnapshotMask = 0x235C81U ;
     using FieldValues = RCC_APB2ENR_SYSCFGEN_Values<RCC::APB2ENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -401,6 +419,7 @@ struct RCC
     using FLASHSMEN = RCC_AHB1SMENR_FLASHSMEN_Values<RCC::AHB1SMENR, 8, 1, ReadWriteMode, RCCAHB1SMENRBase> ;
     using DMA2SMEN = RCC_AHB1SMENR_DMA2SMEN_Values<RCC::AHB1SMENR, 1, 1, ReadWriteMode, RCCAHB1SMENRBase> ;
     using DMA1SMEN = RCC_AHB1SMENR_DMA1SMEN_Values<RCC::AHB1SMENR, 0, 1, ReadWriteMode, RCCAHB1SMENRBase> ;
+    static constexpr Type SnapshotMask = 0x11303U ;
     using FieldValues = RCC_AHB1SMENR_DMA1SMEN_Values<RCC::AHB1SMENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -421,6 +440,7 @@ struct RCC
     using GPIOCSMEN = RCC_AHB2SMENR_GPIOCSMEN_Values<RCC::AHB2SMENR, 2, 1, ReadWriteMode, RCCAHB2SMENRBase> ;
     using GPIOBSMEN = RCC_AHB2SMENR_GPIOBSMEN_Values<RCC::AHB2SMENR, 1, 1, ReadWriteMode, RCCAHB2SMENRBase> ;
     using GPIOASMEN = RCC_AHB2SMENR_GPIOASMEN_Values<RCC::AHB2SMENR, 0, 1, ReadWriteMode, RCCAHB2SMENRBase> ;
+    static constexpr Type SnapshotMask = 0x5229FU ;
     using FieldValues = RCC_AHB2SMENR_GPIOASMEN_Values<RCC::AHB2SMENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -432,6 +452,7 @@ struct RCC
   struct AHB3SMENR : public RegisterBase<0x40021070, 32, ReadWriteMode>
   {
     using QSPISMEN = RCC_AHB3SMENR_QSPISMEN_Values<RCC::AHB3SMENR, 8, 1, ReadWriteMode, RCCAHB3SMENRBase> ;
+    static constexpr Type SnapshotMask = 0x100U ;
     using FieldValues = RCC_AHB3SMENR_QSPISMEN_Values<RCC::AHB3SMENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -462,6 +483,7 @@ struct RCC
     using USBFSSMEN = RCC_APB1SMENR1_USBFSSMEN_Values<RCC::APB1SMENR1, 26, 1, ReadWriteMode, RCCAPB1SMENR1Base> ;
     using I2C2SMEN = RCC_APB1SMENR1_I2C2SMEN_Values<RCC::APB1SMENR1, 22, 1, ReadWriteMode, RCCAPB1SMENR1Base> ;
     using CRSSMEN = RCC_APB1SMENR1_CRSSMEN_Values<RCC::APB1SMENR1, 24, 1, ReadWriteMode, RCCAPB1SMENR1Base> ;
+    static constexpr Type SnapshotMask = 0xF7E6CE31U ;
     using FieldValues = RCC_APB1SMENR1_CRSSMEN_Values<RCC::APB1SMENR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -475,6 +497,7 @@ struct RCC
     using LPTIM2SMEN = RCC_APB1SMENR2_LPTIM2SMEN_Values<RCC::APB1SMENR2, 5, 1, ReadWriteMode, RCCAPB1SMENR2Base> ;
     using SWPMI1SMEN = RCC_APB1SMENR2_SWPMI1SMEN_Values<RCC::APB1SMENR2, 2, 1, ReadWriteMode, RCCAPB1SMENR2Base> ;
     using LPUART1SMEN = RCC_APB1SMENR2_LPUART1SMEN_Values<RCC::APB1SMENR2, 0, 1, ReadWriteMode, RCCAPB1SMENR2Base> ;
+    static constexpr Type SnapshotMask = 0x25U ;
     using FieldValues = RCC_APB1SMENR2_LPUART1SMEN_Values<RCC::APB1SMENR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -493,6 +516,7 @@ struct RCC
     using TIM1SMEN = RCC_APB2SMENR_TIM1SMEN_Values<RCC::APB2SMENR, 11, 1, ReadWriteMode, RCCAPB2SMENRBase> ;
     using SDMMCSMEN = RCC_APB2SMENR_SDMMCSMEN_Values<RCC::APB2SMENR, 10, 1, ReadWriteMode, RCCAPB2SMENRBase> ;
     using SYSCFGSMEN = RCC_APB2SMENR_SYSCFGSMEN_Values<RCC::APB2SMENR, 0, 1, ReadWriteMode, RCCAPB2SMENRBase> ;
+    static constexpr Type SnapshotMask = 0x235C01U ;
     using FieldValues = RCC_APB2SMENR_SYSCFGSMEN_Values<RCC::APB2SMENR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -517,6 +541,7 @@ struct RCC
     using USART4SEL = RCC_CCIPR_USART4SEL_Values<RCC::CCIPR, 6, 2, ReadWriteMode, RCCCCIPRBase> ;
     using USART3SEL = RCC_CCIPR_USART3SEL_Values<RCC::CCIPR, 4, 2, ReadWriteMode, RCCCCIPRBase> ;
     using I2C2SEL = RCC_CCIPR_I2C2SEL_Values<RCC::CCIPR, 14, 2, ReadWriteMode, RCCCCIPRBase> ;
+    static constexpr Type SnapshotMask = 0x7CFFFCFFU ;
     using FieldValues = RCC_CCIPR_I2C2SEL_Values<RCC::CCIPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -538,6 +563,7 @@ struct RCC
     using LSEBYP = RCC_BDCR_LSEBYP_Values<RCC::BDCR, 2, 1, ReadWriteMode, RCCBDCRBase> ;
     using LSERDY = RCC_BDCR_LSERDY_Values<RCC::BDCR, 1, 1, ReadMode, RCCBDCRBase> ;
     using LSEON = RCC_BDCR_LSEON_Values<RCC::BDCR, 0, 1, ReadWriteMode, RCCBDCRBase> ;
+    static constexpr Type SnapshotMask = 0x301833DU ;
     using FieldValues = RCC_BDCR_LSEON_Values<RCC::BDCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -560,6 +586,7 @@ struct RCC
     using MSISRANGE = RCC_CSR_MSISRANGE_Values<RCC::CSR, 8, 4, ReadWriteMode, RCCCSRBase> ;
     using LSIRDY = RCC_CSR_LSIRDY_Values<RCC::CSR, 1, 1, ReadMode, RCCCSRBase> ;
     using LSION = RCC_CSR_LSION_Values<RCC::CSR, 0, 1, ReadWriteMode, RCCCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RCC_CSR_LSION_Values<RCC::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -573,12 +600,14 @@ struct RCC
     using HSI48ON = RCC_CRRCR_HSI48ON_Values<RCC::CRRCR, 0, 1, ReadWriteMode, RCCCRRCRBase> ;
     using HSI48RDY = RCC_CRRCR_HSI48RDY_Values<RCC::CRRCR, 1, 1, ReadMode, RCCCRRCRBase> ;
     using HSI48CAL = RCC_CRRCR_HSI48CAL_Values<RCC::CRRCR, 7, 9, ReadMode, RCCCRRCRBase> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = RCC_CRRCR_HSI48CAL_Values<RCC::CRRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CRRCRPack  = Register<0x40021098, 32, ReadWriteMode, RCCCRRCRBase, T...> ;
 
+  using Registers = TypesList<RCC::CR, RCC::ICSCR, RCC::CFGR, RCC::PLLCFGR, RCC::PLLSAI1CFGR, RCC::CIER, RCC::CIFR, RCC::CICR, RCC::AHB1RSTR, RCC::AHB2RSTR, RCC::AHB3RSTR, RCC::APB1RSTR1, RCC::APB1RSTR2, RCC::APB2RSTR, RCC::AHB1ENR, RCC::AHB2ENR, RCC::AHB3ENR, RCC::APB1ENR1, RCC::APB1ENR2, RCC::APB2ENR, RCC::AHB1SMENR, RCC::AHB2SMENR, RCC::AHB3SMENR, RCC::APB1SMENR1, RCC::APB1SMENR2, RCC::APB2SMENR, RCC::CCIPR, RCC::BDCR, RCC::CSR, RCC::CRRCR> ;
 } ;
 
 #endif //#if !defined(RCCREGISTERS_HPP)
@@ -23,6 +23,7 @@ struct RNG
   {
     using IE = RNG_CR_IE_Values<RNG::CR, 3, 1, ReadWriteMode, RNGCRBase> ;
     using RNGEN = RNG_CR_RNGEN_Values<RNG::CR, 2, 1, ReadWriteMode, RNGCRBase> ;
+    static constexpr Type SnapshotMask = 0xCU ;
     using FieldValues = RNG_CR_RNGEN_Values<RNG::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -38,6 +39,7 @@ struct RNG
     using SECS = RNG_SR_SECS_Values<RNG::SR, 2, 1, ReadMode, RNGSRBase> ;
     using CECS = RNG_SR_CECS_Values<RNG::SR, 1, 1, ReadMode, RNGSRBase> ;
     using DRDY = RNG_SR_DRDY_Values<RNG::SR, 0, 1, ReadMode, RNGSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RNG_SR_DRDY_Values<RNG::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -55,6 +57,7 @@ struct RNG
   template<typename... T> 
   using DRPack  = Register<0x50060808, 32, ReadMode, RNGDRBase, T...> ;
 
+  using Registers = TypesList<RNG::CR, RNG::SR, RNG::DR> ;
 } ;
 
 #endif //#if !defined(RNGREGISTERS_HPP)
@@ -28,6 +28,7 @@ struct RTC
     using MNU = RTC_TR_MNU_Values<RTC::TR, 8, 4, ReadWriteMode, RTCTRBase> ;
     using ST = RTC_TR_ST_Values<RTC::TR, 4, 3, ReadWriteMode, RTCTRBase> ;
     using SU = RTC_TR_SU_Values<RTC::TR, 0, 4, ReadWriteMode, RTCTRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RTC_TR_SU_Values<RTC::TR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -45,6 +46,7 @@ struct RTC
     using MU = RTC_DR_MU_Values<RTC::DR, 8, 4, ReadWriteMode, RTCDRBase> ;
     using DT = RTC_DR_DT_Values<RTC::DR, 4, 2, ReadWriteMode, RTCDRBase> ;
     using DU = RTC_DR_DU_Values<RTC::DR, 0, 4, ReadWriteMode, RTCDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RTC_DR_DU_Values<RTC::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +78,7 @@ struct RTC
     using OSEL = RTC_CR_OSEL_Values<RTC::CR, 21, 2, ReadWriteMode, RTCCRBase> ;
     using COE = RTC_CR_COE_Values<RTC::CR, 23, 1, ReadWriteMode, RTCCRBase> ;
     using ITSE = RTC_CR_ITSE_Values<RTC::CR, 24, 1, ReadWriteMode, RTCCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFF7FU ;
     using FieldValues = RTC_CR_ITSE_Values<RTC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -103,6 +106,9 @@ struct RTC
     using TAMP2F = RTC_ISR_TAMP2F_Values<RTC::ISR, 14, 1, ReadWriteMode, RTCISRBase> ;
     using TAMP3F = RTC_ISR_TAMP3F_Values<RTC::ISR, 15, 1, ReadWriteMode, RTCISRBase> ;
     using RECALPF = RTC_ISR_RECALPF_Values<RTC::ISR, 16, 1, ReadMode, RTCISRBase> ;
+    static constexpr Type WritableMask = 0xFFA8U ;
+    static constexpr Type ZeroToClearMask = 0xFF20U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = RTC_ISR_RECALPF_Values<RTC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -115,6 +121,7 @@ struct RTC
   {
     using PREDIV_A = RTC_PRER_PREDIV_A_Values<RTC::PRER, 16, 7, ReadWriteMode, RTCPRERBase> ;
     using PREDIV_S = RTC_PRER_PREDIV_S_Values<RTC::PRER, 0, 15, ReadWriteMode, RTCPRERBase> ;
+    static constexpr Type SnapshotMask = 0x7F7FFFU ;
     using FieldValues = RTC_PRER_PREDIV_S_Values<RTC::PRER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -126,6 +133,7 @@ struct RTC
   struct WUTR : public RegisterBase<0x40002814, 32, ReadWriteMode>
   {
     using WUT = RTC_WUTR_WUT_Values<RTC::WUTR, 0, 16, ReadWriteMode, RTCWUTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = RTC_WUTR_WUT_Values<RTC::WUTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -150,6 +158,7 @@ struct RTC
     using MSK1 = RTC_ALRMAR_MSK1_Values<RTC::ALRMAR, 7, 1, ReadWriteMode, RTCALRMARBase> ;
     using ST = RTC_ALRMAR_ST_Values<RTC::ALRMAR, 4, 3, ReadWriteMode, RTCALRMARBase> ;
     using SU = RTC_ALRMAR_SU_Values<RTC::ALRMAR, 0, 4, ReadWriteMode, RTCALRMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_ALRMAR_SU_Values<RTC::ALRMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -174,6 +183,7 @@ struct RTC
     using MSK1 = RTC_ALRMBR_MSK1_Values<RTC::ALRMBR, 7, 1, ReadWriteMode, RTCALRMBRBase> ;
     using ST = RTC_ALRMBR_ST_Values<RTC::ALRMBR, 4, 3, ReadWriteMode, RTCALRMBRBase> ;
     using SU = RTC_ALRMBR_SU_Values<RTC::ALRMBR, 0, 4, ReadWriteMode, RTCALRMBRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_ALRMBR_SU_Values<RTC::ALRMBR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -265,6 +275,7 @@ struct RTC
     using CALW8 = RTC_CALR_CALW8_Values<RTC::CALR, 14, 1, ReadWriteMode, RTCCALRBase> ;
     using CALW16 = RTC_CALR_CALW16_Values<RTC::CALR, 13, 1, ReadWriteMode, RTCCALRBase> ;
     using CALM = RTC_CALR_CALM_Values<RTC::CALR, 0, 9, ReadWriteMode, RTCCALRBase> ;
+    static constexpr Type SnapshotMask = 0xE1FFU ;
     using FieldValues = RTC_CALR_CALM_Values<RTC::CALR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -296,6 +307,7 @@ struct RTC
     using TAMP3IE = RTC_TAMPCR_TAMP3IE_Values<RTC::TAMPCR, 22, 1, ReadWriteMode, RTCTAMPCRBase> ;
     using TAMP3NOERASE = RTC_TAMPCR_TAMP3NOERASE_Values<RTC::TAMPCR, 23, 1, ReadWriteMode, RTCTAMPCRBase> ;
     using TAMP3MF = RTC_TAMPCR_TAMP3MF_Values<RTC::TAMPCR, 24, 1, ReadWriteMode, RTCTAMPCRBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFU ;
     using FieldValues = RTC_TAMPCR_TAMP3MF_Values<RTC::TAMPCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -308,6 +320,7 @@ struct RTC
   {
     using MASKSS = RTC_ALRMASSR_MASKSS_Values<RTC::ALRMASSR, 24, 4, ReadWriteMode, RTCALRMASSRBase> ;
     using SS = RTC_ALRMASSR_SS_Values<RTC::ALRMASSR, 0, 15, ReadWriteMode, RTCALRMASSRBase> ;
+    static constexpr Type SnapshotMask = 0xF007FFFU ;
     using FieldValues = RTC_ALRMASSR_SS_Values<RTC::ALRMASSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -320,6 +333,7 @@ struct RTC
   {
     using MASKSS = RTC_ALRMBSSR_MASKSS_Values<RTC::ALRMBSSR, 24, 4, ReadWriteMode, RTCALRMBSSRBase> ;
     using SS = RTC_ALRMBSSR_SS_Values<RTC::ALRMBSSR, 0, 15, ReadWriteMode, RTCALRMBSSRBase> ;
+    static constexpr Type SnapshotMask = 0xF007FFFU ;
     using FieldValues = RTC_ALRMBSSR_SS_Values<RTC::ALRMBSSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -332,6 +346,7 @@ struct RTC
   {
     using RTC_ALARM_TYPE = RTC_OR_RTC_ALARM_TYPE_Values<RTC::OR, 0, 1, ReadWriteMode, RTCORBase> ;
     using RTC_OUT_RMP = RTC_OR_RTC_OUT_RMP_Values<RTC::OR, 1, 1, ReadWriteMode, RTCORBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = RTC_OR_RTC_OUT_RMP_Values<RTC::OR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -343,6 +358,7 @@ struct RTC
   struct BKP0R : public RegisterBase<0x40002850, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP0R_BKP_Values<RTC::BKP0R, 0, 32, ReadWriteMode, RTCBKP0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP0R_BKP_Values<RTC::BKP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -354,6 +370,7 @@ struct RTC
   struct BKP1R : public RegisterBase<0x40002854, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP1R_BKP_Values<RTC::BKP1R, 0, 32, ReadWriteMode, RTCBKP1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP1R_BKP_Values<RTC::BKP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -365,6 +382,7 @@ struct RTC
   struct BKP2R : public RegisterBase<0x40002858, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP2R_BKP_Values<RTC::BKP2R, 0, 32, ReadWriteMode, RTCBKP2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP2R_BKP_Values<RTC::BKP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -376,6 +394,7 @@ struct RTC
   struct BKP3R : public RegisterBase<0x4000285C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP3R_BKP_Values<RTC::BKP3R, 0, 32, ReadWriteMode, RTCBKP3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP3R_BKP_Values<RTC::BKP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -387,6 +406,7 @@ struct RTC
   struct BKP4R : public RegisterBase<0x40002860, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP4R_BKP_Values<RTC::BKP4R, 0, 32, ReadWriteMode, RTCBKP4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP4R_BKP_Values<RTC::BKP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -398,6 +418,7 @@ struct RTC
   struct BKP5R : public RegisterBase<0x40002864, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP5R_BKP_Values<RTC::BKP5R, 0, 32, ReadWriteMode, RTCBKP5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP5R_BKP_Values<RTC::BKP5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -409,6 +430,7 @@ struct RTC
   struct BKP6R : public RegisterBase<0x40002868, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP6R_BKP_Values<RTC::BKP6R, 0, 32, ReadWriteMode, RTCBKP6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP6R_BKP_Values<RTC::BKP6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -420,6 +442,7 @@ struct RTC
   struct BKP7R : public RegisterBase<0x4000286C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP7R_BKP_Values<RTC::BKP7R, 0, 32, ReadWriteMode, RTCBKP7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP7R_BKP_Values<RTC::BKP7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -431,6 +454,7 @@ struct RTC
   struct BKP8R : public RegisterBase<0x40002870, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP8R_BKP_Values<RTC::BKP8R, 0, 32, ReadWriteMode, RTCBKP8RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP8R_BKP_Values<RTC::BKP8R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -442,6 +466,7 @@ struct RTC
   struct BKP9R : public RegisterBase<0x40002874, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP9R_BKP_Values<RTC::BKP9R, 0, 32, ReadWriteMode, RTCBKP9RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP9R_BKP_Values<RTC::BKP9R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -453,6 +478,7 @@ struct RTC
   struct BKP10R : public RegisterBase<0x40002878, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP10R_BKP_Values<RTC::BKP10R, 0, 32, ReadWriteMode, RTCBKP10RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP10R_BKP_Values<RTC::BKP10R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -464,6 +490,7 @@ struct RTC
   struct BKP11R : public RegisterBase<0x4000287C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP11R_BKP_Values<RTC::BKP11R, 0, 32, ReadWriteMode, RTCBKP11RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP11R_BKP_Values<RTC::BKP11R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -475,6 +502,7 @@ struct RTC
   struct BKP12R : public RegisterBase<0x40002880, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP12R_BKP_Values<RTC::BKP12R, 0, 32, ReadWriteMode, RTCBKP12RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP12R_BKP_Values<RTC::BKP12R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -486,6 +514,7 @@ struct RTC
   struct BKP13R : public RegisterBase<0x40002884, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP13R_BKP_Values<RTC::BKP13R, 0, 32, ReadWriteMode, RTCBKP13RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP13R_BKP_Values<RTC::BKP13R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -497,6 +526,7 @@ struct RTC
   struct BKP14R : public RegisterBase<0x40002888, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP14R_BKP_Values<RTC::BKP14R, 0, 32, ReadWriteMode, RTCBKP14RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP14R_BKP_Values<RTC::BKP14R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -508,6 +538,7 @@ struct RTC
   struct BKP15R : public RegisterBase<0x4000288C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP15R_BKP_Values<RTC::BKP15R, 0, 32, ReadWriteMode, RTCBKP15RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP15R_BKP_Values<RTC::BKP15R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -519,6 +550,7 @@ struct RTC
   struct BKP16R : public RegisterBase<0x40002890, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP16R_BKP_Values<RTC::BKP16R, 0, 32, ReadWriteMode, RTCBKP16RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP16R_BKP_Values<RTC::BKP16R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -530,6 +562,7 @@ struct RTC
   struct BKP17R : public RegisterBase<0x40002894, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP17R_BKP_Values<RTC::BKP17R, 0, 32, ReadWriteMode, RTCBKP17RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP17R_BKP_Values<RTC::BKP17R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -541,6 +574,7 @@ struct RTC
   struct BKP18R : public RegisterBase<0x40002898, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP18R_BKP_Values<RTC::BKP18R, 0, 32, ReadWriteMode, RTCBKP18RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP18R_BKP_Values<RTC::BKP18R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -552,6 +586,7 @@ struct RTC
   struct BKP19R : public RegisterBase<0x4000289C, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP19R_BKP_Values<RTC::BKP19R, 0, 32, ReadWriteMode, RTCBKP19RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP19R_BKP_Values<RTC::BKP19R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -563,6 +598,7 @@ struct RTC
   struct BKP20R : public RegisterBase<0x400028A0, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP20R_BKP_Values<RTC::BKP20R, 0, 32, ReadWriteMode, RTCBKP20RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP20R_BKP_Values<RTC::BKP20R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -574,6 +610,7 @@ struct RTC
   struct BKP21R : public RegisterBase<0x400028A4, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP21R_BKP_Values<RTC::BKP21R, 0, 32, ReadWriteMode, RTCBKP21RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP21R_BKP_Values<RTC::BKP21R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -585,6 +622,7 @@ struct RTC
   struct BKP22R : public RegisterBase<0x400028A8, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP22R_BKP_Values<RTC::BKP22R, 0, 32, ReadWriteMode, RTCBKP22RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP22R_BKP_Values<RTC::BKP22R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -596,6 +634,7 @@ struct RTC
   struct BKP23R : public RegisterBase<0x400028AC, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP23R_BKP_Values<RTC::BKP23R, 0, 32, ReadWriteMode, RTCBKP23RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP23R_BKP_Values<RTC::BKP23R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -607,6 +646,7 @@ struct RTC
   struct BKP24R : public RegisterBase<0x400028B0, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP24R_BKP_Values<RTC::BKP24R, 0, 32, ReadWriteMode, RTCBKP24RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP24R_BKP_Values<RTC::BKP24R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -618,6 +658,7 @@ struct RTC
   struct BKP25R : public RegisterBase<0x400028B4, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP25R_BKP_Values<RTC::BKP25R, 0, 32, ReadWriteMode, RTCBKP25RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP25R_BKP_Values<RTC::BKP25R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -629,6 +670,7 @@ struct RTC
   struct BKP26R : public RegisterBase<0x400028B8, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP26R_BKP_Values<RTC::BKP26R, 0, 32, ReadWriteMode, RTCBKP26RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP26R_BKP_Values<RTC::BKP26R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -640,6 +682,7 @@ struct RTC
   struct BKP27R : public RegisterBase<0x400028BC, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP27R_BKP_Values<RTC::BKP27R, 0, 32, ReadWriteMode, RTCBKP27RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP27R_BKP_Values<RTC::BKP27R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -651,6 +694,7 @@ struct RTC
   struct BKP28R : public RegisterBase<0x400028C0, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP28R_BKP_Values<RTC::BKP28R, 0, 32, ReadWriteMode, RTCBKP28RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP28R_BKP_Values<RTC::BKP28R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -662,6 +706,7 @@ struct RTC
   struct BKP29R : public RegisterBase<0x400028C4, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP29R_BKP_Values<RTC::BKP29R, 0, 32, ReadWriteMode, RTCBKP29RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP29R_BKP_Values<RTC::BKP29R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -673,6 +718,7 @@ struct RTC
   struct BKP30R : public RegisterBase<0x400028C8, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP30R_BKP_Values<RTC::BKP30R, 0, 32, ReadWriteMode, RTCBKP30RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP30R_BKP_Values<RTC::BKP30R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -684,12 +730,14 @@ struct RTC
   struct BKP31R : public RegisterBase<0x400028CC, 32, ReadWriteMode>
   {
     using BKP = RTC_BKP31R_BKP_Values<RTC::BKP31R, 0, 32, ReadWriteMode, RTCBKP31RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = RTC_BKP31R_BKP_Values<RTC::BKP31R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BKP31RPack  = Register<0x400028CC, 32, ReadWriteMode, RTCBKP31RBase, T...> ;
 
+  using Registers = TypesList<RTC::TR, RTC::DR, RTC::CR, RTC::ISR, RTC::PRER, RTC::WUTR, RTC::ALRMAR, RTC::ALRMBR, RTC::WPR, RTC::SSR, RTC::SHIFTR, RTC::TSTR, RTC::TSDR, RTC::TSSSR, RTC::CALR, RTC::TAMPCR, RTC::ALRMASSR, RTC::ALRMBSSR, RTC::OR, RTC::BKP0R, RTC::BKP1R, RTC::BKP2R, RTC::BKP3R, RTC::BKP4R, RTC::BKP5R, RTC::BKP6R, RTC::BKP7R, RTC::BKP8R, RTC::BKP9R, RTC::BKP10R, RTC::BKP11R, RTC::BKP12R, RTC::BKP13R, RTC::BKP14R, RTC::BKP15R, RTC::BKP16R, RTC::BKP17R, RTC::BKP18R, RTC::BKP19R, RTC::BKP20R, RTC::BKP21R, RTC::BKP22R, RTC::BKP23R, RTC::BKP24R, RTC::BKP25R, RTC::BKP26R, RTC::BKP27R, RTC::BKP28R, RTC::BKP29R, RTC::BKP30R, RTC::BKP31R> ;
 } ;
 
 #endif //#if !defined(RTCREGISTERS_HPP)
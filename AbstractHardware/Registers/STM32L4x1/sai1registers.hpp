@@ -33,6 +33,7 @@ struct SAI1
     using DS = SAI1_BCR1_DS_Values<SAI1::BCR1, 5, 3, ReadWriteMode, SAI1BCR1Base> ;
     using PRTCFG = SAI1_BCR1_PRTCFG_Values<SAI1::BCR1, 2, 2, ReadWriteMode, SAI1BCR1Base> ;
     using MODE = SAI1_BCR1_MODE_Values<SAI1::BCR1, 0, 2, ReadWriteMode, SAI1BCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFB3FEFU ;
     using FieldValues = SAI1_BCR1_MODE_Values<SAI1::BCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +52,7 @@ struct SAI1
     using TRIS = SAI1_BCR2_TRIS_Values<SAI1::BCR2, 4, 1, ReadWriteMode, SAI1BCR2Base> ;
     using FFLUS = SAI1_BCR2_FFLUS_Values<SAI1::BCR2, 3, 1, ReadWriteMode, SAI1BCR2Base> ;
     using FTH = SAI1_BCR2_FTH_Values<SAI1::BCR2, 0, 3, ReadWriteMode, SAI1BCR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SAI1_BCR2_FTH_Values<SAI1::BCR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -66,6 +68,7 @@ struct SAI1
     using FSDEF = SAI1_BFRCR_FSDEF_Values<SAI1::BFRCR, 16, 1, ReadWriteMode, SAI1BFRCRBase> ;
     using FSALL = SAI1_BFRCR_FSALL_Values<SAI1::BFRCR, 8, 7, ReadWriteMode, SAI1BFRCRBase> ;
     using FRL = SAI1_BFRCR_FRL_Values<SAI1::BFRCR, 0, 8, ReadWriteMode, SAI1BFRCRBase> ;
+    static constexpr Type SnapshotMask = 0x77FFFU ;
     using FieldValues = SAI1_BFRCR_FRL_Values<SAI1::BFRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +83,7 @@ struct SAI1
     using NBSLOT = SAI1_BSLOTR_NBSLOT_Values<SAI1::BSLOTR, 8, 4, ReadWriteMode, SAI1BSLOTRBase> ;
     using SLOTSZ = SAI1_BSLOTR_SLOTSZ_Values<SAI1::BSLOTR, 6, 2, ReadWriteMode, SAI1BSLOTRBase> ;
     using FBOFF = SAI1_BSLOTR_FBOFF_Values<SAI1::BSLOTR, 0, 5, ReadWriteMode, SAI1BSLOTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF0FDFU ;
     using FieldValues = SAI1_BSLOTR_FBOFF_Values<SAI1::BSLOTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -97,6 +101,7 @@ struct SAI1
     using WCKCFG = SAI1_BIM_WCKCFG_Values<SAI1::BIM, 2, 1, ReadWriteMode, SAI1BIMBase> ;
     using MUTEDET = SAI1_BIM_MUTEDET_Values<SAI1::BIM, 1, 1, ReadWriteMode, SAI1BIMBase> ;
     using OVRUDRIE = SAI1_BIM_OVRUDRIE_Values<SAI1::BIM, 0, 1, ReadWriteMode, SAI1BIMBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = SAI1_BIM_OVRUDRIE_Values<SAI1::BIM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -142,6 +147,7 @@ struct SAI1
   struct BDR : public RegisterBase<0x40015440, 32, ReadWriteMode>
   {
     using DATA = SAI1_BDR_DATA_Values<SAI1::BDR, 0, 32, ReadWriteMode, SAI1BDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SAI1_BDR_DATA_Values<SAI1::BDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -164,6 +170,7 @@ struct SAI1
     using DS = SAI1_ACR1_DS_Values<SAI1::ACR1, 5, 3, ReadWriteMode, SAI1ACR1Base> ;
     using PRTCFG = SAI1_ACR1_PRTCFG_Values<SAI1::ACR1, 2, 2, ReadWriteMode, SAI1ACR1Base> ;
     using MODE = SAI1_ACR1_MODE_Values<SAI1::ACR1, 0, 2, ReadWriteMode, SAI1ACR1Base> ;
+    static constexpr Type SnapshotMask = 0xFB3FEFU ;
     using FieldValues = SAI1_ACR1_MODE_Values<SAI1::ACR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -182,6 +189,7 @@ struct SAI1
     using TRIS = SAI1_ACR2_TRIS_Values<SAI1::ACR2, 4, 1, ReadWriteMode, SAI1ACR2Base> ;
     using FFLUS = SAI1_ACR2_FFLUS_Values<SAI1::ACR2, 3, 1, ReadWriteMode, SAI1ACR2Base> ;
     using FTH = SAI1_ACR2_FTH_Values<SAI1::ACR2, 0, 3, ReadWriteMode, SAI1ACR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SAI1_ACR2_FTH_Values<SAI1::ACR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -197,6 +205,7 @@ struct SAI1
     using FSDEF = SAI1_AFRCR_FSDEF_Values<SAI1::AFRCR, 16, 1, ReadWriteMode, SAI1AFRCRBase> ;
     using FSALL = SAI1_AFRCR_FSALL_Values<SAI1::AFRCR, 8, 7, ReadWriteMode, SAI1AFRCRBase> ;
     using FRL = SAI1_AFRCR_FRL_Values<SAI1::AFRCR, 0, 8, ReadWriteMode, SAI1AFRCRBase> ;
+    static constexpr Type SnapshotMask = 0x77FFFU ;
     using FieldValues = SAI1_AFRCR_FRL_Values<SAI1::AFRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -211,6 +220,7 @@ struct SAI1
     using NBSLOT = SAI1_ASLOTR_NBSLOT_Values<SAI1::ASLOTR, 8, 4, ReadWriteMode, SAI1ASLOTRBase> ;
     using SLOTSZ = SAI1_ASLOTR_SLOTSZ_Values<SAI1::ASLOTR, 6, 2, ReadWriteMode, SAI1ASLOTRBase> ;
     using FBOFF = SAI1_ASLOTR_FBOFF_Values<SAI1::ASLOTR, 0, 5, ReadWriteMode, SAI1ASLOTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF0FDFU ;
     using FieldValues = SAI1_ASLOTR_FBOFF_Values<SAI1::ASLOTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -228,6 +238,7 @@ struct SAI1
     using WCKCFG = SAI1_AIM_WCKCFG_Values<SAI1::AIM, 2, 1, ReadWriteMode, SAI1AIMBase> ;
     using MUTEDET = SAI1_AIM_MUTEDET_Values<SAI1::AIM, 1, 1, ReadWriteMode, SAI1AIMBase> ;
     using OVRUDRIE = SAI1_AIM_OVRUDRIE_Values<SAI1::AIM, 0, 1, ReadWriteMode, SAI1AIMBase> ;
+    static constexpr Type SnapshotMask = 0x7FU ;
     using FieldValues = SAI1_AIM_OVRUDRIE_Values<SAI1::AIM, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -246,6 +257,7 @@ struct SAI1
     using WCKCFG = SAI1_ASR_WCKCFG_Values<SAI1::ASR, 2, 1, ReadWriteMode, SAI1ASRBase> ;
     using MUTEDET = SAI1_ASR_MUTEDET_Values<SAI1::ASR, 1, 1, ReadWriteMode, SAI1ASRBase> ;
     using OVRUDR = SAI1_ASR_OVRUDR_Values<SAI1::ASR, 0, 1, ReadWriteMode, SAI1ASRBase> ;
+    static constexpr Type SnapshotMask = 0x7007FU ;
     using FieldValues = SAI1_ASR_OVRUDR_Values<SAI1::ASR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -262,6 +274,7 @@ struct SAI1
     using WCKCFG = SAI1_ACLRFR_WCKCFG_Values<SAI1::ACLRFR, 2, 1, ReadWriteMode, SAI1ACLRFRBase> ;
     using MUTEDET = SAI1_ACLRFR_MUTEDET_Values<SAI1::ACLRFR, 1, 1, ReadWriteMode, SAI1ACLRFRBase> ;
     using OVRUDR = SAI1_ACLRFR_OVRUDR_Values<SAI1::ACLRFR, 0, 1, ReadWriteMode, SAI1ACLRFRBase> ;
+    static constexpr Type SnapshotMask = 0x77U ;
     using FieldValues = SAI1_ACLRFR_OVRUDR_Values<SAI1::ACLRFR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -273,12 +286,14 @@ struct SAI1
   struct ADR : public RegisterBase<0x40015420, 32, ReadWriteMode>
   {
     using DATA = SAI1_ADR_DATA_Values<SAI1::ADR, 0, 32, ReadWriteMode, SAI1ADRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SAI1_ADR_DATA_Values<SAI1::ADR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using ADRPack  = Register<0x40015420, 32, ReadWriteMode, SAI1ADRBase, T...> ;
 
+  using Registers = TypesList<SAI1::BCR1, SAI1::BCR2, SAI1::BFRCR, SAI1::BSLOTR, SAI1::BIM, SAI1::BSR, SAI1::BCLRFR, SAI1::BDR, SAI1::ACR1, SAI1::ACR2, SAI1::AFRCR, SAI1::ASLOTR, SAI1::AIM, SAI1::ASR, SAI1::ACLRFR, SAI1::ADR> ;
 } ;
 
 #endif //#if !defined(SAI1REGISTERS_HPP)
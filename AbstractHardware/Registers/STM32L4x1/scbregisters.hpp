@@ -45,6 +45,7 @@ struct SCB
     using PENDSVCLR = SCB_ICSR_PENDSVCLR_Values<SCB::ICSR, 27, 1, ReadWriteMode, SCBICSRBase> ;
     using PENDSVSET = SCB_ICSR_PENDSVSET_Values<SCB::ICSR, 28, 1, ReadWriteMode, SCBICSRBase> ;
     using NMIPENDSET = SCB_ICSR_NMIPENDSET_Values<SCB::ICSR, 31, 1, ReadWriteMode, SCBICSRBase> ;
+    static constexpr Type SnapshotMask = 0x9E47F9FFU ;
     using FieldValues = SCB_ICSR_NMIPENDSET_Values<SCB::ICSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -56,6 +57,7 @@ struct SCB
   struct VTOR : public RegisterBase<0xE000ED08, 32, ReadWriteMode>
   {
     using TBLOFF = SCB_VTOR_TBLOFF_Values<SCB::VTOR, 9, 21, ReadWriteMode, SCBVTORBase> ;
+    static constexpr Type SnapshotMask = 0x3FFFFE00U ;
     using FieldValues = SCB_VTOR_TBLOFF_Values<SCB::VTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +74,7 @@ struct SCB
     using PRIGROUP = SCB_AIRCR_PRIGROUP_Values<SCB::AIRCR, 8, 3, ReadWriteMode, SCBAIRCRBase> ;
     using ENDIANESS = SCB_AIRCR_ENDIANESS_Values<SCB::AIRCR, 15, 1, ReadWriteMode, SCBAIRCRBase> ;
     using VECTKEYSTAT = SCB_AIRCR_VECTKEYSTAT_Values<SCB::AIRCR, 16, 16, ReadWriteMode, SCBAIRCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFF8707U ;
     using FieldValues = SCB_AIRCR_VECTKEYSTAT_Values<SCB::AIRCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -85,6 +88,7 @@ struct SCB
     using SLEEPONEXIT = SCB_SCR_SLEEPONEXIT_Values<SCB::SCR, 1, 1, ReadWriteMode, SCBSCRBase> ;
     using SLEEPDEEP = SCB_SCR_SLEEPDEEP_Values<SCB::SCR, 2, 1, ReadWriteMode, SCBSCRBase> ;
     using SEVEONPEND = SCB_SCR_SEVEONPEND_Values<SCB::SCR, 4, 1, ReadWriteMode, SCBSCRBase> ;
+    static constexpr Type SnapshotMask = 0x16U ;
     using FieldValues = SCB_SCR_SEVEONPEND_Values<SCB::SCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -101,6 +105,7 @@ struct SCB
     using DIV_0_TRP = SCB_CCR_DIV_0_TRP_Values<SCB::CCR, 4, 1, ReadWriteMode, SCBCCRBase> ;
     using BFHFNMIGN = SCB_CCR_BFHFNMIGN_Values<SCB::CCR, 8, 1, ReadWriteMode, SCBCCRBase> ;
     using STKALIGN = SCB_CCR_STKALIGN_Values<SCB::CCR, 9, 1, ReadWriteMode, SCBCCRBase> ;
+    static constexpr Type SnapshotMask = 0x31BU ;
     using FieldValues = SCB_CCR_STKALIGN_Values<SCB::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -114,6 +119,7 @@ struct SCB
     using PRI_4 = SCB_SHPR1_PRI_4_Values<SCB::SHPR1, 0, 8, ReadWriteMode, SCBSHPR1Base> ;
     using PRI_5 = SCB_SHPR1_PRI_5_Values<SCB::SHPR1, 8, 8, ReadWriteMode, SCBSHPR1Base> ;
     using PRI_6 = SCB_SHPR1_PRI_6_Values<SCB::SHPR1, 16, 8, ReadWriteMode, SCBSHPR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = SCB_SHPR1_PRI_6_Values<SCB::SHPR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -125,6 +131,7 @@ struct SCB
   struct SHPR2 : public RegisterBase<0xE000ED1C, 32, ReadWriteMode>
   {
     using PRI_11 = SCB_SHPR2_PRI_11_Values<SCB::SHPR2, 24, 8, ReadWriteMode, SCBSHPR2Base> ;
+    static constexpr Type SnapshotMask = 0xFF000000U ;
     using FieldValues = SCB_SHPR2_PRI_11_Values<SCB::SHPR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -137,6 +144,7 @@ struct SCB
   {
     using PRI_14 = SCB_SHPR3_PRI_14_Values<SCB::SHPR3, 16, 8, ReadWriteMode, SCBSHPR3Base> ;
     using PRI_15 = SCB_SHPR3_PRI_15_Values<SCB::SHPR3, 24, 8, ReadWriteMode, SCBSHPR3Base> ;
+    static constexpr Type SnapshotMask = 0xFFFF0000U ;
     using FieldValues = SCB_SHPR3_PRI_15_Values<SCB::SHPR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -161,6 +169,7 @@ struct SCB
     using MEMFAULTENA = SCB_SHCRS_MEMFAULTENA_Values<SCB::SHCRS, 16, 1, ReadWriteMode, SCBSHCRSBase> ;
     using BUSFAULTENA = SCB_SHCRS_BUSFAULTENA_Values<SCB::SHCRS, 17, 1, ReadWriteMode, SCBSHCRSBase> ;
     using USGFAULTENA = SCB_SHCRS_USGFAULTENA_Values<SCB::SHCRS, 18, 1, ReadWriteMode, SCBSHCRSBase> ;
+    static constexpr Type SnapshotMask = 0x7FD8BU ;
     using FieldValues = SCB_SHCRS_USGFAULTENA_Values<SCB::SHCRS, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -189,6 +198,7 @@ struct SCB
     using NOCP = SCB_CFSR_UFSR_BFSR_MMFSR_NOCP_Values<SCB::CFSR_UFSR_BFSR_MMFSR, 19, 1, ReadWriteMode, SCBCFSR_UFSR_BFSR_MMFSRBase> ;
     using UNALIGNED = SCB_CFSR_UFSR_BFSR_MMFSR_UNALIGNED_Values<SCB::CFSR_UFSR_BFSR_MMFSR, 24, 1, ReadWriteMode, SCBCFSR_UFSR_BFSR_MMFSRBase> ;
     using DIVBYZERO = SCB_CFSR_UFSR_BFSR_MMFSR_DIVBYZERO_Values<SCB::CFSR_UFSR_BFSR_MMFSR, 25, 1, ReadWriteMode, SCBCFSR_UFSR_BFSR_MMFSRBase> ;
+    static constexpr Type SnapshotMask = 0x30FBFBAU ;
     using FieldValues = SCB_CFSR_UFSR_BFSR_MMFSR_DIVBYZERO_Values<SCB::CFSR_UFSR_BFSR_MMFSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -202,6 +212,7 @@ struct SCB
     using VECTTBL = SCB_HFSR_VECTTBL_Values<SCB::HFSR, 1, 1, ReadWriteMode, SCBHFSRBase> ;
     using FORCED = SCB_HFSR_FORCED_Values<SCB::HFSR, 30, 1, ReadWriteMode, SCBHFSRBase> ;
     using DEBUG_VT = SCB_HFSR_DEBUG_VT_Values<SCB::HFSR, 31, 1, ReadWriteMode, SCBHFSRBase> ;
+    static constexpr Type SnapshotMask = 0xC0000002U ;
     using FieldValues = SCB_HFSR_DEBUG_VT_Values<SCB::HFSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -213,6 +224,7 @@ struct SCB
   struct MMFAR : public RegisterBase<0xE000ED34, 32, ReadWriteMode>
   {
     using MMFARField = SCB_MMFAR_MMFAR_Values<SCB::MMFAR, 0, 32, ReadWriteMode, SCBMMFARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SCB_MMFAR_MMFAR_Values<SCB::MMFAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -224,6 +236,7 @@ struct SCB
   struct BFAR : public RegisterBase<0xE000ED38, 32, ReadWriteMode>
   {
     using BFARField = SCB_BFAR_BFAR_Values<SCB::BFAR, 0, 32, ReadWriteMode, SCBBFARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SCB_BFAR_BFAR_Values<SCB::BFAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -235,12 +248,14 @@ struct SCB
   struct AFSR : public RegisterBase<0xE000ED3C, 32, ReadWriteMode>
   {
     using IMPDEF = SCB_AFSR_IMPDEF_Values<SCB::AFSR, 0, 32, ReadWriteMode, SCBAFSRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SCB_AFSR_IMPDEF_Values<SCB::AFSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using AFSRPack  = Register<0xE000ED3C, 32, ReadWriteMode, SCBAFSRBase, T...> ;
 
+  using Registers = TypesList<SCB::CPUID, SCB::ICSR, SCB::VTOR, SCB::AIRCR, SCB::SCR, SCB::CCR, SCB::SHPR1, SCB::SHPR2, SCB::SHPR3, SCB::SHCRS, SCB::CFSR_UFSR_BFSR_MMFSR, SCB::HFSR, SCB::MMFAR, SCB::BFAR, SCB::AFSR> ;
 } ;
 
 #endif //#if !defined(SCBREGISTERS_HPP)
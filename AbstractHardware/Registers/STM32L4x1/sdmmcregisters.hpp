@@ -22,6 +22,7 @@ struct SDMMC
   struct POWER : public RegisterBase<0x40012800, 32, ReadWriteMode>
   {
     using PWRCTRL = SDMMC_POWER_PWRCTRL_Values<SDMMC::POWER, 0, 2, ReadWriteMode, SDMMCPOWERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = SDMMC_POWER_PWRCTRL_Values<SDMMC::POWER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -39,6 +40,7 @@ struct SDMMC
     using PWRSAV = SDMMC_CLKCR_PWRSAV_Values<SDMMC::CLKCR, 9, 1, ReadWriteMode, SDMMCCLKCRBase> ;
     using CLKEN = SDMMC_CLKCR_CLKEN_Values<SDMMC::CLKCR, 8, 1, ReadWriteMode, SDMMCCLKCRBase> ;
     using CLKDIV = SDMMC_CLKCR_CLKDIV_Values<SDMMC::CLKCR, 0, 8, ReadWriteMode, SDMMCCLKCRBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SDMMC_CLKCR_CLKDIV_Values<SDMMC::CLKCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -50,6 +52,7 @@ struct SDMMC
   struct ARG : public RegisterBase<0x40012808, 32, ReadWriteMode>
   {
     using CMDARG = SDMMC_ARG_CMDARG_Values<SDMMC::ARG, 0, 32, ReadWriteMode, SDMMCARGBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SDMMC_ARG_CMDARG_Values<SDMMC::ARG, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +72,7 @@ struct SDMMC
     using WAITINT = SDMMC_CMD_WAITINT_Values<SDMMC::CMD, 8, 1, ReadWriteMode, SDMMCCMDBase> ;
     using WAITRESP = SDMMC_CMD_WAITRESP_Values<SDMMC::CMD, 6, 2, ReadWriteMode, SDMMCCMDBase> ;
     using CMDINDEX = SDMMC_CMD_CMDINDEX_Values<SDMMC::CMD, 0, 6, ReadWriteMode, SDMMCCMDBase> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SDMMC_CMD_CMDINDEX_Values<SDMMC::CMD, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +139,7 @@ struct SDMMC
   struct DTIMER : public RegisterBase<0x40012824, 32, ReadWriteMode>
   {
     using DATATIME = SDMMC_DTIMER_DATATIME_Values<SDMMC::DTIMER, 0, 32, ReadWriteMode, SDMMCDTIMERBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SDMMC_DTIMER_DATATIME_Values<SDMMC::DTIMER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +151,7 @@ struct SDMMC
   struct DLEN : public RegisterBase<0x40012828, 32, ReadWriteMode>
   {
     using DATALENGTH = SDMMC_DLEN_DATALENGTH_Values<SDMMC::DLEN, 0, 25, ReadWriteMode, SDMMCDLENBase> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFU ;
     using FieldValues = SDMMC_DLEN_DATALENGTH_Values<SDMMC::DLEN, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -165,6 +171,7 @@ struct SDMMC
     using DTMODE = SDMMC_DCTRL_DTMODE_Values<SDMMC::DCTRL, 2, 1, ReadWriteMode, SDMMCDCTRLBase> ;
     using DTDIR = SDMMC_DCTRL_DTDIR_Values<SDMMC::DCTRL, 1, 1, ReadWriteMode, SDMMCDCTRLBase> ;
     using DTEN = SDMMC_DCTRL_DTEN_Values<SDMMC::DCTRL, 0, 1, ReadWriteMode, SDMMCDCTRLBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = SDMMC_DCTRL_DTEN_Values<SDMMC::DCTRL, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,6 +240,7 @@ struct SDMMC
     using CTIMEOUTC = SDMMC_ICR_CTIMEOUTC_Values<SDMMC::ICR, 2, 1, ReadWriteMode, SDMMCICRBase> ;
     using DCRCFAILC = SDMMC_ICR_DCRCFAILC_Values<SDMMC::ICR, 1, 1, ReadWriteMode, SDMMCICRBase> ;
     using CCRCFAILC = SDMMC_ICR_CCRCFAILC_Values<SDMMC::ICR, 0, 1, ReadWriteMode, SDMMCICRBase> ;
+    static constexpr Type SnapshotMask = 0xC007FFU ;
     using FieldValues = SDMMC_ICR_CCRCFAILC_Values<SDMMC::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -267,6 +275,7 @@ struct SDMMC
     using CTIMEOUTIE = SDMMC_MASK_CTIMEOUTIE_Values<SDMMC::MASK, 2, 1, ReadWriteMode, SDMMCMASKBase> ;
     using DCRCFAILIE = SDMMC_MASK_DCRCFAILIE_Values<SDMMC::MASK, 1, 1, ReadWriteMode, SDMMCMASKBase> ;
     using CCRCFAILIE = SDMMC_MASK_CCRCFAILIE_Values<SDMMC::MASK, 0, 1, ReadWriteMode, SDMMCMASKBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFU ;
     using FieldValues = SDMMC_MASK_CCRCFAILIE_Values<SDMMC::MASK, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -289,12 +298,14 @@ struct SDMMC
   struct FIFO : public RegisterBase<0x40012880, 32, ReadWriteMode>
   {
     using FIFOData = SDMMC_FIFO_FIFOData_Values<SDMMC::FIFO, 0, 32, ReadWriteMode, SDMMCFIFOBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = SDMMC_FIFO_FIFOData_Values<SDMMC::FIFO, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using FIFOPack  = Register<0x40012880, 32, ReadWriteMode, SDMMCFIFOBase, T...> ;
 
+  using Registers = TypesList<SDMMC::POWER, SDMMC::CLKCR, SDMMC::ARG, SDMMC::CMD, SDMMC::RESPCMD, SDMMC::RESP1, SDMMC::RESP2, SDMMC::RESP3, SDMMC::RESP4, SDMMC::DTIMER, SDMMC::DLEN, SDMMC::DCTRL, SDMMC::DCOUNT, SDMMC::STA, SDMMC::ICR, SDMMC::MASK, SDMMC::FIFOCNT, SDMMC::FIFO> ;
 } ;
 
 #endif //#if !defined(SDMMCREGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI1
     using MSTR = SPI1_CR1_MSTR_Values<SPI1::CR1, 2, 1, ReadWriteMode, SPI1CR1Base> ;
     using CPOL = SPI1_CR1_CPOL_Values<SPI1::CR1, 1, 1, ReadWriteMode, SPI1CR1Base> ;
     using CPHA = SPI1_CR1_CPHA_Values<SPI1::CR1, 0, 1, ReadWriteMode, SPI1CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI1_CR1_CPHA_Values<SPI1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct SPI1
     using FRXTH = SPI1_CR2_FRXTH_Values<SPI1::CR2, 12, 1, ReadWriteMode, SPI1CR2Base> ;
     using LDMA_RX = SPI1_CR2_LDMA_RX_Values<SPI1::CR2, 13, 1, ReadWriteMode, SPI1CR2Base> ;
     using LDMA_TX = SPI1_CR2_LDMA_TX_Values<SPI1::CR2, 14, 1, ReadWriteMode, SPI1CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SPI1_CR2_LDMA_TX_Values<SPI1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +79,9 @@ struct SPI1
     using TIFRFE = SPI1_SR_TIFRFE_Values<SPI1::SR, 8, 1, ReadMode, SPI1SRBase> ;
     using FRLVL = SPI1_SR_FRLVL_Values<SPI1::SR, 9, 2, ReadMode, SPI1SRBase> ;
     using FTLVL = SPI1_SR_FTLVL_Values<SPI1::SR, 11, 2, ReadMode, SPI1SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI1_SR_FTLVL_Values<SPI1::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -87,6 +93,7 @@ struct SPI1
   struct DR : public RegisterBase<0x4001300C, 32, ReadWriteMode>
   {
     using DRField = SPI1_DR_DR_Values<SPI1::DR, 0, 16, ReadWriteMode, SPI1DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI1_DR_DR_Values<SPI1::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +105,7 @@ struct SPI1
   struct CRCPR : public RegisterBase<0x40013010, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI1_CRCPR_CRCPOLY_Values<SPI1::CRCPR, 0, 16, ReadWriteMode, SPI1CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI1_CRCPR_CRCPOLY_Values<SPI1::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -126,6 +134,7 @@ struct SPI1
   template<typename... T> 
   using TXCRCRPack  = Register<0x40013018, 32, ReadMode, SPI1TXCRCRBase, T...> ;
 
+  using Registers = TypesList<SPI1::CR1, SPI1::CR2, SPI1::SR, SPI1::DR, SPI1::CRCPR, SPI1::RXCRCR, SPI1::TXCRCR> ;
 } ;
 
 #endif //#if !defined(SPI1REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI2
     using MSTR = SPI2_CR1_MSTR_Values<SPI2::CR1, 2, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPOL = SPI2_CR1_CPOL_Values<SPI2::CR1, 1, 1, ReadWriteMode, SPI2CR1Base> ;
     using CPHA = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 1, ReadWriteMode, SPI2CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI2_CR1_CPHA_Values<SPI2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct SPI2
     using FRXTH = SPI2_CR2_FRXTH_Values<SPI2::CR2, 12, 1, ReadWriteMode, SPI2CR2Base> ;
     using LDMA_RX = SPI2_CR2_LDMA_RX_Values<SPI2::CR2, 13, 1, ReadWriteMode, SPI2CR2Base> ;
     using LDMA_TX = SPI2_CR2_LDMA_TX_Values<SPI2::CR2, 14, 1, ReadWriteMode, SPI2CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SPI2_CR2_LDMA_TX_Values<SPI2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +79,9 @@ struct SPI2
     using TIFRFE = SPI2_SR_TIFRFE_Values<SPI2::SR, 8, 1, ReadMode, SPI2SRBase> ;
     using FRLVL = SPI2_SR_FRLVL_Values<SPI2::SR, 9, 2, ReadMode, SPI2SRBase> ;
     using FTLVL = SPI2_SR_FTLVL_Values<SPI2::SR, 11, 2, ReadMode, SPI2SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_SR_FTLVL_Values<SPI2::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -87,6 +93,7 @@ struct SPI2
   struct DR : public RegisterBase<0x4000380C, 32, ReadWriteMode>
   {
     using DRField = SPI2_DR_DR_Values<SPI2::DR, 0, 16, ReadWriteMode, SPI2DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI2_DR_DR_Values<SPI2::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +105,7 @@ struct SPI2
   struct CRCPR : public RegisterBase<0x40003810, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 16, ReadWriteMode, SPI2CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI2_CRCPR_CRCPOLY_Values<SPI2::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -126,6 +134,7 @@ struct SPI2
   template<typename... T> 
   using TXCRCRPack  = Register<0x40003818, 32, ReadMode, SPI2TXCRCRBase, T...> ;
 
+  using Registers = TypesList<SPI2::CR1, SPI2::CR2, SPI2::SR, SPI2::DR, SPI2::CRCPR, SPI2::RXCRCR, SPI2::TXCRCR> ;
 } ;
 
 #endif //#if !defined(SPI2REGISTERS_HPP)
@@ -35,6 +35,8 @@ struct SPI3
     using MSTR = SPI3_CR1_MSTR_Values<SPI3::CR1, 2, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPOL = SPI3_CR1_CPOL_Values<SPI3::CR1, 1, 1, ReadWriteMode, SPI3CR1Base> ;
     using CPHA = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 1, ReadWriteMode, SPI3CR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
+    static constexpr Type EnableMask = 0x40U ;
     using FieldValues = SPI3_CR1_CPHA_Values<SPI3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct SPI3
     using FRXTH = SPI3_CR2_FRXTH_Values<SPI3::CR2, 12, 1, ReadWriteMode, SPI3CR2Base> ;
     using LDMA_RX = SPI3_CR2_LDMA_RX_Values<SPI3::CR2, 13, 1, ReadWriteMode, SPI3CR2Base> ;
     using LDMA_TX = SPI3_CR2_LDMA_TX_Values<SPI3::CR2, 14, 1, ReadWriteMode, SPI3CR2Base> ;
+    static constexpr Type SnapshotMask = 0x7FFFU ;
     using FieldValues = SPI3_CR2_LDMA_TX_Values<SPI3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -76,6 +79,9 @@ struct SPI3
     using TIFRFE = SPI3_SR_TIFRFE_Values<SPI3::SR, 8, 1, ReadMode, SPI3SRBase> ;
     using FRLVL = SPI3_SR_FRLVL_Values<SPI3::SR, 9, 2, ReadMode, SPI3SRBase> ;
     using FTLVL = SPI3_SR_FTLVL_Values<SPI3::SR, 11, 2, ReadMode, SPI3SRBase> ;
+    static constexpr Type WritableMask = 0x10U ;
+    static constexpr Type ZeroToClearMask = 0x10U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI3_SR_FTLVL_Values<SPI3::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -87,6 +93,7 @@ struct SPI3
   struct DR : public RegisterBase<0x40003C0C, 32, ReadWriteMode>
   {
     using DRField = SPI3_DR_DR_Values<SPI3::DR, 0, 16, ReadWriteMode, SPI3DRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = SPI3_DR_DR_Values<SPI3::DR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -98,6 +105,7 @@ struct SPI3
   struct CRCPR : public RegisterBase<0x40003C10, 32, ReadWriteMode>
   {
     using CRCPOLY = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 16, ReadWriteMode, SPI3CRCPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = SPI3_CRCPR_CRCPOLY_Values<SPI3::CRCPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -126,6 +134,7 @@ struct SPI3
   template<typename... T> 
   using TXCRCRPack  = Register<0x40003C18, 32, ReadMode, SPI3TXCRCRBase, T...> ;
 
+  using Registers = TypesList<SPI3::CR1, SPI3::CR2, SPI3::SR, SPI3::DR, SPI3::CRCPR, SPI3::RXCRCR, SPI3::TXCRCR> ;
 } ;
 
 #endif //#if !defined(SPI3REGISTERS_HPP)
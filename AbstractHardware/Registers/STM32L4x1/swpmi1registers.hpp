@@ -28,6 +28,7 @@ struct SWPMI1
     using LPBK = SWPMI1_CR_LPBK_Values<SWPMI1::CR, 4, 1, ReadWriteMode, SWPMI1CRBase> ;
     using SWPME = SWPMI1_CR_SWPME_Values<SWPMI1::CR, 5, 1, ReadWriteMode, SWPMI1CRBase> ;
     using DEACT = SWPMI1_CR_DEACT_Values<SWPMI1::CR, 10, 1, ReadWriteMode, SWPMI1CRBase> ;
+    static constexpr Type SnapshotMask = 0x43FU ;
     using FieldValues = SWPMI1_CR_DEACT_Values<SWPMI1::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -39,6 +40,7 @@ struct SWPMI1
   struct BRR : public RegisterBase<0x40008804, 32, ReadWriteMode>
   {
     using BR = SWPMI1_BRR_BR_Values<SWPMI1::BRR, 0, 6, ReadWriteMode, SWPMI1BRRBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = SWPMI1_BRR_BR_Values<SWPMI1::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -96,6 +98,7 @@ struct SWPMI1
     using TIE = SWPMI1_IER_TIE_Values<SWPMI1::IER, 6, 1, ReadWriteMode, SWPMI1IERBase> ;
     using TCIE = SWPMI1_IER_TCIE_Values<SWPMI1::IER, 7, 1, ReadWriteMode, SWPMI1IERBase> ;
     using SRIE = SWPMI1_IER_SRIE_Values<SWPMI1::IER, 8, 1, ReadWriteMode, SWPMI1IERBase> ;
+    static constexpr Type SnapshotMask = 0x1FFU ;
     using FieldValues = SWPMI1_IER_SRIE_Values<SWPMI1::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +138,7 @@ struct SWPMI1
   template<typename... T> 
   using RDRPack  = Register<0x40008820, 32, ReadMode, SWPMI1RDRBase, T...> ;
 
+  using Registers = TypesList<SWPMI1::CR, SWPMI1::BRR, SWPMI1::ISR, SWPMI1::ICR, SWPMI1::IER, SWPMI1::RFL, SWPMI1::TDR, SWPMI1::RDR> ;
 } ;
 
 #endif //#if !defined(SWPMI1REGISTERS_HPP)
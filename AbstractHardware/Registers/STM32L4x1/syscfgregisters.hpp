@@ -24,6 +24,7 @@ struct SYSCFG
     using FB_MODE = SYSCFG_MEMRMP_FB_MODE_Values<SYSCFG::MEMRMP, 8, 1, ReadWriteMode, SYSCFGMEMRMPBase> ;
     using QFS = SYSCFG_MEMRMP_QFS_Values<SYSCFG::MEMRMP, 3, 1, ReadWriteMode, SYSCFGMEMRMPBase> ;
     using MEM_MODE = SYSCFG_MEMRMP_MEM_MODE_Values<SYSCFG::MEMRMP, 0, 3, ReadWriteMode, SYSCFGMEMRMPBase> ;
+    static constexpr Type SnapshotMask = 0x10FU ;
     using FieldValues = SYSCFG_MEMRMP_MEM_MODE_Values<SYSCFG::MEMRMP, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -44,6 +45,7 @@ struct SYSCFG
     using I2C_PB6_FMP = SYSCFG_CFGR1_I2C_PB6_FMP_Values<SYSCFG::CFGR1, 16, 1, ReadWriteMode, SYSCFGCFGR1Base> ;
     using BOOSTEN = SYSCFG_CFGR1_BOOSTEN_Values<SYSCFG::CFGR1, 8, 1, ReadWriteMode, SYSCFGCFGR1Base> ;
     using FWDIS = SYSCFG_CFGR1_FWDIS_Values<SYSCFG::CFGR1, 0, 1, ReadWriteMode, SYSCFGCFGR1Base> ;
+    static constexpr Type SnapshotMask = 0xFC7F0101U ;
     using FieldValues = SYSCFG_CFGR1_FWDIS_Values<SYSCFG::CFGR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -58,6 +60,7 @@ struct SYSCFG
     using EXTI2 = SYSCFG_EXTICR1_EXTI2_Values<SYSCFG::EXTICR1, 8, 3, ReadWriteMode, SYSCFGEXTICR1Base> ;
     using EXTI1 = SYSCFG_EXTICR1_EXTI1_Values<SYSCFG::EXTICR1, 4, 3, ReadWriteMode, SYSCFGEXTICR1Base> ;
     using EXTI0 = SYSCFG_EXTICR1_EXTI0_Values<SYSCFG::EXTICR1, 0, 3, ReadWriteMode, SYSCFGEXTICR1Base> ;
+    static constexpr Type SnapshotMask = 0x7777U ;
     using FieldValues = SYSCFG_EXTICR1_EXTI0_Values<SYSCFG::EXTICR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -72,6 +75,7 @@ struct SYSCFG
     using EXTI6 = SYSCFG_EXTICR2_EXTI6_Values<SYSCFG::EXTICR2, 8, 3, ReadWriteMode, SYSCFGEXTICR2Base> ;
     using EXTI5 = SYSCFG_EXTICR2_EXTI5_Values<SYSCFG::EXTICR2, 4, 3, ReadWriteMode, SYSCFGEXTICR2Base> ;
     using EXTI4 = SYSCFG_EXTICR2_EXTI4_Values<SYSCFG::EXTICR2, 0, 3, ReadWriteMode, SYSCFGEXTICR2Base> ;
+    static constexpr Type SnapshotMask = 0x7777U ;
     using FieldValues = SYSCFG_EXTICR2_EXTI4_Values<SYSCFG::EXTICR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -86,6 +90,7 @@ struct SYSCFG
     using EXTI10 = SYSCFG_EXTICR3_EXTI10_Values<SYSCFG::EXTICR3, 8, 3, ReadWriteMode, SYSCFGEXTICR3Base> ;
     using EXTI9 = SYSCFG_EXTICR3_EXTI9_Values<SYSCFG::EXTICR3, 4, 3, ReadWriteMode, SYSCFGEXTICR3Base> ;
     using EXTI8 = SYSCFG_EXTICR3_EXTI8_Values<SYSCFG::EXTICR3, 0, 3, ReadWriteMode, SYSCFGEXTICR3Base> ;
+    static constexpr Type SnapshotMask = 0x7777U ;
     using FieldValues = SYSCFG_EXTICR3_EXTI8_Values<SYSCFG::EXTICR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -100,6 +105,7 @@ struct SYSCFG
     using EXTI14 = SYSCFG_EXTICR4_EXTI14_Values<SYSCFG::EXTICR4, 8, 3, ReadWriteMode, SYSCFGEXTICR4Base> ;
     using EXTI13 = SYSCFG_EXTICR4_EXTI13_Values<SYSCFG::EXTICR4, 4, 3, ReadWriteMode, SYSCFGEXTICR4Base> ;
     using EXTI12 = SYSCFG_EXTICR4_EXTI12_Values<SYSCFG::EXTICR4, 0, 3, ReadWriteMode, SYSCFGEXTICR4Base> ;
+    static constexpr Type SnapshotMask = 0x7777U ;
     using FieldValues = SYSCFG_EXTICR4_EXTI12_Values<SYSCFG::EXTICR4, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -112,6 +118,7 @@ struct SYSCFG
   {
     using SRAM2BSY = SYSCFG_SCSR_SRAM2BSY_Values<SYSCFG::SCSR, 1, 1, ReadMode, SYSCFGSCSRBase> ;
     using SRAM2ER = SYSCFG_SCSR_SRAM2ER_Values<SYSCFG::SCSR, 0, 1, ReadWriteMode, SYSCFGSCSRBase> ;
+    static constexpr Type SnapshotMask = 0x1U ;
     using FieldValues = SYSCFG_SCSR_SRAM2ER_Values<SYSCFG::SCSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -127,6 +134,7 @@ struct SYSCFG
     using PVDL = SYSCFG_CFGR2_PVDL_Values<SYSCFG::CFGR2, 2, 1, WriteMode, SYSCFGCFGR2Base> ;
     using SPL = SYSCFG_CFGR2_SPL_Values<SYSCFG::CFGR2, 1, 1, WriteMode, SYSCFGCFGR2Base> ;
     using CLL = SYSCFG_CFGR2_CLL_Values<SYSCFG::CFGR2, 0, 1, WriteMode, SYSCFGCFGR2Base> ;
+    static constexpr Type SnapshotMask = 0x10FU ;
     using FieldValues = SYSCFG_CFGR2_CLL_Values<SYSCFG::CFGR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -186,6 +194,7 @@ struct SYSCFG
   template<typename... T> 
   using SKRPack  = Register<0x40010024, 32, WriteMode, SYSCFGSKRBase, T...> ;
 
+  using Registers = TypesList<SYSCFG::MEMRMP, SYSCFG::CFGR1, SYSCFG::EXTICR1, SYSCFG::EXTICR2, SYSCFG::EXTICR3, SYSCFG::EXTICR4, SYSCFG::SCSR, SYSCFG::CFGR2, SYSCFG::SWPR, SYSCFG::SKR> ;
 } ;
 
 #endif //#if !defined(SYSCFGREGISTERS_HPP)
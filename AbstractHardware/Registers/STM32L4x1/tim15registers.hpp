@@ -28,6 +28,8 @@ struct TIM15
     using ARPE = TIM15_CR1_ARPE_Values<TIM15::CR1, 7, 1, ReadWriteMode, TIM15CR1Base> ;
     using CKD = TIM15_CR1_CKD_Values<TIM15::CR1, 8, 2, ReadWriteMode, TIM15CR1Base> ;
     using UIFREMAP = TIM15_CR1_UIFREMAP_Values<TIM15::CR1, 11, 1, ReadWriteMode, TIM15CR1Base> ;
+    static constexpr Type SnapshotMask = 0xB8EU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = TIM15_CR1_UIFREMAP_Values<TIM15::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -43,6 +45,7 @@ struct TIM15
     using CCDS = TIM15_CR2_CCDS_Values<TIM15::CR2, 3, 1, ReadWriteMode, TIM15CR2Base> ;
     using CCUS = TIM15_CR2_CCUS_Values<TIM15::CR2, 2, 1, ReadWriteMode, TIM15CR2Base> ;
     using CCPC = TIM15_CR2_CCPC_Values<TIM15::CR2, 0, 1, ReadWriteMode, TIM15CR2Base> ;
+    static constexpr Type SnapshotMask = 0x30DU ;
     using FieldValues = TIM15_CR2_CCPC_Values<TIM15::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -62,6 +65,7 @@ struct TIM15
     using COMIE = TIM15_DIER_COMIE_Values<TIM15::DIER, 5, 1, ReadWriteMode, TIM15DIERBase> ;
     using CC1IE = TIM15_DIER_CC1IE_Values<TIM15::DIER, 1, 1, ReadWriteMode, TIM15DIERBase> ;
     using UIE = TIM15_DIER_UIE_Values<TIM15::DIER, 0, 1, ReadWriteMode, TIM15DIERBase> ;
+    static constexpr Type SnapshotMask = 0x63E3U ;
     using FieldValues = TIM15_DIER_UIE_Values<TIM15::DIER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -78,6 +82,9 @@ struct TIM15
     using COMIF = TIM15_SR_COMIF_Values<TIM15::SR, 5, 1, ReadWriteMode, TIM15SRBase> ;
     using CC1IF = TIM15_SR_CC1IF_Values<TIM15::SR, 1, 1, ReadWriteMode, TIM15SRBase> ;
     using UIF = TIM15_SR_UIF_Values<TIM15::SR, 0, 1, ReadWriteMode, TIM15SRBase> ;
+    static constexpr Type WritableMask = 0x2E3U ;
+    static constexpr Type ZeroToClearMask = 0x2E3U ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM15_SR_UIF_Values<TIM15::SR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -108,6 +115,7 @@ struct TIM15
     using OC1PE = TIM15_CCMR1_Output_OC1PE_Values<TIM15::CCMR1_Output, 3, 1, ReadWriteMode, TIM15CCMR1_OutputBase> ;
     using OC1FE = TIM15_CCMR1_Output_OC1FE_Values<TIM15::CCMR1_Output, 2, 1, ReadWriteMode, TIM15CCMR1_OutputBase> ;
     using CC1S = TIM15_CCMR1_Output_CC1S_Values<TIM15::CCMR1_Output, 0, 2, ReadWriteMode, TIM15CCMR1_OutputBase> ;
+    static constexpr Type SnapshotMask = 0x1007FU ;
     using FieldValues = TIM15_CCMR1_Output_CC1S_Values<TIM15::CCMR1_Output, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +129,7 @@ struct TIM15
     using IC1F = TIM15_CCMR1_Input_IC1F_Values<TIM15::CCMR1_Input, 4, 4, ReadWriteMode, TIM15CCMR1_InputBase> ;
     using IC1PSC = TIM15_CCMR1_Input_IC1PSC_Values<TIM15::CCMR1_Input, 2, 2, ReadWriteMode, TIM15CCMR1_InputBase> ;
     using CC1S = TIM15_CCMR1_Input_CC1S_Values<TIM15::CCMR1_Input, 0, 2, ReadWriteMode, TIM15CCMR1_InputBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM15_CCMR1_Input_CC1S_Values<TIM15::CCMR1_Input, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -135,6 +144,7 @@ struct TIM15
     using CC1NE = TIM15_CCER_CC1NE_Values<TIM15::CCER, 2, 1, ReadWriteMode, TIM15CCERBase> ;
     using CC1P = TIM15_CCER_CC1P_Values<TIM15::CCER, 1, 1, ReadWriteMode, TIM15CCERBase> ;
     using CC1E = TIM15_CCER_CC1E_Values<TIM15::CCER, 0, 1, ReadWriteMode, TIM15CCERBase> ;
+    static constexpr Type SnapshotMask = 0xFU ;
     using FieldValues = TIM15_CCER_CC1E_Values<TIM15::CCER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -147,6 +157,7 @@ struct TIM15
   {
     using CNTField = TIM15_CNT_CNT_Values<TIM15::CNT, 0, 16, ReadWriteMode, TIM15CNTBase> ;
     using UIFCPY = TIM15_CNT_UIFCPY_Values<TIM15::CNT, 31, 1, ReadMode, TIM15CNTBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TIM15_CNT_UIFCPY_Values<TIM15::CNT, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -158,6 +169,7 @@ struct TIM15
   struct PSC : public RegisterBase<0x40014028, 32, ReadWriteMode>
   {
     using PSCField = TIM15_PSC_PSC_Values<TIM15::PSC, 0, 16, ReadWriteMode, TIM15PSCBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_PSC_PSC_Values<TIM15::PSC, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -169,6 +181,7 @@ struct TIM15
   struct ARR : public RegisterBase<0x4001402C, 32, ReadWriteMode>
   {
     using ARRField = TIM15_ARR_ARR_Values<TIM15::ARR, 0, 16, ReadWriteMode, TIM15ARRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_ARR_ARR_Values<TIM15::ARR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -180,6 +193,7 @@ struct TIM15
   struct RCR : public RegisterBase<0x40014030, 32, ReadWriteMode>
   {
     using REP = TIM15_RCR_REP_Values<TIM15::RCR, 0, 8, ReadWriteMode, TIM15RCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TIM15_RCR_REP_Values<TIM15::RCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -191,6 +205,7 @@ struct TIM15
   struct CCR1 : public RegisterBase<0x40014034, 32, ReadWriteMode>
   {
     using CCR1Field = TIM15_CCR1_CCR1_Values<TIM15::CCR1, 0, 16, ReadWriteMode, TIM15CCR1Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_CCR1_CCR1_Values<TIM15::CCR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -210,6 +225,7 @@ struct TIM15
     using AOE = TIM15_BDTR_AOE_Values<TIM15::BDTR, 14, 1, ReadWriteMode, TIM15BDTRBase> ;
     using MOE = TIM15_BDTR_MOE_Values<TIM15::BDTR, 15, 1, ReadWriteMode, TIM15BDTRBase> ;
     using BKF = TIM15_BDTR_BKF_Values<TIM15::BDTR, 16, 4, ReadWriteMode, TIM15BDTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFU ;
     using FieldValues = TIM15_BDTR_BKF_Values<TIM15::BDTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -222,6 +238,7 @@ struct TIM15
   {
     using DBL = TIM15_DCR_DBL_Values<TIM15::DCR, 8, 5, ReadWriteMode, TIM15DCRBase> ;
     using DBA = TIM15_DCR_DBA_Values<TIM15::DCR, 0, 5, ReadWriteMode, TIM15DCRBase> ;
+    static constexpr Type SnapshotMask = 0x1F1FU ;
     using FieldValues = TIM15_DCR_DBA_Values<TIM15::DCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -233,12 +250,14 @@ struct TIM15
   struct DMAR : public RegisterBase<0x4001404C, 32, ReadWriteMode>
   {
     using DMAB = TIM15_DMAR_DMAB_Values<TIM15::DMAR, 0, 16, ReadWriteMode, TIM15DMARBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = TIM15_DMAR_DMAB_Values<TIM15::DMAR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using DMARPack  = Register<0x4001404C, 32, ReadWriteMode, TIM15DMARBase, T...> ;
 
+  using Registers = TypesList<TIM15::CR1, TIM15::CR2, TIM15::DIER, TIM15::SR, TIM15::EGR, TIM15::CCMR1_Output, TIM15::CCMR1_Input, TIM15::CCER, TIM15::CNT, TIM15::PSC, TIM15::ARR, TIM15::RCR, TIM15::CCR1, TIM15::BDTR, TIM15::DCR, TIM15::DMAR> ;
 } ;
 
 #endif //#if !defined(TIM15REGISTERS_HPP)
@@ -33,6 +33,7 @@ struct TSC
     using AM = TSC_CR_AM_Values<TSC::CR, 2, 1, ReadWriteMode, TSCCRBase> ;
     using START = TSC_CR_START_Values<TSC::CR, 1, 1, ReadWriteMode, TSCCRBase> ;
     using TSCE = TSC_CR_TSCE_Values<TSC::CR, 0, 1, ReadWriteMode, TSCCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFF0FFU ;
     using FieldValues = TSC_CR_TSCE_Values<TSC::CR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -45,6 +46,7 @@ struct TSC
   {
     using MCEIE = TSC_IER_MCEIE_Values<TSC::IER, 1, 1, ReadWriteMode, TSCIERBase> ;
     using EOAIE = TSC_IER_EOAIE_Values<TSC::IER, 0, 1, ReadWriteMode, TSCIERBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TSC_IER_EOAIE_Values<TSC::IER, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -57,6 +59,7 @@ struct TSC
   {
     using MCEIC = TSC_ICR_MCEIC_Values<TSC::ICR, 1, 1, ReadWriteMode, TSCICRBase> ;
     using EOAIC = TSC_ICR_EOAIC_Values<TSC::ICR, 0, 1, ReadWriteMode, TSCICRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = TSC_ICR_EOAIC_Values<TSC::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -69,6 +72,7 @@ struct TSC
   {
     using MCEF = TSC_ISR_MCEF_Values<TSC::ISR, 1, 1, ReadWriteMode, TSCISRBase> ;
     using EOAF = TSC_ISR_EOAF_Values<TSC::ISR, 0, 1, ReadWriteMode, TSCISRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = TSC_ISR_EOAF_Values<TSC::ISR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct TSC
     using G1_IO3 = TSC_IOHCR_G1_IO3_Values<TSC::IOHCR, 2, 1, ReadWriteMode, TSCIOHCRBase> ;
     using G1_IO2 = TSC_IOHCR_G1_IO2_Values<TSC::IOHCR, 1, 1, ReadWriteMode, TSCIOHCRBase> ;
     using G1_IO1 = TSC_IOHCR_G1_IO1_Values<TSC::IOHCR, 0, 1, ReadWriteMode, TSCIOHCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TSC_IOHCR_G1_IO1_Values<TSC::IOHCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -153,6 +158,7 @@ struct TSC
     using G1_IO3 = TSC_IOASCR_G1_IO3_Values<TSC::IOASCR, 2, 1, ReadWriteMode, TSCIOASCRBase> ;
     using G1_IO2 = TSC_IOASCR_G1_IO2_Values<TSC::IOASCR, 1, 1, ReadWriteMode, TSCIOASCRBase> ;
     using G1_IO1 = TSC_IOASCR_G1_IO1_Values<TSC::IOASCR, 0, 1, ReadWriteMode, TSCIOASCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TSC_IOASCR_G1_IO1_Values<TSC::IOASCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -195,6 +201,7 @@ struct TSC
     using G1_IO3 = TSC_IOSCR_G1_IO3_Values<TSC::IOSCR, 2, 1, ReadWriteMode, TSCIOSCRBase> ;
     using G1_IO2 = TSC_IOSCR_G1_IO2_Values<TSC::IOSCR, 1, 1, ReadWriteMode, TSCIOSCRBase> ;
     using G1_IO1 = TSC_IOSCR_G1_IO1_Values<TSC::IOSCR, 0, 1, ReadWriteMode, TSCIOSCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TSC_IOSCR_G1_IO1_Values<TSC::IOSCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -237,6 +244,7 @@ struct TSC
     using G1_IO3 = TSC_IOCCR_G1_IO3_Values<TSC::IOCCR, 2, 1, ReadWriteMode, TSCIOCCRBase> ;
     using G1_IO2 = TSC_IOCCR_G1_IO2_Values<TSC::IOCCR, 1, 1, ReadWriteMode, TSCIOCCRBase> ;
     using G1_IO1 = TSC_IOCCR_G1_IO1_Values<TSC::IOCCR, 0, 1, ReadWriteMode, TSCIOCCRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = TSC_IOCCR_G1_IO1_Values<TSC::IOCCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -263,6 +271,7 @@ struct TSC
     using G3E = TSC_IOGCSR_G3E_Values<TSC::IOGCSR, 2, 1, ReadWriteMode, TSCIOGCSRBase> ;
     using G2E = TSC_IOGCSR_G2E_Values<TSC::IOGCSR, 1, 1, ReadWriteMode, TSCIOGCSRBase> ;
     using G1E = TSC_IOGCSR_G1E_Values<TSC::IOGCSR, 0, 1, ReadWriteMode, TSCIOGCSRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = TSC_IOGCSR_G1E_Values<TSC::IOGCSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -357,6 +366,7 @@ struct TSC
   template<typename... T> 
   using IOG8CRPack  = Register<0x40024050, 32, ReadMode, TSCIOG8CRBase, T...> ;
 
+  using Registers = TypesList<TSC::CR, TSC::IER, TSC::ICR, TSC::ISR, TSC::IOHCR, TSC::IOASCR, TSC::IOSCR, TSC::IOCCR, TSC::IOGCSR, TSC::IOG1CR, TSC::IOG2CR, TSC::IOG3CR, TSC::IOG4CR, TSC::IOG5CR, TSC::IOG6CR, TSC::IOG7CR, TSC::IOG8CR> ;
 } ;
 
 #endif //#if !defined(TSCREGISTERS_HPP)
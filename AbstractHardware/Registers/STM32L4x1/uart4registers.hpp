@@ -50,6 +50,8 @@ struct UART4
     using RE = UART4_CR1_RE_Values<UART4::CR1, 2, 1, ReadWriteMode, UART4CR1Base> ;
     using UESM = UART4_CR1_UESM_Values<UART4::CR1, 1, 1, ReadWriteMode, UART4CR1Base> ;
     using UE = UART4_CR1_UE_Values<UART4::CR1, 0, 1, ReadWriteMode, UART4CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = UART4_CR1_UE_Values<UART4::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +82,7 @@ struct UART4
     using LBDIE = UART4_CR2_LBDIE_Values<UART4::CR2, 6, 1, ReadWriteMode, UART4CR2Base> ;
     using LBDL = UART4_CR2_LBDL_Values<UART4::CR2, 5, 1, ReadWriteMode, UART4CR2Base> ;
     using ADDM7 = UART4_CR2_ADDM7_Values<UART4::CR2, 4, 1, ReadWriteMode, UART4CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = UART4_CR2_ADDM7_Values<UART4::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +112,7 @@ struct UART4
     using IRLP = UART4_CR3_IRLP_Values<UART4::CR3, 2, 1, ReadWriteMode, UART4CR3Base> ;
     using IREN = UART4_CR3_IREN_Values<UART4::CR3, 1, 1, ReadWriteMode, UART4CR3Base> ;
     using EIE = UART4_CR3_EIE_Values<UART4::CR3, 0, 1, ReadWriteMode, UART4CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = UART4_CR3_EIE_Values<UART4::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +125,7 @@ struct UART4
   {
     using DIV_Mantissa = UART4_BRR_DIV_Mantissa_Values<UART4::BRR, 4, 12, ReadWriteMode, UART4BRRBase> ;
     using DIV_Fraction = UART4_BRR_DIV_Fraction_Values<UART4::BRR, 0, 4, ReadWriteMode, UART4BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART4_BRR_DIV_Fraction_Values<UART4::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +138,7 @@ struct UART4
   {
     using GT = UART4_GTPR_GT_Values<UART4::GTPR, 8, 8, ReadWriteMode, UART4GTPRBase> ;
     using PSC = UART4_GTPR_PSC_Values<UART4::GTPR, 0, 8, ReadWriteMode, UART4GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = UART4_GTPR_PSC_Values<UART4::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +151,7 @@ struct UART4
   {
     using BLEN = UART4_RTOR_BLEN_Values<UART4::RTOR, 24, 8, ReadWriteMode, UART4RTORBase> ;
     using RTO = UART4_RTOR_RTO_Values<UART4::RTOR, 0, 24, ReadWriteMode, UART4RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = UART4_RTOR_RTO_Values<UART4::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -214,6 +221,8 @@ struct UART4
     using NCF = UART4_ICR_NCF_Values<UART4::ICR, 2, 1, WriteMode, UART4ICRBase> ;
     using FECF = UART4_ICR_FECF_Values<UART4::ICR, 1, 1, WriteMode, UART4ICRBase> ;
     using PECF = UART4_ICR_PECF_Values<UART4::ICR, 0, 1, WriteMode, UART4ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
     using FieldValues = UART4_ICR_PECF_Values<UART4::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,12 +245,14 @@ struct UART4
   struct TDR : public RegisterBase<0x40004C28, 32, ReadWriteMode>
   {
     using TDRField = UART4_TDR_TDR_Values<UART4::TDR, 0, 9, ReadWriteMode, UART4TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = UART4_TDR_TDR_Values<UART4::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40004C28, 32, ReadWriteMode, UART4TDRBase, T...> ;
 
+  using Registers = TypesList<UART4::CR1, UART4::CR2, UART4::CR3, UART4::BRR, UART4::GTPR, UART4::RTOR, UART4::RQR, UART4::ISR, UART4::ICR, UART4::RDR, UART4::TDR> ;
 } ;
 
 #endif //#if !defined(UART4REGISTERS_HPP)
@@ -50,6 +50,8 @@ struct USART1
     using RE = USART1_CR1_RE_Values<USART1::CR1, 2, 1, ReadWriteMode, USART1CR1Base> ;
     using UESM = USART1_CR1_UESM_Values<USART1::CR1, 1, 1, ReadWriteMode, USART1CR1Base> ;
     using UE = USART1_CR1_UE_Values<USART1::CR1, 0, 1, ReadWriteMode, USART1CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART1_CR1_UE_Values<USART1::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +82,7 @@ struct USART1
     using LBDIE = USART1_CR2_LBDIE_Values<USART1::CR2, 6, 1, ReadWriteMode, USART1CR2Base> ;
     using LBDL = USART1_CR2_LBDL_Values<USART1::CR2, 5, 1, ReadWriteMode, USART1CR2Base> ;
     using ADDM7 = USART1_CR2_ADDM7_Values<USART1::CR2, 4, 1, ReadWriteMode, USART1CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART1_CR2_ADDM7_Values<USART1::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +112,7 @@ struct USART1
     using IRLP = USART1_CR3_IRLP_Values<USART1::CR3, 2, 1, ReadWriteMode, USART1CR3Base> ;
     using IREN = USART1_CR3_IREN_Values<USART1::CR3, 1, 1, ReadWriteMode, USART1CR3Base> ;
     using EIE = USART1_CR3_EIE_Values<USART1::CR3, 0, 1, ReadWriteMode, USART1CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART1_CR3_EIE_Values<USART1::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +125,7 @@ struct USART1
   {
     using DIV_Mantissa = USART1_BRR_DIV_Mantissa_Values<USART1::BRR, 4, 12, ReadWriteMode, USART1BRRBase> ;
     using DIV_Fraction = USART1_BRR_DIV_Fraction_Values<USART1::BRR, 0, 4, ReadWriteMode, USART1BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART1_BRR_DIV_Fraction_Values<USART1::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +138,7 @@ struct USART1
   {
     using GT = USART1_GTPR_GT_Values<USART1::GTPR, 8, 8, ReadWriteMode, USART1GTPRBase> ;
     using PSC = USART1_GTPR_PSC_Values<USART1::GTPR, 0, 8, ReadWriteMode, USART1GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART1_GTPR_PSC_Values<USART1::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +151,7 @@ struct USART1
   {
     using BLEN = USART1_RTOR_BLEN_Values<USART1::RTOR, 24, 8, ReadWriteMode, USART1RTORBase> ;
     using RTO = USART1_RTOR_RTO_Values<USART1::RTOR, 0, 24, ReadWriteMode, USART1RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART1_RTOR_RTO_Values<USART1::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -214,6 +221,8 @@ struct USART1
     using NCF = USART1_ICR_NCF_Values<USART1::ICR, 2, 1, WriteMode, USART1ICRBase> ;
     using FECF = USART1_ICR_FECF_Values<USART1::ICR, 1, 1, WriteMode, USART1ICRBase> ;
     using PECF = USART1_ICR_PECF_Values<USART1::ICR, 0, 1, WriteMode, USART1ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
     using FieldValues = USART1_ICR_PECF_Values<USART1::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,12 +245,14 @@ struct USART1
   struct TDR : public RegisterBase<0x40013828, 32, ReadWriteMode>
   {
     using TDRField = USART1_TDR_TDR_Values<USART1::TDR, 0, 9, ReadWriteMode, USART1TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART1_TDR_TDR_Values<USART1::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40013828, 32, ReadWriteMode, USART1TDRBase, T...> ;
 
+  using Registers = TypesList<USART1::CR1, USART1::CR2, USART1::CR3, USART1::BRR, USART1::GTPR, USART1::RTOR, USART1::RQR, USART1::ISR, USART1::ICR, USART1::RDR, USART1::TDR> ;
 } ;
 
 #endif //#if !defined(USART1REGISTERS_HPP)
@@ -50,6 +50,8 @@ struct USART2
     using RE = USART2_CR1_RE_Values<USART2::CR1, 2, 1, ReadWriteMode, USART2CR1Base> ;
     using UESM = USART2_CR1_UESM_Values<USART2::CR1, 1, 1, ReadWriteMode, USART2CR1Base> ;
     using UE = USART2_CR1_UE_Values<USART2::CR1, 0, 1, ReadWriteMode, USART2CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART2_CR1_UE_Values<USART2::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +82,7 @@ struct USART2
     using LBDIE = USART2_CR2_LBDIE_Values<USART2::CR2, 6, 1, ReadWriteMode, USART2CR2Base> ;
     using LBDL = USART2_CR2_LBDL_Values<USART2::CR2, 5, 1, ReadWriteMode, USART2CR2Base> ;
     using ADDM7 = USART2_CR2_ADDM7_Values<USART2::CR2, 4, 1, ReadWriteMode, USART2CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART2_CR2_ADDM7_Values<USART2::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -109,6 +112,7 @@ struct USART2
     using IRLP = USART2_CR3_IRLP_Values<USART2::CR3, 2, 1, ReadWriteMode, USART2CR3Base> ;
     using IREN = USART2_CR3_IREN_Values<USART2::CR3, 1, 1, ReadWriteMode, USART2CR3Base> ;
     using EIE = USART2_CR3_EIE_Values<USART2::CR3, 0, 1, ReadWriteMode, USART2CR3Base> ;
+    static constexpr Type SnapshotMask = 0x7EFFFFU ;
     using FieldValues = USART2_CR3_EIE_Values<USART2::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -121,6 +125,7 @@ struct USART2
   {
     using DIV_Mantissa = USART2_BRR_DIV_Mantissa_Values<USART2::BRR, 4, 12, ReadWriteMode, USART2BRRBase> ;
     using DIV_Fraction = USART2_BRR_DIV_Fraction_Values<USART2::BRR, 0, 4, ReadWriteMode, USART2BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART2_BRR_DIV_Fraction_Values<USART2::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -133,6 +138,7 @@ struct USART2
   {
     using GT = USART2_GTPR_GT_Values<USART2::GTPR, 8, 8, ReadWriteMode, USART2GTPRBase> ;
     using PSC = USART2_GTPR_PSC_Values<USART2::GTPR, 0, 8, ReadWriteMode, USART2GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART2_GTPR_PSC_Values<USART2::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -145,6 +151,7 @@ struct USART2
   {
     using BLEN = USART2_RTOR_BLEN_Values<USART2::RTOR, 24, 8, ReadWriteMode, USART2RTORBase> ;
     using RTO = USART2_RTOR_RTO_Values<USART2::RTOR, 0, 24, ReadWriteMode, USART2RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART2_RTOR_RTO_Values<USART2::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -214,6 +221,8 @@ struct USART2
     using NCF = USART2_ICR_NCF_Values<USART2::ICR, 2, 1, WriteMode, USART2ICRBase> ;
     using FECF = USART2_ICR_FECF_Values<USART2::ICR, 1, 1, WriteMode, USART2ICRBase> ;
     using PECF = USART2_ICR_PECF_Values<USART2::ICR, 0, 1, WriteMode, USART2ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
     using FieldValues = USART2_ICR_PECF_Values<USART2::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -236,12 +245,14 @@ struct USART2
   struct TDR : public RegisterBase<0x40004428, 32, ReadWriteMode>
   {
     using TDRField = USART2_TDR_TDR_Values<USART2::TDR, 0, 9, ReadWriteMode, USART2TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART2_TDR_TDR_Values<USART2::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40004428, 32, ReadWriteMode, USART2TDRBase, T...> ;
 
+  using Registers = TypesList<USART2::CR1, USART2::CR2, USART2::CR3, USART2::BRR, USART2::GTPR, USART2::RTOR, USART2::RQR, USART2::ISR, USART2::ICR, USART2::RDR, USART2::TDR> ;
 } ;
 
 #endif //#if !defined(USART2REGISTERS_HPP)
@@ -50,6 +50,8 @@ struct USART3
     using RE = USART3_CR1_RE_Values<USART3::CR1, 2, 1, ReadWriteMode, USART3CR1Base> ;
     using UESM = USART3_CR1_UESM_Values<USART3::CR1, 1, 1, ReadWriteMode, USART3CR1Base> ;
     using UE = USART3_CR1_UE_Values<USART3::CR1, 0, 1, ReadWriteMode, USART3CR1Base> ;
+    static constexpr Type SnapshotMask = 0x1FFFFFFEU ;
+    static constexpr Type EnableMask = 0x1U ;
     using FieldValues = USART3_CR1_UE_Values<USART3::CR1, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -80,6 +82,7 @@ struct USART3
     using LBDIE = USART3_CR2_LBDIE_Values<USART3::CR2, 6, 1, ReadWriteMode, USART3CR2Base> ;
     using LBDL = USART3_CR2_LBDL_Values<USART3::CR2, 5, 1, ReadWriteMode, USART3CR2Base> ;
     using ADDM7 = USART3_CR2_ADDM7_Values<USART3::CR2, 4, 1, ReadWriteMode, USART3CR2Base> ;
+    static constexpr Type SnapshotMask = 0xFFFFFF70U ;
     using FieldValues = USART3_CR2_ADDM7_Values<USART3::CR2, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +114,7 @@ struct USART3
     using EIE = USART3_CR3_EIE_Values<USART3::CR3, 0, 1, ReadWriteMode, USART3CR3Base> ;
     using UCESM = USART3_CR3_UCESM_Values<USART3::CR3, 23, 1, ReadWriteMode, USART3CR3Base> ;
     using TCBGTIE = USART3_CR3_TCBGTIE_Values<USART3::CR3, 24, 1, ReadWriteMode, USART3CR3Base> ;
+    static constexpr Type SnapshotMask = 0x1FEFFFFU ;
     using FieldValues = USART3_CR3_TCBGTIE_Values<USART3::CR3, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -122,6 +126,7 @@ struct USART3
   struct BRR : public RegisterBase<0x4000480C, 32, ReadWriteMode>
   {
     using BRRField = USART3_BRR_BRR_Values<USART3::BRR, 0, 12, ReadWriteMode, USART3BRRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFU ;
     using FieldValues = USART3_BRR_BRR_Values<USART3::BRR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -134,6 +139,7 @@ struct USART3
   {
     using GT = USART3_GTPR_GT_Values<USART3::GTPR, 8, 8, ReadWriteMode, USART3GTPRBase> ;
     using PSC = USART3_GTPR_PSC_Values<USART3::GTPR, 0, 8, ReadWriteMode, USART3GTPRBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USART3_GTPR_PSC_Values<USART3::GTPR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -146,6 +152,7 @@ struct USART3
   {
     using BLEN = USART3_RTOR_BLEN_Values<USART3::RTOR, 24, 8, ReadWriteMode, USART3RTORBase> ;
     using RTO = USART3_RTOR_RTO_Values<USART3::RTOR, 0, 24, ReadWriteMode, USART3RTORBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFFFFFU ;
     using FieldValues = USART3_RTOR_RTO_Values<USART3::RTOR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -216,6 +223,8 @@ struct USART3
     using NCF = USART3_ICR_NCF_Values<USART3::ICR, 2, 1, WriteMode, USART3ICRBase> ;
     using FECF = USART3_ICR_FECF_Values<USART3::ICR, 1, 1, WriteMode, USART3ICRBase> ;
     using PECF = USART3_ICR_PECF_Values<USART3::ICR, 0, 1, WriteMode, USART3ICRBase> ;
+    static constexpr Type WritableMask = 0x121B5FU ;
+    static constexpr Type OneToClearMask = 0x121B5FU ;
     using FieldValues = USART3_ICR_PECF_Values<USART3::ICR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -238,12 +247,14 @@ struct USART3
   struct TDR : public RegisterBase<0x40004828, 32, ReadWriteMode>
   {
     using TDRField = USART3_TDR_TDR_Values<USART3::TDR, 0, 9, ReadWriteMode, USART3TDRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = USART3_TDR_TDR_Values<USART3::TDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using TDRPack  = Register<0x40004828, 32, ReadWriteMode, USART3TDRBase, T...> ;
 
+  using Registers = TypesList<USART3::CR1, USART3::CR2, USART3::CR3, USART3::BRR, USART3::GTPR, USART3::RTOR, USART3::RQR, USART3::ISR, USART3::ICR, USART3::RDR, USART3::TDR> ;
 } ;
 
 #endif //#if !defined(USART3REGISTERS_HPP)
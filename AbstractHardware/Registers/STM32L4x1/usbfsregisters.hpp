@@ -31,6 +31,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP0R_STAT_RX_Values<USB_FS::EP0R, 12, 2, ReadWriteMode, USB_FSEP0RBase> ;
     using DTOG_RX = USB_FS_EP0R_DTOG_RX_Values<USB_FS::EP0R, 14, 1, ReadWriteMode, USB_FSEP0RBase> ;
     using CTR_RX = USB_FS_EP0R_CTR_RX_Values<USB_FS::EP0R, 15, 1, ReadWriteMode, USB_FSEP0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP0R_CTR_RX_Values<USB_FS::EP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +52,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP1R_STAT_RX_Values<USB_FS::EP1R, 12, 2, ReadWriteMode, USB_FSEP1RBase> ;
     using DTOG_RX = USB_FS_EP1R_DTOG_RX_Values<USB_FS::EP1R, 14, 1, ReadWriteMode, USB_FSEP1RBase> ;
     using CTR_RX = USB_FS_EP1R_CTR_RX_Values<USB_FS::EP1R, 15, 1, ReadWriteMode, USB_FSEP1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP1R_CTR_RX_Values<USB_FS::EP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP2R_STAT_RX_Values<USB_FS::EP2R, 12, 2, ReadWriteMode, USB_FSEP2RBase> ;
     using DTOG_RX = USB_FS_EP2R_DTOG_RX_Values<USB_FS::EP2R, 14, 1, ReadWriteMode, USB_FSEP2RBase> ;
     using CTR_RX = USB_FS_EP2R_CTR_RX_Values<USB_FS::EP2R, 15, 1, ReadWriteMode, USB_FSEP2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP2R_CTR_RX_Values<USB_FS::EP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +94,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP3R_STAT_RX_Values<USB_FS::EP3R, 12, 2, ReadWriteMode, USB_FSEP3RBase> ;
     using DTOG_RX = USB_FS_EP3R_DTOG_RX_Values<USB_FS::EP3R, 14, 1, ReadWriteMode, USB_FSEP3RBase> ;
     using CTR_RX = USB_FS_EP3R_CTR_RX_Values<USB_FS::EP3R, 15, 1, ReadWriteMode, USB_FSEP3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP3R_CTR_RX_Values<USB_FS::EP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP4R_STAT_RX_Values<USB_FS::EP4R, 12, 2, ReadWriteMode, USB_FSEP4RBase> ;
     using DTOG_RX = USB_FS_EP4R_DTOG_RX_Values<USB_FS::EP4R, 14, 1, ReadWriteMode, USB_FSEP4RBase> ;
     using CTR_RX = USB_FS_EP4R_CTR_RX_Values<USB_FS::EP4R, 15, 1, ReadWriteMode, USB_FSEP4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP4R_CTR_RX_Values<USB_FS::EP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP5R_STAT_RX_Values<USB_FS::EP5R, 12, 2, ReadWriteMode, USB_FSEP5RBase> ;
     using DTOG_RX = USB_FS_EP5R_DTOG_RX_Values<USB_FS::EP5R, 14, 1, ReadWriteMode, USB_FSEP5RBase> ;
     using CTR_RX = USB_FS_EP5R_CTR_RX_Values<USB_FS::EP5R, 15, 1, ReadWriteMode, USB_FSEP5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP5R_CTR_RX_Values<USB_FS::EP5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +157,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP6R_STAT_RX_Values<USB_FS::EP6R, 12, 2, ReadWriteMode, USB_FSEP6RBase> ;
     using DTOG_RX = USB_FS_EP6R_DTOG_RX_Values<USB_FS::EP6R, 14, 1, ReadWriteMode, USB_FSEP6RBase> ;
     using CTR_RX = USB_FS_EP6R_CTR_RX_Values<USB_FS::EP6R, 15, 1, ReadWriteMode, USB_FSEP6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP6R_CTR_RX_Values<USB_FS::EP6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +178,7 @@ struct USB_FS
     using STAT_RX = USB_FS_EP7R_STAT_RX_Values<USB_FS::EP7R, 12, 2, ReadWriteMode, USB_FSEP7RBase> ;
     using DTOG_RX = USB_FS_EP7R_DTOG_RX_Values<USB_FS::EP7R, 14, 1, ReadWriteMode, USB_FSEP7RBase> ;
     using CTR_RX = USB_FS_EP7R_CTR_RX_Values<USB_FS::EP7R, 15, 1, ReadWriteMode, USB_FSEP7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_FS_EP7R_CTR_RX_Values<USB_FS::EP7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +204,7 @@ struct USB_FS
     using ERRM = USB_FS_CNTR_ERRM_Values<USB_FS::CNTR, 13, 1, ReadWriteMode, USB_FSCNTRBase> ;
     using PMAOVRM = USB_FS_CNTR_PMAOVRM_Values<USB_FS::CNTR, 14, 1, ReadWriteMode, USB_FSCNTRBase> ;
     using CTRM = USB_FS_CNTR_CTRM_Values<USB_FS::CNTR, 15, 1, ReadWriteMode, USB_FSCNTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
     using FieldValues = USB_FS_CNTR_CTRM_Values<USB_FS::CNTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -217,6 +226,7 @@ struct USB_FS
     using ERR = USB_FS_ISTR_ERR_Values<USB_FS::ISTR, 13, 1, ReadWriteMode, USB_FSISTRBase> ;
     using PMAOVR = USB_FS_ISTR_PMAOVR_Values<USB_FS::ISTR, 14, 1, ReadWriteMode, USB_FSISTRBase> ;
     using CTR = USB_FS_ISTR_CTR_Values<USB_FS::ISTR, 15, 1, ReadMode, USB_FSISTRBase> ;
+    static constexpr Type SnapshotMask = 0x7F80U ;
     using FieldValues = USB_FS_ISTR_CTR_Values<USB_FS::ISTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -244,6 +254,7 @@ struct USB_FS
   {
     using ADD = USB_FS_DADDR_ADD_Values<USB_FS::DADDR, 0, 7, ReadWriteMode, USB_FSDADDRBase> ;
     using EF = USB_FS_DADDR_EF_Values<USB_FS::DADDR, 7, 1, ReadWriteMode, USB_FSDADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = USB_FS_DADDR_EF_Values<USB_FS::DADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +266,7 @@ struct USB_FS
   struct BTABLE : public RegisterBase<0x40006850, 32, ReadWriteMode>
   {
     using BTABLEField = USB_FS_BTABLE_BTABLE_Values<USB_FS::BTABLE, 3, 13, ReadWriteMode, USB_FSBTABLEBase> ;
+    static constexpr Type SnapshotMask = 0xFFF8U ;
     using FieldValues = USB_FS_BTABLE_BTABLE_Values<USB_FS::BTABLE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -269,6 +281,7 @@ struct USB_FS
     using LPMACK = USB_FS_LPMCSR_LPMACK_Values<USB_FS::LPMCSR, 1, 1, ReadWriteMode, USB_FSLPMCSRBase> ;
     using REMWAKE = USB_FS_LPMCSR_REMWAKE_Values<USB_FS::LPMCSR, 3, 1, ReadMode, USB_FSLPMCSRBase> ;
     using BESL = USB_FS_LPMCSR_BESL_Values<USB_FS::LPMCSR, 4, 4, ReadMode, USB_FSLPMCSRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = USB_FS_LPMCSR_BESL_Values<USB_FS::LPMCSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -288,12 +301,14 @@ struct USB_FS
     using SDET = USB_FS_BCDR_SDET_Values<USB_FS::BCDR, 6, 1, ReadMode, USB_FSBCDRBase> ;
     using PS2DET = USB_FS_BCDR_PS2DET_Values<USB_FS::BCDR, 7, 1, ReadMode, USB_FSBCDRBase> ;
     using DPPU = USB_FS_BCDR_DPPU_Values<USB_FS::BCDR, 15, 1, ReadWriteMode, USB_FSBCDRBase> ;
+    static constexpr Type SnapshotMask = 0x800FU ;
     using FieldValues = USB_FS_BCDR_DPPU_Values<USB_FS::BCDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BCDRPack  = Register<0x40006858, 32, ReadWriteMode, USB_FSBCDRBase, T...> ;
 
+  using Registers = TypesList<USB_FS::EP0R, USB_FS::EP1R, USB_FS::EP2R, USB_FS::EP3R, USB_FS::EP4R, USB_FS::EP5R, USB_FS::EP6R, USB_FS::EP7R, USB_FS::CNTR, USB_FS::ISTR, USB_FS::FNR, USB_FS::DADDR, USB_FS::BTABLE, USB_FS::LPMCSR, USB_FS::BCDR> ;
 } ;
 
 #endif //#if !defined(USBFSREGISTERS_HPP)
@@ -31,6 +31,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP0R_STAT_RX_Values<USB_SRAM::EP0R, 12, 2, ReadWriteMode, USB_SRAMEP0RBase> ;
     using DTOG_RX = USB_SRAM_EP0R_DTOG_RX_Values<USB_SRAM::EP0R, 14, 1, ReadWriteMode, USB_SRAMEP0RBase> ;
     using CTR_RX = USB_SRAM_EP0R_CTR_RX_Values<USB_SRAM::EP0R, 15, 1, ReadWriteMode, USB_SRAMEP0RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP0R_CTR_RX_Values<USB_SRAM::EP0R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -51,6 +52,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP1R_STAT_RX_Values<USB_SRAM::EP1R, 12, 2, ReadWriteMode, USB_SRAMEP1RBase> ;
     using DTOG_RX = USB_SRAM_EP1R_DTOG_RX_Values<USB_SRAM::EP1R, 14, 1, ReadWriteMode, USB_SRAMEP1RBase> ;
     using CTR_RX = USB_SRAM_EP1R_CTR_RX_Values<USB_SRAM::EP1R, 15, 1, ReadWriteMode, USB_SRAMEP1RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP1R_CTR_RX_Values<USB_SRAM::EP1R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -71,6 +73,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP2R_STAT_RX_Values<USB_SRAM::EP2R, 12, 2, ReadWriteMode, USB_SRAMEP2RBase> ;
     using DTOG_RX = USB_SRAM_EP2R_DTOG_RX_Values<USB_SRAM::EP2R, 14, 1, ReadWriteMode, USB_SRAMEP2RBase> ;
     using CTR_RX = USB_SRAM_EP2R_CTR_RX_Values<USB_SRAM::EP2R, 15, 1, ReadWriteMode, USB_SRAMEP2RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP2R_CTR_RX_Values<USB_SRAM::EP2R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -91,6 +94,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP3R_STAT_RX_Values<USB_SRAM::EP3R, 12, 2, ReadWriteMode, USB_SRAMEP3RBase> ;
     using DTOG_RX = USB_SRAM_EP3R_DTOG_RX_Values<USB_SRAM::EP3R, 14, 1, ReadWriteMode, USB_SRAMEP3RBase> ;
     using CTR_RX = USB_SRAM_EP3R_CTR_RX_Values<USB_SRAM::EP3R, 15, 1, ReadWriteMode, USB_SRAMEP3RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP3R_CTR_RX_Values<USB_SRAM::EP3R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -111,6 +115,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP4R_STAT_RX_Values<USB_SRAM::EP4R, 12, 2, ReadWriteMode, USB_SRAMEP4RBase> ;
     using DTOG_RX = USB_SRAM_EP4R_DTOG_RX_Values<USB_SRAM::EP4R, 14, 1, ReadWriteMode, USB_SRAMEP4RBase> ;
     using CTR_RX = USB_SRAM_EP4R_CTR_RX_Values<USB_SRAM::EP4R, 15, 1, ReadWriteMode, USB_SRAMEP4RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP4R_CTR_RX_Values<USB_SRAM::EP4R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -131,6 +136,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP5R_STAT_RX_Values<USB_SRAM::EP5R, 12, 2, ReadWriteMode, USB_SRAMEP5RBase> ;
     using DTOG_RX = USB_SRAM_EP5R_DTOG_RX_Values<USB_SRAM::EP5R, 14, 1, ReadWriteMode, USB_SRAMEP5RBase> ;
     using CTR_RX = USB_SRAM_EP5R_CTR_RX_Values<USB_SRAM::EP5R, 15, 1, ReadWriteMode, USB_SRAMEP5RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP5R_CTR_RX_Values<USB_SRAM::EP5R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -151,6 +157,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP6R_STAT_RX_Values<USB_SRAM::EP6R, 12, 2, ReadWriteMode, USB_SRAMEP6RBase> ;
     using DTOG_RX = USB_SRAM_EP6R_DTOG_RX_Values<USB_SRAM::EP6R, 14, 1, ReadWriteMode, USB_SRAMEP6RBase> ;
     using CTR_RX = USB_SRAM_EP6R_CTR_RX_Values<USB_SRAM::EP6R, 15, 1, ReadWriteMode, USB_SRAMEP6RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP6R_CTR_RX_Values<USB_SRAM::EP6R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -171,6 +178,7 @@ struct USB_SRAM
     using STAT_RX = USB_SRAM_EP7R_STAT_RX_Values<USB_SRAM::EP7R, 12, 2, ReadWriteMode, USB_SRAMEP7RBase> ;
     using DTOG_RX = USB_SRAM_EP7R_DTOG_RX_Values<USB_SRAM::EP7R, 14, 1, ReadWriteMode, USB_SRAMEP7RBase> ;
     using CTR_RX = USB_SRAM_EP7R_CTR_RX_Values<USB_SRAM::EP7R, 15, 1, ReadWriteMode, USB_SRAMEP7RBase> ;
+    static constexpr Type SnapshotMask = 0xFFFFU ;
     using FieldValues = USB_SRAM_EP7R_CTR_RX_Values<USB_SRAM::EP7R, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -196,6 +204,7 @@ struct USB_SRAM
     using ERRM = USB_SRAM_CNTR_ERRM_Values<USB_SRAM::CNTR, 13, 1, ReadWriteMode, USB_SRAMCNTRBase> ;
     using PMAOVRM = USB_SRAM_CNTR_PMAOVRM_Values<USB_SRAM::CNTR, 14, 1, ReadWriteMode, USB_SRAMCNTRBase> ;
     using CTRM = USB_SRAM_CNTR_CTRM_Values<USB_SRAM::CNTR, 15, 1, ReadWriteMode, USB_SRAMCNTRBase> ;
+    static constexpr Type SnapshotMask = 0xFFBFU ;
     using FieldValues = USB_SRAM_CNTR_CTRM_Values<USB_SRAM::CNTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -217,6 +226,7 @@ struct USB_SRAM
     using ERR = USB_SRAM_ISTR_ERR_Values<USB_SRAM::ISTR, 13, 1, ReadWriteMode, USB_SRAMISTRBase> ;
     using PMAOVR = USB_SRAM_ISTR_PMAOVR_Values<USB_SRAM::ISTR, 14, 1, ReadWriteMode, USB_SRAMISTRBase> ;
     using CTR = USB_SRAM_ISTR_CTR_Values<USB_SRAM::ISTR, 15, 1, ReadMode, USB_SRAMISTRBase> ;
+    static constexpr Type SnapshotMask = 0x7F80U ;
     using FieldValues = USB_SRAM_ISTR_CTR_Values<USB_SRAM::ISTR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -244,6 +254,7 @@ struct USB_SRAM
   {
     using ADD = USB_SRAM_DADDR_ADD_Values<USB_SRAM::DADDR, 0, 7, ReadWriteMode, USB_SRAMDADDRBase> ;
     using EF = USB_SRAM_DADDR_EF_Values<USB_SRAM::DADDR, 7, 1, ReadWriteMode, USB_SRAMDADDRBase> ;
+    static constexpr Type SnapshotMask = 0xFFU ;
     using FieldValues = USB_SRAM_DADDR_EF_Values<USB_SRAM::DADDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -255,6 +266,7 @@ struct USB_SRAM
   struct BTABLE : public RegisterBase<0x40006C50, 32, ReadWriteMode>
   {
     using BTABLEField = USB_SRAM_BTABLE_BTABLE_Values<USB_SRAM::BTABLE, 3, 13, ReadWriteMode, USB_SRAMBTABLEBase> ;
+    static constexpr Type SnapshotMask = 0xFFF8U ;
     using FieldValues = USB_SRAM_BTABLE_BTABLE_Values<USB_SRAM::BTABLE, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -269,6 +281,7 @@ struct USB_SRAM
     using LPMACK = USB_SRAM_LPMCSR_LPMACK_Values<USB_SRAM::LPMCSR, 1, 1, ReadWriteMode, USB_SRAMLPMCSRBase> ;
     using REMWAKE = USB_SRAM_LPMCSR_REMWAKE_Values<USB_SRAM::LPMCSR, 3, 1, ReadMode, USB_SRAMLPMCSRBase> ;
     using BESL = USB_SRAM_LPMCSR_BESL_Values<USB_SRAM::LPMCSR, 4, 4, ReadMode, USB_SRAMLPMCSRBase> ;
+    static constexpr Type SnapshotMask = 0x3U ;
     using FieldValues = USB_SRAM_LPMCSR_BESL_Values<USB_SRAM::LPMCSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -288,12 +301,14 @@ struct USB_SRAM
     using SDET = USB_SRAM_BCDR_SDET_Values<USB_SRAM::BCDR, 6, 1, ReadMode, USB_SRAMBCDRBase> ;
     using PS2DET = USB_SRAM_BCDR_PS2DET_Values<USB_SRAM::BCDR, 7, 1, ReadMode, USB_SRAMBCDRBase> ;
     using DPPU = USB_SRAM_BCDR_DPPU_Values<USB_SRAM::BCDR, 15, 1, ReadWriteMode, USB_SRAMBCDRBase> ;
+    static constexpr Type SnapshotMask = 0x800FU ;
     using FieldValues = USB_SRAM_BCDR_DPPU_Values<USB_SRAM::BCDR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using BCDRPack  = Register<0x40006C58, 32, ReadWriteMode, USB_SRAMBCDRBase, T...> ;
 
+  using Registers = TypesList<USB_SRAM::EP0R, USB_SRAM::EP1R, USB_SRAM::EP2R, USB_SRAM::EP3R, USB_SRAM::EP4R, USB_SRAM::EP5R, USB_SRAM::EP6R, USB_SRAM::EP7R, USB_SRAM::CNTR, USB_SRAM::ISTR, USB_SRAM::FNR, USB_SRAM::DADDR, USB_SRAM::BTABLE, USB_SRAM::LPMCSR, USB_SRAM::BCDR> ;
 } ;
 
 #endif //#if !defined(USBSRAMREGISTERS_HPP)
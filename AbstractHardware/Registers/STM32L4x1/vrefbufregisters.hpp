@@ -25,6 +25,7 @@ struct VREFBUF
     using HIZ = VREFBUF_CSR_HIZ_Values<VREFBUF::CSR, 1, 1, ReadWriteMode, VREFBUFCSRBase> ;
     using VRS = VREFBUF_CSR_VRS_Values<VREFBUF::CSR, 2, 1, ReadWriteMode, VREFBUFCSRBase> ;
     using VRR = VREFBUF_CSR_VRR_Values<VREFBUF::CSR, 3, 1, ReadMode, VREFBUFCSRBase> ;
+    static constexpr Type SnapshotMask = 0x0U ;
     using FieldValues = VREFBUF_CSR_VRR_Values<VREFBUF::CSR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
@@ -36,12 +37,14 @@ struct VREFBUF
   struct CCR : public RegisterBase<0x40010034, 32, ReadWriteMode>
   {
     using TRIM = VREFBUF_CCR_TRIM_Values<VREFBUF::CCR, 0, 6, ReadWriteMode, VREFBUFCCRBase> ;
+    static constexpr Type SnapshotMask = 0x3FU ;
     using FieldValues = VREFBUF_CCR_TRIM_Values<VREFBUF::CCR, 0, 0, NoAccess, NoAccess> ;
   } ;
 
   template<typename... T> 
   using CCRPack  = Register<0x40010034, 32, ReadWriteMode, VREFBUFCCRBase, T...> ;
 
+  using Registers = TypesList<VREFBUF::CSR, VREFBUF::CCR> ;
 } ;
 
 #endif //#if !defined(VREFBUFREGISTERS_HPP)
@@ -0,0 +1,43 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>             //for std::size_t
+#include <cstdint>             //for std::uint32_t, std::uintptr_t
+#include <type_traits>         //for std::is_same
+#include "memoryaccess.hpp"    //for VolatileMemoryAccess, UnderlyingMemoryAccess
+#include "devicetraits.hpp"    //for DeviceTraits
+#include "registertraits.hpp"  //for RegisterZeroToClearMask, RegisterOneToClearMask
+
+//Класс для работы с битом регистра через область псевдонимов bit-band. Запись в псевдоним выполняется одной
+//командой сохранения и не затрагивает остальные биты регистра, поэтому не требует критической секции.
+//Используется только если микроконтроллер поддерживает bit-band (см. DeviceTraits), регистр лежит в области
+//периферии и доступ идет напрямую к памяти, а не к эмулированным регистрам. Для регистров с флагами, которые
+//сбрасываются записью, bit-band не используется: шина выполняет чтение-модификацию-запись всего слова и
+//записывает обратно прочитанные значения флагов.
+template<typename Reg, std::size_t offset, std::size_t size>
+struct BitBand
+{
+  static constexpr bool IsAvailable = DeviceTraits::IsBitBandSupported &&
+                                      (size == 1U) &&
+                                      (RegisterZeroToClearMask<Reg>::Value == 0U) &&
+                                      (RegisterOneToClearMask<Reg>::Value == 0U) &&
+                                      std::is_same<typename UnderlyingMemoryAccess<typename Reg::Memory>::Type,
+                                                   VolatileMemoryAccess>::value &&
+                                      (Reg::Address >= DeviceTraits::PeripheralBase) &&
+                                      (Reg::Address < (DeviceTraits::PeripheralBase + DeviceTraits::PeripheralSize)) ;
+
+  //Адрес слова псевдонима, каждому байту области периферии соответствует 8 слов псевдонимов
+  static constexpr std::uintptr_t Alias = DeviceTraits::PeripheralBitBandBase +
+                                          (Reg::Address - DeviceTraits::PeripheralBase) * 32U + offset * 4U ;
+
+  //Метод записывает значение бита через псевдоним. Запись идет через политику доступа регистра, поэтому
+  //при включенной трассировке попадает в нее с адресом псевдонима
+  __forceinline static void Write(std::uint32_t value)
+  {
+    static_assert(IsAvailable, "Bit-band is not available for this field") ;
+    Reg::Memory::template Write<std::uint32_t>(Alias, value) ;
+  }
+} ;
@@ -0,0 +1,91 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>            //for std::uint32_t
+#include <type_traits>        //for std::is_same, std::enable_if_t
+#include "buses.hpp"          //for BusCost
+#include "registertraits.hpp" //for RegisterBus, SetPromotion, RegisterSetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+#include "registerwriter.hpp" //for RegisterWriter
+
+//Оценка стоимости обращений к регистрам на этапе компиляции. Стоимость считается по шине периферии
+//(генератор указывает ее для каждой периферии) и оценкам BusCost из devicetraits.hpp. Позволяет проверить
+//бюджет тактов обработчика прерывания, например:
+//static_assert((FieldValueCost<TIM2::SR::UIF::NoInterruptPending>::Set +
+//               RegisterCost<USART2::DR>::Write).Cycles <= 20U, "ISR is too slow") ;
+struct AccessCost
+{
+  std::uint32_t Reads ;
+  std::uint32_t Writes ;
+  std::uint32_t Cycles ;
+
+  constexpr AccessCost operator+(const AccessCost& other) const
+  {
+    return AccessCost{Reads + other.Reads, Writes + other.Writes, Cycles + other.Cycles} ;
+  }
+
+  constexpr AccessCost operator*(std::uint32_t times) const
+  {
+    return AccessCost{Reads * times, Writes * times, Cycles * times} ;
+  }
+} ;
+
+//Стоимость обращений к регистру: чтения, записи и чтения-модификации-записи
+template<typename Reg>
+struct RegisterCost
+{
+  using Bus = typename RegisterBus<Reg>::Type ;
+  static constexpr AccessCost Read = AccessCost{1U, 0U, BusCost<Bus>::ReadCycles} ;
+  static constexpr AccessCost Write = AccessCost{0U, 1U, BusCost<Bus>::WriteCycles} ;
+  static constexpr AccessCost Set = Read + Write ;
+} ;
+
+//Стоимость установки битовых полей регистра. Если у регистра есть регистр установки и сброса, то установка
+//стоит одну запись в него. Установка однобитового поля через псевдоним bit-band для ядра стоит одну запись,
+//чтение-модификацию-запись выполняет шина. Установка полей, которые перекрывают все доступные для записи
+//биты регистра, тоже стоит одну запись (см. SetPromotion), как и установка полей регистра, у которого остальные
+//доступные для записи биты - флаги, сбрасываемые записью (см. ClearOnWrite)
+template<typename Reg, typename Reg::Type mask, typename = void>
+struct RegisterSetCost
+{
+  static constexpr AccessCost Value = (RegisterWriter<Reg>::template IsBitBand<mask>() ||
+                                       SetPromotion<Reg, mask>::IsPromoted ||
+                                       (ClearOnWrite<Reg>::IsAvailable && ClearOnWrite<Reg>::IsSingleStore(mask))) ?
+                                      RegisterCost<Reg>::Write : RegisterCost<Reg>::Set ;
+} ;
+
+template<typename Reg, typename Reg::Type mask>
+struct RegisterSetCost<Reg, mask, std::enable_if_t<RegisterSetReset<Reg>::IsAvailable>>
+{
+  static constexpr AccessCost Value = RegisterCost<typename RegisterSetReset<Reg>::Type>::Write ;
+} ;
+
+//Стоимость методов значения битового поля
+template<typename FieldValue>
+struct FieldValueCost
+{
+  using Field = typename FieldValue::FieldType ;
+  using Reg = typename Field::Register ;
+  static constexpr AccessCost Set =
+    RegisterSetCost<Reg, static_cast<typename Reg::Type>(Field::Mask << Field::Offset)>::Value ;
+  static constexpr AccessCost Write = RegisterCost<Reg>::Write ;
+  static constexpr AccessCost IsSet = RegisterCost<Reg>::Read ;
+} ;
+
+//Стоимость методов набора битовых полей одного регистра (Register<...>)
+template<typename FieldValue, typename ...FieldValues>
+struct RegisterPackCost
+{
+  using Reg = typename FieldValue::FieldType::Register ;
+  static_assert((std::is_same<Reg, typename FieldValues::FieldType::Register>::value && ...),
+                "All field values must belong to the same register") ;
+  static constexpr typename Reg::Type Mask = static_cast<typename Reg::Type>(
+    (static_cast<typename Reg::Type>(FieldValue::Mask << FieldValue::Offset) | ... |
+     static_cast<typename Reg::Type>(FieldValues::Mask << FieldValues::Offset))) ;
+  static constexpr AccessCost Set = RegisterSetCost<Reg, Mask>::Value ;
+  static constexpr AccessCost Write = RegisterCost<Reg>::Write ;
+  static constexpr AccessCost IsSet = RegisterCost<Reg>::Read ;
+} ;
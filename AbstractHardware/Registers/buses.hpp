@@ -0,0 +1,26 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>      //for std::uint32_t
+
+//Шины, к которым подключена периферия. Генератор указывает шину для каждой периферии (using Bus = ...),
+//шина определяет и домен тактирования периферии
+struct Ahb1Bus {} ;
+struct Ahb2Bus {} ;
+struct Ahb3Bus {} ;
+struct Apb1Bus {} ;
+struct Apb2Bus {} ;
+struct PpbBus {} ;      //Внутренняя шина ядра (NVIC, SCB, SysTick)
+struct UnknownBus {} ;
+
+//Оценка стоимости одного обращения к регистру на шине в тактах ядра. Значения по умолчанию соответствуют
+//обращению без ожидания, для конкретного микроконтроллера они уточняются в devicetraits.hpp
+template<typename Bus>
+struct BusCost
+{
+  static constexpr std::uint32_t ReadCycles = 2U ;
+  static constexpr std::uint32_t WriteCycles = 1U ;
+} ;
@@ -0,0 +1,74 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include "susudefs.hpp"       //for __forceinline
+#include "registertraits.hpp" //for RegisterZeroToClearMask, RegisterOneToClearMask, RegisterWritableMask
+
+//Класс для изменения регистров с флагами, которые сбрасываются записью (rc_w0, rc_w1). Чтение-модификация-запись
+//такого регистра записывает обратно прочитанные значения флагов: для rc_w1 это сбрасывает все установленные флаги,
+//а для rc_w0 - флаги, которые аппаратура установила между чтением и записью, и прерывание теряется. Поэтому
+//остальные флаги всегда записываются значением, которое их не изменяет (1 для rc_w0, 0 для rc_w1). Если кроме
+//флагов и изменяемых полей в регистре нет доступных для записи битов, то регистр не читается, например,
+//TIM2::SR::UIF::Clear() - одна запись 0x1E5E в TIM2::SR.
+template<typename Reg>
+struct ClearOnWrite
+{
+  using Type = typename Reg::Type ;
+  static constexpr Type ZeroToClear = RegisterZeroToClearMask<Reg>::Value ;
+  static constexpr Type OneToClear = RegisterOneToClearMask<Reg>::Value ;
+  static constexpr Type ClearMask = static_cast<Type>(ZeroToClear | OneToClear) ;
+  static constexpr bool IsAvailable = (ClearMask != 0U) ;
+
+  //Метод проверяет, что при изменении битов mask регистр не нужно читать
+  static constexpr bool IsSingleStore(Type mask)
+  {
+    return (RegisterWritableMask<Reg>::Value & static_cast<Type>(~static_cast<Type>(mask | ClearMask))) == 0U ;
+  }
+
+  //Метод записывает value в биты mask, остальные флаги регистра не изменяются
+  __forceinline template<Type mask>
+  static void Update(Type value)
+  {
+    constexpr Type noEffect = static_cast<Type>(ZeroToClear & static_cast<Type>(~mask)) ;
+    if constexpr (IsSingleStore(mask))
+    {
+      Reg::Memory::template Write<Type>(Reg::Address, static_cast<Type>(noEffect | (value & mask))) ;
+    }
+    else
+    {
+      Type newRegValue = Reg::Memory::template Read<Type>(Reg::Address) ;
+      newRegValue &= static_cast<Type>(~static_cast<Type>(mask | ClearMask)) ;
+      newRegValue |= static_cast<Type>(noEffect | (value & mask)) ;
+      Reg::Memory::template Write<Type>(Reg::Address, newRegValue) ;
+    }
+  }
+
+  //Метод записывает value в биты mask, известные только во время выполнения (поле FieldArray). Без чтения
+  //регистра можно обойтись, только если все его доступные для записи биты - флаги
+  __forceinline static void Update(Type mask, Type value)
+  {
+    const Type noEffect = static_cast<Type>(ZeroToClear & static_cast<Type>(~mask)) ;
+    if constexpr (IsSingleStore(0U))
+    {
+      Reg::Memory::template Write<Type>(Reg::Address, static_cast<Type>(noEffect | (value & mask))) ;
+    }
+    else
+    {
+      Type newRegValue = Reg::Memory::template Read<Type>(Reg::Address) ;
+      newRegValue &= static_cast<Type>(~static_cast<Type>(mask | ClearMask)) ;
+      newRegValue |= static_cast<Type>(noEffect | (value & mask)) ;
+      Reg::Memory::template Write<Type>(Reg::Address, newRegValue) ;
+    }
+  }
+
+  //Метод сбрасывает флаги mask
+  __forceinline template<Type mask>
+  static void Clear()
+  {
+    static_assert((mask & static_cast<Type>(~ClearMask)) == 0U, "Bits are not cleared by write") ;
+    Update<mask>(static_cast<Type>(mask & OneToClear)) ;
+  }
+} ;
@@ -0,0 +1,149 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cassert>            //for assert
+#include <cstddef>            //for std::size_t
+#include <tuple>              //for std::tuple, std::tuple_element_t
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include <utility>            //for std::index_sequence
+#include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline
+#include "atomicutils.hpp"    //for AtomicUtils
+#include "memoryaccess.hpp"   //for DefaultMemoryAccess
+#include "registertraits.hpp" //for RegisterSetReset
+#include "setreset.hpp"       //for SetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+#include "registerwriter.hpp" //for RegisterWriter
+
+//Тип из списка по индексу, нумерация списка начинается с firstIndex. Генератор использует его для массивов
+//регистров, например, DMA2::S<3>::NDTR - то же, что DMA2::S3NDTR
+template<std::size_t index, std::size_t firstIndex, typename ...Types>
+using IndexedType = std::tuple_element_t<index - firstIndex, std::tuple<Types...>> ;
+
+//Функция проверяет, что смещения полей массива растут с постоянным шагом
+template<typename ...Fields, std::size_t ...Indexes>
+constexpr bool IsEquallySpaced(std::index_sequence<Indexes...>)
+{
+  if constexpr (sizeof...(Fields) > 1U)
+  {
+    using First = IndexedType<0U, 0U, Fields...> ;
+    constexpr auto stride = IndexedType<1U, 0U, Fields...>::Offset - First::Offset ;
+    return ((IndexedType<Indexes, 0U, Fields...>::Offset == First::Offset + stride * Indexes) && ...) ;
+  }
+  else
+  {
+    return true ;
+  }
+}
+
+//Массив одинаковых битовых полей регистра с постоянным шагом (MODER0..MODER15, AFRL0..AFRL7, SQ1..SQ6).
+//Поле выбирается по индексу на этапе компиляции: GPIOA::MODER::Field<5> - то же, что GPIOA::MODER::MODER5,
+//или во время выполнения, тогда смещение поля вычисляется по шагу массива:
+//GPIOA::MODER::MODERArray::SetAtomic(pin, GPIOA::MODER::FieldValues::Output::Value) ;
+template<std::size_t firstIndex, typename First, typename ...Rest>
+struct FieldArray
+{
+  using Register = typename First::Register ;
+  using RegType = typename Register::Type ;
+  using Memory = typename Register::Memory ;
+  using Access = typename First::Access ;
+
+  static constexpr std::size_t FirstIndex = firstIndex ;
+  static constexpr std::size_t Count = sizeof...(Rest) + 1U ;
+  static constexpr RegType Mask = First::Mask ;
+  static constexpr RegType FirstOffset = First::Offset ;
+
+  //Шаг массива - разность смещений первых двух полей, массив из одного поля считается плотным
+  static constexpr RegType Stride = (Count > 1U) ?
+    static_cast<RegType>(IndexedType<(Count > 1U) ? 1U : 0U, 0U, First, Rest...>::Offset - FirstOffset) : First::Size ;
+
+  static_assert((std::is_same<Register, typename Rest::Register>::value && ...),
+                "All fields must belong to the same register") ;
+  static_assert(((Rest::Size == First::Size) && ...) && (Stride >= First::Size),
+                "All fields must have the same size and must not overlap") ;
+  static_assert((std::is_same<Access, typename Rest::Access>::value && ...),
+                "All fields must have the same access mode") ;
+  static_assert(IsEquallySpaced<First, Rest...>(std::make_index_sequence<Count>()),
+                "Fields must follow with a constant stride") ;
+
+  template<std::size_t index>
+  using Field = IndexedType<index, firstIndex, First, Rest...> ;
+
+  //Метод возвращает смещение поля с индексом, известным только во время выполнения
+  __forceinline static constexpr RegType GetOffset(std::size_t index)
+  {
+    return static_cast<RegType>(FirstOffset + Stride * (index - firstIndex)) ;
+  }
+
+  //Метод устанавливает значение поля, только в случае, если оно доступно для записи
+  __forceinline template<typename T = Access, class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
+  static void Set(std::size_t index, RegType value)
+  {
+    assert((index >= firstIndex) && (index < firstIndex + Count)) ;
+    assert(value <= Mask) ;
+    const RegType offset = GetOffset(index) ;
+    RegisterWriter<Register>::Update(static_cast<RegType>(Mask << offset), static_cast<RegType>(value << offset)) ;
+  }
+
+  //Метод атомарно устанавливает значение поля, поэтому его можно вызывать одновременно из задачи и из
+  //прерывания для разных полей одного регистра. Способ выбирается по архитектуре (см. AtomicUtils)
+  __forceinline template<typename T = Access, class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
+  static void SetAtomic(std::size_t index, RegType value)
+  {
+    assert((index >= firstIndex) && (index < firstIndex + Count)) ;
+    assert(value <= Mask) ;
+    if constexpr (RegisterSetReset<Register>::IsAvailable)
+    {
+      const RegType offset = GetOffset(index) ;
+      SetReset<Register>::Update(static_cast<RegType>(Mask << offset), static_cast<RegType>(value << offset)) ;
+    }
+    else if constexpr (ClearOnWrite<Register>::IsAvailable)
+    {
+      static_assert(ClearOnWrite<Register>::IsSingleStore(0U),
+                    "Register with clear-on-write flags can be changed atomically only by a single store") ;
+      const RegType offset = GetOffset(index) ;
+      ClearOnWrite<Register>::Update(static_cast<RegType>(Mask << offset), static_cast<RegType>(value << offset)) ;
+    }
+    else if constexpr (std::is_same<Memory, DefaultMemoryAccess>::value)
+    {
+      AtomicUtils<RegType>::Set(Register::Address, Mask, value, GetOffset(index)) ;
+    }
+    else
+    {
+      Set(index, value) ; //Для собственной политики доступа к памяти атомарность обеспечивает сама политика
+    }
+  }
+
+  //Метод записывает значение поля в регистр только для записи, остальные поля записываются равными 0
+  __forceinline template<typename T = Access, class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value>>
+  static void Write(std::size_t index, RegType value)
+  {
+    assert((index >= firstIndex) && (index < firstIndex + Count)) ;
+    assert(value <= Mask) ;
+    Memory::template Write<RegType>(Register::Address, static_cast<RegType>(value << GetOffset(index))) ;
+  }
+
+  //Метод сбрасывает флаг поля, который сбрасывается записью, например, EXTI::PR::PRArray::Clear(line)
+  //(см. ClearOnWrite)
+  __forceinline template<typename T = Access, class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value ||
+                                                                               std::is_base_of<ReadWriteMode, T>::value>>
+  static void Clear(std::size_t index)
+  {
+    assert((index >= firstIndex) && (index < firstIndex + Count)) ;
+    const RegType fieldMask = static_cast<RegType>(Mask << GetOffset(index)) ;
+    assert((fieldMask & static_cast<RegType>(~ClearOnWrite<Register>::ClearMask)) == 0U) ;
+    ClearOnWrite<Register>::Update(fieldMask, static_cast<RegType>(fieldMask & ClearOnWrite<Register>::OneToClear)) ;
+  }
+
+  //Метод возвращает значение поля, только в случае, если оно доступно для чтения
+  __forceinline template<typename T = Access,
+    class = typename std::enable_if_t<std::is_base_of<ReadMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
+  static RegType Get(std::size_t index)
+  {
+    assert((index >= firstIndex) && (index < firstIndex + Count)) ;
+    return static_cast<RegType>((Memory::template Read<RegType>(Register::Address) >> GetOffset(index)) & Mask) ;
+  }
+} ;
@@ -0,0 +1,93 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cassert>            //for assert
+#include <cstddef>            //for std::size_t
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include "accessmode.hpp"     //for ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline
+#include "atomicutils.hpp"    //for AtomicUtils
+#include "memoryaccess.hpp"   //for DefaultMemoryAccess
+#include "registertraits.hpp" //for RegisterSetReset
+#include "setreset.hpp"       //for SetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+#include "registerwriter.hpp" //for RegisterWriter
+
+//Класс для установки значений, известных только во время выполнения, сразу в нескольких битовых полях
+//одного регистра. Маска полей вычисляется на этапе компиляции, значения объединяются и регистр изменяется
+//за одно чтение и одну запись, например:
+//FieldsUpdate<TIM2::CCMR1_Output::OC1M, TIM2::CCMR1_Output::OC1PE>::Set(mode, preload) ;
+template<typename Field, typename ...Fields>
+struct FieldsUpdate
+{
+  using Reg = typename Field::Register ;
+  using RegType = typename Reg::Type ;
+  using Memory = typename Reg::Memory ;
+
+  static_assert((std::is_same<Reg, typename Fields::Register>::value && ...),
+                "All fields must belong to the same register") ;
+  static_assert(std::is_base_of<ReadWriteMode, typename Field::Access>::value &&
+                (std::is_base_of<ReadWriteMode, typename Fields::Access>::value && ...),
+                "All fields must be readable and writable") ;
+
+  static constexpr RegType Mask = static_cast<RegType>(
+    (static_cast<RegType>(Field::Mask << Field::Offset) | ... | static_cast<RegType>(Fields::Mask << Fields::Offset))) ;
+
+  //Метод устанавливает значения битовых полей, значения передаются в порядке полей
+  __forceinline static void Set(RegType value, typename Fields::RegType ...values)
+  {
+    static_assert(!HasIdentFields(), "There is the same field type") ;
+    RegisterWriter<Reg>::template Update<Mask>(GetValue(value, values...)) ;
+  }
+
+  //Метод атомарно устанавливает значения битовых полей, поэтому его можно вызывать одновременно из задачи
+  //и из прерывания для разных полей одного регистра. Способ выбирается по архитектуре (см. AtomicUtils)
+  __forceinline static void SetAtomic(RegType value, typename Fields::RegType ...values)
+  {
+    static_assert(!HasIdentFields(), "There is the same field type") ;
+    const RegType newValue = GetValue(value, values...) ;
+    if constexpr (RegisterSetReset<Reg>::IsAvailable)
+    {
+      SetReset<Reg>::Update(Mask, newValue) ;
+    }
+    else if constexpr (ClearOnWrite<Reg>::IsAvailable)
+    {
+      static_assert(ClearOnWrite<Reg>::IsSingleStore(Mask),
+                    "Register with clear-on-write flags can be changed atomically only by a single store") ;
+      ClearOnWrite<Reg>::template Update<Mask>(newValue) ;
+    }
+    else if constexpr (std::is_same<Memory, DefaultMemoryAccess>::value)
+    {
+      AtomicUtils<RegType>::Set(Reg::Address, Mask, newValue, RegType{0U}) ;
+    }
+    else
+    {
+      Set(value, values...) ; //Для собственной политики доступа к памяти атомарность обеспечивает сама политика
+    }
+  }
+
+ private:
+  //Метод проверяет, что значения помещаются в свои битовые поля, и объединяет их в значение регистра
+  __forceinline static RegType GetValue(RegType value, typename Fields::RegType ...values)
+  {
+    assert(value <= Field::Mask) ;
+    assert(((values <= Fields::Mask) && ...)) ;
+    return static_cast<RegType>(static_cast<RegType>(value << Field::Offset) |
+                                (static_cast<RegType>(values << Fields::Offset) | ... | RegType{0U})) ;
+  }
+
+  static constexpr bool HasIdentFields()
+  {
+    return (CountFields<Field>() > 1U) || ((CountFields<Fields>() > 1U) || ...) ;
+  }
+
+  template<typename T>
+  static constexpr std::size_t CountFields()
+  {
+    return static_cast<std::size_t>(std::is_same<T, Field>::value) +
+           (static_cast<std::size_t>(std::is_same<T, Fields>::value) + ... + 0U) ;
+  }
+} ;
@@ -8,6 +8,11 @@
 #include "accessmode.hpp"    //for WriteMode, ReadMode
 #include "susudefs.hpp"      //for __forceinline
 #include "registerfield.hpp" //for RegisterField
+#include "bitband.hpp"       //for BitBand
+#include "registertraits.hpp" //for RegisterSetReset
+#include "setreset.hpp"       //for SetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+#include "registerwriter.hpp" //for RegisterWriter
 
 
 //Базовый класс для работы с битовыми полями регистров
@@ -15,32 +20,55 @@ template<typename Field, typename Base, typename Field::Register::Type value>
 struct FieldValueBase
 {
   using RegType = typename Field::Register::Type ;
+  using Memory = typename Field::Register::Memory ;
   //Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
   __forceinline template<typename T = typename Field::Access,
           class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
   static void Set()
   {
-
-    RegType newRegValue = *reinterpret_cast<volatile RegType *>(Field::Register::Address) ; //Сохраняем текущее значение регистра
-    
-    newRegValue &=~ (Field::Mask << Field::Offset); //Вначале нужно очистить старое значение битового поля
-    newRegValue |= (value << Field::Offset) ; // Затем установить новое
-    
-    *reinterpret_cast<volatile RegType *>(Field::Register::Address) = newRegValue ; //И записать новое значение в регистр
+    RegisterWriter<typename Field::Register>::template Update<static_cast<RegType>(Field::Mask << Field::Offset)>(
+      static_cast<RegType>(value << Field::Offset)) ;
   }
 
-//  //Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
-//  __forceinline template<typename T = typename Field::Access,
-//    class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
-//  static void SetAtomic()
-//  {
-//    AtomicUtils<RegType>::Set(
-//      Field::Register::Address,
-//      Field::Mask,
-//      value,
-//      Field::Offset
-//      ) ;
-//  }
+  //Метод атомарно устанавливает значение битового поля, только в случае, если оно достпуно для записи.
+  //Способ выбирается по архитектуре: регистр установки и сброса, bit-band, LDREX/STREX, amoand/amoor,
+  //lr.w/sc.w или запрет прерываний (см. AtomicUtils)
+  __forceinline template<typename T = typename Field::Access,
+    class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
+  static void SetAtomic()
+  {
+    using BitBandField = BitBand<typename Field::Register, Field::Offset, Field::Size> ;
+    if constexpr (RegisterSetReset<typename Field::Register>::IsAvailable)
+    {
+      SetReset<typename Field::Register>::Update(static_cast<RegType>(Field::Mask << Field::Offset),
+                                                 static_cast<RegType>(value << Field::Offset)) ;
+    }
+    else if constexpr (ClearOnWrite<typename Field::Register>::IsAvailable)
+    {
+      static_assert(ClearOnWrite<typename Field::Register>::IsSingleStore(
+                      static_cast<RegType>(Field::Mask << Field::Offset)),
+                    "Register with clear-on-write flags can be changed atomically only by a single store") ;
+      ClearOnWrite<typename Field::Register>::template Update<static_cast<RegType>(Field::Mask << Field::Offset)>(
+        static_cast<RegType>(value << Field::Offset)) ;
+    }
+    else if constexpr (BitBandField::IsAvailable)
+    {
+      BitBandField::Write(static_cast<std::uint32_t>(value)) ;
+    }
+    else if constexpr (std::is_same<Memory, DefaultMemoryAccess>::value)
+    {
+      AtomicUtils<RegType>::Set(
+        Field::Register::Address,
+        Field::Mask,
+        value,
+        Field::Offset
+        ) ;
+    }
+    else
+    {
+      Set() ; //Для собственной политики доступа к памяти атомарность обеспечивает сама политика
+    }
+  }
 
   //Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
   __forceinline template<typename T = typename Field::Access,
@@ -48,17 +76,38 @@ struct FieldValueBase
                                             std::is_base_of<ReadWriteMode, T>::value>>
   static void Write()
   {
-    *reinterpret_cast<volatile RegType *>(Field::Register::Address) = (value << Field::Offset) ;
+    Memory::template Write<RegType>(Field::Register::Address, static_cast<RegType>(value << Field::Offset)) ;
   }
   
   
+  //Метод сбрасывает флаг битового поля одной записью, независимо от значения, например,
+  //TIM2::SR::UIF::InterruptPending::Clear() (см. ClearOnWrite)
+  __forceinline template<typename T = typename Field::Access,
+          class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value ||
+                                            std::is_base_of<ReadWriteMode, T>::value>>
+  static void Clear()
+  {
+    ClearOnWrite<typename Field::Register>::template Clear<static_cast<RegType>(Field::Mask << Field::Offset)>() ;
+  }
+
   //Метод проверяет установлено ли значение битового поля
   __forceinline template<typename T = typename Field::Access,
           class = typename std::enable_if_t<std::is_base_of<ReadMode, T>::value ||
                                             std::is_base_of<ReadWriteMode, T>::value>>
   inline static bool IsSet()
   {
-    return ((*reinterpret_cast<volatile RegType *>(Field::Register::Address)) &
+    return (Memory::template Read<RegType>(Field::Register::Address) &
+              static_cast<RegType>(Field::Mask << Field::Offset)) == (value << Field::Offset) ;
+  }
+
+  //Метод проверяет установлено ли значение битового поля в снимке регистров (RegisterSnapshot), без обращения
+  //к периферии
+  __forceinline template<typename Snapshot, typename T = typename Field::Access,
+          class = typename std::enable_if_t<std::is_base_of<ReadMode, T>::value ||
+                                            std::is_base_of<ReadWriteMode, T>::value>>
+  inline static bool IsSet(const Snapshot& snapshot)
+  {
+    return (snapshot.template Get<typename Field::Register>() &
               static_cast<RegType>(Field::Mask << Field::Offset)) == (value << Field::Offset) ;
   }
 };
@@ -0,0 +1,123 @@
+//
+// Created by Lamerok on 17.10.2026.
+//
+
+#pragma once
+
+#include <array>          //for std::array
+#include <cstddef>        //for std::size_t
+#include <cstdint>        //for std::uintptr_t, std::uint64_t
+#include <cstdlib>        //for std::abort
+#include "susudefs.hpp"   //for __forceinline
+
+//Эмулированный файл регистров для запуска кода драйверов на хосте. Каждому адресу периферии ставится в
+//соответствие ячейка в таблице с открытой адресацией, поэтому доступ к регистру не требует выделения памяти
+//и стоит несколько инструкций. Поведение аппаратуры (например, установка флагов TXE или BSY) можно эмулировать
+//через обработчики чтения и записи.
+struct HostRegisterFile
+{
+  using tReadHook = std::uint64_t (*)(std::uintptr_t address, std::uint64_t value) ;
+  using tWriteHook = void (*)(std::uintptr_t address, std::uint64_t value) ;
+
+  //Метод считывает значение регистра, если задан обработчик чтения, то значение возвращает он
+  static std::uint64_t Read(std::uintptr_t address)
+  {
+    const std::uint64_t value = GetCell(address).value ;
+    return (readHook != nullptr) ? readHook(address, value) : value ;
+  }
+
+  //Метод записывает значение регистра и вызывает обработчик записи, если он задан
+  static void Write(std::uintptr_t address, std::uint64_t value)
+  {
+    GetCell(address).value = value ;
+    if (writeHook != nullptr)
+    {
+      writeHook(address, value) ;
+    }
+  }
+
+  //Метод устанавливает значение регистра в обход обработчиков, например, чтобы выставить флаги статуса
+  static void Preset(std::uintptr_t address, std::uint64_t value)
+  {
+    GetCell(address).value = value ;
+  }
+
+  //Метод возвращает значение регистра в обход обработчиков
+  static std::uint64_t Peek(std::uintptr_t address)
+  {
+    return GetCell(address).value ;
+  }
+
+  __forceinline static void SetReadHook(tReadHook hook)
+  {
+    readHook = hook ;
+  }
+
+  __forceinline static void SetWriteHook(tWriteHook hook)
+  {
+    writeHook = hook ;
+  }
+
+  //Метод сбрасывает все регистры и обработчики, все регистры после сброса равны 0
+  static void Reset()
+  {
+    cells.fill(Cell{0U, 0U, false}) ;
+    readHook = nullptr ;
+    writeHook = nullptr ;
+  }
+
+ private:
+  struct Cell
+  {
+    std::uintptr_t address ;
+    std::uint64_t value ;
+    bool isUsed ;
+  } ;
+
+  static constexpr std::size_t Capacity = 4096U ;
+  static_assert((Capacity & (Capacity - 1U)) == 0U, "Capacity must be power of 2") ;
+
+  static Cell& GetCell(std::uintptr_t address)
+  {
+    //Регистры выровнены по границе 4 байт, поэтому младшие биты в хэш не берем
+    std::size_t index = static_cast<std::size_t>((address >> 2U) * 2654435761U) & (Capacity - 1U) ;
+    for (std::size_t i = 0U; i < Capacity; ++i)
+    {
+      Cell& cell = cells[index] ;
+      if (!cell.isUsed)
+      {
+        cell.isUsed = true ;
+        cell.address = address ;
+        return cell ;
+      }
+      if (cell.address == address)
+      {
+        return cell ;
+      }
+      index = (index + 1U) & (Capacity - 1U) ;
+    }
+    //Таблица регистров переполнена: чужая ячейка подменила бы регистр, поэтому тест останавливается и в
+    //сборке с NDEBUG
+    std::abort() ;
+  }
+
+  inline static std::array<Cell, Capacity> cells = {} ;
+  inline static tReadHook readHook = nullptr ;
+  inline static tWriteHook writeHook = nullptr ;
+} ;
+
+//Политика доступа к памяти регистров, которая вместо обращения к периферии работает с HostRegisterFile
+struct HostMemoryAccess
+{
+  __forceinline template<typename Type>
+  static Type Read(std::uintptr_t address)
+  {
+    return static_cast<Type>(HostRegisterFile::Read(address)) ;
+  }
+
+  __forceinline template<typename Type>
+  static void Write(std::uintptr_t address, Type value)
+  {
+    HostRegisterFile::Write(address, static_cast<std::uint64_t>(value)) ;
+  }
+} ;
@@ -0,0 +1,112 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>            //for std::size_t
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include "accessmode.hpp"     //for WriteMode, ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline, TypesList
+#include "registertraits.hpp" //for RegisterResetValue, RegisterVolatileMask, RegisterWritableMask,
+                              //RegisterZeroToClearMask, RegisterOneToClearMask
+
+//Класс для начальной настройки регистра, значение которого известно - равно значению после сброса (старт
+//программы, выход из режима Standby). Значения битовых полей накладываются на значение после сброса на этапе
+//компиляции, и регистр записывается одной командой без чтения. Если регистр мог быть изменен после сброса,
+//то эти изменения будут потеряны, в этом случае нужно использовать Set().
+template<typename FieldValue, typename ...FieldValues>
+struct InitPack
+{
+  using Reg = typename FieldValue::FieldType::Register ;
+  using Type = typename Reg::Type ;
+
+  static_assert((std::is_same<Reg, typename FieldValues::FieldType::Register>::value && ...),
+                "All field values must belong to the same register") ;
+  static_assert(RegisterResetValue<Reg>::IsKnown, "Register reset value is unknown") ;
+  static_assert(std::is_base_of<WriteMode, typename Reg::Access>::value ||
+                std::is_base_of<ReadWriteMode, typename Reg::Access>::value, "Register is not writable") ;
+
+  static constexpr Type Mask = static_cast<Type>(
+    (static_cast<Type>(FieldValue::Mask << FieldValue::Offset) | ... |
+     static_cast<Type>(FieldValues::Mask << FieldValues::Offset))) ;
+
+  //Значение регистра после записи: значение после сброса с установленными битовыми полями
+  static constexpr Type Value = static_cast<Type>(
+    (RegisterResetValue<Reg>::Value & static_cast<Type>(~Mask)) |
+    (static_cast<Type>(FieldValue::Value << FieldValue::Offset) | ... |
+     static_cast<Type>(FieldValues::Value << FieldValues::Offset))) ;
+
+  __forceinline static void Write()
+  {
+    static_assert(!HasIdentFields(), "There is the same field value type") ;
+    Reg::Memory::template Write<Type>(Reg::Address, Value) ;
+  }
+
+ private:
+  static constexpr bool HasIdentFields()
+  {
+    return (CountFields<typename FieldValue::FieldType>() > 1U) ||
+           ((CountFields<typename FieldValues::FieldType>() > 1U) || ...) ;
+  }
+
+  template<typename Field>
+  static constexpr std::size_t CountFields()
+  {
+    return static_cast<std::size_t>(std::is_same<Field, typename FieldValue::FieldType>::value) +
+           (static_cast<std::size_t>(std::is_same<Field, typename FieldValues::FieldType>::value) + ... + 0U) ;
+  }
+} ;
+
+//Класс для возврата периферии в состояние после сброса без сброса через RCC. Значение после сброса
+//записывается во все регистры для чтения и записи, у которых есть битовые поля, не изменяемые аппаратурой.
+//Регистры статуса, данных и счетчики, все доступные для записи биты которых меняет аппаратура, не трогаются,
+//так как запись в них имеет побочные эффекты (передача байта, сброс флагов). В регистрах управления биты,
+//которые меняет аппаратура (START, SWSTART, EN), записываются 0, чтобы не запустить операцию, флаги, которые
+//сбрасываются записью 0, - 1, а биты, недоступные для записи, сохраняются чтением регистра. Список регистров
+//периферии (Registers) и значения после сброса добавляет генератор.
+template<typename Periph>
+struct PeripheralDefaults
+{
+  static void ResetToDefault()
+  {
+    ResetRegisters(typename Periph::Registers()) ;
+  }
+
+ private:
+  template<typename ...Regs>
+  __forceinline static void ResetRegisters(TypesList<Regs...>)
+  {
+    (ResetRegister<Regs>(), ...) ;
+  }
+
+  template<typename Reg>
+  __forceinline static void ResetRegister()
+  {
+    using Type = typename Reg::Type ;
+    constexpr Type writableMask = RegisterWritableMask<Reg>::Value ;
+    //Флаги, которые сбрасываются записью, тоже устанавливает аппаратура
+    constexpr Type volatileMask = static_cast<Type>(RegisterVolatileMask<Reg>::Value |
+                                                    RegisterZeroToClearMask<Reg>::Value |
+                                                    RegisterOneToClearMask<Reg>::Value) ;
+    //Биты, которым записывается значение после сброса
+    constexpr Type resetMask = static_cast<Type>(writableMask & ~volatileMask) ;
+    constexpr Type value = static_cast<Type>((RegisterResetValue<Reg>::Value & resetMask) |
+                                             (RegisterZeroToClearMask<Reg>::Value & writableMask)) ;
+    if constexpr (std::is_base_of<ReadWriteMode, typename Reg::Access>::value &&
+                  RegisterResetValue<Reg>::IsKnown && (resetMask != 0U))
+    {
+      if constexpr ((writableMask & volatileMask) == 0U)
+      {
+        Reg::Memory::template Write<Type>(Reg::Address, RegisterResetValue<Reg>::Value) ;
+      }
+      else
+      {
+        Type newRegValue = Reg::Memory::template Read<Type>(Reg::Address) ;
+        newRegValue &= static_cast<Type>(~writableMask) ;
+        newRegValue |= value ;
+        Reg::Memory::template Write<Type>(Reg::Address, newRegValue) ;
+      }
+    }
+  }
+} ;
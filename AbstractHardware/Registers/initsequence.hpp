@@ -0,0 +1,232 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <array>              //for std::array
+#include <cstddef>            //for std::size_t
+#include <cstdint>            //for std::uintptr_t, std::uint32_t
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include <utility>            //for std::index_sequence
+#include "accessmode.hpp"     //for WriteMode
+#include "memoryaccess.hpp"   //for DefaultMemoryAccess
+#include "registertraits.hpp" //for RegisterWritableMask, RegisterResetValue, RegisterSetReset
+#include "setreset.hpp"       //for SetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+
+//Запись таблицы начальной настройки регистров. Маска 0 означает барьер: регистр только читается, чтобы
+//предыдущая запись завершилась (например, включение тактирования до обращения к периферии). Маска из всех
+//единиц означает запись значения без чтения, остальные маски - чтение, модификацию и запись.
+struct InitEntry
+{
+  std::uintptr_t address ;
+  std::uint32_t mask ;
+  std::uint32_t value ;
+} ;
+
+//Разделитель этапов последовательности начальной настройки. Значения битовых полей объединяются только
+//в пределах этапа, и все записи этапа выполняются до записей следующего этапа
+struct InitBarrier
+{
+} ;
+
+//Значение битового поля, известное на этапе компиляции, но не описанное в SVD (делитель, адрес, период)
+template<typename Field, typename Field::Register::Type value>
+struct InitFieldValue
+{
+  static_assert(value <= Field::Mask, "Value type size is more then the field size") ;
+
+  using FieldType = Field ;
+  static constexpr auto Mask = Field::Mask ;
+  static constexpr auto Offset = Field::Offset ;
+  static constexpr auto Value = value ;
+} ;
+
+//Класс, который выполняет таблицу начальной настройки. Один экземпляр кода на все таблицы
+struct InitInterpreter
+{
+  static constexpr std::uint32_t WriteMask = 0xFFFFFFFFU ;
+
+  static void Apply(const InitEntry* entry, std::size_t count)
+  {
+    for (; count != 0U; --count, ++entry)
+    {
+      if (entry->mask == WriteMask)
+      {
+        DefaultMemoryAccess::template Write<std::uint32_t>(entry->address, entry->value) ;
+      }
+      else if (entry->mask == 0U)
+      {
+        static_cast<void>(DefaultMemoryAccess::template Read<std::uint32_t>(entry->address)) ;
+      }
+      else
+      {
+        std::uint32_t newRegValue = DefaultMemoryAccess::template Read<std::uint32_t>(entry->address) ;
+        newRegValue &= ~entry->mask ;
+        newRegValue |= entry->value ;
+        DefaultMemoryAccess::template Write<std::uint32_t>(entry->address, newRegValue) ;
+      }
+    }
+  }
+} ;
+
+//Последовательность начальной настройки периферии, например:
+//using BootSequence = InitSequence<RCC::AHB1ENR::GPIOAEN::Enable, InitBarrier, GPIOA::MODER::MODER5::Output> ;
+//BootSequence::Apply() ;
+//На этапе компиляции значения битовых полей одного регистра в пределах этапа объединяются в одну запись
+//таблицы, порядок записей определяется первым упоминанием регистра. Таблица размещается в ROM, поэтому ее
+//можно выполнить повторно, например, после выхода из режима Stop.
+//Интерпретатор изменяет регистр чтением-модификацией-записью, поэтому биты регистра, у которого есть регистр
+//установки и сброса (ODR), записываются в регистр установки и сброса (BSRR), а регистр с флагами, которые
+//сбрасываются записью, записывается без чтения значением, которое не изменяет остальные флаги. Для этого все
+//его доступные для записи поля, кроме флагов, должны быть заданы в одном этапе.
+template<typename ...Items>
+struct InitSequence
+{
+ private:
+  //Запись таблицы с маской битов регистра, доступных для записи, и значением после сброса зарезервированных
+  //битов вне этой маски, нужна только для компиляции таблицы. Для регистра с флагами, которые сбрасываются
+  //записью, флаги не входят в маску битов, доступных для записи, а их значение, которое их не изменяет,
+  //входит в reservedValue
+  struct Item
+  {
+    InitEntry entry ;
+    std::uint32_t writableMask ;
+    std::uint32_t reservedValue ;
+    bool isClearOnWrite ;
+  } ;
+
+  struct Compiled
+  {
+    std::array<InitEntry, sizeof...(Items)> entries ;
+    std::size_t size ;
+    bool hasOverlap ;
+    bool hasClearOnWriteModify ;
+  } ;
+
+  template<typename T>
+  static constexpr Item GetItem()
+  {
+    if constexpr (std::is_same<T, InitBarrier>::value)
+    {
+      return Item{InitEntry{0U, 0U, 0U}, 0U, 0U, false} ;
+    }
+    else
+    {
+      using Reg = typename T::FieldType::Register ;
+      static_assert(sizeof(typename Reg::Type) == sizeof(std::uint32_t), "Only 32 bit registers are supported") ;
+      static_assert(std::is_same<typename Reg::Memory, DefaultMemoryAccess>::value,
+                    "Register must use the default memory access") ;
+      constexpr auto mask = static_cast<std::uint32_t>(T::Mask << T::Offset) ;
+      constexpr auto value = static_cast<std::uint32_t>(T::Value << T::Offset) ;
+      if constexpr (RegisterSetReset<Reg>::IsAvailable)
+      {
+        //Биты записываются в регистр установки и сброса, его биты, которые не записываются, не изменяют регистр
+        using SetResetRegister = typename SetReset<Reg>::Register ;
+        static_assert(sizeof(typename SetResetRegister::Type) == sizeof(std::uint32_t),
+                      "Only 32 bit registers are supported") ;
+        static_assert((mask >> SetReset<Reg>::Shift) == 0U, "Field does not fit the set/reset register") ;
+        constexpr auto setResetMask = static_cast<std::uint32_t>(SetReset<Reg>::GetValue(mask, mask) |
+                                                                 SetReset<Reg>::GetValue(mask, 0U)) ;
+        constexpr auto setResetValue = static_cast<std::uint32_t>(SetReset<Reg>::GetValue(mask, value)) ;
+        return Item{InitEntry{SetResetRegister::Address, setResetMask, setResetValue}, setResetMask, 0U, false} ;
+      }
+      else
+      {
+        constexpr auto clearMask = static_cast<std::uint32_t>(ClearOnWrite<Reg>::ClearMask) ;
+        //Регистр только для записи не читается, его поля, не указанные в последовательности, равны 0
+        constexpr auto writableMask = std::is_base_of<WriteMode, typename Reg::Access>::value ?
+                                      mask : (static_cast<std::uint32_t>(RegisterWritableMask<Reg>::Value) & ~clearMask) ;
+        //Зарезервированные биты записываются значением после сброса (бит 29 RCC::PLLCFGR равен 1), а флаги,
+        //которые сбрасываются записью, - значением, которое их не изменяет
+        constexpr auto reservedValue = (static_cast<std::uint32_t>(RegisterResetValue<Reg>::Value) & ~writableMask &
+                                        ~clearMask) | static_cast<std::uint32_t>(ClearOnWrite<Reg>::ZeroToClear) ;
+        return Item{InitEntry{Reg::Address, mask, value}, writableMask, reservedValue, ClearOnWrite<Reg>::IsAvailable} ;
+      }
+    }
+  }
+
+  static constexpr Compiled Compile()
+  {
+    constexpr std::array<Item, sizeof...(Items)> items = {GetItem<Items>()...} ;
+    std::array<Item, sizeof...(Items)> merged = {} ;
+    std::size_t size = 0U ;
+    std::size_t stageStart = 0U ;
+    bool hasOverlap = false ;
+    for (const auto& item: items)
+    {
+      if (item.entry.mask == 0U)
+      {
+        //Барьер: последний записанный регистр читается, чтобы запись завершилась до следующего этапа
+        if (size != stageStart)
+        {
+          merged[size] = Item{InitEntry{merged[size - 1U].entry.address, 0U, 0U}, 0U, 0U, false} ;
+          ++size ;
+        }
+        stageStart = size ;
+        continue ;
+      }
+      std::size_t index = stageStart ;
+      while ((index < size) && (merged[index].entry.address != item.entry.address))
+      {
+        ++index ;
+      }
+      if (index == size)
+      {
+        merged[size] = item ;
+        ++size ;
+      }
+      else
+      {
+        hasOverlap = hasOverlap || ((merged[index].entry.mask & item.entry.mask) != 0U) ;
+        merged[index].entry.mask |= item.entry.mask ;
+        merged[index].entry.value |= item.entry.value ;
+        merged[index].writableMask |= item.writableMask ;
+        merged[index].reservedValue |= item.reservedValue ;
+        merged[index].isClearOnWrite = merged[index].isClearOnWrite || item.isClearOnWrite ;
+      }
+    }
+
+    Compiled result = {} ;
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+      result.entries[i] = merged[i].entry ;
+      //Если поля покрывают все доступные для записи биты регистра, то регистр достаточно записать
+      if ((merged[i].entry.mask != 0U) &&
+          ((merged[i].entry.mask & merged[i].writableMask) == merged[i].writableMask))
+      {
+        result.entries[i].mask = InitInterpreter::WriteMask ;
+        result.entries[i].value |= merged[i].reservedValue & ~merged[i].entry.mask ;
+      }
+      //Чтение-модификация-запись регистра с флагами, которые сбрасываются записью, сбросила бы флаги
+      else if (merged[i].isClearOnWrite)
+      {
+        result.hasClearOnWriteModify = true ;
+      }
+    }
+    result.size = size ;
+    result.hasOverlap = hasOverlap ;
+    return result ;
+  }
+
+  static constexpr Compiled compiled = Compile() ;
+  static_assert(!compiled.hasOverlap, "The same field is set twice in one stage") ;
+  static_assert(!compiled.hasClearOnWriteModify,
+                "Register with clear-on-write flags must be written by a single store: set all its fields in one stage") ;
+
+  template<std::size_t... Indexes>
+  static constexpr std::array<InitEntry, sizeof...(Indexes)> GetTable(std::index_sequence<Indexes...>)
+  {
+    return {compiled.entries[Indexes]...} ;
+  }
+
+ public:
+  static constexpr std::size_t Size = compiled.size ;
+  static constexpr std::array<InitEntry, Size> Table = GetTable(std::make_index_sequence<Size>()) ;
+
+  static void Apply()
+  {
+    InitInterpreter::Apply(Table.data(), Table.size()) ;
+  }
+} ;
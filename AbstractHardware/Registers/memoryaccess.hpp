@@ -0,0 +1,60 @@
+//
+// Created by Lamerok on 17.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>        //for std::uintptr_t
+#include <type_traits>    //for std::void_t
+#include "susudefs.hpp"   //for __forceinline
+
+//Политика доступа к памяти регистров по умолчанию - обращение к регистрам периферии микроконтроллера
+//через volatile указатель
+struct VolatileMemoryAccess
+{
+  //Метод считывает значение регистра по адресу
+  __forceinline template<typename Type>
+  static Type Read(std::uintptr_t address)
+  {
+    return *reinterpret_cast<volatile Type *>(address) ;
+  }
+
+  //Метод записывает значение в регистр по адресу
+  __forceinline template<typename Type>
+  static void Write(std::uintptr_t address, Type value)
+  {
+    *reinterpret_cast<volatile Type *>(address) = value ;
+  }
+} ;
+
+//Вспомогательный класс, возвращает политику, через которую на самом деле выполняется обращение к памяти.
+//Политики-обертки (например, TracedMemoryAccess) указывают обернутую политику через Underlying
+template<typename Memory, typename = void>
+struct UnderlyingMemoryAccess
+{
+  using Type = Memory ;
+} ;
+
+template<typename Memory>
+struct UnderlyingMemoryAccess<Memory, std::void_t<typename Memory::Underlying>> :
+  UnderlyingMemoryAccess<typename Memory::Underlying>
+{
+} ;
+
+//Для сборки под хост (например для тестов и бенчмарков драйверов на Linux) нужно определить
+//REGISTERS_HOST_ACCESS, тогда все регистры по умолчанию будут работать с эмулированным файлом регистров
+#if defined(REGISTERS_HOST_ACCESS)
+#include "hostmemoryaccess.hpp" //for HostMemoryAccess
+using UntracedMemoryAccess = HostMemoryAccess ;
+#else
+using UntracedMemoryAccess = VolatileMemoryAccess ;
+#endif
+
+//Для отладки драйверов нужно определить REGISTERS_TRACE, тогда все обращения к регистрам записываются
+//в кольцевой буфер RegisterTrace. Без REGISTERS_TRACE трассировка не добавляет ни одной команды
+#if defined(REGISTERS_TRACE)
+#include "registertrace.hpp" //for TracedMemoryAccess
+using DefaultMemoryAccess = TracedMemoryAccess<UntracedMemoryAccess> ;
+#else
+using DefaultMemoryAccess = UntracedMemoryAccess ;
+#endif
@@ -0,0 +1,144 @@
+//
+// Created by Lamerok on 17.10.2026.
+//
+
+#pragma once
+
+#include <array>              //for std::array
+#include <cstddef>            //for std::size_t
+#include <cstdint>            //for std::uintptr_t
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include <utility>            //for std::index_sequence
+#include "accessmode.hpp"     //for WriteMode, ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline
+#include "registertraits.hpp" //for IsRegisterOf
+#include "registerwriter.hpp" //for RegisterWriter
+
+//Класс для настройки сразу нескольких регистров одной периферии. Значения битовых полей группируются
+//по регистрам на этапе компиляции, регистры упорядочиваются по адресу и в каждый регистр производится
+//ровно одно чтение и одна запись. Для регистров только для записи, а также для регистров, все доступные для
+//записи биты которых перекрываются устанавливаемыми битовыми полями, чтение не производится вовсе. Биты
+//регистров с регистром установки и сброса (ODR) изменяются одной записью в него, а флаги, которые
+//сбрасываются записью, записываются значением, которое их не изменяет (см. ClearOnWrite).
+template<typename Periph, typename ...FieldValues>
+class PeripheralTransaction
+{
+  static_assert(sizeof...(FieldValues) != 0U, "There are no field values in the transaction") ;
+  static_assert((IsRegisterOf<typename FieldValues::FieldType::Register, Periph>::value && ...),
+                "Field value does not belong to the peripheral") ;
+  static_assert(((std::is_base_of<WriteMode, typename FieldValues::Access>::value ||
+                 std::is_base_of<ReadWriteMode, typename FieldValues::Access>::value) && ...),
+                "Field value is not writable") ;
+
+ public:
+  //Метод устанавливает все битовые поля транзакции, регистры записываются в порядке возрастания адреса
+  __forceinline static void Set()
+  {
+    static_assert(!HasIdentFields(), "There is the same field value type") ;
+    SetRegisters(std::make_index_sequence<sortedAddresses.count>()) ;
+  }
+
+ private:
+  static constexpr std::size_t fieldValuesCount = sizeof...(FieldValues) ;
+
+  struct Addresses
+  {
+    std::array<std::uintptr_t, fieldValuesCount> items ;
+    std::size_t count ;
+  } ;
+
+  //Вспомогательный метод, возвращает отсортированный список адресов регистров без повторов
+  static constexpr Addresses GetSortedAddresses()
+  {
+    Addresses result{{}, 0U} ;
+    for (const auto address: {FieldValues::FieldType::Register::Address...})
+    {
+      std::size_t position = 0U ;
+      while ((position < result.count) && (result.items[position] < address))
+      {
+        ++position ;
+      }
+      if ((position == result.count) || (result.items[position] != address))
+      {
+        for (std::size_t i = result.count; i > position; --i)
+        {
+          result.items[i] = result.items[i - 1U] ;
+        }
+        result.items[position] = address ;
+        ++result.count ;
+      }
+    }
+    return result ;
+  }
+
+  static constexpr Addresses sortedAddresses = GetSortedAddresses() ;
+
+  //Вспомогательный класс, находит тип регистра по его адресу среди регистров битовых полей транзакции
+  template<std::uintptr_t address, typename T, typename ...Ts>
+  struct FindRegister
+  {
+    using Type = std::conditional_t<(T::FieldType::Register::Address == address),
+                                    typename T::FieldType::Register,
+                                    typename FindRegister<address, Ts...>::Type> ;
+  } ;
+
+  template<std::uintptr_t address, typename T>
+  struct FindRegister<address, T>
+  {
+    using Type = typename T::FieldType::Register ;
+  } ;
+
+  __forceinline template<std::size_t ...indexes>
+  static void SetRegisters(std::index_sequence<indexes...>)
+  {
+    (SetRegister<sortedAddresses.items[indexes]>(), ...) ;
+  }
+
+  //Вспомогательный метод, расчитывает общую маску битовых полей транзакции для регистра с заданным адресом
+  template<std::uintptr_t address, typename Type>
+  static constexpr Type GetMask()
+  {
+    return static_cast<Type>((((FieldValues::FieldType::Register::Address == address) ?
+                               static_cast<Type>(FieldValues::Mask << FieldValues::Offset) : Type{0U}) | ...)) ;
+  }
+
+  //Вспомогательный метод, расчитывает значение битовых полей транзакции для регистра с заданным адресом
+  template<std::uintptr_t address, typename Type>
+  static constexpr Type GetValue()
+  {
+    return static_cast<Type>((((FieldValues::FieldType::Register::Address == address) ?
+                               static_cast<Type>(FieldValues::Value << FieldValues::Offset) : Type{0U}) | ...)) ;
+  }
+
+  __forceinline template<std::uintptr_t address>
+  static void SetRegister()
+  {
+    using Reg = typename FindRegister<address, FieldValues...>::Type ;
+    using Type = typename Reg::Type ;
+    using Memory = typename Reg::Memory ;
+    constexpr Type mask = GetMask<address, Type>() ;
+    constexpr Type value = GetValue<address, Type>() ;
+    constexpr bool isWriteOnly = std::is_base_of<WriteMode, typename Reg::Access>::value ;
+
+    if constexpr (isWriteOnly)
+    {
+      Memory::template Write<Type>(address, value) ;
+    }
+    else
+    {
+      RegisterWriter<Reg>::template Update<mask>(value) ;
+    }
+  }
+
+  //Вспомогательный метод, проверяет что в транзакции нет двух значений одного и того же битового поля
+  static constexpr bool HasIdentFields()
+  {
+    return ((CountFields<typename FieldValues::FieldType>() > 1U) || ...) ;
+  }
+
+  template<typename Field>
+  static constexpr std::size_t CountFields()
+  {
+    return (static_cast<std::size_t>(std::is_same<Field, typename FieldValues::FieldType>::value) + ...) ;
+  }
+} ;
@@ -7,6 +7,33 @@
 #include "registertype.hpp"   //for RegisterType
 #include "accessmode.hpp"     //for WriteMode, ReadMode
 #include "susudefs.hpp"       //for __forceinline
+#include "memoryaccess.hpp"   //for DefaultMemoryAccess
+#include "atomicutils.hpp"    //for AtomicUtils
+#include "registertraits.hpp" //for RegisterSetReset
+#include "setreset.hpp"       //for SetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+#include "registerwriter.hpp" //for RegisterWriter
+
+//Вспомогательный класс, определяет политику доступа к памяти регистра по первому битовому полю из набора.
+//Все битовые поля набора относятся к одному регистру, поэтому и политика у них общая.
+template<typename ...Args>
+struct RegisterMemory
+{
+    using Type = DefaultMemoryAccess;
+};
+
+template<typename T, typename ...Args>
+struct RegisterMemory<T, Args...>
+{
+    using Type = typename T::FieldType::Register::Memory;
+};
+
+//Вспомогательный класс, определяет описание регистра по первому битовому полю из набора
+template<typename T, typename ...Args>
+struct RegisterOfFields
+{
+    using Type = typename T::FieldType::Register;
+};
 
 //Класс для работы с регистром, можно передавать список Битовых полей для установки и проверки
 template<std::uintptr_t address, size_t size, typename AccessMode, typename FieldValueBaseType, typename ...Args>
@@ -14,32 +41,47 @@ class Register
 {
  public:
     using Type = typename RegisterType<size>::Type;
+    using Memory = typename RegisterMemory<Args...>::Type;
     //Метод Set устанавливает битовые поля, только если регистр может использоваться для записи
     __forceinline template<typename T = AccessMode,
         class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
     static void Set()
     {
-        Type newRegValue = *reinterpret_cast<volatile Type*>(address); //Сохраняем текущее значение регистра
         static constexpr auto mask = GetMask();
         static constexpr auto value = GetValue();
-
-        newRegValue &= ~mask; //Сбрасываем битовые поля, которые нужно будет установить
-        newRegValue |= value; //Устанавливаем новые значения битовых полей
-        *reinterpret_cast<volatile Type*>(address) = newRegValue; //Записываем в регистра новое значение
+        using Reg = typename RegisterOfFields<Args...>::Type;
+        RegisterWriter<Reg>::template Update<static_cast<Type>(mask)>(value);
     }
 
-//    //Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
-//    __forceinline template<typename T = AccessMode,
-//            class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
-//    static void SetAtomic()
-//    {
-//      AtomicUtils<Type>::Set(
-//              address,
-//              GetMask(),
-//              GetValue,
-//              0U
-//      ) ;
-//    }
+    //Метод SetAtomic атомарно устанавливает битовые поля, только если регистр может использоваться для записи.
+    //Способ выбирается по архитектуре: регистр установки и сброса, LDREX/STREX, amoand/amoor, lr.w/sc.w
+    //или запрет прерываний (см. AtomicUtils)
+    __forceinline template<typename T = AccessMode,
+            class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
+    static void SetAtomic()
+    {
+        using Reg = typename RegisterOfFields<Args...>::Type;
+        if constexpr (RegisterSetReset<Reg>::IsAvailable)
+        {
+            Set(); //Запись в регистр установки и сброса атомарна сама по себе
+        }
+        else if constexpr (ClearOnWrite<Reg>::IsAvailable)
+        {
+            static_assert(ClearOnWrite<Reg>::IsSingleStore(static_cast<Type>(GetMask())),
+                          "Register with clear-on-write flags can be changed atomically only by a single store");
+            Set();
+        }
+        else if constexpr (std::is_same<Memory, DefaultMemoryAccess>::value)
+        {
+            static constexpr auto mask = GetMask();
+            static constexpr auto value = GetValue();
+            AtomicUtils<Type>::Set(address, mask, value, Type{0U});
+        }
+        else
+        {
+            Set(); //Для собственной политики доступа к памяти атомарность обеспечивает сама политика
+        }
+    }
 
     //Метод Write устанавливает битовые поля, только если регистр может использоваться для записи
     __forceinline template<typename T = AccessMode,
@@ -49,7 +91,7 @@ class Register
     {
         static constexpr auto value = GetValue();
 
-        *reinterpret_cast<volatile Type*>(address) = value; //Записываем в регистра новое значение
+        Memory::template Write<Type>(address, value); //Записываем в регистра новое значение
     }
 
 
@@ -61,7 +103,7 @@ class Register
     {
         static constexpr auto mask = GetMask();
         static constexpr auto value = GetValue();
-        Type newRegValue = *reinterpret_cast<volatile Type*>(address);
+        Type newRegValue = Memory::template Read<Type>(address);
 
         return ((newRegValue & mask) == value);
     }
@@ -113,7 +155,7 @@ class Register
     {
         if constexpr (sizeof...(Ts) != 0U)
         {
-            if (Attributes<typename Ts::FieldType...>::template HasAttribute<T::FieldType>())
+            if (Attributes<typename Ts::FieldType...>::template HasAttribute<typename T::FieldType>())
             {
                 return true;
             }
@@ -7,13 +7,17 @@
 #include "registertype.hpp"   //for RegisterType
 #include "accessmode.hpp"    //for WriteMode, ReadMode
 #include "susudefs.hpp"      //for __forceinline
+#include "memoryaccess.hpp"  //for DefaultMemoryAccess
 
-//Базовый класс для работы с регистром
-template<std::uintptr_t address, size_t size, typename AccessMode>
+//Базовый класс для работы с регистром. MemoryAccess задает способ доступа к памяти регистра, по умолчанию
+//обращение к периферии через volatile указатель
+template<std::uintptr_t address, size_t size, typename AccessMode, typename MemoryAccess = DefaultMemoryAccess>
 struct RegisterBase
 {
   static constexpr auto Address = address ;
   using Type = typename RegisterType<size>::Type ;
+  using Access = AccessMode ;
+  using Memory = MemoryAccess ;
 
 
   //Метод Write будет работать только для регистров, в которые можно записать значение
@@ -21,7 +25,7 @@ struct RegisterBase
     class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value >>
   inline static void Write(Type value)
   {
-    *reinterpret_cast<volatile Type *>(address) = value ;
+    MemoryAccess::template Write<Type>(address, value) ;
   }
 
     //Метод Write будет работать только для регистров, в которые можно записать значение
@@ -29,7 +33,7 @@ struct RegisterBase
         class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value >>
     inline static void Write()
     {
-      *reinterpret_cast<volatile Type *>(address) = value ;
+      MemoryAccess::template Write<Type>(address, value) ;
     }
 
   //Метод Write будет работать только для регистров, в которые можно записать значение
@@ -37,8 +41,8 @@ struct RegisterBase
       class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value >>
   inline static void Set(Type value)
   {
-    Type oldRegValue = *reinterpret_cast<volatile Type *>(address) ; //Сохраняем текущее значение регистра
-    *reinterpret_cast<volatile Type *>(address) = oldRegValue | value ;
+    Type oldRegValue = MemoryAccess::template Read<Type>(address) ; //Сохраняем текущее значение регистра
+    MemoryAccess::template Write<Type>(address, static_cast<Type>(oldRegValue | value)) ;
   }
 
   //Метод Write будет работать только для регистров, в которые можно записать значение
@@ -46,7 +50,8 @@ struct RegisterBase
     class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
   inline static void Toggle(Type value)
   {
-    *reinterpret_cast<volatile Type *>(address) ^= value ;
+    const Type oldRegValue = MemoryAccess::template Read<Type>(address) ;
+    MemoryAccess::template Write<Type>(address, static_cast<Type>(oldRegValue ^ value)) ;
   }
 
   //Метод Get возвращает целое значение регистра, будет работать только для регистров, которые можно считать
@@ -55,7 +60,7 @@ struct RegisterBase
                                             std::is_base_of<ReadWriteMode, T>::value>>
   inline static Type Get()
   {
-    return *reinterpret_cast<volatile Type *>(address) ;
+    return MemoryAccess::template Read<Type>(address) ;
   }
 } ;
 
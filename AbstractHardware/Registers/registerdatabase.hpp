@@ -0,0 +1,201 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>            //for std::size_t
+#include <cstdint>            //for std::uint8_t, std::uint16_t, std::uint32_t, std::int16_t
+#include "memoryaccess.hpp"   //for DefaultMemoryAccess
+
+//Доступ к регистру или полю: биты чтения и записи
+enum class RegisterDbAccess: std::uint8_t
+{
+  Read = 1U,
+  Write = 2U,
+  ReadWrite = 3U
+} ;
+
+//Описание регистра в базе. Поля регистра идут в таблице полей подряд, начиная с firstField
+struct RegisterDbRegister
+{
+  const char* name ;
+  std::uint32_t address ;
+  std::uint16_t firstField ;
+  std::uint8_t fieldsCount ;
+  std::uint8_t peripheral ;
+  std::uint8_t size ;
+  RegisterDbAccess access ;
+} ;
+
+struct RegisterDbField
+{
+  const char* name ;
+  std::uint8_t offset ;
+  std::uint8_t width ;
+  RegisterDbAccess access ;
+} ;
+
+//Запись индекса имен: номер регистра и номер поля, для имени регистра номер поля равен NoField
+struct RegisterDbKey
+{
+  static constexpr std::uint16_t NoField = 0xFFFFU ;
+
+  std::uint16_t registerIndex ;
+  std::uint16_t fieldIndex ;
+} ;
+
+//Хеш FNV-1a с начальным значением, смещенным на seed. Генератор вычисляет по нему ту же самую функцию
+constexpr std::uint32_t RegisterDbHash(const char* name, std::uint32_t seed)
+{
+  std::uint32_t hash = 0x811C9DC5U ^ seed ;
+  for (; *name != '\0'; ++name)
+  {
+    hash ^= static_cast<std::uint8_t>(*name) ;
+    hash *= 0x01000193U ;
+  }
+  return hash ;
+}
+
+//Поиск регистров и полей по имени вида "GPIOA.MODER" или "GPIOA.MODER.MODER5" в базе, которую генератор
+//создает для устройства (registerdb.hpp, опция -d). Индекс имен - совершенная хеш-функция: имя хешируется
+//два раза, и найденная запись проверяется сравнением с именами из таблиц, поэтому строки целиком нигде
+//не хранятся, а все таблицы лежат в ROM. Таблицы - constexpr члены класса, поэтому если база не используется,
+//то они не попадают в образ.
+template<typename Db>
+struct RegisterDatabase
+{
+  static const RegisterDbKey* Find(const char* name)
+  {
+    constexpr std::uint32_t keysCount = static_cast<std::uint32_t>(sizeof(Db::Keys) / sizeof(Db::Keys[0])) ;
+    const std::int16_t seed = Db::Seeds[RegisterDbHash(name, 0U) % keysCount] ;
+    //Отрицательное значение - сам номер записи, для корзин из одного имени
+    const std::uint32_t index = (seed < 0) ? static_cast<std::uint32_t>(-seed - 1) :
+                                RegisterDbHash(name, static_cast<std::uint32_t>(seed)) % keysCount ;
+    const RegisterDbKey& key = Db::Keys[index] ;
+    return IsMatched(key, name) ? &key : nullptr ;
+  }
+
+  //Метод возвращает значение регистра или поля
+  static bool Peek(const char* name, std::uint32_t& value)
+  {
+    const RegisterDbKey* key = Find(name) ;
+    if ((key == nullptr) || !IsReadable(*key))
+    {
+      return false ;
+    }
+    const RegisterDbRegister& reg = Db::Registers[key->registerIndex] ;
+    value = Read(reg) ;
+    if (key->fieldIndex != RegisterDbKey::NoField)
+    {
+      const RegisterDbField& field = Db::Fields[key->fieldIndex] ;
+      value = (value >> field.offset) & GetMask(field.width) ;
+    }
+    return true ;
+  }
+
+  //Метод записывает значение регистра или поля. Поле регистра для чтения и записи изменяется чтением,
+  //модификацией и записью, поле регистра только для записи записывается с остальными полями равными 0
+  static bool Poke(const char* name, std::uint32_t value)
+  {
+    const RegisterDbKey* key = Find(name) ;
+    if ((key == nullptr) || !IsWritable(*key))
+    {
+      return false ;
+    }
+    const RegisterDbRegister& reg = Db::Registers[key->registerIndex] ;
+    if (key->fieldIndex != RegisterDbKey::NoField)
+    {
+      const RegisterDbField& field = Db::Fields[key->fieldIndex] ;
+      const std::uint32_t mask = GetMask(field.width) ;
+      if (value > mask)
+      {
+        return false ;
+      }
+      std::uint32_t newRegValue = (reg.access == RegisterDbAccess::ReadWrite) ? Read(reg) : 0U ;
+      newRegValue &= ~(mask << field.offset) ;
+      newRegValue |= value << field.offset ;
+      value = newRegValue ;
+    }
+    Write(reg, value) ;
+    return true ;
+  }
+
+  static std::uint32_t Read(const RegisterDbRegister& reg)
+  {
+    switch (reg.size)
+    {
+      case 8U:
+        return DefaultMemoryAccess::template Read<std::uint8_t>(reg.address) ;
+      case 16U:
+        return DefaultMemoryAccess::template Read<std::uint16_t>(reg.address) ;
+      default:
+        return DefaultMemoryAccess::template Read<std::uint32_t>(reg.address) ;
+    }
+  }
+
+  static void Write(const RegisterDbRegister& reg, std::uint32_t value)
+  {
+    switch (reg.size)
+    {
+      case 8U:
+        DefaultMemoryAccess::template Write<std::uint8_t>(reg.address, static_cast<std::uint8_t>(value)) ;
+        break ;
+      case 16U:
+        DefaultMemoryAccess::template Write<std::uint16_t>(reg.address, static_cast<std::uint16_t>(value)) ;
+        break ;
+      default:
+        DefaultMemoryAccess::template Write<std::uint32_t>(reg.address, value) ;
+        break ;
+    }
+  }
+
+  static constexpr std::uint32_t GetMask(std::uint8_t width)
+  {
+    return (width < 32U) ? ((1U << width) - 1U) : 0xFFFFFFFFU ;
+  }
+
+ private:
+  static RegisterDbAccess GetAccess(const RegisterDbKey& key)
+  {
+    return (key.fieldIndex != RegisterDbKey::NoField) ? Db::Fields[key.fieldIndex].access :
+                                                        Db::Registers[key.registerIndex].access ;
+  }
+
+  static bool IsReadable(const RegisterDbKey& key)
+  {
+    return (static_cast<std::uint8_t>(GetAccess(key)) & static_cast<std::uint8_t>(RegisterDbAccess::Read)) != 0U ;
+  }
+
+  static bool IsWritable(const RegisterDbKey& key)
+  {
+    return (static_cast<std::uint8_t>(GetAccess(key)) & static_cast<std::uint8_t>(RegisterDbAccess::Write)) != 0U ;
+  }
+
+  //Метод сравнивает начало имени с частью из таблицы и возвращает указатель на остаток имени или nullptr
+  static const char* MatchPart(const char* name, const char* part)
+  {
+    for (; *part != '\0'; ++part, ++name)
+    {
+      if (*name != *part)
+      {
+        return nullptr ;
+      }
+    }
+    return name ;
+  }
+
+  static bool IsMatched(const RegisterDbKey& key, const char* name)
+  {
+    const RegisterDbRegister& reg = Db::Registers[key.registerIndex] ;
+    name = MatchPart(name, Db::Peripherals[reg.peripheral]) ;
+    name = (name != nullptr) ? MatchPart(name, ".") : nullptr ;
+    name = (name != nullptr) ? MatchPart(name, reg.name) : nullptr ;
+    if ((name != nullptr) && (key.fieldIndex != RegisterDbKey::NoField))
+    {
+      name = MatchPart(name, ".") ;
+      name = (name != nullptr) ? MatchPart(name, Db::Fields[key.fieldIndex].name) : nullptr ;
+    }
+    return (name != nullptr) && (*name == '\0') ;
+  }
+} ;
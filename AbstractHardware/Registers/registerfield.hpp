@@ -6,8 +6,13 @@
 
 #include <cassert>      //for assert
 #include <limits>       // for std::mnumeric_limits<>
-//#include <atomicutils.hpp>
+#include "atomicutils.hpp" //for AtomicUtils
 #include "susudefs.hpp" //for __forceinline (#define __forceinline  _Pragma("inline=forced"))
+#include "bitband.hpp"  //for BitBand
+#include "registertraits.hpp" //for RegisterSetReset
+#include "setreset.hpp"   //for SetReset
+#include "clearonwrite.hpp" //for ClearOnWrite
+#include "registerwriter.hpp" //for RegisterWriter
 //#include "criticalsectionconfig.hpp" // for CriticalSection
 
 //Базовый класс для работы с битовыми полями регистров
@@ -16,6 +21,7 @@ struct RegisterField
 {
 		using RegType = typename Reg::Type;
 		using Register = Reg;
+		using Memory = typename Reg::Memory;
 
 		static constexpr RegType Offset = offset;
 		static constexpr RegType Size = size;
@@ -30,12 +36,7 @@ struct RegisterField
 				assert((size < sizeof(RegType) * 8U) ? (value <= ((static_cast<RegType>(1U) << size) - static_cast<RegType>(1U))) :
 				       (value <= std::numeric_limits<RegType>::max()));
 
-				RegType newRegValue = *reinterpret_cast<volatile RegType*>(Reg::Address); //Сохраняем текущее значение регистра
-
-				newRegValue &= ~(Mask << offset); //Вначале нужно очистить старое значение битового поля
-				newRegValue |= (value << offset); // Затем установить новое
-
-				*reinterpret_cast<volatile RegType*>(Reg::Address) = newRegValue; //И записать новое значение в регистр
+				RegisterWriter<Reg>::template Update<static_cast<RegType>(Mask << offset)>(static_cast<RegType>(value << offset));
 		}
 
 		//Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
@@ -44,30 +45,44 @@ struct RegisterField
 		{
 				static_assert((size < sizeof(RegType) * 8U) ? (value <= ((static_cast<RegType>(1U) << size) - static_cast<RegType>(1U))) :
 							 (value <= std::numeric_limits<RegType>::max()), "Value type size is more then the field size");
-				RegType newRegValue = *reinterpret_cast<volatile RegType*>(Reg::Address); //Сохраняем текущее значение регистра
-
-				newRegValue &= ~(Mask << offset); //Вначале нужно очистить старое значение битового поля
-				newRegValue |= (value << offset); // Затем установить новое
-
-				*reinterpret_cast<volatile RegType*>(Reg::Address) = newRegValue; //И записать новое значение в регистр
+				RegisterWriter<Reg>::template Update<static_cast<RegType>(Mask << offset)>(static_cast<RegType>(value << offset));
 		}
 
              
 
-//  //Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
-//  __forceinline template<typename T = AccessMode,
-//    class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
-//  static void SetAtomic(RegType value)
-//  {
-//    assert(value < (1U << (size - 1))) ;
-//
-//    AtomicUtils<RegType>::Set(
-//      Reg::Address,
-//      Mask,
-//      value,
-//      offset
-//    ) ;
-//  }
+		//Метод атомарно устанавливает значение битового поля, только в случае, если оно достпуно для записи.
+		//Способ выбирается по архитектуре: регистр установки и сброса, bit-band, LDREX/STREX, amoand/amoor,
+		//lr.w/sc.w или запрет прерываний (см. AtomicUtils)
+		__forceinline template<typename T = AccessMode, class = typename std::enable_if_t<std::is_base_of<ReadWriteMode, T>::value>>
+		static void SetAtomic(RegType value)
+		{
+				assert((size < sizeof(RegType) * 8U) ? (value <= ((static_cast<RegType>(1U) << size) - static_cast<RegType>(1U))) :
+				       (value <= std::numeric_limits<RegType>::max()));
+
+				using BitBandField = BitBand<Reg, offset, size>;
+				if constexpr (RegisterSetReset<Reg>::IsAvailable)
+				{
+						SetReset<Reg>::Update(static_cast<RegType>(Mask << offset), static_cast<RegType>(value << offset));
+				}
+				else if constexpr (ClearOnWrite<Reg>::IsAvailable)
+				{
+						static_assert(ClearOnWrite<Reg>::IsSingleStore(static_cast<RegType>(Mask << offset)),
+						              "Register with clear-on-write flags can be changed atomically only by a single store");
+						ClearOnWrite<Reg>::template Update<static_cast<RegType>(Mask << offset)>(static_cast<RegType>(value << offset));
+				}
+				else if constexpr (BitBandField::IsAvailable)
+				{
+						BitBandField::Write(static_cast<std::uint32_t>(value));
+				}
+				else if constexpr (std::is_same<Memory, DefaultMemoryAccess>::value)
+				{
+						AtomicUtils<RegType>::Set(Reg::Address, Mask, value, offset);
+				}
+				else
+				{
+						Set(value); //Для собственной политики доступа к памяти атомарность обеспечивает сама политика
+				}
+		}
 
 		//Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
 		__forceinline template<typename T = AccessMode, class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value>>
@@ -75,7 +90,7 @@ struct RegisterField
 		{
 				assert((size < sizeof(RegType) * 8U) ? (value <= ((static_cast<RegType>(1U) << size) - static_cast<RegType>(1U))) :
 							 (value <= std::numeric_limits<RegType>::max()));
-				*reinterpret_cast<volatile RegType*>(Reg::Address) = (value << offset);
+				Memory::template Write<RegType>(Reg::Address, static_cast<RegType>(value << offset));
 		}
 
 		//Метод устанавливает значение битового поля, только в случае, если оно достпуно для записи
@@ -84,7 +99,16 @@ struct RegisterField
 		{
 				static_assert((size < sizeof(RegType) * 8U) ? (value <=((static_cast<RegType>(1U) << size) - static_cast<RegType>(1U))) :
 											(value <= std::numeric_limits<RegType>::max()), "Value type size is more then the field size");
-				*reinterpret_cast<volatile RegType*>(Reg::Address) = (value << offset);
+				Memory::template Write<RegType>(Reg::Address, static_cast<RegType>(value << offset));
+		}
+
+		//Метод сбрасывает флаг, который сбрасывается записью 0 (rc_w0) или 1 (rc_w1), остальные флаги регистра при
+		//этом не изменяются. Если в регистре нет других доступных для записи битов, то это одна запись (см. ClearOnWrite)
+		__forceinline template<typename T = AccessMode, class = typename std::enable_if_t<
+						std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
+		static void Clear()
+		{
+				ClearOnWrite<Reg>::template Clear<static_cast<RegType>(Mask << offset)>();
 		}
 
 		//Метод устанавливает проверяет установлено ли значение битового поля
@@ -92,7 +116,7 @@ struct RegisterField
 						std::is_base_of<ReadMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
 		inline static RegType Get()
 		{
-				return ((*reinterpret_cast<volatile RegType*>(Reg::Address)) & (Mask << offset)) >> offset;
+				return (Memory::template Read<RegType>(Reg::Address) & (Mask << offset)) >> offset;
 		}
 };
 
@@ -0,0 +1,108 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <algorithm>      //for std::sort
+#include <cstdint>        //for std::uint32_t, std::uintptr_t
+#include <cstdio>         //for std::printf
+#include <map>            //for std::map
+#include <vector>         //for std::vector
+
+//Гистограмма обращений к регистрам на хосте, заполняется трассировкой (REGISTERS_TRACE вместе с
+//REGISTERS_HOST_ACCESS). Кроме числа чтений и записей для каждого адреса считаются подозрительные обращения:
+//повторное чтение, между которым и предыдущим чтением не было записи и значение не изменилось, и запись
+//значения, которое в регистре уже было. Для регистров статуса повторные чтения - это ожидание флага,
+//для остальных регистров такие обращения обычно можно убрать. Подключается из registertrace.hpp.
+struct RegisterAccessHistogram
+{
+  struct Counters
+  {
+    std::uint32_t reads ;
+    std::uint32_t writes ;
+    std::uint32_t atomicSets ;
+    std::uint32_t repeatedReads ;
+    std::uint32_t repeatedWrites ;
+  } ;
+
+  static void OnAccess(std::uintptr_t address, std::uint32_t value, RegisterAccessKind kind)
+  {
+    Item& item = items[address] ;
+    switch (kind)
+    {
+      case RegisterAccessKind::Read:
+        ++item.counters.reads ;
+        if (item.isLastRead && item.isKnown && (item.lastValue == value))
+        {
+          ++item.counters.repeatedReads ;
+        }
+        item.isLastRead = true ;
+        break ;
+      case RegisterAccessKind::Write:
+        ++item.counters.writes ;
+        if (item.isKnown && (item.lastValue == value))
+        {
+          ++item.counters.repeatedWrites ;
+        }
+        item.isLastRead = false ;
+        break ;
+      default:
+        //После атомарной установки поля значение регистра целиком неизвестно
+        ++item.counters.atomicSets ;
+        item.isLastRead = false ;
+        item.isKnown = false ;
+        return ;
+    }
+    item.lastValue = value ;
+    item.isKnown = true ;
+  }
+
+  static Counters Get(std::uintptr_t address)
+  {
+    const auto it = items.find(address) ;
+    return (it != items.end()) ? it->second.counters : Counters{0U, 0U, 0U, 0U, 0U} ;
+  }
+
+  static void Reset()
+  {
+    items.clear() ;
+  }
+
+  //Метод выводит гистограмму, регистры упорядочены по убыванию общего числа обращений
+  static void Print()
+  {
+    std::vector<std::pair<std::uintptr_t, Counters>> sorted ;
+    for (const auto& item: items)
+    {
+      sorted.emplace_back(item.first, item.second.counters) ;
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto& left, const auto& right)
+    {
+      return GetTotal(left.second) > GetTotal(right.second) ;
+    }) ;
+    std::printf("%-10s %8s %8s %8s %10s %10s\n", "Address", "Reads", "Writes", "Atomic", "RepReads", "RepWrites") ;
+    for (const auto& item: sorted)
+    {
+      std::printf("%08lX   %8u %8u %8u %10u %10u\n", static_cast<unsigned long>(item.first),
+                  item.second.reads, item.second.writes, item.second.atomicSets,
+                  item.second.repeatedReads, item.second.repeatedWrites) ;
+    }
+  }
+
+ private:
+  struct Item
+  {
+    Counters counters ;
+    std::uint32_t lastValue ;
+    bool isLastRead ;
+    bool isKnown ;
+  } ;
+
+  static std::uint32_t GetTotal(const Counters& counters)
+  {
+    return counters.reads + counters.writes + counters.atomicSets ;
+  }
+
+  inline static std::map<std::uintptr_t, Item> items = {} ;
+} ;
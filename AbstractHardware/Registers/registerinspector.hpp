@@ -0,0 +1,129 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <array>                  //for std::array
+#include <cstddef>                //for std::size_t
+#include <cstdint>                //for std::uint8_t, std::uint32_t
+#include "registerdatabase.hpp"   //for RegisterDatabase, RegisterDbKey
+#include "waituntil.hpp"          //for WaitFor
+
+//Класс для просмотра и изменения регистров по имени через UART, например, на устройстве в эксплуатации:
+//using Inspector = RegisterInspector<RegisterDb, MyDriver> ;
+//Inspector::Print("GPIOA.MODER") ;       //"GPIOA.MODER = 0xA8000400" и значения всех полей, по строке на поле
+//Inspector::Poke("GPIOA.MODER.MODER5", 1U) ;
+//Вывод идет через UartDriver, каждая строка ждет окончания передачи предыдущей, но не дольше LineTimeout
+//опросов, иначе строка пропускается. Если инспектор не используется, то ни он, ни база регистров не попадают
+//в образ.
+template<typename Db, typename Driver>
+struct RegisterInspector
+{
+  using Database = RegisterDatabase<Db> ;
+
+  static bool Peek(const char* name, std::uint32_t& value)
+  {
+    return Database::Peek(name, value) ;
+  }
+
+  static bool Poke(const char* name, std::uint32_t value)
+  {
+    return Database::Poke(name, value) ;
+  }
+
+  //Метод выводит значение регистра и всех его полей или значение одного поля. Для неизвестного имени или
+  //регистра только для записи выводится "<имя> ?"
+  static bool Print(const char* name)
+  {
+    const RegisterDbKey* key = Database::Find(name) ;
+    std::uint32_t value = 0U ;
+    Line line ;
+    line.Append(name) ;
+    if ((key == nullptr) || !Database::Peek(name, value))
+    {
+      line.Append(" ?") ;
+      line.Send() ;
+      return false ;
+    }
+    const RegisterDbRegister& reg = Db::Registers[key->registerIndex] ;
+    line.Append(" = 0x") ;
+    line.AppendHex(value, (key->fieldIndex == RegisterDbKey::NoField) ? (reg.size / 4U) : 0U) ;
+    line.Send() ;
+    if (key->fieldIndex == RegisterDbKey::NoField)
+    {
+      for (std::size_t i = reg.firstField; i < reg.firstField + reg.fieldsCount; ++i)
+      {
+        const RegisterDbField& field = Db::Fields[i] ;
+        line.Append("  ") ;
+        line.Append(field.name) ;
+        line.Append(" [") ;
+        line.AppendDecimal(field.offset + field.width - 1U) ;
+        line.Append(":") ;
+        line.AppendDecimal(field.offset) ;
+        line.Append("] = 0x") ;
+        line.AppendHex((value >> field.offset) & Database::GetMask(field.width), 0U) ;
+        line.Send() ;
+      }
+    }
+    return true ;
+  }
+
+ private:
+  //Строка вывода, размер меньше буфера UartDriver
+  struct Line
+  {
+    static constexpr std::size_t MaxSize = 96U ;
+    static constexpr std::uint32_t LineTimeout = 10000000U ;
+    std::array<std::uint8_t, MaxSize> data ;
+    std::size_t size = 0U ;
+
+    void Append(const char* str)
+    {
+      //Длинная строка обрезается, 2 байта остаются для "\r\n"
+      for (; (*str != '\0') && (size < MaxSize - 2U); ++str)
+      {
+        data[size] = static_cast<std::uint8_t>(*str) ;
+        ++size ;
+      }
+    }
+
+    //Метод выводит число без ведущих нулей, если digits равно 0
+    void AppendHex(std::uint32_t value, std::uint32_t digits)
+    {
+      char buffer[9] = {} ;
+      std::size_t index = 8U ;
+      do
+      {
+        --index ;
+        buffer[index] = "0123456789ABCDEF"[value & 0xFU] ;
+        value >>= 4U ;
+      } while ((index > 0U) && ((value != 0U) || ((8U - index) < digits))) ;
+      Append(&buffer[index]) ;
+    }
+
+    void AppendDecimal(std::uint32_t value)
+    {
+      char buffer[11] = {} ;
+      std::size_t index = 10U ;
+      do
+      {
+        --index ;
+        buffer[index] = static_cast<char>('0' + (value % 10U)) ;
+        value /= 10U ;
+      } while (value != 0U) ;
+      Append(&buffer[index]) ;
+    }
+
+    void Send()
+    {
+      data[size] = '\r' ;
+      data[size + 1U] = '\n' ;
+      if (WaitFor([]() { return Driver::GetStatus() != Driver::Status::Write ; }, LineTimeout) == WaitStatus::Ready)
+      {
+        Driver::WriteData(data.data(), static_cast<std::uint8_t>(size + 2U)) ;
+      }
+      size = 0U ;
+    }
+  } ;
+} ;
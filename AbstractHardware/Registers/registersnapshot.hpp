@@ -0,0 +1,60 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>            //for std::size_t
+#include <tuple>              //for std::tuple, std::get
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include "accessmode.hpp"     //for ReadMode, ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline
+
+//Значения регистров, прочитанные один раз, например, регистров статуса и управления при входе в прерывание.
+//Регистры читаются в конструкторе в порядке перечисления, после этого значения полей проверяются по снимку
+//без обращений к периферии:
+//const RegisterSnapshot<USART2::SR, USART2::CR1> snapshot ;
+//if (USART2::SR::RXNE::DataReceived::IsSet(snapshot) && USART2::CR1::RXNEIE::InterruptWhenRXNE::IsSet(snapshot))
+//Регистр, которого нет в снимке, читается из периферии, поэтому обработчик можно вызвать со снимком
+//любого набора регистров.
+template<typename ...Registers>
+struct RegisterSnapshot
+{
+  static_assert(((std::is_base_of<ReadMode, typename Registers::Access>::value ||
+                  std::is_base_of<ReadWriteMode, typename Registers::Access>::value) && ...),
+                "All registers must be readable") ;
+
+  template<typename Reg>
+  static constexpr bool Contains = (std::is_same<Reg, Registers>::value || ...) ;
+
+  __forceinline RegisterSnapshot():
+    values{Registers::Memory::template Read<typename Registers::Type>(Registers::Address)...}
+  {
+  }
+
+  //Метод возвращает значение регистра на момент снимка
+  template<typename Reg>
+  __forceinline typename Reg::Type Get() const
+  {
+    if constexpr (Contains<Reg>)
+    {
+      return std::get<IndexOf<Reg>()>(values) ;
+    }
+    else
+    {
+      return Reg::Memory::template Read<typename Reg::Type>(Reg::Address) ;
+    }
+  }
+
+ private:
+  template<typename Reg>
+  static constexpr std::size_t IndexOf()
+  {
+    std::size_t index = 0U ;
+    std::size_t result = 0U ;
+    static_cast<void>(((std::is_same<Reg, Registers>::value ? (result = index, true) : (++index, false)) || ...)) ;
+    return result ;
+  }
+
+  std::tuple<typename Registers::Type...> values ;
+} ;
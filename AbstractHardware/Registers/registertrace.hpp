@@ -0,0 +1,183 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <array>          //for std::array
+#include <atomic>         //for std::atomic
+#include <cstddef>        //for std::size_t
+#include <cstdint>        //for std::uint32_t, std::uintptr_t
+#include "susudefs.hpp"   //for __forceinline
+
+//Размер кольцевого буфера трассировки в записях, должен быть степенью 2. Одна запись занимает 16 байт
+#if !defined(REGISTERS_TRACE_SIZE)
+#define REGISTERS_TRACE_SIZE 128U
+#endif
+
+enum class RegisterAccessKind : std::uint8_t
+{
+  Read = 'R',
+  Write = 'W',
+  AtomicSet = 'A' //Атомарная установка битового поля, значение - новое значение поля, сдвинутое на его смещение
+} ;
+
+struct RegisterTraceEntry
+{
+  std::uintptr_t address ;
+  std::uint32_t value ;
+  std::uint32_t timestamp ;
+  RegisterAccessKind kind ;
+} ;
+
+#if defined(REGISTERS_HOST_ACCESS)
+#include "registerhistogram.hpp" //for RegisterAccessHistogram
+#endif
+
+//Источник меток времени для трассировки. На Cortex-M3/M4 используется счетчик тактов DWT CYCCNT,
+//на RISC-V - счетчик тактов mcycle. На хосте и на Cortex-M0, где счетчика тактов нет, метка времени -
+//порядковый номер обращения.
+struct RegisterTraceClock
+{
+#if !defined(REGISTERS_HOST_ACCESS) && !defined(__riscv) && \
+    (defined(__ARM_FEATURE_LDREX) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+  //Метод включает счетчик тактов: бит TRCENA в DEMCR и бит CYCCNTENA в DWT_CTRL. Обращение идет напрямую,
+  //чтобы запуск трассировки сам не попадал в трассировку
+  static void Start()
+  {
+    *reinterpret_cast<volatile std::uint32_t*>(DemcrAddress) |= (1U << 24U) ;
+    *reinterpret_cast<volatile std::uint32_t*>(DwtCtrlAddress) |= 1U ;
+  }
+
+  __forceinline static std::uint32_t Get()
+  {
+    return *reinterpret_cast<volatile std::uint32_t*>(DwtCyccntAddress) ;
+  }
+
+ private:
+  static constexpr std::uintptr_t DemcrAddress = 0xE000EDFCU ;
+  static constexpr std::uintptr_t DwtCtrlAddress = 0xE0001000U ;
+  static constexpr std::uintptr_t DwtCyccntAddress = 0xE0001004U ;
+#elif !defined(REGISTERS_HOST_ACCESS) && defined(__riscv)
+  static void Start()
+  {
+  }
+
+  __forceinline static std::uint32_t Get()
+  {
+    std::uint32_t cycles ;
+    __asm volatile ("csrr %0, mcycle" : "=r"(cycles)) ;
+    return cycles ;
+  }
+#else
+  static void Start()
+  {
+  }
+
+  __forceinline static std::uint32_t Get()
+  {
+    return sequence++ ;
+  }
+
+ private:
+  inline static std::uint32_t sequence = 0U ;
+#endif
+} ;
+
+//Кольцевой буфер трассировки обращений к регистрам. Место под запись занимается атомарным увеличением
+//индекса, поэтому записывать в буфер можно одновременно из задачи и из прерываний без критической секции
+//(на Cortex-M0, где нет атомарных команд, атомарность индекса обеспечивает библиотека компилятора).
+//При переполнении самые старые записи затираются. Читать буфер нужно при остановленной трассировке.
+struct RegisterTrace
+{
+  static constexpr std::size_t Capacity = REGISTERS_TRACE_SIZE ;
+  static_assert((Capacity & (Capacity - 1U)) == 0U, "REGISTERS_TRACE_SIZE must be power of 2") ;
+
+  //Метод запускает трассировку, буфер при этом не очищается
+  static void Start()
+  {
+    RegisterTraceClock::Start() ;
+    isEnabled = true ;
+  }
+
+  static void Stop()
+  {
+    isEnabled = false ;
+  }
+
+  __forceinline static bool IsEnabled()
+  {
+    return isEnabled ;
+  }
+
+  static void Clear()
+  {
+    head.store(0U, std::memory_order_relaxed) ;
+  }
+
+  //Метод возвращает количество записей в буфере
+  static std::size_t Count()
+  {
+    const std::uint32_t total = head.load(std::memory_order_relaxed) ;
+    return (total < Capacity) ? static_cast<std::size_t>(total) : Capacity ;
+  }
+
+  //Метод возвращает количество затертых записей
+  static std::uint32_t Lost()
+  {
+    const std::uint32_t total = head.load(std::memory_order_relaxed) ;
+    return (total < Capacity) ? 0U : static_cast<std::uint32_t>(total - Capacity) ;
+  }
+
+  //Метод вызывает функцию для каждой записи буфера, начиная с самой старой
+  template<typename Function>
+  static void ForEach(Function function)
+  {
+    const std::uint32_t total = head.load(std::memory_order_acquire) ;
+    const std::uint32_t first = (total < Capacity) ? 0U : static_cast<std::uint32_t>(total - Capacity) ;
+    for (std::uint32_t i = first; i != total; ++i)
+    {
+      function(entries[i & (Capacity - 1U)]) ;
+    }
+  }
+
+  __forceinline static void Record(std::uintptr_t address, std::uint32_t value, RegisterAccessKind kind)
+  {
+    if (isEnabled)
+    {
+      const std::uint32_t index = head.fetch_add(1U, std::memory_order_relaxed) ;
+      entries[index & (Capacity - 1U)] = RegisterTraceEntry{address, value, RegisterTraceClock::Get(), kind} ;
+#if defined(REGISTERS_HOST_ACCESS)
+      RegisterAccessHistogram::OnAccess(address, value, kind) ;
+#endif
+    }
+  }
+
+ private:
+  inline static volatile bool isEnabled = false ;
+  inline static std::atomic<std::uint32_t> head = {0U} ;
+  inline static std::array<RegisterTraceEntry, Capacity> entries = {} ;
+} ;
+
+//Политика доступа к памяти регистров, которая записывает каждое обращение в RegisterTrace и передает его
+//обернутой политике
+template<typename Memory>
+struct TracedMemoryAccess
+{
+  using Underlying = Memory ;
+
+  __forceinline template<typename Type>
+  static Type Read(std::uintptr_t address)
+  {
+    const Type value = Memory::template Read<Type>(address) ;
+    RegisterTrace::Record(address, static_cast<std::uint32_t>(value), RegisterAccessKind::Read) ;
+    return value ;
+  }
+
+  __forceinline template<typename Type>
+  static void Write(std::uintptr_t address, Type value)
+  {
+    Memory::template Write<Type>(address, value) ;
+    RegisterTrace::Record(address, static_cast<std::uint32_t>(value), RegisterAccessKind::Write) ;
+  }
+} ;
@@ -0,0 +1,74 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstdint>            //for std::uint8_t, std::uint32_t
+#include "registertrace.hpp"  //for RegisterTrace, RegisterTraceEntry
+#include "waituntil.hpp"      //for WaitFor
+
+//Класс для вывода трассировки обращений к регистрам через UART в текстовом виде, по строке на обращение:
+//"<адрес> <R|W|A> <значение> <метка времени>\r\n", все числа шестнадцатеричные. Первой строкой выводится
+//количество затертых записей. Вывод выполняется опросом флага TXE, без прерываний, поэтому его можно вызвать
+//из обработчика исключения (например, HardFault). На время вывода трассировка останавливается, чтобы
+//обращения к регистрам самого UART в нее не попадали. Uart - класс вида HardwareUartBase.
+template<typename Uart>
+struct RegisterTraceDump
+{
+  static void Dump()
+  {
+    const bool isEnabled = RegisterTrace::IsEnabled() ;
+    RegisterTrace::Stop() ;
+
+    WriteString("Lost ") ;
+    WriteHex(RegisterTrace::Lost()) ;
+    WriteString("\r\n") ;
+    RegisterTrace::ForEach([](const RegisterTraceEntry& entry)
+    {
+      WriteHex(static_cast<std::uint32_t>(entry.address)) ;
+      WriteByte(' ') ;
+      WriteByte(static_cast<std::uint8_t>(entry.kind)) ;
+      WriteByte(' ') ;
+      WriteHex(entry.value) ;
+      WriteByte(' ') ;
+      WriteHex(entry.timestamp) ;
+      WriteString("\r\n") ;
+    }) ;
+
+    if (isEnabled)
+    {
+      RegisterTrace::Start() ;
+    }
+  }
+
+ private:
+  static constexpr std::uint32_t ByteTimeout = 200000U ;
+
+  //Если UART не освободился (например, не включено тактирование), байт пропускается, чтобы вывод из
+  //обработчика исключения не зависал
+  static void WriteByte(std::uint8_t byte)
+  {
+    if (WaitFor([]() { return Uart::IsDataRegisterEmpty() ; }, ByteTimeout) == WaitStatus::Ready)
+    {
+      Uart::WriteByte(byte) ;
+    }
+  }
+
+  static void WriteString(const char* str)
+  {
+    while (*str != '\0')
+    {
+      WriteByte(static_cast<std::uint8_t>(*str)) ;
+      ++str ;
+    }
+  }
+
+  static void WriteHex(std::uint32_t value)
+  {
+    for (std::uint32_t shift = 28U; shift <= 28U; shift -= 4U)
+    {
+      WriteByte(static_cast<std::uint8_t>("0123456789ABCDEF"[(value >> shift) & 0xFU])) ;
+    }
+  }
+} ;
@@ -0,0 +1,204 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>            //for std::size_t
+#include <cstdint>            //for std::uintptr_t
+#include <type_traits>        //for std::is_same, std::void_t
+#include "susudefs.hpp"       //for __forceinline
+#include "buses.hpp"          //for UnknownBus
+
+//Характеристики регистров, которые генератор добавляет в описание регистра. Заголовочные файлы, созданные
+//старыми версиями генератора, этих характеристик не содержат, поэтому для каждой задано значение по умолчанию.
+
+//Вспомогательный класс, проверяет, что регистр принадлежит периферии. Если генератор не указал для регистра
+//периферию, то проверить принадлежность нельзя и считаем, что регистр принадлежит периферии
+template<typename Reg, typename Periph, typename = void>
+struct IsRegisterOf : std::true_type
+{
+} ;
+
+template<typename Reg, typename Periph>
+struct IsRegisterOf<Reg, Periph, std::void_t<typename Reg::Peripheral>> :
+  std::is_same<typename Reg::Peripheral, Periph>
+{
+} ;
+
+//Вспомогательный класс, проверяет, что генератор указал для регистра периферию. Такие заголовочные файлы созданы
+//генератором, который записывает все характеристики регистра, кроме масок, равных 0
+template<typename Reg, typename = void>
+struct HasRegisterTraits : std::false_type
+{
+} ;
+
+template<typename Reg>
+struct HasRegisterTraits<Reg, std::void_t<typename Reg::Peripheral>> : std::true_type
+{
+} ;
+
+//Вспомогательный класс, возвращает маску битовых полей регистра, которые может изменить аппаратура
+//(флаги статуса, счетчики, самосбрасывающиеся биты). Если регистр описан старой версией генератора, то маска
+//неизвестна (IsKnown = false) и Value = 0 не означает, что аппаратура регистр не меняет
+template<typename Reg, typename = void>
+struct RegisterVolatileMask
+{
+  static constexpr bool IsKnown = HasRegisterTraits<Reg>::value ;
+  static constexpr typename Reg::Type Value = 0U ;
+} ;
+
+template<typename Reg>
+struct RegisterVolatileMask<Reg, std::void_t<decltype(Reg::VolatileMask)>>
+{
+  static constexpr bool IsKnown = true ;
+  static constexpr typename Reg::Type Value = Reg::VolatileMask ;
+} ;
+
+//Вспомогательный класс, возвращает маску битовых полей регистра, доступных для записи. Если генератор не указал
+//маску, то считается, что для записи доступны все биты регистра
+template<typename Reg, typename = void>
+struct RegisterWritableMask
+{
+  static constexpr typename Reg::Type Value = static_cast<typename Reg::Type>(~typename Reg::Type{0U}) ;
+} ;
+
+template<typename Reg>
+struct RegisterWritableMask<Reg, std::void_t<decltype(Reg::WritableMask)>>
+{
+  static constexpr typename Reg::Type Value = Reg::WritableMask ;
+} ;
+
+//Вспомогательный класс, возвращает маску битов регистра, которые сохраняются в снимок периферии. Генератор
+//указывает маску, только если она отличается от маски битов, доступных для записи: для регистров статуса и
+//данных она равна 0, а биты запуска (SWSTART, STRT) в нее не входят. Если регистр описан старой версией
+//генератора без маски снимка, то маска неизвестна (IsKnown = false) и регистр может оказаться регистром данных
+template<typename Reg, typename = void>
+struct RegisterSnapshotMask
+{
+  static constexpr bool IsKnown = HasRegisterTraits<Reg>::value ;
+  static constexpr typename Reg::Type Value = RegisterWritableMask<Reg>::Value ;
+} ;
+
+template<typename Reg>
+struct RegisterSnapshotMask<Reg, std::void_t<decltype(Reg::SnapshotMask)>>
+{
+  static constexpr bool IsKnown = true ;
+  static constexpr typename Reg::Type Value = Reg::SnapshotMask ;
+} ;
+
+//Вспомогательный класс, возвращает маску битов включения периферии (CEN, SPE, UE), которые не входят в маску
+//снимка: периферия настраивается выключенной, поэтому снимок включает ее после восстановления всех регистров.
+//Если генератор не указал маску, то таких битов нет
+template<typename Reg, typename = void>
+struct RegisterEnableMask
+{
+  static constexpr typename Reg::Type Value = 0U ;
+} ;
+
+template<typename Reg>
+struct RegisterEnableMask<Reg, std::void_t<decltype(Reg::EnableMask)>>
+{
+  static constexpr typename Reg::Type Value = Reg::EnableMask ;
+} ;
+
+//Вспомогательный класс, возвращает значение регистра после сброса. Если генератор не указал значение, то оно
+//неизвестно
+template<typename Reg, typename = void>
+struct RegisterResetValue
+{
+  static constexpr bool IsKnown = false ;
+  static constexpr typename Reg::Type Value = 0U ;
+} ;
+
+template<typename Reg>
+struct RegisterResetValue<Reg, std::void_t<decltype(Reg::ResetValue)>>
+{
+  static constexpr bool IsKnown = true ;
+  static constexpr typename Reg::Type Value = Reg::ResetValue ;
+} ;
+
+//Вспомогательный класс, возвращает регистр, который одной записью устанавливает и сбрасывает биты регистра
+//(BSRR для ODR, BOP для OCTL). Младшие Shift бит регистра установки и сброса устанавливают биты, следующие
+//Shift бит - сбрасывают. Если генератор не указал такой регистр, то его нет
+template<typename Reg, typename = void>
+struct RegisterSetReset
+{
+  static constexpr bool IsAvailable = false ;
+} ;
+
+template<typename Reg>
+struct RegisterSetReset<Reg, std::void_t<typename Reg::SetResetRegister>>
+{
+  static constexpr bool IsAvailable = true ;
+  using Type = typename Reg::SetResetRegister ;
+  static constexpr std::size_t Shift = Reg::SetResetShift ;
+} ;
+
+//Вспомогательные классы, возвращают маски битов регистра, которые сбрасываются записью 0 (rc_w0, например, флаги
+//TIMx::SR) и записью 1 (rc_w1, например, EXTI::PR). Если генератор не указал маски, то таких битов нет
+template<typename Reg, typename = void>
+struct RegisterZeroToClearMask
+{
+  static constexpr typename Reg::Type Value = 0U ;
+} ;
+
+template<typename Reg>
+struct RegisterZeroToClearMask<Reg, std::void_t<decltype(Reg::ZeroToClearMask)>>
+{
+  static constexpr typename Reg::Type Value = Reg::ZeroToClearMask ;
+} ;
+
+template<typename Reg, typename = void>
+struct RegisterOneToClearMask
+{
+  static constexpr typename Reg::Type Value = 0U ;
+} ;
+
+template<typename Reg>
+struct RegisterOneToClearMask<Reg, std::void_t<decltype(Reg::OneToClearMask)>>
+{
+  static constexpr typename Reg::Type Value = Reg::OneToClearMask ;
+} ;
+
+#if defined(REGISTERS_PROMOTION_DIAGNOSTIC)
+template<std::uintptr_t address>
+[[deprecated("Set() is compiled as a single write: field values cover all writable bits of the register")]]
+constexpr void SetPromotedToWrite()
+{
+}
+#endif
+
+//Вспомогательный класс, проверяет, что битовые поля с общей маской mask перекрывают все доступные для записи
+//биты регистра. Тогда значение регистра перед записью читать не нужно и чтение-модификацию-запись можно заменить
+//одной записью. Зарезервированные биты вне маски записи записываются значением после сброса (ReservedValue),
+//например, бит 29 RCC::PLLCFGR, который должен оставаться равным 1. Если определен REGISTERS_PROMOTION_DIAGNOSTIC,
+//то о каждой замене выводится предупреждение компилятора с адресом регистра
+template<typename Reg, typename Reg::Type mask>
+struct SetPromotion
+{
+  static constexpr bool IsPromoted = ((mask & RegisterWritableMask<Reg>::Value) == RegisterWritableMask<Reg>::Value) ;
+  static constexpr typename Reg::Type ReservedValue = static_cast<typename Reg::Type>(
+    RegisterResetValue<Reg>::Value & ~RegisterWritableMask<Reg>::Value & ~mask) ;
+
+  __forceinline static void OnPromoted()
+  {
+#if defined(REGISTERS_PROMOTION_DIAGNOSTIC)
+    SetPromotedToWrite<Reg::Address>() ;
+#endif
+  }
+} ;
+
+//Вспомогательный класс, возвращает шину, к которой подключена периферия регистра. Если генератор не указал
+//шину или периферию, то шина неизвестна
+template<typename Reg, typename = void>
+struct RegisterBus
+{
+  using Type = UnknownBus ;
+} ;
+
+template<typename Reg>
+struct RegisterBus<Reg, std::void_t<typename Reg::Peripheral::Bus>>
+{
+  using Type = typename Reg::Peripheral::Bus ;
+} ;
@@ -0,0 +1,109 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cstddef>            //for std::size_t
+#include <cstdint>            //for std::uint32_t
+#include <type_traits>        //for std::is_base_of
+#include "accessmode.hpp"     //for ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline
+#include "bitband.hpp"        //for BitBand
+#include "registertraits.hpp" //for SetPromotion, RegisterSetReset
+#include "setreset.hpp"       //for SetReset
+#include "clearonwrite.hpp"   //for ClearOnWrite
+
+//Класс изменяет биты регистра самым дешевым способом, который известен на этапе компиляции. Через него
+//изменяют регистр методы Set битовых полей, их значений, наборов полей (Register, FieldsUpdate, FieldArray)
+//и транзакций, поэтому порядок выбора один для всех:
+//- биты регистра, у которого есть регистр установки и сброса (ODR), изменяются одной записью в него;
+//- флаги регистра, которые сбрасываются записью, записываются значением, которое их не изменяет (ClearOnWrite),
+//  иначе чтение-модификация-запись сбросила бы флаги, установленные аппаратурой;
+//- однобитовое поле в области bit-band устанавливается одной записью в псевдоним;
+//- если биты перекрывают все доступные для записи биты регистра, то регистр не читается, а записывается
+//  (SetPromotion);
+//- иначе регистр читается, биты заменяются и регистр записывается.
+template<typename Reg>
+struct RegisterWriter
+{
+  using Type = typename Reg::Type ;
+  using Memory = typename Reg::Memory ;
+
+  //Метод возвращает номер младшего бита маски
+  static constexpr std::size_t GetOffset(Type mask)
+  {
+    std::size_t offset = 0U ;
+    while ((mask != 0U) && ((mask & 1U) == 0U))
+    {
+      mask = static_cast<Type>(mask >> 1U) ;
+      ++offset ;
+    }
+    return offset ;
+  }
+
+  //Метод проверяет, что маска из одного бита и его можно записать через псевдоним bit-band
+  template<Type mask>
+  static constexpr bool IsBitBand()
+  {
+    constexpr bool isSingleBit = (mask != 0U) && ((mask & static_cast<Type>(mask - 1U)) == 0U) ;
+    return BitBand<Reg, GetOffset(mask), isSingleBit ? 1U : 0U>::IsAvailable ;
+  }
+
+  //Метод записывает value в биты mask, остальные биты регистра не изменяются
+  __forceinline template<Type mask>
+  static void Update(Type value)
+  {
+    using Promotion = SetPromotion<Reg, mask> ;
+    if constexpr (RegisterSetReset<Reg>::IsAvailable)
+    {
+      SetReset<Reg>::Update(mask, value) ;
+    }
+    else if constexpr (ClearOnWrite<Reg>::IsAvailable)
+    {
+      ClearOnWrite<Reg>::template Update<mask>(value) ;
+    }
+    else if constexpr (IsBitBand<mask>())
+    {
+      BitBand<Reg, GetOffset(mask), 1U>::Write(static_cast<std::uint32_t>(value >> GetOffset(mask))) ;
+    }
+    else if constexpr (Promotion::IsPromoted)
+    {
+      Promotion::OnPromoted() ;
+      Memory::template Write<Type>(Reg::Address, static_cast<Type>(value | Promotion::ReservedValue)) ;
+    }
+    else
+    {
+      Modify(mask, value) ;
+    }
+  }
+
+  //Метод записывает value в биты mask, известные только во время выполнения (поле FieldArray), поэтому
+  //bit-band и запись без чтения не выбираются
+  __forceinline static void Update(Type mask, Type value)
+  {
+    if constexpr (RegisterSetReset<Reg>::IsAvailable)
+    {
+      SetReset<Reg>::Update(mask, value) ;
+    }
+    else if constexpr (ClearOnWrite<Reg>::IsAvailable)
+    {
+      ClearOnWrite<Reg>::Update(mask, value) ;
+    }
+    else
+    {
+      Modify(mask, value) ;
+    }
+  }
+
+ private:
+  __forceinline static void Modify(Type mask, Type value)
+  {
+    static_assert(std::is_base_of<ReadWriteMode, typename Reg::Access>::value,
+                  "Register is not available for read-modify-write") ;
+    Type newRegValue = Memory::template Read<Type>(Reg::Address) ; //Сохраняем текущее значение регистра
+    newRegValue &= static_cast<Type>(~mask) ; //Сбрасываем биты, которые нужно будет установить
+    newRegValue |= value ; //Устанавливаем новые значения битов
+    Memory::template Write<Type>(Reg::Address, newRegValue) ; //Записываем в регистр новое значение
+  }
+} ;
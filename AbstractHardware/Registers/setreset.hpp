@@ -0,0 +1,59 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <cassert>            //for assert
+#include <cstddef>            //for std::size_t
+#include "susudefs.hpp"       //for __forceinline
+#include "registertraits.hpp" //for RegisterSetReset
+
+//Класс для изменения битов регистра (например, ODR) через его регистр установки и сброса (BSRR, BOP). Любое
+//изменение выполняется одной записью, регистр при этом не читается, поэтому изменение битов из задачи и из
+//прерывания не требует критической секции и не теряет изменения, сделанные между чтением и записью.
+template<typename Reg>
+struct SetReset
+{
+  static_assert(RegisterSetReset<Reg>::IsAvailable, "Register has no set/reset register") ;
+
+  using Type = typename Reg::Type ;
+  using Register = typename RegisterSetReset<Reg>::Type ;
+  static constexpr std::size_t Shift = RegisterSetReset<Reg>::Shift ;
+
+  //Метод возвращает значение регистра установки и сброса, которое устанавливает биты mask, равные 1 в value,
+  //и сбрасывает биты mask, равные 0 в value
+  static constexpr typename Register::Type GetValue(Type mask, Type value)
+  {
+    return static_cast<typename Register::Type>(
+      static_cast<typename Register::Type>(value & mask) |
+      static_cast<typename Register::Type>(static_cast<typename Register::Type>(~value & mask) << Shift)) ;
+  }
+
+  //Метод устанавливает биты mask в значения из value
+  __forceinline static void Update(Type mask, Type value)
+  {
+    assert((mask >> Shift) == 0U) ;
+    Register::Write(GetValue(mask, value)) ;
+  }
+
+  //Метод записывает значение в регистр установки и сброса как есть: младшие биты устанавливаются, старшие
+  //сбрасываются
+  __forceinline static void Set(typename Register::Type bits)
+  {
+    Register::Write(bits) ;
+  }
+
+  __forceinline static void Reset(Type bits)
+  {
+    Register::Write(static_cast<typename Register::Type>(static_cast<typename Register::Type>(bits) << Shift)) ;
+  }
+
+  //Метод переключает биты: текущее значение регистра считывается один раз, а переключение выполняется
+  //одной записью в регистр установки и сброса
+  __forceinline static void Toggle(Type bits)
+  {
+    const Type current = Reg::Memory::template Read<Type>(Reg::Address) ;
+    Update(bits, static_cast<Type>(~current)) ;
+  }
+} ;
@@ -0,0 +1,97 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include "accessmode.hpp"     //for WriteMode, ReadMode, ReadWriteMode
+#include "susudefs.hpp"       //for __forceinline
+#include "registertraits.hpp" //for RegisterVolatileMask, RegisterResetValue
+
+//Класс для работы с регистром через копию в ОЗУ. Подходит для регистров, которые меняет только программа
+//(GPIO ODR и MODER, SPI CR1, TIM PSC и ARR): значение регистра и чтение-модификация-запись берутся из копии,
+//а к периферии выполняется только одна итоговая запись. Регистры, битовые поля которых может изменить
+//аппаратура (генератор помечает их маской VolatileMask), использовать через копию нельзя. Заголовочные файлы
+//старых версий генератора эту маску не содержат, поэтому их регистры через копию тоже не используются.
+//Копия не защищена от одновременного изменения из задачи и прерывания, так же как и Set() обычного регистра.
+template<typename Reg>
+struct Shadowed
+{
+  static_assert(RegisterVolatileMask<Reg>::IsKnown,
+                "Register description has no VolatileMask, it is unknown whether hardware modifies the register") ;
+  static_assert(RegisterVolatileMask<Reg>::Value == 0U,
+                "Register has fields modified by hardware, it can not be shadowed") ;
+
+  using Type = typename Reg::Type ;
+  using Memory = typename Reg::Memory ;
+  static constexpr auto Address = Reg::Address ;
+
+  //Метод Get возвращает значение регистра из копии, обращения к периферии нет
+  __forceinline static Type Get()
+  {
+    return shadow ;
+  }
+
+  //Метод Write записывает значение в копию и в регистр, будет работать только для регистров,
+  //в которые можно записать значение
+  __forceinline template<typename T = typename Reg::Access,
+    class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
+  static void Write(Type value)
+  {
+    shadow = value ;
+    Memory::template Write<Type>(Address, value) ;
+  }
+
+  //Метод Set устанавливает биты регистра, значение регистра берется из копии
+  __forceinline template<typename T = typename Reg::Access,
+    class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
+  static void Set(Type value)
+  {
+    Write(static_cast<Type>(shadow | value)) ;
+  }
+
+  //Метод Toggle переключает биты регистра, значение регистра берется из копии
+  __forceinline template<typename T = typename Reg::Access,
+    class = typename std::enable_if_t<std::is_base_of<WriteMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
+  static void Toggle(Type value)
+  {
+    Write(static_cast<Type>(shadow ^ value)) ;
+  }
+
+  //Метод Set устанавливает значения битовых полей регистра, значение регистра берется из копии
+  __forceinline template<typename ...FieldValues>
+  static void Set()
+  {
+    static_assert((std::is_same<typename FieldValues::FieldType::Register, Reg>::value && ...),
+                  "Field value does not belong to the register") ;
+    constexpr Type mask = static_cast<Type>((static_cast<Type>(FieldValues::Mask << FieldValues::Offset) | ...)) ;
+    constexpr Type value = static_cast<Type>((static_cast<Type>(FieldValues::Value << FieldValues::Offset) | ...)) ;
+    Write(static_cast<Type>((shadow & static_cast<Type>(~mask)) | value)) ;
+  }
+
+  //Метод IsSet проверяет по копии, что все битовые поля из переданного набора установлены
+  __forceinline template<typename ...FieldValues>
+  static bool IsSet()
+  {
+    static_assert((std::is_same<typename FieldValues::FieldType::Register, Reg>::value && ...),
+                  "Field value does not belong to the register") ;
+    constexpr Type mask = static_cast<Type>((static_cast<Type>(FieldValues::Mask << FieldValues::Offset) | ...)) ;
+    constexpr Type value = static_cast<Type>((static_cast<Type>(FieldValues::Value << FieldValues::Offset) | ...)) ;
+    return ((shadow & mask) == value) ;
+  }
+
+  //Метод Sync перечитывает значение регистра в копию. Нужно вызывать, если регистр был изменен в обход копии,
+  //например, напрямую через Reg или загрузчиком до старта программы
+  __forceinline template<typename T = typename Reg::Access,
+    class = typename std::enable_if_t<std::is_base_of<ReadMode, T>::value || std::is_base_of<ReadWriteMode, T>::value>>
+  static void Sync()
+  {
+    shadow = Memory::template Read<Type>(Address) ;
+  }
+
+ private:
+  //Копия регистра равна значению регистра после сброса. Если генератор не указал это значение, то копия равна 0
+  //и для регистров, значение которых после сброса отлично от 0, перед использованием нужно вызвать Sync()
+  inline static Type shadow = RegisterResetValue<Reg>::Value ;
+} ;
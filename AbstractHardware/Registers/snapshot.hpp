@@ -0,0 +1,174 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <array>              //for std::array
+#include <cstddef>            //for std::size_t
+#include <cstdint>            //for std::uintptr_t, std::uint32_t
+#include <type_traits>        //for std::is_same, std::is_base_of
+#include <utility>            //for std::index_sequence
+#include "accessmode.hpp"     //for ReadWriteMode
+#include "memoryaccess.hpp"   //for DefaultMemoryAccess
+#include "susudefs.hpp"       //for TypesList
+#include "registertraits.hpp" //for RegisterSnapshotMask, RegisterEnableMask
+
+//Запись таблицы регистров снимка: адрес регистра, маска битов, которые восстанавливаются, и маска битов
+//включения периферии, которые восстанавливаются вторым проходом
+struct SnapshotEntry
+{
+  std::uintptr_t address ;
+  std::uint32_t mask ;
+  std::uint32_t enableMask ;
+} ;
+
+//Класс для сохранения настроек периферии перед входом в режим Standby или Stop и их восстановления после
+//выхода из него. Сохраняются только регистры для чтения и записи с ненулевой маской снимка (регистры статуса,
+//данных и счетчики генератор исключает). Регистры восстанавливаются без чтения, периферия за периферией
+//в порядке перечисления, внутри периферии - в порядке возрастания адресов, биты включения периферии (CEN, SPE,
+//UE) записываются вторым проходом. Источники тактирования и PLL требуют
+//ожидания готовности, поэтому тактирование настраивается до восстановления снимка (например, InitSequence),
+//а в снимок включается только периферия. Storage можно разместить в RAM или в backup SRAM:
+//using SensorSnapshot = Snapshot<GPIOA, USART2, ADC1> ;
+//SensorSnapshot::Storage storage ;
+//SensorSnapshot::Save(storage) ; ... SensorSnapshot::Restore(storage) ;
+template<typename ...Peripherals>
+struct Snapshot
+{
+ private:
+  template<typename ...Regs>
+  static constexpr std::size_t GetRegistersCount(TypesList<Regs...>)
+  {
+    return sizeof...(Regs) ;
+  }
+
+  static constexpr std::size_t RegistersCount = (GetRegistersCount(typename Peripherals::Registers()) + ... + 0U) ;
+
+  struct Item
+  {
+    SnapshotEntry entry ;
+    std::size_t order ;
+  } ;
+
+  struct Compiled
+  {
+    std::array<SnapshotEntry, RegistersCount> entries ;
+    std::size_t size ;
+  } ;
+
+  template<typename Reg>
+  static constexpr SnapshotEntry GetEntry()
+  {
+    static_assert(!std::is_base_of<ReadWriteMode, typename Reg::Access>::value || RegisterSnapshotMask<Reg>::IsKnown,
+                  "Register description has no SnapshotMask, it is unknown whether the register holds settings") ;
+    if constexpr (std::is_base_of<ReadWriteMode, typename Reg::Access>::value &&
+                  ((RegisterSnapshotMask<Reg>::Value | RegisterEnableMask<Reg>::Value) != 0U))
+    {
+      static_assert(sizeof(typename Reg::Type) == sizeof(std::uint32_t), "Only 32 bit registers are supported") ;
+      static_assert(std::is_same<typename Reg::Memory, DefaultMemoryAccess>::value,
+                    "Register must use the default memory access") ;
+      return SnapshotEntry{Reg::Address, static_cast<std::uint32_t>(RegisterSnapshotMask<Reg>::Value),
+                           static_cast<std::uint32_t>(RegisterEnableMask<Reg>::Value)} ;
+    }
+    else
+    {
+      return SnapshotEntry{Reg::Address, 0U, 0U} ;
+    }
+  }
+
+  template<typename ...Regs>
+  static constexpr void AddItems(TypesList<Regs...>, std::array<Item, RegistersCount>& items, std::size_t& size,
+                                 std::size_t order)
+  {
+    const std::array<SnapshotEntry, sizeof...(Regs)> entries = {GetEntry<Regs>()...} ;
+    for (const auto& entry: entries)
+    {
+      if ((entry.mask | entry.enableMask) != 0U)
+      {
+        items[size] = Item{entry, order} ;
+        ++size ;
+      }
+    }
+  }
+
+  static constexpr Compiled Compile()
+  {
+    std::array<Item, RegistersCount> items = {} ;
+    std::size_t size = 0U ;
+    std::size_t order = 0U ;
+    ((AddItems(typename Peripherals::Registers(), items, size, order), ++order), ...) ;
+
+    //Сортировка вставками по номеру периферии и адресу регистра
+    for (std::size_t i = 1U; i < size; ++i)
+    {
+      const Item item = items[i] ;
+      std::size_t j = i ;
+      while ((j > 0U) && ((items[j - 1U].order > item.order) ||
+             ((items[j - 1U].order == item.order) && (items[j - 1U].entry.address > item.entry.address))))
+      {
+        items[j] = items[j - 1U] ;
+        --j ;
+      }
+      items[j] = item ;
+    }
+
+    //Регистры с одним адресом (например, CCMR1_Output и CCMR1_Input) сохраняются один раз
+    Compiled result = {} ;
+    result.size = 0U ;
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+      if ((result.size != 0U) && (result.entries[result.size - 1U].address == items[i].entry.address))
+      {
+        result.entries[result.size - 1U].mask |= items[i].entry.mask ;
+        result.entries[result.size - 1U].enableMask |= items[i].entry.enableMask ;
+      }
+      else
+      {
+        result.entries[result.size] = items[i].entry ;
+        ++result.size ;
+      }
+    }
+    return result ;
+  }
+
+  static constexpr Compiled compiled = Compile() ;
+
+  template<std::size_t... Indexes>
+  static constexpr std::array<SnapshotEntry, sizeof...(Indexes)> GetTable(std::index_sequence<Indexes...>)
+  {
+    return {compiled.entries[Indexes]...} ;
+  }
+
+ public:
+  static constexpr std::size_t Size = compiled.size ;
+  static constexpr std::array<SnapshotEntry, Size> Table = GetTable(std::make_index_sequence<Size>()) ;
+  using Storage = std::array<std::uint32_t, Size> ;
+
+  static void Save(Storage& storage)
+  {
+    for (std::size_t i = 0U; i < Size; ++i)
+    {
+      storage[i] = DefaultMemoryAccess::template Read<std::uint32_t>(Table[i].address) ;
+    }
+  }
+
+  //Метод восстанавливает регистры только записью, биты вне маски снимка (биты запуска, только для чтения)
+  //записываются равными 0. Первый проход восстанавливает регистры с выключенной периферией, второй - включает
+  //периферию, которая была включена, записывая регистр еще раз вместе с битами включения
+  static void Restore(const Storage& storage)
+  {
+    for (std::size_t i = 0U; i < Size; ++i)
+    {
+      DefaultMemoryAccess::template Write<std::uint32_t>(Table[i].address, storage[i] & Table[i].mask) ;
+    }
+    for (std::size_t i = 0U; i < Size; ++i)
+    {
+      if ((storage[i] & Table[i].enableMask) != 0U)
+      {
+        DefaultMemoryAccess::template Write<std::uint32_t>(Table[i].address,
+                                                           storage[i] & (Table[i].mask | Table[i].enableMask)) ;
+      }
+    }
+  }
+} ;
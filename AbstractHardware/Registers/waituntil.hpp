@@ -0,0 +1,130 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+
+#pragma once
+
+#include <algorithm>          //for std::min
+#include <cstdint>            //for std::uint32_t, std::uint8_t
+#include "susudefs.hpp"       //for __forceinline
+
+#if !defined(REGISTERS_HOST_ACCESS) && !defined(__riscv)
+#include "intrinsics.h"       //for __WFE
+#endif
+
+//Результат ожидания: условие выполнено или истекло максимальное количество опросов
+enum class WaitStatus: std::uint8_t
+{
+  Ready = 0U,
+  Timeout = 1U
+} ;
+
+//Количество опросов, при котором ожидание не ограничено, например, если его ограничивает сама аппаратура
+//(переполнение таймера)
+constexpr std::uint32_t WaitForever = 0xFFFFFFFFU ;
+
+//Статистика ожиданий. Включается определением REGISTERS_INSTRUMENTATION, позволяет подобрать ограничения
+//ожиданий по максимальному количеству опросов, которое было на самом деле.
+struct WaitStatistics
+{
+#if defined(REGISTERS_INSTRUMENTATION)
+  inline static volatile std::uint32_t waitCount = 0U ;    //Количество ожиданий
+  inline static volatile std::uint32_t timeoutCount = 0U ; //Количество ожиданий, закончившихся по таймауту
+  inline static volatile std::uint32_t maxPolls = 0U ;     //Максимальное количество опросов одного ожидания
+
+  static void Reset()
+  {
+    waitCount = 0U ;
+    timeoutCount = 0U ;
+    maxPolls = 0U ;
+  }
+#endif
+
+  __forceinline static void OnWait(std::uint32_t polls, WaitStatus status)
+  {
+#if defined(REGISTERS_INSTRUMENTATION)
+    waitCount = waitCount + 1U ;
+    if (status == WaitStatus::Timeout)
+    {
+      timeoutCount = timeoutCount + 1U ;
+    }
+    if (polls > maxPolls)
+    {
+      maxPolls = polls ;
+    }
+#else
+    static_cast<void>(polls) ;
+    static_cast<void>(status) ;
+#endif
+  }
+} ;
+
+//Стратегия ожидания: опрос без пауз, минимальная задержка реакции
+struct SpinWait
+{
+  __forceinline static void Pause(std::uint32_t poll)
+  {
+    static_cast<void>(poll) ;
+  }
+} ;
+
+//Стратегия ожидания: пауза между опросами удваивается до maxDelay итераций пустого цикла. Подходит для долгих
+//операций (стирание Flash), когда частые чтения регистра только нагружают шину
+template<std::uint32_t maxDelay = 1024U>
+struct BackoffWait
+{
+  static void Pause(std::uint32_t poll)
+  {
+    const std::uint32_t delay = (poll < 31U) ? std::min((1U << poll), maxDelay) : maxDelay ;
+    for (volatile std::uint32_t i = 0U; i < delay; i = i + 1U)
+    {
+    }
+  }
+} ;
+
+//Стратегия ожидания: ядро останавливается командой WFE до события. Событием является и вход в прерывание, а
+//при установленном бите SEVONPEND (SCB::SCR::SEVEONPEND) и появление ожидающего прерывания, даже запрещенного
+//в NVIC. Поэтому у периферии нужно разрешить прерывание по ожидаемому флагу, иначе ядро проснется только по
+//другому прерыванию (например, SysTick). На RISC-V используется WFI.
+struct EventWait
+{
+  __forceinline static void Pause(std::uint32_t poll)
+  {
+    static_cast<void>(poll) ;
+#if defined(REGISTERS_HOST_ACCESS)
+#elif defined(__riscv)
+    __asm volatile ("wfi") ;
+#else
+    __WFE() ;
+#endif
+  }
+} ;
+
+//Функция опрашивает условие, пока оно не выполнится, но не больше timeout раз. Между опросами вызывается
+//стратегия ожидания, например:
+//if (WaitFor([]() { return Uart::IsDataRegisterEmpty() ; }, UartTimeout) == WaitStatus::Ready)
+template<typename Predicate, typename Strategy = SpinWait>
+WaitStatus WaitFor(Predicate predicate, std::uint32_t timeout, Strategy = Strategy{})
+{
+  std::uint32_t polls = 0U ;
+  while (!predicate())
+  {
+    if ((timeout != WaitForever) && (polls >= timeout))
+    {
+      WaitStatistics::OnWait(polls, WaitStatus::Timeout) ;
+      return WaitStatus::Timeout ;
+    }
+    Strategy::Pause(polls) ;
+    ++polls ;
+  }
+  WaitStatistics::OnWait(polls, WaitStatus::Ready) ;
+  return WaitStatus::Ready ;
+}
+
+//Функция ждет, пока не будут установлены все значения битовых полей, например:
+//WaitUntil<FLASH::SR::BSY::NotBusy>(FlashTimeout, BackoffWait<>{}) ;
+template<typename FieldValue, typename ...FieldValues, typename Strategy = SpinWait>
+WaitStatus WaitUntil(std::uint32_t timeout, Strategy strategy = Strategy{})
+{
+  return WaitFor([]() { return FieldValue::IsSet() && (FieldValues::IsSet() && ...) ; }, timeout, strategy) ;
+}
@@ -8,6 +8,7 @@
 #include <cstddef>  //for std::uint8_t
 
 #include "susudefs.hpp"  //for __forceinline
+#include "waituntil.hpp" //for WaitUntil
 
 
 template<typename SpiModule>
@@ -22,26 +23,35 @@ struct Spi
 				// no implementation for SPI
 		}
 
-  __forceinline static void WriteByte(std::uint8_t chByte)
+  //Метод возвращает false, если модуль SPI не освободился за SpiTimeout опросов (например, не включено
+  //тактирование модуля)
+  __forceinline static bool WriteByte(std::uint8_t chByte)
   {
-    while (SpiModule::SR::TXE::TxBufferNotEmpty::IsSet())
+    if (WaitUntil<typename SpiModule::SR::TXE::TxBufferEmpty>(SpiTimeout) == WaitStatus::Timeout)
     {
+      return false ;
     }
     SendByte(chByte);
-    while (SpiModule::SR::BSY::Busy::IsSet())
-    {
-    }
+    return WaitUntil<typename SpiModule::SR::BSY::NotBusy>(SpiTimeout) == WaitStatus::Ready ;
   }
 
-  static void WriteData(std::uint8_t *pData, size_t size)
+  //Метод прекращает передачу и возвращает false, если байт не передан за SpiTimeout опросов
+  static bool WriteData(std::uint8_t *pData, size_t size)
   {
     for(size_t i = 0; i < size; ++i)
     {
-      WriteByte(pData[i]);
+      if (!WriteByte(pData[i]))
+      {
+        return false ;
+      }
     }
+    return true ;
   }
 
   private:
+    //Передача байта на минимальной частоте SPI (fPCLK/256) занимает около 2000 тактов
+    static constexpr std::uint32_t SpiTimeout = 10000U ;
+
     __forceinline void static SendByte(std::uint8_t chByte)
     {
       SpiModule::DR::Write(static_cast<typename SpiModule::DR::Type>(chByte)) ;
@@ -8,6 +8,7 @@
 #include "susudefs.hpp"  //for __forceinline
 #include "hardwaretimerbase.hpp" //for TimerInterruptable
 #include "tim1registers.hpp" //for TIM1
+#include "registersnapshot.hpp" //for RegisterSnapshot
 
 struct CC1 {};
 struct CC2 {};
@@ -25,7 +26,8 @@ struct HardwareCCTimerBase
       class = typename std::enable_if_t<std::is_base_of<TimerInterruptable, T>::value>>
   static void HandleInterrupt()
   {
-    TimerList::OnInterrupt();
+    //Регистр статуса читается один раз для всех обработчиков списка
+    TimerList::template OnInterrupt<RegisterSnapshot<typename Timer::SR>>();
   }
 } ;
 
@@ -33,17 +35,25 @@ template <typename TimerModule, typename CcTimerObserver, typename CCTimerNum>
 struct HardwareCCxTimerBase
 {
   __forceinline static void HandleInterrupt()
+  {
+    HandleInterrupt(RegisterSnapshot<typename TimerModule::Timer::SR>()) ;
+  }
+
+  //Обработчик для списка прерываний HardwareCCTimerBase, флаг проверяется по снимку регистра статуса,
+  //сделанному при входе в прерывание
+  template<typename Snapshot>
+  __forceinline static void HandleInterrupt(const Snapshot& snapshot)
   {
     if constexpr (std::is_same<CCTimerNum, CC1>::value)
     {
-      if (TimerModule::Timer::SR::CC1IF::InterruptPending::IsSet())
+      if (TimerModule::Timer::SR::CC1IF::InterruptPending::IsSet(snapshot))
       {
         CcTimerObserver::OnCaptureCompare() ;
       }
     } else
       if constexpr (std::is_same<CCTimerNum, CC2>::value)
     {
-      if (TimerModule::Timer::SR::CC2IF::InterruptPending::IsSet())
+      if (TimerModule::Timer::SR::CC2IF::InterruptPending::IsSet(snapshot))
       {
         CcTimerObserver::OnCaptureCompare() ;
       }
@@ -51,14 +61,14 @@ struct HardwareCCxTimerBase
       if constexpr (std::is_same<CCTimerNum, CC3>::value)
     {
       //static_assert(TimerModule::Timer::CC3IF)
-      if (TimerModule::Timer::SR::CC3IF::InterruptPending::IsSet())
+      if (TimerModule::Timer::SR::CC3IF::InterruptPending::IsSet(snapshot))
       {
         CcTimerObserver::OnCaptureCompare() ;
       }
     } else
       if constexpr (std::is_same<CCTimerNum, CC4>::value)
     {
-      if (TimerModule::Timer::SR::CC4IF::InterruptPending::IsSet())
+      if (TimerModule::Timer::SR::CC4IF::InterruptPending::IsSet(snapshot))
       {
         CcTimerObserver::OnCaptureCompare() ;
       }
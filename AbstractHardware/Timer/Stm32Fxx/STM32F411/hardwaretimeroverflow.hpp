@@ -8,6 +8,7 @@
 //#include <cstddef.h> // for std::uint32_t
 #include "hardwaretimerbase.hpp"
 #include "susudefs.hpp"
+#include "waituntil.hpp" //for WaitUntil, WaitForever
 
 template<typename TimerModule, typename TimerObserver>
 struct HardwareOverflowTimer
@@ -16,7 +17,7 @@ struct HardwareOverflowTimer
 		{
 				if (TimerModule::Timer::SR::UIF::InterruptPending::IsSet())
 				{
-						TimerModule::Timer::SR::UIF::NoInterruptPending::Set();
+						TimerModule::Timer::SR::UIF::InterruptPending::Clear();
 						TimerObserver::OnOverflow();
 				}
 		}
@@ -45,10 +46,9 @@ struct HardwareOverflowTimer
 		__forceinline static void Execute()
 		{
 				TimerModule::Start();
-				while (!TimerModule::IsOverflow())
-				{
-				}
-				TimerModule::Timer::SR::UIF::NoInterruptPending::Set();
+				//Ожидание ограничено самим таймером, поэтому без таймаута
+				WaitUntil<typename TimerModule::Timer::SR::UIF::InterruptPending>(WaitForever) ;
+				TimerModule::Timer::SR::UIF::InterruptPending::Clear();
 				TimerObserver::OnOverflow();
 				TimerModule::Restart();
 		}
@@ -10,6 +10,7 @@
 #include <cassert> // for assert
 #include <cstring> // for memcpy
 #include "criticalsectionguard.hpp" //for criticalsectionguard
+#include "registersnapshot.hpp" //for RegisterSnapshot
 
 struct UartInterruptable
 {
@@ -111,7 +112,8 @@ struct HardwareUartBase
       class = typename std::enable_if_t<std::is_base_of<UartInterruptable, T>::value>>
   static void HandleInterrupt()
   {
-    InterruptsList::OnInterrupt() ;
+    //Регистры статуса и управления читаются один раз для всех обработчиков списка
+    InterruptsList::template OnInterrupt<RegisterSnapshot<typename UartModule::ISR, typename UartModule::CR1>>() ;
   }
 
   __forceinline static void ClearStatus()
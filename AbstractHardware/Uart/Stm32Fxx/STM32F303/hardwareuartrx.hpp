@@ -6,6 +6,7 @@
 #define REGISTERS_HARDWAREUARTRX_HPP
 
 #include "susudefs.hpp" //for __forceinline
+#include "registersnapshot.hpp" // for RegisterSnapshot
 #include "hardwareuartbase.hpp" // for UartRx
 
 
@@ -17,8 +18,16 @@ struct HardwareUartRx
        class = typename std::enable_if_t<std::is_base_of<UartRxInterruptable, T>::value>>
   static void HandleInterrupt()
   {
-    const bool DataRecieved = Uart::ISR::RXNE::DataReceived::IsSet() ;
-    const bool InterruptEnabled = Uart::CR1::RXNEIE::InterruptWhenRXNE::IsSet() ;
+    HandleInterrupt(RegisterSnapshot<typename Uart::ISR, typename Uart::CR1>()) ;
+  }
+
+  //Обработчик для списка прерываний, флаги проверяются по снимку регистров, сделанному при входе в прерывание
+  __forceinline template<typename Snapshot, typename T = typename UartModule::Base,
+      class = typename std::enable_if_t<std::is_base_of<UartRxInterruptable, T>::value>>
+  static void HandleInterrupt(const Snapshot& snapshot)
+  {
+    const bool DataRecieved = Uart::ISR::RXNE::DataReceived::IsSet(snapshot) ;
+    const bool InterruptEnabled = Uart::CR1::RXNEIE::InterruptWhenRXNE::IsSet(snapshot) ;
     if(DataRecieved && InterruptEnabled)
     {
       UartReceiveObservers::OnRxData();
@@ -5,6 +5,7 @@
 #ifndef REGISTERS_HARDWAREUARTTC_HPP
 #define REGISTERS_HARDWAREUARTTC_HPP
 #include "susudefs.hpp" //for __forceinline
+#include "registersnapshot.hpp" // for RegisterSnapshot
 #include "hardwareuartbase.hpp" // for UartTx
 
 
@@ -16,8 +17,16 @@ struct HardwareUartTc
       class = typename std::enable_if_t<std::is_base_of<UartTxInterruptable, T>::value>>
   static void HandleInterrupt()
   {
-    const bool TransmitionComplete = Uart::ISR::TC::TransmitionComplete::IsSet() ;
-    const bool InterruptEnabled = Uart::CR1::TCIE::InterruptWhenTC::IsSet() ;
+    HandleInterrupt(RegisterSnapshot<typename Uart::ISR, typename Uart::CR1>()) ;
+  }
+
+  //Обработчик для списка прерываний, флаги проверяются по снимку регистров, сделанному при входе в прерывание
+  __forceinline template<typename Snapshot, typename T = typename UartModule::Base,
+      class = typename std::enable_if_t<std::is_base_of<UartTxInterruptable, T>::value>>
+  static void HandleInterrupt(const Snapshot& snapshot)
+  {
+    const bool TransmitionComplete = Uart::ISR::TC::TransmitionComplete::IsSet(snapshot) ;
+    const bool InterruptEnabled = Uart::CR1::TCIE::InterruptWhenTC::IsSet(snapshot) ;
     if(TransmitionComplete && InterruptEnabled)
     {
       Uart::ICR::TCCF::TransmitionNotComplete::Set() ;
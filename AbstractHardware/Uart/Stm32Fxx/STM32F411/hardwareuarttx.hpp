@@ -5,6 +5,7 @@
 #ifndef REGISTERS_HARDWAREUARTTX_HPP
 #define REGISTERS_HARDWAREUARTTX_HPP
 #include "susudefs.hpp" //for __forceinline
+#include "registersnapshot.hpp" // for RegisterSnapshot
 #include "hardwareuartbase.hpp" // for UartTx
 
 
@@ -16,8 +17,16 @@ struct HardwareUartTx
       class = typename std::enable_if_t<std::is_base_of<UartTxInterruptable, T>::value>>
   static void HandleInterrupt()
   {
-    const bool DataRegisterEmpty = Uart::SR::TXE::DataRegisterEmpty::IsSet() ;
-    const bool InterruptEnabled = Uart::CR1::TXEIE::InterruptWhenTXE::IsSet() ;
+    HandleInterrupt(RegisterSnapshot<typename Uart::SR, typename Uart::CR1>()) ;
+  }
+
+  //Обработчик для списка прерываний, флаги проверяются по снимку регистров, сделанному при входе в прерывание
+  __forceinline template<typename Snapshot, typename T = typename UartModule::Base,
+      class = typename std::enable_if_t<std::is_base_of<UartTxInterruptable, T>::value>>
+  static void HandleInterrupt(const Snapshot& snapshot)
+  {
+    const bool DataRegisterEmpty = Uart::SR::TXE::DataRegisterEmpty::IsSet(snapshot) ;
+    const bool InterruptEnabled = Uart::CR1::TXEIE::InterruptWhenTXE::IsSet(snapshot) ;
     if(DataRegisterEmpty && InterruptEnabled)
     {
       UartTransmitObservers::OnTxDataRegEmpty();
@@ -12,6 +12,7 @@
 #include <cstring> // for memcpy
 #include "criticalsectionconfig.hpp" // for CriticalSection
 #include "uartdriverconfig.hpp" // for tBuffer
+#include "waituntil.hpp" // for WaitFor
 
 
 template<typename UartModule, typename  UartDriverTransmitCompleteObservers, typename UartDriverReceiveObservers>
@@ -47,15 +48,21 @@ struct UartDriver
       //если работает без прерываний, то посылаем прямо тут
       if constexpr (!std::is_base_of<UartTxInterruptable, typename Uart::Base>::value)
       {
+        //Если передатчик завис (например, не включено тактирование), передача прерывается и статус
+        //сбрасывается, чтобы следующая передача могла начаться
         for(; bufferIndex < bytesTosend ; ++bufferIndex)
         {
-          while (!Uart::IsDataRegisterEmpty())
+          if (WaitFor([]() { return Uart::IsDataRegisterEmpty() ; }, UartTimeout) == WaitStatus::Timeout)
           {
+            status = Status::None ;
+            return ;
           }
           Uart::WriteByte(txRxBuffer[bufferIndex]) ;
         }
-        while (!Uart::IsTransmitComplete())
+        if (WaitFor([]() { return Uart::IsTransmitComplete() ; }, UartTimeout) == WaitStatus::Timeout)
         {
+          status = Status::None ;
+          return ;
         }
         
         status = Status::WriteComplete ;
@@ -155,6 +162,8 @@ struct UartDriver
   }
 
 private:
+  //Передача байта на скорости 1200 бод при частоте ядра 16 МГц занимает около 130000 тактов
+  static constexpr std::uint32_t UartTimeout = 200000U ;
 
   inline static  tBuffer txRxBuffer = {} ;
   inline static std::uint8_t bufferSize = 0U ;
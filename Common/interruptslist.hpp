@@ -5,8 +5,22 @@
 #ifndef REGISTERS_INTERRUPTSLIST_HPP
 #define REGISTERS_INTERRUPTSLIST_HPP
 
+#include <type_traits> //for std::void_t, std::declval
 #include "susudefs.hpp" //for __forceinline
 
+//Проверка, что обработчик модуля принимает снимок регистров
+template<typename Module, typename Snapshot, typename = void>
+struct IsSnapshotHandler: std::false_type
+{
+} ;
+
+template<typename Module, typename Snapshot>
+struct IsSnapshotHandler<Module, Snapshot,
+                         std::void_t<decltype(Module::HandleInterrupt(std::declval<const Snapshot&>()))>>:
+  std::true_type
+{
+} ;
+
 template<typename... Modules>
 struct InterruptsList
 {
@@ -14,5 +28,36 @@ struct InterruptsList
   {
     (Modules::HandleInterrupt(), ...) ;
   }
+
+  //Регистры статуса читаются один раз при входе в прерывание, и снимок (RegisterSnapshot) передается всем
+  //обработчикам списка, которые его принимают, остальные вызываются без него. Снимок делается, только если
+  //его принимает хотя бы один обработчик
+  template<typename Snapshot>
+  __forceinline static void OnInterrupt()
+  {
+    if constexpr ((IsSnapshotHandler<Modules, Snapshot>::value || ...))
+    {
+      const Snapshot snapshot ;
+      (Handle<Modules>(snapshot), ...) ;
+    }
+    else
+    {
+      OnInterrupt() ;
+    }
+  }
+
+private:
+  template<typename Module, typename Snapshot>
+  __forceinline static void Handle(const Snapshot& snapshot)
+  {
+    if constexpr (IsSnapshotHandler<Module, Snapshot>::value)
+    {
+      Module::HandleInterrupt(snapshot) ;
+    }
+    else
+    {
+      Module::HandleInterrupt() ;
+    }
+  }
 } ;
 #endif //REGISTERS_INTERRUPTSLIST_HPP
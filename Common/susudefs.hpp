@@ -6,6 +6,7 @@
 #define REGISTERS_SUSUDEFS_HPP
 
 #include <algorithm>
+#include <array>
 
 #include <type_traits>
 #include <cassert>
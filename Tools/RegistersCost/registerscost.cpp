@@ -0,0 +1,143 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+// Отчет об оценке стоимости операций драйверов в тактах ядра для STM32F411. Запускается на хосте: драйверы
+// работают с эмулированными регистрами (REGISTERS_HOST_ACCESS), а обработчики чтения и записи суммируют
+// стоимость каждого обращения по шине периферии (Bus из описания периферии) и оценкам BusCost.
+// На хосте bit-band не используется, поэтому однобитовые поля учитываются как чтение-модификация-запись.
+// Флаги статуса выставлены так, что все циклы ожидания завершаются с первой проверки.
+//
+// Сборка из корня репозитория:
+// g++ -std=c++17 -DREGISTERS_HOST_ACCESS -IAbstractHardware/Registers -IAbstractHardware/Registers/STM32F411
+//   -IAbstractHardware/Registers/STM32F411/FieldValues -IAbstractHardware/Atomic -ICommon -ICommon/CriticalSection
+//   -IAbstractHardware/Spi -IAbstractHardware/Uart -IAbstractHardware/Uart/Stm32Fxx/STM32F411 -IApplication
+//   -IAbstractHardware/Flash -IAbstractHardware/Flash/Stm32Fxx/STM32F411
+//   Tools/RegistersCost/registerscost.cpp -o registerscost
+//
+
+#include <array>                   //for std::array
+#include <cstdio>                  //for std::printf
+#include "susudefs.hpp"            //for TypesList
+#include "buscost.hpp"             //for AccessCost, BusCost
+#include "gpioaregisters.hpp"      //for GPIOA
+#include "spi2registers.hpp"       //for SPI2
+#include "usart2registers.hpp"     //for USART2
+#include "flashregisters.hpp"      //for FLASH
+#include "spi.hpp"                 //for Spi
+#include "uartdriver.hpp"          //for UartDriver
+#include "uartdriverobservers.hpp" //for UartDriverTransmitCompleteObservers
+#include "interruptslist.hpp"      //for InterruptsList
+#include "flashwrapper.hpp"        //for FlashWrapper
+
+//Периферия, обращения к которой учитываются в отчете
+using Peripherals = TypesList<GPIOA, SPI2, USART2, FLASH> ;
+
+struct PeripheralCost
+{
+  std::uintptr_t baseAddress ;
+  std::uint32_t readCycles ;
+  std::uint32_t writeCycles ;
+} ;
+
+template<typename ...Periphs>
+constexpr auto MakeCostTable(TypesList<Periphs...>)
+{
+  return std::array<PeripheralCost, sizeof...(Periphs)>{{
+    {Periphs::BaseAddress, BusCost<typename Periphs::Bus>::ReadCycles, BusCost<typename Periphs::Bus>::WriteCycles}...
+  }} ;
+}
+
+constexpr auto costTable = MakeCostTable(Peripherals{}) ;
+
+AccessCost total = {0U, 0U, 0U} ;
+
+//Периферия обращения - та, у которой ближайший снизу базовый адрес. Если подходящей периферии нет,
+//то стоимость обращения считается по умолчанию
+PeripheralCost FindPeripheral(std::uintptr_t address)
+{
+  PeripheralCost result = {0U, BusCost<UnknownBus>::ReadCycles, BusCost<UnknownBus>::WriteCycles} ;
+  for (const auto& item: costTable)
+  {
+    if ((item.baseAddress <= address) && (item.baseAddress >= result.baseAddress))
+    {
+      result = item ;
+    }
+  }
+  return result ;
+}
+
+std::uint64_t OnRead(std::uintptr_t address, std::uint64_t value)
+{
+  total = total + AccessCost{1U, 0U, FindPeripheral(address).readCycles} ;
+  return value ;
+}
+
+void OnWrite(std::uintptr_t address, std::uint64_t)
+{
+  total = total + AccessCost{0U, 1U, FindPeripheral(address).writeCycles} ;
+}
+
+struct Observer
+{
+  static void OnWriteComplete()
+  {
+  }
+
+  static void OnTransmitComplete()
+  {
+  }
+} ;
+
+struct Uart ;
+struct UartDriverPolling : UartDriver<Uart, UartDriverTransmitCompleteObservers<Observer>,
+                                      UartDriverReceiveCompleteObservers<>>
+{
+} ;
+struct Uart : HardwareUartBase<USART2, UartTransmit, InterruptsList<>>
+{
+} ;
+
+//Метод выставляет флаги статуса, при которых драйверы не ждут аппаратуру
+void PresetStatus()
+{
+  HostRegisterFile::Preset(SPI2::SR::Address, 0x02U) ;   //TXE = 1, BSY = 0
+  HostRegisterFile::Preset(USART2::SR::Address, 0xC0U) ; //TXE = 1, TC = 1
+  HostRegisterFile::Preset(FLASH::SR::Address, 0x00U) ;  //BSY = 0
+}
+
+template<typename Operation>
+void Report(const char* name, Operation operation)
+{
+  HostRegisterFile::Reset() ;
+  PresetStatus() ;
+  HostRegisterFile::SetReadHook(OnRead) ;
+  HostRegisterFile::SetWriteHook(OnWrite) ;
+  total = AccessCost{0U, 0U, 0U} ;
+  operation() ;
+  std::printf("%-40s %6u %6u %8u\n", name, static_cast<unsigned>(total.Reads), static_cast<unsigned>(total.Writes),
+              static_cast<unsigned>(total.Cycles)) ;
+}
+
+int main()
+{
+  static std::array<std::uint8_t, 16> data = {} ;
+  static std::array<char, 16> flash = {} ;
+  static std::uint32_t flashWord = 0U ;
+
+  std::printf("%-40s %6s %6s %8s\n", "Operation", "Reads", "Writes", "Cycles") ;
+  Report("Spi<SPI2>::WriteByte", []() { Spi<SPI2>::WriteByte(0x55U) ; }) ;
+  Report("Spi<SPI2>::WriteData(16 bytes)", []() { Spi<SPI2>::WriteData(data.data(), data.size()) ; }) ;
+  Report("HardwareUartBase<USART2>::WriteByte", []() { Uart::WriteByte(0x55U) ; }) ;
+  Report("HardwareUartBase<USART2>::StartTransmit", []() { Uart::StartTransmit() ; }) ;
+  Report("UartDriver<USART2>::WriteData(16 bytes)", []()
+  {
+    UartDriverPolling::WriteData(data.data(), static_cast<std::uint8_t>(data.size())) ;
+  }) ;
+  Report("FlashWrapper::Write(16 bytes)", []()
+  {
+    FlashWrapper::Write("0123456789abcde", flash.data(), flash.size()) ;
+  }) ;
+  Report("FlashWrapper::Write<std::uint32_t>", []() { FlashWrapper::Write(0x12345678U, &flashWord) ; }) ;
+  Report("FlashWrapper::Erase", []() { FlashWrapper::Erase(0x08004000U) ; }) ;
+  return 0 ;
+}
@@ -0,0 +1,101 @@
+#Compile-time benchmark of generated register headers. Headers are generated for the SVD file twice: as full copies
+#for every peripheral and with derived peripherals as instances of the base peripheral template (-t option of the
+#generator). Then a translation unit, which includes all instances of derived peripherals, is compiled with both
+#sets of headers and the median time of syntax check and the size of the preprocessed output are reported.
+#
+#Run from the repository root:
+#python Tools/RegistersGenerator/compile_benchmark.py Tools/RegistersGenerator/STM32F411.svd
+import os
+import re
+import sys
+import time
+import argparse
+import tempfile
+import subprocess
+from cmsis_svd.parser import SVDParser
+
+tools_dir = os.path.dirname(os.path.abspath(__file__))
+repository_dir = os.path.abspath(os.path.join(tools_dir, '..', '..'))
+
+#Register layer headers, which are used by generated headers. Registers are accessed on host, so the benchmark
+#doesn't depend on the target compiler
+include_dirs = [
+    os.path.join('AbstractHardware', 'Registers'),
+    os.path.join('AbstractHardware', 'Atomic'),
+    'Common',
+    os.path.join('Common', 'CriticalSection')
+]
+
+def get_derived_peripherals(svd_file):
+    device = SVDParser.for_xml_file(svd_file).get_device()
+    result = []
+    for peripheral in device.peripherals:
+        if (peripheral.derived_from != None) and (peripheral._registers == None):
+            result.append(peripheral.name)
+            result.append(peripheral.derived_from)
+    return device.name, sorted(set(result))
+
+def generate(svd_file, output_dir, template_mode):
+    arguments = [sys.executable, os.path.join(tools_dir, 'reg_wrappers_generator.py'), os.path.abspath(svd_file), '-o']
+    if (template_mode):
+        arguments.append('-t')
+    subprocess.run(arguments, cwd = output_dir, check = True, stdout = subprocess.DEVNULL)
+
+def create_translation_unit(file_name, peripherals):
+    with open(file_name, 'w') as source_file:
+        for peripheral in peripherals:
+            source_file.write('#include "{}registers.hpp"\n'.format(peripheral.lower().replace('_', '')))
+        source_file.write('\n')
+        for peripheral in peripherals:
+            source_file.write('static_assert({}::BaseAddress != 0U, "") ;\n'.format(peripheral))
+
+def compile_unit(compiler, source_file, headers_dir, device_dir, extra_arguments):
+    arguments = [compiler, '-std=c++17', '-DREGISTERS_HOST_ACCESS']
+    arguments += ['-I' + os.path.join(headers_dir, device_dir), '-I' + os.path.join(headers_dir, device_dir, 'FieldValues')]
+    #devicetraits.hpp and other hand-written device headers are taken from the repository
+    arguments += ['-idirafter' + os.path.join(repository_dir, 'AbstractHardware', 'Registers', device_dir)]
+    arguments += ['-I' + os.path.join(repository_dir, x) for x in include_dirs]
+    arguments += extra_arguments + [source_file]
+    return subprocess.run(arguments, check = True, stdout = subprocess.PIPE).stdout
+
+def measure(compiler, source_file, headers_dir, device_dir, repeat):
+    times = []
+    for i in range(repeat):
+        start = time.perf_counter()
+        compile_unit(compiler, source_file, headers_dir, device_dir, ['-fsyntax-only'])
+        times.append(time.perf_counter() - start)
+    times.sort()
+    preprocessed = compile_unit(compiler, source_file, headers_dir, device_dir, ['-E', '-P'])
+    return times[len(times) // 2], len(preprocessed.splitlines())
+
+def main():
+    arg_parser = argparse.ArgumentParser()
+    arg_parser.add_argument('input_file', help = 'input SVD file')
+    arg_parser.add_argument('-c', metavar = 'COMPILER', default = 'g++', help = 'host C++17 compiler')
+    arg_parser.add_argument('-r', metavar = 'REPEAT', type = int, default = 5, help = 'number of compilations')
+    args = arg_parser.parse_args()
+
+    device_name, peripherals = get_derived_peripherals(args.input_file)
+    if (len(peripherals) == 0):
+        print('There are no derived peripherals in {}'.format(device_name))
+        return
+    device_dir = re.sub(r'[\W]', '_', device_name).strip()
+
+    with tempfile.TemporaryDirectory() as work_dir:
+        source_file = os.path.join(work_dir, 'benchmark.cpp')
+        create_translation_unit(source_file, peripherals)
+        results = []
+        for mode, template_mode in (('copies', False), ('template', True)):
+            headers_dir = os.path.join(work_dir, mode)
+            os.mkdir(headers_dir)
+            generate(args.input_file, headers_dir, template_mode)
+            results.append((mode,) + measure(args.c, source_file, headers_dir, device_dir, args.r))
+
+    print('{} peripherals: {}'.format(len(peripherals), ', '.join(peripherals)))
+    print('{:<10}{:>12}{:>20}'.format('mode', 'time, s', 'preprocessed lines'))
+    for mode, duration, lines in results:
+        print('{:<10}{:>12.3f}{:>20}'.format(mode, duration, lines))
+    print('speedup {:.2f}x'.format(results[0][1] / results[1][1]))
+
+if __name__ == "__main__":
+    main()
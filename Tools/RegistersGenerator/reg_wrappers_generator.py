@@ -2,8 +2,12 @@ from cmsis_svd.parser import SVDParser
 from cmsis_svd.model import SVDRegister
 from cmsis_svd.model import SVDField
 import os
+import io
 import argparse
 import re
+import pickle
+import hashlib
+import multiprocessing
 
 access_mode = {
     'read-only': 'ReadMode',
@@ -42,6 +46,127 @@ register_field_types = {
 
 bits_field_max_width = 5
 
+#Registers and fields which can be modified by hardware. SVD files for STM32 don't describe readAction and
+#modifiedWriteValues, so status, data and counter registers and self-clearing bits are listed here by name.
+#Such fields are collected into VolatileMask of the register, so the register can't be shadowed in RAM
+hardware_volatile_registers = [
+    r'^(SR|ISR|[LH]ISR|DR|JDR\d|IDR|CNT|PR|CSR|BDCR|TR|SSR|S\dNDTR|CCR\d)$'
+]
+
+#Status, data and counter registers. Writing them has side effects (flags are cleared, data is transmitted) and
+#their value is meaningless after wake-up, so SnapshotMask of such registers is 0 and Snapshot doesn't save them
+snapshot_excluded_registers = [
+    r'^(SR|ISR|[LH]ISR|DR|JDR\d|IDR|CNT|PR|SWIER|CSR|TR|SSR|TSTR|TSDR|TSSSR)$',
+    r'^(TX?DR|DATA|STAT\d?)$'
+]
+
+#Registers which set and reset bits of an output register in one store, so the output register is never read and
+#modified. Bits [0, shift) of the set/reset register set bits of the output register, bits [shift, 2 * shift) reset them
+set_reset_registers = [
+    (r'^ODR$', r'^BSRR$', 16),
+    (r'^OCTL$', r'^BOP$', 16)
+]
+
+#Bus (and so clock domain) of peripheral by its base address. First matched device name pattern is used, the
+#last entry is a fallback for devices which are not described: only Cortex-M private peripheral bus is known there
+bus_address_map = [
+    (r'^STM32F4', [
+        (0x40000000, 0x4000FFFF, 'Apb1Bus'),
+        (0x40010000, 0x4001FFFF, 'Apb2Bus'),
+        (0x40020000, 0x4FFFFFFF, 'Ahb1Bus'),
+        (0x50000000, 0x5FFFFFFF, 'Ahb2Bus'),
+        (0xA0000000, 0xAFFFFFFF, 'Ahb3Bus'),
+        (0xE0000000, 0xE00FFFFF, 'PpbBus')]),
+    (r'^STM32(F3|L4)', [
+        (0x40000000, 0x4000FFFF, 'Apb1Bus'),
+        (0x40010000, 0x4001FFFF, 'Apb2Bus'),
+        (0x40020000, 0x47FFFFFF, 'Ahb1Bus'),
+        (0x48000000, 0x5FFFFFFF, 'Ahb2Bus'),
+        (0xA0000000, 0xAFFFFFFF, 'Ahb3Bus'),
+        (0xE0000000, 0xE00FFFFF, 'PpbBus')]),
+    (r'^STM32F0', [
+        (0x40000000, 0x4001FFFF, 'Apb1Bus'),
+        (0x40020000, 0x47FFFFFF, 'Ahb1Bus'),
+        (0x48000000, 0x4FFFFFFF, 'Ahb2Bus'),
+        (0xE0000000, 0xE00FFFFF, 'PpbBus')]),
+    (r'^GD32VF103', [
+        (0x40000000, 0x4000FFFF, 'Apb1Bus'),
+        (0x40010000, 0x40017FFF, 'Apb2Bus'),
+        (0x40018000, 0x5FFFFFFF, 'Ahb1Bus'),
+        (0xA0000000, 0xAFFFFFFF, 'Ahb3Bus'),
+        (0xD1000000, 0xD2FFFFFF, 'PpbBus')]),
+    (r'', [
+        (0xE0000000, 0xE00FFFFF, 'PpbBus')])
+]
+
+#Fields which SVD describes as read-write, although the core ignores writes to them. They are not included
+#into WritableMask of the register and are treated as modified by hardware
+read_only_fields = [
+    (r'^CTRL$', r'^COUNTFLAG$')
+]
+
+hardware_volatile_fields = [
+    (r'^CR2$', r'^J?SWSTART$'),
+    (r'^CR1$', r'^(START|STOP)$'),
+    (r'^CR$', r'^(STRT|.*RDY)$'),
+    (r'^S\dCR$', r'^EN$')
+]
+
+#Enable bits of peripherals. A peripheral is configured while it is disabled (prescaler and period of a timer, baud rate
+#of USART, DMA channel addresses), so enable bits are not included into SnapshotMask. They are collected into EnableMask
+#of the register and Snapshot sets them by the second pass, after all registers are restored
+enable_fields = [
+    (r'^TIM\d+$', r'^CR1$', r'^CEN$'),
+    (r'^(SPI\d|I2S\dext)$', r'^CR1$', r'^SPE$'),
+    (r'^(SPI\d|I2S\dext)$', r'^I2SCFGR$', r'^I2SE$'),
+    (r'^(LP)?US?ART\d+$', r'^CR1$', r'^UE$'),
+    (r'^I2C\d$', r'^CR1$', r'^PE$'),
+    (r'^ADC\d$', r'^CR2$', r'^ADON$'),
+    (r'^DMA\d$', r'^CCR\d$', r'^EN$'),
+    (r'^TIMER\d+$', r'^CTL0$', r'^CEN$'),
+    (r'^SPI\d$', r'^CTL0$', r'^SPIEN$'),
+    (r'^SPI\d$', r'^I2SCTL$', r'^I2SEN$'),
+    (r'^US?ART\d+$', r'^CTL0$', r'^UEN$'),
+    (r'^I2C\d$', r'^CTL0$', r'^I2CEN$'),
+    (r'^ADC\d$', r'^CTL1$', r'^ADCON$'),
+    (r'^DMA\d$', r'^CH\dCTL$', r'^CHEN$')
+]
+
+#Flags which are cleared by writing 0 (rc_w0) or 1 (rc_w1). SVD files describe them by modifiedWriteValues
+#(zeroToClear, oneToClear), but STM32 and GD32 SVD files don't, so flags are listed here by peripheral, register and
+#field name. Such fields are collected into ZeroToClearMask and OneToClearMask of the register: other flags are written
+#with the value which doesn't change them, so a flag is cleared by a single store without reading the register
+clear_on_write_fields = [
+    (r'^TIM\d+$', r'^SR$', r'.*', 'zeroToClear'),
+    (r'^US?ART\d+$', r'^SR$', r'^(CTS|LBD|TC|RXNE)$', 'zeroToClear'),
+    (r'^ADC\d$', r'^SR$', r'^(OVR|STRT|JSTRT|JEOC|EOC|AWD)$', 'zeroToClear'),
+    (r'^ADC\d?$', r'^ISR$', r'.*', 'oneToClear'),
+    (r'^(SPI\d|I2S\dext)$', r'^SR$', r'^CRCERR$', 'zeroToClear'),
+    (r'^I2C\d$', r'^SR1$', r'^(SMBALERT|TIMEOUT|PECERR|OVR|AF|ARLO|BERR)$', 'zeroToClear'),
+    (r'^WWDG$', r'^SR$', r'^EWIF$', 'zeroToClear'),
+    (r'^RTC$', r'^ISR$', r'^(RSF|ALRAF|ALRBF|WUTF|TSF|TSOVF|TAMP1F|TAMP2F|TAMP3F)$', 'zeroToClear'),
+    (r'^EXTI$', r'^PR\d?$', r'.*', 'oneToClear'),
+    (r'^(FLASH|Flash)$', r'^SR$',
+     r'^(EOP|OPERR|WRPERR|PGAERR|PGPERR|PGSERR|RDERR|WRPRT|PGERR|PROGERR|SIZERR|MISERR|FASTERR|OPTVERR)$', 'oneToClear'),
+    (r'^(LP)?US?ART\d+$', r'^ICR$', r'.*', 'oneToClear'),
+    (r'^DMA\d$', r'^[LH]?IFCR$', r'.*', 'oneToClear'),
+    (r'^TIMER\d+$', r'^INTF$', r'.*', 'zeroToClear'),
+    (r'^US?ART\d+$', r'^STAT$', r'^(CTSF|LBDF|TC|RBNE)$', 'zeroToClear'),
+    (r'^ADC\d$', r'^STAT$', r'.*', 'zeroToClear'),
+    (r'^SPI\d$', r'^STAT$', r'^CRCERR$', 'zeroToClear'),
+    (r'^I2C\d$', r'^STAT0$', r'^(SMBALT|SMBTO|PECERR|OUERR|AERR|LOSTARB|BERR)$', 'zeroToClear'),
+    (r'^WWDGT$', r'^STAT$', r'^EWIF$', 'zeroToClear'),
+    (r'^RTC$', r'^CTL$', r'^(RSYNF|OVIF|ALRMIF|SCIF)$', 'zeroToClear'),
+    (r'^EXTI$', r'^PD$', r'.*', 'oneToClear'),
+    (r'^FMC$', r'^STAT\d?$', r'^(ENDF|WPERR|PGERR)$', 'oneToClear'),
+    (r'^DMA\d$', r'^INTC$', r'.*', 'oneToClear')
+]
+
+#Numbered fields and registers (SVD dim arrays, which are unrolled, or just fields named MODER0..MODER15) are
+#also emitted as arrays indexed by the number: FieldArray for fields and IndexedType for registers
+array_field_name = r'^([A-Za-z_]*[A-Za-z_])(\d+)$'
+array_register_name = r'^([A-Za-z_]+?)(\d+)([A-Za-z][A-Za-z0-9]*)?$'
+
 class Device:
     def __init__(self, name, access, size):
         self.name = name
@@ -57,6 +182,9 @@ class Peripheral:
         self.size = size
         self.description = description
         self.registers = []
+        self.bus = 'UnknownBus'
+        self.derived_from = None
+        self.template_name = None
         
 class Register:
     def __init__(self, name, address, access, size, description):
@@ -67,6 +195,7 @@ class Register:
         self.description = description
         self.fields = []
         self.type = ''
+        self.reset_value = None
         
 class Field:
     def __init__(self, name, access, bit_offset, bit_width, description, is_fieldvalue):
@@ -77,6 +206,8 @@ class Field:
         self.description = description,
         self.is_fieldvalue = False
         self.fieldvalue_values = None
+        self.is_hardware_volatile = False
+        self.clear_mode = None
 
         
 class FieldValue:
@@ -126,6 +257,7 @@ def process_peripheral(raw_peripheral, device):
             for raw_register in raw_peripheral._registers:
                 result.registers.append(process_register(raw_register, result))
         else:
+            result.derived_from = base_peripheral.name
             if (base_peripheral._registers != None):
                 for raw_register in base_peripheral._registers:
                     result.registers.append(process_register(raw_register, result))
@@ -167,8 +299,18 @@ def process_peripheral(raw_peripheral, device):
                         )
                         result.registers.append(process_register(reg, result))
 
+    result.bus = get_bus(device.name, result.base_address)
     return result
     
+def get_bus(device_name, address):
+    for device_pattern, address_map in bus_address_map:
+        if (re.match(device_pattern, device_name) != None):
+            for start, end, bus in address_map:
+                if (start <= address <= end):
+                    return bus
+            break
+    return 'UnknownBus'
+
 def process_register(raw_register, peripheral):
     if (raw_register.derived_from != None):
         base_register = raw_register.get_derived_from()
@@ -181,6 +323,8 @@ def process_register(raw_register, peripheral):
             raw_register._size if (raw_register._size != None) else base_register._size,
             raw_register.description if (raw_register.description != None) else base_register.description)
         
+        result.reset_value = raw_register._reset_value if (raw_register._reset_value != None) else base_register._reset_value
+
         if (raw_register._fields != None):
             for field in raw_register._fields:
                 result.fields.append(process_field(field, result,peripheral))
@@ -196,6 +340,7 @@ def process_register(raw_register, peripheral):
             raw_register._size if (raw_register._size != None) else peripheral.size,
             raw_register.description
             )
+        result.reset_value = raw_register._reset_value
         
         if (raw_register._fields != None):
             for field in raw_register._fields:
@@ -294,9 +439,77 @@ def process_field(raw_field, register, peripheral):
                         result.is_fieldvalue = False
             else:
                 pass #Fixme
-    
+
+    result.is_hardware_volatile = is_hardware_volatile_field(raw_field, result, register)
+    modified_write_values = raw_field.modified_write_values
+    if (modified_write_values == None) and (raw_field.derived_from != None):
+        modified_write_values = base_field.modified_write_values
+    result.clear_mode = get_clear_mode(modified_write_values, result, register, peripheral)
     return result
 
+def get_clear_mode(modified_write_values, field, register, peripheral):
+    if (fieldvalue_types[field.access] == 'ReadMode'):
+        return None
+    if (modified_write_values in ('zeroToClear', 'oneToClear')):
+        return modified_write_values
+    for peripheral_pattern, register_pattern, field_pattern, mode in clear_on_write_fields:
+        if (re.match(peripheral_pattern, peripheral.name) != None) and \
+           (re.match(register_pattern, register.name) != None) and (re.match(field_pattern, field.name) != None):
+            return mode
+    return None
+
+def is_read_only_field(field, register):
+    for register_pattern, field_pattern in read_only_fields:
+        if (re.match(register_pattern, register.name) != None) and (re.match(field_pattern, field.name) != None):
+            return True
+    return False
+
+def is_enable_field(field, register, peripheral):
+    for peripheral_pattern, register_pattern, field_pattern in enable_fields:
+        if (re.match(peripheral_pattern, peripheral.name) != None) and \
+           (re.match(register_pattern, register.name) != None) and (re.match(field_pattern, field.name) != None):
+            return True
+    return False
+
+def get_enable_mask(peripheral, register):
+    enable_mask = 0
+    for field in register.fields:
+        if is_enable_field(field, register, peripheral):
+            enable_mask |= ((1 << field.bit_width) - 1) << field.bit_offset
+    return enable_mask
+
+def get_snapshot_mask(peripheral, register):
+    for pattern in snapshot_excluded_registers:
+        if (re.match(pattern, register.name) != None):
+            return 0
+    snapshot_mask = 0
+    for field in register.fields:
+        if (fieldvalue_types[field.access] == 'ReadMode') or is_read_only_field(field, register) or \
+           (field.clear_mode != None) or is_enable_field(field, register, peripheral):
+            continue
+        is_trigger = False
+        for register_pattern, field_pattern in hardware_volatile_fields:
+            if (re.match(register_pattern, register.name) != None) and (re.match(field_pattern, field.name) != None):
+                is_trigger = True
+        if not is_trigger:
+            snapshot_mask |= ((1 << field.bit_width) - 1) << field.bit_offset
+    return snapshot_mask
+
+def is_hardware_volatile_field(raw_field, field, register):
+    if (field.access == 'read-only') or (register.access == 'read-only') or is_read_only_field(field, register):
+        return True
+    if (raw_field.read_action != None):
+        return True
+    if (raw_field.modified_write_values != None) and (raw_field.modified_write_values != 'modify'):
+        return True
+    for pattern in hardware_volatile_registers:
+        if (re.match(pattern, register.name) != None):
+            return True
+    for register_pattern, field_pattern in hardware_volatile_fields:
+        if (re.match(register_pattern, register.name) != None) and (re.match(field_pattern, field.name) != None):
+            return True
+    return False
+
 def process_fieldvalue_none(peripheral, register, field, value, description):
 
    # name = '{}_{}_{}_Values'.format(
@@ -325,13 +538,49 @@ def camel_case(str):
     return result
     #return str.title().replace('_', '')
 
+#Peripheral type: the struct itself or the template shared by derived peripherals
+def peripheral_type(peripheral):
+    if (peripheral.template_name != None):
+        return peripheral.template_name
+    return camel_case(peripheral.name)
+
+#Qualified register name. Inside the peripheral template registers are referred by their own names
+def register_type(peripheral, register):
+    if (peripheral.template_name != None):
+        return camel_case(register.name)
+    return '{}::{}'.format(camel_case(peripheral.name), camel_case(register.name))
+
+def register_address(peripheral, register):
+    if (peripheral.template_name != None):
+        return 'baseAddress + 0x{:X}U'.format(register.address - peripheral.base_address)
+    return '0x{:X}'.format(register.address)
+
+def generate_peripheral_instance(peripheral, registers_file):
+    registers_file.write('using {} = {}<0x{:X}U, {}> ;\n'.format(
+        camel_case(peripheral.name),
+        peripheral.template_name,
+        peripheral.base_address,
+        peripheral.bus))
+    registers_file.write('\n')
+
 def generate_peripheral(peripheral, registers_file, enumerations_file = None):
-    registers_file.write('struct {}\n'.format(
-        camel_case(peripheral.name), 
-        peripheral.base_address, 
-        peripheral.access, 
-        peripheral.size))
+    if (peripheral.template_name != None):
+        registers_file.write('template<std::uintptr_t baseAddress, typename BusType>\n')
+    registers_file.write('struct {}\n'.format(peripheral_type(peripheral)))
     registers_file.write('{\n')
+    if (peripheral.template_name != None):
+        registers_file.write('  using Bus = BusType ;\n')
+        registers_file.write('  static constexpr std::uintptr_t BaseAddress = baseAddress ;\n')
+    else:
+        registers_file.write('  using Bus = {} ;\n'.format(peripheral.bus))
+        registers_file.write('  static constexpr std::uintptr_t BaseAddress = 0x{:X}U ;\n'.format(peripheral.base_address))
+    registers_file.write('\n')
+    #Set/reset register is referenced from the output register, which goes before it
+    for register in peripheral.registers:
+        set_reset = find_set_reset_register(peripheral, register)
+        if (set_reset != None):
+            registers_file.write('  struct {} ;\n'.format(camel_case(set_reset[0].name)))
+            registers_file.write('\n')
     
     for register in peripheral.registers:
         generate_register_base(
@@ -345,16 +594,29 @@ def generate_peripheral(peripheral, registers_file, enumerations_file = None):
             register,
             registers_file)
 
+    generate_register_arrays(peripheral, registers_file)
+    registers_file.write('  using Registers = TypesList<{}> ;\n'.format(', '.join(
+        register_type(peripheral, register) for register in peripheral.registers)))
     registers_file.write('} ;\n')
     registers_file.write('\n')
+    if (peripheral.template_name != None):
+        generate_peripheral_instance(peripheral, registers_file)
+
 
+def find_set_reset_register(peripheral, register):
+    for register_pattern, set_reset_pattern, shift in set_reset_registers:
+        if (re.match(register_pattern, register.name) != None):
+            for set_reset_register in peripheral.registers:
+                if (re.match(set_reset_pattern, set_reset_register.name) != None):
+                    return (set_reset_register, shift)
+    return None
 
 def generate_register_pack(peripheral, register, registers_file):
     registers_file.write('  template<typename... T> \n')
-    registers_file.write('  using {}Pack  = {}<0x{:X}, {}, {}, {}Base, T...> ;\n'.format(
+    registers_file.write('  using {}Pack  = {}<{}, {}, {}, {}Base, T...> ;\n'.format(
         camel_case(register.name),
         register_types['register_pack'],
-        register.address,
+        register_address(peripheral, register),
         register.size,
         access_mode[register.access],
         camel_case(peripheral.name) + camel_case(register.name)
@@ -364,15 +626,19 @@ def generate_register_pack(peripheral, register, registers_file):
 def generate_register_base(peripheral, register, registers_file, enumerations_file):
 
     generate_bits_filed_base(peripheral, register, registers_file)
-    registers_file.write('  struct {} : public {}<0x{:X}, {}, {}>\n'.format(
+    registers_file.write('  struct {} : public {}<{}, {}, {}>\n'.format(
         camel_case(register.name),
         register_types['register_base'],
-        register.address,
+        register_address(peripheral, register),
         register.size,
         access_mode[register.access]
         ))
     
     registers_file.write('  {\n')
+    #Base class of a register inside the peripheral template depends on the template parameter, so its Type
+    #is not visible in the register and has to be declared once more
+    if (peripheral.template_name != None):
+        registers_file.write('    using Type = RegisterType<{}>::Type ;\n'.format(register.size))
     fieldvalue_class_name = ""
     for field in register.fields:
         fieldvalue_class_name = generate_field(
@@ -381,22 +647,160 @@ def generate_register_base(peripheral, register, registers_file, enumerations_fi
             field, 
             registers_file, 
             enumerations_file)
+    volatile_mask = 0
+    for field in register.fields:
+        if (field.is_hardware_volatile):
+            volatile_mask |= ((1 << field.bit_width) - 1) << field.bit_offset
+    if (volatile_mask != 0):
+        registers_file.write('    static constexpr Type VolatileMask = 0x{:X}U ;\n'.format(volatile_mask))
+    #WritableMask is used to replace read-modify-write by a single store when field values cover all writable bits
+    if (access_mode[register.access] != 'ReadMode') and (len(register.fields) != 0):
+        writable_mask = 0
+        for field in register.fields:
+            if (fieldvalue_types[field.access] != 'ReadMode') and not is_read_only_field(field, register):
+                writable_mask |= ((1 << field.bit_width) - 1) << field.bit_offset
+        registers_file.write('    static constexpr Type WritableMask = 0x{:X}U ;\n'.format(writable_mask))
+    #Flags cleared by a write are written with the value which doesn't change them (see ClearOnWrite)
+    for mode, name in (('zeroToClear', 'ZeroToClearMask'), ('oneToClear', 'OneToClearMask')):
+        clear_mask = 0
+        for field in register.fields:
+            if (field.clear_mode == mode):
+                clear_mask |= ((1 << field.bit_width) - 1) << field.bit_offset
+        if (clear_mask != 0):
+            registers_file.write('    static constexpr Type {} = 0x{:X}U ;\n'.format(name, clear_mask))
+    set_reset = find_set_reset_register(peripheral, register)
+    if (set_reset != None):
+        registers_file.write('    using SetResetRegister = {} ;\n'.format(register_type(peripheral, set_reset[0])))
+        registers_file.write('    static constexpr std::size_t SetResetShift = {}U ;\n'.format(set_reset[1]))
+    if (register.reset_value != None):
+        registers_file.write('    static constexpr Type ResetValue = 0x{:X}U ;\n'.format(register.reset_value))
+    #SnapshotMask is written only if it differs from WritableMask: status and data registers are not saved at all,
+    #trigger bits (SWSTART, STRT, EN of DMA stream) are cleared on restore, enable bits are set by the second pass
+    if (access_mode[register.access] == 'ReadWriteMode') and (len(register.fields) != 0):
+        snapshot_mask = get_snapshot_mask(peripheral, register)
+        if (snapshot_mask != writable_mask):
+            registers_file.write('    static constexpr Type SnapshotMask = 0x{:X}U ;\n'.format(snapshot_mask))
+        enable_mask = get_enable_mask(peripheral, register)
+        if (enable_mask != 0):
+            registers_file.write('    static constexpr Type EnableMask = 0x{:X}U ;\n'.format(enable_mask))
+    generate_field_arrays(register, registers_file)
+    registers_file.write('    using Peripheral = {} ;\n'.format(peripheral_type(peripheral)))
     if (fieldvalue_class_name != ''):
-        registers_file.write('    using FieldValues = {}<{}::{}, 0, 0, NoAccess, NoAccess> ;\n'.format(
+        registers_file.write('    using FieldValues = {}<{}, 0, 0, NoAccess, NoAccess> ;\n'.format(
             fieldvalue_class_name,
-            camel_case(peripheral.name),
-            camel_case(register.name)
+            register_type(peripheral, register)
         ))
     registers_file.write('  } ;\n')
     registers_file.write('\n')
 
+def field_type(register, field):
+    if (camel_case(register.name) == camel_case(field.name)):
+        return '{}Field'.format(camel_case(field.name))
+    return camel_case(field.name)
+
+#Groups of numbered fields of the same width and access which follow with a constant stride. Returns list of
+#tuples (prefix, first index, fields sorted by index)
+def get_field_arrays(register):
+    groups = {}
+    for field in register.fields:
+        match = re.match(array_field_name, field.name)
+        if (match != None):
+            groups.setdefault(match.group(1), []).append((int(match.group(2)), field))
+    result = []
+    for prefix, items in groups.items():
+        items.sort(key = lambda x: x[0])
+        fields = [x[1] for x in items]
+        if (len(items) < 2) or (any(x.name == prefix for x in register.fields)):
+            continue
+        stride = fields[1].bit_offset - fields[0].bit_offset
+        if (stride < fields[0].bit_width):
+            continue
+        if all((items[i][0] == items[0][0] + i) and
+               (fields[i].bit_offset == fields[0].bit_offset + stride * i) and
+               (fields[i].bit_width == fields[0].bit_width) and
+               (fields[i].access == fields[0].access) for i in range(len(items))):
+            result.append((prefix, items[0][0], fields))
+    return result
+
+#Groups of numbered registers with a constant address stride, for example S0CR..S7CR of DMA streams. Returns
+#list of tuples (prefix, first index, {suffix: registers sorted by index}), registers without suffix (CCR1..CCR4)
+#have an empty suffix
+#Registers of an array must be copies of one register: CR1 and CR2 of TIM, SMPR1 and SMPR2 of ADC or SHPR1..SHPR3 of SCB
+#have the same name and stride, but different fields, so they are not an array. Digits are dropped from field names,
+#because fields of an unrolled array are often numbered too: M0A of S0M0AR and S1M0AR, EXTI0..EXTI3 of EXTICR1 and
+#EXTI4..EXTI7 of EXTICR2. The SVD describes S0CR of STM32F411 DMA without ACK field, so there is no DMA2::S<index>::CR.
+#Unrolled registers and fields themselves are kept: their names are the interface used by drivers and applications,
+#arrays are only added to them
+def get_field_layout(register):
+    return sorted((re.sub(r'\d+', '', x.name), x.bit_offset, x.bit_width, x.access) for x in register.fields)
+
+def get_register_arrays(peripheral):
+    groups = {}
+    for register in peripheral.registers:
+        match = re.match(array_register_name, register.name)
+        if (match != None):
+            suffix = match.group(3) if (match.group(3) != None) else ''
+            groups.setdefault(match.group(1), {}).setdefault(suffix, []).append((int(match.group(2)), register))
+    names = [camel_case(x.name) for x in peripheral.registers]
+    result = []
+    for prefix, suffixes in groups.items():
+        if (camel_case(prefix) in names):
+            continue
+        arrays = {}
+        for suffix, items in suffixes.items():
+            items.sort(key = lambda x: x[0])
+            registers = [x[1] for x in items]
+            if (len(items) < 2):
+                continue
+            stride = registers[1].address - registers[0].address
+            if all((items[i][0] == items[0][0] + i) and
+                   (registers[i].address == registers[0].address + stride * i) and
+                   (registers[i].size == registers[0].size) and
+                   (get_field_layout(registers[i]) == get_field_layout(registers[0])) for i in range(len(items))):
+                arrays[suffix] = (items[0][0], registers)
+        #Registers of one index (stream, channel) are members of one struct, so all arrays must have the same range
+        ranges = set((x[0], len(x[1])) for x in arrays.values())
+        if (len(ranges) != 1) or (('' in arrays) and (len(arrays) != 1)):
+            continue
+        first_index = ranges.pop()[0]
+        result.append((prefix, first_index, {x: arrays[x][1] for x in arrays}))
+    return result
+
+def generate_field_arrays(register, registers_file):
+    arrays = get_field_arrays(register)
+    for prefix, first_index, fields in arrays:
+        registers_file.write('    using {}Array = FieldArray<{}U, {}> ;\n'.format(
+            camel_case(prefix),
+            first_index,
+            ', '.join(field_type(register, x) for x in fields)))
+    #Field<N> is a shortcut for the only array of the register
+    if (len(arrays) == 1) and all(field_type(register, x) != 'Field' for x in register.fields):
+        registers_file.write('    template<std::size_t index>\n')
+        registers_file.write('    using Field = typename {}Array::template Field<index> ;\n'.format(camel_case(arrays[0][0])))
+
+def generate_register_arrays(peripheral, registers_file):
+    for prefix, first_index, arrays in get_register_arrays(peripheral):
+        registers_file.write('  template<std::size_t index>\n')
+        if ('' in arrays):
+            registers_file.write('  using {} = IndexedType<index, {}U, {}> ;\n'.format(
+                camel_case(prefix),
+                first_index,
+                ', '.join(register_type(peripheral, x) for x in arrays[''])))
+        else:
+            registers_file.write('  struct {}\n'.format(camel_case(prefix)))
+            registers_file.write('  {\n')
+            for suffix, registers in arrays.items():
+                registers_file.write('    using {} = IndexedType<index, {}U, {}> ;\n'.format(
+                    camel_case(suffix),
+                    first_index,
+                    ', '.join(register_type(peripheral, x) for x in registers)))
+            registers_file.write('  } ;\n')
+        registers_file.write('\n')
+
 def generate_field(peripheral, register, field, registers_file, bitsfiled_file):
-    field_name = camel_case(field.name)
+    field_name = field_type(register, field)
     access = fieldvalue_types[field.access]
 
-    if (camel_case(register.name) == camel_case(field.name)):
-        field_name = '{}Field'.format(field_name)
-
     #if ((field.enumerated_values != None) or (field.bit_width <= bits_field_max_width)):
     name = (
         '{}_{}_{}_Values'.format(
@@ -424,11 +828,10 @@ def generate_field(peripheral, register, field, registers_file, bitsfiled_file):
   #  access = fieldvalue_types['read-write'] ;
 
     if (field.fieldvalue_values != None):
-        registers_file.write('    using {} = {}<{}::{}, {}, {}, {}, {}Base> ;\n'.format(
+        registers_file.write('    using {} = {}<{}, {}, {}, {}, {}Base> ;\n'.format(
             field_name,
             fieldvalue_class_name,
-            camel_case(peripheral.name),
-            camel_case(register.name),
+            register_type(peripheral, register),
             field.bit_offset,
             field.bit_width,
             access,
@@ -436,11 +839,10 @@ def generate_field(peripheral, register, field, registers_file, bitsfiled_file):
 
             camel_case(peripheral.name) + camel_case(register.name)))
     else:
-        registers_file.write('    using {} = {}<{}::{}, {}, {}, {}, {}Base> ;\n'.format(
+        registers_file.write('    using {} = {}<{}, {}, {}, {}, {}Base> ;\n'.format(
             field_name,
             fieldvalue_class_name,
-            camel_case(peripheral.name),
-            camel_case(register.name),
+            register_type(peripheral, register),
             field.bit_offset,
             field.bit_width,
             access,
@@ -527,79 +929,347 @@ def create_file_description(file_name, description):
     
     return result
 
+#Base peripherals, from which other peripherals are derived without own registers, are generated as a template
+#parameterised on base address and bus. Derived peripherals (GPIOC, USART2) become aliases of its instances
+def set_template_names(device):
+    bases = {}
+    for peripheral in device.peripherals:
+        if (peripheral.derived_from == None):
+            bases[peripheral.name] = peripheral
+    for peripheral in device.peripherals:
+        if (peripheral.derived_from != None) and (peripheral.derived_from in bases):
+            template_name = '{}_Template'.format(camel_case(peripheral.derived_from))
+            peripheral.template_name = template_name
+            bases[peripheral.derived_from].template_name = template_name
+
+def generate_derived_peripheral(device, peripheral, reg_file_name, registers_file):
+    registers_file.write(create_file_description(reg_file_name,
+        'This header file is auto-generated for {} device. {} is an instance of {} peripheral template.'.format(
+            device.name,
+            peripheral.name,
+            peripheral.derived_from)))
+    reg_guard = '{}REGISTERS_HPP'.format(peripheral.name.lower().replace('_', '').upper())
+    registers_file.write('\n')
+    registers_file.write('#if !defined({})\n'.format(reg_guard))
+    registers_file.write('#define {}\n'.format(reg_guard))
+    registers_file.write('\n')
+    registers_file.write('#include "{}registers.hpp"  //for {}\n'.format(
+        peripheral.derived_from.lower().replace('_', ''),
+        peripheral.template_name))
+    registers_file.write('#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  \n')
+    registers_file.write('\n')
+    generate_peripheral_instance(peripheral, registers_file)
+    registers_file.write('#endif //#if !defined({})\n'.format(reg_guard))
+
+#Parsed and processed device model is cached, so SVD file is parsed again only if it or the generator is changed
+def load_device(svd_file, cache_dir):
+    with open(svd_file, 'rb') as file:
+        svd_hash = hashlib.sha256(file.read())
+    with open(os.path.abspath(__file__), 'rb') as file:
+        svd_hash.update(file.read())
+    key = svd_hash.hexdigest()
+    cache_file = os.path.join(cache_dir, '{}.pickle'.format(os.path.basename(svd_file)))
+    if (os.path.isfile(cache_file)):
+        try:
+            with open(cache_file, 'rb') as file:
+                cached_key, device = pickle.load(file)
+            if (cached_key == key):
+                return device
+        except Exception:
+            pass
+
+    device = process_device(SVDParser.for_xml_file(svd_file).get_device())
+    if (not os.path.isdir(cache_dir)):
+        os.makedirs(cache_dir)
+    with open(cache_file, 'wb') as file:
+        pickle.dump((key, device), file)
+    return device
+
+#Header is written only if its content is changed, so the time of modification of unchanged headers is kept and
+#translation units which include them are not rebuilt
+def write_if_changed(file_name, text):
+    if (os.path.isfile(file_name)):
+        with open(file_name, 'r') as file:
+            if (hashlib.sha256(file.read().encode()).digest() == hashlib.sha256(text.encode()).digest()):
+                return False
+    with open(file_name, 'w') as file:
+        file.write(text)
+    return True
+
+def generate_registers_file(device, peripheral, reg_file_name, enum_file_name, registers_file,
+                            enumerations_file = None):
+    peripheral_name = peripheral.name.lower().replace('_', '')
+    if (peripheral.description != None):
+        per_description = '{}. This header file is auto-generated for {} device.'.format(
+            peripheral.description.rstrip('. '),
+            device.name)
+    else:
+        per_description = 'This header file is auto-generated for {} device.'.format(device.name)
+
+    registers_file.write(create_file_description(reg_file_name, per_description))
+
+    reg_guard = '{}REGISTERS_HPP'.format(peripheral_name.upper())
+    registers_file.write('\n')
+    registers_file.write('#if !defined({})\n'.format(reg_guard))
+    registers_file.write('#define {}\n'.format(reg_guard))
+    registers_file.write('\n')
+    registers_file.write('#include "{}"  //for Bits Fields defs \n'.format(enum_file_name))
+    registers_file.write('#include "registerbase.hpp"   //for RegisterBase\n')
+    registers_file.write('#include "register.hpp"       //for Register\n')
+    registers_file.write('#include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  \n')
+    registers_file.write('#include "buses.hpp"          //for Ahb1Bus, Apb1Bus, Apb2Bus  \n')
+    registers_file.write('#include "fieldarray.hpp"     //for FieldArray, IndexedType\n')
+    registers_file.write('\n')
+
+    if (enumerations_file != None):
+        enumerations_file.write(create_file_description(
+            enum_file_name,
+            'Enumerations related with {} peripheral. This header file is auto-generated for {} device.'.format(
+                peripheral.name,
+                device.name)))
+
+        enum_guard = '{}ENUMS_HPP'.format(peripheral_name.upper())
+        enumerations_file.write('\n')
+        enumerations_file.write('#if !defined({})\n'.format(enum_guard))
+        enumerations_file.write('#define {}\n'.format(enum_guard))
+        enumerations_file.write('\n')
+        enumerations_file.write('#include "fieldvalue.hpp"     //for FieldValues \n')
+        enumerations_file.write('\n')
+
+        generate_peripheral(peripheral, registers_file, enumerations_file)
+
+        enumerations_file.write('#endif //#if !defined({})\n'.format(enum_guard))
+    else:
+        generate_peripheral(peripheral, registers_file)
+
+    registers_file.write('#endif //#if !defined({})\n'.format(reg_guard))
+
+register_db_access = {
+    'ReadMode': 'RegisterDbAccess::Read',
+    'WriteMode': 'RegisterDbAccess::Write',
+    'ReadWriteMode': 'RegisterDbAccess::ReadWrite'
+}
+
+#The same function as RegisterDbHash in registerdatabase.hpp
+def register_db_hash(name, seed):
+    result = 0x811C9DC5 ^ seed
+    for char in name.encode():
+        result = ((result ^ char) * 0x01000193) & 0xFFFFFFFF
+    return result
+
+#Perfect hash (hash and displace): keys are distributed into buckets by the first hash. For buckets of several keys
+#the seed of the second hash, which places all their keys into free slots, is searched. Keys of single-key buckets
+#are placed into remaining free slots directly, the seed is then the negative slot number minus 1
+def build_perfect_hash(keys):
+    size = len(keys)
+    buckets = [[] for i in range(size)]
+    for index, key in enumerate(keys):
+        buckets[register_db_hash(key, 0) % size].append(index)
+    seeds = [0] * size
+    slots = [None] * size
+    order = sorted(range(size), key = lambda x: -len(buckets[x]))
+    for bucket in order:
+        items = buckets[bucket]
+        if (len(items) <= 1):
+            break
+        seed = 1
+        while True:
+            placed = []
+            for item in items:
+                slot = register_db_hash(keys[item], seed) % size
+                if (slots[slot] != None) or (slot in placed):
+                    break
+                placed.append(slot)
+            if (len(placed) == len(items)):
+                break
+            seed += 1
+        for item, slot in zip(items, placed):
+            slots[slot] = item
+        seeds[bucket] = seed
+    free_slots = [x for x in range(size) if slots[x] == None]
+    for bucket in order:
+        if (len(buckets[bucket]) == 1):
+            slot = free_slots.pop()
+            slots[slot] = buckets[bucket][0]
+            seeds[bucket] = -slot - 1
+    if (max(seeds) > 0x7FFF) or (min(seeds) < -0x8000):
+        raise ValueError('Seed of perfect hash is out of range')
+    return seeds, slots
+
+#ROM database of registers and fields with the perfect hash index over PERIPH.REG and PERIPH.REG.FIELD names
+#for RegisterDatabase and RegisterInspector
+def generate_register_database(device, database_file):
+    peripherals = []
+    registers = []
+    fields = []
+    keys = []
+    key_names = set()
+    for peripheral in device.peripherals:
+        for register in peripheral.registers:
+            register_name = '{}.{}'.format(peripheral.name, register.name)
+            if (register_name in key_names):
+                continue
+            if (peripheral.name not in peripherals):
+                peripherals.append(peripheral.name)
+            key_names.add(register_name)
+            keys.append((register_name, len(registers), 'RegisterDbKey::NoField'))
+            register_fields = []
+            for field in register.fields:
+                field_name = '{}.{}'.format(register_name, field.name)
+                if (field_name in key_names):
+                    continue
+                key_names.add(field_name)
+                keys.append((field_name, len(registers), '{}U'.format(len(fields) + len(register_fields))))
+                register_fields.append(field)
+            registers.append((peripherals.index(peripheral.name), register, len(fields), len(register_fields)))
+            fields += register_fields
+    if (len(peripherals) > 0xFF) or (len(registers) > 0xFFFF) or (len(fields) >= 0xFFFF):
+        raise ValueError('Register database is too large')
+    seeds, slots = build_perfect_hash([x[0] for x in keys])
+
+    database_file.write(create_file_description('registerdb.hpp',
+        'Database of registers and fields with the perfect hash index over names. This header file is '
+        'auto-generated for {} device.'.format(device.name)))
+    database_file.write('\n')
+    database_file.write('#if !defined(REGISTERDB_HPP)\n')
+    database_file.write('#define REGISTERDB_HPP\n')
+    database_file.write('\n')
+    database_file.write('#include "registerdatabase.hpp"   //for RegisterDbRegister, RegisterDbField, RegisterDbKey\n')
+    database_file.write('\n')
+    database_file.write('struct RegisterDb\n')
+    database_file.write('{\n')
+    database_file.write('  static constexpr const char* Peripherals[] = {\n')
+    for peripheral in peripherals:
+        database_file.write('    "{}",\n'.format(peripheral))
+    database_file.write('  } ;\n')
+    database_file.write('\n')
+    database_file.write('  static constexpr RegisterDbRegister Registers[] = {\n')
+    for peripheral_index, register, first_field, fields_count in registers:
+        database_file.write('    {{"{}", 0x{:X}U, {}U, {}U, {}U, {}U, {}}},\n'.format(
+            register.name,
+            register.address,
+            first_field,
+            fields_count,
+            peripheral_index,
+            register.size,
+            register_db_access[access_mode[register.access]]))
+    database_file.write('  } ;\n')
+    database_file.write('\n')
+    database_file.write('  static constexpr RegisterDbField Fields[] = {\n')
+    for field in fields:
+        database_file.write('    {{"{}", {}U, {}U, {}}},\n'.format(
+            field.name,
+            field.bit_offset,
+            field.bit_width,
+            register_db_access[fieldvalue_types[field.access]]))
+    database_file.write('  } ;\n')
+    database_file.write('\n')
+    database_file.write('  static constexpr std::int16_t Seeds[] = {\n')
+    for index in range(0, len(seeds), 16):
+        database_file.write('    {},\n'.format(', '.join(str(x) for x in seeds[index:index + 16])))
+    database_file.write('  } ;\n')
+    database_file.write('\n')
+    database_file.write('  static constexpr RegisterDbKey Keys[] = {\n')
+    for slot in slots:
+        database_file.write('    {{{}U, {}}}, //{}\n'.format(keys[slot][1], keys[slot][2], keys[slot][0]))
+    database_file.write('  } ;\n')
+    database_file.write('} ;\n')
+    database_file.write('\n')
+    database_file.write('#endif //#if !defined(REGISTERDB_HPP)\n')
+
+#Devices are passed to worker processes once, when the process is started, and then peripherals are referred
+#by indexes
+worker_devices = []
+
+def init_worker(devices):
+    global worker_devices
+    worker_devices = devices
+
+#Generates headers of one peripheral and returns list of tuples (file name, text)
+def generate_peripheral_files(task):
+    device_index, peripheral_index, write_enumerations = task
+    device = worker_devices[device_index]
+    peripheral = device.peripherals[peripheral_index]
+    device_name = camel_case(device.name)
+    peripheral_name = peripheral.name.lower().replace('_', '')
+    reg_file_name = '{}registers.hpp'.format(peripheral_name)
+    enum_file_name = '{}fieldvalues.hpp'.format(peripheral_name)
+    del bits_field_list[:]
+
+    registers_file = io.StringIO()
+    #Derived peripheral is an alias of the base peripheral template, so neither registers nor field values
+    #are repeated for it
+    if (peripheral.template_name != None) and (peripheral.derived_from != None):
+        generate_derived_peripheral(device, peripheral, reg_file_name, registers_file)
+        return [(os.path.join(device_name, reg_file_name), registers_file.getvalue())]
+
+    if (write_enumerations):
+        enumerations_file = io.StringIO()
+        generate_registers_file(device, peripheral, reg_file_name, enum_file_name, registers_file, enumerations_file)
+        return [(os.path.join(device_name, reg_file_name), registers_file.getvalue()),
+                (os.path.join(device_name, 'FieldValues', enum_file_name), enumerations_file.getvalue())]
+    generate_registers_file(device, peripheral, reg_file_name, enum_file_name, registers_file)
+    return [(os.path.join(device_name, reg_file_name), registers_file.getvalue())]
+
 def main():  
     arg_parser = argparse.ArgumentParser()
-    arg_parser.add_argument('input_file', help = 'input SVD file')
+    arg_parser.add_argument('input_file', nargs = '+', help = 'input SVD files')
     arg_parser.add_argument('-p', metavar =  'PERIPHERAL', help = 'generate code only for specified peripheral')
     arg_parser.add_argument('-o', help = 'overwrite existing enumerations header files', action = 'store_true')
+    arg_parser.add_argument('-t', help = 'generate derived peripherals as instances of the base peripheral template',
+                            action = 'store_true')
+    arg_parser.add_argument('-j', metavar = 'JOBS', type = int, default = os.cpu_count(),
+                            help = 'number of worker processes')
+    arg_parser.add_argument('-c', metavar = 'CACHE_DIR', default = '.svdcache',
+                            help = 'directory of the parsed SVD files cache')
+    arg_parser.add_argument('-d', help = 'generate database of registers for RegisterInspector', action = 'store_true')
     args = arg_parser.parse_args()
-    
-    parser = SVDParser.for_xml_file(args.input_file)
-    device = process_device(parser.get_device())
 
-    device_name = camel_case(device.name)
+    devices = []
+    tasks = []
+    for input_file in args.input_file:
+        device = load_device(input_file, args.c)
+        device_name = camel_case(device.name)
 
-    if (not os.path.isdir(device_name)):
-        os.mkdir(device_name)
-        
-    if (not os.path.isdir('{}\FieldValues'.format(device_name))):
-        os.mkdir('{}\FieldValues'.format(device_name))
-        
-    if (args.p != None):
-        peripherals = [x for x in device.peripherals if x.name.lower() == args.p.lower()]
+        if (not os.path.isdir(device_name)):
+            os.mkdir(device_name)
+
+        if (not os.path.isdir(os.path.join(device_name, 'FieldValues'))):
+            os.mkdir(os.path.join(device_name, 'FieldValues'))
+
+        if (args.t):
+            set_template_names(device)
+
+        for index, peripheral in enumerate(device.peripherals):
+            if (args.p != None) and (peripheral.name.lower() != args.p.lower()):
+                continue
+            enum_file_name = '{}fieldvalues.hpp'.format(peripheral.name.lower().replace('_', ''))
+            write_enumerations = args.o or not os.path.isfile(os.path.join(device_name, 'FieldValues', enum_file_name))
+            tasks.append((len(devices), index, write_enumerations))
+        devices.append(device)
+
+    if (args.j > 1) and (len(tasks) > 1):
+        with multiprocessing.Pool(args.j, init_worker, (devices,)) as pool:
+            results = pool.map(generate_peripheral_files, tasks)
     else:
-        peripherals = device.peripherals
+        init_worker(devices)
+        results = [generate_peripheral_files(x) for x in tasks]
 
-    for peripheral in peripherals:
-        peripheral_name = peripheral.name.lower().replace('_', '')
-        reg_file_name = '{}registers.hpp'.format(peripheral_name)
-        enum_file_name = '{}fieldvalues.hpp'.format(peripheral_name)
-        enum_file_full_name = '{}\FieldValues\{}'.format(device_name, enum_file_name)
-    
-        with open('{}\{}'.format(device_name, reg_file_name), 'w') as registers_file:
-            if (peripheral.description != None):
-                per_description = '{}. This header file is auto-generated for {} device.'.format(
-                    peripheral.description.rstrip('. '),
-                    device.name)
-            else:
-                per_description = 'This header file is auto-generated for {} device.'.format(device.name)
-            
-            registers_file.write(create_file_description(reg_file_name, per_description))
-                
-            reg_guard = '{}REGISTERS_HPP'.format(peripheral_name.upper())
-            registers_file.write('\n')
-            registers_file.write('#if !defined({})\n'.format(reg_guard))
-            registers_file.write('#define {}\n'.format(reg_guard))
-            registers_file.write('\n')
-            registers_file.write('#include "{}"  //for Bits Fields defs \n'.format(enum_file_name))
-            registers_file.write('#include "registerbase.hpp"   //for RegisterBase\n')
-            registers_file.write('#include "register.hpp"       //for Register\n')
-            registers_file.write('#include "accessmode.hpp"     //for ReadMode, WriteMode, ReadWriteMode  \n')
-            registers_file.write('\n')
-            
-            if((args.o) or (not os.path.isfile(enum_file_full_name))):
-                with open(enum_file_full_name, 'w') as enumerations_file:
-                    enumerations_file.write(create_file_description(
-                        enum_file_name,
-                        'Enumerations related with {} peripheral. This header file is auto-generated for {} device.'.format(
-                            peripheral.name,
-                            device.name)))
-                        
-                    enum_guard = '{}ENUMS_HPP'.format(peripheral_name.upper())
-                    enumerations_file.write('\n')
-                    enumerations_file.write('#if !defined({})\n'.format(enum_guard))
-                    enumerations_file.write('#define {}\n'.format(enum_guard))
-                    enumerations_file.write('\n')
-                    enumerations_file.write('#include "fieldvalue.hpp"     //for FieldValues \n')
-                    enumerations_file.write('\n')
-                
-                    generate_peripheral(peripheral, registers_file, enumerations_file)
-                    
-                    enumerations_file.write('#endif //#if !defined({})\n'.format(enum_guard))
+    if (args.d):
+        for device in devices:
+            database_file = io.StringIO()
+            generate_register_database(device, database_file)
+            results.append([(os.path.join(camel_case(device.name), 'registerdb.hpp'), database_file.getvalue())])
+
+    written = 0
+    unchanged = 0
+    for files in results:
+        for file_name, text in files:
+            if (write_if_changed(file_name, text)):
+                written += 1
             else:
-                generate_peripheral(peripheral, registers_file)
-                
-            registers_file.write('#endif //#if !defined({})\n'.format(reg_guard))
+                unchanged += 1
+    print('{} files written, {} files unchanged'.format(written, unchanged))
         
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
@@ -0,0 +1,82 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+// Гистограммы обращений к регистрам для операций драйверов STM32F411. Запускается на хосте: драйверы работают
+// с эмулированными регистрами (REGISTERS_HOST_ACCESS), а трассировка (REGISTERS_TRACE) считает для каждого
+// регистра чтения, записи и повторные обращения, которые можно убрать из драйвера. Для первой операции
+// дополнительно выводится содержимое буфера трассировки в том же виде, в котором его выводит RegisterTraceDump.
+//
+// Сборка из корня репозитория:
+// g++ -std=c++17 -DREGISTERS_HOST_ACCESS -DREGISTERS_TRACE -IAbstractHardware/Registers
+//   -IAbstractHardware/Registers/STM32F411 -IAbstractHardware/Registers/STM32F411/FieldValues
+//   -IAbstractHardware/Atomic -ICommon -ICommon/CriticalSection -IAbstractHardware/Adc -IAbstractHardware/Uart
+//   -IAbstractHardware/Uart/Stm32Fxx/STM32F411 -IApplication Tools/RegistersTrace/registerstrace.cpp -o registerstrace
+//
+
+#include <array>                   //for std::array
+#include <cstdio>                  //for std::printf
+#include "memoryaccess.hpp"        //for HostRegisterFile, RegisterTrace, RegisterAccessHistogram
+#include "usart2registers.hpp"     //for USART2
+#include "adc1registers.hpp"       //for ADC1
+#include "hardwareadc.hpp"         //for Adc
+#include "uartdriver.hpp"          //for UartDriver
+#include "uartdriverobservers.hpp" //for UartDriverTransmitCompleteObservers
+#include "interruptslist.hpp"      //for InterruptsList
+
+struct Observer
+{
+  static void OnTransmitComplete()
+  {
+  }
+} ;
+
+struct Uart ;
+struct UartDriverPolling : UartDriver<Uart, UartDriverTransmitCompleteObservers<Observer>,
+                                      UartDriverReceiveCompleteObservers<>>
+{
+} ;
+struct Uart : HardwareUartBase<USART2, UartTransmit, InterruptsList<>>
+{
+} ;
+
+template<typename Operation>
+void Report(const char* name, Operation operation)
+{
+  HostRegisterFile::Reset() ;
+  HostRegisterFile::Preset(USART2::SR::Address, 0xC0U) ; //TXE = 1, TC = 1
+  HostRegisterFile::Preset(ADC1::SR::Address, 0x02U) ;   //EOC = 1
+  RegisterAccessHistogram::Reset() ;
+  RegisterTrace::Clear() ;
+  RegisterTrace::Start() ;
+  operation() ;
+  RegisterTrace::Stop() ;
+  std::printf("\n%s\n", name) ;
+  RegisterAccessHistogram::Print() ;
+}
+
+int main()
+{
+  static std::array<std::uint8_t, 16> data = {} ;
+
+  Report("HardwareUartBase<USART2>::StartTransmit", []() { Uart::StartTransmit() ; }) ;
+  RegisterTrace::ForEach([](const RegisterTraceEntry& entry)
+  {
+    std::printf("%08lX %c %08X %08X\n", static_cast<unsigned long>(entry.address), static_cast<char>(entry.kind),
+                static_cast<unsigned>(entry.value), static_cast<unsigned>(entry.timestamp)) ;
+  }) ;
+  Report("UartDriver<USART2>::WriteData(16 bytes)", []()
+  {
+    UartDriverPolling::WriteData(data.data(), static_cast<std::uint8_t>(data.size())) ;
+  }) ;
+  Report("Adc<ADC1>::ConfigureChannels<0, 1, 4>", []() { Adc<ADC1>::ConfigureChannels<0U, 1U, 4U>() ; }) ;
+  Report("Adc<ADC1> single conversion", []()
+  {
+    Adc<ADC1>::SwitchOn() ;
+    Adc<ADC1>::StartConversion() ;
+    while (!Adc<ADC1>::IsReady())
+    {
+    }
+    static_cast<void>(Adc<ADC1>::GetData()) ;
+  }) ;
+  return 0 ;
+}
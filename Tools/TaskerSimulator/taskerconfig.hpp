@@ -0,0 +1,107 @@
+// Filename: taskerconfig.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+// Конфигурация Tasker для симуляции на хосте, заменяет rtos/Config/taskerconfig.hpp. Задачи только отмечают
+// выполненную работу (InterruptSimulator::Consume), длительность работы задается Workload для каждого запуска.
+
+#pragma once
+
+#include <array>                  // for std::array
+#include <cstddef>                // for std::size_t
+#include <cstdint>                // for std::uint64_t
+#include "interruptsimulator.hpp" // for InterruptSimulator
+#include "criticalsection.hpp"    // for CriticalSection
+#include "taskbase.hpp"           // for TaskBase
+#include "tasker.hpp"             // for Tasker
+
+struct Workload
+{
+    static constexpr std::size_t TasksCount = 4U ;
+
+    struct TaskStatistics
+    {
+        std::uint64_t runs ;
+        std::uint64_t maxLatency ;    // Максимальная задержка от события до начала работы задачи, в тактах
+        std::uint64_t totalLatency ;
+        std::uint64_t lostEvents ;    // События, пришедшие, пока задача еще не начала обрабатывать предыдущее,
+                                      // или не поместившиеся в очередь
+    } ;
+
+    static inline std::array<std::uint64_t, TasksCount> taskCycles = {} ;
+    // Работа задачи внутри CriticalSection, задерживает прерывания
+    static inline std::array<std::uint64_t, TasksCount> criticalCycles = {} ;
+    static inline std::array<std::uint64_t, TasksCount> postTime = {} ;
+    static inline std::array<TaskStatistics, TasksCount> statistics = {} ;
+
+    static void OnEvent(std::size_t id, std::uint64_t time)
+    {
+        const std::uint64_t latency = InterruptSimulator::Now() - time ;
+        ++statistics[id].runs ;
+        statistics[id].totalLatency += latency ;
+        statistics[id].maxLatency = (latency > statistics[id].maxLatency) ? latency : statistics[id].maxLatency ;
+    }
+
+    // Метод вызывается перед отправкой события задаче без очереди, pending - у задачи есть необработанные события
+    static void OnPost(std::size_t id, bool pending, std::uint64_t time)
+    {
+        if (pending)
+        {
+            ++statistics[id].lostEvents ;
+        }
+        else
+        {
+            postTime[id] = time ;
+        }
+    }
+} ;
+
+template<std::size_t id>
+struct WorkerTask : public TaskBase<WorkerTask<id>>
+{
+    constexpr WorkerTask()
+    {
+    }
+
+    void OnEvent() const ;
+};
+
+// События от прерывания периферии с временем запроса прерывания, все накопившиеся обрабатываются за один запуск
+struct PeripheralTask : public TaskWithQueue<PeripheralTask, std::uint64_t, 16U>
+{
+    constexpr PeripheralTask()
+    {
+    }
+
+    void OnEvent() const
+    {
+        queue.Drain([](std::uint64_t raiseTime)
+        {
+            Workload::OnEvent(0U, raiseTime) ;
+            InterruptSimulator::Consume(Workload::taskCycles[0U]) ;
+        }) ;
+    }
+};
+
+inline constexpr PeripheralTask peripheralTask;
+inline constexpr WorkerTask<1U> fastTask;        // События от таймера 10 мс
+inline constexpr WorkerTask<2U> slowTask;        // События от таймера 100 мс
+inline constexpr WorkerTask<3U> backgroundTask;  // События от fastTask
+
+class myTasker : public Tasker<peripheralTask, fastTask, slowTask, backgroundTask> {} ;
+
+template<std::size_t id>
+void WorkerTask<id>::OnEvent() const
+{
+    Workload::OnEvent(id, Workload::postTime[id]) ;
+    if (Workload::criticalCycles[id] != 0U)
+    {
+        const CriticalSection cs ;
+        InterruptSimulator::Consume(Workload::criticalCycles[id]) ;
+    }
+    InterruptSimulator::Consume(Workload::taskCycles[id]) ;
+    if constexpr (id == 1U)
+    {
+        Workload::OnPost(3U, backgroundTask.events != 0U, InterruptSimulator::Now()) ;
+        myTasker::PostEvent<backgroundTask>(1U) ;
+    }
+}
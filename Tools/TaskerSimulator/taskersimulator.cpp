@@ -0,0 +1,178 @@
+//
+// Created by Lamerok on 18.10.2026.
+//
+// Симуляция Tasker на хосте в виртуальном времени. Tasker, TaskerTimer и TaskerTimerService те же, что и на
+// устройстве, CriticalSection работает с маской прерываний симулятора (rtos/Source/Host/intrinsics.h), а
+// PendSV и ожидание в Tasker::Start() реализует rtos/Source/Host/rtosconfig.hpp. Для каждой конфигурации
+// нагрузки симулируется одна секунда работы ядра 16 МГц с SysTick 1 кГц и прерыванием периферии со случайным
+// периодом, и выводится строка с задержками прерываний и задач в тактах и количеством обработанных событий.
+// Tasker::Start() не возвращает управление, поэтому каждая конфигурация запускается в отдельном процессе.
+// С аргументом tickless Tasker ждет в TicklessIdle: SysTick (SimulatedTimer) приходит только на тиках, на
+// которых срабатывают таймеры, и задачи должны получать события на тех же тиках, что и без него.
+//
+// Сборка из корня репозитория:
+// g++ -std=c++17 -ITools/TaskerSimulator -Irtos/Source/Host -Irtos/Source -Irtos/Source/CriticalSection -ICommon
+//   Tools/TaskerSimulator/taskersimulator.cpp rtos/Source/taskerschedule.cpp
+//   rtos/Source/CriticalSection/criticalsection.cpp -o taskersimulator
+//
+
+#include <array>                   //for std::array
+#include <cstdint>                 //for std::uint64_t
+#include <cstdio>                  //for std::printf
+#include <random>                  //for std::minstd_rand
+#include <sys/wait.h>              //for waitpid
+#include <unistd.h>                //for fork
+#include <cstring>                 //for std::strcmp
+#include "interruptsimulator.hpp"  //for InterruptSimulator
+#include "simulatedtimer.hpp"      //for SimulatedTimer
+#include "taskerconfig.hpp"        //for myTasker, Workload
+#include "taskertimer.hpp"         //for TaskerTimer
+#include "taskertimerservice.hpp"  //for TaskerTimerService
+
+using FastTimer = TaskerTimer<myTasker, 1'000UL, 10UL, 1, fastTask> ;
+using SlowTimer = TaskerTimer<myTasker, 1'000UL, 100UL, 1, slowTask> ;
+using tRtosTimerService = TaskerTimerService<myTasker, FastTimer, SlowTimer> ;
+
+constexpr std::uint64_t CpuFrequency = 16'000'000U ;
+constexpr std::uint64_t TickPeriod = CpuFrequency / 1'000U ;
+using tTickTimer = SimulatedTimer<TickPeriod> ;
+constexpr std::uint64_t SimulationTime = CpuFrequency ;
+constexpr std::uint64_t TickCycles = 200U ;        //Работа обработчика SysTick
+constexpr std::uint64_t PeripheralIsrCycles = 100U ;
+constexpr std::uint64_t PeripheralTaskCycles = 500U ;
+
+struct Config
+{
+  std::uint64_t peripheralPeriod ;   //Средний период прерывания периферии
+  std::uint64_t fastTaskCycles ;
+  std::uint64_t slowTaskCycles ;
+  std::uint64_t criticalCycles ;     //Работа backgroundTask с запрещенными прерываниями
+} ;
+
+Config config ;
+bool tickless = false ;
+std::minstd_rand generator ;
+std::size_t peripheralSource = 0U ;
+
+std::uint64_t GetPeripheralInterval()
+{
+  return config.peripheralPeriod / 2U + generator() % config.peripheralPeriod ;
+}
+
+void OnSysTick()
+{
+  InterruptSimulator::Consume(TickCycles) ;
+  //Во время сна тики учитываются без прерывания, номер тика берется у сервиса таймеров
+  const std::uint32_t ticks = tRtosTimerService::GetTicks() + 1U ;
+  const std::uint64_t raiseTime = InterruptSimulator::GetActiveRaiseTime() ;
+  if ((ticks % 10U) == 0U)
+  {
+    Workload::OnPost(1U, fastTask.events != 0U, raiseTime) ;
+  }
+  if ((ticks % 100U) == 0U)
+  {
+    Workload::OnPost(2U, slowTask.events != 0U, raiseTime) ;
+  }
+  tRtosTimerService::OnSystemTick() ;
+}
+
+void OnPeripheralInterrupt()
+{
+  InterruptSimulator::Consume(PeripheralIsrCycles) ;
+  const std::uint64_t raiseTime = InterruptSimulator::GetActiveRaiseTime() ;
+  myTasker::IsrEntry() ;
+  if (!myTasker::PostEvent<peripheralTask>(raiseTime))
+  {
+    ++Workload::statistics[0U].lostEvents ;
+  }
+  myTasker::IsrExit() ;
+  InterruptSimulator::SetNextTime(peripheralSource, raiseTime + GetPeripheralInterval()) ;
+}
+
+std::uint64_t GetAverage(std::uint64_t total, std::uint64_t count)
+{
+  return (count != 0U) ? (total / count) : 0U ;
+}
+
+void PrintResult()
+{
+  const auto& irq = InterruptSimulator::GetStatistics() ;
+  const auto& tasks = Workload::statistics ;
+  std::printf("%8llu %8llu %8llu %6llu | %6llu %6llu %5llu %5llu | %6llu %6llu %6llu | %7llu %8llu %8llu | %4llu%%\n",
+              static_cast<unsigned long long>(config.peripheralPeriod),
+              static_cast<unsigned long long>(config.fastTaskCycles),
+              static_cast<unsigned long long>(config.slowTaskCycles),
+              static_cast<unsigned long long>(config.criticalCycles),
+              static_cast<unsigned long long>(irq.interrupts),
+              static_cast<unsigned long long>(irq.maxLatency),
+              static_cast<unsigned long long>(GetAverage(irq.totalLatency, irq.interrupts)),
+              static_cast<unsigned long long>(irq.lost),
+              static_cast<unsigned long long>(tasks[0].maxLatency),
+              static_cast<unsigned long long>(GetAverage(tasks[0].totalLatency, tasks[0].runs)),
+              static_cast<unsigned long long>(tasks[0].lostEvents),
+              static_cast<unsigned long long>(tasks[0].runs + tasks[1].runs + tasks[2].runs + tasks[3].runs),
+              static_cast<unsigned long long>(tasks[1].maxLatency),
+              static_cast<unsigned long long>(tasks[3].maxLatency),
+              static_cast<unsigned long long>((irq.idleCycles * 100U) / SimulationTime)) ;
+}
+
+[[noreturn]] void Run(std::uint32_t seed)
+{
+  generator.seed(seed) ;
+  Workload::taskCycles = {PeripheralTaskCycles, config.fastTaskCycles, config.slowTaskCycles, 2000U} ;
+  Workload::criticalCycles = {0U, 0U, 0U, config.criticalCycles} ;
+  InterruptSimulator::Reset(SimulationTime, PrintResult) ;
+  tTickTimer::Start(OnSysTick) ;
+  peripheralSource = InterruptSimulator::AddSource(OnPeripheralInterrupt, GetPeripheralInterval(), 0U) ;
+  if (tickless)
+  {
+    myTasker::Start<TicklessIdle<tRtosTimerService, tTickTimer>>() ;
+  }
+  else
+  {
+    myTasker::Start() ;
+  }
+  //Симуляция заканчивается в InterruptSimulator завершением процесса
+  std::_Exit(EXIT_FAILURE) ;
+}
+
+int main(int argc, char* argv[])
+{
+  tickless = (argc > 1) && (std::strcmp(argv[1], "tickless") == 0) ;
+  constexpr std::array<std::uint64_t, 4> peripheralPeriods = {2'000U, 8'000U, 32'000U, 128'000U} ;
+  constexpr std::array<std::uint64_t, 4> fastTaskCycles = {1'000U, 20'000U, 80'000U, 150'000U} ;
+  constexpr std::array<std::uint64_t, 3> slowTaskCycles = {100'000U, 1'000'000U, 4'000'000U} ;
+  constexpr std::array<std::uint64_t, 4> criticalCycles = {0U, 500U, 4'000U, 16'000U} ;
+
+  std::printf("  periph     fast     slow   crit |    irq maxlat avlat  lost |"
+              " t0 max t0 avg t0lost |  events  fastmax    bgmax | idle\n") ;
+  std::uint32_t seed = 1U ;
+  for (const auto periph: peripheralPeriods)
+  {
+    for (const auto fast: fastTaskCycles)
+    {
+      for (const auto slow: slowTaskCycles)
+      {
+        for (const auto crit: criticalCycles)
+        {
+          config = Config{periph, fast, slow, crit} ;
+          std::fflush(stdout) ;
+          const pid_t pid = fork() ;
+          if (pid == 0)
+          {
+            Run(seed) ;
+          }
+          int status = 0 ;
+          waitpid(pid, &status, 0) ;
+          if (!WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS))
+          {
+            std::printf("Configuration %u failed\n", seed) ;
+            return 1 ;
+          }
+          ++seed ;
+        }
+      }
+    }
+  }
+  return 0 ;
+}
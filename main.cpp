@@ -28,6 +28,7 @@
 #include "delaytimer.hpp" // for DelayTimer
 #include "dma2registers.hpp"
 #include "flashregisters.hpp" // for Flash
+#include "initsequence.hpp" // for InitSequence
 
 //#include "flashwrapper.hpp"
 
@@ -41,123 +42,91 @@ constexpr std::size_t Uart2InterruptPosition = 38U - 32U ;
 #include <cstddef>
 #include <ostream>
 
-extern "C"
-{
-int __low_level_init(void)
-{
-    //Switch on external 16 MHz oscillator
-    RCC::CR::HSEON::On::Set() ;
-    //while (!RCC::CR::HSERDY::Ready::IsSet())
-    //Switch system clock on external oscillator
-    RCC::CFGR::SW::Hse::Set() ;
-    //while (!RCC::CFGR::SWS::Hse::IsSet())
-    {
-
-    }
-
-    //Switch on clock on PortA and PortC, PortB
-    RCC::AHB1ENRPack<
-        RCC::AHB1ENR::GPIOCEN::Enable,
-        RCC::AHB1ENR::GPIOAEN::Enable,
-        RCC::AHB1ENR::GPIOBEN::Enable,
-
-    >::Set() ;
-
-    RCC::APB1ENRPack<
-        RCC::APB1ENR::TIM5EN::Enable,
-        RCC::APB1ENR::TIM2EN::Enable,
-        RCC::APB1ENR::SPI2EN::Enable,
-        RCC::APB1ENR::USART2EN::Enable
-    >::Set() ;
-
-
-    GPIOA::MODERPack<
-        GPIOA::MODER::MODER5::Output, // LED1 on PortA.5, set PortA.5 as output
-        GPIOA::MODER::MODER2::Alternate, // Uart2 TX
-        GPIOA::MODER::MODER3::Alternate  // Uart2 RX
-    >::Set() ;
-
-    GPIOA::AFRLPack <
-        GPIOA::AFRL::AFRL2::Af7, // Uart2 TX
-        GPIOA::AFRL::AFRL3::Af7  // Uart2 RX
-    >::Set() ;
-
-    //USART2::CR1::TE::Enable::Set() ;
+//Начальная настройка периферии: значения битовых полей одного регистра объединяются на этапе компиляции
+//в одну запись таблицы, которая размещается в ROM и выполняется при старте
+using BootSequence = InitSequence<
+    //Switch on external 16 MHz oscillator and switch system clock on it
+    RCC::CR::HSEON::On,
+    RCC::CFGR::SW::Hse,
+    //Switch on clock on PortA and PortC, PortB, TIM2, TIM5, SPI2, USART2 and ADC1
+    RCC::AHB1ENR::GPIOCEN::Enable,
+    RCC::AHB1ENR::GPIOAEN::Enable,
+    RCC::AHB1ENR::GPIOBEN::Enable,
+    RCC::APB1ENR::TIM5EN::Enable,
+    RCC::APB1ENR::TIM2EN::Enable,
+    RCC::APB1ENR::SPI2EN::Enable,
+    RCC::APB1ENR::USART2EN::Enable,
+    RCC::APB2ENR::ADC1EN::Enable,
+    InitBarrier, //Тактирование должно быть включено до обращения к периферии
+
+    GPIOA::MODER::MODER5::Output, // LED1 on PortA.5, set PortA.5 as output
+    GPIOA::MODER::MODER2::Alternate, // Uart2 TX
+    GPIOA::MODER::MODER3::Alternate,  // Uart2 RX
+    GPIOA::MODER::MODER0::Analog, // ADC channel 0
+    GPIOA::AFRL::AFRL2::Af7, // Uart2 TX
+    GPIOA::AFRL::AFRL3::Af7,  // Uart2 RX
 
     // PortB.13 - SPI3_CLK, PortB.15 - SPI2_MOSI, PB1 -CS, PB2- DC, PB8 -Reset
-    GPIOB::MODERPack<
-        GPIOB::MODER::MODER1::Output,         //CS
-        GPIOB::MODER::MODER2::Output,         //DC
-        GPIOB::MODER::MODER8::Output,
-        GPIOB::MODER::MODER9::Output,
-        GPIOB::MODER::MODER13::Alternate,			//PortC.3 scl
-        GPIOB::MODER::MODER15::Alternate			//PortC.2 sda
-    >::Set() ;
-
-    GPIOB::AFRHPack<
-        GPIOB::AFRH::AFRH13::Af5,
-        GPIOB::AFRH::AFRH15::Af5
-    >::Set() ;
-
-    GPIOB::BSRR::BS1::High::Write() ;
+    // PortB.8 scl, PortB.9 sda for Smbus
+    GPIOB::MODER::MODER1::Output,         //CS
+    GPIOB::MODER::MODER2::Output,         //DC
+    GPIOB::MODER::MODER8::Output,
+    GPIOB::MODER::MODER9::Output,
+    GPIOB::MODER::MODER13::Alternate,			//PortC.3 scl
+    GPIOB::MODER::MODER15::Alternate,			//PortC.2 sda
+    GPIOB::OTYPER::OT8::OutputOpenDrain,
+    GPIOB::OTYPER::OT9::OutputOpenDrain,
+    GPIOB::AFRH::AFRH13::Af5,
+    GPIOB::AFRH::AFRH15::Af5,
+    GPIOB::BSRR::BS1::High,
+    GPIOB::BSRR::BS8::High,
+    GPIOB::BSRR::BS9::High,
 
     // LED2 on PortC.9, LED3 on PortC.8, LED4 on PortC.5 so set PortC.5,8,9 as output
     // PortC.2 sda, PortC.3 scl  for Smbus
-    GPIOC::MODERPack<
-        GPIOC::MODER::MODER5::Output,
-        GPIOC::MODER::MODER8::Output,
-        GPIOC::MODER::MODER9::Output,
-				GPIOC::MODER::MODER2::Input, //Busy
-				GPIOC::MODER::MODER3::Output //Reset
-    >::Set() ;
-
-		// PortC.2 sda, PortC.3 scl  for Smbus
-		GPIOB::OTYPERPack<
-		        GPIOB::OTYPER::OT8::OutputOpenDrain,
-						GPIOB::OTYPER::OT9::OutputOpenDrain
-		        >::Set() ;
-
-		GPIOB::BSRRPack<
-		        GPIOB::BSRR::BS8::High,
-						GPIOB::BSRR::BS9::High
-		        >::Write() ;
-
-    SPI2::CR1Pack<
-        SPI2::CR1::MSTR::Master,   //SPI2 master
-        SPI2::CR1::BIDIMODE::Unidirectional2Line,
-        SPI2::CR1::DFF::Data8bit,
-        SPI2::CR1::CPOL::High,
-        SPI2::CR1::CPHA::Phase2edge,
-        SPI2::CR1::SSM::NssSoftwareEnable,
-        SPI2::CR1::SSI::Value1,
-        SPI2::CR1::BR::PclockDiv2,
-        SPI2::CR1::LSBFIRST::MsbFisrt,
-        SPI2::CR1::CRCEN::CrcCalcDisable
-    >::Set() ;
-
-    SPI2::CRCPR::CRCPOLY::Set(10U) ;
-    SPI2::CR1::SPE::Enable::Set() ;
-
-    NVIC::ISER0::Write(1U << 28U) ;
-
-   // TIM2::DIER::UIE::Enable::Set() ;
-		TIM2::PSC::Write(8000) ;
+    GPIOC::MODER::MODER5::Output,
+    GPIOC::MODER::MODER8::Output,
+    GPIOC::MODER::MODER9::Output,
+    GPIOC::MODER::MODER2::Input, //Busy
+    GPIOC::MODER::MODER3::Output, //Reset
+
+    SPI2::CR1::MSTR::Master,   //SPI2 master
+    SPI2::CR1::BIDIMODE::Unidirectional2Line,
+    SPI2::CR1::DFF::Data8bit,
+    SPI2::CR1::CPOL::High,
+    SPI2::CR1::CPHA::Phase2edge,
+    SPI2::CR1::SSM::NssSoftwareEnable,
+    SPI2::CR1::SSI::Value1,
+    SPI2::CR1::BR::PclockDiv2,
+    SPI2::CR1::LSBFIRST::MsbFisrt,
+    SPI2::CR1::CRCEN::CrcCalcDisable,
+    InitFieldValue<SPI2::CRCPR::CRCPOLY, 10U>,
+    InitBarrier, //SPI2 включается после настройки
+    SPI2::CR1::SPE::Enable,
+
+    InitFieldValue<NVIC::ISER0::SETENA, 1U << 28U>,
+    InitFieldValue<TIM2::PSC::PSCField, 8000U>,
 
     //******* UART
-    USART2::BRR::Write(UartSpeed9600) ;
-    USART2::CR1::UE::Enable::Set() ;
-    NVIC::ISER1::Write(1U << Uart2InterruptPosition) ;
+    InitFieldValue<USART2::BRR::DIV_Mantissa, (UartSpeed9600 >> 4U)>,
+    InitFieldValue<USART2::BRR::DIV_Fraction, (UartSpeed9600 & 0xFU)>,
+    USART2::CR1::UE::Enable,
+    InitFieldValue<NVIC::ISER1::SETENA, 1U << Uart2InterruptPosition>,
 
     //********************ADC
-    RCC::APB2ENR::ADC1EN::Enable::Set() ;
-    ADC_Common::CCR::TSVREFE::Enable::Set() ;
-    ADC1::CR2::EOCS::SingleConversion::Set() ;
-    //84 cycles sample rate for channel 0
-    ADC1::SMPR2::SMP0::Cycles84::Set() ;
-    ADC1::SQR1::L::Conversions1::Set() ;
-    ADC1::SQR3::SQ1::Channel18::Set() ;
-    GPIOA::MODER::MODER0::Analog::Set() ;
-		DMA2::S0M0AR::M0A::Set(10);
+    ADC_Common::CCR::TSVREFE::Enable,
+    ADC1::CR2::EOCS::SingleConversion,
+    ADC1::SMPR2::SMP0::Cycles84, //84 cycles sample rate for channel 0
+    ADC1::SQR1::L::Conversions1,
+    ADC1::SQR3::SQ1::Channel18,
+    InitFieldValue<DMA2::S0M0AR::M0A, 10U>
+> ;
+
+extern "C"
+{
+int __low_level_init(void)
+{
+    BootSequence::Apply() ;
     return 1;
   }
 }
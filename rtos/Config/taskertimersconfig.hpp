@@ -5,7 +5,8 @@
 
 #include "taskerconfig.hpp"
 #include "taskertimer.hpp"        // For TaskerTimer
-#include "taskertimerservice.hpp" // For TaskerTimerService
+#include "taskertimerservice.hpp" // For TaskerTimerService, TicklessIdle
+#include "systicktimer.hpp"       // For SysTickTimer
 #include "teststates.hpp"         // for myThread1
 #include "idletask.hpp"           // for  idleTask
 
@@ -27,4 +28,7 @@ using IdleTimer = TaskerTimer<myTasker, 1'000UL,
 
 using tRtosTimerService = TaskerTimerService<myTasker, MyThread1Timer, MyThread2Timer, IdleTimer>;
 
+// Без готовых задач ядро спит до ближайшего срабатывания таймеров, SysTick 1 кГц от 16 МГц (main.cpp)
+using tRtosIdle = TicklessIdle<tRtosTimerService, SysTickTimer<16'000'000U / 1'000U>>;
+
 
@@ -0,0 +1,96 @@
+// Filename: machinetimer.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <cstdint>                      // for std::uint32_t, std::uint64_t
+#include "machinetimerregisters.hpp"    // for MACHINETIMER
+#include "susudefs.hpp"                 // for __forceinline
+
+// Машинный таймер RISC-V (mtime/mtimecmp GD32VF103) как системный таймер простоя без тиков (TicklessIdle).
+// mtime считает непрерывно, тик - прерывание при mtime >= mtimecmp, после каждого тика mtimecmp сдвигается
+// на countsPerTick. Во сне mtimecmp указывает сразу на тик пробуждения, после пробуждения - на следующий
+// тик, поэтому границы тиков не сдвигаются. Прерывание держится, пока mtime >= mtimecmp, поэтому тик,
+// пройденный во время записи mtimecmp, не теряется. Обработчик прерывания машинного таймера вызывает
+// OnInterrupt(), затем TaskerTimerService::OnSystemTick().
+template<std::uint32_t countsPerTick>
+struct MachineTimer
+{
+    static_assert(countsPerTick != 0U, "Tick period could not be 0");
+
+    // 64-битный счетчик не ограничивает сон
+    static constexpr std::uint32_t MaxTicks = 0xFFFFFFFFU;
+
+    static void Start()
+    {
+        compare = GetTime() + countsPerTick;
+        SetCompare(compare);
+    }
+
+    static void OnInterrupt()
+    {
+        compare += countsPerTick;
+        SetCompare(compare);
+    }
+
+    // Метод вызывается с запрещенными прерываниями: ядро спит до тика номер ticks, считая от текущего, или
+    // до другого прерывания. Возвращает количество тиков, прошедших во сне, без тика пробуждения - его
+    // обработает ожидающее прерывание таймера
+    static std::uint32_t Sleep(std::uint32_t ticks)
+    {
+        // Тик наступил, но еще не обработан
+        if ((ticks < 2U) || (GetTime() >= compare))
+        {
+            Wait();
+            return 0U;
+        }
+        const std::uint64_t deadline = compare + static_cast<std::uint64_t>(ticks - 1U) * countsPerTick;
+        SetCompare(deadline);
+        Wait();
+        const std::uint64_t time = GetTime();
+        if (time >= deadline)
+        {
+            compare = deadline;
+            return ticks - 1U;
+        }
+        // Разбудило другое прерывание
+        const std::uint32_t result =
+            (time >= compare) ? static_cast<std::uint32_t>(1U + (time - compare) / countsPerTick) : 0U;
+        compare += static_cast<std::uint64_t>(result) * countsPerTick;
+        SetCompare(compare);
+        return result;
+    }
+
+  private:
+    using Memory = MACHINETIMER::MTIME::Memory;
+
+    // WFI будит ожидающее прерывание и при запрещенных прерываниях (mstatus.MIE = 0)
+    __forceinline static void Wait()
+    {
+        __asm volatile ("wfi");
+    }
+
+    // На RV32 64-битный счетчик читается двумя словами, старшее перечитывается, если младшее переполнилось
+    static std::uint64_t GetTime()
+    {
+        std::uint32_t high = 0U;
+        std::uint32_t low = 0U;
+        do
+        {
+            high = Memory::template Read<std::uint32_t>(MACHINETIMER::MTIME::Address + 4U);
+            low = Memory::template Read<std::uint32_t>(MACHINETIMER::MTIME::Address);
+        } while (high != Memory::template Read<std::uint32_t>(MACHINETIMER::MTIME::Address + 4U));
+        return (static_cast<std::uint64_t>(high) << 32U) | low;
+    }
+
+    // Старшее слово сначала максимальное, чтобы промежуточное значение не вызвало прерывание
+    static void SetCompare(std::uint64_t value)
+    {
+        Memory::template Write<std::uint32_t>(MACHINETIMER::MTIMECMP::Address + 4U, 0xFFFFFFFFU);
+        Memory::template Write<std::uint32_t>(MACHINETIMER::MTIMECMP::Address, static_cast<std::uint32_t>(value));
+        Memory::template Write<std::uint32_t>(MACHINETIMER::MTIMECMP::Address + 4U,
+                                              static_cast<std::uint32_t>(value >> 32U));
+    }
+
+    static inline std::uint64_t compare = 0U;
+};
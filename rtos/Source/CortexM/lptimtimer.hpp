@@ -0,0 +1,170 @@
+// Filename: lptimtimer.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <cstdint>       // for std::uint32_t
+#include <intrinsics.h>  // for __DSB, __WFI, __ISB
+#include "susudefs.hpp"  // for __forceinline
+#include "waituntil.hpp" // for WaitUntil, WaitStatus
+
+// Таймер LPTIM (STM32L4, например LPTIM1) как системный таймер простоя без тиков (TicklessIdle). Счетчик
+// считает непрерывно до ARR = 0xFFFF от LSE или LSI и не останавливается во сне, тик - совпадение с CMP,
+// которое после каждого тика сдвигается на countsPerTick. Во сне CMP указывает сразу на тик пробуждения,
+// после пробуждения - на следующий тик, поэтому границы тиков не сдвигаются. Обработчик прерывания LPTIM
+// вызывает OnInterrupt(), затем TaskerTimerService::OnSystemTick(). Запись CMP не ждет подтверждения (CMPOK),
+// подтверждение предыдущей записи проверяется перед следующей, к тому времени запись обычно уже закончилась.
+// Ожидание подтверждения ограничено, поэтому, если LPTIM не тактируется, цикл простоя не зависает, а ядро
+// не засыпает. Ограничение рассчитывается по наибольшей частоте ядра coreClock и наименьшей частоте LPTIM
+// minLptimClock с учетом разброса LSI (на STM32L4 - от 29,5 кГц):
+// using SystemTimer = LptimTimer<LPTIM1, 32U, 80'000'000U, 29'500U> ;
+template<typename Lptim, std::uint32_t countsPerTick, std::uint32_t coreClock, std::uint32_t minLptimClock>
+struct LptimTimer
+{
+    static_assert((countsPerTick >= 4U) && (countsPerTick <= 0x8000U), "Tick period does not fit LPTIM");
+    static_assert((minLptimClock != 0U) && (minLptimClock <= coreClock), "LPTIM clock must not exceed core clock");
+
+    // Сон ограничен 16-битным счетчиком
+    static constexpr std::uint32_t MaxTicks = 0xFFFFU / countsPerTick;
+
+    // Метод вызывается после включения таймера (CR::ENABLE) и разрешения прерывания IER::CMPMIE. Возвращает
+    // false, если таймер не тактируется, тогда Sleep() вызывать нельзя
+    static bool Start()
+    {
+        Lptim::ARR::Write(counterMask);
+        if (WaitUntil<typename Lptim::ISR::ARROK::Value1>(writeTimeout) == WaitStatus::Timeout)
+        {
+            return false;
+        }
+        Lptim::ICR::ARROKCF::Value1::Write();
+        Lptim::CR::CNTSTRT::Value1::Set();
+        WriteCompare(GetCounter() + countsPerTick);
+        return true;
+    }
+
+    // Запись CMP на прошлом тике давно закончилась, поэтому обработчик не ждет. Если таймер перестал
+    // тактироваться, следующего тика не будет, это обнаружит запись CMP в Sleep()
+    static void OnInterrupt()
+    {
+        Lptim::ICR::CMPMCF::Value1::Write();
+        static_cast<void>(SetCompare(compare + countsPerTick));
+    }
+
+    // Метод вызывается с запрещенными прерываниями: ядро спит до тика номер ticks, считая от текущего, или
+    // до другого прерывания. Возвращает количество тиков, прошедших во сне, без тика пробуждения - его
+    // обработает ожидающее прерывание LPTIM
+    static std::uint32_t Sleep(std::uint32_t ticks)
+    {
+        if (ticks < 2U)
+        {
+            Wait();
+            return 0U;
+        }
+        // Таймер не тактируется, тик пробуждения не наступит
+        if (!IsCompareWritten())
+        {
+            return 0U;
+        }
+        // Тик наступил, но еще не обработан, или наступит раньше, чем закончится запись CMP: до ее подтверждения
+        // действует прежнее совпадение. CMPM читается после счетчика, поэтому, если он не установлен, счетчик
+        // прочитан до тика
+        const std::uint32_t counter = GetCounter();
+        if (Lptim::ISR::CMPM::Value1::IsSet() || (((compare - counter) & counterMask) <= writeCounts))
+        {
+            Wait();
+            return 0U;
+        }
+        const std::uint32_t previous = compare - countsPerTick;
+        WriteCompare(compare + (ticks - 1U) * countsPerTick);
+        Wait();
+        if (Lptim::ISR::CMPM::Value1::IsSet())
+        {
+            return ticks - 1U;
+        }
+        // Разбудило другое прерывание. Совпадение со следующим тиком записывается с запасом, иначе счетчик
+        // может пройти его раньше, чем закончится запись, и прерывание придет только через период счетчика.
+        // Счетчик читается после подтверждения предыдущей записи, поэтому запас - одна запись
+        if (!IsCompareWritten())
+        {
+            return 0U;
+        }
+        const std::uint32_t current = GetCounter();
+        std::uint32_t result = ((current - previous) & counterMask) / countsPerTick;
+        if (((previous + (result + 1U) * countsPerTick - current) & counterMask) <= writeCounts)
+        {
+            ++result;
+        }
+        // Следующий тик - тик пробуждения, совпадение с ним уже записано
+        if ((result + 1U) >= ticks)
+        {
+            return ticks - 1U;
+        }
+        WriteCompare(previous + (result + 1U) * countsPerTick);
+        return result;
+    }
+
+  private:
+    static constexpr std::uint32_t counterMask = 0xFFFFU;
+    // Запись CMP синхронизируется с тактированием счетчика и занимает несколько его тактов. Следующая запись
+    // CMP до подтверждения предыдущей (CMPOK) приводит к непредсказуемому результату
+    static constexpr std::uint32_t writeCounts = 3U;
+    // Ограничение ожидания записи ARR и CMP: опрос занимает не меньше такта ядра, поэтому writeCounts + 1
+    // тактов счетчика укладываются в это количество опросов
+    static constexpr std::uint32_t writeTimeout =
+        (writeCounts + 1U) * ((coreClock + minLptimClock - 1U) / minLptimClock);
+
+    __forceinline static void Wait()
+    {
+        __DSB();
+        __WFI();
+        __ISB();
+    }
+
+    // Счетчик тактируется асинхронно, значение достоверно, если два чтения подряд совпали
+    static std::uint32_t GetCounter()
+    {
+        std::uint32_t counter = Lptim::CNT::Get();
+        for (std::uint32_t next = Lptim::CNT::Get(); next != counter; next = Lptim::CNT::Get())
+        {
+            counter = next;
+        }
+        return counter;
+    }
+
+    // Метод ждет подтверждения последней записи CMP, если оно еще не получено, и сбрасывает CMPOK. Возвращает
+    // false, если запись не подтверждена, то есть таймер не тактируется
+    static bool IsCompareWritten()
+    {
+        if (isWritePending)
+        {
+            if (WaitUntil<typename Lptim::ISR::CMPOK::Value1>(writeTimeout) == WaitStatus::Timeout)
+            {
+                return false;
+            }
+            Lptim::ICR::CMPOKCF::Value1::Write();
+            isWritePending = false;
+        }
+        return true;
+    }
+
+    static void WriteCompare(std::uint32_t value)
+    {
+        compare = value & counterMask;
+        Lptim::CMP::Write(compare);
+        isWritePending = true;
+    }
+
+    // Метод возвращает false и не меняет CMP, если предыдущая запись не подтверждена
+    static bool SetCompare(std::uint32_t value)
+    {
+        if (!IsCompareWritten())
+        {
+            return false;
+        }
+        WriteCompare(value);
+        return true;
+    }
+
+    static inline std::uint32_t compare = 0U;
+    static inline bool isWritePending = false;
+};
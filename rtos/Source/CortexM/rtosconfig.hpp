@@ -7,4 +7,8 @@ inline constexpr bool CORTEXM = true;
 __forceinline inline static void IsrExitProceed()
 {
   SCB::ICSR::PENDSVSET::PendingState::Set(); 
-}
\ No newline at end of file
+}
+
+__forceinline inline static void IdleProceed()
+{
+}
@@ -0,0 +1,140 @@
+// Filename: systicktimer.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <cstdint>           // for std::uint32_t
+#include <intrinsics.h>      // for __DSB, __WFI, __ISB
+#include "stkregisters.hpp"  // for STK
+#include "scbregisters.hpp"  // for SCB
+#include "susudefs.hpp"      // for __forceinline
+
+// SysTick как системный таймер простоя без тиков (TicklessIdle). Период тика - cyclesPerTick тактов, при
+// запуске в LOAD загружается cyclesPerTick - 1, SysTick тактируется от ядра (main.cpp). Счетчик во сне не
+// останавливается и не перезаписывается: новое значение LOAD загружается только при перезагрузке счетчика
+// на тике. Поэтому перед сном в LOAD записывается время от следующего тика до тика пробуждения, ядро
+// просыпается на следующем тике, сбрасывает его прерывание, возвращает в LOAD период тика и спит до тика
+// пробуждения. Границы тиков при этом остаются на своих местах. Только если ядро разбудило другое
+// прерывание посреди сна, счетчик перезапускается с остатком текущего тика, и такты перезапуска
+// учитываются в остатке.
+template<std::uint32_t cyclesPerTick>
+struct SysTickTimer
+{
+    static_assert((cyclesPerTick >= 2U) && (cyclesPerTick <= 0x1000000U), "Tick period does not fit SysTick");
+
+    // Сон ограничен 24-битным счетчиком
+    static constexpr std::uint32_t MaxTicks = 0x1000000U / cyclesPerTick;
+
+    // Метод вызывается с запрещенными прерываниями: ядро спит до тика номер ticks, считая от текущего, или
+    // до другого прерывания. Возвращает количество тиков, прошедших во сне, без тика пробуждения - его
+    // обработает ожидающее прерывание SysTick
+    static std::uint32_t Sleep(std::uint32_t ticks)
+    {
+        // COUNTFLAG, оставшийся от уже обработанного тика, сбрасывается чтением CTRL
+        static_cast<void>(STK::CTRL::Get());
+        // Тик наступил, но еще не обработан, или наступит раньше, чем запишется LOAD
+        if ((ticks < 2U) || SCB::ICSR::PENDSTSET::PendingState::IsSet() || !IsBeforeTick())
+        {
+            Wait();
+            return 0U;
+        }
+        const std::uint32_t sleepReload = (ticks - 1U) * cyclesPerTick - 1U;
+        STK::LOAD::Write(sleepReload);
+        Wait();
+        if (!WaitForTick())
+        {
+            // Разбудило другое прерывание до следующего тика, счетчик еще не перезагружался
+            STK::LOAD::Write(cyclesPerTick - 1U);
+            return 0U;
+        }
+        // Следующий тик наступил, счетчик перезагрузился до тика пробуждения. Период тика загрузится на нем
+        STK::LOAD::Write(cyclesPerTick - 1U);
+        SCB::ICSR::PENDSTCLR::PendingStateRemove::Write();
+        Wait();
+        const std::uint32_t current = STK::VAL::Get();
+        if (STK::CTRL::COUNTFLAG::Overflow::IsSet())
+        {
+            // Тик пробуждения наступил
+            return ticks - 1U;
+        }
+        // Разбудило другое прерывание: current тактов до тика пробуждения, тиков прошло
+        // 1 + (sleepReload - current) / cyclesPerTick. Если до следующего тика меньше guardCycles тактов,
+        // то он считается прошедшим, а счетчик перезапускается до тика после него
+        std::uint32_t result = 1U + (sleepReload - current) / cyclesPerTick;
+        std::uint32_t ticksLeft = ticks - 1U - result;
+        if ((ticksLeft != 0U) && ((current - ticksLeft * cyclesPerTick) < guardCycles))
+        {
+            ++result;
+            --ticksLeft;
+        }
+        // Следующий тик - тик пробуждения, счетчик уже считает до него
+        if (ticksLeft == 0U)
+        {
+            return ticks - 1U;
+        }
+        Restart(ticksLeft * cyclesPerTick);
+        return result;
+    }
+
+  private:
+    // Тактов от чтения VAL до записи LOAD или VAL с запасом на вычисления и ожидание на шине
+    static constexpr std::uint32_t guardCycles = 100U;
+    // Тактов от чтения VAL до перезагрузки счетчика после записи VAL: чтение VAL, сложение, запись LOAD
+    // и VAL (Cortex-M3/M4), перезагрузка - на следующем такте после записи
+    static constexpr std::uint32_t restartCycles = 5U;
+
+    __forceinline static void Wait()
+    {
+        __DSB();
+        __WFI();
+        __ISB();
+    }
+
+    // Метод возвращает true, если тик не наступил и до него не меньше guardCycles тактов. COUNTFLAG читается
+    // после VAL, поэтому, если он не установлен, VAL прочитан до тика
+    static bool IsBeforeTick()
+    {
+        const std::uint32_t current = STK::VAL::Get();
+        return !STK::CTRL::COUNTFLAG::Overflow::IsSet() && (current >= guardCycles);
+    }
+
+    // Метод возвращает true, если тик наступил и счетчик перезагрузился, и false, если до тика не меньше
+    // guardCycles тактов и LOAD можно записать до перезагрузки счетчика. Иначе ждет тика, это меньше
+    // guardCycles тактов
+    static bool WaitForTick()
+    {
+        for (;;)
+        {
+            const std::uint32_t current = STK::VAL::Get();
+            if (STK::CTRL::COUNTFLAG::Overflow::IsSet())
+            {
+                WaitForReload();
+                return true;
+            }
+            if (current >= guardCycles)
+            {
+                return false;
+            }
+        }
+    }
+
+    // Счетчик перезапускается так, чтобы следующий тик наступил через VAL - offset тактов от чтения VAL.
+    // Между чтением VAL и записью VAL нет других команд, поэтому такты перезапуска известны и вычитаются из
+    // остатка. LOAD = cyclesPerTick - 1 записывается после перезагрузки счетчика
+    static void Restart(std::uint32_t offset)
+    {
+        const std::uint32_t reload = STK::VAL::Get() - offset - restartCycles;
+        STK::LOAD::Write(reload);
+        STK::VAL::Write(0U);
+        WaitForReload();
+        STK::LOAD::Write(cyclesPerTick - 1U);
+    }
+
+    // Счетчик, равный 0, перезагружается значением LOAD на следующем такте, после этого LOAD можно менять
+    static void WaitForReload()
+    {
+        while (STK::VAL::Get() == 0U)
+        {
+        }
+    }
+};
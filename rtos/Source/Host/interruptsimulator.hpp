@@ -0,0 +1,259 @@
+// Filename: interruptsimulator.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <array>     // for std::array
+#include <cassert>   // for assert()
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint32_t, std::uint64_t
+#include <cstdlib>   // for std::exit
+
+// Планировщик, тот же, который вызывает HandlePendSv (taskerschedule.cpp)
+extern "C" void Schedule() ;
+
+// Симулятор прерываний для запуска Tasker на хосте. Время виртуальное, в тактах ядра. Источники
+// прерываний (SysTick, периферия) выставляют запрос в заданное время, обработчик вызывается сразу, если
+// прерывания разрешены и не выполняется другой обработчик, иначе - после разрешения прерываний или
+// выхода из обработчика. Приоритеты прерываний одинаковые: обработчики не вытесняют друг друга, ожидающие
+// обрабатываются в порядке появления запросов.
+// Код задач и обработчиков отмечает выполненную работу вызовом Consume(cycles) - это точка, в которой
+// его может вытеснить прерывание. Запрос PendSV (PendSchedule()) обрабатывается последним, как прерывание
+// с самым низким приоритетом: вызывается Schedule() с запрещенными прерываниями, так же как в
+// CortexM0/interrupthandlers.s, поэтому задачи вытесняют друг друга вложенными вызовами на одном стеке.
+// Tasker::Start() не возвращает управление, поэтому симуляция заканчивается вызовом обработчика остановки
+// и завершением процесса, когда виртуальное время доходит до stopTime.
+class InterruptSimulator
+{
+  public:
+    using tHandler = void (*)() ;
+
+    static constexpr std::size_t MaxSources = 8U ;
+    static constexpr std::uint64_t Never = UINT64_MAX ;
+
+    struct Statistics
+    {
+        std::uint64_t interrupts ;    // Количество вызовов обработчиков прерываний
+        std::uint64_t lost ;          // Запросы, пришедшие, пока предыдущий запрос источника еще ожидал
+        std::uint64_t maxLatency ;    // Максимальная задержка от запроса до входа в обработчик, в тактах
+        std::uint64_t totalLatency ;
+        std::uint64_t schedules ;     // Количество вызовов планировщика из PendSV
+        std::uint64_t idleCycles ;    // Время, проведенное в цикле Tasker::Start()
+    } ;
+
+    // Метод сбрасывает время и источники, onStop вызывается при достижении stopTime
+    static void Reset(std::uint64_t stopTime, tHandler onStop)
+    {
+        now = 0U ;
+        stop = stopTime ;
+        stopHandler = onStop ;
+        mask = 0U ;
+        depth = 0U ;
+        scheduleRequested = false ;
+        sourcesCount = 0U ;
+        activeRaiseTime = 0U ;
+        statistics = Statistics{} ;
+    }
+
+    // Метод добавляет источник прерывания с первым запросом в firstTime. Для period не равного 0 запросы
+    // повторяются с этим периодом, иначе следующий запрос задается SetNextTime()
+    static std::size_t AddSource(tHandler handler, std::uint64_t firstTime, std::uint64_t period)
+    {
+        assert(sourcesCount < MaxSources) ;
+        sources[sourcesCount] = Source{handler, firstTime, period, 0U, false} ;
+        return sourcesCount++ ;
+    }
+
+    static void SetNextTime(std::size_t source, std::uint64_t time)
+    {
+        assert(source < sourcesCount) ;
+        sources[source].nextTime = time ;
+    }
+
+    // Время следующего запроса источника
+    static std::uint64_t GetNextTime(std::size_t source)
+    {
+        assert(source < sourcesCount) ;
+        return sources[source].nextTime ;
+    }
+
+    // Точка вытеснения: код выполнил работу длиной cycles тактов. Прерывания, запрошенные за это время,
+    // обрабатываются в момент запроса, и оставшаяся работа сдвигается на время их обработки
+    static void Consume(std::uint64_t cycles)
+    {
+        for (;;)
+        {
+            CheckStop() ;
+            const std::uint64_t next = GetNextTime() ;
+            if ((next > now) && ((next - now) > cycles))
+            {
+                now += cycles ;
+                break ;
+            }
+            if (next > now)
+            {
+                cycles -= next - now ;
+                now = next ;
+            }
+            RaiseDue() ;
+            Deliver() ;
+        }
+    }
+
+    // Ожидание в цикле Tasker::Start(), как WFI: время сдвигается до следующего запроса прерывания, если
+    // нет ожидающих. При запрещенных прерываниях запрос только выставляется
+    static void Idle()
+    {
+        const std::uint64_t next = GetNextTime() ;
+        if ((next > now) && (GetFirstPending() == nullptr))
+        {
+            const std::uint64_t wakeTime = (next < stop) ? next : stop ;
+            statistics.idleCycles += wakeTime - now ;
+            now = wakeTime ;
+        }
+        CheckStop() ;
+        RaiseDue() ;
+        Deliver() ;
+    }
+
+    // Запрос PendSV
+    static void PendSchedule()
+    {
+        scheduleRequested = true ;
+        Deliver() ;
+    }
+
+    static std::uint32_t GetMask()
+    {
+        return mask ;
+    }
+
+    // Разрешение прерываний сразу вызывает обработчики ожидающих прерываний
+    static void SetMask(std::uint32_t value)
+    {
+        mask = value ;
+        Deliver() ;
+    }
+
+    static std::uint64_t Now()
+    {
+        return now ;
+    }
+
+    // Время запроса прерывания, обработчик которого выполняется
+    static std::uint64_t GetActiveRaiseTime()
+    {
+        return activeRaiseTime ;
+    }
+
+    static const Statistics& GetStatistics()
+    {
+        return statistics ;
+    }
+
+  private:
+    struct Source
+    {
+        tHandler handler ;
+        std::uint64_t nextTime ;
+        std::uint64_t period ;
+        std::uint64_t raiseTime ;
+        bool pending ;
+    } ;
+
+    static std::uint64_t GetNextTime()
+    {
+        std::uint64_t result = Never ;
+        for (std::size_t i = 0U; i < sourcesCount; ++i)
+        {
+            result = (sources[i].nextTime < result) ? sources[i].nextTime : result ;
+        }
+        return result ;
+    }
+
+    static void RaiseDue()
+    {
+        for (std::size_t i = 0U; i < sourcesCount; ++i)
+        {
+            Source& source = sources[i] ;
+            if (source.nextTime <= now)
+            {
+                if (source.pending)
+                {
+                    ++statistics.lost ;
+                }
+                else
+                {
+                    source.pending = true ;
+                    source.raiseTime = source.nextTime ;
+                }
+                source.nextTime = (source.period != 0U) ? (source.nextTime + source.period) : Never ;
+            }
+        }
+    }
+
+    static Source* GetFirstPending()
+    {
+        Source* result = nullptr ;
+        for (std::size_t i = 0U; i < sourcesCount; ++i)
+        {
+            if (sources[i].pending && ((result == nullptr) || (sources[i].raiseTime < result->raiseTime)))
+            {
+                result = &sources[i] ;
+            }
+        }
+        return result ;
+    }
+
+    static void Deliver()
+    {
+        while ((mask == 0U) && (depth == 0U))
+        {
+            Source* source = GetFirstPending() ;
+            if (source != nullptr)
+            {
+                source->pending = false ;
+                const std::uint64_t latency = now - source->raiseTime ;
+                ++statistics.interrupts ;
+                statistics.totalLatency += latency ;
+                statistics.maxLatency = (latency > statistics.maxLatency) ? latency : statistics.maxLatency ;
+                activeRaiseTime = source->raiseTime ;
+                ++depth ;
+                source->handler() ;
+                --depth ;
+            }
+            else if (scheduleRequested)
+            {
+                scheduleRequested = false ;
+                ++statistics.schedules ;
+                mask = 1U ;
+                Schedule() ;
+                mask = 0U ;
+            }
+            else
+            {
+                break ;
+            }
+        }
+    }
+
+    static void CheckStop()
+    {
+        if (now >= stop)
+        {
+            stopHandler() ;
+            std::exit(EXIT_SUCCESS) ;
+        }
+    }
+
+    static inline std::uint64_t now = 0U ;
+    static inline std::uint64_t stop = Never ;
+    static inline tHandler stopHandler = nullptr ;
+    static inline std::uint32_t mask = 0U ;
+    static inline std::uint32_t depth = 0U ;
+    static inline bool scheduleRequested = false ;
+    static inline std::array<Source, MaxSources> sources = {} ;
+    static inline std::size_t sourcesCount = 0U ;
+    static inline std::uint64_t activeRaiseTime = 0U ;
+    static inline Statistics statistics = {} ;
+} ;
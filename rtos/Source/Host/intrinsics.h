@@ -0,0 +1,37 @@
+// Filename: intrinsics.h
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+// Замена intrinsics.h IAR для сборки на хосте: запрет прерываний - маска симулятора прерываний
+
+#pragma once
+
+#include <cstdint>                 // for std::uint32_t
+#include "interruptsimulator.hpp"  // for InterruptSimulator
+
+using __istate_t = std::uint32_t ;
+
+inline __istate_t __get_interrupt_state()
+{
+    return InterruptSimulator::GetMask() ;
+}
+
+inline void __set_interrupt_state(__istate_t state)
+{
+    InterruptSimulator::SetMask(state) ;
+}
+
+inline void __disable_interrupt()
+{
+    InterruptSimulator::SetMask(1U) ;
+}
+
+inline void __enable_interrupt()
+{
+    InterruptSimulator::SetMask(0U) ;
+}
+
+// Для хоста на ARM (__ARM_FEATURE_CLZ), CLZ от 0 равен 32, как у команды ядра
+inline std::uint32_t __CLZ(std::uint32_t value)
+{
+    return (value != 0U) ? static_cast<std::uint32_t>(__builtin_clz(value)) : 32U ;
+}
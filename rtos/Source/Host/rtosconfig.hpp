@@ -0,0 +1,16 @@
+#pragma once
+
+#include "interruptsimulator.hpp"  // for InterruptSimulator
+#include "susudefs.hpp"            // for forceinline
+inline constexpr bool CORTEXM = false;
+
+__forceinline inline static void IsrExitProceed()
+{
+  InterruptSimulator::PendSchedule();
+}
+
+// Виртуальное время сдвигается до следующего прерывания
+__forceinline inline static void IdleProceed()
+{
+  InterruptSimulator::Idle();
+}
@@ -0,0 +1,50 @@
+// Filename: simulatedtimer.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <cstddef>                 // for std::size_t
+#include <cstdint>                 // for std::uint32_t, std::uint64_t
+#include "interruptsimulator.hpp"  // for InterruptSimulator
+
+// Системный таймер простоя без тиков (TicklessIdle) для симуляции на хосте: источник прерывания
+// InterruptSimulator с периодом cyclesPerTick тактов. Во сне следующий запрос переносится на тик
+// пробуждения, после пробуждения - на следующий тик, так же как SysTickTimer перезагружает счетчик. Сон
+// ограничен так же, как у 24-битного SysTick.
+template<std::uint64_t cyclesPerTick>
+struct SimulatedTimer
+{
+    static constexpr std::uint32_t MaxTicks = static_cast<std::uint32_t>(0x1000000U / cyclesPerTick);
+
+    static void Start(InterruptSimulator::tHandler handler)
+    {
+        source = InterruptSimulator::AddSource(handler, cyclesPerTick, cyclesPerTick);
+    }
+
+    // Метод вызывается с запрещенными прерываниями, возвращает количество тиков, прошедших во сне, без
+    // тика пробуждения - его обработает ожидающее прерывание
+    static std::uint32_t Sleep(std::uint32_t ticks)
+    {
+        if (ticks < 2U)
+        {
+            InterruptSimulator::Idle();
+            return 0U;
+        }
+        const std::uint64_t next = InterruptSimulator::GetNextTime(source);
+        const std::uint64_t deadline = next + (ticks - 1U) * cyclesPerTick;
+        InterruptSimulator::SetNextTime(source, deadline);
+        InterruptSimulator::Idle();
+        const std::uint64_t now = InterruptSimulator::Now();
+        if (now >= deadline)
+        {
+            return ticks - 1U;
+        }
+        // Разбудило другое прерывание
+        const std::uint32_t result = (now >= next) ? static_cast<std::uint32_t>(1U + (now - next) / cyclesPerTick) : 0U;
+        InterruptSimulator::SetNextTime(source, next + result * cyclesPerTick);
+        return result;
+    }
+
+  private:
+    static inline std::size_t source = 0U;
+};
@@ -0,0 +1,53 @@
+// Filename: prioritybitmap.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <array>      // for std::array
+#include <cstddef>    // for std::size_t
+#include <cstdint>    // for std::uint32_t, std::uint8_t
+#include "susudefs.hpp" // for __forceinline
+
+#if defined(__ARM_FEATURE_CLZ)
+#include <intrinsics.h> // for __CLZ
+#endif
+
+// Битовая карта готовых задач: задаче с приоритетом priority (0 - самый высокий) соответствует бит
+// 31 - priority, поэтому номер самой приоритетной готовой задачи - количество ведущих нулей карты.
+// На ядрах с командой CLZ (Cortex M3/M4) это одна команда, на Cortex M0 и RISC-V - умножение на
+// последовательность де Брёйна и чтение таблицы.
+struct PriorityBitmap
+{
+    static constexpr std::size_t MaxPriorities = 32U;
+
+    static constexpr std::uint32_t GetBit(std::size_t priority)
+    {
+        return 0x80000000U >> priority;
+    }
+
+    // Метод возвращает самый высокий приоритет из карты или MaxPriorities, если карта пустая
+    __forceinline static std::size_t GetHighest(std::uint32_t bitmap)
+    {
+#if defined(__ARM_FEATURE_CLZ)
+        return __CLZ(bitmap);
+#else
+        // Все биты младше старшего единичного становятся единичными, после умножения старшие 5 бит
+        // различны для каждого положения старшего бита
+        bitmap |= bitmap >> 1U;
+        bitmap |= bitmap >> 2U;
+        bitmap |= bitmap >> 4U;
+        bitmap |= bitmap >> 8U;
+        bitmap |= bitmap >> 16U;
+        return (bitmap != 0U) ? leadingZeros[(bitmap * 0x07C4ACDDU) >> 27U] : MaxPriorities;
+#endif
+    }
+
+  private:
+#if !defined(__ARM_FEATURE_CLZ)
+    static constexpr std::array<std::uint8_t, 32U> leadingZeros =
+    {
+        31U, 22U, 30U, 21U, 18U, 10U, 29U,  2U, 20U, 17U, 15U, 13U,  9U,  6U, 28U,  1U,
+        23U, 19U, 11U,  3U, 16U, 14U,  7U, 24U, 12U,  4U,  8U, 25U,  5U, 26U, 27U,  0U
+    };
+#endif
+};
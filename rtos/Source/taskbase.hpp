@@ -3,6 +3,7 @@
 
 #pragma once
 #include "taskertypes.hpp"
+#include "taskeventqueue.hpp" // for TaskEventQueue
 
 
 template <typename T>
@@ -14,4 +15,11 @@ struct TaskBase
     inline static tStateEvents events = static_cast<tStateEvents>(0U);
 };
 
-
+// Задача с очередью событий с данными: Tasker::PostEvent<task>(event) кладет событие в очередь, а задача
+// обрабатывает все накопившиеся события за один вызов OnEvent(), например, queue.Drain(handler)
+template <typename T, typename Event, std::size_t capacity, QueueProducers producers = QueueProducers::Multiple>
+struct TaskWithQueue : public TaskBase<T>
+{
+    using tEvent = Event;
+    inline static TaskEventQueue<Event, capacity, producers> queue;
+};
@@ -5,15 +5,27 @@
 #include "taskertypes.hpp"            // For  types
 #include "criticalsection.hpp"        // For CriticalSection
 #include "susudefs.hpp"               // For __forceinline
+#include "rtosconfig.hpp"             // For IsrExitProceed(), IdleProceed()
+#include "prioritybitmap.hpp"         // For PriorityBitmap
 #include <cassert>                    // For assert(), static_assert()
-#include <type_traits>                // for std::is_same
-//#include "scbregisters.hpp"  // for SCB
+#include <type_traits>                // for std::is_same, std::decay_t
+
+// Цикл простоя по умолчанию: ожидание прерывания определяет порт (rtosconfig.hpp)
+struct TaskerIdle
+{
+    __forceinline static void OnIdle()
+    {
+        IdleProceed();
+    }
+};
 
 template<const auto& ...tasks>
 class Tasker
 {
  public:
     
+    // Idle::OnIdle() вызывается, когда нет готовых задач, например, TicklessIdle (taskertimerservice.hpp)
+    template<typename Idle = TaskerIdle>
     __forceinline static void Start()
     {
         if (status != Status::Running)
@@ -26,6 +38,7 @@ class Tasker
             }
             for (;;) //UB Однако
             {
+                Idle::OnIdle();
             }
         }
     }
@@ -34,13 +47,37 @@ class Tasker
     static void PostEvent(const tStateEvents events)
     {
         const CriticalSection cs;
-        (targetTasks.events |= events, ...);
+        ((targetTasks.events |= events), ...);
+        constexpr std::uint32_t targetTasksBits = (PriorityBitmap::GetBit(GetTaskId<targetTasks>()) | ...);
+        if (events != noEvents)
+        {
+            readyTasks |= targetTasksBits;
+        }
         if (scheduleLockedCounter == 0U)
         {
             Schedule();
         }
     }
 
+    // Событие с данными для задачи с очередью (TaskWithQueue). Метод возвращает false, если очередь задачи
+    // заполнена, тогда событие не отправляется
+    template<const auto& targetTask>
+    static bool PostEvent(const typename std::decay_t<decltype(targetTask)>::tEvent& event)
+    {
+        constexpr std::uint32_t targetTaskBit = PriorityBitmap::GetBit(GetTaskId<targetTask>());
+        if (!targetTask.queue.Push(event))
+        {
+            return false;
+        }
+        const CriticalSection cs;
+        readyTasks |= targetTaskBit;
+        if (scheduleLockedCounter == 0U)
+        {
+            Schedule();
+        }
+        return true;
+    }
+
     __forceinline static void IsrEntry()
     {
         assert(scheduleLockedCounter != 255U);
@@ -50,8 +87,8 @@ class Tasker
     __forceinline static void IsrExit()
     {
         assert(scheduleLockedCounter != 0U);
-        --scheduleLockedCounter;           
-      // SCB::ICSR::PENDSVSET::PendingState::Set();       
+        --scheduleLockedCounter;
+        IsrExitProceed();
     }
 
  private:
@@ -78,7 +115,7 @@ class Tasker
         const auto preemptedTaskId = activeTaskId;
         auto nextTaskId = GetFirstActiveTaskId();
 
-        while (nextTaskId < activeTaskId)
+        while (nextTaskId < preemptedTaskId)
         {
             activeTaskId = nextTaskId;
             CallTask(nextTaskId);
@@ -88,72 +125,35 @@ class Tasker
 
     }
 
-    static constexpr size_t GetFirstActiveTaskId()
-    {
-        return GetFirstActiveTask<tasks...>(0U);
-    }
-
-    __forceinline template<const auto& task, const auto& ...args>
-    static constexpr size_t GetFirstActiveTask(size_t result)
+    __forceinline static size_t GetFirstActiveTaskId()
     {
-        if constexpr (sizeof...(args) != 0U)
-        {
-          if (task.events != noEvents)
-          {
-            return result ;
-          }
-          else
-          {
-            return GetFirstActiveTask<args...>(result + 1U) ;
-          }
-          //return (task.events != noEvents) ? result : GetFirstActiveTask<args...>(result + 1U);
-        }
-        else
-        {
-            return (task.events != noEvents) ? result : sizeof...(tasks) ;
-        }
-        assert(false);  //Dummy IAR thinks that no return from the method
-        return 0U;
+        return PriorityBitmap::GetHighest(readyTasks | noTasksBit);
     }
 
-    static void CallTask(size_t id)
+    __forceinline static void CallTask(size_t id)
     {
-        return CallTaskById<tasks...>(id, 0U);
+        taskTable[id]();
     }
 
-    __forceinline template<const auto& task, const auto& ...args>
-    static void CallTaskById(size_t id, size_t result)
+    // Номер задачи в списке задач, он же приоритет
+    template<const auto& task>
+    static constexpr size_t GetTaskId()
     {
-        if constexpr (sizeof...(args) != 0U)
-        {
-            if (result == id)
-            {
-              CallTaskHelper<task>();
-            }
-            else
-            {
-                const auto res = result + 1U;
-                CallTaskById<args...>(id, res);
-            }
-        }
-        else
-        {
-            if (result == id)
-            {
-                CallTaskHelper<task>();
-            }
-            else
-            {
-
-            }
-
-        }
+        static_assert(((static_cast<const void*>(&task) == static_cast<const void*>(&tasks)) || ...),
+                      "Task is not in the list of tasks of the scheduler");
+        size_t index = 0U;
+        size_t result = 0U;
+        static_cast<void>((((static_cast<const void*>(&task) == static_cast<const void*>(&tasks)) ?
+                            (result = index, true) : (++index, false)) || ...));
+        return result;
     }
 
-    __forceinline template<const auto& task> 
+    template<const auto& task>
     static void CallTaskHelper()
     {
+        constexpr std::uint32_t taskBit = PriorityBitmap::GetBit(GetTaskId<task>());
         task.events = noEvents;
+        readyTasks &= ~taskBit;
         __enable_interrupt();
         task.OnEvent();
         __disable_interrupt();
@@ -167,7 +167,17 @@ class Tasker
 
     static constexpr tStateEvents noEvents = tStateEvents{ 0U };
 
+    static_assert(sizeof...(tasks) <= PriorityBitmap::MaxPriorities, "Too many tasks");
+
+    // Бит после последней задачи: пустая карта готовых задач дает номер sizeof...(tasks)
+    static constexpr std::uint32_t noTasksBit =
+        (sizeof...(tasks) < PriorityBitmap::MaxPriorities) ? PriorityBitmap::GetBit(sizeof...(tasks)) : 0U;
+
+    using tTaskFunction = void (*)();
+    static constexpr tTaskFunction taskTable[] = { &CallTaskHelper<tasks>... };
+
     static inline volatile size_t activeTaskId = sizeof...(tasks);
+    static inline volatile std::uint32_t readyTasks = 0U;
     static inline Status status = Status::NotRunning;
     static inline volatile std::uint8_t scheduleLockedCounter = 1U;
 
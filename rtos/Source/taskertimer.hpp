@@ -3,21 +3,17 @@
 #pragma once
 
 #include "taskertypes.hpp" // For tTaskEvents
+#include "timerwheel.hpp"  // For TimerWheelNode
 #include "chrono"
 
 template <typename Tasker, std::uint32_t TimerFrequency, std::uint32_t msPeriod, tStateEvents eventsToPost, const auto& ...targetThreads>
 class TaskerTimer {
   public:
-    static void OnTick()
+    static void OnExpire()
     {
-      --ticksRemain ;
-      if (ticksRemain == 0U)
-      {       
-        ticksRemain = ticksReload ;
-        Tasker::template PostEvent<targetThreads...>(eventsToPost) ;
-      }
+      Tasker::template PostEvent<targetThreads...>(eventsToPost) ;
     }
-    
+
   private:
 
     static constexpr std::uint32_t msInSec = 1000UL ;
@@ -28,8 +24,11 @@ class TaskerTimer {
     static_assert((msPeriod <= 400'000U), "msPeriod too big ");
 
     static_assert((ticksReload != 0UL), "msPeriod too small");
+    static_assert((ticksReload <= TimerWheel::MaxDelay), "msPeriod too big for timer wheel");
 
-    static inline volatile std::uint32_t ticksRemain = ticksReload ;
+  public:
+    // Узел таймера в колесе TaskerTimerService, первый раз таймер срабатывает через период после запуска
+    static inline TimerWheelNode node = {nullptr, nullptr, 0U, ticksReload, &OnExpire} ;
 } ;
 
 
@@ -2,13 +2,77 @@
 // Created by by Sergey Kolody aka Lamerok on 29.03.2020.
 #pragma once
 
+#include <cstdint>             // for std::uint32_t
+#include "criticalsection.hpp" // for CriticalSection
+#include "timerwheel.hpp"      // for TimerWheel, TimerWheelNode
+
+// Сервис таймеров: таймеры TaskerTimer из списка и таймеры, запущенные во время работы, лежат в колесе
+// таймеров, поэтому работа на тик не зависит от количества таймеров
 template <typename Tasker, typename ...Timers>
 struct TaskerTimerService {
     static void OnSystemTick()
     {
         Tasker::IsrEntry() ;
-        (Timers::OnTick(), ...) ;
+        AddTimers() ;
+        wheel.Tick() ;
         Tasker::IsrExit() ;
     }
+
+    // Простой без тиков, метод вызывается из цикла простоя с запрещенными прерываниями. Системный таймер
+    // TickTimer перепрограммируется на ближайший тик, на котором у колеса есть работа, ядро спит до него или
+    // до другого прерывания, а тики, прошедшие во сне, сдвигают время колеса. Тик пробуждения обрабатывает
+    // прерывание системного таймера как обычно, поэтому таймеры срабатывают на тех же тиках, что и без сна
+    template <typename TickTimer>
+    static void Sleep()
+    {
+        AddTimers() ;
+        wheel.Skip(TickTimer::Sleep(wheel.GetTicksToNextEvent(TickTimer::MaxTicks))) ;
+    }
+
+    // Количество тиков системного таймера с запуска
+    static std::uint32_t GetTicks()
+    {
+        return wheel.Now() ;
+    }
+
+    // Метод запускает таймер во время работы: обработчик timer.callback вызывается из прерывания системного
+    // таймера через delay тиков, затем через каждые period тиков, если period не равен 0. Запущенный таймер
+    // перезапускается
+    static void StartTimer(TimerWheelNode& timer, std::uint32_t delay, std::uint32_t period)
+    {
+        const CriticalSection cs ;
+        wheel.Remove(timer) ;
+        timer.period = period ;
+        wheel.Add(timer, delay) ;
+    }
+
+    static void StopTimer(TimerWheelNode& timer)
+    {
+        const CriticalSection cs ;
+        wheel.Remove(timer) ;
+    }
+
+  private:
+    // Таймеры из списка запускаются с первым тиком, первый раз срабатывают через период
+    static void AddTimers()
+    {
+        if (!started)
+        {
+            started = true ;
+            (wheel.Add(Timers::node, Timers::node.period), ...) ;
+        }
+    }
+
+    static inline TimerWheel wheel ;
+    static inline bool started = false ;
 } ;
 
+// Цикл простоя Tasker без тиков: myTasker::Start<TicklessIdle<tRtosTimerService, SysTickTimer<16'000U>>>()
+template <typename TimerService, typename TickTimer>
+struct TicklessIdle {
+    static void OnIdle()
+    {
+        const CriticalSection cs ;
+        TimerService::template Sleep<TickTimer>() ;
+    }
+} ;
@@ -0,0 +1,163 @@
+// Filename: taskeventqueue.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <array>        // for std::array
+#include <atomic>       // for std::atomic_signal_fence
+#include <cstddef>      // for std::size_t
+#include <cstdint>      // for std::uint32_t, std::int32_t
+#include "susudefs.hpp" // for __forceinline
+
+#if defined(__ARM_FEATURE_LDREX) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+#include <intrinsics.h> // for __LDREX, __STREX, __CLREX
+#elif !defined(__riscv)
+#include <intrinsics.h> // for __get_interrupt_state, __disable_interrupt, __set_interrupt_state
+#endif
+
+// Сравнение с обменом для резервирования места в очереди несколькими источниками
+struct EventQueueAtomic
+{
+    __forceinline static bool CompareExchange(volatile std::uint32_t* ptr, std::uint32_t oldValue,
+                                              std::uint32_t newValue)
+    {
+#if defined(__ARM_FEATURE_LDREX) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+        // На Cortex M3/M4 если между чтением и записью значение изменило прерывание, то запись не
+        // выполняется, и очередь повторяет резервирование
+        if (__LDREX(ptr) != oldValue)
+        {
+            __CLREX();
+            return false;
+        }
+        return __STREX(newValue, ptr) == 0U;
+#elif defined(__riscv)
+        std::uint32_t current;
+        std::uint32_t failed = 1U;
+        __asm volatile ("1: lr.w %0, (%2)\n"
+                        "   bne %0, %3, 2f\n"
+                        "   sc.w %1, %4, (%2)\n"
+                        "2:"
+                        : "=&r"(current), "+&r"(failed)
+                        : "r"(ptr), "r"(oldValue), "r"(newValue)
+                        : "memory");
+        return failed == 0U;
+#else
+        // На Cortex M0 нет эксклюзивного доступа, поэтому на время сравнения прерывания запрещаются.
+        // На хосте это маска симулятора прерываний
+        const auto state = __get_interrupt_state();
+        __disable_interrupt();
+        const bool result = (*ptr == oldValue);
+        if (result)
+        {
+            *ptr = newValue;
+        }
+        __set_interrupt_state(state);
+        return result;
+#endif
+    }
+};
+
+enum class QueueProducers : std::uint8_t
+{
+    Single,    // События отправляет одно прерывание или одна задача
+    Multiple   // События отправляют несколько прерываний и задач
+};
+
+// Очередь событий с данными для задачи фиксированного размера. Отправлять события можно из прерываний и
+// задач без блокировки, получает их только задача-владелец. Каждая ячейка хранит номер записи, для которой
+// она свободна или заполнена: источник резервирует номер записи сравнением с обменом и помечает ячейку
+// заполненной после копирования события. Если источник вытеснен между резервированием и копированием,
+// задача останавливается на его ячейке и дочитает ее при следующем запуске. Номера в ячейках хранятся
+// за вычетом номера ячейки, поэтому очередь, заполненная нулями, пуста и готова к работе.
+template<typename T, std::size_t capacity, QueueProducers producers = QueueProducers::Multiple>
+class TaskEventQueue
+{
+    static_assert((capacity >= 2U) && ((capacity & (capacity - 1U)) == 0U), "Capacity must be power of 2");
+
+  public:
+    // Метод возвращает false, если очередь заполнена
+    bool Push(const T& event)
+    {
+        std::uint32_t position = tail;
+        for (;;)
+        {
+            const std::int32_t difference = static_cast<std::int32_t>(GetSequence(position) - position);
+            if (difference < 0)
+            {
+                return false;
+            }
+            if (difference == 0)
+            {
+                if constexpr (producers == QueueProducers::Single)
+                {
+                    tail = position + 1U;
+                    break;
+                }
+                else if (EventQueueAtomic::CompareExchange(&tail, position, position + 1U))
+                {
+                    break;
+                }
+            }
+            // Ячейку занял другой источник, который вытеснил этот
+            position = tail;
+        }
+        Cell& cell = cells[position & mask];
+        cell.event = event;
+        std::atomic_signal_fence(std::memory_order_release);
+        SetSequence(position, position + 1U);
+        return true;
+    }
+
+    // Метод возвращает false, если очередь пуста или следующее событие еще копируется
+    bool Pop(T& event)
+    {
+        const std::uint32_t position = head;
+        if (static_cast<std::int32_t>(GetSequence(position) - (position + 1U)) < 0)
+        {
+            return false;
+        }
+        std::atomic_signal_fence(std::memory_order_acquire);
+        event = cells[position & mask].event;
+        std::atomic_signal_fence(std::memory_order_release);
+        SetSequence(position, position + capacity);
+        head = position + 1U;
+        return true;
+    }
+
+    // Метод обрабатывает все события, которые есть в очереди, и возвращает их количество
+    template<typename Handler>
+    std::size_t Drain(Handler handler)
+    {
+        std::size_t count = 0U;
+        T event;
+        while (Pop(event))
+        {
+            handler(event);
+            ++count;
+        }
+        return count;
+    }
+
+  private:
+    static constexpr std::uint32_t mask = static_cast<std::uint32_t>(capacity - 1U);
+
+    struct Cell
+    {
+        volatile std::uint32_t sequence;
+        T event;
+    };
+
+    std::uint32_t GetSequence(std::uint32_t position) const
+    {
+        return cells[position & mask].sequence + (position & mask);
+    }
+
+    void SetSequence(std::uint32_t position, std::uint32_t sequence)
+    {
+        cells[position & mask].sequence = sequence - (position & mask);
+    }
+
+    std::array<Cell, capacity> cells = {};
+    volatile std::uint32_t tail = 0U;
+    volatile std::uint32_t head = 0U;
+};
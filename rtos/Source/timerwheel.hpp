@@ -0,0 +1,172 @@
+// Filename: timerwheel.hpp
+// Created by Sergey Kolody aka Lamerok on 18.10.2026.
+
+#pragma once
+
+#include <array>     // for std::array
+#include <cstddef>   // for std::size_t
+#include <cstdint>   // for std::uint32_t
+
+// Таймер в колесе таймеров. Узел хранится в самом таймере, поэтому колесо не выделяет память
+struct TimerWheelNode
+{
+    using tCallback = void (*)();
+
+    TimerWheelNode* next;
+    TimerWheelNode** link;   // Указатель, который ссылается на этот узел, nullptr - таймер не запущен
+    std::uint32_t expires;   // Номер тика срабатывания
+    std::uint32_t period;    // Период в тиках, 0 - однократный таймер
+    tCallback callback;
+};
+
+// Иерархическое колесо таймеров. Уровень 0 - Slots ячеек по одному тику, каждый следующий уровень - Slots
+// ячеек, каждая в Slots раз длиннее ячейки предыдущего уровня. Таймер кладется в ячейку самого младшего
+// уровня, на котором его задержка помещается, поэтому добавление и удаление занимают постоянное время.
+// Каждый тик обрабатывается только одна ячейка уровня 0, в которой лежат таймеры этого тика, а когда
+// индекс уровня переходит через 0, таймеры очередной ячейки следующего уровня раскладываются по младшим
+// уровням. Время работы тика не зависит от общего количества таймеров.
+class TimerWheel
+{
+  public:
+    static constexpr std::uint32_t SlotBits = 6U;
+    static constexpr std::size_t Slots = 1U << SlotBits;
+    static constexpr std::size_t Levels = 4U;
+    static constexpr std::uint32_t MaxDelay = (1UL << (SlotBits * Levels)) - 1U;
+
+    // Метод запускает таймер, который сработает через delay тиков (от 1 до MaxDelay)
+    void Add(TimerWheelNode& node, std::uint32_t delay)
+    {
+        node.expires = now + ((delay != 0U) ? delay : 1U);
+        Insert(node);
+    }
+
+    void Remove(TimerWheelNode& node)
+    {
+        if (node.link != nullptr)
+        {
+            *node.link = node.next;
+            if (node.next != nullptr)
+            {
+                node.next->link = node.link;
+            }
+            node.link = nullptr;
+        }
+    }
+
+    static bool IsActive(const TimerWheelNode& node)
+    {
+        return node.link != nullptr;
+    }
+
+    // Метод сдвигает время на тик и вызывает обработчики сработавших таймеров. Периодический таймер
+    // перезапускается до вызова обработчика от времени срабатывания, а не от текущего времени, поэтому
+    // период не накапливает ошибку
+    void Tick()
+    {
+        ++now;
+        for (std::size_t level = 1U; level < Levels; ++level)
+        {
+            if (GetIndex(level - 1U) != 0U)
+            {
+                break;
+            }
+            Cascade(level);
+        }
+        TimerWheelNode*& head = slots[0U][GetIndex(0U)];
+        while (head != nullptr)
+        {
+            TimerWheelNode& node = *head;
+            Remove(node);
+            if (node.period != 0U)
+            {
+                node.expires += node.period;
+                Insert(node);
+            }
+            node.callback();
+        }
+    }
+
+    std::uint32_t Now() const
+    {
+        return now;
+    }
+
+    // Метод возвращает количество тиков до ближайшего тика, на котором колесу есть работа: срабатывание
+    // таймера уровня 0 или раскладка непустой ячейки старшего уровня, но не больше maxTicks. Ячейка уровня
+    // level раскладывается на тике, кратном Slots в степени level, поэтому проверяются только такие тики
+    std::uint32_t GetTicksToNextEvent(std::uint32_t maxTicks) const
+    {
+        std::uint32_t result = maxTicks;
+        for (std::size_t level = 0U; level < Levels; ++level)
+        {
+            const std::uint32_t shift = SlotBits * level;
+            const std::uint32_t index = (now >> shift) + 1U;
+            // Тиков до первой раскладки (для уровня 0 - до следующего тика)
+            const std::uint32_t first = (index << shift) - now;
+            for (std::uint32_t step = 0U; step < ((level == 0U) ? (Slots - 1U) : Slots); ++step)
+            {
+                const std::uint32_t ticks = first + (step << shift);
+                if (ticks >= result)
+                {
+                    break;
+                }
+                if (slots[level][(index + step) & slotMask] != nullptr)
+                {
+                    result = ticks;
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    // Метод сдвигает время на ticks тиков без обработки ячеек, ticks должно быть меньше, чем
+    // GetTicksToNextEvent(): так учитываются тики, пропущенные во время сна
+    void Skip(std::uint32_t ticks)
+    {
+        now += ticks;
+    }
+
+  private:
+    static constexpr std::uint32_t slotMask = static_cast<std::uint32_t>(Slots - 1U);
+
+    std::uint32_t GetIndex(std::size_t level) const
+    {
+        return (now >> (SlotBits * level)) & slotMask;
+    }
+
+    void Insert(TimerWheelNode& node)
+    {
+        const std::uint32_t delay = node.expires - now;
+        std::size_t level = 0U;
+        while ((level < (Levels - 1U)) && (delay >= (1UL << (SlotBits * (level + 1U)))))
+        {
+            ++level;
+        }
+        TimerWheelNode*& head = slots[level][(node.expires >> (SlotBits * level)) & slotMask];
+        node.next = head;
+        if (head != nullptr)
+        {
+            head->link = &node.next;
+        }
+        head = &node;
+        node.link = &head;
+    }
+
+    // Таймеры ячейки уровня level раскладываются по младшим уровням
+    void Cascade(std::size_t level)
+    {
+        TimerWheelNode*& head = slots[level][GetIndex(level)];
+        TimerWheelNode* node = head;
+        head = nullptr;
+        while (node != nullptr)
+        {
+            TimerWheelNode* next = node->next;
+            Insert(*node);
+            node = next;
+        }
+    }
+
+    std::array<std::array<TimerWheelNode*, Slots>, Levels> slots = {};
+    std::uint32_t now = 0U;
+};